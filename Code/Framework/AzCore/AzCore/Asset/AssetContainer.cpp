@@ -9,6 +9,7 @@
 #include <AzCore/Outcome/Outcome.h>
 #include <AzCore/Asset/AssetManagerBus.h>
 #include <AzCore/Asset/AssetManager.h>
+#include <AzCore/Asset/AssetDataStream.h>
 
 namespace AZ
 {
@@ -196,34 +197,42 @@ namespace AZ
                 dependencyAssets.emplace_back(thisInfo, AZStd::move(dependentAsset));
             }
 
-            // Queue the loading of all of the dependent assets before loading the root asset.  
-            for (auto& [dependentAssetInfo, dependentAsset] : dependencyAssets)
+            // Collect the file reads for the dependent assets and the root asset so they're handed to the streamer as a single batch
+            // once all of them have been queued. This allows the streamer to read the entire dependency graph in the order it's
+            // stored on disk, instead of the order in which the dependencies happen to be listed.
+            Asset<AssetData> thisAsset;
             {
-                // Queue each asset to load.
-                auto queuedDependentAsset = AssetManager::Instance().GetAssetInternal(
-                    dependentAsset.GetId(), dependentAsset.GetType(),
-                    AZ::Data::AssetLoadBehavior::Default, loadParamsCopyWithNoLoadingFilter,
-                    dependentAssetInfo, HasPreloads(dependentAsset.GetId()));
-
-                // Verify that the returned asset reference matches the one that we found or created and queued to load.
-                AZ_Assert(dependentAsset == queuedDependentAsset, "GetAssetInternal returned an unexpected asset reference for Asset %s",
-                    dependentAsset.GetId().ToString<AZStd::string>().c_str());
-            }
+                AssetDataStream::ReadBatchScope readBatch;
 
-            // Add all of the queued dependent assets as dependencies
-            {
-                AZStd::lock_guard<AZStd::recursive_mutex> dependencyLock(m_dependencyMutex);
+                // Queue the loading of all of the dependent assets before loading the root asset.  
                 for (auto& [dependentAssetInfo, dependentAsset] : dependencyAssets)
                 {
-                    AddDependency(AZStd::move(dependentAsset));
+                    // Queue each asset to load.
+                    auto queuedDependentAsset = AssetManager::Instance().GetAssetInternal(
+                        dependentAsset.GetId(), dependentAsset.GetType(),
+                        AZ::Data::AssetLoadBehavior::Default, loadParamsCopyWithNoLoadingFilter,
+                        dependentAssetInfo, HasPreloads(dependentAsset.GetId()));
+
+                    // Verify that the returned asset reference matches the one that we found or created and queued to load.
+                    AZ_Assert(dependentAsset == queuedDependentAsset, "GetAssetInternal returned an unexpected asset reference for Asset %s",
+                        dependentAsset.GetId().ToString<AZStd::string>().c_str());
+                }
+
+                // Add all of the queued dependent assets as dependencies
+                {
+                    AZStd::lock_guard<AZStd::recursive_mutex> dependencyLock(m_dependencyMutex);
+                    for (auto& [dependentAssetInfo, dependentAsset] : dependencyAssets)
+                    {
+                        AddDependency(AZStd::move(dependentAsset));
+                    }
                 }
-            }
 
-            // Finally, after creating and queueing the dependent assets, queue the root asset.  This is saved until last to ensure that
-            // it doesn't have any chance of serializing in until after all the dependent assets have been queued for loading and have
-            // been added to the list of dependencies.
-            auto thisAsset = AssetManager::Instance().GetAssetInternal(rootAssetId, rootAssetType, rootAsset.GetAutoLoadBehavior(),
-                loadParamsCopyWithNoLoadingFilter, AssetInfo(), HasPreloads(rootAssetId));
+                // Finally, after creating and queueing the dependent assets, queue the root asset.  This is saved until last to ensure that
+                // it doesn't have any chance of serializing in until after all the dependent assets have been queued for loading and have
+                // been added to the list of dependencies.
+                thisAsset = AssetManager::Instance().GetAssetInternal(rootAssetId, rootAssetType, rootAsset.GetAutoLoadBehavior(),
+                    loadParamsCopyWithNoLoadingFilter, AssetInfo(), HasPreloads(rootAssetId));
+            }
 
             if (!thisAsset)
             {
@@ -9,6 +9,114 @@
 
 namespace AZ::Data
 {
+    namespace
+    {
+        AZ_THREAD_LOCAL AssetDataStream::ReadBatchScope* s_activeReadBatch = nullptr;
+    }
+
+    AssetDataStream::ReadBatchScope::ReadBatchScope()
+    {
+        if (!s_activeReadBatch)
+        {
+            s_activeReadBatch = this;
+            m_isOutermost = true;
+        }
+    }
+
+    AssetDataStream::ReadBatchScope::~ReadBatchScope()
+    {
+        if (m_isOutermost)
+        {
+            Flush();
+            s_activeReadBatch = nullptr;
+        }
+    }
+
+    void AssetDataStream::ReadBatchScope::FlushActiveScope()
+    {
+        if (s_activeReadBatch)
+        {
+            s_activeReadBatch->Flush();
+        }
+    }
+
+    void AssetDataStream::ReadBatchScope::Flush()
+    {
+        if (!m_requests.empty())
+        {
+            AZ::Interface<AZ::IO::IStreamer>::Get()->QueueRequestBatch(AZStd::move(m_requests));
+            m_requests = {};
+        }
+    }
+
+    void AssetDataStream::QueueReadRequest(const AZ::IO::FileRequestPtr& request)
+    {
+        if (s_activeReadBatch)
+        {
+            s_activeReadBatch->m_requests.push_back(request);
+        }
+        else
+        {
+            AZ::Interface<AZ::IO::IStreamer>::Get()->QueueRequest(request);
+        }
+    }
+
+    AssetDataStream::ClaimedBuffer::~ClaimedBuffer()
+    {
+        Reset();
+    }
+
+    AssetDataStream::ClaimedBuffer::ClaimedBuffer(ClaimedBuffer&& rhs)
+        : m_stream(AZStd::move(rhs.m_stream))
+        , m_data(rhs.m_data)
+        , m_size(rhs.m_size)
+    {
+        rhs.m_data = nullptr;
+        rhs.m_size = 0;
+    }
+
+    auto AssetDataStream::ClaimedBuffer::operator=(ClaimedBuffer&& rhs) -> ClaimedBuffer&
+    {
+        if (this != &rhs)
+        {
+            Reset();
+            m_stream = AZStd::move(rhs.m_stream);
+            m_data = rhs.m_data;
+            m_size = rhs.m_size;
+            rhs.m_data = nullptr;
+            rhs.m_size = 0;
+        }
+        return *this;
+    }
+
+    void AssetDataStream::ClaimedBuffer::Reset()
+    {
+        if (m_stream)
+        {
+            // The stream will release the data when it closes, which happens at the latest when the last reference is released.
+            m_stream->m_bufferClaimed = false;
+            m_stream.reset();
+        }
+        m_data = nullptr;
+        m_size = 0;
+    }
+
+    auto AssetDataStream::ClaimBuffer(const AZStd::shared_ptr<AssetDataStream>& stream) -> ClaimedBuffer
+    {
+        ClaimedBuffer result;
+        if (stream && stream->IsFullyLoaded() && stream->m_buffer && !stream->m_bufferClaimed)
+        {
+            stream->m_bufferClaimed = true;
+            // Nothing can be read from the stream anymore, the data belongs to the claimed buffer now.
+            stream->m_curOffset = stream->m_loadedSize;
+
+            result.m_stream = stream;
+            result.m_data = stream->m_buffer;
+            result.m_size = stream->m_loadedSize;
+        }
+        return result;
+    }
+
     AssetDataStream::AssetDataStream(AZ::IO::IStreamerTypes::RequestMemoryAllocator* bufferAllocator)
         : m_bufferAllocator(bufferAllocator ? bufferAllocator : &m_defaultAllocator)
     {
@@ -128,7 +236,7 @@ namespace AZ::Data
             m_curPriority = priority;
             streamer->SetRequestCompleteCallback(m_curReadRequest, streamerCallback);
 
-            streamer->QueueRequest(m_curReadRequest);
+            QueueReadRequest(m_curReadRequest);
         }
         else
         {
@@ -158,6 +266,9 @@ namespace AZ::Data
 
     void AssetDataStream::BlockUntilLoadComplete()
     {
+        // Make sure the read is actually queued if it was started inside a batch on this thread.
+        ReadBatchScope::FlushActiveScope();
+
         AZStd::unique_lock<AZStd::mutex> lock(m_readRequestMutex);
         m_readRequestActive.wait(lock, [this] { return m_curReadRequest == nullptr; });
         lock.unlock();
@@ -204,6 +315,7 @@ namespace AZ::Data
     {
         AZ_Assert(m_isOpen, "Attempting to close a stream that hasn't been opened.");
         AZ_Assert(m_curReadRequest == nullptr, "Attempting to close a stream with a read request in flight.");
+        AZ_Assert(!m_bufferClaimed, "Attempting to close a stream while its data is still used by a claimed buffer.");
 
         // Destroy the asset buffer and unlock the allocator, so the allocator itself knows that it is no longer needed.
         if (m_buffer != m_preloadedData.data())
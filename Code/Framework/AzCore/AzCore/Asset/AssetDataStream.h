@@ -11,6 +11,7 @@
 #include <AzCore/IO/IStreamer.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/parallel/condition_variable.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <AzCore/Asset/AssetCommon.h>
 #include <AzCore/Debug/Profiler.h>
 
@@ -27,6 +28,68 @@ namespace AZ::Data
         explicit AssetDataStream(AZ::IO::IStreamerTypes::RequestMemoryAllocator* bufferAllocator = nullptr);
         ~AssetDataStream() override;
 
+        //! Collects the file reads of all AssetDataStreams that are opened on the current thread while the scope is alive and
+        //! queues them with the file streamer as a single batch when the scope ends. Seeing all the reads at the same time allows
+        //! the streamer to service them in the order they're stored on disk instead of the order they were requested in.
+        //! Nested scopes add their reads to the outermost scope.
+        class ReadBatchScope
+        {
+        public:
+            ReadBatchScope();
+            ~ReadBatchScope();
+
+            ReadBatchScope(const ReadBatchScope&) = delete;
+            ReadBatchScope& operator=(const ReadBatchScope&) = delete;
+
+            //! Queues the reads collected so far by the active scope on the current thread, if there is one. This needs to be
+            //! called before blocking on a read that may have been started by the current thread.
+            static void FlushActiveScope();
+
+        private:
+            friend class AssetDataStream;
+
+            void Flush();
+
+            AZStd::vector<AZ::IO::FileRequestPtr> m_requests;
+            bool m_isOutermost{ false };
+        };
+
+        //! The loaded data of an AssetDataStream that has been claimed by an asset handler. The buffer keeps the stream alive, so the
+        //! data stays valid without being copied for as long as the buffer exists. The data is returned to the allocator it was read
+        //! with when the buffer is destroyed. Handlers that provide their own allocator through AssetHandler::GetAssetBufferAllocator
+        //! need to keep it alive until then.
+        class ClaimedBuffer
+        {
+        public:
+            ClaimedBuffer() = default;
+            ~ClaimedBuffer();
+
+            ClaimedBuffer(const ClaimedBuffer&) = delete;
+            ClaimedBuffer& operator=(const ClaimedBuffer&) = delete;
+            ClaimedBuffer(ClaimedBuffer&& rhs);
+            ClaimedBuffer& operator=(ClaimedBuffer&& rhs);
+
+            void* GetData() const { return m_data; }
+            size_t GetSize() const { return m_size; }
+
+            explicit operator bool() const { return m_data != nullptr; }
+
+        private:
+            friend class AssetDataStream;
+
+            void Reset();
+
+            AZStd::shared_ptr<AssetDataStream> m_stream;
+            void* m_data{ nullptr };
+            size_t m_size{ 0 };
+        };
+
+        //! Hands the loaded data of the stream to the caller, which allows asset handlers to use the data the streamer read directly
+        //! instead of copying it into the asset. The stream needs to be fully loaded. Afterwards the stream will have no more data
+        //! to read.
+        //! @return The claimed data or an empty buffer if the stream isn't fully loaded or the data has already been claimed.
+        static ClaimedBuffer ClaimBuffer(const AZStd::shared_ptr<AssetDataStream>& stream);
+
         // Open the AssetDataStream and make a copy of the provided memory buffer.
         void Open(const AZStd::vector<AZ::u8>& data);
 
@@ -87,6 +150,9 @@ namespace AZ::Data
 
         void ClearInternalStateData();
 
+        //! Queues the read with the file streamer or adds it to the active ReadBatchScope.
+        static void QueueReadRequest(const AZ::IO::FileRequestPtr& request);
+
         //! The allocator to use for allocating / deallocating asset buffers
         AZ::IO::IStreamerTypes::RequestMemoryAllocator* m_bufferAllocator{ nullptr };
 
@@ -131,6 +197,9 @@ namespace AZ::Data
         //! Track whether or not the stream is currently open
         bool m_isOpen{ false };
 
+        //! Whether or not the loaded data is owned by a ClaimedBuffer.
+        bool m_bufferClaimed{ false };
+
     };
 
 } // AZ::Data
@@ -820,6 +820,9 @@ namespace AZ
                 // since the main thread is typically responsible for calling DispatchEvents elsewhere
                 const bool shouldDispatch = AZStd::this_thread::get_id() == m_mainThreadId;
 
+                // Reads that have been collected in a batch on this thread would otherwise not be started until after the wait.
+                AssetDataStream::ReadBatchScope::FlushActiveScope();
+
                 // Wait for the asset and all queued dependencies to finish loading.
                 WaitForAsset blockingWait(asset, shouldDispatch);
 
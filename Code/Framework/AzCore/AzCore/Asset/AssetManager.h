@@ -17,6 +17,7 @@
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/string/string.h>
+#include <AzCore/std/containers/flat_hash_map.h>
 #include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/containers/intrusive_list.h>
 #include <AzCore/std/parallel/binary_semaphore.h>
@@ -152,7 +153,7 @@ namespace AZ
 
             typedef AZStd::unordered_map<AssetType, AssetHandler*> AssetHandlerMap;
             typedef AZStd::unordered_map<AssetType, AssetCatalog*> AssetCatalogMap;
-            typedef AZStd::unordered_map<AssetId, AssetData*> AssetMap;
+            typedef AZStd::flat_hash_map<AssetId, AssetData*> AssetMap;
             typedef AZStd::unordered_map<AssetContainerKey, AZStd::weak_ptr<AssetContainer>> WeakAssetContainerMap;
             typedef AZStd::unordered_map<AssetContainer*, AZStd::shared_ptr<AssetContainer>> OwnedAssetContainerMap;
 
@@ -568,6 +569,8 @@ namespace AZ
             virtual void GetCustomAssetStreamInfoForLoad([[maybe_unused]] AssetStreamInfo& streamInfo) {}
 
             //! Asset Handlers have the ability to provide custom asset buffer allocators for any non-standard allocation needs.
+            //! Combined with AssetDataStream::ClaimBuffer this allows the streamer to read directly into the final destination of
+            //! the data, such as a mapped upload buffer, without the handler copying it.
             virtual IO::IStreamerTypes::RequestMemoryAllocator* GetAssetBufferAllocator() { return nullptr; }
 
             virtual void GetDefaultAssetLoadPriority([[maybe_unused]] AssetType type, AZStd::chrono::milliseconds& defaultDeadline,
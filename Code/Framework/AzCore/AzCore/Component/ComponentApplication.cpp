@@ -22,6 +22,7 @@
 #include <AzCore/Memory/OverrunDetectionAllocator.h>
 #include <AzCore/Memory/AllocatorManager.h>
 #include <AzCore/Memory/MallocSchema.h>
+#include <AzCore/Memory/MemoryBudgetTracker.h>
 
 #include <AzCore/NativeUI/NativeUIRequests.h>
 
@@ -103,6 +104,10 @@ namespace AZ
     static EnvironmentVariable<ReflectionEnvironment> s_reflectionEnvironment;
     static const char* s_reflectionEnvironmentName = "ReflectionEnvironment";
 
+    //! When true, types are only reflected to the BehaviorContext the first time it is requested, for applications
+    //! (e.g. headless servers) that may never run scripts
+    static constexpr const char* s_deferBehaviorContextReflectionKey = "/Amazon/AzCore/Application/DeferBehaviorContextReflection";
+
     void ReflectionEnvironment::Init()
     {
         s_reflectionEnvironment = AZ::Environment::CreateVariable<ReflectionEnvironment>(s_reflectionEnvironmentName);
@@ -155,6 +160,7 @@ namespace AZ
         m_reservedDebug = 0;
         m_recordingMode = Debug::AllocationRecords::RECORD_STACK_IF_NO_FILE_LINE;
         m_stackRecordLevels = 5;
+        m_allocationRecordsSamplingInterval = Debug::AllocationRecords::DefaultSamplingInterval;
         m_enableDrilling = false;
         m_useOverrunDetection = false;
         m_useMalloc = false;
@@ -304,6 +310,7 @@ namespace AZ
                 ->Field("allocationRecordsAttemptDecodeImmediately", &Descriptor::m_allocationRecordsAttemptDecodeImmediately)
                 ->Field("recordingMode", &Descriptor::m_recordingMode)
                 ->Field("stackRecordLevels", &Descriptor::m_stackRecordLevels)
+                ->Field("allocationRecordsSamplingInterval", &Descriptor::m_allocationRecordsSamplingInterval)
                 ->Field("autoIntegrityCheck", &Descriptor::m_autoIntegrityCheck)
                 ->Field("markUnallocatedMemory", &Descriptor::m_markUnallocatedMemory)
                 ->Field("doNotUsePools", &Descriptor::m_doNotUsePools)
@@ -327,7 +334,8 @@ namespace AZ
                     ->Value("No records", Debug::AllocationRecords::RECORD_NO_RECORDS)
                     ->Value("No stack trace", Debug::AllocationRecords::RECORD_STACK_NEVER)
                     ->Value("Stack trace when file/line missing", Debug::AllocationRecords::RECORD_STACK_IF_NO_FILE_LINE)
-                    ->Value("Stack trace always", Debug::AllocationRecords::RECORD_FULL);
+                    ->Value("Stack trace always", Debug::AllocationRecords::RECORD_FULL)
+                    ->Value("Sampled allocations with stack trace", Debug::AllocationRecords::RECORD_SAMPLED);
                 ec->Class<Descriptor>("System memory settings", "Settings for managing application memory usage")
                     ->ClassElement(Edit::ClassElements::EditorData, "")
                         ->Attribute(Edit::Attributes::AutoExpand, true)
@@ -339,6 +347,8 @@ namespace AZ
                     ->DataElement(Edit::UIHandlers::SpinBox, &Descriptor::m_stackRecordLevels, "Stack entries to record", "Number of stack levels to record for each allocation (ignored in Release builds)")
                         ->Attribute(Edit::Attributes::Step, 1)
                         ->Attribute(Edit::Attributes::Max, 1024)
+                    ->DataElement(Edit::UIHandlers::SpinBox, &Descriptor::m_allocationRecordsSamplingInterval, "Sampling interval", "Average number of bytes between two recorded allocations in sampled recording mode (ignored in Release builds)")
+                        ->Attribute(Edit::Attributes::Min, 1)
                     ->DataElement(Edit::UIHandlers::CheckBox, &Descriptor::m_autoIntegrityCheck, "Validate allocations", "Check allocations for integrity on each allocation/free (ignored in Release builds)")
                     ->DataElement(Edit::UIHandlers::CheckBox, &Descriptor::m_markUnallocatedMemory, "Mark freed memory", "Set memory to 0xcd when a block is freed for debugging (ignored in Release builds)")
                     ->DataElement(Edit::UIHandlers::CheckBox, &Descriptor::m_doNotUsePools, "Don't pool allocations", "Pipe pool allocations in system/tree heap (ignored in Release builds)")
@@ -603,6 +613,8 @@ namespace AZ
         CreateCommon();
         AZ_Assert(m_systemEntity, "SystemEntity failed to initialize!");
 
+        m_memoryBudgetTracker = AZStd::make_unique<MemoryBudgetTracker>();
+
         AddRequiredSystemComponents(m_systemEntity.get());
         m_isStarted = true;
         return m_systemEntity.get();
@@ -728,6 +740,8 @@ namespace AZ
 
         static_cast<SettingsRegistryImpl*>(m_settingsRegistry.get())->ClearNotifiers();
 
+        m_memoryBudgetTracker.reset();
+
         // Uninit and unload any dynamic modules.
         m_moduleManager->UnloadModules();
 
@@ -860,6 +874,7 @@ namespace AZ
                 records->SetMode(m_descriptor.m_recordingMode);
                 records->SetSaveNames(m_descriptor.m_allocationRecordsSaveNames);
                 records->SetDecodeImmediately(m_descriptor.m_allocationRecordsAttemptDecodeImmediately);
+                records->SetSamplingInterval(aznumeric_caster(m_descriptor.m_allocationRecordsSamplingInterval));
                 records->AutoIntegrityCheck(m_descriptor.m_autoIntegrityCheck);
                 records->MarkUallocatedMemory(m_descriptor.m_markUnallocatedMemory);
             }
@@ -959,12 +974,21 @@ namespace AZ
         //!    2. <cache_root>/Registry
         //!    3. <project_build_path>/bin/$<CONFIG>/Registry
         //! 3. MergeSettingsToRegistry_GemRegistries - Merges the settings registry files from each gem's <GemRoot>/Registry directory
-
-        SettingsRegistryMergeUtils::MergeSettingsToRegistry_TargetBuildDependencyRegistry(registry,
-            AZ_TRAIT_OS_PLATFORM_CODENAME, specializations, &scratchBuffer);
-        SettingsRegistryMergeUtils::MergeSettingsToRegistry_EngineRegistry(registry, AZ_TRAIT_OS_PLATFORM_CODENAME, specializations, &scratchBuffer);
-        SettingsRegistryMergeUtils::MergeSettingsToRegistry_GemRegistries(registry, AZ_TRAIT_OS_PLATFORM_CODENAME, specializations, &scratchBuffer);
-        SettingsRegistryMergeUtils::MergeSettingsToRegistry_ProjectRegistry(registry, AZ_TRAIT_OS_PLATFORM_CODENAME, specializations, &scratchBuffer);
+        //! These merges only depend on the registry and the files, so in development builds they are loaded from a binary cache
+        //! after the first run.
+        auto mergeProjectRegistries = [&registry, &specializations, &scratchBuffer]()
+        {
+            SettingsRegistryMergeUtils::MergeSettingsToRegistry_TargetBuildDependencyRegistry(registry,
+                AZ_TRAIT_OS_PLATFORM_CODENAME, specializations, &scratchBuffer);
+            SettingsRegistryMergeUtils::MergeSettingsToRegistry_EngineRegistry(registry, AZ_TRAIT_OS_PLATFORM_CODENAME, specializations, &scratchBuffer);
+            SettingsRegistryMergeUtils::MergeSettingsToRegistry_GemRegistries(registry, AZ_TRAIT_OS_PLATFORM_CODENAME, specializations, &scratchBuffer);
+            SettingsRegistryMergeUtils::MergeSettingsToRegistry_ProjectRegistry(registry, AZ_TRAIT_OS_PLATFORM_CODENAME, specializations, &scratchBuffer);
+        };
+#if defined(AZ_DEBUG_BUILD) || defined(AZ_PROFILE_BUILD)
+        SettingsRegistryMergeUtils::MergeSettingsToRegistry_Cached(registry, AZ_TRAIT_OS_PLATFORM_CODENAME, specializations, mergeProjectRegistries);
+#else
+        mergeProjectRegistries();
+#endif
 #if defined(AZ_DEBUG_BUILD) || defined(AZ_PROFILE_BUILD)
         SettingsRegistryMergeUtils::MergeSettingsToRegistry_O3deUserRegistry(registry, AZ_TRAIT_OS_PLATFORM_CODENAME, specializations, &scratchBuffer);
         SettingsRegistryMergeUtils::MergeSettingsToRegistry_CommandLine(registry, m_commandLine, false);
@@ -1172,7 +1196,17 @@ namespace AZ
         ReflectionEnvironment::Init();
 
         ReflectionEnvironment::GetReflectionManager()->AddReflectContext<SerializeContext>();
-        ReflectionEnvironment::GetReflectionManager()->AddReflectContext<BehaviorContext>();
+
+        bool deferBehaviorContextReflection = false;
+        m_settingsRegistry->Get(deferBehaviorContextReflection, s_deferBehaviorContextReflectionKey);
+        if (deferBehaviorContextReflection)
+        {
+            ReflectionEnvironment::GetReflectionManager()->AddDeferredReflectContext<BehaviorContext>();
+        }
+        else
+        {
+            ReflectionEnvironment::GetReflectionManager()->AddReflectContext<BehaviorContext>();
+        }
         ReflectionEnvironment::GetReflectionManager()->AddReflectContext<JsonRegistrationContext>();
     }
 
@@ -1412,9 +1446,13 @@ namespace AZ
             m_currentTime = now;
             {
                 AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::AzCore, "ComponentApplication::Tick:OnTick");
-                EBUS_EVENT(TickBus, OnTick, m_deltaTime, ScriptTimePoint(now));
+                TickBusBroadcastOnTick(m_deltaTime, ScriptTimePoint(now));
             }
         }
+        if (m_memoryBudgetTracker)
+        {
+            m_memoryBudgetTracker->OnTick(m_deltaTime);
+        }
         if (m_drillerManager)
         {
             m_drillerManager->FrameUpdate();
@@ -23,6 +23,7 @@
 #include <AzCore/Settings/CommandLine.h>
 #include <AzCore/Settings/SettingsRegistry.h>
 #include <AzCore/Settings/SettingsRegistryConsoleUtils.h>
+#include <AzCore/std/containers/flat_hash_map.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/std/string/conversions.h>
@@ -32,6 +33,7 @@ namespace AZ
 {
     class BehaviorContext;
     class IConsole;
+    class MemoryBudgetTracker;
     class Module;
     class ModuleManager;
 }
@@ -77,8 +79,8 @@ namespace AZ
         : public ComponentApplicationBus::Handler
         , public TickRequestBus::Handler
     {
-        // or try to use unordered set if we store the ID internally
-        typedef AZStd::unordered_map<EntityId, Entity*>  EntitySetType;
+        // Looked up for every EntityId resolution, the open addressing map keeps the lookups to one or two cache lines
+        typedef AZStd::flat_hash_map<EntityId, Entity*>  EntitySetType;
 
     public:
         AZ_RTTI(ComponentApplication, "{1F3B070F-89F7-4C3D-B5A3-8832D5BC81D7}");
@@ -139,6 +141,7 @@ namespace AZ
             AZ::u64         m_reservedDebug;            //!< Reserved memory for Debugging (allocation,etc.). Used only when m_grabAllMemory is set to true. (default: 0)
             Debug::AllocationRecords::Mode m_recordingMode; //!< When to record stack traces (default: AZ::Debug::AllocationRecords::RECORD_STACK_IF_NO_FILE_LINE)
             AZ::u64         m_stackRecordLevels;        //!< If stack recording is enabled, how many stack levels to record. (default: 5)
+            AZ::u64         m_allocationRecordsSamplingInterval; //!< Average number of bytes between two recorded allocations when the recording mode is RECORD_SAMPLED. (default: AZ::Debug::AllocationRecords::DefaultSamplingInterval)
             bool            m_enableDrilling;           //!< True to enabled drilling support for the application. RegisterDrillers will be called. Ignored in release. (default: true)
             bool            m_useOverrunDetection;      //!< True to use the overrun detection memory management scheme. Only available on some platforms; greatly increases memory consumption.
             bool            m_useMalloc;                //!< True to use malloc instead of the internal memory manager. Intended for debugging purposes only.
@@ -379,6 +382,7 @@ namespace AZ
         float                                       m_deltaTime{ 0.0f };
         AZStd::unique_ptr<ModuleManager>            m_moduleManager;
         AZStd::unique_ptr<SettingsRegistryInterface> m_settingsRegistry;
+        AZStd::unique_ptr<MemoryBudgetTracker>      m_memoryBudgetTracker;
         EntityAddedEvent                            m_entityAddedEvent;
         EntityRemovedEvent                          m_entityRemovedEvent;
         EntityAddedEvent                            m_entityActivatedEvent;
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/Jobs/Algorithms.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ
+{
+    void TickBusBroadcastOnTick(float deltaTime, ScriptTimePoint time)
+    {
+        JobContext* jobContext = JobContext::GetGlobalContext();
+
+        // Thread-safe handlers of the current tick order that haven't been ticked yet.
+        AZStd::vector<TickEvents*> parallelHandlers;
+        int parallelTickOrder = 0;
+
+        auto tickParallelHandlers = [&parallelHandlers, jobContext, deltaTime, &time]()
+        {
+            if (parallelHandlers.size() == 1)
+            {
+                TickEvents::EventProcessingPolicy::Call(&TickEvents::OnTick, parallelHandlers.front(), deltaTime, time);
+            }
+            else if (!parallelHandlers.empty())
+            {
+                parallel_for(size_t{ 0 }, parallelHandlers.size(), [&parallelHandlers, deltaTime, &time](size_t index)
+                    {
+                        TickEvents::EventProcessingPolicy::Call(&TickEvents::OnTick, parallelHandlers[index], deltaTime, time);
+                    }, jobContext);
+            }
+            parallelHandlers.clear();
+        };
+
+        TickBus::EnumerateHandlers([&](TickEvents* handler)
+            {
+                if (jobContext && handler->IsTickThreadSafe())
+                {
+                    const int tickOrder = handler->GetTickOrder();
+                    if (!parallelHandlers.empty() && tickOrder != parallelTickOrder)
+                    {
+                        tickParallelHandlers();
+                    }
+                    parallelTickOrder = tickOrder;
+                    parallelHandlers.push_back(handler);
+                }
+                else
+                {
+                    // Handlers that aren't thread-safe keep their position relative to the parallel handlers.
+                    tickParallelHandlers();
+                    handler->OnTick(deltaTime, time);
+                }
+                return true;
+            });
+        tickParallelHandlers();
+    }
+} // namespace AZ
@@ -137,6 +137,18 @@ namespace AZ
             return m_tickOrder;
         }
 
+        /**
+         * Opts the handler in to parallel ticking. Consecutive handlers with the same tick order that return true
+         * are ticked in parallel on the job system by TickBusBroadcastOnTick().
+         * A thread-safe handler must not touch state shared with other handlers in OnTick() without synchronization
+         * and must not connect to or disconnect from the TickBus while it's being ticked.
+         * @return True if OnTick() can be called on a job thread concurrently with other thread-safe handlers.
+         */
+        virtual bool    IsTickThreadSafe()
+        {
+            return false;
+        }
+
     protected:
         // Only the component application is allowed to issue ticks.
         friend class ComponentApplication;
@@ -153,6 +165,16 @@ namespace AZ
      * The events are defined in the AZ::TickEvents class.
      */
     typedef AZ::EBus<TickEvents>    TickBus;
+
+    /**
+     * Broadcasts TickEvents::OnTick to all TickBus handlers in tick order.
+     * Consecutive handlers with the same tick order that are thread-safe (see TickEvents::IsTickThreadSafe()) are
+     * ticked in parallel on the global job context, all other handlers are ticked on the calling thread.
+     * If there's no global job context all handlers are ticked on the calling thread.
+     * @param deltaTime The delta (in seconds) from the previous tick and the current time.
+     * @param time The current time.
+     */
+    void TickBusBroadcastOnTick(float deltaTime, ScriptTimePoint time);
     
     /**
      * Interface for AZ::TickRequestBus, which components use to make tick-related 
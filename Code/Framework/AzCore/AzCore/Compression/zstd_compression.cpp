@@ -15,6 +15,38 @@
 
 using namespace AZ;
 
+namespace
+{
+    // The advanced streaming api was stabilized with different names in zstd 1.4
+#if ZSTD_VERSION_NUMBER >= 10400
+    constexpr ZSTD_cParameter CompressionLevelParameter = ZSTD_c_compressionLevel;
+    constexpr ZSTD_cParameter NumWorkersParameter = ZSTD_c_nbWorkers;
+
+    size_t CompressStream(ZSTD_CCtx* context, ZSTD_outBuffer* output, ZSTD_inBuffer* input, ZSTD_EndDirective endDirective)
+    {
+        return ZSTD_compressStream2(context, output, input, endDirective);
+    }
+
+    void ResetCompressionSession(ZSTD_CCtx* context)
+    {
+        ZSTD_CCtx_reset(context, ZSTD_reset_session_only);
+    }
+#else
+    constexpr ZSTD_cParameter CompressionLevelParameter = ZSTD_p_compressionLevel;
+    constexpr ZSTD_cParameter NumWorkersParameter = ZSTD_p_nbWorkers;
+
+    size_t CompressStream(ZSTD_CCtx* context, ZSTD_outBuffer* output, ZSTD_inBuffer* input, ZSTD_EndDirective endDirective)
+    {
+        return ZSTD_compress_generic(context, output, input, endDirective);
+    }
+
+    void ResetCompressionSession(ZSTD_CCtx* context)
+    {
+        ZSTD_CCtx_reset(context);
+    }
+#endif
+}
+
 ZStd::ZStd(IAllocatorAllocate* workMemAllocator)
 {
     m_workMemoryAllocator = workMemAllocator;
@@ -50,42 +82,96 @@ void ZStd::FreeMem(void* userData, void* address)
     allocator->DeAllocate(address);
 }
 
-void ZStd::StartCompressor(unsigned int compressionLevel)
+void ZStd::StartCompressor(unsigned int compressionLevel, unsigned int numWorkers)
 {
     AZ_Assert(!m_streamCompression, "Compressor already started!");
     ZSTD_customMem customAlloc;
     customAlloc.customAlloc = reinterpret_cast<ZSTD_allocFunction>(&AllocateMem);
     customAlloc.customFree = &FreeMem;
+    customAlloc.opaque = m_workMemoryAllocator;
 
-    AZ_UNUSED(compressionLevel);
-    m_streamCompression = (ZSTD_createCStream_advanced(customAlloc));
+    m_streamCompression = ZSTD_createCCtx_advanced(customAlloc);
     AZ_Assert( m_streamCompression , "ZStandard internal error - failed to create compression stream\n");
+    m_isCompressingFrame = false;
+
+    size_t result = ZSTD_CCtx_setParameter(m_streamCompression, CompressionLevelParameter, compressionLevel);
+    AZ_Assert(!ZSTD_isError(result), "ZStandard internal error: %s", ZSTD_getErrorName(result));
+    if (numWorkers > 0)
+    {
+        // Fails when the library is built without ZSTD_MULTITHREAD, compression then stays on the calling thread
+        result = ZSTD_CCtx_setParameter(m_streamCompression, NumWorkersParameter, numWorkers);
+        AZ_Warning("ZStandard", !ZSTD_isError(result), "Multi-threaded compression is unavailable: %s", ZSTD_getErrorName(result));
+    }
 }
 
 void ZStd::StopCompressor()
 {
     AZ_Assert(m_streamCompression, "Compressor not started!");
-    ZSTD_endStream(m_streamCompression, nullptr);
-    FreeMem(m_workMemoryAllocator, m_streamCompression);
+    size_t result = ZSTD_freeCCtx(m_streamCompression);
+    AZ_Verify(!ZSTD_isError(result), "ZStandard internal error: %s", ZSTD_getErrorName(result));
     m_streamCompression = nullptr;
 }
 
 void ZStd::ResetCompressor()
 {
     AZ_Assert(m_streamCompression, "Compressor not started!");
-    size_t r = ZSTD_resetCStream(m_streamCompression,0);
-    AZ_UNUSED(r);
-    AZ_Assert(!ZSTD_isError(r), "Can't reset compressor");
+    ResetCompressionSession(m_streamCompression);
+    m_isCompressingFrame = false;
 }
 
 unsigned int ZStd::Compress(const void* data, unsigned int& dataSize, void* compressedData, unsigned int compressedDataSize, FlushType flushType)
 {
-    AZ_UNUSED(data);
-    AZ_UNUSED(dataSize);
-    AZ_UNUSED(compressedData);
-    AZ_UNUSED(compressedDataSize);
-    AZ_UNUSED(flushType);
-    return 0;
+    AZ_Assert(m_streamCompression, "Compressor not started!");
+
+    ZSTD_EndDirective endDirective;
+    switch (flushType)
+    {
+    case FT_NO_FLUSH:
+        endDirective = ZSTD_e_continue;
+        break;
+    case FT_FULL_FLUSH:
+    case FT_FINISH:
+        // Ends the frame, the data that follows starts a new frame which can be decompressed on its own
+        endDirective = ZSTD_e_end;
+        break;
+    default:
+        endDirective = ZSTD_e_flush;
+        break;
+    }
+
+    if (dataSize == 0 && (endDirective == ZSTD_e_continue || !m_isCompressingFrame))
+    {
+        // Nothing to compress or to flush, don't start an empty frame
+        return 0;
+    }
+
+    ZSTD_inBuffer input;
+    input.src = data;
+    input.size = dataSize;
+    input.pos = 0;
+
+    ZSTD_outBuffer output;
+    output.dst = compressedData;
+    output.size = compressedDataSize;
+    output.pos = 0;
+
+    // Flushing returns the amount of data still buffered or in flight on the workers, keep going until all of it is out
+    // or the output is full, in which case the caller calls again with a new output buffer.
+    size_t remaining = 0;
+    do
+    {
+        remaining = CompressStream(m_streamCompression, &output, &input, endDirective);
+        if (ZSTD_isError(remaining))
+        {
+            AZ_Assert(false, "ZStd streaming compression error: %s", ZSTD_getErrorName(remaining));
+            break;
+        }
+    } while (endDirective != ZSTD_e_continue && remaining != 0 && output.pos < output.size);
+
+    m_isCompressingFrame = endDirective != ZSTD_e_end || remaining != 0;
+
+    dataSize = azlossy_cast<unsigned int>(input.size - input.pos);
+    return azlossy_cast<unsigned int>(output.pos);
 }
 
 unsigned int ZStd::GetMinCompressedBufferSize(unsigned int sourceDataSize)
@@ -110,7 +196,6 @@ void ZStd::StartDecompressor()
     m_inBuffer.size = 0;
     m_outBuffer.size = 0;
     m_outBuffer.pos = 0;
-    m_compressedBufferIndex = 0;
 }
 
 void ZStd::StopDecompressor()
@@ -123,7 +208,11 @@ void ZStd::StopDecompressor()
 
 void ZStd::ResetDecompressor(Header* header)
 {
+    AZ_Assert(m_streamDecompression, "Decompressor not started!");
+    // Seek points start a new frame, there is no stream header to restore
     AZ_UNUSED(header);
+    m_nextBlockSize = ZSTD_resetDStream(m_streamDecompression);
+    AZ_Assert(!ZSTD_isError(m_nextBlockSize), "ZStandard internal error: %s", ZSTD_getErrorName(m_nextBlockSize));
 }
 
 void ZStd::SetupDecompressHeader(Header header)
@@ -131,13 +220,11 @@ void ZStd::SetupDecompressHeader(Header header)
     AZ_UNUSED(header);
 }
 
-unsigned int ZStd::Decompress(const void* compressedData, unsigned int compressedDataSize, void* outputData, unsigned int outputDataSize, size_t* sizeOfNextBlock)
+unsigned int ZStd::Decompress(const void* compressedData, unsigned int compressedDataSize, void* outputData, unsigned int& outputDataSize, size_t* sizeOfNextBlock)
 {
     AZ_Assert(m_streamDecompression, "Decompressor not started!");
-    AZ_UNUSED(compressedDataSize);
-    const char* data = reinterpret_cast<const char*>(compressedData);
-    m_inBuffer.src = reinterpret_cast<const void*>(&data[m_compressedBufferIndex]);
-    m_inBuffer.size = m_nextBlockSize;
+    m_inBuffer.src = compressedData;
+    m_inBuffer.size = compressedDataSize;
     m_inBuffer.pos = 0;
 
     m_outBuffer.dst = outputData;
@@ -153,14 +240,17 @@ unsigned int ZStd::Decompress(const void* compressedData, unsigned int compresse
 
     if (m_nextBlockSize == 0)
     {
+        // End of a frame, the next one starts with the following compressed data
         m_nextBlockSize = ZSTD_resetDStream(m_streamDecompression);
     }
 
-    m_compressedBufferIndex += azlossy_cast<unsigned int>(m_inBuffer.pos);
-
-    *sizeOfNextBlock = m_nextBlockSize;
+    outputDataSize -= azlossy_cast<unsigned int>(m_outBuffer.pos);
+    if (sizeOfNextBlock)
+    {
+        *sizeOfNextBlock = m_nextBlockSize;
+    }
 
-    return azlossy_cast<unsigned int>(m_outBuffer.pos); //return number of bytes decompressed
+    return azlossy_cast<unsigned int>(m_inBuffer.pos); //return number of compressed bytes processed
 }
 
 bool ZStd::IsCompressorStarted() const
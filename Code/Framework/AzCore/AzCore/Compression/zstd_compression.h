@@ -46,7 +46,9 @@ namespace AZ
 
         using Header = AZ::u32;     ///< Typedef for the  byte zstd header.
 
-        void StartCompressor(unsigned int compressionLevel = 1);
+        /// \param numWorkers number of threads compressing the stream in parallel, 0 compresses on the calling thread.
+        /// Frames are split in jobs that are compressed independently, so workers only help streams of several MB.
+        void StartCompressor(unsigned int compressionLevel = 1, unsigned int numWorkers = 0);
         bool IsCompressorStarted() const;
         void StopCompressor();
         void ResetCompressor();
@@ -61,12 +63,16 @@ namespace AZ
         // Compressor
         unsigned int GetMinCompressedBufferSize(unsigned int sourceDataSize);
 
+        /// FT_FULL_FLUSH and FT_FINISH end the current frame, so the following data can be decompressed without the previous frames.
+        /// When the returned size is compressedDataSize the flush may not be complete, call again with no data to continue it.
         unsigned int Compress(const void* data, unsigned int& dataSize, void* compressedData, unsigned int compressedDataSize, FlushType flushType = FT_NO_FLUSH);
         //////////////////////////////////////////////////////////////////////////
 
         //////////////////////////////////////////////////////////////////////////
         // Decompressor
-        unsigned int Decompress(const void* compressedData, unsigned int compressedDataSize, void* outputData, unsigned int outputDataSize, size_t* sizeOfNextBlock);
+        /// Decompresses as much as possible in outputData, outputDataSize is set to the output space left.
+        /// \return number of compressed bytes processed, compressed data that doesn't complete a block is kept by the decompressor.
+        unsigned int Decompress(const void* compressedData, unsigned int compressedDataSize, void* outputData, unsigned int& outputDataSize, size_t* sizeOfNextBlock = nullptr);
         //////////////////////////////////////////////////////////////////////////
     private:
         static void* AllocateMem(void* userData, size_t size);
@@ -80,6 +86,6 @@ namespace AZ
         ZSTD_inBuffer   m_inBuffer;
         ZSTD_outBuffer  m_outBuffer;
         size_t          m_nextBlockSize;
-        unsigned int    m_compressedBufferIndex;
+        bool            m_isCompressingFrame = false;   ///< True when data was compressed since the last frame ended.
     };
 };
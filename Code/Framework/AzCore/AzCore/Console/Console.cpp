@@ -16,10 +16,22 @@
 #include <AzCore/IO/FileIO.h>
 #include <AzCore/IO/Path/Path.h>
 #include <AzCore/IO/SystemFile.h>
+#include <AzCore/std/parallel/atomic.h>
 #include <cctype>
 
 namespace AZ
 {
+    namespace Internal
+    {
+        // Shared by all consoles, so a console created where another one was destroyed never reuses its generations
+        static AZStd::atomic<uint32_t> s_nextFunctorGeneration{ 1 };
+
+        static uint32_t NextFunctorGeneration()
+        {
+            return s_nextFunctorGeneration++;
+        }
+    }
+
     uint32_t CountMatchingPrefixes(const AZStd::string_view& string, const ConsoleCommandContainer& stringSet)
     {
         uint32_t count = 0;
@@ -38,6 +50,7 @@ namespace AZ
     Console::Console()
         : m_head(nullptr)
     {
+        m_functorGeneration = Internal::NextFunctorGeneration();
     }
 
     Console::Console(AZ::SettingsRegistryInterface& settingsRegistryInterface)
@@ -301,6 +314,7 @@ namespace AZ
         m_commands[lowerName].emplace_back(functor);
         functor->Link(m_head);
         functor->m_console = this;
+        m_functorGeneration = Internal::NextFunctorGeneration();
     }
 
     void Console::UnregisterFunctor(ConsoleFunctorBase* functor)
@@ -324,6 +338,7 @@ namespace AZ
         }
         functor->Unlink(m_head);
         functor->m_console = nullptr;
+        m_functorGeneration = Internal::NextFunctorGeneration();
     }
 
     void Console::LinkDeferredFunctors(ConsoleFunctorBase*& deferredHead)
@@ -345,6 +360,7 @@ namespace AZ
     void Console::MoveFunctorsToDeferredHead(ConsoleFunctorBase*& deferredHead)
     {
         m_commands.clear();
+        m_functorGeneration = Internal::NextFunctorGeneration();
 
         // Re-initialize all of the current functors to a deferred state
         for (ConsoleFunctorBase* curr = m_head; curr != nullptr; curr = curr->m_next)
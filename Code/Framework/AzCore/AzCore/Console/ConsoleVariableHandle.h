@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Interface/Interface.h>
+
+namespace AZ
+{
+    //! @class ConsoleVariableHandle
+    //! Caches the lookup of a console variable by name, for code that reads a cvar it doesn't own every frame.
+    //! The variable is looked up again only when functors were registered or unregistered with the console since the last read.
+    //! Cvars declared as VALUE_TYPE are read directly, other cvars go through the same string conversion as IConsole::GetCvarValue.
+    template <typename VALUE_TYPE>
+    class ConsoleVariableHandle
+    {
+    public:
+        //! @param name the name of the cvar, does not need to be registered yet
+        explicit ConsoleVariableHandle(const char* name);
+
+        //! Retrieves the current value of the console variable.
+        //! @param outValue reference to the instance to write the current cvar value to
+        //! @return GetValueResult::Success if the operation succeeded, or an error result if the operation failed
+        GetValueResult GetValue(VALUE_TYPE& outValue);
+
+        //! Returns the console functor of the console variable, nullptr if it isn't registered.
+        ConsoleFunctorBase* GetFunctor();
+
+    private:
+        using DataWrapper = ConsoleDataWrapper<VALUE_TYPE, ConsoleThreadSafety<VALUE_TYPE>>;
+        using TypedFunctor = ConsoleFunctor<DataWrapper, true>;
+        // The data wrapper has to be instantiated before the functor it holds
+        static_assert(sizeof(DataWrapper) > 0);
+
+        void Resolve();
+
+        CVarFixedString m_name;
+        IConsole* m_console = nullptr;
+        uint32_t m_functorGeneration = 0;
+        ConsoleFunctorBase* m_functor = nullptr;
+        //! Set when the functor belongs to a cvar declared as VALUE_TYPE
+        TypedFunctor* m_typedFunctor = nullptr;
+    };
+
+    template <typename VALUE_TYPE>
+    inline ConsoleVariableHandle<VALUE_TYPE>::ConsoleVariableHandle(const char* name)
+        : m_name(name)
+    {
+    }
+
+    template <typename VALUE_TYPE>
+    inline GetValueResult ConsoleVariableHandle<VALUE_TYPE>::GetValue(VALUE_TYPE& outValue)
+    {
+        Resolve();
+        if (m_typedFunctor)
+        {
+            outValue = static_cast<VALUE_TYPE>(m_typedFunctor->GetValue());
+            return GetValueResult::Success;
+        }
+        if (m_functor)
+        {
+            return m_functor->GetValue(outValue);
+        }
+        return GetValueResult::ConsoleVarNotFound;
+    }
+
+    template <typename VALUE_TYPE>
+    inline ConsoleFunctorBase* ConsoleVariableHandle<VALUE_TYPE>::GetFunctor()
+    {
+        Resolve();
+        return m_functor;
+    }
+
+    template <typename VALUE_TYPE>
+    inline void ConsoleVariableHandle<VALUE_TYPE>::Resolve()
+    {
+        IConsole* console = Interface<IConsole>::Get();
+        if (console == m_console && (console == nullptr || console->GetFunctorGeneration() == m_functorGeneration))
+        {
+            return;
+        }
+
+        m_console = console;
+        m_functorGeneration = console ? console->GetFunctorGeneration() : 0;
+        m_functor = console ? console->FindCommand(m_name.c_str()) : nullptr;
+        // Only cvars carry a type id, and they are all declared through ConsoleDataWrapper with the default thread safety
+        m_typedFunctor = (m_functor && m_functor->GetTypeId() == AzTypeInfo<VALUE_TYPE>::Uuid())
+            ? static_cast<TypedFunctor*>(m_functor)
+            : nullptr;
+    }
+}
@@ -118,6 +118,10 @@ namespace AZ
         template<typename RETURN_TYPE>
         GetValueResult GetCvarValue(const char* command, RETURN_TYPE& outValue);
 
+        //! Returns a value that changes whenever a functor is registered or unregistered with this console,
+        //! which lets ConsoleVariableHandle know when the functor it looked up may be gone.
+        uint32_t GetFunctorGeneration() const;
+
         //! Visits all registered console functors.
         //! @param visitor the instance to visit all functors with
         virtual void VisitRegisteredFunctors(const FunctorVisitor& visitor) = 0;
@@ -157,6 +161,7 @@ namespace AZ
         ConsoleCommandRegisteredEvent m_consoleCommandRegisteredEvent;
         ConsoleCommandInvokedEvent m_consoleCommandInvokedEvent;
         DispatchCommandNotFoundEvent m_dispatchCommandNotFoundEvent;
+        uint32_t m_functorGeneration = 0;
     };
 
     inline auto IConsole::GetConsoleCommandRegisteredEvent() -> ConsoleCommandRegisteredEvent&
@@ -174,6 +179,11 @@ namespace AZ
         return m_dispatchCommandNotFoundEvent;
     }
 
+    inline uint32_t IConsole::GetFunctorGeneration() const
+    {
+        return m_functorGeneration;
+    }
+
     template<typename RETURN_TYPE>
     inline GetValueResult IConsole::GetCvarValue(const char* command, RETURN_TYPE& outValue)
     {
@@ -829,13 +829,10 @@ namespace AZ
             auto& context = Bus::GetOrCreateContext(false);
             if (context.m_queue.IsActive())
             {
-                AZStd::scoped_lock<decltype(context.m_queue.m_messagesMutex)> messageLock(context.m_queue.m_messagesMutex);
-                context.m_queue.m_messages.push(typename Bus::QueuePolicy::BusMessageCall(
-                    [func = AZStd::forward<Function>(func), args...]() mutable
+                context.m_queue.Queue([func = AZStd::forward<Function>(func), args...]() mutable
                 {
                     AZStd::invoke(AZStd::forward<Function>(func), AZStd::forward<InputArgs>(args)...);
-                },
-                    typename Traits::AllocatorType()));
+                });
             }
             else
             {
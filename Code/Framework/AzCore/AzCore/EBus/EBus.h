@@ -20,6 +20,7 @@
 #include <AzCore/EBus/BusImpl.h>
 #include <AzCore/EBus/Results.h>
 #include <AzCore/EBus/Internal/Debug.h>
+#include <AzCore/EBus/Internal/Profiling.h>
 
  // Included for backwards compatibility purposes
 #include <AzCore/std/smart_ptr/unique_ptr.h>
@@ -170,9 +171,10 @@ namespace AZ
         static const bool EnableQueuedReferences = false;
 
         /**
-         * Locking primitive that is used when adding and removing
+         * Locking primitive that was used when adding and removing
          * events from the queue.
-         * Not used for connection or event execution.
+         * The event queue is now lock-free, so this is no longer used
+         * to guard the queue. It's kept so existing traits continue to compile.
          * Used only when #EnableEventQueue is true.
          * If left unspecified, it will use the #MutexType.
          */
@@ -640,6 +642,9 @@ namespace AZ
             ContextMutexType        m_contextMutex;  ///< Mutex to control access when modifying the context
             QueuePolicy             m_queue;
             RouterPolicy            m_routing;
+#if AZ_EBUS_PROFILING
+            AZ::Internal::EBusProfile m_profile{ GetName() }; ///< Dispatch statistics of this context.
+#endif
 
             Context();
             Context(EBusEnvironment* environment);
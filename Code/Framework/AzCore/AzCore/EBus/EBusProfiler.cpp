@@ -0,0 +1,238 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/EBus/Internal/Profiling.h>
+
+#if AZ_EBUS_PROFILING
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Module/Environment.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/sort.h>
+#include <AzCore/std/string/string.h>
+
+namespace AZ
+{
+    namespace Internal
+    {
+        namespace EBusProfilerInternal
+        {
+            struct Registry
+            {
+                static u32 GetId()
+                {
+                    return AZ_CRC_CE("EBusProfilerRegistry");
+                }
+
+                AZStd::mutex m_mutex;
+                AZStd::vector<EBusProfile*, EBusEnvironmentAllocator> m_profiles;
+            };
+
+            static Registry& GetRegistry()
+            {
+                // hold a reference to the variable (even though we will never release it) so the registry is shared by all modules.
+                static EnvironmentVariable<Registry> s_registry = nullptr;
+                if (!s_registry)
+                {
+                    s_registry = Environment::CreateVariable<Registry>(Registry::GetId());
+                }
+                return *s_registry;
+            }
+
+            struct EventTotals
+            {
+                AZStd::string m_signature;
+                u64 m_function[2] = { 0, 0 };
+                EBusEventProfile m_totals;
+            };
+
+            struct BusTotals
+            {
+                AZStd::string m_busName;
+                EBusEventProfile m_totals;
+                AZStd::vector<EventTotals> m_events;
+            };
+
+            static void Accumulate(EBusEventProfile& target, const EBusEventProfile& source)
+            {
+                target.m_dispatchCount += source.m_dispatchCount;
+                target.m_handlerCallCount += source.m_handlerCallCount;
+                target.m_lockWaitTime += source.m_lockWaitTime;
+                target.m_dispatchTime += source.m_dispatchTime;
+            }
+
+            static double ToMilliseconds(u64 nanoseconds)
+            {
+                return static_cast<double>(nanoseconds) / 1000000.0;
+            }
+        } // namespace EBusProfilerInternal
+
+        EBusProfile::EBusProfile(const char* busName)
+            : m_busName(busName)
+        {
+            EBusProfiler::Register(*this);
+        }
+
+        EBusProfile::~EBusProfile()
+        {
+            EBusProfiler::Unregister(*this);
+        }
+
+        void EBusProfile::Record(const EBusEventKey& key, const char* signature, u64 handlerCallCount, u64 lockWaitTime, u64 dispatchTime)
+        {
+            AZStd::scoped_lock lock(m_eventsMutex);
+            EBusEventProfile& event = m_events[key];
+            event.m_signature = signature;
+            event.m_dispatchCount++;
+            event.m_handlerCallCount += handlerCallCount;
+            event.m_lockWaitTime += lockWaitTime;
+            event.m_dispatchTime += dispatchTime;
+        }
+
+        void EBusProfile::Reset()
+        {
+            AZStd::scoped_lock lock(m_eventsMutex);
+            m_events.clear();
+        }
+
+        void EBusProfiler::Register(EBusProfile& profile)
+        {
+            EBusProfilerInternal::Registry& registry = EBusProfilerInternal::GetRegistry();
+            AZStd::scoped_lock lock(registry.m_mutex);
+            registry.m_profiles.push_back(&profile);
+        }
+
+        void EBusProfiler::Unregister(EBusProfile& profile)
+        {
+            EBusProfilerInternal::Registry& registry = EBusProfilerInternal::GetRegistry();
+            AZStd::scoped_lock lock(registry.m_mutex);
+            auto it = AZStd::find(registry.m_profiles.begin(), registry.m_profiles.end(), &profile);
+            if (it != registry.m_profiles.end())
+            {
+                registry.m_profiles.erase(it);
+            }
+        }
+
+        void EBusProfiler::PrintStatistics(size_t maxBuses)
+        {
+            using namespace EBusProfilerInternal;
+
+            // Combine the statistics of all contexts of the same bus, for instance thread local buses or buses that
+            // are used from multiple modules.
+            AZStd::vector<BusTotals> buses;
+            {
+                Registry& registry = GetRegistry();
+                AZStd::scoped_lock lock(registry.m_mutex);
+                for (EBusProfile* profile : registry.m_profiles)
+                {
+                    auto busIt = AZStd::find_if(buses.begin(), buses.end(),
+                        [profile](const BusTotals& bus) { return bus.m_busName == profile->GetBusName(); });
+                    if (busIt == buses.end())
+                    {
+                        buses.emplace_back();
+                        busIt = buses.end() - 1;
+                        busIt->m_busName = profile->GetBusName();
+                    }
+
+                    BusTotals& bus = *busIt;
+                    profile->Visit([&bus](const EBusEventKey& key, const EBusEventProfile& event)
+                        {
+                            Accumulate(bus.m_totals, event);
+                            auto eventIt = AZStd::find_if(bus.m_events.begin(), bus.m_events.end(),
+                                [&key, &event](const EventTotals& entry)
+                                {
+                                    return entry.m_function[0] == key.m_function[0] && entry.m_function[1] == key.m_function[1] &&
+                                        entry.m_signature == event.m_signature;
+                                });
+                            if (eventIt == bus.m_events.end())
+                            {
+                                bus.m_events.emplace_back();
+                                eventIt = bus.m_events.end() - 1;
+                                eventIt->m_signature = event.m_signature;
+                                eventIt->m_function[0] = key.m_function[0];
+                                eventIt->m_function[1] = key.m_function[1];
+                            }
+                            Accumulate(eventIt->m_totals, event);
+                        });
+                }
+            }
+
+            auto byDispatchTime = [](const auto& lhs, const auto& rhs)
+            {
+                return lhs.m_totals.m_dispatchTime > rhs.m_totals.m_dispatchTime;
+            };
+            AZStd::sort(buses.begin(), buses.end(), byDispatchTime);
+
+            AZ_TracePrintf("EBus", "EBus dispatch statistics, times are in milliseconds and include nested dispatches.\n");
+            const size_t numBuses = AZStd::min(maxBuses, buses.size());
+            for (size_t i = 0; i < numBuses; ++i)
+            {
+                BusTotals& bus = buses[i];
+                if (bus.m_totals.m_dispatchCount == 0)
+                {
+                    break;
+                }
+
+                AZ_TracePrintf("EBus", "%s\n", bus.m_busName.c_str());
+                AZ_TracePrintf("EBus", "    Dispatches: %llu, Handler calls: %llu, Lock wait: %.3f, Dispatch time: %.3f\n",
+                    static_cast<unsigned long long>(bus.m_totals.m_dispatchCount), static_cast<unsigned long long>(bus.m_totals.m_handlerCallCount),
+                    ToMilliseconds(bus.m_totals.m_lockWaitTime), ToMilliseconds(bus.m_totals.m_dispatchTime));
+
+                AZStd::sort(bus.m_events.begin(), bus.m_events.end(), byDispatchTime);
+                for (const EventTotals& event : bus.m_events)
+                {
+                    AZ_TracePrintf("EBus", "    %s [%016llx%016llx]\n", event.m_signature.c_str(),
+                        static_cast<unsigned long long>(event.m_function[1]), static_cast<unsigned long long>(event.m_function[0]));
+                    AZ_TracePrintf("EBus", "        Dispatches: %llu, Handler calls: %llu, Lock wait: %.3f, Dispatch time: %.3f\n",
+                        static_cast<unsigned long long>(event.m_totals.m_dispatchCount), static_cast<unsigned long long>(event.m_totals.m_handlerCallCount),
+                        ToMilliseconds(event.m_totals.m_lockWaitTime), ToMilliseconds(event.m_totals.m_dispatchTime));
+                }
+            }
+        }
+
+        void EBusProfiler::ResetStatistics()
+        {
+            EBusProfilerInternal::Registry& registry = EBusProfilerInternal::GetRegistry();
+            AZStd::scoped_lock lock(registry.m_mutex);
+            for (EBusProfile* profile : registry.m_profiles)
+            {
+                profile->Reset();
+            }
+        }
+
+        void EBusProfiler::BeginCapture([[maybe_unused]] const char* busName)
+        {
+            AZ_PROFILE_EVENT_BEGIN(AZ::Debug::ProfileCategory::AzCore, busName);
+        }
+
+        void EBusProfiler::EndCapture()
+        {
+            AZ_PROFILE_EVENT_END(AZ::Debug::ProfileCategory::AzCore);
+        }
+    } // namespace Internal
+
+    static void ebus_DumpProfile(const AZ::ConsoleCommandContainer& arguments)
+    {
+        size_t maxBuses = 20;
+        if (!arguments.empty())
+        {
+            maxBuses = AZStd::stoull(AZStd::string(arguments.front()));
+        }
+        Internal::EBusProfiler::PrintStatistics(maxBuses);
+    }
+
+    static void ebus_ResetProfile([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
+    {
+        Internal::EBusProfiler::ResetStatistics();
+    }
+
+    AZ_CONSOLEFREEFUNC(ebus_DumpProfile, AZ::ConsoleFunctorFlags::Null,
+        "Prints the dispatch statistics of the EBuses with the highest total dispatch time. Optional parameter: the number of buses to print (default 20)");
+    AZ_CONSOLEFREEFUNC(ebus_ResetProfile, AZ::ConsoleFunctorFlags::Null, "Resets the dispatch statistics of all EBuses");
+} // namespace AZ
+#endif // AZ_EBUS_PROFILING
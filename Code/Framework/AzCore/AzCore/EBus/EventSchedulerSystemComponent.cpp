@@ -62,15 +62,10 @@ namespace AZ
         TimeMs startTime = GetElapsedTimeMs();
         bool usingTimeslice = bg_maxScheduledEventProcessTimeMs != TimeMs{ 0 };
 
-        while (!m_queue.empty())
+        ScheduledEventHandle* expiredHandle = nullptr;
+        while (m_queue.PopExpired(startTime, expiredHandle))
         {
-            ScheduledEventHandle* handle = m_queue.top();
-            if (handle->GetExecuteTimeMs() > startTime)
-            {
-                break;
-            }
-            m_queue.pop();
-            m_pendingQueue.push(handle);
+            m_pendingQueue.push(expiredHandle);
         }
 
         while (!m_pendingQueue.empty())
@@ -110,7 +105,7 @@ namespace AZ
         const bool ownsScheduledEvent = false;
         *(timedEvent->m_handle) = ScheduledEventHandle(TimeMs(currentMilliseconds + durationMs), durationMs, timedEvent, ownsScheduledEvent);
         timedEvent->m_timeInserted = currentMilliseconds;
-        m_queue.push(timedEvent->m_handle);
+        m_queue.Insert(timedEvent->m_handle, timedEvent->m_handle->GetExecuteTimeMs());
         return timedEvent->m_handle;
     }
 
@@ -126,7 +121,7 @@ namespace AZ
         const bool ownsScheduledEvent = true;
         *(timedEvent->m_handle) = ScheduledEventHandle(TimeMs(currentMilliseconds + durationMs), durationMs, timedEvent, ownsScheduledEvent);
         timedEvent->m_timeInserted = currentMilliseconds;
-        m_queue.push(timedEvent->m_handle);
+        m_queue.Insert(timedEvent->m_handle, timedEvent->m_handle->GetExecuteTimeMs());
     }
 
     AZStd::size_t EventSchedulerSystemComponent::GetHandleCount() const
@@ -141,7 +136,7 @@ namespace AZ
 
     AZStd::size_t EventSchedulerSystemComponent::GetQueueSize() const
     {
-        return m_queue.size();
+        return m_queue.GetSize();
     }
 
     void EventSchedulerSystemComponent::DumpStats([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
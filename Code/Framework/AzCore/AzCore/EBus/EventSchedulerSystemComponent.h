@@ -13,21 +13,12 @@
 #include <AzCore/EBus/ScheduledEventHandle.h>
 #include <AzCore/EBus/ScheduledEvent.h>
 #include <AzCore/Component/TickBus.h>
+#include <AzCore/Time/TimingWheel.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/containers/queue.h>
 
 namespace AZ
 {
-    //! @struct CompareScheduledEventPtrs
-    //! Comparison of scheduled events to add in the priority queue.
-    struct CompareScheduledEventPtrs
-    {
-        bool operator() (const ScheduledEventHandle* lhs, const ScheduledEventHandle* rhs) const
-        {
-            return (*lhs) > (*rhs);
-        }
-    };
-
     //! @struct PrioritizeScheduledEventPtrs
     //! Prioritization operator for scheduled events to add in the priority queue.
     struct PrioritizeScheduledEventPtrs
@@ -95,8 +86,8 @@ namespace AZ
         // Bind the DumpStats member function to the console as 'EventSchedulerSystemComponent.DumpStats'
         AZ_CONSOLEFUNC(EventSchedulerSystemComponent, DumpStats, AZ::ConsoleFunctorFlags::Null, "Dump EventSchedulerSystemComponent stats to the console window");
 
-        // Priority queues of scheduled events sorted by execution time
-        AZStd::priority_queue<ScheduledEventHandle*, AZStd::vector<ScheduledEventHandle*>, CompareScheduledEventPtrs> m_queue;
+        // Scheduled events by execution time, and the expired ones by priority
+        TimingWheel<ScheduledEventHandle*> m_queue;
         AZStd::priority_queue<ScheduledEventHandle*, AZStd::vector<ScheduledEventHandle*>, PrioritizeScheduledEventPtrs> m_pendingQueue;
         AZStd::deque<ScheduledEvent> m_ownedEvents;
         AZStd::vector<ScheduledEvent*> m_freeEvents;
@@ -14,6 +14,7 @@
 #include <AzCore/EBus/Internal/Handlers.h>
 #include <AzCore/EBus/Internal/StoragePolicies.h>
 #include <AzCore/EBus/Internal/Debug.h>
+#include <AzCore/EBus/Internal/Profiling.h>
 
 AZ_PUSH_DISABLE_WARNING(4127, "-Wunknown-warning-option")
 
@@ -114,7 +115,9 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
+                        EBUS_PROFILE_DISPATCH(*context, func);
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_PROFILE_LOCK_ACQUIRED();
                         EBUS_DO_ROUTING(*context, &id, false, false);
 
                         auto& addresses = context->m_buses.m_addresses;
@@ -145,6 +148,7 @@ namespace AZ
                             while (handlerIt != handlersEnd)
                             {
                                 auto itr = handlerIt++;
+                                EBUS_PROFILE_HANDLER_CALL();
                                 Traits::EventProcessingPolicy::Call(func, *itr, args...);
                             }
 
@@ -157,7 +161,9 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
+                        EBUS_PROFILE_DISPATCH(*context, func);
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_PROFILE_LOCK_ACQUIRED();
                         EBUS_DO_ROUTING(*context, &id, false, false);
 
                         auto& addresses = context->m_buses.m_addresses;
@@ -188,6 +194,7 @@ namespace AZ
                             while (handlerIt != handlersEnd)
                             {
                                 auto itr = handlerIt++;
+                                EBUS_PROFILE_HANDLER_CALL();
                                 Traits::EventProcessingPolicy::CallResult(results, func, *itr, args...);
                             }
 
@@ -200,7 +207,9 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
+                        EBUS_PROFILE_DISPATCH(*context, func);
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_PROFILE_LOCK_ACQUIRED();
                         EBUS_DO_ROUTING(*context, &id, false, true);
 
                         auto& addresses = context->m_buses.m_addresses;
@@ -217,6 +226,7 @@ namespace AZ
                             while (handlerIt != handlers.rend())
                             {
                                 auto itr = handlerIt++;
+                                EBUS_PROFILE_HANDLER_CALL();
                                 Traits::EventProcessingPolicy::Call(func, *itr, args...);
                             }
 
@@ -229,7 +239,9 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
+                        EBUS_PROFILE_DISPATCH(*context, func);
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_PROFILE_LOCK_ACQUIRED();
                         EBUS_DO_ROUTING(*context, &id, false, true);
 
                         auto& addresses = context->m_buses.m_addresses;
@@ -246,6 +258,7 @@ namespace AZ
                             while (handlerIt != handlers.rend())
                             {
                                 auto itr = handlerIt++;
+                                EBUS_PROFILE_HANDLER_CALL();
                                 Traits::EventProcessingPolicy::CallResult(results, func, *itr, args...);
                             }
 
@@ -260,7 +273,9 @@ namespace AZ
                     {
                         auto* context = Bus::GetContext();
                         EBUS_ASSERT(context, "Internal error: context deleted with bind ptr outstanding.");
+                        EBUS_PROFILE_DISPATCH(*context, func);
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_PROFILE_LOCK_ACQUIRED();
 
                         EBUS_DO_ROUTING(*context, &busPtr->m_busId, false, false);
 
@@ -285,6 +300,7 @@ namespace AZ
                         while (handlerIt != handlersEnd)
                         {
                             auto itr = handlerIt++;
+                            EBUS_PROFILE_HANDLER_CALL();
                             Traits::EventProcessingPolicy::Call(func, *itr, args...);
                         }
                     }
@@ -296,7 +312,9 @@ namespace AZ
                     {
                         auto* context = Bus::GetContext();
                         EBUS_ASSERT(context, "Internal error: context deleted with bind ptr outstanding.");
+                        EBUS_PROFILE_DISPATCH(*context, func);
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_PROFILE_LOCK_ACQUIRED();
 
                         EBUS_DO_ROUTING(*context, &busPtr->m_busId, false, false);
 
@@ -321,6 +339,7 @@ namespace AZ
                         while (handlerIt != handlersEnd)
                         {
                             auto itr = handlerIt++;
+                            EBUS_PROFILE_HANDLER_CALL();
                             Traits::EventProcessingPolicy::CallResult(results, func, *itr, args...);
                         }
                     }
@@ -332,7 +351,9 @@ namespace AZ
                     {
                         auto* context = Bus::GetContext();
                         EBUS_ASSERT(context, "Internal error: context deleted with bind ptr outstanding.");
+                        EBUS_PROFILE_DISPATCH(*context, func);
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_PROFILE_LOCK_ACQUIRED();
 
                         EBUS_DO_ROUTING(*context, &busPtr->m_busId, false, true);
 
@@ -343,6 +364,7 @@ namespace AZ
                         while (handlerIt != handlers.rend())
                         {
                             auto itr = handlerIt++;
+                            EBUS_PROFILE_HANDLER_CALL();
                             Traits::EventProcessingPolicy::Call(func, *itr, args...);
                         }
                     }
@@ -354,7 +376,9 @@ namespace AZ
                     {
                         auto* context = Bus::GetContext();
                         EBUS_ASSERT(context, "Internal error: context deleted with bind ptr outstanding.");
+                        EBUS_PROFILE_DISPATCH(*context, func);
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_PROFILE_LOCK_ACQUIRED();
 
                         EBUS_DO_ROUTING(*context, &busPtr->m_busId, false, true);
 
@@ -365,6 +389,7 @@ namespace AZ
                         while (handlerIt != handlers.rend())
                         {
                             auto itr = handlerIt++;
+                            EBUS_PROFILE_HANDLER_CALL();
                             Traits::EventProcessingPolicy::CallResult(results, func, *itr, args...);
                         }
                     }
@@ -376,7 +401,9 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
+                        EBUS_PROFILE_DISPATCH(*context, func);
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_PROFILE_LOCK_ACQUIRED();
                         EBUS_DO_ROUTING(*context, nullptr, false, false);
 
                         auto& addresses = context->m_buses.m_addresses;
@@ -407,6 +434,7 @@ namespace AZ
                             while (handlerIt != handlersEnd)
                             {
                                 auto itr = handlerIt++;
+                                EBUS_PROFILE_HANDLER_CALL();
                                 Traits::EventProcessingPolicy::Call(func, *itr, args...);
                             }
 
@@ -422,7 +450,9 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
+                        EBUS_PROFILE_DISPATCH(*context, func);
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_PROFILE_LOCK_ACQUIRED();
                         EBUS_DO_ROUTING(*context, nullptr, false, false);
 
                         auto& addresses = context->m_buses.m_addresses;
@@ -453,6 +483,7 @@ namespace AZ
                             while (handlerIt != handlersEnd)
                             {
                                 auto itr = handlerIt++;
+                                EBUS_PROFILE_HANDLER_CALL();
                                 Traits::EventProcessingPolicy::CallResult(results, func, *itr, args...);
                             }
 
@@ -468,7 +499,9 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
+                        EBUS_PROFILE_DISPATCH(*context, func);
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_PROFILE_LOCK_ACQUIRED();
                         EBUS_DO_ROUTING(*context, nullptr, false, true);
 
                         auto& addresses = context->m_buses.m_addresses;
@@ -496,6 +529,7 @@ namespace AZ
                             while (handlerIt != handlers.rend())
                             {
                                 auto itr = handlerIt++;
+                                EBUS_PROFILE_HANDLER_CALL();
                                 Traits::EventProcessingPolicy::Call(func, *itr, args...);
                             }
                             holder.release();
@@ -526,7 +560,9 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
+                        EBUS_PROFILE_DISPATCH(*context, func);
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_PROFILE_LOCK_ACQUIRED();
                         EBUS_DO_ROUTING(*context, nullptr, false, true);
 
                         auto& addresses = context->m_buses.m_addresses;
@@ -554,6 +590,7 @@ namespace AZ
                             while (handlerIt != handlers.rend())
                             {
                                 auto itr = handlerIt++;
+                                EBUS_PROFILE_HANDLER_CALL();
                                 Traits::EventProcessingPolicy::CallResult(results, func, *itr, args...);
                             }
                             holder.release();
@@ -586,7 +623,9 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
+                        EBUS_PROFILE_DISPATCH(*context, callback);
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_PROFILE_LOCK_ACQUIRED();
 
                         auto& addresses = context->m_buses.m_addresses;
                         auto addressIt = addresses.begin();
@@ -605,7 +644,9 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
+                        EBUS_PROFILE_DISPATCH(*context, callback);
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_PROFILE_LOCK_ACQUIRED();
 
                         auto& addresses = context->m_buses.m_addresses;
                         auto addressIt = addresses.find(id);
@@ -620,7 +661,9 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
+                        EBUS_PROFILE_DISPATCH(*context, callback);
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_PROFILE_LOCK_ACQUIRED();
 
                         if (ptr)
                         {
@@ -794,7 +837,9 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
+                        EBUS_PROFILE_DISPATCH(*context, func);
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_PROFILE_LOCK_ACQUIRED();
                         EBUS_DO_ROUTING(*context, &id, false, false);
 
                         auto& addresses = context->m_buses.m_addresses;
@@ -802,6 +847,7 @@ namespace AZ
                         if (addressIt != addresses.end() && addressIt->m_interface)
                         {
                             CallstackEntry entry(context, &addressIt->m_busId);
+                            EBUS_PROFILE_HANDLER_CALL();
                             Traits::EventProcessingPolicy::Call(AZStd::forward<Function>(func), addressIt->m_interface, AZStd::forward<ArgsT>(args)...);
                         }
                     }
@@ -811,7 +857,9 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
+                        EBUS_PROFILE_DISPATCH(*context, func);
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_PROFILE_LOCK_ACQUIRED();
                         EBUS_DO_ROUTING(*context, &id, false, false);
 
                         auto& addresses = context->m_buses.m_addresses;
@@ -819,6 +867,7 @@ namespace AZ
                         if (addressIt != addresses.end() && addressIt->m_interface)
                         {
                             CallstackEntry entry(context, &addressIt->m_busId);
+                            EBUS_PROFILE_HANDLER_CALL();
                             Traits::EventProcessingPolicy::CallResult(results, AZStd::forward<Function>(func), addressIt->m_interface, AZStd::forward<ArgsT>(args)...);
                         }
                     }
@@ -828,7 +877,9 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
+                        EBUS_PROFILE_DISPATCH(*context, func);
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_PROFILE_LOCK_ACQUIRED();
                         EBUS_DO_ROUTING(*context, &id, false, true);
 
                         auto& addresses = context->m_buses.m_addresses;
@@ -836,6 +887,7 @@ namespace AZ
                         if (addressIt != addresses.end() && addressIt->m_interface)
                         {
                             CallstackEntry entry(context, &addressIt->m_busId);
+                            EBUS_PROFILE_HANDLER_CALL();
                             Traits::EventProcessingPolicy::Call(AZStd::forward<Function>(func), addressIt->m_interface, AZStd::forward<ArgsT>(args)...);
                         }
                     }
@@ -845,7 +897,9 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
+                        EBUS_PROFILE_DISPATCH(*context, func);
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_PROFILE_LOCK_ACQUIRED();
                         EBUS_DO_ROUTING(*context, &id, false, true);
 
                         auto& addresses = context->m_buses.m_addresses;
@@ -853,6 +907,7 @@ namespace AZ
                         if (addressIt != addresses.end() && addressIt->m_interface)
                         {
                             CallstackEntry entry(context, &addressIt->m_busId);
+                            EBUS_PROFILE_HANDLER_CALL();
                             Traits::EventProcessingPolicy::CallResult(results, AZStd::forward<Function>(func), addressIt->m_interface, AZStd::forward<ArgsT>(args)...);
                         }
                     }
@@ -864,13 +919,16 @@ namespace AZ
                     {
                         auto* context = Bus::GetContext();
                         EBUS_ASSERT(context, "Internal error: context deleted with bind ptr outstanding.");
+                        EBUS_PROFILE_DISPATCH(*context, func);
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_PROFILE_LOCK_ACQUIRED();
 
                         EBUS_DO_ROUTING(*context, &busPtr->m_busId, false, false);
 
                         if (busPtr->m_interface)
                         {
                             CallstackEntry entry(context, &busPtr->m_busId);
+                            EBUS_PROFILE_HANDLER_CALL();
                             Traits::EventProcessingPolicy::Call(AZStd::forward<Function>(func), busPtr->m_interface, AZStd::forward<ArgsT>(args)...);
                         }
                     }
@@ -882,13 +940,16 @@ namespace AZ
                     {
                         auto* context = Bus::GetContext();
                         EBUS_ASSERT(context, "Internal error: context deleted with bind ptr outstanding.");
+                        EBUS_PROFILE_DISPATCH(*context, func);
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_PROFILE_LOCK_ACQUIRED();
 
                         EBUS_DO_ROUTING(*context, &busPtr->m_busId, false, false);
 
                         if (busPtr->m_interface)
                         {
                             CallstackEntry entry(context, &busPtr->m_busId);
+                            EBUS_PROFILE_HANDLER_CALL();
                             Traits::EventProcessingPolicy::CallResult(results, AZStd::forward<Function>(func), busPtr->m_interface, AZStd::forward<ArgsT>(args)...);
                         }
                     }
@@ -900,13 +961,16 @@ namespace AZ
                     {
                         auto* context = Bus::GetContext();
                         EBUS_ASSERT(context, "Internal error: context deleted with bind ptr outstanding.");
+                        EBUS_PROFILE_DISPATCH(*context, func);
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_PROFILE_LOCK_ACQUIRED();
 
                         EBUS_DO_ROUTING(*context, &busPtr->m_busId, false, true);
 
                         if (busPtr->m_interface)
                         {
                             CallstackEntry entry(context, &busPtr->m_busId);
+                            EBUS_PROFILE_HANDLER_CALL();
                             Traits::EventProcessingPolicy::Call(AZStd::forward<Function>(func), busPtr->m_interface, AZStd::forward<ArgsT>(args)...);
                         }
                     }
@@ -918,13 +982,16 @@ namespace AZ
                     {
                         auto* context = Bus::GetContext();
                         EBUS_ASSERT(context, "Internal error: context deleted with bind ptr outstanding.");
+                        EBUS_PROFILE_DISPATCH(*context, func);
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_PROFILE_LOCK_ACQUIRED();
 
                         EBUS_DO_ROUTING(*context, &busPtr->m_busId, false, true);
 
                         if (busPtr->m_interface)
                         {
                             CallstackEntry entry(context, &busPtr->m_busId);
+                            EBUS_PROFILE_HANDLER_CALL();
                             Traits::EventProcessingPolicy::CallResult(results, AZStd::forward<Function>(func), busPtr->m_interface, AZStd::forward<ArgsT>(args)...);
                         }
                     }
@@ -936,7 +1003,9 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
+                        EBUS_PROFILE_DISPATCH(*context, func);
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_PROFILE_LOCK_ACQUIRED();
                         EBUS_DO_ROUTING(*context, nullptr, false, false);
 
                         auto& addresses = context->m_buses.m_addresses;
@@ -964,6 +1033,7 @@ namespace AZ
                             {
                                 // @func and @args cannot be forwarded here as rvalue arguments need to bind to const lvalue arguments
                                 // due to potential of multiple addresses of this EBus container invoking the function multiple times
+                                EBUS_PROFILE_HANDLER_CALL();
                                 Traits::EventProcessingPolicy::Call(func, inst, args...);
                             }
                         }
@@ -974,7 +1044,9 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
+                        EBUS_PROFILE_DISPATCH(*context, func);
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_PROFILE_LOCK_ACQUIRED();
                         EBUS_DO_ROUTING(*context, nullptr, false, false);
 
                         auto& addresses = context->m_buses.m_addresses;
@@ -1002,6 +1074,7 @@ namespace AZ
                             {
                                 // @func and @args cannot be forwarded here as rvalue arguments need to bind to const lvalue arguments
                                 // due to potential of multiple addresses of this EBus container invoking the function multiple times
+                                EBUS_PROFILE_HANDLER_CALL();
                                 Traits::EventProcessingPolicy::CallResult(results, func, inst, args...);
                             }
                         }
@@ -1012,7 +1085,9 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
+                        EBUS_PROFILE_DISPATCH(*context, func);
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_PROFILE_LOCK_ACQUIRED();
                         EBUS_DO_ROUTING(*context, nullptr, false, true);
 
                         auto& addresses = context->m_buses.m_addresses;
@@ -1038,6 +1113,7 @@ namespace AZ
                                 CallstackEntry entry(context, &holder.m_busId);
                                 // @func and @args cannot be forwarded here as rvalue arguments need to bind to const lvalue arguments
                                 // due to potential of multiple addresses of this EBus container invoking the function multiple times
+                                EBUS_PROFILE_HANDLER_CALL();
                                 Traits::EventProcessingPolicy::Call(func, inst, args...);
                             }
                             holder.release();
@@ -1068,7 +1144,9 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
+                        EBUS_PROFILE_DISPATCH(*context, func);
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_PROFILE_LOCK_ACQUIRED();
                         EBUS_DO_ROUTING(*context, nullptr, false, true);
 
                         auto& addresses = context->m_buses.m_addresses;
@@ -1094,6 +1172,7 @@ namespace AZ
                                 CallstackEntry entry(context, &holder.m_busId);
                                 // @func and @args cannot be forwarded here as rvalue arguments need to bind to const lvalue arguments
                                 // due to potential of multiple addresses of this EBus container invoking the function multiple times
+                                EBUS_PROFILE_HANDLER_CALL();
                                 Traits::EventProcessingPolicy::CallResult(results, func, inst, args...);
                             }
                             holder.release();
@@ -1126,7 +1205,9 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
+                        EBUS_PROFILE_DISPATCH(*context, callback);
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_PROFILE_LOCK_ACQUIRED();
 
                         auto& addresses = context->m_buses.m_addresses;
                         auto addressIt = addresses.begin();
@@ -1152,6 +1233,7 @@ namespace AZ
                             if (Interface* inst = (addressIt++)->m_interface)
                             {
                                 bool result = false;
+                                EBUS_PROFILE_HANDLER_CALL();
                                 Traits::EventProcessingPolicy::CallResult(result, callback, inst);
                                 if (!result)
                                 {
@@ -1166,7 +1248,9 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
+                        EBUS_PROFILE_DISPATCH(*context, callback);
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_PROFILE_LOCK_ACQUIRED();
 
                         auto& addresses = context->m_buses.m_addresses;
                         auto addressIt = addresses.find(id);
@@ -1176,6 +1260,7 @@ namespace AZ
                             {
                                 CallstackEntry entry(context, &id);
                                 bool result = false;
+                                EBUS_PROFILE_HANDLER_CALL();
                                 Traits::EventProcessingPolicy::CallResult(result, callback, inst);
                                 if (!result)
                                 {
@@ -1190,7 +1275,9 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
+                        EBUS_PROFILE_DISPATCH(*context, callback);
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_PROFILE_LOCK_ACQUIRED();
 
                         if (ptr)
                         {
@@ -1198,6 +1285,7 @@ namespace AZ
                             {
                                 CallstackEntry entry(context, &ptr->m_busId);
                                 bool result = false;
+                                EBUS_PROFILE_HANDLER_CALL();
                                 Traits::EventProcessingPolicy::CallResult(result, callback, inst);
                                 if (!result)
                                 {
@@ -1335,7 +1423,9 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
+                        EBUS_PROFILE_DISPATCH(*context, func);
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_PROFILE_LOCK_ACQUIRED();
                         EBUS_DO_ROUTING(*context, nullptr, false, false);
 
                         auto& handlers = context->m_buses.m_handlers;
@@ -1361,6 +1451,7 @@ namespace AZ
                             // @func and @args cannot be forwarded here as rvalue arguments need to bind to const lvalue arguments
                             // due to potential of multiple handlers of this EBus container invoking the function multiple times
                             auto itr = handlerIt++;
+                            EBUS_PROFILE_HANDLER_CALL();
                             Traits::EventProcessingPolicy::Call(func, *itr, args...);
                         }
                     }
@@ -1370,7 +1461,9 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
+                        EBUS_PROFILE_DISPATCH(*context, func);
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_PROFILE_LOCK_ACQUIRED();
                         EBUS_DO_ROUTING(*context, nullptr, false, false);
 
                         auto& handlers = context->m_buses.m_handlers;
@@ -1396,6 +1489,7 @@ namespace AZ
                             // @func and @args cannot be forwarded here as rvalue arguments need to bind to const lvalue arguments
                             // due to potential of multiple handlers of this EBus container invoking the function multiple times
                             auto itr = handlerIt++;
+                            EBUS_PROFILE_HANDLER_CALL();
                             Traits::EventProcessingPolicy::CallResult(results, func, *itr, args...);
                         }
                     }
@@ -1405,7 +1499,9 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
+                        EBUS_PROFILE_DISPATCH(*context, func);
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_PROFILE_LOCK_ACQUIRED();
                         EBUS_DO_ROUTING(*context, nullptr, false, true);
 
                         auto& handlers = context->m_buses.m_handlers;
@@ -1417,6 +1513,7 @@ namespace AZ
                             // @func and @args cannot be forwarded here as rvalue arguments need to bind to const lvalue arguments
                             // due to potential of multiple handlers of this EBus container invoking the function multiple times
                             auto itr = handlerIt++;
+                            EBUS_PROFILE_HANDLER_CALL();
                             Traits::EventProcessingPolicy::Call(func, *itr, args...);
                         }
                     }
@@ -1426,7 +1523,9 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
+                        EBUS_PROFILE_DISPATCH(*context, func);
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_PROFILE_LOCK_ACQUIRED();
                         EBUS_DO_ROUTING(*context, nullptr, false, true);
 
                         auto& handlers = context->m_buses.m_handlers;
@@ -1438,6 +1537,7 @@ namespace AZ
                             // @func and @args cannot be forwarded here as rvalue arguments need to bind to const lvalue arguments
                             // due to potential of multiple handlers of this EBus container invoking the function multiple times
                             auto itr = handlerIt++;
+                            EBUS_PROFILE_HANDLER_CALL();
                             Traits::EventProcessingPolicy::CallResult(results, func, *itr, args...);
                         }
                     }
@@ -1449,7 +1549,9 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
+                        EBUS_PROFILE_DISPATCH(*context, callback);
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_PROFILE_LOCK_ACQUIRED();
 
                         auto& handlers = context->m_buses.m_handlers;
                         auto handlerIt = handlers.begin();
@@ -1473,6 +1575,7 @@ namespace AZ
                         {
                             bool result = false;
                             auto itr = handlerIt++;
+                            EBUS_PROFILE_HANDLER_CALL();
                             Traits::EventProcessingPolicy::CallResult(result, callback, itr->m_interface);
                             if (!result)
                             {
@@ -1529,13 +1632,16 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
+                        EBUS_PROFILE_DISPATCH(*context, func);
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_PROFILE_LOCK_ACQUIRED();
                         EBUS_DO_ROUTING(*context, nullptr, false, false);
 
                         auto handler = context->m_buses.m_handler;
                         if (handler)
                         {
                             CallstackEntry entry(context, nullptr);
+                            EBUS_PROFILE_HANDLER_CALL();
                             Traits::EventProcessingPolicy::Call(AZStd::forward<Function>(func), handler, AZStd::forward<ArgsT>(args)...);
                         }
                     }
@@ -1545,13 +1651,16 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
+                        EBUS_PROFILE_DISPATCH(*context, func);
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_PROFILE_LOCK_ACQUIRED();
                         EBUS_DO_ROUTING(*context, nullptr, false, false);
 
                         auto handler = context->m_buses.m_handler;
                         if (handler)
                         {
                             CallstackEntry entry(context, nullptr);
+                            EBUS_PROFILE_HANDLER_CALL();
                             Traits::EventProcessingPolicy::CallResult(results, AZStd::forward<Function>(func), handler, AZStd::forward<ArgsT>(args)...);
                         }
                     }
@@ -1561,13 +1670,16 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
+                        EBUS_PROFILE_DISPATCH(*context, func);
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_PROFILE_LOCK_ACQUIRED();
                         EBUS_DO_ROUTING(*context, nullptr, false, false);
 
                         auto handler = context->m_buses.m_handler;
                         if (handler)
                         {
                             CallstackEntry entry(context, nullptr);
+                            EBUS_PROFILE_HANDLER_CALL();
                             Traits::EventProcessingPolicy::Call(AZStd::forward<Function>(func), handler, AZStd::forward<ArgsT>(args)...);
                         }
                     }
@@ -1577,13 +1689,16 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
+                        EBUS_PROFILE_DISPATCH(*context, func);
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_PROFILE_LOCK_ACQUIRED();
                         EBUS_DO_ROUTING(*context, nullptr, false, false);
 
                         auto handler = context->m_buses.m_handler;
                         if (handler)
                         {
                             CallstackEntry entry(context, nullptr);
+                            EBUS_PROFILE_HANDLER_CALL();
                             Traits::EventProcessingPolicy::CallResult(results, AZStd::forward<Function>(func), handler, AZStd::forward<ArgsT>(args)...);
                         }
                     }
@@ -1595,12 +1710,15 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
+                        EBUS_PROFILE_DISPATCH(*context, callback);
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_PROFILE_LOCK_ACQUIRED();
 
                         auto handler = context->m_buses.m_handler;
                         if (handler)
                         {
                             CallstackEntry entry(context, nullptr);
+                            EBUS_PROFILE_HANDLER_CALL();
                             Traits::EventProcessingPolicy::Call(callback, handler);
                         }
                     }
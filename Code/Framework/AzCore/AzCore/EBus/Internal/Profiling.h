@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+// Set to 1 to record the dispatch statistics of every EBus. The statistics are printed with the ebus_DumpProfile console
+// command and every dispatch is reported to the profiler as an event named after the bus.
+#ifndef AZ_EBUS_PROFILING
+#define AZ_EBUS_PROFILING 0
+#endif
+
+#if AZ_EBUS_PROFILING
+#include <AzCore/EBus/Environment.h>
+#include <AzCore/std/chrono/clocks.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/hash.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/scoped_lock.h>
+#include <AzCore/std/string/string_view.h>
+#include <AzCore/std/typetraits/decay.h>
+#include <AzCore/std/typetraits/is_member_function_pointer.h>
+
+namespace AZ
+{
+    namespace Internal
+    {
+        //! Identifies an event by the type of the function that was dispatched and, for member functions, by the member
+        //! function pointer itself so events with the same signature are recorded separately.
+        struct EBusEventKey
+        {
+            size_t m_signatureHash = 0;
+            u64 m_function[2] = { 0, 0 };
+
+            bool operator==(const EBusEventKey& rhs) const
+            {
+                return m_signatureHash == rhs.m_signatureHash && m_function[0] == rhs.m_function[0] && m_function[1] == rhs.m_function[1];
+            }
+        };
+
+        struct EBusEventKeyHasher
+        {
+            size_t operator()(const EBusEventKey& key) const
+            {
+                size_t hash = key.m_signatureHash;
+                AZStd::hash_combine(hash, key.m_function[0], key.m_function[1]);
+                return hash;
+            }
+        };
+
+        //! Statistics for a single event on a bus. Times are in nanoseconds and include nested dispatches.
+        struct EBusEventProfile
+        {
+            const char* m_signature = nullptr;
+            u64 m_dispatchCount = 0;
+            u64 m_handlerCallCount = 0;
+            u64 m_lockWaitTime = 0;
+            u64 m_dispatchTime = 0;
+        };
+
+        //! Dispatch statistics of a bus context. Every profile is registered with the EBusProfiler so the statistics of all
+        //! buses across all modules can be collected.
+        class EBusProfile
+        {
+        public:
+            using EventMap = AZStd::unordered_map<EBusEventKey, EBusEventProfile, EBusEventKeyHasher, AZStd::equal_to<EBusEventKey>, EBusEnvironmentAllocator>;
+
+            explicit EBusProfile(const char* busName);
+            ~EBusProfile();
+
+            EBusProfile(const EBusProfile&) = delete;
+            EBusProfile& operator=(const EBusProfile&) = delete;
+
+            void Record(const EBusEventKey& key, const char* signature, u64 handlerCallCount, u64 lockWaitTime, u64 dispatchTime);
+            void Reset();
+
+            //! Calls the visitor with the statistics of every event while the statistics are locked.
+            template<class Visitor>
+            void Visit(Visitor&& visitor)
+            {
+                AZStd::scoped_lock lock(m_eventsMutex);
+                for (const auto& event : m_events)
+                {
+                    visitor(event.first, event.second);
+                }
+            }
+
+            const char* GetBusName() const { return m_busName; }
+
+        private:
+            const char* m_busName;
+            AZStd::mutex m_eventsMutex;
+            EventMap m_events;
+        };
+
+        //! Collects the statistics of all registered bus profiles.
+        class EBusProfiler
+        {
+        public:
+            static void Register(EBusProfile& profile);
+            static void Unregister(EBusProfile& profile);
+
+            //! Prints the statistics of the maxBuses buses with the highest total dispatch time. Contexts of the same bus are combined.
+            static void PrintStatistics(size_t maxBuses);
+            static void ResetStatistics();
+
+            //! Marks the start and end of a dispatch in profiler captures.
+            static void BeginCapture(const char* busName);
+            static void EndCapture();
+        };
+
+        template<class Function>
+        const char* GetEBusEventSignature()
+        {
+            return AZ_FUNCTION_SIGNATURE;
+        }
+
+        template<class Function>
+        EBusEventKey MakeEBusEventKey(const Function& function)
+        {
+            using FunctionType = AZStd::decay_t<Function>;
+            // The signature is hashed once per module so the key is cheap to create on every dispatch.
+            static const size_t s_signatureHash = AZStd::hash<AZStd::string_view>()(GetEBusEventSignature<FunctionType>());
+
+            EBusEventKey key;
+            key.m_signatureHash = s_signatureHash;
+            if constexpr (AZStd::is_member_function_pointer_v<FunctionType> && sizeof(FunctionType) <= sizeof(key.m_function))
+            {
+                memcpy(key.m_function, &function, sizeof(FunctionType));
+            }
+            return key;
+        }
+
+        //! Measures a single dispatch on a bus and records it with the profile of the bus context when it goes out of scope.
+        class EBusDispatchProfileScope
+        {
+        public:
+            using Clock = AZStd::chrono::high_resolution_clock;
+
+            EBusDispatchProfileScope(EBusProfile& profile, const EBusEventKey& key, const char* signature)
+                : m_profile(profile)
+                , m_key(key)
+                , m_signature(signature)
+                , m_start(Clock::now())
+                , m_lockAcquired(m_start)
+            {
+                EBusProfiler::BeginCapture(profile.GetBusName());
+            }
+
+            ~EBusDispatchProfileScope()
+            {
+                EBusProfiler::EndCapture();
+                const Clock::time_point end = Clock::now();
+                m_profile.Record(m_key, m_signature, m_handlerCallCount,
+                    AZStd::chrono::duration_cast<AZStd::chrono::nanoseconds>(m_lockAcquired - m_start).count(),
+                    AZStd::chrono::duration_cast<AZStd::chrono::nanoseconds>(end - m_start).count());
+            }
+
+            void OnLockAcquired()
+            {
+                m_lockAcquired = Clock::now();
+            }
+
+            void OnHandlerCall()
+            {
+                ++m_handlerCallCount;
+            }
+
+        private:
+            EBusProfile& m_profile;
+            EBusEventKey m_key;
+            const char* m_signature;
+            Clock::time_point m_start;
+            Clock::time_point m_lockAcquired;
+            u64 m_handlerCallCount = 0;
+        };
+    } // namespace Internal
+} // namespace AZ
+
+#define EBUS_PROFILE_DISPATCH(context, func) \
+    AZ::Internal::EBusDispatchProfileScope ebusProfileScope((context).m_profile, AZ::Internal::MakeEBusEventKey(func), \
+        AZ::Internal::GetEBusEventSignature<AZStd::decay_t<decltype(func)>>())
+#define EBUS_PROFILE_LOCK_ACQUIRED() ebusProfileScope.OnLockAcquired()
+#define EBUS_PROFILE_HANDLER_CALL() ebusProfileScope.OnHandlerCall()
+#else
+#define EBUS_PROFILE_DISPATCH(...)
+#define EBUS_PROFILE_LOCK_ACQUIRED()
+#define EBUS_PROFILE_HANDLER_CALL()
+#endif // AZ_EBUS_PROFILING
@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/std/createdestroy.h>
+#include <AzCore/std/typetraits/conditional.h>
+#include <AzCore/std/typetraits/decay.h>
+#include <AzCore/std/typetraits/is_same.h>
+#include <AzCore/std/utils.h>
+
+namespace AZ
+{
+    namespace Internal
+    {
+        /**
+         * Type erased, move-only callable used to store the functions queued on an EBus. Unlike AZStd::function, closures of
+         * up to s_inlineStorageSize bytes are stored inside the object, so queueing an event with a few arguments doesn't
+         * require a heap allocation. Larger closures are allocated with the allocator of the bus.
+         */
+        template<class Allocator>
+        class QueuedMessageCall
+        {
+        public:
+            static constexpr size_t s_inlineStorageSize = 48;
+            static constexpr size_t s_inlineStorageAlignment = 16;
+
+            QueuedMessageCall() = default;
+
+            template<class Function, typename = AZStd::enable_if_t<!AZStd::is_same_v<AZStd::decay_t<Function>, QueuedMessageCall>>>
+            QueuedMessageCall(Function&& function, const Allocator& allocator = Allocator())
+                : m_allocator(allocator)
+            {
+                using FunctionType = AZStd::decay_t<Function>;
+                if constexpr (IsStoredInline<FunctionType>)
+                {
+                    new (&m_storage) FunctionType(AZStd::forward<Function>(function));
+                }
+                else
+                {
+                    void* memory = m_allocator.allocate(sizeof(FunctionType), alignof(FunctionType));
+                    *reinterpret_cast<FunctionType**>(&m_storage) = new (memory) FunctionType(AZStd::forward<Function>(function));
+                }
+                m_manager = &Manage<FunctionType>;
+            }
+
+            QueuedMessageCall(QueuedMessageCall&& rhs)
+                : m_allocator(rhs.m_allocator)
+            {
+                MoveFrom(rhs);
+            }
+
+            QueuedMessageCall& operator=(QueuedMessageCall&& rhs)
+            {
+                if (this != &rhs)
+                {
+                    Reset();
+                    m_allocator = rhs.m_allocator;
+                    MoveFrom(rhs);
+                }
+                return *this;
+            }
+
+            QueuedMessageCall(const QueuedMessageCall&) = delete;
+            QueuedMessageCall& operator=(const QueuedMessageCall&) = delete;
+
+            ~QueuedMessageCall()
+            {
+                Reset();
+            }
+
+            void operator()()
+            {
+                m_manager(Operation::Invoke, *this, nullptr);
+            }
+
+            explicit operator bool() const
+            {
+                return m_manager != nullptr;
+            }
+
+        private:
+            enum class Operation
+            {
+                Invoke,
+                Move,
+                Destroy
+            };
+            using Manager = void(*)(Operation, QueuedMessageCall& self, QueuedMessageCall* destination);
+
+            template<class FunctionType>
+            static constexpr bool IsStoredInline = sizeof(FunctionType) <= s_inlineStorageSize &&
+                s_inlineStorageAlignment % alignof(FunctionType) == 0;
+
+            template<class FunctionType>
+            static void Manage(Operation operation, QueuedMessageCall& self, QueuedMessageCall* destination)
+            {
+                if constexpr (IsStoredInline<FunctionType>)
+                {
+                    FunctionType* function = reinterpret_cast<FunctionType*>(&self.m_storage);
+                    switch (operation)
+                    {
+                    case Operation::Invoke:
+                        (*function)();
+                        break;
+                    case Operation::Move:
+                        new (&destination->m_storage) FunctionType(AZStd::move(*function));
+                        AZStd::destroy_at(function);
+                        break;
+                    case Operation::Destroy:
+                        AZStd::destroy_at(function);
+                        break;
+                    }
+                }
+                else
+                {
+                    FunctionType* function = *reinterpret_cast<FunctionType**>(&self.m_storage);
+                    switch (operation)
+                    {
+                    case Operation::Invoke:
+                        (*function)();
+                        break;
+                    case Operation::Move:
+                        // Only the pointer to the closure needs to be transferred.
+                        *reinterpret_cast<FunctionType**>(&destination->m_storage) = function;
+                        break;
+                    case Operation::Destroy:
+                        AZStd::destroy_at(function);
+                        self.m_allocator.deallocate(function, sizeof(FunctionType), alignof(FunctionType));
+                        break;
+                    }
+                }
+            }
+
+            void MoveFrom(QueuedMessageCall& rhs)
+            {
+                if (rhs.m_manager)
+                {
+                    rhs.m_manager(Operation::Move, rhs, this);
+                    m_manager = rhs.m_manager;
+                    rhs.m_manager = nullptr;
+                }
+            }
+
+            void Reset()
+            {
+                if (m_manager)
+                {
+                    m_manager(Operation::Destroy, *this, nullptr);
+                    m_manager = nullptr;
+                }
+            }
+
+            Manager m_manager = nullptr;
+            Allocator m_allocator;
+            alignas(s_inlineStorageAlignment) unsigned char m_storage[s_inlineStorageSize];
+        };
+    } // namespace Internal
+} // namespace AZ
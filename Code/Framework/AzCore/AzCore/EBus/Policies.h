@@ -17,6 +17,10 @@
 #include <AzCore/std/function/invoke.h>
 #include <AzCore/std/containers/queue.h>
 #include <AzCore/std/containers/intrusive_set.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/containers/mpmc_queue.h>
+
+#include <AzCore/EBus/Internal/QueuedMessageCall.h>
 
 #include <AzCore/Module/Environment.h>
 #include <AzCore/EBus/Environment.h>
@@ -236,59 +240,48 @@ namespace AZ
     template <class Bus, class MutexType>
     struct EBusQueuePolicy<true, Bus, MutexType>
     {
-        typedef AZStd::function<void()> BusMessageCall;
+        typedef AZ::Internal::QueuedMessageCall<typename Bus::AllocatorType> BusMessageCall;
+
+        typedef AZStd::mpmc_queue<BusMessageCall, typename Bus::AllocatorType> MessageQueueType;
 
-        typedef AZStd::deque<BusMessageCall, typename Bus::AllocatorType> DequeType;
-        typedef AZStd::queue<BusMessageCall, DequeType > MessageQueueType;
+        /// Number of queued messages that can be stored before queueing falls back to a locked overflow.
+        static constexpr size_t s_lockFreeCapacity = 128;
 
         EBusQueuePolicy() = default;
 
-        bool                        m_isActive = Bus::Traits::EventQueueingActiveByDefault;
-        MessageQueueType            m_messages;
-        MutexType                   m_messagesMutex;        ///< Used to control access to the m_messages. Make sure you never interlock with the EBus mutex. Otherwise, a deadlock can occur.
+        AZStd::atomic_bool          m_isActive{ Bus::Traits::EventQueueingActiveByDefault };
+        MessageQueueType            m_messages{ s_lockFreeCapacity }; ///< Lock-free so events can be queued from many threads without contention.
+
+        template <class Function>
+        void Queue(Function&& function)
+        {
+            m_messages.emplace(AZStd::forward<Function>(function), typename Bus::AllocatorType());
+        }
 
         void Execute()
         {
             AZ_Warning("System", m_isActive, "You are calling execute queued functions on a bus which has not activated its function queuing! Call YourBus::AllowFunctionQueuing(true)!");
-            while (true)
+            BusMessageCall invoke;
+            while (m_messages.try_pop(invoke))
             {
-                BusMessageCall invoke;
-
-                //////////////////////////////////////////////////////////////////////////
-                // Pop element from the queue.
-                {
-                    AZStd::lock_guard<MutexType> lock(m_messagesMutex);
-                    size_t numMessages = m_messages.size();
-                    if (numMessages == 0)
-                    {
-                        break;
-                    }
-                    AZStd::swap(invoke, m_messages.front());
-                    m_messages.pop();
-                    if (numMessages == 1)
-                    {
-                        m_messages.get_container().clear(); // If it was the last message, free all memory.
-                    }
-                }
-                //////////////////////////////////////////////////////////////////////////
-
                 invoke();
             }
         }
 
         void Clear()
         {
-            AZStd::lock_guard<MutexType> lock(m_messagesMutex);
-            m_messages.get_container().clear();
+            BusMessageCall message;
+            while (m_messages.try_pop(message))
+            {
+            }
         }
 
         void SetActive(bool isActive)
         {
-            AZStd::lock_guard<MutexType> lock(m_messagesMutex);
             m_isActive = isActive;
-            if (!m_isActive)
+            if (!isActive)
             {
-                m_messages.get_container().clear();
+                Clear();
             }
         };
 
@@ -299,8 +292,7 @@ namespace AZ
 
         size_t Count()
         {
-            AZStd::lock_guard<MutexType> lock(m_messagesMutex);
-            return m_messages.size();
+            return m_messages.size_approx();
         }
     };
 
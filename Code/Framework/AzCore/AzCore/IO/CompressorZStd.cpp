@@ -17,9 +17,10 @@ namespace AZ
 {
     namespace IO
     {
-        CompressorZStd::CompressorZStd(unsigned int decompressionCachePerStream, unsigned int dataBufferSize)
+        CompressorZStd::CompressorZStd(unsigned int decompressionCachePerStream, unsigned int dataBufferSize, unsigned int numCompressionWorkers)
             : m_compressedDataBufferSize(dataBufferSize)
             , m_decompressionCachePerStream(decompressionCachePerStream)
+            , m_numCompressionWorkers(numCompressionWorkers)
 
         {
             AZ_Assert((dataBufferSize % (32 * 1024)) == 0, "Data buffer size %d must be multiple of 32 KB.", dataBufferSize);
@@ -67,7 +68,8 @@ namespace AZ
             zstdData->m_zstdHeader = *reinterpret_cast<ZStd::Header*>(data);
             dataSize -= sizeof(zstdData->m_zstdHeader);
             data += sizeof(zstdData->m_zstdHeader);
-            zstdData->m_decompressNextOffset = sizeof(CompressorHeader) + sizeof(CompressorZStdHeader) + sizeof(ZStd::Header); // start after the headers
+            // the zstd header is the start of the first frame, decompression starts with it
+            zstdData->m_decompressNextOffset = sizeof(CompressorHeader) + sizeof(CompressorZStdHeader);
 
             AZ_Error("CompressorZStd", hdr->m_numSeekPoints > 0, "We should have at least one seek point for the entire stream.");
 
@@ -260,7 +262,7 @@ namespace AZ
                 zstdData->m_decompressNextOffset = bestSeekPoint.m_compressedOffset;  // set next read point
                 zstdData->m_decompressedCacheOffset = bestSeekPoint.m_uncompressedOffset; // set uncompressed offset
                 zstdData->m_decompressedCacheDataSize = 0; // invalidate the cache
-                zstdData->m_zstd.ResetDecompressor(&zstdData->m_zstdHeader); // reset decompressor and setup the header.
+                zstdData->m_zstd.ResetDecompressor(&zstdData->m_zstdHeader); // reset decompressor, seek points start a new frame.
             }
 
             // decompress and move forward until the request is done
@@ -280,14 +282,13 @@ namespace AZ
 
                     // decompress in the cache buffer
                     u32 availDecompressedCacheSize = m_decompressionCachePerStream; // reset buffer size
-                    size_t nextBlockSize;
                     unsigned int processed = zstdData->m_zstd.Decompress(&m_compressedDataBuffer[processedCompressedData], 
                                                                         static_cast<unsigned int>(compressedDataSize) - processedCompressedData,
                                                                         zstdData->m_decompressedCache, 
-                                                                        availDecompressedCacheSize, 
-                                                                        &nextBlockSize);
+                                                                        availDecompressedCacheSize);
                     zstdData->m_decompressedCacheDataSize = m_decompressionCachePerStream - availDecompressedCacheSize;
-                    if (processed == 0)
+                    // zstd can produce data buffered from previous input without processing more, carry on while it does
+                    if (processed == 0 && zstdData->m_decompressedCacheDataSize == 0)
                     {
                         break; // we processed everything we could, load more compressed data.
                     }
@@ -357,6 +358,7 @@ namespace AZ
 
             m_lastReadStream = nullptr; // invalidate last read position, otherwise m_dataBuffer will be corrupted (as we are about to write in it).
 
+            // end the frame, so the data after the seek point can be decompressed independently of the data before it
             unsigned int compressedSize;
             unsigned int dataToCompress = 0;
             do
@@ -371,7 +373,7 @@ namespace AZ
                         return false; // error we wrote less than than requested!
                     }
                 }
-            } while (dataToCompress != 0);
+            } while (compressedSize == m_compressedDataBufferSize); // a full buffer means the flush may not be complete
 
             CompressorZStdSeekPoint sp;
             sp.m_compressedOffset = stream->GetLength();
@@ -393,7 +395,7 @@ namespace AZ
             zstdData->m_autoSeekSize = autoSeekDataSize;
             compressionLevel = AZ::GetClamp(compressionLevel, 1, 9); // remap to zlib levels
 
-            zstdData->m_zstd.StartCompressor(compressionLevel);
+            zstdData->m_zstd.StartCompressor(compressionLevel, m_numCompressionWorkers);
 
             stream->SetCompressorData(zstdData);
 
@@ -401,7 +403,7 @@ namespace AZ
             {
                 // add the first and always present seek point at the start of the compressed stream
                 CompressorZStdSeekPoint sp;
-                sp.m_compressedOffset = sizeof(CompressorHeader) + sizeof(CompressorZStdHeader) + sizeof(zstdData->m_zstdHeader);
+                sp.m_compressedOffset = sizeof(CompressorHeader) + sizeof(CompressorZStdHeader);
                 sp.m_uncompressedOffset = 0;
                 zstdData->m_seekPoints.push_back(sp);
                 return true;
@@ -431,7 +433,7 @@ namespace AZ
                     {
                         baseStream->Write(compressedSize, m_compressedDataBuffer);
                     }
-                } while (dataToCompress != 0);
+                } while (compressedSize == m_compressedDataBufferSize); // a full buffer means the flush may not be complete
 
                 result = WriteHeaderAndData(stream);
                 if (result)
@@ -57,7 +57,7 @@ namespace AZ
             AZ::u64           m_decompressLastOffset{};     ///< Last valid offset in the compressed stream of the compressed data. Used only when we decompress.
             unsigned char*    m_decompressedCache{};      ///< Decompressed stream cache.
             unsigned int      m_decompressedCacheDataSize{};   ///< Number of valid bytes in the decompressed cache.
-            ZStd::Header      m_zstdHeader;                       ///< Stored 2 bytes header of the zlib when we reset the decompressor.
+            ZStd::Header      m_zstdHeader;                       ///< Magic number at the start of the first zstd frame.
             union
             {
                 AZ::u64       m_decompressedCacheOffset{};  ///< Used when decompressing. Decompressed cache is the data offset in the uncompressed data stream.
@@ -81,8 +81,10 @@ namespace AZ
              * We can convert this system to use pools of caches, but as of now this should be fine.
              * \param dataBufferSize we have one compressor per device, only one stream can read/write at a time and the data buffer is shared for IO operations,
              * the buffer is refCounted and existing only when we read/write compressed streams.
+             * \param numCompressionWorkers number of zstd worker threads compressing each written stream, 0 compresses on the writing thread.
+             * Every seek point ends a zstd frame, so the data between two seek points can be decompressed independently.
              */
-            CompressorZStd(unsigned int decompressionCachePerStream = 64* 1024, unsigned int dataBufferSize = 128* 1024);
+            CompressorZStd(unsigned int decompressionCachePerStream = 64* 1024, unsigned int dataBufferSize = 128* 1024, unsigned int numCompressionWorkers = 0);
 
             ~CompressorZStd() override;
 
@@ -124,6 +126,7 @@ namespace AZ
             unsigned int        m_compressedDataBufferSize;                   ///< Data buffer size (stored so we can lazy allocate m_dataBuffer as we need).
             unsigned int        m_compressedDataBufferUseCount = 0;           ///< Data buffer use count.
             unsigned int        m_decompressionCachePerStream;      ///< Cache per stream for each compressed stream stream in bytes.
+            unsigned int        m_numCompressionWorkers;            ///< Number of zstd worker threads used when compressing a stream.
         };
     }   // namespace IO
 }   // namespace AZ
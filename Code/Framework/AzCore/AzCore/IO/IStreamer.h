@@ -20,6 +20,11 @@
 #include <AzCore/IO/Streamer/Statistics.h>
 #include <AzCore/IO/Streamer/FileRequest.h>
 
+namespace AZ
+{
+    class Job;
+}
+
 namespace AZ::IO
 {
     /**
@@ -258,6 +263,15 @@ namespace AZ::IO
         //! @param callback A function with the signature "void(FileRequestHandle request);"
         //! @return A reference to the provided request.
         virtual FileRequestPtr& SetRequestCompleteCallback(FileRequestPtr& request, OnCompleteCallback callback) = 0;
+        //! Sets a job that will only run after the provided request completes, including when the request fails or is canceled.
+        //! This allows work that depends on the result of a request to be scheduled on the job system without a worker thread
+        //! having to wait in a callback or WaitForCompletion until the request completes. The job still needs to be started by
+        //! the caller as usual, but won't be picked up by a worker until the request is done. Note that this replaces the
+        //! completion callback of the request and that the request needs to be queued, otherwise the job will never run.
+        //! @param request The request the job will wait on.
+        //! @param dependent The job that runs after the request. The job needs to be in the setup state, so not started yet.
+        //! @return A reference to the provided request.
+        virtual FileRequestPtr& SetRequestCompleteDependent(FileRequestPtr& request, Job& dependent) = 0;
 
         //
         // Streamer request management.
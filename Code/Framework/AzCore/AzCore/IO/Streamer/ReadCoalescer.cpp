@@ -0,0 +1,266 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/ReadCoalescer.h>
+#include <AzCore/IO/Streamer/StreamerContext.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/std/sort.h>
+
+namespace AZ
+{
+    namespace IO
+    {
+        AZStd::shared_ptr<StreamStackEntry> ReadCoalescerConfig::AddStreamStackEntry(
+            const HardwareInformation& hardware, AZStd::shared_ptr<StreamStackEntry> parent)
+        {
+            auto stackEntry = AZStd::make_shared<ReadCoalescer>(
+                aznumeric_cast<u64>(m_mergeWindowKib) * 1_kib,
+                aznumeric_cast<u64>(m_maxMergedReadSizeKib) * 1_kib,
+                m_maxNumMergedReads,
+                aznumeric_caster(hardware.m_maxPhysicalSectorSize));
+            stackEntry->SetNext(AZStd::move(parent));
+            return stackEntry;
+        }
+
+        void ReadCoalescerConfig::Reflect(AZ::ReflectContext* context)
+        {
+            if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context); serializeContext != nullptr)
+            {
+                serializeContext->Class<ReadCoalescerConfig, IStreamerStackConfig>()
+                    ->Version(1)
+                    ->Field("MergeWindowKib", &ReadCoalescerConfig::m_mergeWindowKib)
+                    ->Field("MaxMergedReadSizeKib", &ReadCoalescerConfig::m_maxMergedReadSizeKib)
+                    ->Field("MaxNumMergedReads", &ReadCoalescerConfig::m_maxNumMergedReads);
+            }
+        }
+
+        static constexpr char MergedReadsName[] = "Merged reads";
+        static constexpr char AvgNumReadsPerMergeName[] = "Avg. num reads per merge";
+        static constexpr char NumInFlightMergedReadsName[] = "Num in-flight merged reads";
+
+        ReadCoalescer::ReadCoalescer(u64 mergeWindow, u64 maxMergedReadSize, u32 maxNumMergedReads, u32 memoryAlignment)
+            : StreamStackEntry("Read coalescer")
+            , m_mergeWindow(mergeWindow)
+            , m_maxMergedReadSize(maxMergedReadSize)
+            , m_maxNumMergedReads(AZStd::max(maxNumMergedReads, 1u))
+            , m_memoryAlignment(memoryAlignment)
+        {
+            AZ_Assert(IStreamerTypes::IsPowerOf2(memoryAlignment), "Memory alignment needs to be a power of 2");
+            m_heldReads.reserve(m_maxNumMergedReads);
+        }
+
+        void ReadCoalescer::QueueRequest(FileRequest* request)
+        {
+            AZ_Assert(request, "QueueRequest was provided a null request.");
+            if (!m_next)
+            {
+                request->SetStatus(IStreamerTypes::RequestStatus::Failed);
+                m_context->MarkRequestAsCompleted(request);
+                return;
+            }
+
+            auto data = AZStd::get_if<FileRequest::ReadData>(&request->GetCommand());
+            if (data == nullptr)
+            {
+                // Release the held reads first so they're not reordered with requests such as flushes.
+                QueueHeldReads();
+                StreamStackEntry::QueueRequest(request);
+                return;
+            }
+
+            if (data->m_size >= m_maxMergedReadSize || m_maxNumMergedReads == 1)
+            {
+                // Nothing can be merged with this read, so there's no benefit to holding on to it.
+                m_mergedReadsStat.PushSample(0.0);
+                StreamStackEntry::QueueRequest(request);
+                return;
+            }
+
+            HeldRead held;
+            held.m_request = request;
+            held.m_pathHash = data->m_path.GetHash();
+            held.m_offset = data->m_offset;
+            held.m_size = data->m_size;
+            m_heldReads.push_back(held);
+        }
+
+        bool ReadCoalescer::ExecuteRequests()
+        {
+            bool hasQueuedReads = !m_heldReads.empty();
+            QueueHeldReads();
+            bool hasProcessedRequests = StreamStackEntry::ExecuteRequests();
+            return hasQueuedReads || hasProcessedRequests;
+        }
+
+        void ReadCoalescer::QueueHeldReads()
+        {
+            if (m_heldReads.empty())
+            {
+                return;
+            }
+
+            AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzCore);
+
+            // Group the reads per file and order them by offset so neighboring reads end up next to each other.
+            AZStd::sort(m_heldReads.begin(), m_heldReads.end(), [](const HeldRead& lhs, const HeldRead& rhs)
+                {
+                    return lhs.m_pathHash != rhs.m_pathHash ? lhs.m_pathHash < rhs.m_pathHash : lhs.m_offset < rhs.m_offset;
+                });
+
+            const HeldRead* heldBegin = m_heldReads.data();
+            const HeldRead* heldEnd = heldBegin + m_heldReads.size();
+            const HeldRead* first = heldBegin;
+            while (first != heldEnd)
+            {
+                const RequestPath& path = AZStd::get<FileRequest::ReadData>(first->m_request->GetCommand()).m_path;
+                u64 mergedEnd = first->m_offset + first->m_size;
+                const HeldRead* last = first + 1;
+                while (last != heldEnd &&
+                    aznumeric_cast<u32>(last - first) < m_maxNumMergedReads &&
+                    last->m_pathHash == first->m_pathHash &&
+                    last->m_offset <= mergedEnd + m_mergeWindow &&
+                    AZStd::max(mergedEnd, last->m_offset + last->m_size) - first->m_offset <= m_maxMergedReadSize &&
+                    AZStd::get<FileRequest::ReadData>(last->m_request->GetCommand()).m_path == path)
+                {
+                    mergedEnd = AZStd::max(mergedEnd, last->m_offset + last->m_size);
+                    ++last;
+                }
+
+                size_t numReads = last - first;
+                if (numReads == 1)
+                {
+                    m_mergedReadsStat.PushSample(0.0);
+                    m_next->QueueRequest(first->m_request);
+                }
+                else
+                {
+                    QueueMergedRead(first, last);
+                }
+                first = last;
+            }
+            m_heldReads.clear();
+        }
+
+        void ReadCoalescer::QueueMergedRead(const HeldRead* begin, const HeldRead* end)
+        {
+            const FileRequest::ReadData& firstData = AZStd::get<FileRequest::ReadData>(begin->m_request->GetCommand());
+            u64 offset = begin->m_offset;
+            u64 mergedEnd = 0;
+            bool sharedRead = false;
+
+            MergedRead merged;
+            merged.m_sections.reserve(end - begin);
+            for (const HeldRead* held = begin; held != end; ++held)
+            {
+                const FileRequest::ReadData& data = AZStd::get<FileRequest::ReadData>(held->m_request->GetCommand());
+                sharedRead = sharedRead || data.m_sharedRead;
+                mergedEnd = AZStd::max(mergedEnd, held->m_offset + held->m_size);
+
+                // The wait keeps the original request from completing until the data has been copied into its output.
+                MergedSection section;
+                section.m_wait = m_context->GetNewInternalRequest();
+                section.m_wait->CreateWait(held->m_request);
+                section.m_output = reinterpret_cast<u8*>(data.m_output);
+                section.m_bufferOffset = held->m_offset - offset;
+                section.m_copySize = held->m_size;
+                merged.m_sections.push_back(section);
+
+                m_mergedReadsStat.PushSample(1.0);
+            }
+
+            m_averageNumReadsPerMergeStat.PushSample(aznumeric_cast<double>(merged.m_sections.size()));
+            Statistic::PlotImmediate(m_name, AvgNumReadsPerMergeName, m_averageNumReadsPerMergeStat.GetMostRecentSample());
+
+            merged.m_bufferSize = mergedEnd - offset;
+            merged.m_buffer = reinterpret_cast<u8*>(AZ::AllocatorInstance<AZ::SystemAllocator>::Get().Allocate(
+                merged.m_bufferSize, m_memoryAlignment, 0, "AZ::IO::Streamer ReadCoalescer", __FILE__, __LINE__));
+
+            // The merged read has no parent as it serves multiple requests. The original requests are completed
+            // through their waits instead. The path is owned by the first request, which outlives the merged read.
+            merged.m_request = m_context->GetNewInternalRequest();
+            merged.m_request->CreateRead(nullptr, merged.m_buffer, merged.m_bufferSize, firstData.m_path,
+                offset, merged.m_bufferSize, sharedRead);
+            merged.m_request->SetCompletionCallback([this](FileRequest& request)
+                {
+                    AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzCore);
+                    CompleteMergedRead(request);
+                });
+
+            FileRequest* mergedRequest = merged.m_request;
+            m_inFlightReads.push_back(AZStd::move(merged));
+            m_next->QueueRequest(mergedRequest);
+        }
+
+        void ReadCoalescer::CompleteMergedRead(FileRequest& request)
+        {
+            auto it = AZStd::find_if(m_inFlightReads.begin(), m_inFlightReads.end(),
+                [&request](const MergedRead& merged) { return merged.m_request == &request; });
+            AZ_Assert(it != m_inFlightReads.end(), "Read coalescer was asked to complete a file request it never queued.");
+
+            IStreamerTypes::RequestStatus requestStatus = request.GetStatus();
+            bool requestWasSuccessful = requestStatus == IStreamerTypes::RequestStatus::Completed;
+            for (MergedSection& section : it->m_sections)
+            {
+                if (requestWasSuccessful)
+                {
+                    memcpy(section.m_output, it->m_buffer + section.m_bufferOffset, section.m_copySize);
+                }
+                section.m_wait->SetStatus(requestStatus);
+                m_context->MarkRequestAsCompleted(section.m_wait);
+            }
+
+            AZ::AllocatorInstance<AZ::SystemAllocator>::Get().DeAllocate(it->m_buffer, it->m_bufferSize, m_memoryAlignment);
+
+            if (it != m_inFlightReads.end() - 1)
+            {
+                *it = AZStd::move(m_inFlightReads.back());
+            }
+            m_inFlightReads.pop_back();
+        }
+
+        void ReadCoalescer::UpdateStatus(Status& status) const
+        {
+            StreamStackEntry::UpdateStatus(status);
+            // Held reads haven't been passed to the next entry yet so don't occupy any of its slots. As long as the next
+            // entry can take more work, keep accepting reads up to the merge limit to give the coalescer something to merge.
+            if (status.m_numAvailableSlots > 0)
+            {
+                status.m_numAvailableSlots = aznumeric_cast<s32>(m_maxNumMergedReads) - aznumeric_cast<s32>(m_heldReads.size());
+            }
+            status.m_isIdle = status.m_isIdle && m_heldReads.empty() && m_inFlightReads.empty();
+        }
+
+        void ReadCoalescer::UpdateCompletionEstimates(AZStd::chrono::system_clock::time_point now,
+            AZStd::vector<FileRequest*>& internalPending, StreamerContext::PreparedQueue::iterator pendingBegin,
+            StreamerContext::PreparedQueue::iterator pendingEnd)
+        {
+            StreamStackEntry::UpdateCompletionEstimates(now, internalPending, pendingBegin, pendingEnd);
+
+            // The merged reads don't have a parent, so forward their estimate to the requests they're serving.
+            for (MergedRead& merged : m_inFlightReads)
+            {
+                AZStd::chrono::system_clock::time_point estimate = merged.m_request->GetEstimatedCompletion();
+                for (MergedSection& section : merged.m_sections)
+                {
+                    section.m_wait->SetEstimatedCompletion(estimate);
+                }
+            }
+        }
+
+        void ReadCoalescer::CollectStatistics(AZStd::vector<Statistic>& statistics) const
+        {
+            statistics.push_back(Statistic::CreatePercentage(m_name, MergedReadsName, m_mergedReadsStat.GetAverage()));
+            statistics.push_back(Statistic::CreateFloat(m_name, AvgNumReadsPerMergeName, m_averageNumReadsPerMergeStat.GetAverage()));
+            statistics.push_back(Statistic::CreateInteger(m_name, NumInFlightMergedReadsName, aznumeric_caster(m_inFlightReads.size())));
+            StreamStackEntry::CollectStatistics(statistics);
+        }
+    } // namespace IO
+} // namespace AZ
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/IO/Streamer/Statistics.h>
+#include <AzCore/IO/Streamer/StreamStackEntry.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/Statistics/RunningStatistic.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ
+{
+    namespace IO
+    {
+        struct ReadCoalescerConfig final :
+            public IStreamerStackConfig
+        {
+            AZ_RTTI(AZ::IO::ReadCoalescerConfig, "{6A0F3B7E-2C1D-4E58-9B7A-3F0C8D2E1A64}", IStreamerStackConfig);
+            AZ_CLASS_ALLOCATOR(ReadCoalescerConfig, AZ::SystemAllocator, 0);
+
+            ~ReadCoalescerConfig() override = default;
+            AZStd::shared_ptr<StreamStackEntry> AddStreamStackEntry(
+                const HardwareInformation& hardware, AZStd::shared_ptr<StreamStackEntry> parent) override;
+            static void Reflect(AZ::ReflectContext* context);
+
+            //! The maximum number of bytes between two reads to the same file for them to still be merged. The bytes
+            //! in the gap are read from disk and discarded, so this should be set to roughly the amount of data the
+            //! device can read in the time it takes to issue a new read or seek.
+            u32 m_mergeWindowKib{ 16 };
+            //! The maximum size of a merged read. Merging stops once the combined read would exceed this size.
+            u32 m_maxMergedReadSizeKib{ 1024 };
+            //! The maximum number of reads that will be combined into a single merged read.
+            u32 m_maxNumMergedReads{ 32 };
+        };
+
+        //! Stream stack entry that combines reads to the same file that are close together into a single larger read.
+        //! Reads queued in the same scheduling pass are held until ExecuteRequests is called, after which reads that
+        //! overlap or are within the merge window of each other are issued as one read into an internal buffer. When
+        //! the merged read completes the data is copied back to the outputs of the original requests. This reduces
+        //! the number of calls to the OS and the number of seeks, which mostly benefits HDDs, optical drives and
+        //! network storage when many small reads are issued against the same archive.
+        //! This entry should be placed just above the entry that does the reading, e.g. the StorageDrive, as entries
+        //! such as the BlockCache and ReadSplitter determine the final size and alignment of the reads.
+        class ReadCoalescer
+            : public StreamStackEntry
+        {
+        public:
+            ReadCoalescer(u64 mergeWindow, u64 maxMergedReadSize, u32 maxNumMergedReads, u32 memoryAlignment);
+            ~ReadCoalescer() override = default;
+
+            void QueueRequest(FileRequest* request) override;
+            bool ExecuteRequests() override;
+            void UpdateStatus(Status& status) const override;
+            void UpdateCompletionEstimates(AZStd::chrono::system_clock::time_point now, AZStd::vector<FileRequest*>& internalPending,
+                StreamerContext::PreparedQueue::iterator pendingBegin, StreamerContext::PreparedQueue::iterator pendingEnd) override;
+
+            void CollectStatistics(AZStd::vector<Statistic>& statistics) const override;
+
+        private:
+            struct HeldRead
+            {
+                FileRequest* m_request{ nullptr };
+                size_t m_pathHash{ 0 };
+                u64 m_offset{ 0 };
+                u64 m_size{ 0 };
+            };
+
+            struct MergedSection
+            {
+                FileRequest* m_wait{ nullptr }; //!< Keeps the original request from completing until the merged read is done.
+                u8* m_output{ nullptr }; //!< The output of the original request.
+                u64 m_bufferOffset{ 0 }; //!< Offset into the merged buffer to start copying from.
+                u64 m_copySize{ 0 }; //!< Number of bytes to copy to the output.
+            };
+
+            struct MergedRead
+            {
+                FileRequest* m_request{ nullptr };
+                u8* m_buffer{ nullptr };
+                u64 m_bufferSize{ 0 };
+                AZStd::vector<MergedSection> m_sections;
+            };
+
+            void QueueHeldReads();
+            void QueueMergedRead(const HeldRead* begin, const HeldRead* end);
+            void CompleteMergedRead(FileRequest& request);
+
+            AZ::Statistics::RunningStatistic m_mergedReadsStat;
+            AZ::Statistics::RunningStatistic m_averageNumReadsPerMergeStat;
+            //! Reads that have been queued since the last call to ExecuteRequests.
+            AZStd::vector<HeldRead> m_heldReads;
+            //! Merged reads that have been queued on the next entry in the stack and are waiting to be completed.
+            AZStd::vector<MergedRead> m_inFlightReads;
+            u64 m_mergeWindow;
+            u64 m_maxMergedReadSize;
+            u32 m_maxNumMergedReads;
+            u32 m_memoryAlignment;
+        };
+    } // namespace IO
+} // namespace AZ
@@ -14,6 +14,12 @@ namespace AZ::IO
 {
     static constexpr char SchedulerName[] = "Scheduler";
     static constexpr char ImmediateReadsName[] = "Immediate reads";
+    static constexpr char AtRiskRequestsName[] = "At-risk requests";
+    static constexpr char QueueDepthName[] = "Queue depth";
+    static constexpr char DeadlineMarginName[] = "Deadline margin (us)";
+    // Upper limit for the deadline margin so a few very late requests, for instance due to a drive spinning up, don't
+    // cause every request to be treated as urgent for a long time.
+    static constexpr s64 MaxDeadlineMarginUs = 100'000;
 
     Scheduler::Scheduler(AZStd::shared_ptr<StreamStackEntry> streamStack, u64 memoryAlignment, u64 sizeAlignment, u64 granularity)
     {
@@ -69,10 +75,7 @@ namespace AZ::IO
     {
         AZ_Assert(m_isRunning, "Trying to queue a request when Streamer's scheduler isn't running.");
 
-        {
-            AZStd::scoped_lock lock(m_pendingRequestsLock);
-            m_pendingRequests.push_back(AZStd::move(request));
-        }
+        m_pendingRequests.push(AZStd::move(request));
         m_context.WakeUpSchedulingThread();
     }
 
@@ -80,9 +83,9 @@ namespace AZ::IO
     {
         AZ_Assert(m_isRunning, "Trying to queue a batch of requests when Streamer's scheduler isn't running.");
 
+        for (const FileRequestPtr& request : requests)
         {
-            AZStd::scoped_lock lock(m_pendingRequestsLock);
-            m_pendingRequests.insert(m_pendingRequests.end(), requests.begin(), requests.end());
+            m_pendingRequests.push(request);
         }
         m_context.WakeUpSchedulingThread();
     }
@@ -91,9 +94,9 @@ namespace AZ::IO
     {
         AZ_Assert(m_isRunning, "Trying to queue a batch of requests when Streamer's scheduler isn't running.");
 
+        for (FileRequestPtr& request : requests)
         {
-            AZStd::scoped_lock lock(m_pendingRequestsLock);
-            AZStd::move(requests.begin(), requests.end(), AZStd::back_inserter(m_pendingRequests));
+            m_pendingRequests.push(AZStd::move(request));
         }
         m_context.WakeUpSchedulingThread();
     }
@@ -120,6 +123,8 @@ namespace AZ::IO
         statistics.push_back(Statistic::CreateFloat(SchedulerName, "Processing speed (avg. mbps)", m_processingSpeedStat.CalculateAverage()));
         statistics.push_back(Statistic::CreatePercentage(SchedulerName, ImmediateReadsName, m_immediateReadsPercentageStat.GetAverage()));
 #endif
+        statistics.push_back(Statistic::CreateInteger(SchedulerName, AtRiskRequestsName, aznumeric_caster(m_threadData.m_numAtRiskRequests)));
+        statistics.push_back(Statistic::CreateInteger(SchedulerName, DeadlineMarginName, m_threadData.m_deadlineMargin.count()));
         m_context.CollectStatistics(statistics);
         m_threadData.m_streamStack->CollectStatistics(statistics);
     }
@@ -319,16 +324,14 @@ namespace AZ::IO
     {
         AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzCore);
 
+        FileRequestPtr pendingRequest;
+        while (m_pendingRequests.try_pop(pendingRequest))
         {
-            AZStd::scoped_lock lock(m_pendingRequestsLock);
-            if (!m_pendingRequests.empty())
-            {
-                outstandingRequests.swap(m_pendingRequests);
-            }
-            else
-            {
-                return false;
-            }
+            outstandingRequests.push_back(AZStd::move(pendingRequest));
+        }
+        if (outstandingRequests.empty())
+        {
+            return false;
         }
 
 #if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
@@ -467,8 +470,8 @@ namespace AZ::IO
             return Order::Equal;
         }
 
-        bool firstInPanic = first->GetEstimatedCompletion() > firstRead->m_deadline;
-        bool secondInPanic = second->GetEstimatedCompletion() > secondRead->m_deadline;
+        bool firstInPanic = Thread_IsAtRisk(first, *firstRead);
+        bool secondInPanic = Thread_IsAtRisk(second, *secondRead);
         // Both request are at risk of not completing before their deadline.
         if (firstInPanic && secondInPanic)
         {
@@ -540,6 +543,14 @@ namespace AZ::IO
         return Order::Equal;
     }
 
+    bool Scheduler::Thread_IsAtRisk(const FileRequest* request, const FileRequest::ReadRequestData& readRequest) const
+    {
+        // Compare against the time left instead of adding the margin to the estimate so requests without a deadline,
+        // which use the maximum time point, can't overflow.
+        AZStd::chrono::system_clock::time_point estimate = request->GetEstimatedCompletion();
+        return estimate > readRequest.m_deadline || readRequest.m_deadline - estimate < m_threadData.m_deadlineMargin;
+    }
+
     void Scheduler::Thread_ScheduleRequests()
     {
         AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzCore);
@@ -551,6 +562,23 @@ namespace AZ::IO
             pendingQueue.begin(), pendingQueue.end());
         m_threadData.m_internalPendingRequests.clear();
 
+        // The estimates are based on the measured throughput of the drives, but tend to be optimistic when the drive
+        // is under load. Use the measured lateness of completed requests to start promoting requests before they're late.
+        m_threadData.m_deadlineMargin = AZStd::chrono::microseconds(
+            AZStd::min(m_context.GetAverageCompletionLateness().count(), MaxDeadlineMarginUs));
+        size_t numAtRisk = 0;
+        for (const FileRequest* pending : pendingQueue)
+        {
+            const FileRequest::ReadRequestData* readRequest = pending->GetCommandFromChain<FileRequest::ReadRequestData>();
+            if (readRequest && Thread_IsAtRisk(pending, *readRequest))
+            {
+                ++numAtRisk;
+            }
+        }
+        m_threadData.m_numAtRiskRequests = numAtRisk;
+        Statistic::PlotImmediate(SchedulerName, AtRiskRequestsName, aznumeric_cast<double>(numAtRisk));
+        Statistic::PlotImmediate(SchedulerName, QueueDepthName, aznumeric_cast<double>(pendingQueue.size()));
+
         if (m_context.GetNumPreparedRequests() > 1)
         {
             AZ_PROFILE_SCOPE_DYNAMIC(AZ::Debug::ProfileCategory::AzCore,
@@ -14,6 +14,7 @@
 #include <AzCore/IO/Streamer/StreamStackEntry.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/containers/mpmc_queue.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/smart_ptr/shared_ptr.h>
@@ -71,6 +72,8 @@ namespace AZ::IO
         };
         //! Determine which of the two provided requests is more important to process next.
         Order Thread_PrioritizeRequests(const FileRequest* first, const FileRequest* second) const;
+        //! Returns true if the request is expected to complete too close to or after its deadline.
+        bool Thread_IsAtRisk(const FileRequest* request, const FileRequest::ReadRequestData& readRequest) const;
         void Thread_ScheduleRequests();
 
         // Stores data that's unguarded and should only be changed by the scheduling thread.
@@ -82,6 +85,11 @@ namespace AZ::IO
             RequestPath m_lastFilePath; //!< Path of the last file queued for reading.
             AZStd::shared_ptr<StreamStackEntry> m_streamStack;
             u64 m_lastFileOffset{ 0 }; //!< Offset of into the last file queued after reading has completed.
+            //! Requests are considered at risk of missing their deadline if their estimated completion plus this margin is past
+            //! the deadline. The margin is based on how much later than estimated requests have been completing.
+            AZStd::chrono::microseconds m_deadlineMargin{ 0 };
+            //! The number of requests that were at risk of missing their deadline during the last scheduling pass.
+            size_t m_numAtRiskRequests{ 0 };
         };
         ThreadData m_threadData;
         StreamerContext m_context;
@@ -103,8 +111,8 @@ namespace AZ::IO
         AZ::Statistics::RunningStatistic m_immediateReadsPercentageStat;
 #endif
 
-        AZStd::mutex m_pendingRequestsLock;
-        AZStd::vector<FileRequestPtr> m_pendingRequests;
+        //! Requests queued by the main thread(s) that have not been picked up by the scheduler thread yet.
+        AZStd::mpmc_queue<FileRequestPtr> m_pendingRequests;
 
         AZStd::thread m_mainLoop;
         AZStd::atomic_bool m_isRunning{ false };
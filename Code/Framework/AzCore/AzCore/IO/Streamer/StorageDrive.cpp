@@ -19,6 +19,8 @@ namespace AZ
 {
     namespace IO
     {
+        static constexpr char ReadSpeedName[] = "Read Speed (avg. mbps)";
+
         AZStd::shared_ptr<StreamStackEntry> StorageDriveConfig::AddStreamStackEntry(
             [[maybe_unused]] const HardwareInformation& hardware, [[maybe_unused]] AZStd::shared_ptr<StreamStackEntry> parent)
         {
@@ -311,6 +313,7 @@ namespace AZ
                 bytesRead = file->Read(data->m_size, data->m_output);
             }
             m_readSizeAverage.PushEntry(bytesRead);
+            Statistic::PlotImmediate(m_name, ReadSpeedName, CalculateReadSpeedMbps());
 
             m_activeCacheSlot = cacheIndex;
             m_activeOffset = data->m_offset + bytesRead;
@@ -426,16 +429,21 @@ namespace AZ
             return s_fileNotFound;
         }
 
-        void StorageDrive::CollectStatistics(AZStd::vector<Statistic>& statistics) const
+        double StorageDrive::CalculateReadSpeedMbps() const
         {
             constexpr double bytesToMB = (1024.0 * 1024.0);
             using DoubleSeconds = AZStd::chrono::duration<double>;
-            
+
             double totalBytesReadMB = m_readSizeAverage.GetTotal() / bytesToMB;
             double totalReadTimeSec = AZStd::chrono::duration_cast<DoubleSeconds>(m_readTimeAverage.GetTotal()).count();
+            return totalBytesReadMB / totalReadTimeSec;
+        }
+
+        void StorageDrive::CollectStatistics(AZStd::vector<Statistic>& statistics) const
+        {
             if (m_readSizeAverage.GetTotal() > 1) // A default value is always added.
             {
-                statistics.push_back(Statistic::CreateFloat(m_name, "Read Speed (avg. mbps)", totalBytesReadMB / totalReadTimeSec));
+                statistics.push_back(Statistic::CreateFloat(m_name, ReadSpeedName, CalculateReadSpeedMbps()));
             }
 
             if (m_fileOpenCloseTimeAverage.GetNumRecorded() > 0)
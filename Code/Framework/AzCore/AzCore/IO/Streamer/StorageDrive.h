@@ -74,6 +74,8 @@ namespace AZ
                 const RequestPath*& activeFile, u64& activeOffset) const;
 
             void Report(const FileRequest::ReportData& data) const;
+            //! Returns the read speed in megabytes per second over the recent reads.
+            double CalculateReadSpeedMbps() const;
 
             TimedAverageWindow<s_statisticsWindowSize> m_fileOpenCloseTimeAverage;
             TimedAverageWindow<s_statisticsWindowSize> m_getFileExistsTimeAverage;
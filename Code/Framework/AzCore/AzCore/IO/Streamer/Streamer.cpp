@@ -10,6 +10,7 @@
 #include <AzCore/IO/Streamer/Streamer.h>
 #include <AzCore/IO/Streamer/StreamerConfiguration.h>
 #include <AzCore/IO/Streamer/StreamStackEntry.h>
+#include <AzCore/Jobs/Job.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 
 namespace AZ::IO
@@ -162,6 +163,18 @@ namespace AZ::IO
         return request;
     }
 
+    FileRequestPtr& Streamer::SetRequestCompleteDependent(FileRequestPtr& request, Job& dependent)
+    {
+        // The request holds on to one of the dependencies of the job, so the job isn't picked up by the job system until both the
+        // caller has started it and the request has completed, whichever comes last.
+        dependent.IncrementDependentCount();
+        request->m_request.SetCompletionCallback([job = &dependent](FileRequestHandle)
+            {
+                job->DecrementDependentCount();
+            });
+        return request;
+    }
+
     FileRequestPtr Streamer::CreateRequest()
     {
         return m_streamStack->CreateRequest();
@@ -123,6 +123,9 @@ namespace AZ::IO
         //! Sets a callback function that will trigger when the provided request completes.
         FileRequestPtr& SetRequestCompleteCallback(FileRequestPtr& request, OnCompleteCallback callback) override;
 
+        //! Sets a job that will not run until the provided request completes.
+        FileRequestPtr& SetRequestCompleteDependent(FileRequestPtr& request, Job& dependent) override;
+
         //
         // Streamer request management.
         //
@@ -17,6 +17,7 @@
 #include <AzCore/IO/Streamer/StreamerComponent.h>
 #include <AzCore/IO/Streamer/StreamerConfiguration.h>
 #include <AzCore/IO/Streamer/StorageDrive.h>
+#include <AzCore/IO/Streamer/ReadCoalescer.h>
 #include <AzCore/IO/Streamer/ReadSplitter.h>
 #include <AzCore/Interface/Interface.h>
 #include <AzCore/Settings/SettingsRegistry.h>
@@ -193,6 +194,7 @@ namespace AZ
         DedicatedCacheConfig::Reflect(context);
         IStreamerStackConfig::Reflect(context);
         FullFileDecompressorConfig::Reflect(context);
+        ReadCoalescerConfig::Reflect(context);
         ReadSplitterConfig::Reflect(context);
         StorageDriveConfig::Reflect(context);
         StreamerConfig::Reflect(context);
@@ -19,6 +19,8 @@ namespace AZ
         static constexpr char PredictionAccuracyName[] = "Prediction accuracy (ms)";
         static constexpr char LatePredictionName[] = "Early completions";
         static constexpr char MissedDeadlinesName[] = "Missed deadlines";
+        static constexpr char NumMissedDeadlinesName[] = "Missed deadlines (total)";
+        static constexpr char CompletionLatenessName[] = "Completion lateness (avg. us)";
 
         StreamerContext::~StreamerContext()
         {
@@ -154,9 +156,7 @@ namespace AZ
         {
             AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzCore);
 
-#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
             auto now = AZStd::chrono::system_clock::now();
-#endif
             bool hasCompletedRequests = false;
             while (true)
             {
@@ -202,13 +202,28 @@ namespace AZ
                                 m_latePredictionsPercentageStat.GetMostRecentSample());
                         }
                     }
+#endif // AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
                     auto readRequest = AZStd::get_if<FileRequest::ReadRequestData>(&top->GetCommand());
                     if (readRequest != nullptr)
                     {
-                        m_missedDeadlinePercentageStat.PushSample(now < readRequest->m_deadline ? 0.0 : 1.0);
+                        bool missedDeadline = now >= readRequest->m_deadline;
+                        ++m_numCompletedReads;
+                        if (missedDeadline)
+                        {
+                            ++m_numMissedDeadlines;
+                            Statistic::PlotImmediate(ContextName, NumMissedDeadlinesName, aznumeric_cast<double>(m_numMissedDeadlines));
+                        }
+                        if (top->m_estimatedCompletion > AZStd::chrono::system_clock::time_point())
+                        {
+                            m_completionLatenessAverage.PushEntry(top->m_estimatedCompletion < now
+                                ? AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(now - top->m_estimatedCompletion)
+                                : AZStd::chrono::microseconds(0));
+                        }
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+                        m_missedDeadlinePercentageStat.PushSample(missedDeadline ? 1.0 : 0.0);
                         Statistic::PlotImmediate(ContextName, MissedDeadlinesName, m_missedDeadlinePercentageStat.GetMostRecentSample());
-                    }
 #endif // AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+                    }
 
                     // Get all information before calling the completion routine as it's technically possible that an external
                     // request is recycled during the callback.
@@ -262,6 +277,11 @@ namespace AZ
             return m_threadSync;
         }
 
+        AZStd::chrono::microseconds StreamerContext::GetAverageCompletionLateness() const
+        {
+            return m_completionLatenessAverage.CalculateAverage();
+        }
+
         void StreamerContext::CollectStatistics(AZStd::vector<Statistic>& statistics)
         {
             statistics.push_back(
@@ -271,6 +291,9 @@ namespace AZ
             statistics.push_back(Statistic::CreatePercentage(ContextName, LatePredictionName, m_latePredictionsPercentageStat.GetAverage()));
             statistics.push_back(Statistic::CreatePercentage(ContextName, MissedDeadlinesName, m_missedDeadlinePercentageStat.GetAverage()));
 #endif // AZ_STREAMER_ADD_EXTRA_PROFILNG_INFO
+            statistics.push_back(Statistic::CreateInteger(ContextName, "Completed reads", aznumeric_caster(m_numCompletedReads)));
+            statistics.push_back(Statistic::CreateInteger(ContextName, NumMissedDeadlinesName, aznumeric_caster(m_numMissedDeadlines)));
+            statistics.push_back(Statistic::CreateInteger(ContextName, CompletionLatenessName, m_completionLatenessAverage.CalculateAverage().count()));
             statistics.push_back(Statistic::CreateInteger(ContextName, "Total requests", aznumeric_caster(m_pendingIdCounter)));
             statistics.push_back(Statistic::CreateInteger(ContextName, "Internal bucket size", aznumeric_caster(m_internalRecycleBin.size())));
             statistics.push_back(Statistic::CreateInteger(ContextName, "External bucket size", aznumeric_caster(m_externalRecycleBin.size())));
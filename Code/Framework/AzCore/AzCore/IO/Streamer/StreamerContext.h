@@ -85,6 +85,11 @@ namespace AZ
             //! Returns the native primitive(s) used to suspend and wake up the scheduling thread and possibly other threads.
             AZ::Platform::StreamerContextThreadSync& GetStreamerThreadSynchronizer();
 
+            //! Returns how much later than estimated read requests complete on average. Early completions count as
+            //! zero. The scheduler uses this as a safety margin to promote requests that are at risk of missing their
+            //! deadline before they actually do.
+            AZStd::chrono::microseconds GetAverageCompletionLateness() const;
+
             //! Collects statistics recorded during processing. This will only return statistics for the
             //! context. Use the CollectStatistics on AZ::IO::Streamer to get all statistics.
             void CollectStatistics(AZStd::vector<Statistic>& statistics);
@@ -122,6 +127,12 @@ namespace AZ
             AZ::Statistics::RunningStatistic m_missedDeadlinePercentageStat;
 #endif // AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
 
+            //! How much later than their estimate read requests completed. Unlike the profiling only statistics this
+            //! is always recorded as it feeds back into scheduling.
+            TimedAverageWindow<s_statisticsWindowSize> m_completionLatenessAverage;
+            size_t m_numCompletedReads{ 0 };
+            size_t m_numMissedDeadlines{ 0 };
+
             //! Platform-specific synchronization object used to suspend the Streamer thread and wake it up to resume procesing.
             AZ::Platform::StreamerContextThreadSync m_threadSync;
 
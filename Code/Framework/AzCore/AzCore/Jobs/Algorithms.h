@@ -9,6 +9,8 @@
 
 #include <AzCore/Jobs/task_group.h>
 #include <AzCore/std/allocator_stack.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/sort.h>
 
 #include <AzCore/std/parallel/spin_mutex.h>
 
@@ -766,6 +768,257 @@ namespace AZ
         group.run(f7);
         group.run_and_wait(f8);
     }
+
+    namespace Internal
+    {
+        // Minimum number of elements per chunk for the parallel sort, reduce and scan. Below this the overhead of the jobs
+        // outweighs the gain of running in parallel.
+        static constexpr ParallelIndexType s_minElementsPerChunk = 1024;
+
+        template<class Partition>
+        inline ParallelIndexType GetNumAlgorithmChunks(ParallelIndexType numElements, const Partition& partition, JobContext* jobContext)
+        {
+            ParallelIndexType numChunks = partition.GetNumChunks(numElements, jobContext);
+            numChunks = AZStd::GetMin(numChunks, numElements / s_minElementsPerChunk);
+            return AZStd::GetMax(numChunks, static_cast<ParallelIndexType>(1));
+        }
+
+        // Returns the offset of the first element of a chunk. Chunks differ at most by one element in size.
+        inline ParallelIndexType GetChunkOffset(ParallelIndexType chunk, ParallelIndexType numChunks, ParallelIndexType numElements)
+        {
+            return static_cast<ParallelIndexType>((static_cast<AZ::s64>(numElements) * chunk) / numChunks);
+        }
+
+        // Merges pairs of neighboring sorted runs from source into target. A run is "runLength" chunks long.
+        template<class SourceIterator, class TargetIterator, class Compare>
+        inline void ParallelMergePass(SourceIterator source, TargetIterator target, ParallelIndexType numChunks, ParallelIndexType numElements,
+            ParallelIndexType runLength, const Compare& comp, JobContext* jobContext)
+        {
+            const ParallelIndexType numPairs = (numChunks + (2 * runLength) - 1) / (2 * runLength);
+            parallel_for(static_cast<ParallelIndexType>(0), numPairs, [=, &comp](ParallelIndexType pair)
+                {
+                    const ParallelIndexType firstChunk = pair * 2 * runLength;
+                    const ParallelIndexType begin = GetChunkOffset(firstChunk, numChunks, numElements);
+                    const ParallelIndexType mid = GetChunkOffset(AZStd::GetMin(firstChunk + runLength, numChunks), numChunks, numElements);
+                    const ParallelIndexType end = GetChunkOffset(AZStd::GetMin(firstChunk + 2 * runLength, numChunks), numChunks, numElements);
+                    AZStd::merge(source + begin, source + mid, source + mid, source + end, target + begin, comp);
+                }, static_partitioner(), jobContext);
+        }
+    }
+
+    /**
+     * Sorts the range [first, last) in parallel. The range is split in chunks as determined by the partition, which
+     * are sorted in parallel and then merged pairwise, with every merge pass running in parallel as well. Small ranges
+     * are sorted on the calling thread. The sort is not stable and the value type needs to be copyable, as an additional
+     * buffer of the size of the range is used to merge into. This function will block until the sort is complete.
+     */
+    template<class RandomIterator, class Compare, class Partition>
+    void parallel_sort(RandomIterator first, RandomIterator last, const Compare& comp, const Partition& partition, JobContext* jobContext = nullptr)
+    {
+        using ValueType = typename AZStd::iterator_traits<RandomIterator>::value_type;
+
+        JobContext* context = jobContext ? jobContext : JobContext::GetParentContext();
+
+        const Internal::ParallelIndexType numElements = static_cast<Internal::ParallelIndexType>(last - first);
+        const Internal::ParallelIndexType numChunks = Internal::GetNumAlgorithmChunks(numElements, partition, context);
+        if (numChunks <= 1)
+        {
+            AZStd::sort(first, last, comp);
+            return;
+        }
+
+        parallel_for(static_cast<Internal::ParallelIndexType>(0), numChunks, [=, &comp](Internal::ParallelIndexType chunk)
+            {
+                AZStd::sort(first + Internal::GetChunkOffset(chunk, numChunks, numElements),
+                    first + Internal::GetChunkOffset(chunk + 1, numChunks, numElements), comp);
+            }, static_partitioner(), context);
+
+        // Ping-pong between the range and the buffer until there's a single sorted run left.
+        AZStd::vector<ValueType> buffer(first, last);
+        bool isInBuffer = false;
+        for (Internal::ParallelIndexType runLength = 1; runLength < numChunks; runLength *= 2)
+        {
+            if (isInBuffer)
+            {
+                Internal::ParallelMergePass(buffer.begin(), first, numChunks, numElements, runLength, comp, context);
+            }
+            else
+            {
+                Internal::ParallelMergePass(first, buffer.begin(), numChunks, numElements, runLength, comp, context);
+            }
+            isInBuffer = !isInBuffer;
+        }
+
+        if (isInBuffer)
+        {
+            auto source = buffer.begin();
+            parallel_for(static_cast<Internal::ParallelIndexType>(0), numChunks, [=](Internal::ParallelIndexType chunk)
+                {
+                    AZStd::copy(source + Internal::GetChunkOffset(chunk, numChunks, numElements),
+                        source + Internal::GetChunkOffset(chunk + 1, numChunks, numElements),
+                        first + Internal::GetChunkOffset(chunk, numChunks, numElements));
+                }, static_partitioner(), context);
+        }
+    }
+
+    template<class RandomIterator, class Compare>
+    void parallel_sort(RandomIterator first, RandomIterator last, const Compare& comp, JobContext* jobContext = nullptr)
+    {
+        parallel_sort(first, last, comp, auto_partitioner(), jobContext);
+    }
+
+    template<class RandomIterator>
+    void parallel_sort(RandomIterator first, RandomIterator last, JobContext* jobContext = nullptr)
+    {
+        parallel_sort(first, last, AZStd::less<typename AZStd::iterator_traits<RandomIterator>::value_type>(), auto_partitioner(), jobContext);
+    }
+
+    /**
+     * Combines all elements in the range [first, last) and init using the binary operation op. The range is split in chunks
+     * as determined by the partition, which are reduced in parallel. The partial results are combined in order, so op needs
+     * to be associative, but doesn't need to be commutative. This function will block until the reduction is complete.
+     */
+    template<class RandomIterator, class T, class BinaryOperation, class Partition>
+    T parallel_reduce(RandomIterator first, RandomIterator last, T init, const BinaryOperation& op, const Partition& partition,
+        JobContext* jobContext = nullptr)
+    {
+        JobContext* context = jobContext ? jobContext : JobContext::GetParentContext();
+
+        const Internal::ParallelIndexType numElements = static_cast<Internal::ParallelIndexType>(last - first);
+        const Internal::ParallelIndexType numChunks = Internal::GetNumAlgorithmChunks(numElements, partition, context);
+        if (numChunks <= 1)
+        {
+            for (; first != last; ++first)
+            {
+                init = op(init, *first);
+            }
+            return init;
+        }
+
+        AZStd::vector<T> partialResults(numChunks, init);
+        parallel_for(static_cast<Internal::ParallelIndexType>(0), numChunks, [=, &op, &partialResults](Internal::ParallelIndexType chunk)
+            {
+                RandomIterator current = first + Internal::GetChunkOffset(chunk, numChunks, numElements);
+                RandomIterator end = first + Internal::GetChunkOffset(chunk + 1, numChunks, numElements);
+                T result = *current;
+                for (++current; current != end; ++current)
+                {
+                    result = op(result, *current);
+                }
+                partialResults[chunk] = AZStd::move(result);
+            }, static_partitioner(), context);
+
+        for (T& partialResult : partialResults)
+        {
+            init = op(init, partialResult);
+        }
+        return init;
+    }
+
+    template<class RandomIterator, class T, class BinaryOperation>
+    T parallel_reduce(RandomIterator first, RandomIterator last, T init, const BinaryOperation& op, JobContext* jobContext = nullptr)
+    {
+        return parallel_reduce(first, last, AZStd::move(init), op, auto_partitioner(), jobContext);
+    }
+
+    template<class RandomIterator, class T>
+    T parallel_reduce(RandomIterator first, RandomIterator last, T init, JobContext* jobContext = nullptr)
+    {
+        return parallel_reduce(first, last, AZStd::move(init), AZStd::plus<T>(), auto_partitioner(), jobContext);
+    }
+
+    /**
+     * Writes the inclusive prefix combination of the range [first, last) to the range starting at result, so element i
+     * of the output holds op applied to element 0 through i of the input. The range is split in chunks as determined by
+     * the partition. First the total of every chunk is calculated in parallel, after which every chunk is scanned in
+     * parallel starting from the combined totals of the chunks before it. op needs to be associative. The input and
+     * output range are allowed to be the same. This function will block until the scan is complete.
+     * @return Iterator to the element past the last element written.
+     */
+    template<class RandomIterator, class OutputRandomIterator, class BinaryOperation, class Partition>
+    OutputRandomIterator parallel_inclusive_scan(RandomIterator first, RandomIterator last, OutputRandomIterator result,
+        const BinaryOperation& op, const Partition& partition, JobContext* jobContext = nullptr)
+    {
+        using ValueType = typename AZStd::iterator_traits<RandomIterator>::value_type;
+
+        JobContext* context = jobContext ? jobContext : JobContext::GetParentContext();
+
+        const Internal::ParallelIndexType numElements = static_cast<Internal::ParallelIndexType>(last - first);
+        if (numElements == 0)
+        {
+            return result;
+        }
+
+        auto scanRange = [&op](RandomIterator current, RandomIterator end, OutputRandomIterator output, ValueType total)
+        {
+            for (; current != end; ++current, ++output)
+            {
+                total = op(total, *current);
+                *output = total;
+            }
+        };
+
+        const Internal::ParallelIndexType numChunks = Internal::GetNumAlgorithmChunks(numElements, partition, context);
+        if (numChunks <= 1)
+        {
+            ValueType total = *first;
+            *result = total;
+            scanRange(first + 1, last, result + 1, AZStd::move(total));
+            return result + numElements;
+        }
+
+        // Calculate the totals of all but the last chunk, as the last total isn't needed as a starting value.
+        AZStd::vector<ValueType> chunkTotals(numChunks - 1, *first);
+        parallel_for(static_cast<Internal::ParallelIndexType>(0), numChunks - 1, [=, &op, &chunkTotals](Internal::ParallelIndexType chunk)
+            {
+                RandomIterator current = first + Internal::GetChunkOffset(chunk, numChunks, numElements);
+                RandomIterator end = first + Internal::GetChunkOffset(chunk + 1, numChunks, numElements);
+                ValueType total = *current;
+                for (++current; current != end; ++current)
+                {
+                    total = op(total, *current);
+                }
+                chunkTotals[chunk] = AZStd::move(total);
+            }, static_partitioner(), context);
+
+        for (size_t i = 1; i < chunkTotals.size(); ++i)
+        {
+            chunkTotals[i] = op(chunkTotals[i - 1], chunkTotals[i]);
+        }
+
+        parallel_for(static_cast<Internal::ParallelIndexType>(0), numChunks, [=, &chunkTotals, &scanRange](Internal::ParallelIndexType chunk)
+            {
+                const Internal::ParallelIndexType begin = Internal::GetChunkOffset(chunk, numChunks, numElements);
+                const Internal::ParallelIndexType end = Internal::GetChunkOffset(chunk + 1, numChunks, numElements);
+                if (chunk == 0)
+                {
+                    ValueType total = *first;
+                    *result = total;
+                    scanRange(first + 1, first + end, result + 1, AZStd::move(total));
+                }
+                else
+                {
+                    scanRange(first + begin, first + end, result + begin, chunkTotals[chunk - 1]);
+                }
+            }, static_partitioner(), context);
+
+        return result + numElements;
+    }
+
+    template<class RandomIterator, class OutputRandomIterator, class BinaryOperation>
+    OutputRandomIterator parallel_inclusive_scan(RandomIterator first, RandomIterator last, OutputRandomIterator result,
+        const BinaryOperation& op, JobContext* jobContext = nullptr)
+    {
+        return parallel_inclusive_scan(first, last, result, op, auto_partitioner(), jobContext);
+    }
+
+    template<class RandomIterator, class OutputRandomIterator>
+    OutputRandomIterator parallel_inclusive_scan(RandomIterator first, RandomIterator last, OutputRandomIterator result,
+        JobContext* jobContext = nullptr)
+    {
+        return parallel_inclusive_scan(first, last, result, AZStd::plus<typename AZStd::iterator_traits<RandomIterator>::value_type>(),
+            auto_partitioner(), jobContext);
+    }
 }
 
 #ifdef AZ_COMPILER_MSVC
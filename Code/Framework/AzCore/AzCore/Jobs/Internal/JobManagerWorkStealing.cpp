@@ -28,31 +28,56 @@ bool CompareJobPriorities(AZ::s8 value, const Job* job)
     return value > job->GetPriority();
 }
 
+namespace
+{
+    // insert into the queue based on the job's priority, jobs with equal priority keep their queued order
+    void InsertByPriority(AZStd::deque<Job*>& queue, Job* job)
+    {
+        const AZStd::deque<Job*>::const_iterator locationToinsert = AZStd::upper_bound(queue.begin(),
+                                                                                       queue.end(),
+                                                                                       job->GetPriority(),
+                                                                                       CompareJobPriorities);
+        queue.insert(locationToinsert, job);
+    }
+
+    // removes and returns the first job in the queue which is allowed to run on the thread
+    Job* PopFirstRunnable(AZStd::deque<Job*>& queue, AZ::u64 threadWorkerMask, AZ::u64 allWorkersMask)
+    {
+        for (auto it = queue.begin(); it != queue.end(); ++it)
+        {
+            Job* job = *it;
+            if (JobManagerWorkStealing::IsRunnableOn(job, threadWorkerMask, allWorkersMask))
+            {
+                queue.erase(it);
+                return job;
+            }
+        }
+        return nullptr;
+    }
+}
+
 void WorkQueue::LocalInsert(Job* job)
 {
     LockGuard lock(m_lock);
-    const AZStd::deque<Job*>::const_iterator locationToinsert = AZStd::upper_bound(m_queue.begin(),
-                                                                                   m_queue.end(),
-                                                                                   job->GetPriority(),
-                                                                                   CompareJobPriorities);
-    m_queue.insert(locationToinsert, job);
+    InsertByPriority(m_queues[static_cast<size_t>(job->GetPriorityClass())], job);
 }
 
-Job* WorkQueue::LocalPopFront()
+Job* WorkQueue::LocalPopFront(JobPriorityClass priorityClass)
 {
     LockGuard lock(m_lock);
 
     Job* result = nullptr;
-    if (!m_queue.empty())
+    AZStd::deque<Job*>& queue = m_queues[static_cast<size_t>(priorityClass)];
+    if (!queue.empty())
     {
-        result = m_queue.front();
-        m_queue.pop_front();
+        result = queue.front();
+        queue.pop_front();
     }
 
     return result;
 }
 
-Job* WorkQueue::TryStealFront()
+Job* WorkQueue::TryStealFront(AZ::u64 thiefWorkerMask, AZ::u64 allWorkersMask)
 {
     AZStd::exponential_backoff backoff;
     for (unsigned attempCount = 0; attempCount < TryStealSpinAttemps; ++attempCount)
@@ -61,10 +86,13 @@ Job* WorkQueue::TryStealFront()
         if (m_lock.try_lock())
         {
             Job* result = nullptr;
-            if (!m_queue.empty())
+            for (AZStd::deque<Job*>& queue : m_queues)
             {
-                result = m_queue.front();
-                m_queue.pop_front();
+                result = PopFirstRunnable(queue, thiefWorkerMask, allWorkersMask);
+                if (result)
+                {
+                    break;
+                }
             }
 
             m_lock.unlock();
@@ -83,7 +111,13 @@ AZ_THREAD_LOCAL JobManagerWorkStealing::ThreadInfo* JobManagerWorkStealing::m_cu
 JobManagerWorkStealing::JobManagerWorkStealing(const JobManagerDesc& desc)
     : m_isAsynchronous(!desc.m_workerThreads.empty())
     , m_workerThreads(AZStd::move(CreateWorkerThreads(desc.m_workerThreads)))
+    , m_allWorkersMask(m_workerThreads.size() < 64 ? ((static_cast<AZ::u64>(1) << m_workerThreads.size()) - 1) : JobAnyWorkerAffinityMask)
 {
+    for (AZStd::atomic_uint& numGlobalJobs : m_numGlobalJobs)
+    {
+        numGlobalJobs.store(0, AZStd::memory_order_relaxed);
+    }
+
     //allow workers to begin processing after they have all been created, needed to wait since they may access each others queues
     m_initSemaphore.release(static_cast<unsigned int>(desc.m_workerThreads.size()));
 }
@@ -141,40 +175,38 @@ void JobManagerWorkStealing::AddPendingJob(Job* job)
 #endif
         }
     }
-    else if (info && info->m_isWorker && (info->m_owningManager == this))
+    else if (info && info->m_isWorker && (info->m_owningManager == this) && IsRunnableOn(job, info->m_workerMask, m_allWorkersMask))
     {
-        //current thread is a worker, insert into the local queue based on the job's priority
+        //current thread is a worker, insert into the local queue based on the job's priority class and priority
         info->m_pendingJobs.LocalInsert(job);
 #ifdef JOBMANAGER_ENABLE_STATS
         ++info->m_jobsForked;
 #endif
         // if there are threads asleep wake one up
-        ActivateWorker();
+        ActivateWorker(job->GetWorkerAffinityMask());
     }
     else
     {
-        //current thread is not a worker thread, insert into the global queue based on the job's priority
+        //current thread is not a worker thread (or the job is not allowed to run on it), insert into the global queue
+        //based on the job's priority class and priority
+        const size_t priorityClass = static_cast<size_t>(job->GetPriorityClass());
         if (IsAsynchronous())
         {
+            AZ_Assert((job->GetWorkerAffinityMask() & m_allWorkersMask) != 0, "Job worker affinity mask does not match any of the %zu workers", m_workerThreads.size());
+
             AZStd::lock_guard<GlobalQueueMutexType> lock(m_globalJobQueueMutex);
-            const GlobalJobQueue::const_iterator locationToinsert = AZStd::upper_bound(m_globalJobQueue.begin(),
-                                                                                       m_globalJobQueue.end(),
-                                                                                       job->GetPriority(),
-                                                                                       CompareJobPriorities);
-            m_globalJobQueue.insert(locationToinsert, job);
+            InsertByPriority(m_globalJobQueues[priorityClass], job);
+            m_numGlobalJobs[priorityClass].fetch_add(1, AZStd::memory_order_release);
 
             //checking/changing global queue empty state or worker availability must be done atomically while holding the global queue lock
-            ActivateWorker();
+            ActivateWorker(job->GetWorkerAffinityMask());
         }
         else
         {
             {
                 AZStd::lock_guard<GlobalQueueMutexType> lock(m_globalJobQueueMutex);
-                const GlobalJobQueue::const_iterator locationToinsert = AZStd::upper_bound(m_globalJobQueue.begin(),
-                                                                                           m_globalJobQueue.end(),
-                                                                                           job->GetPriority(),
-                                                                                           CompareJobPriorities);
-                m_globalJobQueue.insert(locationToinsert, job);
+                InsertByPriority(m_globalJobQueues[priorityClass], job);
+                m_numGlobalJobs[priorityClass].fetch_add(1, AZStd::memory_order_release);
             }
 
             //no workers, so must process the jobs right now
@@ -352,7 +384,7 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
                 {
                     //checking/changing global queue empty state or worker availability must be done atomically while holding the global queue lock
                     AZStd::lock_guard<GlobalQueueMutexType> lock(m_globalJobQueueMutex);
-                    if (m_globalJobQueue.empty())
+                    if (!HasGlobalJobFor(info))
                     {
                         shouldSleep = true;
 
@@ -386,23 +418,7 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
                 return;
             }
 
-            {
-                AZStd::lock_guard<GlobalQueueMutexType> lock(m_globalJobQueueMutex);
-                if (!m_globalJobQueue.empty())
-                {
-                    job = m_globalJobQueue.front();
-                    m_globalJobQueue.pop_front();
-#ifdef JOBMANAGER_ENABLE_STATS
-                    ++info->m_globalJobs;
-#endif
-                }
-            }
-        }
-
-        if (!job && pendingJobs)
-        {
-            //nothing on the global queue, try to pop from the local queue
-            job = pendingJobs->LocalPopFront();
+            job = TakeJob(info, pendingJobs, false);
         }
 
         bool isTerminated = false;
@@ -429,10 +445,10 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
                     return;
                 }
 
-                //pop a new job from the local queue
+                //pop a new job from the local queue, unless a more urgent job is waiting in the global queue
                 if (pendingJobs)
                 {
-                    job = pendingJobs->LocalPopFront();
+                    job = TakeJob(info, pendingJobs, true);
                     if (job)
                     {
                         // not necessary, just an optimization - wakeup sleeping threads, there's work to be done
@@ -473,7 +489,7 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
                     WorkQueue* victimQueue = &m_workerThreads[victim]->m_pendingJobs;
 
                     //attempt the steal
-                    job = victimQueue->TryStealFront();
+                    job = victimQueue->TryStealFront(info->m_workerMask, m_allWorkersMask);
                     if (job)
                     {
                         //success, continue with the stolen job
@@ -521,10 +537,9 @@ void JobManagerWorkStealing::ProcessJobsSynchronous(ThreadInfo* info, Job* suspe
     ThreadInfo* oldInfo = m_currentThreadInfo;
     m_currentThreadInfo = info;
 
-    while (!m_globalJobQueue.empty())
+    //without workers there is no affinity, the jobs are run in priority class order
+    while (Job* job = PopGlobalJob(info, JobPriorityClass::Critical))
     {
-        Job* job = m_globalJobQueue.front();
-        m_globalJobQueue.pop_front();
 
         info->m_currentJob = job;
         Process(job);
@@ -632,6 +647,7 @@ JobManagerWorkStealing::ThreadList JobManagerWorkStealing::CreateWorkerThreads(c
         info->m_isWorker = true;
         info->m_owningManager = this;
         info->m_workerId = iThread;
+        info->m_workerMask = static_cast<AZ::u64>(1) << iThread;
 
         AZStd::thread_desc threadDesc;
         threadDesc.m_name = "AZ JobManager worker thread";
@@ -659,7 +675,97 @@ JobManagerWorkStealing::ThreadList JobManagerWorkStealing::CreateWorkerThreads(c
     return workerThreads;
 }
 
-inline void JobManagerWorkStealing::ActivateWorker()
+bool JobManagerWorkStealing::IsRunnableOn(const Job* job, AZ::u64 threadWorkerMask, AZ::u64 allWorkersMask)
+{
+    const AZ::u64 jobWorkerMask = job->GetWorkerAffinityMask() & allWorkersMask;
+    //non-worker threads can only run unrestricted jobs
+    return threadWorkerMask ? (jobWorkerMask & threadWorkerMask) != 0 : jobWorkerMask == allWorkersMask;
+}
+
+Job* JobManagerWorkStealing::TakeJob(ThreadInfo* info, WorkQueue* pendingJobs, bool preferLocal)
+{
+    //both queues are checked for each priority class in turn, so a worker busy with local jobs still picks up more
+    //urgent jobs queued by other threads
+    for (size_t priorityClass = 0; priorityClass < JobPriorityClassCount; ++priorityClass)
+    {
+        if (pendingJobs && preferLocal)
+        {
+            if (Job* job = pendingJobs->LocalPopFront(static_cast<JobPriorityClass>(priorityClass)))
+            {
+                return job;
+            }
+        }
+
+        if (m_numGlobalJobs[priorityClass].load(AZStd::memory_order_acquire) > 0)
+        {
+            if (Job* job = PopGlobalJob(info, static_cast<JobPriorityClass>(priorityClass)))
+            {
+                return job;
+            }
+        }
+
+        if (pendingJobs && !preferLocal)
+        {
+            if (Job* job = pendingJobs->LocalPopFront(static_cast<JobPriorityClass>(priorityClass)))
+            {
+                return job;
+            }
+        }
+    }
+    return nullptr;
+}
+
+Job* JobManagerWorkStealing::PopGlobalJob(ThreadInfo* info, JobPriorityClass firstPriorityClass)
+{
+    AZStd::lock_guard<GlobalQueueMutexType> lock(m_globalJobQueueMutex);
+    for (size_t priorityClass = static_cast<size_t>(firstPriorityClass); priorityClass < JobPriorityClassCount; ++priorityClass)
+    {
+        GlobalJobQueue& queue = m_globalJobQueues[priorityClass];
+        Job* job = nullptr;
+        if (IsAsynchronous())
+        {
+            job = PopFirstRunnable(queue, info->m_workerMask, m_allWorkersMask);
+        }
+        else if (!queue.empty())
+        {
+            job = queue.front();
+            queue.pop_front();
+        }
+
+        if (job)
+        {
+            m_numGlobalJobs[priorityClass].fetch_sub(1, AZStd::memory_order_release);
+#ifdef JOBMANAGER_ENABLE_STATS
+            ++info->m_globalJobs;
+#endif
+            return job;
+        }
+
+        //only the synchronous path falls through to less urgent classes, TakeJob interleaves them with the local queue
+        if (IsAsynchronous())
+        {
+            break;
+        }
+    }
+    return nullptr;
+}
+
+bool JobManagerWorkStealing::HasGlobalJobFor(const ThreadInfo* info) const
+{
+    for (const GlobalJobQueue& queue : m_globalJobQueues)
+    {
+        for (const Job* job : queue)
+        {
+            if (IsRunnableOn(job, info->m_workerMask, m_allWorkersMask))
+            {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+inline void JobManagerWorkStealing::ActivateWorker(AZ::u64 workerMask)
 {
     // find an available worker thread (we do it brute force because the number of threads is small)
     while (m_numAvailableWorkers.load(AZStd::memory_order_acquire) > 0)
@@ -667,7 +773,7 @@ inline void JobManagerWorkStealing::ActivateWorker()
         for (size_t i = 0; i < m_workerThreads.size(); ++i)
         {
             ThreadInfo* info = m_workerThreads[i];
-            if (info->m_isAvailable.exchange(false, AZStd::memory_order_acq_rel) == true)
+            if ((info->m_workerMask & workerMask) && info->m_isAvailable.exchange(false, AZStd::memory_order_acq_rel) == true)
             {
                 // decrement number of available workers
                 m_numAvailableWorkers.fetch_sub(1, AZStd::memory_order_acq_rel);
@@ -678,6 +784,13 @@ inline void JobManagerWorkStealing::ActivateWorker()
                 return;
             }
         }
+
+        if ((workerMask & m_allWorkersMask) != m_allWorkersMask)
+        {
+            // restricted jobs are always queued while holding the global queue lock, so the available state of the allowed
+            // workers is stable and a single pass is enough. Otherwise we could spin forever while only disallowed workers sleep.
+            return;
+        }
     }
 }
 
@@ -30,8 +30,10 @@ namespace AZ
         {
         public:
             void LocalInsert(Job *job);
-            Job* LocalPopFront();
-            Job* TryStealFront();
+            /// Pops the front job of the specified priority class.
+            Job* LocalPopFront(JobPriorityClass priorityClass);
+            /// Steals the most urgent job which is allowed to run on the thief, see JobManagerWorkStealing::IsRunnableOn.
+            Job* TryStealFront(AZ::u64 thiefWorkerMask, AZ::u64 allWorkersMask);
 
         private:
             enum
@@ -41,7 +43,7 @@ namespace AZ
             using LockType = AZStd::shared_mutex;
             using LockGuard = AZStd::lock_guard<LockType>;
 
-            AZStd::deque<Job*> m_queue;
+            AZStd::deque<Job*> m_queues[JobPriorityClassCount];
             LockType m_lock;
         };
 
@@ -79,9 +81,16 @@ namespace AZ
 
             AZ::u32 GetWorkerThreadId() const;
 
+            /// Mask with one bit set for every worker thread.
+            AZ::u64 GetAllWorkersMask() const { return m_allWorkersMask; }
+
+            /// Checks if a job is allowed to run on a thread with the specified worker mask (0 for non-worker threads).
+            static bool IsRunnableOn(const Job* job, AZ::u64 threadWorkerMask, AZ::u64 allWorkersMask);
+
         private:
 
-            void ActivateWorker();
+            /// Wakes up a sleeping worker which is allowed to run jobs with the specified affinity.
+            void ActivateWorker(AZ::u64 workerMask = JobAnyWorkerAffinityMask);
 
             struct ThreadInfo
             {
@@ -98,6 +107,7 @@ namespace AZ
                 AZStd::binary_semaphore m_waitEvent;
                 WorkQueue m_pendingJobs;
                 unsigned int m_workerId = JobManagerBase::InvalidWorkerThreadId;
+                AZ::u64 m_workerMask = 0; ///< bit of this worker in affinity masks, 0 for non-worker threads
 
 #ifdef JOBMANAGER_ENABLE_STATS
                 unsigned int m_globalJobs = 0;
@@ -115,6 +125,16 @@ namespace AZ
             void ProcessJobsSynchronous(ThreadInfo* info, Job* suspendedJob, AZStd::atomic<bool>* notifyFlag);
             void ProcessJobsInternal(ThreadInfo* info, Job* suspendedJob, AZStd::atomic<bool>* notifyFlag);
             ThreadList CreateWorkerThreads(const JobManagerDesc::DescList& workerDescList);
+
+            using GlobalJobQueue = AZStd::deque<Job*>;
+            using GlobalQueueMutexType = AZStd::mutex;
+
+            /// Takes the most urgent job available to this thread from the global queue or its local queue, preferLocal
+            /// only decides between the two queues within the same priority class.
+            Job* TakeJob(ThreadInfo* info, WorkQueue* pendingJobs, bool preferLocal);
+            Job* PopGlobalJob(ThreadInfo* info, JobPriorityClass priorityClass);
+            /// m_globalJobQueueMutex must be locked
+            bool HasGlobalJobFor(const ThreadInfo* info) const;
 #ifndef AZ_MONOLITHIC_BUILD
             ThreadInfo* CrossModuleFindAndSetWorkerThreadInfo() const;
 #endif
@@ -129,11 +149,10 @@ namespace AZ
             AZStd::semaphore m_initSemaphore;
 
             const ThreadList m_workerThreads; //no mutex required for this list, it's only assigned during startup, must be declared after m_threads and m_initSemaphore
+            const AZ::u64 m_allWorkersMask;
 
-            using GlobalJobQueue = AZStd::deque<Job*>;
-            using GlobalQueueMutexType = AZStd::mutex;
-
-            GlobalJobQueue              m_globalJobQueue;
+            GlobalJobQueue              m_globalJobQueues[JobPriorityClassCount];
+            AZStd::atomic_uint          m_numGlobalJobs[JobPriorityClassCount]; ///< allows checking for urgent global jobs without locking
             GlobalQueueMutexType        m_globalJobQueueMutex;
 
             volatile bool               m_quitRequested = false;
@@ -172,6 +172,22 @@ namespace AZ
          */
         AZ::s8 GetPriority() const;
 
+        /**
+         * Sets the priority class (lane) of this job, the job manager will run all ready jobs of a more urgent class
+         * before any job of a less urgent class. Can only be called before the job is started, the class is kept when
+         * the job is reset.
+         */
+        void SetPriorityClass(JobPriorityClass priorityClass);
+        JobPriorityClass GetPriorityClass() const;
+
+        /**
+         * Restricts the worker threads this job can run on, each bit maps to a worker index, see JobAnyWorkerAffinityMask.
+         * Restricted jobs are never run by non-worker threads assisting the job manager. Can only be called before the
+         * job is started, the mask is kept when the job is reset.
+         */
+        void SetWorkerAffinityMask(AZ::u64 workerMask);
+        AZ::u64 GetWorkerAffinityMask() const;
+
 #ifdef AZ_DEBUG_JOB_STATE
         int GetState() const    { return m_state; }
 #endif // AZ_DEBUG_JOB_STATE
@@ -215,7 +231,7 @@ namespace AZ
         };
 
     protected:
-        //16 bytes of overhead per job, including the vtable pointer (20 bytes in debug)
+        //32 bytes of overhead per job, including the vtable pointer
 
         JobContext* volatile m_context;
 
@@ -232,6 +248,10 @@ namespace AZ
         //state is only really necessary for debugging... we could squeeze it into the dependent count member, but it
         //would require atomic ops to set/read it, so not really worth it.
         int m_state;
+
+        //scheduling hints, only read by the job manager once the job is pending
+        JobPriorityClass m_priorityClass = JobPriorityClass::Normal;
+        AZ::u64 m_workerAffinityMask = JobAnyWorkerAffinityMask;
     };
 
     //============================================================================================================
@@ -497,6 +517,34 @@ namespace AZ
         return (GetDependentCountAndFlags() >> FLAG_PRIORITY_START_BIT) & 0xff;
     }
 
+    inline void Job::SetPriorityClass(JobPriorityClass priorityClass)
+    {
+#ifdef AZ_DEBUG_JOB_STATE
+        AZ_Assert(m_state == STATE_SETUP, "Priority class can only be set before the job is started");
+#endif
+        AZ_Assert(priorityClass < JobPriorityClass::Count, "Invalid job priority class");
+        m_priorityClass = priorityClass;
+    }
+
+    AZ_FORCE_INLINE JobPriorityClass Job::GetPriorityClass() const
+    {
+        return m_priorityClass;
+    }
+
+    inline void Job::SetWorkerAffinityMask(AZ::u64 workerMask)
+    {
+#ifdef AZ_DEBUG_JOB_STATE
+        AZ_Assert(m_state == STATE_SETUP, "Worker affinity can only be set before the job is started");
+#endif
+        AZ_Assert(workerMask != 0, "Worker affinity mask must allow at least one worker");
+        m_workerAffinityMask = workerMask;
+    }
+
+    AZ_FORCE_INLINE AZ::u64 Job::GetWorkerAffinityMask() const
+    {
+        return m_workerAffinityMask;
+    }
+
 #ifdef AZ_DEBUG_JOB_STATE
     AZ_FORCE_INLINE void Job::SetState(int state)
     {
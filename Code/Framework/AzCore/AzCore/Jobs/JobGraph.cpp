@@ -0,0 +1,226 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Jobs/JobGraph.h>
+
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/std/sort.h>
+
+namespace AZ
+{
+    JobGraph::JobGraph(JobContext* context)
+        : m_parentContext(context ? context : JobContext::GetParentContext())
+        , m_context(m_parentContext->GetJobManager())
+        , m_completion(false, m_parentContext)
+    {
+    }
+
+    JobGraph::~JobGraph()
+    {
+        AZ_Assert(!m_isInFlight, "JobGraph destroyed while in flight, Wait must be called first");
+        ReleaseCompiledData();
+    }
+
+    void JobGraph::AddEdge(NodeId predecessor, NodeId successor)
+    {
+        AZ_Assert(!m_isInFlight, "Edges can't be added while the graph is in flight");
+        AZ_Assert(predecessor < m_nodes.size() && successor < m_nodes.size(), "Invalid node id");
+        AZ_Assert(predecessor != successor, "A node can't depend on itself");
+        m_isCompiled = false;
+        m_edges.emplace_back(predecessor, successor);
+    }
+
+    bool JobGraph::Compile()
+    {
+        AZ_Assert(!m_isInFlight, "Graph can't be compiled while it is in flight");
+        ReleaseCompiledData();
+
+        const AZ::u32 nodeCount = static_cast<AZ::u32>(m_nodes.size());
+
+        //flatten the edges into a compact successor list per node
+        m_successorOffsets.resize(nodeCount + 1, 0);
+        m_predecessorCounts.resize(nodeCount, 0);
+        for (const AZStd::pair<NodeId, NodeId>& edge : m_edges)
+        {
+            ++m_successorOffsets[edge.first + 1];
+            ++m_predecessorCounts[edge.second];
+        }
+        for (AZ::u32 i = 0; i < nodeCount; ++i)
+        {
+            m_successorOffsets[i + 1] += m_successorOffsets[i];
+        }
+        m_successors.resize(m_edges.size());
+        AZStd::vector<AZ::u32> insertPositions(m_successorOffsets.begin(), m_successorOffsets.end() - 1);
+        for (const AZStd::pair<NodeId, NodeId>& edge : m_edges)
+        {
+            m_successors[insertPositions[edge.first]++] = edge.second;
+        }
+
+        //topological sort, also detects cycles
+        AZStd::vector<NodeId> order;
+        order.reserve(nodeCount);
+        AZStd::vector<AZ::u32> remainingPredecessors(m_predecessorCounts);
+        for (NodeId node = 0; node < nodeCount; ++node)
+        {
+            if (remainingPredecessors[node] == 0)
+            {
+                order.push_back(node);
+            }
+        }
+        for (size_t head = 0; head < order.size(); ++head)
+        {
+            const NodeId node = order[head];
+            for (AZ::u32 i = m_successorOffsets[node]; i < m_successorOffsets[node + 1]; ++i)
+            {
+                if (--remainingPredecessors[m_successors[i]] == 0)
+                {
+                    order.push_back(m_successors[i]);
+                }
+            }
+        }
+        if (order.size() != nodeCount)
+        {
+            AZ_Error("JobGraph", false, "JobGraph contains a cycle, %zu of %u nodes can never run", nodeCount - order.size(), nodeCount);
+            ReleaseCompiledData();
+            return false;
+        }
+
+        //length of the most expensive path from each node to the end of the graph, visited in reverse topological order so
+        //all successors are known before their predecessors
+        AZStd::vector<AZ::u64> criticalPath(nodeCount, 0);
+        AZ::u64 longestPath = 0;
+        for (auto it = order.rbegin(); it != order.rend(); ++it)
+        {
+            const NodeId node = *it;
+            AZ::u64 longestSuccessor = 0;
+            for (AZ::u32 i = m_successorOffsets[node]; i < m_successorOffsets[node + 1]; ++i)
+            {
+                longestSuccessor = AZStd::GetMax(longestSuccessor, criticalPath[m_successors[i]]);
+            }
+            criticalPath[node] = m_nodes[node].m_cost + longestSuccessor;
+            longestPath = AZStd::GetMax(longestPath, criticalPath[node]);
+        }
+
+        //map the critical path onto the non-negative job priority range, so the graph never starves default priority jobs
+        m_jobs.reserve(nodeCount);
+        for (NodeId node = 0; node < nodeCount; ++node)
+        {
+            const AZ::s8 priority = longestPath ? static_cast<AZ::s8>((criticalPath[node] * 127) / longestPath) : 0;
+            m_jobs.push_back(aznew NodeJob(*this, node, &m_context, priority));
+        }
+
+        //nodes with predecessors are started first, they are held back by their dependent count. Roots are started last,
+        //most critical first, so they are queued in critical path order.
+        m_submitOrder.reserve(nodeCount);
+        for (NodeId node = 0; node < nodeCount; ++node)
+        {
+            if (m_predecessorCounts[node] != 0)
+            {
+                m_submitOrder.push_back(node);
+            }
+        }
+        const size_t firstRoot = m_submitOrder.size();
+        for (NodeId node = 0; node < nodeCount; ++node)
+        {
+            if (m_predecessorCounts[node] == 0)
+            {
+                m_submitOrder.push_back(node);
+            }
+        }
+        AZStd::stable_sort(m_submitOrder.begin() + firstRoot, m_submitOrder.end(),
+            [&criticalPath](NodeId lhs, NodeId rhs)
+            {
+                return criticalPath[lhs] > criticalPath[rhs];
+            });
+
+        m_isCompiled = true;
+        return true;
+    }
+
+    void JobGraph::Submit()
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzCore);
+        AZ_Assert(m_isCompiled, "JobGraph must be compiled before it is submitted");
+        AZ_Assert(!m_isInFlight, "JobGraph is already in flight, Wait must be called before submitting it again");
+        m_isInFlight = true;
+
+        //the completion must be reset before the node jobs, which register themselves on it again
+        m_completion.Reset(true);
+        for (size_t node = 0; node < m_jobs.size(); ++node)
+        {
+            NodeJob* job = m_jobs[node];
+            job->Reset(true);
+            job->SetDependent(&m_completion);
+            for (AZ::u32 i = 0; i < m_predecessorCounts[node]; ++i)
+            {
+                job->IncrementDependentCount();
+            }
+        }
+
+        for (NodeId node : m_submitOrder)
+        {
+            m_jobs[node]->Start();
+        }
+    }
+
+    void JobGraph::Wait()
+    {
+        AZ_PROFILE_FUNCTION_STALL(AZ::Debug::ProfileCategory::AzCore);
+        AZ_Assert(m_isInFlight, "JobGraph must be submitted before waiting on it");
+        m_completion.StartAndWaitForCompletion();
+        m_isInFlight = false;
+    }
+
+    void JobGraph::SubmitAndWait()
+    {
+        Submit();
+        Wait();
+    }
+
+    void JobGraph::Clear()
+    {
+        AZ_Assert(!m_isInFlight, "JobGraph can't be cleared while it is in flight");
+        ReleaseCompiledData();
+        m_nodes.clear();
+        m_edges.clear();
+    }
+
+    AZ::s8 JobGraph::GetNodePriority(NodeId node) const
+    {
+        AZ_Assert(m_isCompiled, "Node priorities are only known after the graph is compiled");
+        AZ_Assert(node < m_jobs.size(), "Invalid node id");
+        return m_jobs[node]->GetPriority();
+    }
+
+    void JobGraph::ProcessNode(NodeId node)
+    {
+        JobCancelGroup* cancelGroup = m_parentContext->GetCancelGroup();
+        if (!cancelGroup || !cancelGroup->IsCancelled())
+        {
+            m_nodes[node].m_function();
+        }
+
+        for (AZ::u32 i = m_successorOffsets[node]; i < m_successorOffsets[node + 1]; ++i)
+        {
+            m_jobs[m_successors[i]]->DecrementDependentCount();
+        }
+    }
+
+    void JobGraph::ReleaseCompiledData()
+    {
+        for (NodeJob* job : m_jobs)
+        {
+            delete job;
+        }
+        m_jobs.clear();
+        m_successorOffsets.clear();
+        m_successors.clear();
+        m_predecessorCounts.clear();
+        m_submitOrder.clear();
+        m_isCompiled = false;
+    }
+}
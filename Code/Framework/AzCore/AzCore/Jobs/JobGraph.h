@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Jobs/Job.h>
+#include <AzCore/Jobs/JobEmpty.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/utils.h>
+
+namespace AZ
+{
+    /**
+     * A reusable dependency graph of jobs. Nodes and edges are declared once, the graph is then compiled into flat
+     * arrays (one pre-allocated job per node plus a compact successor list), after which it can be submitted any number
+     * of times without allocating or re-linking jobs.
+     *
+     * Unlike regular jobs, which only support a single dependent, a node can have any number of predecessors and
+     * successors. Node jobs are given a priority based on the length of the longest (critical) path from the node to the
+     * end of the graph, so the work stealing scheduler will favor nodes on the critical path when several are ready.
+     *
+     * Usage:
+     *     JobGraph graph;
+     *     JobGraph::NodeId cull = graph.AddNode([]() { ... });
+     *     JobGraph::NodeId sort = graph.AddNode([]() { ... });
+     *     graph.AddEdge(cull, sort);
+     *     graph.Compile();
+     *     // every frame
+     *     graph.SubmitAndWait();
+     *
+     * A graph can only be in flight once at a time, Wait (or SubmitAndWait) must be called before it is submitted again.
+     */
+    class JobGraph
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(JobGraph, SystemAllocator, 0)
+
+        using NodeId = AZ::u32;
+        static constexpr NodeId InvalidNodeId = static_cast<NodeId>(-1);
+
+        /**
+         * If no context is specified the parent context is used, see JobContext::GetParentContext. The cancel group of the
+         * context is honored, a canceled node will skip its function but still release its successors so the graph can
+         * always be waited on.
+         */
+        explicit JobGraph(JobContext* context = nullptr);
+        ~JobGraph();
+
+        /**
+         * Adds a node which runs the specified function (void()). The cost is a relative estimate of the work done by the
+         * node and is only used to compute the critical path. Adding nodes invalidates a previous compile.
+         */
+        template<class Function>
+        NodeId AddNode(Function&& function, AZ::u32 cost = 1);
+
+        /**
+         * Declares that the successor can not run until the predecessor has completed. Adding edges invalidates a
+         * previous compile.
+         */
+        void AddEdge(NodeId predecessor, NodeId successor);
+
+        /**
+         * Flattens the declared nodes and edges and creates the node jobs. Returns false (and leaves the graph
+         * uncompiled) if the graph contains a cycle.
+         */
+        bool Compile();
+
+        bool IsCompiled() const { return m_isCompiled; }
+
+        /**
+         * Starts all the node jobs of a compiled graph, does not allocate.
+         */
+        void Submit();
+
+        /**
+         * Blocks until all the nodes of the submitted graph have completed. When called from a worker thread the current
+         * job is suspended and the thread keeps processing other jobs, otherwise this thread will assist.
+         */
+        void Wait();
+
+        /// Convenience function for Submit followed by Wait.
+        void SubmitAndWait();
+
+        /// Removes all nodes and edges, and releases the compiled data. The graph must not be in flight.
+        void Clear();
+
+        size_t GetNodeCount() const { return m_nodes.size(); }
+
+        /// Returns the scheduling priority assigned to the node during Compile.
+        AZ::s8 GetNodePriority(NodeId node) const;
+
+    private:
+        //non-copyable
+        JobGraph(const JobGraph&) = delete;
+        JobGraph& operator=(const JobGraph&) = delete;
+
+        /// Pre-allocated job which runs a single node, it is reset every time the graph is submitted.
+        class NodeJob
+            : public Job
+        {
+        public:
+            AZ_CLASS_ALLOCATOR(NodeJob, ThreadPoolAllocator, 0)
+
+            NodeJob(JobGraph& graph, NodeId node, JobContext* context, AZ::s8 priority)
+                : Job(false, context, false, priority)
+                , m_graph(graph)
+                , m_node(node)
+            {
+            }
+
+        protected:
+            void Process() override
+            {
+                m_graph.ProcessNode(m_node);
+            }
+
+        private:
+            JobGraph& m_graph;
+            NodeId m_node;
+        };
+
+        struct NodeDesc
+        {
+            AZStd::function<void()> m_function;
+            AZ::u32 m_cost;
+        };
+
+        void ProcessNode(NodeId node);
+        void ReleaseCompiledData();
+
+        JobContext* m_parentContext;
+        //node jobs use a context without a cancel group, cancellation is checked by the graph itself so successors
+        //are always notified
+        JobContext m_context;
+
+        AZStd::vector<NodeDesc> m_nodes;
+        AZStd::vector<AZStd::pair<NodeId, NodeId>> m_edges;
+
+        //compiled data
+        AZStd::vector<NodeJob*> m_jobs;
+        AZStd::vector<AZ::u32> m_successorOffsets; ///< m_successors range of node i is [m_successorOffsets[i], m_successorOffsets[i + 1])
+        AZStd::vector<NodeId> m_successors;
+        AZStd::vector<AZ::u32> m_predecessorCounts;
+        AZStd::vector<NodeId> m_submitOrder; ///< all nodes, roots last sorted by descending priority
+
+        JobEmpty m_completion;
+        bool m_isCompiled = false;
+        bool m_isInFlight = false;
+    };
+
+    //============================================================================================================
+    //============================================================================================================
+    //============================================================================================================
+
+    template<class Function>
+    inline JobGraph::NodeId JobGraph::AddNode(Function&& function, AZ::u32 cost)
+    {
+        AZ_Assert(!m_isInFlight, "Nodes can't be added while the graph is in flight");
+        m_isCompiled = false;
+        m_nodes.push_back(NodeDesc{ AZStd::function<void()>(AZStd::forward<Function>(function)), cost });
+        return static_cast<NodeId>(m_nodes.size() - 1);
+    }
+}
@@ -11,6 +11,28 @@
 
 namespace AZ
 {
+    /**
+     * Priority class (lane) of a job. Each class has its own queues in the job manager, a worker will always take a
+     * job from the most urgent non-empty class before looking at the less urgent ones. The job priority value is only
+     * used to order jobs within a class.
+     */
+    enum class JobPriorityClass : AZ::u8
+    {
+        Critical,   ///< latency critical frame work, e.g. culling or animation that the frame is waiting on
+        Normal,     ///< default
+        Background, ///< work that can be deferred, e.g. asset processing or streaming
+
+        Count
+    };
+
+    static constexpr size_t JobPriorityClassCount = static_cast<size_t>(JobPriorityClass::Count);
+
+    /**
+     * Worker affinity masks map each bit to a worker thread index [0-63] (the order of JobManagerDesc::m_workerThreads).
+     * Jobs with the default mask can run on any thread, including non-worker threads assisting the job manager.
+     */
+    static constexpr AZ::u64 JobAnyWorkerAffinityMask = ~static_cast<AZ::u64>(0);
+
     /**
      * Descriptor for a single job manager thread, an array of these is specified in JobManagerDesc.
      */
@@ -6,25 +6,65 @@
  */
 
 #include <AzCore/Math/Crc.h>
+#include <AzCore/Math/Internal/Crc32Slicing.h>
 #include <AzCore/Serialization/SerializeContext.h>
 
 #include <string.h>
 
+#if defined(__ARM_FEATURE_CRC32)
+#   include <arm_acle.h>
+#endif
+
 namespace AZ
 {
+    namespace
+    {
+        constexpr Internal::Crc32SlicingTables Crc32Tables = Internal::MakeCrc32SlicingTables(0xEDB88320);
+
+        // Runtime version of Internal::Crc32Set for buffers, same values but 8 bytes per step.
+        // The lower case conversion works on single bytes, so those requests keep the byte-wise loop.
+        void Crc32SetRuntime(const uint8_t* data, size_t size, bool forceLowerCase, AZ::u32& value)
+        {
+            if (!data || forceLowerCase)
+            {
+                Internal::Crc32Set(data, size, forceLowerCase, value);
+                return;
+            }
+
+            AZ::u32 crc = 0xffffffff;
+#if defined(__ARM_FEATURE_CRC32)
+            // ARMv8 has an instruction for the IEEE polynomial (x86 only has the Castagnoli one, see AZ::Crc32c)
+            for (; size >= 8; data += 8, size -= 8)
+            {
+                AZ::u64 octets;
+                memcpy(&octets, data, sizeof(octets));
+                crc = __crc32d(crc, octets);
+            }
+            for (; size > 0; ++data, --size)
+            {
+                crc = __crc32b(crc, *data);
+            }
+#else
+            crc = Internal::Crc32SlicingBy8(Crc32Tables, crc, data, size);
+#endif
+            value = crc ^ 0xffffffff;
+        }
+    } // namespace
+
     //=========================================================================
     //
     // Crc32 constructor
     //
     //=========================================================================
     Crc32::Crc32(const void* data, size_t size, bool forceLowerCase)
-        : Crc32{ reinterpret_cast<const uint8_t*>(data), size, forceLowerCase }
+        : m_value{ 0 }
     {
+        Crc32SetRuntime(reinterpret_cast<const uint8_t*>(data), size, forceLowerCase, m_value);
     }
 
     void Crc32::Set(const void* data, size_t size, bool forceLowerCase)
     {
-        Internal::Crc32Set(reinterpret_cast<const uint8_t*>(data), size, forceLowerCase, m_value);
+        Crc32SetRuntime(reinterpret_cast<const uint8_t*>(data), size, forceLowerCase, m_value);
     }
 
     //=========================================================================
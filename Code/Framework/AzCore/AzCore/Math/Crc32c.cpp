@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/Crc32c.h>
+#include <AzCore/Math/Internal/Crc32Slicing.h>
+
+#if AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+#   include <nmmintrin.h>
+#   if defined(AZ_COMPILER_MSVC)
+#       include <intrin.h>
+#   endif
+#elif defined(__ARM_FEATURE_CRC32)
+#   include <arm_acle.h>
+#endif
+
+namespace AZ
+{
+    namespace
+    {
+        constexpr Internal::Crc32SlicingTables Crc32cTables = Internal::MakeCrc32SlicingTables(0x82F63B78);
+
+#if AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+        // SSE4.2 is not part of the minimum CPU requirements, the crc32 instruction is only used when cpuid reports it
+        bool HasSse42()
+        {
+#if defined(AZ_COMPILER_MSVC)
+            int cpuInfo[4];
+            __cpuid(cpuInfo, 1);
+            return (cpuInfo[2] & (1 << 20)) != 0;
+#else
+            return __builtin_cpu_supports("sse4.2");
+#endif
+        }
+
+        const bool s_hasSse42 = HasSse42();
+
+#if !defined(AZ_COMPILER_MSVC)
+        __attribute__((target("sse4.2")))
+#endif
+        AZ::u32 UpdateSse42(AZ::u32 crc, const AZ::u8* data, size_t size)
+        {
+            AZ::u64 crc64 = crc;
+            for (; size >= 8; data += 8, size -= 8)
+            {
+                AZ::u64 value;
+                memcpy(&value, data, sizeof(value));
+                crc64 = _mm_crc32_u64(crc64, value);
+            }
+            crc = static_cast<AZ::u32>(crc64);
+            for (; size > 0; ++data, --size)
+            {
+                crc = _mm_crc32_u8(crc, *data);
+            }
+            return crc;
+        }
+#elif defined(__ARM_FEATURE_CRC32)
+        AZ::u32 UpdateArmCrc(AZ::u32 crc, const AZ::u8* data, size_t size)
+        {
+            for (; size >= 8; data += 8, size -= 8)
+            {
+                AZ::u64 value;
+                memcpy(&value, data, sizeof(value));
+                crc = __crc32cd(crc, value);
+            }
+            for (; size > 0; ++data, --size)
+            {
+                crc = __crc32cb(crc, *data);
+            }
+            return crc;
+        }
+#endif
+
+        AZ::u32 UpdateCrc32c(AZ::u32 crc, const void* data, size_t size)
+        {
+            const AZ::u8* bytes = reinterpret_cast<const AZ::u8*>(data);
+#if AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+            if (s_hasSse42)
+            {
+                return UpdateSse42(crc, bytes, size);
+            }
+            return Internal::Crc32SlicingBy8(Crc32cTables, crc, bytes, size);
+#elif defined(__ARM_FEATURE_CRC32)
+            return UpdateArmCrc(crc, bytes, size);
+#else
+            return Internal::Crc32SlicingBy8(Crc32cTables, crc, bytes, size);
+#endif
+        }
+    } // namespace
+
+    void Crc32c::Reset()
+    {
+        m_state = 0xFFFFFFFF;
+    }
+
+    void Crc32c::Update(const void* data, size_t size)
+    {
+        m_state = UpdateCrc32c(m_state, data, size);
+    }
+
+    AZ::u32 Crc32c::GetValue() const
+    {
+        return m_state ^ 0xFFFFFFFF;
+    }
+
+    AZ::u32 Crc32c::Compute(const void* data, size_t size)
+    {
+        return UpdateCrc32c(0xFFFFFFFF, data, size) ^ 0xFFFFFFFF;
+    }
+
+    bool Crc32c::IsHardwareAccelerated()
+    {
+#if AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+        return s_hasSse42;
+#elif defined(__ARM_FEATURE_CRC32)
+        return true;
+#else
+        return false;
+#endif
+    }
+} // namespace AZ
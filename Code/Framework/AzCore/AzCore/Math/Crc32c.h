@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+
+namespace AZ
+{
+    //! CRC-32C (Castagnoli polynomial 0x1EDC6F41, reflected 0x82F63B78), used by iSCSI, ext4, LevelDB...
+    //! It is computed with the SSE4.2 crc32 instruction when the CPU supports it (checked at runtime) or the ARMv8 CRC32
+    //! extension when compiled for it, and with a slicing-by-8 table otherwise.
+    //! The values are unrelated to AZ::Crc32, which uses the IEEE polynomial and must stay compatible with the data
+    //! and the AZ_CRC_CE values already baked into assets. Use this one for new runtime only checksums and hashes.
+    class Crc32c
+    {
+    public:
+        Crc32c() = default;
+
+        //! Starts a new checksum.
+        void Reset();
+
+        //! Adds @size bytes to the checksum. Updating with several buffers gives the same value as a single buffer holding them all.
+        void Update(const void* data, size_t size);
+
+        //! Returns the checksum of all the bytes added since the last Reset().
+        AZ::u32 GetValue() const;
+
+        //! Returns the checksum of a single buffer.
+        static AZ::u32 Compute(const void* data, size_t size);
+
+        //! Returns true if the checksum is computed with a dedicated CPU instruction on this machine.
+        static bool IsHardwareAccelerated();
+
+    private:
+        AZ::u32 m_state = 0xFFFFFFFF;
+    };
+} // namespace AZ
@@ -10,6 +10,7 @@
 #include <AzCore/Math/Aabb.h>
 #include <AzCore/Math/Sphere.h>
 #include <AzCore/Math/Vector3.h>
+#include <AzCore/Math/Vector3Batch.h>
 #include <AzCore/Math/Transform.h>
 #include <AzCore/Math/Plane.h>
 #include <AzCore/Math/SimdMath.h>
@@ -140,6 +141,16 @@ namespace AZ
         //! @return the intersection result of the Aabb against the frustum
         IntersectResult IntersectAabb(const Aabb& aabb) const;
 
+        //! Batch versions of IntersectSphere and IntersectAabb, testing VecType::ElementCount shapes at once.
+        //! 
+        //! @param outResults receives the intersection result of each lane, it must hold VecType::ElementCount values
+        //! @{
+        template <typename VecType>
+        void IntersectSphere(const Vector3Batch<VecType>& centers, typename VecType::FloatArgType radii, IntersectResult* outResults) const;
+        template <typename VecType>
+        void IntersectAabb(const Vector3Batch<VecType>& minimums, const Vector3Batch<VecType>& maximums, IntersectResult* outResults) const;
+        //! @}
+
         //! Returns true if the current frustum and provided frustum are close to identical.
         //! @param rhs the frustum to compare against for closeness
         bool IsClose(const Frustum& rhs, float tolerance = Constants::Tolerance) const;
@@ -109,6 +109,82 @@ namespace AZ
     }
 
 
+    template <typename VecType>
+    AZ_MATH_INLINE void Frustum::IntersectSphere(const Vector3Batch<VecType>& centers, typename VecType::FloatArgType radii, IntersectResult* outResults) const
+    {
+        using FloatType = typename VecType::FloatType;
+
+        const FloatType negativeRadii = VecType::Sub(VecType::ZeroFloat(), radii);
+        FloatType exterior = VecType::ZeroFloat();
+        FloatType intersect = VecType::ZeroFloat();
+
+        for (PlaneId i = PlaneId::Near; i < PlaneId::MAX; ++i)
+        {
+            const Plane plane(m_planes[i]);
+            const FloatType distance = VecType::Add(
+                centers.Dot(Vector3Batch<VecType>::CreateSplat(plane.GetNormal())), VecType::Splat(plane.GetDistance()));
+
+            exterior = VecType::Or(exterior, VecType::CmpLt(distance, negativeRadii));
+            intersect = VecType::Or(intersect, VecType::CmpLt(VecType::Abs(distance), radii));
+        }
+
+        int32_t exteriorLanes[VecType::ElementCount];
+        int32_t intersectLanes[VecType::ElementCount];
+        VecType::StoreUnaligned(exteriorLanes, VecType::CastToInt(exterior));
+        VecType::StoreUnaligned(intersectLanes, VecType::CastToInt(intersect));
+        for (int32_t lane = 0; lane < VecType::ElementCount; ++lane)
+        {
+            outResults[lane] = exteriorLanes[lane] ? IntersectResult::Exterior
+                : (intersectLanes[lane] ? IntersectResult::Overlaps : IntersectResult::Interior);
+        }
+    }
+
+
+    template <typename VecType>
+    AZ_MATH_INLINE void Frustum::IntersectAabb(const Vector3Batch<VecType>& minimums, const Vector3Batch<VecType>& maximums, IntersectResult* outResults) const
+    {
+        using FloatType = typename VecType::FloatType;
+
+        const FloatType zero = VecType::ZeroFloat();
+        FloatType exterior = zero;
+        FloatType overlaps = zero;
+
+        for (PlaneId i = PlaneId::Near; i < PlaneId::MAX; ++i)
+        {
+            // The planes are shared by all the lanes, so the support points of IntersectAabb(const Aabb&) are picked per plane
+            const Plane plane(m_planes[i]);
+            const Vector3 normal = plane.GetNormal();
+            const Vector3Batch<VecType> normals = Vector3Batch<VecType>::CreateSplat(normal);
+            const FloatType distance = VecType::Splat(plane.GetDistance());
+
+            const Vector3Batch<VecType> disjointSupport(
+                normal.GetX() > 0.0f ? maximums.GetX() : minimums.GetX(),
+                normal.GetY() > 0.0f ? maximums.GetY() : minimums.GetY(),
+                normal.GetZ() > 0.0f ? maximums.GetZ() : minimums.GetZ());
+            const Vector3Batch<VecType> intersectSupport(
+                normal.GetX() < 0.0f ? maximums.GetX() : minimums.GetX(),
+                normal.GetY() < 0.0f ? maximums.GetY() : minimums.GetY(),
+                normal.GetZ() < 0.0f ? maximums.GetZ() : minimums.GetZ());
+
+            const FloatType disjointDistance = VecType::Add(disjointSupport.Dot(normals), distance);
+            const FloatType intersectDistance = VecType::Add(intersectSupport.Dot(normals), distance);
+
+            exterior = VecType::Or(exterior, VecType::CmpLt(disjointDistance, zero));
+            overlaps = VecType::Or(overlaps, VecType::CmpLt(intersectDistance, zero));
+        }
+
+        int32_t exteriorLanes[VecType::ElementCount];
+        int32_t overlapsLanes[VecType::ElementCount];
+        VecType::StoreUnaligned(exteriorLanes, VecType::CastToInt(exterior));
+        VecType::StoreUnaligned(overlapsLanes, VecType::CastToInt(overlaps));
+        for (int32_t lane = 0; lane < VecType::ElementCount; ++lane)
+        {
+            outResults[lane] = exteriorLanes[lane] ? IntersectResult::Exterior
+                : (overlapsLanes[lane] ? IntersectResult::Overlaps : IntersectResult::Interior);
+        }
+    }
+
+
     AZ_MATH_INLINE bool Frustum::IsClose(const Frustum& rhs, float tolerance) const
     {
         return Vector4(m_planes[PlaneId::Near  ]).IsClose(Vector4(rhs.m_planes[PlaneId::Near  ]), tolerance)
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+
+#include <string.h>
+
+namespace AZ::Internal
+{
+    //! Tables of the slicing-by-8 algorithm for a reflected CRC-32 polynomial.
+    //! m_table[0] is the usual byte table, m_table[k][b] is the CRC of byte b followed by k zero bytes.
+    struct Crc32SlicingTables
+    {
+        AZ::u32 m_table[8][256];
+    };
+
+    constexpr Crc32SlicingTables MakeCrc32SlicingTables(AZ::u32 reflectedPolynomial)
+    {
+        Crc32SlicingTables tables{};
+        for (AZ::u32 byteValue = 0; byteValue < 256; ++byteValue)
+        {
+            AZ::u32 crc = byteValue;
+            for (int bit = 0; bit < 8; ++bit)
+            {
+                crc = (crc >> 1) ^ ((crc & 1) ? reflectedPolynomial : 0);
+            }
+            tables.m_table[0][byteValue] = crc;
+        }
+        for (AZ::u32 byteValue = 0; byteValue < 256; ++byteValue)
+        {
+            for (int slice = 1; slice < 8; ++slice)
+            {
+                const AZ::u32 previous = tables.m_table[slice - 1][byteValue];
+                tables.m_table[slice][byteValue] = (previous >> 8) ^ tables.m_table[0][previous & 0xFF];
+            }
+        }
+        return tables;
+    }
+
+    //! Updates a running (pre-inverted) CRC with @size bytes, 8 bytes per step. All the supported platforms are little endian.
+    inline AZ::u32 Crc32SlicingBy8(const Crc32SlicingTables& tables, AZ::u32 crc, const AZ::u8* data, size_t size)
+    {
+        for (; size >= 8; data += 8, size -= 8)
+        {
+            AZ::u32 low;
+            AZ::u32 high;
+            memcpy(&low, data, sizeof(low));
+            memcpy(&high, data + 4, sizeof(high));
+            low ^= crc;
+            crc = tables.m_table[7][low & 0xFF] ^ tables.m_table[6][(low >> 8) & 0xFF] ^
+                tables.m_table[5][(low >> 16) & 0xFF] ^ tables.m_table[4][low >> 24] ^
+                tables.m_table[3][high & 0xFF] ^ tables.m_table[2][(high >> 8) & 0xFF] ^
+                tables.m_table[1][(high >> 16) & 0xFF] ^ tables.m_table[0][high >> 24];
+        }
+        for (; size > 0; ++data, --size)
+        {
+            crc = tables.m_table[0][(crc ^ *data) & 0xFF] ^ (crc >> 8);
+        }
+        return crc;
+    }
+} // namespace AZ::Internal
@@ -0,0 +1,343 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ * 
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+namespace AZ
+{
+    namespace Simd
+    {
+        AZ_MATH_INLINE Vec8::FloatType Vec8::LoadAligned(const float* __restrict addr)
+        {
+            return _mm256_load_ps(addr);
+        }
+
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::LoadAligned(const int32_t* __restrict addr)
+        {
+            return _mm256_load_si256(reinterpret_cast<const __m256i*>(addr));
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::LoadUnaligned(const float* __restrict addr)
+        {
+            return _mm256_loadu_ps(addr);
+        }
+
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::LoadUnaligned(const int32_t* __restrict addr)
+        {
+            return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(addr));
+        }
+
+
+        AZ_MATH_INLINE void Vec8::StoreAligned(float* __restrict addr, FloatArgType value)
+        {
+            _mm256_store_ps(addr, value);
+        }
+
+
+        AZ_MATH_INLINE void Vec8::StoreAligned(int32_t* __restrict addr, Int32ArgType value)
+        {
+            _mm256_store_si256(reinterpret_cast<__m256i*>(addr), value);
+        }
+
+
+        AZ_MATH_INLINE void Vec8::StoreUnaligned(float* __restrict addr, FloatArgType value)
+        {
+            _mm256_storeu_ps(addr, value);
+        }
+
+
+        AZ_MATH_INLINE void Vec8::StoreUnaligned(int32_t* __restrict addr, Int32ArgType value)
+        {
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(addr), value);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Splat(float value)
+        {
+            return _mm256_set1_ps(value);
+        }
+
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::Splat(int32_t value)
+        {
+            return _mm256_set1_epi32(value);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Add(FloatArgType arg1, FloatArgType arg2)
+        {
+            return _mm256_add_ps(arg1, arg2);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Sub(FloatArgType arg1, FloatArgType arg2)
+        {
+            return _mm256_sub_ps(arg1, arg2);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Mul(FloatArgType arg1, FloatArgType arg2)
+        {
+            return _mm256_mul_ps(arg1, arg2);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Madd(FloatArgType mul1, FloatArgType mul2, FloatArgType add)
+        {
+            return _mm256_add_ps(_mm256_mul_ps(mul1, mul2), add);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Div(FloatArgType arg1, FloatArgType arg2)
+        {
+            return _mm256_div_ps(arg1, arg2);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Abs(FloatArgType value)
+        {
+            return _mm256_and_ps(value, _mm256_castsi256_ps(_mm256_set1_epi32(0x7fffffff)));
+        }
+
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::Add(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return _mm256_add_epi32(arg1, arg2);
+        }
+
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::Sub(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return _mm256_sub_epi32(arg1, arg2);
+        }
+
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::Mul(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return _mm256_mullo_epi32(arg1, arg2);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Not(FloatArgType value)
+        {
+            return _mm256_xor_ps(value, _mm256_castsi256_ps(_mm256_set1_epi32(-1)));
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::And(FloatArgType arg1, FloatArgType arg2)
+        {
+            return _mm256_and_ps(arg1, arg2);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::AndNot(FloatArgType arg1, FloatArgType arg2)
+        {
+            return _mm256_andnot_ps(arg1, arg2);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Or(FloatArgType arg1, FloatArgType arg2)
+        {
+            return _mm256_or_ps(arg1, arg2);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Xor(FloatArgType arg1, FloatArgType arg2)
+        {
+            return _mm256_xor_ps(arg1, arg2);
+        }
+
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::Not(Int32ArgType value)
+        {
+            return _mm256_xor_si256(value, _mm256_set1_epi32(-1));
+        }
+
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::And(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return _mm256_and_si256(arg1, arg2);
+        }
+
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::AndNot(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return _mm256_andnot_si256(arg1, arg2);
+        }
+
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::Or(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return _mm256_or_si256(arg1, arg2);
+        }
+
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::Xor(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return _mm256_xor_si256(arg1, arg2);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Min(FloatArgType arg1, FloatArgType arg2)
+        {
+            return _mm256_min_ps(arg1, arg2);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Max(FloatArgType arg1, FloatArgType arg2)
+        {
+            return _mm256_max_ps(arg1, arg2);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Clamp(FloatArgType value, FloatArgType min, FloatArgType max)
+        {
+            return Max(min, Min(value, max));
+        }
+
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::Min(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return _mm256_min_epi32(arg1, arg2);
+        }
+
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::Max(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return _mm256_max_epi32(arg1, arg2);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::CmpEq(FloatArgType arg1, FloatArgType arg2)
+        {
+            return _mm256_cmp_ps(arg1, arg2, _CMP_EQ_OQ);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::CmpNeq(FloatArgType arg1, FloatArgType arg2)
+        {
+            return _mm256_cmp_ps(arg1, arg2, _CMP_NEQ_UQ);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::CmpGt(FloatArgType arg1, FloatArgType arg2)
+        {
+            return _mm256_cmp_ps(arg1, arg2, _CMP_GT_OQ);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::CmpGtEq(FloatArgType arg1, FloatArgType arg2)
+        {
+            return _mm256_cmp_ps(arg1, arg2, _CMP_GE_OQ);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::CmpLt(FloatArgType arg1, FloatArgType arg2)
+        {
+            return _mm256_cmp_ps(arg1, arg2, _CMP_LT_OQ);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::CmpLtEq(FloatArgType arg1, FloatArgType arg2)
+        {
+            return _mm256_cmp_ps(arg1, arg2, _CMP_LE_OQ);
+        }
+
+
+        AZ_MATH_INLINE bool Vec8::CmpAllEq(FloatArgType arg1, FloatArgType arg2)
+        {
+            return _mm256_movemask_ps(CmpNeq(arg1, arg2)) == 0;
+        }
+
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::CmpEq(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return _mm256_cmpeq_epi32(arg1, arg2);
+        }
+
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::CmpGt(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return _mm256_cmpgt_epi32(arg1, arg2);
+        }
+
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::CmpLt(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return _mm256_cmpgt_epi32(arg2, arg1);
+        }
+
+
+        AZ_MATH_INLINE bool Vec8::CmpAllEq(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return _mm256_movemask_epi8(_mm256_cmpeq_epi32(arg1, arg2)) == -1;
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Select(FloatArgType arg1, FloatArgType arg2, FloatArgType mask)
+        {
+            return _mm256_blendv_ps(arg2, arg1, mask);
+        }
+
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::Select(Int32ArgType arg1, Int32ArgType arg2, Int32ArgType mask)
+        {
+            return _mm256_blendv_epi8(arg2, arg1, mask);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Reciprocal(FloatArgType value)
+        {
+            return _mm256_div_ps(_mm256_set1_ps(1.0f), value);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Sqrt(FloatArgType value)
+        {
+            return _mm256_sqrt_ps(value);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::ConvertToFloat(Int32ArgType value)
+        {
+            return _mm256_cvtepi32_ps(value);
+        }
+
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::ConvertToInt(FloatArgType value)
+        {
+            return _mm256_cvttps_epi32(value);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::CastToFloat(Int32ArgType value)
+        {
+            return _mm256_castsi256_ps(value);
+        }
+
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::CastToInt(FloatArgType value)
+        {
+            return _mm256_castps_si256(value);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::ZeroFloat()
+        {
+            return _mm256_setzero_ps();
+        }
+
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::ZeroInt()
+        {
+            return _mm256_setzero_si256();
+        }
+    }
+}
@@ -0,0 +1,351 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ * 
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+namespace AZ
+{
+    namespace Simd
+    {
+        AZ_MATH_INLINE Vec8::FloatType Vec8::LoadAligned(const float* __restrict addr)
+        {
+            return { { Vec4::LoadAligned(addr), Vec4::LoadAligned(addr + 4) } };
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::LoadUnaligned(const float* __restrict addr)
+        {
+            return { { Vec4::LoadUnaligned(addr), Vec4::LoadUnaligned(addr + 4) } };
+        }
+
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::LoadAligned(const int32_t* __restrict addr)
+        {
+            return { { Vec4::LoadAligned(addr), Vec4::LoadAligned(addr + 4) } };
+        }
+
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::LoadUnaligned(const int32_t* __restrict addr)
+        {
+            return { { Vec4::LoadUnaligned(addr), Vec4::LoadUnaligned(addr + 4) } };
+        }
+
+
+        AZ_MATH_INLINE void Vec8::StoreAligned(float* __restrict addr, FloatArgType value)
+        {
+            Vec4::StoreAligned(addr, value.v[0]);
+            Vec4::StoreAligned(addr + 4, value.v[1]);
+        }
+
+
+        AZ_MATH_INLINE void Vec8::StoreUnaligned(float* __restrict addr, FloatArgType value)
+        {
+            Vec4::StoreUnaligned(addr, value.v[0]);
+            Vec4::StoreUnaligned(addr + 4, value.v[1]);
+        }
+
+
+        AZ_MATH_INLINE void Vec8::StoreAligned(int32_t* __restrict addr, Int32ArgType value)
+        {
+            Vec4::StoreAligned(addr, value.v[0]);
+            Vec4::StoreAligned(addr + 4, value.v[1]);
+        }
+
+
+        AZ_MATH_INLINE void Vec8::StoreUnaligned(int32_t* __restrict addr, Int32ArgType value)
+        {
+            Vec4::StoreUnaligned(addr, value.v[0]);
+            Vec4::StoreUnaligned(addr + 4, value.v[1]);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Splat(float value)
+        {
+            const Vec4::FloatType splat = Vec4::Splat(value);
+            return { { splat, splat } };
+        }
+
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::Splat(int32_t value)
+        {
+            const Vec4::Int32Type splat = Vec4::Splat(value);
+            return { { splat, splat } };
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Add(FloatArgType arg1, FloatArgType arg2)
+        {
+            return { { Vec4::Add(arg1.v[0], arg2.v[0]), Vec4::Add(arg1.v[1], arg2.v[1]) } };
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Sub(FloatArgType arg1, FloatArgType arg2)
+        {
+            return { { Vec4::Sub(arg1.v[0], arg2.v[0]), Vec4::Sub(arg1.v[1], arg2.v[1]) } };
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Mul(FloatArgType arg1, FloatArgType arg2)
+        {
+            return { { Vec4::Mul(arg1.v[0], arg2.v[0]), Vec4::Mul(arg1.v[1], arg2.v[1]) } };
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Madd(FloatArgType mul1, FloatArgType mul2, FloatArgType add)
+        {
+            return { { Vec4::Madd(mul1.v[0], mul2.v[0], add.v[0]), Vec4::Madd(mul1.v[1], mul2.v[1], add.v[1]) } };
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Div(FloatArgType arg1, FloatArgType arg2)
+        {
+            return { { Vec4::Div(arg1.v[0], arg2.v[0]), Vec4::Div(arg1.v[1], arg2.v[1]) } };
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Abs(FloatArgType value)
+        {
+            return { { Vec4::Abs(value.v[0]), Vec4::Abs(value.v[1]) } };
+        }
+
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::Add(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return { { Vec4::Add(arg1.v[0], arg2.v[0]), Vec4::Add(arg1.v[1], arg2.v[1]) } };
+        }
+
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::Sub(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return { { Vec4::Sub(arg1.v[0], arg2.v[0]), Vec4::Sub(arg1.v[1], arg2.v[1]) } };
+        }
+
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::Mul(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return { { Vec4::Mul(arg1.v[0], arg2.v[0]), Vec4::Mul(arg1.v[1], arg2.v[1]) } };
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Not(FloatArgType value)
+        {
+            return { { Vec4::Not(value.v[0]), Vec4::Not(value.v[1]) } };
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::And(FloatArgType arg1, FloatArgType arg2)
+        {
+            return { { Vec4::And(arg1.v[0], arg2.v[0]), Vec4::And(arg1.v[1], arg2.v[1]) } };
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::AndNot(FloatArgType arg1, FloatArgType arg2)
+        {
+            return { { Vec4::AndNot(arg1.v[0], arg2.v[0]), Vec4::AndNot(arg1.v[1], arg2.v[1]) } };
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Or(FloatArgType arg1, FloatArgType arg2)
+        {
+            return { { Vec4::Or(arg1.v[0], arg2.v[0]), Vec4::Or(arg1.v[1], arg2.v[1]) } };
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Xor(FloatArgType arg1, FloatArgType arg2)
+        {
+            return { { Vec4::Xor(arg1.v[0], arg2.v[0]), Vec4::Xor(arg1.v[1], arg2.v[1]) } };
+        }
+
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::Not(Int32ArgType value)
+        {
+            return { { Vec4::Not(value.v[0]), Vec4::Not(value.v[1]) } };
+        }
+
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::And(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return { { Vec4::And(arg1.v[0], arg2.v[0]), Vec4::And(arg1.v[1], arg2.v[1]) } };
+        }
+
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::AndNot(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return { { Vec4::AndNot(arg1.v[0], arg2.v[0]), Vec4::AndNot(arg1.v[1], arg2.v[1]) } };
+        }
+
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::Or(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return { { Vec4::Or(arg1.v[0], arg2.v[0]), Vec4::Or(arg1.v[1], arg2.v[1]) } };
+        }
+
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::Xor(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return { { Vec4::Xor(arg1.v[0], arg2.v[0]), Vec4::Xor(arg1.v[1], arg2.v[1]) } };
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Min(FloatArgType arg1, FloatArgType arg2)
+        {
+            return { { Vec4::Min(arg1.v[0], arg2.v[0]), Vec4::Min(arg1.v[1], arg2.v[1]) } };
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Max(FloatArgType arg1, FloatArgType arg2)
+        {
+            return { { Vec4::Max(arg1.v[0], arg2.v[0]), Vec4::Max(arg1.v[1], arg2.v[1]) } };
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Clamp(FloatArgType value, FloatArgType min, FloatArgType max)
+        {
+            return { { Vec4::Clamp(value.v[0], min.v[0], max.v[0]), Vec4::Clamp(value.v[1], min.v[1], max.v[1]) } };
+        }
+
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::Min(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return { { Vec4::Min(arg1.v[0], arg2.v[0]), Vec4::Min(arg1.v[1], arg2.v[1]) } };
+        }
+
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::Max(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return { { Vec4::Max(arg1.v[0], arg2.v[0]), Vec4::Max(arg1.v[1], arg2.v[1]) } };
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::CmpEq(FloatArgType arg1, FloatArgType arg2)
+        {
+            return { { Vec4::CmpEq(arg1.v[0], arg2.v[0]), Vec4::CmpEq(arg1.v[1], arg2.v[1]) } };
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::CmpNeq(FloatArgType arg1, FloatArgType arg2)
+        {
+            return { { Vec4::CmpNeq(arg1.v[0], arg2.v[0]), Vec4::CmpNeq(arg1.v[1], arg2.v[1]) } };
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::CmpGt(FloatArgType arg1, FloatArgType arg2)
+        {
+            return { { Vec4::CmpGt(arg1.v[0], arg2.v[0]), Vec4::CmpGt(arg1.v[1], arg2.v[1]) } };
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::CmpGtEq(FloatArgType arg1, FloatArgType arg2)
+        {
+            return { { Vec4::CmpGtEq(arg1.v[0], arg2.v[0]), Vec4::CmpGtEq(arg1.v[1], arg2.v[1]) } };
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::CmpLt(FloatArgType arg1, FloatArgType arg2)
+        {
+            return { { Vec4::CmpLt(arg1.v[0], arg2.v[0]), Vec4::CmpLt(arg1.v[1], arg2.v[1]) } };
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::CmpLtEq(FloatArgType arg1, FloatArgType arg2)
+        {
+            return { { Vec4::CmpLtEq(arg1.v[0], arg2.v[0]), Vec4::CmpLtEq(arg1.v[1], arg2.v[1]) } };
+        }
+
+
+        AZ_MATH_INLINE bool Vec8::CmpAllEq(FloatArgType arg1, FloatArgType arg2)
+        {
+            return Vec4::CmpAllEq(arg1.v[0], arg2.v[0]) && Vec4::CmpAllEq(arg1.v[1], arg2.v[1]);
+        }
+
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::CmpEq(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return { { Vec4::CmpEq(arg1.v[0], arg2.v[0]), Vec4::CmpEq(arg1.v[1], arg2.v[1]) } };
+        }
+
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::CmpGt(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return { { Vec4::CmpGt(arg1.v[0], arg2.v[0]), Vec4::CmpGt(arg1.v[1], arg2.v[1]) } };
+        }
+
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::CmpLt(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return { { Vec4::CmpLt(arg1.v[0], arg2.v[0]), Vec4::CmpLt(arg1.v[1], arg2.v[1]) } };
+        }
+
+
+        AZ_MATH_INLINE bool Vec8::CmpAllEq(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return Vec4::CmpAllEq(arg1.v[0], arg2.v[0]) && Vec4::CmpAllEq(arg1.v[1], arg2.v[1]);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Select(FloatArgType arg1, FloatArgType arg2, FloatArgType mask)
+        {
+            return { { Vec4::Select(arg1.v[0], arg2.v[0], mask.v[0]), Vec4::Select(arg1.v[1], arg2.v[1], mask.v[1]) } };
+        }
+
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::Select(Int32ArgType arg1, Int32ArgType arg2, Int32ArgType mask)
+        {
+            return { { Vec4::Select(arg1.v[0], arg2.v[0], mask.v[0]), Vec4::Select(arg1.v[1], arg2.v[1], mask.v[1]) } };
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Reciprocal(FloatArgType value)
+        {
+            return { { Vec4::Reciprocal(value.v[0]), Vec4::Reciprocal(value.v[1]) } };
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Sqrt(FloatArgType value)
+        {
+            return { { Vec4::Sqrt(value.v[0]), Vec4::Sqrt(value.v[1]) } };
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::ConvertToFloat(Int32ArgType value)
+        {
+            return { { Vec4::ConvertToFloat(value.v[0]), Vec4::ConvertToFloat(value.v[1]) } };
+        }
+
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::ConvertToInt(FloatArgType value)
+        {
+            return { { Vec4::ConvertToInt(value.v[0]), Vec4::ConvertToInt(value.v[1]) } };
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::CastToFloat(Int32ArgType value)
+        {
+            return { { Vec4::CastToFloat(value.v[0]), Vec4::CastToFloat(value.v[1]) } };
+        }
+
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::CastToInt(FloatArgType value)
+        {
+            return { { Vec4::CastToInt(value.v[0]), Vec4::CastToInt(value.v[1]) } };
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::ZeroFloat()
+        {
+            const Vec4::FloatType zero = Vec4::ZeroFloat();
+            return { { zero, zero } };
+        }
+
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::ZeroInt()
+        {
+            const Vec4::Int32Type zero = Vec4::ZeroInt();
+            return { { zero, zero } };
+        }
+    }
+}
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ * 
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/Vector3Batch.h>
+
+namespace AZ
+{
+    //! A batch of quaternions stored as structure of arrays, one SIMD register per component.
+    //! Each lane of the batch behaves like a Quaternion, see Vector3Batch.
+    template <typename VecType>
+    class QuaternionBatch
+    {
+    public:
+
+        using FloatType = typename VecType::FloatType;
+        using FloatArgType = typename VecType::FloatArgType;
+
+        static constexpr int32_t ElementCount = VecType::ElementCount;
+
+        //! Default constructor, components are uninitialized.
+        QuaternionBatch() = default;
+
+        QuaternionBatch(FloatArgType x, FloatArgType y, FloatArgType z, FloatArgType w);
+
+        //! Creates a batch with all the lanes set to @value.
+        static QuaternionBatch CreateSplat(const Quaternion& value);
+
+        static QuaternionBatch CreateIdentity();
+
+        //! Gathers ElementCount quaternions from an array of Quaternion.
+        static QuaternionBatch CreateGather(const Quaternion* values);
+
+        //! Scatters the ElementCount quaternions to an array of Quaternion.
+        void Scatter(Quaternion* values) const;
+
+        //! Returns the quaternion in lane @index.
+        Quaternion GetElement(int32_t index) const;
+
+        FloatArgType GetX() const;
+        FloatArgType GetY() const;
+        FloatArgType GetZ() const;
+        FloatArgType GetW() const;
+
+        Vector3Batch<VecType> GetImaginary() const;
+
+        FloatType Dot(const QuaternionBatch& rhs) const;
+        FloatType GetLengthSq() const;
+        FloatType GetLength() const;
+
+        //! Returns the normalized quaternions, lanes must not have a zero length.
+        QuaternionBatch GetNormalized() const;
+
+        QuaternionBatch GetConjugate() const;
+
+        //! Rotates each lane of @vectors by the quaternion in the same lane, same math as Quaternion::TransformVector.
+        Vector3Batch<VecType> TransformVector(const Vector3Batch<VecType>& vectors) const;
+
+        QuaternionBatch operator*(const QuaternionBatch& rhs) const;
+
+    private:
+
+        FloatType m_x;
+        FloatType m_y;
+        FloatType m_z;
+        FloatType m_w;
+    };
+
+    using QuaternionX4 = QuaternionBatch<Simd::Vec4>;
+    using QuaternionX8 = QuaternionBatch<Simd::Vec8>;
+}
+
+#include <AzCore/Math/QuaternionBatch.inl>
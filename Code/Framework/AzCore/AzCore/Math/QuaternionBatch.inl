@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ * 
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+namespace AZ
+{
+    template <typename VecType>
+    AZ_MATH_INLINE QuaternionBatch<VecType>::QuaternionBatch(FloatArgType x, FloatArgType y, FloatArgType z, FloatArgType w)
+        : m_x(x)
+        , m_y(y)
+        , m_z(z)
+        , m_w(w)
+    {
+        ;
+    }
+
+
+    template <typename VecType>
+    AZ_MATH_INLINE QuaternionBatch<VecType> QuaternionBatch<VecType>::CreateSplat(const Quaternion& value)
+    {
+        return QuaternionBatch(VecType::Splat(value.GetX()), VecType::Splat(value.GetY()), VecType::Splat(value.GetZ()), VecType::Splat(value.GetW()));
+    }
+
+
+    template <typename VecType>
+    AZ_MATH_INLINE QuaternionBatch<VecType> QuaternionBatch<VecType>::CreateIdentity()
+    {
+        const FloatType zero = VecType::ZeroFloat();
+        return QuaternionBatch(zero, zero, zero, VecType::Splat(1.0f));
+    }
+
+
+    template <typename VecType>
+    AZ_MATH_INLINE QuaternionBatch<VecType> QuaternionBatch<VecType>::CreateGather(const Quaternion* values)
+    {
+        float components[4][ElementCount];
+        for (int32_t index = 0; index < ElementCount; ++index)
+        {
+            components[0][index] = values[index].GetX();
+            components[1][index] = values[index].GetY();
+            components[2][index] = values[index].GetZ();
+            components[3][index] = values[index].GetW();
+        }
+        return QuaternionBatch(
+            VecType::LoadUnaligned(components[0]), VecType::LoadUnaligned(components[1]),
+            VecType::LoadUnaligned(components[2]), VecType::LoadUnaligned(components[3]));
+    }
+
+
+    template <typename VecType>
+    AZ_MATH_INLINE void QuaternionBatch<VecType>::Scatter(Quaternion* values) const
+    {
+        float components[4][ElementCount];
+        VecType::StoreUnaligned(components[0], m_x);
+        VecType::StoreUnaligned(components[1], m_y);
+        VecType::StoreUnaligned(components[2], m_z);
+        VecType::StoreUnaligned(components[3], m_w);
+        for (int32_t index = 0; index < ElementCount; ++index)
+        {
+            values[index].Set(components[0][index], components[1][index], components[2][index], components[3][index]);
+        }
+    }
+
+
+    template <typename VecType>
+    AZ_MATH_INLINE Quaternion QuaternionBatch<VecType>::GetElement(int32_t index) const
+    {
+        AZ_MATH_ASSERT(index >= 0 && index < ElementCount, "Invalid index for batch lane");
+        Quaternion values[ElementCount];
+        Scatter(values);
+        return values[index];
+    }
+
+
+    template <typename VecType>
+    AZ_MATH_INLINE typename QuaternionBatch<VecType>::FloatArgType QuaternionBatch<VecType>::GetX() const
+    {
+        return m_x;
+    }
+
+
+    template <typename VecType>
+    AZ_MATH_INLINE typename QuaternionBatch<VecType>::FloatArgType QuaternionBatch<VecType>::GetY() const
+    {
+        return m_y;
+    }
+
+
+    template <typename VecType>
+    AZ_MATH_INLINE typename QuaternionBatch<VecType>::FloatArgType QuaternionBatch<VecType>::GetZ() const
+    {
+        return m_z;
+    }
+
+
+    template <typename VecType>
+    AZ_MATH_INLINE typename QuaternionBatch<VecType>::FloatArgType QuaternionBatch<VecType>::GetW() const
+    {
+        return m_w;
+    }
+
+
+    template <typename VecType>
+    AZ_MATH_INLINE Vector3Batch<VecType> QuaternionBatch<VecType>::GetImaginary() const
+    {
+        return Vector3Batch<VecType>(m_x, m_y, m_z);
+    }
+
+
+    template <typename VecType>
+    AZ_MATH_INLINE typename QuaternionBatch<VecType>::FloatType QuaternionBatch<VecType>::Dot(const QuaternionBatch& rhs) const
+    {
+        return VecType::Madd(m_w, rhs.m_w, GetImaginary().Dot(rhs.GetImaginary()));
+    }
+
+
+    template <typename VecType>
+    AZ_MATH_INLINE typename QuaternionBatch<VecType>::FloatType QuaternionBatch<VecType>::GetLengthSq() const
+    {
+        return Dot(*this);
+    }
+
+
+    template <typename VecType>
+    AZ_MATH_INLINE typename QuaternionBatch<VecType>::FloatType QuaternionBatch<VecType>::GetLength() const
+    {
+        return VecType::Sqrt(GetLengthSq());
+    }
+
+
+    template <typename VecType>
+    AZ_MATH_INLINE QuaternionBatch<VecType> QuaternionBatch<VecType>::GetNormalized() const
+    {
+        const FloatType invLength = VecType::Reciprocal(GetLength());
+        return QuaternionBatch(VecType::Mul(m_x, invLength), VecType::Mul(m_y, invLength), VecType::Mul(m_z, invLength), VecType::Mul(m_w, invLength));
+    }
+
+
+    template <typename VecType>
+    AZ_MATH_INLINE QuaternionBatch<VecType> QuaternionBatch<VecType>::GetConjugate() const
+    {
+        const FloatType zero = VecType::ZeroFloat();
+        return QuaternionBatch(VecType::Sub(zero, m_x), VecType::Sub(zero, m_y), VecType::Sub(zero, m_z), m_w);
+    }
+
+
+    template <typename VecType>
+    AZ_MATH_INLINE Vector3Batch<VecType> QuaternionBatch<VecType>::TransformVector(const Vector3Batch<VecType>& vectors) const
+    {
+        // Same terms as Simd::Vec4::QuaternionTransform
+        const Vector3Batch<VecType> vecQuat = GetImaginary();
+        const FloatType twoDot = VecType::Mul(vecQuat.Dot(vectors), VecType::Splat(2.0f));
+        const FloatType scale = VecType::Sub(VecType::Mul(m_w, m_w), vecQuat.GetLengthSq());
+        const FloatType twoScalar = VecType::Mul(m_w, VecType::Splat(2.0f));
+        return vecQuat * twoDot + vectors * scale + vecQuat.Cross(vectors) * twoScalar;
+    }
+
+
+    template <typename VecType>
+    AZ_MATH_INLINE QuaternionBatch<VecType> QuaternionBatch<VecType>::operator*(const QuaternionBatch& rhs) const
+    {
+        // Same as Simd::Vec4::QuaternionMultiply, lane by lane
+        const Vector3Batch<VecType> lhsVec = GetImaginary();
+        const Vector3Batch<VecType> rhsVec = rhs.GetImaginary();
+        const Vector3Batch<VecType> imaginary = lhsVec.Cross(rhsVec) + rhsVec * m_w + lhsVec * rhs.m_w;
+        const FloatType real = VecType::Sub(VecType::Mul(m_w, rhs.m_w), lhsVec.Dot(rhsVec));
+        return QuaternionBatch(imaginary.GetX(), imaginary.GetY(), imaginary.GetZ(), real);
+    }
+}
@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ * 
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/SimdBatch.h>
+#include <AzCore/Math/Matrix3x4.h>
+#include <AzCore/Math/ShapeIntersection.h>
+#include <AzCore/Math/SimdMath.h>
+#include <AzCore/Math/Vector3Batch.h>
+
+namespace AZ
+{
+    namespace SimdBatch
+    {
+        static constexpr size_t LaneCount = static_cast<size_t>(Simd::Vec8::ElementCount);
+
+        void TransformPoints(
+            const Matrix3x4& transform,
+            const float* pointsX, const float* pointsY, const float* pointsZ,
+            float* outPointsX, float* outPointsY, float* outPointsZ,
+            size_t count)
+        {
+            const size_t batchCount = count - count % LaneCount;
+            for (size_t index = 0; index < batchCount; index += LaneCount)
+            {
+                const Vector3x8 points = Vector3x8::CreateFromSoa(pointsX + index, pointsY + index, pointsZ + index);
+                TransformPoint(transform, points).StoreToSoa(outPointsX + index, outPointsY + index, outPointsZ + index);
+            }
+
+            for (size_t index = batchCount; index < count; ++index)
+            {
+                const Vector3 result = transform * Vector3(pointsX[index], pointsY[index], pointsZ[index]);
+                outPointsX[index] = result.GetX();
+                outPointsY[index] = result.GetY();
+                outPointsZ[index] = result.GetZ();
+            }
+        }
+
+        void OverlapsFrustum(
+            const Frustum& frustum,
+            const float* minX, const float* minY, const float* minZ,
+            const float* maxX, const float* maxY, const float* maxZ,
+            bool* outOverlaps,
+            size_t count)
+        {
+            using Vec8 = Simd::Vec8;
+
+            struct PlaneLanes
+            {
+                Vec8::FloatType m_normal[3];
+                Vec8::FloatType m_absNormal[3];
+                Vec8::FloatType m_distance;
+            };
+
+            PlaneLanes planes[Frustum::PlaneId::MAX];
+            for (Frustum::PlaneId planeId = Frustum::PlaneId::Near; planeId < Frustum::PlaneId::MAX; ++planeId)
+            {
+                const Plane plane = frustum.GetPlane(planeId);
+                const Vector3 normal = plane.GetNormal();
+                const Vector3 absNormal = normal.GetAbs();
+                for (int32_t axis = 0; axis < 3; ++axis)
+                {
+                    planes[planeId].m_normal[axis] = Vec8::Splat(normal.GetElement(axis));
+                    planes[planeId].m_absNormal[axis] = Vec8::Splat(absNormal.GetElement(axis));
+                }
+                planes[planeId].m_distance = Vec8::Splat(plane.GetDistance());
+            }
+
+            const Vec8::FloatType half = Vec8::Splat(0.5f);
+            const Vec8::FloatType zero = Vec8::ZeroFloat();
+
+            const size_t batchCount = count - count % LaneCount;
+            for (size_t index = 0; index < batchCount; index += LaneCount)
+            {
+                const Vec8::FloatType mins[3] = {
+                    Vec8::LoadUnaligned(minX + index), Vec8::LoadUnaligned(minY + index), Vec8::LoadUnaligned(minZ + index) };
+                const Vec8::FloatType maxs[3] = {
+                    Vec8::LoadUnaligned(maxX + index), Vec8::LoadUnaligned(maxY + index), Vec8::LoadUnaligned(maxZ + index) };
+
+                Vec8::FloatType centers[3];
+                Vec8::FloatType extents[3];
+                for (int32_t axis = 0; axis < 3; ++axis)
+                {
+                    centers[axis] = Vec8::Mul(half, Vec8::Add(mins[axis], maxs[axis]));
+                    extents[axis] = Vec8::Mul(half, Vec8::Sub(maxs[axis], mins[axis]));
+                }
+
+                // Same as the scalar test, an aabb is outside when it is fully behind any of the planes
+                Vec8::FloatType outside = zero;
+                for (const PlaneLanes& plane : planes)
+                {
+                    Vec8::FloatType distance = Vec8::Madd(plane.m_normal[0], centers[0], plane.m_distance);
+                    distance = Vec8::Madd(plane.m_normal[1], centers[1], distance);
+                    distance = Vec8::Madd(plane.m_normal[2], centers[2], distance);
+
+                    Vec8::FloatType radius = Vec8::Mul(plane.m_absNormal[0], extents[0]);
+                    radius = Vec8::Madd(plane.m_absNormal[1], extents[1], radius);
+                    radius = Vec8::Madd(plane.m_absNormal[2], extents[2], radius);
+
+                    outside = Vec8::Or(outside, Vec8::CmpLtEq(Vec8::Add(distance, radius), zero));
+                }
+
+                AZ_ALIGN(int32_t outsideLanes[LaneCount], 32);
+                Vec8::StoreAligned(outsideLanes, Vec8::CastToInt(outside));
+                for (size_t lane = 0; lane < LaneCount; ++lane)
+                {
+                    outOverlaps[index + lane] = outsideLanes[lane] == 0;
+                }
+            }
+
+            for (size_t index = batchCount; index < count; ++index)
+            {
+                const Aabb aabb = Aabb::CreateFromMinMax(
+                    Vector3(minX[index], minY[index], minZ[index]), Vector3(maxX[index], maxY[index], maxZ[index]));
+                outOverlaps[index] = ShapeIntersection::Overlaps(frustum, aabb);
+            }
+        }
+    }
+}
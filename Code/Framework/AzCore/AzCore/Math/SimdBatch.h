@@ -0,0 +1,38 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ * 
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+
+namespace AZ
+{
+    class Frustum;
+    class Matrix3x4;
+
+    //! Batch kernels processing Simd::Vec8::ElementCount elements at a time.
+    //! The data is laid out as structure of arrays, one array per component, the arrays don't need any particular alignment.
+    //! The remaining elements of a batch not multiple of the lane count give the same results as the scalar math types.
+    namespace SimdBatch
+    {
+        //! Transforms @count points by @transform. The output arrays may be the input arrays, but must not partially overlap them.
+        void TransformPoints(
+            const Matrix3x4& transform,
+            const float* pointsX, const float* pointsY, const float* pointsZ,
+            float* outPointsX, float* outPointsY, float* outPointsZ,
+            size_t count);
+
+        //! Tests @count aabbs against @frustum, using the same test as ShapeIntersection::Overlaps(const Frustum&, const Aabb&).
+        //! @outOverlaps is set to true for each aabb overlapping the frustum.
+        void OverlapsFrustum(
+            const Frustum& frustum,
+            const float* minX, const float* minY, const float* minZ,
+            const float* maxX, const float* maxY, const float* maxZ,
+            bool* outOverlaps,
+            size_t count);
+    }
+}
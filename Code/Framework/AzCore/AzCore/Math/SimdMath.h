@@ -19,6 +19,13 @@
 #   endif
 #endif
 
+// The eight lane types use AVX2 when the compiler targets it (-mavx2, /arch:AVX2), otherwise they fall back to pairs of Vec4
+#if AZ_TRAIT_USE_PLATFORM_SIMD_SSE && defined(__AVX2__)
+#   if !defined(AZ_TRAIT_USE_PLATFORM_SIMD_AVX2)
+#       define AZ_TRAIT_USE_PLATFORM_SIMD_AVX2 1
+#   endif
+#endif
+
 namespace AZ
 {
     namespace Simd
@@ -48,6 +55,7 @@ namespace AZ
 #include <AzCore/Math/SimdMathVec2.h>
 #include <AzCore/Math/SimdMathVec3.h>
 #include <AzCore/Math/SimdMathVec4.h>
+#include <AzCore/Math/SimdMathVec8.h>
 
 namespace AZ
 {
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ * 
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Matrix3x4.h>
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/Math/Vector3.h>
+
+namespace AZ
+{
+    //! A batch of 3-dimensional vectors stored as structure of arrays, one SIMD register per component.
+    //! Each lane of the batch behaves like a Vector3, so loops over arrays of vectors use all the SIMD lanes.
+    //! @VecType is one of the Simd vector types, see the Vector3x4 and Vector3x8 aliases.
+    template <typename VecType>
+    class Vector3Batch
+    {
+    public:
+
+        using FloatType = typename VecType::FloatType;
+        using FloatArgType = typename VecType::FloatArgType;
+
+        static constexpr int32_t ElementCount = VecType::ElementCount;
+
+        //! Default constructor, components are uninitialized.
+        Vector3Batch() = default;
+
+        Vector3Batch(FloatArgType x, FloatArgType y, FloatArgType z);
+
+        //! Creates a batch with all the lanes set to @value.
+        static Vector3Batch CreateSplat(const Vector3& value);
+
+        static Vector3Batch CreateZero();
+
+        //! Loads ElementCount vectors from separate x, y and z arrays, no alignment is required.
+        static Vector3Batch CreateFromSoa(const float* x, const float* y, const float* z);
+
+        //! Gathers ElementCount vectors from an array of Vector3.
+        static Vector3Batch CreateGather(const Vector3* values);
+
+        //! Stores ElementCount vectors to separate x, y and z arrays, no alignment is required.
+        void StoreToSoa(float* x, float* y, float* z) const;
+
+        //! Scatters the ElementCount vectors to an array of Vector3.
+        void Scatter(Vector3* values) const;
+
+        //! Returns the vector in lane @index.
+        Vector3 GetElement(int32_t index) const;
+
+        FloatArgType GetX() const;
+        FloatArgType GetY() const;
+        FloatArgType GetZ() const;
+        void SetX(FloatArgType x);
+        void SetY(FloatArgType y);
+        void SetZ(FloatArgType z);
+
+        FloatType GetLengthSq() const;
+        FloatType GetLength() const;
+
+        //! Returns the normalized vectors, lanes must not have a zero length.
+        Vector3Batch GetNormalized() const;
+
+        //! Returns the normalized vectors, lanes with a length below @tolerance are set to zero like Vector3::GetNormalizedSafe.
+        Vector3Batch GetNormalizedSafe(float tolerance = Constants::Tolerance) const;
+
+        FloatType Dot(const Vector3Batch& rhs) const;
+        Vector3Batch Cross(const Vector3Batch& rhs) const;
+
+        //! Per lane select, ( r = mask ? vA : vB ) where @mask comes from a VecType comparison.
+        static Vector3Batch CreateSelect(FloatArgType mask, const Vector3Batch& vA, const Vector3Batch& vB);
+
+        Vector3Batch operator-() const;
+        Vector3Batch operator+(const Vector3Batch& rhs) const;
+        Vector3Batch operator-(const Vector3Batch& rhs) const;
+        Vector3Batch operator*(const Vector3Batch& rhs) const;
+        Vector3Batch operator*(FloatArgType multiplier) const;
+        Vector3Batch operator*(float multiplier) const;
+        Vector3Batch& operator+=(const Vector3Batch& rhs);
+        Vector3Batch& operator-=(const Vector3Batch& rhs);
+        Vector3Batch& operator*=(float multiplier);
+
+    private:
+
+        FloatType m_x;
+        FloatType m_y;
+        FloatType m_z;
+    };
+
+    using Vector3x4 = Vector3Batch<Simd::Vec4>;
+    using Vector3x8 = Vector3Batch<Simd::Vec8>;
+
+    //! Batch equivalents of Transform::TransformPoint / TransformVector and Matrix3x4 * Vector3, applying the same transform to every lane.
+    template <typename VecType>
+    Vector3Batch<VecType> TransformPoint(const Transform& transform, const Vector3Batch<VecType>& points);
+    template <typename VecType>
+    Vector3Batch<VecType> TransformVector(const Transform& transform, const Vector3Batch<VecType>& vectors);
+    template <typename VecType>
+    Vector3Batch<VecType> TransformPoint(const Matrix3x4& matrix, const Vector3Batch<VecType>& points);
+
+    //! Batch equivalent of Quaternion::TransformVector, rotating every lane by @rotation.
+    template <typename VecType>
+    Vector3Batch<VecType> TransformVector(const Quaternion& rotation, const Vector3Batch<VecType>& vectors);
+}
+
+#include <AzCore/Math/Vector3Batch.inl>
@@ -0,0 +1,292 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ * 
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+namespace AZ
+{
+    template <typename VecType>
+    AZ_MATH_INLINE Vector3Batch<VecType>::Vector3Batch(FloatArgType x, FloatArgType y, FloatArgType z)
+        : m_x(x)
+        , m_y(y)
+        , m_z(z)
+    {
+        ;
+    }
+
+
+    template <typename VecType>
+    AZ_MATH_INLINE Vector3Batch<VecType> Vector3Batch<VecType>::CreateSplat(const Vector3& value)
+    {
+        return Vector3Batch(VecType::Splat(value.GetX()), VecType::Splat(value.GetY()), VecType::Splat(value.GetZ()));
+    }
+
+
+    template <typename VecType>
+    AZ_MATH_INLINE Vector3Batch<VecType> Vector3Batch<VecType>::CreateZero()
+    {
+        const FloatType zero = VecType::ZeroFloat();
+        return Vector3Batch(zero, zero, zero);
+    }
+
+
+    template <typename VecType>
+    AZ_MATH_INLINE Vector3Batch<VecType> Vector3Batch<VecType>::CreateFromSoa(const float* x, const float* y, const float* z)
+    {
+        return Vector3Batch(VecType::LoadUnaligned(x), VecType::LoadUnaligned(y), VecType::LoadUnaligned(z));
+    }
+
+
+    template <typename VecType>
+    AZ_MATH_INLINE Vector3Batch<VecType> Vector3Batch<VecType>::CreateGather(const Vector3* values)
+    {
+        float components[3][ElementCount];
+        for (int32_t index = 0; index < ElementCount; ++index)
+        {
+            components[0][index] = values[index].GetX();
+            components[1][index] = values[index].GetY();
+            components[2][index] = values[index].GetZ();
+        }
+        return CreateFromSoa(components[0], components[1], components[2]);
+    }
+
+
+    template <typename VecType>
+    AZ_MATH_INLINE void Vector3Batch<VecType>::StoreToSoa(float* x, float* y, float* z) const
+    {
+        VecType::StoreUnaligned(x, m_x);
+        VecType::StoreUnaligned(y, m_y);
+        VecType::StoreUnaligned(z, m_z);
+    }
+
+
+    template <typename VecType>
+    AZ_MATH_INLINE void Vector3Batch<VecType>::Scatter(Vector3* values) const
+    {
+        float components[3][ElementCount];
+        StoreToSoa(components[0], components[1], components[2]);
+        for (int32_t index = 0; index < ElementCount; ++index)
+        {
+            values[index].Set(components[0][index], components[1][index], components[2][index]);
+        }
+    }
+
+
+    template <typename VecType>
+    AZ_MATH_INLINE Vector3 Vector3Batch<VecType>::GetElement(int32_t index) const
+    {
+        AZ_MATH_ASSERT(index >= 0 && index < ElementCount, "Invalid index for batch lane");
+        float components[3][ElementCount];
+        StoreToSoa(components[0], components[1], components[2]);
+        return Vector3(components[0][index], components[1][index], components[2][index]);
+    }
+
+
+    template <typename VecType>
+    AZ_MATH_INLINE typename Vector3Batch<VecType>::FloatArgType Vector3Batch<VecType>::GetX() const
+    {
+        return m_x;
+    }
+
+
+    template <typename VecType>
+    AZ_MATH_INLINE typename Vector3Batch<VecType>::FloatArgType Vector3Batch<VecType>::GetY() const
+    {
+        return m_y;
+    }
+
+
+    template <typename VecType>
+    AZ_MATH_INLINE typename Vector3Batch<VecType>::FloatArgType Vector3Batch<VecType>::GetZ() const
+    {
+        return m_z;
+    }
+
+
+    template <typename VecType>
+    AZ_MATH_INLINE void Vector3Batch<VecType>::SetX(FloatArgType x)
+    {
+        m_x = x;
+    }
+
+
+    template <typename VecType>
+    AZ_MATH_INLINE void Vector3Batch<VecType>::SetY(FloatArgType y)
+    {
+        m_y = y;
+    }
+
+
+    template <typename VecType>
+    AZ_MATH_INLINE void Vector3Batch<VecType>::SetZ(FloatArgType z)
+    {
+        m_z = z;
+    }
+
+
+    template <typename VecType>
+    AZ_MATH_INLINE typename Vector3Batch<VecType>::FloatType Vector3Batch<VecType>::GetLengthSq() const
+    {
+        return Dot(*this);
+    }
+
+
+    template <typename VecType>
+    AZ_MATH_INLINE typename Vector3Batch<VecType>::FloatType Vector3Batch<VecType>::GetLength() const
+    {
+        return VecType::Sqrt(GetLengthSq());
+    }
+
+
+    template <typename VecType>
+    AZ_MATH_INLINE Vector3Batch<VecType> Vector3Batch<VecType>::GetNormalized() const
+    {
+        return (*this) * VecType::Reciprocal(GetLength());
+    }
+
+
+    template <typename VecType>
+    AZ_MATH_INLINE Vector3Batch<VecType> Vector3Batch<VecType>::GetNormalizedSafe(float tolerance) const
+    {
+        const FloatType lengthSq = GetLengthSq();
+        const FloatType tooSmall = VecType::CmpLt(lengthSq, VecType::Splat(tolerance * tolerance));
+        const FloatType invLength = VecType::Select(VecType::ZeroFloat(), VecType::Reciprocal(VecType::Sqrt(lengthSq)), tooSmall);
+        return (*this) * invLength;
+    }
+
+
+    template <typename VecType>
+    AZ_MATH_INLINE typename Vector3Batch<VecType>::FloatType Vector3Batch<VecType>::Dot(const Vector3Batch& rhs) const
+    {
+        return VecType::Madd(m_z, rhs.m_z, VecType::Madd(m_y, rhs.m_y, VecType::Mul(m_x, rhs.m_x)));
+    }
+
+
+    template <typename VecType>
+    AZ_MATH_INLINE Vector3Batch<VecType> Vector3Batch<VecType>::Cross(const Vector3Batch& rhs) const
+    {
+        return Vector3Batch(
+            VecType::Sub(VecType::Mul(m_y, rhs.m_z), VecType::Mul(m_z, rhs.m_y)),
+            VecType::Sub(VecType::Mul(m_z, rhs.m_x), VecType::Mul(m_x, rhs.m_z)),
+            VecType::Sub(VecType::Mul(m_x, rhs.m_y), VecType::Mul(m_y, rhs.m_x)));
+    }
+
+
+    template <typename VecType>
+    AZ_MATH_INLINE Vector3Batch<VecType> Vector3Batch<VecType>::CreateSelect(FloatArgType mask, const Vector3Batch& vA, const Vector3Batch& vB)
+    {
+        return Vector3Batch(VecType::Select(vA.m_x, vB.m_x, mask), VecType::Select(vA.m_y, vB.m_y, mask), VecType::Select(vA.m_z, vB.m_z, mask));
+    }
+
+
+    template <typename VecType>
+    AZ_MATH_INLINE Vector3Batch<VecType> Vector3Batch<VecType>::operator-() const
+    {
+        const FloatType zero = VecType::ZeroFloat();
+        return Vector3Batch(VecType::Sub(zero, m_x), VecType::Sub(zero, m_y), VecType::Sub(zero, m_z));
+    }
+
+
+    template <typename VecType>
+    AZ_MATH_INLINE Vector3Batch<VecType> Vector3Batch<VecType>::operator+(const Vector3Batch& rhs) const
+    {
+        return Vector3Batch(VecType::Add(m_x, rhs.m_x), VecType::Add(m_y, rhs.m_y), VecType::Add(m_z, rhs.m_z));
+    }
+
+
+    template <typename VecType>
+    AZ_MATH_INLINE Vector3Batch<VecType> Vector3Batch<VecType>::operator-(const Vector3Batch& rhs) const
+    {
+        return Vector3Batch(VecType::Sub(m_x, rhs.m_x), VecType::Sub(m_y, rhs.m_y), VecType::Sub(m_z, rhs.m_z));
+    }
+
+
+    template <typename VecType>
+    AZ_MATH_INLINE Vector3Batch<VecType> Vector3Batch<VecType>::operator*(const Vector3Batch& rhs) const
+    {
+        return Vector3Batch(VecType::Mul(m_x, rhs.m_x), VecType::Mul(m_y, rhs.m_y), VecType::Mul(m_z, rhs.m_z));
+    }
+
+
+    template <typename VecType>
+    AZ_MATH_INLINE Vector3Batch<VecType> Vector3Batch<VecType>::operator*(FloatArgType multiplier) const
+    {
+        return Vector3Batch(VecType::Mul(m_x, multiplier), VecType::Mul(m_y, multiplier), VecType::Mul(m_z, multiplier));
+    }
+
+
+    template <typename VecType>
+    AZ_MATH_INLINE Vector3Batch<VecType> Vector3Batch<VecType>::operator*(float multiplier) const
+    {
+        return (*this) * VecType::Splat(multiplier);
+    }
+
+
+    template <typename VecType>
+    AZ_MATH_INLINE Vector3Batch<VecType>& Vector3Batch<VecType>::operator+=(const Vector3Batch& rhs)
+    {
+        *this = (*this) + rhs;
+        return *this;
+    }
+
+
+    template <typename VecType>
+    AZ_MATH_INLINE Vector3Batch<VecType>& Vector3Batch<VecType>::operator-=(const Vector3Batch& rhs)
+    {
+        *this = (*this) - rhs;
+        return *this;
+    }
+
+
+    template <typename VecType>
+    AZ_MATH_INLINE Vector3Batch<VecType>& Vector3Batch<VecType>::operator*=(float multiplier)
+    {
+        *this = (*this) * multiplier;
+        return *this;
+    }
+
+
+    template <typename VecType>
+    AZ_MATH_INLINE Vector3Batch<VecType> TransformVector(const Quaternion& rotation, const Vector3Batch<VecType>& vectors)
+    {
+        // Same terms as Simd::Vec4::QuaternionTransform, with the quaternion shared by all the lanes
+        const Vector3Batch<VecType> vecQuat = Vector3Batch<VecType>::CreateSplat(rotation.GetImaginary());
+        const float scalar = rotation.GetW();
+
+        const typename VecType::FloatType twoDot = VecType::Mul(vecQuat.Dot(vectors), VecType::Splat(2.0f));
+        const Vector3Batch<VecType> sum1 = vecQuat * twoDot; // quat.Dot(vec3) * vec3 * 2.0f
+        const Vector3Batch<VecType> sum2 = vectors * (scalar * scalar - rotation.GetImaginary().GetLengthSq()); // vec3 * (scalar * scalar - quat.Dot(quat))
+        const Vector3Batch<VecType> sum3 = vecQuat.Cross(vectors) * (scalar * 2.0f); // scalar * 2.0f * quat.Cross(vec3)
+        return sum1 + sum2 + sum3;
+    }
+
+
+    template <typename VecType>
+    AZ_MATH_INLINE Vector3Batch<VecType> TransformVector(const Transform& transform, const Vector3Batch<VecType>& vectors)
+    {
+        return TransformVector(transform.GetRotation(), vectors * transform.GetUniformScale());
+    }
+
+
+    template <typename VecType>
+    AZ_MATH_INLINE Vector3Batch<VecType> TransformPoint(const Transform& transform, const Vector3Batch<VecType>& points)
+    {
+        return TransformVector(transform, points) + Vector3Batch<VecType>::CreateSplat(transform.GetTranslation());
+    }
+
+
+    template <typename VecType>
+    AZ_MATH_INLINE Vector3Batch<VecType> TransformPoint(const Matrix3x4& matrix, const Vector3Batch<VecType>& points)
+    {
+        typename VecType::FloatType rows[3];
+        for (int32_t row = 0; row < 3; ++row)
+        {
+            rows[row] = VecType::Madd(VecType::Splat(matrix.GetElement(row, 2)), points.GetZ(), VecType::Splat(matrix.GetElement(row, 3)));
+            rows[row] = VecType::Madd(VecType::Splat(matrix.GetElement(row, 1)), points.GetY(), rows[row]);
+            rows[row] = VecType::Madd(VecType::Splat(matrix.GetElement(row, 0)), points.GetX(), rows[row]);
+        }
+        return Vector3Batch<VecType>(rows[0], rows[1], rows[2]);
+    }
+}
@@ -0,0 +1,193 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/XxHash64.h>
+
+#include <string.h>
+
+namespace AZ
+{
+    namespace
+    {
+        constexpr AZ::u64 Prime1 = 0x9E3779B185EBCA87ULL;
+        constexpr AZ::u64 Prime2 = 0xC2B2AE3D27D4EB4FULL;
+        constexpr AZ::u64 Prime3 = 0x165667B19E3779F9ULL;
+        constexpr AZ::u64 Prime4 = 0x85EBCA77C2B2AE63ULL;
+        constexpr AZ::u64 Prime5 = 0x27D4EB2F165667C5ULL;
+
+        AZ_FORCE_INLINE AZ::u64 RotateLeft(AZ::u64 value, int bits)
+        {
+            return (value << bits) | (value >> (64 - bits));
+        }
+
+        AZ_FORCE_INLINE AZ::u64 Read64(const AZ::u8* data)
+        {
+            AZ::u64 value;
+            memcpy(&value, data, sizeof(value));
+            return value;
+        }
+
+        AZ_FORCE_INLINE AZ::u32 Read32(const AZ::u8* data)
+        {
+            AZ::u32 value;
+            memcpy(&value, data, sizeof(value));
+            return value;
+        }
+
+        AZ_FORCE_INLINE AZ::u64 Round(AZ::u64 accumulator, AZ::u64 input)
+        {
+            accumulator += input * Prime2;
+            accumulator = RotateLeft(accumulator, 31);
+            return accumulator * Prime1;
+        }
+
+        AZ_FORCE_INLINE AZ::u64 MergeRound(AZ::u64 hash, AZ::u64 accumulator)
+        {
+            hash ^= Round(0, accumulator);
+            return hash * Prime1 + Prime4;
+        }
+
+        //! Consumes whole 32 bytes stripes, returns the number of bytes consumed.
+        size_t ProcessStripes(AZ::u64 (&accumulators)[4], const AZ::u8* data, size_t size)
+        {
+            AZ::u64 v1 = accumulators[0];
+            AZ::u64 v2 = accumulators[1];
+            AZ::u64 v3 = accumulators[2];
+            AZ::u64 v4 = accumulators[3];
+            const AZ::u8* const begin = data;
+            for (; size >= 32; data += 32, size -= 32)
+            {
+                v1 = Round(v1, Read64(data));
+                v2 = Round(v2, Read64(data + 8));
+                v3 = Round(v3, Read64(data + 16));
+                v4 = Round(v4, Read64(data + 24));
+            }
+            accumulators[0] = v1;
+            accumulators[1] = v2;
+            accumulators[2] = v3;
+            accumulators[3] = v4;
+            return static_cast<size_t>(data - begin);
+        }
+
+        //! Mixes the remaining tail bytes (less than 32) and avalanches the result.
+        AZ::u64 Finalize(AZ::u64 hash, const AZ::u8* data, size_t size)
+        {
+            for (; size >= 8; data += 8, size -= 8)
+            {
+                hash ^= Round(0, Read64(data));
+                hash = RotateLeft(hash, 27) * Prime1 + Prime4;
+            }
+            if (size >= 4)
+            {
+                hash ^= static_cast<AZ::u64>(Read32(data)) * Prime1;
+                hash = RotateLeft(hash, 23) * Prime2 + Prime3;
+                data += 4;
+                size -= 4;
+            }
+            for (; size > 0; ++data, --size)
+            {
+                hash ^= (*data) * Prime5;
+                hash = RotateLeft(hash, 11) * Prime1;
+            }
+
+            hash ^= hash >> 33;
+            hash *= Prime2;
+            hash ^= hash >> 29;
+            hash *= Prime3;
+            hash ^= hash >> 32;
+            return hash;
+        }
+
+        AZ::u64 MergeAccumulators(const AZ::u64 (&accumulators)[4])
+        {
+            AZ::u64 hash = RotateLeft(accumulators[0], 1) + RotateLeft(accumulators[1], 7) +
+                RotateLeft(accumulators[2], 12) + RotateLeft(accumulators[3], 18);
+            for (AZ::u64 accumulator : accumulators)
+            {
+                hash = MergeRound(hash, accumulator);
+            }
+            return hash;
+        }
+    } // namespace
+
+    XxHash64::XxHash64(AZ::u64 seed)
+    {
+        Reset(seed);
+    }
+
+    void XxHash64::Reset(AZ::u64 seed)
+    {
+        m_accumulators[0] = seed + Prime1 + Prime2;
+        m_accumulators[1] = seed + Prime2;
+        m_accumulators[2] = seed;
+        m_accumulators[3] = seed - Prime1;
+        m_seed = seed;
+        m_totalSize = 0;
+        m_bufferSize = 0;
+    }
+
+    void XxHash64::Update(const void* data, size_t size)
+    {
+        const AZ::u8* bytes = reinterpret_cast<const AZ::u8*>(data);
+        m_totalSize += size;
+
+        if (m_bufferSize + size < sizeof(m_buffer))
+        {
+            if (size > 0)
+            {
+                memcpy(m_buffer + m_bufferSize, bytes, size);
+                m_bufferSize += static_cast<AZ::u32>(size);
+            }
+            return;
+        }
+
+        if (m_bufferSize > 0)
+        {
+            const size_t toFill = sizeof(m_buffer) - m_bufferSize;
+            memcpy(m_buffer + m_bufferSize, bytes, toFill);
+            ProcessStripes(m_accumulators, m_buffer, sizeof(m_buffer));
+            bytes += toFill;
+            size -= toFill;
+            m_bufferSize = 0;
+        }
+
+        const size_t consumed = ProcessStripes(m_accumulators, bytes, size);
+        bytes += consumed;
+        size -= consumed;
+        if (size > 0)
+        {
+            memcpy(m_buffer, bytes, size);
+            m_bufferSize = static_cast<AZ::u32>(size);
+        }
+    }
+
+    AZ::u64 XxHash64::GetDigest() const
+    {
+        AZ::u64 hash = m_totalSize >= 32 ? MergeAccumulators(m_accumulators) : m_seed + Prime5;
+        hash += m_totalSize;
+        return Finalize(hash, m_buffer, m_bufferSize);
+    }
+
+    AZ::u64 XxHash64::Compute(const void* data, size_t size, AZ::u64 seed)
+    {
+        const AZ::u8* bytes = reinterpret_cast<const AZ::u8*>(data);
+        AZ::u64 hash;
+        size_t consumed = 0;
+        if (size >= 32)
+        {
+            AZ::u64 accumulators[4] = { seed + Prime1 + Prime2, seed + Prime2, seed, seed - Prime1 };
+            consumed = ProcessStripes(accumulators, bytes, size);
+            hash = MergeAccumulators(accumulators);
+        }
+        else
+        {
+            hash = seed + Prime5;
+        }
+        hash += size;
+        return Finalize(hash, bytes + consumed, size - consumed);
+    }
+} // namespace AZ
@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+
+namespace AZ
+{
+    //! 64 bits xxHash (XXH64), a fast non cryptographic hash processing 32 bytes per round.
+    //! The values are identical to the reference implementation (XXH64() / XXH64_update() of the xxhash library),
+    //! so hashes stored by tools using the library stay valid.
+    //! The streaming state lives in the object, no allocation is made.
+    class XxHash64
+    {
+    public:
+        explicit XxHash64(AZ::u64 seed = 0);
+
+        //! Starts a new hash with @seed.
+        void Reset(AZ::u64 seed = 0);
+
+        //! Adds @size bytes to the hash. Updating with several buffers gives the same value as a single buffer holding them all.
+        void Update(const void* data, size_t size);
+
+        //! Returns the hash of all the bytes added since the last Reset(). The state is not modified, more data can be added.
+        AZ::u64 GetDigest() const;
+
+        //! Returns the hash of a single buffer.
+        static AZ::u64 Compute(const void* data, size_t size, AZ::u64 seed = 0);
+
+    private:
+        AZ::u64 m_accumulators[4];
+        AZ::u64 m_seed = 0;
+        AZ::u64 m_totalSize = 0;
+        //! Bytes of an incomplete 32 bytes stripe, waiting for more data.
+        alignas(8) AZ::u8 m_buffer[32];
+        AZ::u32 m_bufferSize = 0;
+    };
+} // namespace AZ
@@ -11,8 +11,10 @@
 #include <AzCore/Driller/DrillerBus.h>
 
 #include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/math.h>
 
 #include <AzCore/Debug/StackTracer.h>
+#include <AzCore/IO/GenericStreams.h>
 
 using namespace AZ;
 using namespace AZ::Debug;
@@ -20,6 +22,36 @@ using namespace AZ::Debug;
 // Many PC tools break with alloc/free size mismatches when the memory guard is enabled.  Disable for now
 //#define ENABLE_MEMORY_GUARD
 
+namespace
+{
+    // Number of slots in the sampled addresses set, it's considered full at 3/4 of that.
+    const size_t SampledAddressesSize = 16 * 1024;
+    // Marks a slot which address was erased, lookups must keep probing past it.
+    void* const SampledAddressErased = reinterpret_cast<void*>(1);
+
+    // Sampling state, per thread and shared by all the records.
+    AZ_THREAD_LOCAL AZ::s64 s_bytesUntilNextSample = 0;
+    AZ_THREAD_LOCAL AZ::u64 s_sampleRandomState = 0;
+
+    size_t SampledAddressSlot(void* address)
+    {
+        // Fibonacci hashing, the low bits of an address are mostly zero because of the alignment
+        const AZ::u64 hash = (static_cast<AZ::u64>(reinterpret_cast<uintptr_t>(address)) >> 3) * 0x9E3779B97F4A7C15ull;
+        return static_cast<size_t>(hash >> 32) & (SampledAddressesSize - 1);
+    }
+
+    // Distance in bytes to the next sample point, exponentially distributed so the sample points follow a Poisson process
+    AZ::s64 NextSampleDistance(size_t samplingInterval)
+    {
+        // xorshift64
+        s_sampleRandomState ^= s_sampleRandomState << 13;
+        s_sampleRandomState ^= s_sampleRandomState >> 7;
+        s_sampleRandomState ^= s_sampleRandomState << 17;
+        const double uniform = static_cast<double>(s_sampleRandomState >> 11) * (1.0 / 9007199254740992.0); // [0,1)
+        return static_cast<AZ::s64>(-AZStd::log(1.0 - uniform) * static_cast<double>(samplingInterval)) + 1;
+    }
+}
+
 //=========================================================================
 // AllocationRecords
 // [9/16/2009]
@@ -34,6 +66,10 @@ AllocationRecords::AllocationRecords(unsigned char stackRecordLevels, bool isMem
     , m_requestedAllocs(0)
     , m_requestedBytes(0)
     , m_requestedBytesPeak(0)
+    , m_samplingInterval(DefaultSamplingInterval)
+    , m_sampledAddresses(nullptr)
+    , m_numUsedSampledAddressSlots(0)
+    , m_isSampledAddressesOverflow(false)
     , m_allocatorName(allocatorName)
 {
 #if defined(ENABLE_MEMORY_GUARD)
@@ -47,6 +83,11 @@ AllocationRecords::AllocationRecords(unsigned char stackRecordLevels, bool isMem
 #endif
     // preallocate some buckets
     //m_records.rehash(20000);
+
+    if (m_mode == RECORD_SAMPLED)
+    {
+        ResetSampledAddresses();
+    }
 };
 
 //=========================================================================
@@ -62,6 +103,12 @@ AllocationRecords::~AllocationRecords()
         EnumerateAllocations(PrintAllocationsCB(true, includeNameAndFilename));
         AZ_Error("Memory", m_records.empty(), "We still have %d allocations on record! They must be freed prior to destroy!", m_records.size());
     }
+
+    if (m_sampledAddresses)
+    {
+        m_records.get_allocator().deallocate(m_sampledAddresses, sizeof(AZStd::atomic<void*>) * SampledAddressesSize, alignof(AZStd::atomic<void*>));
+        m_sampledAddresses = nullptr;
+    }
 }
 
 //=========================================================================
@@ -132,6 +179,12 @@ AllocationRecords::RegisterAllocation(void* address, size_t byteSize, size_t ali
         AZ_Assert(iterBool.second, "Memory address 0x%p is already allocated and in the records!", address);
     }
 
+    if (m_mode == RECORD_SAMPLED)
+    {
+        // the allocator already filtered out the allocations which were not sampled, see ShouldRecordAllocation
+        InsertSampledAddress(address);
+    }
+
     Debug::AllocationInfo& ai = iterBool.first->second;
     ai.m_byteSize =  byteSize;
     ai.m_alignment = static_cast<unsigned int>(alignment);
@@ -167,7 +220,7 @@ AllocationRecords::RegisterAllocation(void* address, size_t byteSize, size_t ali
     ai.m_timeStamp = AZStd::GetTimeNowMicroSecond();
 
     // if we don't have a fileName,lineNum record the stack or if the user requested it.
-    if ((fileName == 0 && m_mode == RECORD_STACK_IF_NO_FILE_LINE) || m_mode == RECORD_FULL)
+    if ((fileName == 0 && m_mode == RECORD_STACK_IF_NO_FILE_LINE) || m_mode == RECORD_FULL || m_mode == RECORD_SAMPLED)
     {
         ai.m_stackFrames = m_numStackLevels ? reinterpret_cast<AZ::Debug::StackFrame*>(m_records.get_allocator().allocate(sizeof(AZ::Debug::StackFrame)*m_numStackLevels, 1)) : nullptr;
         if (ai.m_stackFrames)
@@ -295,6 +348,11 @@ AllocationRecords::UnregisterAllocation(void* address, size_t byteSize, size_t a
         *info = iter->second;
     }
 
+    if (m_sampledAddresses)
+    {
+        EraseSampledAddress(address);
+    }
+
     m_records.erase(iter);
 
     // try to be more aggressive and keep the memory footprint low.
@@ -324,6 +382,10 @@ AllocationRecords::ResizeAllocation(void* address, size_t newSize)
     }
 
     Debug::AllocationRecordsType::iterator iter = m_records.find(address);
+    if (iter == m_records.end() && m_mode == RECORD_SAMPLED)
+    {
+        return; // the allocation was not sampled
+    }
     AZ_Assert(iter!=m_records.end(), "Could not find address 0x%p in the allocator!", address);
     AllocatorManager::Instance().DebugBreak(address, iter->second);
     
@@ -384,11 +446,161 @@ AllocationRecords::SetMode(Mode mode)
 
     AZ_Warning("Memory", m_mode!=RECORD_NO_RECORDS||mode==RECORD_NO_RECORDS, "Records recording was disabled and now it's enabled! You might get assert when you free memory, if a you have allocations which were not recorded!");
 
+    if (mode == RECORD_SAMPLED && m_mode != RECORD_SAMPLED)
+    {
+        ResetSampledAddresses();
+    }
+
     m_mode = mode;
 
     DrillerEBusMutex::GetMutex().unlock();
 }
 
+//=========================================================================
+// SetSamplingInterval
+//=========================================================================
+void
+AllocationRecords::SetSamplingInterval(size_t samplingInterval)
+{
+    AZ_Assert(samplingInterval > 0, "Sampling interval must be at least one byte!");
+    m_samplingInterval = AZStd::GetMax(samplingInterval, static_cast<size_t>(1));
+}
+
+//=========================================================================
+// ShouldRecordAllocation
+//=========================================================================
+bool
+AllocationRecords::ShouldRecordAllocation(size_t byteSize) const
+{
+    if (m_mode != RECORD_SAMPLED)
+    {
+        return true;
+    }
+
+    if (s_sampleRandomState == 0)
+    {
+        // first sampled allocator use on this thread
+        s_sampleRandomState = (static_cast<AZ::u64>(reinterpret_cast<uintptr_t>(&s_sampleRandomState)) ^ AZStd::GetTimeNowMicroSecond()) | 1;
+        s_bytesUntilNextSample = NextSampleDistance(m_samplingInterval);
+    }
+
+    s_bytesUntilNextSample -= static_cast<AZ::s64>(byteSize);
+    if (s_bytesUntilNextSample > 0)
+    {
+        return false;
+    }
+    s_bytesUntilNextSample = NextSampleDistance(m_samplingInterval);
+    return true;
+}
+
+//=========================================================================
+// IsRecordedAddress
+//=========================================================================
+bool
+AllocationRecords::IsRecordedAddress(void* address) const
+{
+    if (m_mode != RECORD_SAMPLED || !m_sampledAddresses || m_isSampledAddressesOverflow.load(AZStd::memory_order_acquire))
+    {
+        return true;
+    }
+
+    // The address we look for is live, so it can't be inserted or erased while we probe. Other slots can change
+    // concurrently, which is fine since erased slots are never turned back into empty ones while the set is in use.
+    for (size_t i = 0, slot = SampledAddressSlot(address); i < SampledAddressesSize; ++i, slot = (slot + 1) & (SampledAddressesSize - 1))
+    {
+        void* slotAddress = m_sampledAddresses[slot].load(AZStd::memory_order_acquire);
+        if (slotAddress == address)
+        {
+            return true;
+        }
+        if (slotAddress == nullptr)
+        {
+            return false;
+        }
+    }
+    return false;
+}
+
+//=========================================================================
+// ResetSampledAddresses
+//=========================================================================
+void
+AllocationRecords::ResetSampledAddresses()
+{
+    if (!m_sampledAddresses)
+    {
+        m_sampledAddresses = reinterpret_cast<AZStd::atomic<void*>*>(m_records.get_allocator().allocate(sizeof(AZStd::atomic<void*>) * SampledAddressesSize, alignof(AZStd::atomic<void*>)));
+    }
+    for (size_t i = 0; i < SampledAddressesSize; ++i)
+    {
+        new(&m_sampledAddresses[i]) AZStd::atomic<void*>(nullptr);
+    }
+    m_numUsedSampledAddressSlots = 0;
+    m_isSampledAddressesOverflow.store(false, AZStd::memory_order_release);
+
+    // allocations recorded before we switched to sampled mode must still be reported when freed
+    for (const auto& record : m_records)
+    {
+        InsertSampledAddress(record.first);
+    }
+}
+
+//=========================================================================
+// InsertSampledAddress
+//=========================================================================
+void
+AllocationRecords::InsertSampledAddress(void* address)
+{
+    if (m_isSampledAddressesOverflow.load(AZStd::memory_order_relaxed))
+    {
+        return;
+    }
+
+    size_t slot = SampledAddressSlot(address);
+    while (true)
+    {
+        void* slotAddress = m_sampledAddresses[slot].load(AZStd::memory_order_relaxed);
+        if (slotAddress == SampledAddressErased)
+        {
+            break;
+        }
+        if (slotAddress == nullptr)
+        {
+            if ((m_numUsedSampledAddressSlots + 1) * 4 > SampledAddressesSize * 3)
+            {
+                // too many samples to keep the probing short, every deallocation will be reported from now on
+                m_isSampledAddressesOverflow.store(true, AZStd::memory_order_release);
+                return;
+            }
+            ++m_numUsedSampledAddressSlots;
+            break;
+        }
+        slot = (slot + 1) & (SampledAddressesSize - 1);
+    }
+    m_sampledAddresses[slot].store(address, AZStd::memory_order_release);
+}
+
+//=========================================================================
+// EraseSampledAddress
+//=========================================================================
+void
+AllocationRecords::EraseSampledAddress(void* address)
+{
+    for (size_t i = 0, slot = SampledAddressSlot(address); i < SampledAddressesSize; ++i, slot = (slot + 1) & (SampledAddressesSize - 1))
+    {
+        void* slotAddress = m_sampledAddresses[slot].load(AZStd::memory_order_relaxed);
+        if (slotAddress == address)
+        {
+            m_sampledAddresses[slot].store(SampledAddressErased, AZStd::memory_order_release);
+            return;
+        }
+        if (slotAddress == nullptr)
+        {
+            return;
+        }
+    }
+}
+
 //=========================================================================
 // EnumerateAllocations
 // [9/29/2009]
@@ -411,6 +623,77 @@ AllocationRecords::EnumerateAllocations(AllocationInfoCBType cb)
     DrillerEBusMutex::GetMutex().unlock();
 }
 
+//=========================================================================
+// EnumerateAllocationSites
+//=========================================================================
+void
+AllocationRecords::EnumerateAllocationSites(AllocationSiteCBType cb)
+{
+    typedef AZStd::unordered_map<AZ::u64, AllocationSiteInfo, AZStd::hash<AZ::u64>, AZStd::equal_to<AZ::u64>, OSStdAllocator> AllocationSitesType;
+
+    DrillerEBusMutex::GetMutex().lock();
+    // Same as EnumerateAllocations, we make a copy of the records which the sites can point to while we call the callback
+    const Debug::AllocationRecordsType recordsCopy = m_records;
+    const bool isSampled = (m_mode == RECORD_SAMPLED);
+    const double samplingInterval = static_cast<double>(m_samplingInterval);
+
+    AllocationSitesType sites;
+    for (Debug::AllocationRecordsType::const_iterator iter = recordsCopy.begin(); iter != recordsCopy.end(); ++iter)
+    {
+        const AllocationInfo& info = iter->second;
+
+        // FNV-1a of the stack, or of the file and line when the stack was not recorded
+        AZ::u64 siteKey = 14695981039346656037ull;
+        auto hashValue = [&siteKey](AZ::u64 value)
+        {
+            siteKey ^= value;
+            siteKey *= 1099511628211ull;
+        };
+        if (info.m_stackFrames)
+        {
+            for (unsigned char i = 0; i < m_numStackLevels; ++i)
+            {
+                hashValue(static_cast<AZ::u64>(info.m_stackFrames[i].m_programCounter));
+            }
+        }
+        else
+        {
+            hashValue(static_cast<AZ::u64>(reinterpret_cast<uintptr_t>(info.m_fileName)));
+            hashValue(static_cast<AZ::u64>(info.m_lineNum));
+        }
+
+        // Each sampled allocation stands for 1/p allocations, where p is the probability to sample an allocation of that size
+        double weight = 1.0;
+        if (isSampled)
+        {
+            const double probability = 1.0 - AZStd::exp(-static_cast<double>(info.m_byteSize) / samplingInterval);
+            if (probability > 0.0)
+            {
+                weight = 1.0 / probability;
+            }
+        }
+
+        AllocationSiteInfo& site = sites[siteKey];
+        if (!site.m_allocation)
+        {
+            site.m_allocation = &info;
+        }
+        ++site.m_numRecords;
+        site.m_recordedBytes += info.m_byteSize;
+        site.m_estimatedCount += static_cast<size_t>(weight + 0.5);
+        site.m_estimatedBytes += static_cast<size_t>(static_cast<double>(info.m_byteSize) * weight + 0.5);
+    }
+
+    for (AllocationSitesType::const_iterator iter = sites.begin(); iter != sites.end(); ++iter)
+    {
+        if (!cb(iter->second, m_numStackLevels))
+        {
+            break;
+        }
+    }
+    DrillerEBusMutex::GetMutex().unlock();
+}
+
 //=========================================================================
 // IntegrityCheck
 // [9/9/2011]
@@ -501,3 +784,48 @@ PrintAllocationsCB::operator()(void* address, const AllocationInfo& info, unsign
     }
     return true; // continue enumerating
 }
+
+//=========================================================================
+// WriteAllocationSitesCB::operator()
+//=========================================================================
+bool
+WriteAllocationSitesCB::operator()(const AllocationSiteInfo& site, unsigned char numStackLevels)
+{
+    char line[512];
+    const AllocationInfo& info = *site.m_allocation;
+    int length = azsnprintf(line, AZ_ARRAY_SIZE(line), "Site EstimatedBytes: %zu EstimatedCount: %zu Records: %zu RecordedBytes: %zu Name: %s\n",
+        site.m_estimatedBytes, site.m_estimatedCount, site.m_numRecords, site.m_recordedBytes, info.m_name ? info.m_name : "");
+    m_stream->Write(AZStd::GetMin(static_cast<size_t>(AZStd::GetMax(length, 0)), sizeof(line) - 1), line);
+
+    if (!info.m_stackFrames)
+    {
+        if (info.m_fileName)
+        {
+            length = azsnprintf(line, AZ_ARRAY_SIZE(line), " %s (%d)\n", info.m_fileName, info.m_lineNum);
+            m_stream->Write(AZStd::GetMin(static_cast<size_t>(AZStd::GetMax(length, 0)), sizeof(line) - 1), line);
+        }
+    }
+    else
+    {
+        // Allocation callstack, decoding is slow but we only do it once per site
+        const unsigned char decodeStep = 40;
+        Debug::SymbolStorage::StackLine lines[decodeStep];
+        unsigned char iFrame = 0;
+        while (numStackLevels > 0)
+        {
+            unsigned char numToDecode = AZStd::GetMin(decodeStep, numStackLevels);
+            Debug::SymbolStorage::DecodeFrames(&info.m_stackFrames[iFrame], numToDecode, lines);
+            for (unsigned char i = 0; i < numToDecode; ++i)
+            {
+                if (info.m_stackFrames[iFrame + i].IsValid())
+                {
+                    length = azsnprintf(line, AZ_ARRAY_SIZE(line), " %s\n", lines[i]);
+                    m_stream->Write(AZStd::GetMin(static_cast<size_t>(AZStd::GetMax(length, 0)), sizeof(line) - 1), line);
+                }
+            }
+            numStackLevels -= numToDecode;
+            iFrame += numToDecode;
+        }
+    }
+    return true; // continue enumerating
+}
@@ -13,9 +13,15 @@
 
 #include <AzCore/Memory/OSAllocator.h>
 #include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/atomic.h>
 
 namespace AZ
 {
+    namespace IO
+    {
+        class GenericStream;
+    }
+
     namespace Debug
     {
         struct StackFrame;
@@ -63,6 +69,40 @@ namespace AZ
             bool m_isDetailed;      ///< True to print allocation line and allocation callstack, otherwise false.
             bool m_includeNameAndFilename;  /// < True to print the source name and source filename, otherwise skip
         };
+
+        /**
+         * Recorded allocations aggregated by allocation site (same stack, or same file and line when there is no stack).
+         * In \ref AllocationRecords::RECORD_SAMPLED mode the estimates account for the allocations that were not sampled.
+         */
+        struct AllocationSiteInfo
+        {
+            const AllocationInfo*   m_allocation{};     ///< One of the allocations of the site, for its name, file, line and stack.
+            size_t                  m_numRecords{};     ///< Number of recorded allocations.
+            size_t                  m_recordedBytes{};  ///< Bytes of the recorded allocations.
+            size_t                  m_estimatedCount{}; ///< Estimated number of live allocations made from the site.
+            size_t                  m_estimatedBytes{}; ///< Estimated number of live bytes allocated from the site.
+        };
+
+        /**
+         * Allocation sites enumeration callback
+         * \param const AllocationSiteInfo& aggregated allocations of the site.
+         * \param unsigned char number of stack records/levels, if AllocationSiteInfo::m_allocation->m_stackFrames != NULL.
+         * \returns true if you want to continue traverse of the sites and false if you want to stop.
+         */
+        typedef AZStd::function<bool (const AllocationSiteInfo&, unsigned char)> AllocationSiteCBType;
+        /**
+         * Allocation sites enumeration callback which writes the sites as text into a stream (a file for example), one
+         * line per site followed by the decoded stack.
+         */
+        struct WriteAllocationSitesCB
+        {
+            WriteAllocationSitesCB(IO::GenericStream& stream)
+                : m_stream(&stream) {}
+
+            bool operator()(const AllocationSiteInfo& site, unsigned char numStackLevels);
+
+            IO::GenericStream* m_stream;
+        };
         
         /**
          * Guard value is used to guard different memory allocations for stomping.
@@ -130,6 +170,7 @@ namespace AZ
                 RECORD_STACK_NEVER,             ///< Never record stack traces. All other info is stored.
                 RECORD_STACK_IF_NO_FILE_LINE,   ///< Record stack if fileName and lineNum are not available. (default)
                 RECORD_FULL,                    ///< Always record the full stack.
+                RECORD_SAMPLED,                 ///< Record, with the full stack, a sample of one allocation every \ref GetSamplingInterval bytes on average.
 
                 RECORD_MAX                      ///< Must be last
             };
@@ -138,6 +179,9 @@ namespace AZ
              * IMPORTANT: if isAllocationGuard
              */
 
+            /// Default number of bytes between two recorded allocations in RECORD_SAMPLED mode.
+            static const size_t DefaultSamplingInterval = 512 * 1024;
+
             AllocationRecords(unsigned char stackRecordLevels, bool isMemoryGuard, bool isMarkUnallocatedMemory, const char* allocatorName);
             ~AllocationRecords();
 
@@ -156,6 +200,24 @@ namespace AZ
             void    SetSaveNames(bool saveNames)                { m_saveNames = saveNames; }
             void    SetDecodeImmediately(bool decodeImmediately) { m_decodeImmediately = decodeImmediately; }
 
+            /**
+             * Average number of allocated bytes between two recorded allocations in RECORD_SAMPLED mode. Allocations are
+             * sampled per byte (Poisson process), so large allocations are more likely to be recorded than small ones.
+             */
+            void    SetSamplingInterval(size_t samplingInterval);
+            size_t  GetSamplingInterval() const                 { return m_samplingInterval; }
+
+            /**
+             * Lock free check done by the allocators before reporting an allocation. Always true, except in RECORD_SAMPLED
+             * mode where it's only true for the sampled allocations (the sampling state is kept per thread).
+             */
+            bool    ShouldRecordAllocation(size_t byteSize) const;
+            /**
+             * Lock free check done by the allocators before reporting a deallocation or resize. Returns false only if the
+             * address is known not to be recorded, which avoids taking the lock for every allocation that was not sampled.
+             */
+            bool    IsRecordedAddress(void* address) const;
+
             /// Returns number of stack levels that will captured for each allocation when requested (depending on the \ref Mode)
             unsigned char   GetNumStackLevels() const           { return m_numStackLevels; }
 
@@ -165,6 +227,9 @@ namespace AZ
             /// Enumerates all allocations in a thread safe manner.
             void    EnumerateAllocations(AllocationInfoCBType cb);
 
+            /// Enumerates all allocations, aggregated by allocation site, in a thread safe manner.
+            void    EnumerateAllocationSites(AllocationSiteCBType cb);
+
             /// If marking is enabled it will set all memory we deallocate with 0xcd
             void    MarkUallocatedMemory(bool isMark)           { m_isMarkUnallocatedMemory = isMark; }
             bool    IsMarkUnallocatedMemory() const             { return m_isMarkUnallocatedMemory; }
@@ -197,6 +262,12 @@ namespace AZ
 
             void    IntegrityCheckNoLock() const;
 
+            // @{ Set of the sampled addresses, which can be queried without the lock - we assume this functions are called with the lock locked.
+            void    ResetSampledAddresses();
+            void    InsertSampledAddress(void* address);
+            void    EraseSampledAddress(void* address);
+            // @}
+
             Debug::AllocationRecordsType    m_records;
             Mode                            m_mode;
             bool                            m_isAutoIntegrityCheck;
@@ -208,6 +279,13 @@ namespace AZ
             size_t                          m_requestedAllocs;
             size_t                          m_requestedBytes;
             size_t                          m_requestedBytesPeak;
+            size_t                          m_samplingInterval;
+
+            /// Open addressing hash set of the sampled addresses, allocated the first time RECORD_SAMPLED mode is used.
+            AZStd::atomic<void*>*           m_sampledAddresses;
+            size_t                          m_numUsedSampledAddressSlots;
+            /// True when the sampled addresses don't fit in the set, IsRecordedAddress will then always return true.
+            AZStd::atomic_bool              m_isSampledAddressesOverflow;
 
             const char*                     m_allocatorName;
         };
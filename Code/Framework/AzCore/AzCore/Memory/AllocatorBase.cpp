@@ -7,6 +7,7 @@
 
 #include <AzCore/Memory/Memory.h>
 #include <AzCore/Memory/AllocatorManager.h>
+#include <AzCore/Memory/AllocationRecords.h>
 #include <AzCore/Memory/MemoryDrillerBus.h>
 
 using namespace AZ;
@@ -132,6 +133,11 @@ void AllocatorBase::ProfileAllocation(void* ptr, size_t byteSize, size_t alignme
 #if PLATFORM_MEMORY_INSTRUMENTATION_ENABLED
         AZ::PlatformMemoryInstrumentation::Alloc(ptr, byteSize, 0, m_platformMemoryInstrumentationGroupId);
 #else
+        // in sampled mode most allocations are filtered out here, before we take the driller lock
+        if (m_records && !m_records->ShouldRecordAllocation(byteSize))
+        {
+            return;
+        }
         EBUS_EVENT(AZ::Debug::MemoryDrillerBus, RegisterAllocation, this, ptr, byteSize, alignment, name, fileName, lineNum, suppressStackRecord);
 #endif
     }
@@ -144,6 +150,10 @@ void AllocatorBase::ProfileDeallocation(void* ptr, size_t byteSize, size_t align
 #if PLATFORM_MEMORY_INSTRUMENTATION_ENABLED
         AZ::PlatformMemoryInstrumentation::Free(ptr);
 #else
+        if (!info && m_records && !m_records->IsRecordedAddress(ptr))
+        {
+            return;
+        }
         EBUS_EVENT(AZ::Debug::MemoryDrillerBus, UnregisterAllocation, this, ptr, byteSize, alignment, info);
 #endif
     }
@@ -184,6 +194,10 @@ void AllocatorBase::ProfileResize(void* ptr, size_t newSize)
 {
     if (newSize && m_isProfilingActive)
     {
+        if (m_records && !m_records->IsRecordedAddress(ptr))
+        {
+            return;
+        }
         EBUS_EVENT(AZ::Debug::MemoryDrillerBus, ResizeAllocation, this, ptr, newSize);
     }
 }
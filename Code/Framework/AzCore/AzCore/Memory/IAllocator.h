@@ -70,6 +70,8 @@ namespace AZ
         virtual size_type               GetUnAllocatedMemory(bool isPrint = false) const { (void)isPrint; return 0; }
         /// Returns a pointer to a sub-allocator or NULL.
         virtual IAllocatorAllocate*     GetSubAllocator() = 0;
+        /// Returns true if the allocations are forwarded to another allocator, which then also reports their bytes.
+        virtual bool                    IsChildAllocator() const { return false; }
     };
 
     /**
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Memory/LinearSchema.h>
+#include <AzCore/Memory/SimpleSchemaAllocator.h>
+
+namespace AZ
+{
+    namespace Internal
+    {
+        /*!
+        * Template you can use to create your own thread linear allocators, as you can't inherit from FrameLinearAllocator.
+        * This is the case because we use thread local storage and we need separate "static" instance for each allocator.
+        * Allocations are not profiled or recorded, as they are never freed individually.
+        */
+        template<class Schema>
+        class LinearAllocatorHelper
+            : public SimpleSchemaAllocator<Schema, typename Schema::Descriptor, /* ProfileAllocations */ false, /* ReportOutOfMemory */ true>
+        {
+        public:
+            using Base = SimpleSchemaAllocator<Schema, typename Schema::Descriptor, false, true>;
+            using Descriptor = typename Base::Descriptor;
+            using pointer_type = typename Base::pointer_type;
+            using size_type = typename Base::size_type;
+            using difference_type = typename Base::difference_type;
+
+            LinearAllocatorHelper(const char* name, const char* desc) : Base(name, desc)
+            {
+            }
+
+            bool Create(const Descriptor& descriptor)
+            {
+                AZ_Assert(this->IsReady() == false, "Allocator was already created!");
+                if (this->IsReady())
+                {
+                    return false;
+                }
+
+                bool isReady = static_cast<Base*>(this)->Create(descriptor);
+
+                if (isReady)
+                {
+                    isReady = static_cast<Schema*>(this->m_schema)->Create(descriptor);
+                }
+
+                return isReady;
+            }
+
+            void Destroy() override
+            {
+                static_cast<Schema*>(this->m_schema)->Destroy();
+                Base::Destroy();
+            }
+
+            AllocatorDebugConfig GetDebugConfig() override
+            {
+                return AllocatorDebugConfig().ExcludeFromDebugging();
+            }
+
+            /**
+             * Releases all the memory allocated since the last reset, on all threads. All pointers previously returned
+             * by the allocator become invalid, so this must only be called when no thread is using the allocator, e.g. at
+             * the end of a frame after all frame jobs have completed.
+             */
+            void Reset()
+            {
+                static_cast<Schema*>(this->m_schema)->Reset();
+            }
+
+            //////////////////////////////////////////////////////////////////////////
+            // IAllocatorAllocate
+            pointer_type ReAllocate(pointer_type ptr, size_type newSize, size_type newAlignment) override
+            {
+                (void)ptr;
+                (void)newSize;
+                (void)newAlignment;
+                AZ_Assert(false, "Not supported!");
+                return nullptr;
+            }
+
+            //////////////////////////////////////////////////////////////////////////
+
+            LinearAllocatorHelper& operator=(const LinearAllocatorHelper&) = delete;
+        };
+    }
+
+    template<class Allocator>
+    using ThreadLinearBase = Internal::LinearAllocatorHelper<ThreadLinearSchemaHelper<Allocator> >;
+
+    /*!
+     * Thread safe, frame scoped linear allocator for transient data (cull lists, sort keys, per frame buffers, etc.).
+     * Each thread bump allocates from its own pages without locking, deallocation is free and all memory is released
+     * at once by calling Reset at the end of the frame. If you want to create your own linear heap with a different
+     * lifetime, inherit from ThreadLinearBase, as we need unique static variable for allocator type.
+     *
+     * Usage with AZStd containers:
+     *     AZStd::vector<AZ::u64, AZ::FrameLinearStdAllocator> sortKeys;
+     */
+    class FrameLinearAllocator final
+        : public ThreadLinearBase<FrameLinearAllocator>
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(FrameLinearAllocator, SystemAllocator, 0);
+        AZ_TYPE_INFO(FrameLinearAllocator, "{6A37B8E6-1C2B-4E57-9F2B-8D1A9E0E6C31}");
+
+        using Base = ThreadLinearBase<FrameLinearAllocator>;
+
+        FrameLinearAllocator()
+            : Base("FrameLinearAllocator", "Thread safe linear allocator for transient per frame data")
+        {
+        }
+    };
+
+    using FrameLinearStdAllocator = AZStdAlloc<FrameLinearAllocator>;
+}
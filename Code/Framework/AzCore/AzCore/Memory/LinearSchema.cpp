@@ -0,0 +1,423 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Memory/LinearSchema.h>
+
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/lock.h>
+
+namespace AZ
+{
+    /**
+     * Per thread state of the linear schema, only accessed by the owning thread (and by Reset/GarbageCollect/Destroy
+     * which require all threads to be idle).
+     */
+    struct ThreadLinearData
+    {
+        AZ_CLASS_ALLOCATOR(ThreadLinearData, SystemAllocator, 0)
+
+        /// Header stored at the start of every page/block, the data follows it.
+        struct Page
+        {
+            Page* m_next;
+            size_t m_dataSize;
+
+            char* GetData() { return reinterpret_cast<char*>(this + 1); }
+        };
+
+        Page* m_firstPage = nullptr;        ///< Regular pages, they are kept between resets.
+        Page* m_currentPage = nullptr;      ///< Page we currently bump allocate from.
+        Page* m_largeBlocks = nullptr;      ///< Dedicated blocks for allocations bigger than a page, released on reset.
+        char* m_cursor = nullptr;
+        char* m_end = nullptr;
+        char* m_lastAllocation = nullptr;   ///< Most recent allocation from m_currentPage, can be freed or resized in place.
+        size_t m_numBytesAllocated = 0;
+        size_t m_capacity = 0;
+    };
+
+    class ThreadLinearSchemaImpl
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(ThreadLinearSchemaImpl, SystemAllocator, 0)
+
+        using Page = ThreadLinearData::Page;
+
+        ThreadLinearSchemaImpl(const ThreadLinearSchema::Descriptor& desc, ThreadLinearSchema::GetThreadLinearData threadLinearGetter, ThreadLinearSchema::SetThreadLinearData threadLinearSetter);
+        ~ThreadLinearSchemaImpl();
+
+        void* Allocate(size_t byteSize, size_t alignment);
+        void DeAllocate(void* ptr);
+        size_t Resize(void* ptr, size_t newSize);
+        void Reset();
+        void GarbageCollect();
+
+        ThreadLinearData* GetOrCreateThreadData();
+        void* AllocateLargeBlock(ThreadLinearData* threadData, size_t byteSize, size_t alignment);
+        Page* AllocatePage(size_t dataSize);
+        void FreePage(Page* page);
+        void FreeLargeBlocks(ThreadLinearData* threadData);
+
+        static char* AlignPointer(char* ptr, size_t alignment)
+        {
+            return reinterpret_cast<char*>(AZ::SizeAlignUp(reinterpret_cast<size_t>(ptr), alignment));
+        }
+
+        ThreadLinearSchema::GetThreadLinearData m_threadLinearGetter;
+        ThreadLinearSchema::SetThreadLinearData m_threadLinearSetter;
+
+        AZStd::vector<ThreadLinearData*> m_threads;     ///< Array with all separate thread data, used to reset all threads.
+        IAllocatorAllocate* m_pageAllocator;
+        size_t m_pageDataSize;
+        mutable AZStd::mutex m_mutex;
+    };
+}
+
+using namespace AZ;
+
+//////////////////////////////////////////////////////////////////////////
+// ThreadLinearSchema
+//////////////////////////////////////////////////////////////////////////
+
+ThreadLinearSchema::ThreadLinearSchema(GetThreadLinearData getThreadLinearData, SetThreadLinearData setThreadLinearData)
+    : m_impl(nullptr)
+    , m_threadLinearGetter(getThreadLinearData)
+    , m_threadLinearSetter(setThreadLinearData)
+{
+}
+
+ThreadLinearSchema::~ThreadLinearSchema()
+{
+    AZ_Assert(m_impl == nullptr, "You did not destroy the thread linear schema!");
+    delete m_impl;
+}
+
+bool ThreadLinearSchema::Create(const Descriptor& desc)
+{
+    AZ_Assert(m_impl == nullptr, "ThreadLinearSchema already created!");
+    if (m_impl == nullptr)
+    {
+        m_impl = aznew ThreadLinearSchemaImpl(desc, m_threadLinearGetter, m_threadLinearSetter);
+    }
+    return (m_impl != nullptr);
+}
+
+bool ThreadLinearSchema::Destroy()
+{
+    delete m_impl;
+    m_impl = nullptr;
+    return true;
+}
+
+ThreadLinearSchema::pointer_type
+ThreadLinearSchema::Allocate(size_type byteSize, size_type alignment, int flags, const char* name, const char* fileName, int lineNum, unsigned int suppressStackRecord)
+{
+    (void)flags;
+    (void)name;
+    (void)fileName;
+    (void)lineNum;
+    (void)suppressStackRecord;
+    return m_impl->Allocate(byteSize, alignment);
+}
+
+void
+ThreadLinearSchema::DeAllocate(pointer_type ptr, size_type byteSize, size_type alignment)
+{
+    (void)byteSize;
+    (void)alignment;
+    m_impl->DeAllocate(ptr);
+}
+
+ThreadLinearSchema::size_type
+ThreadLinearSchema::Resize(pointer_type ptr, size_type newSize)
+{
+    return m_impl->Resize(ptr, newSize);
+}
+
+ThreadLinearSchema::pointer_type
+ThreadLinearSchema::ReAllocate(pointer_type ptr, size_type newSize, size_type newAlignment)
+{
+    (void)ptr;
+    (void)newSize;
+    (void)newAlignment;
+    AZ_Assert(false, "unsupported");
+
+    return ptr;
+}
+
+ThreadLinearSchema::size_type
+ThreadLinearSchema::AllocationSize(pointer_type ptr)
+{
+    (void)ptr;
+    return 0; // allocation sizes are not tracked
+}
+
+void
+ThreadLinearSchema::GarbageCollect()
+{
+    m_impl->GarbageCollect();
+}
+
+ThreadLinearSchema::size_type
+ThreadLinearSchema::NumAllocatedBytes() const
+{
+    size_type bytesAllocated = 0;
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_impl->m_mutex);
+        for (const ThreadLinearData* threadData : m_impl->m_threads)
+        {
+            bytesAllocated += threadData->m_numBytesAllocated;
+        }
+    }
+    return bytesAllocated;
+}
+
+ThreadLinearSchema::size_type
+ThreadLinearSchema::Capacity() const
+{
+    size_type capacity = 0;
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_impl->m_mutex);
+        for (const ThreadLinearData* threadData : m_impl->m_threads)
+        {
+            capacity += threadData->m_capacity;
+        }
+    }
+    return capacity;
+}
+
+ThreadLinearSchema::size_type
+ThreadLinearSchema::GetMaxAllocationSize() const
+{
+    return m_impl->m_pageAllocator->GetMaxAllocationSize();
+}
+
+IAllocatorAllocate*
+ThreadLinearSchema::GetSubAllocator()
+{
+    return m_impl->m_pageAllocator;
+}
+
+void
+ThreadLinearSchema::Reset()
+{
+    m_impl->Reset();
+}
+
+//////////////////////////////////////////////////////////////////////////
+// ThreadLinearSchemaImpl
+//////////////////////////////////////////////////////////////////////////
+
+ThreadLinearSchemaImpl::ThreadLinearSchemaImpl(const ThreadLinearSchema::Descriptor& desc, ThreadLinearSchema::GetThreadLinearData threadLinearGetter, ThreadLinearSchema::SetThreadLinearData threadLinearSetter)
+    : m_threadLinearGetter(threadLinearGetter)
+    , m_threadLinearSetter(threadLinearSetter)
+    , m_pageAllocator(desc.m_pageAllocator)
+    , m_pageDataSize(desc.m_pageSize > sizeof(Page) ? desc.m_pageSize - sizeof(Page) : desc.m_pageSize)
+{
+    if (m_pageAllocator == nullptr)
+    {
+        m_pageAllocator = &AllocatorInstance<SystemAllocator>::Get();  // use the SystemAllocator if no page allocator is provided
+    }
+}
+
+ThreadLinearSchemaImpl::~ThreadLinearSchemaImpl()
+{
+    // IMPORTANT: We assume/rely that all threads (except the calling one) are done with the allocator, same as the
+    // ThreadPoolSchema.
+    AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+    for (ThreadLinearData* threadData : m_threads)
+    {
+        FreeLargeBlocks(threadData);
+        Page* page = threadData->m_firstPage;
+        while (page)
+        {
+            Page* next = page->m_next;
+            FreePage(page);
+            page = next;
+        }
+        delete threadData;
+    }
+    m_threads.clear();
+
+    /// reset the variable for the owner thread.
+    m_threadLinearSetter(nullptr);
+}
+
+void* ThreadLinearSchemaImpl::Allocate(size_t byteSize, size_t alignment)
+{
+    AZ_Assert(alignment > 0 && (alignment & (alignment - 1)) == 0, "Alignment must be >0 and power of 2!");
+    byteSize = AZ::GetMax(byteSize, size_t(1));
+
+    ThreadLinearData* threadData = GetOrCreateThreadData();
+
+    char* ptr = AlignPointer(threadData->m_cursor, alignment);
+    if (!threadData->m_cursor || ptr + byteSize > threadData->m_end)
+    {
+        if (byteSize + alignment > m_pageDataSize)
+        {
+            return AllocateLargeBlock(threadData, byteSize, alignment);
+        }
+
+        // move on to the next page, reuse the pages kept from previous frames first
+        Page* page = threadData->m_currentPage ? threadData->m_currentPage->m_next : nullptr;
+        if (!page)
+        {
+            page = AllocatePage(m_pageDataSize);
+            if (!page)
+            {
+                return nullptr;
+            }
+            threadData->m_capacity += m_pageDataSize;
+            if (threadData->m_currentPage)
+            {
+                threadData->m_currentPage->m_next = page;
+            }
+            else
+            {
+                threadData->m_firstPage = page;
+            }
+        }
+        threadData->m_currentPage = page;
+        threadData->m_cursor = page->GetData();
+        threadData->m_end = threadData->m_cursor + page->m_dataSize;
+        ptr = AlignPointer(threadData->m_cursor, alignment);
+    }
+
+    threadData->m_numBytesAllocated += (ptr + byteSize) - threadData->m_cursor;
+    threadData->m_cursor = ptr + byteSize;
+    threadData->m_lastAllocation = ptr;
+    return ptr;
+}
+
+void ThreadLinearSchemaImpl::DeAllocate(void* ptr)
+{
+    ThreadLinearData* threadData = m_threadLinearGetter();
+    if (threadData && ptr && ptr == threadData->m_lastAllocation)
+    {
+        // only the most recent allocation can be reclaimed, everything else is released by Reset
+        char* lastAllocation = threadData->m_lastAllocation;
+        threadData->m_numBytesAllocated -= threadData->m_cursor - lastAllocation;
+        threadData->m_cursor = lastAllocation;
+        threadData->m_lastAllocation = nullptr;
+    }
+}
+
+size_t ThreadLinearSchemaImpl::Resize(void* ptr, size_t newSize)
+{
+    ThreadLinearData* threadData = m_threadLinearGetter();
+    if (threadData && ptr && ptr == threadData->m_lastAllocation)
+    {
+        char* lastAllocation = threadData->m_lastAllocation;
+        if (lastAllocation + newSize <= threadData->m_end)
+        {
+            threadData->m_numBytesAllocated -= threadData->m_cursor - lastAllocation;
+            threadData->m_numBytesAllocated += newSize;
+            threadData->m_cursor = lastAllocation + newSize;
+            return newSize;
+        }
+    }
+    return 0;
+}
+
+void ThreadLinearSchemaImpl::Reset()
+{
+    AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+    for (ThreadLinearData* threadData : m_threads)
+    {
+        FreeLargeBlocks(threadData);
+        threadData->m_currentPage = threadData->m_firstPage;
+        threadData->m_cursor = threadData->m_firstPage ? threadData->m_firstPage->GetData() : nullptr;
+        threadData->m_end = threadData->m_firstPage ? threadData->m_cursor + threadData->m_firstPage->m_dataSize : nullptr;
+        threadData->m_lastAllocation = nullptr;
+        threadData->m_numBytesAllocated = 0;
+    }
+}
+
+void ThreadLinearSchemaImpl::GarbageCollect()
+{
+    AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+    for (ThreadLinearData* threadData : m_threads)
+    {
+        if (!threadData->m_currentPage)
+        {
+            continue;
+        }
+
+        // pages after the current one have not been used since the last reset
+        Page* page = threadData->m_currentPage->m_next;
+        threadData->m_currentPage->m_next = nullptr;
+        while (page)
+        {
+            Page* next = page->m_next;
+            threadData->m_capacity -= page->m_dataSize;
+            FreePage(page);
+            page = next;
+        }
+    }
+}
+
+ThreadLinearData* ThreadLinearSchemaImpl::GetOrCreateThreadData()
+{
+    ThreadLinearData* threadData = m_threadLinearGetter();
+    if (threadData == nullptr)
+    {
+        threadData = aznew ThreadLinearData();
+        m_threadLinearSetter(threadData);
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            m_threads.push_back(threadData);
+        }
+    }
+    return threadData;
+}
+
+void* ThreadLinearSchemaImpl::AllocateLargeBlock(ThreadLinearData* threadData, size_t byteSize, size_t alignment)
+{
+    Page* block = AllocatePage(byteSize + alignment);
+    if (!block)
+    {
+        return nullptr;
+    }
+    block->m_next = threadData->m_largeBlocks;
+    threadData->m_largeBlocks = block;
+    threadData->m_capacity += block->m_dataSize;
+    threadData->m_numBytesAllocated += byteSize;
+    return AlignPointer(block->GetData(), alignment);
+}
+
+ThreadLinearSchemaImpl::Page* ThreadLinearSchemaImpl::AllocatePage(size_t dataSize)
+{
+    void* memBlock = m_pageAllocator->Allocate(sizeof(Page) + dataSize, AZStd::alignment_of<Page>::value, 0, "AZSystem::ThreadLinearSchema::Page", __FILE__, __LINE__);
+    if (!memBlock)
+    {
+        return nullptr;
+    }
+    Page* page = new(memBlock) Page;
+    page->m_next = nullptr;
+    page->m_dataSize = dataSize;
+    return page;
+}
+
+void ThreadLinearSchemaImpl::FreePage(Page* page)
+{
+    const size_t blockSize = sizeof(Page) + page->m_dataSize;
+    page->~Page();
+    m_pageAllocator->DeAllocate(page, blockSize);
+}
+
+void ThreadLinearSchemaImpl::FreeLargeBlocks(ThreadLinearData* threadData)
+{
+    Page* block = threadData->m_largeBlocks;
+    while (block)
+    {
+        Page* next = block->m_next;
+        threadData->m_capacity -= block->m_dataSize;
+        FreePage(block);
+        block = next;
+    }
+    threadData->m_largeBlocks = nullptr;
+}
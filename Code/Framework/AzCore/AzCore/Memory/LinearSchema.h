@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Memory/SystemAllocator.h>
+
+namespace AZ
+{
+    struct ThreadLinearData;
+
+    /**
+     * Thread safe linear (bump) allocator schema.
+     * Every thread allocates from its own list of pages by bumping a pointer, so allocations never take a lock (except
+     * the first allocation on a new thread and when a thread needs a new page). Memory is not returned on DeAllocate,
+     * instead all threads are rewound at once by calling Reset, usually at the end of a frame.
+     * DeAllocate only reclaims memory if it's the most recent allocation of the calling thread, which allows containers
+     * to be used as stacks and Resize to grow the most recent allocation in place.
+     * IMPORTANT: Reset invalidates all memory handed out by the schema, it must only be called when none of the threads
+     * are using or allocating memory from it.
+     */
+    class ThreadLinearSchema
+        : public IAllocatorAllocate
+    {
+    public:
+        // Functions for getting an instance of a ThreadLinearData when using thread local storage
+        typedef ThreadLinearData* (* GetThreadLinearData)();
+        typedef void(* SetThreadLinearData)(ThreadLinearData*);
+
+        struct Descriptor
+        {
+            Descriptor()
+                : m_pageSize(64 * 1024)
+                , m_pageAllocator(nullptr)
+            {}
+            size_t              m_pageSize;         ///< Page size in bytes, allocations that don't fit in a page get a dedicated block until the next Reset.
+            IAllocatorAllocate* m_pageAllocator;    ///< If you provide this interface we will use it for page allocations, otherwise SystemAllocator will be used.
+        };
+
+        ThreadLinearSchema(GetThreadLinearData getThreadLinearData, SetThreadLinearData setThreadLinearData);
+        ~ThreadLinearSchema();
+
+        bool Create(const Descriptor& desc);
+        bool Destroy();
+
+        pointer_type Allocate(size_type byteSize, size_type alignment, int flags, const char* name, const char* fileName, int lineNum, unsigned int suppressStackRecord) override;
+        void DeAllocate(pointer_type ptr, size_type byteSize, size_type alignment) override;
+        size_type Resize(pointer_type ptr, size_type newSize) override;
+        pointer_type ReAllocate(pointer_type ptr, size_type newSize, size_type newAlignment) override;
+        size_type AllocationSize(pointer_type ptr) override;
+        /// Releases the pages that were not needed since the last Reset. Same restrictions as Reset.
+        void GarbageCollect() override;
+
+        size_type NumAllocatedBytes() const override;
+        size_type Capacity() const override;
+        size_type GetMaxAllocationSize() const override;
+        IAllocatorAllocate* GetSubAllocator() override;
+
+        /// Rewinds all threads to the start of their first page, see class description.
+        void Reset();
+
+    protected:
+        ThreadLinearSchema(const ThreadLinearSchema&);
+        ThreadLinearSchema& operator=(const ThreadLinearSchema&);
+
+        class ThreadLinearSchemaImpl* m_impl;
+        GetThreadLinearData m_threadLinearGetter;
+        SetThreadLinearData m_threadLinearSetter;
+    };
+
+    /**
+     * Helper class to allow multiple instances of ThreadLinearSchema that can
+     * operate independent from each other. Your thread linear allocator should inherit from that class.
+     */
+    template<class Allocator>
+    class ThreadLinearSchemaHelper
+        : public ThreadLinearSchema
+    {
+    public:
+        ThreadLinearSchemaHelper(const Descriptor& desc = Descriptor())
+            : ThreadLinearSchema(&GetThreadLinearData, &SetThreadLinearData)
+        {
+            // Descriptor is ignored here; Create() must be called directly on the schema
+            (void)desc;
+        }
+
+    protected:
+
+        static ThreadLinearData* GetThreadLinearData()
+        {
+            return m_threadData;
+        }
+
+        static void SetThreadLinearData(ThreadLinearData* data)
+        {
+            m_threadData = data;
+        }
+
+        static AZ_THREAD_LOCAL ThreadLinearData* m_threadData;
+    };
+
+    template<class Allocator>
+    AZ_THREAD_LOCAL ThreadLinearData* ThreadLinearSchemaHelper<Allocator>::m_threadData = 0;
+}
@@ -847,6 +847,11 @@ namespace AZ
         {
             return AZ::AllocatorInstance<Parent>::Get().GetSubAllocator();
         }
+
+        bool IsChildAllocator() const override
+        {
+            return true;
+        }
     };
 
     /**
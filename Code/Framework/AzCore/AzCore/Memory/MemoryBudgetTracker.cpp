@@ -0,0 +1,306 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Memory/MemoryBudgetTracker.h>
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Memory/AllocationRecords.h>
+#include <AzCore/Memory/AllocatorManager.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/StringFunc/StringFunc.h>
+
+namespace AZ
+{
+    namespace MemoryBudgetTrackerInternal
+    {
+        static constexpr size_t BytesPerMegabyte = 1024 * 1024;
+
+        template<MemoryBudgetCategory Category>
+        static void OnBudgetChanged(const AZ::u32& budgetMegabytes)
+        {
+            if (auto* tracker = AZ::Interface<MemoryBudgetTracker>::Get())
+            {
+                tracker->SetBudget(Category, budgetMegabytes * BytesPerMegabyte);
+            }
+        }
+    } // namespace MemoryBudgetTrackerInternal
+
+    AZ_CVAR(float, mem_budgetUpdateInterval, 1.0f, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Seconds between two updates of the memory budgets, 0 disables the updates");
+    AZ_CVAR(AZ::u32, mem_budgetRenderingMB, 0, &MemoryBudgetTrackerInternal::OnBudgetChanged<MemoryBudgetCategory::Rendering>,
+        AZ::ConsoleFunctorFlags::Null, "Memory budget of the rendering in megabytes, including the RHI pools, 0 for no budget");
+    AZ_CVAR(AZ::u32, mem_budgetAnimationMB, 0, &MemoryBudgetTrackerInternal::OnBudgetChanged<MemoryBudgetCategory::Animation>,
+        AZ::ConsoleFunctorFlags::Null, "Memory budget of the animation in megabytes, 0 for no budget");
+    AZ_CVAR(AZ::u32, mem_budgetPhysicsMB, 0, &MemoryBudgetTrackerInternal::OnBudgetChanged<MemoryBudgetCategory::Physics>,
+        AZ::ConsoleFunctorFlags::Null, "Memory budget of the physics in megabytes, 0 for no budget");
+    AZ_CVAR(AZ::u32, mem_budgetAudioMB, 0, &MemoryBudgetTrackerInternal::OnBudgetChanged<MemoryBudgetCategory::Audio>,
+        AZ::ConsoleFunctorFlags::Null, "Memory budget of the audio in megabytes, 0 for no budget");
+    AZ_CVAR(AZ::u32, mem_budgetScriptMB, 0, &MemoryBudgetTrackerInternal::OnBudgetChanged<MemoryBudgetCategory::Script>,
+        AZ::ConsoleFunctorFlags::Null, "Memory budget of the scripts in megabytes, 0 for no budget");
+    AZ_CVAR(AZ::u32, mem_budgetAssetsMB, 0, &MemoryBudgetTrackerInternal::OnBudgetChanged<MemoryBudgetCategory::Assets>,
+        AZ::ConsoleFunctorFlags::Null, "Memory budget of the assets in megabytes, 0 for no budget");
+
+    static void mem_budgets([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
+    {
+        if (auto* tracker = AZ::Interface<MemoryBudgetTracker>::Get())
+        {
+            tracker->Update();
+            tracker->PrintUsage();
+        }
+    }
+    AZ_CONSOLEFREEFUNC(mem_budgets, AZ::ConsoleFunctorFlags::Null, "Prints the memory used by each subsystem and its budget");
+
+    const char* ToString(MemoryBudgetCategory category)
+    {
+        switch (category)
+        {
+        case MemoryBudgetCategory::Rendering:
+            return "Rendering";
+        case MemoryBudgetCategory::Animation:
+            return "Animation";
+        case MemoryBudgetCategory::Physics:
+            return "Physics";
+        case MemoryBudgetCategory::Audio:
+            return "Audio";
+        case MemoryBudgetCategory::Script:
+            return "Script";
+        case MemoryBudgetCategory::Assets:
+            return "Assets";
+        case MemoryBudgetCategory::Other:
+            return "Other";
+        default:
+            return "Unknown";
+        }
+    }
+
+    MemoryBudgetTracker::MemoryBudgetTracker()
+    {
+        using MemoryBudgetTrackerInternal::BytesPerMegabyte;
+
+        for (AZStd::string_view pattern : { "Atom", "RHI", "RPI", "Render", "Shader" })
+        {
+            AddAllocatorPattern(MemoryBudgetCategory::Rendering, pattern);
+        }
+        for (AZStd::string_view pattern : { "EMotion", "Anim", "Simulated Object" })
+        {
+            AddAllocatorPattern(MemoryBudgetCategory::Animation, pattern);
+        }
+        for (AZStd::string_view pattern : { "PhysX", "NvCloth", "Blast", "Physics" })
+        {
+            AddAllocatorPattern(MemoryBudgetCategory::Physics, pattern);
+        }
+        for (AZStd::string_view pattern : { "Audio", "Wwise" })
+        {
+            AddAllocatorPattern(MemoryBudgetCategory::Audio, pattern);
+        }
+        for (AZStd::string_view pattern : { "Script", "Lua" })
+        {
+            AddAllocatorPattern(MemoryBudgetCategory::Script, pattern);
+        }
+        for (AZStd::string_view pattern : { "Asset", "Streamer" })
+        {
+            AddAllocatorPattern(MemoryBudgetCategory::Assets, pattern);
+        }
+
+        SetBudget(MemoryBudgetCategory::Rendering, static_cast<AZ::u32>(mem_budgetRenderingMB) * BytesPerMegabyte);
+        SetBudget(MemoryBudgetCategory::Animation, static_cast<AZ::u32>(mem_budgetAnimationMB) * BytesPerMegabyte);
+        SetBudget(MemoryBudgetCategory::Physics, static_cast<AZ::u32>(mem_budgetPhysicsMB) * BytesPerMegabyte);
+        SetBudget(MemoryBudgetCategory::Audio, static_cast<AZ::u32>(mem_budgetAudioMB) * BytesPerMegabyte);
+        SetBudget(MemoryBudgetCategory::Script, static_cast<AZ::u32>(mem_budgetScriptMB) * BytesPerMegabyte);
+        SetBudget(MemoryBudgetCategory::Assets, static_cast<AZ::u32>(mem_budgetAssetsMB) * BytesPerMegabyte);
+
+        if (AZ::Interface<MemoryBudgetTracker>::Get() == nullptr)
+        {
+            AZ::Interface<MemoryBudgetTracker>::Register(this);
+            m_isRegistered = true;
+        }
+    }
+
+    MemoryBudgetTracker::~MemoryBudgetTracker()
+    {
+        if (m_isRegistered)
+        {
+            AZ::Interface<MemoryBudgetTracker>::Unregister(this);
+        }
+    }
+
+    void MemoryBudgetTracker::SetBudget(MemoryBudgetCategory category, size_t budgetBytes)
+    {
+        m_usage[static_cast<size_t>(category)].m_budgetBytes = budgetBytes;
+    }
+
+    void MemoryBudgetTracker::AddAllocatorPattern(MemoryBudgetCategory category, AZStd::string_view pattern)
+    {
+        m_allocatorPatterns[static_cast<size_t>(category)].emplace_back(pattern);
+    }
+
+    MemoryBudgetCategory MemoryBudgetTracker::GetAllocatorCategory(AZStd::string_view allocatorName) const
+    {
+        for (size_t categoryIndex = 0; categoryIndex < CategoryCount; ++categoryIndex)
+        {
+            for (const AZStd::string& pattern : m_allocatorPatterns[categoryIndex])
+            {
+                if (AZ::StringFunc::Contains(allocatorName, pattern))
+                {
+                    return static_cast<MemoryBudgetCategory>(categoryIndex);
+                }
+            }
+        }
+        return MemoryBudgetCategory::Other;
+    }
+
+    void MemoryBudgetTracker::AddUsageProvider(MemoryBudgetCategory category, AZStd::string_view name, UsageProvider provider)
+    {
+        RemoveUsageProvider(name);
+        m_usageProviders.push_back({ AZStd::string(name), category, AZStd::move(provider) });
+    }
+
+    void MemoryBudgetTracker::RemoveUsageProvider(AZStd::string_view name)
+    {
+        AZStd::erase_if(m_usageProviders, [name](const NamedUsageProvider& usageProvider) { return usageProvider.m_name == name; });
+    }
+
+    void MemoryBudgetTracker::Update()
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzCore);
+
+        AllocatorManager& allocatorManager = AllocatorManager::Instance();
+        auto lock = allocatorManager.LockAllocators();
+
+        // Allocators overridden with the same source share its bytes, only the first one gets them
+        AZStd::unordered_set<IAllocatorAllocate*> countedSources;
+        AZStd::vector<AllocatorUsage> allocators;
+        allocators.reserve(allocatorManager.GetNumAllocators());
+        for (int allocatorIndex = 0; allocatorIndex < allocatorManager.GetNumAllocators(); ++allocatorIndex)
+        {
+            IAllocator* allocator = allocatorManager.GetAllocator(allocatorIndex);
+            IAllocatorAllocate* schema = allocator->GetSchema();
+            if (schema && schema->IsChildAllocator())
+            {
+                // The schema reports the bytes of the parent, the records are the only source of the child's own usage
+                Debug::AllocationRecords* records = allocator->GetRecords();
+                allocators.push_back({ allocator->GetName(), records ? records->RequestedBytes() : 0, true });
+            }
+            else if (countedSources.insert(allocator->GetAllocationSource()).second)
+            {
+                allocators.push_back({ allocator->GetName(), allocator->GetAllocationSource()->NumAllocatedBytes(), false });
+            }
+        }
+
+        Update(allocators);
+    }
+
+    void MemoryBudgetTracker::Update(const AZStd::vector<AllocatorUsage>& allocators)
+    {
+        for (CategoryUsage& usage : m_usage)
+        {
+            usage.m_allocatorBytes = 0;
+            usage.m_providedBytes = 0;
+        }
+
+        // Child allocator bytes are part of their parent's, they are moved out of the parent's category into their own
+        // by attributing to Other whatever is left of the total once the other categories are counted
+        size_t totalBytes = 0;
+        size_t categorizedBytes = 0;
+        for (const AllocatorUsage& allocator : allocators)
+        {
+            if (!allocator.m_isChild)
+            {
+                totalBytes += allocator.m_allocatedBytes;
+            }
+
+            const MemoryBudgetCategory category = GetAllocatorCategory(allocator.m_name);
+            if (category != MemoryBudgetCategory::Other)
+            {
+                m_usage[static_cast<size_t>(category)].m_allocatorBytes += allocator.m_allocatedBytes;
+                categorizedBytes += allocator.m_allocatedBytes;
+            }
+        }
+        m_usage[static_cast<size_t>(MemoryBudgetCategory::Other)].m_allocatorBytes =
+            totalBytes > categorizedBytes ? totalBytes - categorizedBytes : 0;
+
+        for (const NamedUsageProvider& usageProvider : m_usageProviders)
+        {
+            m_usage[static_cast<size_t>(usageProvider.m_category)].m_providedBytes += usageProvider.m_provider();
+        }
+
+        for (size_t categoryIndex = 0; categoryIndex < CategoryCount; ++categoryIndex)
+        {
+            const CategoryUsage& usage = m_usage[categoryIndex];
+            const bool isOverBudget = usage.IsOverBudget();
+            if (isOverBudget && !m_isOverBudget[categoryIndex])
+            {
+                const MemoryBudgetCategory category = static_cast<MemoryBudgetCategory>(categoryIndex);
+                AZ_Warning("MemoryBudget", false, "%s is over its memory budget: %zu bytes used for a budget of %zu bytes.",
+                    ToString(category), usage.GetUsedBytes(), usage.m_budgetBytes);
+                m_overBudgetEvent.Signal(category, usage);
+            }
+            m_isOverBudget[categoryIndex] = isOverBudget;
+        }
+    }
+
+    void MemoryBudgetTracker::OnTick(float deltaTime)
+    {
+        if (mem_budgetUpdateInterval <= 0.0f)
+        {
+            return;
+        }
+
+        m_timeSinceUpdate += deltaTime;
+        if (m_timeSinceUpdate >= mem_budgetUpdateInterval)
+        {
+            m_timeSinceUpdate = 0.0f;
+            Update();
+        }
+    }
+
+    const MemoryBudgetTracker::CategoryUsage& MemoryBudgetTracker::GetUsage(MemoryBudgetCategory category) const
+    {
+        return m_usage[static_cast<size_t>(category)];
+    }
+
+    size_t MemoryBudgetTracker::GetTotalUsedBytes() const
+    {
+        size_t totalBytes = 0;
+        for (const CategoryUsage& usage : m_usage)
+        {
+            totalBytes += usage.GetUsedBytes();
+        }
+        return totalBytes;
+    }
+
+    void MemoryBudgetTracker::PrintUsage() const
+    {
+        using MemoryBudgetTrackerInternal::BytesPerMegabyte;
+
+        AZ_TracePrintf("MemoryBudget", "%-10s %12s %12s %12s\n", "Category", "Used (MB)", "Budget (MB)", "Headroom (MB)");
+        for (size_t categoryIndex = 0; categoryIndex < CategoryCount; ++categoryIndex)
+        {
+            const CategoryUsage& usage = m_usage[categoryIndex];
+            const double usedMegabytes = static_cast<double>(usage.GetUsedBytes()) / BytesPerMegabyte;
+            if (usage.m_budgetBytes > 0)
+            {
+                const double budgetMegabytes = static_cast<double>(usage.m_budgetBytes) / BytesPerMegabyte;
+                AZ_TracePrintf("MemoryBudget", "%-10s %12.2f %12.2f %12.2f%s\n", ToString(static_cast<MemoryBudgetCategory>(categoryIndex)),
+                    usedMegabytes, budgetMegabytes, budgetMegabytes - usedMegabytes, usage.IsOverBudget() ? " OVER BUDGET" : "");
+            }
+            else
+            {
+                AZ_TracePrintf("MemoryBudget", "%-10s %12.2f %12s %12s\n", ToString(static_cast<MemoryBudgetCategory>(categoryIndex)),
+                    usedMegabytes, "-", "-");
+            }
+        }
+        AZ_TracePrintf("MemoryBudget", "%-10s %12.2f\n", "Total", static_cast<double>(GetTotalUsedBytes()) / BytesPerMegabyte);
+    }
+
+    void MemoryBudgetTracker::ConnectOverBudgetHandler(OverBudgetEvent::Handler& handler)
+    {
+        handler.Connect(m_overBudgetEvent);
+    }
+} // namespace AZ
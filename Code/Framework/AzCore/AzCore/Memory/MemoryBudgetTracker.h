@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/EBus/Event.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/RTTI/TypeInfo.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/string/string.h>
+#include <AzCore/std/string/string_view.h>
+
+namespace AZ
+{
+    //! Subsystems memory budgets are tracked for.
+    enum class MemoryBudgetCategory : AZ::u32
+    {
+        Rendering,
+        Animation,
+        Physics,
+        Audio,
+        Script,
+        Assets,
+        //! Memory of the allocators that don't belong to any other category.
+        Other,
+        Count
+    };
+
+    const char* ToString(MemoryBudgetCategory category);
+
+    //! Aggregates the memory used by each subsystem and compares it against configurable budgets.
+    //! The usage of a category is the sum of the allocators whose name matches one of its patterns and of the
+    //! usage providers registered for it by systems that don't allocate through the AllocatorManager, like the RHI pools.
+    //! Child allocators forward their allocations to their parent, so their usage is only known when allocation
+    //! records are enabled. It is otherwise left in the category of the parent allocator.
+    //! The ComponentApplication owns the tracker, registers it with AZ::Interface and updates it every
+    //! mem_budgetUpdateInterval seconds. The tracker is not thread safe and must be used on the main thread.
+    class MemoryBudgetTracker
+    {
+    public:
+        AZ_TYPE_INFO(MemoryBudgetTracker, "{5B0D1C3E-8F47-4E2A-A6C9-3D1B7E4F2A58}");
+        AZ_CLASS_ALLOCATOR(MemoryBudgetTracker, AZ::SystemAllocator, 0);
+
+        struct CategoryUsage
+        {
+            size_t GetUsedBytes() const { return m_allocatorBytes + m_providedBytes; }
+            bool IsOverBudget() const { return m_budgetBytes > 0 && GetUsedBytes() > m_budgetBytes; }
+
+            //! Bytes allocated through the allocators of the category.
+            size_t m_allocatorBytes = 0;
+            //! Bytes reported by the usage providers of the category.
+            size_t m_providedBytes = 0;
+            //! Budget of the category, 0 if it has none.
+            size_t m_budgetBytes = 0;
+        };
+
+        //! Usage of one allocator, as gathered from the AllocatorManager.
+        struct AllocatorUsage
+        {
+            AZStd::string_view m_name;
+            size_t m_allocatedBytes = 0;
+            //! Child allocator bytes are also counted by their parent allocator.
+            bool m_isChild = false;
+        };
+
+        //! Returns the number of bytes used by a system outside of the AllocatorManager.
+        using UsageProvider = AZStd::function<size_t()>;
+
+        //! Signaled by Update when a category goes over its budget.
+        using OverBudgetEvent = AZ::Event<MemoryBudgetCategory, const CategoryUsage&>;
+
+        //! Registers the tracker with AZ::Interface if no other tracker is registered, and reads the budgets from the mem_budget* cvars.
+        MemoryBudgetTracker();
+        ~MemoryBudgetTracker();
+
+        //! Sets the budget of a category, 0 removes it.
+        void SetBudget(MemoryBudgetCategory category, size_t budgetBytes);
+
+        //! Adds a case insensitive pattern matched against the allocator names to assign them to a category.
+        void AddAllocatorPattern(MemoryBudgetCategory category, AZStd::string_view pattern);
+
+        //! Returns the category of an allocator, Other if none of the patterns match its name.
+        MemoryBudgetCategory GetAllocatorCategory(AZStd::string_view allocatorName) const;
+
+        //! Adds a provider whose usage is added to the category, replacing the one with the same name.
+        void AddUsageProvider(MemoryBudgetCategory category, AZStd::string_view name, UsageProvider provider);
+        void RemoveUsageProvider(AZStd::string_view name);
+
+        //! Gathers the usage of the allocators registered with the AllocatorManager and of the usage providers.
+        void Update();
+
+        //! Computes the usage of each category from the provided allocators and the usage providers.
+        void Update(const AZStd::vector<AllocatorUsage>& allocators);
+
+        //! Calls Update once mem_budgetUpdateInterval seconds have elapsed since the previous update.
+        void OnTick(float deltaTime);
+
+        const CategoryUsage& GetUsage(MemoryBudgetCategory category) const;
+
+        //! Returns the total number of bytes used by the tracked allocators and usage providers.
+        size_t GetTotalUsedBytes() const;
+
+        //! Prints the usage and budget of each category.
+        void PrintUsage() const;
+
+        void ConnectOverBudgetHandler(OverBudgetEvent::Handler& handler);
+
+    private:
+        struct NamedUsageProvider
+        {
+            AZStd::string m_name;
+            MemoryBudgetCategory m_category;
+            UsageProvider m_provider;
+        };
+
+        static constexpr size_t CategoryCount = static_cast<size_t>(MemoryBudgetCategory::Count);
+
+        AZStd::array<CategoryUsage, CategoryCount> m_usage;
+        AZStd::array<AZStd::vector<AZStd::string>, CategoryCount> m_allocatorPatterns;
+        AZStd::vector<NamedUsageProvider> m_usageProviders;
+        AZStd::array<bool, CategoryCount> m_isOverBudget = {};
+        OverBudgetEvent m_overBudgetEvent;
+        float m_timeSinceUpdate = 0.0f;
+        bool m_isRegistered = false;
+    };
+} // namespace AZ
@@ -129,6 +129,10 @@ namespace AZ
             {
                 m_output->Write(AZ_CRC("RecordsMode", 0x764c147a), (char)records->GetMode());
                 m_output->Write(AZ_CRC("NumStackLevels", 0xad9cff15), records->GetNumStackLevels());
+                if (records->GetMode() == AllocationRecords::RECORD_SAMPLED)
+                {
+                    m_output->Write(AZ_CRC_CE("SamplingInterval"), records->GetSamplingInterval());
+                }
             }
             m_output->EndTag(AZ_CRC("RegisterAllocator", 0x19f08114));
             m_output->EndTag(AZ_CRC("MemoryDriller", 0x1b31269d));
@@ -246,6 +250,11 @@ namespace AZ
         {
             AllocationInfo info;
             UnregisterAllocation(allocator, prevAddress, 0, 0, &info);
+            auto records = allocator->GetRecords();
+            if (records && !records->ShouldRecordAllocation(newByteSize))
+            {
+                return; // the new allocation was not sampled
+            }
             RegisterAllocation(allocator, newAddress, newByteSize, newAlignment, info.m_name, info.m_fileName, info.m_lineNum, 0);
         }
 
@@ -289,5 +298,61 @@ namespace AZ
             }
         }
 
+        //=========================================================================
+        // DumpAllocationSites
+        //=========================================================================
+        void MemoryDriller::DumpAllocationSites(IO::GenericStream* stream)
+        {
+            // Create a copy so allocations done during the output dont end up affecting the container
+            const AZStd::list<Debug::AllocationRecords*, OSStdAllocator> allocationRecords = m_allAllocatorRecords;
+
+            for (auto records : allocationRecords)
+            {
+                if (records->GetMap().empty())
+                {
+                    continue;
+                }
+
+                if (stream)
+                {
+                    char line[256];
+                    const int length = azsnprintf(line, AZ_ARRAY_SIZE(line), "Allocator: %s\n", records->GetAllocatorName());
+                    stream->Write(AZStd::GetMin(static_cast<size_t>(AZStd::GetMax(length, 0)), sizeof(line) - 1), line);
+                    records->EnumerateAllocationSites(AZ::Debug::WriteAllocationSitesCB(*stream));
+                }
+                else if (m_output)
+                {
+                    m_output->BeginTag(AZ_CRC("MemoryDriller", 0x1b31269d));
+                    m_output->BeginTag(AZ_CRC_CE("AllocationSites"));
+                    m_output->Write(AZ_CRC("RecordsId", 0x7caaca88), records);
+                    records->EnumerateAllocationSites([this](const AllocationSiteInfo& site, unsigned char numStackLevels)
+                    {
+                        const AllocationInfo& info = *site.m_allocation;
+                        m_output->BeginTag(AZ_CRC_CE("Site"));
+                        m_output->Write(AZ_CRC_CE("EstimatedBytes"), site.m_estimatedBytes);
+                        m_output->Write(AZ_CRC_CE("EstimatedCount"), site.m_estimatedCount);
+                        m_output->Write(AZ_CRC_CE("NumRecords"), site.m_numRecords);
+                        if (info.m_name)
+                        {
+                            m_output->Write(AZ_CRC("Name", 0x5e237e06), info.m_name);
+                        }
+                        if (info.m_fileName)
+                        {
+                            m_output->Write(AZ_CRC("FileName", 0x3c0be965), info.m_fileName);
+                            m_output->Write(AZ_CRC("FileLine", 0xb33c2395), info.m_lineNum);
+                        }
+                        if (info.m_stackFrames)
+                        {
+                            m_output->Write(AZ_CRC("Stack", 0x41a87b6a), info.m_stackFrames, info.m_stackFrames + numStackLevels);
+                        }
+                        m_output->EndTag(AZ_CRC_CE("Site"));
+                        return true;
+                    });
+                    m_output->EndTag(AZ_CRC_CE("AllocationSites"));
+                    m_output->EndTag(AZ_CRC("MemoryDriller", 0x1b31269d));
+                }
+            }
+        }
+
     }// namespace Debug
 } // namespace AZ
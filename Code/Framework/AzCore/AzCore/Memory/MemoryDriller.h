@@ -55,6 +55,7 @@ namespace AZ
             virtual void ResizeAllocation(IAllocator* allocator, void* address, size_t newSize);
 
             virtual void DumpAllAllocations();
+            virtual void DumpAllocationSites(IO::GenericStream* stream);
             //////////////////////////////////////////////////////////////////////////
 
             void RegisterAllocatorOutput(IAllocator* allocator);
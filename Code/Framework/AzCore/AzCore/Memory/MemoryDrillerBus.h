@@ -12,6 +12,10 @@
 namespace AZ
 {
     class IAllocator;
+    namespace IO
+    {
+        class GenericStream;
+    }
     namespace Debug
     {
         //class AllocationRecords;
@@ -41,6 +45,12 @@ namespace AZ
             virtual void ResizeAllocation(IAllocator* allocator, void* address, size_t newSize) = 0;
 
             virtual void DumpAllAllocations() = 0;
+
+            /**
+             * Reports the recorded allocations of all allocators aggregated by allocation site, see AllocationRecords::EnumerateAllocationSites.
+             * The sites are written as text to the stream if one is provided, otherwise they are sent to the driller output.
+             */
+            virtual void DumpAllocationSites(IO::GenericStream* stream) = 0;
         };
 
         typedef AZ::EBus<MemoryDrillerMessages> MemoryDrillerBus;
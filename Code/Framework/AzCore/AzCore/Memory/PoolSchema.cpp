@@ -300,6 +300,8 @@ namespace AZ
         size_t                      m_pageSize;
         size_t                      m_minAllocationSize;
         size_t                      m_maxAllocationSize;
+        unsigned int                m_threadPageCacheSize;
+        unsigned int                m_crossThreadFreeBatchSize;
         bool                        m_isDynamic;
         // TODO rbbaklov Changed to recursive_mutex from mutex for Linux support.
         AZStd::recursive_mutex      m_mutex;
@@ -319,8 +321,36 @@ namespace AZ
         */
         typedef AZStd::lock_free_intrusive_stack<ThreadPoolSchemaImpl::Page::FakeNodeLF, AZStd::lock_free_intrusive_stack_base_hook<ThreadPoolSchemaImpl::Page::FakeNodeLF> > FreedElementsStack;
 
+        /**
+        * Elements freed by this thread which belong to another thread. They are linked together and pushed on the owner's
+        * m_freedElements at once, so the owner's stack is not hammered when a thread frees many elements of another thread.
+        */
+        struct RemoteFreeBatch
+        {
+            ThreadPoolData*                         m_owner = nullptr;
+            ThreadPoolSchemaImpl::Page::FakeNodeLF* m_first = nullptr;
+            ThreadPoolSchemaImpl::Page::FakeNodeLF* m_last = nullptr;
+            unsigned int                            m_numElements = 0;
+        };
+        static const unsigned int MaxRemoteFreeBatches = 4;
+
+        /// Processes the elements freed by other threads, must be called from the owning thread.
+        void DeAllocateFreedElements();
+        /// Batches an element owned by another thread, see RemoteFreeBatch.
+        void QueueRemoteFree(ThreadPoolData* owner, ThreadPoolSchemaImpl::Page::FakeNodeLF* element, unsigned int batchSize);
+        void FlushRemoteFrees();
+        void FlushRemoteFreeBatch(RemoteFreeBatch& batch);
+        /// Returns all the pages in the thread page cache to the allocator's shared free list.
+        void ReleaseCachedPages();
+
+        // IMPORTANT: the page cache must be declared before the allocator, on destruction the allocator returns its pages to the schema.
+        ThreadPoolSchemaImpl::FreePagesType m_cachedPages;                         ///< Free pages only this thread can use, see Descriptor::m_threadPageCacheSize.
+        unsigned int            m_numCachedPages;
+        unsigned int            m_maxCachedPages;
         AllocatorType           m_allocator;
         FreedElementsStack      m_freedElements;
+        RemoteFreeBatch         m_remoteFreeBatches[MaxRemoteFreeBatches];
+        unsigned int            m_nextRemoteFreeBatch;
     };
 }
 
@@ -1103,6 +1133,8 @@ ThreadPoolSchemaImpl::ThreadPoolSchemaImpl(const ThreadPoolSchema::Descriptor& d
     , m_pageSize(desc.m_pageSize)
     , m_minAllocationSize(desc.m_minAllocationSize)
     , m_maxAllocationSize(desc.m_maxAllocationSize)
+    , m_threadPageCacheSize(desc.m_threadPageCacheSize)
+    , m_crossThreadFreeBatchSize(desc.m_crossThreadFreeBatchSize)
     , m_isDynamic(desc.m_isDynamic)
 {
 #   if AZ_TRAIT_OS_HAS_CRITICAL_SECTION_SPIN_COUNT
@@ -1123,7 +1155,8 @@ ThreadPoolSchemaImpl::ThreadPoolSchemaImpl(const ThreadPoolSchema::Descriptor& d
         size_t pageDataSize = m_pageSize - sizeof(Page);
         for (unsigned int i = 0; i < m_numStaticPages; ++i)
         {
-            Page* page = new(memBlock+pageDataSize)Page(m_threadPoolGetter());
+            // static pages are owned by the thread which pops them from the free list
+            Page* page = new(memBlock+pageDataSize)Page(nullptr);
             page->m_bin = 0xffffffff;
             PushFreePage(page);
             memBlock += m_pageSize;
@@ -1145,6 +1178,18 @@ ThreadPoolSchemaImpl::~ThreadPoolSchemaImpl()
         AZStd::lock_guard<AZStd::recursive_mutex> lock(m_mutex);
         if (!m_threads.empty())
         {
+            // All pages are force freed below, drop the pending batches so no thread data pushes to an owner that was already deleted.
+            for (size_t i = 0; i < m_threads.size(); ++i)
+            {
+                if (m_threads[i])
+                {
+                    for (ThreadPoolData::RemoteFreeBatch& batch : m_threads[i]->m_remoteFreeBatches)
+                    {
+                        batch = ThreadPoolData::RemoteFreeBatch();
+                    }
+                }
+            }
+
             for (size_t i = 0; i < m_threads.size(); ++i)
             {
                 if (m_threads[i])
@@ -1209,11 +1254,7 @@ ThreadPoolSchemaImpl::Allocate(ThreadPoolSchema::size_type byteSize, ThreadPoolS
     else
     {
         // deallocate elements if they were freed from other threads
-        Page::FakeNodeLF* fakeLFNode;
-        while ((fakeLFNode = threadData->m_freedElements.pop())!=0)
-        {
-            threadData->m_allocator.DeAllocate(fakeLFNode);
-        }
+        threadData->DeAllocateFreedElements();
     }
 
     return threadData->m_allocator.Allocate(byteSize, alignment);
@@ -1249,7 +1290,14 @@ ThreadPoolSchemaImpl::DeAllocate(ThreadPoolSchema::pointer_type ptr)
         // otherwise we will assert the node is in the list
         fakeLFNode->m_next = 0;
 #endif
-        page->m_threadData->m_freedElements.push(*fakeLFNode);
+        if (threadData && m_crossThreadFreeBatchSize > 1)
+        {
+            threadData->QueueRemoteFree(page->m_threadData, fakeLFNode, m_crossThreadFreeBatchSize);
+        }
+        else
+        {
+            page->m_threadData->m_freedElements.push(*fakeLFNode);
+        }
     }
 }
 
@@ -1276,7 +1324,16 @@ ThreadPoolSchemaImpl::AllocationSize(ThreadPoolSchema::pointer_type ptr)
 AZ_INLINE ThreadPoolSchemaImpl::Page*
 ThreadPoolSchemaImpl::PopFreePage()
 {
+    ThreadPoolData* threadData = m_threadPoolGetter();
     Page* page;
+    if (threadData && !threadData->m_cachedPages.empty())
+    {
+        // the page cache is only used by the owning thread, no need to lock
+        page = &threadData->m_cachedPages.front();
+        threadData->m_cachedPages.pop_front();
+        --threadData->m_numCachedPages;
+    }
+    else
     {
         AZStd::lock_guard<AZStd::recursive_mutex> lock(m_mutex);
         if (m_freePages.empty())
@@ -1295,7 +1352,7 @@ ThreadPoolSchemaImpl::PopFreePage()
         AZ_Assert(page->m_threadData == 0, "If we stored the free page properly we should have null here!");
 #   endif
         // store the current thread data, used when we free elements
-        page->m_threadData = m_threadPoolGetter();
+        page->m_threadData = threadData;
     }
     return page;
 }
@@ -1307,9 +1364,17 @@ ThreadPoolSchemaImpl::PopFreePage()
 AZ_INLINE void
 ThreadPoolSchemaImpl::PushFreePage(Page* page)
 {
+    // pages are only returned by the pool of the thread that owns them
+    ThreadPoolData* threadData = page->m_threadData;
 #ifdef AZ_DEBUG_BUILD
     page->m_threadData = 0;
 #endif
+    if (threadData && threadData->m_numCachedPages < threadData->m_maxCachedPages)
+    {
+        threadData->m_cachedPages.push_front(*page);
+        ++threadData->m_numCachedPages;
+    }
+    else
     {
         AZStd::lock_guard<AZStd::recursive_mutex> lock(m_mutex);
         m_freePages.push_front(*page);
@@ -1328,6 +1393,13 @@ ThreadPoolSchemaImpl::GarbageCollect()
         return;                // we have the memory statically allocated, can't collect garbage.
     }
 
+    // hand back what the calling thread is holding on to, so it can be collected too
+    if (ThreadPoolData* threadData = m_threadPoolGetter())
+    {
+        threadData->FlushRemoteFrees();
+        threadData->ReleaseCachedPages();
+    }
+
     FreePagesType staticPages;
     AZStd::lock_guard<AZStd::recursive_mutex> lock(m_mutex);
     while (!m_freePages.empty())
@@ -1375,7 +1447,10 @@ ThreadPoolSchemaImpl::Page::SetupFreeList(size_t elementSize, size_t pageDataBlo
 // [9/15/2009]
 //=========================================================================
 ThreadPoolData::ThreadPoolData(ThreadPoolSchemaImpl* alloc, size_t pageSize, size_t minAllocationSize, size_t maxAllocationSize)
-    : m_allocator(alloc, pageSize, minAllocationSize, maxAllocationSize)
+    : m_numCachedPages(0)
+    , m_maxCachedPages(alloc->m_threadPageCacheSize)
+    , m_allocator(alloc, pageSize, minAllocationSize, maxAllocationSize)
+    , m_nextRemoteFreeBatch(0)
 {}
 
 //=========================================================================
@@ -1384,10 +1459,115 @@ ThreadPoolData::ThreadPoolData(ThreadPoolSchemaImpl* alloc, size_t pageSize, siz
 //=========================================================================
 ThreadPoolData::~ThreadPoolData()
 {
+    FlushRemoteFrees();
+
     // deallocate elements if they were freed from other threads
-    ThreadPoolSchemaImpl::Page::FakeNodeLF* fakeLFNode;
-    while ((fakeLFNode = m_freedElements.pop())!=0)
+    DeAllocateFreedElements();
+
+    // from now on all pages go back to the shared free list
+    m_maxCachedPages = 0;
+    ReleaseCachedPages();
+}
+
+//=========================================================================
+// ThreadPoolData::DeAllocateFreedElements
+//=========================================================================
+void
+ThreadPoolData::DeAllocateFreedElements()
+{
+    // take the whole stack at once, we are the only thread popping from it
+    ThreadPoolSchemaImpl::Page::FakeNodeLF* fakeLFNode = m_freedElements.pop_all();
+    while (fakeLFNode)
     {
+        ThreadPoolSchemaImpl::Page::FakeNodeLF* next = fakeLFNode->m_next;
+#ifdef AZ_DEBUG_BUILD
+        fakeLFNode->m_next = 0;
+#endif
         m_allocator.DeAllocate(fakeLFNode);
+        fakeLFNode = next;
+    }
+}
+
+//=========================================================================
+// ThreadPoolData::QueueRemoteFree
+//=========================================================================
+void
+ThreadPoolData::QueueRemoteFree(ThreadPoolData* owner, ThreadPoolSchemaImpl::Page::FakeNodeLF* element, unsigned int batchSize)
+{
+    RemoteFreeBatch* batch = nullptr;
+    for (RemoteFreeBatch& remoteFreeBatch : m_remoteFreeBatches)
+    {
+        if (remoteFreeBatch.m_owner == owner)
+        {
+            batch = &remoteFreeBatch;
+            break;
+        }
+    }
+    if (!batch)
+    {
+        // evict the oldest batch
+        batch = &m_remoteFreeBatches[m_nextRemoteFreeBatch];
+        m_nextRemoteFreeBatch = (m_nextRemoteFreeBatch + 1) % MaxRemoteFreeBatches;
+        FlushRemoteFreeBatch(*batch);
+        batch->m_owner = owner;
+    }
+
+    element->m_next = batch->m_first;
+    if (!batch->m_first)
+    {
+        batch->m_last = element;
+    }
+    batch->m_first = element;
+    if (++batch->m_numElements >= batchSize)
+    {
+        FlushRemoteFreeBatch(*batch);
+    }
+}
+
+//=========================================================================
+// ThreadPoolData::FlushRemoteFrees
+//=========================================================================
+void
+ThreadPoolData::FlushRemoteFrees()
+{
+    for (RemoteFreeBatch& batch : m_remoteFreeBatches)
+    {
+        FlushRemoteFreeBatch(batch);
+    }
+}
+
+//=========================================================================
+// ThreadPoolData::FlushRemoteFreeBatch
+//=========================================================================
+void
+ThreadPoolData::FlushRemoteFreeBatch(RemoteFreeBatch& batch)
+{
+    if (batch.m_numElements)
+    {
+        batch.m_owner->m_freedElements.push_chain(*batch.m_first, *batch.m_last);
+        batch.m_first = nullptr;
+        batch.m_last = nullptr;
+        batch.m_numElements = 0;
+    }
+}
+
+//=========================================================================
+// ThreadPoolData::ReleaseCachedPages
+//=========================================================================
+void
+ThreadPoolData::ReleaseCachedPages()
+{
+    if (m_cachedPages.empty())
+    {
+        return;
+    }
+
+    AZStd::lock_guard<AZStd::recursive_mutex> lock(m_allocator.m_allocator->m_mutex);
+    while (!m_cachedPages.empty())
+    {
+        ThreadPoolSchemaImpl::Page* page = &m_cachedPages.front();
+        m_cachedPages.pop_front();
+        m_allocator.m_allocator->m_freePages.push_front(*page);
     }
+    m_numCachedPages = 0;
 }
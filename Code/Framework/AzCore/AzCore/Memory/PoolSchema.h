@@ -40,6 +40,8 @@ namespace AZ
                 , m_isDynamic(true)
                 , m_numStaticPages(0)
                 , m_pageAllocator(nullptr)
+                , m_threadPageCacheSize(0)
+                , m_crossThreadFreeBatchSize(0)
 
             {}
             size_t              m_pageSize;             ///< Page size in bytes.
@@ -52,6 +54,17 @@ namespace AZ
              */
             unsigned int        m_numStaticPages;
             IAllocatorAllocate* m_pageAllocator;        ///< If you provide this interface we will use it for page allocations, otherwise SystemAllocator will be used.
+            /**
+             * ThreadPoolSchema only. Number of free pages each thread keeps for itself before returning them to the shared
+             * free page list, which requires a lock. 0 disables the per thread page cache.
+             */
+            unsigned int        m_threadPageCacheSize;
+            /**
+             * ThreadPoolSchema only. Number of elements, freed from a thread that doesn't own them, that are batched before
+             * they are handed back to the owning thread with a single atomic operation. 0 or 1 hands the elements back one by one.
+             * Batched elements stay allocated until the batch is full or the freeing thread calls GarbageCollect.
+             */
+            unsigned int        m_crossThreadFreeBatchSize;
         };
 
         PoolSchema(const Descriptor& desc = Descriptor());
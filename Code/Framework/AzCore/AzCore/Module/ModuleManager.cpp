@@ -19,13 +19,98 @@
 #include <AzCore/NativeUI/NativeUIRequests.h>
 #include <AzCore/Script/ScriptSystemBus.h>
 #include <AzCore/Script/ScriptContext.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/Settings/SettingsRegistry.h>
 
 #include <AzCore/std/algorithm.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/std/sort.h>
 
 namespace
 {
     static const char* s_moduleLoggingScope = "Module Manager";
+
+    //! When true (the default), the files of the dynamic modules are read on worker threads ahead of their loads
+    static constexpr const char* s_prefetchModulesKey = "/Amazon/AzCore/ModuleManager/PrefetchModules";
+
+    static constexpr AZ::u32 s_maxPrefetchThreads = 4;
+    static constexpr AZ::u64 s_prefetchReadSize = 1024 * 1024;
+
+    bool GetRegistryFlag(const char* key, bool defaultValue)
+    {
+        bool value = defaultValue;
+        if (auto settingsRegistry = AZ::SettingsRegistry::Get(); settingsRegistry)
+        {
+            settingsRegistry->Get(value, key);
+        }
+        return value;
+    }
+
+#if defined(AZ_ENABLE_TRACING)
+    //! When true, the time spent loading each dynamic module and activating each system component is logged
+    static constexpr const char* s_reportStartupTimesKey = "/Amazon/AzCore/ModuleManager/ReportStartupTimes";
+
+    double ToMilliseconds(AZStd::chrono::microseconds duration)
+    {
+        return static_cast<double>(duration.count()) / 1000.0;
+    }
+#endif
+
+    //! Reads the files of the dynamic modules on worker threads while the calling thread loads them one by one,
+    //! so the OS loader finds them in the file cache instead of waiting on each read in turn.
+    //! Only file contents are read, the modules themselves are still loaded and initialized in order on the calling thread,
+    //! since the static initializers and InitializeDynamicModule of a module may rely on the modules loaded before it.
+    class ModuleFilePrefetcher
+    {
+    public:
+        explicit ModuleFilePrefetcher(AZStd::vector<AZ::OSString> moduleFiles)
+            : m_moduleFiles(AZStd::move(moduleFiles))
+        {
+            const AZ::u32 threadCount = AZStd::min(AZStd::min(AZStd::max(AZStd::thread::hardware_concurrency(), 1u), s_maxPrefetchThreads),
+                static_cast<AZ::u32>(m_moduleFiles.size()));
+
+            AZStd::thread_desc threadDesc;
+            threadDesc.m_name = "Module Prefetch";
+            m_threads.reserve(threadCount);
+            for (AZ::u32 threadIndex = 0; threadIndex < threadCount; ++threadIndex)
+            {
+                m_threads.emplace_back([this]()
+                    {
+                        PrefetchFiles();
+                    }, &threadDesc);
+            }
+        }
+
+        ~ModuleFilePrefetcher()
+        {
+            for (AZStd::thread& thread : m_threads)
+            {
+                thread.join();
+            }
+        }
+
+    private:
+        void PrefetchFiles()
+        {
+            AZStd::vector<char> buffer(s_prefetchReadSize);
+            for (size_t fileIndex = m_nextFile++; fileIndex < m_moduleFiles.size(); fileIndex = m_nextFile++)
+            {
+                AZ::IO::SystemFile file;
+                if (file.Open(m_moduleFiles[fileIndex].c_str(), AZ::IO::SystemFile::SF_OPEN_READ_ONLY))
+                {
+                    while (file.Read(buffer.size(), buffer.data()) == buffer.size())
+                    {
+                    }
+                }
+            }
+        }
+
+        AZStd::vector<AZ::OSString> m_moduleFiles;
+        AZStd::atomic<size_t> m_nextFile{ 0 };
+        AZStd::vector<AZStd::thread> m_threads;
+    };
 }
 
 namespace AZ
@@ -469,7 +554,13 @@ namespace AZ
                 continue;
             }
 
+            const auto phaseStart = AZStd::chrono::high_resolution_clock::now();
             PhaseOutcome phaseResult = phasePair.second();
+            if (phasePair.first != ModuleInitializationSteps::ActivateEntity)
+            {
+                moduleDataPtr->m_loadTime += AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(
+                    AZStd::chrono::high_resolution_clock::now() - phaseStart);
+            }
             if (!phaseResult.IsSuccess())
             {
                 // Remove all references to the module from the owned and unowned list
@@ -503,21 +594,71 @@ namespace AZ
     {
         LoadModulesResult results;
 
-        Internal::ModuleManagerSearchPathTool moduleSearchPathHelper;
-
-        // Load DLLs specified in the application descriptor
-        for (const auto& moduleDescriptor : modules)
+#if defined(AZ_ENABLE_TRACING)
+        const auto loadStart = AZStd::chrono::high_resolution_clock::now();
+#endif
         {
-            // For each module that is loaded, attempt to set the module's folder as a path for dependent module resolution
-            moduleSearchPathHelper.SetModuleSearchPath(moduleDescriptor);
+            AZStd::unique_ptr<ModuleFilePrefetcher> prefetcher;
+            if (lastStepToPerform >= ModuleInitializationSteps::Load && modules.size() > 1 && GetRegistryFlag(s_prefetchModulesKey, true))
+            {
+                prefetcher = AZStd::make_unique<ModuleFilePrefetcher>(GetUnloadedModuleFiles(modules));
+            }
+
+            Internal::ModuleManagerSearchPathTool moduleSearchPathHelper;
+
+            // Load DLLs specified in the application descriptor
+            for (const auto& moduleDescriptor : modules)
+            {
+                // For each module that is loaded, attempt to set the module's folder as a path for dependent module resolution
+                moduleSearchPathHelper.SetModuleSearchPath(moduleDescriptor);
 
-            LoadModuleOutcome result = LoadDynamicModule(moduleDescriptor.m_dynamicLibraryPath.c_str(), lastStepToPerform, maintainReferences);
-            results.emplace_back(AZStd::move(result));
+                LoadModuleOutcome result = LoadDynamicModule(moduleDescriptor.m_dynamicLibraryPath.c_str(), lastStepToPerform, maintainReferences);
+                results.emplace_back(AZStd::move(result));
+            }
+        }
+
+#if defined(AZ_ENABLE_TRACING)
+        if (GetRegistryFlag(s_reportStartupTimesKey, false))
+        {
+            const auto loadTime = AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(AZStd::chrono::high_resolution_clock::now() - loadStart);
+            AZ_TracePrintf(s_moduleLoggingScope, "Loaded %zu dynamic modules in %.2f ms\n", modules.size(), ToMilliseconds(loadTime));
+            for (const LoadModuleOutcome& result : results)
+            {
+                if (result.IsSuccess())
+                {
+                    const auto moduleData = AZStd::static_pointer_cast<ModuleDataImpl>(result.GetValue());
+                    AZ_TracePrintf(s_moduleLoggingScope, "%10.2f ms  %s\n", ToMilliseconds(moduleData->m_loadTime), moduleData->GetDebugName());
+                }
+            }
         }
+#endif
 
         return results;
     }
 
+    //=========================================================================
+    // GetUnloadedModuleFiles
+    //=========================================================================
+    AZStd::vector<AZ::OSString> ModuleManager::GetUnloadedModuleFiles(const ModuleDescriptorList& modules)
+    {
+        AZStd::vector<AZ::OSString> moduleFiles;
+        for (const auto& moduleDescriptor : modules)
+        {
+            if (GetLoadedModule(moduleDescriptor.m_dynamicLibraryPath))
+            {
+                continue;
+            }
+
+            // Creating a handle only resolves the module's file, nothing is loaded until Load() is called
+            if (AZStd::unique_ptr<DynamicModuleHandle> handle = DynamicModuleHandle::Create(PreProcessModule(moduleDescriptor.m_dynamicLibraryPath).c_str());
+                handle)
+            {
+                moduleFiles.emplace_back(handle->GetFilename());
+            }
+        }
+        return moduleFiles;
+    }
+
     //=========================================================================
     // LoadStaticModules
     //=========================================================================
@@ -737,9 +878,39 @@ namespace AZ
         }
 
         // Activate the entities in the appropriate order
-        for (Component* component : componentsToActivate)
+#if defined(AZ_ENABLE_TRACING)
+        if (GetRegistryFlag(s_reportStartupTimesKey, false))
+        {
+            AZStd::vector<AZStd::pair<AZStd::chrono::microseconds, Component*>> activationTimes;
+            activationTimes.reserve(componentsToActivate.size());
+            AZStd::chrono::microseconds totalTime{};
+            for (Component* component : componentsToActivate)
+            {
+                const auto activateStart = AZStd::chrono::high_resolution_clock::now();
+                ModuleEntity::ActivateComponent(*component);
+                activationTimes.emplace_back(AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(
+                    AZStd::chrono::high_resolution_clock::now() - activateStart), component);
+                totalTime += activationTimes.back().first;
+            }
+
+            AZStd::sort(activationTimes.begin(), activationTimes.end(), [](const auto& lhs, const auto& rhs)
+                {
+                    return lhs.first > rhs.first;
+                });
+            AZ_TracePrintf(s_moduleLoggingScope, "Activated %zu system components in %.2f ms\n", activationTimes.size(), ToMilliseconds(totalTime));
+            for (const auto& [activationTime, component] : activationTimes)
+            {
+                AZ_TracePrintf(s_moduleLoggingScope, "%10.2f ms  %s (%s)\n", ToMilliseconds(activationTime), component->RTTI_GetTypeName(),
+                    component->GetEntity() ? component->GetEntity()->GetName().c_str() : "");
+            }
+        }
+        else
+#endif
         {
-            ModuleEntity::ActivateComponent(*component);
+            for (Component* component : componentsToActivate)
+            {
+                ModuleEntity::ActivateComponent(*component);
+            }
         }
 
         // Done activating; set state to active
@@ -11,6 +11,7 @@
 #include <AzCore/Component/Component.h>
 #include <AzCore/Module/ModuleManagerBus.h>
 
+#include <AzCore/std/chrono/chrono.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/smart_ptr/weak_ptr.h>
@@ -97,6 +98,9 @@ namespace AZ
 
         //! The last step this module completed
         ModuleInitializationSteps m_lastCompletedStep = ModuleInitializationSteps::None;
+
+        //! Time spent loading the module, creating its class and registering its descriptors
+        AZStd::chrono::microseconds m_loadTime{};
     };
 
     /*!
@@ -162,6 +166,9 @@ namespace AZ
         // Helper function to preprocess the module names to handle any special processing
         static AZ::OSString PreProcessModule(AZStd::string_view moduleName);
 
+        // Helper function returning the files of the modules that aren't loaded yet, in load order
+        AZStd::vector<AZ::OSString> GetUnloadedModuleFiles(const ModuleDescriptorList& modules);
+
         // Tags to look for when activating system components
         AZStd::vector<Crc32> m_systemComponentTags;
 
@@ -35,12 +35,40 @@ namespace AZ
 
         void NameData::release()
         {
-            AZ_Assert(m_useCount > 0, "m_useCount is already 0!");
-            if (m_useCount.fetch_sub(1) == 1)
+            int useCount = m_useCount.load(AZStd::memory_order_relaxed);
+            while (true)
             {
-                AZ::NameDictionary::Instance().TryReleaseName(this);
+                AZ_Assert(useCount > 0, "m_useCount is already 0!");
+                // Entries involved in a hash collision stay in the dictionary, so they only drop to 0.
+                // Otherwise the last reference marks the entry with -1 so a lookup on another thread
+                // can't take a new reference while it's removed from the dictionary.
+                if (useCount == 1 && !m_hashCollision)
+                {
+                    if (m_useCount.compare_exchange_weak(useCount, -1, AZStd::memory_order_acq_rel))
+                    {
+                        AZ::NameDictionary::Instance().TryReleaseName(this);
+                        return;
+                    }
+                }
+                else if (m_useCount.compare_exchange_weak(useCount, useCount - 1, AZStd::memory_order_acq_rel))
+                {
+                    return;
+                }
             }
         }
+
+        bool NameData::TryAddRef()
+        {
+            int useCount = m_useCount.load(AZStd::memory_order_relaxed);
+            while (useCount >= 0)
+            {
+                if (m_useCount.compare_exchange_weak(useCount, useCount + 1, AZStd::memory_order_acq_rel))
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
     }
 }
 
@@ -39,9 +39,14 @@ namespace AZ
             void add_ref();
             void release();
 
+            // Takes a reference unless the entry is being released (m_useCount is -1). Used by lookups that
+            // don't hold the dictionary lock.
+            bool TryAddRef();
+
             template <typename T>
             friend struct AZStd::IntrusivePtrCountPolicy;
 
+            // Set to -1 by the thread releasing the last reference, after which no new references can be taken.
             AZStd::atomic_int m_useCount = {0};
             AZStd::string m_name;
             Hash m_hash;
@@ -196,6 +196,28 @@ namespace AZ
             jsonContext->Serializer<NameJsonSerializer>()->HandlesType<Name>();
         }
     }
-    
+
+    namespace Internal
+    {
+        NameLiteral::~NameLiteral()
+        {
+            // The dictionary clears m_data when it's destroyed, so this only reaches the dictionary while it exists.
+            if (m_data.load(AZStd::memory_order_acquire))
+            {
+                NameDictionary::Instance().UnregisterLiteral(*this);
+            }
+        }
+
+        Name NameLiteral::GetName()
+        {
+            NameData* nameData = m_data.load(AZStd::memory_order_acquire);
+            if (!nameData)
+            {
+                AZ_Assert(NameDictionary::IsReady(), "Attempted to initialize Name '%.*s' before the NameDictionary is ready.", AZ_STRING_ARG(m_name));
+                nameData = NameDictionary::Instance().RegisterLiteral(*this);
+            }
+            return Name(nameData);
+        }
+    }
 } // namespace AZ
 
@@ -13,6 +13,12 @@ namespace AZ
 {
     class NameDictionary;
     class ScriptDataContext;
+
+    namespace Internal
+    {
+        class NameLiteral;
+    }
+
     class ReflectContext;
 
     //! The Name class provides very fast string equality comparison, so that names can be used as IDs without sacrificing performance.
@@ -24,10 +30,11 @@ namespace AZ
     //! Equality-comparison of two Name objects is very fast.
     //!
     //! The dictionary must be initialized before Name objects are created.
-    //! A Name instance must not be statically declared.
+    //! A Name instance must not be statically declared, use AZ_NAME_LITERAL for names known at compile time instead.
     class Name
     {
         friend NameDictionary;
+        friend Internal::NameLiteral;
     public:
         using Hash = Internal::NameData::Hash;
 
@@ -115,8 +122,58 @@ namespace AZ
         AZStd::intrusive_ptr<Internal::NameData> m_data;
     };
 
+    namespace Internal
+    {
+        //! Backing storage for AZ_NAME_LITERAL. The hash is calculated at compile time and the dictionary entry is
+        //! resolved the first time the literal is used, after which making the Name only loads the cached entry.
+        //! The literal holds a reference to the entry until the NameDictionary or the module containing the literal
+        //! is destroyed, a new dictionary resolves the entry again on first use.
+        class NameLiteral final
+        {
+            friend NameDictionary;
+        public:
+            static constexpr Name::Hash CalcHash(AZStd::string_view name)
+            {
+                // AZStd::hash<AZStd::string_view> returns 64 bits but we want 32 bit hashes for the sake
+                // of network synchronization. So just take the low 32 bits.
+                return static_cast<Name::Hash>(AZStd::hash<AZStd::string_view>()(name) & 0xFFFFFFFF);
+            }
+
+            constexpr NameLiteral(AZStd::string_view name, Name::Hash hash)
+                : m_name(name)
+                , m_hash(hash)
+            {}
+            ~NameLiteral();
+
+            NameLiteral(const NameLiteral&) = delete;
+            NameLiteral& operator=(const NameLiteral&) = delete;
+
+            Name GetName();
+
+        private:
+            AZStd::string_view m_name;
+            Name::Hash m_hash;
+            AZStd::atomic<NameData*> m_data{ nullptr };
+
+            // Links in the list of registered literals, guarded by the NameDictionary mutex.
+            NameLiteral* m_next = nullptr;
+            NameLiteral* m_previous = nullptr;
+        };
+    }
+
 } // namespace AZ
 
+//! Makes a Name from a string literal, hashing it at compile time and resolving it against the NameDictionary only
+//! the first time the expression is evaluated. Use it for names that are created repeatedly in hot code paths, e.g.
+//!     shaderOptions.SetValue(AZ_NAME_LITERAL("o_useDepthPrepass"), value);
+#define AZ_NAME_LITERAL(str)                                                                        \
+    ([]() -> AZ::Name                                                                               \
+    {                                                                                               \
+        constexpr AZ::Name::Hash nameLiteralHash = AZ::Internal::NameLiteral::CalcHash(str);        \
+        static AZ::Internal::NameLiteral s_nameLiteral(str, nameLiteralHash);                       \
+        return s_nameLiteral.GetName();                                                             \
+    }())
+
 namespace AZStd
 {
     template <typename T>
@@ -10,6 +10,7 @@
 #include <AzCore/std/hash.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/string/conversions.h>
 #include <AzCore/Module/Environment.h>
 #include <cstring>
@@ -21,6 +22,9 @@ namespace AZ
     namespace NameDictionaryInternal
     {
         static AZ::EnvironmentVariable<NameDictionary*> s_instance = nullptr;
+
+        // Marks a removed slot in the lookup table, probing continues past it.
+        static Internal::NameData* const s_tombstone = reinterpret_cast<Internal::NameData*>(alignof(Internal::NameData));
     }
 
     void NameDictionary::Create()
@@ -75,11 +79,77 @@ namespace AZ
         return *(*s_instance);
     }
     
+    NameDictionary::ReadTable::ReadTable(size_t capacity)
+        : m_capacity(capacity)
+    {
+        AZ_Assert((capacity & (capacity - 1)) == 0, "Capacity must be a power of 2");
+        void* slots = AZ::AllocatorInstance<AZ::OSAllocator>::Get().Allocate(sizeof(AZStd::atomic<Internal::NameData*>) * capacity, alignof(AZStd::atomic<Internal::NameData*>), 0, "NameDictionary::ReadTable", __FILE__, __LINE__);
+        m_slots = reinterpret_cast<AZStd::atomic<Internal::NameData*>*>(slots);
+        for (size_t i = 0; i < capacity; ++i)
+        {
+            new (&m_slots[i]) AZStd::atomic<Internal::NameData*>(nullptr);
+        }
+    }
+
+    NameDictionary::ReadTable::~ReadTable()
+    {
+        AZ::AllocatorInstance<AZ::OSAllocator>::Get().DeAllocate(m_slots, sizeof(AZStd::atomic<Internal::NameData*>) * m_capacity, alignof(AZStd::atomic<Internal::NameData*>));
+    }
+
+    NameDictionary::ReadScope::ReadScope(const NameDictionary& dictionary)
+        : m_dictionary(dictionary)
+    {
+        // Spread the threads over the counters, thread ids are often aligned so mix the bits first
+        const size_t threadHash = AZStd::hash<AZStd::thread_id>()(AZStd::this_thread::get_id()) * 0x9E3779B97F4A7C15ull;
+        m_slot = static_cast<uint32_t>(threadHash >> 32) % ReaderCountSlots;
+
+        while (true)
+        {
+            m_generation = m_dictionary.m_readGeneration.load(AZStd::memory_order_seq_cst);
+            m_dictionary.m_readerCounts[m_generation][m_slot].m_count.fetch_add(1, AZStd::memory_order_seq_cst);
+
+            // If a writer flipped the generation in between it may not have seen our counter, register again
+            // in the new generation. Otherwise the writer sees us and won't free anything we can reach.
+            if (m_dictionary.m_readGeneration.load(AZStd::memory_order_seq_cst) == m_generation)
+            {
+                break;
+            }
+            m_dictionary.m_readerCounts[m_generation][m_slot].m_count.fetch_sub(1, AZStd::memory_order_release);
+        }
+    }
+
+    NameDictionary::ReadScope::~ReadScope()
+    {
+        m_dictionary.m_readerCounts[m_generation][m_slot].m_count.fetch_sub(1, AZStd::memory_order_release);
+    }
+
     NameDictionary::NameDictionary()
-    {}
+    {
+        m_readTable.store(aznew ReadTable(MinReadTableCapacity), AZStd::memory_order_release);
+    }
 
     NameDictionary::~NameDictionary()
     {
+        // Drop the references held by the literals first, so they are not reported as leaks. Detach the list
+        // first as releasing the entries goes back into the dictionary.
+        Internal::NameLiteral* literal = nullptr;
+        {
+            AZStd::unique_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+            literal = m_literals;
+            m_literals = nullptr;
+        }
+        while (literal)
+        {
+            Internal::NameLiteral* next = literal->m_next;
+            literal->m_next = nullptr;
+            literal->m_previous = nullptr;
+            if (Internal::NameData* nameData = literal->m_data.exchange(nullptr, AZStd::memory_order_acq_rel))
+            {
+                nameData->release();
+            }
+            literal = next;
+        }
+
         bool leaksDetected = false;
 
         for (const auto& keyValue : m_dictionary)
@@ -102,15 +172,19 @@ namespace AZ
         }
 
         AZ_Assert(!leaksDetected, "AZ::NameDictionary still has active name references. See debug output for the list of leaked names.");
+
+        // No readers are left at this point
+        FreeRetired(m_retired[0]);
+        FreeRetired(m_retired[1]);
+        delete m_readTable.load(AZStd::memory_order_acquire);
     }
 
     Name NameDictionary::FindName(Name::Hash hash) const
     {
-        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
-        auto iter = m_dictionary.find(hash);
-        if (iter != m_dictionary.end())
+        ReadScope readScope(*this);
+        if (Internal::NameData* nameData = FindInReadTable(hash))
         {
-            return Name(iter->second);
+            return TryAcquireName(nameData);
         }
         return Name();
     }
@@ -123,15 +197,31 @@ namespace AZ
             return Name();
         }
 
-        Name::Hash hash = CalcHash(nameString);
+        return MakeName(nameString, CalcHash(nameString));
+    }
 
-        // If we find the same name with the same hash, just return it. 
-        // This path is faster than the loop below because FindName() takes a shared_lock whereas the
-        // loop requires a unique_lock to modify the dictionary.
-        Name name = FindName(hash);
-        if (name.GetStringView() == nameString)
+    Name NameDictionary::MakeName(AZStd::string_view nameString, Name::Hash hash)
+    {
+        // If we find the same name with the same hash, just return it. This path doesn't lock, names that
+        // already exist only cost a probe of the lookup table and taking a reference. Follow the collision
+        // chain the same way as the loop below.
         {
-            return AZStd::move(name);
+            ReadScope readScope(*this);
+            Name::Hash probeHash = hash;
+            while (Internal::NameData* nameData = FindInReadTable(probeHash))
+            {
+                if (nameData->GetName() == nameString)
+                {
+                    Name name = TryAcquireName(nameData);
+                    if (!name.IsEmpty())
+                    {
+                        return name;
+                    }
+                    // Being released on another thread, the loop below replaces it
+                    break;
+                }
+                ++probeHash;
+            }
         }
 
         // The name doesn't exist in the dictionary, so we have to lock and add it
@@ -146,19 +236,39 @@ namespace AZ
             {
                 Internal::NameData* nameData = aznew Internal::NameData(nameString, hash);
                 nameData->m_hashCollision = collisionDetected;
+                AddToReadTable(nameData);
                 m_dictionary.emplace(hash, nameData);
+                ReclaimRetired();
                 return Name(nameData);
             }
+
+            Internal::NameData* nameData = iter->second;
+            const bool matchingName = nameData->GetName() == nameString;
+
             // Found the desired entry, return it
-            else if (iter->second->GetName() == nameString)
+            if (matchingName)
+            {
+                Name name = TryAcquireName(nameData);
+                if (!name.IsEmpty())
+                {
+                    return name;
+                }
+            }
+
+            // The entry is being released on another thread, which will delete it once it gets the lock. Take
+            // over its hash so the collision chain stays intact.
+            if (matchingName || nameData->m_useCount < 0)
             {
-                return Name(iter->second);
+                collisionDetected = collisionDetected || nameData->m_hashCollision;
+                RemoveFromReadTable(nameData);
+                m_dictionary.erase(iter);
+                iter = m_dictionary.end();
             }
             // Hash collision, try a new hash
             else
             {
                 collisionDetected = true;
-                iter->second->m_hashCollision = true; // Make sure the existing entry is flagged as colliding too
+                nameData->m_hashCollision = true; // Make sure the existing entry is flagged as colliding too
                 ++hash;
                 iter = m_dictionary.find(hash);
             }
@@ -177,34 +287,258 @@ namespace AZ
         //      try to find that hash in the dictionary, and nothing is found. So now "world" is added to
         //      the dictionary *again*, this time with hash value 1000. Name objects pointing to the original
         //      entry and Name objects pointing to the new entry will fail comparison operations.
+        //
+        // NameData::release only calls this for entries without collisions, after setting the use count to -1
+        // so no other thread can take a new reference.
+
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_sharedMutex);
 
-        // Early exit to avoid locking the mutex unnecessarily.
-        if (nameData->m_hashCollision)
+        // MakeName may have replaced the entry with a new one while we were waiting for the lock
+        auto iter = m_dictionary.find(nameData->GetHash());
+        if (iter != m_dictionary.end() && iter->second == nameData)
         {
-            return;
+            // Check m_hashCollision again inside the m_sharedMutex because a new collision could have happened
+            // on another thread after the entry was marked for release. Keep it in that case.
+            if (nameData->m_hashCollision)
+            {
+                nameData->m_useCount = 0;
+                return;
+            }
+
+            RemoveFromReadTable(nameData);
+            m_dictionary.erase(iter);
         }
 
+        // Lookups on other threads may still be reading the entry, so it's deleted later
+        RetireName(nameData);
+
+        ReportStats();
+    }
+
+    Internal::NameData* NameDictionary::RegisterLiteral(Internal::NameLiteral& literal)
+    {
+        Name name = MakeName(literal.m_name, literal.m_hash);
+
         AZStd::unique_lock<AZStd::shared_mutex> lock(m_sharedMutex);
 
-        // Check m_hashCollision again inside the m_sharedMutex because a new collision could have happened
-        // on another thread before taking the lock.
-        if (nameData->m_hashCollision)
+        // Another thread may have registered the literal while we were making the name
+        Internal::NameData* nameData = literal.m_data.load(AZStd::memory_order_acquire);
+        if (!nameData)
         {
-            return;
+            nameData = name.m_data.get();
+            nameData->add_ref();
+            literal.m_data.store(nameData, AZStd::memory_order_release);
+
+            literal.m_previous = nullptr;
+            literal.m_next = m_literals;
+            if (m_literals)
+            {
+                m_literals->m_previous = &literal;
+            }
+            m_literals = &literal;
         }
+        return nameData;
+    }
 
-        // We need to check the count again in here in case
-        // someone was trying to get the name on another thread.
-        // Set it to -1 so only this thread will attempt to clean up the
-        // dictionary and delete the name.
-        int32_t expectedRefCount = 0;
-        if (nameData->m_useCount.compare_exchange_strong(expectedRefCount, -1))
+    void NameDictionary::UnregisterLiteral(Internal::NameLiteral& literal)
+    {
+        Internal::NameData* nameData = nullptr;
         {
-            m_dictionary.erase(nameData->GetHash());
-            delete nameData;
+            AZStd::unique_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+
+            nameData = literal.m_data.exchange(nullptr, AZStd::memory_order_acq_rel);
+            if (!nameData)
+            {
+                return;
+            }
+
+            if (literal.m_previous)
+            {
+                literal.m_previous->m_next = literal.m_next;
+            }
+            else
+            {
+                m_literals = literal.m_next;
+            }
+            if (literal.m_next)
+            {
+                literal.m_next->m_previous = literal.m_previous;
+            }
+            literal.m_next = nullptr;
+            literal.m_previous = nullptr;
         }
 
-        ReportStats();
+        // Releasing may remove the entry, which locks the dictionary again
+        nameData->release();
+    }
+
+    Internal::NameData* NameDictionary::FindInReadTable(Name::Hash hash) const
+    {
+        using namespace NameDictionaryInternal;
+
+        const ReadTable* table = m_readTable.load(AZStd::memory_order_acquire);
+        const size_t mask = table->m_capacity - 1;
+        for (size_t probe = 0, slot = hash & mask; probe < table->m_capacity; ++probe, slot = (slot + 1) & mask)
+        {
+            Internal::NameData* nameData = table->m_slots[slot].load(AZStd::memory_order_acquire);
+            if (!nameData)
+            {
+                break;
+            }
+            if (nameData != s_tombstone && nameData->GetHash() == hash)
+            {
+                return nameData;
+            }
+        }
+        return nullptr;
+    }
+
+    Name NameDictionary::TryAcquireName(Internal::NameData* nameData)
+    {
+        // The reference taken by TryAddRef is handed over to the Name
+        if (nameData->TryAddRef())
+        {
+            Name name(nameData);
+            nameData->m_useCount.fetch_sub(1, AZStd::memory_order_relaxed);
+            return name;
+        }
+        return Name();
+    }
+
+    void NameDictionary::AddToReadTable(Internal::NameData* nameData)
+    {
+        using namespace NameDictionaryInternal;
+
+        ReadTable* table = m_readTable.load(AZStd::memory_order_relaxed);
+        // Keep the load factor (including tombstones) under 1/2 so probe sequences stay short
+        if ((table->m_usedSlots + 1) * 2 > table->m_capacity)
+        {
+            size_t capacity = MinReadTableCapacity;
+            while (capacity < (m_dictionary.size() + 1) * 4)
+            {
+                capacity *= 2;
+            }
+            RebuildReadTable(capacity);
+            table = m_readTable.load(AZStd::memory_order_relaxed);
+        }
+
+        const size_t mask = table->m_capacity - 1;
+        for (size_t slot = nameData->GetHash() & mask; ; slot = (slot + 1) & mask)
+        {
+            Internal::NameData* slotData = table->m_slots[slot].load(AZStd::memory_order_relaxed);
+            if (!slotData || slotData == s_tombstone)
+            {
+                if (!slotData)
+                {
+                    ++table->m_usedSlots;
+                }
+                table->m_slots[slot].store(nameData, AZStd::memory_order_release);
+                return;
+            }
+        }
+    }
+
+    void NameDictionary::RemoveFromReadTable(Internal::NameData* nameData)
+    {
+        using namespace NameDictionaryInternal;
+
+        ReadTable* table = m_readTable.load(AZStd::memory_order_relaxed);
+        const size_t mask = table->m_capacity - 1;
+        for (size_t probe = 0, slot = nameData->GetHash() & mask; probe < table->m_capacity; ++probe, slot = (slot + 1) & mask)
+        {
+            Internal::NameData* slotData = table->m_slots[slot].load(AZStd::memory_order_relaxed);
+            if (!slotData)
+            {
+                break;
+            }
+            if (slotData == nameData)
+            {
+                table->m_slots[slot].store(s_tombstone, AZStd::memory_order_release);
+                return;
+            }
+        }
+        AZ_Assert(false, "Name '%.*s' is missing from the lookup table", AZ_STRING_ARG(nameData->GetName()));
+    }
+
+    void NameDictionary::RebuildReadTable(size_t capacity)
+    {
+        // Entries being added are inserted by the caller after the rebuild
+        ReadTable* newTable = aznew ReadTable(capacity);
+        const size_t mask = capacity - 1;
+        for (const auto& keyValue : m_dictionary)
+        {
+            size_t slot = keyValue.first & mask;
+            while (newTable->m_slots[slot].load(AZStd::memory_order_relaxed))
+            {
+                slot = (slot + 1) & mask;
+            }
+            newTable->m_slots[slot].store(keyValue.second, AZStd::memory_order_relaxed);
+            ++newTable->m_usedSlots;
+        }
+
+        // Readers may still be probing the old table
+        ReadTable* oldTable = m_readTable.exchange(newTable, AZStd::memory_order_acq_rel);
+        m_retired[m_readGeneration.load(AZStd::memory_order_relaxed)].m_tables.push_back(oldTable);
+    }
+
+    void NameDictionary::RetireName(Internal::NameData* nameData)
+    {
+        m_retired[m_readGeneration.load(AZStd::memory_order_relaxed)].m_names.push_back(nameData);
+        ReclaimRetired();
+    }
+
+    void NameDictionary::ReclaimRetired()
+    {
+        // Everything retired in the previous generation was unlinked before the readers of the current
+        // generation started, so it can be freed once the readers of the previous generation are done.
+        const uint32_t currentGeneration = m_readGeneration.load(AZStd::memory_order_relaxed);
+        const uint32_t previousGeneration = currentGeneration ^ 1;
+        RetiredList& previous = m_retired[previousGeneration];
+        if (!previous.m_names.empty() || !previous.m_tables.empty())
+        {
+            if (HasReaders(previousGeneration))
+            {
+                return;
+            }
+            FreeRetired(previous);
+        }
+
+        RetiredList& current = m_retired[currentGeneration];
+        if (!current.m_names.empty() || !current.m_tables.empty())
+        {
+            // New readers start in the other generation and can't reach the retired entries anymore
+            m_readGeneration.store(previousGeneration, AZStd::memory_order_seq_cst);
+            if (!HasReaders(currentGeneration))
+            {
+                FreeRetired(current);
+            }
+        }
+    }
+
+    bool NameDictionary::HasReaders(uint32_t generation) const
+    {
+        for (const ReaderCount& readerCount : m_readerCounts[generation])
+        {
+            if (readerCount.m_count.load(AZStd::memory_order_seq_cst) != 0)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void NameDictionary::FreeRetired(RetiredList& retiredList)
+    {
+        for (Internal::NameData* nameData : retiredList.m_names)
+        {
+            delete nameData;
+        }
+        for (ReadTable* table : retiredList.m_tables)
+        {
+            delete table;
+        }
+        retiredList.m_names.clear();
+        retiredList.m_tables.clear();
     }
 
     void NameDictionary::ReportStats() const
@@ -274,9 +608,7 @@ namespace AZ
 
     Name::Hash NameDictionary::CalcHash(AZStd::string_view name)
     {
-        // AZStd::hash<AZStd::string_view> returns 64 bits but we want 32 bit hashes for the sake
-        // of network synchronization. So just take the low 32 bits.
-        const uint32_t hash = AZStd::hash<AZStd::string_view>()(name) & 0xFFFFFFFF;
-        return hash;
+        // Shared with AZ_NAME_LITERAL, which calculates the same hash at compile time
+        return Internal::NameLiteral::CalcHash(name);
     }
 }
@@ -10,6 +10,8 @@
 #include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/std/string/string_view.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/shared_mutex.h>
 #include <AzCore/Memory/Memory.h>
 #include <AzCore/Memory/OSAllocator.h>
@@ -32,6 +34,7 @@ namespace AZ
     namespace Internal
     {
         class NameData;
+        class NameLiteral;
     };
     
     //! Maintains a list of unique strings for Name objects.
@@ -42,6 +45,11 @@ namespace AZ
     //! Benchmarks have shown that creating a new Name object can be quite slow when the name doesn't 
     //! already exist in the NameDictionary, but is comparable to creating an AZStd::string for names 
     //! that already exist.
+    //!
+    //! Looking up names that already exist doesn't take a lock, the entries are mirrored in an open addressing
+    //! table that readers probe without locking. Only adding and removing entries takes m_sharedMutex. Entries
+    //! and tables removed from the lookup table are deleted once all the readers that could still see them are
+    //! done (see ReadScope).
     class NameDictionary final
     {
         AZ_CLASS_ALLOCATOR(NameDictionary, AZ::OSAllocator, 0);
@@ -49,6 +57,7 @@ namespace AZ
         friend Module;
         friend Name;
         friend Internal::NameData;
+        friend Internal::NameLiteral;
         friend UnitTest::NameDictionaryTester;
         
     public:
@@ -72,9 +81,57 @@ namespace AZ
         Name FindName(Name::Hash hash) const;
 
     private:
+        // Open addressing table of entries used for lock free lookups, keyed by the (collision resolved) hash.
+        // Slots are only written under m_sharedMutex, removed entries leave a tombstone behind.
+        struct ReadTable
+        {
+            AZ_CLASS_ALLOCATOR(ReadTable, AZ::OSAllocator, 0);
+
+            explicit ReadTable(size_t capacity);
+            ~ReadTable();
+
+            size_t m_capacity; // Always a power of 2
+            size_t m_usedSlots = 0; // Includes tombstones
+            AZStd::atomic<Internal::NameData*>* m_slots;
+        };
+
+        // Entries and tables that were removed from the lookup table while m_readGeneration had a given value.
+        struct RetiredList
+        {
+            AZStd::vector<Internal::NameData*> m_names;
+            AZStd::vector<ReadTable*> m_tables;
+        };
+
+        // Readers count themselves in one of a few padded counters (picked by thread id) for the current generation.
+        // Writers flip the generation and free what was retired in the old one once all its counters drop to zero.
+        struct ReaderCount
+        {
+            AZStd::atomic<uint32_t> m_count{ 0 };
+            char m_padding[64 - sizeof(AZStd::atomic<uint32_t>)];
+        };
+
+        // Marks a section in which entries found in the lookup table are guaranteed not to be deleted.
+        class ReadScope
+        {
+        public:
+            explicit ReadScope(const NameDictionary& dictionary);
+            ~ReadScope();
+
+        private:
+            const NameDictionary& m_dictionary;
+            uint32_t m_slot;
+            uint32_t m_generation;
+        };
+
+        static constexpr uint32_t ReaderCountSlots = 16;
+        static constexpr size_t MinReadTableCapacity = 256;
+
         NameDictionary();
         ~NameDictionary();
 
+        // Same as MakeName(AZStd::string_view) with the hash of the string already calculated.
+        Name MakeName(AZStd::string_view name, Name::Hash hash);
+
         void ReportStats() const;
 
         //////////////////////////////////////////////////////////////////////////
@@ -84,13 +141,45 @@ namespace AZ
         // a reference wasn't taken by another thread.
         void TryReleaseName(Internal::NameData* data);
         
+        //////////////////////////////////////////////////////////////////////////
+        // Private API for NameLiteral
+
+        // Resolves the literal against the dictionary and keeps a reference to the entry in the literal until
+        // the dictionary is destroyed or UnregisterLiteral is called.
+        Internal::NameData* RegisterLiteral(Internal::NameLiteral& literal);
+        void UnregisterLiteral(Internal::NameLiteral& literal);
+
         //////////////////////////////////////////////////////////////////////////
 
         // Calculates a hash for the provided name string.
         // Does not attempt to resolve hash collisions; that is handled elsewhere.
         Name::Hash CalcHash(AZStd::string_view name);
-                
+
+        // Lock free lookup of an entry by hash, must be called inside a ReadScope. The returned entry
+        // may be in the process of being released.
+        Internal::NameData* FindInReadTable(Name::Hash hash) const;
+
+        // Returns a Name for an entry found with FindInReadTable, or an empty Name when the entry is being released.
+        static Name TryAcquireName(Internal::NameData* nameData);
+
+        // The following functions must be called with m_sharedMutex locked exclusively.
+        void AddToReadTable(Internal::NameData* nameData);
+        void RemoveFromReadTable(Internal::NameData* nameData);
+        void RebuildReadTable(size_t capacity);
+        void RetireName(Internal::NameData* nameData);
+        void ReclaimRetired();
+        bool HasReaders(uint32_t generation) const;
+        void FreeRetired(RetiredList& retiredList);
+
         AZStd::unordered_map<Name::Hash, Internal::NameData*> m_dictionary;
         mutable AZStd::shared_mutex m_sharedMutex;
+
+        AZStd::atomic<ReadTable*> m_readTable{ nullptr };
+        AZStd::atomic<uint32_t> m_readGeneration{ 0 };
+        mutable ReaderCount m_readerCounts[2][ReaderCountSlots];
+        RetiredList m_retired[2];
+
+        // Literals holding references to entries, guarded by m_sharedMutex.
+        Internal::NameLiteral* m_literals = nullptr;
     };
 }
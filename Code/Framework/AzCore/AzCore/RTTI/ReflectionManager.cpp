@@ -6,6 +6,7 @@
  */
 #include <AzCore/RTTI/ReflectionManager.h>
 #include <AzCore/Component/Component.h>
+#include <AzCore/std/algorithm.h>
 
 namespace AZ
 {
@@ -50,7 +51,10 @@ namespace AZ
         // Call the new entry point with all known contexts
         for (const auto& context : m_contexts)
         {
-            reflectEntryPoint(context.get());
+            if (!IsDeferred(context.get()))
+            {
+                reflectEntryPoint(context.get());
+            }
         }
     }
 
@@ -65,6 +69,10 @@ namespace AZ
             // Call unreflect on everything in reverse context order
             for (auto contextIt = m_contexts.rbegin(); contextIt != m_contexts.rend(); ++contextIt)
             {
+                if (IsDeferred(contextIt->get()))
+                {
+                    continue;
+                }
                 (*contextIt)->EnableRemoveReflection();
                 (*entryIt->second)(contextIt->get());
                 (*contextIt)->DisableRemoveReflection();
@@ -94,7 +102,10 @@ namespace AZ
         // Call the new entry point with all known contexts
         for (const auto& contextIt : m_contexts)
         {
-            reflectEntryPoint(contextIt.get());
+            if (!IsDeferred(contextIt.get()))
+            {
+                reflectEntryPoint(contextIt.get());
+            }
         }
     }
 
@@ -109,6 +120,10 @@ namespace AZ
             // Call unreflect on everything (order doesn't matter, the contexts are disparate)
             for (auto contextIt = m_contexts.rbegin(); contextIt != m_contexts.rend(); ++contextIt)
             {
+                if (IsDeferred(contextIt->get()))
+                {
+                    continue;
+                }
                 (*contextIt)->EnableRemoveReflection();
                 (*entryIt->second)(contextIt->get());
                 (*contextIt)->DisableRemoveReflection();
@@ -149,21 +164,41 @@ namespace AZ
     //=========================================================================
     // AddReflectContext
     //=========================================================================
-    void ReflectionManager::AddReflectContext(AZStd::unique_ptr<ReflectContext>&& context)
+    void ReflectionManager::AddReflectContext(AZStd::unique_ptr<ReflectContext>&& context, bool deferred)
     {
         // Early out if the context is already registered
-        if (GetReflectContext(azrtti_typeid(context.get())) != nullptr)
+        const AZ::TypeId contextTypeId = azrtti_typeid(context.get());
+        auto registeredIt = AZStd::find_if(m_contexts.begin(), m_contexts.end(), [&contextTypeId](const AZStd::unique_ptr<ReflectContext>& registered)
+        {
+            return azrtti_typeid(registered.get()) == contextTypeId;
+        });
+        if (registeredIt != m_contexts.end())
         {
             return;
         }
 
-        for (const auto& entry : m_entryPoints)
+        if (deferred)
+        {
+            m_deferredContexts.emplace_back(context.get());
+        }
+        else
         {
-            entry(context.get());
+            for (const auto& entry : m_entryPoints)
+            {
+                entry(context.get());
+            }
         }
         m_contexts.emplace_back(AZStd::move(context));
     }
 
+    //=========================================================================
+    // IsDeferred
+    //=========================================================================
+    bool ReflectionManager::IsDeferred(const ReflectContext* context) const
+    {
+        return AZStd::find(m_deferredContexts.begin(), m_deferredContexts.end(), context) != m_deferredContexts.end();
+    }
+
     //=========================================================================
     // GetReflectContext
     //=========================================================================
@@ -173,6 +208,25 @@ namespace AZ
         {
             if (azrtti_typeid(context.get()) == contextTypeId)
             {
+                if (auto deferredIt = AZStd::find(m_deferredContexts.begin(), m_deferredContexts.end(), context.get());
+                    deferredIt != m_deferredContexts.end())
+                {
+                    // No longer deferred before reflecting, entry points requesting the context get it as it is being reflected,
+                    // and entry points registered meanwhile are reflected into it by Reflect()
+                    m_deferredContexts.erase(deferredIt);
+                    if (!m_entryPoints.empty())
+                    {
+                        const auto lastEntryIt = AZStd::prev(m_entryPoints.end());
+                        for (auto entryIt = m_entryPoints.begin(); ; ++entryIt)
+                        {
+                            (*entryIt)(context.get());
+                            if (entryIt == lastEntryIt)
+                            {
+                                break;
+                            }
+                        }
+                    }
+                }
                 return context.get();
             }
         }
@@ -190,6 +244,15 @@ namespace AZ
             ReflectContext* context = contextIt->get();
             if (azrtti_typeid(context) == contextTypeId)
             {
+                if (auto deferredIt = AZStd::find(m_deferredContexts.begin(), m_deferredContexts.end(), context);
+                    deferredIt != m_deferredContexts.end())
+                {
+                    // Nothing was reflected into it
+                    m_deferredContexts.erase(deferredIt);
+                    m_contexts.erase(contextIt);
+                    return;
+                }
+
                 // Unreflect everything from the context
                 context->EnableRemoveReflection();
                 for (auto entryIt = m_entryPoints.rbegin(); entryIt != m_entryPoints.rend(); ++entryIt)
@@ -46,9 +46,14 @@ namespace AZ
 
         /// Creates a reflect context, and reflects all registered entry points
         template <typename ReflectContextT, typename = IsReflectContextT<ReflectContextT>>
-        void AddReflectContext() { AddReflectContext(AZStd::make_unique<ReflectContextT>()); }
+        void AddReflectContext() { AddReflectContext(AZStd::make_unique<ReflectContextT>(), false); }
 
-        /// Gets a reflect context of the requested type
+        /// Creates a reflect context whose entry points are only reflected the first time it is requested with GetReflectContext(),
+        /// so applications that never use it (e.g. the BehaviorContext of a server without scripting) don't pay for its reflection.
+        template <typename ReflectContextT, typename = IsReflectContextT<ReflectContextT>>
+        void AddDeferredReflectContext() { AddReflectContext(AZStd::make_unique<ReflectContextT>(), true); }
+
+        /// Gets a reflect context of the requested type, reflecting all entry points into it if it was deferred
         template <typename ReflectContextT, typename = IsReflectContextT<ReflectContextT>>
         ReflectContextT* GetReflectContext() { return azrtti_cast<ReflectContextT*>(GetReflectContext(azrtti_typeid<ReflectContextT>())); }
 
@@ -72,6 +77,8 @@ namespace AZ
         };
 
         AZStd::vector<AZStd::unique_ptr<ReflectContext>> m_contexts;
+        /// Contexts of m_contexts that entry points haven't been reflected into yet
+        AZStd::vector<ReflectContext*> m_deferredContexts;
 
         using EntryPointList = AZStd::list<EntryPoint>;
         EntryPointList m_entryPoints;
@@ -79,7 +86,8 @@ namespace AZ
         AZStd::unordered_map<TypeId, EntryPointList::iterator> m_typedEntryPoints;
         AZStd::unordered_map<StaticReflectionFunctionPtr, EntryPointList::iterator> m_nonTypedEntryPoints;
 
-        void AddReflectContext(AZStd::unique_ptr<ReflectContext>&& context);
+        void AddReflectContext(AZStd::unique_ptr<ReflectContext>&& context, bool deferred);
+        bool IsDeferred(const ReflectContext* context) const;
         ReflectContext* GetReflectContext(AZ::TypeId contextTypeId);
         void RemoveReflectContext(AZ::TypeId contextTypeId);
     };
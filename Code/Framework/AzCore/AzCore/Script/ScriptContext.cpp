@@ -11,6 +11,7 @@
 #include <AzCore/Script/ScriptContextDebug.h>
 #include <AzCore/Script/ScriptProperty.h>
 #include <AzCore/std/algorithm.h>
+#include <AzCore/std/chrono/clocks.h>
 #include <AzCore/std/string/conversions.h>
 #include <AzCore/Script/lua/lua.h>
 #include <AzCore/IO/GenericStreams.h>
@@ -3449,9 +3450,40 @@ LUA_API const Node* lua_getDummyNode()
                     return 0;
                 }
 
+                // most reflected methods take a handful of arguments, don't construct (and destroy) the parameters for the worst case on every call
+                if (thisPtr->m_method->GetNumArguments() <= s_maxArgumentsFastPath)
+                {
+                    return CallWithArguments<s_maxArgumentsFastPath>(lua, thisPtr, numElementsOnStack);
+                }
+
                 // there's no limit inherently in BehaviorContext (as there is no document limit in C++), but the LY supported limits default to 40 for Lua, ScriptCanvas, and ScriptEvents.
                 // this limit of 40 is however implicit, for now.
-                BehaviorValueParameter arguments[40];
+                return CallWithArguments<40>(lua, thisPtr, numElementsOnStack);
+            }
+
+            AZStd::vector<AZStd::pair<LuaLoadFromStack, BehaviorClass*>> m_fromLua;
+            LuaPushToStack m_resultToLua;
+            LuaPrepareValue m_prepareResult;
+            BehaviorClass* m_resultClass;
+
+            bool m_isResult;
+
+        private:
+            static constexpr size_t s_maxArgumentsFastPath = 8;
+
+            // everything the result callback needs, so the callback only captures one pointer and fits in the small object buffer of AZStd::function
+            struct ResultPush
+            {
+                lua_State* m_lua;
+                LuaScriptCaller* m_caller;
+                BehaviorValueParameter* m_result;
+                int* m_numResults;
+            };
+
+            template<size_t MaxArguments>
+            static int CallWithArguments(lua_State* lua, LuaScriptCaller* thisPtr, int numElementsOnStack)
+            {
+                BehaviorValueParameter arguments[MaxArguments];
                 BehaviorValueParameter result;
                 ScriptContext::StackVariableAllocator tempData;
                 AZStd::allocator backupAllocator;
@@ -3481,6 +3513,8 @@ LUA_API const Node* lua_getDummyNode()
                     return 0;
                 }
                 int numResults = 0;
+                ResultPush resultPushData{ lua, thisPtr, &result, &numResults };
+                ResultPush* resultPush = &resultPushData;
 
                 if (thisPtr->m_resultToLua)
                 {
@@ -3492,12 +3526,12 @@ LUA_API const Node* lua_getDummyNode()
                     }
 
                     // TODO: Make it optional for EBuses only, make it light weight too, probably a virtual function for the store result.
-                    result.m_onAssignedResult = AZStd::function<void()>([&]()
+                    result.m_onAssignedResult = AZStd::function<void()>([resultPush]()
                     {
-                        if (result.m_value)
+                        if (resultPush->m_result->m_value)
                         {
-                            thisPtr->m_resultToLua(lua, result);
-                            ++numResults;
+                            resultPush->m_caller->m_resultToLua(resultPush->m_lua, *resultPush->m_result);
+                            ++(*resultPush->m_numResults);
                         }
                     });
                 }
@@ -3557,13 +3591,6 @@ LUA_API const Node* lua_getDummyNode()
 
                 return numResults;
             }
-
-            AZStd::vector<AZStd::pair<LuaLoadFromStack, BehaviorClass*>> m_fromLua;
-            LuaPushToStack m_resultToLua;
-            LuaPrepareValue m_prepareResult;
-            BehaviorClass* m_resultClass;
-
-            bool m_isResult;
         };
 
         class LuaGenericCaller : public LuaCaller
@@ -5848,6 +5875,59 @@ LUA_API const Node* lua_getDummyNode()
         lua_gc(m_impl->m_lua, LUA_GCSTEP, numberOfSteps);
     }
 
+    //////////////////////////////////////////////////////////////////////////
+    bool ScriptContext::GarbageCollectStepBudgeted(AZ::u64 budgetUs, int stepSizeKB)
+    {
+        const auto start = AZStd::chrono::high_resolution_clock::now();
+        AZ::u64 elapsedUs = 0;
+        bool isCycleComplete = false;
+
+        do
+        {
+            isCycleComplete = lua_gc(m_impl->m_lua, LUA_GCSTEP, stepSizeKB) != 0;
+            ++m_garbageCollectorStats.m_numSteps;
+            elapsedUs = static_cast<AZ::u64>(AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(AZStd::chrono::high_resolution_clock::now() - start).count());
+        }
+        while (!isCycleComplete && elapsedUs < budgetUs);
+
+        if (isCycleComplete)
+        {
+            ++m_garbageCollectorStats.m_numCycles;
+        }
+
+        m_garbageCollectorStats.m_lastStepTimeUs = elapsedUs;
+        m_garbageCollectorStats.m_maxStepTimeUs = AZStd::max(m_garbageCollectorStats.m_maxStepTimeUs, elapsedUs);
+        return isCycleComplete;
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    void ScriptContext::SetAutomaticGarbageCollection(bool isEnabled)
+    {
+        if (m_isAutomaticGarbageCollectionEnabled != isEnabled)
+        {
+            lua_gc(m_impl->m_lua, isEnabled ? LUA_GCRESTART : LUA_GCSTOP, 0);
+            m_isAutomaticGarbageCollectionEnabled = isEnabled;
+        }
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    bool ScriptContext::IsAutomaticGarbageCollectionEnabled() const
+    {
+        return m_isAutomaticGarbageCollectionEnabled;
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    const ScriptContext::GarbageCollectorStats& ScriptContext::GetGarbageCollectorStats() const
+    {
+        return m_garbageCollectorStats;
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    void ScriptContext::ResetGarbageCollectorStats()
+    {
+        m_garbageCollectorStats = {};
+    }
+
     //////////////////////////////////////////////////////////////////////////
     size_t ScriptContext::GetMemoryUsage() const
     {
@@ -797,6 +797,16 @@ namespace AZ
         using RequireHook = AZStd::function<int(lua_State* lua, ScriptContext* context, const char* module)>;
 
         using StackVariableAllocator = StackVariableAllocator;
+
+        /// Statistics of the incremental garbage collector steps taken through \ref GarbageCollectStepBudgeted.
+        struct GarbageCollectorStats
+        {
+            AZ::u64 m_numSteps = 0; ///< Total number of incremental steps taken.
+            AZ::u64 m_numCycles = 0; ///< Number of collection cycles the steps completed.
+            AZ::u64 m_lastStepTimeUs = 0; ///< Time spent in the last call to \ref GarbageCollectStepBudgeted.
+            AZ::u64 m_maxStepTimeUs = 0; ///< Longest time spent in a single call to \ref GarbageCollectStepBudgeted.
+        };
+
         /// Stack temporary memory
         
         /**
@@ -863,6 +873,24 @@ namespace AZ
          */ 
         void GarbageCollectStep(int numberOfSteps = 2);
 
+        /**
+         * Step the incremental garbage collector until the time budget is used up, or a collection cycle completes.
+         * The budget is checked between steps, so a single step of stepSizeKB can overrun it. Use together with
+         * \ref SetAutomaticGarbageCollection to collect only at a fixed point in the frame.
+         * \returns true when a collection cycle completed.
+         */
+        bool GarbageCollectStepBudgeted(AZ::u64 budgetUs, int stepSizeKB = 1);
+
+        /**
+         * Enable (default) or disable Lua's automatic garbage collection. When disabled, memory is only reclaimed
+         * through the GarbageCollect functions, which then have to be called often enough to keep up with allocations.
+         */
+        void SetAutomaticGarbageCollection(bool isEnabled);
+        bool IsAutomaticGarbageCollectionEnabled() const;
+
+        const GarbageCollectorStats& GetGarbageCollectorStats() const;
+        void ResetGarbageCollectorStats();
+
         lua_State* NativeContext();
 
         //////////////////////////////////////////////////////////////////////////
@@ -930,6 +958,8 @@ namespace AZ
     protected:
         class ScriptContextImpl* m_impl;
         ScriptContextId m_id;
+        GarbageCollectorStats m_garbageCollectorStats;
+        bool m_isAutomaticGarbageCollectionEnabled = true;
 
 #if defined(LUA_USERDATA_TRACKING)
     public:
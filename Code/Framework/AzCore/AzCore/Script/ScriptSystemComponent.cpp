@@ -15,6 +15,7 @@
 #include <AzCore/Component/ComponentApplication.h>
 #include <AzCore/Component/Entity.h>
 #include <AzCore/Component/TickBus.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Debug/TraceReflection.h>
 #include <AzCore/IO/FileIO.h>
 #include <AzCore/Math/MathReflection.h>
@@ -53,6 +54,30 @@ namespace
     }
 }
 
+namespace AZ
+{
+    AZ_CVAR(uint32_t, script_gcBudgetUs, 0, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Microseconds per system tick the Lua garbage collector runs incremental steps, with Lua's automatic collection stopped. "
+        "0 keeps the automatic collection and the fixed number of steps per tick");
+    AZ_CVAR(int, script_gcStepSizeKB, 1, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "The amount of work, in KB of allocation, of a single incremental garbage collector step while script_gcBudgetUs is set");
+
+    static void script_PrintGarbageCollectorStats([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
+    {
+        ScriptContext* context = nullptr;
+        ScriptSystemRequestBus::BroadcastResult(context, &ScriptSystemRequests::GetContext, ScriptContextIds::DefaultScriptContextId);
+        if (context)
+        {
+            const ScriptContext::GarbageCollectorStats& stats = context->GetGarbageCollectorStats();
+            AZ_TracePrintf("Script", "Lua GC: %zu KB in use, %" PRIu64 " budgeted steps, %" PRIu64 " completed cycles, last frame %" PRIu64 " us, max frame %" PRIu64 " us\n",
+                context->GetMemoryUsage() / 1024, stats.m_numSteps, stats.m_numCycles, stats.m_lastStepTimeUs, stats.m_maxStepTimeUs);
+        }
+    }
+
+    AZ_CONSOLEFREEFUNC(script_PrintGarbageCollectorStats, AZ::ConsoleFunctorFlags::Null,
+        "Prints the memory use and the budgeted garbage collector statistics of the default script context");
+}
+
 //=========================================================================
 // ScriptSystemComponent
 // [5/29/2012]
@@ -293,7 +318,24 @@ void    ScriptSystemComponent::OnSystemTick()
         }
 #endif // AZ_PROFILE_TELEMETRY
 
-        contextContainer.m_context->GarbageCollectStep(contextContainer.m_garbageCollectorSteps);
+        // with a budget the collector only runs here, at a fixed point in the frame, instead of whenever Lua allocates
+        const AZ::u64 garbageCollectorBudgetUs = static_cast<uint32_t>(script_gcBudgetUs);
+        contextContainer.m_context->SetAutomaticGarbageCollection(garbageCollectorBudgetUs == 0);
+        if (garbageCollectorBudgetUs > 0)
+        {
+            contextContainer.m_context->GarbageCollectStepBudgeted(garbageCollectorBudgetUs, AZ::GetMax(static_cast<int>(script_gcStepSizeKB), 1));
+
+#ifdef AZ_PROFILE_TELEMETRY
+            if (contextContainer.m_context->GetId() == ScriptContextIds::DefaultScriptContextId)
+            {
+                AZ_PROFILE_DATAPOINT(AZ::Debug::ProfileCategory::Script, contextContainer.m_context->GetGarbageCollectorStats().m_lastStepTimeUs, "Script GC Step (us)");
+            }
+#endif // AZ_PROFILE_TELEMETRY
+        }
+        else
+        {
+            contextContainer.m_context->GarbageCollectStep(contextContainer.m_garbageCollectorSteps);
+        }
     }
 }
 
@@ -7,6 +7,7 @@
 
 #include <AzCore/Casting/numeric_cast.h>
 #include <AzCore/Component/ComponentApplicationBus.h>
+#include <AzCore/JSON/error/en.h>
 #include <AzCore/Serialization/Json/BaseJsonSerializer.h>
 #include <AzCore/Serialization/Json/JsonDeserializer.h>
 #include <AzCore/Serialization/Json/JsonMerger.h>
@@ -14,6 +15,7 @@
 #include <AzCore/Serialization/Json/JsonSerializer.h>
 #include <AzCore/Serialization/Json/RegistrationContext.h>
 #include <AzCore/Serialization/Json/StackedString.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/sort.h>
 
 namespace AZ
@@ -249,6 +251,52 @@ namespace AZ
         return result;
     }
 
+    JsonSerializationResult::ResultCode JsonSerialization::LoadFromString(
+        void* object, const Uuid& objectType, AZStd::string_view jsonText, const JsonDeserializerSettings& settings)
+    {
+        // Explicitly make a copy to call the correct overloaded version and avoid infinite recursion on this function.
+        JsonDeserializerSettings settingsCopy{settings};
+        return LoadFromString(object, objectType, jsonText, settingsCopy);
+    }
+
+    JsonSerializationResult::ResultCode JsonSerialization::LoadFromString(
+        void* object, const Uuid& objectType, AZStd::string_view jsonText, JsonDeserializerSettings& settings)
+    {
+        using namespace JsonSerializationResult;
+
+        AZStd::string scratchBuffer;
+        auto issueReportingCallback = [&scratchBuffer](AZStd::string_view message, ResultCode result, AZStd::string_view target) -> ResultCode
+        {
+            return JsonSerialization::DefaultIssueReporter(scratchBuffer, message, result, target);
+        };
+        if (!settings.m_reporting)
+        {
+            settings.m_reporting = issueReportingCallback;
+        }
+
+        // The document only lives for the duration of this call, so the text can be parsed in-situ, which makes the strings in the
+        // document point into the copy of the text instead of being allocated individually. The pool is sized after the input so
+        // the values typically end up in a single chunk.
+        constexpr size_t MinPoolChunkSize = 4 * 1024;
+        AZStd::vector<char> text;
+        text.resize_no_construct(jsonText.size() + 1);
+        memcpy(text.data(), jsonText.data(), jsonText.size());
+        text[jsonText.size()] = 0;
+
+        rapidjson::Document::AllocatorType pool(AZStd::max(jsonText.size(), MinPoolChunkSize));
+        rapidjson::Document document(&pool);
+        document.ParseInsitu<rapidjson::kParseCommentsFlag>(text.data());
+        if (document.HasParseError())
+        {
+            return settings.m_reporting(
+                AZStd::string::format("Unable to parse json text due to json error '%s' at offset %zu.",
+                    rapidjson::GetParseError_En(document.GetParseError()), document.GetErrorOffset()),
+                ResultCode(Tasks::ReadField, Outcomes::Invalid), "");
+        }
+
+        return Load(object, objectType, document, settings);
+    }
+
     JsonSerializationResult::ResultCode JsonSerialization::LoadTypeId(
         Uuid& typeId, const rapidjson::Value& input, const Uuid* baseClassTypeId, AZStd::string_view jsonPath,
         const JsonDeserializerSettings& settings)
@@ -48,6 +48,7 @@
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/IO/ByteContainerStream.h>
 #include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/string/osstring.h>
 
 namespace AZ
@@ -120,6 +121,9 @@ namespace AZ
             bool ReadElement(SerializeContext& sc, const SerializeContext::ClassData*& cd, SerializeContext::DataElement& element, const SerializeContext::ClassData* parent, bool nextLevel, bool isTopElement);
             // used during load to skip the rest of the element including any subelements
             void SkipElement();
+            // finds the registered class data for an element that has been read and replaces the element type id with the
+            // specialized type id if the class has GenericClassInfo
+            const SerializeContext::ClassData* FindElementClassData(SerializeContext& sc, SerializeContext::DataElement& element, const SerializeContext::ClassData* parent);
 
             bool WriteClass(const void* classPtr, const Uuid& classId, const SerializeContext::ClassData* classData) override;
             bool WriteElement(const void* elemPtr, const SerializeContext::ClassData* classData, const SerializeContext::ClassElement* classElement);
@@ -224,8 +228,75 @@ namespace AZ
             // completed successfully to make sure the equivalent amount
             // of CloseElements are called
             AZStd::vector<bool>                           m_writeElementResultStack;
+
+            // Streams contain the same types and members over and over again, so the results of looking up the class data of
+            // an element and matching an element to the member of its parent class are cached for the duration of the load.
+            // The reflected types can't change while a stream is being loaded.
+            struct ElementLookupKey
+            {
+                Uuid m_typeId;
+                const SerializeContext::ClassData* m_parent;
+                u32 m_nameCrc;
+
+                bool operator==(const ElementLookupKey& rhs) const
+                {
+                    return m_typeId == rhs.m_typeId && m_parent == rhs.m_parent && m_nameCrc == rhs.m_nameCrc;
+                }
+            };
+            struct ElementLookupKeyHash
+            {
+                size_t operator()(const ElementLookupKey& key) const
+                {
+                    size_t hash = AZStd::hash<Uuid>{}(key.m_typeId);
+                    AZStd::hash_combine(hash, key.m_parent, key.m_nameCrc);
+                    return hash;
+                }
+            };
+            struct ElementClassDataLookup
+            {
+                const SerializeContext::ClassData* m_classData;
+                Uuid m_specializedTypeId;
+            };
+            AZStd::unordered_map<ElementLookupKey, ElementClassDataLookup, ElementLookupKeyHash> m_elementClassDataCache;
+            // Members of (non-container) parent classes that have been matched to an element with a compatible type.
+            AZStd::unordered_map<ElementLookupKey, const SerializeContext::ClassElement*, ElementLookupKeyHash> m_classElementCache;
         };
 
+        //=========================================================================
+        // FindElementClassData
+        //=========================================================================
+        const SerializeContext::ClassData* ObjectStreamImpl::FindElementClassData(SerializeContext& sc, SerializeContext::DataElement& element, const SerializeContext::ClassData* parent)
+        {
+            // The cache is only valid for the context the stream is loaded with.
+            const bool useCache = &sc == m_sc;
+            const ElementLookupKey key{ element.m_id, parent, element.m_nameCrc };
+            if (useCache)
+            {
+                auto cached = m_elementClassDataCache.find(key);
+                if (cached != m_elementClassDataCache.end())
+                {
+                    element.m_id = cached->second.m_specializedTypeId;
+                    return cached->second.m_classData;
+                }
+            }
+
+            const SerializeContext::ClassData* cd = sc.FindClassData(element.m_id, parent, element.m_nameCrc);
+            if (cd)
+            {
+                // Lookup the SpecializedTypeId from the class if it has GenericClassInfo registered with it
+                if (GenericClassInfo* genericClassInfo = sc.FindGenericClassInfo(cd->m_typeId))
+                {
+                    element.m_id = genericClassInfo->GetSpecializedTypeId();
+                }
+            }
+
+            if (useCache)
+            {
+                m_elementClassDataCache.emplace(key, ElementClassDataLookup{ cd, element.m_id });
+            }
+            return cd;
+        }
+
         //=========================================================================
         // PreparseOldVersion
         // [4/25/2012]
@@ -594,6 +665,12 @@ namespace AZ
                         dynamicElementMetadata.m_typeId = fieldContainer->m_typeId;
                         classElement = &dynamicElementMetadata;
                     }
+                    else if (auto cachedClassElement = m_classElementCache.find(ElementLookupKey{ element.m_id, parentClassInfo, element.m_nameCrc });
+                        cachedClassElement != m_classElementCache.end())
+                    {
+                        // This member has been matched to an element of the same type before.
+                        classElement = cachedClassElement->second;
+                    }
                     else
                     {
                         for (size_t i = 0; i < parentClassInfo->m_elements.size(); ++i)
@@ -658,6 +735,11 @@ namespace AZ
                             }
                         }
 
+                        if (classElement)
+                        {
+                            m_classElementCache.emplace(ElementLookupKey{ element.m_id, parentClassInfo, element.m_nameCrc }, classElement);
+                        }
+
                         // If we can't resolve classElement while looking into members of a containing class, issue a warning.
                         // We can continue safely, but this constitutes loss of old data that users should be aware of.
                         if (classElement == nullptr)
@@ -1105,16 +1187,7 @@ namespace AZ
                 }
  
                 // find the registered class data
-                cd = sc.FindClassData(element.m_id, parent, element.m_nameCrc);
-
-                if (cd)
-                {
-                    // Lookup the SpecializedTypeId from the class if it has GenericClassInfo registered with it
-                    if (GenericClassInfo* genericClassInfo = sc.FindGenericClassInfo(cd->m_typeId))
-                    {
-                        element.m_id = genericClassInfo->GetSpecializedTypeId();
-                    }
-                }
+                cd = FindElementClassData(sc, element, parent);
 
                 // Root elements may require classInfo to be provided by the in-place load callback.
                 if (!cd && isTopElement && m_inplaceLoadInfoCB)
@@ -1233,15 +1306,7 @@ namespace AZ
                 }
 
                 // find the registered class data
-                cd = sc.FindClassData(element.m_id, parent, element.m_nameCrc);
-                if (cd)
-                {
-                    // Lookup the SpecializedTypeId from the class if it has GenericClassInfo registered with it
-                    if (GenericClassInfo* genericClassInfo = sc.FindGenericClassInfo(cd->m_typeId))
-                    {
-                        element.m_id = genericClassInfo->GetSpecializedTypeId();
-                    }
-                }
+                cd = FindElementClassData(sc, element, parent);
                 // Root elements may require classInfo to be provided by the in-place load callback.
                 if (!cd && isTopElement && m_inplaceLoadInfoCB)
                 {
@@ -1341,15 +1406,7 @@ namespace AZ
 
 
                 // find the registered class data
-                cd = sc.FindClassData(element.m_id, parent, element.m_nameCrc);
-                if (cd)
-                {
-                    // Lookup the SpecializedTypeId from the class if it has GenericClassInfo registered with it
-                    if (GenericClassInfo* genericClassInfo = sc.FindGenericClassInfo(cd->m_typeId))
-                    {
-                        element.m_id = genericClassInfo->GetSpecializedTypeId();
-                    }
-                }
+                cd = FindElementClassData(sc, element, parent);
 
                 // Root elements may require classInfo to be provided by the in-place load callback.
                 if (!cd && isTopElement && m_inplaceLoadInfoCB)
@@ -318,6 +318,20 @@ namespace AZ
         virtual bool MergeSettingsFolder(AZStd::string_view path, const Specializations& specializations,
             AZStd::string_view platform = {}, AZStd::string_view rootKey = "", AZStd::vector<char>* scratchBuffer = nullptr) = 0;
 
+        //! Stores the settings at the provided path, including all the keys below it, in a compact binary form.
+        //! The binary data is meant for caches local to a machine, the format can change between versions.
+        //! @param output The buffer the binary data is written to. Previous content is discarded.
+        //! @param path The key of the settings to store, an empty path stores the complete registry.
+        //! @return True if the key exists and has been stored, otherwise false.
+        virtual bool SaveSettingsBinary(AZStd::vector<char>& output, AZStd::string_view path = "") const = 0;
+        //! Replaces the settings at the provided path with settings stored by SaveSettingsBinary.
+        //! Unlike the Merge functions no patching is done, which makes this much faster than parsing and merging the same
+        //! settings as JSON. Notifiers are signaled once with the provided path.
+        //! @param data Binary data created by SaveSettingsBinary.
+        //! @param path The key to replace, an empty path replaces the complete registry.
+        //! @return True if the data is valid and has been loaded, otherwise false and the registry is unchanged.
+        virtual bool LoadSettingsBinary(AZStd::string_view data, AZStd::string_view path = "") = 0;
+
         //! Stores the settings structure which is used when merging settings to the Settings Registry
         //! using JSON Merge Patch or JSON Merge Patch.
         //! The settings contain an issue reporting callback which can be used to track patching process.
@@ -762,6 +762,309 @@ namespace AZ
         return true;
     }
 
+    namespace SettingsBinary
+    {
+        // Layout: a version byte followed by the root value. Every value starts with a Tag, numbers are stored as
+        // 8 bytes and strings, arrays and objects with a 32 bits count, all in the native (little endian) byte order.
+        constexpr char FormatVersion = 1;
+        // Deeper data comes from a corrupted file, real settings never get close
+        constexpr int MaxDepth = 256;
+
+        enum class Tag : char
+        {
+            Null,
+            False,
+            True,
+            Int64,
+            Uint64,
+            Double,
+            String,
+            Array,
+            Object
+        };
+
+        template<typename T>
+        void Write(AZStd::vector<char>& output, T value)
+        {
+            const char* bytes = reinterpret_cast<const char*>(&value);
+            output.insert(output.end(), bytes, bytes + sizeof(T));
+        }
+
+        void WriteString(AZStd::vector<char>& output, const char* string, rapidjson::SizeType length)
+        {
+            Write<u32>(output, length);
+            output.insert(output.end(), string, string + length);
+        }
+
+        void WriteValue(AZStd::vector<char>& output, const rapidjson::Value& value)
+        {
+            switch (value.GetType())
+            {
+            case rapidjson::kNullType:
+                Write(output, Tag::Null);
+                break;
+            case rapidjson::kFalseType:
+                Write(output, Tag::False);
+                break;
+            case rapidjson::kTrueType:
+                Write(output, Tag::True);
+                break;
+            case rapidjson::kNumberType:
+                if (value.IsDouble())
+                {
+                    Write(output, Tag::Double);
+                    Write(output, value.GetDouble());
+                }
+                else if (value.IsUint64())
+                {
+                    Write(output, Tag::Uint64);
+                    Write(output, value.GetUint64());
+                }
+                else
+                {
+                    Write(output, Tag::Int64);
+                    Write(output, value.GetInt64());
+                }
+                break;
+            case rapidjson::kStringType:
+                Write(output, Tag::String);
+                WriteString(output, value.GetString(), value.GetStringLength());
+                break;
+            case rapidjson::kArrayType:
+                Write(output, Tag::Array);
+                Write<u32>(output, value.Size());
+                for (const rapidjson::Value& element : value.GetArray())
+                {
+                    WriteValue(output, element);
+                }
+                break;
+            case rapidjson::kObjectType:
+                Write(output, Tag::Object);
+                Write<u32>(output, value.MemberCount());
+                for (const auto& member : value.GetObject())
+                {
+                    WriteString(output, member.name.GetString(), member.name.GetStringLength());
+                    WriteValue(output, member.value);
+                }
+                break;
+            }
+        }
+
+        class Reader
+        {
+        public:
+            Reader(const char* begin, const char* end)
+                : m_current(begin)
+                , m_end(end)
+            {
+            }
+
+            bool IsAtEnd() const
+            {
+                return m_current == m_end;
+            }
+
+            bool ReadValue(rapidjson::Value& value, rapidjson::Document::AllocatorType& allocator, int depth)
+            {
+                Tag tag;
+                if (depth > MaxDepth || !Read(tag))
+                {
+                    return false;
+                }
+
+                switch (tag)
+                {
+                case Tag::Null:
+                    value.SetNull();
+                    return true;
+                case Tag::False:
+                    value.SetBool(false);
+                    return true;
+                case Tag::True:
+                    value.SetBool(true);
+                    return true;
+                case Tag::Int64:
+                {
+                    s64 number;
+                    if (!Read(number))
+                    {
+                        return false;
+                    }
+                    value.SetInt64(number);
+                    return true;
+                }
+                case Tag::Uint64:
+                {
+                    u64 number;
+                    if (!Read(number))
+                    {
+                        return false;
+                    }
+                    value.SetUint64(number);
+                    return true;
+                }
+                case Tag::Double:
+                {
+                    double number;
+                    if (!Read(number))
+                    {
+                        return false;
+                    }
+                    value.SetDouble(number);
+                    return true;
+                }
+                case Tag::String:
+                {
+                    const char* string;
+                    u32 length;
+                    if (!ReadString(string, length))
+                    {
+                        return false;
+                    }
+                    value.SetString(string, length, allocator);
+                    return true;
+                }
+                case Tag::Array:
+                {
+                    u32 count;
+                    // Every element takes at least one byte, which rejects corrupted counts before reserving
+                    if (!Read(count) || count > static_cast<size_t>(m_end - m_current))
+                    {
+                        return false;
+                    }
+                    value.SetArray();
+                    value.Reserve(count, allocator);
+                    for (u32 index = 0; index < count; ++index)
+                    {
+                        rapidjson::Value element;
+                        if (!ReadValue(element, allocator, depth + 1))
+                        {
+                            return false;
+                        }
+                        value.PushBack(element, allocator);
+                    }
+                    return true;
+                }
+                case Tag::Object:
+                {
+                    u32 count;
+                    if (!Read(count))
+                    {
+                        return false;
+                    }
+                    value.SetObject();
+                    for (u32 index = 0; index < count; ++index)
+                    {
+                        const char* name;
+                        u32 nameLength;
+                        rapidjson::Value memberValue;
+                        if (!ReadString(name, nameLength) || !ReadValue(memberValue, allocator, depth + 1))
+                        {
+                            return false;
+                        }
+                        value.AddMember(rapidjson::Value(name, nameLength, allocator), memberValue, allocator);
+                    }
+                    return true;
+                }
+                default:
+                    return false;
+                }
+            }
+
+        private:
+            template<typename T>
+            bool Read(T& value)
+            {
+                if (static_cast<size_t>(m_end - m_current) < sizeof(T))
+                {
+                    return false;
+                }
+                memcpy(&value, m_current, sizeof(T));
+                m_current += sizeof(T);
+                return true;
+            }
+
+            bool ReadString(const char*& string, u32& length)
+            {
+                if (!Read(length) || static_cast<size_t>(m_end - m_current) < length)
+                {
+                    return false;
+                }
+                string = m_current;
+                m_current += length;
+                return true;
+            }
+
+            const char* m_current;
+            const char* m_end;
+        };
+    } // namespace SettingsBinary
+
+    bool SettingsRegistryImpl::SaveSettingsBinary(AZStd::vector<char>& output, AZStd::string_view path) const
+    {
+        if (path.empty())
+        {
+            // rapidjson::Pointer assets that the supplied string
+            // is not nullptr even if the supplied size is 0
+            // Setting to empty string to prevent assert
+            path = "";
+        }
+        rapidjson::Pointer pointer(path.data(), path.length());
+        if (!pointer.IsValid())
+        {
+            return false;
+        }
+
+        AZStd::scoped_lock lock(m_settingMutex);
+        const rapidjson::Value* value = pointer.Get(m_settings);
+        if (!value)
+        {
+            return false;
+        }
+
+        output.clear();
+        output.push_back(SettingsBinary::FormatVersion);
+        SettingsBinary::WriteValue(output, *value);
+        return true;
+    }
+
+    bool SettingsRegistryImpl::LoadSettingsBinary(AZStd::string_view data, AZStd::string_view path)
+    {
+        if (path.empty())
+        {
+            // rapidjson::Pointer assets that the supplied string
+            // is not nullptr even if the supplied size is 0
+            // Setting to empty string to prevent assert
+            path = "";
+        }
+        rapidjson::Pointer pointer(path.data(), path.length());
+        if (!pointer.IsValid())
+        {
+            return false;
+        }
+
+        if (data.empty() || data[0] != SettingsBinary::FormatVersion)
+        {
+            AZ_Error("Settings Registry", false, "Binary settings data is empty or has been stored by a different version.");
+            return false;
+        }
+
+        AZStd::scoped_lock lock(m_settingMutex);
+
+        // Decode into a separate value first so invalid data leaves the registry untouched
+        rapidjson::Value value;
+        SettingsBinary::Reader reader(data.data() + 1, data.data() + data.size());
+        if (!reader.ReadValue(value, m_settings.GetAllocator(), 0) || !reader.IsAtEnd())
+        {
+            AZ_Error("Settings Registry", false, "Binary settings data is corrupted.");
+            return false;
+        }
+
+        pointer.Create(m_settings, m_settings.GetAllocator()) = value;
+        m_notifiers.Signal(path, GetType(path));
+        return true;
+    }
+
     SettingsRegistryInterface::VisitResponse SettingsRegistryImpl::Visit(Visitor& visitor, StackedString& path, AZStd::string_view valueName,
         const rapidjson::Value& value) const
     {
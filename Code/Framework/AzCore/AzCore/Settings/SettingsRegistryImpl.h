@@ -73,6 +73,9 @@ namespace AZ
         bool MergeSettingsFolder(AZStd::string_view path, const Specializations& specializations,
             AZStd::string_view platform, AZStd::string_view rootKey = "", AZStd::vector<char>* scratchBuffer = nullptr) override;
 
+        bool SaveSettingsBinary(AZStd::vector<char>& output, AZStd::string_view path = "") const override;
+        bool LoadSettingsBinary(AZStd::string_view data, AZStd::string_view path = "") override;
+
         void SetApplyPatchSettings(const AZ::JsonApplyPatchSettings& applyPatchSettings) override;
         void GetApplyPatchSettings(AZ::JsonApplyPatchSettings& applyPatchSettings) override;
 
@@ -5,16 +5,22 @@
  *
  */
 
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/IO/GenericStreams.h>
 #include <AzCore/IO/Path/Path.h>
+#include <AzCore/IO/SystemFile.h>
 #include <AzCore/IO/TextStreamWriters.h>
 #include <AzCore/JSON/document.h>
 #include <AzCore/JSON/pointer.h>
 #include <AzCore/JSON/prettywriter.h>
 #include <AzCore/JSON/writer.h>
+#include <AzCore/Math/Uuid.h>
+#include <AzCore/Math/XxHash64.h>
 #include <AzCore/PlatformId/PlatformDefaults.h>
+#include <AzCore/Settings/SettingsRegistryImpl.h>
 #include <AzCore/Settings/SettingsRegistryMergeUtils.h>
 #include <AzCore/Settings/CommandLine.h>
+#include <AzCore/std/sort.h>
 #include <AzCore/std/string/conversions.h>
 #include <AzCore/std/string/wildcard.h>
 #include <AzCore/std/tuple.h>
@@ -789,6 +795,330 @@ namespace AZ::SettingsRegistryMergeUtils
         }
     }
 
+    namespace RegistryCache
+    {
+        // Layout of a cache file:
+        // u32 magic, u32 version, u64 key,
+        // u32 input count, inputs as { u8 InputType, u32 path length, path, u64, u64 },
+        // then the SaveSettingsBinary data of the merged registry up to the end of the file.
+        constexpr u32 Magic = 0x43525A41; // "AZRC"
+        constexpr u32 Version = 1;
+        constexpr char FolderName[] = "SettingsRegistryCache";
+        constexpr char PlatformFolder[] = "Platform";
+
+        enum class InputType : u8
+        {
+            File, // size and modification time
+            Folder // hash of the file names and 0
+        };
+
+        template<typename T>
+        void Write(AZStd::vector<char>& output, T value)
+        {
+            const char* bytes = reinterpret_cast<const char*>(&value);
+            output.insert(output.end(), bytes, bytes + sizeof(T));
+        }
+
+        template<typename T>
+        bool Read(AZStd::string_view& input, T& value)
+        {
+            if (input.size() < sizeof(T))
+            {
+                return false;
+            }
+            memcpy(&value, input.data(), sizeof(T));
+            input.remove_prefix(sizeof(T));
+            return true;
+        }
+
+        //! Adding or removing a file in a registry folder changes the files merged, the names of the files are enough to detect it
+        u64 HashFolderListing(const AZ::IO::FixedMaxPath& folder)
+        {
+            AZStd::vector<AZ::IO::FixedMaxPathString> fileNames;
+            AZ::IO::SystemFile::FindFiles((folder / "*").c_str(), [&fileNames](const char* fileName, bool isFile)
+                {
+                    if (isFile)
+                    {
+                        fileNames.emplace_back(fileName);
+                    }
+                    return true;
+                });
+            AZStd::sort(fileNames.begin(), fileNames.end());
+
+            AZ::XxHash64 hash;
+            for (const AZ::IO::FixedMaxPathString& fileName : fileNames)
+            {
+                // Include the terminator so "ab" + "c" differs from "a" + "bc"
+                hash.Update(fileName.c_str(), fileName.size() + 1);
+            }
+            return hash.GetDigest();
+        }
+
+        void GetInputState(InputType type, const char* path, u64& first, u64& second)
+        {
+            if (type == InputType::File)
+            {
+                first = AZ::IO::SystemFile::Length(path);
+                second = AZ::IO::SystemFile::ModificationTime(path);
+            }
+            else
+            {
+                first = HashFolderListing(AZ::IO::FixedMaxPath(path));
+                second = 0;
+            }
+        }
+
+        void WriteInput(AZStd::vector<char>& output, u32& inputCount, InputType type, AZStd::string_view path)
+        {
+            const AZ::IO::FixedMaxPathString pathString(path);
+            u64 first;
+            u64 second;
+            GetInputState(type, pathString.c_str(), first, second);
+
+            Write(output, type);
+            Write(output, aznumeric_cast<u32>(path.size()));
+            output.insert(output.end(), path.begin(), path.end());
+            Write(output, first);
+            Write(output, second);
+            ++inputCount;
+        }
+
+        //! Lists the files and folders merged since the history entry @firstEntry.
+        //! Returns false if any merge reported an error, in which case the result must not be cached.
+        bool WriteMergedInputs(SettingsRegistryInterface& registry, size_t firstEntry, AZStd::string_view platform,
+            AZStd::vector<char>& output, u32& inputCount)
+        {
+            for (size_t entryIndex = firstEntry;; ++entryIndex)
+            {
+                const auto entryKey = SettingsRegistryInterface::FixedValueString::format(AZ_SETTINGS_REGISTRY_HISTORY_KEY "/%zu", entryIndex);
+                const SettingsRegistryInterface::Type entryType = registry.GetType(entryKey);
+                if (entryType == SettingsRegistryInterface::Type::NoType)
+                {
+                    return true;
+                }
+
+                AZ::IO::FixedMaxPathString path;
+                if (entryType == SettingsRegistryInterface::Type::String && registry.Get(path, entryKey))
+                {
+                    WriteInput(output, inputCount, InputType::File, path);
+                }
+                else if (registry.Get(path, SettingsRegistryInterface::FixedValueString::format(AZ_SETTINGS_REGISTRY_HISTORY_KEY "/%zu/Folder", entryIndex)) &&
+                    !path.empty() && path.back() == '*')
+                {
+                    // The folder is recorded as the wildcard used to list it, followed by an entry per merged file
+                    path.pop_back();
+                    WriteInput(output, inputCount, InputType::Folder, path);
+                    if (!platform.empty())
+                    {
+                        WriteInput(output, inputCount, InputType::Folder, (AZ::IO::FixedMaxPath(path) / PlatformFolder / platform).Native());
+                    }
+                }
+                else
+                {
+                    // Error entry
+                    return false;
+                }
+            }
+        }
+
+        size_t GetHistoryCount(SettingsRegistryInterface& registry)
+        {
+            size_t count = 0;
+            while (registry.GetType(SettingsRegistryInterface::FixedValueString::format(AZ_SETTINGS_REGISTRY_HISTORY_KEY "/%zu", count)) !=
+                SettingsRegistryInterface::Type::NoType)
+            {
+                ++count;
+            }
+            return count;
+        }
+
+        //! Returns the registry data of the cache file if it matches @key and none of its inputs changed, otherwise an empty view.
+        AZStd::string_view ValidateCacheFile(AZStd::string_view data, u64 key)
+        {
+            u32 magic;
+            u32 version;
+            u64 storedKey;
+            u32 inputCount;
+            if (!Read(data, magic) || !Read(data, version) || !Read(data, storedKey) || !Read(data, inputCount) ||
+                magic != Magic || version != Version || storedKey != key)
+            {
+                return {};
+            }
+
+            for (u32 inputIndex = 0; inputIndex < inputCount; ++inputIndex)
+            {
+                InputType type;
+                u32 pathLength;
+                if (!Read(data, type) || !Read(data, pathLength) || data.size() < pathLength || pathLength >= AZ::IO::MaxPathLength)
+                {
+                    return {};
+                }
+                const AZ::IO::FixedMaxPathString path(data.substr(0, pathLength));
+                data.remove_prefix(pathLength);
+
+                u64 storedFirst;
+                u64 storedSecond;
+                if (!Read(data, storedFirst) || !Read(data, storedSecond))
+                {
+                    return {};
+                }
+                u64 first;
+                u64 second;
+                GetInputState(type, path.c_str(), first, second);
+                if (first != storedFirst || second != storedSecond)
+                {
+                    return {};
+                }
+            }
+            return data;
+        }
+
+        bool ReadFile(const char* path, AZStd::vector<char>& buffer)
+        {
+            AZ::IO::SystemFile file;
+            if (!file.Open(path, AZ::IO::SystemFile::SF_OPEN_READ_ONLY))
+            {
+                return false;
+            }
+            const AZ::IO::SystemFile::SizeType fileSize = file.Length();
+            buffer.resize_no_construct(fileSize);
+            return file.Read(fileSize, buffer.data()) == fileSize;
+        }
+
+        void WriteFile(const AZ::IO::FixedMaxPath& path, const AZStd::vector<char>& header, const AZStd::vector<char>& settings)
+        {
+            // Write under a unique name and rename into place, applications starting at the same time may store the same entry
+            char uuidString[AZ::Uuid::MaxStringBuffer];
+            AZ::Uuid::CreateRandom().ToString(uuidString, false, false);
+            const AZ::IO::FixedMaxPath stagingPath(AZ::IO::FixedMaxPathString::format("%s.%s", path.c_str(), uuidString));
+            {
+                AZ::IO::SystemFile stagingFile;
+                if (!stagingFile.Open(stagingPath.c_str(),
+                    AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_CREATE_PATH | AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY))
+                {
+                    return;
+                }
+                const bool written = stagingFile.Write(header.data(), header.size()) == header.size() &&
+                    stagingFile.Write(settings.data(), settings.size()) == settings.size();
+                stagingFile.Close();
+                if (!written)
+                {
+                    AZ::IO::SystemFile::Delete(stagingPath.c_str());
+                    return;
+                }
+            }
+            if (!AZ::IO::SystemFile::Rename(stagingPath.c_str(), path.c_str(), true))
+            {
+                AZ::IO::SystemFile::Delete(stagingPath.c_str());
+            }
+        }
+    } // namespace RegistryCache
+
+    bool MergeSettingsToRegistry_Cached(SettingsRegistryInterface& registry, const AZStd::string_view platform,
+        const SettingsRegistryInterface::Specializations& specializations, const AZStd::function<void()>& mergeFunction)
+    {
+        bool cacheEnabled = true;
+        registry.Get(cacheEnabled, RegistryCacheEnabledKey);
+        AZ::IO::FixedMaxPath cacheFilePath;
+        if (!cacheEnabled || !registry.Get(cacheFilePath.Native(), FilePathKey_ProjectUserPath) || cacheFilePath.empty())
+        {
+            mergeFunction();
+            return false;
+        }
+
+        // The command line differs between runs of the same application (the builders for instance get a unique id) and
+        // isn't read by the merge functions, so it's left out of the key and put back after loading a cached registry.
+        // Arguments which change settings (--regset...) are in the registry content that is part of the key.
+        AZStd::vector<char> commandLineSettings;
+        const bool hasCommandLine = registry.SaveSettingsBinary(commandLineSettings, CommandLineRootKey);
+        if (hasCommandLine)
+        {
+            registry.Remove(CommandLineRootKey);
+        }
+        AZStd::vector<char> settingsBeforeMerge;
+        const bool settingsStored = registry.SaveSettingsBinary(settingsBeforeMerge);
+        if (hasCommandLine)
+        {
+            registry.LoadSettingsBinary({ commandLineSettings.data(), commandLineSettings.size() }, CommandLineRootKey);
+        }
+        if (!settingsStored)
+        {
+            mergeFunction();
+            return false;
+        }
+
+        AZ::XxHash64 keyHash;
+        AZ::XxHash64 nameHash;
+        keyHash.Update(settingsBeforeMerge.data(), settingsBeforeMerge.size());
+        auto hashName = [&keyHash, &nameHash](AZStd::string_view name)
+        {
+            constexpr char separator = 0;
+            for (AZ::XxHash64* hash : { &keyHash, &nameHash })
+            {
+                hash->Update(name.data(), name.size());
+                hash->Update(&separator, 1);
+            }
+        };
+        for (size_t index = 0; index < specializations.GetCount(); ++index)
+        {
+            hashName(specializations.GetSpecialization(index));
+        }
+        hashName(platform);
+        const u64 cacheKey = keyHash.GetDigest();
+
+        // The specializations identify the application, so the Editor, the Asset Processor, the builders... each have a file
+        cacheFilePath /= RegistryCache::FolderName;
+        cacheFilePath /= AZ::IO::FixedMaxPathString::format("%016" PRIx64 ".bin", nameHash.GetDigest());
+
+        AZStd::vector<char> cacheFile;
+        if (AZ::IO::SystemFile::Exists(cacheFilePath.c_str()) && RegistryCache::ReadFile(cacheFilePath.c_str(), cacheFile))
+        {
+            const AZStd::string_view cachedSettings = RegistryCache::ValidateCacheFile({ cacheFile.data(), cacheFile.size() }, cacheKey);
+            if (!cachedSettings.empty() && registry.LoadSettingsBinary(cachedSettings))
+            {
+                if (hasCommandLine)
+                {
+                    registry.LoadSettingsBinary({ commandLineSettings.data(), commandLineSettings.size() }, CommandLineRootKey);
+                }
+                return true;
+            }
+        }
+
+        const size_t firstHistoryEntry = RegistryCache::GetHistoryCount(registry);
+        AZStd::vector<char> consoleCommandsBeforeMerge;
+        registry.SaveSettingsBinary(consoleCommandsBeforeMerge, AZ::IConsole::ConsoleRootCommandKey);
+
+        mergeFunction();
+
+        // Console commands are run while their key is merged, a cached registry would skip them
+        AZStd::vector<char> consoleCommandsAfterMerge;
+        registry.SaveSettingsBinary(consoleCommandsAfterMerge, AZ::IConsole::ConsoleRootCommandKey);
+        if (consoleCommandsAfterMerge != consoleCommandsBeforeMerge)
+        {
+            return false;
+        }
+
+        AZStd::vector<char> header;
+        RegistryCache::Write(header, RegistryCache::Magic);
+        RegistryCache::Write(header, RegistryCache::Version);
+        RegistryCache::Write(header, cacheKey);
+        const size_t inputCountOffset = header.size();
+        u32 inputCount = 0;
+        RegistryCache::Write(header, inputCount);
+        if (!RegistryCache::WriteMergedInputs(registry, firstHistoryEntry, platform, header, inputCount))
+        {
+            return false;
+        }
+        memcpy(header.data() + inputCountOffset, &inputCount, sizeof(inputCount));
+
+        AZStd::vector<char> settingsAfterMerge;
+        if (registry.SaveSettingsBinary(settingsAfterMerge))
+        {
+            RegistryCache::WriteFile(cacheFilePath, header, settingsAfterMerge);
+        }
+        return false;
+    }
+
     void MergeSettingsToRegistry_ProjectUserRegistry(SettingsRegistryInterface& registry, const AZStd::string_view platform,
         const SettingsRegistryInterface::Specializations& specializations, AZStd::vector<char>* scratchBuffer)
     {
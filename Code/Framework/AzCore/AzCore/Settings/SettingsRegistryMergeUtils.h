@@ -185,6 +185,22 @@ namespace AZ::SettingsRegistryMergeUtils
     void MergeSettingsToRegistry_ProjectRegistry(SettingsRegistryInterface& registry, const AZStd::string_view platform,
         const SettingsRegistryInterface::Specializations& specializations, AZStd::vector<char>* scratchBuffer = nullptr);
 
+    //! Setting which can be set to false, for instance on the command line, to always merge the registry files in
+    //! MergeSettingsToRegistry_Cached.
+    inline static constexpr char RegistryCacheEnabledKey[] = "/Amazon/AzCore/Settings/RegistryCache/Enabled";
+
+    //! Runs @mergeFunction, which merges registry folders and files such as the engine, gem and project registries, and stores
+    //! the resulting registry in a binary file in <ProjectUserPath>/SettingsRegistryCache.
+    //! Later runs load that file instead of parsing and merging the individual files, as long as the registry content before
+    //! the merge (the command line excepted), the specializations, the platform and the merged files, including the list of
+    //! files in each merged folder, are the same. Merges which report errors or run console commands are never cached.
+    //! @mergeFunction must only depend on the registry content and the registry files, which is true for the MergeSettingsToRegistry
+    //! functions that merge folders.
+    //! Note that this function is only called in development builds, release builds run the merges directly.
+    //! @return True if the settings have been loaded from the cache.
+    bool MergeSettingsToRegistry_Cached(SettingsRegistryInterface& registry, const AZStd::string_view platform,
+        const SettingsRegistryInterface::Specializations& specializations, const AZStd::function<void()>& mergeFunction);
+
     //! Adds the development settings added by individual users of the project to the Settings Registry.
     //! Note that this function is only called in development builds and is compiled out in release builds.
     void MergeSettingsToRegistry_ProjectUserRegistry(SettingsRegistryInterface& registry, const AZStd::string_view platform,
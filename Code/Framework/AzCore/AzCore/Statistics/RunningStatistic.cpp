@@ -55,6 +55,40 @@ namespace AZ
             m_average = newAverage;
         }
 
+        void RunningStatistic::Merge(const RunningStatistic& other)
+        {
+            if (other.m_numSamples == 0)
+            {
+                return;
+            }
+
+            if (m_numSamples == 0)
+            {
+                *this = other;
+                return;
+            }
+
+            //Combines the averages and variance trackings of both sample sets,
+            //see the parallel algorithm in the references of the header.
+            const AZ::u64 numSamples = m_numSamples + other.m_numSamples;
+            const double delta = other.m_average - m_average;
+            const double otherWeight = static_cast<double>(other.m_numSamples) / numSamples;
+            m_average = m_average + delta * otherWeight;
+            m_varianceTracking = m_varianceTracking + other.m_varianceTracking + delta * delta * m_numSamples * otherWeight;
+
+            m_numSamples = numSamples;
+            m_mostRecentSample = other.m_mostRecentSample;
+            m_sum += other.m_sum;
+            if (other.m_minimum < m_minimum)
+            {
+                m_minimum = other.m_minimum;
+            }
+            if (other.m_maximum > m_maximum)
+            {
+                m_maximum = other.m_maximum;
+            }
+        }
+
         double RunningStatistic::GetVariance(VarianceType varianceType) const
         {
             if (m_numSamples > 1)
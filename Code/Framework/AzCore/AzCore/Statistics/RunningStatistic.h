@@ -51,6 +51,12 @@ namespace AZ
 
             void PushSample(double value);
 
+            /**
+             * Adds the samples tracked by another statistic to this one, as if they had been pushed here.
+             * The most recent sample becomes the most recent sample of the other statistic.
+             */
+            void Merge(const RunningStatistic& other);
+
             AZ::u64 GetNumSamples() const
             {
                 return m_numSamples;
@@ -9,7 +9,13 @@
 #include <AzCore/EBus/BusImpl.h> //Just to get AZ::NullMutex
 #include <AzCore/std/chrono/types.h>
 #include <AzCore/Statistics/StatisticsManager.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/scoped_lock.h>
+#include <AzCore/std/parallel/spin_mutex.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/typetraits/is_same.h>
 
 namespace AZ
 {
@@ -30,6 +36,9 @@ namespace AZ
         //! StatisticalProfiler<AZ::Crc32, AZStd::mutex>.
         //! The UnitTests mentioned in the first paragraph do benchmarks of different combinations
         //! of indexing and synchronization primitives.
+        //! Profilers with a mutex accumulate the samples of each thread in a shard owned by that thread,
+        //! so threads pushing samples don't contend with each other. The shards are merged into the
+        //! statistics of the StatisticsManager whenever statistics are read.
         //!
         //! Even though you can create, subclass and use your own StatisticalProfiler<*,*>, there
         //! are some things to consider when working with the StatisticalProfilerProxy:
@@ -72,10 +81,12 @@ namespace AZ
             friend class TimedScope;
 
             StatisticalProfiler()
+                : m_profilerId(s_nextProfilerId++)
             {
             }
 
             StatisticalProfiler(const StatisticalProfiler& other)
+                : m_profilerId(s_nextProfilerId++)
             {
                 m_statisticsManager = other.m_statisticsManager;
                 m_statsVector.clear();
@@ -83,7 +94,12 @@ namespace AZ
             }
 
             StatisticalProfiler(StatisticalProfiler&& other)
+                : m_profilerId(s_nextProfilerId++)
             {
+                {
+                    AZStd::scoped_lock<MutexType> lock(other.m_mutex);
+                    other.MergeThreadShards();
+                }
                 m_statisticsManager = AZStd::move(other.m_statisticsManager);
                 m_perFrameAggregates = AZStd::move(other.m_perFrameAggregates);
             }
@@ -102,6 +118,7 @@ namespace AZ
             double SummarizePerFrameStats()
             {
                 AZStd::scoped_lock<MutexType> lock(m_mutex);
+                MergeThreadShards();
 
                 if (m_perFrameAggregates.size() < 1)
                 {
@@ -133,6 +150,7 @@ namespace AZ
             void LogAndResetStats(const char* windowName)
             {
                 AZStd::scoped_lock<MutexType> lock(m_mutex);
+                MergeThreadShards();
 
                 if (m_statsVector.size() != m_statisticsManager.GetCount())
                 {
@@ -158,17 +176,46 @@ namespace AZ
 
             void PushSample(const StatIdType& statId, double value)
             {
-                AZStd::scoped_lock<MutexType> lock(m_mutex);
-                AZ::Statistics::NamedRunningStatistic* stat = m_statisticsManager.GetStatistic(statId);
-                if (!stat)
+                if constexpr (UsesThreadShards)
+                {
+                    ThreadShard& shard = GetThreadShard();
+                    {
+                        AZStd::scoped_lock<AZStd::spin_mutex> shardLock(shard.m_mutex);
+                        auto shardStatIt = shard.m_statistics.find(statId);
+                        if (shardStatIt != shard.m_statistics.end())
+                        {
+                            shardStatIt->second.PushSample(value);
+                            return;
+                        }
+                    }
+
+                    // First sample of this statistic on this thread
+                    {
+                        AZStd::scoped_lock<MutexType> lock(m_mutex);
+                        if (!m_statisticsManager.GetStatistic(statId))
+                        {
+                            return;
+                        }
+                    }
+                    AZStd::scoped_lock<AZStd::spin_mutex> shardLock(shard.m_mutex);
+                    shard.m_statistics[statId].PushSample(value);
+                }
+                else
                 {
-                    return;
+                    AZStd::scoped_lock<MutexType> lock(m_mutex);
+                    AZ::Statistics::NamedRunningStatistic* stat = m_statisticsManager.GetStatistic(statId);
+                    if (!stat)
+                    {
+                        return;
+                    }
+                    stat->PushSample(value);
                 }
-                stat->PushSample(value);
             }
 
             const AZ::Statistics::NamedRunningStatistic* GetStatistic(const StatIdType& statId)
             {
+                AZStd::scoped_lock<MutexType> lock(m_mutex);
+                MergeThreadShards();
                 return m_statisticsManager.GetStatistic(statId);
             }
 
@@ -225,6 +272,82 @@ namespace AZ
             }
 
         protected:
+            static constexpr bool UsesThreadShards = !AZStd::is_same_v<MutexType, AZ::NullMutex>;
+
+            //! The samples pushed by one thread since the last time the shards were merged.
+            struct ThreadShard
+            {
+                AZStd::thread_id m_threadId;
+                //! Only contended while the shards are merged
+                AZStd::spin_mutex m_mutex;
+                AZStd::unordered_map<StatIdType, AZ::Statistics::RunningStatistic> m_statistics;
+            };
+
+            //! Returns the shard of the calling thread, creating it on the first sample pushed by the thread.
+            ThreadShard& GetThreadShard()
+            {
+                // A few profilers per thread are remembered without any lock, the profiler address and id
+                // are both checked since a destroyed profiler's address can be reused
+                struct CachedShard
+                {
+                    const StatisticalProfiler* m_profiler;
+                    AZ::u64 m_profilerId;
+                    ThreadShard* m_shard;
+                };
+                static constexpr size_t CachedShardCount = 8;
+                thread_local CachedShard t_cachedShards[CachedShardCount] = {};
+
+                CachedShard& cachedShard = t_cachedShards[m_profilerId % CachedShardCount];
+                if (cachedShard.m_profiler == this && cachedShard.m_profilerId == m_profilerId)
+                {
+                    return *cachedShard.m_shard;
+                }
+
+                AZStd::scoped_lock<MutexType> lock(m_mutex);
+                const AZStd::thread_id threadId = AZStd::this_thread::get_id();
+                auto shardIt = AZStd::find_if(m_threadShards.begin(), m_threadShards.end(),
+                    [threadId](const AZStd::unique_ptr<ThreadShard>& shard) { return shard->m_threadId == threadId; });
+                ThreadShard* shard = nullptr;
+                if (shardIt != m_threadShards.end())
+                {
+                    shard = shardIt->get();
+                }
+                else
+                {
+                    m_threadShards.emplace_back(AZStd::make_unique<ThreadShard>());
+                    shard = m_threadShards.back().get();
+                    shard->m_threadId = threadId;
+                }
+                cachedShard = CachedShard{ this, m_profilerId, shard };
+                return *shard;
+            }
+
+            //! Moves the samples of all the thread shards into m_statisticsManager, m_mutex must be locked.
+            void MergeThreadShards()
+            {
+                for (AZStd::unique_ptr<ThreadShard>& shard : m_threadShards)
+                {
+                    AZStd::scoped_lock<AZStd::spin_mutex> shardLock(shard->m_mutex);
+                    for (auto& shardStat : shard->m_statistics)
+                    {
+                        if (shardStat.second.GetNumSamples() == 0)
+                        {
+                            continue;
+                        }
+                        if (AZ::Statistics::NamedRunningStatistic* stat = m_statisticsManager.GetStatistic(shardStat.first))
+                        {
+                            stat->Merge(shardStat.second);
+                        }
+                        shardStat.second.Reset();
+                    }
+                }
+            }
+
+            inline static AZStd::atomic<AZ::u64> s_nextProfilerId{ 1 };
+            AZ::u64 m_profilerId;
+            //! Owned here so they outlive the threads that pushed samples in them
+            AZStd::vector<AZStd::unique_ptr<ThreadShard>> m_threadShards;
+
             //! Lock this before reading/writing to m_timeStatisticsManager, or else...
             MutexType m_mutex;
             AZ::Statistics::StatisticsManager<StatIdType> m_statisticsManager;
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Time/ITime.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ
+{
+    //! @class TimingWheel
+    //! @brief Hierarchical timing wheel of values indexed by a deadline in milliseconds.
+    //! Insert and Remove are O(1), and expired values are popped in deadline order (values sharing a deadline in insertion order).
+    //! The wheel has four levels of 256 slots, each slot of a level covering a full rotation of the level below it.
+    //! A value lands in the lowest level able to hold its deadline and moves down a level each time the wheel reaches its slot,
+    //! deadlines beyond the last level (about 49 days) are kept aside until the last level completes a rotation.
+    template <typename T>
+    class TimingWheel
+    {
+    public:
+        using Id = uint32_t;
+        static constexpr Id InvalidId = static_cast<Id>(-1);
+
+        //! @param startTimeMs time of the first deadline the wheel can expire. Earlier deadlines expire on the first PopExpired().
+        explicit TimingWheel(TimeMs startTimeMs = TimeMs{ 0 });
+
+        //! Removes all the values and restarts the wheel at the provided time.
+        //! @param startTimeMs time of the first deadline the wheel can expire
+        void Reset(TimeMs startTimeMs = TimeMs{ 0 });
+
+        //! Adds a value to the wheel.
+        //! @param value      the value to add
+        //! @param deadlineMs the time from which PopExpired() can return the value
+        //! @return identifier of the value, valid until the value is removed or popped
+        Id Insert(const T& value, TimeMs deadlineMs);
+
+        //! Removes a value from the wheel.
+        //! @param id identifier returned by Insert() for a value still in the wheel
+        void Remove(Id id);
+
+        //! Returns the value of an identifier returned by Insert(), for a value still in the wheel.
+        T& GetValue(Id id);
+        const T& GetValue(Id id) const;
+
+        //! Returns the deadline a value was inserted with.
+        TimeMs GetDeadline(Id id) const;
+
+        //! Pops the value with the earliest deadline, if that deadline is before or at the provided time.
+        //! @param currentTimeMs the current time, which should never decrease between calls
+        //! @param outValue      set to the popped value
+        //! @return true if a value was popped, false if no value has expired
+        bool PopExpired(TimeMs currentTimeMs, T& outValue);
+
+        //! Returns true if a value has a deadline before or at the provided time.
+        //! @param currentTimeMs the current time, which should never decrease between calls
+        bool HasExpired(TimeMs currentTimeMs);
+
+        //! Returns the number of values in the wheel.
+        size_t GetSize() const;
+
+        //! Returns true if the wheel holds no value.
+        bool IsEmpty() const;
+
+    private:
+        static constexpr uint32_t SlotBits = 8;
+        static constexpr uint32_t SlotCount = 1 << SlotBits;
+        static constexpr uint64_t SlotMask = SlotCount - 1;
+        static constexpr uint32_t LevelCount = 4;
+        static constexpr uint32_t OverflowList = LevelCount * SlotCount;
+        //! Values inserted with a deadline the wheel already went past
+        static constexpr uint32_t ExpiredList = OverflowList + 1;
+        static constexpr uint32_t ListCount = ExpiredList + 1;
+        static constexpr uint32_t FreeList = ListCount;
+        static constexpr uint32_t BitmapWordsPerLevel = SlotCount / 64;
+
+        struct Node
+        {
+            T m_value{};
+            uint64_t m_deadline = 0;
+            Id m_previous = InvalidId;
+            Id m_next = InvalidId;
+            uint32_t m_list = FreeList;
+        };
+
+        struct List
+        {
+            Id m_head = InvalidId;
+            Id m_tail = InvalidId;
+        };
+
+        //! Returns the list holding values due at the provided deadline, relative to the current tick.
+        uint32_t GetListForDeadline(uint64_t deadline) const;
+        void Link(Id id, uint32_t list);
+        void Unlink(Id id);
+        //! Moves the values of a list to the lists matching their deadline from the current tick.
+        void Redistribute(uint32_t list);
+        //! Called when the current tick reaches the start of a rotation of level 0, moves the values of the higher levels down.
+        void Cascade();
+        //! Returns the first non empty slot of a level from slot index, SlotCount if there is none.
+        uint32_t FindNextSlot(uint32_t level, uint32_t slotIndex) const;
+        //! Returns the start of the next non empty slot after the current tick, where values may expire or move down a level.
+        uint64_t GetNextEventTick() const;
+        //! Advances the wheel up to the provided time and returns the first expired value, InvalidId if there is none.
+        Id FindExpired(TimeMs currentTimeMs);
+
+        AZStd::vector<Node> m_nodes;
+        AZStd::array<List, ListCount> m_lists;
+        AZStd::array<uint64_t, LevelCount * BitmapWordsPerLevel> m_slotBitmaps;
+        Id m_freeHead = InvalidId;
+        size_t m_size = 0;
+        //! The earliest deadline that hasn't been expired yet
+        uint64_t m_currentTick = 0;
+    };
+}
+
+#include <AzCore/Time/TimingWheel.inl>
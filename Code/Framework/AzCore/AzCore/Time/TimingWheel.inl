@@ -0,0 +1,316 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Debug/Trace.h>
+#include <AzCore/Math/MathIntrinsics.h>
+#include <AzCore/std/algorithm.h>
+
+namespace AZ
+{
+    namespace Internal
+    {
+        inline uint64_t ToTimingWheelTick(TimeMs timeMs)
+        {
+            return static_cast<uint64_t>(AZStd::max<int64_t>(static_cast<int64_t>(timeMs), 0));
+        }
+    }
+
+    template <typename T>
+    inline TimingWheel<T>::TimingWheel(TimeMs startTimeMs)
+    {
+        Reset(startTimeMs);
+    }
+
+    template <typename T>
+    inline void TimingWheel<T>::Reset(TimeMs startTimeMs)
+    {
+        m_nodes.clear();
+        m_lists.fill(List{});
+        m_slotBitmaps.fill(0);
+        m_freeHead = InvalidId;
+        m_size = 0;
+        m_currentTick = Internal::ToTimingWheelTick(startTimeMs);
+    }
+
+    template <typename T>
+    inline typename TimingWheel<T>::Id TimingWheel<T>::Insert(const T& value, TimeMs deadlineMs)
+    {
+        Id id = m_freeHead;
+        if (id != InvalidId)
+        {
+            m_freeHead = m_nodes[id].m_next;
+        }
+        else
+        {
+            id = static_cast<Id>(m_nodes.size());
+            m_nodes.emplace_back();
+        }
+
+        Node& node = m_nodes[id];
+        node.m_value = value;
+        node.m_deadline = Internal::ToTimingWheelTick(deadlineMs);
+        Link(id, GetListForDeadline(node.m_deadline));
+        ++m_size;
+        return id;
+    }
+
+    template <typename T>
+    inline void TimingWheel<T>::Remove(Id id)
+    {
+        AZ_Assert(id < m_nodes.size() && m_nodes[id].m_list != FreeList, "Invalid timing wheel id %u", id);
+        Unlink(id);
+
+        Node& node = m_nodes[id];
+        node.m_value = T{};
+        node.m_list = FreeList;
+        node.m_next = m_freeHead;
+        m_freeHead = id;
+        --m_size;
+    }
+
+    template <typename T>
+    inline T& TimingWheel<T>::GetValue(Id id)
+    {
+        AZ_Assert(id < m_nodes.size() && m_nodes[id].m_list != FreeList, "Invalid timing wheel id %u", id);
+        return m_nodes[id].m_value;
+    }
+
+    template <typename T>
+    inline const T& TimingWheel<T>::GetValue(Id id) const
+    {
+        AZ_Assert(id < m_nodes.size() && m_nodes[id].m_list != FreeList, "Invalid timing wheel id %u", id);
+        return m_nodes[id].m_value;
+    }
+
+    template <typename T>
+    inline TimeMs TimingWheel<T>::GetDeadline(Id id) const
+    {
+        AZ_Assert(id < m_nodes.size() && m_nodes[id].m_list != FreeList, "Invalid timing wheel id %u", id);
+        return TimeMs{ static_cast<int64_t>(m_nodes[id].m_deadline) };
+    }
+
+    template <typename T>
+    inline bool TimingWheel<T>::PopExpired(TimeMs currentTimeMs, T& outValue)
+    {
+        const Id expired = FindExpired(currentTimeMs);
+        if (expired == InvalidId)
+        {
+            return false;
+        }
+
+        outValue = AZStd::move(m_nodes[expired].m_value);
+        Remove(expired);
+        return true;
+    }
+
+    template <typename T>
+    inline bool TimingWheel<T>::HasExpired(TimeMs currentTimeMs)
+    {
+        return FindExpired(currentTimeMs) != InvalidId;
+    }
+
+    template <typename T>
+    inline size_t TimingWheel<T>::GetSize() const
+    {
+        return m_size;
+    }
+
+    template <typename T>
+    inline bool TimingWheel<T>::IsEmpty() const
+    {
+        return m_size == 0;
+    }
+
+    template <typename T>
+    inline uint32_t TimingWheel<T>::GetListForDeadline(uint64_t deadline) const
+    {
+        if (deadline < m_currentTick)
+        {
+            return ExpiredList;
+        }
+
+        // The first level where the deadline and the current tick only differ by the level's slot
+        const uint64_t differentBits = deadline ^ m_currentTick;
+        for (uint32_t level = 0; level < LevelCount; ++level)
+        {
+            if ((differentBits >> (SlotBits * (level + 1))) == 0)
+            {
+                return level * SlotCount + static_cast<uint32_t>((deadline >> (SlotBits * level)) & SlotMask);
+            }
+        }
+        return OverflowList;
+    }
+
+    template <typename T>
+    inline void TimingWheel<T>::Link(Id id, uint32_t list)
+    {
+        Node& node = m_nodes[id];
+        List& nodeList = m_lists[list];
+        node.m_list = list;
+        node.m_previous = nodeList.m_tail;
+        node.m_next = InvalidId;
+        if (nodeList.m_tail != InvalidId)
+        {
+            m_nodes[nodeList.m_tail].m_next = id;
+        }
+        else
+        {
+            nodeList.m_head = id;
+            if (list < OverflowList)
+            {
+                m_slotBitmaps[list / 64] |= uint64_t{ 1 } << (list % 64);
+            }
+        }
+        nodeList.m_tail = id;
+    }
+
+    template <typename T>
+    inline void TimingWheel<T>::Unlink(Id id)
+    {
+        Node& node = m_nodes[id];
+        List& nodeList = m_lists[node.m_list];
+        if (node.m_previous != InvalidId)
+        {
+            m_nodes[node.m_previous].m_next = node.m_next;
+        }
+        else
+        {
+            nodeList.m_head = node.m_next;
+        }
+        if (node.m_next != InvalidId)
+        {
+            m_nodes[node.m_next].m_previous = node.m_previous;
+        }
+        else
+        {
+            nodeList.m_tail = node.m_previous;
+        }
+
+        if (nodeList.m_head == InvalidId && node.m_list < OverflowList)
+        {
+            m_slotBitmaps[node.m_list / 64] &= ~(uint64_t{ 1 } << (node.m_list % 64));
+        }
+        node.m_previous = InvalidId;
+        node.m_next = InvalidId;
+    }
+
+    template <typename T>
+    inline void TimingWheel<T>::Redistribute(uint32_t list)
+    {
+        Id id = m_lists[list].m_head;
+        m_lists[list] = List{};
+        if (list < OverflowList)
+        {
+            m_slotBitmaps[list / 64] &= ~(uint64_t{ 1 } << (list % 64));
+        }
+
+        while (id != InvalidId)
+        {
+            const Id next = m_nodes[id].m_next;
+            Link(id, GetListForDeadline(m_nodes[id].m_deadline));
+            id = next;
+        }
+    }
+
+    template <typename T>
+    inline void TimingWheel<T>::Cascade()
+    {
+        // Every level whose lower levels all start a rotation moves its current slot down, highest level first
+        uint32_t level = 1;
+        while (level < LevelCount && ((m_currentTick >> (SlotBits * level)) & SlotMask) == 0)
+        {
+            ++level;
+        }
+        if (level == LevelCount)
+        {
+            Redistribute(OverflowList);
+            level = LevelCount - 1;
+        }
+        for (; level > 0; --level)
+        {
+            Redistribute(level * SlotCount + static_cast<uint32_t>((m_currentTick >> (SlotBits * level)) & SlotMask));
+        }
+    }
+
+    template <typename T>
+    inline uint32_t TimingWheel<T>::FindNextSlot(uint32_t level, uint32_t slotIndex) const
+    {
+        if (slotIndex >= SlotCount)
+        {
+            return SlotCount;
+        }
+
+        const uint64_t* levelBitmap = &m_slotBitmaps[level * BitmapWordsPerLevel];
+        uint32_t word = slotIndex / 64;
+        uint64_t bits = levelBitmap[word] & (~uint64_t{ 0 } << (slotIndex % 64));
+        while (bits == 0)
+        {
+            if (++word == BitmapWordsPerLevel)
+            {
+                return SlotCount;
+            }
+            bits = levelBitmap[word];
+        }
+        return word * 64 + static_cast<uint32_t>(az_ctz_u64(bits));
+    }
+
+    template <typename T>
+    inline typename TimingWheel<T>::Id TimingWheel<T>::FindExpired(TimeMs currentTimeMs)
+    {
+        // Deadlines the wheel already went past when they were inserted expire first
+        if (const Id expired = m_lists[ExpiredList].m_head; expired != InvalidId)
+        {
+            return expired;
+        }
+
+        const uint64_t currentTick = Internal::ToTimingWheelTick(currentTimeMs);
+        while (m_currentTick <= currentTick)
+        {
+            if (m_size == 0)
+            {
+                // Nothing to cascade, jump straight to the current time
+                m_currentTick = currentTick + 1;
+                break;
+            }
+
+            const Id head = m_lists[static_cast<uint32_t>(m_currentTick & SlotMask)].m_head;
+            if (head != InvalidId)
+            {
+                return head;
+            }
+
+            // Skip the empty slots of all levels
+            m_currentTick = AZStd::min(GetNextEventTick(), currentTick + 1);
+            if ((m_currentTick & SlotMask) == 0)
+            {
+                Cascade();
+            }
+        }
+        return InvalidId;
+    }
+
+    template <typename T>
+    inline uint64_t TimingWheel<T>::GetNextEventTick() const
+    {
+        // The slots of a level before its current one are empty, and so is the current one of level 0 when this is called.
+        // When a level has no value left in its rotation, the next event is at most the next slot of the level above.
+        for (uint32_t level = 0; level < LevelCount; ++level)
+        {
+            const uint32_t shift = SlotBits * level;
+            const uint32_t slotIndex = static_cast<uint32_t>((m_currentTick >> shift) & SlotMask);
+            const uint32_t nextSlot = FindNextSlot(level, slotIndex + 1);
+            if (nextSlot < SlotCount)
+            {
+                return ((m_currentTick >> shift) - slotIndex + nextSlot) << shift;
+            }
+        }
+        // The values left are in the overflow list
+        return ((m_currentTick >> (SlotBits * LevelCount)) + 1) << (SlotBits * LevelCount);
+    }
+}
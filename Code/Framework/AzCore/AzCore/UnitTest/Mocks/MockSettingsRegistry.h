@@ -49,6 +49,8 @@ namespace AZ
         MOCK_METHOD5(
             MergeSettingsFolder,
             bool(AZStd::string_view, const Specializations&, AZStd::string_view, AZStd::string_view, AZStd::vector<char>*));
+        MOCK_CONST_METHOD2(SaveSettingsBinary, bool(AZStd::vector<char>&, AZStd::string_view));
+        MOCK_METHOD2(LoadSettingsBinary, bool(AZStd::string_view, AZStd::string_view));
 
         MOCK_METHOD1(SetApplyPatchSettings, void(const JsonApplyPatchSettings&));
         MOCK_METHOD1(GetApplyPatchSettings, void(JsonApplyPatchSettings&));
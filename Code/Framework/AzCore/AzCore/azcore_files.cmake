@@ -55,6 +55,7 @@ set(FILES
     Component/NamedEntityId.h
     Component/NonUniformScaleBus.cpp
     Component/NonUniformScaleBus.h
+    Component/TickBus.cpp
     Component/TickBus.h
     Component/TransformBus.h
     Console/Console.cpp
@@ -66,6 +67,7 @@ set(FILES
     Console/ConsoleFunctor.inl
     Console/ConsoleTypeHelpers.h
     Console/ConsoleTypeHelpers.inl
+    Console/ConsoleVariableHandle.h
     Console/IConsole.h
     Console/IConsoleTypes.h
     Console/ILogger.h
@@ -132,6 +134,7 @@ set(FILES
     EBus/BusImpl.h
     EBus/EBus.h
     EBus/EBusEnvironment.cpp
+    EBus/EBusProfiler.cpp
     EBus/Environment.h
     EBus/Event.h
     EBus/Event.inl
@@ -150,6 +153,8 @@ set(FILES
     EBus/Internal/CallstackEntry.h
     EBus/Internal/Debug.h
     EBus/Internal/Handlers.h
+    EBus/Internal/Profiling.h
+    EBus/Internal/QueuedMessageCall.h
     EBus/Internal/StoragePolicies.h
     Interface/Interface.h
     IO/ByteContainerStream.h
@@ -192,6 +197,8 @@ set(FILES
     IO/Streamer/FileRequest.cpp
     IO/Streamer/FullFileDecompressor.h
     IO/Streamer/FullFileDecompressor.cpp
+    IO/Streamer/ReadCoalescer.h
+    IO/Streamer/ReadCoalescer.cpp
     IO/Streamer/ReadSplitter.h
     IO/Streamer/ReadSplitter.cpp
     IO/Streamer/RequestPath.h
@@ -228,6 +235,8 @@ set(FILES
     Jobs/JobContext.h
     Jobs/JobEmpty.h
     Jobs/JobFunction.h
+    Jobs/JobGraph.cpp
+    Jobs/JobGraph.h
     Jobs/JobManager.cpp
     Jobs/JobManager.h
     Jobs/JobManagerBus.h
@@ -248,6 +257,8 @@ set(FILES
     Math/Crc.cpp
     Math/Crc.inl
     Math/Crc.h
+    Math/Crc32c.cpp
+    Math/Crc32c.h
     Math/DocsMath.h
     Math/Frustum.cpp
     Math/Frustum.h
@@ -255,6 +266,7 @@ set(FILES
     Math/Geometry2DUtils.cpp
     Math/Geometry2DUtils.h
     Math/Guid.h
+    Math/Internal/Crc32Slicing.h
     Math/Internal/MathTypes.h
     Math/Internal/SimdMathVec1_neon.inl
     Math/Internal/SimdMathVec1_scalar.inl
@@ -268,6 +280,8 @@ set(FILES
     Math/Internal/SimdMathVec4_neon.inl
     Math/Internal/SimdMathVec4_scalar.inl
     Math/Internal/SimdMathVec4_sse.inl
+    Math/Internal/SimdMathVec8_avx.inl
+    Math/Internal/SimdMathVec8_vec4.inl
     Math/Internal/SimdMathCommon_neon.inl
     Math/Internal/SimdMathCommon_neonDouble.inl
     Math/Internal/SimdMathCommon_neonQuad.inl
@@ -312,16 +326,21 @@ set(FILES
     Math/Quaternion.cpp
     Math/Quaternion.inl
     Math/Quaternion.h
+    Math/QuaternionBatch.h
+    Math/QuaternionBatch.inl
     Math/Random.h
     Math/Sfmt.cpp
     Math/Sfmt.h
     Math/ShapeIntersection.h
     Math/ShapeIntersection.inl
+    Math/SimdBatch.cpp
+    Math/SimdBatch.h
     Math/SimdMath.h
     Math/SimdMathVec1.h
     Math/SimdMathVec2.h
     Math/SimdMathVec3.h
     Math/SimdMathVec4.h
+    Math/SimdMathVec8.h
     Math/Sha1.h
     Math/Spline.cpp
     Math/Spline.h
@@ -342,6 +361,8 @@ set(FILES
     Math/Vector3.cpp
     Math/Vector3.h
     Math/Vector3.inl
+    Math/Vector3Batch.h
+    Math/Vector3Batch.inl
     Math/Vector4.cpp
     Math/Vector4.h
     Math/Vector4.inl
@@ -349,6 +370,8 @@ set(FILES
     Math/VertexContainer.h
     Math/VertexContainer.cpp
     Math/VertexContainerInterface.h
+    Math/XxHash64.cpp
+    Math/XxHash64.h
     Math/PackedVector3.h
     Math/Color.h
     Math/Color.cpp
@@ -377,8 +400,13 @@ set(FILES
     Memory/HphaSchema.h
     Memory/IAllocator.cpp
     Memory/IAllocator.h
+    Memory/LinearAllocator.h
+    Memory/LinearSchema.cpp
+    Memory/LinearSchema.h
     Memory/MallocSchema.cpp
     Memory/MallocSchema.h
+    Memory/MemoryBudgetTracker.cpp
+    Memory/MemoryBudgetTracker.h
     Memory/Memory.cpp
     Memory/Memory.h
     Memory/MemoryComponent.cpp
@@ -621,6 +649,8 @@ set(FILES
     Time/ITime.h
     Time/TimeSystemComponent.cpp
     Time/TimeSystemComponent.h
+    Time/TimingWheel.h
+    Time/TimingWheel.inl
 )
 
 # Prevent the following files from being grouped in UNITY builds
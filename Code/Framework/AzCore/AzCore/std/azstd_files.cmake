@@ -19,6 +19,7 @@ set(FILES
     createdestroy.h
     docs.h
     exceptions.h
+    flat_hash_table.h
     functional.h
     functional_basic.h
     hash.cpp
@@ -49,6 +50,8 @@ set(FILES
     containers/fixed_list.h
     containers/fixed_unordered_map.h
     containers/fixed_unordered_set.h
+    containers/flat_hash_map.h
+    containers/flat_hash_set.h
     containers/fixed_vector.h
     containers/forward_list.h
     containers/intrusive_list.h
@@ -61,6 +64,8 @@ set(FILES
     containers/rbtree.h
     containers/ring_buffer.h
     containers/set.h
+    containers/small_vector.h
+    containers/span.h
     containers/stack.h
     containers/unordered_map.h
     containers/unordered_set.h
@@ -96,6 +101,7 @@ set(FILES
     parallel/containers/lock_free_stack.h
     parallel/containers/lock_free_stamped_queue.h
     parallel/containers/lock_free_stamped_stack.h
+    parallel/containers/mpmc_queue.h
     parallel/containers/internal/concurrent_hash_table.h
     delegate/delegate.h
     delegate/delegate_bind.h
@@ -0,0 +1,257 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/std/flat_hash_table.h>
+#include <AzCore/std/tuple.h>
+
+namespace AZStd
+{
+    namespace Internal
+    {
+        template<class Key, class MappedType, class Hasher, class EqualKey, class Allocator>
+        struct FlatHashMapTableTraits
+        {
+            typedef Key                             key_type;
+            typedef EqualKey                        key_eq;
+            typedef Hasher                          hasher;
+            typedef AZStd::pair<Key, MappedType>    value_type;
+            typedef Allocator                       allocator_type;
+
+            static AZ_FORCE_INLINE const key_type& key_from_value(const value_type& value) { return value.first; }
+        };
+    }
+
+    /**
+     * Open addressing map with pair(Key,MappedType) elements stored inline, all Keys are unique.
+     * It has the interface of unordered_map without the bucket and node handle functions, lookups
+     * are several times faster and there is no allocation per element.
+     * Any insert can move the elements: all iterators, pointers and references are invalidated when the
+     * map grows. Use unordered_map when element addresses must stay stable.
+     * Check \ref flat_hash_table for more details.
+     */
+    template<class Key, class MappedType, class Hasher = AZStd::hash<Key>, class EqualKey = AZStd::equal_to<Key>, class Allocator = AZStd::allocator>
+    class flat_hash_map
+        : public Internal::flat_hash_table<Internal::FlatHashMapTableTraits<Key, MappedType, Hasher, EqualKey, Allocator>>
+    {
+        typedef flat_hash_map<Key, MappedType, Hasher, EqualKey, Allocator> this_type;
+        typedef Internal::flat_hash_table<Internal::FlatHashMapTableTraits<Key, MappedType, Hasher, EqualKey, Allocator>> base_type;
+    public:
+        typedef typename base_type::traits_type traits_type;
+
+        typedef typename base_type::key_type    key_type;
+        typedef typename base_type::key_eq      key_eq;
+        typedef typename base_type::hasher      hasher;
+        typedef MappedType                      mapped_type;
+
+        typedef typename base_type::allocator_type              allocator_type;
+        typedef typename base_type::size_type                   size_type;
+        typedef typename base_type::difference_type             difference_type;
+        typedef typename base_type::pointer                     pointer;
+        typedef typename base_type::const_pointer               const_pointer;
+        typedef typename base_type::reference                   reference;
+        typedef typename base_type::const_reference             const_reference;
+
+        typedef typename base_type::iterator                    iterator;
+        typedef typename base_type::const_iterator              const_iterator;
+
+        typedef typename base_type::value_type                  value_type;
+        typedef typename base_type::pair_iter_bool              pair_iter_bool;
+
+        flat_hash_map()
+            : base_type(hasher(), key_eq(), allocator_type()) {}
+        explicit flat_hash_map(const allocator_type& alloc)
+            : base_type(hasher(), key_eq(), alloc) {}
+        flat_hash_map(const flat_hash_map& rhs)
+            : base_type(rhs) {}
+        flat_hash_map(flat_hash_map&& rhs)
+            : base_type(AZStd::move(rhs)) {}
+        flat_hash_map(const hasher& hash, const key_eq& keyEqual, const allocator_type& allocator)
+            : base_type(hash, keyEqual, allocator) {}
+        explicit flat_hash_map(size_type numSlotsHint, const hasher& hash = hasher(), const key_eq& keyEqual = key_eq(), const allocator_type& allocator = allocator_type())
+            : base_type(hash, keyEqual, allocator)
+        {
+            base_type::rehash(numSlotsHint);
+        }
+        template<class Iterator>
+        flat_hash_map(Iterator first, Iterator last, size_type numSlotsHint = 0, const hasher& hash = hasher(), const key_eq& keyEqual = key_eq(), const allocator_type& allocator = allocator_type())
+            : base_type(hash, keyEqual, allocator)
+        {
+            base_type::rehash(numSlotsHint);
+            base_type::insert(first, last);
+        }
+        flat_hash_map(const std::initializer_list<value_type>& list, const hasher& hash = hasher(), const key_eq& keyEqual = key_eq(), const allocator_type& allocator = allocator_type())
+            : base_type(hash, keyEqual, allocator)
+        {
+            base_type::reserve(list.size());
+            base_type::insert(list.begin(), list.end());
+        }
+
+        this_type& operator=(this_type&& rhs)
+        {
+            base_type::operator=(AZStd::move(rhs));
+            return *this;
+        }
+
+        this_type& operator=(const this_type& rhs)
+        {
+            base_type::operator=(rhs);
+            return *this;
+        }
+
+        /**
+         * Look up operator if element doesn't exists inserts a new one with (key,mapped_type()).
+         */
+        mapped_type& operator[](const key_type& key)
+        {
+            return try_emplace(key).first->second;
+        }
+        mapped_type& operator[](key_type&& key)
+        {
+            return try_emplace(AZStd::move(key)).first->second;
+        }
+        /**
+         * Returns mapped type with based on the key, if the element doesn't exist an assert it triggered!
+         */
+        mapped_type& at(const key_type& key)
+        {
+            iterator iter = base_type::find(key);
+            AZSTD_CONTAINER_ASSERT(iter != base_type::end(), "Element with key is not present");
+            return iter->second;
+        }
+        const mapped_type& at(const key_type& key) const
+        {
+            const_iterator iter = base_type::find(key);
+            AZSTD_CONTAINER_ASSERT(iter != base_type::end(), "Element with key is not present");
+            return iter->second;
+        }
+
+        using base_type::insert;
+
+        //! C++17 insert_or_assign function assigns the element to the mapped_type if the key exist in the container
+        //! Otherwise a new value is inserted into the container
+        template <typename M>
+        pair_iter_bool insert_or_assign(const key_type& key, M&& value)
+        {
+            pair_iter_bool result = try_emplace(key, AZStd::forward<M>(value));
+            if (!result.second)
+            {
+                result.first->second = AZStd::forward<M>(value);
+            }
+            return result;
+        }
+        template <typename M>
+        pair_iter_bool insert_or_assign(key_type&& key, M&& value)
+        {
+            pair_iter_bool result = try_emplace(AZStd::move(key), AZStd::forward<M>(value));
+            if (!result.second)
+            {
+                result.first->second = AZStd::forward<M>(value);
+            }
+            return result;
+        }
+        template <typename M>
+        iterator insert_or_assign(const_iterator, const key_type& key, M&& value)
+        {
+            return insert_or_assign(key, AZStd::forward<M>(value)).first;
+        }
+        template <typename M>
+        iterator insert_or_assign(const_iterator, key_type&& key, M&& value)
+        {
+            return insert_or_assign(AZStd::move(key), AZStd::forward<M>(value)).first;
+        }
+
+        //! C++17 try_emplace function that does nothing to the arguments if the key exist in the container,
+        //! otherwise it constructs the value type in place as if invoking
+        //! value_type(AZStd::piecewise_construct, AZStd::forward_as_tuple(AZStd::forward<KeyType>(key)),
+        //!  AZStd::forward_as_tuple(AZStd::forward<Args>(args)...))
+        template <typename... Args>
+        pair_iter_bool try_emplace(const key_type& key, Args&&... arguments)
+        {
+            return try_emplace_impl(key, AZStd::forward<Args>(arguments)...);
+        }
+        template <typename... Args>
+        pair_iter_bool try_emplace(key_type&& key, Args&&... arguments)
+        {
+            return try_emplace_impl(AZStd::move(key), AZStd::forward<Args>(arguments)...);
+        }
+        template <typename... Args>
+        iterator try_emplace(const_iterator, const key_type& key, Args&&... arguments)
+        {
+            return try_emplace_impl(key, AZStd::forward<Args>(arguments)...).first;
+        }
+        template <typename... Args>
+        iterator try_emplace(const_iterator, key_type&& key, Args&&... arguments)
+        {
+            return try_emplace_impl(AZStd::move(key), AZStd::forward<Args>(arguments)...).first;
+        }
+
+    private:
+        template <typename KeyType, typename... Args>
+        pair_iter_bool try_emplace_impl(KeyType&& key, Args&&... arguments)
+        {
+            const pair<size_type, bool> result = base_type::find_or_prepare_insert(key);
+            if (result.second)
+            {
+                AZStd::construct_at(base_type::slot_at(result.first), AZStd::piecewise_construct,
+                    AZStd::forward_as_tuple(AZStd::forward<KeyType>(key)), AZStd::forward_as_tuple(AZStd::forward<Args>(arguments)...));
+            }
+            return pair_iter_bool(base_type::iterator_at(result.first), result.second);
+        }
+    };
+
+    template<class Key, class MappedType, class Hasher, class EqualKey, class Allocator>
+    AZ_FORCE_INLINE void swap(flat_hash_map<Key, MappedType, Hasher, EqualKey, Allocator>& left, flat_hash_map<Key, MappedType, Hasher, EqualKey, Allocator>& right)
+    {
+        left.swap(right);
+    }
+
+    //! The element order depends on the insertion history, so the maps are compared with lookups.
+    template <class Key, class MappedType, class Hasher, class EqualKey, class Allocator>
+    bool operator==(const flat_hash_map<Key, MappedType, Hasher, EqualKey, Allocator>& a, const flat_hash_map<Key, MappedType, Hasher, EqualKey, Allocator>& b)
+    {
+        if (a.size() != b.size())
+        {
+            return false;
+        }
+        for (const auto& element : a)
+        {
+            auto it = b.find(element.first);
+            if (it == b.end() || !(it->second == element.second))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template <class Key, class MappedType, class Hasher, class EqualKey, class Allocator>
+    AZ_FORCE_INLINE bool operator!=(const flat_hash_map<Key, MappedType, Hasher, EqualKey, Allocator>& a, const flat_hash_map<Key, MappedType, Hasher, EqualKey, Allocator>& b)
+    {
+        return !(a == b);
+    }
+
+    template<class Key, class MappedType, class Hasher, class EqualKey, class Allocator, class Predicate>
+    decltype(auto) erase_if(flat_hash_map<Key, MappedType, Hasher, EqualKey, Allocator>& container, Predicate predicate)
+    {
+        auto originalSize = container.size();
+
+        for (auto iter = container.begin(); iter != container.end(); )
+        {
+            if (predicate(*iter))
+            {
+                iter = container.erase(iter);
+            }
+            else
+            {
+                ++iter;
+            }
+        }
+
+        return originalSize - container.size();
+    }
+} // namespace AZStd
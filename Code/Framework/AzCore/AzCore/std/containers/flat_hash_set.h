@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/std/flat_hash_table.h>
+
+namespace AZStd
+{
+    namespace Internal
+    {
+        template<class Key, class Hasher, class EqualKey, class Allocator>
+        struct FlatHashSetTableTraits
+        {
+            typedef Key         key_type;
+            typedef EqualKey    key_eq;
+            typedef Hasher      hasher;
+            typedef Key         value_type;
+            typedef Allocator   allocator_type;
+
+            static AZ_FORCE_INLINE const key_type& key_from_value(const value_type& value) { return value; }
+        };
+    }
+
+    /**
+     * Open addressing set with the keys stored inline, the interface is the one of unordered_set without
+     * the bucket and node handle functions.
+     * Any insert can move the elements: all iterators, pointers and references are invalidated when the
+     * set grows. Use unordered_set when element addresses must stay stable.
+     * Check \ref flat_hash_table for more details.
+     */
+    template<class Key, class Hasher = AZStd::hash<Key>, class EqualKey = AZStd::equal_to<Key>, class Allocator = AZStd::allocator>
+    class flat_hash_set
+        : public Internal::flat_hash_table<Internal::FlatHashSetTableTraits<Key, Hasher, EqualKey, Allocator>>
+    {
+        typedef flat_hash_set<Key, Hasher, EqualKey, Allocator> this_type;
+        typedef Internal::flat_hash_table<Internal::FlatHashSetTableTraits<Key, Hasher, EqualKey, Allocator>> base_type;
+    public:
+        typedef typename base_type::traits_type traits_type;
+
+        typedef typename base_type::key_type    key_type;
+        typedef typename base_type::key_eq      key_eq;
+        typedef typename base_type::hasher      hasher;
+
+        typedef typename base_type::allocator_type              allocator_type;
+        typedef typename base_type::size_type                   size_type;
+        typedef typename base_type::difference_type             difference_type;
+        typedef typename base_type::pointer                     pointer;
+        typedef typename base_type::const_pointer               const_pointer;
+        typedef typename base_type::reference                   reference;
+        typedef typename base_type::const_reference             const_reference;
+
+        typedef typename base_type::iterator                    iterator;
+        typedef typename base_type::const_iterator              const_iterator;
+
+        typedef typename base_type::value_type                  value_type;
+        typedef typename base_type::pair_iter_bool              pair_iter_bool;
+
+        flat_hash_set()
+            : base_type(hasher(), key_eq(), allocator_type()) {}
+        explicit flat_hash_set(const allocator_type& alloc)
+            : base_type(hasher(), key_eq(), alloc) {}
+        flat_hash_set(const flat_hash_set& rhs)
+            : base_type(rhs) {}
+        flat_hash_set(flat_hash_set&& rhs)
+            : base_type(AZStd::move(rhs)) {}
+        flat_hash_set(const hasher& hash, const key_eq& keyEqual, const allocator_type& allocator)
+            : base_type(hash, keyEqual, allocator) {}
+        explicit flat_hash_set(size_type numSlotsHint, const hasher& hash = hasher(), const key_eq& keyEqual = key_eq(), const allocator_type& allocator = allocator_type())
+            : base_type(hash, keyEqual, allocator)
+        {
+            base_type::rehash(numSlotsHint);
+        }
+        template<class Iterator>
+        flat_hash_set(Iterator first, Iterator last, size_type numSlotsHint = 0, const hasher& hash = hasher(), const key_eq& keyEqual = key_eq(), const allocator_type& allocator = allocator_type())
+            : base_type(hash, keyEqual, allocator)
+        {
+            base_type::rehash(numSlotsHint);
+            base_type::insert(first, last);
+        }
+        flat_hash_set(const std::initializer_list<value_type>& list, const hasher& hash = hasher(), const key_eq& keyEqual = key_eq(), const allocator_type& allocator = allocator_type())
+            : base_type(hash, keyEqual, allocator)
+        {
+            base_type::reserve(list.size());
+            base_type::insert(list.begin(), list.end());
+        }
+
+        this_type& operator=(this_type&& rhs)
+        {
+            base_type::operator=(AZStd::move(rhs));
+            return *this;
+        }
+
+        this_type& operator=(const this_type& rhs)
+        {
+            base_type::operator=(rhs);
+            return *this;
+        }
+    };
+
+    template<class Key, class Hasher, class EqualKey, class Allocator>
+    AZ_FORCE_INLINE void swap(flat_hash_set<Key, Hasher, EqualKey, Allocator>& left, flat_hash_set<Key, Hasher, EqualKey, Allocator>& right)
+    {
+        left.swap(right);
+    }
+
+    template <class Key, class Hasher, class EqualKey, class Allocator>
+    bool operator==(const flat_hash_set<Key, Hasher, EqualKey, Allocator>& a, const flat_hash_set<Key, Hasher, EqualKey, Allocator>& b)
+    {
+        if (a.size() != b.size())
+        {
+            return false;
+        }
+        for (const auto& element : a)
+        {
+            if (!b.contains(element))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template <class Key, class Hasher, class EqualKey, class Allocator>
+    AZ_FORCE_INLINE bool operator!=(const flat_hash_set<Key, Hasher, EqualKey, Allocator>& a, const flat_hash_set<Key, Hasher, EqualKey, Allocator>& b)
+    {
+        return !(a == b);
+    }
+
+    template<class Key, class Hasher, class EqualKey, class Allocator, class Predicate>
+    decltype(auto) erase_if(flat_hash_set<Key, Hasher, EqualKey, Allocator>& container, Predicate predicate)
+    {
+        auto originalSize = container.size();
+
+        for (auto iter = container.begin(); iter != container.end(); )
+        {
+            if (predicate(*iter))
+            {
+                iter = container.erase(iter);
+            }
+            else
+            {
+                ++iter;
+            }
+        }
+
+        return originalSize - container.size();
+    }
+} // namespace AZStd
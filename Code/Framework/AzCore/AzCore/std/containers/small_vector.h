@@ -0,0 +1,541 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/allocator.h>
+#include <AzCore/std/createdestroy.h>
+#include <AzCore/std/iterator.h>
+#include <AzCore/std/typetraits/typetraits.h>
+
+namespace AZStd
+{
+    /**
+     * Vector which stores up to InlineCapacity elements inside the object and only uses the allocator
+     * once it grows past them. Use it for short lists built in hot code (per draw item, per query...),
+     * where AZStd::vector would allocate for every instance and fixed_vector would set a hard limit.
+     * A small_vector which spilled to the allocator keeps its heap storage until shrink_to_fit is called.
+     *
+     * Unlike vector, moving a small_vector which uses its inline storage moves the elements one by one,
+     * so iterators to the moved from container are not transferred.
+     * Check the small_vector \ref AZStdExamples.
+     */
+    template<class T, AZStd::size_t InlineCapacity, class Allocator = AZStd::allocator>
+    class small_vector
+    {
+        static_assert(InlineCapacity > 0, "small_vector needs at least one inline element, use vector instead");
+        typedef small_vector<T, InlineCapacity, Allocator> this_type;
+
+    public:
+        typedef T*                                          pointer;
+        typedef const T*                                    const_pointer;
+        typedef T&                                          reference;
+        typedef const T&                                    const_reference;
+        typedef typename Allocator::difference_type         difference_type;
+        typedef typename Allocator::size_type               size_type;
+        typedef pointer                                     iterator;
+        typedef const_pointer                               const_iterator;
+        typedef AZStd::reverse_iterator<iterator>           reverse_iterator;
+        typedef AZStd::reverse_iterator<const_iterator>     const_reverse_iterator;
+        typedef T                                           value_type;
+        typedef Allocator                                   allocator_type;
+
+        // AZStd extension.
+        typedef value_type                                  node_type;
+
+        static constexpr size_type inline_capacity = InlineCapacity;
+
+        small_vector() = default;
+
+        explicit small_vector(const allocator_type& allocator)
+            : m_allocator(allocator)
+        {
+        }
+
+        explicit small_vector(size_type numElements)
+        {
+            resize(numElements);
+        }
+
+        small_vector(size_type numElements, const_reference value, const allocator_type& allocator = allocator_type())
+            : m_allocator(allocator)
+        {
+            assign(numElements, value);
+        }
+
+        template <class InputIt, typename = enable_if_t<Internal::is_input_iterator_v<InputIt>>>
+        small_vector(InputIt first, InputIt last, const allocator_type& allocator = allocator_type())
+            : m_allocator(allocator)
+        {
+            assign(first, last);
+        }
+
+        small_vector(AZStd::initializer_list<value_type> list, const allocator_type& allocator = allocator_type())
+            : m_allocator(allocator)
+        {
+            assign(list.begin(), list.end());
+        }
+
+        small_vector(const small_vector& rhs)
+            : m_allocator(rhs.m_allocator)
+        {
+            assign(rhs.begin(), rhs.end());
+        }
+
+        small_vector(small_vector&& rhs)
+            : m_allocator(rhs.m_allocator)
+        {
+            move_from(rhs);
+        }
+
+        ~small_vector()
+        {
+            clear();
+            deallocate_memory();
+        }
+
+        small_vector& operator=(const small_vector& rhs)
+        {
+            if (this != &rhs)
+            {
+                assign(rhs.begin(), rhs.end());
+            }
+            return *this;
+        }
+
+        small_vector& operator=(small_vector&& rhs)
+        {
+            if (this != &rhs)
+            {
+                clear();
+                deallocate_memory();
+                move_from(rhs);
+            }
+            return *this;
+        }
+
+        small_vector& operator=(AZStd::initializer_list<value_type> list)
+        {
+            assign(list.begin(), list.end());
+            return *this;
+        }
+
+        void assign(size_type numElements, const_reference value)
+        {
+            clear();
+            if (numElements > m_capacity)
+            {
+                // value can live in this container, copy it before the storage is released
+                value_type valueCopy(value);
+                reallocate(numElements);
+                AZStd::uninitialized_fill_n(m_start, numElements, valueCopy);
+            }
+            else
+            {
+                AZStd::uninitialized_fill_n(m_start, numElements, value);
+            }
+            m_size = numElements;
+        }
+
+        template <class InputIt, typename = enable_if_t<Internal::is_input_iterator_v<InputIt>>>
+        void assign(InputIt first, InputIt last)
+        {
+            clear();
+            if constexpr (Internal::is_forward_iterator_v<InputIt>)
+            {
+                const size_type numElements = static_cast<size_type>(AZStd::distance(first, last));
+                reserve(numElements);
+                AZStd::uninitialized_copy(first, last, m_start);
+                m_size = numElements;
+            }
+            else
+            {
+                for (; first != last; ++first)
+                {
+                    emplace_back(*first);
+                }
+            }
+        }
+
+        void assign(AZStd::initializer_list<value_type> list)
+        {
+            assign(list.begin(), list.end());
+        }
+
+        iterator begin() { return m_start; }
+        const_iterator begin() const { return m_start; }
+        const_iterator cbegin() const { return m_start; }
+        iterator end() { return m_start + m_size; }
+        const_iterator end() const { return m_start + m_size; }
+        const_iterator cend() const { return m_start + m_size; }
+        reverse_iterator rbegin() { return reverse_iterator(end()); }
+        const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+        const_reverse_iterator crbegin() const { return const_reverse_iterator(end()); }
+        reverse_iterator rend() { return reverse_iterator(begin()); }
+        const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+        const_reverse_iterator crend() const { return const_reverse_iterator(begin()); }
+
+        size_type size() const { return m_size; }
+        size_type max_size() const { return m_allocator.get_max_size() / sizeof(value_type); }
+        size_type capacity() const { return m_capacity; }
+        bool empty() const { return m_size == 0; }
+        //! Returns true while the elements are stored inside the object.
+        bool is_inline() const { return m_start == inline_data(); }
+
+        pointer data() { return m_start; }
+        const_pointer data() const { return m_start; }
+
+        reference operator[](size_type position)
+        {
+            AZSTD_CONTAINER_ASSERT(position < m_size, "AZStd::small_vector<>::operator[] - position is out of range");
+            return m_start[position];
+        }
+        const_reference operator[](size_type position) const
+        {
+            AZSTD_CONTAINER_ASSERT(position < m_size, "AZStd::small_vector<>::operator[] - position is out of range");
+            return m_start[position];
+        }
+        reference at(size_type position) { return operator[](position); }
+        const_reference at(size_type position) const { return operator[](position); }
+
+        reference front()
+        {
+            AZSTD_CONTAINER_ASSERT(m_size != 0, "AZStd::small_vector<>::front - container is empty!");
+            return m_start[0];
+        }
+        const_reference front() const
+        {
+            AZSTD_CONTAINER_ASSERT(m_size != 0, "AZStd::small_vector<>::front - container is empty!");
+            return m_start[0];
+        }
+        reference back()
+        {
+            AZSTD_CONTAINER_ASSERT(m_size != 0, "AZStd::small_vector<>::back - container is empty!");
+            return m_start[m_size - 1];
+        }
+        const_reference back() const
+        {
+            AZSTD_CONTAINER_ASSERT(m_size != 0, "AZStd::small_vector<>::back - container is empty!");
+            return m_start[m_size - 1];
+        }
+
+        void push_back(const_reference value)
+        {
+            emplace_back(value);
+        }
+
+        void push_back(value_type&& value)
+        {
+            emplace_back(AZStd::move(value));
+        }
+
+        template<class... Args>
+        reference emplace_back(Args&&... args)
+        {
+            if (m_size == m_capacity)
+            {
+                // The arguments can reference an element of this container, construct the new element before moving the old ones
+                const size_type newCapacity = grow_capacity(m_size + 1);
+                pointer newStart = allocate_memory(newCapacity);
+                AZStd::construct_at(newStart + m_size, AZStd::forward<Args>(args)...);
+                relocate(newStart, newCapacity);
+            }
+            else
+            {
+                AZStd::construct_at(m_start + m_size, AZStd::forward<Args>(args)...);
+            }
+            return m_start[m_size++];
+        }
+
+        void pop_back()
+        {
+            AZSTD_CONTAINER_ASSERT(m_size != 0, "AZStd::small_vector<>::pop_back - no elements to pop!");
+            AZStd::destroy_at(m_start + --m_size);
+        }
+
+        template<class... Args>
+        iterator emplace(const_iterator insertPos, Args&&... args)
+        {
+            const size_type offset = static_cast<size_type>(insertPos - m_start);
+            AZSTD_CONTAINER_ASSERT(offset <= m_size, "AZStd::small_vector<>::emplace - insert position is out of range");
+            if (offset == m_size)
+            {
+                emplace_back(AZStd::forward<Args>(args)...);
+            }
+            else
+            {
+                value_type value(AZStd::forward<Args>(args)...);
+                emplace_back(AZStd::move(back()));
+                AZStd::move_backward(m_start + offset, m_start + m_size - 2, m_start + m_size - 1);
+                m_start[offset] = AZStd::move(value);
+            }
+            return m_start + offset;
+        }
+
+        iterator insert(const_iterator insertPos, const_reference value)
+        {
+            return emplace(insertPos, value);
+        }
+
+        iterator insert(const_iterator insertPos, value_type&& value)
+        {
+            return emplace(insertPos, AZStd::move(value));
+        }
+
+        iterator insert(const_iterator insertPos, size_type numElements, const_reference value)
+        {
+            const size_type offset = static_cast<size_type>(insertPos - m_start);
+            const size_type oldSize = m_size;
+            if (numElements)
+            {
+                value_type valueCopy(value);
+                reserve(m_size + numElements);
+                AZStd::uninitialized_fill_n(m_start + m_size, numElements, valueCopy);
+                m_size += numElements;
+                AZStd::rotate(m_start + offset, m_start + oldSize, m_start + m_size);
+            }
+            return m_start + offset;
+        }
+
+        template <class InputIt, typename = enable_if_t<Internal::is_input_iterator_v<InputIt>>>
+        iterator insert(const_iterator insertPos, InputIt first, InputIt last)
+        {
+            // Append the new elements and rotate them into place, which also handles input iterators
+            const size_type offset = static_cast<size_type>(insertPos - m_start);
+            const size_type oldSize = m_size;
+            for (; first != last; ++first)
+            {
+                emplace_back(*first);
+            }
+            AZStd::rotate(m_start + offset, m_start + oldSize, m_start + m_size);
+            return m_start + offset;
+        }
+
+        iterator insert(const_iterator insertPos, AZStd::initializer_list<value_type> list)
+        {
+            return insert(insertPos, list.begin(), list.end());
+        }
+
+        iterator erase(const_iterator erasePos)
+        {
+            return erase(erasePos, erasePos + 1);
+        }
+
+        iterator erase(const_iterator first, const_iterator last)
+        {
+            pointer firstPtr = m_start + (first - m_start);
+            pointer lastPtr = m_start + (last - m_start);
+            AZSTD_CONTAINER_ASSERT(firstPtr >= m_start && firstPtr <= lastPtr && lastPtr <= m_start + m_size,
+                "AZStd::small_vector<>::erase - invalid range");
+            if (firstPtr != lastPtr)
+            {
+                pointer newEnd = AZStd::move(lastPtr, m_start + m_size, firstPtr);
+                AZStd::destroy(newEnd, m_start + m_size);
+                m_size = static_cast<size_type>(newEnd - m_start);
+            }
+            return firstPtr;
+        }
+
+        void clear()
+        {
+            AZStd::destroy(m_start, m_start + m_size);
+            m_size = 0;
+        }
+
+        void resize(size_type newSize)
+        {
+            if (newSize < m_size)
+            {
+                erase(m_start + newSize, m_start + m_size);
+            }
+            else if (newSize > m_size)
+            {
+                reserve(newSize);
+                for (; m_size < newSize; ++m_size)
+                {
+                    AZStd::construct_at(m_start + m_size);
+                }
+            }
+        }
+
+        void resize(size_type newSize, const_reference value)
+        {
+            if (newSize < m_size)
+            {
+                erase(m_start + newSize, m_start + m_size);
+            }
+            else if (newSize > m_size)
+            {
+                insert(end(), newSize - m_size, value);
+            }
+        }
+
+        void reserve(size_type numElements)
+        {
+            if (numElements > m_capacity)
+            {
+                reallocate(numElements);
+            }
+        }
+
+        //! Releases the heap storage when it isn't fully used, moving the elements back inside the object when they fit.
+        void shrink_to_fit()
+        {
+            if (!is_inline() && m_size < m_capacity)
+            {
+                if (m_size <= InlineCapacity)
+                {
+                    relocate(inline_data(), InlineCapacity);
+                }
+                else
+                {
+                    reallocate(m_size);
+                }
+            }
+        }
+
+        void swap(this_type& rhs)
+        {
+            if (this == &rhs)
+            {
+                return;
+            }
+            if (!is_inline() && !rhs.is_inline() && m_allocator == rhs.m_allocator)
+            {
+                AZStd::swap(m_start, rhs.m_start);
+                AZStd::swap(m_size, rhs.m_size);
+                AZStd::swap(m_capacity, rhs.m_capacity);
+            }
+            else
+            {
+                this_type temp(AZStd::move(rhs));
+                rhs = AZStd::move(*this);
+                *this = AZStd::move(temp);
+            }
+        }
+
+        allocator_type& get_allocator() { return m_allocator; }
+        const allocator_type& get_allocator() const { return m_allocator; }
+
+        bool validate() const
+        {
+            if (m_size > m_capacity || m_capacity < InlineCapacity)
+            {
+                return false;
+            }
+            return is_inline() ? m_capacity == InlineCapacity : m_start != nullptr;
+        }
+
+    private:
+        pointer inline_data() { return reinterpret_cast<pointer>(m_inlineStorage); }
+        const_pointer inline_data() const { return reinterpret_cast<const_pointer>(m_inlineStorage); }
+
+        size_type grow_capacity(size_type minCapacity) const
+        {
+            return AZStd::GetMax(minCapacity, m_capacity + m_capacity / 2);
+        }
+
+        pointer allocate_memory(size_type capacity)
+        {
+            return static_cast<pointer>(m_allocator.allocate(capacity * sizeof(value_type), alignment_of<value_type>::value));
+        }
+
+        void deallocate_memory()
+        {
+            if (!is_inline())
+            {
+                m_allocator.deallocate(m_start, m_capacity * sizeof(value_type), alignment_of<value_type>::value);
+                m_start = inline_data();
+                m_capacity = InlineCapacity;
+            }
+        }
+
+        //! Moves the elements to newStart and releases the current heap storage.
+        void relocate(pointer newStart, size_type newCapacity)
+        {
+            AZStd::uninitialized_move(m_start, m_start + m_size, newStart);
+            AZStd::destroy(m_start, m_start + m_size);
+            deallocate_memory();
+            m_start = newStart;
+            m_capacity = newCapacity;
+        }
+
+        void reallocate(size_type newCapacity)
+        {
+            relocate(allocate_memory(newCapacity), newCapacity);
+        }
+
+        //! Takes the heap storage of rhs or moves its inline elements, this container must be empty and inline.
+        void move_from(this_type& rhs)
+        {
+            if (!rhs.is_inline() && m_allocator == rhs.m_allocator)
+            {
+                m_start = rhs.m_start;
+                m_size = rhs.m_size;
+                m_capacity = rhs.m_capacity;
+                rhs.m_start = rhs.inline_data();
+                rhs.m_size = 0;
+                rhs.m_capacity = InlineCapacity;
+            }
+            else
+            {
+                reserve(rhs.m_size);
+                AZStd::uninitialized_move(rhs.m_start, rhs.m_start + rhs.m_size, m_start);
+                m_size = rhs.m_size;
+                rhs.clear();
+            }
+        }
+
+        pointer m_start = inline_data();
+        size_type m_size = 0;
+        size_type m_capacity = InlineCapacity;
+        allocator_type m_allocator;
+        alignas(T) unsigned char m_inlineStorage[InlineCapacity * sizeof(T)];
+    };
+
+    template<class T, AZStd::size_t InlineCapacity, class Allocator>
+    AZ_FORCE_INLINE bool operator==(const small_vector<T, InlineCapacity, Allocator>& left, const small_vector<T, InlineCapacity, Allocator>& right)
+    {
+        return left.size() == right.size() && AZStd::equal(left.begin(), left.end(), right.begin());
+    }
+
+    template<class T, AZStd::size_t InlineCapacity, class Allocator>
+    AZ_FORCE_INLINE bool operator!=(const small_vector<T, InlineCapacity, Allocator>& left, const small_vector<T, InlineCapacity, Allocator>& right)
+    {
+        return !(left == right);
+    }
+
+    template<class T, AZStd::size_t InlineCapacity, class Allocator>
+    AZ_FORCE_INLINE bool operator<(const small_vector<T, InlineCapacity, Allocator>& left, const small_vector<T, InlineCapacity, Allocator>& right)
+    {
+        return AZStd::lexicographical_compare(left.begin(), left.end(), right.begin(), right.end());
+    }
+
+    template<class T, AZStd::size_t InlineCapacity, class Allocator>
+    AZ_FORCE_INLINE void swap(small_vector<T, InlineCapacity, Allocator>& left, small_vector<T, InlineCapacity, Allocator>& right)
+    {
+        left.swap(right);
+    }
+
+    template<class T, AZStd::size_t InlineCapacity, class Allocator, class U>
+    decltype(auto) erase(small_vector<T, InlineCapacity, Allocator>& container, const U& value)
+    {
+        auto iter = AZStd::remove(container.begin(), container.end(), value);
+        auto removedCount = AZStd::distance(iter, container.end());
+        container.erase(iter, container.end());
+        return removedCount;
+    }
+
+    template<class T, AZStd::size_t InlineCapacity, class Allocator, class Predicate>
+    decltype(auto) erase_if(small_vector<T, InlineCapacity, Allocator>& container, Predicate predicate)
+    {
+        auto iter = AZStd::remove_if(container.begin(), container.end(), predicate);
+        auto removedCount = AZStd::distance(iter, container.end());
+        container.erase(iter, container.end());
+        return removedCount;
+    }
+} // namespace AZStd
@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/iterator.h>
+#include <AzCore/std/typetraits/is_convertible.h>
+#include <AzCore/std/typetraits/remove_cv.h>
+#include <AzCore/std/typetraits/remove_pointer.h>
+#include <AzCore/std/utils.h>
+
+// Same as in array.h, allows asserts in constexpr functions
+#define AZSTD_CONTAINER_COMPILETIME_ASSERT(expression, ...) \
+    if (!(expression)) \
+    { \
+        AZ_Assert(expression, __VA_ARGS__); \
+    }
+
+namespace AZStd
+{
+    inline constexpr size_t dynamic_extent = static_cast<size_t>(-1);
+
+    /**
+     * Non owning view over a contiguous sequence of elements, based on C++20 std::span.
+     * Unlike AZStd::basic_string_view the elements can be modified, use span<const T> for a read only view.
+     * Only the dynamic extent is supported, the number of elements is always stored in the span.
+     * The span is only valid as long as the memory it points to is valid.
+     *
+     * Usage:
+     *     void Scale(AZStd::span<float> values, float scale);
+     *     AZStd::vector<float> values(128);
+     *     Scale(values, 2.0f);
+     */
+    template<class T, size_t Extent = dynamic_extent>
+    class span final
+    {
+        static_assert(Extent == dynamic_extent, "AZStd::span only supports a dynamic extent");
+
+        template<class Container>
+        using container_element_t = AZStd::remove_pointer_t<decltype(AZStd::data(AZStd::declval<Container&>()))>;
+
+        // Containers are accepted if their elements can be used as T (e.g. non-const to const)
+        template<class Container>
+        using enable_if_compatible_container_t = AZStd::enable_if_t<
+            AZStd::is_convertible_v<container_element_t<Container>(*)[], T(*)[]> &&
+            AZStd::is_convertible_v<decltype(AZStd::size(AZStd::declval<Container&>())), size_t>>;
+
+    public:
+        using element_type = T;
+        using value_type = AZStd::remove_cv_t<T>;
+        using size_type = size_t;
+        using difference_type = ptrdiff_t;
+        using pointer = T*;
+        using const_pointer = const T*;
+        using reference = T&;
+        using const_reference = const T&;
+        using iterator = T*;
+        using const_iterator = const T*;
+        using reverse_iterator = AZStd::reverse_iterator<iterator>;
+        using const_reverse_iterator = AZStd::reverse_iterator<const_iterator>;
+
+        static constexpr size_t extent = Extent;
+
+        constexpr span() = default;
+
+        constexpr span(pointer first, size_type count)
+            : m_data(first)
+            , m_size(count)
+        {}
+
+        constexpr span(pointer first, pointer last)
+            : m_data(first)
+            , m_size(static_cast<size_type>(last - first))
+        {}
+
+        template<size_t N>
+        constexpr span(element_type (&arr)[N])
+            : m_data(arr)
+            , m_size(N)
+        {}
+
+        template<class Container, class = enable_if_compatible_container_t<Container>>
+        constexpr span(Container& container)
+            : m_data(AZStd::data(container))
+            , m_size(AZStd::size(container))
+        {}
+
+        template<class Container, class = enable_if_compatible_container_t<const Container>>
+        constexpr span(const Container& container)
+            : m_data(AZStd::data(container))
+            , m_size(AZStd::size(container))
+        {}
+
+        // Allows span<T> to span<const T> conversion
+        template<class U, class = AZStd::enable_if_t<AZStd::is_convertible_v<U(*)[], T(*)[]>>>
+        constexpr span(const span<U>& other)
+            : m_data(other.data())
+            , m_size(other.size())
+        {}
+
+        constexpr span(const span&) = default;
+        constexpr span& operator=(const span&) = default;
+
+        constexpr iterator begin() const { return m_data; }
+        constexpr iterator end() const { return m_data + m_size; }
+        constexpr const_iterator cbegin() const { return m_data; }
+        constexpr const_iterator cend() const { return m_data + m_size; }
+        constexpr reverse_iterator rbegin() const { return reverse_iterator(end()); }
+        constexpr reverse_iterator rend() const { return reverse_iterator(begin()); }
+
+        constexpr reference operator[](size_type index) const
+        {
+            AZSTD_CONTAINER_COMPILETIME_ASSERT(index < m_size, "AZStd::span - index %zu is out of range (size %zu)", index, m_size);
+            return m_data[index];
+        }
+
+        constexpr reference front() const
+        {
+            AZSTD_CONTAINER_COMPILETIME_ASSERT(m_size > 0, "AZStd::span - calling front on an empty span");
+            return m_data[0];
+        }
+
+        constexpr reference back() const
+        {
+            AZSTD_CONTAINER_COMPILETIME_ASSERT(m_size > 0, "AZStd::span - calling back on an empty span");
+            return m_data[m_size - 1];
+        }
+
+        constexpr pointer data() const { return m_data; }
+        constexpr size_type size() const { return m_size; }
+        constexpr size_type size_bytes() const { return m_size * sizeof(element_type); }
+        [[nodiscard]] constexpr bool empty() const { return m_size == 0; }
+
+        //! Returns a span of the first count elements.
+        constexpr span first(size_type count) const
+        {
+            AZSTD_CONTAINER_COMPILETIME_ASSERT(count <= m_size, "AZStd::span - count %zu is out of range (size %zu)", count, m_size);
+            return span(m_data, count);
+        }
+
+        //! Returns a span of the last count elements.
+        constexpr span last(size_type count) const
+        {
+            AZSTD_CONTAINER_COMPILETIME_ASSERT(count <= m_size, "AZStd::span - count %zu is out of range (size %zu)", count, m_size);
+            return span(m_data + (m_size - count), count);
+        }
+
+        //! Returns a span of count elements starting at offset, or all the remaining elements if count is dynamic_extent.
+        constexpr span subspan(size_type offset, size_type count = dynamic_extent) const
+        {
+            AZSTD_CONTAINER_COMPILETIME_ASSERT(offset <= m_size, "AZStd::span - offset %zu is out of range (size %zu)", offset, m_size);
+            const size_type remaining = m_size - offset;
+            AZSTD_CONTAINER_COMPILETIME_ASSERT(count == dynamic_extent || count <= remaining, "AZStd::span - count %zu is out of range (%zu remaining)", count, remaining);
+            return span(m_data + offset, count == dynamic_extent ? remaining : count);
+        }
+
+    private:
+        pointer m_data = nullptr;
+        size_type m_size = 0;
+    };
+
+    template<class T, size_t N>
+    span(T (&)[N]) -> span<T>;
+
+    template<class T, size_t N>
+    span(array<T, N>&) -> span<T>;
+
+    template<class T, size_t N>
+    span(const array<T, N>&) -> span<const T>;
+
+    template<class Container>
+    span(Container&) -> span<AZStd::remove_pointer_t<decltype(AZStd::data(AZStd::declval<Container&>()))>>;
+
+    template<class Container>
+    span(const Container&) -> span<AZStd::remove_pointer_t<decltype(AZStd::data(AZStd::declval<const Container&>()))>>;
+} // namespace AZStd
+
+#undef AZSTD_CONTAINER_COMPILETIME_ASSERT
@@ -0,0 +1,913 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/std/allocator.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/createdestroy.h>
+#include <AzCore/std/functional_basic.h>
+#include <AzCore/std/hash.h>
+#include <AzCore/std/iterator.h>
+#include <AzCore/std/typetraits/alignment_of.h>
+#include <AzCore/std/utils.h>
+
+#if AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+#   include <emmintrin.h>
+#endif
+#if defined(AZ_COMPILER_MSVC)
+#   include <intrin.h>
+#endif
+
+namespace AZStd
+{
+    namespace Internal
+    {
+        //! Control byte of a flat_hash_table slot. Full slots store the low 7 bits of the element hash,
+        //! empty and deleted slots have the high bit set so they never match a hash.
+        using flat_hash_ctrl = int8_t;
+        static constexpr flat_hash_ctrl flat_hash_ctrl_empty = -128;
+        static constexpr flat_hash_ctrl flat_hash_ctrl_deleted = -2;
+
+        //! One bit per slot of a flat_hash_group.
+        class flat_hash_bitmask
+        {
+        public:
+            static constexpr uint32_t width = 16;
+
+            explicit flat_hash_bitmask(uint32_t mask)
+                : m_mask(mask)
+            {
+            }
+
+            explicit operator bool() const
+            {
+                return m_mask != 0;
+            }
+
+            //! Index of the lowest set bit, the mask must not be empty.
+            uint32_t lowest_bit_index() const
+            {
+#if defined(AZ_COMPILER_MSVC)
+                unsigned long index;
+                _BitScanForward(&index, m_mask);
+                return static_cast<uint32_t>(index);
+#else
+                return static_cast<uint32_t>(__builtin_ctz(m_mask));
+#endif
+            }
+
+            uint32_t trailing_zeros() const
+            {
+                return m_mask ? lowest_bit_index() : width;
+            }
+
+            uint32_t leading_zeros() const
+            {
+                if (!m_mask)
+                {
+                    return width;
+                }
+#if defined(AZ_COMPILER_MSVC)
+                unsigned long index;
+                _BitScanReverse(&index, m_mask);
+                return width - 1 - static_cast<uint32_t>(index);
+#else
+                return static_cast<uint32_t>(__builtin_clz(m_mask)) - (32 - width);
+#endif
+            }
+
+            void clear_lowest_bit()
+            {
+                m_mask &= m_mask - 1;
+            }
+
+            //! Keeps the bits of the first @count slots.
+            flat_hash_bitmask keep_first(size_t count) const
+            {
+                return count >= width ? *this : flat_hash_bitmask(m_mask & ((1u << count) - 1));
+            }
+
+        private:
+            uint32_t m_mask;
+        };
+
+        //! A group of consecutive control bytes, probed at once.
+        class flat_hash_group
+        {
+        public:
+            static constexpr size_t width = flat_hash_bitmask::width;
+
+#if AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+            explicit flat_hash_group(const flat_hash_ctrl* ctrl)
+                : m_ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl)))
+            {
+            }
+
+            flat_hash_bitmask match(flat_hash_ctrl h2) const
+            {
+                return flat_hash_bitmask(static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), m_ctrl))));
+            }
+
+            flat_hash_bitmask match_empty() const
+            {
+                return match(flat_hash_ctrl_empty);
+            }
+
+            flat_hash_bitmask match_empty_or_deleted() const
+            {
+                return flat_hash_bitmask(static_cast<uint32_t>(_mm_movemask_epi8(m_ctrl)));
+            }
+
+            flat_hash_bitmask match_full() const
+            {
+                return flat_hash_bitmask(static_cast<uint32_t>(_mm_movemask_epi8(m_ctrl)) ^ 0xffff);
+            }
+
+        private:
+            __m128i m_ctrl;
+#else
+            explicit flat_hash_group(const flat_hash_ctrl* ctrl)
+            {
+                for (size_t i = 0; i < width; ++i)
+                {
+                    m_ctrl[i] = ctrl[i];
+                }
+            }
+
+            flat_hash_bitmask match(flat_hash_ctrl h2) const
+            {
+                uint32_t mask = 0;
+                for (size_t i = 0; i < width; ++i)
+                {
+                    mask |= static_cast<uint32_t>(m_ctrl[i] == h2) << i;
+                }
+                return flat_hash_bitmask(mask);
+            }
+
+            flat_hash_bitmask match_empty() const
+            {
+                return match(flat_hash_ctrl_empty);
+            }
+
+            flat_hash_bitmask match_empty_or_deleted() const
+            {
+                uint32_t mask = 0;
+                for (size_t i = 0; i < width; ++i)
+                {
+                    mask |= static_cast<uint32_t>(m_ctrl[i] < 0) << i;
+                }
+                return flat_hash_bitmask(mask);
+            }
+
+            flat_hash_bitmask match_full() const
+            {
+                uint32_t mask = 0;
+                for (size_t i = 0; i < width; ++i)
+                {
+                    mask |= static_cast<uint32_t>(m_ctrl[i] >= 0) << i;
+                }
+                return flat_hash_bitmask(mask);
+            }
+
+        private:
+            flat_hash_ctrl m_ctrl[width];
+#endif
+        };
+
+        /**
+         * Open addressing hash table storing the elements inline ("Swiss table" layout), the implementation
+         * behind flat_hash_map and flat_hash_set.
+         * Each slot has a control byte holding 7 bits of the element hash, lookups compare a whole group of
+         * control bytes at once and only touch the elements whose hash bits match.
+         * Unlike hash_table, any insert can move the elements, invalidating all iterators, pointers and references.
+         * Erasing an element only invalidates the iterators to that element.
+         *
+         * Traits must define key_type, value_type, hasher, key_eq, allocator_type and a static key_from_value(const value_type&).
+         */
+        template<class Traits>
+        class flat_hash_table
+        {
+            typedef flat_hash_table<Traits> this_type;
+
+        public:
+            typedef Traits                                  traits_type;
+            typedef typename Traits::key_type               key_type;
+            typedef typename Traits::key_eq                 key_eq;
+            typedef typename Traits::hasher                 hasher;
+            typedef typename Traits::allocator_type         allocator_type;
+            typedef typename Traits::value_type             value_type;
+
+            typedef value_type*                             pointer;
+            typedef const value_type*                       const_pointer;
+            typedef value_type&                             reference;
+            typedef const value_type&                       const_reference;
+            typedef typename allocator_type::size_type      size_type;
+            typedef typename allocator_type::difference_type difference_type;
+
+            template<bool IsConst>
+            class iterator_impl
+            {
+                friend class flat_hash_table;
+                friend class iterator_impl<!IsConst>;
+
+            public:
+                typedef forward_iterator_tag                                    iterator_category;
+                typedef typename flat_hash_table::value_type                    value_type;
+                typedef typename flat_hash_table::difference_type               difference_type;
+                typedef conditional_t<IsConst, const value_type*, value_type*>  pointer;
+                typedef conditional_t<IsConst, const value_type&, value_type&>  reference;
+
+                iterator_impl() = default;
+
+                //! Non const to const conversion.
+                template<bool WasConst, class = enable_if_t<IsConst && !WasConst>>
+                iterator_impl(const iterator_impl<WasConst>& rhs)
+                    : m_ctrl(rhs.m_ctrl)
+                    , m_ctrlEnd(rhs.m_ctrlEnd)
+                    , m_slot(rhs.m_slot)
+                {
+                }
+
+                reference operator*() const
+                {
+                    return *m_slot;
+                }
+
+                pointer operator->() const
+                {
+                    return m_slot;
+                }
+
+                iterator_impl& operator++()
+                {
+                    ++m_ctrl;
+                    ++m_slot;
+                    skip_empty_slots();
+                    return *this;
+                }
+
+                iterator_impl operator++(int)
+                {
+                    iterator_impl result = *this;
+                    ++(*this);
+                    return result;
+                }
+
+                bool operator==(const iterator_impl& rhs) const
+                {
+                    return m_ctrl == rhs.m_ctrl;
+                }
+
+                bool operator!=(const iterator_impl& rhs) const
+                {
+                    return m_ctrl != rhs.m_ctrl;
+                }
+
+            private:
+                iterator_impl(const flat_hash_ctrl* ctrl, const flat_hash_ctrl* ctrlEnd, value_type* slot)
+                    : m_ctrl(ctrl)
+                    , m_ctrlEnd(ctrlEnd)
+                    , m_slot(slot)
+                {
+                }
+
+                void skip_empty_slots()
+                {
+                    // The control bytes are cloned past the end, so a group can be loaded at any slot
+                    while (m_ctrl != m_ctrlEnd)
+                    {
+                        const size_t remaining = static_cast<size_t>(m_ctrlEnd - m_ctrl);
+                        const flat_hash_bitmask full = flat_hash_group(m_ctrl).match_full().keep_first(remaining);
+                        if (full)
+                        {
+                            const uint32_t offset = full.lowest_bit_index();
+                            m_ctrl += offset;
+                            m_slot += offset;
+                            return;
+                        }
+                        const size_t offset = AZStd::GetMin(remaining, flat_hash_group::width);
+                        m_ctrl += offset;
+                        m_slot += offset;
+                    }
+                }
+
+                const flat_hash_ctrl* m_ctrl = nullptr;
+                const flat_hash_ctrl* m_ctrlEnd = nullptr;
+                value_type* m_slot = nullptr;
+            };
+
+            typedef iterator_impl<false>    iterator;
+            typedef iterator_impl<true>     const_iterator;
+            typedef pair<iterator, bool>    pair_iter_bool;
+
+            flat_hash_table(const hasher& hash, const key_eq& keyEqual, const allocator_type& allocator)
+                : m_hasher(hash)
+                , m_keyEqual(keyEqual)
+                , m_allocator(allocator)
+            {
+            }
+
+            flat_hash_table(const flat_hash_table& rhs)
+                : m_hasher(rhs.m_hasher)
+                , m_keyEqual(rhs.m_keyEqual)
+                , m_allocator(rhs.m_allocator)
+            {
+                copy_from(rhs);
+            }
+
+            flat_hash_table(flat_hash_table&& rhs)
+                : m_hasher(AZStd::move(rhs.m_hasher))
+                , m_keyEqual(AZStd::move(rhs.m_keyEqual))
+                , m_allocator(rhs.m_allocator)
+            {
+                steal_storage(rhs);
+            }
+
+            ~flat_hash_table()
+            {
+                destroy_elements();
+                deallocate_storage();
+            }
+
+            flat_hash_table& operator=(const flat_hash_table& rhs)
+            {
+                if (this != &rhs)
+                {
+                    clear();
+                    m_hasher = rhs.m_hasher;
+                    m_keyEqual = rhs.m_keyEqual;
+                    copy_from(rhs);
+                }
+                return *this;
+            }
+
+            flat_hash_table& operator=(flat_hash_table&& rhs)
+            {
+                if (this != &rhs)
+                {
+                    destroy_elements();
+                    m_hasher = AZStd::move(rhs.m_hasher);
+                    m_keyEqual = AZStd::move(rhs.m_keyEqual);
+                    if (m_allocator == rhs.m_allocator)
+                    {
+                        deallocate_storage();
+                        steal_storage(rhs);
+                    }
+                    else
+                    {
+                        // Different allocators, move the elements one by one
+                        m_size = 0;
+                        m_growthLeft = capacity_to_growth(m_capacity);
+                        reset_ctrl();
+                        reserve(rhs.m_size);
+                        for (value_type& value : rhs)
+                        {
+                            insert_unique_no_check(AZStd::move(value));
+                        }
+                        rhs.clear();
+                    }
+                }
+                return *this;
+            }
+
+            iterator begin()
+            {
+                iterator it(m_ctrl, m_ctrl + m_capacity, m_slots);
+                it.skip_empty_slots();
+                return it;
+            }
+            const_iterator begin() const
+            {
+                const_iterator it(m_ctrl, m_ctrl + m_capacity, m_slots);
+                it.skip_empty_slots();
+                return it;
+            }
+            const_iterator cbegin() const { return begin(); }
+            iterator end() { return iterator(m_ctrl + m_capacity, m_ctrl + m_capacity, m_slots + m_capacity); }
+            const_iterator end() const { return const_iterator(m_ctrl + m_capacity, m_ctrl + m_capacity, m_slots + m_capacity); }
+            const_iterator cend() const { return end(); }
+
+            bool empty() const { return m_size == 0; }
+            size_type size() const { return m_size; }
+            size_type max_size() const { return m_allocator.get_max_size() / sizeof(value_type); }
+            //! Number of slots, the table grows when it is 7/8 full.
+            size_type capacity() const { return m_capacity; }
+            float load_factor() const { return m_capacity ? static_cast<float>(m_size) / static_cast<float>(m_capacity) : 0.0f; }
+            float max_load_factor() const { return static_cast<float>(MaxLoadNumerator) / static_cast<float>(MaxLoadDenominator); }
+
+            hasher hash_function() const { return m_hasher; }
+            key_eq key_eq_function() const { return m_keyEqual; }
+            allocator_type& get_allocator() { return m_allocator; }
+            const allocator_type& get_allocator() const { return m_allocator; }
+
+            pair_iter_bool insert(const value_type& value)
+            {
+                const pair<size_type, bool> result = find_or_prepare_insert(Traits::key_from_value(value));
+                if (result.second)
+                {
+                    AZStd::construct_at(m_slots + result.first, value);
+                }
+                return pair_iter_bool(iterator_at(result.first), result.second);
+            }
+
+            pair_iter_bool insert(value_type&& value)
+            {
+                const pair<size_type, bool> result = find_or_prepare_insert(Traits::key_from_value(value));
+                if (result.second)
+                {
+                    AZStd::construct_at(m_slots + result.first, AZStd::move(value));
+                }
+                return pair_iter_bool(iterator_at(result.first), result.second);
+            }
+
+            iterator insert(const_iterator, const value_type& value)
+            {
+                return insert(value).first;
+            }
+
+            iterator insert(const_iterator, value_type&& value)
+            {
+                return insert(AZStd::move(value)).first;
+            }
+
+            template<class InputIterator>
+            void insert(InputIterator first, InputIterator last)
+            {
+                for (; first != last; ++first)
+                {
+                    insert(*first);
+                }
+            }
+
+            void insert(std::initializer_list<value_type> list)
+            {
+                insert(list.begin(), list.end());
+            }
+
+            template<class... Args>
+            pair_iter_bool emplace(Args&&... args)
+            {
+                value_type value(AZStd::forward<Args>(args)...);
+                return insert(AZStd::move(value));
+            }
+
+            template<class... Args>
+            iterator emplace_hint(const_iterator, Args&&... args)
+            {
+                return emplace(AZStd::forward<Args>(args)...).first;
+            }
+
+            iterator find(const key_type& key)
+            {
+                const size_type index = find_index(key);
+                return index == m_capacity ? end() : iterator_at(index);
+            }
+
+            const_iterator find(const key_type& key) const
+            {
+                const size_type index = find_index(key);
+                return index == m_capacity ? end() : const_iterator(m_ctrl + index, m_ctrl + m_capacity, m_slots + index);
+            }
+
+            bool contains(const key_type& key) const
+            {
+                return find_index(key) != m_capacity;
+            }
+
+            size_type count(const key_type& key) const
+            {
+                return contains(key) ? 1 : 0;
+            }
+
+            pair<iterator, iterator> equal_range(const key_type& key)
+            {
+                iterator first = find(key);
+                iterator last = first;
+                return pair<iterator, iterator>(first, first == end() ? last : ++last);
+            }
+
+            pair<const_iterator, const_iterator> equal_range(const key_type& key) const
+            {
+                const_iterator first = find(key);
+                const_iterator last = first;
+                return pair<const_iterator, const_iterator>(first, first == end() ? last : ++last);
+            }
+
+            iterator erase(const_iterator pos)
+            {
+                const size_type index = static_cast<size_type>(pos.m_ctrl - m_ctrl);
+                erase_at(index);
+                iterator next = iterator_at(index);
+                next.skip_empty_slots();
+                return next;
+            }
+
+            iterator erase(iterator pos)
+            {
+                return erase(const_iterator(pos));
+            }
+
+            iterator erase(const_iterator first, const_iterator last)
+            {
+                while (first != last)
+                {
+                    first = erase(first);
+                }
+                return iterator_at(static_cast<size_type>(last.m_ctrl - m_ctrl));
+            }
+
+            size_type erase(const key_type& key)
+            {
+                const size_type index = find_index(key);
+                if (index == m_capacity)
+                {
+                    return 0;
+                }
+                erase_at(index);
+                return 1;
+            }
+
+            void clear()
+            {
+                destroy_elements();
+                m_size = 0;
+                reset_ctrl();
+                m_growthLeft = capacity_to_growth(m_capacity);
+            }
+
+            void swap(this_type& rhs)
+            {
+                AZ_Assert(m_allocator == rhs.m_allocator, "flat_hash_table::swap requires the same allocators");
+                AZStd::swap(m_hasher, rhs.m_hasher);
+                AZStd::swap(m_keyEqual, rhs.m_keyEqual);
+                AZStd::swap(m_ctrl, rhs.m_ctrl);
+                AZStd::swap(m_slots, rhs.m_slots);
+                AZStd::swap(m_capacity, rhs.m_capacity);
+                AZStd::swap(m_size, rhs.m_size);
+                AZStd::swap(m_growthLeft, rhs.m_growthLeft);
+            }
+
+            //! Resizes the table to hold at least @numSlots slots and all the current elements.
+            //! rehash(0) on an empty table frees all the memory.
+            void rehash(size_type numSlots)
+            {
+                if (numSlots == 0 && m_size == 0)
+                {
+                    deallocate_storage();
+                    return;
+                }
+
+                const size_type newCapacity = normalize_capacity(AZStd::GetMax(numSlots, growth_to_lower_bound_capacity(m_size)));
+                if (newCapacity != m_capacity)
+                {
+                    resize(newCapacity);
+                }
+            }
+
+            //! Makes room for @count elements without growing.
+            void reserve(size_type count)
+            {
+                if (count > m_size + m_growthLeft)
+                {
+                    resize(normalize_capacity(growth_to_lower_bound_capacity(count)));
+                }
+            }
+
+            bool validate() const
+            {
+                size_type fullCount = 0;
+                for (size_type index = 0; index < m_capacity; ++index)
+                {
+                    if (m_ctrl[index] >= 0)
+                    {
+                        ++fullCount;
+                        if (find_index(Traits::key_from_value(m_slots[index])) != index)
+                        {
+                            return false;
+                        }
+                    }
+                    if (index < flat_hash_group::width && m_ctrl[m_capacity + index] != m_ctrl[index])
+                    {
+                        return false;
+                    }
+                }
+                return fullCount == m_size;
+            }
+
+        protected:
+            //! Returns the index of @key, when the key isn't in the table a slot is reserved for it and
+            //! the caller must construct the element there.
+            pair<size_type, bool> find_or_prepare_insert(const key_type& key)
+            {
+                const size_t hash = hash_key(key);
+                if (m_capacity)
+                {
+                    const flat_hash_ctrl h2 = hash_h2(hash);
+                    size_type position = hash_h1(hash) & (m_capacity - 1);
+                    for (size_type probeStep = 0;;)
+                    {
+                        const flat_hash_group group(m_ctrl + position);
+                        for (flat_hash_bitmask match = group.match(h2); match; match.clear_lowest_bit())
+                        {
+                            const size_type index = (position + match.lowest_bit_index()) & (m_capacity - 1);
+                            if (m_keyEqual(Traits::key_from_value(m_slots[index]), key))
+                            {
+                                return pair<size_type, bool>(index, false);
+                            }
+                        }
+                        if (group.match_empty())
+                        {
+                            break;
+                        }
+                        probeStep += flat_hash_group::width;
+                        position = (position + probeStep) & (m_capacity - 1);
+                    }
+                }
+                return pair<size_type, bool>(prepare_insert(hash), true);
+            }
+
+            iterator iterator_at(size_type index)
+            {
+                return iterator(m_ctrl + index, m_ctrl + m_capacity, m_slots + index);
+            }
+
+            pointer slot_at(size_type index)
+            {
+                return m_slots + index;
+            }
+
+        private:
+            // Max load factor of 7/8
+            static constexpr size_type MaxLoadNumerator = 7;
+            static constexpr size_type MaxLoadDenominator = 8;
+
+            static size_type capacity_to_growth(size_type capacity)
+            {
+                return capacity - capacity / MaxLoadDenominator;
+            }
+
+            static size_type growth_to_lower_bound_capacity(size_type growth)
+            {
+                return growth + (growth + MaxLoadNumerator - 1) / MaxLoadNumerator;
+            }
+
+            //! Power of 2 capacity, at least a group wide so a group never covers a slot twice.
+            static size_type normalize_capacity(size_type capacity)
+            {
+                size_type result = flat_hash_group::width;
+                while (result < capacity)
+                {
+                    result *= 2;
+                }
+                return result;
+            }
+
+            size_t hash_key(const key_type& key) const
+            {
+                // Mix the bits, many AZStd::hash specializations return the value itself and both ends of the hash are used
+                uint64_t hash = static_cast<uint64_t>(m_hasher(key));
+                hash ^= hash >> 33;
+                hash *= 0xff51afd7ed558ccdull;
+                hash ^= hash >> 33;
+                return static_cast<size_t>(hash);
+            }
+
+            static size_t hash_h1(size_t hash)
+            {
+                return hash >> 7;
+            }
+
+            static flat_hash_ctrl hash_h2(size_t hash)
+            {
+                return static_cast<flat_hash_ctrl>(hash & 0x7f);
+            }
+
+            size_type find_index(const key_type& key) const
+            {
+                if (!m_capacity)
+                {
+                    return m_capacity;
+                }
+
+                const size_t hash = hash_key(key);
+                const flat_hash_ctrl h2 = hash_h2(hash);
+                size_type position = hash_h1(hash) & (m_capacity - 1);
+                for (size_type probeStep = 0;;)
+                {
+                    const flat_hash_group group(m_ctrl + position);
+                    for (flat_hash_bitmask match = group.match(h2); match; match.clear_lowest_bit())
+                    {
+                        const size_type index = (position + match.lowest_bit_index()) & (m_capacity - 1);
+                        if (m_keyEqual(Traits::key_from_value(m_slots[index]), key))
+                        {
+                            return index;
+                        }
+                    }
+                    if (group.match_empty())
+                    {
+                        return m_capacity;
+                    }
+                    probeStep += flat_hash_group::width;
+                    position = (position + probeStep) & (m_capacity - 1);
+                }
+            }
+
+            size_type find_first_non_full(size_t hash) const
+            {
+                size_type position = hash_h1(hash) & (m_capacity - 1);
+                for (size_type probeStep = 0;;)
+                {
+                    const flat_hash_bitmask mask = flat_hash_group(m_ctrl + position).match_empty_or_deleted();
+                    if (mask)
+                    {
+                        return (position + mask.lowest_bit_index()) & (m_capacity - 1);
+                    }
+                    probeStep += flat_hash_group::width;
+                    position = (position + probeStep) & (m_capacity - 1);
+                }
+            }
+
+            size_type prepare_insert(size_t hash)
+            {
+                size_type index = m_capacity ? find_first_non_full(hash) : 0;
+                if (m_growthLeft == 0 && (!m_capacity || m_ctrl[index] != flat_hash_ctrl_deleted))
+                {
+                    grow();
+                    index = find_first_non_full(hash);
+                }
+                m_growthLeft -= m_ctrl[index] == flat_hash_ctrl_empty ? 1 : 0;
+                set_ctrl(index, hash_h2(hash));
+                ++m_size;
+                return index;
+            }
+
+            template<class ValueType>
+            void insert_unique_no_check(ValueType&& value)
+            {
+                const size_t hash = hash_key(Traits::key_from_value(value));
+                const size_type index = prepare_insert(hash);
+                AZStd::construct_at(m_slots + index, AZStd::forward<ValueType>(value));
+            }
+
+            void grow()
+            {
+                if (m_capacity == 0)
+                {
+                    resize(flat_hash_group::width);
+                }
+                else if (m_size <= capacity_to_growth(m_capacity) / 2)
+                {
+                    // Mostly deleted slots, rehashing in place is enough
+                    resize(m_capacity);
+                }
+                else
+                {
+                    resize(m_capacity * 2);
+                }
+            }
+
+            void resize(size_type newCapacity)
+            {
+                flat_hash_ctrl* oldCtrl = m_ctrl;
+                value_type* oldSlots = m_slots;
+                const size_type oldCapacity = m_capacity;
+
+                allocate_storage(newCapacity);
+                for (size_type index = 0; index < oldCapacity; ++index)
+                {
+                    if (oldCtrl[index] >= 0)
+                    {
+                        const size_t hash = hash_key(Traits::key_from_value(oldSlots[index]));
+                        const size_type newIndex = find_first_non_full(hash);
+                        set_ctrl(newIndex, hash_h2(hash));
+                        AZStd::construct_at(m_slots + newIndex, AZStd::move(oldSlots[index]));
+                        AZStd::destroy_at(oldSlots + index);
+                    }
+                }
+                m_growthLeft = capacity_to_growth(m_capacity) - m_size;
+
+                if (oldCtrl)
+                {
+                    m_allocator.deallocate(oldCtrl, storage_size(oldCapacity), alignment_of<value_type>::value);
+                }
+            }
+
+            void erase_at(size_type index)
+            {
+                AZStd::destroy_at(m_slots + index);
+                --m_size;
+
+                // When no group containing this slot was ever full, probing never went past it, so it can be marked empty
+                // instead of deleted
+                const size_type indexBefore = (index - flat_hash_group::width) & (m_capacity - 1);
+                const flat_hash_bitmask emptyAfter = flat_hash_group(m_ctrl + index).match_empty();
+                const flat_hash_bitmask emptyBefore = flat_hash_group(m_ctrl + indexBefore).match_empty();
+                const bool wasNeverFull = emptyBefore && emptyAfter &&
+                    (emptyAfter.trailing_zeros() + emptyBefore.leading_zeros()) < flat_hash_group::width;
+
+                set_ctrl(index, wasNeverFull ? flat_hash_ctrl_empty : flat_hash_ctrl_deleted);
+                m_growthLeft += wasNeverFull ? 1 : 0;
+            }
+
+            void set_ctrl(size_type index, flat_hash_ctrl value)
+            {
+                m_ctrl[index] = value;
+                if (index < flat_hash_group::width)
+                {
+                    m_ctrl[m_capacity + index] = value;
+                }
+            }
+
+            void reset_ctrl()
+            {
+                if (m_ctrl)
+                {
+                    memset(m_ctrl, static_cast<uint8_t>(flat_hash_ctrl_empty), m_capacity + flat_hash_group::width);
+                }
+            }
+
+            static size_type slots_offset(size_type capacity)
+            {
+                const size_type alignment = alignment_of<value_type>::value;
+                return (capacity + flat_hash_group::width + alignment - 1) & ~(alignment - 1);
+            }
+
+            static size_type storage_size(size_type capacity)
+            {
+                return slots_offset(capacity) + capacity * sizeof(value_type);
+            }
+
+            //! Control bytes and slots share one allocation, the first group of control bytes is cloned after the last one.
+            void allocate_storage(size_type capacity)
+            {
+                char* storage = static_cast<char*>(m_allocator.allocate(storage_size(capacity), alignment_of<value_type>::value));
+                m_ctrl = reinterpret_cast<flat_hash_ctrl*>(storage);
+                m_slots = reinterpret_cast<value_type*>(storage + slots_offset(capacity));
+                m_capacity = capacity;
+                reset_ctrl();
+            }
+
+            void deallocate_storage()
+            {
+                if (m_ctrl)
+                {
+                    m_allocator.deallocate(m_ctrl, storage_size(m_capacity), alignment_of<value_type>::value);
+                }
+                m_ctrl = nullptr;
+                m_slots = nullptr;
+                m_capacity = 0;
+                m_size = 0;
+                m_growthLeft = 0;
+            }
+
+            void destroy_elements()
+            {
+                for (size_type index = 0; index < m_capacity; ++index)
+                {
+                    if (m_ctrl[index] >= 0)
+                    {
+                        AZStd::destroy_at(m_slots + index);
+                    }
+                }
+            }
+
+            void copy_from(const flat_hash_table& rhs)
+            {
+                reserve(rhs.m_size);
+                for (const value_type& value : rhs)
+                {
+                    insert_unique_no_check(value);
+                }
+            }
+
+            void steal_storage(flat_hash_table& rhs)
+            {
+                m_ctrl = rhs.m_ctrl;
+                m_slots = rhs.m_slots;
+                m_capacity = rhs.m_capacity;
+                m_size = rhs.m_size;
+                m_growthLeft = rhs.m_growthLeft;
+                rhs.m_ctrl = nullptr;
+                rhs.m_slots = nullptr;
+                rhs.m_capacity = 0;
+                rhs.m_size = 0;
+                rhs.m_growthLeft = 0;
+            }
+
+            hasher m_hasher;
+            key_eq m_keyEqual;
+            allocator_type m_allocator;
+
+            flat_hash_ctrl* m_ctrl = nullptr;
+            value_type* m_slots = nullptr;
+            size_type m_capacity = 0;
+            size_type m_size = 0;
+            //! Number of elements that can be inserted in empty slots before the table grows.
+            size_type m_growthLeft = 0;
+        };
+    } // namespace Internal
+} // namespace AZStd
@@ -18,9 +18,11 @@ namespace AZStd
     using std::atan2;
     using std::ceil;
     using std::cos;
+    using std::exp;
     using std::exp2;
     using std::floor;
     using std::fmod;
+    using std::log;
     using std::round;
     using std::sin;
     using std::sqrt;
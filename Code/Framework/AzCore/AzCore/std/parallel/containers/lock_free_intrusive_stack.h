@@ -107,10 +107,18 @@ namespace AZStd
         ///Pushes a value onto the top of the stack
         void push(const_reference value);
 
+        ///Pushes a chain of values, already linked from first to last, onto the top of the stack with a single atomic
+        ///operation. The last value in the chain must not be linked to any other value.
+        void push_chain(const_reference first, const_reference last);
+
         ///Attempts to pop a value from the top of the stack. Returns NULL if the stack was empty, otherwise returns
         ///a pointer to the popped value
         pointer pop();
 
+        ///Removes all values from the stack with a single atomic operation. Returns the former top of the stack (or NULL
+        ///if it was empty), the remaining values can be reached by following the hook nodes.
+        pointer pop_all();
+
         ///Tests if the stack is empty, limited utility for a concurrent container.
         bool empty() const;
 
@@ -195,6 +203,36 @@ namespace AZStd
         }
     }
 
+    template<typename T, typename Hook>
+    inline void lock_free_intrusive_stack<T, Hook>::push_chain(const T& first, const T& last)
+    {
+        pointer firstNode = const_cast<pointer>(&first);
+        hook_node_type* lastHookNode = Hook::to_node_ptr(const_cast<pointer>(&last));
+#ifdef AZ_DEBUG_BUILD
+        AZSTD_CONTAINER_ASSERT(!lastHookNode->m_next, "Last node of the chain is already in an intrusive list");
+#endif
+        exponential_backoff backoff;
+        while (true)
+        {
+            node_type* oldTop = m_top.load(memory_order_acquire);
+            lastHookNode->m_next = oldTop;
+            if (m_top.compare_exchange_weak(oldTop, firstNode, memory_order_acq_rel, memory_order_acquire))
+            {
+                break;
+            }
+            else
+            {
+                backoff.wait();
+            }
+        }
+    }
+
+    template<typename T, typename Hook>
+    inline typename lock_free_intrusive_stack<T, Hook>::pointer lock_free_intrusive_stack<T, Hook>::pop_all()
+    {
+        return m_top.exchange(NULL, memory_order_acq_rel);
+    }
+
     template<typename T, typename Hook>
     inline bool lock_free_intrusive_stack<T, Hook>::empty() const
     {
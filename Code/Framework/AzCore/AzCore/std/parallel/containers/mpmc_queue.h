@@ -0,0 +1,317 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/allocator.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/createdestroy.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/scoped_lock.h>
+#include <AzCore/std/typetraits/aligned_storage.h>
+#include <AzCore/std/typetraits/alignment_of.h>
+
+namespace AZStd
+{
+    namespace Internal
+    {
+        //! Keeps the positions of the producers and consumers of the mpmc queues on separate cache lines.
+        static constexpr size_t mpmc_queue_cache_line_size = 64;
+    }
+
+    /**
+     * Bounded lock-free queue that allows multiple producers and multiple consumers. The queue is a ring buffer where every
+     * cell has a sequence number which tells producers and consumers if the cell is available to them, so pushing and popping
+     * only requires a single compare-and-swap in the uncontended case. The capacity is fixed at construction and is rounded up
+     * to a power of 2. Pushing to a full queue fails instead of blocking or allocating.
+     * Elements are popped in the order they were pushed.
+     */
+    template<typename T, typename Allocator = AZStd::allocator>
+    class bounded_mpmc_queue
+    {
+    public:
+        using value_type = T;
+        using reference = T&;
+        using const_reference = const T&;
+        using allocator_type = Allocator;
+        using size_type = typename Allocator::size_type;
+
+        explicit bounded_mpmc_queue(size_type capacity, const Allocator& allocator = Allocator());
+        ~bounded_mpmc_queue();
+
+        bounded_mpmc_queue(const bounded_mpmc_queue&) = delete;
+        bounded_mpmc_queue& operator=(const bounded_mpmc_queue&) = delete;
+
+        //! Tries to add a value to the back of the queue.
+        //! @return True if the value was added, false if the queue was full.
+        bool try_push(const_reference value) { return try_emplace(value); }
+        bool try_push(T&& value) { return try_emplace(AZStd::move(value)); }
+        template<typename... Args>
+        bool try_emplace(Args&&... args);
+
+        //! Tries to remove the value at the front of the queue.
+        //! @return True if a value was moved into valueOut, false if the queue was empty.
+        bool try_pop(reference valueOut);
+
+        //! Tests if the queue is empty. This has limited use for a concurrent container as the result may be stale by the time it's used.
+        bool empty() const;
+        //! Returns an approximation of the number of elements in the queue.
+        size_type size_approx() const;
+        size_type capacity() const { return m_mask + 1; }
+
+    private:
+        struct cell
+        {
+            atomic<size_t> m_sequence;
+            typename aligned_storage<sizeof(T), alignment_of<T>::value>::type m_storage;
+
+            T* get_value() { return reinterpret_cast<T*>(&m_storage); }
+        };
+
+        alignas(Internal::mpmc_queue_cache_line_size) atomic<size_t> m_pushPosition{ 0 };
+        alignas(Internal::mpmc_queue_cache_line_size) atomic<size_t> m_popPosition{ 0 };
+        alignas(Internal::mpmc_queue_cache_line_size) cell* m_cells{ nullptr };
+        size_t m_mask{ 0 };
+        allocator_type m_allocator;
+    };
+
+    /**
+     * Unbounded queue that allows multiple producers and multiple consumers. Values are stored in a bounded_mpmc_queue, so
+     * pushing and popping is lock-free as long as the number of queued elements stays below the initial capacity. Once the
+     * ring buffer is full, values are pushed into an overflow deque protected by a mutex until the overflow has been fully
+     * drained again. The values pushed by a single producer are popped in the order they were pushed.
+     */
+    template<typename T, typename Allocator = AZStd::allocator>
+    class mpmc_queue
+    {
+    public:
+        using value_type = T;
+        using reference = T&;
+        using const_reference = const T&;
+        using allocator_type = Allocator;
+        using size_type = typename Allocator::size_type;
+
+        static constexpr size_type default_capacity = 1024;
+
+        explicit mpmc_queue(size_type lockFreeCapacity = default_capacity, const Allocator& allocator = Allocator());
+
+        mpmc_queue(const mpmc_queue&) = delete;
+        mpmc_queue& operator=(const mpmc_queue&) = delete;
+
+        //! Adds a value to the back of the queue.
+        void push(const_reference value) { emplace(value); }
+        void push(T&& value) { emplace(AZStd::move(value)); }
+        template<typename... Args>
+        void emplace(Args&&... args);
+
+        //! Tries to remove the value at the front of the queue.
+        //! @return True if a value was moved into valueOut, false if the queue was empty.
+        bool try_pop(reference valueOut);
+
+        //! Tests if the queue is empty. This has limited use for a concurrent container as the result may be stale by the time it's used.
+        bool empty() const;
+        //! Returns an approximation of the number of elements in the queue.
+        size_type size_approx() const;
+
+    private:
+        bounded_mpmc_queue<T, Allocator> m_ring;
+        // Number of elements in the overflow. While non-zero, new elements are added to the overflow as well to maintain the order.
+        atomic<size_type> m_overflowCount{ 0 };
+        mutable mutex m_overflowLock;
+        deque<T, Allocator> m_overflow;
+    };
+
+    //============================================================================================================
+    // bounded_mpmc_queue
+    //============================================================================================================
+
+    template<typename T, typename Allocator>
+    inline bounded_mpmc_queue<T, Allocator>::bounded_mpmc_queue(size_type capacity, const Allocator& allocator)
+        : m_allocator(allocator)
+    {
+        size_t cellCount = 2;
+        while (cellCount < capacity)
+        {
+            cellCount <<= 1;
+        }
+        m_mask = cellCount - 1;
+
+        m_cells = reinterpret_cast<cell*>(m_allocator.allocate(sizeof(cell) * cellCount, alignment_of<cell>::value));
+        for (size_t i = 0; i < cellCount; ++i)
+        {
+            new (&m_cells[i]) cell;
+            m_cells[i].m_sequence.store(i, memory_order_relaxed);
+        }
+    }
+
+    template<typename T, typename Allocator>
+    inline bounded_mpmc_queue<T, Allocator>::~bounded_mpmc_queue()
+    {
+        if constexpr (!is_trivially_destructible_v<T>)
+        {
+            size_t position = m_popPosition.load(memory_order_relaxed);
+            const size_t end = m_pushPosition.load(memory_order_relaxed);
+            for (; position != end; ++position)
+            {
+                destroy_at(m_cells[position & m_mask].get_value());
+            }
+        }
+        for (size_t i = 0; i <= m_mask; ++i)
+        {
+            m_cells[i].~cell();
+        }
+        m_allocator.deallocate(m_cells, sizeof(cell) * (m_mask + 1), alignment_of<cell>::value);
+    }
+
+    template<typename T, typename Allocator>
+    template<typename... Args>
+    inline bool bounded_mpmc_queue<T, Allocator>::try_emplace(Args&&... args)
+    {
+        cell* target;
+        size_t position = m_pushPosition.load(memory_order_relaxed);
+        while (true)
+        {
+            target = &m_cells[position & m_mask];
+            const size_t sequence = target->m_sequence.load(memory_order_acquire);
+            const ptrdiff_t difference = static_cast<ptrdiff_t>(sequence) - static_cast<ptrdiff_t>(position);
+            if (difference == 0)
+            {
+                // The cell is free for this round, try to claim it.
+                if (m_pushPosition.compare_exchange_weak(position, position + 1, memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (difference < 0)
+            {
+                // The cell still holds a value from the previous round, so the queue is full.
+                return false;
+            }
+            else
+            {
+                // Another producer claimed the cell, retry at the new position.
+                position = m_pushPosition.load(memory_order_relaxed);
+            }
+        }
+
+        new (target->get_value()) T(AZStd::forward<Args>(args)...);
+        target->m_sequence.store(position + 1, memory_order_release);
+        return true;
+    }
+
+    template<typename T, typename Allocator>
+    inline bool bounded_mpmc_queue<T, Allocator>::try_pop(reference valueOut)
+    {
+        cell* source;
+        size_t position = m_popPosition.load(memory_order_relaxed);
+        while (true)
+        {
+            source = &m_cells[position & m_mask];
+            const size_t sequence = source->m_sequence.load(memory_order_acquire);
+            const ptrdiff_t difference = static_cast<ptrdiff_t>(sequence) - static_cast<ptrdiff_t>(position + 1);
+            if (difference == 0)
+            {
+                // The cell holds a value for this round, try to claim it.
+                if (m_popPosition.compare_exchange_weak(position, position + 1, memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (difference < 0)
+            {
+                // The cell hasn't been filled yet, so the queue is empty.
+                return false;
+            }
+            else
+            {
+                // Another consumer claimed the cell, retry at the new position.
+                position = m_popPosition.load(memory_order_relaxed);
+            }
+        }
+
+        T* value = source->get_value();
+        valueOut = AZStd::move(*value);
+        destroy_at(value);
+        // Release the cell to the producers of the next round.
+        source->m_sequence.store(position + m_mask + 1, memory_order_release);
+        return true;
+    }
+
+    template<typename T, typename Allocator>
+    inline bool bounded_mpmc_queue<T, Allocator>::empty() const
+    {
+        return size_approx() == 0;
+    }
+
+    template<typename T, typename Allocator>
+    inline auto bounded_mpmc_queue<T, Allocator>::size_approx() const -> size_type
+    {
+        const size_t popPosition = m_popPosition.load(memory_order_acquire);
+        const size_t pushPosition = m_pushPosition.load(memory_order_acquire);
+        return pushPosition > popPosition ? static_cast<size_type>(pushPosition - popPosition) : 0;
+    }
+
+    //============================================================================================================
+    // mpmc_queue
+    //============================================================================================================
+
+    template<typename T, typename Allocator>
+    inline mpmc_queue<T, Allocator>::mpmc_queue(size_type lockFreeCapacity, const Allocator& allocator)
+        : m_ring(lockFreeCapacity, allocator)
+        , m_overflow(allocator)
+    {
+    }
+
+    template<typename T, typename Allocator>
+    template<typename... Args>
+    inline void mpmc_queue<T, Allocator>::emplace(Args&&... args)
+    {
+        if (m_overflowCount.load(memory_order_acquire) == 0 && m_ring.try_emplace(AZStd::forward<Args>(args)...))
+        {
+            return;
+        }
+
+        AZStd::scoped_lock lock(m_overflowLock);
+        m_overflow.emplace_back(AZStd::forward<Args>(args)...);
+        m_overflowCount.fetch_add(1, memory_order_release);
+    }
+
+    template<typename T, typename Allocator>
+    inline bool mpmc_queue<T, Allocator>::try_pop(reference valueOut)
+    {
+        if (m_ring.try_pop(valueOut))
+        {
+            return true;
+        }
+
+        if (m_overflowCount.load(memory_order_acquire) != 0)
+        {
+            AZStd::scoped_lock lock(m_overflowLock);
+            if (!m_overflow.empty())
+            {
+                valueOut = AZStd::move(m_overflow.front());
+                m_overflow.pop_front();
+                m_overflowCount.fetch_sub(1, memory_order_release);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    template<typename T, typename Allocator>
+    inline bool mpmc_queue<T, Allocator>::empty() const
+    {
+        return m_ring.empty() && m_overflowCount.load(memory_order_acquire) == 0;
+    }
+
+    template<typename T, typename Allocator>
+    inline auto mpmc_queue<T, Allocator>::size_approx() const -> size_type
+    {
+        return m_ring.size_approx() + m_overflowCount.load(memory_order_acquire);
+    }
+} // namespace AZStd
@@ -0,0 +1,337 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Debug/Trace.h>
+#include <AzCore/IO/Streamer/IoUringQueue_Linux.h>
+#include <AzCore/std/algorithm.h>
+
+#include <errno.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+// Older kernel headers, such as the ones shipped with Ubuntu 18.04, don't include io_uring. In that case the queue will report
+// that it's not supported and the storage drive will forward all requests to the next entry in the stack.
+#if __has_include(<linux/io_uring.h>) && defined(__NR_io_uring_setup)
+#   include <linux/io_uring.h>
+#   define AZ_IO_URING_AVAILABLE 1
+#else
+#   define AZ_IO_URING_AVAILABLE 0
+#endif
+
+namespace AZ::IO
+{
+#if AZ_IO_URING_AVAILABLE
+    namespace IoUringInternal
+    {
+        static int Setup(u32 entries, io_uring_params* params)
+        {
+            return aznumeric_cast<int>(::syscall(__NR_io_uring_setup, entries, params));
+        }
+
+        static int Enter(int ringDescriptor, u32 toSubmit, u32 minComplete, u32 flags)
+        {
+            return aznumeric_cast<int>(::syscall(__NR_io_uring_enter, ringDescriptor, toSubmit, minComplete, flags, nullptr, 0));
+        }
+
+        static int Register(int ringDescriptor, u32 opcode, const void* args, u32 numArgs)
+        {
+            return aznumeric_cast<int>(::syscall(__NR_io_uring_register, ringDescriptor, opcode, args, numArgs));
+        }
+
+        // The ring indices are shared with the kernel, so they need to be accessed with the appropriate memory ordering.
+        static u32 LoadAcquire(const u32* value)
+        {
+            return __atomic_load_n(value, __ATOMIC_ACQUIRE);
+        }
+
+        static void StoreRelease(u32* value, u32 newValue)
+        {
+            __atomic_store_n(value, newValue, __ATOMIC_RELEASE);
+        }
+    } // namespace IoUringInternal
+
+    IoUringQueue::~IoUringQueue()
+    {
+        Shutdown();
+    }
+
+    bool IoUringQueue::IsSupported()
+    {
+        io_uring_params params;
+        memset(&params, 0, sizeof(params));
+        int ringDescriptor = IoUringInternal::Setup(1, &params);
+        if (ringDescriptor < 0)
+        {
+            // ENOSYS if the kernel is too old, EPERM if io_uring has been disabled or blocked by a seccomp filter.
+            return false;
+        }
+        ::close(ringDescriptor);
+        return true;
+    }
+
+    bool IoUringQueue::Initialize(u32 numEntries)
+    {
+        AZ_Assert(!IsInitialized(), "IoUringQueue has already been initialized.");
+
+        io_uring_params params;
+        memset(&params, 0, sizeof(params));
+        params.flags = IORING_SETUP_CLAMP;
+        m_ringDescriptor = IoUringInternal::Setup(numEntries, &params);
+        if (m_ringDescriptor < 0)
+        {
+            m_ringDescriptor = -1;
+            return false;
+        }
+
+        m_submissionRingSize = params.sq_off.array + params.sq_entries * sizeof(u32);
+        m_completionRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        const bool singleMap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+        if (singleMap)
+        {
+            m_submissionRingSize = AZStd::max(m_submissionRingSize, m_completionRingSize);
+            m_completionRingSize = m_submissionRingSize;
+        }
+
+        m_submissionRing = ::mmap(nullptr, m_submissionRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+            m_ringDescriptor, IORING_OFF_SQ_RING);
+        if (m_submissionRing == MAP_FAILED)
+        {
+            m_submissionRing = nullptr;
+            Shutdown();
+            return false;
+        }
+
+        if (singleMap)
+        {
+            m_completionRing = m_submissionRing;
+        }
+        else
+        {
+            m_completionRing = ::mmap(nullptr, m_completionRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                m_ringDescriptor, IORING_OFF_CQ_RING);
+            if (m_completionRing == MAP_FAILED)
+            {
+                m_completionRing = nullptr;
+                Shutdown();
+                return false;
+            }
+        }
+
+        m_submissionEntriesSize = params.sq_entries * sizeof(io_uring_sqe);
+        void* entries = ::mmap(nullptr, m_submissionEntriesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+            m_ringDescriptor, IORING_OFF_SQES);
+        if (entries == MAP_FAILED)
+        {
+            Shutdown();
+            return false;
+        }
+        m_submissionEntries = reinterpret_cast<io_uring_sqe*>(entries);
+
+        u8* submissionRing = reinterpret_cast<u8*>(m_submissionRing);
+        m_submissionHead = reinterpret_cast<u32*>(submissionRing + params.sq_off.head);
+        m_submissionTail = reinterpret_cast<u32*>(submissionRing + params.sq_off.tail);
+        m_submissionArray = reinterpret_cast<u32*>(submissionRing + params.sq_off.array);
+        m_submissionMask = *reinterpret_cast<u32*>(submissionRing + params.sq_off.ring_mask);
+        m_numSubmissionEntries = params.sq_entries;
+        m_localSubmissionTail = *m_submissionTail;
+        m_numUnsubmitted = 0;
+
+        u8* completionRing = reinterpret_cast<u8*>(m_completionRing);
+        m_completionHead = reinterpret_cast<u32*>(completionRing + params.cq_off.head);
+        m_completionTail = reinterpret_cast<u32*>(completionRing + params.cq_off.tail);
+        m_completionMask = *reinterpret_cast<u32*>(completionRing + params.cq_off.ring_mask);
+        m_completions = reinterpret_cast<io_uring_cqe*>(completionRing + params.cq_off.cqes);
+
+        return true;
+    }
+
+    void IoUringQueue::Shutdown()
+    {
+        if (m_submissionEntries)
+        {
+            ::munmap(m_submissionEntries, m_submissionEntriesSize);
+            m_submissionEntries = nullptr;
+        }
+        if (m_completionRing && m_completionRing != m_submissionRing)
+        {
+            ::munmap(m_completionRing, m_completionRingSize);
+        }
+        m_completionRing = nullptr;
+        if (m_submissionRing)
+        {
+            ::munmap(m_submissionRing, m_submissionRingSize);
+            m_submissionRing = nullptr;
+        }
+        if (m_ringDescriptor >= 0)
+        {
+            // Closing the ring will cancel any requests that are still in flight.
+            ::close(m_ringDescriptor);
+            m_ringDescriptor = -1;
+        }
+        m_numSubmissionEntries = 0;
+        m_numUnsubmitted = 0;
+    }
+
+    bool IoUringQueue::IsInitialized() const
+    {
+        return m_ringDescriptor >= 0;
+    }
+
+    bool IoUringQueue::RegisterEventDescriptor(int eventDescriptor)
+    {
+        AZ_Assert(IsInitialized(), "IoUringQueue needs to be initialized before an eventfd can be registered.");
+        return IoUringInternal::Register(m_ringDescriptor, IORING_REGISTER_EVENTFD, &eventDescriptor, 1) == 0;
+    }
+
+    bool IoUringQueue::RegisterBuffers(const iovec* buffers, u32 count)
+    {
+        AZ_Assert(IsInitialized(), "IoUringQueue needs to be initialized before buffers can be registered.");
+        return IoUringInternal::Register(m_ringDescriptor, IORING_REGISTER_BUFFERS, buffers, count) == 0;
+    }
+
+    io_uring_sqe* IoUringQueue::GetSubmissionEntry()
+    {
+        if (GetNumAvailableEntries() == 0)
+        {
+            return nullptr;
+        }
+
+        u32 index = m_localSubmissionTail & m_submissionMask;
+        io_uring_sqe* entry = &m_submissionEntries[index];
+        memset(entry, 0, sizeof(io_uring_sqe));
+        m_submissionArray[index] = index;
+        ++m_localSubmissionTail;
+        ++m_numUnsubmitted;
+        return entry;
+    }
+
+    bool IoUringQueue::QueueReadVector(int fileDescriptor, const iovec* buffer, u64 offset, u64 userData)
+    {
+        io_uring_sqe* entry = GetSubmissionEntry();
+        if (!entry)
+        {
+            return false;
+        }
+        entry->opcode = IORING_OP_READV;
+        entry->fd = fileDescriptor;
+        entry->addr = reinterpret_cast<u64>(buffer);
+        entry->len = 1;
+        entry->off = offset;
+        entry->user_data = userData;
+        return true;
+    }
+
+    bool IoUringQueue::QueueReadFixed(int fileDescriptor, void* output, u32 size, u64 offset, u16 bufferIndex, u64 userData)
+    {
+        io_uring_sqe* entry = GetSubmissionEntry();
+        if (!entry)
+        {
+            return false;
+        }
+        entry->opcode = IORING_OP_READ_FIXED;
+        entry->fd = fileDescriptor;
+        entry->addr = reinterpret_cast<u64>(output);
+        entry->len = size;
+        entry->off = offset;
+        entry->buf_index = bufferIndex;
+        entry->user_data = userData;
+        return true;
+    }
+
+    bool IoUringQueue::QueueCancel(u64 targetUserData, u64 userData)
+    {
+        io_uring_sqe* entry = GetSubmissionEntry();
+        if (!entry)
+        {
+            return false;
+        }
+        entry->opcode = IORING_OP_ASYNC_CANCEL;
+        entry->fd = -1;
+        entry->addr = targetUserData;
+        entry->user_data = userData;
+        return true;
+    }
+
+    s32 IoUringQueue::Submit()
+    {
+        if (m_numUnsubmitted == 0)
+        {
+            return 0;
+        }
+
+        IoUringInternal::StoreRelease(m_submissionTail, m_localSubmissionTail);
+        int result;
+        do
+        {
+            result = IoUringInternal::Enter(m_ringDescriptor, m_numUnsubmitted, 0, 0);
+        } while (result < 0 && errno == EINTR);
+
+        if (result < 0)
+        {
+            // EAGAIN and EBUSY mean the kernel is temporarily out of resources. The entries stay in the ring and will be
+            // submitted on the next call.
+            return -errno;
+        }
+        m_numUnsubmitted -= AZStd::min(m_numUnsubmitted, aznumeric_cast<u32>(result));
+        return result;
+    }
+
+    u32 IoUringQueue::GetNumAvailableEntries() const
+    {
+        u32 numInUse = m_localSubmissionTail - IoUringInternal::LoadAcquire(m_submissionHead);
+        return m_numSubmissionEntries - numInUse;
+    }
+
+    u32 IoUringQueue::GetNumUnsubmittedEntries() const
+    {
+        return m_numUnsubmitted;
+    }
+
+    bool IoUringQueue::PeekCompletion(u64& userData, s32& result)
+    {
+        if (!IsInitialized())
+        {
+            return false;
+        }
+
+        u32 head = *m_completionHead;
+        if (head == IoUringInternal::LoadAcquire(m_completionTail))
+        {
+            return false;
+        }
+        const io_uring_cqe& completion = m_completions[head & m_completionMask];
+        userData = completion.user_data;
+        result = completion.res;
+        return true;
+    }
+
+    void IoUringQueue::PopCompletion()
+    {
+        IoUringInternal::StoreRelease(m_completionHead, *m_completionHead + 1);
+    }
+#else
+    IoUringQueue::~IoUringQueue() = default;
+    bool IoUringQueue::IsSupported() { return false; }
+    bool IoUringQueue::Initialize(u32) { return false; }
+    void IoUringQueue::Shutdown() {}
+    bool IoUringQueue::IsInitialized() const { return false; }
+    bool IoUringQueue::RegisterEventDescriptor(int) { return false; }
+    bool IoUringQueue::RegisterBuffers(const iovec*, u32) { return false; }
+    bool IoUringQueue::QueueReadVector(int, const iovec*, u64, u64) { return false; }
+    bool IoUringQueue::QueueReadFixed(int, void*, u32, u64, u16, u64) { return false; }
+    bool IoUringQueue::QueueCancel(u64, u64) { return false; }
+    s32 IoUringQueue::Submit() { return -ENOSYS; }
+    u32 IoUringQueue::GetNumAvailableEntries() const { return 0; }
+    u32 IoUringQueue::GetNumUnsubmittedEntries() const { return 0; }
+    bool IoUringQueue::PeekCompletion(u64&, s32&) { return false; }
+    void IoUringQueue::PopCompletion() {}
+    io_uring_sqe* IoUringQueue::GetSubmissionEntry() { return nullptr; }
+#endif // AZ_IO_URING_AVAILABLE
+} // namespace AZ::IO
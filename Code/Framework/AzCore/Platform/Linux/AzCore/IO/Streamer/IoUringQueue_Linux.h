@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/function/invoke.h>
+
+#include <sys/uio.h>
+
+struct io_uring_sqe;
+struct io_uring_cqe;
+
+namespace AZ::IO
+{
+    //! Minimal wrapper around a Linux io_uring instance, using the system calls directly so there's no dependency on liburing.
+    //! Requests are added to the submission queue with the Queue* functions and handed to the kernel in a single batch with
+    //! Submit. Completed requests are retrieved with ProcessCompletions. The queue is not thread safe and is expected to be
+    //! used from the Streamer thread only.
+    class IoUringQueue
+    {
+    public:
+        IoUringQueue() = default;
+        ~IoUringQueue();
+
+        IoUringQueue(const IoUringQueue&) = delete;
+        IoUringQueue& operator=(const IoUringQueue&) = delete;
+
+        //! Returns true if the running kernel supports io_uring and the process is allowed to use it.
+        static bool IsSupported();
+
+        //! Creates the io_uring instance with room for at least the requested number of submissions.
+        //! @return True if the instance was created, false if io_uring isn't available.
+        bool Initialize(u32 numEntries);
+        void Shutdown();
+        bool IsInitialized() const;
+
+        //! Signals the eventfd every time a request completes, which allows a thread to sleep until IO is done.
+        bool RegisterEventDescriptor(int eventDescriptor);
+        //! Pins the provided buffers in the kernel so they can be used with QueueReadFixed, which avoids mapping the
+        //! buffer for every request.
+        bool RegisterBuffers(const iovec* buffers, u32 count);
+
+        //! Queues a read into the provided io vector. The io vector needs to stay alive until the request completes.
+        bool QueueReadVector(int fileDescriptor, const iovec* buffer, u64 offset, u64 userData);
+        //! Queues a read into (part of) a buffer previously registered with RegisterBuffers.
+        bool QueueReadFixed(int fileDescriptor, void* output, u32 size, u64 offset, u16 bufferIndex, u64 userData);
+        //! Queues a request to cancel a previously submitted request with the given user data.
+        bool QueueCancel(u64 targetUserData, u64 userData);
+        //! Hands all queued requests to the kernel.
+        //! @return The number of submitted requests or a negative error code.
+        s32 Submit();
+
+        //! Returns the number of requests that can still be queued before Submit needs to be called.
+        u32 GetNumAvailableEntries() const;
+        //! Returns the number of requests that have been queued but not submitted yet.
+        u32 GetNumUnsubmittedEntries() const;
+
+        //! Calls the callback for every completed request with the user data of the request and the result, which is
+        //! the number of bytes read or a negative error code.
+        //! @return The number of processed completions.
+        template<typename Callback>
+        u32 ProcessCompletions(Callback&& callback);
+
+    private:
+        bool PeekCompletion(u64& userData, s32& result);
+        void PopCompletion();
+        io_uring_sqe* GetSubmissionEntry();
+
+        void* m_submissionRing{ nullptr };
+        void* m_completionRing{ nullptr };
+        io_uring_sqe* m_submissionEntries{ nullptr };
+        size_t m_submissionRingSize{ 0 };
+        size_t m_completionRingSize{ 0 };
+        size_t m_submissionEntriesSize{ 0 };
+
+        u32* m_submissionHead{ nullptr };
+        u32* m_submissionTail{ nullptr };
+        u32* m_submissionArray{ nullptr };
+        u32* m_completionHead{ nullptr };
+        u32* m_completionTail{ nullptr };
+        io_uring_cqe* m_completions{ nullptr };
+
+        u32 m_submissionMask{ 0 };
+        u32 m_completionMask{ 0 };
+        u32 m_numSubmissionEntries{ 0 };
+        //! Cached copy of the submission tail, which is published to the kernel on Submit.
+        u32 m_localSubmissionTail{ 0 };
+        u32 m_numUnsubmitted{ 0 };
+        int m_ringDescriptor{ -1 };
+    };
+
+    template<typename Callback>
+    u32 IoUringQueue::ProcessCompletions(Callback&& callback)
+    {
+        u32 count = 0;
+        u64 userData;
+        s32 result;
+        while (PeekCompletion(userData, result))
+        {
+            // Release the entry first so the callback is free to queue new requests.
+            PopCompletion();
+            AZStd::invoke(callback, userData, result);
+            ++count;
+        }
+        return count;
+    }
+} // namespace AZ::IO
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/Streamer/IoUringQueue_Linux.h>
+#include <AzCore/IO/Streamer/StorageDrive_Linux.h>
+#include <AzCore/IO/Streamer/StorageDriveConfig_Linux.h>
+#include <AzCore/IO/Streamer/StreamerConfiguration_Linux.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+
+namespace AZ::IO
+{
+    AZStd::shared_ptr<StreamStackEntry> LinuxStorageDriveConfig::AddStreamStackEntry(
+        const HardwareInformation& hardware, AZStd::shared_ptr<StreamStackEntry> parent)
+    {
+        if (!IoUringQueue::IsSupported())
+        {
+            AZ_Warning("Streamer", false, "io_uring isn't available on this system so the optimized Linux storage drive won't be used.\n");
+            return parent;
+        }
+
+        LinuxDriveInformation drive;
+        if (const LinuxDriveInformation* collected = AZStd::any_cast<LinuxDriveInformation>(&hardware.m_platformData))
+        {
+            drive = *collected;
+        }
+        else
+        {
+            drive.m_physicalSectorSize = hardware.m_maxPhysicalSectorSize;
+            drive.m_logicalSectorSize = hardware.m_maxLogicalSectorSize;
+        }
+
+        constexpr u32 DefaultQueueDepth = 32;
+        constexpr u32 MaxAutomaticQueueDepth = 128;
+        u32 queueDepth = m_queueDepth;
+        if (queueDepth == 0)
+        {
+            queueDepth = drive.m_ioQueueDepth > 0 ? AZStd::min(drive.m_ioQueueDepth, MaxAutomaticQueueDepth) : DefaultQueueDepth;
+        }
+
+        StorageDriveLinux::ConstructionOptions options;
+        options.m_enableDirectReads = m_enableDirectReads;
+        options.m_hasSeekPenalty = drive.m_hasSeekPenalty;
+        options.m_minimalReporting = m_minimalReporting;
+
+        auto stackEntry = AZStd::make_shared<StorageDriveLinux>(
+            m_maxFileHandles, m_maxMetaDataCache, drive.m_physicalSectorSize, drive.m_logicalSectorSize, queueDepth,
+            aznumeric_cast<s32>(m_overcommit), aznumeric_cast<size_t>(m_registeredBufferSizeKib) * 1_kib, options);
+        stackEntry->SetNext(AZStd::move(parent));
+        return stackEntry;
+    }
+
+    void LinuxStorageDriveConfig::Reflect(ReflectContext* context)
+    {
+        if (auto serializeContext = azrtti_cast<SerializeContext*>(context); serializeContext != nullptr)
+        {
+            serializeContext->Class<LinuxStorageDriveConfig, IStreamerStackConfig>()
+                ->Version(1)
+                ->Field("MaxFileHandles", &LinuxStorageDriveConfig::m_maxFileHandles)
+                ->Field("MaxMetaDataCache", &LinuxStorageDriveConfig::m_maxMetaDataCache)
+                ->Field("QueueDepth", &LinuxStorageDriveConfig::m_queueDepth)
+                ->Field("Overcommit", &LinuxStorageDriveConfig::m_overcommit)
+                ->Field("RegisteredBufferSizeKib", &LinuxStorageDriveConfig::m_registeredBufferSizeKib)
+                ->Field("EnableDirectReads", &LinuxStorageDriveConfig::m_enableDirectReads)
+                ->Field("MinimalReporting", &LinuxStorageDriveConfig::m_minimalReporting);
+        }
+    }
+} // namespace AZ::IO
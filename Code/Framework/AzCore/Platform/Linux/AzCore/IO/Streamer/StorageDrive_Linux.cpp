@@ -0,0 +1,1076 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/StreamerContext.h>
+#include <AzCore/IO/Streamer/StorageDrive_Linux.h>
+#include <AzCore/std/typetraits/decay.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace AZ::IO
+{
+    static constexpr char ReadSpeedName[] = "Read Speed (avg. mbps)";
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+    static constexpr char FileSwitchesName[] = "File switches";
+    static constexpr char SeeksName[] = "Seeks";
+    static constexpr char DirectReadsName[] = "Direct reads (no internal alloc)";
+#endif // AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+
+    // The ring holds twice the queue depth so cancel requests can always be queued next to a full set of reads.
+    static constexpr u32 RingEntriesPerRead = 2;
+    // Upper limit for the queue depth. Beyond this the kernel's own request queue is the bottleneck.
+    static constexpr u32 MaxQueueDepth = 1024;
+
+    const AZStd::chrono::microseconds StorageDriveLinux::s_averageSeekTime =
+        AZStd::chrono::milliseconds(9) + // Common average seek time for desktop hdd drives.
+        AZStd::chrono::milliseconds(3); // Rotational latency for a 7200RPM disk
+
+    //
+    // ConstructionOptions
+    //
+
+    StorageDriveLinux::ConstructionOptions::ConstructionOptions()
+        : m_hasSeekPenalty(true)
+        , m_enableDirectReads(true)
+        , m_minimalReporting(false)
+    {}
+
+    //
+    // FileReadInformation
+    //
+
+    void StorageDriveLinux::FileReadInformation::AllocateAlignedBuffer(size_t size, size_t sectorSize)
+    {
+        AZ_Assert(m_sectorAlignedOutput == nullptr, "Assign a sector aligned buffer when one is already assigned.");
+        m_sectorAlignedOutput = azmalloc(size, sectorSize, AZ::SystemAllocator);
+    }
+
+    void StorageDriveLinux::FileReadInformation::Clear()
+    {
+        if (m_sectorAlignedOutput)
+        {
+            azfree(m_sectorAlignedOutput, AZ::SystemAllocator);
+        }
+        *this = FileReadInformation{};
+    }
+
+    //
+    // StorageDriveLinux
+    //
+
+    StorageDriveLinux::StorageDriveLinux(u32 maxFileHandles, u32 maxMetaDataCacheEntries, size_t physicalSectorSize,
+        size_t logicalSectorSize, u32 queueDepth, s32 overCommit, size_t registeredBufferSize, ConstructionOptions options)
+        : StreamStackEntry("Storage drive (io_uring)")
+        , m_physicalSectorSize(physicalSectorSize)
+        , m_logicalSectorSize(logicalSectorSize)
+        , m_maxFileHandles(AZStd::max(maxFileHandles, 1u))
+        , m_queueDepth(queueDepth)
+        , m_overCommit(overCommit)
+        , m_constructionOptions(options)
+    {
+        if (m_physicalSectorSize == 0)
+        {
+            m_physicalSectorSize = 4_kib;
+            AZ_Error("StorageDriveLinux", false,
+                "Received physical sector size of 0 for %s. Picking a sector size of %zu instead.\n", m_name.c_str(), m_physicalSectorSize);
+        }
+        if (m_logicalSectorSize == 0)
+        {
+            m_logicalSectorSize = 512;
+            AZ_Error("StorageDriveLinux", false,
+                "Received logical sector size of 0 for %s. Picking a sector size of %zu instead.\n", m_name.c_str(), m_logicalSectorSize);
+        }
+        AZ_Error("StorageDriveLinux", IStreamerTypes::IsPowerOf2(m_physicalSectorSize) && IStreamerTypes::IsPowerOf2(m_logicalSectorSize),
+            "StorageDriveLinux requires power-of-2 sector sizes. Received physical: %zu and logical: %zu",
+            m_physicalSectorSize, m_logicalSectorSize);
+
+        if (m_queueDepth == 0)
+        {
+            m_queueDepth = 32;
+            AZ_Warning("StorageDriveLinux", false,
+                "Received queue depth of 0 for %s. Picking a depth of %u instead.\n", m_name.c_str(), m_queueDepth);
+        }
+        m_queueDepth = AZStd::min(m_queueDepth, MaxQueueDepth);
+        // Make sure that the overCommit isn't so small that no slots are ever reported.
+        if (aznumeric_cast<s32>(m_queueDepth) + m_overCommit <= 0)
+        {
+            AZ_Error("StorageDriveLinux", false,
+                "Received overcommit (%i) for %s that subtracts more than the queue depth (%u). Setting combined count to 1.\n",
+                m_overCommit, m_name.c_str(), m_queueDepth);
+            m_overCommit = 1 - aznumeric_cast<s32>(m_queueDepth);
+        }
+
+        if (registeredBufferSize > 0)
+        {
+            m_registeredBufferSize = AZ_SIZE_ALIGN_UP(registeredBufferSize, m_physicalSectorSize);
+        }
+
+        if (!m_ring.Initialize(m_queueDepth * RingEntriesPerRead))
+        {
+            AZ_Error("StorageDriveLinux", false,
+                "Failed to create an io_uring instance (error %i). All requests will be forwarded to the next entry.\n", errno);
+        }
+
+        // Add initial dummy values to the stats to avoid division by zero later on and avoid needing branches.
+        m_readSizeAverage.PushEntry(1);
+        m_readTimeAverage.PushEntry(AZStd::chrono::microseconds(1));
+
+        AZ_Assert(IStreamerTypes::IsPowerOf2(maxMetaDataCacheEntries),
+            "StorageDriveLinux requires a power-of-2 for maxMetaDataCacheEntries. Received %u", maxMetaDataCacheEntries);
+        m_metaDataCache_paths.resize(maxMetaDataCacheEntries);
+        m_metaDataCache_fileSize.resize(maxMetaDataCacheEntries);
+
+        if (!m_constructionOptions.m_minimalReporting)
+        {
+            AZ_Printf("Streamer", "%s created with a queue depth of %u.\n", m_name.c_str(), m_queueDepth);
+        }
+    }
+
+    StorageDriveLinux::~StorageDriveLinux()
+    {
+        AZ_Assert(m_activeReads_Count == 0, "%s destroyed while %u reads are still in flight.", m_name.c_str(), m_activeReads_Count);
+
+        // Close the ring first so the kernel no longer references any of the buffers.
+        m_ring.Shutdown();
+
+        for (int file : m_fileCache_descriptors)
+        {
+            if (file >= 0)
+            {
+                ::close(file);
+            }
+        }
+        for (FileReadInformation& readInfo : m_readSlots_readInfo)
+        {
+            readInfo.Clear();
+        }
+        if (m_registeredBuffers)
+        {
+            azfree(m_registeredBuffers, AZ::SystemAllocator);
+        }
+
+        if (!m_constructionOptions.m_minimalReporting)
+        {
+            AZ_Printf("Streamer", "%s destroyed.\n", m_name.c_str());
+        }
+    }
+
+    void StorageDriveLinux::SetContext(StreamerContext& context)
+    {
+        StreamStackEntry::SetContext(context);
+
+        if (m_ring.IsInitialized())
+        {
+            // Without the eventfd the Streamer thread would go to sleep without a way to be woken up when reads complete.
+            int wakeUpEvent = context.GetStreamerThreadSynchronizer().GetWakeUpEventDescriptor();
+            if (wakeUpEvent < 0 || !m_ring.RegisterEventDescriptor(wakeUpEvent))
+            {
+                AZ_Error("StorageDriveLinux", false,
+                    "Failed to register the Streamer eventfd with io_uring (error %i). All requests will be forwarded to the next entry.\n",
+                    errno);
+                m_ring.Shutdown();
+            }
+        }
+    }
+
+    void StorageDriveLinux::PrepareRequest(FileRequest* request)
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzCore);
+        AZ_Assert(request, "PrepareRequest was provided a null request.");
+
+        if (m_ring.IsInitialized() && AZStd::holds_alternative<FileRequest::ReadRequestData>(request->GetCommand()))
+        {
+            auto& readRequest = AZStd::get<FileRequest::ReadRequestData>(request->GetCommand());
+            FileRequest* read = m_context->GetNewInternalRequest();
+            read->CreateRead(request, readRequest.m_output, readRequest.m_outputSize, readRequest.m_path,
+                readRequest.m_offset, readRequest.m_size);
+            m_context->PushPreparedRequest(read);
+            return;
+        }
+        StreamStackEntry::PrepareRequest(request);
+    }
+
+    void StorageDriveLinux::QueueRequest(FileRequest* request)
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzCore);
+        AZ_Assert(request, "QueueRequest was provided a null request.");
+
+        if (!m_ring.IsInitialized())
+        {
+            StreamStackEntry::QueueRequest(request);
+            return;
+        }
+
+        AZStd::visit([this, request](auto&& args)
+        {
+            using Command = AZStd::decay_t<decltype(args)>;
+            if constexpr (AZStd::is_same_v<Command, FileRequest::ReadData>)
+            {
+                m_pendingReadRequests.push_back(request);
+                return;
+            }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::FileExistsCheckData> ||
+                AZStd::is_same_v<Command, FileRequest::FileMetaDataRetrievalData>)
+            {
+                m_pendingRequests.push_back(request);
+                return;
+            }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::CancelData>)
+            {
+                if (CancelRequest(request, args.m_target))
+                {
+                    // Only forward if this isn't part of the request chain, otherwise the storage device should
+                    // be the last step as it doesn't forward any (sub)requests.
+                    return;
+                }
+            }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::FlushData>)
+            {
+                FlushCache(args.m_path);
+            }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::FlushAllData>)
+            {
+                FlushEntireCache();
+            }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::ReportData>)
+            {
+                Report(args);
+            }
+            StreamStackEntry::QueueRequest(request);
+        }, request->GetCommand());
+    }
+
+    bool StorageDriveLinux::ExecuteRequests()
+    {
+        if (!m_ring.IsInitialized())
+        {
+            return StreamStackEntry::ExecuteRequests();
+        }
+
+        bool hasFinalizedReads = FinalizeReads();
+        bool hasWorked = SubmitReads();
+
+        if (!m_pendingRequests.empty())
+        {
+            FileRequest* request = m_pendingRequests.front();
+            hasWorked = AZStd::visit([this, request](auto&& args)
+            {
+                using Command = AZStd::decay_t<decltype(args)>;
+                if constexpr (AZStd::is_same_v<Command, FileRequest::FileExistsCheckData>)
+                {
+                    FileExistsRequest(request);
+                    m_pendingRequests.pop_front();
+                    return true;
+                }
+                else if constexpr (AZStd::is_same_v<Command, FileRequest::FileMetaDataRetrievalData>)
+                {
+                    FileMetaDataRetrievalRequest(request);
+                    m_pendingRequests.pop_front();
+                    return true;
+                }
+                else
+                {
+                    AZ_Assert(false, "A request was added to StorageDriveLinux's pending queue that isn't supported.");
+                    return false;
+                }
+            }, request->GetCommand()) || hasWorked;
+        }
+
+        return StreamStackEntry::ExecuteRequests() || hasFinalizedReads || hasWorked;
+    }
+
+    void StorageDriveLinux::UpdateStatus(Status& status) const
+    {
+        StreamStackEntry::UpdateStatus(status);
+        if (m_ring.IsInitialized())
+        {
+            status.m_numAvailableSlots = AZStd::min(status.m_numAvailableSlots, CalculateNumAvailableSlots());
+            status.m_isIdle = status.m_isIdle && m_pendingReadRequests.empty() && m_pendingRequests.empty() &&
+                (m_activeReads_Count == 0) && (m_pendingCancels_Count == 0) && (m_ring.GetNumUnsubmittedEntries() == 0);
+        }
+    }
+
+    void StorageDriveLinux::UpdateCompletionEstimates(AZStd::chrono::system_clock::time_point now, AZStd::vector<FileRequest*>& internalPending,
+        StreamerContext::PreparedQueue::iterator pendingBegin, StreamerContext::PreparedQueue::iterator pendingEnd)
+    {
+        StreamStackEntry::UpdateCompletionEstimates(now, internalPending, pendingBegin, pendingEnd);
+        if (!m_ring.IsInitialized())
+        {
+            return;
+        }
+
+        const RequestPath* activeFile = nullptr;
+        if (m_activeCacheSlot != InvalidFileCacheIndex)
+        {
+            activeFile = &m_fileCache_paths[m_activeCacheSlot];
+        }
+        u64 activeOffset = m_activeOffset;
+
+        // Determine the time of the first available slot
+        AZStd::chrono::system_clock::time_point earliestSlot = AZStd::chrono::system_clock::time_point::max();
+        for (size_t i = 0; i < m_readSlots_readInfo.size(); ++i)
+        {
+            if (m_readSlots_active[i])
+            {
+                FileReadInformation& read = m_readSlots_readInfo[i];
+                u64 totalBytesRead = m_readSizeAverage.GetTotal();
+                double totalReadTimeUSec = aznumeric_caster(m_readTimeAverage.GetTotal().count());
+                auto readCommand = AZStd::get_if<FileRequest::ReadData>(&read.m_request->GetCommand());
+                AZ_Assert(readCommand, "Request currently reading doesn't contain a read command.");
+                auto endTime = read.m_startTime + AZStd::chrono::microseconds(aznumeric_cast<u64>((readCommand->m_size * totalReadTimeUSec) / totalBytesRead));
+                earliestSlot = AZStd::min(earliestSlot, endTime);
+                read.m_request->SetEstimatedCompletion(endTime);
+            }
+        }
+        if (earliestSlot != AZStd::chrono::system_clock::time_point::max())
+        {
+            now = earliestSlot;
+        }
+
+        // Estimate requests in this stack entry.
+        for (FileRequest* request : m_pendingReadRequests)
+        {
+            EstimateCompletionTimeForRequest(request, now, activeFile, activeOffset);
+        }
+        for (FileRequest* request : m_pendingRequests)
+        {
+            EstimateCompletionTimeForRequest(request, now, activeFile, activeOffset);
+        }
+
+        // Estimate internally pending requests. Because this call will go from the top of the stack to the bottom,
+        // but estimation is calculated from the bottom to the top, this list should be processed in reverse order.
+        for (auto requestIt = internalPending.rbegin(); requestIt != internalPending.rend(); ++requestIt)
+        {
+            EstimateCompletionTimeForRequestChecked(*requestIt, now, activeFile, activeOffset);
+        }
+
+        // Estimate pending requests that have not been queued yet.
+        for (auto requestIt = pendingBegin; requestIt != pendingEnd; ++requestIt)
+        {
+            EstimateCompletionTimeForRequestChecked(*requestIt, now, activeFile, activeOffset);
+        }
+    }
+
+    void StorageDriveLinux::EstimateCompletionTimeForRequest(FileRequest* request, AZStd::chrono::system_clock::time_point& startTime,
+        const RequestPath*& activeFile, u64& activeOffset) const
+    {
+        u64 readSize = 0;
+        u64 offset = 0;
+        const RequestPath* targetFile = nullptr;
+
+        AZStd::visit([&](auto&& args)
+        {
+            using Command = AZStd::decay_t<decltype(args)>;
+            if constexpr (AZStd::is_same_v<Command, FileRequest::ReadData>)
+            {
+                targetFile = &args.m_path;
+                readSize = args.m_size;
+                offset = args.m_offset;
+            }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::CompressedReadData>)
+            {
+                targetFile = &args.m_compressionInfo.m_archiveFilename;
+                readSize = args.m_compressionInfo.m_compressedSize;
+                offset = args.m_compressionInfo.m_offset;
+            }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::FileExistsCheckData>)
+            {
+                readSize = 0;
+                startTime += m_getFileExistsTimeAverage.CalculateAverage();
+            }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::FileMetaDataRetrievalData>)
+            {
+                readSize = 0;
+                startTime += m_getFileMetaDataRetrievalTimeAverage.CalculateAverage();
+            }
+        }, request->GetCommand());
+
+        if (readSize > 0)
+        {
+            if (activeFile && activeFile != targetFile)
+            {
+                if (FindInFileHandleCache(*targetFile) == InvalidFileCacheIndex)
+                {
+                    startTime += m_fileOpenCloseTimeAverage.CalculateAverage();
+                }
+                activeOffset = std::numeric_limits<u64>::max();
+            }
+
+            if (activeOffset != offset && m_constructionOptions.m_hasSeekPenalty)
+            {
+                startTime += s_averageSeekTime;
+            }
+
+            u64 totalBytesRead = m_readSizeAverage.GetTotal();
+            double totalReadTimeUSec = aznumeric_caster(m_readTimeAverage.GetTotal().count());
+            startTime += AZStd::chrono::microseconds(aznumeric_cast<u64>((readSize * totalReadTimeUSec) / totalBytesRead));
+            activeOffset = offset + readSize;
+        }
+        request->SetEstimatedCompletion(startTime);
+    }
+
+    void StorageDriveLinux::EstimateCompletionTimeForRequestChecked(FileRequest* request,
+        AZStd::chrono::system_clock::time_point startTime, const RequestPath*& activeFile, u64& activeOffset) const
+    {
+        AZStd::visit([&, this](auto&& args)
+        {
+            using Command = AZStd::decay_t<decltype(args)>;
+            if constexpr (AZStd::is_same_v<Command, FileRequest::ReadData> ||
+                          AZStd::is_same_v<Command, FileRequest::FileExistsCheckData> ||
+                          AZStd::is_same_v<Command, FileRequest::CompressedReadData>)
+            {
+                EstimateCompletionTimeForRequest(request, startTime, activeFile, activeOffset);
+            }
+        }, request->GetCommand());
+    }
+
+    s32 StorageDriveLinux::CalculateNumAvailableSlots() const
+    {
+        return (m_overCommit + aznumeric_cast<s32>(m_queueDepth)) - aznumeric_cast<s32>(m_pendingReadRequests.size()) -
+            aznumeric_cast<s32>(m_pendingRequests.size()) - m_activeReads_Count;
+    }
+
+    void StorageDriveLinux::InitializeCaches()
+    {
+        m_fileCache_lastTimeUsed.resize(m_maxFileHandles, AZStd::chrono::system_clock::time_point::min());
+        m_fileCache_paths.resize(m_maxFileHandles);
+        m_fileCache_descriptors.resize(m_maxFileHandles, -1);
+        m_fileCache_activeReads.resize(m_maxFileHandles, 0);
+        m_fileCache_isDirect.resize(m_maxFileHandles, false);
+
+        // The read slots are never resized after this point as the kernel holds on to the addresses of the io vectors.
+        m_readSlots_readInfo.resize(m_queueDepth);
+        m_readSlots_active.resize(m_queueDepth);
+
+        if (m_registeredBufferSize > 0 && m_constructionOptions.m_enableDirectReads)
+        {
+            m_registeredBuffers = reinterpret_cast<u8*>(azmalloc(m_registeredBufferSize * m_queueDepth, m_physicalSectorSize, AZ::SystemAllocator));
+            AZStd::vector<iovec> buffers;
+            buffers.resize(m_queueDepth);
+            for (u32 i = 0; i < m_queueDepth; ++i)
+            {
+                buffers[i].iov_base = m_registeredBuffers + i * m_registeredBufferSize;
+                buffers[i].iov_len = m_registeredBufferSize;
+            }
+            if (!m_ring.RegisterBuffers(buffers.data(), m_queueDepth))
+            {
+                // Registered buffers count towards the locked memory limit (RLIMIT_MEMLOCK), which can be quite low.
+                AZ_Warning("StorageDriveLinux", false,
+                    "Unable to register %zu bytes of read buffers with io_uring (error %i). Unaligned reads will allocate a temporary "
+                    "buffer instead. Consider increasing the locked memory limit or lowering RegisteredBufferSizeKib.\n",
+                    m_registeredBufferSize * m_queueDepth, errno);
+                azfree(m_registeredBuffers, AZ::SystemAllocator);
+                m_registeredBuffers = nullptr;
+            }
+        }
+
+        m_cachesInitialized = true;
+    }
+
+    auto StorageDriveLinux::OpenFile(int& fileDescriptor, size_t& cacheSlot, FileRequest* request, const FileRequest::ReadData& data)
+        -> OpenFileResult
+    {
+        int file = -1;
+
+        // If the file is already opened for use, use that file handle and update it's last touched time.
+        size_t cacheIndex = FindInFileHandleCache(data.m_path);
+        if (cacheIndex != InvalidFileCacheIndex)
+        {
+            file = m_fileCache_descriptors[cacheIndex];
+            AZ_Assert(file >= 0, "Found the file '%s' in cache, but file descriptor is invalid.\n", data.m_path.GetRelativePath());
+        }
+        else
+        {
+            // If the file is not already found in the cache, attempt to claim an available cache entry.
+            cacheIndex = FindAvailableFileHandleCacheIndex();
+            if (cacheIndex == InvalidFileCacheIndex)
+            {
+                // No files ready to be evicted.
+                return OpenFileResult::CacheFull;
+            }
+
+            bool isDirect = false;
+            // Adding explicit scope here for profiling file Open & Close
+            {
+                AZ_PROFILE_SCOPE_DYNAMIC(AZ::Debug::ProfileCategory::AzCore, "StorageDriveLinux::ReadRequest OpenFile %s", m_name.c_str());
+                TIMED_AVERAGE_WINDOW_SCOPE(m_fileOpenCloseTimeAverage);
+
+                constexpr int openFlags = O_RDONLY | O_CLOEXEC;
+                if (m_constructionOptions.m_enableDirectReads)
+                {
+                    file = ::open(data.m_path.GetAbsolutePath(), openFlags | O_DIRECT);
+                    isDirect = file >= 0;
+                }
+                // Not all file systems support O_DIRECT, in which case open fails with EINVAL. Fall back to buffered reads.
+                if (file < 0 && (!m_constructionOptions.m_enableDirectReads || errno == EINVAL))
+                {
+                    file = ::open(data.m_path.GetAbsolutePath(), openFlags);
+                }
+
+                if (file < 0)
+                {
+                    // Failed to open the file, so let the next entry in the stack try.
+                    StreamStackEntry::QueueRequest(request);
+                    return OpenFileResult::RequestForwarded;
+                }
+
+                CloseFile(cacheIndex);
+            }
+
+            // Fill the cache entry with data about the new file.
+            m_fileCache_descriptors[cacheIndex] = file;
+            m_fileCache_activeReads[cacheIndex] = 0;
+            m_fileCache_isDirect[cacheIndex] = isDirect;
+            m_fileCache_paths[cacheIndex] = data.m_path;
+        }
+
+        // Set the current request and update timestamp, regardless of cache hit or miss.
+        m_fileCache_lastTimeUsed[cacheIndex] = AZStd::chrono::system_clock::now();
+        fileDescriptor = file;
+        cacheSlot = cacheIndex;
+        return OpenFileResult::FileOpened;
+    }
+
+    bool StorageDriveLinux::ReadRequest(FileRequest* request)
+    {
+        AZ_PROFILE_SCOPE_DYNAMIC(AZ::Debug::ProfileCategory::AzCore, "StorageDriveLinux::ReadRequest %s", m_name.c_str());
+
+        if (!m_cachesInitialized)
+        {
+            InitializeCaches();
+        }
+
+        if (m_activeReads_Count >= m_queueDepth || m_ring.GetNumAvailableEntries() == 0)
+        {
+            return false;
+        }
+
+        size_t readSlot = FindAvailableReadSlot();
+        AZ_Assert(readSlot != InvalidReadSlotIndex, "Active read slot count indicates there's a read slot available, but no read slot was found.");
+
+        auto data = AZStd::get_if<FileRequest::ReadData>(&request->GetCommand());
+        AZ_Assert(data, "Read request in StorageDriveLinux doesn't contain read data.");
+
+        int file = -1;
+        size_t fileCacheSlot = InvalidFileCacheIndex;
+        switch (OpenFile(file, fileCacheSlot, request, *data))
+        {
+        case OpenFileResult::FileOpened:
+            break;
+        case OpenFileResult::RequestForwarded:
+            return true;
+        case OpenFileResult::CacheFull:
+            return false;
+        default:
+            AZ_Assert(false, "Unsupported OpenFileRequest returned.");
+        }
+
+        u64 readSize = data->m_size;
+        u64 readOffs = data->m_offset;
+        u8* output = reinterpret_cast<u8*>(data->m_output);
+        bool useRegisteredBuffer = false;
+
+        FileReadInformation& readInfo = m_readSlots_readInfo[readSlot];
+        readInfo.m_request = request;
+        readInfo.m_fileHandleIndex = fileCacheSlot;
+
+        if (m_fileCache_isDirect[fileCacheSlot])
+        {
+            // Direct reads have the same alignment restrictions as unbuffered reads on Windows. See
+            // StorageDriveWin::ReadRequest for a detailed description of the adjustments below.
+            const bool alignedAddr = IStreamerTypes::IsAlignedTo(data->m_output, aznumeric_caster(m_physicalSectorSize));
+            const bool alignedOffs = IStreamerTypes::IsAlignedTo(data->m_offset, aznumeric_caster(m_logicalSectorSize));
+            if (!alignedOffs)
+            {
+                readOffs = AZ_SIZE_ALIGN_DOWN(readOffs, m_logicalSectorSize);
+                readInfo.m_copyBackOffset = data->m_offset - readOffs;
+                readSize = data->m_size + readInfo.m_copyBackOffset;
+            }
+
+            bool alignedSize = IStreamerTypes::IsAlignedTo(readSize, aznumeric_caster(m_logicalSectorSize));
+            if (!alignedSize)
+            {
+                u64 alignedReadSize = AZ_SIZE_ALIGN_UP(readSize, m_logicalSectorSize);
+                if (alignedReadSize <= data->m_outputSize)
+                {
+                    alignedSize = true;
+                    readSize = alignedReadSize;
+                }
+            }
+
+            const bool isAligned = (alignedAddr && alignedSize && alignedOffs);
+            if (!isAligned)
+            {
+                readSize = AZ_SIZE_ALIGN_UP(readSize, m_logicalSectorSize);
+                if (m_registeredBuffers && readSize <= m_registeredBufferSize)
+                {
+                    output = m_registeredBuffers + readSlot * m_registeredBufferSize;
+                    useRegisteredBuffer = true;
+                }
+                else
+                {
+                    readInfo.AllocateAlignedBuffer(readSize, m_physicalSectorSize);
+                    output = reinterpret_cast<u8*>(readInfo.m_sectorAlignedOutput);
+                }
+            }
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+            m_directReadsPercentageStat.PushSample(isAligned ? 1.0 : 0.0);
+            Statistic::PlotImmediate(m_name, DirectReadsName, m_directReadsPercentageStat.GetMostRecentSample());
+#endif // AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+        }
+        readInfo.m_readOutput = output;
+
+        bool isQueued = false;
+        if (useRegisteredBuffer)
+        {
+            isQueued = m_ring.QueueReadFixed(file, output, aznumeric_cast<u32>(readSize), readOffs, aznumeric_cast<u16>(readSlot), readSlot);
+        }
+        else
+        {
+            readInfo.m_ioVector.iov_base = output;
+            readInfo.m_ioVector.iov_len = aznumeric_cast<size_t>(readSize);
+            isQueued = m_ring.QueueReadVector(file, &readInfo.m_ioVector, readOffs, readSlot);
+        }
+        AZ_Assert(isQueued, "Available entries in the io_uring were checked, but the read couldn't be queued.");
+
+        auto now = AZStd::chrono::system_clock::now();
+        if (m_activeReads_Count++ == 0)
+        {
+            m_activeReads_startTime = now;
+        }
+        readInfo.m_startTime = now;
+        m_readSlots_active[readSlot] = true;
+
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+        if (m_activeCacheSlot == fileCacheSlot)
+        {
+            m_fileSwitchPercentageStat.PushSample(0.0);
+            m_seekPercentageStat.PushSample(m_activeOffset == data->m_offset ? 0.0 : 1.0);
+        }
+        else
+        {
+            m_fileSwitchPercentageStat.PushSample(1.0);
+            m_seekPercentageStat.PushSample(0.0);
+        }
+
+        Statistic::PlotImmediate(m_name, FileSwitchesName, m_fileSwitchPercentageStat.GetMostRecentSample());
+        Statistic::PlotImmediate(m_name, SeeksName, m_seekPercentageStat.GetMostRecentSample());
+#endif // AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+
+        m_fileCache_activeReads[fileCacheSlot]++;
+        m_activeCacheSlot = fileCacheSlot;
+        m_activeOffset = readOffs + readSize;
+
+        return true;
+    }
+
+    bool StorageDriveLinux::SubmitReads()
+    {
+        bool hasWorked = false;
+        while (!m_pendingReadRequests.empty())
+        {
+            FileRequest* request = m_pendingReadRequests.front();
+            if (!ReadRequest(request))
+            {
+                break;
+            }
+            m_pendingReadRequests.pop_front();
+            hasWorked = true;
+        }
+
+        // Hand all reads and cancels that were queued in this pass to the kernel with one system call.
+        u32 numUnsubmitted = m_ring.GetNumUnsubmittedEntries();
+        if (numUnsubmitted > 0)
+        {
+            AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::AzCore, "StorageDriveLinux::SubmitReads io_uring_enter");
+            s32 result = m_ring.Submit();
+            if (result > 0)
+            {
+                m_submitBatchSizeAverage.PushEntry(aznumeric_cast<u64>(result));
+            }
+            AZ_Error("StorageDriveLinux", result >= 0 || result == -EAGAIN || result == -EBUSY,
+                "Failed to submit %u requests to io_uring (error %i).\n", numUnsubmitted, -result);
+            // If the kernel was temporarily out of resources keep the Streamer thread running so the submit will be retried.
+            hasWorked = hasWorked || m_ring.GetNumUnsubmittedEntries() > 0;
+        }
+        return hasWorked;
+    }
+
+    bool StorageDriveLinux::CancelRequest(FileRequest* cancelRequest, FileRequestPtr& target)
+    {
+        bool ownsRequestChain = false;
+        for (auto it = m_pendingReadRequests.begin(); it != m_pendingReadRequests.end();)
+        {
+            if ((*it)->WorksOn(target))
+            {
+                (*it)->SetStatus(IStreamerTypes::RequestStatus::Canceled);
+                m_context->MarkRequestAsCompleted(*it);
+                it = m_pendingReadRequests.erase(it);
+                ownsRequestChain = true;
+            }
+            else
+            {
+                ++it;
+            }
+        }
+
+        // Pending requests have been accounted for, now address any active reads and ask the kernel to cancel them. The
+        // cancel is submitted with the next batch and the read completes with -ECANCELED if the kernel stopped it in time.
+        for (size_t readSlot = 0; readSlot < m_readSlots_active.size(); ++readSlot)
+        {
+            FileReadInformation& readInfo = m_readSlots_readInfo[readSlot];
+            if (m_readSlots_active[readSlot] && readInfo.m_request->WorksOn(target))
+            {
+                ownsRequestChain = true;
+                if (!readInfo.m_isCanceled && m_ring.QueueCancel(readSlot, CancelUserData))
+                {
+                    readInfo.m_isCanceled = true;
+                    m_pendingCancels_Count++;
+                }
+            }
+        }
+
+        if (ownsRequestChain)
+        {
+            cancelRequest->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(cancelRequest);
+        }
+
+        return ownsRequestChain;
+    }
+
+    void StorageDriveLinux::FileExistsRequest(FileRequest* request)
+    {
+        auto& fileExists = AZStd::get<FileRequest::FileExistsCheckData>(request->GetCommand());
+
+        AZ_PROFILE_SCOPE_DYNAMIC(AZ::Debug::ProfileCategory::AzCore, "StorageDriveLinux::FileExistsRequest %s : %s",
+            m_name.c_str(), fileExists.m_path.GetRelativePath());
+        TIMED_AVERAGE_WINDOW_SCOPE(m_getFileExistsTimeAverage);
+
+        if (FindInFileHandleCache(fileExists.m_path) != InvalidFileCacheIndex ||
+            FindInMetaDataCache(fileExists.m_path) != InvalidMetaDataCacheIndex)
+        {
+            fileExists.m_found = true;
+            request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(request);
+            return;
+        }
+
+        struct stat fileStatus;
+        if (::stat(fileExists.m_path.GetAbsolutePath(), &fileStatus) == 0)
+        {
+            if (S_ISREG(fileStatus.st_mode))
+            {
+                size_t cacheIndex = GetNextMetaDataCacheSlot();
+                m_metaDataCache_paths[cacheIndex] = fileExists.m_path;
+                m_metaDataCache_fileSize[cacheIndex] = aznumeric_caster(fileStatus.st_size);
+                fileExists.m_found = true;
+            }
+            request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(request);
+            return;
+        }
+
+        StreamStackEntry::QueueRequest(request);
+    }
+
+    void StorageDriveLinux::FileMetaDataRetrievalRequest(FileRequest* request)
+    {
+        auto& command = AZStd::get<FileRequest::FileMetaDataRetrievalData>(request->GetCommand());
+
+        AZ_PROFILE_SCOPE_DYNAMIC(AZ::Debug::ProfileCategory::AzCore, "StorageDriveLinux::FileMetaDataRetrievalRequest %s : %s",
+            m_name.c_str(), command.m_path.GetRelativePath());
+        TIMED_AVERAGE_WINDOW_SCOPE(m_getFileMetaDataRetrievalTimeAverage);
+
+        size_t cacheIndex = FindInMetaDataCache(command.m_path);
+        if (cacheIndex != InvalidMetaDataCacheIndex)
+        {
+            command.m_fileSize = m_metaDataCache_fileSize[cacheIndex];
+            command.m_found = true;
+            request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(request);
+            return;
+        }
+
+        struct stat fileStatus;
+        cacheIndex = FindInFileHandleCache(command.m_path);
+        int result = (cacheIndex != InvalidFileCacheIndex)
+            ? ::fstat(m_fileCache_descriptors[cacheIndex], &fileStatus)
+            : ::stat(command.m_path.GetAbsolutePath(), &fileStatus);
+        if (result != 0 || !S_ISREG(fileStatus.st_mode))
+        {
+            StreamStackEntry::QueueRequest(request);
+            return;
+        }
+
+        command.m_fileSize = aznumeric_caster(fileStatus.st_size);
+        command.m_found = true;
+
+        cacheIndex = GetNextMetaDataCacheSlot();
+        m_metaDataCache_paths[cacheIndex] = command.m_path;
+        m_metaDataCache_fileSize[cacheIndex] = command.m_fileSize;
+
+        request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+        m_context->MarkRequestAsCompleted(request);
+    }
+
+    void StorageDriveLinux::CloseFile(size_t cacheIndex)
+    {
+        if (m_fileCache_descriptors[cacheIndex] >= 0)
+        {
+            ::close(m_fileCache_descriptors[cacheIndex]);
+            m_fileCache_descriptors[cacheIndex] = -1;
+        }
+    }
+
+    void StorageDriveLinux::FlushCache(const RequestPath& filePath)
+    {
+        if (m_cachesInitialized)
+        {
+            size_t cacheIndex = FindInFileHandleCache(filePath);
+            if (cacheIndex != InvalidFileCacheIndex)
+            {
+                AZ_Assert(m_fileCache_activeReads[cacheIndex] == 0, "Flushing '%s' but it has %u active reads\n",
+                    filePath.GetRelativePath(), m_fileCache_activeReads[cacheIndex]);
+                CloseFile(cacheIndex);
+                m_fileCache_activeReads[cacheIndex] = 0;
+                m_fileCache_isDirect[cacheIndex] = false;
+                m_fileCache_lastTimeUsed[cacheIndex] = AZStd::chrono::system_clock::time_point();
+                m_fileCache_paths[cacheIndex].Clear();
+            }
+
+            cacheIndex = FindInMetaDataCache(filePath);
+            if (cacheIndex != InvalidMetaDataCacheIndex)
+            {
+                m_metaDataCache_paths[cacheIndex].Clear();
+                m_metaDataCache_fileSize[cacheIndex] = 0;
+            }
+        }
+    }
+
+    void StorageDriveLinux::FlushEntireCache()
+    {
+        if (m_cachesInitialized)
+        {
+            // Clear file handle cache
+            for (size_t cacheIndex = 0; cacheIndex < m_maxFileHandles; ++cacheIndex)
+            {
+                AZ_Assert(m_fileCache_activeReads[cacheIndex] == 0, "Flushing '%s' but it has %u active reads\n",
+                    m_fileCache_paths[cacheIndex].GetRelativePath(), m_fileCache_activeReads[cacheIndex]);
+                CloseFile(cacheIndex);
+                m_fileCache_activeReads[cacheIndex] = 0;
+                m_fileCache_isDirect[cacheIndex] = false;
+                m_fileCache_lastTimeUsed[cacheIndex] = AZStd::chrono::system_clock::time_point();
+                m_fileCache_paths[cacheIndex].Clear();
+            }
+
+            // Clear meta data cache
+            auto metaDataCacheSize = m_metaDataCache_paths.size();
+            m_metaDataCache_paths.clear();
+            m_metaDataCache_fileSize.clear();
+            m_metaDataCache_front = 0;
+            m_metaDataCache_paths.resize(metaDataCacheSize);
+            m_metaDataCache_fileSize.resize(metaDataCacheSize);
+        }
+    }
+
+    bool StorageDriveLinux::FinalizeReads()
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzCore);
+
+        u32 numCompleted = m_ring.ProcessCompletions([this](u64 userData, s32 result)
+            {
+                if (userData == CancelUserData)
+                {
+                    // The result of the cancel itself isn't needed as the canceled read gets its own completion.
+                    m_pendingCancels_Count--;
+                }
+                else
+                {
+                    FinalizeSingleRequest(aznumeric_cast<size_t>(userData), result);
+                }
+            });
+        return numCompleted > 0;
+    }
+
+    void StorageDriveLinux::FinalizeSingleRequest(size_t readSlot, s32 result)
+    {
+        AZ_Assert(readSlot < m_readSlots_active.size() && m_readSlots_active[readSlot],
+            "io_uring returned a completion for read slot %zu which isn't active.", readSlot);
+
+        size_t numBytesTransferred = result > 0 ? aznumeric_cast<size_t>(result) : 0;
+        m_activeReads_ByteCount += numBytesTransferred;
+        if (--m_activeReads_Count == 0)
+        {
+            // Update read stats now that the operation is done.
+            m_readSizeAverage.PushEntry(m_activeReads_ByteCount);
+            m_readTimeAverage.PushEntry(AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(
+                AZStd::chrono::system_clock::now() - m_activeReads_startTime));
+            Statistic::PlotImmediate(m_name, ReadSpeedName, CalculateReadSpeedMbps());
+
+            m_activeReads_ByteCount = 0;
+        }
+
+        FileReadInformation& fileReadInfo = m_readSlots_readInfo[readSlot];
+
+        auto readCommand = AZStd::get_if<FileRequest::ReadData>(&fileReadInfo.m_request->GetCommand());
+        AZ_Assert(readCommand != nullptr, "Request stored with the io_uring read did not contain a read request.");
+
+        // A read that was interrupted by a cancel can also report EINTR instead of ECANCELED.
+        const bool isCanceled = result == -ECANCELED || (fileReadInfo.m_isCanceled && result == -EINTR);
+        // The request could be reading more due to alignment requirements. It should however never read less that the amount of
+        // requested data.
+        const bool isSuccess = result >= 0 && (fileReadInfo.m_copyBackOffset + readCommand->m_size <= numBytesTransferred);
+        AZ_Error("StorageDriveLinux", result >= 0 || isCanceled, "Async file read of '%s' failed with error %i.\n",
+            readCommand->m_path.GetRelativePath(), -result);
+
+        if (isSuccess && fileReadInfo.m_readOutput != readCommand->m_output)
+        {
+            ::memcpy(readCommand->m_output, fileReadInfo.m_readOutput + fileReadInfo.m_copyBackOffset, readCommand->m_size);
+        }
+
+        fileReadInfo.m_request->SetStatus(
+            isCanceled
+                ? IStreamerTypes::RequestStatus::Canceled
+                : isSuccess
+                    ? IStreamerTypes::RequestStatus::Completed
+                    : IStreamerTypes::RequestStatus::Failed
+        );
+        m_context->MarkRequestAsCompleted(fileReadInfo.m_request);
+
+        m_fileCache_activeReads[fileReadInfo.m_fileHandleIndex]--;
+        m_readSlots_active[readSlot] = false;
+        fileReadInfo.Clear();
+    }
+
+    size_t StorageDriveLinux::FindInFileHandleCache(const RequestPath& filePath) const
+    {
+        size_t numFiles = m_fileCache_paths.size();
+        for (size_t i = 0; i < numFiles; ++i)
+        {
+            if (m_fileCache_paths[i] == filePath)
+            {
+                return i;
+            }
+        }
+        return InvalidFileCacheIndex;
+    }
+
+    size_t StorageDriveLinux::FindAvailableFileHandleCacheIndex() const
+    {
+        AZ_Assert(m_cachesInitialized, "Using file cache before it has been (lazily) initialized\n");
+
+        // This needs to look for files with no active reads, and the oldest file among those.
+        size_t cacheIndex = InvalidFileCacheIndex;
+        AZStd::chrono::system_clock::time_point oldest = AZStd::chrono::system_clock::time_point::max();
+        for (size_t index = 0; index < m_maxFileHandles; ++index)
+        {
+            if (m_fileCache_activeReads[index] == 0 && m_fileCache_lastTimeUsed[index] < oldest)
+            {
+                oldest = m_fileCache_lastTimeUsed[index];
+                cacheIndex = index;
+            }
+        }
+
+        return cacheIndex;
+    }
+
+    size_t StorageDriveLinux::FindAvailableReadSlot() const
+    {
+        for (size_t i = 0; i < m_readSlots_active.size(); ++i)
+        {
+            if (!m_readSlots_active[i])
+            {
+                return i;
+            }
+        }
+        return InvalidReadSlotIndex;
+    }
+
+    size_t StorageDriveLinux::FindInMetaDataCache(const RequestPath& filePath) const
+    {
+        size_t numFiles = m_metaDataCache_paths.size();
+        for (size_t i = 0; i < numFiles; ++i)
+        {
+            if (m_metaDataCache_paths[i] == filePath)
+            {
+                return i;
+            }
+        }
+        return InvalidMetaDataCacheIndex;
+    }
+
+    size_t StorageDriveLinux::GetNextMetaDataCacheSlot()
+    {
+        m_metaDataCache_front = (m_metaDataCache_front + 1) & (m_metaDataCache_paths.size() - 1);
+        return m_metaDataCache_front;
+    }
+
+    double StorageDriveLinux::CalculateReadSpeedMbps() const
+    {
+        constexpr double bytesToMB = aznumeric_cast<double>(1_mib);
+        using DoubleSeconds = AZStd::chrono::duration<double>;
+
+        double totalBytesReadMB = m_readSizeAverage.GetTotal() / bytesToMB;
+        double totalReadTimeSec = AZStd::chrono::duration_cast<DoubleSeconds>(m_readTimeAverage.GetTotal()).count();
+        return totalBytesReadMB / totalReadTimeSec;
+    }
+
+    void StorageDriveLinux::CollectStatistics(AZStd::vector<Statistic>& statistics) const
+    {
+        if (m_cachesInitialized)
+        {
+            statistics.push_back(Statistic::CreateFloat(m_name, ReadSpeedName, CalculateReadSpeedMbps()));
+            statistics.push_back(Statistic::CreateInteger(m_name, "File Open & Close (avg. us)", m_fileOpenCloseTimeAverage.CalculateAverage().count()));
+            statistics.push_back(Statistic::CreateInteger(m_name, "Get file exists (avg. us)", m_getFileExistsTimeAverage.CalculateAverage().count()));
+            statistics.push_back(Statistic::CreateInteger(m_name, "Get file meta data (avg. us)", m_getFileMetaDataRetrievalTimeAverage.CalculateAverage().count()));
+            statistics.push_back(Statistic::CreateFloat(m_name, "Submit batch size (avg.)", m_submitBatchSizeAverage.CalculateAverage()));
+
+            statistics.push_back(Statistic::CreateInteger(m_name, "Available slots", CalculateNumAvailableSlots()));
+            statistics.push_back(Statistic::CreateInteger(m_name, "Registered buffers", m_registeredBuffers ? m_queueDepth : 0));
+
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+            statistics.push_back(Statistic::CreatePercentage(m_name, FileSwitchesName, m_fileSwitchPercentageStat.GetAverage()));
+            statistics.push_back(Statistic::CreatePercentage(m_name, SeeksName, m_seekPercentageStat.GetAverage()));
+            statistics.push_back(Statistic::CreatePercentage(m_name, DirectReadsName, m_directReadsPercentageStat.GetAverage()));
+#endif
+        }
+        StreamStackEntry::CollectStatistics(statistics);
+    }
+
+    void StorageDriveLinux::Report(const FileRequest::ReportData& data) const
+    {
+        switch (data.m_reportType)
+        {
+        case FileRequest::ReportData::ReportType::FileLocks:
+            if (m_cachesInitialized)
+            {
+                for (u32 i = 0; i < m_maxFileHandles; ++i)
+                {
+                    if (m_fileCache_descriptors[i] >= 0)
+                    {
+                        AZ_Printf("Streamer", "File lock in %s : '%s'.\n", m_name.c_str(), m_fileCache_paths[i].GetRelativePath());
+                    }
+                }
+            }
+            else
+            {
+                AZ_Printf("Streamer", "File lock in %s : No files have been streamed.\n", m_name.c_str());
+            }
+            break;
+        default:
+            break;
+        }
+    }
+} // namespace AZ::IO
@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/IO/Streamer/IoUringQueue_Linux.h>
+#include <AzCore/IO/Streamer/Statistics.h>
+#include <AzCore/IO/Streamer/StreamerConfiguration.h>
+#include <AzCore/IO/Streamer/StreamStackEntry.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/chrono/clocks.h>
+#include <AzCore/Statistics/RunningStatistic.h>
+
+#include <sys/uio.h>
+
+namespace AZ::IO
+{
+    //! Storage drive that reads files asynchronously through io_uring. All reads that can be issued in a scheduling pass
+    //! are submitted to the kernel with a single system call and completions wake up the Streamer thread through the
+    //! eventfd of the StreamerContext. Files that can't be opened by this drive are forwarded to the next entry in the
+    //! stack, which is expected to be the generic StorageDrive.
+    class StorageDriveLinux
+        : public StreamStackEntry
+    {
+    public:
+        struct ConstructionOptions
+        {
+            ConstructionOptions();
+
+            //! Whether or not the device has a cost for seeking, such as happens on platter disks. This
+            //! will be accounted for when predicting file reads.
+            u8 m_hasSeekPenalty : 1;
+            //! Open files with O_DIRECT to bypass the page cache. Similar to unbuffered reads on Windows this gives the
+            //! fastest first read, but rereads can't be serviced from the page cache. Direct reads have alignment
+            //! restrictions on the output buffer, offset and size. Reads that don't meet them are read into an aligned
+            //! (registered) buffer and copied to the output. Files on file systems that don't support O_DIRECT, such as
+            //! tmpfs, automatically fall back to buffered reads.
+            u8 m_enableDirectReads : 1;
+            //! If true, only information that's explicitly requested or issues are reported. If false, status information
+            //! such as when drives are created and destroyed is reported as well.
+            u8 m_minimalReporting : 1;
+        };
+
+        //! Creates an instance of a storage device that uses io_uring for asynchronous reads.
+        //! @param maxFileHandles The maximum number of file handles that are cached. Only a small number are needed when
+        //!     running from archives, but it's recommended that a larger number are kept open when reading from loose files.
+        //! @param maxMetaDataCacheEntires The maximum number of files to keep meta data, such as the file size, to cache.
+        //!     Needs to be a power of 2.
+        //! @param physicalSectorSize The alignment of the output buffer for direct reads.
+        //! @param logicalSectorSize The alignment of the read offset and size for direct reads.
+        //! @param queueDepth The maximum number of reads that are in flight at the same time.
+        //! @param overCommit The number of additional slots that will be reported as available. This makes sure that there are
+        //!     always a few requests pending to avoid starvation. A negative value will under-commit.
+        //! @param registeredBufferSize The size of the buffer per read slot that's registered with the kernel. Reads that need
+        //!     to be realigned and fit in this buffer avoid an allocation and the kernel doesn't need to map the pages on
+        //!     every read. Use 0 to disable registered buffers.
+        //! @param options Additional configuration options. See ConstructionOptions for more details.
+        StorageDriveLinux(u32 maxFileHandles, u32 maxMetaDataCacheEntries, size_t physicalSectorSize, size_t logicalSectorSize,
+            u32 queueDepth, s32 overCommit, size_t registeredBufferSize, ConstructionOptions options);
+        ~StorageDriveLinux() override;
+
+        void SetContext(StreamerContext& context) override;
+
+        void PrepareRequest(FileRequest* request) override;
+        void QueueRequest(FileRequest* request) override;
+        bool ExecuteRequests() override;
+
+        void UpdateStatus(Status& status) const override;
+        void UpdateCompletionEstimates(AZStd::chrono::system_clock::time_point now, AZStd::vector<FileRequest*>& internalPending,
+            StreamerContext::PreparedQueue::iterator pendingBegin, StreamerContext::PreparedQueue::iterator pendingEnd) override;
+
+        void CollectStatistics(AZStd::vector<Statistic>& statistics) const override;
+
+    protected:
+        static const AZStd::chrono::microseconds s_averageSeekTime;
+
+        inline static constexpr size_t InvalidFileCacheIndex = std::numeric_limits<size_t>::max();
+        inline static constexpr size_t InvalidReadSlotIndex = std::numeric_limits<size_t>::max();
+        inline static constexpr size_t InvalidMetaDataCacheIndex = std::numeric_limits<size_t>::max();
+        //! User data for cancel requests. Read requests use the index of their read slot as user data.
+        inline static constexpr u64 CancelUserData = std::numeric_limits<u64>::max();
+
+        struct FileReadInformation
+        {
+            AZStd::chrono::system_clock::time_point m_startTime;
+            FileRequest* m_request{ nullptr };
+            void* m_sectorAlignedOutput{ nullptr };    // Internally allocated buffer that is sector aligned.
+            u8* m_readOutput{ nullptr };               // The buffer the kernel is reading into.
+            iovec m_ioVector{};
+            size_t m_copyBackOffset{ 0 };
+            size_t m_fileHandleIndex{ InvalidFileCacheIndex };
+            bool m_isCanceled{ false };
+
+            void AllocateAlignedBuffer(size_t size, size_t sectorSize);
+            void Clear();
+        };
+
+        enum class OpenFileResult
+        {
+            FileOpened,
+            RequestForwarded,
+            CacheFull
+        };
+
+        void InitializeCaches();
+        OpenFileResult OpenFile(int& fileDescriptor, size_t& cacheSlot, FileRequest* request, const FileRequest::ReadData& data);
+        bool ReadRequest(FileRequest* request);
+        bool CancelRequest(FileRequest* cancelRequest, FileRequestPtr& target);
+        void FileExistsRequest(FileRequest* request);
+        void FileMetaDataRetrievalRequest(FileRequest* request);
+        size_t FindInFileHandleCache(const RequestPath& filePath) const;
+        size_t FindAvailableFileHandleCacheIndex() const;
+        size_t FindAvailableReadSlot() const;
+        size_t FindInMetaDataCache(const RequestPath& filePath) const;
+        size_t GetNextMetaDataCacheSlot();
+
+        void EstimateCompletionTimeForRequest(FileRequest* request, AZStd::chrono::system_clock::time_point& startTime,
+            const RequestPath*& activeFile, u64& activeOffset) const;
+        void EstimateCompletionTimeForRequestChecked(FileRequest* request,
+            AZStd::chrono::system_clock::time_point startTime, const RequestPath*& activeFile, u64& activeOffset) const;
+        s32 CalculateNumAvailableSlots() const;
+
+        void FlushCache(const RequestPath& filePath);
+        void FlushEntireCache();
+        void CloseFile(size_t cacheIndex);
+
+        bool SubmitReads();
+        bool FinalizeReads();
+        void FinalizeSingleRequest(size_t readSlot, s32 result);
+
+        void Report(const FileRequest::ReportData& data) const;
+        //! Returns the read speed in megabytes per second over the recent reads.
+        double CalculateReadSpeedMbps() const;
+
+        IoUringQueue m_ring;
+
+        TimedAverageWindow<s_statisticsWindowSize> m_fileOpenCloseTimeAverage;
+        TimedAverageWindow<s_statisticsWindowSize> m_getFileExistsTimeAverage;
+        TimedAverageWindow<s_statisticsWindowSize> m_getFileMetaDataRetrievalTimeAverage;
+        TimedAverageWindow<s_statisticsWindowSize> m_readTimeAverage;
+        AverageWindow<u64, float, s_statisticsWindowSize> m_readSizeAverage;
+        AverageWindow<u64, float, s_statisticsWindowSize> m_submitBatchSizeAverage;
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+        AZ::Statistics::RunningStatistic m_fileSwitchPercentageStat;
+        AZ::Statistics::RunningStatistic m_seekPercentageStat;
+        AZ::Statistics::RunningStatistic m_directReadsPercentageStat;
+#endif
+        AZStd::chrono::system_clock::time_point m_activeReads_startTime;
+
+        AZStd::deque<FileRequest*> m_pendingReadRequests;
+        AZStd::deque<FileRequest*> m_pendingRequests;
+
+        AZStd::vector<FileReadInformation> m_readSlots_readInfo;
+        AZStd::vector<bool> m_readSlots_active;
+
+        AZStd::vector<AZStd::chrono::system_clock::time_point> m_fileCache_lastTimeUsed;
+        AZStd::vector<RequestPath> m_fileCache_paths;
+        AZStd::vector<int> m_fileCache_descriptors;
+        AZStd::vector<u16> m_fileCache_activeReads;
+        AZStd::vector<bool> m_fileCache_isDirect;
+
+        AZStd::vector<RequestPath> m_metaDataCache_paths;
+        AZStd::vector<u64> m_metaDataCache_fileSize;
+
+        //! One buffer per read slot, allocated as a single block and registered with the kernel.
+        u8* m_registeredBuffers{ nullptr };
+
+        size_t m_activeReads_ByteCount{ 0 };
+
+        size_t m_physicalSectorSize{ 0 };
+        size_t m_logicalSectorSize{ 0 };
+        size_t m_registeredBufferSize{ 0 };
+        size_t m_activeCacheSlot{ InvalidFileCacheIndex };
+        size_t m_metaDataCache_front{ 0 };
+        u64 m_activeOffset{ 0 };
+        u32 m_maxFileHandles{ 1 };
+        u32 m_queueDepth{ 1 };
+        s32 m_overCommit{ 0 };
+
+        u16 m_activeReads_Count{ 0 };
+        u16 m_pendingCancels_Count{ 0 };
+
+        ConstructionOptions m_constructionOptions;
+        bool m_cachesInitialized{ false };
+    };
+} // namespace AZ::IO
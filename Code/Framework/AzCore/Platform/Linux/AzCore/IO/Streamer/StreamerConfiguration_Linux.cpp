@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/IO/IStreamerTypes.h>
+#include <AzCore/IO/Streamer/StorageDriveConfig_Linux.h>
+#include <AzCore/IO/Streamer/StreamerConfiguration.h>
+#include <AzCore/IO/Streamer/StreamerConfiguration_Linux.h>
+#include <AzCore/std/string/string.h>
+
+#include <dirent.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+namespace AZ::IO
+{
+    static bool ReadBlockDeviceValue(const char* deviceName, const char* queueValue, u64& value)
+    {
+        AZStd::string path = AZStd::string::format("/sys/block/%s/queue/%s", deviceName, queueValue);
+        FILE* file = fopen(path.c_str(), "r");
+        if (!file)
+        {
+            return false;
+        }
+        unsigned long long readValue = 0;
+        bool result = fscanf(file, "%llu", &readValue) == 1;
+        fclose(file);
+        value = readValue;
+        return result;
+    }
+
+    static bool IsVirtualBlockDevice(const char* deviceName)
+    {
+        // Loop, ram and device mapper devices either map onto one of the physical devices or don't have meaningful values.
+        return strncmp(deviceName, "loop", 4) == 0 || strncmp(deviceName, "ram", 3) == 0 || strncmp(deviceName, "zram", 4) == 0 ||
+            strncmp(deviceName, "dm-", 3) == 0;
+    }
+
+    static bool CollectHardwareInfo(HardwareInformation& hardwareInfo, bool includeAllHardware, bool reportHardware)
+    {
+        DIR* blockDevices = opendir("/sys/block");
+        if (!blockDevices)
+        {
+            return false;
+        }
+
+        LinuxDriveInformation driveInfo;
+        driveInfo.m_physicalSectorSize = 0;
+        driveInfo.m_logicalSectorSize = 0;
+        driveInfo.m_hasSeekPenalty = false;
+        size_t maxTransfer = 0;
+        u32 numDevices = 0;
+
+        while (dirent* entry = readdir(blockDevices))
+        {
+            if (entry->d_name[0] == '.' || (!includeAllHardware && IsVirtualBlockDevice(entry->d_name)))
+            {
+                continue;
+            }
+
+            u64 physicalSectorSize = 0;
+            u64 logicalSectorSize = 0;
+            if (!ReadBlockDeviceValue(entry->d_name, "physical_block_size", physicalSectorSize) ||
+                !ReadBlockDeviceValue(entry->d_name, "logical_block_size", logicalSectorSize))
+            {
+                continue;
+            }
+
+            u64 rotational = 1;
+            ReadBlockDeviceValue(entry->d_name, "rotational", rotational);
+            u64 maxTransferKib = 0;
+            ReadBlockDeviceValue(entry->d_name, "max_sectors_kb", maxTransferKib);
+            u64 queueDepth = 0;
+            ReadBlockDeviceValue(entry->d_name, "nr_requests", queueDepth);
+
+            if (reportHardware)
+            {
+                AZ_Printf("Streamer", "Block device '%s':\n", entry->d_name);
+                AZ_Printf("Streamer", "    Physical sector size: %llu\n", physicalSectorSize);
+                AZ_Printf("Streamer", "    Logical sector size: %llu\n", logicalSectorSize);
+                AZ_Printf("Streamer", "    Max transfer: %llu kib\n", maxTransferKib);
+                AZ_Printf("Streamer", "    Queue depth: %llu\n", queueDepth);
+                AZ_Printf("Streamer", "    Has seek penalty: %s\n", rotational != 0 ? "Yes" : "No");
+            }
+
+            driveInfo.m_physicalSectorSize = AZStd::max(driveInfo.m_physicalSectorSize, aznumeric_cast<size_t>(physicalSectorSize));
+            driveInfo.m_logicalSectorSize = AZStd::max(driveInfo.m_logicalSectorSize, aznumeric_cast<size_t>(logicalSectorSize));
+            driveInfo.m_hasSeekPenalty = driveInfo.m_hasSeekPenalty || rotational != 0;
+            if (queueDepth > 0)
+            {
+                u32 depth = aznumeric_cast<u32>(queueDepth);
+                driveInfo.m_ioQueueDepth = driveInfo.m_ioQueueDepth == 0 ? depth : AZStd::min(driveInfo.m_ioQueueDepth, depth);
+            }
+            if (maxTransferKib > 0)
+            {
+                size_t transfer = aznumeric_cast<size_t>(maxTransferKib * 1_kib);
+                maxTransfer = maxTransfer == 0 ? transfer : AZStd::min(maxTransfer, transfer);
+            }
+            ++numDevices;
+        }
+        closedir(blockDevices);
+
+        if (numDevices == 0 || !IStreamerTypes::IsPowerOf2(driveInfo.m_physicalSectorSize) ||
+            !IStreamerTypes::IsPowerOf2(driveInfo.m_logicalSectorSize))
+        {
+            return false;
+        }
+
+        long pageSize = sysconf(_SC_PAGESIZE);
+        hardwareInfo.m_maxPageSize = pageSize > 0 ? aznumeric_cast<size_t>(pageSize) : 4096;
+        hardwareInfo.m_maxTransfer = maxTransfer > 0 ? maxTransfer : 512_kib;
+        hardwareInfo.m_maxPhysicalSectorSize = driveInfo.m_physicalSectorSize;
+        hardwareInfo.m_maxLogicalSectorSize = driveInfo.m_logicalSectorSize;
+        hardwareInfo.m_profile = "Generic";
+        hardwareInfo.m_platformData = AZStd::make_any<LinuxDriveInformation>(driveInfo);
+        return true;
+    }
+
+    bool CollectIoHardwareInformation(HardwareInformation& info, bool includeAllHardware, bool reportHardware)
+    {
+        if (!CollectHardwareInfo(info, includeAllHardware, reportHardware))
+        {
+            // The numbers below are based on common defaults from a local hardware survey.
+            info.m_maxPageSize = 4096;
+            info.m_maxTransfer = 512_kib;
+            info.m_maxPhysicalSectorSize = 4096;
+            info.m_maxLogicalSectorSize = 512;
+            info.m_profile = "Generic";
+        }
+        return true;
+    }
+
+    void ReflectNative(ReflectContext* context)
+    {
+        LinuxStorageDriveConfig::Reflect(context);
+    }
+} // namespace AZ::IO
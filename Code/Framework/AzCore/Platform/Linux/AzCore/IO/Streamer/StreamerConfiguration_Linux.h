@@ -0,0 +1,27 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/Memory/Memory.h>
+
+namespace AZ::IO
+{
+    //! Combined information about the block devices in the system. Paths aren't mapped to devices on Linux, so the
+    //! storage drive uses the most restrictive values across all devices.
+    struct LinuxDriveInformation
+    {
+        AZ_TYPE_INFO(AZ::IO::LinuxDriveInformation, "{3C5E8B1A-7D24-4F6B-A9E0-52D1C6F4B873}");
+
+        size_t m_physicalSectorSize{ 4096 };
+        size_t m_logicalSectorSize{ 512 };
+        //! The smallest hardware request queue size across the devices, or 0 if unknown.
+        u32 m_ioQueueDepth{ 0 };
+        bool m_hasSeekPenalty{ true };
+    };
+} // namespace AZ::IO
@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Debug/Trace.h>
+#include <AzCore/IO/Streamer/StreamerContext_Linux.h>
+
+#include <errno.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+namespace AZ::Platform
+{
+    StreamerContextThreadSync::StreamerContextThreadSync()
+    {
+        m_wakeUpEvent = ::eventfd(0, EFD_CLOEXEC);
+        AZ_Error("StreamerContext", m_wakeUpEvent >= 0, "Unable to create the eventfd for the Streamer thread (error %i).", errno);
+    }
+
+    StreamerContextThreadSync::~StreamerContextThreadSync()
+    {
+        if (m_wakeUpEvent >= 0)
+        {
+            ::close(m_wakeUpEvent);
+        }
+    }
+
+    void StreamerContextThreadSync::Suspend()
+    {
+        // Reading blocks until the counter is non-zero and then resets it, so wake up calls that are queued before
+        // suspending, or completions signaled by the kernel, aren't lost.
+        eventfd_t value;
+        while (::eventfd_read(m_wakeUpEvent, &value) != 0)
+        {
+            if (errno != EINTR)
+            {
+                AZ_Error("StreamerContext", false, "Failed to wait on the Streamer thread eventfd (error %i).", errno);
+                return;
+            }
+        }
+    }
+
+    void StreamerContextThreadSync::Resume()
+    {
+        ::eventfd_write(m_wakeUpEvent, 1);
+    }
+
+    int StreamerContextThreadSync::GetWakeUpEventDescriptor() const
+    {
+        return m_wakeUpEvent;
+    }
+} // namespace AZ::Platform
@@ -0,0 +1,30 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/base.h>
+
+namespace AZ::Platform
+{
+    //! Synchronizes the scheduler thread through an eventfd. Besides explicit wake up calls, the eventfd can be registered
+    //! with the kernel, for instance with an io_uring instance, so completed asynchronous IO wakes up the scheduler thread.
+    class StreamerContextThreadSync
+    {
+    public:
+        StreamerContextThreadSync();
+        ~StreamerContextThreadSync();
+
+        void Suspend();
+        void Resume();
+
+        //! Returns the eventfd the scheduler thread is sleeping on, or -1 if the eventfd couldn't be created.
+        int GetWakeUpEventDescriptor() const;
+
+    private:
+        int m_wakeUpEvent{ -1 };
+    };
+} // namespace AZ::Platform
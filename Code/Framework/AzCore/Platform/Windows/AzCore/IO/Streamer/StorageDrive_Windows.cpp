@@ -18,6 +18,7 @@
 
 namespace AZ::IO
 {
+    static constexpr char ReadSpeedName[] = "Read Speed (avg. mbps)";
 #if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
     static constexpr char FileSwitchesName[] = "File switches";
     static constexpr char SeeksName[] = "Seeks";
@@ -991,6 +992,7 @@ namespace AZ::IO
             m_readSizeAverage.PushEntry(m_activeReads_ByteCount);
             m_readTimeAverage.PushEntry(AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(
                 AZStd::chrono::system_clock::now() - m_activeReads_startTime));
+            Statistic::PlotImmediate(m_name, ReadSpeedName, CalculateReadSpeedMbps());
 
             m_activeReads_ByteCount = 0;
         }
@@ -1114,16 +1116,21 @@ namespace AZ::IO
         return false;
     }
 
+    double StorageDriveWin::CalculateReadSpeedMbps() const
+    {
+        constexpr double bytesToMB = aznumeric_cast<double>(1_mib);
+        using DoubleSeconds = AZStd::chrono::duration<double>;
+
+        double totalBytesReadMB = m_readSizeAverage.GetTotal() / bytesToMB;
+        double totalReadTimeSec = AZStd::chrono::duration_cast<DoubleSeconds>(m_readTimeAverage.GetTotal()).count();
+        return totalBytesReadMB / totalReadTimeSec;
+    }
+
     void StorageDriveWin::CollectStatistics(AZStd::vector<Statistic>& statistics) const
     {
         if (m_cachesInitialized)
         {
-            constexpr double bytesToMB = aznumeric_cast<double>(1_mib);
-            using DoubleSeconds = AZStd::chrono::duration<double>;
-
-            double totalBytesReadMB = m_readSizeAverage.GetTotal() / bytesToMB;
-            double totalReadTimeSec = AZStd::chrono::duration_cast<DoubleSeconds>(m_readTimeAverage.GetTotal()).count();
-            statistics.push_back(Statistic::CreateFloat(m_name, "Read Speed (avg. mbps)", totalBytesReadMB / totalReadTimeSec));
+            statistics.push_back(Statistic::CreateFloat(m_name, ReadSpeedName, CalculateReadSpeedMbps()));
             statistics.push_back(Statistic::CreateInteger(m_name, "File Open & Close (avg. us)", m_fileOpenCloseTimeAverage.CalculateAverage().count()));
             statistics.push_back(Statistic::CreateInteger(m_name, "Get file exists (avg. us)", m_getFileExistsTimeAverage.CalculateAverage().count()));
             statistics.push_back(Statistic::CreateInteger(m_name, "Get file meta data (avg. us)", m_getFileMetaDataRetrievalTimeAverage.CalculateAverage().count()));
@@ -137,6 +137,8 @@ namespace AZ::IO
             bool isCanceled, bool encounteredError);
 
         void Report(const FileRequest::ReportData& data) const;
+        //! Returns the read speed in megabytes per second over the recent reads.
+        double CalculateReadSpeedMbps() const;
 
         TimedAverageWindow<s_statisticsWindowSize> m_fileOpenCloseTimeAverage;
         TimedAverageWindow<s_statisticsWindowSize> m_getFileExistsTimeAverage;
@@ -11,6 +11,8 @@
 #include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/containers/fixed_unordered_set.h>
 #include <AzCore/std/containers/fixed_unordered_map.h>
+#include <AzCore/std/containers/flat_hash_map.h>
+#include <AzCore/std/containers/flat_hash_set.h>
 #include <AzCore/std/string/string.h>
 
 #if defined(HAVE_BENCHMARK)
@@ -2079,6 +2081,173 @@ namespace UnitTest
         EXPECT_EQ(0, HashedContainerTransparentTestInternal::s_allAssignmentCount);
     }
 
+    TEST_F(HashedContainers, FlatHashMapBasic)
+    {
+        flat_hash_map<int, int> intIntMap;
+        ValidateHash(intIntMap);
+        EXPECT_EQ(0, intIntMap.capacity());
+        EXPECT_TRUE(intIntMap.find(1) == intIntMap.end());
+
+        for (int i = 0; i < 100; ++i)
+        {
+            EXPECT_TRUE(intIntMap.insert(AZStd::make_pair(i, i * 2)).second);
+        }
+        ValidateHash(intIntMap, 100);
+        EXPECT_FALSE(intIntMap.insert(AZStd::make_pair(5, 0)).second);
+        EXPECT_EQ(10, intIntMap.at(5));
+        EXPECT_GE(intIntMap.capacity(), 100u);
+        EXPECT_LE(intIntMap.load_factor(), intIntMap.max_load_factor());
+
+        int sum = 0;
+        for (const auto& element : intIntMap)
+        {
+            EXPECT_EQ(element.first * 2, element.second);
+            ++sum;
+        }
+        EXPECT_EQ(100, sum);
+
+        EXPECT_EQ(1, intIntMap.erase(10));
+        EXPECT_EQ(0, intIntMap.erase(10));
+        EXPECT_EQ(0, intIntMap.count(10));
+        EXPECT_FALSE(intIntMap.contains(10));
+        ValidateHash(intIntMap, 99);
+
+        intIntMap[10] = 7;
+        intIntMap[1000] = 8;
+        EXPECT_EQ(7, intIntMap[10]);
+        EXPECT_EQ(8, intIntMap.find(1000)->second);
+        ValidateHash(intIntMap, 101);
+
+        flat_hash_map<int, int> copyMap(intIntMap);
+        EXPECT_TRUE(copyMap == intIntMap);
+        copyMap[1000] = 9;
+        EXPECT_TRUE(copyMap != intIntMap);
+
+        flat_hash_map<int, int> movedMap(AZStd::move(copyMap));
+        ValidateHash(copyMap);
+        ValidateHash(movedMap, 101);
+
+        intIntMap.clear();
+        ValidateHash(intIntMap);
+        EXPECT_GT(intIntMap.capacity(), 0u);
+        intIntMap.rehash(0);
+        EXPECT_EQ(0, intIntMap.capacity());
+
+        flat_hash_map<int, int> listMap({ { 1, 2 }, { 3, 4 }, { 1, 5 } });
+        ValidateHash(listMap, 2);
+        EXPECT_EQ(2, listMap[1]);
+    }
+
+    TEST_F(HashedContainers, FlatHashMapEraseWhileIterating)
+    {
+        flat_hash_map<int, int> intIntMap;
+        for (int i = 0; i < 1000; ++i)
+        {
+            intIntMap.emplace(i, i);
+        }
+
+        for (auto it = intIntMap.begin(); it != intIntMap.end();)
+        {
+            it = (it->first % 3 == 0) ? intIntMap.erase(it) : AZStd::next(it);
+        }
+        ValidateHash(intIntMap, 666);
+        EXPECT_EQ(333, AZStd::erase_if(intIntMap, [](const auto& element) { return element.first % 3 == 1; }));
+        ValidateHash(intIntMap, 333);
+        for (const auto& element : intIntMap)
+        {
+            EXPECT_EQ(2, element.first % 3);
+        }
+
+        while (!intIntMap.empty())
+        {
+            intIntMap.erase(intIntMap.begin());
+        }
+        ValidateHash(intIntMap);
+    }
+
+    TEST_F(HashedContainers, FlatHashMapMatchesUnorderedMap_WithRandomOperations)
+    {
+        // Mixes inserts and erases on a small key range to grow, fill with tombstones and rehash in place
+        flat_hash_map<int, AZStd::string> flatMap;
+        unordered_map<int, AZStd::string> referenceMap;
+        unsigned int seed = 1;
+        for (int i = 0; i < 20000; ++i)
+        {
+            seed = seed * 1664525u + 1013904223u;
+            const int key = static_cast<int>((seed >> 8) % 500);
+            switch ((seed >> 4) % 3)
+            {
+            case 0:
+                flatMap[key] = AZStd::string::format("value %d", i);
+                referenceMap[key] = flatMap[key];
+                break;
+            case 1:
+                EXPECT_EQ(referenceMap.erase(key), flatMap.erase(key));
+                break;
+            default:
+                EXPECT_EQ(referenceMap.find(key) != referenceMap.end(), flatMap.find(key) != flatMap.end());
+                break;
+            }
+            ASSERT_EQ(referenceMap.size(), flatMap.size());
+        }
+        ValidateHash(flatMap, referenceMap.size());
+        for (const auto& element : referenceMap)
+        {
+            EXPECT_EQ(element.second, flatMap.at(element.first));
+        }
+    }
+
+    TEST_F(HashedContainers, FlatHashMapTryEmplace_DoesNotConstruct_OnExistingKey)
+    {
+        flat_hash_map<int, MyNoCopyClass> noCopyMap;
+        auto result = noCopyMap.try_emplace(1, 1, true, 1.0f);
+        EXPECT_TRUE(result.second);
+        EXPECT_TRUE(result.first->second.m_bool);
+
+        result = noCopyMap.try_emplace(1, 2, false, 2.0f);
+        EXPECT_FALSE(result.second);
+        EXPECT_TRUE(result.first->second.m_bool);
+
+        flat_hash_map<int, int> intIntMap;
+        EXPECT_TRUE(intIntMap.insert_or_assign(1, 2).second);
+        EXPECT_FALSE(intIntMap.insert_or_assign(1, 3).second);
+        EXPECT_EQ(3, intIntMap[1]);
+    }
+
+    TEST_F(HashedContainers, FlatHashSetBasic)
+    {
+        flat_hash_set<int> intSet;
+        ValidateHash(intSet);
+        for (int i = 0; i < 200; i += 2)
+        {
+            EXPECT_TRUE(intSet.insert(i).second);
+        }
+        EXPECT_FALSE(intSet.insert(0).second);
+        ValidateHash(intSet, 100);
+        EXPECT_TRUE(intSet.contains(100));
+        EXPECT_FALSE(intSet.contains(101));
+
+        intSet.reserve(1000);
+        const auto capacity = intSet.capacity();
+        for (int i = 1; i < 1000; i += 2)
+        {
+            intSet.emplace(i);
+        }
+        EXPECT_EQ(capacity, intSet.capacity());
+        ValidateHash(intSet, 600);
+
+        flat_hash_set<int> otherSet(intSet.begin(), intSet.end());
+        EXPECT_TRUE(otherSet == intSet);
+        otherSet.erase(5);
+        EXPECT_TRUE(otherSet != intSet);
+
+        flat_hash_set<AZStd::string> stringSet{ "one", "two", "three" };
+        ValidateHash(stringSet, 3);
+        EXPECT_TRUE(stringSet.contains("two"));
+        EXPECT_EQ(1, stringSet.erase("two"));
+        ValidateHash(stringSet, 2);
+    }
+
 #if defined(HAVE_BENCHMARK)
     template <template <typename...> class Hash>
     void Benchmark_Lookup(benchmark::State& state)
@@ -2172,6 +2341,30 @@ namespace UnitTest
         Benchmark_Thrash<AZStd::unordered_map>(state);
     }
     BENCHMARK(Benchmark_UnorderedMapThrash);
+
+    void Benchmark_FlatHashMapLookup(benchmark::State& state)
+    {
+        Benchmark_Lookup<AZStd::flat_hash_map>(state);
+    }
+    BENCHMARK(Benchmark_FlatHashMapLookup);
+
+    void Benchmark_FlatHashMapInsert(benchmark::State& state)
+    {
+        Benchmark_Insert<AZStd::flat_hash_map>(state);
+    }
+    BENCHMARK(Benchmark_FlatHashMapInsert);
+
+    void Benchmark_FlatHashMapErase(benchmark::State& state)
+    {
+        Benchmark_Erase<AZStd::flat_hash_map>(state);
+    }
+    BENCHMARK(Benchmark_FlatHashMapErase);
+
+    void Benchmark_FlatHashMapThrash(benchmark::State& state)
+    {
+        Benchmark_Thrash<AZStd::flat_hash_map>(state);
+    }
+    BENCHMARK(Benchmark_FlatHashMapThrash);
 #endif
 } // namespace UnitTest
 
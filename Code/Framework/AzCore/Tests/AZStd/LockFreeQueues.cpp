@@ -10,8 +10,16 @@
 #include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/parallel/containers/lock_free_queue.h>
 #include <AzCore/std/parallel/containers/lock_free_stamped_queue.h>
+#include <AzCore/std/parallel/containers/mpmc_queue.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/functional.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/std/smart_ptr/shared_ptr.h>
+#include <AzCore/Threading/ThreadSafeDeque.h>
+
+#if defined(HAVE_BENCHMARK)
+#include <benchmark/benchmark.h>
+#endif // HAVE_BENCHMARK
 
 using namespace AZStd;
 using namespace UnitTestInternal;
@@ -223,4 +231,230 @@ namespace UnitTest
             AZ_TEST_ASSERT(queue.empty());
         }
     }
+
+    TEST_F(LockFreeQueue, BoundedMpmcQueue)
+    {
+        bounded_mpmc_queue<int> queue(3);
+        int result;
+        EXPECT_EQ(4, queue.capacity());
+        EXPECT_TRUE(queue.empty());
+        EXPECT_FALSE(queue.try_pop(result));
+
+        for (int i = 0; i < 4; ++i)
+        {
+            EXPECT_TRUE(queue.try_push(i));
+        }
+        EXPECT_FALSE(queue.try_push(4));
+        EXPECT_EQ(4, queue.size_approx());
+
+        // Wrap around the ring buffer a couple of times to make sure the cells are recycled.
+        for (int i = 0; i < 10; ++i)
+        {
+            EXPECT_TRUE(queue.try_pop(result));
+            EXPECT_EQ(i, result);
+            EXPECT_TRUE(queue.try_push(i + 4));
+        }
+        for (int i = 10; i < 14; ++i)
+        {
+            EXPECT_TRUE(queue.try_pop(result));
+            EXPECT_EQ(i, result);
+        }
+        EXPECT_TRUE(queue.empty());
+        EXPECT_FALSE(queue.try_pop(result));
+    }
+
+    TEST_F(LockFreeQueue, BoundedMpmcQueueNonTrivialDestructor)
+    {
+        AZStd::shared_ptr<int> value = AZStd::make_shared<int>(42);
+        {
+            bounded_mpmc_queue<AZStd::shared_ptr<int>> queue(8);
+            EXPECT_TRUE(queue.try_push(value));
+            EXPECT_TRUE(queue.try_push(value));
+            EXPECT_TRUE(queue.try_push(value));
+            EXPECT_EQ(4, value.use_count());
+
+            AZStd::shared_ptr<int> result;
+            EXPECT_TRUE(queue.try_pop(result));
+            EXPECT_EQ(42, *result);
+            result.reset();
+            EXPECT_EQ(3, value.use_count());
+        }
+        // The destructor of the queue releases the remaining values.
+        EXPECT_EQ(1, value.use_count());
+    }
+
+    TEST_F(LockFreeQueue, MpmcQueue_PushBeyondCapacity_OverflowKeepsOrder)
+    {
+        mpmc_queue<int> queue(4);
+        int result;
+        EXPECT_TRUE(queue.empty());
+        EXPECT_FALSE(queue.try_pop(result));
+
+        for (int i = 0; i < 64; ++i)
+        {
+            queue.push(i);
+        }
+        EXPECT_EQ(64, queue.size_approx());
+        for (int i = 0; i < 32; ++i)
+        {
+            EXPECT_TRUE(queue.try_pop(result));
+            EXPECT_EQ(i, result);
+        }
+        // New values need to be queued behind the values that are still in the overflow.
+        for (int i = 64; i < 128; ++i)
+        {
+            queue.push(i);
+        }
+        for (int i = 32; i < 128; ++i)
+        {
+            EXPECT_TRUE(queue.try_pop(result));
+            EXPECT_EQ(i, result);
+        }
+        EXPECT_TRUE(queue.empty());
+        EXPECT_FALSE(queue.try_pop(result));
+    }
+
+    template<class Q>
+    void MpmcQueueMultipleProducersAndConsumers(Q& queue, int numIterations)
+    {
+        constexpr int numProducers = 4;
+        constexpr int numConsumers = 4;
+        AZStd::atomic<int> numPopped{ 0 };
+        AZStd::atomic<int> numOutOfOrder{ 0 };
+        AZStd::atomic<AZ::s64> sum{ 0 };
+
+        AZStd::vector<AZStd::thread> threads;
+        for (int producer = 0; producer < numProducers; ++producer)
+        {
+            threads.emplace_back([&queue, producer, numIterations]()
+            {
+                for (int i = 0; i < numIterations; ++i)
+                {
+                    // The producer is stored in the upper bits so the consumer can validate the order per producer.
+                    const int value = (producer << 24) | i;
+                    if constexpr (AZStd::is_same_v<Q, mpmc_queue<int>>)
+                    {
+                        queue.push(value);
+                    }
+                    else
+                    {
+                        while (!queue.try_push(value))
+                        {
+                            AZStd::this_thread::yield();
+                        }
+                    }
+                }
+            });
+        }
+        for (int consumer = 0; consumer < numConsumers; ++consumer)
+        {
+            threads.emplace_back([&]()
+            {
+                int lastValues[numProducers] = { -1, -1, -1, -1 };
+                const int total = numProducers * numIterations;
+                int value;
+                while (numPopped.load() < total)
+                {
+                    if (queue.try_pop(value))
+                    {
+                        const int producer = value >> 24;
+                        const int index = value & 0xffffff;
+                        if (index <= lastValues[producer])
+                        {
+                            ++numOutOfOrder;
+                        }
+                        lastValues[producer] = index;
+                        sum += index;
+                        ++numPopped;
+                    }
+                }
+            });
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        const AZ::s64 expectedSum = static_cast<AZ::s64>(numProducers) * (static_cast<AZ::s64>(numIterations) * (numIterations - 1) / 2);
+        EXPECT_EQ(numProducers * numIterations, numPopped.load());
+        EXPECT_EQ(expectedSum, sum.load());
+        EXPECT_EQ(0, numOutOfOrder.load());
+        EXPECT_TRUE(queue.empty());
+    }
+
+    TEST_F(LockFreeQueue, BoundedMpmcQueue_MultipleProducersAndConsumers)
+    {
+        bounded_mpmc_queue<int> queue(256);
+        MpmcQueueMultipleProducersAndConsumers(queue, NUM_ITERATIONS);
+    }
+
+    TEST_F(LockFreeQueue, MpmcQueue_MultipleProducersAndConsumers)
+    {
+        // Use a small ring buffer so the overflow path is exercised as well.
+        mpmc_queue<int> queue(64);
+        MpmcQueueMultipleProducersAndConsumers(queue, NUM_ITERATIONS);
+    }
 }
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    // Every thread pushes a value and pops a value from the same queue, so the benchmark measures how well the queue
+    // holds up when the number of producers and consumers increases.
+    template<class Q>
+    class MpmcQueueBenchmarkFixture
+        : public ::benchmark::Fixture
+    {
+    public:
+        void SetUp(const ::benchmark::State& state) override
+        {
+            if (state.thread_index == 0)
+            {
+                s_queue = new Q();
+            }
+        }
+
+        void TearDown(const ::benchmark::State& state) override
+        {
+            if (state.thread_index == 0)
+            {
+                delete s_queue;
+                s_queue = nullptr;
+            }
+        }
+
+    protected:
+        static Q* s_queue;
+    };
+
+    template<class Q>
+    Q* MpmcQueueBenchmarkFixture<Q>::s_queue = nullptr;
+
+    using ThreadSafeDequeInt = AZ::ThreadSafeDeque<int>;
+    using MpmcQueueInt = AZStd::mpmc_queue<int>;
+
+    BENCHMARK_TEMPLATE_DEFINE_F(MpmcQueueBenchmarkFixture, ThreadSafeDeque, ThreadSafeDequeInt)(::benchmark::State& state)
+    {
+        int value = 0;
+        while (state.KeepRunning())
+        {
+            s_queue->PushBackItem(value);
+            s_queue->PopFrontItem(value);
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+    BENCHMARK_REGISTER_F(MpmcQueueBenchmarkFixture, ThreadSafeDeque)->ThreadRange(1, 64)->UseRealTime();
+
+    BENCHMARK_TEMPLATE_DEFINE_F(MpmcQueueBenchmarkFixture, MpmcQueue, MpmcQueueInt)(::benchmark::State& state)
+    {
+        int value = 0;
+        while (state.KeepRunning())
+        {
+            s_queue->push(value);
+            s_queue->try_pop(value);
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+    BENCHMARK_REGISTER_F(MpmcQueueBenchmarkFixture, MpmcQueue)->ThreadRange(1, 64)->UseRealTime();
+} // Benchmark
+#endif // HAVE_BENCHMARK
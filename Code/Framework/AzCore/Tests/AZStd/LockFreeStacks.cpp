@@ -245,7 +245,31 @@ namespace UnitTest
             AZ_TEST_ASSERT(stack.empty());
         }
     }
-    
+
+
+    TEST_F(LockFreeIntrusiveStack, MyIntrusiveStackBaseChain)
+    {
+        MyIntrusiveStackBase stack;
+
+        MyStackItem item1(100);
+        MyStackItem item2(200);
+        MyStackItem item3(300);
+
+        AZ_TEST_ASSERT(!stack.pop_all());
+
+        // chain item2 -> item1 and push it on top of item3
+        stack.push(item3);
+        item2.m_next = &item1;
+        stack.push_chain(item2, item1);
+        AZ_TEST_ASSERT(stack.pop() == &item2);
+
+        MyStackItem* top = stack.pop_all();
+        AZ_TEST_ASSERT(stack.empty());
+        AZ_TEST_ASSERT(top == &item1);
+        AZ_TEST_ASSERT(top->m_next == &item3);
+        AZ_TEST_ASSERT(top->m_next->m_next == nullptr);
+        item1.m_next = nullptr;
+    }
 
     TEST_F(LockFreeIntrusiveStack, MyIntrusiveStackMember)
     {
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#include "UserTypes.h"
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace UnitTest
+{
+    class SpanFixture
+        : public AllocatorsFixture
+    {
+    };
+
+    static_assert(AZStd::span<int>().empty(), "default constructed span should be empty");
+    static_assert(AZStd::is_same_v<decltype(AZStd::span(AZStd::declval<const AZStd::vector<float>&>())), AZStd::span<const float>>,
+        "span deduced from a const container should be read only");
+
+    TEST_F(SpanFixture, Construct_FromContainers_ViewsSameMemory)
+    {
+        int cArray[] = { 1, 2, 3 };
+        AZStd::array<int, 3> array = { { 4, 5, 6 } };
+        AZStd::vector<int> vector = { 7, 8, 9, 10 };
+
+        AZStd::span<int> cArraySpan(cArray);
+        AZStd::span<int> arraySpan(array);
+        AZStd::span<int> vectorSpan(vector);
+        AZStd::span<const int> constSpan(vectorSpan);
+        AZStd::span<int> pointerSpan(vector.data(), vector.data() + 2);
+
+        EXPECT_EQ(cArray, cArraySpan.data());
+        EXPECT_EQ(3, cArraySpan.size());
+        EXPECT_EQ(array.data(), arraySpan.data());
+        EXPECT_EQ(vector.data(), vectorSpan.data());
+        EXPECT_EQ(4, vectorSpan.size());
+        EXPECT_EQ(4 * sizeof(int), vectorSpan.size_bytes());
+        EXPECT_EQ(vector.data(), constSpan.data());
+        EXPECT_EQ(2, pointerSpan.size());
+    }
+
+    TEST_F(SpanFixture, Modify_ThroughSpan_ModifiesContainer)
+    {
+        AZStd::vector<float> values(8, 1.0f);
+        AZStd::span<float> valueSpan(values);
+        for (float& value : valueSpan)
+        {
+            value *= 2.0f;
+        }
+        valueSpan[3] = 0.0f;
+
+        EXPECT_FLOAT_EQ(2.0f, values.front());
+        EXPECT_FLOAT_EQ(0.0f, values[3]);
+        EXPECT_FLOAT_EQ(2.0f, valueSpan.back());
+    }
+
+    TEST_F(SpanFixture, SubViews_ReturnExpectedRanges)
+    {
+        int values[] = { 0, 1, 2, 3, 4, 5, 6, 7 };
+        AZStd::span<int> valueSpan(values);
+
+        AZStd::span<int> first = valueSpan.first(3);
+        EXPECT_EQ(3, first.size());
+        EXPECT_EQ(0, first.front());
+        EXPECT_EQ(2, first.back());
+
+        AZStd::span<int> last = valueSpan.last(2);
+        EXPECT_EQ(2, last.size());
+        EXPECT_EQ(6, last.front());
+
+        AZStd::span<int> middle = valueSpan.subspan(2, 4);
+        EXPECT_EQ(4, middle.size());
+        EXPECT_EQ(2, middle.front());
+        EXPECT_EQ(5, middle.back());
+
+        AZStd::span<int> remaining = valueSpan.subspan(5);
+        EXPECT_EQ(3, remaining.size());
+        EXPECT_EQ(5, remaining.front());
+
+        EXPECT_TRUE(valueSpan.subspan(8).empty());
+    }
+}
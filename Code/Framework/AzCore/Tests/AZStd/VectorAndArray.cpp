@@ -7,6 +7,7 @@
 #include "UserTypes.h"
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/std/containers/small_vector.h>
 #include <AzCore/std/containers/array.h>
 #include <AzCore/std/containers/bitset.h>
 
@@ -784,6 +785,108 @@ namespace UnitTest
         static_assert(greaterVectorDifferentSize > lessVector);
     }
 
+    TEST_F(Arrays, SmallVector_StaysInline_UntilCapacityIsExceeded)
+    {
+        small_vector<int, 4> intVector;
+        EXPECT_TRUE(intVector.validate());
+        EXPECT_TRUE(intVector.empty());
+        EXPECT_TRUE(intVector.is_inline());
+        EXPECT_EQ(4, intVector.capacity());
+
+        for (int i = 0; i < 4; ++i)
+        {
+            intVector.push_back(i);
+        }
+        EXPECT_TRUE(intVector.is_inline());
+        EXPECT_EQ(4, intVector.size());
+
+        // Spill to the allocator, pushing an element of the container itself
+        intVector.push_back(intVector[0]);
+        EXPECT_FALSE(intVector.is_inline());
+        EXPECT_TRUE(intVector.validate());
+        ASSERT_EQ(5, intVector.size());
+        for (int i = 0; i < 4; ++i)
+        {
+            EXPECT_EQ(i, intVector[i]);
+        }
+        EXPECT_EQ(0, intVector.back());
+
+        // Moves back to the inline storage once the elements fit
+        intVector.resize(2);
+        intVector.shrink_to_fit();
+        EXPECT_TRUE(intVector.is_inline());
+        EXPECT_EQ(2, intVector.size());
+        EXPECT_EQ(1, intVector[1]);
+    }
+
+    TEST_F(Arrays, SmallVector_InsertAndErase_Succeed)
+    {
+        small_vector<MyClass, 2> classVector(3, MyClass(1));
+        EXPECT_EQ(3, classVector.size());
+
+        classVector.insert(classVector.begin(), MyClass(0));
+        classVector.insert(classVector.begin() + 2, 2, MyClass(2));
+        classVector.emplace(classVector.end(), 3);
+        classVector.insert(classVector.begin() + 1, { MyClass(4), MyClass(5) });
+        const int expectedValues[] = { 0, 4, 5, 1, 2, 2, 1, 1, 3 };
+        ASSERT_EQ(AZ_ARRAY_SIZE(expectedValues), classVector.size());
+        for (size_t i = 0; i < classVector.size(); ++i)
+        {
+            EXPECT_EQ(expectedValues[i], classVector[i].m_data);
+        }
+
+        classVector.erase(classVector.begin() + 1, classVector.begin() + 3);
+        classVector.erase(classVector.begin());
+        EXPECT_EQ(6, classVector.size());
+        EXPECT_EQ(1, classVector.front().m_data);
+        EXPECT_EQ(3, classVector.back().m_data);
+
+        EXPECT_EQ(2, AZStd::erase_if(classVector, [](const MyClass& element) { return element.m_data == 2; }));
+        EXPECT_EQ(4, classVector.size());
+
+        classVector.clear();
+        EXPECT_TRUE(classVector.empty());
+        EXPECT_TRUE(classVector.validate());
+    }
+
+    TEST_F(Arrays, SmallVector_CopyMoveAndSwap_Succeed)
+    {
+        small_vector<AZStd::unique_ptr<int>, 2> inlineVector;
+        inlineVector.emplace_back(AZStd::make_unique<int>(1));
+
+        small_vector<AZStd::unique_ptr<int>, 2> heapVector;
+        for (int i = 0; i < 5; ++i)
+        {
+            heapVector.emplace_back(AZStd::make_unique<int>(10 + i));
+        }
+        const auto* heapData = heapVector.data();
+
+        // A heap vector hands its storage over, an inline vector moves its elements
+        small_vector<AZStd::unique_ptr<int>, 2> movedHeapVector(AZStd::move(heapVector));
+        EXPECT_EQ(heapData, movedHeapVector.data());
+        EXPECT_TRUE(heapVector.empty());
+        EXPECT_TRUE(heapVector.is_inline());
+
+        small_vector<AZStd::unique_ptr<int>, 2> movedInlineVector;
+        movedInlineVector = AZStd::move(inlineVector);
+        EXPECT_TRUE(inlineVector.empty());
+        ASSERT_EQ(1, movedInlineVector.size());
+        EXPECT_EQ(1, *movedInlineVector[0]);
+
+        movedInlineVector.swap(movedHeapVector);
+        ASSERT_EQ(5, movedInlineVector.size());
+        ASSERT_EQ(1, movedHeapVector.size());
+        EXPECT_EQ(14, *movedInlineVector.back());
+        EXPECT_EQ(1, *movedHeapVector.front());
+
+        const small_vector<int, 3> intVector{ 1, 2, 3, 4 };
+        small_vector<int, 3> copiedVector(intVector);
+        EXPECT_EQ(intVector, copiedVector);
+        copiedVector.back() = 3;
+        EXPECT_NE(intVector, copiedVector);
+        EXPECT_TRUE(copiedVector < intVector);
+    }
+
     TEST_F(Arrays, VectorSwap)
     {
         vector<void*> vec1(42, nullptr);
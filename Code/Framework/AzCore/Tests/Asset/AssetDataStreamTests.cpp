@@ -5,6 +5,7 @@
  *
  */
 #include <AzCore/Asset/AssetDataStream.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/UnitTest/TestTypes.h>
 #include <AZTestShared/Utils/Utils.h>
 #include <Tests/Streamer/IStreamerMock.h>
@@ -401,6 +402,104 @@ TEST_F(AssetDataStreamTest, BlockUntilLoadComplete_BlockWhenOpenedWithMemoryBuff
     assetDataStream.Close();
 }
 
+TEST_F(AssetDataStreamTest, ReadBatchScope_OpenStreamsInsideScope_ReadsQueuedAsSingleBatch)
+{
+    using ::testing::_;
+    using ::testing::An;
+
+    // Keep the callbacks for all the streams so the batch can complete all of the reads.
+    AZStd::vector<AZ::IO::IStreamer::OnCompleteCallback> callbacks;
+    ON_CALL(m_mockStreamer, SetRequestCompleteCallback(_, _))
+        .WillByDefault([&callbacks](FileRequestPtr& request, AZ::IO::IStreamer::OnCompleteCallback callback) -> FileRequestPtr&
+            {
+                callbacks.push_back(callback);
+                return request;
+            });
+
+    ON_CALL(m_mockStreamer, QueueRequestBatch(An<AZStd::vector<FileRequestPtr>&&>()))
+        .WillByDefault([&callbacks](AZStd::vector<FileRequestPtr>&& requests)
+            {
+                ASSERT_EQ(callbacks.size(), requests.size());
+                for (size_t i = 0; i < requests.size(); ++i)
+                {
+                    FileRequestHandle handle(requests[i]);
+                    callbacks[i](handle);
+                }
+            });
+
+    EXPECT_CALL(m_mockStreamer, QueueRequest(_)).Times(0);
+    EXPECT_CALL(m_mockStreamer, QueueRequestBatch(An<AZStd::vector<FileRequestPtr>&&>())).Times(1);
+
+    constexpr size_t assetSize = 100;
+    int numCompleted = 0;
+    AZ::Data::AssetDataStream::OnCompleteCallback loadCallback =
+        [&numCompleted]([[maybe_unused]] AZ::IO::IStreamerTypes::RequestStatus status)
+    {
+        ++numCompleted;
+    };
+
+    // Both streams share the allocator as the mock streamer allocates the buffers from the allocator of the last read.
+    AZ::IO::IStreamerTypes::DefaultRequestMemoryAllocator allocator;
+    AZ::Data::AssetDataStream firstStream(&allocator);
+    AZ::Data::AssetDataStream secondStream(&allocator);
+    {
+        AZ::Data::AssetDataStream::ReadBatchScope readBatch;
+        firstStream.Open(AZStd::string("path/first"), 0, assetSize,
+            AZ::IO::IStreamerTypes::s_noDeadline, AZ::IO::IStreamerTypes::s_priorityMedium, loadCallback);
+        {
+            // Nested scopes add their reads to the outermost scope.
+            AZ::Data::AssetDataStream::ReadBatchScope nestedReadBatch;
+            secondStream.Open(AZStd::string("path/second"), 0, assetSize,
+                AZ::IO::IStreamerTypes::s_noDeadline, AZ::IO::IStreamerTypes::s_priorityMedium, loadCallback);
+        }
+
+        // Nothing is handed to the streamer until the outermost scope ends.
+        EXPECT_EQ(0, numCompleted);
+    }
+    EXPECT_EQ(2, numCompleted);
+    EXPECT_TRUE(firstStream.IsFullyLoaded());
+    EXPECT_TRUE(secondStream.IsFullyLoaded());
+
+    firstStream.Close();
+    secondStream.Close();
+}
+
+TEST_F(AssetDataStreamTest, ClaimBuffer_ClaimLoadedData_DataIsNotCopiedAndReleasedWithBuffer)
+{
+    constexpr size_t assetSize = 500;
+
+    AZ::IO::IStreamerTypes::DefaultRequestMemoryAllocator allocator;
+    auto assetDataStream = AZStd::make_shared<AZ::Data::AssetDataStream>(&allocator);
+    assetDataStream->Open(AZStd::string("path/test"), 0, assetSize);
+    assetDataStream->BlockUntilLoadComplete();
+
+    AZ::Data::AssetDataStream::ClaimedBuffer buffer = AZ::Data::AssetDataStream::ClaimBuffer(assetDataStream);
+    ASSERT_TRUE(buffer);
+
+    // The claimed buffer is the one the streamer read into.
+    EXPECT_EQ(m_buffer, buffer.GetData());
+    EXPECT_EQ(assetSize, buffer.GetSize());
+
+    // The data can only be claimed once and can't be read from the stream anymore.
+    EXPECT_FALSE(AZ::Data::AssetDataStream::ClaimBuffer(assetDataStream));
+    AZ::u8 readByte;
+    EXPECT_EQ(0u, assetDataStream->Read(1, &readByte));
+
+    // The buffer keeps the stream and with it the allocation alive.
+    assetDataStream.reset();
+    EXPECT_EQ(1, allocator.GetNumLocks());
+    EXPECT_EQ(m_expectedBufferChar, reinterpret_cast<AZ::u8*>(buffer.GetData())[assetSize - 1]);
+
+    buffer = {};
+    EXPECT_EQ(0, allocator.GetNumLocks());
+}
+
+TEST_F(AssetDataStreamTest, ClaimBuffer_StreamNotLoaded_ReturnsEmptyBuffer)
+{
+    auto assetDataStream = AZStd::make_shared<AZ::Data::AssetDataStream>();
+    EXPECT_FALSE(AZ::Data::AssetDataStream::ClaimBuffer(assetDataStream));
+}
+
 TEST_F(AssetDataStreamTest, Read_ReadDataIncrementally_PartialDataReadSuccessfully)
 {
     // Create an arbitrary buffer with different data in every byte
@@ -8,6 +8,7 @@
 #include <AzCore/UnitTest/TestTypes.h>
 #include <AzCore/Interface/Interface.h>
 #include <AzCore/Console/Console.h>
+#include <AzCore/Console/ConsoleVariableHandle.h>
 #include <AzCore/Settings/SettingsRegistryImpl.h>
 #include <AzCore/Utils/Utils.h>
 
@@ -254,6 +255,51 @@ namespace AZ
         AZ_TEST_ASSERT(console->GetCvarValue("testString", testValue) != GetValueResult::Success); // Console can't convert an arbitrary string to a float
     }
 
+    TEST_F(ConsoleTests, ConsoleVariableHandle_GetValue_ReadsCurrentValue)
+    {
+        AZ::IConsole* console = m_console.get();
+        testInt32 = {};
+
+        AZ::ConsoleVariableHandle<int32_t> handle("testInt32");
+        int32_t value = 100;
+        EXPECT_EQ(GetValueResult::Success, handle.GetValue(value));
+        EXPECT_EQ(0, value);
+
+        console->PerformCommand("testInt32 7");
+        EXPECT_EQ(GetValueResult::Success, handle.GetValue(value));
+        EXPECT_EQ(7, value);
+    }
+
+    TEST_F(ConsoleTests, ConsoleVariableHandle_GetValue_ConvertsOtherTypes)
+    {
+        AZ::IConsole* console = m_console.get();
+        console->PerformCommand("testString 100.5f");
+
+        AZ::ConsoleVariableHandle<float> handle("testString");
+        float value = 0.0f;
+        EXPECT_EQ(GetValueResult::Success, handle.GetValue(value));
+        EXPECT_EQ(100.5f, value);
+
+        console->PerformCommand("testString asdf");
+        EXPECT_NE(GetValueResult::Success, handle.GetValue(value));
+    }
+
+    TEST_F(ConsoleTests, ConsoleVariableHandle_CVarRegisteredAndUnregistered_HandleFollows)
+    {
+        AZ::ConsoleVariableHandle<int32_t> handle("testHandleLifetime");
+        int32_t value = 0;
+        EXPECT_EQ(GetValueResult::ConsoleVarNotFound, handle.GetValue(value));
+
+        {
+            AZ_CVAR_SCOPED(int32_t, testHandleLifetime, 3, nullptr, ConsoleFunctorFlags::Null, "");
+            EXPECT_EQ(GetValueResult::Success, handle.GetValue(value));
+            EXPECT_EQ(3, value);
+        }
+
+        EXPECT_EQ(GetValueResult::ConsoleVarNotFound, handle.GetValue(value));
+        EXPECT_EQ(nullptr, handle.GetFunctor());
+    }
+
     TEST_F(ConsoleTests, CVar_Autocomplete)
     {
         AZ::IConsole* console = m_console.get();
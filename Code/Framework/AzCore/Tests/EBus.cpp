@@ -7,10 +7,12 @@
 
 #include <AzCore/EBus/EBus.h>
 #include <AzCore/EBus/Results.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/sort.h>
 #include <AzCore/std/chrono/chrono.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/Jobs/JobManager.h>
 #include <AzCore/Jobs/JobContext.h>
@@ -1847,6 +1849,82 @@ namespace UnitTest
 
     }
 
+    TEST_F(QueueEbusTest, QueueFunction_InlineAndAllocatedClosures_ExecutedInOrder)
+    {
+        using namespace QueueMessageTest;
+        struct LargeArgument
+        {
+            // Too large to fit in the inline storage of the queued call.
+            int m_values[64] = {};
+        };
+
+        AZStd::vector<int> order;
+        LargeArgument large;
+        large.m_values[63] = 2;
+        // Queue more functions than the lock-free capacity of the queue so the overflow path is used as well.
+        const int numCalls = 1000;
+        for (int i = 0; i < numCalls; ++i)
+        {
+            if (i % 2)
+            {
+                QueueTestSingleBus::QueueFunction([&order](int value) { order.push_back(value); }, i);
+            }
+            else
+            {
+                QueueTestSingleBus::QueueFunction([&order, i](const LargeArgument& argument) { order.push_back(i + argument.m_values[63] - 2); }, large);
+            }
+        }
+        EXPECT_EQ(numCalls, QueueTestSingleBus::QueuedEventCount());
+        QueueTestSingleBus::ExecuteQueuedEvents();
+        EXPECT_EQ(0, QueueTestSingleBus::QueuedEventCount());
+
+        ASSERT_EQ(numCalls, order.size());
+        for (int i = 0; i < numCalls; ++i)
+        {
+            EXPECT_EQ(i, order[i]);
+        }
+    }
+
+    TEST_F(QueueEbusTest, ClearQueuedEvents_QueuedArguments_AreReleased)
+    {
+        using namespace QueueMessageTest;
+        AZStd::shared_ptr<int> value = AZStd::make_shared<int>(42);
+        bool executed = false;
+        QueueTestSingleBus::QueueFunction([&executed](AZStd::shared_ptr<int>) { executed = true; }, value);
+        EXPECT_EQ(2, value.use_count());
+
+        QueueTestSingleBus::ClearQueuedEvents();
+        EXPECT_EQ(1, value.use_count());
+        QueueTestSingleBus::ExecuteQueuedEvents();
+        EXPECT_FALSE(executed);
+    }
+
+#if AZ_EBUS_PROFILING
+    TEST_F(QueueEbusTest, Profiling_Broadcast_RecordsDispatchesAndHandlerCalls)
+    {
+        using namespace QueueMessageTest;
+        QueueTestSingleBus::Handler handler;
+        handler.BusConnect();
+        auto* context = QueueTestSingleBus::GetContext();
+        ASSERT_NE(nullptr, context);
+        context->m_profile.Reset();
+
+        QueueTestSingleBus::Broadcast(&QueueTestSingleBus::Events::OnMessage);
+        QueueTestSingleBus::Broadcast(&QueueTestSingleBus::Events::OnMessage);
+
+        AZ::u64 dispatchCount = 0;
+        AZ::u64 handlerCallCount = 0;
+        context->m_profile.Visit([&](const AZ::Internal::EBusEventKey&, const AZ::Internal::EBusEventProfile& event)
+            {
+                dispatchCount += event.m_dispatchCount;
+                handlerCallCount += event.m_handlerCallCount;
+            });
+        EXPECT_EQ(2, dispatchCount);
+        EXPECT_EQ(2, handlerCallCount);
+        handler.BusDisconnect();
+    }
+#endif // AZ_EBUS_PROFILING
+
     class ConnectDisconnectInterface
         : public EBusTraits
     {
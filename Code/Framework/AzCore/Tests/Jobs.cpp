@@ -9,6 +9,7 @@
 #include <AzCore/Jobs/JobCompletion.h>
 #include <AzCore/Jobs/JobCompletionSpin.h>
 #include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobGraph.h>
 #include <AzCore/Jobs/LegacyJobExecutor.h>
 #include <AzCore/Jobs/JobManager.h>
 #include <AzCore/Jobs/task_group.h>
@@ -1651,6 +1652,289 @@ namespace UnitTest
     {
         RunTest();
     }
+
+    class JobPriorityClassTestFixture : public DefaultJobManagerSetupFixture
+    {
+    public:
+        JobPriorityClassTestFixture() : DefaultJobManagerSetupFixture(1) // Only 1 worker to serialize job execution
+        {
+        }
+
+        Job* CreatePriorityJob(JobPriorityClass priorityClass, AZ::s8 priority, const char* name, AZStd::binary_semaphore& binarySemaphore, AZStd::vector<AZStd::string>& namesOfProcessedJobs)
+        {
+            Job* job = aznew TestJobWithPriority(priority, name, m_jobContext, binarySemaphore, namesOfProcessedJobs);
+            job->SetPriorityClass(priorityClass);
+            return job;
+        }
+    };
+
+    TEST_F(JobPriorityClassTestFixture, PriorityClass_MoreUrgentClass_RunsFirstRegardlessOfPriority)
+    {
+        AZStd::vector<AZStd::string> namesOfProcessedJobs;
+        AZStd::binary_semaphore binarySemaphore;
+
+        // Same approach as JobPriorityTestFixture, the first job blocks the only worker until all other jobs are queued.
+        CreatePriorityJob(JobPriorityClass::Critical, 127, "FirstJobQueued", binarySemaphore, namesOfProcessedJobs)->Start();
+        CreatePriorityJob(JobPriorityClass::Background, 127, "Background", binarySemaphore, namesOfProcessedJobs)->Start();
+        CreatePriorityJob(JobPriorityClass::Normal, 127, "NormalHighPriority", binarySemaphore, namesOfProcessedJobs)->Start();
+        CreatePriorityJob(JobPriorityClass::Normal, -128, "NormalLowPriority", binarySemaphore, namesOfProcessedJobs)->Start();
+        CreatePriorityJob(JobPriorityClass::Critical, -128, "Critical", binarySemaphore, namesOfProcessedJobs)->Start();
+
+        binarySemaphore.release();
+        while (TestJobWithPriority::s_numIncompleteJobs > 0) {}
+
+        ASSERT_EQ(namesOfProcessedJobs.size(), 5);
+        EXPECT_EQ(namesOfProcessedJobs[0], "FirstJobQueued");
+        EXPECT_EQ(namesOfProcessedJobs[1], "Critical");
+        EXPECT_EQ(namesOfProcessedJobs[2], "NormalHighPriority");
+        EXPECT_EQ(namesOfProcessedJobs[3], "NormalLowPriority");
+        EXPECT_EQ(namesOfProcessedJobs[4], "Background");
+    }
+
+    class JobWorkerAffinityTestFixture : public DefaultJobManagerSetupFixture
+    {
+    public:
+        JobWorkerAffinityTestFixture() : DefaultJobManagerSetupFixture(2)
+        {
+        }
+    };
+
+    TEST_F(JobWorkerAffinityTestFixture, WorkerAffinity_RestrictedJobs_OnlyRunOnAllowedWorker)
+    {
+        constexpr int numJobs = 64;
+        AZStd::atomic<int> numWrongWorker{ 0 };
+
+        JobCompletion completion(m_jobContext);
+        for (int i = 0; i < numJobs; ++i)
+        {
+            const AZ::u32 allowedWorker = i % 2;
+            Job* job = CreateJobFunction([this, allowedWorker, &numWrongWorker]()
+            {
+                if (m_jobManager->GetWorkerThreadId() != allowedWorker)
+                {
+                    ++numWrongWorker;
+                }
+            }, true, m_jobContext);
+            job->SetWorkerAffinityMask(static_cast<AZ::u64>(1) << allowedWorker);
+            job->SetDependent(&completion);
+            job->Start();
+        }
+        completion.StartAndWaitForCompletion();
+
+        EXPECT_EQ(0, numWrongWorker);
+    }
+    class JobGraphTest
+        : public DefaultJobManagerSetupFixture
+    {
+    };
+
+    TEST_F(JobGraphTest, SubmitAndWait_DiamondGraph_RespectsDependencies)
+    {
+        AZStd::atomic<int> counter{ 0 };
+        int top = -1, left = -1, right = -1, bottom = -1;
+
+        JobGraph graph(m_jobContext);
+        JobGraph::NodeId topNode = graph.AddNode([&]() { top = counter++; });
+        JobGraph::NodeId leftNode = graph.AddNode([&]() { left = counter++; });
+        JobGraph::NodeId rightNode = graph.AddNode([&]() { right = counter++; });
+        JobGraph::NodeId bottomNode = graph.AddNode([&]() { bottom = counter++; });
+        graph.AddEdge(topNode, leftNode);
+        graph.AddEdge(topNode, rightNode);
+        graph.AddEdge(leftNode, bottomNode);
+        graph.AddEdge(rightNode, bottomNode);
+        ASSERT_TRUE(graph.Compile());
+
+        graph.SubmitAndWait();
+
+        EXPECT_EQ(4, counter);
+        EXPECT_EQ(0, top);
+        EXPECT_LT(top, left);
+        EXPECT_LT(top, right);
+        EXPECT_GT(bottom, left);
+        EXPECT_GT(bottom, right);
+    }
+
+    TEST_F(JobGraphTest, SubmitAndWait_CompiledGraph_IsReusable)
+    {
+        constexpr int numChains = 16;
+        constexpr int chainLength = 8;
+        constexpr int numSubmits = 32;
+        AZStd::array<int, numChains> chainValues;
+        chainValues.fill(0);
+
+        JobGraph graph(m_jobContext);
+        for (int chain = 0; chain < numChains; ++chain)
+        {
+            JobGraph::NodeId previous = JobGraph::InvalidNodeId;
+            for (int link = 0; link < chainLength; ++link)
+            {
+                //each link only succeeds if it runs after the previous link of the same submit
+                JobGraph::NodeId node = graph.AddNode([&chainValues, chain, link]()
+                {
+                    if (chainValues[chain] % chainLength == link)
+                    {
+                        ++chainValues[chain];
+                    }
+                });
+                if (previous != JobGraph::InvalidNodeId)
+                {
+                    graph.AddEdge(previous, node);
+                }
+                previous = node;
+            }
+        }
+        ASSERT_TRUE(graph.Compile());
+
+        for (int submit = 0; submit < numSubmits; ++submit)
+        {
+            graph.Submit();
+            graph.Wait();
+        }
+
+        for (int chain = 0; chain < numChains; ++chain)
+        {
+            EXPECT_EQ(chainLength * numSubmits, chainValues[chain]);
+        }
+    }
+
+    TEST_F(JobGraphTest, Compile_CriticalPath_HasHighestPriority)
+    {
+        JobGraph graph(m_jobContext);
+        JobGraph::NodeId expensive = graph.AddNode([]() {}, 10);
+        JobGraph::NodeId cheap = graph.AddNode([]() {}, 1);
+        JobGraph::NodeId sink = graph.AddNode([]() {}, 1);
+        graph.AddEdge(expensive, sink);
+        graph.AddEdge(cheap, sink);
+        ASSERT_TRUE(graph.Compile());
+
+        EXPECT_EQ(127, graph.GetNodePriority(expensive));
+        EXPECT_GT(graph.GetNodePriority(cheap), graph.GetNodePriority(sink));
+        EXPECT_GT(graph.GetNodePriority(expensive), graph.GetNodePriority(cheap));
+    }
+
+    TEST_F(JobGraphTest, Compile_Cycle_Fails)
+    {
+        JobGraph graph(m_jobContext);
+        JobGraph::NodeId first = graph.AddNode([]() {});
+        JobGraph::NodeId second = graph.AddNode([]() {});
+        graph.AddEdge(first, second);
+        graph.AddEdge(second, first);
+
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        EXPECT_FALSE(graph.Compile());
+        AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+        EXPECT_FALSE(graph.IsCompiled());
+    }
+
+    class JobParallelAlgorithmsTest
+        : public DefaultJobManagerSetupFixture
+    {
+    public:
+        void SetUp() override
+        {
+            DefaultJobManagerSetupFixture::SetUp();
+
+            std::mt19937 randomGenerator(1); // Always use the same seed
+            std::uniform_int_distribution<int> randomDistribution(-100000, 100000);
+            m_values.resize(NumValues);
+            for (int& value : m_values)
+            {
+                value = randomDistribution(randomGenerator);
+            }
+        }
+
+        void TearDown() override
+        {
+            m_values = {};
+            DefaultJobManagerSetupFixture::TearDown();
+        }
+
+    protected:
+        // Large enough to be split across all workers, with a size that doesn't divide evenly into chunks.
+        static constexpr int NumValues = 100003;
+        AZStd::vector<int> m_values;
+    };
+
+    TEST_F(JobParallelAlgorithmsTest, ParallelSort_RandomValues_MatchesSerialSort)
+    {
+        AZStd::vector<int> expected = m_values;
+        AZStd::sort(expected.begin(), expected.end());
+
+        parallel_sort(m_values.begin(), m_values.end());
+        EXPECT_EQ(expected, m_values);
+    }
+
+    TEST_F(JobParallelAlgorithmsTest, ParallelSort_CustomCompareAndPartitioner_MatchesSerialSort)
+    {
+        AZStd::vector<int> expected = m_values;
+        AZStd::sort(expected.begin(), expected.end(), AZStd::greater<int>());
+
+        parallel_sort(m_values.begin(), m_values.end(), AZStd::greater<int>(), simple_partitioner(5000));
+        EXPECT_EQ(expected, m_values);
+    }
+
+    TEST_F(JobParallelAlgorithmsTest, ParallelSort_SmallRange_IsSorted)
+    {
+        AZStd::vector<int> values = { 5, 3, 9, 1, 7 };
+        parallel_sort(values.begin(), values.end());
+        EXPECT_EQ(AZStd::vector<int>({ 1, 3, 5, 7, 9 }), values);
+    }
+
+    TEST_F(JobParallelAlgorithmsTest, ParallelReduce_RandomValues_MatchesSerialSum)
+    {
+        AZ::s64 expected = 42;
+        for (int value : m_values)
+        {
+            expected += value;
+        }
+
+        AZ::s64 result = parallel_reduce(m_values.begin(), m_values.end(), static_cast<AZ::s64>(42),
+            [](AZ::s64 lhs, AZ::s64 rhs) { return lhs + rhs; });
+        EXPECT_EQ(expected, result);
+    }
+
+    TEST_F(JobParallelAlgorithmsTest, ParallelReduce_NonCommutativeOperation_KeepsOrder)
+    {
+        // Keeping only the right hand side is associative but not commutative, so this returns the last element.
+        int result = parallel_reduce(m_values.begin(), m_values.end(), 0, [](int, int rhs) { return rhs; });
+        EXPECT_EQ(m_values.back(), result);
+    }
+
+    TEST_F(JobParallelAlgorithmsTest, ParallelReduce_EmptyRange_ReturnsInit)
+    {
+        AZStd::vector<int> values;
+        EXPECT_EQ(13, parallel_reduce(values.begin(), values.end(), 13));
+    }
+
+    TEST_F(JobParallelAlgorithmsTest, ParallelInclusiveScan_RandomValues_MatchesSerialScan)
+    {
+        AZStd::vector<int> expected(m_values.size());
+        int total = 0;
+        for (size_t i = 0; i < m_values.size(); ++i)
+        {
+            total += m_values[i];
+            expected[i] = total;
+        }
+
+        AZStd::vector<int> results(m_values.size());
+        auto end = parallel_inclusive_scan(m_values.begin(), m_values.end(), results.begin());
+        EXPECT_EQ(results.end(), end);
+        EXPECT_EQ(expected, results);
+    }
+
+    TEST_F(JobParallelAlgorithmsTest, ParallelInclusiveScan_InPlace_MatchesSerialScan)
+    {
+        AZStd::vector<int> expected(m_values.size());
+        int highest = std::numeric_limits<int>::min();
+        for (size_t i = 0; i < m_values.size(); ++i)
+        {
+            highest = AZStd::GetMax(highest, m_values[i]);
+            expected[i] = highest;
+        }
+
+        parallel_inclusive_scan(m_values.begin(), m_values.end(), m_values.begin(), [](int lhs, int rhs) { return AZStd::GetMax(lhs, rhs); });
+        EXPECT_EQ(expected, m_values);
+    }
 } // UnitTest
 
 #if defined(HAVE_BENCHMARK)
@@ -2011,6 +2295,116 @@ namespace Benchmark
             RunMultipleCalculatePiJobsWithRandomDepthAndRandomPriority(LARGE_NUMBER_OF_JOBS);
         }
     }
+
+    class ParallelAlgorithmsBenchmarkFixture : public JobBenchmarkFixture
+    {
+    public:
+        void SetUp(::benchmark::State& state) override
+        {
+            JobBenchmarkFixture::SetUp(state);
+
+            std::mt19937 randomGenerator(1); // Always use the same seed
+            std::uniform_int_distribution<AZ::u32> randomDistribution;
+            m_values.resize(state.range(0));
+            for (AZ::u32& value : m_values)
+            {
+                value = randomDistribution(randomGenerator);
+            }
+            m_scratch.resize(m_values.size());
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            m_values = {};
+            m_scratch = {};
+            JobBenchmarkFixture::TearDown(state);
+        }
+
+    protected:
+        AZStd::vector<AZ::u32> m_values;
+        AZStd::vector<AZ::u32> m_scratch;
+    };
+
+    BENCHMARK_DEFINE_F(ParallelAlgorithmsBenchmarkFixture, SerialSort)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            state.PauseTiming();
+            m_scratch = m_values;
+            state.ResumeTiming();
+
+            AZStd::sort(m_scratch.begin(), m_scratch.end());
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK_REGISTER_F(ParallelAlgorithmsBenchmarkFixture, SerialSort)->RangeMultiplier(16)->Range(1 << 12, 1 << 20);
+
+    BENCHMARK_DEFINE_F(ParallelAlgorithmsBenchmarkFixture, ParallelSort)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            state.PauseTiming();
+            m_scratch = m_values;
+            state.ResumeTiming();
+
+            parallel_sort(m_scratch.begin(), m_scratch.end(), m_jobContext);
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK_REGISTER_F(ParallelAlgorithmsBenchmarkFixture, ParallelSort)->RangeMultiplier(16)->Range(1 << 12, 1 << 20);
+
+    BENCHMARK_DEFINE_F(ParallelAlgorithmsBenchmarkFixture, SerialReduce)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            AZ::u64 total = 0;
+            for (AZ::u32 value : m_values)
+            {
+                total += value;
+            }
+            benchmark::DoNotOptimize(total);
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK_REGISTER_F(ParallelAlgorithmsBenchmarkFixture, SerialReduce)->RangeMultiplier(16)->Range(1 << 12, 1 << 20);
+
+    BENCHMARK_DEFINE_F(ParallelAlgorithmsBenchmarkFixture, ParallelReduce)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(parallel_reduce(m_values.begin(), m_values.end(), static_cast<AZ::u64>(0),
+                [](AZ::u64 lhs, AZ::u64 rhs) { return lhs + rhs; }, m_jobContext));
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK_REGISTER_F(ParallelAlgorithmsBenchmarkFixture, ParallelReduce)->RangeMultiplier(16)->Range(1 << 12, 1 << 20);
+
+    BENCHMARK_DEFINE_F(ParallelAlgorithmsBenchmarkFixture, SerialInclusiveScan)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            AZ::u32 total = 0;
+            for (size_t i = 0; i < m_values.size(); ++i)
+            {
+                total += m_values[i];
+                m_scratch[i] = total;
+            }
+            benchmark::DoNotOptimize(m_scratch.data());
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK_REGISTER_F(ParallelAlgorithmsBenchmarkFixture, SerialInclusiveScan)->RangeMultiplier(16)->Range(1 << 12, 1 << 20);
+
+    BENCHMARK_DEFINE_F(ParallelAlgorithmsBenchmarkFixture, ParallelInclusiveScan)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            parallel_inclusive_scan(m_values.begin(), m_values.end(), m_scratch.begin(), m_jobContext);
+            benchmark::DoNotOptimize(m_scratch.data());
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK_REGISTER_F(ParallelAlgorithmsBenchmarkFixture, ParallelInclusiveScan)->RangeMultiplier(16)->Range(1 << 12, 1 << 20);
 } // Benchmark
 
 #endif // HAVE_BENCHMARK
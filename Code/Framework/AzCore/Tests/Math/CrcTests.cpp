@@ -6,6 +6,8 @@
  */
 
 #include <AzCore/Math/Crc.h>
+#include <AzCore/Math/Crc32c.h>
+#include <AzCore/std/algorithm.h>
 #include <AzCore/std/containers/array.h>
 #include <AzCore/UnitTest/TestTypes.h>
 
@@ -115,4 +117,63 @@ namespace UnitTest
         EXPECT_EQ(AZ::Crc32(0x4727dc92), constEvalIntValue);
     }
 
+    TEST_F(Crc32Fixture, RuntimeBuffer_MatchesConstexprCalculation)
+    {
+        // The void* overloads are computed 8 bytes at a time, they must give the same values as the constexpr byte-wise path
+        AZStd::array<uint8_t, 1031> buffer;
+        for (size_t index = 0; index < buffer.size(); ++index)
+        {
+            buffer[index] = static_cast<uint8_t>(index * 131 + 7);
+        }
+
+        for (size_t offset = 0; offset < 9; ++offset)
+        {
+            for (size_t size : { size_t{ 0 }, size_t{ 1 }, size_t{ 7 }, size_t{ 8 }, size_t{ 9 }, size_t{ 64 }, size_t{ 1000 } })
+            {
+                const AZ::Crc32 expected(buffer.data() + offset, size);
+                EXPECT_EQ(expected, AZ::Crc32(static_cast<const void*>(buffer.data() + offset), size));
+
+                AZ::Crc32 added(0x1234U);
+                added.Add(static_cast<const void*>(buffer.data() + offset), size);
+                AZ::Crc32 addedConstexpr(0x1234U);
+                addedConstexpr.Add(buffer.data() + offset, size);
+                EXPECT_EQ(addedConstexpr, added);
+            }
+        }
+
+        const char mixedCase[] = "SomeMixedCase_ComponentName";
+        EXPECT_EQ(AZ::Crc32("somemixedcase_componentname"), AZ::Crc32(static_cast<const void*>(mixedCase), sizeof(mixedCase) - 1, true));
+    }
+
+    TEST(Crc32cTest, Compute_MatchesKnownValues)
+    {
+        EXPECT_EQ(0u, AZ::Crc32c::Compute("", 0));
+        EXPECT_EQ(0xE3069283u, AZ::Crc32c::Compute("123456789", 9));
+        const uint8_t zeros[32] = {};
+        EXPECT_EQ(0x8A9136AAu, AZ::Crc32c::Compute(zeros, sizeof(zeros)));
+    }
+
+    TEST(Crc32cTest, Update_MatchesSingleBufferCompute)
+    {
+        AZStd::array<uint8_t, 523> buffer;
+        for (size_t index = 0; index < buffer.size(); ++index)
+        {
+            buffer[index] = static_cast<uint8_t>(index * 37 + 11);
+        }
+        const AZ::u32 expected = AZ::Crc32c::Compute(buffer.data(), buffer.size());
+
+        for (size_t chunkSize : { size_t{ 1 }, size_t{ 3 }, size_t{ 8 }, size_t{ 100 } })
+        {
+            AZ::Crc32c crc;
+            for (size_t offset = 0; offset < buffer.size(); offset += chunkSize)
+            {
+                crc.Update(buffer.data() + offset, AZStd::min(chunkSize, buffer.size() - offset));
+            }
+            EXPECT_EQ(expected, crc.GetValue());
+
+            crc.Reset();
+            EXPECT_EQ(0u, crc.GetValue());
+        }
+    }
+
 }
@@ -75,6 +75,28 @@ namespace Benchmark
             }
         }
     }
+
+    BENCHMARK_F(BM_MathFrustum, SphereIntersectBatch)(benchmark::State& state)
+    {
+        using VecType = AZ::Simd::Vec8;
+        for (auto _ : state)
+        {
+            for (size_t i = 0; i + VecType::ElementCount <= m_dataArray.size(); i += VecType::ElementCount)
+            {
+                AZ::Vector3 centers[VecType::ElementCount];
+                float radii[VecType::ElementCount];
+                for (int32_t lane = 0; lane < VecType::ElementCount; ++lane)
+                {
+                    centers[lane] = m_dataArray[i + lane].sphereCenter;
+                    radii[lane] = m_dataArray[i + lane].sphereRadius;
+                }
+
+                AZ::IntersectResult results[VecType::ElementCount];
+                m_testFrustum.IntersectSphere(AZ::Vector3x8::CreateGather(centers), VecType::LoadUnaligned(radii), results);
+                benchmark::DoNotOptimize(results);
+            }
+        }
+    }
 }
 
 #endif
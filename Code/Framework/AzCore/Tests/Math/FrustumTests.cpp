@@ -674,4 +674,43 @@ namespace UnitTest
         // the aabb is contained within the frustum
         EXPECT_TRUE(AZ::ShapeIntersection::Contains(viewFrustum, aabb));
     }
+
+    template <typename VecType>
+    void TestFrustumBatchMatchesScalar()
+    {
+        // Spheres and boxes along the view direction and sideways of testFrustum2, covering all three results
+        AZ::Vector3 centers[VecType::ElementCount];
+        AZ::Vector3 minimums[VecType::ElementCount];
+        AZ::Vector3 maximums[VecType::ElementCount];
+        float radii[VecType::ElementCount];
+        for (int32_t i = 0; i < VecType::ElementCount; ++i)
+        {
+            centers[i] = AZ::Vector3(static_cast<float>(i % 3) * 12.0f - 6.0f, static_cast<float>(i) * 14.0f + 5.0f, 1.0f);
+            radii[i] = 2.0f + static_cast<float>(i % 2) * 4.0f;
+            minimums[i] = centers[i] - AZ::Vector3(radii[i]);
+            maximums[i] = centers[i] + AZ::Vector3(radii[i]);
+        }
+
+        AZ::IntersectResult sphereResults[VecType::ElementCount];
+        AZ::IntersectResult aabbResults[VecType::ElementCount];
+        testFrustum2.IntersectSphere(AZ::Vector3Batch<VecType>::CreateGather(centers), VecType::LoadUnaligned(radii), sphereResults);
+        testFrustum2.IntersectAabb(
+            AZ::Vector3Batch<VecType>::CreateGather(minimums), AZ::Vector3Batch<VecType>::CreateGather(maximums), aabbResults);
+
+        for (int32_t i = 0; i < VecType::ElementCount; ++i)
+        {
+            EXPECT_EQ(sphereResults[i], testFrustum2.IntersectSphere(centers[i], radii[i]));
+            EXPECT_EQ(aabbResults[i], testFrustum2.IntersectAabb(minimums[i], maximums[i]));
+        }
+    }
+
+    TEST(MATH_Frustum, BatchIntersectVector3x4MatchesScalar)
+    {
+        TestFrustumBatchMatchesScalar<AZ::Simd::Vec4>();
+    }
+
+    TEST(MATH_Frustum, BatchIntersectVector3x8MatchesScalar)
+    {
+        TestFrustumBatchMatchesScalar<AZ::Simd::Vec8>();
+    }
 } // namespace UnitTest
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ * 
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/Matrix3x4.h>
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/ShapeIntersection.h>
+#include <AzCore/Math/SimdBatch.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/containers/vector.h>
+
+#if defined(HAVE_BENCHMARK)
+
+#include <random>
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    class BM_MathSimdBatch
+        : public benchmark::Fixture
+    {
+    public:
+        void SetUp([[maybe_unused]] const ::benchmark::State& state) override
+        {
+            m_testFrustum = AZ::Frustum(AZ::ViewFrustumAttributes(AZ::Transform::CreateIdentity(), 1.0f, 2.0f * atanf(0.5f), 10.0f, 90.0f));
+            m_testTransform = AZ::Matrix3x4::CreateFromQuaternionAndTranslation(
+                AZ::Quaternion::CreateRotationZ(0.5f), AZ::Vector3(1.0f, 2.0f, 3.0f));
+
+            const unsigned int seed = 1;
+            std::mt19937_64 rng(seed);
+            std::uniform_real_distribution<float> unif;
+
+            for (size_t axis = 0; axis < 3; ++axis)
+            {
+                m_points[axis].resize(DataCount);
+                m_aabbMin[axis].resize(DataCount);
+                m_aabbMax[axis].resize(DataCount);
+                m_outPoints[axis].resize(DataCount);
+            }
+            m_aabbs.resize(DataCount);
+            m_outOverlaps.resize(DataCount);
+
+            for (size_t i = 0; i < DataCount; ++i)
+            {
+                const AZ::Vector3 aabbMin = AZ::Vector3(unif(rng), unif(rng), unif(rng)) * 100.0f;
+                const AZ::Vector3 aabbMax = AZ::Vector3(unif(rng), unif(rng), unif(rng)).GetAbs() * 10.0f + aabbMin;
+                m_aabbs[i] = AZ::Aabb::CreateFromMinMax(aabbMin, aabbMax);
+                for (int32_t axis = 0; axis < 3; ++axis)
+                {
+                    m_points[axis][i] = unif(rng) * 100.0f;
+                    m_aabbMin[axis][i] = aabbMin.GetElement(axis);
+                    m_aabbMax[axis][i] = aabbMax.GetElement(axis);
+                }
+            }
+        }
+
+        static constexpr size_t DataCount = 1000;
+
+        std::vector<float> m_points[3];
+        std::vector<float> m_outPoints[3];
+        std::vector<float> m_aabbMin[3];
+        std::vector<float> m_aabbMax[3];
+        std::vector<AZ::Aabb> m_aabbs;
+        AZStd::vector<bool> m_outOverlaps;
+        AZ::Frustum m_testFrustum;
+        AZ::Matrix3x4 m_testTransform;
+    };
+
+    BENCHMARK_F(BM_MathSimdBatch, TransformPoints_Scalar)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            for (size_t i = 0; i < DataCount; ++i)
+            {
+                const AZ::Vector3 result = m_testTransform * AZ::Vector3(m_points[0][i], m_points[1][i], m_points[2][i]);
+                m_outPoints[0][i] = result.GetX();
+                m_outPoints[1][i] = result.GetY();
+                m_outPoints[2][i] = result.GetZ();
+            }
+            benchmark::DoNotOptimize(m_outPoints[0].data());
+        }
+    }
+
+    BENCHMARK_F(BM_MathSimdBatch, TransformPoints_Batch)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            AZ::SimdBatch::TransformPoints(m_testTransform,
+                m_points[0].data(), m_points[1].data(), m_points[2].data(),
+                m_outPoints[0].data(), m_outPoints[1].data(), m_outPoints[2].data(), DataCount);
+            benchmark::DoNotOptimize(m_outPoints[0].data());
+        }
+    }
+
+    BENCHMARK_F(BM_MathSimdBatch, OverlapsFrustum_Scalar)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            for (const AZ::Aabb& aabb : m_aabbs)
+            {
+                bool result = AZ::ShapeIntersection::Overlaps(m_testFrustum, aabb);
+                benchmark::DoNotOptimize(result);
+            }
+        }
+    }
+
+    BENCHMARK_F(BM_MathSimdBatch, OverlapsFrustum_Batch)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            AZ::SimdBatch::OverlapsFrustum(m_testFrustum,
+                m_aabbMin[0].data(), m_aabbMin[1].data(), m_aabbMin[2].data(),
+                m_aabbMax[0].data(), m_aabbMax[1].data(), m_aabbMax[2].data(),
+                m_outOverlaps.data(), DataCount);
+            benchmark::DoNotOptimize(m_outOverlaps.data());
+        }
+    }
+}
+
+#endif
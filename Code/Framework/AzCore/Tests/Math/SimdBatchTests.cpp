@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ * 
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/Matrix3x4.h>
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/ShapeIntersection.h>
+#include <AzCore/Math/SimdBatch.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/containers/vector.h>
+#include <AZTestShared/Math/MathTestHelpers.h>
+
+namespace UnitTest
+{
+    // Not a multiple of the lane count, so both the batched and the remaining elements are tested
+    static constexpr size_t SimdBatchTestCount = 37;
+
+    TEST(MATH_SimdBatch, TransformPoints_MatchesMatrix3x4)
+    {
+        const AZ::Matrix3x4 transform = AZ::Matrix3x4::CreateFromQuaternionAndTranslation(
+            AZ::Quaternion::CreateRotationZ(0.7f) * AZ::Quaternion::CreateRotationX(-0.3f), AZ::Vector3(1.0f, -2.0f, 3.0f))
+            * AZ::Matrix3x4::CreateScale(AZ::Vector3(2.0f, 0.5f, 1.5f));
+
+        AZStd::vector<float> x(SimdBatchTestCount), y(SimdBatchTestCount), z(SimdBatchTestCount);
+        for (size_t i = 0; i < SimdBatchTestCount; ++i)
+        {
+            x[i] = static_cast<float>(i) * 0.5f - 4.0f;
+            y[i] = static_cast<float>(i % 7) - 3.0f;
+            z[i] = static_cast<float>(i % 5) * 2.0f;
+        }
+
+        AZStd::vector<float> outX(SimdBatchTestCount), outY(SimdBatchTestCount), outZ(SimdBatchTestCount);
+        AZ::SimdBatch::TransformPoints(transform, x.data(), y.data(), z.data(), outX.data(), outY.data(), outZ.data(), SimdBatchTestCount);
+
+        for (size_t i = 0; i < SimdBatchTestCount; ++i)
+        {
+            const AZ::Vector3 expected = transform * AZ::Vector3(x[i], y[i], z[i]);
+            EXPECT_THAT(AZ::Vector3(outX[i], outY[i], outZ[i]), IsClose(expected));
+        }
+
+        // Transforming in place
+        AZ::SimdBatch::TransformPoints(transform, x.data(), y.data(), z.data(), x.data(), y.data(), z.data(), SimdBatchTestCount);
+        for (size_t i = 0; i < SimdBatchTestCount; ++i)
+        {
+            EXPECT_THAT(AZ::Vector3(x[i], y[i], z[i]), IsClose(AZ::Vector3(outX[i], outY[i], outZ[i])));
+        }
+    }
+
+    TEST(MATH_SimdBatch, OverlapsFrustum_MatchesShapeIntersection)
+    {
+        const AZ::Frustum frustum(AZ::ViewFrustumAttributes(AZ::Transform::CreateIdentity(), 1.0f, 2.0f * atanf(0.5f), 1.0f, 20.0f));
+
+        AZStd::vector<float> minX(SimdBatchTestCount), minY(SimdBatchTestCount), minZ(SimdBatchTestCount);
+        AZStd::vector<float> maxX(SimdBatchTestCount), maxY(SimdBatchTestCount), maxZ(SimdBatchTestCount);
+        for (size_t i = 0; i < SimdBatchTestCount; ++i)
+        {
+            // Boxes along the view direction and sideways, some inside, some crossing and some outside of the frustum
+            const float x = static_cast<float>(i % 9) * 3.0f - 12.0f;
+            const float y = static_cast<float>(i) - 5.0f;
+            const float z = static_cast<float>(i % 4) - 1.5f;
+            minX[i] = x - 0.5f;
+            minY[i] = y - 0.5f;
+            minZ[i] = z - 0.5f;
+            maxX[i] = x + 0.5f;
+            maxY[i] = y + 0.5f;
+            maxZ[i] = z + 0.5f;
+        }
+
+        bool outOverlaps[SimdBatchTestCount];
+        AZ::SimdBatch::OverlapsFrustum(
+            frustum, minX.data(), minY.data(), minZ.data(), maxX.data(), maxY.data(), maxZ.data(), outOverlaps, SimdBatchTestCount);
+
+        size_t overlapCount = 0;
+        for (size_t i = 0; i < SimdBatchTestCount; ++i)
+        {
+            const AZ::Aabb aabb = AZ::Aabb::CreateFromMinMax(AZ::Vector3(minX[i], minY[i], minZ[i]), AZ::Vector3(maxX[i], maxY[i], maxZ[i]));
+            EXPECT_EQ(outOverlaps[i], AZ::ShapeIntersection::Overlaps(frustum, aabb));
+            overlapCount += outOverlaps[i] ? 1 : 0;
+        }
+        EXPECT_GT(overlapCount, 0);
+        EXPECT_LT(overlapCount, SimdBatchTestCount);
+    }
+}
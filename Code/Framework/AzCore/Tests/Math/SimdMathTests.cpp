@@ -2875,4 +2875,81 @@ namespace UnitTest
     {
         TestZeroVectorInt<Simd::Vec4>();
     }
+
+    TEST(MATH_SimdMath, TestLoadStoreVec8)
+    {
+        AZ_ALIGN(float testLoadFloats[8], 32) = { 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f };
+        AZ_ALIGN(float testStoreFloats[8], 32) = {};
+        AZ_ALIGN(int32_t testLoadInts[8], 32) = { 1, 2, 3, 4, 5, 6, 7, 8 };
+        AZ_ALIGN(int32_t testStoreInts[8], 32) = {};
+
+        Simd::Vec8::StoreAligned(testStoreFloats, Simd::Vec8::LoadAligned(testLoadFloats));
+        Simd::Vec8::StoreAligned(testStoreInts, Simd::Vec8::LoadAligned(testLoadInts));
+        for (int32_t i = 0; i < Simd::Vec8::ElementCount; ++i)
+        {
+            EXPECT_EQ(testLoadFloats[i], testStoreFloats[i]);
+            EXPECT_EQ(testLoadInts[i], testStoreInts[i]);
+        }
+
+        Simd::Vec8::StoreUnaligned(testStoreFloats, Simd::Vec8::ZeroFloat());
+        Simd::Vec8::StoreUnaligned(testStoreInts, Simd::Vec8::ZeroInt());
+        for (int32_t i = 0; i < Simd::Vec8::ElementCount; ++i)
+        {
+            EXPECT_EQ(testStoreFloats[i], 0.0f);
+            EXPECT_EQ(testStoreInts[i], 0);
+        }
+    }
+
+    TEST(MATH_SimdMath, TestArithmeticVec8)
+    {
+        const float testValues[8] = { -4.0f, -3.0f, -2.0f, -1.0f, 1.0f, 4.0f, 9.0f, 16.0f };
+        float testStoreValues[8] = {};
+
+        const Simd::Vec8::FloatType values = Simd::Vec8::LoadUnaligned(testValues);
+
+        Simd::Vec8::StoreUnaligned(testStoreValues, Simd::Vec8::Madd(values, Simd::Vec8::Splat(2.0f), Simd::Vec8::Splat(1.0f)));
+        for (int32_t i = 0; i < Simd::Vec8::ElementCount; ++i)
+        {
+            AZ_TEST_ASSERT_FLOAT_CLOSE(testStoreValues[i], testValues[i] * 2.0f + 1.0f);
+        }
+
+        Simd::Vec8::StoreUnaligned(testStoreValues, Simd::Vec8::Sqrt(Simd::Vec8::Abs(values)));
+        for (int32_t i = 0; i < Simd::Vec8::ElementCount; ++i)
+        {
+            AZ_TEST_ASSERT_FLOAT_CLOSE(testStoreValues[i], sqrtf(fabsf(testValues[i])));
+        }
+
+        Simd::Vec8::StoreUnaligned(testStoreValues, Simd::Vec8::Clamp(values, Simd::Vec8::Splat(-2.0f), Simd::Vec8::Splat(4.0f)));
+        for (int32_t i = 0; i < Simd::Vec8::ElementCount; ++i)
+        {
+            AZ_TEST_ASSERT_FLOAT_CLOSE(testStoreValues[i], AZ::GetClamp(testValues[i], -2.0f, 4.0f));
+        }
+
+        int32_t testStoreInts[8] = {};
+        Simd::Vec8::StoreUnaligned(testStoreInts, Simd::Vec8::Mul(Simd::Vec8::ConvertToInt(values), Simd::Vec8::Splat(3)));
+        for (int32_t i = 0; i < Simd::Vec8::ElementCount; ++i)
+        {
+            EXPECT_EQ(testStoreInts[i], static_cast<int32_t>(testValues[i]) * 3);
+        }
+    }
+
+    TEST(MATH_SimdMath, TestCompareSelectVec8)
+    {
+        const float testValues[8] = { -4.0f, -3.0f, -2.0f, -1.0f, 1.0f, 4.0f, 9.0f, 16.0f };
+        float testStoreValues[8] = {};
+
+        const Simd::Vec8::FloatType values = Simd::Vec8::LoadUnaligned(testValues);
+        const Simd::Vec8::FloatType mask = Simd::Vec8::CmpGt(values, Simd::Vec8::ZeroFloat());
+
+        Simd::Vec8::StoreUnaligned(testStoreValues, Simd::Vec8::Select(Simd::Vec8::Splat(1.0f), Simd::Vec8::Splat(-1.0f), mask));
+        for (int32_t i = 0; i < Simd::Vec8::ElementCount; ++i)
+        {
+            EXPECT_EQ(testStoreValues[i], testValues[i] > 0.0f ? 1.0f : -1.0f);
+        }
+
+        EXPECT_TRUE(Simd::Vec8::CmpAllEq(values, values));
+        EXPECT_FALSE(Simd::Vec8::CmpAllEq(values, Simd::Vec8::Abs(values)));
+        EXPECT_TRUE(Simd::Vec8::CmpAllEq(Simd::Vec8::Splat(7), Simd::Vec8::Splat(7)));
+        EXPECT_FALSE(Simd::Vec8::CmpAllEq(Simd::Vec8::CastToInt(mask), Simd::Vec8::ZeroInt()));
+    }
 }
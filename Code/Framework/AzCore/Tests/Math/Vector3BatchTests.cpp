@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ * 
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/QuaternionBatch.h>
+#include <AzCore/Math/Vector3Batch.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AZTestShared/Math/MathTestHelpers.h>
+
+namespace UnitTest
+{
+    template <typename VecType>
+    class Vector3BatchFixture
+        : public ::testing::Test
+    {
+    public:
+        static constexpr int32_t ElementCount = VecType::ElementCount;
+
+        void SetUp() override
+        {
+            for (int32_t i = 0; i < ElementCount; ++i)
+            {
+                const float value = static_cast<float>(i);
+                m_vectorsA[i] = AZ::Vector3(value - 2.0f, 0.5f * value, 3.0f - value);
+                m_vectorsB[i] = AZ::Vector3(1.0f, value * value * 0.1f, -value);
+                m_rotations[i] = AZ::Quaternion::CreateRotationZ(0.3f * value) * AZ::Quaternion::CreateRotationX(1.0f - 0.2f * value);
+            }
+            // A zero length lane, to check GetNormalizedSafe
+            m_vectorsB[ElementCount - 1] = AZ::Vector3::CreateZero();
+        }
+
+        AZ::Vector3 m_vectorsA[ElementCount];
+        AZ::Vector3 m_vectorsB[ElementCount];
+        AZ::Quaternion m_rotations[ElementCount];
+    };
+
+    using Vector3BatchTypes = ::testing::Types<AZ::Simd::Vec4, AZ::Simd::Vec8>;
+    TYPED_TEST_CASE(Vector3BatchFixture, Vector3BatchTypes);
+
+    TYPED_TEST(Vector3BatchFixture, GatherScatter_RoundTrips)
+    {
+        AZ::Vector3 scattered[TestFixture::ElementCount];
+        AZ::Vector3Batch<TypeParam>::CreateGather(this->m_vectorsA).Scatter(scattered);
+        for (int32_t i = 0; i < TestFixture::ElementCount; ++i)
+        {
+            EXPECT_THAT(scattered[i], IsClose(this->m_vectorsA[i]));
+        }
+
+        AZ::Quaternion scatteredRotations[TestFixture::ElementCount];
+        AZ::QuaternionBatch<TypeParam>::CreateGather(this->m_rotations).Scatter(scatteredRotations);
+        for (int32_t i = 0; i < TestFixture::ElementCount; ++i)
+        {
+            EXPECT_THAT(scatteredRotations[i], IsClose(this->m_rotations[i]));
+        }
+    }
+
+    TYPED_TEST(Vector3BatchFixture, VectorOps_MatchVector3)
+    {
+        const auto batchA = AZ::Vector3Batch<TypeParam>::CreateGather(this->m_vectorsA);
+        const auto batchB = AZ::Vector3Batch<TypeParam>::CreateGather(this->m_vectorsB);
+
+        float dots[TestFixture::ElementCount];
+        TypeParam::StoreUnaligned(dots, batchA.Dot(batchB));
+        const auto cross = batchA.Cross(batchB);
+        const auto normalized = batchA.GetNormalized();
+        const auto normalizedSafe = batchB.GetNormalizedSafe();
+
+        for (int32_t i = 0; i < TestFixture::ElementCount; ++i)
+        {
+            EXPECT_NEAR(dots[i], this->m_vectorsA[i].Dot(this->m_vectorsB[i]), 1e-4f);
+            EXPECT_THAT(cross.GetElement(i), IsClose(this->m_vectorsA[i].Cross(this->m_vectorsB[i])));
+            EXPECT_THAT(normalized.GetElement(i), IsClose(this->m_vectorsA[i].GetNormalized()));
+            EXPECT_THAT(normalizedSafe.GetElement(i), IsClose(this->m_vectorsB[i].GetNormalizedSafe()));
+        }
+    }
+
+    TYPED_TEST(Vector3BatchFixture, TransformPoint_MatchesScalar)
+    {
+        const AZ::Transform transform = AZ::Transform::CreateFromQuaternionAndTranslation(
+            AZ::Quaternion::CreateRotationY(0.8f), AZ::Vector3(1.0f, -2.0f, 5.0f)) * AZ::Transform::CreateUniformScale(1.5f);
+        const AZ::Matrix3x4 matrix = AZ::Matrix3x4::CreateFromTransform(transform);
+
+        const auto points = AZ::Vector3Batch<TypeParam>::CreateGather(this->m_vectorsA);
+        const auto transformedPoints = AZ::TransformPoint(transform, points);
+        const auto transformedVectors = AZ::TransformVector(transform, points);
+        const auto matrixPoints = AZ::TransformPoint(matrix, points);
+
+        for (int32_t i = 0; i < TestFixture::ElementCount; ++i)
+        {
+            EXPECT_THAT(transformedPoints.GetElement(i), IsClose(transform.TransformPoint(this->m_vectorsA[i])));
+            EXPECT_THAT(transformedVectors.GetElement(i), IsClose(transform.TransformVector(this->m_vectorsA[i])));
+            EXPECT_THAT(matrixPoints.GetElement(i), IsClose(matrix * this->m_vectorsA[i]));
+        }
+    }
+
+    TYPED_TEST(Vector3BatchFixture, QuaternionOps_MatchQuaternion)
+    {
+        const auto rotations = AZ::QuaternionBatch<TypeParam>::CreateGather(this->m_rotations);
+        const auto vectors = AZ::Vector3Batch<TypeParam>::CreateGather(this->m_vectorsA);
+
+        const auto rotated = rotations.TransformVector(vectors);
+        const auto combined = rotations * rotations.GetConjugate() * rotations;
+
+        for (int32_t i = 0; i < TestFixture::ElementCount; ++i)
+        {
+            const AZ::Quaternion& rotation = this->m_rotations[i];
+            EXPECT_THAT(rotated.GetElement(i), IsClose(rotation.TransformVector(this->m_vectorsA[i])));
+            EXPECT_THAT(combined.GetElement(i), IsClose(rotation * rotation.GetConjugate() * rotation));
+        }
+    }
+}
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/XxHash64.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+#include <string.h>
+
+namespace UnitTest
+{
+    TEST(XxHash64Test, Compute_MatchesReferenceValues)
+    {
+        // Values of the reference xxhash implementation, XXH64(data, size, seed)
+        EXPECT_EQ(0xEF46DB3751D8E999ULL, AZ::XxHash64::Compute("", 0));
+        EXPECT_EQ(0xD24EC4F1A98C6E5BULL, AZ::XxHash64::Compute("a", 1));
+        EXPECT_EQ(0x44BC2CF5AD770999ULL, AZ::XxHash64::Compute("abc", 3));
+
+        // Longer than a 32 bytes stripe
+        const char* sentence = "Nobody inspects the spammish repetition";
+        EXPECT_EQ(0xFBCEA83C8A378BF1ULL, AZ::XxHash64::Compute(sentence, strlen(sentence)));
+    }
+
+    TEST(XxHash64Test, Update_MatchesSingleBufferCompute)
+    {
+        AZStd::array<uint8_t, 1000> buffer;
+        for (size_t index = 0; index < buffer.size(); ++index)
+        {
+            buffer[index] = static_cast<uint8_t>(index * 53 + 5);
+        }
+
+        for (AZ::u64 seed : { AZ::u64{ 0 }, AZ::u64{ 0x123456789ABCDEFULL } })
+        {
+            for (size_t size : { size_t{ 0 }, size_t{ 5 }, size_t{ 31 }, size_t{ 32 }, size_t{ 33 }, size_t{ 1000 } })
+            {
+                const AZ::u64 expected = AZ::XxHash64::Compute(buffer.data(), size, seed);
+                for (size_t chunkSize : { size_t{ 1 }, size_t{ 7 }, size_t{ 32 }, size_t{ 45 } })
+                {
+                    AZ::XxHash64 hash(seed);
+                    for (size_t offset = 0; offset < size; offset += chunkSize)
+                    {
+                        hash.Update(buffer.data() + offset, AZStd::min(chunkSize, size - offset));
+                    }
+                    EXPECT_EQ(expected, hash.GetDigest());
+                }
+            }
+        }
+    }
+
+    TEST(XxHash64Test, GetDigest_DoesNotModifyState)
+    {
+        const char text[] = "some text hashed in two parts, longer than a stripe";
+        AZ::XxHash64 hash;
+        hash.Update(text, 10);
+        const AZ::u64 partial = hash.GetDigest();
+        EXPECT_EQ(AZ::XxHash64::Compute(text, 10), partial);
+
+        hash.Update(text + 10, sizeof(text) - 10);
+        EXPECT_EQ(AZ::XxHash64::Compute(text, sizeof(text)), hash.GetDigest());
+
+        hash.Reset();
+        EXPECT_EQ(AZ::XxHash64::Compute("", 0), hash.GetDigest());
+    }
+} // namespace UnitTest
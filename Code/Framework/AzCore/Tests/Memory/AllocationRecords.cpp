@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/Memory/AllocationRecords.h>
+#include <AzCore/Memory/HphaSchema.h>
+#include <AzCore/IO/ByteContainerStream.h>
+#include <AzCore/std/containers/vector.h>
+
+using namespace AZ;
+
+namespace UnitTest
+{
+    class AllocationRecords_TestAllocator
+        : public AZ::SimpleSchemaAllocator<AZ::HphaSchema>
+    {
+    public:
+        AZ_TYPE_INFO(AllocationRecords_TestAllocator, "{3C4E2A8F-5D0B-4B7E-A1C6-9F8E7D6C5B4A}");
+
+        using Base = AZ::SimpleSchemaAllocator<AZ::HphaSchema>;
+
+        AllocationRecords_TestAllocator()
+            : Base("AllocationRecords_TestAllocator", "Allocator for Test")
+        {}
+    };
+
+    class AllocationRecordsSamplingTest
+        : public AllocatorsTestFixture
+    {
+    public:
+        static const size_t SamplingInterval = 64 * 1024;
+
+        void SetUp() override
+        {
+            AllocatorsTestFixture::SetUp();
+            AllocatorInstance<AllocationRecords_TestAllocator>::Create();
+            m_records = AllocatorInstance<AllocationRecords_TestAllocator>::GetAllocator().GetRecords();
+            ASSERT_NE(nullptr, m_records);
+            m_records->SetMode(Debug::AllocationRecords::RECORD_SAMPLED);
+            m_records->SetSamplingInterval(SamplingInterval);
+        }
+
+        void TearDown() override
+        {
+            AllocatorInstance<AllocationRecords_TestAllocator>::Destroy();
+            AllocatorsTestFixture::TearDown();
+        }
+
+        void AllocateSameSite(size_t numAllocations, size_t byteSize)
+        {
+            for (size_t i = 0; i < numAllocations; ++i)
+            {
+                m_allocations.push_back(AllocatorInstance<AllocationRecords_TestAllocator>::Get().Allocate(byteSize, 8));
+            }
+        }
+
+        void DeAllocateAll(size_t byteSize)
+        {
+            for (void* allocation : m_allocations)
+            {
+                AllocatorInstance<AllocationRecords_TestAllocator>::Get().DeAllocate(allocation, byteSize, 8);
+            }
+            m_allocations.clear();
+        }
+
+        Debug::AllocationRecords* m_records = nullptr;
+        AZStd::vector<void*> m_allocations;
+    };
+
+    TEST_F(AllocationRecordsSamplingTest, Allocate_SampledMode_RecordsOnlyAFraction)
+    {
+        const size_t byteSize = 1024;
+        const size_t numAllocations = 8 * 1024; // 8 MB, ~128 samples
+        AllocateSameSite(numAllocations, byteSize);
+
+        m_records->lock();
+        const size_t numRecords = m_records->GetMap().size();
+        m_records->unlock();
+        EXPECT_GT(numRecords, 0);
+        EXPECT_LT(numRecords, numAllocations / 8);
+
+        DeAllocateAll(byteSize);
+
+        m_records->lock();
+        EXPECT_TRUE(m_records->GetMap().empty());
+        m_records->unlock();
+    }
+
+    TEST_F(AllocationRecordsSamplingTest, EnumerateAllocationSites_SampledMode_EstimatesLiveBytes)
+    {
+        const size_t byteSize = 1024;
+        const size_t numAllocations = 16 * 1024;
+        AllocateSameSite(numAllocations, byteSize);
+
+        size_t numSites = 0;
+        size_t estimatedBytes = 0;
+        size_t numRecords = 0;
+        m_records->EnumerateAllocationSites([&](const Debug::AllocationSiteInfo& site, unsigned char)
+        {
+            ++numSites;
+            estimatedBytes += site.m_estimatedBytes;
+            numRecords += site.m_numRecords;
+            EXPECT_GE(site.m_estimatedBytes, site.m_recordedBytes);
+            return true;
+        });
+
+        // all the allocations come from the same call stack
+        EXPECT_EQ(1, numSites);
+        EXPECT_GT(numRecords, 0);
+        // ~256 samples, the estimate is well within a factor of 2
+        const size_t totalBytes = numAllocations * byteSize;
+        EXPECT_GT(estimatedBytes, totalBytes / 2);
+        EXPECT_LT(estimatedBytes, totalBytes * 2);
+
+        DeAllocateAll(byteSize);
+    }
+
+    TEST_F(AllocationRecordsSamplingTest, WriteAllocationSitesCB_SampledAllocations_WritesSites)
+    {
+        const size_t byteSize = 4 * 1024;
+        AllocateSameSite(1024, byteSize);
+
+        AZStd::vector<char> buffer;
+        IO::ByteContainerStream<AZStd::vector<char>> stream(&buffer);
+        m_records->EnumerateAllocationSites(Debug::WriteAllocationSitesCB(stream));
+        buffer.push_back(0);
+        EXPECT_NE(nullptr, strstr(buffer.data(), "EstimatedBytes"));
+
+        DeAllocateAll(byteSize);
+    }
+}
@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/Memory/LinearAllocator.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/thread.h>
+
+using namespace AZ;
+
+namespace UnitTest
+{
+    class FrameLinearAllocatorTest
+        : public AllocatorsTestFixture
+    {
+    public:
+        void SetUp() override
+        {
+            AllocatorsTestFixture::SetUp();
+
+            FrameLinearAllocator::Descriptor desc;
+            desc.m_pageSize = 4 * 1024;
+            AllocatorInstance<FrameLinearAllocator>::Create(desc);
+        }
+
+        void TearDown() override
+        {
+            AllocatorInstance<FrameLinearAllocator>::Destroy();
+
+            AllocatorsTestFixture::TearDown();
+        }
+
+        FrameLinearAllocator& GetAllocator()
+        {
+            return static_cast<FrameLinearAllocator&>(AllocatorInstance<FrameLinearAllocator>::GetAllocator());
+        }
+    };
+
+    TEST_F(FrameLinearAllocatorTest, Allocate_VariousAlignments_ReturnsAlignedNonOverlappingMemory)
+    {
+        char* previousEnd = nullptr;
+        for (size_t alignment = 1; alignment <= 256; alignment <<= 1)
+        {
+            char* ptr = reinterpret_cast<char*>(GetAllocator().Allocate(24, alignment));
+            ASSERT_NE(nullptr, ptr);
+            EXPECT_EQ(0, reinterpret_cast<size_t>(ptr) % alignment);
+            if (previousEnd)
+            {
+                EXPECT_GE(ptr, previousEnd);
+            }
+            previousEnd = ptr + 24;
+        }
+        EXPECT_GE(GetAllocator().NumAllocatedBytes(), 24u * 9);
+    }
+
+    TEST_F(FrameLinearAllocatorTest, Reset_ReusesPagesFromPreviousFrame)
+    {
+        void* first = GetAllocator().Allocate(64, 16);
+        for (int i = 0; i < 256; ++i)
+        {
+            GetAllocator().Allocate(64, 16);
+        }
+        const size_t capacity = GetAllocator().Capacity();
+        EXPECT_GT(capacity, 4u * 1024);
+
+        GetAllocator().Reset();
+        EXPECT_EQ(0, GetAllocator().NumAllocatedBytes());
+        EXPECT_EQ(capacity, GetAllocator().Capacity());
+
+        // the next frame starts at the beginning of the same first page and doesn't need new pages
+        EXPECT_EQ(first, GetAllocator().Allocate(64, 16));
+        for (int i = 0; i < 256; ++i)
+        {
+            GetAllocator().Allocate(64, 16);
+        }
+        EXPECT_EQ(capacity, GetAllocator().Capacity());
+    }
+
+    TEST_F(FrameLinearAllocatorTest, Allocate_LargerThanPage_IsReleasedOnReset)
+    {
+        void* ptr = GetAllocator().Allocate(64 * 1024, 16);
+        ASSERT_NE(nullptr, ptr);
+        memset(ptr, 0xcd, 64 * 1024);
+        EXPECT_GE(GetAllocator().Capacity(), 64u * 1024);
+
+        GetAllocator().Reset();
+        EXPECT_LT(GetAllocator().Capacity(), 64u * 1024);
+    }
+
+    TEST_F(FrameLinearAllocatorTest, DeAllocate_MostRecentAllocation_IsReclaimed)
+    {
+        void* first = GetAllocator().Allocate(32, 8);
+        GetAllocator().DeAllocate(first, 32, 8);
+        EXPECT_EQ(first, GetAllocator().Allocate(32, 8));
+
+        // growing the most recent allocation happens in place
+        EXPECT_EQ(128, GetAllocator().Resize(first, 128));
+        // older allocations can't be resized
+        GetAllocator().Allocate(32, 8);
+        EXPECT_EQ(0, GetAllocator().Resize(first, 256));
+    }
+
+    TEST_F(FrameLinearAllocatorTest, AZStdVector_WithFrameLinearStdAllocator_Works)
+    {
+        AZStd::vector<AZ::u64, FrameLinearStdAllocator> values;
+        for (AZ::u64 i = 0; i < 1000; ++i)
+        {
+            values.push_back(i);
+        }
+        for (AZ::u64 i = 0; i < 1000; ++i)
+        {
+            EXPECT_EQ(i, values[i]);
+        }
+        values.set_capacity(0);
+        GetAllocator().Reset();
+    }
+
+    TEST_F(FrameLinearAllocatorTest, Allocate_MultipleThreads_UseSeparatePages)
+    {
+        constexpr size_t numThreads = 4;
+        constexpr size_t numAllocations = 1000;
+        AZStd::vector<AZStd::vector<AZ::u32*>> results(numThreads);
+        AZStd::vector<AZStd::thread> threads;
+        for (size_t threadIndex = 0; threadIndex < numThreads; ++threadIndex)
+        {
+            threads.emplace_back([this, threadIndex, &results]()
+            {
+                results[threadIndex].reserve(numAllocations);
+                for (size_t i = 0; i < numAllocations; ++i)
+                {
+                    AZ::u32* value = reinterpret_cast<AZ::u32*>(GetAllocator().Allocate(sizeof(AZ::u32), alignof(AZ::u32)));
+                    *value = static_cast<AZ::u32>(threadIndex * numAllocations + i);
+                    results[threadIndex].push_back(value);
+                }
+            });
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        for (size_t threadIndex = 0; threadIndex < numThreads; ++threadIndex)
+        {
+            for (size_t i = 0; i < numAllocations; ++i)
+            {
+                EXPECT_EQ(threadIndex * numAllocations + i, *results[threadIndex][i]);
+            }
+        }
+        GetAllocator().Reset();
+    }
+}
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/Memory/MemoryBudgetTracker.h>
+
+using namespace AZ;
+
+namespace UnitTest
+{
+    class MemoryBudgetTrackerTest
+        : public AllocatorsTestFixture
+    {
+    public:
+        void SetUp() override
+        {
+            AllocatorsTestFixture::SetUp();
+            m_tracker = AZStd::make_unique<MemoryBudgetTracker>();
+        }
+
+        void TearDown() override
+        {
+            m_tracker.reset();
+            AllocatorsTestFixture::TearDown();
+        }
+
+    protected:
+        AZStd::unique_ptr<MemoryBudgetTracker> m_tracker;
+    };
+
+    TEST_F(MemoryBudgetTrackerTest, GetAllocatorCategory_MatchesPatternsCaseInsensitively)
+    {
+        EXPECT_EQ(MemoryBudgetCategory::Physics, m_tracker->GetAllocatorCategory("PhysX System Allocator"));
+        EXPECT_EQ(MemoryBudgetCategory::Audio, m_tracker->GetAllocatorCategory("AudioBankAllocator"));
+        EXPECT_EQ(MemoryBudgetCategory::Other, m_tracker->GetAllocatorCategory("SystemAllocator"));
+
+        m_tracker->AddAllocatorPattern(MemoryBudgetCategory::Script, "canvas");
+        EXPECT_EQ(MemoryBudgetCategory::Script, m_tracker->GetAllocatorCategory("ScriptCanvasAllocator"));
+        EXPECT_EQ(MemoryBudgetCategory::Script, m_tracker->GetAllocatorCategory("UiCanvasAllocator"));
+    }
+
+    TEST_F(MemoryBudgetTrackerTest, Update_ChildAllocatorBytesMovedOutOfOther)
+    {
+        AZStd::vector<MemoryBudgetTracker::AllocatorUsage> allocators = {
+            { "SystemAllocator", 1000, false },
+            { "EMotion FX System Allocator", 300, true },
+            { "PhysX System Allocator", 200, false },
+        };
+        m_tracker->Update(allocators);
+
+        EXPECT_EQ(300, m_tracker->GetUsage(MemoryBudgetCategory::Animation).GetUsedBytes());
+        EXPECT_EQ(200, m_tracker->GetUsage(MemoryBudgetCategory::Physics).GetUsedBytes());
+        EXPECT_EQ(700, m_tracker->GetUsage(MemoryBudgetCategory::Other).GetUsedBytes());
+        EXPECT_EQ(1200, m_tracker->GetTotalUsedBytes());
+    }
+
+    TEST_F(MemoryBudgetTrackerTest, Update_UsageProvidersAddedToTheirCategory)
+    {
+        m_tracker->AddUsageProvider(MemoryBudgetCategory::Rendering, "Pools", []() { return size_t(500); });
+        m_tracker->Update({});
+        EXPECT_EQ(500, m_tracker->GetUsage(MemoryBudgetCategory::Rendering).m_providedBytes);
+
+        m_tracker->RemoveUsageProvider("Pools");
+        m_tracker->Update({});
+        EXPECT_EQ(0, m_tracker->GetUsage(MemoryBudgetCategory::Rendering).GetUsedBytes());
+    }
+
+    TEST_F(MemoryBudgetTrackerTest, Update_OverBudgetEventSignaledOncePerCrossing)
+    {
+        size_t audioBytes = 100;
+        m_tracker->AddUsageProvider(MemoryBudgetCategory::Audio, "Sounds", [&audioBytes]() { return audioBytes; });
+        m_tracker->SetBudget(MemoryBudgetCategory::Audio, 150);
+
+        int overBudgetCount = 0;
+        MemoryBudgetTracker::OverBudgetEvent::Handler handler(
+            [&overBudgetCount](MemoryBudgetCategory category, const MemoryBudgetTracker::CategoryUsage& usage)
+            {
+                EXPECT_EQ(MemoryBudgetCategory::Audio, category);
+                EXPECT_TRUE(usage.IsOverBudget());
+                ++overBudgetCount;
+            });
+        m_tracker->ConnectOverBudgetHandler(handler);
+
+        m_tracker->Update({});
+        EXPECT_EQ(0, overBudgetCount);
+
+        audioBytes = 200;
+        m_tracker->Update({});
+        m_tracker->Update({});
+        EXPECT_EQ(1, overBudgetCount);
+
+        audioBytes = 100;
+        m_tracker->Update({});
+        audioBytes = 200;
+        m_tracker->Update({});
+        EXPECT_EQ(2, overBudgetCount);
+    }
+} // namespace UnitTest
@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/Memory/PoolAllocator.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/thread.h>
+
+#if defined(HAVE_BENCHMARK)
+#include <benchmark/benchmark.h>
+#endif // HAVE_BENCHMARK
+
+namespace UnitTest
+{
+    // Separate allocator types, as every thread pool allocator needs its own thread local storage
+    class ThreadPoolSchema_TestAllocator final
+        : public AZ::ThreadPoolBase<ThreadPoolSchema_TestAllocator>
+    {
+    public:
+        AZ_TYPE_INFO(ThreadPoolSchema_TestAllocator, "{0B2DC0FD-3B8E-4C1A-9AF6-56F7A0E6F0E2}");
+
+        using Base = AZ::ThreadPoolBase<ThreadPoolSchema_TestAllocator>;
+
+        ThreadPoolSchema_TestAllocator()
+            : Base("ThreadPoolSchema_TestAllocator", "Allocator for Test")
+        {}
+    };
+
+    class ThreadPoolSchema_CachedTestAllocator final
+        : public AZ::ThreadPoolBase<ThreadPoolSchema_CachedTestAllocator>
+    {
+    public:
+        AZ_TYPE_INFO(ThreadPoolSchema_CachedTestAllocator, "{7E3B4F61-08C5-4D3E-B0B4-2A0C9E51D7A4}");
+
+        using Base = AZ::ThreadPoolBase<ThreadPoolSchema_CachedTestAllocator>;
+
+        ThreadPoolSchema_CachedTestAllocator()
+            : Base("ThreadPoolSchema_CachedTestAllocator", "Allocator for Test")
+        {}
+
+        static Descriptor GetCachedDescriptor()
+        {
+            Descriptor desc;
+            desc.m_threadPageCacheSize = 4;
+            desc.m_crossThreadFreeBatchSize = 32;
+            return desc;
+        }
+    };
+
+    class ThreadPoolSchemaCacheTest
+        : public AllocatorsTestFixture
+    {
+    public:
+        void SetUp() override
+        {
+            AllocatorsTestFixture::SetUp();
+            AZ::AllocatorInstance<ThreadPoolSchema_CachedTestAllocator>::Create(ThreadPoolSchema_CachedTestAllocator::GetCachedDescriptor());
+        }
+
+        void TearDown() override
+        {
+            AZ::AllocatorInstance<ThreadPoolSchema_CachedTestAllocator>::Destroy();
+            AllocatorsTestFixture::TearDown();
+        }
+
+        AZ::IAllocatorAllocate& GetAllocator()
+        {
+            return AZ::AllocatorInstance<ThreadPoolSchema_CachedTestAllocator>::Get();
+        }
+    };
+
+    TEST_F(ThreadPoolSchemaCacheTest, DeAllocate_FromOtherThread_ElementsAreReturnedToOwner)
+    {
+        const size_t elementSize = 64;
+        AZStd::vector<void*> elements;
+        for (int i = 0; i < 1000; ++i)
+        {
+            elements.push_back(GetAllocator().Allocate(elementSize, 8));
+        }
+
+        // free them from another thread, which will batch them, and release the batches with GarbageCollect
+        AZStd::thread thread([this, &elements]()
+        {
+            // allocate once so the thread has its own pool (and batches)
+            void* ownElement = GetAllocator().Allocate(elementSize, 8);
+            for (void* element : elements)
+            {
+                GetAllocator().DeAllocate(element, elementSize, 8);
+            }
+            GetAllocator().DeAllocate(ownElement, elementSize, 8);
+            GetAllocator().GarbageCollect();
+        });
+        thread.join();
+
+        // the owner processes the freed elements on its next allocation
+        void* element = GetAllocator().Allocate(elementSize, 8);
+        EXPECT_EQ(elementSize, GetAllocator().NumAllocatedBytes());
+        GetAllocator().DeAllocate(element, elementSize, 8);
+        EXPECT_EQ(0, GetAllocator().NumAllocatedBytes());
+    }
+
+    TEST_F(ThreadPoolSchemaCacheTest, AllocateDeAllocate_ManyPages_ReusesCachedPages)
+    {
+        const size_t elementSize = 256;
+        AZStd::vector<void*> elements;
+        for (int frame = 0; frame < 8; ++frame)
+        {
+            for (int i = 0; i < 200; ++i)
+            {
+                void* element = GetAllocator().Allocate(elementSize, 8);
+                ASSERT_NE(nullptr, element);
+                memset(element, frame, elementSize);
+                elements.push_back(element);
+            }
+            for (void* element : elements)
+            {
+                GetAllocator().DeAllocate(element, elementSize, 8);
+            }
+            elements.clear();
+        }
+        EXPECT_EQ(0, GetAllocator().NumAllocatedBytes());
+        GetAllocator().GarbageCollect();
+    }
+}
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    using namespace UnitTest;
+
+    static const AZStd::array<size_t, 8> s_poolAllocationSizes = { 16, 24, 32, 48, 64, 128, 256, 512 };
+
+    template<class Allocator>
+    class ThreadPoolSchemaBenchmarkFixture
+        : public ::benchmark::Fixture
+    {
+    public:
+        using ::benchmark::Fixture::SetUp, ::benchmark::Fixture::TearDown;
+
+        void SetUp(const ::benchmark::State& state) override
+        {
+            // all threads run SetUp, only one of them may create the allocator
+            if (state.thread_index == 0)
+            {
+                CreateAllocator();
+            }
+        }
+
+        void TearDown(const ::benchmark::State& state) override
+        {
+            if (state.thread_index == 0)
+            {
+                AZ::AllocatorInstance<Allocator>::Destroy();
+            }
+        }
+
+        // Allocates a working set which spans several pages and frees it again, every thread uses its own pool so the
+        // contention comes from the pages moving to and from the shared free list.
+        static void BM_AllocateDeAllocate(::benchmark::State& state)
+        {
+            constexpr size_t workingSetSize = 256;
+            AZStd::array<void*, workingSetSize> allocations;
+            AZ::IAllocatorAllocate& allocator = AZ::AllocatorInstance<Allocator>::Get();
+            while (state.KeepRunning())
+            {
+                for (size_t i = 0; i < workingSetSize; ++i)
+                {
+                    allocations[i] = allocator.Allocate(s_poolAllocationSizes[i % s_poolAllocationSizes.size()], 8);
+                }
+                for (size_t i = 0; i < workingSetSize; ++i)
+                {
+                    allocator.DeAllocate(allocations[i], s_poolAllocationSizes[i % s_poolAllocationSizes.size()], 8);
+                }
+            }
+            state.SetItemsProcessed(state.iterations() * workingSetSize);
+        }
+
+    private:
+        void CreateAllocator();
+    };
+
+    template<>
+    void ThreadPoolSchemaBenchmarkFixture<ThreadPoolSchema_TestAllocator>::CreateAllocator()
+    {
+        AZ::AllocatorInstance<ThreadPoolSchema_TestAllocator>::Create();
+    }
+
+    template<>
+    void ThreadPoolSchemaBenchmarkFixture<ThreadPoolSchema_CachedTestAllocator>::CreateAllocator()
+    {
+        AZ::AllocatorInstance<ThreadPoolSchema_CachedTestAllocator>::Create(ThreadPoolSchema_CachedTestAllocator::GetCachedDescriptor());
+    }
+
+    BENCHMARK_TEMPLATE_DEFINE_F(ThreadPoolSchemaBenchmarkFixture, AllocateDeAllocate, ThreadPoolSchema_TestAllocator)(::benchmark::State& state)
+    {
+        BM_AllocateDeAllocate(state);
+    }
+    BENCHMARK_REGISTER_F(ThreadPoolSchemaBenchmarkFixture, AllocateDeAllocate)->ThreadRange(1, 32)->UseRealTime();
+
+    BENCHMARK_TEMPLATE_DEFINE_F(ThreadPoolSchemaBenchmarkFixture, AllocateDeAllocateThreadCache, ThreadPoolSchema_CachedTestAllocator)(::benchmark::State& state)
+    {
+        BM_AllocateDeAllocate(state);
+    }
+    BENCHMARK_REGISTER_F(ThreadPoolSchemaBenchmarkFixture, AllocateDeAllocateThreadCache)->ThreadRange(1, 32)->UseRealTime();
+} // Benchmark
+#endif // HAVE_BENCHMARK
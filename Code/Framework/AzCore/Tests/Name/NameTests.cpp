@@ -621,6 +621,101 @@ namespace UnitTest
         RunConcurrencyTest<ThreadRepeatedlyCreatesAndReleasesOneName<100>>(100, 2);
     }
 
+    TEST_F(NameTest, ManyNames_ReleasedAndFoundByHash_LookupTableStaysConsistent)
+    {
+        // Enough names to grow the lookup table a few times, and leave tombstones behind
+        AZStd::vector<AZ::Name> names;
+        for (int i = 0; i < 4000; ++i)
+        {
+            names.emplace_back(AZStd::string::format("name%d", i));
+        }
+        for (size_t i = 0; i < names.size(); i += 2)
+        {
+            names[i] = AZ::Name();
+        }
+        EXPECT_EQ(names.size() / 2, NameDictionaryTester::GetEntryCount());
+
+        for (size_t i = 0; i < names.size(); ++i)
+        {
+            if (i % 2)
+            {
+                AZ::Name nameFromHash{names[i].GetHash()};
+                EXPECT_EQ(names[i], nameFromHash);
+                EXPECT_EQ(names[i], AZ::Name(AZStd::string::format("name%zu", i)));
+            }
+            else
+            {
+                // Re-adding the released names reuses the removed slots
+                names[i] = AZ::Name(AZStd::string::format("name%zu", i));
+                EXPECT_EQ(names[i], AZ::Name(names[i].GetHash()));
+            }
+        }
+        EXPECT_EQ(names.size(), NameDictionaryTester::GetEntryCount());
+    }
+
+    TEST_F(NameTest, NameLiteral_SameString_MatchesName)
+    {
+        AZ::Name literalName = AZ_NAME_LITERAL("literal");
+        AZ::Name name{"literal"};
+        EXPECT_EQ(name, literalName);
+        EXPECT_EQ(name.GetStringView(), literalName.GetStringView());
+        EXPECT_EQ(NameDictionaryTester::CalcDirectHashValue("literal"), literalName.GetHash());
+
+        // The literal keeps the entry alive
+        literalName = AZ::Name();
+        name = AZ::Name();
+        EXPECT_EQ(1, NameDictionaryTester::GetEntryCount());
+        EXPECT_EQ(AZ::Name("literal"), AZ_NAME_LITERAL("literal"));
+    }
+
+    TEST_F(NameTest, NameLiteral_DictionaryRecreated_ResolvesAgain)
+    {
+        auto getLiteral = []() { return AZ_NAME_LITERAL("recreated"); };
+        EXPECT_EQ("recreated", getLiteral().GetStringView());
+
+        // Destroying the dictionary drops the reference held by the literal without reporting a leak
+        AZ::NameDictionary::Destroy();
+        AZ::NameDictionary::Create();
+        EXPECT_EQ(0, NameDictionaryTester::GetEntryCount());
+
+        AZ::Name name = getLiteral();
+        EXPECT_EQ("recreated", name.GetStringView());
+        EXPECT_EQ(AZ::Name("recreated"), name);
+    }
+
+    TEST_F(NameTest, ConcurrencyDataTest_ThreadsCreateAndReleaseSharedNames_NamesStayUnique)
+    {
+        // All threads churn through the same small set of names, so lookups regularly race with entries being
+        // released and re-added on other threads.
+        constexpr int nameCount = 16;
+        constexpr int threadCount = 8;
+        AZStd::vector<AZStd::thread> threads;
+        AZStd::atomic<int> mismatches{ 0 };
+        for (int threadIndex = 0; threadIndex < threadCount; ++threadIndex)
+        {
+            threads.emplace_back([&mismatches]()
+            {
+                for (int i = 0; i < 2000; ++i)
+                {
+                    AZStd::string nameString = AZStd::string::format("shared%d", i % nameCount);
+                    AZ::Name name{nameString};
+                    AZ::Name nameFromHash{name.GetHash()};
+                    if (name.GetStringView() != nameString || (!nameFromHash.IsEmpty() && nameFromHash != name))
+                    {
+                        ++mismatches;
+                    }
+                }
+            });
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        EXPECT_EQ(0, mismatches);
+        EXPECT_EQ(0, NameDictionaryTester::GetEntryCount());
+    }
+
     TEST_F(NameTest, DISABLED_NameVsStringPerf_Creation)
     {
         constexpr int CreateCount = AZ_TRAIT_UNIT_TEST_NAME_COUNT;
@@ -6,6 +6,7 @@
  */
 
 #include <AzCore/RTTI/RTTI.h>
+#include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/RTTI/ReflectionManager.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/UnitTest/TestTypes.h>
@@ -1108,4 +1109,53 @@ namespace UnitTest
         m_reflection.reset();
         EXPECT_FALSE(TestReflectedClass::s_isReflected);
     }
+
+    TEST_F(ReflectionManagerTest, DeferredContext_ReflectsOnFirstGet)
+    {
+        m_reflection->AddDeferredReflectContext<SerializeContext>();
+
+        m_reflection->Reflect(&TestReflectedClass::Reflect);
+        EXPECT_FALSE(TestReflectedClass::s_isReflected);
+
+        EXPECT_NE(nullptr, m_reflection->GetReflectContext<SerializeContext>());
+        EXPECT_TRUE(TestReflectedClass::s_isReflected);
+
+        m_reflection->Unreflect(&TestReflectedClass::Reflect);
+        EXPECT_FALSE(TestReflectedClass::s_isReflected);
+
+        m_reflection->Reflect(&TestReflectedClass::Reflect);
+        EXPECT_TRUE(TestReflectedClass::s_isReflected);
+
+        m_reflection.reset();
+        EXPECT_FALSE(TestReflectedClass::s_isReflected);
+    }
+
+    class TestCountedReflectedClass
+    {
+    public:
+        static int s_reflectCount;
+        static int s_unreflectCount;
+        static void Reflect(ReflectContext* context)
+        {
+            ++(context->IsRemovingReflection() ? s_unreflectCount : s_reflectCount);
+        }
+    };
+    int TestCountedReflectedClass::s_reflectCount = 0;
+    int TestCountedReflectedClass::s_unreflectCount = 0;
+
+    TEST_F(ReflectionManagerTest, DeferredContext_NeverRequested_IsNeitherReflectedNorUnreflected)
+    {
+        TestCountedReflectedClass::s_reflectCount = 0;
+        TestCountedReflectedClass::s_unreflectCount = 0;
+
+        m_reflection->AddReflectContext<SerializeContext>();
+        m_reflection->AddDeferredReflectContext<BehaviorContext>();
+
+        m_reflection->Reflect(&TestCountedReflectedClass::Reflect);
+        EXPECT_EQ(1, TestCountedReflectedClass::s_reflectCount);
+
+        m_reflection.reset();
+        EXPECT_EQ(1, TestCountedReflectedClass::s_reflectCount);
+        EXPECT_EQ(1, TestCountedReflectedClass::s_unreflectCount);
+    }
 }
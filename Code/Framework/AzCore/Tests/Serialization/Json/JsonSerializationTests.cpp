@@ -333,6 +333,33 @@ namespace JsonSerializationTests
         EXPECT_EQ(Processing::Halted, loadResult.GetProcessing());
     }
 
+    TEST_F(JsonSerializationTests, LoadFromString_ArrayAtTheRoot_SucceedsAndObjectMatches)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        auto genericInfo = AZ::SerializeGenericTypeInfo<AZStd::vector<AZStd::string>>::GetGenericInfo();
+        ASSERT_NE(nullptr, genericInfo);
+        genericInfo->Reflect(m_serializeContext.get());
+
+        // Only the first part of the text is passed to make sure parsing doesn't rely on the text being null terminated.
+        constexpr AZStd::string_view jsonText = R"([ "hello", "world" ], "ignored" ])";
+        AZStd::vector<AZStd::string> loadValues;
+        ResultCode loadResult = AZ::JsonSerialization::LoadFromString(loadValues, jsonText.substr(0, 20), *m_deserializationSettings);
+        ASSERT_EQ(Outcomes::Success, loadResult.GetOutcome());
+        EXPECT_EQ(loadValues, AZStd::vector<AZStd::string>({ "hello", "world" }));
+    }
+
+    TEST_F(JsonSerializationTests, LoadFromString_InvalidJson_ReturnsInvalid)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        bool loadValue = false;
+        ResultCode loadResult = AZ::JsonSerialization::LoadFromString(loadValue, R"({ "value": )", *m_deserializationSettings);
+        EXPECT_EQ(Outcomes::Invalid, loadResult.GetOutcome());
+        EXPECT_EQ(Processing::Halted, loadResult.GetProcessing());
+        EXPECT_FALSE(loadValue);
+    }
+
     // Store
 
     TEST_F(JsonSerializationTests, Store_PrimitiveAtTheRoot_ReturnsSuccessAndTheValueAtTheRoot)
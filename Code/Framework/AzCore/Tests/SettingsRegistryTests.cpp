@@ -12,6 +12,7 @@
 #include <AzCore/Serialization/Json/RegistrationContext.h>
 #include <AzCore/Serialization/Json/JsonSystemComponent.h>
 #include <AzCore/Settings/SettingsRegistryImpl.h>
+#include <AzCore/Settings/SettingsRegistryMergeUtils.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/std/string/string.h>
@@ -1755,4 +1756,133 @@ namespace SettingsRegistryTests
         EXPECT_EQ(AZ::SettingsRegistryInterface::Type::String, m_registry->GetType(AZ_SETTINGS_REGISTRY_HISTORY_KEY "/1/File1"));
         EXPECT_EQ(AZ::SettingsRegistryInterface::Type::String, m_registry->GetType(AZ_SETTINGS_REGISTRY_HISTORY_KEY "/1/File2"));
     }
+
+    //
+    // SaveSettingsBinary/LoadSettingsBinary
+    //
+
+    TEST_F(SettingsRegistryTest, LoadSettingsBinary_SavedSettings_RoundTripsAllTypes)
+    {
+        ASSERT_TRUE(m_registry->MergeSettings(R"({ "Root": { "Bool": true, "Negative": -3, "Unsigned": 18446744073709551615,
+            "Double": 0.25, "String": "Hello", "Null": null, "Array": [ 1, "two", [], {} ], "Empty": {} } })",
+            AZ::SettingsRegistryInterface::Format::JsonMergePatch));
+
+        AZStd::vector<char> binary;
+        ASSERT_TRUE(m_registry->SaveSettingsBinary(binary));
+
+        AZ::SettingsRegistryImpl loadedRegistry;
+        ASSERT_TRUE(loadedRegistry.LoadSettingsBinary({ binary.data(), binary.size() }));
+
+        bool boolValue = false;
+        EXPECT_TRUE(loadedRegistry.Get(boolValue, "/Root/Bool"));
+        EXPECT_TRUE(boolValue);
+        AZ::s64 negativeValue = 0;
+        EXPECT_TRUE(loadedRegistry.Get(negativeValue, "/Root/Negative"));
+        EXPECT_EQ(-3, negativeValue);
+        AZ::u64 unsignedValue = 0;
+        EXPECT_TRUE(loadedRegistry.Get(unsignedValue, "/Root/Unsigned"));
+        EXPECT_EQ(AZStd::numeric_limits<AZ::u64>::max(), unsignedValue);
+        double doubleValue = 0.0;
+        EXPECT_TRUE(loadedRegistry.Get(doubleValue, "/Root/Double"));
+        EXPECT_DOUBLE_EQ(0.25, doubleValue);
+        AZ::SettingsRegistryInterface::FixedValueString stringValue;
+        EXPECT_TRUE(loadedRegistry.Get(stringValue, "/Root/String"));
+        EXPECT_STREQ("Hello", stringValue.c_str());
+        EXPECT_TRUE(loadedRegistry.Get(stringValue, "/Root/Array/1"));
+        EXPECT_STREQ("two", stringValue.c_str());
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::Null, loadedRegistry.GetType("/Root/Null"));
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::Array, loadedRegistry.GetType("/Root/Array/2"));
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::Object, loadedRegistry.GetType("/Root/Array/3"));
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::Object, loadedRegistry.GetType("/Root/Empty"));
+
+        AZStd::vector<char> reloadedBinary;
+        ASSERT_TRUE(loadedRegistry.SaveSettingsBinary(reloadedBinary));
+        EXPECT_EQ(binary, reloadedBinary);
+    }
+
+    TEST_F(SettingsRegistryTest, LoadSettingsBinary_WithPath_ReplacesOnlyThatKey)
+    {
+        ASSERT_TRUE(m_registry->MergeSettings(R"({ "Source": { "Value": 1 }, "Target": { "Old": 2 }, "Other": 3 })",
+            AZ::SettingsRegistryInterface::Format::JsonMergePatch));
+
+        AZStd::vector<char> binary;
+        ASSERT_TRUE(m_registry->SaveSettingsBinary(binary, "/Source"));
+
+        size_t notifyCount = 0;
+        auto notifyHandler = m_registry->RegisterNotifier([&notifyCount](AZStd::string_view path, AZ::SettingsRegistryInterface::Type type)
+            {
+                EXPECT_TRUE(path == "/Target");
+                EXPECT_EQ(AZ::SettingsRegistryInterface::Type::Object, type);
+                ++notifyCount;
+            });
+        ASSERT_TRUE(m_registry->LoadSettingsBinary({ binary.data(), binary.size() }, "/Target"));
+        EXPECT_EQ(1, notifyCount);
+
+        AZ::s64 value = 0;
+        EXPECT_TRUE(m_registry->Get(value, "/Target/Value"));
+        EXPECT_EQ(1, value);
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::NoType, m_registry->GetType("/Target/Old"));
+        EXPECT_TRUE(m_registry->Get(value, "/Other"));
+        EXPECT_EQ(3, value);
+    }
+
+    TEST_F(SettingsRegistryTest, LoadSettingsBinary_TruncatedData_ReturnsFalseAndKeepsSettings)
+    {
+        ASSERT_TRUE(m_registry->MergeSettings(R"({ "Array": [ "first", "second" ] })", AZ::SettingsRegistryInterface::Format::JsonMergePatch));
+        AZStd::vector<char> binary;
+        ASSERT_TRUE(m_registry->SaveSettingsBinary(binary));
+        ASSERT_TRUE(m_registry->Set("/Value", true));
+
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        EXPECT_FALSE(m_registry->LoadSettingsBinary({ binary.data(), binary.size() - 1 }));
+        EXPECT_FALSE(m_registry->LoadSettingsBinary({}));
+        AZ_TEST_STOP_TRACE_SUPPRESSION(2);
+
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::Boolean, m_registry->GetType("/Value"));
+    }
+
+    TEST_F(SettingsRegistryTest, MergeSettingsToRegistry_Cached_SecondRun_LoadsCacheUntilAFileChanges)
+    {
+        CreateTestFile("Memory.setreg", R"({ "Memory": 1 })");
+        CreateTestFile("Memory.editor.setreg", R"({ "MemoryEditor": true })");
+        const AZStd::string registryFolder = AZStd::string::format("%s/%s", m_testFolder->c_str(), AZ::SettingsRegistryInterface::RegistryFolder);
+        const AZStd::string userFolder = AZStd::string::format("%s/user", m_testFolder->c_str());
+        const AZ::SettingsRegistryInterface::Specializations specializations{ "editor" };
+
+        auto runCachedMerge = [&](AZ::s64& memory) -> bool
+        {
+            AZ::SettingsRegistryImpl registry;
+            registry.Set(AZ::SettingsRegistryMergeUtils::FilePathKey_ProjectUserPath, userFolder);
+            const bool loadedFromCache = AZ::SettingsRegistryMergeUtils::MergeSettingsToRegistry_Cached(registry, "", specializations,
+                [&registry, &registryFolder, &specializations]()
+                {
+                    registry.MergeSettingsFolder(registryFolder, specializations, {});
+                });
+            bool memoryEditor = false;
+            EXPECT_TRUE(registry.Get(memoryEditor, "/MemoryEditor"));
+            EXPECT_TRUE(memoryEditor);
+            EXPECT_TRUE(registry.Get(memory, "/Memory"));
+            return loadedFromCache;
+        };
+
+        AZ::s64 memory = 0;
+        EXPECT_FALSE(runCachedMerge(memory));
+        EXPECT_EQ(1, memory);
+        EXPECT_TRUE(runCachedMerge(memory));
+        EXPECT_EQ(1, memory);
+
+        // A different size invalidates the entry even within the time stamp resolution
+        CreateTestFile("Memory.setreg", R"({ "Memory": 22 })");
+        EXPECT_FALSE(runCachedMerge(memory));
+        EXPECT_EQ(22, memory);
+        EXPECT_TRUE(runCachedMerge(memory));
+
+        // New files in a merged folder invalidate the entry
+        CreateTestFile("Memory.editor.zzz.setreg", R"({ "Memory": 4 })");
+        EXPECT_FALSE(runCachedMerge(memory));
+        EXPECT_EQ(22, memory); // The file doesn't match the specializations but that's only known by merging the folder
+        CreateTestFile("Other.setreg", R"({ "Memory": 5 })");
+        EXPECT_FALSE(runCachedMerge(memory));
+        EXPECT_EQ(5, memory);
+    }
 } // namespace SettingsRegistryTests
@@ -308,6 +308,46 @@ namespace UnitTest
 
     }
 
+    TEST_F(StatisticalProfilerTest, StatisticalProfilerStringWithSharedSpinMutex_PushSameStatFromThreads_SamplesMergedOnRead)
+    {
+        AZ::Statistics::StatisticalProfiler<AZStd::string, AZStd::shared_spin_mutex> profiler;
+
+        const AZStd::string statIdShared = "shared_stat";
+        const AZStd::string statIdUnregistered = "unregistered_stat";
+        ASSERT_TRUE(profiler.GetStatsManager().AddStatistic(statIdShared, statIdShared, "us"));
+
+        const int threadCount = 4;
+        const int samplesPerThread = 1000;
+        AZStd::vector<AZStd::thread> threads;
+        for (int threadIndex = 0; threadIndex < threadCount; ++threadIndex)
+        {
+            threads.emplace_back([&profiler, &statIdShared, &statIdUnregistered, threadIndex]()
+                {
+                    for (int i = 0; i < samplesPerThread; ++i)
+                    {
+                        profiler.PushSample(statIdShared, static_cast<double>(threadIndex + 1));
+                        profiler.PushSample(statIdUnregistered, 1.0);
+                    }
+                });
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        const AZ::Statistics::NamedRunningStatistic* stat = profiler.GetStatistic(statIdShared);
+        ASSERT_TRUE(stat != nullptr);
+        EXPECT_EQ(stat->GetNumSamples(), threadCount * samplesPerThread);
+        EXPECT_EQ(stat->GetMinimum(), 1.0);
+        EXPECT_EQ(stat->GetMaximum(), static_cast<double>(threadCount));
+        EXPECT_NEAR(stat->GetSum(), samplesPerThread * (threadCount * (threadCount + 1) / 2), 0.001);
+        EXPECT_TRUE(profiler.GetStatistic(statIdUnregistered) == nullptr);
+
+        // Samples pushed after a read are merged on the next read
+        profiler.PushSample(statIdShared, 1.0);
+        EXPECT_EQ(profiler.GetStatistic(statIdShared)->GetNumSamples(), threadCount * samplesPerThread + 1);
+    }
+
     TEST_F(StatisticalProfilerTest, StatisticalProfilerProxy_ProfileCode_ValidateStatistics)
     {
 #define CODE_PROFILER_PROXY_PUSH_TIME(profiler, scopeNameId) \
@@ -84,6 +84,37 @@ namespace UnitTest
     }
 
 
+    TEST_F(StatisticsTest, RunningStatistic_MergeSplitSamples_MatchesSingleStatistic)
+    {
+        Statistics::RunningStatistic allSamplesStat;
+        Statistics::RunningStatistic firstPartStat;
+        Statistics::RunningStatistic secondPartStat;
+
+        ASSERT_TRUE(m_dataSamples.get() != nullptr);
+        const AZStd::vector<u32>& dataSamples = *m_dataSamples;
+        for (size_t i = 0; i < dataSamples.size(); ++i)
+        {
+            allSamplesStat.PushSample(dataSamples[i]);
+            (i < dataSamples.size() / 3 ? firstPartStat : secondPartStat).PushSample(dataSamples[i]);
+        }
+
+        firstPartStat.Merge(secondPartStat);
+
+        EXPECT_EQ(firstPartStat.GetNumSamples(), allSamplesStat.GetNumSamples());
+        EXPECT_EQ(firstPartStat.GetMostRecentSample(), allSamplesStat.GetMostRecentSample());
+        EXPECT_EQ(firstPartStat.GetMinimum(), allSamplesStat.GetMinimum());
+        EXPECT_EQ(firstPartStat.GetMaximum(), allSamplesStat.GetMaximum());
+        EXPECT_NEAR(firstPartStat.GetSum(), allSamplesStat.GetSum(), 0.001);
+        EXPECT_NEAR(firstPartStat.GetAverage(), allSamplesStat.GetAverage(), 0.001);
+        EXPECT_NEAR(firstPartStat.GetVariance(), allSamplesStat.GetVariance(), 0.001);
+
+        //Merging into an empty stat copies the other stat.
+        Statistics::RunningStatistic emptyStat;
+        emptyStat.Merge(allSamplesStat);
+        EXPECT_EQ(emptyStat.GetNumSamples(), allSamplesStat.GetNumSamples());
+        EXPECT_NEAR(emptyStat.GetVariance(), allSamplesStat.GetVariance(), 0.001);
+    }
+
     TEST_F(StatisticsTest, StatisticsManager_AddAndRemoveStatisticistics_CollectionIntegrityIsCorrect)
     {
         Statistics::StatisticsManager<> statsManager;
@@ -38,6 +38,7 @@ public:
     MOCK_METHOD1(Custom, FileRequestPtr(AZStd::any));
     MOCK_METHOD2(Custom, FileRequestPtr& (FileRequestPtr&, AZStd::any));
     MOCK_METHOD2(SetRequestCompleteCallback, FileRequestPtr&(FileRequestPtr&, OnCompleteCallback));
+    MOCK_METHOD2(SetRequestCompleteDependent, FileRequestPtr&(FileRequestPtr&, AZ::Job&));
     MOCK_METHOD0(CreateRequest, FileRequestPtr());
     MOCK_METHOD2(CreateRequestBatch, void(AZStd::vector<FileRequestPtr>&, size_t));
     MOCK_METHOD1(QueueRequest, void(const FileRequestPtr&));
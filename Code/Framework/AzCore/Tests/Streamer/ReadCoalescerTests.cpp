@@ -0,0 +1,262 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/IStreamerTypes.h>
+#include <AzCore/IO/Streamer/ReadCoalescer.h>
+#include <AzCore/Memory/Memory.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <Tests/FileIOBaseTestTypes.h>
+#include <Tests/Streamer/StreamStackEntryConformityTests.h>
+#include <Tests/Streamer/StreamStackEntryMock.h>
+
+namespace AZ::IO
+{
+    class ReadCoalescerTestDescription :
+        public StreamStackEntryConformityTestsDescriptor<ReadCoalescer>
+    {
+    public:
+        ReadCoalescer CreateInstance() override
+        {
+            return ReadCoalescer(16_kib, 1_mib, 32, AZCORE_GLOBAL_NEW_ALIGNMENT);
+        }
+    };
+
+    using ReadCoalescerTestTypes = ::testing::Types<ReadCoalescerTestDescription>;
+    INSTANTIATE_TYPED_TEST_CASE_P(Streamer_ReadCoalescerConformityTests, StreamStackEntryConformityTests, ReadCoalescerTestTypes);
+
+    class Streamer_ReadCoalescerTest
+        : public UnitTest::ScopedAllocatorSetupFixture
+    {
+    public:
+        static constexpr u64 MergeWindow = 1_kib;
+        static constexpr u64 MaxMergedReadSize = 16_kib;
+        static constexpr u32 MaxNumMergedReads = 4;
+
+        Streamer_ReadCoalescerTest()
+            : m_mock(AZStd::make_shared<StreamStackEntryMock>())
+        {
+        }
+
+        void SetUp() override
+        {
+            using ::testing::_;
+
+            m_prevFileIO = AZ::IO::FileIOBase::GetInstance();
+            AZ::IO::FileIOBase::SetInstance(&m_fileIO);
+
+            m_path.InitFromRelativePath("TestPath");
+            m_coalescer = AZStd::make_unique<ReadCoalescer>(MergeWindow, MaxMergedReadSize, MaxNumMergedReads, AZCORE_GLOBAL_NEW_ALIGNMENT);
+            m_coalescer->SetNext(m_mock);
+            EXPECT_CALL(*m_mock, SetContext(_));
+            m_coalescer->SetContext(m_context);
+            ON_CALL(*m_mock, ExecuteRequests()).WillByDefault(::testing::Return(false));
+        }
+
+        void TearDown() override
+        {
+            m_coalescer.reset();
+            AZ::IO::FileIOBase::SetInstance(m_prevFileIO);
+        }
+
+        FileRequest* QueueRead(u8* output, u64 offset, u64 size, IStreamerTypes::RequestStatus* status = nullptr)
+        {
+            FileRequest* request = m_context.GetNewInternalRequest();
+            request->CreateRead(nullptr, output, size, m_path, offset, size);
+            if (status)
+            {
+                // The request is recycled after completing, so record the status it completed with.
+                request->SetCompletionCallback([status](FileRequest& request) { *status = request.GetStatus(); });
+            }
+            m_coalescer->QueueRequest(request);
+            return request;
+        }
+
+        // Fills the output of a read the next entry received as if it was read from a file where every byte
+        // contains the lower 8 bits of its offset.
+        static void FillRead(FileRequest* request)
+        {
+            auto data = AZStd::get_if<FileRequest::ReadData>(&request->GetCommand());
+            ASSERT_NE(nullptr, data);
+            u8* output = reinterpret_cast<u8*>(data->m_output);
+            for (u64 i = 0; i < data->m_size; ++i)
+            {
+                output[i] = static_cast<u8>(data->m_offset + i);
+            }
+        }
+
+        static void VerifyOutput(const u8* output, u64 offset, u64 size)
+        {
+            for (u64 i = 0; i < size; ++i)
+            {
+                ASSERT_EQ(static_cast<u8>(offset + i), output[i]);
+            }
+        }
+
+    protected:
+        UnitTest::TestFileIOBase m_fileIO;
+        FileIOBase* m_prevFileIO{};
+        StreamerContext m_context;
+        RequestPath m_path;
+        AZStd::unique_ptr<ReadCoalescer> m_coalescer;
+        AZStd::shared_ptr<StreamStackEntryMock> m_mock;
+    };
+
+    TEST_F(Streamer_ReadCoalescerTest, ExecuteRequests_SingleRead_RequestIsForwarded)
+    {
+        using ::testing::_;
+
+        u8 buffer[64];
+        FileRequest* readRequest = QueueRead(buffer, 0, sizeof(buffer));
+
+        EXPECT_CALL(*m_mock, QueueRequest(readRequest)).Times(1);
+        EXPECT_CALL(*m_mock, ExecuteRequests()).Times(1);
+        EXPECT_TRUE(m_coalescer->ExecuteRequests());
+
+        m_context.RecycleRequest(readRequest);
+    }
+
+    TEST_F(Streamer_ReadCoalescerTest, ExecuteRequests_ContiguousAndNearbyReads_MergedIntoOneRead)
+    {
+        using ::testing::_;
+
+        constexpr u64 readSize = 256;
+        AZStd::vector<u8> buffers[3] = { AZStd::vector<u8>(readSize), AZStd::vector<u8>(readSize), AZStd::vector<u8>(readSize) };
+        // Queued out of order, with a gap smaller than the merge window between the second and third read.
+        const u64 offsets[3] = { readSize, 0, 2 * readSize + MergeWindow / 2 };
+        IStreamerTypes::RequestStatus statuses[3] = { IStreamerTypes::RequestStatus::Pending,
+            IStreamerTypes::RequestStatus::Pending, IStreamerTypes::RequestStatus::Pending };
+        for (size_t i = 0; i < 3; ++i)
+        {
+            QueueRead(buffers[i].data(), offsets[i], readSize, &statuses[i]);
+        }
+
+        FileRequest* mergedRead = nullptr;
+        EXPECT_CALL(*m_mock, QueueRequest(_)).WillOnce([&mergedRead](FileRequest* request) { mergedRead = request; });
+        EXPECT_CALL(*m_mock, ExecuteRequests()).Times(1);
+        m_coalescer->ExecuteRequests();
+
+        ASSERT_NE(nullptr, mergedRead);
+        EXPECT_EQ(nullptr, mergedRead->GetParent());
+        auto data = AZStd::get_if<FileRequest::ReadData>(&mergedRead->GetCommand());
+        ASSERT_NE(nullptr, data);
+        EXPECT_EQ(0, data->m_offset);
+        EXPECT_EQ(offsets[2] + readSize, data->m_size);
+        EXPECT_EQ(m_path, data->m_path);
+
+        FillRead(mergedRead);
+        mergedRead->SetStatus(IStreamerTypes::RequestStatus::Completed);
+        m_context.MarkRequestAsCompleted(mergedRead);
+        m_context.FinalizeCompletedRequests();
+
+        for (size_t i = 0; i < 3; ++i)
+        {
+            EXPECT_EQ(IStreamerTypes::RequestStatus::Completed, statuses[i]);
+            VerifyOutput(buffers[i].data(), offsets[i], readSize);
+        }
+    }
+
+    TEST_F(Streamer_ReadCoalescerTest, ExecuteRequests_ReadsOutsideMergeWindow_ReadsAreForwardedSeparately)
+    {
+        using ::testing::_;
+
+        u8 buffer0[64];
+        u8 buffer1[64];
+        FileRequest* readRequest0 = QueueRead(buffer0, 0, sizeof(buffer0));
+        FileRequest* readRequest1 = QueueRead(buffer1, sizeof(buffer0) + MergeWindow + 1, sizeof(buffer1));
+
+        EXPECT_CALL(*m_mock, QueueRequest(readRequest0)).Times(1);
+        EXPECT_CALL(*m_mock, QueueRequest(readRequest1)).Times(1);
+        EXPECT_CALL(*m_mock, ExecuteRequests()).Times(1);
+        m_coalescer->ExecuteRequests();
+
+        m_context.RecycleRequest(readRequest0);
+        m_context.RecycleRequest(readRequest1);
+    }
+
+    TEST_F(Streamer_ReadCoalescerTest, ExecuteRequests_MoreReadsThanMergeLimit_ReadsSplitOverMultipleMerges)
+    {
+        using ::testing::_;
+
+        constexpr size_t numReads = MaxNumMergedReads + 2;
+        constexpr u64 readSize = 128;
+        u8 buffer[numReads * readSize];
+        for (size_t i = 0; i < numReads; ++i)
+        {
+            QueueRead(buffer + i * readSize, i * readSize, readSize);
+        }
+
+        AZStd::vector<FileRequest*> mergedReads;
+        EXPECT_CALL(*m_mock, QueueRequest(_))
+            .Times(2)
+            .WillRepeatedly([&mergedReads](FileRequest* request) { mergedReads.push_back(request); });
+        EXPECT_CALL(*m_mock, ExecuteRequests()).Times(1);
+        m_coalescer->ExecuteRequests();
+
+        ASSERT_EQ(2, mergedReads.size());
+        EXPECT_EQ(MaxNumMergedReads * readSize, AZStd::get<FileRequest::ReadData>(mergedReads[0]->GetCommand()).m_size);
+        EXPECT_EQ(2 * readSize, AZStd::get<FileRequest::ReadData>(mergedReads[1]->GetCommand()).m_size);
+
+        for (FileRequest* mergedRead : mergedReads)
+        {
+            FillRead(mergedRead);
+            mergedRead->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context.MarkRequestAsCompleted(mergedRead);
+        }
+        m_context.FinalizeCompletedRequests();
+        VerifyOutput(buffer, 0, sizeof(buffer));
+    }
+
+    TEST_F(Streamer_ReadCoalescerTest, ExecuteRequests_MergedReadFails_AllReadsFail)
+    {
+        using ::testing::_;
+
+        u8 buffer0[64];
+        u8 buffer1[64];
+        IStreamerTypes::RequestStatus status0 = IStreamerTypes::RequestStatus::Pending;
+        IStreamerTypes::RequestStatus status1 = IStreamerTypes::RequestStatus::Pending;
+        QueueRead(buffer0, 0, sizeof(buffer0), &status0);
+        QueueRead(buffer1, sizeof(buffer0), sizeof(buffer1), &status1);
+
+        FileRequest* mergedRead = nullptr;
+        EXPECT_CALL(*m_mock, QueueRequest(_)).WillOnce([&mergedRead](FileRequest* request) { mergedRead = request; });
+        EXPECT_CALL(*m_mock, ExecuteRequests()).Times(1);
+        m_coalescer->ExecuteRequests();
+
+        ASSERT_NE(nullptr, mergedRead);
+        mergedRead->SetStatus(IStreamerTypes::RequestStatus::Failed);
+        m_context.MarkRequestAsCompleted(mergedRead);
+        m_context.FinalizeCompletedRequests();
+
+        EXPECT_EQ(IStreamerTypes::RequestStatus::Failed, status0);
+        EXPECT_EQ(IStreamerTypes::RequestStatus::Failed, status1);
+    }
+
+    TEST_F(Streamer_ReadCoalescerTest, UpdateStatus_ReadsHeld_NotIdleAndSlotsReduced)
+    {
+        using ::testing::_;
+
+        EXPECT_CALL(*m_mock, UpdateStatus(_)).Times(2);
+
+        u8 buffer[64];
+        FileRequest* readRequest = QueueRead(buffer, 0, sizeof(buffer));
+
+        StreamStackEntry::Status status;
+        m_coalescer->UpdateStatus(status);
+        EXPECT_FALSE(status.m_isIdle);
+        EXPECT_EQ(MaxNumMergedReads - 1, status.m_numAvailableSlots);
+
+        EXPECT_CALL(*m_mock, QueueRequest(readRequest)).Times(1);
+        EXPECT_CALL(*m_mock, ExecuteRequests()).Times(1);
+        m_coalescer->ExecuteRequests();
+
+        status = StreamStackEntry::Status{};
+        m_coalescer->UpdateStatus(status);
+        EXPECT_TRUE(status.m_isIdle);
+
+        m_context.RecycleRequest(readRequest);
+    }
+} // namespace AZ::IO
@@ -12,6 +12,9 @@
 #include <AzCore/IO/Streamer/Streamer.h>
 #include <AzCore/IO/Streamer/StreamerComponent.h>
 #include <AzCore/IO/Streamer/StreamerConfiguration.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManager.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/binary_semaphore.h>
@@ -604,6 +607,46 @@ namespace AZ
             EXPECT_TRUE(readSuccessful);
         }
 
+        // Start a job that depends on a request before the request can complete, then resume to see if the job runs after the read.
+        TYPED_TEST_P(StreamerTest, SetRequestCompleteDependent_JobStartedBeforeReadCompletes_JobRunsAfterRead)
+        {
+            constexpr size_t fileSize = 50_kib;
+            auto testFile = this->CreateTestFile(fileSize, PadArchive::No);
+
+            JobManagerDesc jobManagerDesc;
+            jobManagerDesc.m_workerThreads.push_back(JobManagerThreadDesc());
+            JobManager jobManager(jobManagerDesc);
+            JobContext jobContext(jobManager);
+
+            AZStd::binary_semaphore sync;
+            AZStd::atomic_bool jobHasRun = false;
+            AZStd::atomic_bool readSuccessful = false;
+
+            char buffer[fileSize];
+            FileRequestPtr request = this->m_streamer->Read(testFile->GetFileName(), buffer, fileSize, fileSize);
+            Job* job = CreateJobFunction([&jobHasRun, &readSuccessful, &sync, &request]()
+                {
+                    readSuccessful = AZ::Interface<IStreamer>::Get()->GetRequestStatus(request) == IStreamerTypes::RequestStatus::Completed;
+                    jobHasRun = true;
+                    sync.release();
+                }, true, &jobContext);
+            this->m_streamer->SetRequestCompleteDependent(request, *job);
+
+            this->m_streamer->SuspendProcessing();
+            this->m_streamer->QueueRequest(request);
+            job->Start();
+
+            // Sleep for a short while to give the job a chance to run if it doesn't wait for the request.
+            AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(250));
+            EXPECT_FALSE(jobHasRun);
+
+            this->m_streamer->ResumeProcessing();
+            bool hasTimedOut = !sync.try_acquire_for(AZStd::chrono::seconds(5));
+            ASSERT_FALSE(hasTimedOut);
+            EXPECT_TRUE(readSuccessful);
+            this->VerifyTestFile(buffer, fileSize);
+        }
+
         TYPED_TEST_P(StreamerTest, FlushCaches_FlushAfterEveryRead_FilesAreReadCorrectly)
         {
             constexpr size_t fileSize = 4_mib;
@@ -665,6 +708,7 @@ namespace AZ
             Read_ReadMultiplePieces_AllReadRequestWereSuccessful,
             Read_ReadMultiplePiecesWithBatch_AllReadRequestWereSuccessful,
             SuspendProcessing_SuspendWhileFileIsQueued_FileIsNotReadUntilProcessingIsRestarted,
+            SetRequestCompleteDependent_JobStartedBeforeReadCompletes_JobRunsAfterRead,
             FlushCaches_FlushAfterEveryRead_FilesAreReadCorrectly);
 
         using StreamerTestCases = ::testing::Types<GlobalCache_Uncompressed, DedicatedCache_Uncompressed, GlobalCache_Compressed, DedicatedCache_Compressed>;
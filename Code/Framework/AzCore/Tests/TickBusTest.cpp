@@ -5,7 +5,12 @@
  *
  */
 #include <AzCore/Component/TickBus.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
 #include <AzCore/Math/Random.h>
+#include <AzCore/Memory/PoolAllocator.h>
+#include <AzCore/std/containers/list.h>
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/sort.h>
 #include <AzCore/UnitTest/TestTypes.h>
 
@@ -65,3 +70,144 @@ TEST_F(OrderedTickBus, OnTick_HandlersFireInSortedOrder)
     // check the order they actually fired in
     EXPECT_EQ(actualTickOrder, sortedOrder);
 }
+
+// TickBus handler that opts in to parallel ticking and counts how often it was ticked.
+struct ThreadSafeTicker : public TickBus::Handler
+{
+    int m_order = TICK_DEFAULT;
+    AZStd::atomic_int* m_tickCount = nullptr;
+
+    int GetTickOrder() override { return m_order; }
+    bool IsTickThreadSafe() override { return true; }
+
+    void OnTick(float /*deltaTime*/, ScriptTimePoint /*time*/) override
+    {
+        m_tickCount->fetch_add(1);
+    }
+};
+
+// TickBus handler that records how many thread-safe handlers had been ticked when it was ticked.
+struct SerialTicker : public TickBus::Handler
+{
+    int m_order = TICK_DEFAULT;
+    AZStd::atomic_int* m_tickCount = nullptr;
+    int m_tickCountWhenTicked = -1;
+
+    int GetTickOrder() override { return m_order; }
+
+    void OnTick(float /*deltaTime*/, ScriptTimePoint /*time*/) override
+    {
+        m_tickCountWhenTicked = m_tickCount->load();
+    }
+};
+
+class ParallelTickBus : public UnitTest::AllocatorsFixture
+{
+public:
+    void SetUp() override
+    {
+        UnitTest::AllocatorsFixture::SetUp();
+        AllocatorInstance<PoolAllocator>::Create();
+        AllocatorInstance<ThreadPoolAllocator>::Create();
+
+        JobManagerDesc jobDesc;
+        JobManagerThreadDesc threadDesc;
+        for (int i = 0; i < 4; ++i)
+        {
+            jobDesc.m_workerThreads.push_back(threadDesc);
+        }
+        m_jobManager = aznew JobManager(jobDesc);
+        m_jobContext = aznew JobContext(*m_jobManager);
+        JobContext::SetGlobalContext(m_jobContext);
+    }
+
+    void TearDown() override
+    {
+        JobContext::SetGlobalContext(nullptr);
+        delete m_jobContext;
+        delete m_jobManager;
+
+        AllocatorInstance<ThreadPoolAllocator>::Destroy();
+        AllocatorInstance<PoolAllocator>::Destroy();
+        UnitTest::AllocatorsFixture::TearDown();
+    }
+
+protected:
+    JobManager* m_jobManager = nullptr;
+    JobContext* m_jobContext = nullptr;
+};
+
+TEST_F(ParallelTickBus, TickBusBroadcastOnTick_ThreadSafeHandlers_TickedOnceBetweenSerialHandlers)
+{
+    AZStd::atomic_int tickCount{ 0 };
+
+    SerialTicker first;
+    first.m_order = TICK_FIRST;
+    first.m_tickCount = &tickCount;
+    first.BusConnect();
+
+    SerialTicker last;
+    last.m_order = TICK_LAST;
+    last.m_tickCount = &tickCount;
+    last.BusConnect();
+
+    constexpr int numThreadSafeTickers = 256;
+    AZStd::list<ThreadSafeTicker> tickers;
+    for (int i = 0; i < numThreadSafeTickers; ++i)
+    {
+        tickers.push_back();
+        ThreadSafeTicker& ticker = tickers.back();
+        ticker.m_tickCount = &tickCount;
+        ticker.BusConnect();
+    }
+
+    TickBusBroadcastOnTick(0.f, ScriptTimePoint{});
+
+    EXPECT_EQ(numThreadSafeTickers, tickCount.load());
+    EXPECT_EQ(0, first.m_tickCountWhenTicked);
+    EXPECT_EQ(numThreadSafeTickers, last.m_tickCountWhenTicked);
+
+    for (ThreadSafeTicker& ticker : tickers)
+    {
+        ticker.BusDisconnect();
+    }
+    first.BusDisconnect();
+    last.BusDisconnect();
+}
+
+TEST_F(ParallelTickBus, TickBusBroadcastOnTick_SerialHandlerInBucket_KeepsOrderWithThreadSafeHandlers)
+{
+    AZStd::atomic_int tickCount{ 0 };
+
+    // Serial handlers with the same tick order as the thread-safe handlers split them into separate parallel batches.
+    AZStd::list<ThreadSafeTicker> tickers;
+    AZStd::list<SerialTicker> serialTickers;
+    for (int i = 0; i < 8; ++i)
+    {
+        tickers.push_back();
+        tickers.back().m_tickCount = &tickCount;
+        tickers.back().BusConnect();
+        tickers.push_back();
+        tickers.back().m_tickCount = &tickCount;
+        tickers.back().BusConnect();
+
+        serialTickers.push_back();
+        serialTickers.back().m_tickCount = &tickCount;
+        serialTickers.back().BusConnect();
+    }
+
+    TickBusBroadcastOnTick(0.f, ScriptTimePoint{});
+
+    EXPECT_EQ(16, tickCount.load());
+    int expectedTickCount = 2;
+    for (SerialTicker& ticker : serialTickers)
+    {
+        EXPECT_EQ(expectedTickCount, ticker.m_tickCountWhenTicked);
+        expectedTickCount += 2;
+        ticker.BusDisconnect();
+    }
+    for (ThreadSafeTicker& ticker : tickers)
+    {
+        ticker.BusDisconnect();
+    }
+}
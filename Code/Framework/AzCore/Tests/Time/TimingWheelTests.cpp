@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Time/TimingWheel.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    using TimingWheelTests = AllocatorsFixture;
+
+    TEST_F(TimingWheelTests, PopExpired_ReturnsValuesInDeadlineOrder)
+    {
+        AZ::TimingWheel<int> wheel;
+        wheel.Insert(3, AZ::TimeMs{ 70000 });
+        wheel.Insert(1, AZ::TimeMs{ 10 });
+        wheel.Insert(4, AZ::TimeMs{ 20000000 });
+        wheel.Insert(2, AZ::TimeMs{ 300 });
+        wheel.Insert(5, AZ::TimeMs{ 6000000000 });
+        EXPECT_EQ(5u, wheel.GetSize());
+
+        int value = 0;
+        EXPECT_FALSE(wheel.PopExpired(AZ::TimeMs{ 9 }, value));
+        for (int expected = 1; expected <= 5; ++expected)
+        {
+            EXPECT_TRUE(wheel.PopExpired(AZ::TimeMs{ 6000000000 }, value));
+            EXPECT_EQ(expected, value);
+        }
+        EXPECT_FALSE(wheel.PopExpired(AZ::TimeMs{ 6000000000 }, value));
+        EXPECT_TRUE(wheel.IsEmpty());
+    }
+
+    TEST_F(TimingWheelTests, PopExpired_SameDeadline_ReturnsValuesInInsertionOrder)
+    {
+        AZ::TimingWheel<int> wheel;
+        for (int value = 0; value < 4; ++value)
+        {
+            wheel.Insert(value, AZ::TimeMs{ 1000 });
+        }
+
+        int value = -1;
+        for (int expected = 0; expected < 4; ++expected)
+        {
+            EXPECT_TRUE(wheel.PopExpired(AZ::TimeMs{ 1000 }, value));
+            EXPECT_EQ(expected, value);
+        }
+    }
+
+    TEST_F(TimingWheelTests, Insert_DeadlineAlreadyPassed_ExpiresOnNextPop)
+    {
+        AZ::TimingWheel<int> wheel(AZ::TimeMs{ 500 });
+        int value = 0;
+        EXPECT_FALSE(wheel.PopExpired(AZ::TimeMs{ 600 }, value));
+
+        wheel.Insert(7, AZ::TimeMs{ 100 });
+        EXPECT_TRUE(wheel.HasExpired(AZ::TimeMs{ 600 }));
+        EXPECT_TRUE(wheel.PopExpired(AZ::TimeMs{ 600 }, value));
+        EXPECT_EQ(7, value);
+    }
+
+    TEST_F(TimingWheelTests, Remove_RemovedValueIsNeverPopped)
+    {
+        AZ::TimingWheel<int> wheel;
+        wheel.Insert(1, AZ::TimeMs{ 5 });
+        const AZ::TimingWheel<int>::Id removedId = wheel.Insert(2, AZ::TimeMs{ 100000 });
+        wheel.Insert(3, AZ::TimeMs{ 200000 });
+        EXPECT_EQ(2, wheel.GetValue(removedId));
+        EXPECT_EQ(AZ::TimeMs{ 100000 }, wheel.GetDeadline(removedId));
+
+        wheel.Remove(removedId);
+        EXPECT_EQ(2u, wheel.GetSize());
+
+        int value = 0;
+        EXPECT_TRUE(wheel.PopExpired(AZ::TimeMs{ 300000 }, value));
+        EXPECT_EQ(1, value);
+        EXPECT_TRUE(wheel.PopExpired(AZ::TimeMs{ 300000 }, value));
+        EXPECT_EQ(3, value);
+        EXPECT_FALSE(wheel.PopExpired(AZ::TimeMs{ 300000 }, value));
+    }
+
+    TEST_F(TimingWheelTests, PopExpired_SmallTimeSteps_ExpiresEachValueAtItsDeadline)
+    {
+        AZ::TimingWheel<int> wheel;
+        constexpr int ValueCount = 2000;
+        for (int value = 0; value < ValueCount; ++value)
+        {
+            // Spread over several rotations of the first two levels
+            wheel.Insert(value, AZ::TimeMs{ (value * 7919) % 100000 });
+        }
+
+        int popped = 0;
+        for (int64_t timeMs = 0; timeMs < 100000; timeMs += 16)
+        {
+            int value = 0;
+            while (wheel.PopExpired(AZ::TimeMs{ timeMs }, value))
+            {
+                const int64_t deadline = (value * 7919) % 100000;
+                EXPECT_LE(deadline, timeMs);
+                EXPECT_GT(deadline, timeMs - 16);
+                ++popped;
+            }
+        }
+        EXPECT_EQ(ValueCount, popped);
+    }
+}
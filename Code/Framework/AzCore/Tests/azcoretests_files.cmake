@@ -66,6 +66,7 @@ set(FILES
     SystemFile.cpp
     TickBusTest.cpp
     TimeDataStatistics.cpp
+    Time/TimingWheelTests.cpp
     UUIDTests.cpp
     XML.cpp
     Debug/AssetTracking.cpp
@@ -84,6 +85,7 @@ set(FILES
     Streamer/FullDecompressorTests.cpp
     Streamer/IStreamerMock.h
     Streamer/IStreamerTypesMock.h
+    Streamer/ReadCoalescerTests.cpp
     Streamer/ReadSplitterTests.cpp
     Streamer/SchedulerTests.cpp
     Streamer/StreamStackEntryConformityTests.h
@@ -153,6 +155,8 @@ set(FILES
     Math/ShapeIntersectionPerformanceTests.cpp
     Math/ShapeIntersectionTests.cpp
     Math/SfmtTests.cpp
+    Math/SimdBatchPerformanceTests.cpp
+    Math/SimdBatchTests.cpp
     Math/SimdMathTests.cpp
     Math/SphereTests.cpp
     Math/SplineTests.cpp
@@ -160,15 +164,21 @@ set(FILES
     Math/TransformTests.cpp
     Math/Vector2PerformanceTests.cpp
     Math/Vector2Tests.cpp
+    Math/Vector3BatchTests.cpp
     Math/Vector3PerformanceTests.cpp
     Math/Vector3Tests.cpp
     Math/Vector4PerformanceTests.cpp
     Math/Vector4Tests.cpp
+    Math/XxHash64Tests.cpp
+    Memory/AllocationRecords.cpp
     Memory/AllocatorManager.cpp
     Memory/HphaSchema.cpp
     Memory/HphaSchemaErrorDetection.cpp
     Memory/LeakDetection.cpp
+    Memory/LinearAllocator.cpp
     Memory/MallocSchema.cpp
+    Memory/MemoryBudgetTracker.cpp
+    Memory/PoolSchema.cpp
     AZStd/Algorithms.cpp
     AZStd/Allocators.cpp
     AZStd/Atomics.cpp
@@ -199,6 +209,7 @@ set(FILES
     AZStd/ScopedLockTests.cpp
     AZStd/SetsIntrusive.cpp
     AZStd/SmartPtr.cpp
+    AZStd/Span.cpp
     AZStd/String.cpp
     AZStd/TypeTraits.cpp
     AZStd/Tuple.cpp
@@ -18,7 +18,10 @@
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Serialization/Utils.h>
 #include <AzCore/NativeUI/NativeUIRequests.h>
+#include <AzCore/std/containers/array.h>
 #include <AzCore/std/functional.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/std/string/conversions.h>
 #include <AzCore/std/string/wildcard.h>
 #include <AzCore/std/sort.h>
@@ -54,6 +57,9 @@ namespace AZ::IO
     AZ_CVAR(int32_t, az_archive_verbosity, 0, nullptr, AZ::ConsoleFunctorFlags::Null,
         "Sets the verbosity level for logging Archive operations\n"
         ">=1 - Turns on verbose logging of all operations");
+    AZ_CVAR(bool, sys_PakMemoryMapped, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "If set, read-only paks opened afterwards are memory mapped and files stored without compression are accessed\n"
+        "directly from the mapping instead of being read into a separate allocation");
 }
 
 namespace AZ::IO::ArchiveInternal
@@ -359,6 +365,165 @@ namespace AZ::IO::ArchiveInternal
         m_nCurSeek += i + 1;
         return c;
     }
+
+    // Table with the pseudo-files opened by the Archive. The pseudo-files are stored in fixed size blocks that are never
+    // moved or freed while the table is alive, so a handle can be turned into its pseudo-file without taking a lock.
+    // Slots are claimed and released through an atomic flag, only adding a new block requires taking a lock.
+    class PseudoFileTable
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(PseudoFileTable, AZ::OSAllocator, 0);
+
+        inline static constexpr size_t BlockSize = 256;
+        inline static constexpr size_t MaxBlocks = 1024;
+        inline static constexpr size_t InvalidIndex = std::numeric_limits<size_t>::max();
+
+        PseudoFileTable() = default;
+        ~PseudoFileTable();
+
+        PseudoFileTable(const PseudoFileTable&) = delete;
+        PseudoFileTable& operator=(const PseudoFileTable&) = delete;
+
+        //! Returns the pseudo-file at the given index or nullptr if the index was never handed out. The slot may not be in use.
+        CZipPseudoFile* Find(size_t index) const;
+        //! Claims a free slot and constructs a pseudo-file for the provided file data in it.
+        //! @return The index of the slot or InvalidIndex if the table is full.
+        size_t Open(CCachedFileData* fileData);
+        //! Destructs the pseudo-file at the given index and makes the slot available again.
+        //! @return False if the index doesn't belong to the table, otherwise true.
+        bool Close(size_t index);
+        //! Closes all pseudo-files that are still open and returns the number of files that were closed.
+        uint32_t CloseAll();
+
+    private:
+        struct Slot
+        {
+            CZipPseudoFile m_file;
+            AZStd::atomic_bool m_inUse{ false };
+        };
+
+        struct Block
+        {
+            AZ_CLASS_ALLOCATOR(Block, AZ::OSAllocator, 0);
+            AZStd::array<Slot, BlockSize> m_slots;
+        };
+
+        size_t Claim(size_t numBlocks);
+
+        AZStd::array<AZStd::atomic<Block*>, MaxBlocks> m_blocks{};
+        AZStd::atomic<size_t> m_numBlocks{ 0 };
+        // The slot after the most recently claimed one, used as the start of the search for a free slot.
+        AZStd::atomic<size_t> m_searchStart{ 0 };
+        AZStd::mutex m_growMutex;
+    };
+
+    PseudoFileTable::~PseudoFileTable()
+    {
+        CloseAll();
+        size_t numBlocks = m_numBlocks.load(AZStd::memory_order_acquire);
+        for (size_t i = 0; i < numBlocks; ++i)
+        {
+            delete m_blocks[i].load(AZStd::memory_order_relaxed);
+        }
+    }
+
+    CZipPseudoFile* PseudoFileTable::Find(size_t index) const
+    {
+        size_t blockIndex = index / BlockSize;
+        if (blockIndex < m_numBlocks.load(AZStd::memory_order_acquire))
+        {
+            return &m_blocks[blockIndex].load(AZStd::memory_order_relaxed)->m_slots[index % BlockSize].m_file;
+        }
+        return nullptr;
+    }
+
+    size_t PseudoFileTable::Claim(size_t numBlocks)
+    {
+        const size_t numSlots = numBlocks * BlockSize;
+        const size_t searchStart = m_searchStart.load(AZStd::memory_order_relaxed);
+        for (size_t i = 0; i < numSlots; ++i)
+        {
+            size_t index = (searchStart + i) % numSlots;
+            Slot& slot = m_blocks[index / BlockSize].load(AZStd::memory_order_relaxed)->m_slots[index % BlockSize];
+            bool expected = false;
+            if (!slot.m_inUse.load(AZStd::memory_order_relaxed) &&
+                slot.m_inUse.compare_exchange_strong(expected, true, AZStd::memory_order_acquire))
+            {
+                m_searchStart.store(index + 1, AZStd::memory_order_relaxed);
+                return index;
+            }
+        }
+        return InvalidIndex;
+    }
+
+    size_t PseudoFileTable::Open(CCachedFileData* fileData)
+    {
+        size_t numBlocks = m_numBlocks.load(AZStd::memory_order_acquire);
+        size_t index = Claim(numBlocks);
+        while (index == InvalidIndex)
+        {
+            // All slots are taken, add a new block unless another thread already did so.
+            AZStd::scoped_lock lock(m_growMutex);
+            size_t currentNumBlocks = m_numBlocks.load(AZStd::memory_order_acquire);
+            if (currentNumBlocks == numBlocks)
+            {
+                if (numBlocks == MaxBlocks)
+                {
+                    return InvalidIndex;
+                }
+                Block* block = new Block;
+                // Claim the first slot before the block becomes visible to other threads.
+                block->m_slots[0].m_inUse.store(true, AZStd::memory_order_relaxed);
+                m_blocks[numBlocks].store(block, AZStd::memory_order_relaxed);
+                m_numBlocks.store(numBlocks + 1, AZStd::memory_order_release);
+                index = numBlocks * BlockSize;
+                m_searchStart.store(index + 1, AZStd::memory_order_relaxed);
+            }
+            else
+            {
+                numBlocks = currentNumBlocks;
+                index = Claim(numBlocks);
+            }
+        }
+
+        Find(index)->Construct(fileData);
+        return index;
+    }
+
+    bool PseudoFileTable::Close(size_t index)
+    {
+        size_t blockIndex = index / BlockSize;
+        if (blockIndex >= m_numBlocks.load(AZStd::memory_order_acquire))
+        {
+            return false;
+        }
+        Slot& slot = m_blocks[blockIndex].load(AZStd::memory_order_relaxed)->m_slots[index % BlockSize];
+        if (slot.m_inUse.load(AZStd::memory_order_acquire))
+        {
+            slot.m_file.Destruct();
+            slot.m_inUse.store(false, AZStd::memory_order_release);
+        }
+        return true;
+    }
+
+    uint32_t PseudoFileTable::CloseAll()
+    {
+        uint32_t numClosed = 0;
+        size_t numBlocks = m_numBlocks.load(AZStd::memory_order_acquire);
+        for (size_t blockIndex = 0; blockIndex < numBlocks; ++blockIndex)
+        {
+            for (Slot& slot : m_blocks[blockIndex].load(AZStd::memory_order_relaxed)->m_slots)
+            {
+                if (slot.m_inUse.load(AZStd::memory_order_acquire) && slot.m_file.GetFile())
+                {
+                    slot.m_file.Destruct();
+                    slot.m_inUse.store(false, AZStd::memory_order_release);
+                    ++numClosed;
+                }
+            }
+        }
+        return numClosed;
+    }
 }
 
 namespace AZ::IO
@@ -501,6 +666,8 @@ namespace AZ::IO
         , m_pLevelResourceList{ new CResourceList{} }
         , m_pNextLevelResourceList{ new CResourceList{} }
         , m_mainThreadId{ AZStd::this_thread::get_id() }
+        , m_openFiles{ AZStd::make_unique<ArchiveInternal::PseudoFileTable>() }
+        , m_zips{ AZStd::allocate_shared<ZipArray>(AZ::OSStdAllocator()) }
     {
     }
 
@@ -509,23 +676,14 @@ namespace AZ::IO
     {
         Release();
 
-        m_arrZips = {};
-
-        uint32_t numFilesForcedToClose = 0;
-        // scan through all open files and close them
         {
-            AZStd::unique_lock lock(m_csOpenFiles);
-            for (ZipPseudoFileArray::iterator itFile = m_arrOpenFiles.begin(); itFile != m_arrOpenFiles.end(); ++itFile)
-            {
-                if ((*itFile)->GetFile())
-                {
-                    (*itFile)->Destruct();
-                    ++numFilesForcedToClose;
-                }
-            }
-            m_arrOpenFiles = {};
+            AZStd::scoped_lock writeLock(m_csZipsWrite);
+            PublishZips(AZStd::allocate_shared<ZipArray>(AZ::OSStdAllocator()));
         }
 
+        // scan through all open files and close them
+        [[maybe_unused]] uint32_t numFilesForcedToClose = m_openFiles->CloseAll();
+
         AZ_Warning("Archive", numFilesForcedToClose == 0, "%u files were forced to close", numFilesForcedToClose);
 
         AZ_Error("Archive", m_arrArchives.empty(), "There are %zu external references to archive objects: they have dangling pointers and will either lead to memory leaks or crashes", m_arrArchives.size());
@@ -802,21 +960,13 @@ namespace AZ::IO
         }
 
         // try to open the pseudofile from one of the zips, make sure there is no user alias
-        AZStd::unique_lock lock(m_csOpenFiles);
-
-        size_t nFile;
         // find the empty slot and open the file there; return the handle
+        size_t nFile = m_openFiles->Open(pFileData.get());
+        if (nFile == ArchiveInternal::PseudoFileTable::InvalidIndex)
         {
-            for (nFile = 0; nFile < m_arrOpenFiles.size() && m_arrOpenFiles[nFile]->GetFile(); ++nFile)
-            {
-                continue;
-            }
-            if (nFile == m_arrOpenFiles.size())
-            {
-                m_arrOpenFiles.emplace_back(AZStd::make_unique<ArchiveInternal::CZipPseudoFile>());
-            }
-            AZStd::unique_ptr<ArchiveInternal::CZipPseudoFile>& rZipFile = m_arrOpenFiles[nFile];
-            rZipFile->Construct(pFileData.get());
+            AZ_Error("Archive", false, "Unable to open %.*s because the maximum number of open files in archives has been reached",
+                aznumeric_cast<int>(pName.size()), pName.data());
+            return AZ::IO::InvalidHandle;
         }
 
         AZ::IO::HandleType ret = (AZ::IO::HandleType)(nFile + ArchiveInternal::PseudoFileIdxOffset);
@@ -894,9 +1044,9 @@ namespace AZ::IO
         }
 
 
-        AZStd::shared_lock lock(m_csZips);
+        ZipArrayPtr zips = GetZips();
         // scan through registered archive files and try to find this file
-        for (auto itZip = m_arrZips.rbegin(); itZip != m_arrZips.rend(); ++itZip)
+        for (auto itZip = zips->rbegin(); itZip != zips->rend(); ++itZip)
         {
             if (bSkipInMemoryArchives && itZip->pArchive->GetFlags() & INestedArchive::FLAGS_IN_MEMORY_MASK)
             {
@@ -1206,10 +1356,8 @@ namespace AZ::IO
 
         SAutoCollectFileAccessTime accessTime(this);
         auto nPseudoFile = static_cast<size_t>(static_cast<uintptr_t>(fileHandle) - ArchiveInternal::PseudoFileIdxOffset);
-        AZStd::unique_lock lock(m_csOpenFiles);
-        if (nPseudoFile < m_arrOpenFiles.size())
+        if (m_openFiles->Close(nPseudoFile))
         {
-            m_arrOpenFiles[nPseudoFile]->Destruct();
             return 0;
         }
         else
@@ -1432,12 +1580,10 @@ namespace AZ::IO
             }
         }
 
-        // hold the lock from the point we query the zip array,
-        // so we don't end up adding a given archive twice
         {
-            AZStd::unique_lock lock(m_csZips);
             // try to find this - maybe the pack has already been opened
-            for (auto it = m_arrZips.begin(); it != m_arrZips.end(); ++it)
+            ZipArrayPtr zips = GetZips();
+            for (auto it = zips->begin(); it != zips->end(); ++it)
             {
                 const char* pFilePath = it->pZip->GetFilePath();
                 if (pFilePath == desc.strFileName && it->m_pathBindRoot == desc.m_pathBindRoot)
@@ -1491,7 +1637,9 @@ namespace AZ::IO
         AZ_TracePrintf("Archive", "Opening archive file %.*s\n", aznumeric_cast<int>(szFullPath.size()), szFullPath.data());
         desc.pZip = static_cast<NestedArchive*>(desc.pArchive.get())->GetCache();
 
-        AZStd::unique_lock lock(m_csZips);
+        // Searches keep using the current snapshot of the archives, the archive is added to a copy which is published afterwards
+        AZStd::scoped_lock writeLock(m_csZipsWrite);
+        auto zips = AZStd::allocate_shared<ZipArray>(AZ::OSStdAllocator(), *m_zips);
         // Insert the archive lexically but before any override archives
         // This allows us to order the archives allowing the later archives
         // that have priority for same name files. This supports the
@@ -1500,10 +1648,10 @@ namespace AZ::IO
         // sure later archives added to the current set of archives sort higher
         // and therefore get used instead of lower sorted archives
         AZStd::string_view nextBundle;
-        ZipArray::reverse_iterator revItZip = m_arrZips.rbegin();
+        ZipArray::reverse_iterator revItZip = zips->rbegin();
         if ((nArchiveFlags & INestedArchive::FLAGS_OVERRIDE_PAK) == 0)
         {
-            for (; revItZip != m_arrZips.rend(); ++revItZip)
+            for (; revItZip != zips->rend(); ++revItZip)
             {
                 if ((revItZip->pArchive->GetFlags() & INestedArchive::FLAGS_OVERRIDE_PAK) == 0)
                 {
@@ -1529,7 +1677,8 @@ namespace AZ::IO
 
         if (usePrefabSystemForLevels)
         {
-            m_arrZips.insert(revItZip.base(), desc);
+            zips->insert(revItZip.base(), desc);
+            PublishZips(AZStd::move(zips));
         }
         else
         {
@@ -1555,7 +1704,8 @@ namespace AZ::IO
                 desc.m_containsLevelPak = true;
             }
 
-            m_arrZips.insert(revItZip.base(), desc);
+            zips->insert(revItZip.base(), desc);
+            PublishZips(AZStd::move(zips));
 
             m_levelOpenEvent.Signal(levelDirs);
         }
@@ -1584,8 +1734,9 @@ namespace AZ::IO
         AzFramework::ApplicationRequests::Bus::BroadcastResult(
             usePrefabSystemForLevels, &AzFramework::ApplicationRequests::IsPrefabSystemForLevelsEnabled);
 
-        AZStd::unique_lock lock(m_csZips);
-        for (auto it = m_arrZips.begin(); it != m_arrZips.end();)
+        AZStd::scoped_lock writeLock(m_csZipsWrite);
+        auto zips = AZStd::allocate_shared<ZipArray>(AZ::OSStdAllocator(), *m_zips);
+        for (auto it = zips->begin(); it != zips->end();)
         {
             if (azstricmp(szZipPath->c_str(), it->GetFullPath()) == 0)
             {
@@ -1601,7 +1752,7 @@ namespace AZ::IO
 
                 if (usePrefabSystemForLevels)
                 {
-                    it = m_arrZips.erase(it);
+                    it = zips->erase(it);
                 }
                 else
                 {
@@ -1612,7 +1763,7 @@ namespace AZ::IO
                         needRescan = true;
                     }
 
-                    it = m_arrZips.erase(it);
+                    it = zips->erase(it);
 
                     if (needRescan)
                     {
@@ -1625,6 +1776,7 @@ namespace AZ::IO
                 ++it;
             }
         }
+        PublishZips(AZStd::move(zips));
         return true;
     }
 
@@ -1752,13 +1904,22 @@ namespace AZ::IO
     //////////////////////////////////////////////////////////////////////////
     ArchiveInternal::CZipPseudoFile* Archive::GetPseudoFile(AZ::IO::HandleType fileHandle) const
     {
-        AZStd::shared_lock lock(m_csOpenFiles);
         auto nPseudoFile = static_cast<size_t>(static_cast<uintptr_t>(fileHandle) - ArchiveInternal::PseudoFileIdxOffset);
-        if (nPseudoFile < m_arrOpenFiles.size())
-        {
-            return m_arrOpenFiles[nPseudoFile].get();
-        }
-        return nullptr;
+        return m_openFiles->Find(nPseudoFile);
+    }
+
+    auto Archive::GetZips() const -> ZipArrayPtr
+    {
+        AZStd::shared_lock lock(m_csZips);
+        return m_zips;
+    }
+
+    void Archive::PublishZips(ZipArrayPtr zips)
+    {
+        AZStd::unique_lock lock(m_csZips);
+        m_zips.swap(zips);
+        // the previous snapshot is released outside of the lock, it's freed once the last search using it finishes
+        lock.unlock();
     }
 
     //////////////////////////////////////////////////////////////////////////
@@ -1767,6 +1928,7 @@ namespace AZ::IO
     {
         m_nArchiveFlags = nArchiveFlags;
         m_pFileData = nullptr;
+        m_bFileDataMapped = false;
         m_pZip = pZip;
         m_pFileEntry = pFileEntry;
     }
@@ -1774,11 +1936,11 @@ namespace AZ::IO
     CCachedFileData::~CCachedFileData()
     {
         // forced destruction
-        if (m_pFileData)
+        if (m_pFileData && !m_bFileDataMapped)
         {
             AZ::AllocatorInstance<AZ::OSAllocator>::Get().DeAllocate(m_pFileData);
-            m_pFileData = nullptr;
         }
+        m_pFileData = nullptr;
 
         m_pZip = nullptr;
         m_pFileEntry = nullptr;
@@ -1836,6 +1998,15 @@ namespace AZ::IO
             AZStd::scoped_lock lock(m_pFileEntry->m_readLock);
             if (!m_pFileData)
             {
+                // stored files in a memory mapped archive are handed out as a view into the mapping,
+                // which avoids both the allocation and the copy
+                if (void* mappedData = m_pZip->GetMappedFileData(m_pFileEntry))
+                {
+                    m_bFileDataMapped = true;
+                    m_pFileData = mappedData;
+                    return m_pFileData;
+                }
+
                 // don't try to decompress if its not actually compressed
                 decompress = decompress && m_pFileEntry->IsCompressed();
 
@@ -1888,8 +2059,13 @@ namespace AZ::IO
         if (m_pFileEntry->nMethod == ZipFile::METHOD_STORE) //Can't use this technique for METHOD_STORE_AND_STREAMCIPHER_KEYTABLE as seeking with encryption performs poorly
         {
             AZStd::scoped_lock lock(m_pFileEntry->m_readLock);
+            if (auto pMappedData = reinterpret_cast<const uint8_t*>(m_pZip->GetMappedFileData(m_pFileEntry)))
+            {
+                // Uncompressed read straight from the memory mapped archive.
+                memcpy(pBuffer, pMappedData + nFileOffset, (size_t)nReadSize);
+            }
             // Uncompressed read.
-            if (ZipDir::ZD_ERROR_SUCCESS != m_pZip->ReadFile(m_pFileEntry, nullptr, pBuffer))
+            else if (ZipDir::ZD_ERROR_SUCCESS != m_pZip->ReadFile(m_pFileEntry, nullptr, pBuffer))
             {
                 return -1;
             }
@@ -1986,6 +2162,11 @@ namespace AZ::IO
         if (nFlags & INestedArchive::FLAGS_READ_ONLY)
         {
             nFactoryFlags |= ZipDir::CacheFactory::FLAGS_READ_ONLY;
+
+            if (sys_PakMemoryMapped)
+            {
+                nFactoryFlags |= ZipDir::CacheFactory::FLAGS_MEMORY_MAPPED;
+            }
         }
 
         if (nFlags & INestedArchive::FLAGS_INSIDE_PAK)
@@ -2620,8 +2801,8 @@ namespace AZ::IO
             return false;
         }
 
-        AZStd::unique_lock lock(m_csZips);
-        for (auto it = m_arrZips.begin(); it != m_arrZips.end(); ++it)
+        ZipArrayPtr zips = GetZips();
+        for (auto it = zips->begin(); it != zips->end(); ++it)
         {
             if (!azstricmp(szZipPath->c_str(), it->GetFullPath()))
             {
@@ -67,6 +67,8 @@ namespace AZ::IO
         uint32_t GetFileDataOffset();
 
         void* m_pFileData;
+        // true if m_pFileData points into the memory mapped archive instead of an allocation owned by this object
+        bool m_bFileDataMapped;
 
         // the zip file in which this file is opened
         ZipDir::CachePtr m_pZip;
@@ -81,6 +83,7 @@ namespace AZ::IO
     {
         struct CCachedFileRawData;
         struct CZipPseudoFile;
+        class PseudoFileTable;
     };
 
     //////////////////////////////////////////////////////////////////////
@@ -97,11 +100,6 @@ namespace AZ::IO
         friend class NestedArchive;
         friend struct SAutoCollectFileAccessTime;
 
-        // the array of pseudo-files : emulated files in the virtual zip file system
-        // the handle to the file is its index inside this array.
-        // some of the entries can be free. The entries need to be destructed manually
-        using ZipPseudoFileArray = AZStd::vector<AZStd::unique_ptr<ArchiveInternal::CZipPseudoFile>, AZ::OSStdAllocator>;
-
         // This is a cached data for the FGetCachedFileData call.
         struct CachedRawDataEntry;
         using CachedFileRawDataSet = AZStd::unordered_map<AZ::IO::HandleType, CachedRawDataEntry, AZStd::hash<AZ::IO::HandleType>, AZStd::equal_to<>, AZ::OSStdAllocator>;
@@ -125,6 +123,9 @@ namespace AZ::IO
             ZipDir::CachePtr pZip;
         };
         using ZipArray = AZStd::vector<PackDesc, AZ::OSStdAllocator>;
+        // The opened archives are published as an immutable snapshot. Opening or closing a pack creates a new copy of the array,
+        // so searches can iterate over the archives without holding a lock while packs are being opened or closed.
+        using ZipArrayPtr = AZStd::shared_ptr<const ZipArray>;
 
         // ArchiveFindDataSet entire purpose is to keep a reference to the intrusive_ptr of ArchiveFindData
         // so that it doesn't go out of scope
@@ -145,6 +146,11 @@ namespace AZ::IO
          */
         ArchiveInternal::CZipPseudoFile* GetPseudoFile(AZ::IO::HandleType fileHandle) const;
 
+        //! Returns the current snapshot of the opened archives. The snapshot keeps the archives in it alive.
+        ZipArrayPtr GetZips() const;
+        //! Replaces the snapshot of the opened archives. Must be called while holding m_csZipsWrite.
+        void PublishZips(ZipArrayPtr zips);
+
     public:
 
         Archive();
@@ -339,8 +345,9 @@ namespace AZ::IO
         // [LYN-2376] Remove once legacy slice support is removed
         AZStd::vector<AZStd::string> ScanForLevels(ZipDir::CachePtr pZip);
 
-        mutable AZStd::shared_mutex m_csOpenFiles;
-        ZipPseudoFileArray m_arrOpenFiles;
+        // the table of pseudo-files : emulated files in the virtual zip file system
+        // the handle to the file is its index inside this table.
+        AZStd::unique_ptr<ArchiveInternal::PseudoFileTable> m_openFiles;
         CachedFileRawDataSet m_cachedFileRawDataSet;
         AZStd::mutex m_cachedFileRawDataMutex;
         // For m_pCachedFileRawDataSet
@@ -351,8 +358,10 @@ namespace AZ::IO
         mutable AZStd::shared_mutex m_archiveMutex;
         ArchiveArray m_arrArchives;
 
+        // m_csZips only guards swapping the snapshot pointer, m_csZipsWrite serializes the functions that modify the archive list.
         mutable AZStd::shared_mutex m_csZips;
-        ZipArray m_arrZips;
+        AZStd::mutex m_csZipsWrite;
+        ZipArrayPtr m_zips;
 
         //////////////////////////////////////////////////////////////////////////
         // Opened files collector.
@@ -184,8 +184,8 @@ namespace AZ::IO
         };
 
         auto archiveInst = static_cast<Archive*>(archive);
-        AZStd::shared_lock lock(archiveInst->m_csZips);
-        for (auto it = archiveInst->m_arrZips.begin(); it != archiveInst->m_arrZips.end(); ++it)
+        Archive::ZipArrayPtr zips = archiveInst->GetZips();
+        for (auto it = zips->begin(); it != zips->end(); ++it)
         {
             // filter out the stuff which does not match.
 
@@ -180,6 +180,7 @@ namespace AZ::IO::ZipDir
                 m_fileHandle = AZ::IO::InvalidHandle;
             }
         }
+        m_mappedFile.Unmap();
         m_allocator = nullptr;
         m_treeDir.Clear();
     }
@@ -711,6 +712,39 @@ namespace AZ::IO::ZipDir
             return nError;
         }
 
+        // the mapped archive can be read without going through the file handle, and compressed data can be
+        // decompressed directly from the mapping without a temporary buffer
+        if (const uint8_t* pMappedData = m_mappedFile.GetData(pFileEntry->nFileDataOffset, pFileEntry->desc.lSizeCompressed))
+        {
+            if (!pCompressed && !pUncompressed)
+            {
+                return ZD_ERROR_INVALID_CALL;
+            }
+
+            if (pCompressed)
+            {
+                memcpy(pCompressed, pMappedData, pFileEntry->desc.lSizeCompressed);
+            }
+
+            if (pUncompressed)
+            {
+                if (pFileEntry->nMethod == 0)
+                {
+                    memcpy(pUncompressed, pMappedData, pFileEntry->desc.lSizeCompressed);
+                }
+                else
+                {
+                    size_t nSizeUncompressed = pFileEntry->desc.lSizeUncompressed;
+                    if (Z_OK != ZipRawUncompress(pUncompressed, &nSizeUncompressed, pMappedData, pFileEntry->desc.lSizeCompressed))
+                    {
+                        return ZD_ERROR_CORRUPTED_DATA;
+                    }
+                }
+            }
+
+            return ZD_ERROR_SUCCESS;
+        }
+
         if (!AZ::IO::FileIOBase::GetDirectInstance()->Seek(m_fileHandle, pFileEntry->nFileDataOffset, AZ::IO::SeekType::SeekFromStart))
         {
             return ZD_ERROR_IO_FAILED;
@@ -763,6 +797,21 @@ namespace AZ::IO::ZipDir
         return ZD_ERROR_SUCCESS;
     }
 
+    void* Cache::GetMappedFileData(FileEntry* pFileEntry)
+    {
+        if (!pFileEntry || !m_mappedFile.IsMapped() || pFileEntry->nMethod != ZipFile::METHOD_STORE)
+        {
+            return nullptr;
+        }
+
+        if (pFileEntry->desc.lSizeUncompressed != pFileEntry->desc.lSizeCompressed || Refresh(pFileEntry) != ZD_ERROR_SUCCESS)
+        {
+            return nullptr;
+        }
+
+        // the mapping is copy-on-write, so handing out a mutable pointer never modifies the archive on disk
+        return const_cast<uint8_t*>(m_mappedFile.GetData(pFileEntry->nFileDataOffset, pFileEntry->desc.lSizeCompressed));
+    }
 
     //////////////////////////////////////////////////////////////////////////
     // finds the file by exact path
@@ -18,6 +18,7 @@
 #include <AzCore/Memory/PoolAllocator.h>
 #include <AzCore/std/smart_ptr/intrusive_base.h>
 #include <AzFramework/Archive/Codec.h>
+#include <AzFramework/Archive/ZipDirMappedFile.h>
 #include <AzFramework/Archive/ZipDirStructures.h>
 #include <AzFramework/Archive/ZipDirTree.h>
 
@@ -80,6 +81,16 @@ namespace AZ::IO::ZipDir
 
         ErrorEnum ReadFile(FileEntry* pFileEntry, void* pCompressed, void* pUncompressed);
 
+        // returns a pointer straight into the memory mapped archive for files that are stored without compression,
+        // or nullptr if the archive isn't memory mapped or the file needs to be decompressed.
+        // The data stays valid for as long as this cache is alive.
+        void* GetMappedFileData(FileEntry* pFileEntry);
+
+        bool IsMemoryMapped() const
+        {
+            return m_mappedFile.IsMapped();
+        }
+
         void Free(void* ptr)
         {
             m_allocator->DeAllocate(ptr);
@@ -133,6 +144,8 @@ namespace AZ::IO::ZipDir
         friend class FileEntryTransactionAdd;
         FileEntryTree m_treeDir;
         AZ::IO::HandleType m_fileHandle;
+        // the archive mapped into memory; only used for read-only archives opened with CacheFactory::FLAGS_MEMORY_MAPPED
+        MappedFile m_mappedFile;
         AZ::IAllocatorAllocate* m_allocator;
         AZStd::string m_strFilePath;
 
@@ -95,6 +95,13 @@ namespace AZ::IO::ZipDir
                 THROW_ZIPDIR_ERROR(ZD_ERROR_IO_FAILED, "Could not read the CDR of the pack file.");
                 return {};
             }
+
+            // archives inside other archives have no OS path that can be mapped
+            if ((m_nFlags & FLAGS_MEMORY_MAPPED) && !(m_nFlags & FLAGS_READ_INSIDE_PAK))
+            {
+                [[maybe_unused]] bool isMapped = pCache->m_mappedFile.Map(szFileName);
+                AZ_Warning("Archive", isMapped, "Unable to memory map archive %s, falling back to file reads.", szFileName);
+            }
         }
         else
         {
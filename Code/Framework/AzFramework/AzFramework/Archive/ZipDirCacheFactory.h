@@ -41,6 +41,10 @@ namespace AZ::IO::ZipDir
 
             // if this is set, zip path will be searched inside other zips
             FLAGS_READ_INSIDE_PAK = 1 << 7,
+
+            // Map read-only archives into memory, so stored (uncompressed) files can be accessed without copying.
+            // Falls back to reading through the file handle if the archive can't be mapped.
+            FLAGS_MEMORY_MAPPED = 1 << 8,
         };
 
         // initializes the internal structures
@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+
+namespace AZ::IO::ZipDir
+{
+    // Read-only view of an entire archive file that's mapped into the address space of the process.
+    // The mapping is copy-on-write, so accidental writes through the returned pointers only change
+    // the pages of this process, never the archive on disk.
+    class MappedFile
+    {
+    public:
+        MappedFile() = default;
+        ~MappedFile();
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        // Maps the file at the given OS path. Returns false if the file couldn't be mapped,
+        // in which case the archive should fall back to reading through file handles.
+        bool Map(const char* filePath);
+        void Unmap();
+
+        bool IsMapped() const
+        {
+            return m_data != nullptr;
+        }
+
+        // Returns a pointer to the mapped data at the given offset, or nullptr if the range
+        // doesn't fit in the mapped file.
+        const uint8_t* GetData(uint64_t offset, uint64_t size) const
+        {
+            return m_data && offset <= m_size && size <= m_size - offset ? m_data + offset : nullptr;
+        }
+
+        uint64_t GetSize() const
+        {
+            return m_size;
+        }
+
+    private:
+        const uint8_t* m_data{};
+        uint64_t m_size{};
+        // Handle to the file mapping object on platforms that need one to keep the view alive.
+        void* m_mappingHandle{};
+    };
+}
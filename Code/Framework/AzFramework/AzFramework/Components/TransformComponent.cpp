@@ -14,6 +14,10 @@
 #include <AzCore/Interface/Interface.h>
 #include <AzCore/Math/Transform.h>
 #include <AzCore/Math/Quaternion.h>
+#include <AzCore/Memory/OSAllocator.h>
+#include <AzCore/Module/Environment.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/sort.h>
 
 namespace AZ
 {
@@ -79,6 +83,46 @@ namespace AZ
 
 namespace AzFramework
 {
+    namespace TransformComponentInternal
+    {
+        struct BatchedChange
+        {
+            TransformComponent* m_transform = nullptr; ///< Reset when the component deactivates before the change is propagated.
+            size_t m_depth = 0; ///< Number of ancestors, used to propagate the changes of parents before the ones of their children.
+        };
+        using BatchedChanges = AZStd::vector<BatchedChange, AZ::OSStdAllocator>;
+
+        //! State of the transform batches. It's shared by all modules so any module can open a batch.
+        struct TransformBatch
+        {
+            int m_depth = 0;
+            bool m_isFlushing = false;
+            BatchedChanges m_changes;
+            BatchedChanges m_flushingChanges;
+        };
+
+        static TransformBatch& GetTransformBatch()
+        {
+            static AZ::EnvironmentVariable<TransformBatch> s_transformBatch;
+            if (!s_transformBatch)
+            {
+                s_transformBatch = AZ::Environment::CreateVariable<TransformBatch>("AzFramework::TransformBatch");
+            }
+            return *s_transformBatch;
+        }
+
+        static void RemoveBatchedChange(BatchedChanges& changes, const TransformComponent* transform)
+        {
+            for (BatchedChange& change : changes)
+            {
+                if (change.m_transform == transform)
+                {
+                    change.m_transform = nullptr;
+                }
+            }
+        }
+    } // namespace TransformComponentInternal
+
     bool TransformComponentVersionConverter(AZ::SerializeContext& context, AZ::SerializeContext::DataElementNode& classElement)
     {
         if (classElement.GetVersion() < 3)
@@ -157,6 +201,12 @@ namespace AzFramework
 
     void TransformComponent::Deactivate()
     {
+        // Components can be destroyed once they are deactivated, so forget about their batched changes.
+        TransformComponentInternal::TransformBatch& batch = TransformComponentInternal::GetTransformBatch();
+        TransformComponentInternal::RemoveBatchedChange(batch.m_changes, this);
+        TransformComponentInternal::RemoveBatchedChange(batch.m_flushingChanges, this);
+        m_hasBatchedChange = false;
+
         EBUS_EVENT_ID(m_parentId, AZ::TransformNotificationBus, OnChildRemoved, GetEntityId());
         auto parentTransform = AZ::TransformBus::FindFirstHandler(m_parentId);
         if (parentTransform)
@@ -598,11 +648,46 @@ namespace AzFramework
     void TransformComponent::SetLocalTMImpl(const AZ::Transform& tm)
     {
         m_localTM = tm;
+        if (IsBatchingTransformChanges())
+        {
+            // The world transform of the parent may still change in this batch, so it will be recomputed when the batch is flushed.
+            if (m_parentTM)
+            {
+                m_worldTM = m_parentTM->GetWorldTM() * m_localTM;
+            }
+            else if (!m_parentActive)
+            {
+                m_worldTM = m_localTM;
+            }
+            MarkBatchedChange();
+            return;
+        }
         ComputeWorldTM();  // We can user dirty flags and compute it later on demand
     }
 
     void TransformComponent::SetWorldTMImpl(const AZ::Transform& tm)
     {
+        if (IsBatchingTransformChanges())
+        {
+            // The local transform is derived from the world transform of the parent, which has to be up to date.
+            if (HasBatchedAncestor())
+            {
+                FlushTransformBatch();
+            }
+
+            m_worldTM = tm;
+            if (m_parentTM)
+            {
+                m_localTM = m_parentTM->GetWorldTM().GetInverse() * m_worldTM;
+            }
+            else if (!m_parentActive)
+            {
+                m_localTM = m_worldTM;
+            }
+            MarkBatchedChange();
+            return;
+        }
+
         m_worldTM = tm;
         ComputeLocalTM(); // We can user dirty flags and compute it later on demand
     }
@@ -613,6 +698,8 @@ namespace AzFramework
         // Ignore the event until we've already derived our local transform.
         if (m_parentTM)
         {
+            // The notification also covers a batched change of this component.
+            m_hasBatchedChange = false;
             m_worldTM = parentWorldTM * m_localTM;
             EBUS_EVENT_PTR(m_notificationBus, AZ::TransformNotificationBus, OnTransformChanged, m_localTM, m_worldTM);
             m_transformChangedEvent.Signal(m_localTM, m_worldTM);
@@ -655,6 +742,112 @@ namespace AzFramework
         m_transformChangedEvent.Signal(m_localTM, m_worldTM);
     }
 
+    void TransformComponent::BeginTransformBatch()
+    {
+        ++TransformComponentInternal::GetTransformBatch().m_depth;
+    }
+
+    void TransformComponent::EndTransformBatch()
+    {
+        TransformComponentInternal::TransformBatch& batch = TransformComponentInternal::GetTransformBatch();
+        AZ_Assert(batch.m_depth > 0, "EndTransformBatch called without a matching BeginTransformBatch.");
+        if (--batch.m_depth == 0)
+        {
+            FlushTransformBatch();
+        }
+    }
+
+    bool TransformComponent::IsBatchingTransformChanges() const
+    {
+        // Inactive components have no observers, so there is nothing to defer.
+        return m_notificationBus && TransformComponentInternal::GetTransformBatch().m_depth > 0;
+    }
+
+    bool TransformComponent::HasBatchedAncestor() const
+    {
+        for (AZ::TransformInterface* parent = m_parentTM; parent; parent = parent->GetParent())
+        {
+            const TransformComponent* parentComponent = azrtti_cast<TransformComponent*>(parent);
+            if (parentComponent && parentComponent->m_hasBatchedChange)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void TransformComponent::MarkBatchedChange()
+    {
+        if (!m_hasBatchedChange)
+        {
+            m_hasBatchedChange = true;
+            TransformComponentInternal::BatchedChange change;
+            change.m_transform = this;
+            TransformComponentInternal::GetTransformBatch().m_changes.push_back(change);
+        }
+    }
+
+    void TransformComponent::SendBatchedChange()
+    {
+        m_hasBatchedChange = false;
+        if (m_parentTM)
+        {
+            m_worldTM = m_parentTM->GetWorldTM() * m_localTM;
+        }
+
+        EBUS_EVENT_PTR(m_notificationBus, AZ::TransformNotificationBus, OnTransformChanged, m_localTM, m_worldTM);
+        m_transformChangedEvent.Signal(m_localTM, m_worldTM);
+
+        AzFramework::IEntityBoundsUnion* boundsUnion = AZ::Interface<AzFramework::IEntityBoundsUnion>::Get();
+        if (boundsUnion != nullptr)
+        {
+            boundsUnion->OnTransformUpdated(GetEntity());
+        }
+    }
+
+    void TransformComponent::FlushTransformBatch()
+    {
+        TransformComponentInternal::TransformBatch& batch = TransformComponentInternal::GetTransformBatch();
+        if (batch.m_isFlushing)
+        {
+            // Changes made by the handlers of the notifications are picked up by the flush in progress.
+            return;
+        }
+
+        batch.m_isFlushing = true;
+        while (!batch.m_changes.empty())
+        {
+            batch.m_flushingChanges.swap(batch.m_changes);
+            for (TransformComponentInternal::BatchedChange& change : batch.m_flushingChanges)
+            {
+                if (change.m_transform)
+                {
+                    for (AZ::TransformInterface* parent = change.m_transform->m_parentTM; parent; parent = parent->GetParent())
+                    {
+                        ++change.m_depth;
+                    }
+                }
+            }
+            AZStd::stable_sort(batch.m_flushingChanges.begin(), batch.m_flushingChanges.end(),
+                [](const TransformComponentInternal::BatchedChange& lhs, const TransformComponentInternal::BatchedChange& rhs)
+                {
+                    return lhs.m_depth < rhs.m_depth;
+                });
+
+            // A change that was already propagated by the notification of an ancestor isn't sent again.
+            for (size_t i = 0; i < batch.m_flushingChanges.size(); ++i)
+            {
+                TransformComponent* transform = batch.m_flushingChanges[i].m_transform;
+                if (transform && transform->m_hasBatchedChange)
+                {
+                    transform->SendBatchedChange();
+                }
+            }
+            batch.m_flushingChanges.clear();
+        }
+        batch.m_isFlushing = false;
+    }
+
     bool TransformComponent::AreMoveRequestsAllowed() const
     {
         // Don't allow static transform to be moved while entity is activated.
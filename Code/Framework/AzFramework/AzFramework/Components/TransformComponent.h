@@ -73,6 +73,15 @@ namespace AzFramework
         //! This will use worldTM as a localTM and move the transform relative to the parent.
         void SetParentRelative(AZ::EntityId id) override;
 
+        //! Opens a transform batch. While a batch is open, changing the local or world transform of an active TransformComponent
+        //! only updates that component. The world transforms of its descendants are updated and the change notifications are sent
+        //! when the outermost batch is closed, parents before children, so every entity is notified at most once per batch no
+        //! matter how many entities of its hierarchy were moved. Until then the world transforms of the descendants of moved
+        //! entities are stale. Batches are not thread-safe and should be opened and closed on the thread that moves the entities.
+        static void BeginTransformBatch();
+        //! Closes a transform batch and propagates the batched changes if it's the outermost batch.
+        static void EndTransformBatch();
+
     protected:
 
         // Component
@@ -158,6 +167,19 @@ namespace AzFramework
         void ComputeWorldTM();
         //////////////////////////////////////////////////////////////////////////
 
+        //! Transform batch support.
+        //! @{
+        //! Returns true if transform changes of this component are deferred to the end of the open transform batch.
+        bool IsBatchingTransformChanges() const;
+        //! Returns true if an ancestor has batched changes that haven't been propagated yet.
+        bool HasBatchedAncestor() const;
+        void MarkBatchedChange();
+        //! Updates the world transform from the parent and sends the notifications of the batched change.
+        void SendBatchedChange();
+        //! Propagates all batched changes in hierarchy order.
+        static void FlushTransformBatch();
+        //! @}
+
         //! Returns whether external calls are currently allowed to move the transform.
         bool AreMoveRequestsAllowed() const;
 
@@ -184,5 +206,24 @@ namespace AzFramework
         bool m_parentActive = false; ///< Keeps track of the state of the parent entity.
         bool m_onNewParentKeepWorldTM = true; ///< If set, recompute localTM instead of worldTM when parent becomes active.
         bool m_isStatic = false; ///< If true, the transform is static and doesn't move while entity is active.
+        bool m_hasBatchedChange = false; ///< If set, the notifications of a change are pending in the open transform batch.
+    };
+
+    //! Keeps a transform batch open for the lifetime of the object. See TransformComponent::BeginTransformBatch.
+    class ScopedTransformBatch
+    {
+    public:
+        ScopedTransformBatch()
+        {
+            TransformComponent::BeginTransformBatch();
+        }
+
+        ~ScopedTransformBatch()
+        {
+            TransformComponent::EndTransformBatch();
+        }
+
+        ScopedTransformBatch(const ScopedTransformBatch&) = delete;
+        ScopedTransformBatch& operator=(const ScopedTransformBatch&) = delete;
     };
 }   // namespace AZ
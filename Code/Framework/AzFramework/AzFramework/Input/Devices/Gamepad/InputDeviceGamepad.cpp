@@ -379,6 +379,15 @@ namespace AzFramework
         }
     }
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    void InputDeviceGamepad::SetSampleRate(AZ::u32 sampleRateHertz)
+    {
+        if (m_pimpl)
+        {
+            m_pimpl->SetSampleRate(AZStd::min(sampleRateHertz, SampleRateMax));
+        }
+    }
+
     ////////////////////////////////////////////////////////////////////////////////////////////////
     InputDeviceGamepad::Implementation::Implementation(InputDeviceGamepad& inputDevice)
         : m_inputDevice(inputDevice)
@@ -199,6 +199,17 @@ namespace AzFramework
         //! \ref AzFramework::InputLightBarRequests::ResetLightBarColor
         void ResetLightBarColor() override;
 
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        //! The highest sample rate in Hertz that can be passed to SetSampleRate
+        static constexpr AZ::u32 SampleRateMax = 1000;
+
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        //! Set the rate at which the game-pad is sampled on a dedicated thread, on platforms that
+        //! support it. Each state change sampled since the last frame is dispatched in order when
+        //! the input device is ticked, so presses shorter than a frame are not lost.
+        //! \param[in] sampleRateHertz The sample rate in Hertz, or 0 to sample once per frame
+        void SetSampleRate(AZ::u32 sampleRateHertz);
+
     protected:
         ////////////////////////////////////////////////////////////////////////////////////////////
         ///@{
@@ -277,6 +288,11 @@ namespace AzFramework
             //! Reset the light bar color of the gamepad (if one exists) to it's default
             virtual void ResetLightBarColor() {}
 
+            ////////////////////////////////////////////////////////////////////////////////////////
+            //! Set the rate at which the gamepad is sampled on a dedicated thread (if supported)
+            //! \param[in] sampleRateHertz The sample rate in Hertz, or 0 to sample once per frame
+            virtual void SetSampleRate(AZ::u32 sampleRateHertz) { AZ_UNUSED(sampleRateHertz); }
+
             ////////////////////////////////////////////////////////////////////////////////////////
             //! Get the text displayed on the physical key/button associated with an input channel.
             //! \param[in] inputChannelId The input channel id whose key or button text to return
@@ -81,8 +81,9 @@ namespace AzFramework
         if (AZ::SerializeContext* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
         {
             serializeContext->Class<InputSystemComponent, AZ::Component>()
-                ->Version(1)
+                ->Version(2)
                 ->Field("MouseMovementSampleRateHertz", &InputSystemComponent::m_mouseMovementSampleRateHertz)
+                ->Field("GamepadSampleRateHertz", &InputSystemComponent::m_gamepadSampleRateHertz)
                 ->Field("GamepadsEnabled", &InputSystemComponent::m_gamepadsEnabled)
                 ->Field("KeyboardEnabled", &InputSystemComponent::m_keyboardEnabled)
                 ->Field("MotionEnabled", &InputSystemComponent::m_motionEnabled)
@@ -104,6 +105,13 @@ namespace AzFramework
                                                       "Increasing this may improve responsiveness, but could impact performance.\n"
                                                       "Decreasing it may improve performance, but could make it less responsive.")
                         ->Attribute(AZ::Edit::Attributes::Min, 1)
+                    ->DataElement(AZ::Edit::UIHandlers::SpinBox, &InputSystemComponent::m_gamepadSampleRateHertz,
+                        "Gamepad Sample Rate", "The game-pad sample rate in Hertz (cycles per second). When non-zero, game-pads\n"
+                                               "are sampled on a dedicated thread at this rate and every state change is\n"
+                                               "dispatched the following frame, so presses shorter than a frame aren't lost.\n"
+                                               "Zero samples game-pads once per frame on the main thread.")
+                        ->Attribute(AZ::Edit::Attributes::Min, 0)
+                        ->Attribute(AZ::Edit::Attributes::Max, InputDeviceGamepad::SampleRateMax)
                     ->DataElement(AZ::Edit::UIHandlers::SpinBox, &InputSystemComponent::m_gamepadsEnabled,
                         "Gamepads", "The number of game-pads enabled.")
                         ->Attribute(AZ::Edit::Attributes::Min, 0)
@@ -170,6 +178,7 @@ namespace AzFramework
         , m_touch()
         , m_virtualKeyboard()
         , m_mouseMovementSampleRateHertz(InputDeviceMouse::MovementSampleRateDefault)
+        , m_gamepadSampleRateHertz(0)
         , m_gamepadsEnabled(4)
         , m_keyboardEnabled(true)
         , m_motionEnabled(true)
@@ -263,6 +272,7 @@ namespace AzFramework
         for (AZ::u32 i = 0; i < m_gamepadsEnabled; ++i)
         {
             m_gamepads[i].reset(aznew InputDeviceGamepad(i));
+            m_gamepads[i]->SetSampleRate(m_gamepadSampleRateHertz);
         }
 
         m_keyboard.reset(m_keyboardEnabled ? aznew InputDeviceKeyboard() : nullptr);
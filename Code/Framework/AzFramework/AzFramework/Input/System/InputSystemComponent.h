@@ -109,6 +109,7 @@ namespace AzFramework
         ////////////////////////////////////////////////////////////////////////////////////////////
         // Serialized Variables
         AZ::u32 m_mouseMovementSampleRateHertz; //!< The mouse movement sample rate in Hertz
+        AZ::u32 m_gamepadSampleRateHertz;       //!< The game-pad sample rate in Hertz (0 = once per frame)
         AZ::u32 m_gamepadsEnabled;              //!< The number of enabled game-pads
         bool    m_keyboardEnabled;              //!< Is the keyboard enabled?
         bool    m_motionEnabled;                //!< Is motion enabled?
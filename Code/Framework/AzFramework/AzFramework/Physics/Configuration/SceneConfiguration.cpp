@@ -30,6 +30,7 @@ namespace AzPhysics
                 ->Field("EnableActiveActors", &SceneConfiguration::m_enableActiveActors)
                 ->Field("EnablePcm", &SceneConfiguration::m_enablePcm)
                 ->Field("BounceThresholdVelocity", &SceneConfiguration::m_bounceThresholdVelocity)
+                ->Field("EnableGpuDynamics", &SceneConfiguration::m_enableGpuDynamics)
                 ;
 
             if (auto* editContext = serializeContext->GetEditContext())
@@ -56,6 +57,8 @@ namespace AzPhysics
                     ->DataElement(AZ::Edit::UIHandlers::Default, &SceneConfiguration::m_bounceThresholdVelocity,
                         "Bounce Threshold Velocity", "Relative velocity below which colliding objects will not bounce")
                     ->Attribute(AZ::Edit::Attributes::Min, 0.01f)
+                    ->DataElement(AZ::Edit::UIHandlers::Default, &SceneConfiguration::m_enableGpuDynamics,
+                        "Enable GPU Dynamics", "Simulate rigid bodies on a compatible GPU, falls back to the CPU if no compatible device is available")
                     ;
             }
         }
@@ -78,6 +81,7 @@ namespace AzPhysics
             && m_customUserData == other.m_customUserData
             && m_maxCcdPasses == other.m_maxCcdPasses
             && AZ::IsClose(m_bounceThresholdVelocity, other.m_bounceThresholdVelocity)
+            && m_enableGpuDynamics == other.m_enableGpuDynamics
             && m_gravity.IsClose(other.m_gravity)
             && m_worldBounds == other.m_worldBounds
         ;
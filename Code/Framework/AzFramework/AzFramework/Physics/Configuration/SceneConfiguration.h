@@ -47,6 +47,10 @@ namespace AzPhysics
         bool m_kinematicStaticFiltering = true; //!< Enables filtering between kinematic/static objects.
         float m_bounceThresholdVelocity = 2.0f; //!< Relative velocity below which colliding objects will not bounce.
 
+        //! Simulates rigid body dynamics and the broadphase on the GPU when the physics backend supports it and a compatible device exists.
+        //! Scenes fall back to simulating on the CPU otherwise.
+        bool m_enableGpuDynamics = false;
+
         bool operator==(const SceneConfiguration& other) const;
         bool operator!=(const SceneConfiguration& other) const;
 
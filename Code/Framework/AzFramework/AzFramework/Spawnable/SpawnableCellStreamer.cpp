@@ -0,0 +1,225 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Asset/AssetManager.h>
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/IO/IStreamerTypes.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/math.h>
+#include <AzCore/std/sort.h>
+#include <AzFramework/Spawnable/SpawnableCellStreamer.h>
+
+namespace AzFramework
+{
+    SpawnableCellStreamer::SpawnableCellStreamer()
+        : SpawnableCellStreamer(Settings())
+    {
+    }
+
+    SpawnableCellStreamer::SpawnableCellStreamer(const Settings& settings)
+        : m_settings(settings)
+    {
+        AZ_Assert(m_settings.m_cellSize > 0.0f, "The cell size of the spawnable cell streamer has to be larger than zero.");
+        AZ_Warning("SpawnableCellStreamer", m_settings.m_preloadDistance >= m_settings.m_spawnDistance,
+            "The preload distance (%f) is smaller than the spawn distance (%f), so cells will be spawned as soon as they're preloaded.",
+            m_settings.m_preloadDistance, m_settings.m_spawnDistance);
+        m_settings.m_preloadDistance = AZStd::max(m_settings.m_preloadDistance, m_settings.m_spawnDistance);
+    }
+
+    SpawnableCellStreamer::~SpawnableCellStreamer()
+    {
+        for (const CellCoordinate& coordinate : m_streamedCells)
+        {
+            Unload(*m_cells[coordinate]);
+        }
+    }
+
+    void SpawnableCellStreamer::AddCell(const CellCoordinate& cell, const AZ::Data::AssetId& spawnableId)
+    {
+        auto it = m_cells.find(cell);
+        if (it != m_cells.end())
+        {
+            StopStreaming(cell, *it->second);
+        }
+        else
+        {
+            it = m_cells.emplace(cell, AZStd::make_unique<Cell>()).first;
+        }
+        it->second->m_spawnableId = spawnableId;
+    }
+
+    void SpawnableCellStreamer::RemoveCell(const CellCoordinate& cell)
+    {
+        auto it = m_cells.find(cell);
+        if (it != m_cells.end())
+        {
+            StopStreaming(cell, *it->second);
+            m_cells.erase(it);
+        }
+    }
+
+    auto SpawnableCellStreamer::GetCellCoordinate(const AZ::Vector3& position) const -> CellCoordinate
+    {
+        CellCoordinate result;
+        result.m_x = aznumeric_cast<int32_t>(AZStd::floor(position.GetX() / m_settings.m_cellSize));
+        result.m_y = aznumeric_cast<int32_t>(AZStd::floor(position.GetY() / m_settings.m_cellSize));
+        return result;
+    }
+
+    float SpawnableCellStreamer::GetDistanceToCell(const AZ::Vector3& position, const CellCoordinate& cell) const
+    {
+        const float minX = aznumeric_cast<float>(cell.m_x) * m_settings.m_cellSize;
+        const float minY = aznumeric_cast<float>(cell.m_y) * m_settings.m_cellSize;
+        const float deltaX = AZStd::max(AZStd::max(minX - position.GetX(), position.GetX() - (minX + m_settings.m_cellSize)), 0.0f);
+        const float deltaY = AZStd::max(AZStd::max(minY - position.GetY(), position.GetY() - (minY + m_settings.m_cellSize)), 0.0f);
+        return AZStd::sqrt(deltaX * deltaX + deltaY * deltaY);
+    }
+
+    auto SpawnableCellStreamer::GetCellState(const CellCoordinate& cell) const -> CellState
+    {
+        auto it = m_cells.find(cell);
+        return it != m_cells.end() ? it->second->m_state : CellState::Unloaded;
+    }
+
+    void SpawnableCellStreamer::Update(const AZStd::vector<AZ::Vector3>& streamingSources)
+    {
+        // Update the cells that are already streamed first, so cells that are no longer needed are released before new ones are requested.
+        for (size_t i = 0; i < m_streamedCells.size();)
+        {
+            Cell& cell = *m_cells[m_streamedCells[i]];
+            const float distance = GetDistanceToClosestSource(m_streamedCells[i], streamingSources);
+            if (distance > m_settings.m_preloadDistance + m_settings.m_unloadMargin)
+            {
+                Unload(cell);
+                m_streamedCells[i] = m_streamedCells.back();
+                m_streamedCells.pop_back();
+                continue;
+            }
+
+            if (cell.m_state == CellState::Spawned && distance > m_settings.m_spawnDistance + m_settings.m_unloadMargin)
+            {
+                Despawn(cell);
+            }
+            else if (cell.m_state == CellState::Preloaded && distance <= m_settings.m_spawnDistance)
+            {
+                Spawn(cell);
+            }
+            ++i;
+        }
+
+        // Find the cells that need to start streaming.
+        AZStd::vector<PreloadRequest> preloadRequests;
+        const int32_t cellRange = aznumeric_cast<int32_t>(AZStd::ceil(m_settings.m_preloadDistance / m_settings.m_cellSize));
+        for (const AZ::Vector3& source : streamingSources)
+        {
+            const CellCoordinate center = GetCellCoordinate(source);
+            CellCoordinate coordinate;
+            for (coordinate.m_y = center.m_y - cellRange; coordinate.m_y <= center.m_y + cellRange; ++coordinate.m_y)
+            {
+                for (coordinate.m_x = center.m_x - cellRange; coordinate.m_x <= center.m_x + cellRange; ++coordinate.m_x)
+                {
+                    auto it = m_cells.find(coordinate);
+                    if (it == m_cells.end() || it->second->m_state != CellState::Unloaded)
+                    {
+                        continue;
+                    }
+
+                    // Several sources can be close to the same cell, so only request it once.
+                    Cell* cell = it->second.get();
+                    auto requested = AZStd::find_if(preloadRequests.begin(), preloadRequests.end(),
+                        [cell](const PreloadRequest& request) { return request.m_cell == cell; });
+                    if (requested == preloadRequests.end())
+                    {
+                        const float distance = GetDistanceToClosestSource(coordinate, streamingSources);
+                        if (distance <= m_settings.m_preloadDistance)
+                        {
+                            preloadRequests.push_back({ coordinate, cell, distance });
+                        }
+                    }
+                }
+            }
+        }
+
+        // Request the closest cells first.
+        AZStd::sort(preloadRequests.begin(), preloadRequests.end(),
+            [](const PreloadRequest& lhs, const PreloadRequest& rhs) { return lhs.m_distance < rhs.m_distance; });
+        for (const PreloadRequest& request : preloadRequests)
+        {
+            Preload(*request.m_cell, request.m_distance);
+            m_streamedCells.push_back(request.m_coordinate);
+            if (request.m_distance <= m_settings.m_spawnDistance)
+            {
+                Spawn(*request.m_cell);
+            }
+        }
+    }
+
+    float SpawnableCellStreamer::GetDistanceToClosestSource(
+        const CellCoordinate& cell, const AZStd::vector<AZ::Vector3>& streamingSources) const
+    {
+        float distance = AZStd::numeric_limits<float>::max();
+        for (const AZ::Vector3& source : streamingSources)
+        {
+            distance = AZStd::min(distance, GetDistanceToCell(source, cell));
+        }
+        return distance;
+    }
+
+    void SpawnableCellStreamer::Preload(Cell& cell, float distance)
+    {
+        // Closer cells are needed sooner, so they get a higher priority.
+        const float closeness = 1.0f - AZ::GetClamp(distance / AZStd::max(m_settings.m_preloadDistance, 1.0f), 0.0f, 1.0f);
+        AZ::Data::AssetLoadParameters loadParameters;
+        loadParameters.m_priority = aznumeric_cast<AZ::IO::IStreamerTypes::Priority>(AZ::IO::IStreamerTypes::s_priorityLow +
+            closeness * (AZ::IO::IStreamerTypes::s_priorityHigh - AZ::IO::IStreamerTypes::s_priorityLow));
+
+        cell.m_spawnable = AZ::Data::AssetManager::Instance().GetAsset<Spawnable>(
+            cell.m_spawnableId, AZ::Data::AssetLoadBehavior::QueueLoad, loadParameters);
+        cell.m_state = CellState::Preloaded;
+    }
+
+    void SpawnableCellStreamer::Spawn(Cell& cell)
+    {
+        // The spawn request is held by the spawnable entities manager until the spawnable has finished loading.
+        if (!cell.m_entities.IsSet())
+        {
+            cell.m_entities.Reset(cell.m_spawnable);
+        }
+        cell.m_entities.SpawnAllEntities();
+        cell.m_state = CellState::Spawned;
+    }
+
+    void SpawnableCellStreamer::Despawn(Cell& cell)
+    {
+        cell.m_entities.DespawnAllEntities();
+        cell.m_state = CellState::Preloaded;
+    }
+
+    void SpawnableCellStreamer::Unload(Cell& cell)
+    {
+        // Clearing the container destroys its ticket, which despawns any remaining entities.
+        cell.m_entities.Clear();
+        cell.m_spawnable.Reset();
+        cell.m_state = CellState::Unloaded;
+    }
+
+    void SpawnableCellStreamer::StopStreaming(const CellCoordinate& coordinate, Cell& cell)
+    {
+        if (cell.m_state != CellState::Unloaded)
+        {
+            Unload(cell);
+            auto it = AZStd::find(m_streamedCells.begin(), m_streamedCells.end(), coordinate);
+            if (it != m_streamedCells.end())
+            {
+                *it = m_streamedCells.back();
+                m_streamedCells.pop_back();
+            }
+        }
+    }
+} // namespace AzFramework
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Asset/AssetCommon.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/hash.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzFramework/Spawnable/Spawnable.h>
+#include <AzFramework/Spawnable/SpawnableEntitiesContainer.h>
+
+namespace AzFramework
+{
+    //! Streams a world that's split into a grid of square cells on the XY plane, where every cell has its own spawnable.
+    //! Cells within the preload distance of a streaming source, such as a camera or a player, have their spawnable loaded
+    //! in the background, with cells closer to a source getting a higher priority. Cells within the spawn distance have
+    //! their entities spawned. Cells are only despawned and released once all sources are further away than the respective
+    //! distance plus the unload margin, which prevents cells from being repeatedly loaded and unloaded by sources that
+    //! move around a cell boundary.
+    //! Calls to the streamer should be done from the same thread, typically the main thread.
+    class SpawnableCellStreamer
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(SpawnableCellStreamer, AZ::SystemAllocator, 0);
+
+        struct CellCoordinate
+        {
+            int32_t m_x{ 0 };
+            int32_t m_y{ 0 };
+
+            bool operator==(const CellCoordinate& rhs) const { return m_x == rhs.m_x && m_y == rhs.m_y; }
+            bool operator!=(const CellCoordinate& rhs) const { return !(*this == rhs); }
+        };
+
+        struct CellCoordinateHasher
+        {
+            size_t operator()(const CellCoordinate& cell) const
+            {
+                size_t hash = 0;
+                AZStd::hash_combine(hash, cell.m_x, cell.m_y);
+                return hash;
+            }
+        };
+
+        struct Settings
+        {
+            float m_cellSize{ 64.0f }; //!< Length of the sides of a cell in meters.
+            float m_spawnDistance{ 128.0f }; //!< Cells closer to a streaming source than this distance are spawned.
+            float m_preloadDistance{ 192.0f }; //!< Cells closer to a streaming source than this distance are loaded. At least the spawn distance.
+            float m_unloadMargin{ 32.0f }; //!< Additional distance a source has to move away before a cell is despawned or released.
+        };
+
+        enum class CellState
+        {
+            Unloaded, //!< The spawnable of the cell isn't requested.
+            Preloaded, //!< The spawnable of the cell is requested or loaded, but its entities aren't spawned.
+            Spawned //!< The entities of the cell are requested to be spawned.
+        };
+
+        SpawnableCellStreamer();
+        explicit SpawnableCellStreamer(const Settings& settings);
+        //! Despawns the entities of all cells and releases their spawnables.
+        ~SpawnableCellStreamer();
+
+        SpawnableCellStreamer(const SpawnableCellStreamer&) = delete;
+        SpawnableCellStreamer& operator=(const SpawnableCellStreamer&) = delete;
+
+        //! Registers the spawnable with the entities of a cell. Replaces the spawnable of the cell if it was already registered.
+        void AddCell(const CellCoordinate& cell, const AZ::Data::AssetId& spawnableId);
+        //! Despawns the entities of a cell, releases its spawnable and stops streaming it.
+        void RemoveCell(const CellCoordinate& cell);
+
+        //! Returns the coordinate of the cell that contains the provided world position.
+        [[nodiscard]] CellCoordinate GetCellCoordinate(const AZ::Vector3& position) const;
+        //! Returns the distance on the XY plane between a position and the closest point in a cell.
+        [[nodiscard]] float GetDistanceToCell(const AZ::Vector3& position, const CellCoordinate& cell) const;
+        [[nodiscard]] CellState GetCellState(const CellCoordinate& cell) const;
+
+        //! Loads, spawns, despawns and releases cells based on the distance to the provided streaming sources. Without any sources
+        //! all cells are unloaded.
+        void Update(const AZStd::vector<AZ::Vector3>& streamingSources);
+
+    private:
+        struct Cell
+        {
+            AZ_CLASS_ALLOCATOR(SpawnableCellStreamer::Cell, AZ::SystemAllocator, 0);
+
+            AZ::Data::AssetId m_spawnableId;
+            AZ::Data::Asset<Spawnable> m_spawnable;
+            SpawnableEntitiesContainer m_entities;
+            CellState m_state{ CellState::Unloaded };
+        };
+
+        struct PreloadRequest
+        {
+            CellCoordinate m_coordinate;
+            Cell* m_cell;
+            float m_distance;
+        };
+
+        float GetDistanceToClosestSource(const CellCoordinate& cell, const AZStd::vector<AZ::Vector3>& streamingSources) const;
+        void Preload(Cell& cell, float distance);
+        void Spawn(Cell& cell);
+        void Despawn(Cell& cell);
+        void Unload(Cell& cell);
+        void StopStreaming(const CellCoordinate& coordinate, Cell& cell);
+
+        Settings m_settings;
+        AZStd::unordered_map<CellCoordinate, AZStd::unique_ptr<Cell>, CellCoordinateHasher> m_cells;
+        //! Cells that aren't unloaded, so only these need to be checked for despawning and unloading.
+        AZStd::vector<CellCoordinate> m_streamedCells;
+    };
+} // namespace AzFramework
@@ -209,6 +209,12 @@ namespace AzFramework
         EntityDespawnCallback m_completionCallback;
         //! The priority at which this call will be executed.
         SpawnablePriority m_priority { SpawnablePriority_Default };
+        //! If true, complete instances of the spawnable, such as the entities created by a single SpawnAllEntities call, are deactivated
+        //!     and kept in a pool by the ticket instead of being destroyed. Following calls to SpawnAllEntities on the same ticket will
+        //!     reuse the pooled entities instead of cloning new ones. Reused entities keep their entity ids and component state, with
+        //!     the exception of the transform which is reset to the one in the spawnable, so the pre-insertion callback can be used to
+        //!     reset any additional state. Pooled entities are destroyed when the spawnable is reloaded or the ticket is destroyed.
+        bool m_returnToPool { false };
     };
 
     struct ReloadSpawnableOptionalArgs final
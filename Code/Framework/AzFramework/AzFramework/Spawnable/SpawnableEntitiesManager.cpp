@@ -42,6 +42,10 @@ namespace AzFramework
             AZ::u64 value = aznumeric_caster(m_highPriorityThreshold);
             settingsRegistry->Get(value, "/O3DE/AzFramework/Spawnables/HighPriorityThreshold");
             m_highPriorityThreshold = aznumeric_cast<SpawnablePriority>(AZStd::clamp(value, 0llu, 255llu));
+
+            AZ::u64 spawnTimeBudget = m_spawnTimeBudget.count();
+            settingsRegistry->Get(spawnTimeBudget, "/O3DE/AzFramework/Spawnables/SpawnTimeBudgetUs");
+            m_spawnTimeBudget = AZStd::chrono::microseconds(spawnTimeBudget);
         }
     }
 
@@ -55,6 +59,10 @@ namespace AzFramework
             optionalArgs.m_serializeContext == nullptr ? m_defaultSerializeContext : optionalArgs.m_serializeContext;
         queueEntry.m_completionCallback = AZStd::move(optionalArgs.m_completionCallback);
         queueEntry.m_preInsertionCallback = AZStd::move(optionalArgs.m_preInsertionCallback);
+        queueEntry.m_spawnedEntitiesInitialCount = 0;
+        queueEntry.m_nextEntityIndex = 0;
+        queueEntry.m_stage = SpawnAllEntitiesCommand::Stage::Start;
+        queueEntry.m_reusePooledEntities = false;
         QueueRequest(ticket, optionalArgs.m_priority, AZStd::move(queueEntry));
     }
 
@@ -81,6 +89,7 @@ namespace AzFramework
         DespawnAllEntitiesCommand queueEntry;
         queueEntry.m_ticketId = ticket.GetId();
         queueEntry.m_completionCallback = AZStd::move(optionalArgs.m_completionCallback);
+        queueEntry.m_returnToPool = optionalArgs.m_returnToPool;
         QueueRequest(ticket, optionalArgs.m_priority, AZStd::move(queueEntry));
     }
 
@@ -147,6 +156,8 @@ namespace AzFramework
 
     auto SpawnableEntitiesManager::ProcessQueue(CommandQueuePriority priority) -> CommandQueueStatus
     {
+        m_spawnTimeBudgetDeadline = AZStd::chrono::system_clock::now() + m_spawnTimeBudget;
+
         CommandQueueStatus result = CommandQueueStatus::NoCommandsLeft;
         if ((priority & CommandQueuePriority::High) == CommandQueuePriority::High)
         {
@@ -222,6 +233,11 @@ namespace AzFramework
         return queue.m_delayed.empty() ? CommandQueueStatus::NoCommandsLeft : CommandQueueStatus::HasCommandsLeft;
     }
 
+    bool SpawnableEntitiesManager::IsSpawnTimeBudgetExhausted() const
+    {
+        return m_spawnTimeBudget.count() > 0 && AZStd::chrono::system_clock::now() >= m_spawnTimeBudgetDeadline;
+    }
+
     AZStd::pair<uint64_t, void*> SpawnableEntitiesManager::CreateTicket(AZ::Data::Asset<Spawnable>&& spawnable)
     {
         static AZStd::atomic_uint64_t idCounter { 1 };
@@ -252,6 +268,71 @@ namespace AzFramework
                 &entityTemplate, templateToCloneMap, &serializeContext);
     }
 
+    void SpawnableEntitiesManager::ResetPooledEntity(const AZ::Entity& entityTemplate, AZ::Entity& entity)
+    {
+        const TransformComponent* templateTransform = entityTemplate.FindComponent<TransformComponent>();
+        TransformComponent* transform = entity.FindComponent<TransformComponent>();
+        if (templateTransform && transform)
+        {
+            AZ::TransformConfig config;
+            templateTransform->GetConfiguration(config);
+            // The parent id in the template refers to a template entity, so keep the remapped parent.
+            config.m_parentId = transform->GetParentId();
+            transform->SetConfiguration(config);
+        }
+    }
+
+    void SpawnableEntitiesManager::ReturnEntitiesToPool(Ticket& ticket)
+    {
+        const size_t instanceSize = ticket.m_spawnable.IsReady() ? ticket.m_spawnable->GetEntities().size() : 0;
+        const size_t spawnedEntitiesCount = ticket.m_spawnedEntities.size();
+
+        size_t i = 0;
+        while (i < spawnedEntitiesCount)
+        {
+            // An instance can only be reused if it contains every entity of the spawnable once and in order, which is the case for
+            // the entities created by SpawnAllEntities.
+            bool isCompleteInstance = instanceSize > 0 && (i + instanceSize) <= spawnedEntitiesCount;
+            for (size_t j = 0; isCompleteInstance && j < instanceSize; ++j)
+            {
+                isCompleteInstance = ticket.m_spawnedEntityIndices[i + j] == j && ticket.m_spawnedEntities[i + j] != nullptr;
+            }
+
+            if (isCompleteInstance)
+            {
+                AZStd::vector<AZ::Entity*>& instance = ticket.m_entityPool.emplace_back(
+                    ticket.m_spawnedEntities.begin() + i, ticket.m_spawnedEntities.begin() + i + instanceSize);
+                // Deactivate children before their parents.
+                for (auto it = instance.rbegin(); it != instance.rend(); ++it)
+                {
+                    GameEntityContextRequestBus::Broadcast(&GameEntityContextRequestBus::Events::DeactivateGameEntity, (*it)->GetId());
+                }
+                i += instanceSize;
+            }
+            else
+            {
+                if (AZ::Entity* entity = ticket.m_spawnedEntities[i]; entity != nullptr)
+                {
+                    GameEntityContextRequestBus::Broadcast(
+                        &GameEntityContextRequestBus::Events::DestroyGameEntityAndDescendants, entity->GetId());
+                }
+                ++i;
+            }
+        }
+    }
+
+    void SpawnableEntitiesManager::DestroyEntityPool(Ticket& ticket)
+    {
+        for (AZStd::vector<AZ::Entity*>& instance : ticket.m_entityPool)
+        {
+            for (AZ::Entity* entity : instance)
+            {
+                GameEntityContextRequestBus::Broadcast(&GameEntityContextRequestBus::Events::DestroyGameEntity, entity->GetId());
+            }
+        }
+        ticket.m_entityPool.clear();
+    }
+
     void SpawnableEntitiesManager::InitializeEntityIdMappings(
         const Spawnable::EntityList& entities, EntityIdMap& idMap, AZStd::unordered_set<AZ::EntityId>& previouslySpawned)
     {
@@ -291,61 +372,124 @@ namespace AzFramework
         Ticket& ticket = *request.m_ticket;
         if (ticket.m_spawnable.IsReady() && request.m_requestId == ticket.m_currentRequestId)
         {
+            // If earlier requests used up the frame's spawn time budget, wait until the next frame.
+            if (IsSpawnTimeBudgetExhausted())
+            {
+                return false;
+            }
+
             AZStd::vector<AZ::Entity*>& spawnedEntities = ticket.m_spawnedEntities;
             AZStd::vector<size_t>& spawnedEntityIndices = ticket.m_spawnedEntityIndices;
 
-            // Keep track how many entities there were in the array initially
-            size_t spawnedEntitiesInitialCount = spawnedEntities.size();
-
             // These are 'template' entities we'll be cloning from
             const Spawnable::EntityList& entitiesToSpawn = ticket.m_spawnable->GetEntities();
             size_t entitiesToSpawnSize = entitiesToSpawn.size();
 
-            // Reserve buffers
-            spawnedEntities.reserve(spawnedEntities.size() + entitiesToSpawnSize);
-            spawnedEntityIndices.reserve(spawnedEntityIndices.size() + entitiesToSpawnSize);
+            if (request.m_stage == SpawnAllEntitiesCommand::Stage::Start)
+            {
+                // Keep track how many entities there were in the array initially
+                request.m_spawnedEntitiesInitialCount = spawnedEntities.size();
 
-            // Pre-generate the full set of entity id to new entity id mappings, so that during the clone operation below,
-            // any entity references that point to a not-yet-cloned entity will still get their ids remapped correctly.
-            // We clear out and regenerate the set of IDs on every SpawnAllEntities call, because presumably every entity reference
-            // in every entity we're about to instantiate is intended to point to an entity in our newly-instantiated batch, regardless
-            // of spawn order.  If we didn't clear out the map, it would be possible for some entities here to have references to
-            // previously-spawned entities from a previous SpawnEntities or SpawnAllEntities call.
-            InitializeEntityIdMappings(entitiesToSpawn, ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
+                // Reserve buffers
+                spawnedEntities.reserve(spawnedEntities.size() + entitiesToSpawnSize);
+                spawnedEntityIndices.reserve(spawnedEntityIndices.size() + entitiesToSpawnSize);
 
-            for (size_t i = 0; i < entitiesToSpawnSize; ++i)
-            {
-                // If this entity has previously been spawned, give it a new id in the reference map
-                RefreshEntityIdMapping(entitiesToSpawn[i].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
+                // Pre-generate the full set of entity id to new entity id mappings, so that during the clone operation below,
+                // any entity references that point to a not-yet-cloned entity will still get their ids remapped correctly.
+                // We clear out and regenerate the set of IDs on every SpawnAllEntities call, because presumably every entity reference
+                // in every entity we're about to instantiate is intended to point to an entity in our newly-instantiated batch, regardless
+                // of spawn order.  If we didn't clear out the map, it would be possible for some entities here to have references to
+                // previously-spawned entities from a previous SpawnEntities or SpawnAllEntities call.
+                InitializeEntityIdMappings(entitiesToSpawn, ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
+
+                request.m_reusePooledEntities = !ticket.m_entityPool.empty();
+                if (request.m_reusePooledEntities)
+                {
+                    // Entities in the pool already reference each other, so map the template entities to the pooled entities.
+                    AZStd::vector<AZ::Entity*> instance = AZStd::move(ticket.m_entityPool.back());
+                    ticket.m_entityPool.pop_back();
+                    AZ_Assert(instance.size() == entitiesToSpawnSize, "Pooled entities don't match the entities in the spawnable.");
+
+                    for (size_t i = 0; i < entitiesToSpawnSize; ++i)
+                    {
+                        const AZ::EntityId templateId = entitiesToSpawn[i]->GetId();
+                        ticket.m_entityIdReferenceMap[templateId] = instance[i]->GetId();
+                        ticket.m_previouslySpawned.emplace(templateId);
 
-                AZ::Entity* clone = CloneSingleEntity(*entitiesToSpawn[i], ticket.m_entityIdReferenceMap, *request.m_serializeContext);
-                AZ_Assert(clone != nullptr, "Failed to clone spawnable entity.");
+                        ResetPooledEntity(*entitiesToSpawn[i], *instance[i]);
 
-                spawnedEntities.emplace_back(clone);
-                spawnedEntityIndices.push_back(i);
+                        spawnedEntities.emplace_back(instance[i]);
+                        spawnedEntityIndices.push_back(i);
+                    }
+                    request.m_nextEntityIndex = entitiesToSpawnSize;
+                }
+                request.m_stage = SpawnAllEntitiesCommand::Stage::Clone;
             }
 
-            // loadAll is true if every entity has been spawned only once
-            ticket.m_loadAll = (spawnedEntities.size() == entitiesToSpawnSize);
-            
-            // Let other systems know about newly spawned entities for any pre-processing before adding to the scene/game context.
-            if (request.m_preInsertionCallback)
+            if (request.m_stage == SpawnAllEntitiesCommand::Stage::Clone)
             {
-                request.m_preInsertionCallback(request.m_ticketId, SpawnableEntityContainerView(
-                        ticket.m_spawnedEntities.begin() + spawnedEntitiesInitialCount, ticket.m_spawnedEntities.end()));
+                for (size_t& i = request.m_nextEntityIndex; i < entitiesToSpawnSize;)
+                {
+                    // If this entity has previously been spawned, give it a new id in the reference map
+                    RefreshEntityIdMapping(entitiesToSpawn[i].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
+
+                    AZ::Entity* clone = CloneSingleEntity(*entitiesToSpawn[i], ticket.m_entityIdReferenceMap, *request.m_serializeContext);
+                    AZ_Assert(clone != nullptr, "Failed to clone spawnable entity.");
+
+                    spawnedEntities.emplace_back(clone);
+                    spawnedEntityIndices.push_back(i);
+
+                    ++i;
+                    if (i < entitiesToSpawnSize && IsSpawnTimeBudgetExhausted())
+                    {
+                        return false;
+                    }
+                }
+
+                // loadAll is true if every entity has been spawned only once
+                ticket.m_loadAll = (spawnedEntities.size() == entitiesToSpawnSize);
+
+                // Let other systems know about newly spawned entities for any pre-processing before adding to the scene/game context.
+                if (request.m_preInsertionCallback)
+                {
+                    request.m_preInsertionCallback(request.m_ticketId, SpawnableEntityContainerView(
+                        ticket.m_spawnedEntities.begin() + request.m_spawnedEntitiesInitialCount, ticket.m_spawnedEntities.end()));
+                }
+
+                request.m_nextEntityIndex = 0;
+                request.m_stage = SpawnAllEntitiesCommand::Stage::Insert;
+                if (IsSpawnTimeBudgetExhausted())
+                {
+                    return false;
+                }
             }
 
-            // Add to the game context, now the entities are active
-            for (auto it = ticket.m_spawnedEntities.begin() + spawnedEntitiesInitialCount; it != ticket.m_spawnedEntities.end(); ++it)
+            // Add to the game context, now the entities are active. Pooled entities are still part of the game context.
+            const size_t spawnedEntitiesCount = ticket.m_spawnedEntities.size() - request.m_spawnedEntitiesInitialCount;
+            for (size_t& i = request.m_nextEntityIndex; i < spawnedEntitiesCount;)
             {
-                GameEntityContextRequestBus::Broadcast(&GameEntityContextRequestBus::Events::AddGameEntity, *it);
+                AZ::Entity* entity = ticket.m_spawnedEntities[request.m_spawnedEntitiesInitialCount + i];
+                if (request.m_reusePooledEntities)
+                {
+                    GameEntityContextRequestBus::Broadcast(&GameEntityContextRequestBus::Events::ActivateGameEntity, entity->GetId());
+                }
+                else
+                {
+                    GameEntityContextRequestBus::Broadcast(&GameEntityContextRequestBus::Events::AddGameEntity, entity);
+                }
+
+                ++i;
+                if (i < spawnedEntitiesCount && IsSpawnTimeBudgetExhausted())
+                {
+                    return false;
+                }
             }
 
             // Let other systems know about newly spawned entities for any post-processing after adding to the scene/game context.
             if (request.m_completionCallback)
             {
                 request.m_completionCallback(request.m_ticketId, SpawnableConstEntityContainerView(
-                        ticket.m_spawnedEntities.begin() + spawnedEntitiesInitialCount, ticket.m_spawnedEntities.end()));
+                        ticket.m_spawnedEntities.begin() + request.m_spawnedEntitiesInitialCount, ticket.m_spawnedEntities.end()));
             }
 
             ticket.m_currentRequestId++;
@@ -442,12 +586,19 @@ namespace AzFramework
         Ticket& ticket = *request.m_ticket;
         if (request.m_requestId == ticket.m_currentRequestId)
         {
-            for (AZ::Entity* entity : ticket.m_spawnedEntities)
+            if (request.m_returnToPool)
             {
-                if (entity != nullptr)
+                ReturnEntitiesToPool(ticket);
+            }
+            else
+            {
+                for (AZ::Entity* entity : ticket.m_spawnedEntities)
                 {
-                    GameEntityContextRequestBus::Broadcast(
-                        &GameEntityContextRequestBus::Events::DestroyGameEntityAndDescendants, entity->GetId());
+                    if (entity != nullptr)
+                    {
+                        GameEntityContextRequestBus::Broadcast(
+                            &GameEntityContextRequestBus::Events::DestroyGameEntityAndDescendants, entity->GetId());
+                    }
                 }
             }
 
@@ -476,7 +627,8 @@ namespace AzFramework
             "This will likely result in unexpected entities being created.");
         if (ticket.m_spawnable.IsReady() && request.m_requestId == ticket.m_currentRequestId)
         {
-            // Delete the original entities.
+            // Delete the original entities. Pooled entities were created from the old spawnable, so they can't be reused either.
+            DestroyEntityPool(ticket);
             for (AZ::Entity* entity : ticket.m_spawnedEntities)
             {
                 if (entity != nullptr)
@@ -639,6 +791,7 @@ namespace AzFramework
                         &GameEntityContextRequestBus::Events::DestroyGameEntityAndDescendants, entity->GetId());
                 }
             }
+            DestroyEntityPool(*request.m_ticket);
             delete request.m_ticket;
 
             return true;
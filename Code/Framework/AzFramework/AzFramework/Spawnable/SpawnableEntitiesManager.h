@@ -8,6 +8,7 @@
 #pragma once
 
 #include <AzCore/Memory/PoolAllocator.h>
+#include <AzCore/std/chrono/clocks.h>
 #include <AzCore/std/limits.h>
 #include <AzCore/std/containers/queue.h>
 #include <AzCore/std/containers/deque.h>
@@ -98,6 +99,8 @@ namespace AzFramework
 
             AZStd::vector<AZ::Entity*> m_spawnedEntities;
             AZStd::vector<size_t> m_spawnedEntityIndices;
+            //! Deactivated instances of the spawnable that are reused by SpawnAllEntities. See DespawnAllEntitiesOptionalArgs::m_returnToPool.
+            AZStd::vector<AZStd::vector<AZ::Entity*>> m_entityPool;
             AZ::Data::Asset<Spawnable> m_spawnable;
             uint32_t m_nextRequestId{ 0 }; //!< Next id for this ticket.
             uint32_t m_currentRequestId { 0 }; //!< The id for the command that should be executed.
@@ -106,12 +109,24 @@ namespace AzFramework
 
         struct SpawnAllEntitiesCommand
         {
+            //! Spawning can be spread over multiple frames if a spawn time budget is set, so the command keeps track of its progress.
+            enum class Stage : uint8_t
+            {
+                Start,
+                Clone, //!< Cloning the template entities.
+                Insert //!< Adding the spawned entities to the game context.
+            };
+
             EntitySpawnCallback m_completionCallback;
             EntityPreInsertionCallback m_preInsertionCallback;
             AZ::SerializeContext* m_serializeContext;
             Ticket* m_ticket;
             EntitySpawnTicket::Id m_ticketId;
             uint32_t m_requestId;
+            size_t m_spawnedEntitiesInitialCount;
+            size_t m_nextEntityIndex; //!< Next entity to clone or insert in the current stage.
+            Stage m_stage;
+            bool m_reusePooledEntities;
         };
         struct SpawnEntitiesCommand
         {
@@ -130,6 +145,7 @@ namespace AzFramework
             Ticket* m_ticket;
             EntitySpawnTicket::Id m_ticketId;
             uint32_t m_requestId;
+            bool m_returnToPool;
         };
         struct ReloadSpawnableCommand
         {
@@ -191,9 +207,16 @@ namespace AzFramework
         void DestroyTicket(void* ticket) override;
 
         CommandQueueStatus ProcessQueue(Queue& queue);
+        //! Returns true if the spawn time budget for the current ProcessQueue call has been used up.
+        bool IsSpawnTimeBudgetExhausted() const;
 
         AZ::Entity* CloneSingleEntity(
             const AZ::Entity& entityTemplate, EntityIdMap& templateToCloneMap, AZ::SerializeContext& serializeContext);
+        //! Resets the state of an entity that's taken from the entity pool to the state of the template entity it was cloned from.
+        void ResetPooledEntity(const AZ::Entity& entityTemplate, AZ::Entity& entity);
+        //! Moves the complete instances of the spawnable in the spawned entities to the entity pool and destroys the remaining entities.
+        void ReturnEntitiesToPool(Ticket& ticket);
+        void DestroyEntityPool(Ticket& ticket);
         
         bool ProcessRequest(SpawnAllEntitiesCommand& request);
         bool ProcessRequest(SpawnEntitiesCommand& request);
@@ -223,6 +246,11 @@ namespace AzFramework
         //! SpawnablePriority_Default which gives users a bit of room to fine tune the priorities as this value can be configured
         //! through the Settings Registry under the key "/O3DE/AzFramework/Spawnables/HighPriorityThreshold".
         SpawnablePriority m_highPriorityThreshold { 64 };
+        //! The maximum time a single ProcessQueue call spends on spawning entities. Once exceeded, the remainder of the spawn requests
+        //! is processed in following calls. Zero means there's no limit. This value can be configured through the Settings Registry
+        //! under the key "/O3DE/AzFramework/Spawnables/SpawnTimeBudgetUs".
+        AZStd::chrono::microseconds m_spawnTimeBudget { 0 };
+        AZStd::chrono::system_clock::time_point m_spawnTimeBudgetDeadline;
     };
 
     AZ_DEFINE_ENUM_BITWISE_OPERATORS(AzFramework::SpawnableEntitiesManager::CommandQueuePriority);
@@ -7,6 +7,8 @@
 
 #include "TerrainDataRequestBus.h"
 
+#include <AzCore/Casting/numeric_cast.h>
+
 namespace AzFramework
 {
     namespace SurfaceData
@@ -56,5 +58,88 @@ namespace AzFramework
 
         }
 
+        void TerrainDataRequests::GetHeights(
+            AZStd::span<const AZ::Vector2> inPositions, AZStd::span<float> outHeights, Sampler sampler, AZStd::span<bool> outTerrainExists) const
+        {
+            AZ_Assert(outHeights.size() == inPositions.size(), "GetHeights needs one output height per position.");
+            AZ_Assert(outTerrainExists.empty() || outTerrainExists.size() == inPositions.size(), "GetHeights needs one terrain exists flag per position.");
+
+            for (size_t index = 0; index < inPositions.size(); ++index)
+            {
+                outHeights[index] = GetHeightFromFloats(inPositions[index].GetX(), inPositions[index].GetY(), sampler,
+                    outTerrainExists.empty() ? nullptr : &outTerrainExists[index]);
+            }
+        }
+
+        void TerrainDataRequests::GetNormals(
+            AZStd::span<const AZ::Vector2> inPositions, AZStd::span<AZ::Vector3> outNormals, Sampler sampler, AZStd::span<bool> outTerrainExists) const
+        {
+            AZ_Assert(outNormals.size() == inPositions.size(), "GetNormals needs one output normal per position.");
+            AZ_Assert(outTerrainExists.empty() || outTerrainExists.size() == inPositions.size(), "GetNormals needs one terrain exists flag per position.");
+
+            for (size_t index = 0; index < inPositions.size(); ++index)
+            {
+                outNormals[index] = GetNormalFromFloats(inPositions[index].GetX(), inPositions[index].GetY(), sampler,
+                    outTerrainExists.empty() ? nullptr : &outTerrainExists[index]);
+            }
+        }
+
+        AZStd::pair<size_t, size_t> TerrainDataRequests::GetNumSamplesFromRegion(const AZ::Aabb& inRegion, const AZ::Vector2& stepSize)
+        {
+            if (!inRegion.IsValid() || stepSize.GetX() <= 0.0f || stepSize.GetY() <= 0.0f)
+            {
+                return { 0, 0 };
+            }
+
+            const AZ::Vector3 extents = inRegion.GetExtents();
+            return { aznumeric_cast<size_t>(ceilf(extents.GetX() / stepSize.GetX())),
+                     aznumeric_cast<size_t>(ceilf(extents.GetY() / stepSize.GetY())) };
+        }
+
+        void TerrainDataRequests::ProcessHeightsFromRegion(
+            const AZ::Aabb& inRegion, const AZ::Vector2& stepSize, HeightRegionCallback perPositionCallback, Sampler sampler) const
+        {
+            if (!perPositionCallback)
+            {
+                return;
+            }
+
+            const AZStd::pair<size_t, size_t> numSamples = GetNumSamplesFromRegion(inRegion, stepSize);
+            for (size_t yIndex = 0; yIndex < numSamples.second; ++yIndex)
+            {
+                const float y = inRegion.GetMin().GetY() + (stepSize.GetY() * yIndex);
+                for (size_t xIndex = 0; xIndex < numSamples.first; ++xIndex)
+                {
+                    const float x = inRegion.GetMin().GetX() + (stepSize.GetX() * xIndex);
+                    bool terrainExists = false;
+                    const float height = GetHeightFromFloats(x, y, sampler, &terrainExists);
+                    perPositionCallback(xIndex, yIndex, AZ::Vector3(x, y, height), terrainExists);
+                }
+            }
+        }
+
+        void TerrainDataRequests::ProcessNormalsFromRegion(
+            const AZ::Aabb& inRegion, const AZ::Vector2& stepSize, NormalRegionCallback perPositionCallback, Sampler sampler) const
+        {
+            if (!perPositionCallback)
+            {
+                return;
+            }
+
+            const AZStd::pair<size_t, size_t> numSamples = GetNumSamplesFromRegion(inRegion, stepSize);
+            for (size_t yIndex = 0; yIndex < numSamples.second; ++yIndex)
+            {
+                const float y = inRegion.GetMin().GetY() + (stepSize.GetY() * yIndex);
+                for (size_t xIndex = 0; xIndex < numSamples.first; ++xIndex)
+                {
+                    const float x = inRegion.GetMin().GetX() + (stepSize.GetX() * xIndex);
+                    bool terrainExists = false;
+                    const float height = GetHeightFromFloats(x, y, sampler, &terrainExists);
+                    const AZ::Vector3 normal = GetNormalFromFloats(x, y, sampler);
+                    perPositionCallback(xIndex, yIndex, AZ::Vector3(x, y, height), normal, terrainExists);
+                }
+            }
+        }
+
     } //namespace Terrain
 } // namespace AzFramework
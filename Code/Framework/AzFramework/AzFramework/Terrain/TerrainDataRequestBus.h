@@ -11,6 +11,8 @@
 #include <AzCore/Math/Vector3.h>
 #include <AzCore/Math/Aabb.h>
 #include <AzCore/RTTI/BehaviorContext.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/function/function_template.h>
 
 namespace AzFramework
 {
@@ -87,6 +89,38 @@ namespace AzFramework
             //!                  otherwise *terrainExistsPtr will be set to true.
             virtual AZ::Vector3 GetNormal(AZ::Vector3 position, Sampler sampleFilter = Sampler::BILINEAR, bool* terrainExistsPtr = nullptr) const = 0;
             virtual AZ::Vector3 GetNormalFromFloats(float x, float y, Sampler sampleFilter = Sampler::BILINEAR, bool* terrainExistsPtr = nullptr) const = 0;
+
+            // Bulk queries, for systems sampling the terrain at many locations (vegetation, physics heightfields, navigation...).
+            // A single bus call processes all the locations, and terrain systems can override these to sample their height grids in bulk
+            // instead of going through the per-point lookups. The default implementations call the per-point queries.
+
+            //! Given a list of XY coordinates, fill outHeights with the terrain height at each of them.
+            //! @outHeights: Must be the same size as inPositions.
+            //! @outTerrainExists: Can be empty. If not, it must be the same size as inPositions and receives the terrainExistsPtr result of every location.
+            virtual void GetHeights(AZStd::span<const AZ::Vector2> inPositions, AZStd::span<float> outHeights,
+                Sampler sampler = Sampler::BILINEAR, AZStd::span<bool> outTerrainExists = {}) const;
+
+            //! Given a list of XY coordinates, fill outNormals with the terrain surface normal at each of them.
+            //! @outNormals: Must be the same size as inPositions.
+            //! @outTerrainExists: Can be empty. If not, it must be the same size as inPositions and receives the terrainExistsPtr result of every location.
+            virtual void GetNormals(AZStd::span<const AZ::Vector2> inPositions, AZStd::span<AZ::Vector3> outNormals,
+                Sampler sampler = Sampler::BILINEAR, AZStd::span<bool> outTerrainExists = {}) const;
+
+            //! Called for every location of a region query, in row order.
+            //! @xIndex, @yIndex: Column and row of the location in the region.
+            //! @position: The location, with z set to the terrain height.
+            using HeightRegionCallback = AZStd::function<void(size_t xIndex, size_t yIndex, const AZ::Vector3& position, bool terrainExists)>;
+            using NormalRegionCallback = AZStd::function<void(size_t xIndex, size_t yIndex, const AZ::Vector3& position, const AZ::Vector3& normal, bool terrainExists)>;
+
+            //! Sample the terrain on a grid covering the XY extents of inRegion. The samples start at the region min corner and are stepSize apart,
+            //! up to (excluding) the region max corner. Does nothing if the region is invalid or stepSize isn't positive.
+            virtual void ProcessHeightsFromRegion(const AZ::Aabb& inRegion, const AZ::Vector2& stepSize, HeightRegionCallback perPositionCallback,
+                Sampler sampler = Sampler::BILINEAR) const;
+            virtual void ProcessNormalsFromRegion(const AZ::Aabb& inRegion, const AZ::Vector2& stepSize, NormalRegionCallback perPositionCallback,
+                Sampler sampler = Sampler::BILINEAR) const;
+
+            //! Returns the number of columns and rows sampled by the region queries for the given region and step size.
+            static AZStd::pair<size_t, size_t> GetNumSamplesFromRegion(const AZ::Aabb& inRegion, const AZ::Vector2& stepSize);
         };
         using TerrainDataRequestBus = AZ::EBus<TerrainDataRequests>;
 
@@ -8,6 +8,7 @@
 #include "EntityVisibilityBoundsUnionSystem.h"
 
 #include <AzFramework/Visibility/BoundsBus.h>
+#include <AzCore/std/sort.h>
 #include <cstring>
 
 namespace AzFramework
@@ -90,19 +91,40 @@ namespace AzFramework
     {
         AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzFramework);
 
+        if (IVisibilitySystem* visibilitySystem = AZ::Interface<IVisibilitySystem>::Get())
+        {
+            if (UpdateWorldBoundsUnion(entity, instance))
+            {
+                visibilitySystem->GetDefaultVisibilityScene()->InsertOrUpdateEntry(instance.m_visibilityEntry);
+            }
+        }
+    }
+
+    bool EntityVisibilityBoundsUnionSystem::UpdateWorldBoundsUnion(AZ::Entity* entity, EntityVisibilityBoundsUnionInstance& instance)
+    {
         if (const auto& localEntityBoundsUnions = instance.m_localEntityBoundsUnion; localEntityBoundsUnions.IsValid())
         {
             // note: worldEntityBounds will not be a 'tight-fit' Aabb but that of a transformed local aabb
             // there will be some wasted space but it should be sufficient for the visibility system
             AZ::TransformInterface* transformInterface = entity->GetTransform();
             const AZ::Aabb worldEntityBoundsUnion = localEntityBoundsUnions.GetTransformedAabb(transformInterface->GetWorldTM());
-            IVisibilitySystem* visibilitySystem = AZ::Interface<IVisibilitySystem>::Get();
-            if (visibilitySystem && !worldEntityBoundsUnion.IsClose(instance.m_visibilityEntry.m_boundingVolume))
+            if (!worldEntityBoundsUnion.IsClose(instance.m_visibilityEntry.m_boundingVolume))
             {
                 instance.m_visibilityEntry.m_boundingVolume = worldEntityBoundsUnion;
-                visibilitySystem->GetDefaultVisibilityScene()->InsertOrUpdateEntry(instance.m_visibilityEntry);
+                return true;
             }
         }
+        return false;
+    }
+
+    void EntityVisibilityBoundsUnionSystem::MarkWorldBoundsDirty(AZ::Entity* entity, EntityVisibilityBoundsUnionInstance& instance)
+    {
+        // the flag makes sure every entity is only queued once, no matter how often it moves
+        if (!instance.m_worldBoundsDirty)
+        {
+            instance.m_worldBoundsDirty = true;
+            m_entityWorldBoundsDirty.push_back(entity);
+        }
     }
 
     void EntityVisibilityBoundsUnionSystem::RefreshEntityLocalBoundsUnion(const AZ::EntityId entityId)
@@ -144,23 +166,52 @@ namespace AzFramework
                 instance_it != m_entityVisibilityBoundsUnionInstanceMapping.end())
             {
                 instance_it->second.m_localEntityBoundsUnion = CalculateEntityLocalBoundsUnion(entity);
-                UpdateVisibilitySystem(entity, instance_it->second);
+                MarkWorldBoundsDirty(entity, instance_it->second);
             }
         }
 
-        // clear dirty entities once the visibility system has been updated
+        // clear dirty entities once their bounds have been recalculated
         m_entityBoundsDirty.clear();
+
+        // gather the entries of all entities whose bounds or transform changed, entities that deactivated in the
+        // meantime are no longer in the mapping and are skipped
+        for (AZ::Entity* entity : m_entityWorldBoundsDirty)
+        {
+            if (auto instance_it = m_entityVisibilityBoundsUnionInstanceMapping.find(entity);
+                instance_it != m_entityVisibilityBoundsUnionInstanceMapping.end() && instance_it->second.m_worldBoundsDirty)
+            {
+                instance_it->second.m_worldBoundsDirty = false;
+                if (UpdateWorldBoundsUnion(entity, instance_it->second))
+                {
+                    m_changedVisibilityEntries.push_back(&instance_it->second.m_visibilityEntry);
+                }
+            }
+        }
+        m_entityWorldBoundsDirty.clear();
+
+        if (!m_changedVisibilityEntries.empty())
+        {
+            if (IVisibilitySystem* visibilitySystem = AZ::Interface<IVisibilitySystem>::Get())
+            {
+                // group the entries by the node they're currently bound to so updates of the same node are done back to back
+                AZStd::sort(m_changedVisibilityEntries.begin(), m_changedVisibilityEntries.end(),
+                    [](const VisibilityEntry* lhs, const VisibilityEntry* rhs) { return lhs->m_internalNode < rhs->m_internalNode; });
+                visibilitySystem->GetDefaultVisibilityScene()->InsertOrUpdateEntries(m_changedVisibilityEntries);
+            }
+            m_changedVisibilityEntries.clear();
+        }
     }
 
     void EntityVisibilityBoundsUnionSystem::OnTransformUpdated(AZ::Entity* entity)
     {
         AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzFramework);
 
-        // update the world transform of the visibility bounds union
+        // queue the world transform of the visibility bounds union to be updated, the visibility system is only
+        // updated once per frame in ProcessEntityBoundsUnionRequests
         if (auto instance_it = m_entityVisibilityBoundsUnionInstanceMapping.find(entity);
             instance_it != m_entityVisibilityBoundsUnionInstanceMapping.end())
         {
-            UpdateVisibilitySystem(entity, instance_it->second);
+            MarkWorldBoundsDirty(entity, instance_it->second);
         }
     }
 
@@ -38,6 +38,7 @@ namespace AzFramework
         {
             AZ::Aabb m_localEntityBoundsUnion = AZ::Aabb::CreateNull(); //!< Entity union bounding volume in local space.
             VisibilityEntry m_visibilityEntry; //!< Hook into the IVisibilitySystem interface.
+            bool m_worldBoundsDirty = false; //!< Set when the instance is queued in m_entityWorldBoundsDirty.
         };
 
         using UniqueEntities = AZStd::set<AZ::Entity*>;
@@ -51,9 +52,13 @@ namespace AzFramework
         void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
 
         void UpdateVisibilitySystem(AZ::Entity* entity, EntityVisibilityBoundsUnionInstance& instance);
+        bool UpdateWorldBoundsUnion(AZ::Entity* entity, EntityVisibilityBoundsUnionInstance& instance);
+        void MarkWorldBoundsDirty(AZ::Entity* entity, EntityVisibilityBoundsUnionInstance& instance);
 
         EntityVisibilityBoundsUnionInstanceMapping m_entityVisibilityBoundsUnionInstanceMapping;
         UniqueEntities m_entityBoundsDirty;
+        AZStd::vector<AZ::Entity*> m_entityWorldBoundsDirty; //!< Entities whose world bounds have to be written to the visibility system.
+        AZStd::vector<VisibilityEntry*> m_changedVisibilityEntries; //!< Scratch buffer used to write changes in a single batch.
 
         AZ::EntityActivatedEvent::Handler m_entityActivatedEventHandler;
         AZ::EntityDeactivatedEvent::Handler m_entityDeactivatedEventHandler;
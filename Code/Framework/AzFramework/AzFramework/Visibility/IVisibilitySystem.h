@@ -16,8 +16,14 @@
 #include <AzCore/Math/Frustum.h>
 #include <AzCore/Name/Name.h>
 #include <AzCore/Interface/Interface.h>
+#include <AzCore/std/containers/span.h>
 #include <AzCore/std/containers/vector.h>
 
+namespace AZ
+{
+    class JobContext;
+}
+
 namespace AzFramework
 {
     //! This is a base spatial hash node type.
@@ -59,6 +65,12 @@ namespace AzFramework
         };
         using EnumerateCallback = AZStd::function<void(const NodeData&)>;
 
+        //! Callback for EnumerateFrustums, bit N of the view mask is set if the node is visible in the Nth frustum.
+        using EnumerateFrustumsCallback = AZStd::function<void(const NodeData&, uint32_t viewMask)>;
+
+        //! The maximum number of frustums that can be enumerated at once, limited by the number of bits in the view mask.
+        static constexpr uint32_t MaxEnumerateFrustumsCount = 32;
+
         //! Get the unique scene name, used to look up the scene in the IVisibilitySystem. Duplicate names will assert on creation.
         virtual const AZ::Name& GetName() const = 0;
 
@@ -71,6 +83,12 @@ namespace AzFramework
         //! @param visibilityEntry data for the object being added/updated
         virtual void InsertOrUpdateEntry(VisibilityEntry& visibilityEntry) = 0;
 
+        //! Insert or update multiple entries within the visibility system at once, this is cheaper than inserting or updating them
+        //! one at a time because the scene only has to be locked once.
+        //! Entries that are bound to the same node should be adjacent, so the node is likely to still be in the cache.
+        //! @param visibilityEntries data for the objects being added/updated
+        virtual void InsertOrUpdateEntries(AZStd::span<VisibilityEntry* const> visibilityEntries) = 0;
+
         //! Removes an entry from the visibility system.
         //! @param visibilityEntry data for the object being removed
         virtual void RemoveEntry(VisibilityEntry& visibilityEntry) = 0;
@@ -93,6 +111,15 @@ namespace AzFramework
         //! @return the intersection result of the frustum against the visibility system
         virtual void Enumerate(const AZ::Frustum& frustum, const EnumerateCallback& callback) const = 0;
 
+        //! Intersects multiple frustums against the visibility system in a single traversal, e.g. for the main view and all its shadow views.
+        //! This is faster than enumerating each frustum individually because every node is only visited once.
+        //! @param frustums the frustums to test against, at most MaxEnumerateFrustumsCount
+        //! @param callback the callback to invoke when a node is visible in at least one of the frustums
+        //! @param jobContext if set, the traversal of the top level nodes is split across jobs and the callback can be
+        //!        invoked concurrently from multiple threads, so it has to be thread-safe
+        virtual void EnumerateFrustums(
+            AZStd::span<const AZ::Frustum> frustums, const EnumerateFrustumsCallback& callback, AZ::JobContext* jobContext = nullptr) const = 0;
+
         //! Enumerate *all* OctreeNodes that have any entries in them (without any culling).
         //! @param callback the callback to invoke when a node is visible
         virtual void EnumerateNoCull(const EnumerateCallback& callback) const = 0;
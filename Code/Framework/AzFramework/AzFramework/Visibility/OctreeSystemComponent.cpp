@@ -6,7 +6,10 @@
  */
 
 #include <AzFramework/Visibility/OctreeSystemComponent.h>
+#include <AzCore/Math/MathIntrinsics.h>
 #include <AzCore/Math/ShapeIntersection.h>
+#include <AzCore/Jobs/Algorithms.h>
+#include <AzCore/std/containers/fixed_vector.h>
 
 namespace AzFramework
 {
@@ -14,6 +17,7 @@ namespace AzFramework
     AZ_CVAR(float,    bg_octreeMaxWorldExtents, 16384.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "Maximum supported world size by the world octreeSystemComponent");
     AZ_CVAR(uint32_t, bg_octreeNodeMaxEntries,       64, nullptr, AZ::ConsoleFunctorFlags::Null, "Maximum number of entries to allow in any node before forcing a split");
     AZ_CVAR(uint32_t, bg_octreeNodeMinEntries,       32, nullptr, AZ::ConsoleFunctorFlags::Null, "Minimum number of entries to allow in a node resulting from a merge operation");
+    AZ_CVAR(float,    bg_octreeLooseness,          1.0f, nullptr, AZ::ConsoleFunctorFlags::ReadOnly, "Scale applied to the bounds of child nodes, values larger than 1 create a loose octree where entries that straddle a split plane can still be stored in a child node");
 
 
     static uint32_t GetChildNodeCount()
@@ -24,6 +28,38 @@ namespace AzFramework
     }
 
 
+    //! The planes of a frustum splatted across all lanes, so a frustum only has to be converted once per query.
+    struct OctreeNode::SoaFrustum
+    {
+        explicit SoaFrustum(const AZ::Frustum& frustum);
+
+        AZ::Simd::Vec4::FloatType m_normalX[AZ::Frustum::PlaneId::MAX];
+        AZ::Simd::Vec4::FloatType m_normalY[AZ::Frustum::PlaneId::MAX];
+        AZ::Simd::Vec4::FloatType m_normalZ[AZ::Frustum::PlaneId::MAX];
+        AZ::Simd::Vec4::FloatType m_absNormalX[AZ::Frustum::PlaneId::MAX];
+        AZ::Simd::Vec4::FloatType m_absNormalY[AZ::Frustum::PlaneId::MAX];
+        AZ::Simd::Vec4::FloatType m_absNormalZ[AZ::Frustum::PlaneId::MAX];
+        AZ::Simd::Vec4::FloatType m_distance[AZ::Frustum::PlaneId::MAX];
+    };
+
+
+    OctreeNode::SoaFrustum::SoaFrustum(const AZ::Frustum& frustum)
+    {
+        for (AZ::Frustum::PlaneId planeId = AZ::Frustum::PlaneId::Near; planeId < AZ::Frustum::PlaneId::MAX; ++planeId)
+        {
+            const AZ::Plane plane = frustum.GetPlane(planeId);
+            const AZ::Vector3 normal = plane.GetNormal();
+            m_normalX[planeId] = AZ::Simd::Vec4::Splat(normal.GetX());
+            m_normalY[planeId] = AZ::Simd::Vec4::Splat(normal.GetY());
+            m_normalZ[planeId] = AZ::Simd::Vec4::Splat(normal.GetZ());
+            m_absNormalX[planeId] = AZ::Simd::Vec4::Splat(AZ::GetAbs(normal.GetX()));
+            m_absNormalY[planeId] = AZ::Simd::Vec4::Splat(AZ::GetAbs(normal.GetY()));
+            m_absNormalZ[planeId] = AZ::Simd::Vec4::Splat(AZ::GetAbs(normal.GetZ()));
+            m_distance[planeId] = AZ::Simd::Vec4::Splat(plane.GetDistance());
+        }
+    }
+
+
     OctreeNode::OctreeNode(const AZ::Aabb& bounds)
         : m_bounds(bounds)
     {
@@ -35,6 +71,7 @@ namespace AzFramework
         : m_bounds(rhs.m_bounds)
         , m_parent(rhs.m_parent)
         , m_children(rhs.m_children)
+        , m_childBounds(rhs.m_childBounds)
         , m_entries(AZStd::move(rhs.m_entries))
     {
         // Correct internal node pointers
@@ -50,6 +87,7 @@ namespace AzFramework
         m_bounds = rhs.m_bounds;
         m_parent = rhs.m_parent;
         m_children = rhs.m_children;
+        m_childBounds = rhs.m_childBounds;
         m_entries = AZStd::move(rhs.m_entries);
 
         // Correct internal node pointers
@@ -165,7 +203,62 @@ namespace AzFramework
 
     void OctreeNode::Enumerate(const AZ::Frustum& frustum, const IVisibilityScene::EnumerateCallback& callback) const
     {
-        EnumerateHelper(frustum, callback);
+        AZ_Assert(AZ::ShapeIntersection::Overlaps(frustum, m_bounds), "Enumerate invoked on an octreeSystemComponent node that is not within the frustum");
+
+        EnumerateFrustumHelper(SoaFrustum(frustum), callback);
+    }
+
+
+    void OctreeNode::EnumerateFrustums(
+        AZStd::span<const AZ::Frustum> frustums, const IVisibilityScene::EnumerateFrustumsCallback& callback, AZ::JobContext* jobContext) const
+    {
+        AZ_Assert(frustums.size() <= IVisibilityScene::MaxEnumerateFrustumsCount, "EnumerateFrustums supports at most %u frustums, %zu provided",
+            IVisibilityScene::MaxEnumerateFrustumsCount, frustums.size());
+
+        AZStd::fixed_vector<SoaFrustum, IVisibilityScene::MaxEnumerateFrustumsCount> soaFrustums;
+        uint32_t viewMask = 0;
+        const size_t frustumCount = AZStd::min(frustums.size(), soaFrustums.capacity());
+        for (size_t frustumIndex = 0; frustumIndex < frustumCount; ++frustumIndex)
+        {
+            if (AZ::ShapeIntersection::Overlaps(frustums[frustumIndex], m_bounds))
+            {
+                viewMask |= 1u << frustumIndex;
+            }
+            soaFrustums.emplace_back(frustums[frustumIndex]);
+        }
+
+        if (viewMask == 0)
+        {
+            return;
+        }
+
+        if (jobContext == nullptr || IsLeaf())
+        {
+            EnumerateFrustumsHelper(soaFrustums.data(), viewMask, callback);
+            return;
+        }
+
+        // Each of the children gets its own job, they're independent so they can be traversed without synchronization
+        if (!m_entries.empty())
+        {
+            callback({m_bounds, m_entries}, viewMask);
+        }
+
+        const uint32_t groupCount = (GetChildNodeCount() + OctreeChildBounds::LaneCount - 1) / OctreeChildBounds::LaneCount;
+        alignas(16) int32_t childViewMasks[OctreeChildBounds::MaxChildNodeCount];
+        for (uint32_t group = 0; group < groupCount; ++group)
+        {
+            const uint32_t firstChild = group * OctreeChildBounds::LaneCount;
+            AZ::Simd::Vec4::StoreAligned(&childViewMasks[firstChild], GetChildViewMasks(soaFrustums.data(), viewMask, firstChild));
+        }
+
+        AZ::parallel_for(0u, GetChildNodeCount(), [this, &soaFrustums, &childViewMasks, &callback](uint32_t child)
+            {
+                if (childViewMasks[child] != 0)
+                {
+                    m_children[child].EnumerateFrustumsHelper(soaFrustums.data(), aznumeric_cast<uint32_t>(childViewMasks[child]), callback);
+                }
+            }, jobContext);
     }
 
 
@@ -261,16 +354,137 @@ namespace AzFramework
     }
 
 
+    AZ::Simd::Vec4::Int32Type OctreeNode::OverlapsChildren(const SoaFrustum& frustum, uint32_t firstChild) const
+    {
+        using AZ::Simd::Vec4;
+
+        // This is the same test as ShapeIntersection::Overlaps(Frustum, Aabb), a child is culled if it's fully behind any of the planes
+        const Vec4::FloatType centerX = Vec4::LoadAligned(&m_childBounds->m_centerX[firstChild]);
+        const Vec4::FloatType centerY = Vec4::LoadAligned(&m_childBounds->m_centerY[firstChild]);
+        const Vec4::FloatType centerZ = Vec4::LoadAligned(&m_childBounds->m_centerZ[firstChild]);
+        const Vec4::FloatType halfExtentsX = Vec4::LoadAligned(&m_childBounds->m_halfExtentsX[firstChild]);
+        const Vec4::FloatType halfExtentsY = Vec4::LoadAligned(&m_childBounds->m_halfExtentsY[firstChild]);
+        const Vec4::FloatType halfExtentsZ = Vec4::LoadAligned(&m_childBounds->m_halfExtentsZ[firstChild]);
+        const Vec4::FloatType zero = Vec4::ZeroFloat();
+
+        Vec4::Int32Type overlaps = Vec4::Splat(-1);
+        for (uint32_t plane = 0; plane < AZ::Frustum::PlaneId::MAX; ++plane)
+        {
+            const Vec4::FloatType pointDist = Vec4::Add(
+                Vec4::Add(Vec4::Mul(centerX, frustum.m_normalX[plane]), Vec4::Mul(centerY, frustum.m_normalY[plane])),
+                Vec4::Add(Vec4::Mul(centerZ, frustum.m_normalZ[plane]), frustum.m_distance[plane]));
+            const Vec4::FloatType radius = Vec4::Add(
+                Vec4::Add(Vec4::Mul(halfExtentsX, frustum.m_absNormalX[plane]), Vec4::Mul(halfExtentsY, frustum.m_absNormalY[plane])),
+                Vec4::Mul(halfExtentsZ, frustum.m_absNormalZ[plane]));
+            overlaps = Vec4::And(overlaps, Vec4::CastToInt(Vec4::CmpGt(Vec4::Add(pointDist, radius), zero)));
+        }
+        return overlaps;
+    }
+
+
+    AZ::Simd::Vec4::Int32Type OctreeNode::GetChildViewMasks(const SoaFrustum* frustums, uint32_t viewMask, uint32_t firstChild) const
+    {
+        using AZ::Simd::Vec4;
+
+        Vec4::Int32Type childViewMasks = Vec4::ZeroInt();
+        for (uint32_t remainingViews = viewMask; remainingViews != 0; remainingViews &= remainingViews - 1)
+        {
+            const uint32_t view = az_ctz_u32(remainingViews);
+            const Vec4::Int32Type viewBit = Vec4::Splat(static_cast<int32_t>(1u << view));
+            childViewMasks = Vec4::Or(childViewMasks, Vec4::And(OverlapsChildren(frustums[view], firstChild), viewBit));
+        }
+        return childViewMasks;
+    }
+
+
+    void OctreeNode::EnumerateFrustumHelper(const SoaFrustum& frustum, const IVisibilityScene::EnumerateCallback& callback) const
+    {
+        // Invoke the callback for the current node
+        if (!m_entries.empty())
+        {
+            callback({m_bounds, m_entries});
+        }
+
+        if (m_children == nullptr)
+        {
+            return;
+        }
+
+        // Test the children four at a time
+        const uint32_t childCount = GetChildNodeCount();
+        for (uint32_t firstChild = 0; firstChild < childCount; firstChild += OctreeChildBounds::LaneCount)
+        {
+            const AZ::Simd::Vec4::Int32Type overlaps = OverlapsChildren(frustum, firstChild);
+            if (AZ::Simd::Vec4::CmpAllEq(overlaps, AZ::Simd::Vec4::ZeroInt()))
+            {
+                continue;
+            }
+
+            alignas(16) int32_t overlapMask[OctreeChildBounds::LaneCount];
+            AZ::Simd::Vec4::StoreAligned(overlapMask, overlaps);
+            for (uint32_t lane = 0; lane < OctreeChildBounds::LaneCount; ++lane)
+            {
+                if (overlapMask[lane] != 0)
+                {
+                    m_children[firstChild + lane].EnumerateFrustumHelper(frustum, callback);
+                }
+            }
+        }
+    }
+
+
+    void OctreeNode::EnumerateFrustumsHelper(
+        const SoaFrustum* frustums, uint32_t viewMask, const IVisibilityScene::EnumerateFrustumsCallback& callback) const
+    {
+        // Invoke the callback for the current node
+        if (!m_entries.empty())
+        {
+            callback({m_bounds, m_entries}, viewMask);
+        }
+
+        if (m_children == nullptr)
+        {
+            return;
+        }
+
+        // Children are only tested against the frustums their parent is visible in
+        const uint32_t childCount = GetChildNodeCount();
+        for (uint32_t firstChild = 0; firstChild < childCount; firstChild += OctreeChildBounds::LaneCount)
+        {
+            const AZ::Simd::Vec4::Int32Type childViewMasks = GetChildViewMasks(frustums, viewMask, firstChild);
+            if (AZ::Simd::Vec4::CmpAllEq(childViewMasks, AZ::Simd::Vec4::ZeroInt()))
+            {
+                continue;
+            }
+
+            alignas(16) int32_t childViewMask[OctreeChildBounds::LaneCount];
+            AZ::Simd::Vec4::StoreAligned(childViewMask, childViewMasks);
+            for (uint32_t lane = 0; lane < OctreeChildBounds::LaneCount; ++lane)
+            {
+                if (childViewMask[lane] != 0)
+                {
+                    m_children[firstChild + lane].EnumerateFrustumsHelper(frustums, aznumeric_cast<uint32_t>(childViewMask[lane]), callback);
+                }
+            }
+        }
+    }
+
+
     void OctreeNode::Split(OctreeScene& octreeScene)
     {
         AZ_Assert(m_children == nullptr, "Split invoked on an octreeScene node that has already been split");
         m_childNodeIndex = octreeScene.AllocateChildNodes();
         m_children = octreeScene.GetChildNodesAtIndex(m_childNodeIndex);
+        OctreeChildBounds* childBounds = octreeScene.GetChildBoundsAtIndex(m_childNodeIndex);
+        m_childBounds = childBounds;
 
         // Set child split planes and bounding volumes
         {
             const AZ::Vector3 childExtent = (m_bounds.GetMax() - m_bounds.GetMin()) * 0.5f;
-            const AZ::Aabb childBound = AZ::Aabb::CreateFromMinMax(m_bounds.GetMin(), m_bounds.GetMin() + childExtent);
+
+            // In a loose octree the child nodes overlap, so the bounds are grown equally on all sides
+            const AZ::Vector3 looseMargin = childExtent * (AZ::GetMax(static_cast<float>(bg_octreeLooseness), 1.0f) - 1.0f) * 0.5f;
+            const AZ::Aabb childBound = AZ::Aabb::CreateFromMinMax(m_bounds.GetMin() - looseMargin, m_bounds.GetMin() + childExtent + looseMargin);
             const uint32_t childCount = GetChildNodeCount();
 
             for (uint32_t child = 0; child < childCount; ++child)
@@ -297,6 +511,15 @@ namespace AzFramework
 
                 m_children[child].m_bounds = childBound.GetTranslated(childOffset);
                 m_children[child].m_parent = this;
+
+                const AZ::Vector3 childCenter = m_children[child].m_bounds.GetCenter();
+                const AZ::Vector3 childHalfExtents = 0.5f * m_children[child].m_bounds.GetExtents();
+                childBounds->m_centerX[child] = childCenter.GetX();
+                childBounds->m_centerY[child] = childCenter.GetY();
+                childBounds->m_centerZ[child] = childCenter.GetZ();
+                childBounds->m_halfExtentsX[child] = childHalfExtents.GetX();
+                childBounds->m_halfExtentsY[child] = childHalfExtents.GetY();
+                childBounds->m_halfExtentsZ[child] = childHalfExtents.GetZ();
             }
         }
 
@@ -331,6 +554,7 @@ namespace AzFramework
         octreeScene.ReleaseChildNodes(m_childNodeIndex);
         m_childNodeIndex = InvalidChildNodeIndex;
         m_children = nullptr;
+        m_childBounds = nullptr;
     }
 
     OctreeScene::OctreeScene(const AZ::Name& sceneName)
@@ -370,6 +594,24 @@ namespace AzFramework
     }
 
 
+    void OctreeScene::InsertOrUpdateEntries(AZStd::span<VisibilityEntry* const> entries)
+    {
+        AZStd::lock_guard<AZStd::shared_mutex> lock(m_sharedMutex);
+        for (VisibilityEntry* entry : entries)
+        {
+            if (entry->m_internalNode != nullptr)
+            {
+                static_cast<OctreeNode*>(entry->m_internalNode)->Update(*this, entry);
+            }
+            else
+            {
+                m_root.Insert(*this, entry);
+                ++m_entryCount;
+            }
+        }
+    }
+
+
     void OctreeScene::RemoveEntry(VisibilityEntry& entry)
     {
         AZStd::lock_guard<AZStd::shared_mutex> lock(m_sharedMutex);
@@ -402,6 +644,14 @@ namespace AzFramework
     }
 
 
+    void OctreeScene::EnumerateFrustums(
+        AZStd::span<const AZ::Frustum> frustums, const IVisibilityScene::EnumerateFrustumsCallback& callback, AZ::JobContext* jobContext) const
+    {
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        m_root.EnumerateFrustums(frustums, callback, jobContext);
+    }
+
+
     void OctreeScene::EnumerateNoCull(const IVisibilityScene::EnumerateCallback& callback) const
     {
         AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
@@ -474,7 +724,7 @@ namespace AzFramework
         }
 
         uint32_t nextChildPage = aznumeric_cast<uint32_t>(m_nodeCache.size() - 1);
-        uint32_t nextChildOffset = aznumeric_cast<uint32_t>(m_nodeCache[nextChildPage]->size());
+        uint32_t nextChildOffset = aznumeric_cast<uint32_t>(m_nodeCache[nextChildPage]->m_nodes.size());
 
         if (!m_freeOctreeNodes.empty())
         {
@@ -493,10 +743,10 @@ namespace AzFramework
             }
 
             // Our (potentially new) last page has unused capacity
-            m_nodeCache[nextChildPage]->resize_no_construct(nextChildOffset + GetChildNodeCount());
+            m_nodeCache[nextChildPage]->m_nodes.resize_no_construct(nextChildOffset + GetChildNodeCount());
 
             // We resize_no_construct to prevent fixed_vector from using copy or assignment operators, but this means we have to explicitly construct nodes ourselves
-            OctreeNode* childNodes = &(*m_nodeCache[nextChildPage])[nextChildOffset];
+            OctreeNode* childNodes = &m_nodeCache[nextChildPage]->m_nodes[nextChildOffset];
             for (uint32_t child = 0; child < childCount; ++child)
             {
                 new (&childNodes[child]) OctreeNode;
@@ -519,7 +769,17 @@ namespace AzFramework
         uint32_t childPage;
         uint32_t childOffset;
         ExtractPageAndOffsetFromIndex(nodeIndex, childPage, childOffset);
-        return &(*m_nodeCache[childPage])[childOffset];
+        return &m_nodeCache[childPage]->m_nodes[childOffset];
+    }
+
+
+    OctreeChildBounds* OctreeScene::GetChildBoundsAtIndex(uint32_t nodeIndex) const
+    {
+        // Child nodes are always allocated in blocks of GetChildNodeCount() nodes, so the offset identifies the block
+        uint32_t childPage;
+        uint32_t childOffset;
+        ExtractPageAndOffsetFromIndex(nodeIndex, childPage, childOffset);
+        return &m_nodeCache[childPage]->m_childBounds[childOffset / GetChildNodeCount()];
     }
 
 
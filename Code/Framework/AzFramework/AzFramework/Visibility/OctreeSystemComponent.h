@@ -9,6 +9,7 @@
 
 #include <AzFramework/Visibility/IVisibilitySystem.h>
 #include <AzCore/Math/Plane.h>
+#include <AzCore/Math/SimdMath.h>
 #include <AzCore/Component/Component.h>
 #include <AzCore/std/containers/stack.h>
 #include <AzCore/std/containers/vector.h>
@@ -20,6 +21,21 @@ namespace AzFramework
     class OctreeSystemComponent;
     class OctreeScene;
 
+    //! The bounds of a block of sibling nodes, stored as a structure of arrays so the bounds of four siblings can be tested
+    //! against a bounding volume with a single set of SIMD operations.
+    struct OctreeChildBounds
+    {
+        static constexpr uint32_t LaneCount = 4;
+        static constexpr uint32_t MaxChildNodeCount = 8;
+
+        alignas(16) float m_centerX[MaxChildNodeCount];
+        alignas(16) float m_centerY[MaxChildNodeCount];
+        alignas(16) float m_centerZ[MaxChildNodeCount];
+        alignas(16) float m_halfExtentsX[MaxChildNodeCount];
+        alignas(16) float m_halfExtentsY[MaxChildNodeCount];
+        alignas(16) float m_halfExtentsZ[MaxChildNodeCount];
+    };
+
     //! An internal node within the tree.
     //! It contains all objects that are *fully contained* by the node, if an object spans multiple child nodes that object will be stored in the parent.
     class OctreeNode
@@ -53,6 +69,10 @@ namespace AzFramework
         void Enumerate(const AZ::Frustum& frustum, const IVisibilityScene::EnumerateCallback& callback) const;
         //! @}
 
+        //! Recursively enumerates any OctreeNodes and their children that intersect any of the provided frustums.
+        void EnumerateFrustums(
+            AZStd::span<const AZ::Frustum> frustums, const IVisibilityScene::EnumerateFrustumsCallback& callback, AZ::JobContext* jobContext) const;
+
         //! Recursively enumerate *all* OctreeNodes that have any entries in them (without any culling).
         void EnumerateNoCull(const IVisibilityScene::EnumerateCallback& callback) const;
 
@@ -67,10 +87,19 @@ namespace AzFramework
 
     private:
 
+        struct SoaFrustum;
+
         void TryMerge(OctreeScene& octreeScene);
 
         template <typename T>
         void EnumerateHelper(const T& boundingVolume, const IVisibilityScene::EnumerateCallback& callback) const;
+        void EnumerateFrustumHelper(const SoaFrustum& frustum, const IVisibilityScene::EnumerateCallback& callback) const;
+        void EnumerateFrustumsHelper(const SoaFrustum* frustums, uint32_t viewMask, const IVisibilityScene::EnumerateFrustumsCallback& callback) const;
+
+        //! Returns a mask with all bits set in the lanes of the four children starting at firstChild that overlap the frustum.
+        AZ::Simd::Vec4::Int32Type OverlapsChildren(const SoaFrustum& frustum, uint32_t firstChild) const;
+        //! Returns the per child view masks of the four children starting at firstChild for the frustums in the view mask.
+        AZ::Simd::Vec4::Int32Type GetChildViewMasks(const SoaFrustum* frustums, uint32_t viewMask, uint32_t firstChild) const;
 
         void Split(OctreeScene& octreeScene);
         void Merge(OctreeScene& octreeScene);
@@ -82,6 +111,7 @@ namespace AzFramework
         AZ::Aabb m_bounds;
         OctreeNode* m_parent = nullptr; //< This is a pointer to an array of GetChildNodeCount() nodes, or nullptr if this is a leaf node
         OctreeNode* m_children = nullptr;
+        const OctreeChildBounds* m_childBounds = nullptr; //< The bounds of m_children in SoA form, or nullptr if this is a leaf node
         AZStd::vector<VisibilityEntry*> m_entries;
     };
 
@@ -102,10 +132,14 @@ namespace AzFramework
         //! @{
         const AZ::Name& GetName() const override;
         void InsertOrUpdateEntry(VisibilityEntry& entry) override;
+        void InsertOrUpdateEntries(AZStd::span<VisibilityEntry* const> entries) override;
         void RemoveEntry(VisibilityEntry& entry) override;
         void Enumerate(const AZ::Aabb& aabb, const IVisibilityScene::EnumerateCallback& callback) const override;
         void Enumerate(const AZ::Sphere& sphere, const IVisibilityScene::EnumerateCallback& callback) const override;
         void Enumerate(const AZ::Frustum& frustum, const IVisibilityScene::EnumerateCallback& callback) const override;
+        void EnumerateFrustums(
+            AZStd::span<const AZ::Frustum> frustums, const IVisibilityScene::EnumerateFrustumsCallback& callback,
+            AZ::JobContext* jobContext = nullptr) const override;
         void EnumerateNoCull(const IVisibilityScene::EnumerateCallback& callback) const override;
         uint32_t GetEntryCount() const override;
         //! @}
@@ -123,6 +157,7 @@ namespace AzFramework
         uint32_t AllocateChildNodes();
         void ReleaseChildNodes(uint32_t nodeIndex);
         OctreeNode* GetChildNodesAtIndex(uint32_t nodeIndex) const;
+        OctreeChildBounds* GetChildBoundsAtIndex(uint32_t nodeIndex) const;
 
         mutable AZStd::shared_mutex m_sharedMutex;
 
@@ -135,7 +170,14 @@ namespace AzFramework
         static constexpr uint32_t BlockSize = 8192; //< This represents the number of nodes that can be stored in each page
         static_assert(BlockSize < 0xFFFF, "BlockSize must be less than 2^16");
 
-        using OctreeNodePage = AZStd::fixed_vector<OctreeNode, BlockSize>;
+        static constexpr uint32_t MinChildNodeCount = 4; //< The number of child nodes of a quadtree node
+        static_assert(BlockSize % OctreeChildBounds::MaxChildNodeCount == 0, "BlockSize must be a multiple of the number of child nodes");
+
+        struct OctreeNodePage
+        {
+            AZStd::fixed_vector<OctreeNode, BlockSize> m_nodes;
+            OctreeChildBounds m_childBounds[BlockSize / MinChildNodeCount]; //< The SoA bounds of each block of child nodes in m_nodes
+        };
         AZStd::vector<OctreeNodePage*> m_nodeCache; //< Array of contiguous memory blocks for all allocated nodes within the tree.
         AZStd::stack<uint32_t> m_freeOctreeNodes; //< Indices of free nodes, each entry represents a contiguous block of free OctreeNodeChildCount nodes.
 
@@ -37,6 +37,7 @@ set(FILES
     Archive/ZipDirCacheFactory.h
     Archive/ZipDirFind.h
     Archive/ZipDirList.h
+    Archive/ZipDirMappedFile.h
     Archive/ZipDirStructures.h
     Archive/ZipDirTree.h
     Archive/ZipFileFormat.h
@@ -284,6 +285,8 @@ set(FILES
     Spawnable/Spawnable.h
     Spawnable/SpawnableAssetHandler.h
     Spawnable/SpawnableAssetHandler.cpp
+    Spawnable/SpawnableCellStreamer.h
+    Spawnable/SpawnableCellStreamer.cpp
     Spawnable/SpawnableEntitiesContainer.h
     Spawnable/SpawnableEntitiesContainer.cpp
     Spawnable/SpawnableEntitiesInterface.h
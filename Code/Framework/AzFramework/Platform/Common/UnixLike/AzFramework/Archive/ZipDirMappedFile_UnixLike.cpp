@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzFramework/Archive/ZipDirMappedFile.h>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace AZ::IO::ZipDir
+{
+    MappedFile::~MappedFile()
+    {
+        Unmap();
+    }
+
+    bool MappedFile::Map(const char* filePath)
+    {
+        Unmap();
+
+        int fileDescriptor = open(filePath, O_RDONLY | O_CLOEXEC);
+        if (fileDescriptor == -1)
+        {
+            return false;
+        }
+
+        struct stat fileStat;
+        if (fstat(fileDescriptor, &fileStat) != 0 || fileStat.st_size <= 0)
+        {
+            close(fileDescriptor);
+            return false;
+        }
+
+        // The mapping keeps its own reference to the file, so the descriptor can be closed right away.
+        void* address = mmap(nullptr, static_cast<size_t>(fileStat.st_size), PROT_READ | PROT_WRITE, MAP_PRIVATE, fileDescriptor, 0);
+        close(fileDescriptor);
+        if (address == MAP_FAILED)
+        {
+            return false;
+        }
+
+        m_data = static_cast<const uint8_t*>(address);
+        m_size = static_cast<uint64_t>(fileStat.st_size);
+        return true;
+    }
+
+    void MappedFile::Unmap()
+    {
+        if (m_data)
+        {
+            munmap(const_cast<uint8_t*>(m_data), static_cast<size_t>(m_size));
+            m_data = nullptr;
+            m_size = 0;
+        }
+    }
+}
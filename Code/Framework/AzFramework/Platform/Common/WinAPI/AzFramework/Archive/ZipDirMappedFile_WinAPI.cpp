@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/PlatformIncl.h>
+#include <AzCore/std/string/conversions.h>
+#include <AzFramework/Archive/ZipDirMappedFile.h>
+
+namespace AZ::IO::ZipDir
+{
+    MappedFile::~MappedFile()
+    {
+        Unmap();
+    }
+
+    bool MappedFile::Map(const char* filePath)
+    {
+        Unmap();
+
+        AZStd::wstring filePathW;
+        AZStd::to_wstring(filePathW, filePath);
+        HANDLE fileHandle = CreateFileW(filePathW.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+            FILE_ATTRIBUTE_NORMAL | FILE_FLAG_RANDOM_ACCESS, nullptr);
+        if (fileHandle == INVALID_HANDLE_VALUE)
+        {
+            return false;
+        }
+
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(fileHandle, &fileSize) || fileSize.QuadPart <= 0)
+        {
+            CloseHandle(fileHandle);
+            return false;
+        }
+
+        // The mapping object keeps its own reference to the file, so the file handle can be closed right away.
+        HANDLE mappingHandle = CreateFileMappingW(fileHandle, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+        CloseHandle(fileHandle);
+        if (mappingHandle == nullptr)
+        {
+            return false;
+        }
+
+        void* address = MapViewOfFile(mappingHandle, FILE_MAP_COPY, 0, 0, 0);
+        if (address == nullptr)
+        {
+            CloseHandle(mappingHandle);
+            return false;
+        }
+
+        m_data = static_cast<const uint8_t*>(address);
+        m_size = static_cast<uint64_t>(fileSize.QuadPart);
+        m_mappingHandle = mappingHandle;
+        return true;
+    }
+
+    void MappedFile::Unmap()
+    {
+        if (m_data)
+        {
+            UnmapViewOfFile(m_data);
+            CloseHandle(static_cast<HANDLE>(m_mappingHandle));
+            m_data = nullptr;
+            m_size = 0;
+            m_mappingHandle = nullptr;
+        }
+    }
+}
@@ -30,4 +30,5 @@ set(FILES
     ../Common/Unimplemented/AzFramework/Input/Devices/VirtualKeyboard/InputDeviceVirtualKeyboard_Unimplemented.cpp
     AzFramework/Archive/ArchiveVars_Platform.h
     AzFramework/Archive/ArchiveVars_Linux.h
+    ../Common/UnixLike/AzFramework/Archive/ZipDirMappedFile_UnixLike.cpp
 )
@@ -32,6 +32,7 @@ set(FILES
     ../Common/Unimplemented/AzFramework/Input/Devices/VirtualKeyboard/InputDeviceVirtualKeyboard_Unimplemented.cpp
     AzFramework/Archive/ArchiveVars_Platform.h
     AzFramework/Archive/ArchiveVars_Mac.h
+    ../Common/UnixLike/AzFramework/Archive/ZipDirMappedFile_UnixLike.cpp
     ../Common/Apple/AzFramework/Utils/SystemUtilsApple.h
     ../Common/Apple/AzFramework/Utils/SystemUtilsApple.mm
 )
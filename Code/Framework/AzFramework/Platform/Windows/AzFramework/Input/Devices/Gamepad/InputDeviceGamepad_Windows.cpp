@@ -11,6 +11,10 @@
 
 #include <AzCore/Debug/Trace.h>
 #include <AzCore/Module/DynamicModuleHandle.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/containers/mpmc_queue.h>
+#include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <AzCore/std/smart_ptr/weak_ptr.h>
 
@@ -183,16 +187,65 @@ namespace AzFramework
         //! \ref AzFramework::InputDeviceGamepad::Implementation::TickInputDevice
         void TickInputDevice() override;
 
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        //! \ref AzFramework::InputDeviceGamepad::Implementation::SetSampleRate
+        void SetSampleRate(AZ::u32 sampleRateHertz) override;
+
         ////////////////////////////////////////////////////////////////////////////////////////////
         //! \ref AzFramework::RawInputNotificationsWindows::OnRawInputDeviceChangeEvent
         void OnRawInputDeviceChangeEvent() override;
 
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        //! Copy an xinput state into the raw game-pad state and process it
+        //! \param[in] inputState The xinput state of the game-pad
+        void ProcessInputState(const XINPUT_STATE& inputState);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        //! Reset the game-pad and broadcast that it disconnected
+        void ProcessDisconnect();
+
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        //! Pop all the states sampled since the last call, processing them in order if requested.
+        //! Disconnects are always processed, so they aren't missed while the window is unfocused.
+        //! \param[in] processSampledStates Should the sampled states be processed or discarded?
+        //! \return True if at least one sampled state was processed, false otherwise
+        bool PopSampledStates(bool processSampledStates);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        //! Start and stop the thread that samples the game-pad at m_samplingInterval
+        ///@{
+        void StartSamplingThread();
+        void StopSamplingThread();
+        ///@}
+
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        //! Main loop of the sampling thread, which pushes each new state of a connected game-pad
+        void SamplingThreadMain();
+
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        //! Game-pad state sampled by the sampling thread
+        struct SampledState
+        {
+            XINPUT_STATE m_inputState; //!< The sampled xinput state, only valid when m_result is ERROR_SUCCESS
+            DWORD        m_result;     //!< The result of XInputGetState
+        };
+
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        //! Max number of sampled states waiting to be processed, over a second at the max sample rate
+        static constexpr size_t SampledStateQueueCapacity = 1024;
+
         ////////////////////////////////////////////////////////////////////////////////////////////
         // Variables
         AZStd::shared_ptr<AZ::DynamicModuleHandle> m_xinputModuleHandle; //!< Handle to the xinput module
         RawGamepadState                            m_rawGamepadState;    //!< The last known raw game-pad state
         bool                                       m_isConnected;        //!< Is this game-pad currently connected?
         bool                                       m_tryConnect;         //!< Check whether this game-pad just connected?
+
+        AZStd::bounded_mpmc_queue<SampledState>    m_sampledStates;      //!< States pushed by the sampling thread
+        AZStd::thread                              m_samplingThread;     //!< Thread sampling the game-pad
+        AZStd::chrono::microseconds                m_samplingInterval;   //!< Time between two samples
+        AZStd::atomic_bool                         m_isSampling;         //!< Should the sampling thread keep running?
+        AZStd::atomic_bool                         m_isSamplingConnected;//!< Should the sampling thread poll xinput?
     };
 
     ////////////////////////////////////////////////////////////////////////////////////////////////
@@ -225,6 +278,11 @@ namespace AzFramework
         , m_rawGamepadState(GetDigitalButtonIdByBitMaskMap())
         , m_isConnected(false)
         , m_tryConnect(true)
+        , m_sampledStates(SampledStateQueueCapacity)
+        , m_samplingThread()
+        , m_samplingInterval(0)
+        , m_isSampling(false)
+        , m_isSamplingConnected(false)
     {
         AZ_Assert(m_xinputModuleHandle, "Creating instance of InputDeviceGamepadWindows with a null XInput handle.");
         AZ_Assert(inputDevice.GetInputDeviceId().GetIndex() < InputDeviceGamepad::GetMaxSupportedGamepads(),
@@ -243,6 +301,7 @@ namespace AzFramework
     ////////////////////////////////////////////////////////////////////////////////////////////////
     InputDeviceGamepadWindows::~InputDeviceGamepadWindows()
     {
+        StopSamplingThread();
         RawInputNotificationBusWindows::Handler::BusDisconnect();
 
         // This basically defeats the purpose of using a weak_ptr in the first place, but we must
@@ -293,6 +352,22 @@ namespace AzFramework
         // keep the behaviour consistent with the mouse and keyboard implementations.
         if (::GetFocus() == nullptr)
         {
+            if (m_isSampling)
+            {
+                PopSampledStates(false);
+            }
+            return;
+        }
+
+        // While the sampling thread polls the connected game-pad, dispatch every state it sampled
+        // since the last frame. When nothing changed the last known state is processed once again
+        // so the input channels are still updated every frame, same as when polling from here.
+        if (m_isConnected && m_isSampling)
+        {
+            if (!PopSampledStates(true) && m_isConnected)
+            {
+                ProcessRawGamepadState(m_rawGamepadState);
+            }
             return;
         }
 
@@ -322,25 +397,29 @@ namespace AzFramework
                 // The game-pad connected since the last call to this function
                 m_isConnected = true;
                 BroadcastInputDeviceConnectedEvent();
+
+                // Hand the polling over to the sampling thread from the next frame
+                m_isSamplingConnected = m_isSampling.load();
             }
 
             // Always update the input channels while the game-pad is connected
-            m_rawGamepadState.m_digitalButtonStates = newInputState.Gamepad.wButtons;
-            m_rawGamepadState.m_triggerButtonLState = static_cast<float>(newInputState.Gamepad.bLeftTrigger);
-            m_rawGamepadState.m_triggerButtonRState = static_cast<float>(newInputState.Gamepad.bRightTrigger);
-            m_rawGamepadState.m_thumbStickLeftXState = static_cast<float>(newInputState.Gamepad.sThumbLX);
-            m_rawGamepadState.m_thumbStickLeftYState = static_cast<float>(newInputState.Gamepad.sThumbLY);
-            m_rawGamepadState.m_thumbStickRightXState = static_cast<float>(newInputState.Gamepad.sThumbRX);
-            m_rawGamepadState.m_thumbStickRightYState = static_cast<float>(newInputState.Gamepad.sThumbRY);
-            ProcessRawGamepadState(m_rawGamepadState);
+            ProcessInputState(newInputState);
         }
         else if (m_isConnected)
         {
             // The game-pad disconnected since the last call to this function
-            m_isConnected = false;
-            m_rawGamepadState.Reset();
-            ResetInputChannelStates();
-            BroadcastInputDeviceDisconnectedEvent();
+            ProcessDisconnect();
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    void InputDeviceGamepadWindows::SetSampleRate(AZ::u32 sampleRateHertz)
+    {
+        StopSamplingThread();
+        if (sampleRateHertz > 0)
+        {
+            m_samplingInterval = AZStd::chrono::microseconds(1000000 / sampleRateHertz);
+            StartSamplingThread();
         }
     }
 
@@ -356,4 +435,123 @@ namespace AzFramework
             m_tryConnect = true;
         }
     }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    void InputDeviceGamepadWindows::ProcessInputState(const XINPUT_STATE& inputState)
+    {
+        m_rawGamepadState.m_digitalButtonStates = inputState.Gamepad.wButtons;
+        m_rawGamepadState.m_triggerButtonLState = static_cast<float>(inputState.Gamepad.bLeftTrigger);
+        m_rawGamepadState.m_triggerButtonRState = static_cast<float>(inputState.Gamepad.bRightTrigger);
+        m_rawGamepadState.m_thumbStickLeftXState = static_cast<float>(inputState.Gamepad.sThumbLX);
+        m_rawGamepadState.m_thumbStickLeftYState = static_cast<float>(inputState.Gamepad.sThumbLY);
+        m_rawGamepadState.m_thumbStickRightXState = static_cast<float>(inputState.Gamepad.sThumbRX);
+        m_rawGamepadState.m_thumbStickRightYState = static_cast<float>(inputState.Gamepad.sThumbRY);
+        ProcessRawGamepadState(m_rawGamepadState);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    void InputDeviceGamepadWindows::ProcessDisconnect()
+    {
+        m_isConnected = false;
+        m_rawGamepadState.Reset();
+        ResetInputChannelStates();
+        BroadcastInputDeviceDisconnectedEvent();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    bool InputDeviceGamepadWindows::PopSampledStates(bool processSampledStates)
+    {
+        bool processedSampledState = false;
+        SampledState sampledState;
+        while (m_sampledStates.try_pop(sampledState))
+        {
+            if (sampledState.m_result != ERROR_SUCCESS)
+            {
+                // The sampling thread stops polling after a failure, so this is always the last state
+                if (m_isConnected)
+                {
+                    ProcessDisconnect();
+                }
+                break;
+            }
+
+            if (processSampledStates && m_isConnected)
+            {
+                ProcessInputState(sampledState.m_inputState);
+                processedSampledState = true;
+            }
+        }
+        return processedSampledState;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    void InputDeviceGamepadWindows::StartSamplingThread()
+    {
+        m_isSampling = true;
+        m_isSamplingConnected = m_isConnected;
+
+        AZStd::thread_desc threadDesc;
+        threadDesc.m_name = "Gamepad Sampling";
+        m_samplingThread = AZStd::thread([this]() { SamplingThreadMain(); }, &threadDesc);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    void InputDeviceGamepadWindows::StopSamplingThread()
+    {
+        if (!m_samplingThread.joinable())
+        {
+            return;
+        }
+
+        m_isSampling = false;
+        m_samplingThread.join();
+        m_isSamplingConnected = false;
+
+        // Any state left is discarded, polling from TickInputDevice will pick up the current one
+        SampledState sampledState;
+        while (m_sampledStates.try_pop(sampledState))
+        {
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    void InputDeviceGamepadWindows::SamplingThreadMain()
+    {
+        const AZ::u32 deviceIndex = GetInputDeviceIndex();
+        bool hasSampledState = false;
+        DWORD lastPacketNumber = 0;
+        while (m_isSampling)
+        {
+            if (!m_isSamplingConnected)
+            {
+                // Connections are only detected on the main thread, see TickInputDevice
+                hasSampledState = false;
+            }
+            else
+            {
+                SampledState sampledState;
+                ZeroMemory(&sampledState.m_inputState, sizeof(XINPUT_STATE));
+                sampledState.m_result = XInput::GetStateFunctionPointer(deviceIndex, &sampledState.m_inputState);
+                if (sampledState.m_result != ERROR_SUCCESS)
+                {
+                    // Stop polling until the main thread reconnects, retrying if the queue is full
+                    if (m_sampledStates.try_push(sampledState))
+                    {
+                        m_isSamplingConnected = false;
+                    }
+                }
+                else if (!hasSampledState || sampledState.m_inputState.dwPacketNumber != lastPacketNumber)
+                {
+                    // The packet number only changes with the state, and is only remembered once the
+                    // state has been pushed so it's pushed again next time if the queue is full.
+                    if (m_sampledStates.try_push(sampledState))
+                    {
+                        hasSampledState = true;
+                        lastPacketNumber = sampledState.m_inputState.dwPacketNumber;
+                    }
+                }
+            }
+            AZStd::this_thread::sleep_for(m_samplingInterval);
+        }
+    }
 } // namespace AzFramework
@@ -34,4 +34,5 @@ set(FILES
     ../Common/Unimplemented/AzFramework/Input/Devices/VirtualKeyboard/InputDeviceVirtualKeyboard_Unimplemented.cpp
     AzFramework/Archive/ArchiveVars_Platform.h
     AzFramework/Archive/ArchiveVars_Windows.h
+    ../Common/WinAPI/AzFramework/Archive/ZipDirMappedFile_WinAPI.cpp
 )
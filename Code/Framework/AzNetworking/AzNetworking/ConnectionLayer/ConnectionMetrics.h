@@ -120,6 +120,10 @@ namespace AzNetworking
         uint32_t m_packetsRecv  = 0;
         uint32_t m_packetsLost  = 0;
         uint32_t m_packetsAcked = 0;
+        uint32_t m_packetsPaced = 0; //< Retransmissions held back by congestion control
+
+        float m_pacingRateBytesPerSecond  = 0.0f; //< Rate congestion control currently paces the connection at
+        float m_bottleneckBytesPerSecond  = 0.0f; //< Estimated bottleneck bandwidth of the connection
 
         DatarateMetrics      m_sendDatarate;
         DatarateMetrics      m_recvDatarate;
@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ * 
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+namespace AzNetworking
+{
+    //! @class ObjectPool
+    //! @brief caches released objects so they can be reused instead of being reallocated.
+    //! Objects are not reset when they are acquired, the caller is expected to overwrite their contents.
+    //! Not thread safe, each owner is expected to keep its own pool.
+    template <typename TYPE, AZStd::size_t MAX_CACHED>
+    class ObjectPool
+    {
+    public:
+
+        using ObjectPtr = AZStd::unique_ptr<TYPE>;
+
+        ObjectPool() = default;
+        ~ObjectPool() = default;
+
+        //! Returns a cached object if one is available, otherwise allocates a new one.
+        //! @return pointer to an object owned by the caller
+        ObjectPtr Acquire();
+
+        //! Returns an object to the pool, the object is freed if the pool is already full.
+        //! @param object the object to return to the pool, may be nullptr
+        void Release(ObjectPtr&& object);
+
+        //! Frees all cached objects.
+        void Clear();
+
+        //! Returns the number of objects currently cached by the pool.
+        //! @return the number of objects currently cached by the pool
+        AZStd::size_t GetCachedCount() const;
+
+    private:
+
+        AZStd::fixed_vector<ObjectPtr, MAX_CACHED> m_cachedObjects;
+    };
+}
+
+#include <AzNetworking/DataStructures/ObjectPool.inl>
@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ * 
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+namespace AzNetworking
+{
+    template <typename TYPE, AZStd::size_t MAX_CACHED>
+    inline typename ObjectPool<TYPE, MAX_CACHED>::ObjectPtr ObjectPool<TYPE, MAX_CACHED>::Acquire()
+    {
+        if (m_cachedObjects.empty())
+        {
+            return AZStd::make_unique<TYPE>();
+        }
+
+        ObjectPtr object = AZStd::move(m_cachedObjects.back());
+        m_cachedObjects.pop_back();
+        return object;
+    }
+
+    template <typename TYPE, AZStd::size_t MAX_CACHED>
+    inline void ObjectPool<TYPE, MAX_CACHED>::Release(ObjectPtr&& object)
+    {
+        if (object != nullptr && m_cachedObjects.size() < MAX_CACHED)
+        {
+            m_cachedObjects.emplace_back(AZStd::move(object));
+        }
+        object = nullptr;
+    }
+
+    template <typename TYPE, AZStd::size_t MAX_CACHED>
+    inline void ObjectPool<TYPE, MAX_CACHED>::Clear()
+    {
+        m_cachedObjects.clear();
+    }
+
+    template <typename TYPE, AZStd::size_t MAX_CACHED>
+    inline AZStd::size_t ObjectPool<TYPE, MAX_CACHED>::GetCachedCount() const
+    {
+        return m_cachedObjects.size();
+    }
+}
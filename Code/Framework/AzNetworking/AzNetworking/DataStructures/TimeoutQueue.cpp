@@ -15,7 +15,7 @@ namespace AzNetworking
     void TimeoutQueue::Reset()
     {
         m_timeoutItemMap.clear();
-        m_timeoutItemQueue = TimeoutItemQueue();
+        m_timeoutItemWheel.Reset();
         m_nextTimeoutId = TimeoutId{0};
     }
 
@@ -29,9 +29,9 @@ namespace AzNetworking
             aznumeric_cast<uint32_t>(timeoutTimeMs)
         );
 
-        TimeoutQueueItem queueItem(timeoutId, timeoutTimeMs);
-        m_timeoutItemMap[timeoutId] = TimeoutItem(userData, timeoutMs);
-        m_timeoutItemQueue.push(queueItem);
+        TimeoutMapItem& mapItem = m_timeoutItemMap[timeoutId];
+        mapItem.m_item = TimeoutItem(userData, timeoutMs);
+        mapItem.m_wheelId = m_timeoutItemWheel.Insert(timeoutId, timeoutTimeMs);
         ++m_nextTimeoutId;
 
         return timeoutId;
@@ -42,14 +42,22 @@ namespace AzNetworking
         TimeoutItemMap::iterator iter = m_timeoutItemMap.find(timeoutId);
         if (iter != m_timeoutItemMap.end())
         {
-            return &(iter->second);
+            return &(iter->second.m_item);
         }
         return nullptr;
     }
 
     void TimeoutQueue::RemoveItem(TimeoutId timeoutId)
     {
-        m_timeoutItemMap.erase(timeoutId);
+        TimeoutItemMap::iterator iter = m_timeoutItemMap.find(timeoutId);
+        if (iter != m_timeoutItemMap.end())
+        {
+            if (iter->second.m_wheelId != TimeoutItemWheel::InvalidId)
+            {
+                m_timeoutItemWheel.Remove(iter->second.m_wheelId);
+            }
+            m_timeoutItemMap.erase(iter);
+        }
     }
 
     void TimeoutQueue::UpdateTimeouts(ITimeoutHandler& timeoutHandler, int32_t maxTimeouts)
@@ -60,18 +68,10 @@ namespace AzNetworking
             maxTimeouts = INT_MAX;
         }
         AZ::TimeMs currentTimeMs = AZ::GetElapsedTimeMs();
-        while (m_timeoutItemQueue.size() > 0)
+        // Items time out once the current time is past their timeout time
+        const AZ::TimeMs expiredTimeMs = currentTimeMs - AZ::TimeMs{ 1 };
+        while (m_timeoutItemWheel.HasExpired(expiredTimeMs))
         {
-            const TimeoutQueueItem queueItem = m_timeoutItemQueue.top();
-            const TimeoutId    itemTimeoutId = queueItem.m_timeoutId;
-            const AZ::TimeMs   itemTimeoutMs = queueItem.m_timeoutTimeMs;
-
-            // Head item has not timed out yet, we can terminate because we've run out of timed out items
-            if (itemTimeoutMs >= currentTimeMs)
-            {
-                break;
-            }
-
             ++numTimeouts;
 
             if (numTimeouts >= maxTimeouts)
@@ -81,35 +81,38 @@ namespace AzNetworking
             }
 
             // Pop the item, we're either going to time it out or reinsert it
-            m_timeoutItemQueue.pop();
+            TimeoutId itemTimeoutId;
+            m_timeoutItemWheel.PopExpired(expiredTimeMs, itemTimeoutId);
 
             TimeoutItemMap::iterator iter = m_timeoutItemMap.find(itemTimeoutId);
-            if (iter == m_timeoutItemMap.end())
-            {
-                // Item has already been deleted, just continue
-                continue;
-            }
-
-            TimeoutItem mapItem = iter->second;
+            AZ_Assert(iter != m_timeoutItemMap.end(), "Timeout id %u is in the timing wheel but not in the item map", aznumeric_cast<uint32_t>(itemTimeoutId));
 
             // Check to see if the item has been refreshed since it was inserted
-            if (mapItem.m_nextTimeoutTimeMs > currentTimeMs)
+            if (iter->second.m_item.m_nextTimeoutTimeMs > currentTimeMs)
             {
-                TimeoutQueueItem reQueueItem(itemTimeoutId, mapItem.m_nextTimeoutTimeMs);
-                m_timeoutItemQueue.push(reQueueItem);
+                iter->second.m_wheelId = m_timeoutItemWheel.Insert(itemTimeoutId, iter->second.m_item.m_nextTimeoutTimeMs);
                 continue;
             }
 
             // By this point, the item is definitely timed out
-            // Invoke the timeout function to see how to proceed
+            // Invoke the timeout function to see how to proceed, the handler may remove or register items
+            iter->second.m_wheelId = TimeoutItemWheel::InvalidId;
+            TimeoutItem mapItem = iter->second.m_item;
             const TimeoutResult result = timeoutHandler.HandleTimeout(mapItem);
 
+            iter = m_timeoutItemMap.find(itemTimeoutId);
+            if (iter == m_timeoutItemMap.end())
+            {
+                // Item has been removed by the handler
+                continue;
+            }
+
             if (result == TimeoutResult::Refresh)
             {
                 mapItem.UpdateTimeoutTime(currentTimeMs);
-                // Re-insert into priority queue
-                TimeoutQueueItem reQueueItem(itemTimeoutId, mapItem.m_nextTimeoutTimeMs);
-                m_timeoutItemQueue.push(reQueueItem);
+                // Re-insert into the timing wheel
+                iter->second.m_item = mapItem;
+                iter->second.m_wheelId = m_timeoutItemWheel.Insert(itemTimeoutId, mapItem.m_nextTimeoutTimeMs);
                 continue;
             }
 
@@ -118,7 +121,7 @@ namespace AzNetworking
                 mapItem.m_userData,
                 aznumeric_cast<uint32_t>(mapItem.m_nextTimeoutTimeMs),
                 aznumeric_cast<uint32_t>(currentTimeMs));
-            m_timeoutItemMap.erase(itemTimeoutId);
+            m_timeoutItemMap.erase(iter);
         }
     }
 }
@@ -8,9 +8,9 @@
 #pragma once
 
 #include <AzCore/Time/ITime.h>
+#include <AzCore/Time/TimingWheel.h>
 #include <AzCore/RTTI/TypeSafeIntegral.h>
-#include <AzCore/std/containers/map.h>
-#include <AzCore/std/containers/queue.h>
+#include <AzCore/std/containers/unordered_map.h>
 
 namespace AzNetworking
 {
@@ -70,22 +70,20 @@ namespace AzNetworking
 
     private:
 
-        struct TimeoutQueueItem
-        {
-            TimeoutQueueItem(TimeoutId timeoutId, AZ::TimeMs timeoutTimeMs);
-
-            bool operator < (const TimeoutQueueItem &rhs) const;
+        using TimeoutItemWheel = AZ::TimingWheel<TimeoutId>;
 
-            TimeoutId m_timeoutId;
-            AZ::TimeMs m_timeoutTimeMs;
+        struct TimeoutMapItem
+        {
+            TimeoutItem m_item;
+            //! Entry of the item in the timing wheel, invalid while its timeout is being handled
+            TimeoutItemWheel::Id m_wheelId = TimeoutItemWheel::InvalidId;
         };
 
-        using TimeoutItemMap   = AZStd::map<TimeoutId, TimeoutItem>;
-        using TimeoutItemQueue = AZStd::priority_queue<TimeoutQueueItem>;
+        using TimeoutItemMap = AZStd::unordered_map<TimeoutId, TimeoutMapItem>;
 
         TimeoutId        m_nextTimeoutId = TimeoutId{ 0 };
         TimeoutItemMap   m_timeoutItemMap;
-        TimeoutItemQueue m_timeoutItemQueue;
+        TimeoutItemWheel m_timeoutItemWheel;
     };
 
     //! @class ITimeoutHandler
@@ -21,16 +21,4 @@ namespace AzNetworking
     {
         m_nextTimeoutTimeMs = currentTimeMs + m_timeoutMs;
     }
-
-    inline TimeoutQueue::TimeoutQueueItem::TimeoutQueueItem(TimeoutId timeoutId, AZ::TimeMs timeoutTimeMs)
-        : m_timeoutId(timeoutId)
-        , m_timeoutTimeMs(timeoutTimeMs)
-    {
-        ;
-    }
-
-    inline bool TimeoutQueue::TimeoutQueueItem::operator <(const TimeoutQueueItem& rhs) const
-    {
-        return rhs.m_timeoutTimeMs < m_timeoutTimeMs;
-    }
 }
@@ -8,6 +8,7 @@
 #include <AzNetworking/Framework/NetworkingSystemComponent.h>
 #include <AzNetworking/TcpTransport/TcpNetworkInterface.h>
 #include <AzNetworking/UdpTransport/UdpNetworkInterface.h>
+#include <AzNetworking/AzNetworking_Traits_Platform.h>
 #include <AzCore/Interface/Interface.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Console/ILogger.h>
@@ -15,6 +16,10 @@
 
 namespace AzNetworking
 {
+    AZ_CVAR(uint32_t, net_UdpReaderThreadCount, 1, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "The number of threads that read UDP packets. Listening sockets are sharded across them by client address using port reuse. "
+        "Only read when the networking system starts");
+
     void NetworkingSystemComponent::Reflect(AZ::ReflectContext* context)
     {
         if (AZ::SerializeContext* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
@@ -41,7 +46,16 @@ namespace AzNetworking
         AZ::Interface<INetworking>::Register(this);
 
         m_listenThread = AZStd::make_unique<TcpListenThread>();
-        m_readerThread = AZStd::make_unique<UdpReaderThread>();
+
+        uint32_t readerThreadCount = AZStd::max(static_cast<uint32_t>(net_UdpReaderThreadCount), 1u);
+#if !AZ_TRAIT_USE_SOCKET_REUSEPORT
+        AZ_Warning("NetworkingSystemComponent", readerThreadCount == 1, "Multiple UDP reader threads require port reuse, which is not supported on this platform");
+        readerThreadCount = 1;
+#endif
+        for (uint32_t i = 0; i < readerThreadCount; ++i)
+        {
+            m_readerThreads.emplace_back(AZStd::make_unique<UdpReaderThread>());
+        }
     }
 
     NetworkingSystemComponent::~NetworkingSystemComponent()
@@ -51,7 +65,7 @@ namespace AzNetworking
 
         m_compressorFactories.clear();
 
-        m_readerThread = nullptr;
+        m_readerThreads.clear();
         m_listenThread = nullptr;
 
         AZ::Interface<INetworking>::Unregister(this);
@@ -72,7 +86,10 @@ namespace AzNetworking
     void NetworkingSystemComponent::OnTick(float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
     {
         AZ::TimeMs elapsedMs = aznumeric_cast<AZ::TimeMs>(aznumeric_cast<int64_t>(deltaTime / 1000.0f));
-        m_readerThread->SwapBuffers();
+        for (auto& readerThread : m_readerThreads)
+        {
+            readerThread->SwapBuffers();
+        }
         for (auto& networkInterface : m_networkInterfaces)
         {
             networkInterface.second->Update(elapsedMs);
@@ -95,7 +112,7 @@ namespace AzNetworking
             result = AZStd::make_unique<TcpNetworkInterface>(name, listener, trustZone, *m_listenThread);
             break;
         case ProtocolType::Udp:
-            result = AZStd::make_unique<UdpNetworkInterface>(name, listener, trustZone, *m_readerThread);
+            result = AZStd::make_unique<UdpNetworkInterface>(name, listener, trustZone, m_readerThreads);
             break;
         }
         INetworkInterface* returnResult = result.get();
@@ -161,12 +178,22 @@ namespace AzNetworking
 
     uint32_t NetworkingSystemComponent::GetUdpReaderThreadSocketCount() const
     {
-        return m_readerThread->GetSocketCount();
+        uint32_t socketCount = 0;
+        for (const auto& readerThread : m_readerThreads)
+        {
+            socketCount += readerThread->GetSocketCount();
+        }
+        return socketCount;
     }
 
     AZ::TimeMs NetworkingSystemComponent::GetUdpReaderThreadUpdateTime() const
     {
-        return m_readerThread->GetUpdateTimeMs();
+        AZ::TimeMs updateTimeMs = AZ::TimeMs{ 0 };
+        for (const auto& readerThread : m_readerThreads)
+        {
+            updateTimeMs += readerThread->GetUpdateTimeMs();
+        }
+        return updateTimeMs;
     }
 
     void NetworkingSystemComponent::DumpStats([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
@@ -76,7 +76,7 @@ namespace AzNetworking
 
         NetworkInterfaces m_networkInterfaces;
         AZStd::unique_ptr<TcpListenThread> m_listenThread;
-        AZStd::unique_ptr<UdpReaderThread> m_readerThread;
+        UdpReaderThreads m_readerThreads;
 
         using CompressionFactories = AZStd::unordered_map<AZ::Name, AZStd::unique_ptr<ICompressorFactory>>;
         CompressionFactories m_compressorFactories;
@@ -6,8 +6,6 @@
  */
 
 #include <AzNetworking/Serialization/DeltaSerializer.h>
-#include <AzNetworking/Serialization/NetworkInputSerializer.h>
-#include <AzNetworking/Serialization/NetworkOutputSerializer.h>
 #include <AzCore/std/string/conversions.h>
 
 namespace AzNetworking
@@ -34,6 +32,17 @@ namespace AzNetworking
         return m_dirtyBits.PushBack(dirtyBit);
     }
 
+    bool SerializerDelta::AnyDirtyBits() const
+    {
+        return m_dirtyBits.AnySet();
+    }
+
+    void SerializerDelta::Clear()
+    {
+        m_dirtyBits.Clear();
+        m_deltaBytes.Resize(0);
+    }
+
     uint8_t* SerializerDelta::GetBufferPtr()
     {
         return m_deltaBytes.GetBuffer();
@@ -9,12 +9,13 @@
 
 #include <AzNetworking/Serialization/ISerializer.h>
 #include <AzNetworking/Serialization/AbstractValue.h>
-#include <AzNetworking/Serialization/NetworkInputSerializer.h>
-#include <AzNetworking/Serialization/NetworkOutputSerializer.h>
+#include <AzNetworking/Serialization/NetworkBitInputSerializer.h>
+#include <AzNetworking/Serialization/NetworkBitOutputSerializer.h>
 #include <AzNetworking/DataStructures/FixedSizeVectorBitset.h>
 #include <AzNetworking/DataStructures/ByteBuffer.h>
 #include <AzCore/Utils/TypeHash.h>
 #include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/typetraits/is_trivially_copyable.h>
 
 namespace AzNetworking
 {
@@ -30,6 +31,13 @@ namespace AzNetworking
         bool GetDirtyBit(uint32_t index) const;
         bool InsertDirtyBit(bool dirtyBit);
 
+        //! Returns true if any of the serialized fields differ from the base object.
+        //! @return boolean true if at least one dirty bit is set
+        bool AnyDirtyBits() const;
+
+        //! Resets the delta to the empty delta, which applies no changes to the base object.
+        void Clear();
+
         uint8_t* GetBufferPtr();
         uint32_t GetBufferSize() const;
         uint32_t GetBufferCapacity() const;
@@ -47,6 +55,8 @@ namespace AzNetworking
     //! A serializer that is used to produce a SerializerDelta between two objects.
     //! This delta can be reapplied to the same base object to reconstruct the second object using 
     //! the DeltaSerializerApply serializer
+    //! Changed values are written bit-packed (see NetworkBitInputSerializer), and unchanged objects produce an empty delta.
+    //! Trivially copyable objects are compared as a single memory block first, so unchanged objects skip per-field comparison entirely.
     //! NOTE: The objects serialized must have a consistent serialization footprint i.e. no changes in branches during serialization
     class DeltaSerializerCreate
         : public ISerializer
@@ -107,7 +117,7 @@ namespace AzNetworking
         AZStd::string m_namePrefix;
         AZStd::vector<size_t> m_nameLengthStack;
         AZStd::unordered_map<AZ::HashValue32, AbstractValue::BaseValue*> m_records;
-        NetworkInputSerializer m_dataSerializer;
+        NetworkBitInputSerializer m_dataSerializer;
     };
 
     //! A serializer that is used to apply a SerializerDelta to a base object in order to reconstruct the second object.
@@ -163,7 +173,7 @@ namespace AzNetworking
 
         SerializerDelta& m_delta;
         uint32_t m_nextDirtyBit = 0;
-        NetworkOutputSerializer m_dataSerializer;
+        NetworkBitOutputSerializer m_dataSerializer;
     };
 }
 
@@ -12,6 +12,16 @@ namespace AzNetworking
     template <typename TYPE>
     bool DeltaSerializerCreate::CreateDelta(TYPE& base, TYPE& current)
     {
+        if constexpr (AZStd::is_trivially_copyable_v<TYPE>)
+        {
+            // Flat objects can be compared as a single block, a mismatch in padding just falls back to the per-field comparison below
+            if (memcmp(&base, &current, sizeof(TYPE)) == 0)
+            {
+                m_delta.Clear();
+                return true;
+            }
+        }
+
         // Gather value records from the base object
         m_gatheringRecords = true;
         if (!base.Serialize(*this))
@@ -27,6 +37,13 @@ namespace AzNetworking
             return false;
         }
 
+        if (!m_delta.AnyDirtyBits())
+        {
+            // Nothing changed, so don't spend a bit per field telling the remote endpoint so
+            m_delta.Clear();
+            return true;
+        }
+
         // Update the delta buffer size based on how much data was serialized
         m_delta.SetBufferSize(m_dataSerializer.GetSize());
         return true;
@@ -35,6 +52,12 @@ namespace AzNetworking
     template <typename TYPE>
     bool DeltaSerializerApply::ApplyDelta(TYPE& output)
     {
+        if (m_delta.GetNumDirtyBits() == 0)
+        {
+            // An empty delta means the object is unchanged from the base
+            return true;
+        }
+
         return output.Serialize(*this);
     }
 }
@@ -0,0 +1,212 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/Serialization/NetworkBitInputSerializer.h>
+#include <AzCore/std/algorithm.h>
+#include <memory>
+
+namespace AzNetworking
+{
+    NetworkBitInputSerializer::NetworkBitInputSerializer(uint8_t* buffer, uint32_t bufferCapacity)
+        : m_bitOffset(0)
+        , m_bufferCapacity(bufferCapacity)
+        , m_buffer(buffer)
+    {
+        ;
+    }
+
+    bool NetworkBitInputSerializer::WriteBits(uint64_t value, uint32_t bitCount)
+    {
+        AZ_Assert(bitCount <= 64, "At most 64 bits can be written at a time");
+        if (!m_serializerValid || (static_cast<uint64_t>(m_bitOffset) + bitCount > static_cast<uint64_t>(m_bufferCapacity) * 8))
+        {
+            // Keep the failed boolean so we can verify serialization success
+            m_serializerValid = false;
+            return false;
+        }
+
+        while (bitCount > 0)
+        {
+            const uint32_t byteIndex = m_bitOffset >> 3;
+            const uint32_t bitIndex = m_bitOffset & 7;
+            const uint32_t writeCount = AZStd::min<uint32_t>(8 - bitIndex, bitCount);
+            const uint8_t writeMask = static_cast<uint8_t>((1u << writeCount) - 1);
+
+            // Bytes are written front to back, so the first write into a byte also clears any stale contents
+            const uint8_t existingBits = (bitIndex == 0) ? 0 : m_buffer[byteIndex];
+            m_buffer[byteIndex] = existingBits | static_cast<uint8_t>((static_cast<uint8_t>(value) & writeMask) << bitIndex);
+
+            value >>= writeCount;
+            bitCount -= writeCount;
+            m_bitOffset += writeCount;
+        }
+        return true;
+    }
+
+    uint32_t NetworkBitInputSerializer::GetSizeInBits() const
+    {
+        return m_bitOffset;
+    }
+
+    SerializerMode NetworkBitInputSerializer::GetSerializerMode() const
+    {
+        return SerializerMode::ReadFromObject;
+    }
+
+    bool NetworkBitInputSerializer::Serialize(bool& value, [[maybe_unused]] const char* name)
+    {
+        return WriteBits(value ? 1 : 0, 1);
+    }
+
+    bool NetworkBitInputSerializer::Serialize(char& value, [[maybe_unused]] const char* name, char minValue, char maxValue)
+    {
+        return SerializeBoundedValue<char>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitInputSerializer::Serialize(int8_t& value, [[maybe_unused]] const char* name, int8_t minValue, int8_t maxValue)
+    {
+        return SerializeBoundedValue<int8_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitInputSerializer::Serialize(int16_t& value, [[maybe_unused]] const char* name, int16_t minValue, int16_t maxValue)
+    {
+        return SerializeBoundedValue<int16_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitInputSerializer::Serialize(int32_t& value, [[maybe_unused]] const char* name, int32_t minValue, int32_t maxValue)
+    {
+        return SerializeBoundedValue<int32_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitInputSerializer::Serialize(int64_t& value, [[maybe_unused]] const char* name, int64_t minValue, int64_t maxValue)
+    {
+        return SerializeBoundedValue<int64_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitInputSerializer::Serialize(uint8_t& value, [[maybe_unused]] const char* name, uint8_t minValue, uint8_t maxValue)
+    {
+        return SerializeBoundedValue<uint8_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitInputSerializer::Serialize(uint16_t& value, [[maybe_unused]] const char* name, uint16_t minValue, uint16_t maxValue)
+    {
+        return SerializeBoundedValue<uint16_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitInputSerializer::Serialize(uint32_t& value, [[maybe_unused]] const char* name, uint32_t minValue, uint32_t maxValue)
+    {
+        return SerializeBoundedValue<uint32_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitInputSerializer::Serialize(uint64_t& value, [[maybe_unused]] const char* name, uint64_t minValue, uint64_t maxValue)
+    {
+        return SerializeBoundedValue<uint64_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitInputSerializer::Serialize(float& value, [[maybe_unused]] const char* name, [[maybe_unused]] float minValue, [[maybe_unused]] float maxValue)
+    {
+        uint32_t bits = 0;
+        memcpy(&bits, &value, sizeof(float));
+        return WriteBits(bits, 32);
+    }
+
+    bool NetworkBitInputSerializer::Serialize(double& value, [[maybe_unused]] const char* name, [[maybe_unused]] double minValue, [[maybe_unused]] double maxValue)
+    {
+        uint64_t bits = 0;
+        memcpy(&bits, &value, sizeof(double));
+        return WriteBits(bits, 64);
+    }
+
+    bool NetworkBitInputSerializer::SerializeBytes(uint8_t* buffer, uint32_t bufferCapacity, [[maybe_unused]] bool isString, uint32_t& outSize, [[maybe_unused]] const char* name)
+    {
+        if (!SerializeBoundedValue<uint32_t>(0, bufferCapacity, outSize))
+        {
+            return false;
+        }
+
+        for (uint32_t i = 0; i < outSize; ++i)
+        {
+            if (!WriteBits(buffer[i], 8))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool NetworkBitInputSerializer::BeginObject([[maybe_unused]] const char* name, [[maybe_unused]] const char* typeName)
+    {
+        return true;
+    }
+
+    bool NetworkBitInputSerializer::EndObject([[maybe_unused]] const char* name, [[maybe_unused]] const char* typeName)
+    {
+        return true;
+    }
+
+    const uint8_t* NetworkBitInputSerializer::GetBuffer() const
+    {
+        return m_buffer;
+    }
+
+    uint32_t NetworkBitInputSerializer::GetCapacity() const
+    {
+        return m_bufferCapacity;
+    }
+
+    uint32_t NetworkBitInputSerializer::GetSize() const
+    {
+        // Partially written bytes still have to be sent
+        return (m_bitOffset + 7) >> 3;
+    }
+
+    template <typename ORIGINAL_TYPE>
+    bool NetworkBitInputSerializer::SerializeBoundedValue(ORIGINAL_TYPE minValue, ORIGINAL_TYPE maxValue, ORIGINAL_TYPE inputValue)
+    {
+        using UnsignedType = AZStd::make_unsigned_t<ORIGINAL_TYPE>;
+
+        m_serializerValid &= (inputValue >= minValue);
+        m_serializerValid &= (inputValue <= maxValue);
+        if (!m_serializerValid)
+        {
+            return false;
+        }
+
+        const UnsignedType valueRange = static_cast<UnsignedType>(static_cast<UnsignedType>(maxValue) - static_cast<UnsignedType>(minValue));
+        if (UseBitPackedVarInt<ORIGINAL_TYPE>(valueRange))
+        {
+            if constexpr (AZStd::is_signed_v<ORIGINAL_TYPE>)
+            {
+                // Zigzag encode so small negative values also produce short encodings
+                const UnsignedType zigzag = static_cast<UnsignedType>((static_cast<UnsignedType>(inputValue) << 1) ^ static_cast<UnsignedType>(inputValue >> (sizeof(ORIGINAL_TYPE) * 8 - 1)));
+                return SerializeVarInt(zigzag);
+            }
+            else
+            {
+                return SerializeVarInt(inputValue);
+            }
+        }
+
+        const UnsignedType valueOffset = static_cast<UnsignedType>(static_cast<UnsignedType>(inputValue) - static_cast<UnsignedType>(minValue));
+        return WriteBits(valueOffset, GetBitPackedWidth(valueRange));
+    }
+
+    bool NetworkBitInputSerializer::SerializeVarInt(uint64_t value)
+    {
+        // Seven bits of payload per group, with the high bit flagging that another group follows
+        do
+        {
+            const uint64_t group = value & 0x7F;
+            value >>= 7;
+            if (!WriteBits(group | ((value != 0) ? 0x80 : 0), 8))
+            {
+                return false;
+            }
+        } while (value != 0);
+        return true;
+    }
+}
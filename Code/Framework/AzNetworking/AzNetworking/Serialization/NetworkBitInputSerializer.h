@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzNetworking/Serialization/ISerializer.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/typetraits/is_signed.h>
+#include <AzCore/std/typetraits/is_unsigned.h>
+
+namespace AzNetworking
+{
+    //! Number of bits used to encode a value offset in [0, valueRange].
+    //! @param valueRange maximum offset from the minimum value that needs to be encodable
+    //! @return the number of bits required, zero if the range only contains a single value
+    inline uint32_t GetBitPackedWidth(uint64_t valueRange)
+    {
+        uint32_t bitCount = 0;
+        while (valueRange > 0)
+        {
+            valueRange >>= 1;
+            ++bitCount;
+        }
+        return bitCount;
+    }
+
+    //! Unbounded 32 and 64 bit values are mostly small, so they're written as variable width integers instead of spending the full width.
+    //! Smaller types are always written with the exact number of bits needed for their range.
+    //! @param valueRange the range between the minimum and maximum value of the serialized value
+    //! @return true if the value is encoded as a variable width integer
+    template <typename ORIGINAL_TYPE>
+    constexpr bool UseBitPackedVarInt(AZStd::make_unsigned_t<ORIGINAL_TYPE> valueRange)
+    {
+        return (sizeof(ORIGINAL_TYPE) >= sizeof(uint32_t)) && (valueRange == AZStd::numeric_limits<AZStd::make_unsigned_t<ORIGINAL_TYPE>>::max());
+    }
+
+    //! @class NetworkBitInputSerializer
+    //! @brief Input serializer for writing an object model into a bit-packed bytestream.
+    //! Unlike NetworkInputSerializer, values are not byte aligned. Bounded values use the minimum number of bits for their range,
+    //! booleans use a single bit and unbounded 32 and 64 bit integers use a variable width encoding with signed values zigzag encoded.
+    //! Quantized floats (see QuantizedValues) are serialized as bounded integers and therefore pack to exactly their quantized width.
+    //! Streams must be read back with a NetworkBitOutputSerializer, the encodings are not compatible with each other.
+    class NetworkBitInputSerializer final
+        : public ISerializer
+    {
+    public:
+
+        //! Constructor.
+        //! @param buffer         input buffer to write to
+        //! @param bufferCapacity capacity of the buffer in bytes
+        NetworkBitInputSerializer(uint8_t* buffer, uint32_t bufferCapacity);
+
+        //! Writes the lowest bitCount bits of the provided value into the serialization output buffer.
+        //! @param value    the value to write
+        //! @param bitCount number of bits to write, at most 64
+        //! @return boolean true on success, false if there was insufficient space to store all the bits
+        bool WriteBits(uint64_t value, uint32_t bitCount);
+
+        //! Returns the number of bits written to the serialization output buffer.
+        //! @return number of bits written to the serialization output buffer
+        uint32_t GetSizeInBits() const;
+
+        // ISerializer interfaces
+        SerializerMode GetSerializerMode() const override;
+        bool Serialize(    bool& value, const char* name) override;
+        bool Serialize(    char& value, const char* name,     char minValue,     char maxValue) override;
+        bool Serialize(  int8_t& value, const char* name,   int8_t minValue,   int8_t maxValue) override;
+        bool Serialize( int16_t& value, const char* name,  int16_t minValue,  int16_t maxValue) override;
+        bool Serialize( int32_t& value, const char* name,  int32_t minValue,  int32_t maxValue) override;
+        bool Serialize( int64_t& value, const char* name,  int64_t minValue,  int64_t maxValue) override;
+        bool Serialize( uint8_t& value, const char* name,  uint8_t minValue,  uint8_t maxValue) override;
+        bool Serialize(uint16_t& value, const char* name, uint16_t minValue, uint16_t maxValue) override;
+        bool Serialize(uint32_t& value, const char* name, uint32_t minValue, uint32_t maxValue) override;
+        bool Serialize(uint64_t& value, const char* name, uint64_t minValue, uint64_t maxValue) override;
+        bool Serialize(   float& value, const char* name,    float minValue,    float maxValue) override;
+        bool Serialize(  double& value, const char* name,   double minValue,   double maxValue) override;
+        bool SerializeBytes(uint8_t* buffer, uint32_t bufferCapacity, bool isString, uint32_t& outSize, const char* name) override;
+        bool BeginObject(const char *name, const char* typeName) override;
+        bool EndObject(const char *name, const char* typeName) override;
+
+        const uint8_t* GetBuffer() const override;
+        uint32_t GetCapacity() const override;
+        uint32_t GetSize() const override;
+        void ClearTrackedChangesFlag() override {}
+        bool GetTrackedChangesFlag() const override { return false; }
+        // ISerializer interfaces
+
+    private:
+
+        //! Private copy operator, do not allow copying instances
+        NetworkBitInputSerializer& operator=(const NetworkBitInputSerializer&) = delete;
+
+        template <typename ORIGINAL_TYPE>
+        bool SerializeBoundedValue(ORIGINAL_TYPE minValue, ORIGINAL_TYPE maxValue, ORIGINAL_TYPE inputValue);
+
+        bool SerializeVarInt(uint64_t value);
+
+        uint32_t       m_bitOffset = 0;
+        const uint32_t m_bufferCapacity;
+        uint8_t*       m_buffer;
+    };
+}
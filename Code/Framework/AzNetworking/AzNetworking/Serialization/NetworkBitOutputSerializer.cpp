@@ -0,0 +1,237 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/Serialization/NetworkBitOutputSerializer.h>
+#include <AzCore/std/algorithm.h>
+#include <memory>
+
+namespace AzNetworking
+{
+    NetworkBitOutputSerializer::NetworkBitOutputSerializer(const uint8_t* buffer, uint32_t bufferCapacity)
+        : m_bitOffset(0)
+        , m_bufferCapacity(bufferCapacity)
+        , m_buffer(buffer)
+    {
+        ;
+    }
+
+    bool NetworkBitOutputSerializer::ReadBits(uint64_t& outValue, uint32_t bitCount)
+    {
+        AZ_Assert(bitCount <= 64, "At most 64 bits can be read at a time");
+        outValue = 0;
+        if (!m_serializerValid || (static_cast<uint64_t>(m_bitOffset) + bitCount > static_cast<uint64_t>(m_bufferCapacity) * 8))
+        {
+            // Keep the failed boolean so we can verify serialization success
+            m_serializerValid = false;
+            return false;
+        }
+
+        uint32_t readBits = 0;
+        while (readBits < bitCount)
+        {
+            const uint32_t byteIndex = m_bitOffset >> 3;
+            const uint32_t bitIndex = m_bitOffset & 7;
+            const uint32_t readCount = AZStd::min<uint32_t>(8 - bitIndex, bitCount - readBits);
+            const uint8_t readMask = static_cast<uint8_t>((1u << readCount) - 1);
+
+            const uint64_t bits = static_cast<uint64_t>((m_buffer[byteIndex] >> bitIndex) & readMask);
+            outValue |= bits << readBits;
+
+            readBits += readCount;
+            m_bitOffset += readCount;
+        }
+        return true;
+    }
+
+    uint32_t NetworkBitOutputSerializer::GetReadSizeInBits() const
+    {
+        return m_bitOffset;
+    }
+
+    SerializerMode NetworkBitOutputSerializer::GetSerializerMode() const
+    {
+        return SerializerMode::WriteToObject;
+    }
+
+    bool NetworkBitOutputSerializer::Serialize(bool& value, [[maybe_unused]] const char* name)
+    {
+        uint64_t bit = 0;
+        if (ReadBits(bit, 1))
+        {
+            value = (bit != 0);
+        }
+        return m_serializerValid;
+    }
+
+    bool NetworkBitOutputSerializer::Serialize(char& value, [[maybe_unused]] const char* name, char minValue, char maxValue)
+    {
+        return SerializeBoundedValue<char>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitOutputSerializer::Serialize(int8_t& value, [[maybe_unused]] const char* name, int8_t minValue, int8_t maxValue)
+    {
+        return SerializeBoundedValue<int8_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitOutputSerializer::Serialize(int16_t& value, [[maybe_unused]] const char* name, int16_t minValue, int16_t maxValue)
+    {
+        return SerializeBoundedValue<int16_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitOutputSerializer::Serialize(int32_t& value, [[maybe_unused]] const char* name, int32_t minValue, int32_t maxValue)
+    {
+        return SerializeBoundedValue<int32_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitOutputSerializer::Serialize(int64_t& value, [[maybe_unused]] const char* name, int64_t minValue, int64_t maxValue)
+    {
+        return SerializeBoundedValue<int64_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitOutputSerializer::Serialize(uint8_t& value, [[maybe_unused]] const char* name, uint8_t minValue, uint8_t maxValue)
+    {
+        return SerializeBoundedValue<uint8_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitOutputSerializer::Serialize(uint16_t& value, [[maybe_unused]] const char* name, uint16_t minValue, uint16_t maxValue)
+    {
+        return SerializeBoundedValue<uint16_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitOutputSerializer::Serialize(uint32_t& value, [[maybe_unused]] const char* name, uint32_t minValue, uint32_t maxValue)
+    {
+        return SerializeBoundedValue<uint32_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitOutputSerializer::Serialize(uint64_t& value, [[maybe_unused]] const char* name, uint64_t minValue, uint64_t maxValue)
+    {
+        return SerializeBoundedValue<uint64_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitOutputSerializer::Serialize(float& value, [[maybe_unused]] const char* name, [[maybe_unused]] float minValue, [[maybe_unused]] float maxValue)
+    {
+        uint64_t bits = 0;
+        if (ReadBits(bits, 32))
+        {
+            const uint32_t floatBits = static_cast<uint32_t>(bits);
+            memcpy(&value, &floatBits, sizeof(float));
+        }
+        return m_serializerValid;
+    }
+
+    bool NetworkBitOutputSerializer::Serialize(double& value, [[maybe_unused]] const char* name, [[maybe_unused]] double minValue, [[maybe_unused]] double maxValue)
+    {
+        uint64_t bits = 0;
+        if (ReadBits(bits, 64))
+        {
+            memcpy(&value, &bits, sizeof(double));
+        }
+        return m_serializerValid;
+    }
+
+    bool NetworkBitOutputSerializer::SerializeBytes(uint8_t* buffer, uint32_t bufferCapacity, [[maybe_unused]] bool isString, uint32_t& outSize, [[maybe_unused]] const char* name)
+    {
+        if (!SerializeBoundedValue<uint32_t>(0, bufferCapacity, outSize))
+        {
+            return false;
+        }
+
+        for (uint32_t i = 0; i < outSize; ++i)
+        {
+            uint64_t byte = 0;
+            if (!ReadBits(byte, 8))
+            {
+                return false;
+            }
+            buffer[i] = static_cast<uint8_t>(byte);
+        }
+        return true;
+    }
+
+    bool NetworkBitOutputSerializer::BeginObject([[maybe_unused]] const char* name, [[maybe_unused]] const char* typeName)
+    {
+        return true;
+    }
+
+    bool NetworkBitOutputSerializer::EndObject([[maybe_unused]] const char* name, [[maybe_unused]] const char* typeName)
+    {
+        return true;
+    }
+
+    const uint8_t* NetworkBitOutputSerializer::GetBuffer() const
+    {
+        return m_buffer;
+    }
+
+    uint32_t NetworkBitOutputSerializer::GetCapacity() const
+    {
+        return m_bufferCapacity;
+    }
+
+    uint32_t NetworkBitOutputSerializer::GetSize() const
+    {
+        return (m_bitOffset + 7) >> 3;
+    }
+
+    template <typename ORIGINAL_TYPE>
+    bool NetworkBitOutputSerializer::SerializeBoundedValue(ORIGINAL_TYPE minValue, ORIGINAL_TYPE maxValue, ORIGINAL_TYPE& outValue)
+    {
+        using UnsignedType = AZStd::make_unsigned_t<ORIGINAL_TYPE>;
+
+        const UnsignedType valueRange = static_cast<UnsignedType>(static_cast<UnsignedType>(maxValue) - static_cast<UnsignedType>(minValue));
+        if (UseBitPackedVarInt<ORIGINAL_TYPE>(valueRange))
+        {
+            uint64_t encoded = 0;
+            if (SerializeVarInt(encoded))
+            {
+                const UnsignedType unsignedValue = static_cast<UnsignedType>(encoded);
+                if constexpr (AZStd::is_signed_v<ORIGINAL_TYPE>)
+                {
+                    // Undo the zigzag encoding applied by NetworkBitInputSerializer
+                    outValue = static_cast<ORIGINAL_TYPE>((unsignedValue >> 1) ^ static_cast<UnsignedType>(0 - (unsignedValue & 1)));
+                }
+                else
+                {
+                    outValue = unsignedValue;
+                }
+            }
+            return m_serializerValid;
+        }
+
+        uint64_t valueOffset = 0;
+        if (ReadBits(valueOffset, GetBitPackedWidth(valueRange)))
+        {
+            // Reject offsets that fall outside of the range, the stream is either corrupt or was written with different bounds
+            m_serializerValid &= (valueOffset <= valueRange);
+            outValue = m_serializerValid ? static_cast<ORIGINAL_TYPE>(static_cast<UnsignedType>(minValue) + static_cast<UnsignedType>(valueOffset)) : outValue;
+        }
+        return m_serializerValid;
+    }
+
+    bool NetworkBitOutputSerializer::SerializeVarInt(uint64_t& outValue)
+    {
+        outValue = 0;
+        for (uint32_t shift = 0; shift < 64; shift += 7)
+        {
+            uint64_t group = 0;
+            if (!ReadBits(group, 8))
+            {
+                return false;
+            }
+
+            outValue |= (group & 0x7F) << shift;
+            if ((group & 0x80) == 0)
+            {
+                return true;
+            }
+        }
+
+        // More groups than a 64 bit value can hold, the stream is corrupt
+        m_serializerValid = false;
+        return false;
+    }
+}
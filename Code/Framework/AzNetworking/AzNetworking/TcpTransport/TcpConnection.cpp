@@ -123,69 +123,85 @@ namespace AzNetworking
         const AZ::TimeMs startTimeMs = AZ::GetElapsedTimeMs();
         GetMetrics().m_recvDatarate.LogPacket(0, startTimeMs);
 
-        // Read new data off the input socket
+        // Sockets are registered edge triggered with epoll, so keep reading until the socket is drained
+        // Data is received directly into the ringbuffer and packets are processed in place after every read
+        for (;;)
         {
-            uint8_t* srcData = m_recvRingbuffer.ReserveBlockForWrite(MaxPacketSize);
-            if (srcData == nullptr)
+            // Read new data off the input socket
             {
-                AZLOG_ERROR("Receive ringbuffer full, dropped connection");
-                Disconnect(DisconnectReason::StreamError, TerminationEndpoint::Local);
-                return false;
-            }
+                uint8_t* srcData = m_recvRingbuffer.ReserveBlockForWrite(MaxPacketSize);
+                if (srcData == nullptr)
+                {
+                    AZLOG_ERROR("Receive ringbuffer full, dropped connection");
+                    Disconnect(DisconnectReason::StreamError, TerminationEndpoint::Local);
+                    return false;
+                }
 
-            const int32_t receivedBytes = m_socket->Receive(srcData, MaxPacketSize);
-            if (receivedBytes == 0)
-            {
-                // No data on the socket, can happen if we're not in select or epoll mode
-                return true;
-            }
+                const int32_t receivedBytes = m_socket->Receive(srcData, MaxPacketSize);
+                if (receivedBytes == 0)
+                {
+                    // No more data on the socket, can also happen if we're not in select or epoll mode
+                    break;
+                }
 
-            const DisconnectReason disconnectReason = GetDisconnectReasonForSocketResult(receivedBytes);
-            if (disconnectReason != DisconnectReason::MAX)
-            {
-                Disconnect(disconnectReason, TerminationEndpoint::Remote);
-                return true;
+                const DisconnectReason disconnectReason = GetDisconnectReasonForSocketResult(receivedBytes);
+                if (disconnectReason != DisconnectReason::MAX)
+                {
+                    Disconnect(disconnectReason, TerminationEndpoint::Remote);
+                    return true;
+                }
+                m_recvRingbuffer.AdvanceWriteBuffer(receivedBytes);
+                m_networkInterface.GetMetrics().m_recvBytes += receivedBytes;
+                m_networkInterface.GetMetrics().m_recvBytesUncompressed += receivedBytes;
             }
-            m_recvRingbuffer.AdvanceWriteBuffer(receivedBytes);
-            m_networkInterface.GetMetrics().m_recvBytes += receivedBytes;
-            m_networkInterface.GetMetrics().m_recvBytesUncompressed += receivedBytes;
-        }
-
-        // Process received packets
-        for (;;)
-        {
-            TcpPacketHeader header(PacketType(0), 0);
-            TcpPacketEncodingBuffer buffer;
 
-            if (!ReceivePacketInternal(header, buffer, startTimeMs))
+            // Process received packets
+            for (;;)
             {
-                break;
-            }
+                TcpPacketHeader header(PacketType(0), 0);
+                const uint8_t* packetData = nullptr;
+                uint32_t packetSize = 0;
+                uint32_t consumedSize = 0;
 
-            TimeoutQueue::TimeoutItem* timeoutItem = m_networkInterface.m_connectionTimeoutQueue.RetrieveItem(GetTimeoutId());
-            if (timeoutItem == nullptr)
-            {
-                return true;
-            }
-            timeoutItem->UpdateTimeoutTime(startTimeMs);
+                if (!ReceivePacketInternal(header, m_decompressBuffer, packetData, packetSize, consumedSize, startTimeMs))
+                {
+                    break;
+                }
 
-            NetworkOutputSerializer serializer(buffer.GetBuffer(), buffer.GetSize());
-            if (m_state == ConnectionState::Connecting)
-            {
-                const ConnectResult connectResult = m_networkInterface.GetConnectionListener().ValidateConnect(GetRemoteAddress(), header, serializer);
-                if (connectResult == ConnectResult::Rejected)
+                TimeoutQueue::TimeoutItem* timeoutItem = m_networkInterface.m_connectionTimeoutQueue.RetrieveItem(GetTimeoutId());
+                if (timeoutItem == nullptr)
                 {
-                    Disconnect(DisconnectReason::ConnectionRejected, TerminationEndpoint::Local);
+                    m_recvRingbuffer.AdvanceReadBuffer(consumedSize);
+                    return true;
                 }
-                else
+                timeoutItem->UpdateTimeoutTime(startTimeMs);
+
+                NetworkOutputSerializer serializer(packetData, packetSize);
+                if (m_state == ConnectionState::Connecting)
+                {
+                    const ConnectResult connectResult = m_networkInterface.GetConnectionListener().ValidateConnect(GetRemoteAddress(), header, serializer);
+                    if (connectResult == ConnectResult::Rejected)
+                    {
+                        Disconnect(DisconnectReason::ConnectionRejected, TerminationEndpoint::Local);
+                    }
+                    else
+                    {
+                        m_state = ConnectionState::Connected;
+                    }
+                }
+
+                if (m_state == ConnectionState::Connected)
                 {
-                    m_state = ConnectionState::Connected;
+                    m_networkInterface.GetConnectionListener().OnPacketReceived(this, header, serializer);
                 }
+
+                // Only release the packet memory once the listener is done with it
+                m_recvRingbuffer.AdvanceReadBuffer(consumedSize);
             }
 
-            if (m_state == ConnectionState::Connected)
+            if (m_state == ConnectionState::Disconnected)
             {
-                m_networkInterface.GetConnectionListener().OnPacketReceived(this, header, serializer);
+                break;
             }
         }
 
@@ -339,7 +355,8 @@ namespace AzNetworking
         return true;
     }
 
-    bool TcpConnection::ReceivePacketInternal(TcpPacketHeader& outHeader, TcpPacketEncodingBuffer& outBuffer, AZ::TimeMs currentTimeMs)
+    bool TcpConnection::ReceivePacketInternal(TcpPacketHeader& outHeader, TcpPacketEncodingBuffer& decompressBuffer, const uint8_t*& outPacketData,
+        uint32_t& outPacketSize, uint32_t& outConsumedSize, AZ::TimeMs currentTimeMs)
     {
         NetworkOutputSerializer serializer(m_recvRingbuffer.GetReadBufferData(), m_recvRingbuffer.GetReadBufferSize());
         if (!outHeader.Serialize(serializer))
@@ -355,29 +372,27 @@ namespace AzNetworking
             return false;
         }
 
-        if (packetSize > outBuffer.GetCapacity())
+        if (packetSize > MaxPacketSize)
         {
-            // If we can't fit the packet, do not allow the copy to proceed as that would overwrite invalid memory
+            // Packets can never be larger than our encoding buffers, the stream is malformed
             return false;
         }
-        outBuffer.Resize(packetSize);
+        outConsumedSize = serializer.GetReadSize() + packetSize;
 
-        const uint8_t* srcData = serializer.GetUnreadData();
+        // The packet is contiguous within the ringbuffer read memory, so uncompressed packets are processed in place
+        outPacketData = serializer.GetUnreadData();
         if (m_compressor && outHeader.IsPacketFlagSet(PacketFlag::Compressed))
         {
-            if (!DecompressPacket(srcData, packetSize, outBuffer))
+            if (!DecompressPacket(outPacketData, packetSize, decompressBuffer))
             {
                 AZLOG_WARN("Failed to decompress packet!");
                 return false;
             }
-            srcData = outBuffer.GetBuffer();
-            packetSize = aznumeric_cast<uint16_t>(outBuffer.GetSize());
+            outPacketData = decompressBuffer.GetBuffer();
+            packetSize = aznumeric_cast<uint16_t>(decompressBuffer.GetSize());
         }
+        outPacketSize = packetSize;
 
-        uint8_t* dstData = outBuffer.GetBuffer();
-        memcpy(dstData, srcData, packetSize);
-
-        m_recvRingbuffer.AdvanceReadBuffer(serializer.GetReadSize() + packetSize);
         GetMetrics().m_packetsRecv++;
         GetMetrics().m_recvDatarate.LogPacket(packetSize, currentTimeMs);
         m_networkInterface.GetMetrics().m_recvPackets++;
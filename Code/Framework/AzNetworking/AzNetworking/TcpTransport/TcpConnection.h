@@ -122,11 +122,17 @@ namespace AzNetworking
         bool SendPacketInternal(PacketType packetType, TcpPacketEncodingBuffer& payloadBuffer, AZ::TimeMs currentTimeMs);
 
         //! Receives a packet from the connected connection.
-        //! @param outHeader      header of the received packet
-        //! @param outBuffer      encoded buffer of the received packet
-        //! @param currentTimeMs current process time in milliseconds
+        //! Uncompressed packets are returned in place inside the receive ringbuffer, the caller must advance the ringbuffer
+        //! read offset by outConsumedSize once it has finished processing the packet.
+        //! @param outHeader        header of the received packet
+        //! @param decompressBuffer buffer to decompress compressed packets into
+        //! @param outPacketData    pointer to the data of the received packet
+        //! @param outPacketSize    size of the received packet in bytes
+        //! @param outConsumedSize  number of ringbuffer bytes used by the received packet, including its header
+        //! @param currentTimeMs    current process time in milliseconds
         //! @return boolean true if a packet has been received, false otherwise
-        bool ReceivePacketInternal(TcpPacketHeader& outHeader, TcpPacketEncodingBuffer& outBuffer, AZ::TimeMs currentTimeMs);
+        bool ReceivePacketInternal(TcpPacketHeader& outHeader, TcpPacketEncodingBuffer& decompressBuffer, const uint8_t*& outPacketData,
+            uint32_t& outPacketSize, uint32_t& outConsumedSize, AZ::TimeMs currentTimeMs);
 
         //! Decompresses an incoming packet data buffer.
         //! @param packetBuffer    the compressed packet buffer to decode
@@ -153,6 +159,7 @@ namespace AzNetworking
 
         static const uint32_t RecvRingbufferSize = 1024 * 1024; // 1 MB recv buffer
         TcpRingBuffer<RecvRingbufferSize> m_recvRingbuffer;
+        TcpPacketEncodingBuffer m_decompressBuffer; //< Only used for compressed packets, all others are processed in place
     };
 }
 
@@ -123,7 +123,11 @@ namespace AzNetworking
             {
                 if (listenPort.m_listenSocket.GetSocketFd() == socketFd)
                 {
-                    HandleSocketAccept((void*)&newConnection, connectionLength, listenPort);
+                    // Listen sockets are edge triggered, so accept every pending connection before waiting for the next event
+                    while (HandleSocketAccept((void*)&newConnection, connectionLength, listenPort))
+                    {
+                        ;
+                    }
                 }
             };
             m_listenPorts.Visit(visitor);
@@ -173,6 +177,11 @@ namespace AzNetworking
         if (newSocketFd <= SocketFd{ 0 })
         {
             const int32_t error = GetLastNetworkError();
+            if (ErrorIsWouldBlock(error))
+            {
+                // No more pending connections
+                return false;
+            }
             AZLOG_WARN("Failed to accept incoming connection (%d:%s)", error, GetNetworkErrorDesc(error));
             return false;
         }
@@ -58,7 +58,7 @@ namespace AzNetworking
     void TcpSocketManager::ProcessEvents(AZ::TimeMs maxBlockMs, const SocketEventCallback& readCallback, const SocketEventCallback& writeCallback)
     {
         struct epoll_event socketEvents[MaxEpollEvents];
-        const int32_t numEpollEvents = epoll_wait(static_cast<int32_t>(m_epollFd), socketEvents, MaxEpollEvents, -1);
+        const int32_t numEpollEvents = epoll_wait(static_cast<int32_t>(m_epollFd), socketEvents, MaxEpollEvents, static_cast<int32_t>(maxBlockMs));
         if (numEpollEvents < 0)
         {
             const int32_t error = GetLastNetworkError();
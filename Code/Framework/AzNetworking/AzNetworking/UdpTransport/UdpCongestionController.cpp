@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ * 
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/UdpTransport/UdpCongestionController.h>
+#include <AzNetworking/DataStructures/ByteBuffer.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/std/algorithm.h>
+
+namespace AzNetworking
+{
+    AZ_CVAR(bool, net_UdpCongestionControl, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "If true, retransmissions of reliable packets are paced to the estimated bandwidth of each connection");
+    AZ_CVAR(float, net_UdpCongestionPacingGain, 1.25f, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Multiple of the estimated bottleneck bandwidth a connection is paced at once startup has finished");
+    AZ_CVAR(float, net_UdpCongestionMinRateBytes, 32.0f * 1024.0f, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "The minimum pacing rate of a connection in bytes per second");
+    AZ_CVAR(AZ::TimeMs, net_UdpCongestionBurstMs, AZ::TimeMs{ 20 }, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Milliseconds worth of the pacing rate a connection is allowed to send in a single burst");
+    AZ_CVAR(AZ::TimeMs, net_UdpCongestionMinSampleMs, AZ::TimeMs{ 50 }, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Minimum duration of a bandwidth sample, samples otherwise span one round trip");
+
+    static constexpr float StartupPacingGain = 2.0f;
+    static constexpr float StartupGrowthThreshold = 1.25f; //< Bandwidth has to grow by 25% per round trip to remain in startup
+    static constexpr uint32_t StartupMaxRoundsWithoutGrowth = 3;
+
+    UdpCongestionController::UdpCongestionController()
+    {
+        Reset();
+    }
+
+    void UdpCongestionController::Reset()
+    {
+        m_sentPackets.fill(SentPacket());
+        m_bandwidthSamples.fill(0.0f);
+        m_nextBandwidthSample = 0;
+        m_deliveredBytes = 0;
+        m_sampleStartTimeMs = AZ::TimeMs{ 0 };
+        m_sampleIntervalMs = AZ::TimeMs{ 100 };
+        m_bottleneckBytesPerSecond = 0.0f;
+        m_pacingRateBytesPerSecond = net_UdpCongestionMinRateBytes;
+        m_inStartup = true;
+        m_startupBottleneckBytesPerSecond = 0.0f;
+        m_startupRoundsWithoutGrowth = 0;
+        m_budgetBytes = aznumeric_cast<float>(MaxUdpTransmissionUnit);
+        m_lastRefillTimeMs = AZ::TimeMs{ 0 };
+    }
+
+    void UdpCongestionController::OnPacketSent(PacketId packetId, uint32_t packetSize, AZ::TimeMs currentTimeMs)
+    {
+        SentPacket& sentPacket = m_sentPackets[aznumeric_cast<uint32_t>(packetId) & (SentPacketHistorySize - 1)];
+        sentPacket.m_packetId = packetId;
+        sentPacket.m_packetSize = packetSize;
+
+        // All traffic counts against the budget, even if only retransmissions are held back by it
+        RefillBudget(currentTimeMs);
+        m_budgetBytes -= aznumeric_cast<float>(packetSize);
+    }
+
+    void UdpCongestionController::OnPacketAcked(PacketId packetId, AZ::TimeMs currentTimeMs, float roundTripTimeSeconds)
+    {
+        SentPacket& sentPacket = m_sentPackets[aznumeric_cast<uint32_t>(packetId) & (SentPacketHistorySize - 1)];
+        if (sentPacket.m_packetId == packetId)
+        {
+            m_deliveredBytes += sentPacket.m_packetSize;
+            sentPacket = SentPacket();
+        }
+
+        const AZ::TimeMs roundTripTimeMs = aznumeric_cast<AZ::TimeMs>(aznumeric_cast<int64_t>(roundTripTimeSeconds * 1000.0f));
+        m_sampleIntervalMs = AZStd::max<AZ::TimeMs>(roundTripTimeMs, net_UdpCongestionMinSampleMs);
+        UpdateBandwidthSample(currentTimeMs);
+    }
+
+    bool UdpCongestionController::CanSend(AZ::TimeMs currentTimeMs)
+    {
+        // Samples are also closed here so the estimate decays when nothing gets acked at all
+        UpdateBandwidthSample(currentTimeMs);
+        RefillBudget(currentTimeMs);
+        return !net_UdpCongestionControl || (m_budgetBytes > 0.0f);
+    }
+
+    float UdpCongestionController::GetPacingRateBytesPerSecond() const
+    {
+        return m_pacingRateBytesPerSecond;
+    }
+
+    float UdpCongestionController::GetBottleneckBytesPerSecond() const
+    {
+        return m_bottleneckBytesPerSecond;
+    }
+
+    void UdpCongestionController::UpdateBandwidthSample(AZ::TimeMs currentTimeMs)
+    {
+        if (m_sampleStartTimeMs == AZ::TimeMs{ 0 })
+        {
+            m_sampleStartTimeMs = currentTimeMs;
+            return;
+        }
+
+        const AZ::TimeMs sampleTimeMs = currentTimeMs - m_sampleStartTimeMs;
+        if (sampleTimeMs < m_sampleIntervalMs)
+        {
+            return;
+        }
+
+        m_bandwidthSamples[m_nextBandwidthSample] = aznumeric_cast<float>(m_deliveredBytes) * 1000.0f / aznumeric_cast<float>(static_cast<int64_t>(sampleTimeMs));
+        m_nextBandwidthSample = (m_nextBandwidthSample + 1) % BandwidthSampleCount;
+        m_deliveredBytes = 0;
+        m_sampleStartTimeMs = currentTimeMs;
+
+        m_bottleneckBytesPerSecond = 0.0f;
+        for (const float bandwidthSample : m_bandwidthSamples)
+        {
+            m_bottleneckBytesPerSecond = AZStd::max(m_bottleneckBytesPerSecond, bandwidthSample);
+        }
+
+        if (m_inStartup)
+        {
+            if (m_bottleneckBytesPerSecond >= m_startupBottleneckBytesPerSecond * StartupGrowthThreshold)
+            {
+                m_startupBottleneckBytesPerSecond = m_bottleneckBytesPerSecond;
+                m_startupRoundsWithoutGrowth = 0;
+            }
+            else if (++m_startupRoundsWithoutGrowth >= StartupMaxRoundsWithoutGrowth)
+            {
+                m_inStartup = false;
+            }
+        }
+
+        const float pacingGain = m_inStartup ? StartupPacingGain : static_cast<float>(net_UdpCongestionPacingGain);
+        m_pacingRateBytesPerSecond = AZStd::max<float>(m_bottleneckBytesPerSecond * pacingGain, net_UdpCongestionMinRateBytes);
+    }
+
+    void UdpCongestionController::RefillBudget(AZ::TimeMs currentTimeMs)
+    {
+        const AZ::TimeMs elapsedTimeMs = (m_lastRefillTimeMs == AZ::TimeMs{ 0 }) ? AZ::TimeMs{ 0 } : currentTimeMs - m_lastRefillTimeMs;
+        m_lastRefillTimeMs = currentTimeMs;
+
+        // Allow at least a couple of full sized packets per burst, and never fall more than a second behind
+        const float burstBytes = AZStd::max<float>(m_pacingRateBytesPerSecond * aznumeric_cast<float>(static_cast<int64_t>(static_cast<AZ::TimeMs>(net_UdpCongestionBurstMs))) / 1000.0f,
+            2.0f * aznumeric_cast<float>(MaxUdpTransmissionUnit));
+        m_budgetBytes += m_pacingRateBytesPerSecond * aznumeric_cast<float>(static_cast<int64_t>(elapsedTimeMs)) / 1000.0f;
+        m_budgetBytes = AZStd::clamp(m_budgetBytes, -m_pacingRateBytesPerSecond, burstBytes);
+    }
+}
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ * 
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzNetworking/Utilities/NetworkCommon.h>
+#include <AzCore/Time/ITime.h>
+#include <AzCore/std/containers/array.h>
+
+namespace AzNetworking
+{
+    //! @class UdpCongestionController
+    //! @brief pacing based congestion control for a single udp connection.
+    //! The controller estimates the bottleneck bandwidth of the connection from the rate at which sent bytes get acked,
+    //! keeping the maximum delivery rate over the last few round trips, and paces retransmissions to a multiple of that
+    //! estimate. Since the estimate is based on delivered bytes, a lossy link lowers the send rate instead of triggering
+    //! ever more retransmits. Pacing is only enforced while net_UdpCongestionControl is enabled.
+    class UdpCongestionController
+    {
+    public:
+
+        UdpCongestionController();
+
+        //! Resets all internal state.
+        void Reset();
+
+        //! Invoked whenever a packet is sent on the connection.
+        //! @param packetId      identifier of the packet being sent
+        //! @param packetSize    size of the sent packet in bytes
+        //! @param currentTimeMs current process time in milliseconds
+        void OnPacketSent(PacketId packetId, uint32_t packetSize, AZ::TimeMs currentTimeMs);
+
+        //! Invoked whenever a packet is acked by the remote endpoint.
+        //! @param packetId             identifier of the acked packet
+        //! @param currentTimeMs        current process time in milliseconds
+        //! @param roundTripTimeSeconds the current round trip time estimate of the connection
+        void OnPacketAcked(PacketId packetId, AZ::TimeMs currentTimeMs, float roundTripTimeSeconds);
+
+        //! Returns whether the pacing budget allows sending another packet right now.
+        //! @param currentTimeMs current process time in milliseconds
+        //! @return boolean true if a packet can be sent, always true if congestion control is disabled
+        bool CanSend(AZ::TimeMs currentTimeMs);
+
+        //! Returns the rate the connection is currently paced at.
+        //! @return the pacing rate in bytes per second
+        float GetPacingRateBytesPerSecond() const;
+
+        //! Returns the current estimate of the bottleneck bandwidth of the connection.
+        //! @return the estimated bottleneck bandwidth in bytes per second
+        float GetBottleneckBytesPerSecond() const;
+
+    private:
+
+        //! Closes the current bandwidth sample once it spans at least one round trip.
+        //! @param currentTimeMs current process time in milliseconds
+        void UpdateBandwidthSample(AZ::TimeMs currentTimeMs);
+
+        //! Adds tokens to the pacing budget for the time passed since the last refill.
+        //! @param currentTimeMs current process time in milliseconds
+        void RefillBudget(AZ::TimeMs currentTimeMs);
+
+        struct SentPacket
+        {
+            PacketId m_packetId = InvalidPacketId;
+            uint32_t m_packetSize = 0;
+        };
+
+        static constexpr uint32_t SentPacketHistorySize = 256; //< Must be power of 2
+        static_assert((SentPacketHistorySize & (SentPacketHistorySize - 1)) == 0, "Sent packet history size is not a power of 2");
+        static constexpr uint32_t BandwidthSampleCount = 10; //< Number of round trips the bottleneck bandwidth estimate is taken over
+
+        AZStd::array<SentPacket, SentPacketHistorySize> m_sentPackets;
+        AZStd::array<float, BandwidthSampleCount> m_bandwidthSamples;
+        uint32_t m_nextBandwidthSample = 0;
+
+        uint32_t   m_deliveredBytes = 0;
+        AZ::TimeMs m_sampleStartTimeMs = AZ::TimeMs{ 0 };
+        AZ::TimeMs m_sampleIntervalMs = AZ::TimeMs{ 100 };
+
+        float m_bottleneckBytesPerSecond = 0.0f;
+        float m_pacingRateBytesPerSecond = 0.0f;
+
+        // While in startup the pacing rate is doubled every round trip until the bandwidth estimate stops growing
+        bool     m_inStartup = true;
+        float    m_startupBottleneckBytesPerSecond = 0.0f;
+        uint32_t m_startupRoundsWithoutGrowth = 0;
+
+        float      m_budgetBytes = 0.0f;
+        AZ::TimeMs m_lastRefillTimeMs = AZ::TimeMs{ 0 };
+    };
+}
@@ -155,6 +155,10 @@ namespace AzNetworking
         {
             GetMetrics().m_connectionRtt.LogPacketAcked(packetId, currentTimeMs);
         }
+
+        m_congestionController.OnPacketAcked(packetId, currentTimeMs, GetMetrics().m_connectionRtt.GetRoundTripTimeSeconds());
+        GetMetrics().m_pacingRateBytesPerSecond = m_congestionController.GetPacingRateBytesPerSecond();
+        GetMetrics().m_bottleneckBytesPerSecond = m_congestionController.GetBottleneckBytesPerSecond();
     }
 
     void UdpConnection::ProcessSent(PacketId packetId, [[maybe_unused]] const IPacket& packet, 
@@ -169,6 +173,7 @@ namespace AzNetworking
 
         GetMetrics().m_packetsSent++;
         GetMetrics().m_sendDatarate.LogPacket(packetSize, currentTimeMs);
+        m_congestionController.OnPacketSent(packetId, packetSize, currentTimeMs);
         m_lastSentPacketMs = currentTimeMs;
         m_unackedPacketCount = 0;
     }
@@ -10,6 +10,7 @@
 #include <AzNetworking/ConnectionLayer/IConnection.h>
 #include <AzNetworking/ConnectionLayer/IConnectionListener.h>
 #include <AzNetworking/UdpTransport/DtlsEndpoint.h>
+#include <AzNetworking/UdpTransport/UdpCongestionController.h>
 #include <AzNetworking/UdpTransport/UdpPacketTracker.h>
 #include <AzNetworking/UdpTransport/UdpReliableQueue.h>
 #include <AzNetworking/UdpTransport/UdpFragmentQueue.h>
@@ -143,6 +144,7 @@ namespace AzNetworking
         UdpPacketTracker  m_packetTracker;
         UdpReliableQueue  m_reliableQueue;
         UdpFragmentQueue  m_fragmentQueue;
+        UdpCongestionController m_congestionController;
         ConnectionState   m_state = ConnectionState::Disconnected;
         ConnectionRole    m_connectionRole = ConnectionRole::Connector;
 
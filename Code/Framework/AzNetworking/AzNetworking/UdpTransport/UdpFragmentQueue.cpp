@@ -27,6 +27,7 @@ namespace AzNetworking
         m_timeoutQueue.Reset();
         m_sequenceGenerator.Reset();
         m_packetFragments.clear();
+        m_chunkPool.Clear();
         m_latestReceivedFragmentSequence = InvalidSequenceId;
         m_deliveredFragments.Reset();
     }
@@ -38,11 +39,13 @@ namespace AzNetworking
 
     bool UdpFragmentQueue::ProcessReceivedChunk(UdpConnection* connection, IConnectionListener& connectionListener, UdpPacketHeader& header, ISerializer& serializer)
     {
-        AZStd::unique_ptr<CorePackets::FragmentedPacket> packet = AZStd::make_unique<CorePackets::FragmentedPacket>();
+        // Chunks arrive at a high rate for large packets, so reuse the chunks of previously reconstructed packets
+        ChunkPool::ObjectPtr packet = m_chunkPool.Acquire();
 
         if (!serializer.Serialize(*packet, "Packet"))
         {
             AZLOG(NET_FragmentQueue, "Fragment failed serialization");
+            m_chunkPool.Release(AZStd::move(packet));
             return false;
         }
 
@@ -62,6 +65,7 @@ namespace AzNetworking
         {
             // Too old to process
             AZLOG(NET_FragmentQueue, "Fragment sequence ID is outside our tracked window");
+            m_chunkPool.Release(AZStd::move(packet));
             return false;
         }
 
@@ -69,6 +73,7 @@ namespace AzNetworking
         {
             // Received packet is a duplicate of one already forwarded to gameplay
             AZLOG(NET_FragmentQueue, "Received duplicate of fragmented packet %u, discarding", static_cast<uint32_t>(fragmentSequence));
+            m_chunkPool.Release(AZStd::move(packet));
             return true;
         }
 
@@ -88,9 +93,12 @@ namespace AzNetworking
         {
             // Either we disagree on the number of chunks, or chunkIndex is bigger than the expected size, bail and disconnect
             AZLOG(NET_FragmentQueue, "Malformed chunk metadata in fragmented packet, chunkIndex %u, chunkCount %u, reservedSize %u", chunkIndex, chunkCount, static_cast<uint32_t>(packetFragments.size()));
+            m_chunkPool.Release(AZStd::move(packet));
             return false;
         }
 
+        // A duplicated chunk replaces the one we already have
+        m_chunkPool.Release(AZStd::move(packetFragments[chunkIndex]));
         packetFragments[chunkIndex] = AZStd::move(packet);
 
         uint32_t totalPacketSize = 0;
@@ -129,8 +137,8 @@ namespace AzNetworking
             bufferPointer += chunkSize;
         }
 
-        // We can erase all the chunks now, packet is completed
-        m_packetFragments.erase(fragmentSequence);
+        // We can release all the chunks now, packet is completed
+        ReleaseFragments(fragmentSequence);
 
         NetworkOutputSerializer networkSerializer(buffer.GetBuffer(), buffer.GetSize());
         {
@@ -167,7 +175,22 @@ namespace AzNetworking
     {
         const SequenceId fragmentSequence = static_cast<SequenceId>(item.m_userData & 0xFF);
         AZLOG(NET_FragmentQueue, "Timing out unreliable fragmented packet %u", static_cast<uint32_t>(fragmentSequence));
-        m_packetFragments.erase(fragmentSequence);
+        ReleaseFragments(fragmentSequence);
         return TimeoutResult::Delete;
     }
+
+    void UdpFragmentQueue::ReleaseFragments(SequenceId fragmentSequence)
+    {
+        auto iter = m_packetFragments.find(fragmentSequence);
+        if (iter == m_packetFragments.end())
+        {
+            return;
+        }
+
+        for (AZStd::unique_ptr<CorePackets::FragmentedPacket>& fragment : iter->second)
+        {
+            m_chunkPool.Release(AZStd::move(fragment));
+        }
+        m_packetFragments.erase(iter);
+    }
 }
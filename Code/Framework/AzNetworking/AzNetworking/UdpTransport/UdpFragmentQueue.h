@@ -10,6 +10,7 @@
 #include <AzNetworking/PacketLayer/IPacket.h>
 #include <AzNetworking/AutoGen/CorePackets.AutoPackets.h>
 #include <AzNetworking/ConnectionLayer/SequenceGenerator.h>
+#include <AzNetworking/DataStructures/ObjectPool.h>
 #include <AzNetworking/DataStructures/RingBufferBitset.h>
 #include <AzNetworking/DataStructures/TimeoutQueue.h>
 #include <AzNetworking/UdpTransport/UdpSocket.h>
@@ -53,12 +54,21 @@ namespace AzNetworking
         //! @return ETimeoutResult for whether to re-register or discard the timeout params
         virtual TimeoutResult HandleTimeout(TimeoutQueue::TimeoutItem& item) override;
 
+        //! Returns the chunks of a fragmented packet to the chunk pool and stops tracking the packet.
+        //! @param fragmentSequence the fragmented sequence identifier of the packet to release
+        void ReleaseFragments(SequenceId fragmentSequence);
+
         TimeoutQueue m_timeoutQueue;
         SequenceGenerator m_sequenceGenerator;
 
         using PacketFragments = AZStd::vector<AZStd::unique_ptr<CorePackets::FragmentedPacket>>;
         AZStd::unordered_map<SequenceId, PacketFragments> m_packetFragments;
 
+        // Received chunks are recycled, a full sized packet never needs more than this many chunks
+        static constexpr AZStd::size_t MaxPooledChunks = MaxPacketSize / MaxUdpTransmissionUnit;
+        using ChunkPool = ObjectPool<CorePackets::FragmentedPacket, MaxPooledChunks>;
+        ChunkPool m_chunkPool;
+
         static constexpr uint32_t PacketWindowAckCount = 16384; // The total number of packet id's to track
         using PacketAckContainer = RingbufferBitset<PacketWindowAckCount>;
 
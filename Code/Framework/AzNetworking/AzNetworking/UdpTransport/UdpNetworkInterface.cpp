@@ -54,12 +54,12 @@ namespace AzNetworking
         outReliability = ((timeoutId & 0x8000000000000000) > 0) ? ReliabilityType::Reliable : ReliabilityType::Unreliable;
     }
 
-    UdpNetworkInterface::UdpNetworkInterface(AZ::Name name, IConnectionListener& connectionListener, TrustZone trustZone, UdpReaderThread& readerThread)
+    UdpNetworkInterface::UdpNetworkInterface(AZ::Name name, IConnectionListener& connectionListener, TrustZone trustZone, UdpReaderThreads& readerThreads)
         : m_name(name)
         , m_trustZone(trustZone)
         , m_connectionListener(connectionListener)
         , m_socket(net_UdpUseEncryption ? new DtlsSocket() : new UdpSocket())
-        , m_readerThread(readerThread)
+        , m_readerThreads(readerThreads)
     {
         const AZ::CVarFixedString compressor = static_cast<AZ::CVarFixedString>(net_UdpCompressor);
         const AZ::Name compressorName = AZ::Name(compressor);
@@ -68,7 +68,11 @@ namespace AzNetworking
 
     UdpNetworkInterface::~UdpNetworkInterface()
     {
-        m_readerThread.UnregisterSocket(m_socket.get());
+        m_readerThreads[0]->UnregisterSocket(m_socket.get());
+        for (uint32_t i = 0; i < m_shardSockets.size(); ++i)
+        {
+            m_readerThreads[i + 1]->UnregisterSocket(m_shardSockets[i].get());
+        }
     }
 
     AZ::Name UdpNetworkInterface::GetName() const
@@ -111,8 +115,30 @@ namespace AzNetworking
 
         m_port = port;
         m_allowIncomingConnections = true;
+
+        // With multiple reader threads every thread gets its own socket bound to the same port, the kernel then distributes
+        // incoming datagrams by a hash of the remote address so all packets of a connection are received by the same thread
+        const bool shardSockets = m_readerThreads.size() > 1;
+        m_socket->SetReusePort(shardSockets);
         m_socket->Open(m_port, UdpSocket::CanAcceptConnections::True, m_trustZone);
-        m_readerThread.RegisterSocket(m_socket.get());
+        m_readerThreads[0]->RegisterSocket(m_socket.get());
+
+        if (shardSockets)
+        {
+            for (uint32_t i = 1; i < m_readerThreads.size(); ++i)
+            {
+                // Shard sockets are only read from, all sends and DTLS handshakes go through the primary socket
+                AZStd::unique_ptr<UdpSocket> shardSocket = AZStd::make_unique<UdpSocket>();
+                shardSocket->SetReusePort(true);
+                if (!shardSocket->Open(m_port, UdpSocket::CanAcceptConnections::True, m_trustZone))
+                {
+                    AZLOG_WARN("Failed to open UDP shard socket %u on port %u", i, aznumeric_cast<uint32_t>(m_port));
+                    break;
+                }
+                m_readerThreads[i]->RegisterSocket(shardSocket.get());
+                m_shardSockets.emplace_back(AZStd::move(shardSocket));
+            }
+        }
         return true;
     }
 
@@ -121,7 +147,7 @@ namespace AzNetworking
         if (!m_socket->IsOpen())
         {
             m_socket->Open(m_port, UdpSocket::CanAcceptConnections::False, m_trustZone);
-            m_readerThread.RegisterSocket(m_socket.get());
+            m_readerThreads[0]->RegisterSocket(m_socket.get());
         }
 
         const ConnectionId connectionId = m_connectionSet.GetNextConnectionId();
@@ -153,25 +179,83 @@ namespace AzNetworking
             return;
         }
 
+        // Send everything that was queued since the last update, see net_UdpBatchSends
+        m_socket->FlushSendBatch();
+
         const AZ::TimeMs startTimeMs = AZ::GetElapsedTimeMs();
-        const UdpReaderThread::ReceivedPackets* packets = m_readerThread.GetReceivedPackets(m_socket.get());
+        const UdpReaderThread::ReceivedPackets* packets = m_readerThreads[0]->GetReceivedPackets(m_socket.get());
         if (packets == nullptr)
         {
             // Socket is not yet registered with the reader thread and is likely still pending, try again later
             return;
         }
 
-        for (uint32_t i = 0; i < packets->size(); ++i)
+        if (ProcessReceivedPackets(*packets, startTimeMs))
+        {
+            for (uint32_t i = 0; i < m_shardSockets.size(); ++i)
+            {
+                const UdpReaderThread::ReceivedPackets* shardPackets = m_readerThreads[i + 1]->GetReceivedPackets(m_shardSockets[i].get());
+                if ((shardPackets != nullptr) && !ProcessReceivedPackets(*shardPackets, startTimeMs))
+                {
+                    break;
+                }
+            }
+        }
+        const AZ::TimeMs receiveTimeMs = AZ::GetElapsedTimeMs() - startTimeMs;
+
+        // Time out any stale client connections
+        {
+            ConnectionTimeoutFunctor functor(*this);
+            m_connectionTimeoutQueue.UpdateTimeouts(functor);
+        }
+
+        // Time out any packets that haven't been acked within our timeout window
+        {
+            PacketTimeoutFunctor functor(*this);
+            m_packetTimeoutQueue.UpdateTimeouts(functor, static_cast<int32_t>(net_MaxTimeoutsPerFrame));
+        }
+
+        // Delete any connections we've disconnected
+        for (RemovedConnection& removedConnection : m_removedConnections)
+        {
+            m_connectionListener.OnDisconnect(removedConnection.m_connection, removedConnection.m_reason, removedConnection.m_endpoint);
+            m_connectionSet.DeleteConnection(removedConnection.m_connection->GetConnectionId()); // Will delete the connection
+        }
+        m_removedConnections.clear();
+
+        // Send the acks, heartbeats and retransmits that were queued during this update
+        m_socket->FlushSendBatch();
+
+        // Update metrics
+        GetMetrics().m_sendPackets = m_socket->GetSentPackets();
+        GetMetrics().m_sendBytes = m_socket->GetSentBytes();
+        GetMetrics().m_sendPacketsEncrypted = m_socket->GetSentPacketsEncrypted();
+        GetMetrics().m_sendBytesEncryptionInflation = m_socket->GetSentBytesEncryptionInflation();
+        GetMetrics().m_recvTimeMs += receiveTimeMs;
+        GetMetrics().m_recvPackets = m_socket->GetRecvPackets();
+        GetMetrics().m_recvBytes = m_socket->GetRecvBytes();
+        for (const AZStd::unique_ptr<UdpSocket>& shardSocket : m_shardSockets)
+        {
+            GetMetrics().m_recvPackets += shardSocket->GetRecvPackets();
+            GetMetrics().m_recvBytes += shardSocket->GetRecvBytes();
+        }
+        GetMetrics().m_connectionCount = m_connectionSet.GetConnectionCount();
+        GetMetrics().m_updateTimeMs += AZ::GetElapsedTimeMs() - startTimeMs;
+    }
+
+    bool UdpNetworkInterface::ProcessReceivedPackets(const UdpReaderThread::ReceivedPackets& packets, AZ::TimeMs startTimeMs)
+    {
+        for (uint32_t i = 0; i < packets.size(); ++i)
         {
-            const UdpReaderThread::ReceivedPacket& packet = (*packets)[i];
+            const UdpReaderThread::ReceivedPacket& packet = packets[i];
             const AZ::TimeMs currentTimeMs = AZ::GetElapsedTimeMs();
 
             // Don't exceed our timeslice, even if unprocessed data remains
             if ((currentTimeMs - startTimeMs) > net_UdpPacketTimeSliceMs)
             {
-                AZLOG_WARN("Processing time exceeded, discarding %d/%d received packets", aznumeric_cast<int32_t>(packets->size() - i), aznumeric_cast<int32_t>(packets->size()));
-                GetMetrics().m_discardedPackets += packets->size() - i;
-                break;
+                AZLOG_WARN("Processing time exceeded, discarding %d/%d received packets", aznumeric_cast<int32_t>(packets.size() - i), aznumeric_cast<int32_t>(packets.size()));
+                GetMetrics().m_discardedPackets += packets.size() - i;
+                return false;
             }
 
             UdpConnection* connection = m_connectionSet.GetConnection(packet.m_address);
@@ -297,38 +381,7 @@ namespace AzNetworking
                 }
             }
         }
-        const AZ::TimeMs receiveTimeMs = AZ::GetElapsedTimeMs() - startTimeMs;
-
-        // Time out any stale client connections
-        {
-            ConnectionTimeoutFunctor functor(*this);
-            m_connectionTimeoutQueue.UpdateTimeouts(functor);
-        }
-
-        // Time out any packets that haven't been acked within our timeout window
-        {
-            PacketTimeoutFunctor functor(*this);
-            m_packetTimeoutQueue.UpdateTimeouts(functor, static_cast<int32_t>(net_MaxTimeoutsPerFrame));
-        }
-
-        // Delete any connections we've disconnected
-        for (RemovedConnection& removedConnection : m_removedConnections)
-        {
-            m_connectionListener.OnDisconnect(removedConnection.m_connection, removedConnection.m_reason, removedConnection.m_endpoint);
-            m_connectionSet.DeleteConnection(removedConnection.m_connection->GetConnectionId()); // Will delete the connection
-        }
-        m_removedConnections.clear();
-
-        // Update metrics
-        GetMetrics().m_sendPackets = m_socket->GetSentPackets();
-        GetMetrics().m_sendBytes = m_socket->GetSentBytes();
-        GetMetrics().m_sendPacketsEncrypted = m_socket->GetSentPacketsEncrypted();
-        GetMetrics().m_sendBytesEncryptionInflation = m_socket->GetSentBytesEncryptionInflation();
-        GetMetrics().m_recvTimeMs += receiveTimeMs;
-        GetMetrics().m_recvPackets = m_socket->GetRecvPackets();
-        GetMetrics().m_recvBytes = m_socket->GetRecvBytes();
-        GetMetrics().m_connectionCount = m_connectionSet.GetConnectionCount();
-        GetMetrics().m_updateTimeMs += AZ::GetElapsedTimeMs() - startTimeMs;
+        return true;
     }
 
     bool UdpNetworkInterface::SendReliablePacket(ConnectionId connectionId, const IPacket& packet)
@@ -732,6 +785,14 @@ namespace AzNetworking
             return TimeoutResult::Delete;
         }
 
+        // Hold back retransmissions that exceed the pacing budget of the connection, so lossy links aren't flooded with resends
+        if ((reliability == ReliabilityType::Reliable) && (connection->GetPacketTracker().GetPacketAckStatus(packetId) == PacketAckState::Nacked)
+            && !connection->m_congestionController.CanSend(AZ::GetElapsedTimeMs()))
+        {
+            connection->GetMetrics().m_packetsPaced++;
+            return TimeoutResult::Refresh;
+        }
+
         const PacketTimeoutResult result = connection->ProcessTimeout(packetId, reliability);
         AZLOG(NET_Debug, "Timeout triggered for packetId %u with result %s", aznumeric_cast<uint32_t>(packetId), GetEnumString(result));
         switch (result)
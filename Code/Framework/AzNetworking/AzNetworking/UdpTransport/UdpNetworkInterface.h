@@ -83,8 +83,8 @@ namespace AzNetworking
         //! @param name               the name of this network interface instance.
         //! @param connectionListener reference to the connection listener responsible for handling all connection events
         //! @param trustZone          the trust level assigned to this network interface, server to server or client to server
-        //! @param readerThread       pointer to the reader thread to be bound to this network interface
-        UdpNetworkInterface(AZ::Name name, IConnectionListener& connectionListener, TrustZone trustZone, UdpReaderThread& readerThread);
+        //! @param readerThreads      the reader threads to be bound to this network interface, listening sockets are sharded across all of them
+        UdpNetworkInterface(AZ::Name name, IConnectionListener& connectionListener, TrustZone trustZone, UdpReaderThreads& readerThreads);
         ~UdpNetworkInterface() override;
 
         //! INetworkInterface interface.
@@ -128,6 +128,12 @@ namespace AzNetworking
         //! @return boolean true on success, false on failure
         bool DecompressPacket(const uint8_t* packetBuffer, size_t packetSize, UdpPacketEncodingBuffer& packetBufferOut) const;
 
+        //! Processes the packets a reader thread received on one of our sockets.
+        //! @param packets     the received packets to process
+        //! @param startTimeMs the time the update started, processing stops once net_UdpPacketTimeSliceMs is exceeded
+        //! @return boolean true if all packets were processed, false if the time slice was exceeded
+        bool ProcessReceivedPackets(const UdpReaderThread::ReceivedPackets& packets, AZ::TimeMs startTimeMs);
+
         //! Sends a packet to the remote connection.
         //! @param connection         the UdpConnection instance to send the packet on
         //! @param packet             serializable object to transmit
@@ -182,8 +188,10 @@ namespace AzNetworking
         TimeoutQueue m_connectionTimeoutQueue;
         TimeoutQueue m_packetTimeoutQueue;
         AZStd::unique_ptr<UdpSocket> m_socket;
+        //! Additional receive only sockets bound to the listen port, one per extra reader thread, see net_UdpReaderThreadCount.
+        AZStd::vector<AZStd::unique_ptr<UdpSocket>> m_shardSockets;
         AZStd::unique_ptr<ICompressor> m_compressor;
-        UdpReaderThread& m_readerThread;
+        UdpReaderThreads& m_readerThreads;
 
         struct RemovedConnection
         {
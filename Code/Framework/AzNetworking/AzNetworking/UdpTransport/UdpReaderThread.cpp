@@ -175,7 +175,6 @@ namespace AzNetworking
                     break;
                 }
 
-                IpAddress address;
                 const uint32_t bufferHead = receiveBuffer.GetSize();
                 if (bufferHead + MaxUdpTransmissionUnit >= receiveBuffer.GetCapacity())
                 {
@@ -184,18 +183,41 @@ namespace AzNetworking
                     break;
                 }
 
+                // Receive as many packets as fit into both the packet list and the receive buffer, each one into its own
+                // transmission unit sized slot
+                const uint32_t freeSlots = (receiveBuffer.GetCapacity() - bufferHead - 1) / MaxUdpTransmissionUnit;
+                const uint32_t freePackets = aznumeric_cast<uint32_t>(receivedPackets.capacity() - receivedPackets.size());
+                const uint32_t batchSize = AZStd::min(AZStd::min(UdpSocket::MaxBatchedPayloadCount, freeSlots), freePackets);
+                if (batchSize == 0)
+                {
+                    break;
+                }
+
                 uint8_t* dstData = receiveBuffer.GetBufferEnd();
-                receiveBuffer.Resize(bufferHead + MaxUdpTransmissionUnit);
+                receiveBuffer.Resize(bufferHead + batchSize * MaxUdpTransmissionUnit);
 
-                const int32_t receivedBytes = socket->Receive(address, dstData, MaxUdpTransmissionUnit);
-                if (receivedBytes > 0 && !receivedPackets.full())
+                UdpSocket::BatchedPayload payloads[UdpSocket::MaxBatchedPayloadCount];
+                for (uint32_t i = 0; i < batchSize; ++i)
                 {
-                    receivedPackets.push_back(ReceivedPacket(address, dstData, receivedBytes));
-                    receiveBuffer.Resize(bufferHead + receivedBytes);
+                    payloads[i].m_data = dstData + i * MaxUdpTransmissionUnit;
+                    payloads[i].m_size = MaxUdpTransmissionUnit;
                 }
-                else
+
+                const int32_t receivedCount = socket->ReceiveBatch(payloads, batchSize);
+                uint32_t bufferSize = bufferHead;
+                for (int32_t i = 0; i < receivedCount; ++i)
+                {
+                    if (payloads[i].m_size > 0)
+                    {
+                        receivedPackets.push_back(ReceivedPacket(payloads[i].m_address, payloads[i].m_data, aznumeric_cast<int32_t>(payloads[i].m_size)));
+                        bufferSize = bufferHead + i * MaxUdpTransmissionUnit + payloads[i].m_size;
+                    }
+                }
+                receiveBuffer.Resize(bufferSize);
+
+                // The socket is drained once it returns fewer packets than requested
+                if (receivedCount < aznumeric_cast<int32_t>(batchSize))
                 {
-                    receiveBuffer.Resize(bufferHead);
                     break;
                 }
             }
@@ -12,6 +12,8 @@
 #include <AzNetworking/Utilities/TimedThread.h>
 #include <AzNetworking/UdpTransport/DtlsEndpoint.h>
 #include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 
 namespace AzNetworking
 {
@@ -95,4 +97,7 @@ namespace AzNetworking
         AZStd::vector<UdpSocket*> m_pendingAdds;
         AZ::TimeMs m_updateTimeMs = AZ::TimeMs{ 0 };
     };
+
+    //! The reader threads shared by all UDP network interfaces, see net_UdpReaderThreadCount.
+    using UdpReaderThreads = AZStd::vector<AZStd::unique_ptr<UdpReaderThread>>;
 }
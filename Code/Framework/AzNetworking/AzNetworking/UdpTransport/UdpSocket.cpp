@@ -22,6 +22,16 @@ namespace AzNetworking
     AZ_CVAR(int32_t, net_UdpSendBufferSize, 1 * 1024 * 1024, nullptr, AZ::ConsoleFunctorFlags::Null, "Default UDP socket send buffer size");
     AZ_CVAR(int32_t, net_UdpRecvBufferSize, 1 * 1024 * 1024, nullptr, AZ::ConsoleFunctorFlags::Null, "Default UDP socket receive buffer size");
     AZ_CVAR(bool, net_UdpIgnoreWin10054, true, nullptr, AZ::ConsoleFunctorFlags::Null, "If true, will ignore 10054 socket errors on windows");
+    AZ_CVAR(bool, net_UdpBatchSends, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "If true, sent payloads are queued and flushed once per network update with as few system calls as possible, trading up to a frame of latency for lower CPU cost");
+
+    namespace Platform
+    {
+        //! Receives up to payloadCount payloads, returns the number of received payloads or < 0 on error.
+        int32_t ReceivePayloads(SocketFd socketFd, UdpSocket::BatchedPayload* payloads, uint32_t payloadCount);
+        //! Sends the payloads in order, returns the number of payloads that were sent before an error occurred.
+        int32_t SendPayloads(SocketFd socketFd, const UdpSocket::BatchedPayload* payloads, uint32_t payloadCount);
+    }
 
     UdpSocket::~UdpSocket()
     {
@@ -67,6 +77,11 @@ namespace AzNetworking
             }
         }
 
+        if (m_reusePort && !SetSocketReusePort(m_socketFd))
+        {
+            return false;
+        }
+
         // Handle binding
         {
             sockaddr_in hints;
@@ -97,6 +112,9 @@ namespace AzNetworking
 
     void UdpSocket::Close()
     {
+        // Make sure queued payloads like disconnect packets are still sent
+        FlushSendBatch();
+
         CloseSocket(m_socketFd);
         m_socketFd = InvalidSocketFd;
     }
@@ -191,42 +209,102 @@ namespace AzNetworking
 
         if (receivedBytes < 0)
         {
-            const int32_t error = GetLastNetworkError();
+            return HandleReceiveError(GetLastNetworkError());
+        }
 
-            if (ErrorIsWouldBlock(error)) // Filter would block messages
-            {
-                return 0;
-            }
+        if (receivedBytes == 0)
+        {
+            return 0;
+        }
+
+        m_recvPackets++;
+        m_recvBytes += receivedBytes;
+        return receivedBytes;
+    }
+
+    int32_t UdpSocket::ReceiveBatch(BatchedPayload* payloads, uint32_t payloadCount) const
+    {
+        AZ_Assert(payloadCount > 0 && payloadCount <= MaxBatchedPayloadCount, "Invalid payload count for batched receive");
+        AZ_Assert(payloads != nullptr, "NULL payload pointer passed to batched receive");
+
+        if (!IsOpen())
+        {
+            return 0;
+        }
+
+        const int32_t receivedPayloads = Platform::ReceivePayloads(m_socketFd, payloads, payloadCount);
+        if (receivedPayloads < 0)
+        {
+            return HandleReceiveError(GetLastNetworkError());
+        }
 
-            bool ignoreForciblyClosedError = false;
-            if (ErrorIsForciblyClosed(error, ignoreForciblyClosedError))
+        for (int32_t i = 0; i < receivedPayloads; ++i)
+        {
+            m_recvBytes += payloads[i].m_size;
+        }
+        m_recvPackets += receivedPayloads;
+        return receivedPayloads;
+    }
+
+    void UdpSocket::FlushSendBatch() const
+    {
+        if (m_queuedPayloads.empty())
+        {
+            return;
+        }
+
+        if (IsOpen())
+        {
+            const uint32_t queuedCount = aznumeric_cast<uint32_t>(m_queuedPayloads.size());
+            const int32_t sentPayloads = Platform::SendPayloads(m_socketFd, m_queuedPayloads.data(), queuedCount);
+            if (sentPayloads < aznumeric_cast<int32_t>(queuedCount))
             {
-                if (ignoreForciblyClosedError)
-                {
-                    return 0;
-                }
-                else
+                // The remaining payloads are dropped, like a payload that fails to send immediately
+                const int32_t error = GetLastNetworkError();
+                if (!ErrorIsWouldBlock(error)) // Filter would block messages
                 {
-                    return SocketOpResultError;
+                    AZLOG_ERROR("Failed to write %d/%u queued payloads to socket (%d:%s)",
+                        aznumeric_cast<int32_t>(queuedCount) - AZStd::max(sentPayloads, 0), queuedCount, error, GetNetworkErrorDesc(error));
                 }
             }
-
-            AZLOG_ERROR("Failed to read from socket (%d:%s)", error, GetNetworkErrorDesc(error));
         }
 
-        if (receivedBytes <= 0)
+        m_queuedPayloads.clear();
+    }
+
+    int32_t UdpSocket::HandleReceiveError(int32_t error) const
+    {
+        if (ErrorIsWouldBlock(error)) // Filter would block messages
         {
             return 0;
         }
 
-        m_recvPackets++;
-        m_recvBytes += receivedBytes;
-        return receivedBytes;
+        bool ignoreForciblyClosedError = false;
+        if (ErrorIsForciblyClosed(error, ignoreForciblyClosedError))
+        {
+            return ignoreForciblyClosedError ? 0 : SocketOpResultError;
+        }
+
+        AZLOG_ERROR("Failed to read from socket (%d:%s)", error, GetNetworkErrorDesc(error));
+        return 0;
     }
 
     int32_t UdpSocket::SendInternal(const IpAddress& address, const uint8_t* data, uint32_t size,
         [[maybe_unused]] bool encrypt, [[maybe_unused]] DtlsEndpoint& dtlsEndpoint) const
     {
+        if (net_UdpBatchSends && size <= MaxUdpTransmissionUnit)
+        {
+            if (m_queuedPayloads.full())
+            {
+                FlushSendBatch();
+            }
+
+            uint8_t* queuedData = m_queuedPayloadBuffer.data() + m_queuedPayloads.size() * MaxUdpTransmissionUnit;
+            memcpy(queuedData, data, size);
+            m_queuedPayloads.push_back(BatchedPayload{ address, queuedData, size });
+            return aznumeric_cast<int32_t>(size);
+        }
+
         sockaddr_in destAddr;
         memset(&destAddr, 0, sizeof(destAddr));
         destAddr.sin_family = AF_INET;
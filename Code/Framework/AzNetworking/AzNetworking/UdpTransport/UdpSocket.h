@@ -12,6 +12,7 @@
 #include <AzNetworking/ConnectionLayer/IConnection.h>
 #include <AzNetworking/UdpTransport/DtlsEndpoint.h>
 #include <AzCore/Math/Random.h>
+#include <AzCore/std/containers/array.h>
 #include <AzCore/std/containers/fixed_vector.h>
 
 #ifndef _RELEASE
@@ -41,6 +42,18 @@ namespace AzNetworking
             True   // Socket can accept incoming connections and may require a valid certificate and private key file
         };
 
+        //! Maximum number of payloads that are received or sent with a single batch.
+        static constexpr uint32_t MaxBatchedPayloadCount = 64;
+
+        //! A single payload of a batched receive or send.
+        struct BatchedPayload
+        {
+            IpAddress m_address;
+            uint8_t*  m_data = nullptr;
+            //! For receives, the capacity of m_data when passed in and the number of received bytes on return
+            uint32_t  m_size = 0;
+        };
+
         UdpSocket() = default;
         virtual ~UdpSocket();
 
@@ -71,6 +84,11 @@ namespace AzNetworking
         //! Closes an open socket.
         virtual void Close();
 
+        //! Allows other sockets to bind the same port, so incoming datagrams can be read by multiple reader threads.
+        //! Has to be called before Open, see SetSocketReusePort.
+        //! @param reusePort if true, the socket will be opened with port reuse enabled
+        void SetReusePort(bool reusePort);
+
         //! Returns true if the UDP socket is currently in an open state.
         //! @return boolean true if the socket is in a connected state
         bool IsOpen() const;
@@ -92,6 +110,16 @@ namespace AzNetworking
         //! @return number of bytes received, <= 0 on error
         int32_t Receive(IpAddress& outAddress, uint8_t* outData, uint32_t size) const;
 
+        //! Receives multiple payloads from the UDP socket, using a single system call on platforms that support it.
+        //! @param payloads     the buffers to receive the payloads into, on success the address and size of each received payload are set
+        //! @param payloadCount number of buffers, at most MaxBatchedPayloadCount
+        //! @return number of payloads received, < 0 on error
+        int32_t ReceiveBatch(BatchedPayload* payloads, uint32_t payloadCount) const;
+
+        //! Sends all payloads that were queued since the last flush, see net_UdpBatchSends.
+        //! Called by the network interface once per update, and when the queue is full.
+        void FlushSendBatch() const;
+
         //! Returns the underlying socket file descriptor.
         //! @return the underlying socket file descriptor
         SocketFd GetSocketFd() const;
@@ -129,12 +157,21 @@ namespace AzNetworking
 
     private:
 
+        //! Filters errors that are expected for a non-blocking socket, and logs the others.
+        //! @return 0 if the error should be ignored, SocketOpResultError otherwise
+        int32_t HandleReceiveError(int32_t error) const;
+
         SocketFd m_socketFd = InvalidSocketFd;
+        bool m_reusePort = false;
         mutable uint32_t m_sentPackets = 0;
         mutable uint32_t m_sentBytes = 0;
         mutable uint32_t m_recvPackets = 0;
         mutable uint32_t m_recvBytes = 0;
 
+        // Payloads queued for the next FlushSendBatch, each one is stored in its own transmission unit sized slot of the buffer
+        mutable AZStd::fixed_vector<BatchedPayload, MaxBatchedPayloadCount> m_queuedPayloads;
+        mutable AZStd::array<uint8_t, MaxBatchedPayloadCount * MaxUdpTransmissionUnit> m_queuedPayloadBuffer;
+
 #ifdef ENABLE_LATENCY_DEBUG
         struct DeferredData
         {
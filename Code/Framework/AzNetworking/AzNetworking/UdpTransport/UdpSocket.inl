@@ -14,6 +14,12 @@ namespace AzNetworking
         return (m_socketFd > SocketFd{ 0 });
     }
 
+    inline void UdpSocket::SetReusePort(bool reusePort)
+    {
+        AZ_Assert(!IsOpen(), "Port reuse has to be set before opening the socket");
+        m_reusePort = reusePort;
+    }
+
     inline SocketFd UdpSocket::GetSocketFd() const
     {
         return m_socketFd;
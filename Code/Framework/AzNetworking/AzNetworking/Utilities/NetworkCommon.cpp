@@ -6,6 +6,7 @@
  */
 
 #include <AzNetworking/Utilities/NetworkCommon.h>
+#include <AzNetworking/AzNetworking_Traits_Platform.h>
 #include <AzNetworking/Utilities/NetworkIncludes.h>
 #include <AzCore/Console/ILogger.h>
 
@@ -70,6 +71,25 @@ namespace AzNetworking
         return true;
     }
 
+    bool SetSocketReusePort([[maybe_unused]] SocketFd socketFd)
+    {
+#if AZ_TRAIT_USE_SOCKET_REUSEPORT
+        int flag = 1;
+
+        if (setsockopt(int32_t(socketFd), SOL_SOCKET, SO_REUSEPORT, (char *)&flag, sizeof(int)) != SocketOpResultSuccess)
+        {
+            const int32_t error = GetLastNetworkError();
+            AZLOG_ERROR("Failed to enable port reuse for socket (%d:%s)", error, GetNetworkErrorDesc(error));
+            return false;
+        }
+
+        return true;
+#else
+        AZLOG_ERROR("Port reuse is not supported on this platform");
+        return false;
+#endif
+    }
+
     bool SetSocketBufferSizes(SocketFd socketFd, int32_t sendSize, int32_t recvSize)
     {
         if (setsockopt(int32_t(socketFd), SOL_SOCKET, SO_SNDBUF, (const char *)&sendSize, sizeof(sendSize)) != SocketOpResultSuccess)
@@ -74,6 +74,12 @@ namespace AzNetworking
     //! @return boolean true on success
     bool SetSocketNoDelay(SocketFd socketFd);
 
+    //! Allows multiple sockets to bind the same port, the kernel distributes incoming datagrams between them by source address.
+    //! Only supported on platforms with AZ_TRAIT_USE_SOCKET_REUSEPORT.
+    //! @param socketFd identifier of the socket to allow port reuse for, has to be called before binding the socket
+    //! @return boolean true on success
+    bool SetSocketReusePort(SocketFd socketFd);
+
     //! Changes network socket receive buffer size.
     //! @param socketFd identifier of the socket to change the receive buffer size of
     //! @param sendSize requested send buffer size
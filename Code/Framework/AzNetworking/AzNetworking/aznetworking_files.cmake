@@ -33,6 +33,8 @@ set(FILES
     DataStructures/FixedSizeVectorBitset.h
     DataStructures/FixedSizeVectorBitset.inl
     DataStructures/IBitset.h
+    DataStructures/ObjectPool.h
+    DataStructures/ObjectPool.inl
     DataStructures/RingBufferBitset.h
     DataStructures/RingBufferBitset.inl
     DataStructures/TimeoutQueue.cpp
@@ -55,6 +57,10 @@ set(FILES
     Serialization/HashSerializer.h
     Serialization/ISerializer.h
     Serialization/ISerializer.inl
+    Serialization/NetworkBitInputSerializer.cpp
+    Serialization/NetworkBitInputSerializer.h
+    Serialization/NetworkBitOutputSerializer.cpp
+    Serialization/NetworkBitOutputSerializer.h
     Serialization/NetworkInputSerializer.cpp
     Serialization/NetworkInputSerializer.h
     Serialization/NetworkInputSerializer.inl
@@ -95,6 +101,8 @@ set(FILES
     UdpTransport/DtlsEndpoint.h
     UdpTransport/DtlsSocket.cpp
     UdpTransport/DtlsSocket.h
+    UdpTransport/UdpCongestionController.cpp
+    UdpTransport/UdpCongestionController.h
     UdpTransport/UdpConnection.cpp
     UdpTransport/UdpConnection.h
     UdpTransport/UdpConnection.inl
@@ -6,6 +6,7 @@
 #
 
 set(FILES
+    ../Common/Default/AzNetworking/UdpTransport/UdpSocket_Default.cpp
     ../Common/Default/AzNetworking/Utilities/IpAddress_Default.cpp
     ../Common/UnixLike/AzNetworking/Utilities/Endian_UnixLike.h
     ../Common/UnixLike/AzNetworking/Utilities/NetworkCommon_UnixLike.cpp
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ * 
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/UdpTransport/UdpSocket.h>
+#include <AzNetworking/Utilities/NetworkIncludes.h>
+
+namespace AzNetworking
+{
+    namespace Platform
+    {
+        // Platforms without batched socket calls fall back to a system call per payload
+
+        int32_t ReceivePayloads(SocketFd socketFd, UdpSocket::BatchedPayload* payloads, uint32_t payloadCount)
+        {
+            for (uint32_t i = 0; i < payloadCount; ++i)
+            {
+                sockaddr_in from;
+                socklen_t   fromLen = sizeof(from);
+
+                const int32_t receivedBytes = recvfrom(static_cast<int32_t>(socketFd), reinterpret_cast<char*>(payloads[i].m_data),
+                    static_cast<int32_t>(payloads[i].m_size), 0, (sockaddr*)&from, &fromLen);
+                if (receivedBytes < 0)
+                {
+                    // Report the error on the next call if some payloads were already received
+                    return (i > 0) ? static_cast<int32_t>(i) : receivedBytes;
+                }
+
+                payloads[i].m_address = IpAddress(ByteOrder::Network, from.sin_addr.s_addr, from.sin_port);
+                payloads[i].m_size = static_cast<uint32_t>(receivedBytes);
+            }
+            return static_cast<int32_t>(payloadCount);
+        }
+
+        int32_t SendPayloads(SocketFd socketFd, const UdpSocket::BatchedPayload* payloads, uint32_t payloadCount)
+        {
+            for (uint32_t i = 0; i < payloadCount; ++i)
+            {
+                sockaddr_in destAddr;
+                memset(&destAddr, 0, sizeof(destAddr));
+                destAddr.sin_family = AF_INET;
+                destAddr.sin_addr.s_addr = payloads[i].m_address.GetAddress(ByteOrder::Network);
+                destAddr.sin_port = payloads[i].m_address.GetPort(ByteOrder::Network);
+
+                if (sendto(static_cast<int32_t>(socketFd), reinterpret_cast<const char*>(payloads[i].m_data), payloads[i].m_size, 0,
+                    (sockaddr*)&destAddr, sizeof(destAddr)) < 0)
+                {
+                    return static_cast<int32_t>(i);
+                }
+            }
+            return static_cast<int32_t>(payloadCount);
+        }
+    }
+}
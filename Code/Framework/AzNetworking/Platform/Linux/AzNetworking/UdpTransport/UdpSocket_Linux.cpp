@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ * 
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/UdpTransport/UdpSocket.h>
+#include <AzNetworking/Utilities/NetworkIncludes.h>
+
+namespace AzNetworking
+{
+    namespace Platform
+    {
+        int32_t ReceivePayloads(SocketFd socketFd, UdpSocket::BatchedPayload* payloads, uint32_t payloadCount)
+        {
+            mmsghdr messages[UdpSocket::MaxBatchedPayloadCount];
+            iovec buffers[UdpSocket::MaxBatchedPayloadCount];
+            sockaddr_in addresses[UdpSocket::MaxBatchedPayloadCount];
+            memset(messages, 0, sizeof(mmsghdr) * payloadCount);
+
+            for (uint32_t i = 0; i < payloadCount; ++i)
+            {
+                buffers[i].iov_base = payloads[i].m_data;
+                buffers[i].iov_len = payloads[i].m_size;
+                messages[i].msg_hdr.msg_name = &addresses[i];
+                messages[i].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+                messages[i].msg_hdr.msg_iov = &buffers[i];
+                messages[i].msg_hdr.msg_iovlen = 1;
+            }
+
+            // Returns immediately with what is available, the socket is non-blocking
+            const int32_t receivedCount = recvmmsg(static_cast<int32_t>(socketFd), messages, payloadCount, 0, nullptr);
+            for (int32_t i = 0; i < receivedCount; ++i)
+            {
+                payloads[i].m_address = IpAddress(ByteOrder::Network, addresses[i].sin_addr.s_addr, addresses[i].sin_port);
+                payloads[i].m_size = messages[i].msg_len;
+            }
+            return receivedCount;
+        }
+
+        int32_t SendPayloads(SocketFd socketFd, const UdpSocket::BatchedPayload* payloads, uint32_t payloadCount)
+        {
+            mmsghdr messages[UdpSocket::MaxBatchedPayloadCount];
+            iovec buffers[UdpSocket::MaxBatchedPayloadCount];
+            sockaddr_in addresses[UdpSocket::MaxBatchedPayloadCount];
+            memset(messages, 0, sizeof(mmsghdr) * payloadCount);
+            memset(addresses, 0, sizeof(sockaddr_in) * payloadCount);
+
+            for (uint32_t i = 0; i < payloadCount; ++i)
+            {
+                addresses[i].sin_family = AF_INET;
+                addresses[i].sin_addr.s_addr = payloads[i].m_address.GetAddress(ByteOrder::Network);
+                addresses[i].sin_port = payloads[i].m_address.GetPort(ByteOrder::Network);
+                buffers[i].iov_base = payloads[i].m_data;
+                buffers[i].iov_len = payloads[i].m_size;
+                messages[i].msg_hdr.msg_name = &addresses[i];
+                messages[i].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+                messages[i].msg_hdr.msg_iov = &buffers[i];
+                messages[i].msg_hdr.msg_iovlen = 1;
+            }
+
+            // sendmmsg can return before all messages are sent, so keep going until it fails
+            uint32_t sentCount = 0;
+            while (sentCount < payloadCount)
+            {
+                const int32_t result = sendmmsg(static_cast<int32_t>(socketFd), messages + sentCount, payloadCount - sentCount, 0);
+                if (result <= 0)
+                {
+                    break;
+                }
+                sentCount += static_cast<uint32_t>(result);
+            }
+            return static_cast<int32_t>(sentCount);
+        }
+    }
+}
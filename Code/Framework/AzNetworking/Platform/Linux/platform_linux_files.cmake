@@ -11,6 +11,7 @@ set(FILES
     ../Common/UnixLike/AzNetworking/Utilities/NetworkCommon_UnixLike.cpp
     ../Common/UnixLike/AzNetworking/Utilities/NetworkIncludes_UnixLike.h
     AzNetworking/AzNetworking_Traits_Platform.h
+    AzNetworking/UdpTransport/UdpSocket_Linux.cpp
     AzNetworking/Utilities/Endian_Platform.h
     AzNetworking/Utilities/NetworkIncludes_Platform.h
 )
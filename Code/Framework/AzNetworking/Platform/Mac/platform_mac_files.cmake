@@ -7,6 +7,7 @@
 
 set(FILES
     ../Common/Apple/AzNetworking/Utilities/Endian_Apple.h
+    ../Common/Default/AzNetworking/UdpTransport/UdpSocket_Default.cpp
     ../Common/Default/AzNetworking/Utilities/IpAddress_Default.cpp
     ../Common/UnixLike/AzNetworking/Utilities/NetworkCommon_UnixLike.cpp
     ../Common/UnixLike/AzNetworking/Utilities/NetworkIncludes_UnixLike.h
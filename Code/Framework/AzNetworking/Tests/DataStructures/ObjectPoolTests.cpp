@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ * 
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/DataStructures/ObjectPool.h>
+#include <AzNetworking/DataStructures/ByteBuffer.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    using TestObjectPool = AzNetworking::ObjectPool<AzNetworking::ChunkBuffer, 2>;
+
+    TEST(ObjectPool, AcquireFromEmptyPool)
+    {
+        TestObjectPool pool;
+        TestObjectPool::ObjectPtr object = pool.Acquire();
+        EXPECT_NE(object.get(), nullptr);
+        EXPECT_EQ(pool.GetCachedCount(), 0u);
+    }
+
+    TEST(ObjectPool, ReleasedObjectIsReused)
+    {
+        TestObjectPool pool;
+        TestObjectPool::ObjectPtr object = pool.Acquire();
+        const AzNetworking::ChunkBuffer* address = object.get();
+
+        pool.Release(AZStd::move(object));
+        EXPECT_EQ(object.get(), nullptr);
+        EXPECT_EQ(pool.GetCachedCount(), 1u);
+
+        object = pool.Acquire();
+        EXPECT_EQ(object.get(), address);
+        EXPECT_EQ(pool.GetCachedCount(), 0u);
+    }
+
+    TEST(ObjectPool, ReleaseBeyondCapacity)
+    {
+        TestObjectPool pool;
+        TestObjectPool::ObjectPtr objects[3] = { pool.Acquire(), pool.Acquire(), pool.Acquire() };
+        for (TestObjectPool::ObjectPtr& object : objects)
+        {
+            pool.Release(AZStd::move(object));
+        }
+        EXPECT_EQ(pool.GetCachedCount(), 2u);
+
+        pool.Release(nullptr);
+        EXPECT_EQ(pool.GetCachedCount(), 2u);
+
+        pool.Clear();
+        EXPECT_EQ(pool.GetCachedCount(), 0u);
+    }
+}
@@ -1,6 +1,6 @@
 /*
  * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
- * 
+ *
  * SPDX-License-Identifier: Apache-2.0 OR MIT
  *
  */
@@ -10,4 +10,93 @@
 
 namespace UnitTest
 {
+    using namespace AzNetworking;
+
+    struct DeltaTestObject
+    {
+        bool m_flag = false;
+        int32_t m_signed = 0;
+        uint16_t m_bounded = 0;
+        float m_float = 0.0f;
+
+        bool Serialize(ISerializer& serializer)
+        {
+            serializer.Serialize(m_flag, "Flag");
+            serializer.Serialize(m_signed, "Signed");
+            serializer.Serialize(m_bounded, "Bounded", uint16_t(0), uint16_t(1000));
+            serializer.Serialize(m_float, "Float");
+            return serializer.IsValid();
+        }
+    };
+
+    TEST(DeltaSerializerTests, BitPackedRoundTrip)
+    {
+        DeltaTestObject input;
+        input.m_flag = true;
+        input.m_signed = -3;
+        input.m_bounded = 999;
+        input.m_float = 1.5f;
+
+        uint8_t buffer[64];
+        NetworkBitInputSerializer inputSerializer(buffer, sizeof(buffer));
+        EXPECT_TRUE(input.Serialize(inputSerializer));
+
+        // 1 bit flag, 1 byte zigzag varint, 10 bit bounded value and 32 bit float
+        EXPECT_EQ(inputSerializer.GetSizeInBits(), 1u + 8u + 10u + 32u);
+        EXPECT_EQ(inputSerializer.GetSize(), 7u);
+
+        DeltaTestObject output;
+        NetworkBitOutputSerializer outputSerializer(buffer, inputSerializer.GetSize());
+        EXPECT_TRUE(output.Serialize(outputSerializer));
+        EXPECT_EQ(output.m_flag, input.m_flag);
+        EXPECT_EQ(output.m_signed, input.m_signed);
+        EXPECT_EQ(output.m_bounded, input.m_bounded);
+        EXPECT_EQ(output.m_float, input.m_float);
+    }
+
+    TEST(DeltaSerializerTests, BitPackedOverflowFails)
+    {
+        DeltaTestObject input;
+        input.m_signed = AZStd::numeric_limits<int32_t>::min();
+
+        uint8_t buffer[4];
+        NetworkBitInputSerializer inputSerializer(buffer, sizeof(buffer));
+        EXPECT_FALSE(input.Serialize(inputSerializer));
+    }
+
+    TEST(DeltaSerializerTests, DeltaRoundTrip)
+    {
+        DeltaTestObject base;
+        DeltaTestObject current = base;
+        current.m_bounded = 42;
+
+        SerializerDelta delta;
+        DeltaSerializerCreate createSerializer(delta);
+        EXPECT_TRUE(createSerializer.CreateDelta(base, current));
+        EXPECT_EQ(delta.GetNumDirtyBits(), 4u);
+
+        DeltaTestObject output = base;
+        DeltaSerializerApply applySerializer(delta);
+        EXPECT_TRUE(applySerializer.ApplyDelta(output));
+        EXPECT_EQ(output.m_bounded, 42);
+        EXPECT_EQ(output.m_signed, base.m_signed);
+    }
+
+    TEST(DeltaSerializerTests, UnchangedObjectProducesEmptyDelta)
+    {
+        DeltaTestObject base;
+        base.m_signed = 7;
+        DeltaTestObject current = base;
+
+        SerializerDelta delta;
+        DeltaSerializerCreate createSerializer(delta);
+        EXPECT_TRUE(createSerializer.CreateDelta(base, current));
+        EXPECT_EQ(delta.GetNumDirtyBits(), 0u);
+        EXPECT_EQ(delta.GetBufferSize(), 0u);
+
+        DeltaTestObject output = base;
+        DeltaSerializerApply applySerializer(delta);
+        EXPECT_TRUE(applySerializer.ApplyDelta(output));
+        EXPECT_EQ(output.m_signed, 7);
+    }
 }
@@ -5,9 +5,11 @@
  *
  */
 
+#include <AzNetworking/UdpTransport/UdpCongestionController.h>
 #include <AzNetworking/UdpTransport/UdpNetworkInterface.h>
 #include <AzNetworking/UdpTransport/UdpPacketTracker.h>
 #include <AzNetworking/UdpTransport/UdpPacketIdWindow.h>
+#include <AzNetworking/UdpTransport/UdpSocket.h>
 #include <AzNetworking/ConnectionLayer/IConnectionListener.h>
 #include <AzNetworking/Framework/NetworkingSystemComponent.h>
 #include <AzNetworking/AutoGen/CorePackets.AutoPackets.h>
@@ -243,6 +245,31 @@ namespace UnitTest
         EXPECT_EQ(ackState, PacketAckState::Nacked); // Testing that PacketId is not flagged as acked
     }
 
+    TEST_F(UdpTransportTests, CongestionControllerBandwidthEstimate)
+    {
+        constexpr uint32_t TestPacketSize = 1000;
+        constexpr uint32_t TestPacketCount = 10;
+
+        UdpCongestionController congestionController;
+        for (uint32_t i = 0; i < TestPacketCount; ++i)
+        {
+            const PacketId packetId = PacketId(i + 1);
+            const AZ::TimeMs currentTimeMs = AZ::TimeMs{ 1000 + i * 10 };
+            congestionController.OnPacketSent(packetId, TestPacketSize, currentTimeMs);
+            congestionController.OnPacketAcked(packetId, currentTimeMs, 0.05f);
+        }
+
+        // Six packets were acked within the first 50 millisecond sample
+        EXPECT_FLOAT_EQ(congestionController.GetBottleneckBytesPerSecond(), 6.0f * TestPacketSize * 1000.0f / 50.0f);
+        EXPECT_GE(congestionController.GetPacingRateBytesPerSecond(), congestionController.GetBottleneckBytesPerSecond());
+
+        // Unknown packets don't count as delivered
+        congestionController.Reset();
+        congestionController.OnPacketAcked(PacketId(1), AZ::TimeMs{ 1000 }, 0.05f);
+        congestionController.OnPacketAcked(PacketId(2), AZ::TimeMs{ 1100 }, 0.05f);
+        EXPECT_FLOAT_EQ(congestionController.GetBottleneckBytesPerSecond(), 0.0f);
+    }
+
     TEST_F(UdpTransportTests, TestSingleClient)
     {
         TestUdpServer testServer;
@@ -298,4 +325,50 @@ namespace UnitTest
             EXPECT_EQ(testClient[i].m_clientNetworkInterface->GetConnectionSet().GetConnectionCount(), 1);
         }
     }
+
+    TEST_F(UdpTransportTests, TestBatchedReceive)
+    {
+        constexpr uint32_t NumTestPayloads = 8;
+
+        UdpSocket sendSocket;
+        UdpSocket recvSocket;
+        EXPECT_TRUE(sendSocket.Open(0, UdpSocket::CanAcceptConnections::False, TrustZone::ExternalClientToServer));
+        EXPECT_TRUE(recvSocket.Open(12346, UdpSocket::CanAcceptConnections::True, TrustZone::ExternalClientToServer));
+
+        DtlsEndpoint dtlsEndpoint;
+        ConnectionQuality connectionQuality;
+        for (uint8_t i = 0; i < NumTestPayloads; ++i)
+        {
+            uint8_t payload[NumTestPayloads];
+            memset(payload, i, sizeof(payload));
+            EXPECT_GT(sendSocket.Send(IpAddress(127, 0, 0, 1, 12346), payload, i + 1, false, dtlsEndpoint, connectionQuality), 0);
+        }
+
+        uint8_t buffers[UdpSocket::MaxBatchedPayloadCount][MaxUdpTransmissionUnit];
+        UdpSocket::BatchedPayload payloads[UdpSocket::MaxBatchedPayloadCount];
+        uint32_t receivedCount = 0;
+        const AZ::TimeMs startTimeMs = AZ::GetElapsedTimeMs();
+        while (receivedCount < NumTestPayloads && AZ::GetElapsedTimeMs() - startTimeMs < AZ::TimeMs{ 1000 })
+        {
+            for (uint32_t i = 0; i < UdpSocket::MaxBatchedPayloadCount; ++i)
+            {
+                payloads[i].m_data = buffers[i];
+                payloads[i].m_size = MaxUdpTransmissionUnit;
+            }
+
+            const int32_t batchCount = recvSocket.ReceiveBatch(payloads, UdpSocket::MaxBatchedPayloadCount);
+            EXPECT_GE(batchCount, 0);
+            for (int32_t i = 0; i < batchCount; ++i)
+            {
+                // Loopback preserves the send order
+                EXPECT_EQ(payloads[i].m_size, receivedCount + 1);
+                EXPECT_EQ(payloads[i].m_data[0], receivedCount);
+                ++receivedCount;
+            }
+            AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(5));
+        }
+
+        EXPECT_EQ(receivedCount, NumTestPayloads);
+        EXPECT_EQ(recvSocket.GetRecvPackets(), NumTestPayloads);
+    }
 }
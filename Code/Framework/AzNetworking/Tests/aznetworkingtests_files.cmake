@@ -12,6 +12,7 @@ set(FILES
     DataStructures/FixedSizeBitsetTests.cpp
     DataStructures/FixedSizeBitsetViewTests.cpp
     DataStructures/FixedSizeVectorBitsetTests.cpp
+    DataStructures/ObjectPoolTests.cpp
     DataStructures/RingBufferBitsetTests.cpp
     DataStructures/TimeoutQueueTests.cpp
     Serialization/DeltaSerializerTests.cpp
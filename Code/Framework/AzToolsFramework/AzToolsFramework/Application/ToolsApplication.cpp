@@ -7,6 +7,7 @@
 
 #include "AzToolsFramework_precompiled.h"
 
+#include <AzCore/Console/Console.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
@@ -83,6 +84,14 @@ AZ_POP_DISABLE_OVERRIDE_WARNING
 // For now we'll stick with the CRT new/delete in tools.
 //#include <AzCore/Memory/NewAndDelete.inl>
 
+AZ_CVAR(
+    uint64_t,
+    ed_undoHistoryMemoryBudgetMb,
+    256,
+    nullptr,
+    AZ::ConsoleFunctorFlags::Null,
+    "Memory budget of the undo history in megabytes, the oldest undo steps are removed once it is exceeded (0 for no budget)");
+
 namespace AzToolsFramework
 {
     namespace Internal
@@ -1519,6 +1528,7 @@ namespace AzToolsFramework
             // record each undo batch
             if (m_undoStack && changed)
             {
+                m_undoStack->SetMemoryBudget(static_cast<AZStd::size_t>(ed_undoHistoryMemoryBudgetMb) * 1024 * 1024);
                 m_undoStack->Post(m_currentBatchUndo);
             }
             else
@@ -34,7 +34,7 @@ namespace AzToolsFramework
 
         size_t ProductThumbnailKey::GetHash() const
         {
-            return m_assetType.GetHash();
+            return AZStd::hash<AZ::Data::AssetId>()(m_assetId);
         }
 
         bool ProductThumbnailKey::Equals(const ThumbnailKey* other) const
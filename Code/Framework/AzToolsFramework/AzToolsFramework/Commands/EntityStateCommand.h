@@ -62,6 +62,11 @@ namespace AzToolsFramework
 
         bool Changed() const override { return m_undoState != m_redoState; }
 
+        AZStd::size_t GetMemoryUsage() const override
+        {
+            return m_undoState.capacity() + m_redoState.capacity() + URSequencePoint::GetMemoryUsage();
+        }
+
     protected:
 
         void RestoreEntity(const AZ::u8* buffer, AZStd::size_t bufferSizeBytes, const AZ::SliceComponent::EntityRestoreInfo& sliceRestoreInfo) const;
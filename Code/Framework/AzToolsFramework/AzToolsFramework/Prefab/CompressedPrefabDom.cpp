@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzToolsFramework/Prefab/CompressedPrefabDom.h>
+
+#include <AzCore/Compression/Compression.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/JSON/stringbuffer.h>
+#include <AzCore/JSON/writer.h>
+
+namespace AzToolsFramework
+{
+    namespace Prefab
+    {
+        namespace Internal
+        {
+            // Prefab json is very repetitive, the fastest level already shrinks it several times over
+            static constexpr unsigned int s_compressionLevel = 1;
+        }
+
+        CompressedPrefabDom::CompressedPrefabDom(const PrefabDomValue& dom)
+        {
+            Store(dom);
+        }
+
+        void CompressedPrefabDom::Store(const PrefabDomValue& dom)
+        {
+            AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzToolsFramework);
+
+            rapidjson::StringBuffer buffer;
+            rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+            dom.Accept(writer);
+
+            const unsigned int uncompressedSize = static_cast<unsigned int>(buffer.GetSize());
+
+            AZ::ZLib compressor;
+            compressor.StartCompressor(Internal::s_compressionLevel);
+
+            AZStd::vector<AZ::u8> compressedData;
+            compressedData.resize_no_construct(compressor.GetMinCompressedBufferSize(uncompressedSize));
+
+            // The buffer is large enough for the whole stream, so a single call finishes it
+            unsigned int remainingSize = uncompressedSize;
+            const unsigned int compressedSize = compressor.Compress(
+                buffer.GetString(), remainingSize, compressedData.data(), static_cast<unsigned int>(compressedData.size()),
+                AZ::ZLib::FT_FINISH);
+            AZ_Assert(remainingSize == 0, "CompressedPrefabDom - Failed to compress the whole prefab dom.");
+
+            m_compressedData.assign(compressedData.begin(), compressedData.begin() + compressedSize);
+            m_uncompressedSize = uncompressedSize;
+        }
+
+        bool CompressedPrefabDom::Load(PrefabDom& outDom) const
+        {
+            AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzToolsFramework);
+
+            if (IsEmpty())
+            {
+                outDom.SetNull();
+                return true;
+            }
+
+            AZStd::vector<char> json;
+            json.resize_no_construct(m_uncompressedSize);
+
+            AZ::ZLib decompressor;
+            decompressor.StartDecompressor();
+
+            unsigned int remainingSize = m_uncompressedSize;
+            decompressor.Decompress(
+                m_compressedData.data(), static_cast<unsigned int>(m_compressedData.size()), json.data(), remainingSize,
+                AZ::ZLib::FT_FINISH);
+            if (remainingSize != 0)
+            {
+                AZ_Error("Prefab", false, "CompressedPrefabDom - Failed to decompress the prefab dom.");
+                outDom.SetNull();
+                return false;
+            }
+
+            outDom.Parse(json.data(), json.size());
+            if (outDom.HasParseError())
+            {
+                AZ_Error("Prefab", false, "CompressedPrefabDom - Failed to parse the decompressed prefab dom.");
+                outDom.SetNull();
+                return false;
+            }
+            return true;
+        }
+
+        void CompressedPrefabDom::Clear()
+        {
+            m_compressedData = {};
+            m_uncompressedSize = 0;
+        }
+
+    } // namespace Prefab
+} // namespace AzToolsFramework
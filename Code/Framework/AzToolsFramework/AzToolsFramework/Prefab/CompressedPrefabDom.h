@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzToolsFramework/Prefab/PrefabDomTypes.h>
+
+namespace AzToolsFramework
+{
+    namespace Prefab
+    {
+        //! Compressed json copy of a PrefabDom, used to hold the doms kept around by the undo history
+        //! and the undo cache at a fraction of the size of a rapidjson document.
+        class CompressedPrefabDom
+        {
+        public:
+            CompressedPrefabDom() = default;
+            explicit CompressedPrefabDom(const PrefabDomValue& dom);
+
+            //! Replaces the stored dom with a compressed copy of the provided one.
+            void Store(const PrefabDomValue& dom);
+
+            //! Decompresses the stored dom into outDom, which is set to null if nothing was stored.
+            //! @return false if the stored data could not be decompressed or parsed.
+            bool Load(PrefabDom& outDom) const;
+
+            void Clear();
+            bool IsEmpty() const { return m_compressedData.empty(); }
+
+            //! Returns the number of bytes held by the compressed data.
+            AZStd::size_t GetMemoryUsage() const { return m_compressedData.capacity(); }
+
+        private:
+            AZStd::vector<AZ::u8> m_compressedData;
+            unsigned int m_uncompressedSize = 0;
+        };
+
+    } // namespace Prefab
+} // namespace AzToolsFramework
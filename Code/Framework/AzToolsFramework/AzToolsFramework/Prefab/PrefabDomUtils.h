@@ -62,7 +62,7 @@ namespace AzToolsFramework
             * @return bool on whether the operation succeeded.
             */
             bool LoadInstanceFromPrefabDom(
-                Instance& instance, const PrefabDom& prefabDom, LoadInstanceFlags flags = LoadInstanceFlags::None);
+                Instance& instance, const PrefabDomValue& prefabDom, LoadInstanceFlags flags = LoadInstanceFlags::None);
 
             /**
             * Loads a valid Prefab Instance from a Prefab Dom. Useful for generating Instances.
@@ -73,7 +73,7 @@ namespace AzToolsFramework
             * @return bool on whether the operation succeeded.
             */
             bool LoadInstanceFromPrefabDom(
-                Instance& instance, const PrefabDom& prefabDom, AZStd::vector<AZ::Data::Asset<AZ::Data::AssetData>>& referencedAssets,
+                Instance& instance, const PrefabDomValue& prefabDom, AZStd::vector<AZ::Data::Asset<AZ::Data::AssetData>>& referencedAssets,
                 LoadInstanceFlags flags = LoadInstanceFlags::None);
 
             /**
@@ -86,7 +86,7 @@ namespace AzToolsFramework
             * @return bool on whether the operation succeeded.
             */
             bool LoadInstanceFromPrefabDom(
-                Instance& instance, Instance::EntityList& newlyAddedEntities, const PrefabDom& prefabDom,
+                Instance& instance, Instance::EntityList& newlyAddedEntities, const PrefabDomValue& prefabDom,
                 LoadInstanceFlags flags = LoadInstanceFlags::None);
 
             inline PrefabDomPath GetPrefabDomInstancePath(const char* instanceName)
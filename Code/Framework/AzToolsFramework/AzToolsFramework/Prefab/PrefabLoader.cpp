@@ -9,7 +9,11 @@
 #include <AzToolsFramework/Prefab/PrefabLoader.h>
 
 #include <AzCore/Component/Entity.h>
+#include <AzCore/Debug/Profiler.h>
 #include <AzCore/IO/Path/Path.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/Settings/SettingsRegistryMergeUtils.h>
 #include <AzCore/StringFunc/StringFunc.h>
 
@@ -69,6 +73,12 @@ namespace AzToolsFramework
                 return InvalidTemplateId;
             }
 
+            // Nested templates preloaded along with the root template are already read and parsed.
+            if (!m_preloadedTemplateDoms.empty() && m_preloadedTemplateDoms.contains(GenerateRelativePath(filePath)))
+            {
+                return LoadTemplateFromString({}, filePath, progressedFilePathsSet);
+            }
+
             auto readResult = AZ::Utils::ReadFile(GetFullPath(filePath).Native(), AZStd::numeric_limits<size_t>::max());
             if (!readResult.IsSuccess())
             {
@@ -132,26 +142,45 @@ namespace AzToolsFramework
                 return loadedTemplateId;
             }
 
-            // Read Template's prefab file from disk and parse Prefab DOM from file.
-            AZ::Outcome<PrefabDom, AZStd::string> readPrefabFileResult = AzFramework::FileFunc::ReadJsonFromString(fileContent);
-            if (!readPrefabFileResult.IsSuccess())
+            // The root template preloads the whole hierarchy of templates nested in it.
+            const bool isRootTemplate = progressedFilePathsSet.empty();
+
+            PrefabDom templateDom;
+            auto preloadedDomIterator = m_preloadedTemplateDoms.find(relativePath);
+            if (preloadedDomIterator != m_preloadedTemplateDoms.end())
             {
-                AZ_Error(
-                    "Prefab", false,
-                    "PrefabLoader::LoadTemplate - Failed to load Prefab file from '%.*s'."
-                    "Error message: '%s'",
-                    AZ_STRING_ARG(originPath.Native()),
-                    readPrefabFileResult.GetError().c_str());
+                templateDom = AZStd::move(preloadedDomIterator->second);
+                m_preloadedTemplateDoms.erase(preloadedDomIterator);
+            }
+            else
+            {
+                // Read Template's prefab file from disk and parse Prefab DOM from file.
+                AZ::Outcome<PrefabDom, AZStd::string> readPrefabFileResult = AzFramework::FileFunc::ReadJsonFromString(fileContent);
+                if (!readPrefabFileResult.IsSuccess())
+                {
+                    AZ_Error(
+                        "Prefab", false,
+                        "PrefabLoader::LoadTemplate - Failed to load Prefab file from '%.*s'."
+                        "Error message: '%s'",
+                        AZ_STRING_ARG(originPath.Native()),
+                        readPrefabFileResult.GetError().c_str());
+
+                    return InvalidTemplateId;
+                }
+                templateDom = readPrefabFileResult.TakeValue();
+            }
 
-                return InvalidTemplateId;
+            if (isRootTemplate)
+            {
+                PreloadNestedTemplates(templateDom, relativePath);
             }
 
             // Add or replace the Source parameter in the dom
             PrefabDomPath sourcePath = PrefabDomPath((AZStd::string("/") + PrefabDomUtils::SourceName).c_str());
-            sourcePath.Set(readPrefabFileResult.GetValue(), relativePath.Native().c_str());
+            sourcePath.Set(templateDom, relativePath.Native().c_str());
 
             // Create new Template with the Prefab DOM.
-            TemplateId newTemplateId = m_prefabSystemComponentInterface->AddTemplate(relativePath, readPrefabFileResult.TakeValue());
+            TemplateId newTemplateId = m_prefabSystemComponentInterface->AddTemplate(relativePath, AZStd::move(templateDom));
             if (newTemplateId == InvalidTemplateId)
             {
                 AZ_Error(
@@ -162,6 +191,10 @@ namespace AzToolsFramework
                     AZ_STRING_ARG(originPath.Native())
                 );
 
+                if (isRootTemplate)
+                {
+                    m_preloadedTemplateDoms.clear();
+                }
                 return InvalidTemplateId;
             }
 
@@ -201,6 +234,12 @@ namespace AzToolsFramework
             // Un-mark the file as being in progress.
             progressedFilePathsSet.erase(originPath);
 
+            // Preloaded templates that weren't reached because of errors aren't kept around.
+            if (isRootTemplate)
+            {
+                m_preloadedTemplateDoms.clear();
+            }
+
             // Return target Template id.
             return newTemplateId;
         }
@@ -277,6 +316,104 @@ namespace AzToolsFramework
             return !nestedTemplateReference->get().IsLoadedWithErrors();
         }
 
+        void PrefabLoader::PreloadNestedTemplates(const PrefabDomValue& templateDom, const AZ::IO::Path& templatePath)
+        {
+            AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzToolsFramework);
+
+            if (!AZ::JobContext::GetGlobalContext())
+            {
+                return;
+            }
+
+            AZStd::unordered_set<AZ::IO::Path> visitedPaths = { templatePath };
+            AZStd::vector<PreloadedTemplate> pendingTemplates;
+            CollectNestedTemplates(templateDom, visitedPaths, pendingTemplates);
+
+            // The templates of a nesting level don't depend on each other, so they are read and parsed concurrently.
+            // Links are still resolved by LoadNestedInstance in dependency order, once the preloading is done.
+            while (!pendingTemplates.empty())
+            {
+                AZ::JobCompletion jobCompletion;
+                for (PreloadedTemplate& pendingTemplate : pendingTemplates)
+                {
+                    AZ::Job* job = AZ::CreateJobFunction(
+                        [&pendingTemplate]()
+                        {
+                            auto readResult =
+                                AZ::Utils::ReadFile(pendingTemplate.m_fullPath.Native(), AZStd::numeric_limits<size_t>::max());
+                            if (readResult.IsSuccess())
+                            {
+                                auto parseResult = AzFramework::FileFunc::ReadJsonFromString(readResult.GetValue());
+                                if (parseResult.IsSuccess())
+                                {
+                                    pendingTemplate.m_dom = parseResult.TakeValue();
+                                    pendingTemplate.m_isParsed = true;
+                                }
+                            }
+                        },
+                        true);
+                    job->SetDependent(&jobCompletion);
+                    job->Start();
+                }
+                jobCompletion.StartAndWaitForCompletion();
+
+                AZStd::vector<PreloadedTemplate> nextTemplates;
+                for (PreloadedTemplate& preloadedTemplate : pendingTemplates)
+                {
+                    // Templates that failed to read or parse are loaded again the regular way, which reports the error.
+                    if (preloadedTemplate.m_isParsed)
+                    {
+                        CollectNestedTemplates(preloadedTemplate.m_dom, visitedPaths, nextTemplates);
+                        m_preloadedTemplateDoms.emplace(AZStd::move(preloadedTemplate.m_relativePath), AZStd::move(preloadedTemplate.m_dom));
+                    }
+                }
+                pendingTemplates = AZStd::move(nextTemplates);
+            }
+        }
+
+        void PrefabLoader::CollectNestedTemplates(
+            const PrefabDomValue& templateDom,
+            AZStd::unordered_set<AZ::IO::Path>& visitedPaths,
+            AZStd::vector<PreloadedTemplate>& outTemplates)
+        {
+            PrefabDomValueConstReference instancesReference = PrefabDomUtils::FindPrefabDomValue(templateDom, PrefabDomUtils::InstancesName);
+            if (!instancesReference.has_value() || !instancesReference->get().IsObject())
+            {
+                return;
+            }
+
+            const PrefabDomValue& instances = instancesReference->get();
+            for (PrefabDomValue::ConstMemberIterator instanceIterator = instances.MemberBegin(); instanceIterator != instances.MemberEnd();
+                 ++instanceIterator)
+            {
+                PrefabDomValueConstReference sourceReference =
+                    PrefabDomUtils::FindPrefabDomValue(instanceIterator->value, PrefabDomUtils::SourceName);
+                if (!sourceReference.has_value() || !sourceReference->get().IsString() || sourceReference->get().GetStringLength() == 0)
+                {
+                    continue;
+                }
+
+                const PrefabDomValue& source = sourceReference->get();
+                AZ::IO::PathView sourcePath = AZStd::string_view(source.GetString(), source.GetStringLength());
+                if (!IsValidPrefabPath(sourcePath))
+                {
+                    continue;
+                }
+
+                AZ::IO::Path relativePath = GenerateRelativePath(sourcePath);
+                if (visitedPaths.contains(relativePath) ||
+                    m_prefabSystemComponentInterface->GetTemplateIdFromFilePath(relativePath) != InvalidTemplateId)
+                {
+                    continue;
+                }
+
+                visitedPaths.emplace(relativePath);
+                PreloadedTemplate& preloadedTemplate = outTemplates.emplace_back();
+                preloadedTemplate.m_relativePath = AZStd::move(relativePath);
+                preloadedTemplate.m_fullPath = GetFullPath(sourcePath);
+            }
+        }
+
         bool PrefabLoader::SaveTemplate(TemplateId templateId)
         {
             const auto& domAndFilepath = StoreTemplateIntoFileFormat(templateId);
@@ -11,7 +11,9 @@
 
 #include <AzCore/IO/Path/Path.h>
 #include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/string/string.h>
 #include <AzToolsFramework/Prefab/PrefabDomTypes.h>
 
@@ -144,6 +146,36 @@ namespace AzToolsFramework
             //! Retrieves Dom content and its path from a template id
             AZStd::optional<AZStd::pair<PrefabDom, AZ::IO::Path>> StoreTemplateIntoFileFormat(TemplateId templateId);
 
+            struct PreloadedTemplate
+            {
+                AZ::IO::Path m_relativePath;
+                AZ::IO::Path m_fullPath;
+                PrefabDom m_dom;
+                bool m_isParsed = false;
+            };
+
+            /**
+             * Reads and parses the files of all the templates nested in a template on the job system, one nesting level at a time,
+             * so that loading the nested instances afterwards finds their Prefab DOM in m_preloadedTemplateDoms.
+             * @param templateDom Prefab DOM of the template to preload the nested templates of.
+             * @param templatePath Relative path of the template, which isn't preloaded.
+             */
+            void PreloadNestedTemplates(const PrefabDomValue& templateDom, const AZ::IO::Path& templatePath);
+
+            /**
+             * Adds the nested templates of a template that aren't loaded or visited yet to the templates to preload.
+             * @param templateDom Prefab DOM of the template to collect the nested templates of.
+             * @param visitedPaths Relative paths of the templates already collected, updated with the new ones.
+             * @param outTemplates The templates to preload.
+             */
+            void CollectNestedTemplates(
+                const PrefabDomValue& templateDom,
+                AZStd::unordered_set<AZ::IO::Path>& visitedPaths,
+                AZStd::vector<PreloadedTemplate>& outTemplates);
+
+            //! Prefab DOMs of the nested templates parsed by PreloadNestedTemplates, by relative path.
+            AZStd::unordered_map<AZ::IO::Path, PrefabDom> m_preloadedTemplateDoms;
+
             PrefabSystemComponentInterface* m_prefabSystemComponentInterface = nullptr;
             AZ::IO::Path m_projectPathWithOsSeparator;
             AZ::IO::Path m_projectPathWithSlashSeparator;
@@ -23,6 +23,22 @@ namespace AzToolsFramework
             AZ_Assert(m_instanceToTemplateInterface, "Failed to grab instance to template interface");
         }
 
+        AZStd::size_t PrefabUndoBase::GetMemoryUsage() const
+        {
+            return m_redoPatch.GetMemoryUsage() + m_undoPatch.GetMemoryUsage() + URSequencePoint::GetMemoryUsage();
+        }
+
+        bool PrefabUndoBase::PatchTemplate(const CompressedPrefabDom& patch, InstanceOptionalReference instanceToExclude)
+        {
+            PrefabDom patchDom;
+            if (!patch.Load(patchDom))
+            {
+                return false;
+            }
+
+            return m_instanceToTemplateInterface->PatchTemplate(patchDom, m_templateId, instanceToExclude);
+        }
+
         //PrefabInstanceUndo
         PrefabUndoInstance::PrefabUndoInstance(const AZStd::string& undoOperationName)
             : PrefabUndoBase(undoOperationName)
@@ -36,18 +52,23 @@ namespace AzToolsFramework
         {
             m_templateId = templateId;
 
-            m_instanceToTemplateInterface->GeneratePatch(m_redoPatch, initialState, endState);
-            m_instanceToTemplateInterface->GeneratePatch(m_undoPatch, endState, initialState);
+            PrefabDom redoPatch;
+            m_instanceToTemplateInterface->GeneratePatch(redoPatch, initialState, endState);
+            m_redoPatch.Store(redoPatch);
+
+            PrefabDom undoPatch;
+            m_instanceToTemplateInterface->GeneratePatch(undoPatch, endState, initialState);
+            m_undoPatch.Store(undoPatch);
         }
 
         void PrefabUndoInstance::Undo()
         {
-            m_instanceToTemplateInterface->PatchTemplate(m_undoPatch, m_templateId);
+            PatchTemplate(m_undoPatch);
         }
 
         void PrefabUndoInstance::Redo()
         {
-            m_instanceToTemplateInterface->PatchTemplate(m_redoPatch, m_templateId);
+            PatchTemplate(m_redoPatch);
         }
 
 
@@ -81,16 +102,20 @@ namespace AzToolsFramework
             m_entityAlias = aliasReference.value();
 
             //generate undo/redo patches
-            m_instanceToTemplateInterface->GeneratePatch(m_redoPatch, initialState, endState);
-            m_instanceToTemplateInterface->AppendEntityAliasToPatchPaths(m_redoPatch, entityId);
-            m_instanceToTemplateInterface->GeneratePatch(m_undoPatch, endState, initialState);
-            m_instanceToTemplateInterface->AppendEntityAliasToPatchPaths(m_undoPatch, entityId);
+            PrefabDom redoPatch;
+            m_instanceToTemplateInterface->GeneratePatch(redoPatch, initialState, endState);
+            m_instanceToTemplateInterface->AppendEntityAliasToPatchPaths(redoPatch, entityId);
+            m_redoPatch.Store(redoPatch);
+
+            PrefabDom undoPatch;
+            m_instanceToTemplateInterface->GeneratePatch(undoPatch, endState, initialState);
+            m_instanceToTemplateInterface->AppendEntityAliasToPatchPaths(undoPatch, entityId);
+            m_undoPatch.Store(undoPatch);
         }
 
         void PrefabUndoEntityUpdate::Undo()
         {
-            [[maybe_unused]] bool isPatchApplicationSuccessful =
-                m_instanceToTemplateInterface->PatchTemplate(m_undoPatch, m_templateId);
+            [[maybe_unused]] bool isPatchApplicationSuccessful = PatchTemplate(m_undoPatch);
 
             AZ_Error(
                 "Prefab", isPatchApplicationSuccessful,
@@ -100,8 +125,7 @@ namespace AzToolsFramework
 
         void PrefabUndoEntityUpdate::Redo()
         {
-            [[maybe_unused]] bool isPatchApplicationSuccessful =
-                m_instanceToTemplateInterface->PatchTemplate(m_redoPatch, m_templateId);
+            [[maybe_unused]] bool isPatchApplicationSuccessful = PatchTemplate(m_redoPatch);
 
             AZ_Error(
                 "Prefab", isPatchApplicationSuccessful,
@@ -111,8 +135,7 @@ namespace AzToolsFramework
 
         void PrefabUndoEntityUpdate::Redo(InstanceOptionalReference instanceToExclude)
         {
-            [[maybe_unused]] bool isPatchApplicationSuccessful =
-                m_instanceToTemplateInterface->PatchTemplate(m_redoPatch, m_templateId, instanceToExclude);
+            [[maybe_unused]] bool isPatchApplicationSuccessful = PatchTemplate(m_redoPatch, instanceToExclude);
 
             AZ_Error(
                 "Prefab", isPatchApplicationSuccessful,
@@ -127,7 +150,6 @@ namespace AzToolsFramework
             , m_sourceId(InvalidTemplateId)
             , m_instanceAlias("")
             , m_linkId(InvalidLinkId)
-            , m_linkPatches(PrefabDom())
             , m_linkStatus(LinkStatus::LINKSTATUS)
         {
             m_prefabSystemComponentInterface = AZ::Interface<PrefabSystemComponentInterface>::Get();
@@ -146,7 +168,7 @@ namespace AzToolsFramework
             m_instanceAlias = instanceAlias;
             m_linkId = linkId;
 
-            m_linkPatches = AZStd::move(linkPatches);
+            m_linkPatches.Store(linkPatches);
 
             //if linkId is invalid, set as ADD
             if (m_linkId == InvalidLinkId)
@@ -197,6 +219,11 @@ namespace AzToolsFramework
             m_prefabSystemComponentInterface->PropagateTemplateChanges(m_targetId);
         }
 
+        AZStd::size_t PrefabUndoInstanceLink::GetMemoryUsage() const
+        {
+            return m_linkPatches.GetMemoryUsage() + PrefabUndoBase::GetMemoryUsage();
+        }
+
         LinkId PrefabUndoInstanceLink::GetLinkId()
         {
             return m_linkId;
@@ -204,7 +231,9 @@ namespace AzToolsFramework
 
         void PrefabUndoInstanceLink::AddLink()
         {
-            m_linkId = m_prefabSystemComponentInterface->CreateLink(m_targetId, m_sourceId, m_instanceAlias, m_linkPatches, m_linkId);
+            PrefabDom linkPatches;
+            m_linkPatches.Load(linkPatches);
+            m_linkId = m_prefabSystemComponentInterface->CreateLink(m_targetId, m_sourceId, m_instanceAlias, linkPatches, m_linkId);
         }
 
         void PrefabUndoInstanceLink::RemoveLink()
@@ -216,8 +245,6 @@ namespace AzToolsFramework
         PrefabUndoLinkUpdate::PrefabUndoLinkUpdate(const AZStd::string& undoOperationName)
             : PrefabUndoBase(undoOperationName)
             , m_linkId(InvalidLinkId)
-            , m_linkDomNext(PrefabDom())
-            , m_linkDomPrevious(PrefabDom())
         {
             m_prefabSystemComponentInterface = AZ::Interface<PrefabSystemComponentInterface>::Get();
             AZ_Assert(m_instanceToTemplateInterface, "Failed to grab interface");
@@ -237,9 +264,11 @@ namespace AzToolsFramework
                 return;
             }
 
+            PrefabDom linkDomPrevious;
             if (link.has_value())
             {
-                m_linkDomPrevious.CopyFrom(link->get().GetLinkDom(), m_linkDomPrevious.GetAllocator());
+                linkDomPrevious.CopyFrom(link->get().GetLinkDom(), linkDomPrevious.GetAllocator());
+                m_linkDomPrevious.Store(linkDomPrevious);
             }
 
             //get source templateDom
@@ -275,23 +304,26 @@ namespace AzToolsFramework
             PrefabDom patchLink;
             m_instanceToTemplateInterface->GeneratePatch(patchLink, sourceDom->get(), instanceDom);
 
-            // Create a copy of patchLink by providing the allocator of m_linkDomNext so that the patch doesn't become invalid when
+            // Create a copy of patchLink by providing the allocator of linkDomNext so that the patch doesn't become invalid when
             // the patch goes out of scope in this function.
+            PrefabDom linkDomNext;
             PrefabDom patchLinkCopy;
-            patchLinkCopy.CopyFrom(patchLink, m_linkDomNext.GetAllocator());
+            patchLinkCopy.CopyFrom(patchLink, linkDomNext.GetAllocator());
 
-            m_linkDomNext.CopyFrom(m_linkDomPrevious, m_linkDomNext.GetAllocator());
-            auto patchesIter = m_linkDomNext.FindMember(PrefabDomUtils::PatchesName);
+            linkDomNext.CopyFrom(linkDomPrevious, linkDomNext.GetAllocator());
+            auto patchesIter = linkDomNext.FindMember(PrefabDomUtils::PatchesName);
 
-            if (patchesIter == m_linkDomNext.MemberEnd())
+            if (patchesIter == linkDomNext.MemberEnd())
             {
-                m_linkDomNext.AddMember(
-                    rapidjson::GenericStringRef(PrefabDomUtils::PatchesName), AZStd::move(patchLinkCopy), m_linkDomNext.GetAllocator());
+                linkDomNext.AddMember(
+                    rapidjson::GenericStringRef(PrefabDomUtils::PatchesName), AZStd::move(patchLinkCopy), linkDomNext.GetAllocator());
             }
             else
             {
                 patchesIter->value = AZStd::move(patchLinkCopy.GetArray());
             }
+
+            m_linkDomNext.Store(linkDomNext);
         }
 
         void PrefabUndoLinkUpdate::Undo()
@@ -309,7 +341,12 @@ namespace AzToolsFramework
             UpdateLink(m_linkDomNext, instanceToExclude);
         }
 
-        void PrefabUndoLinkUpdate::UpdateLink(PrefabDom& linkDom, InstanceOptionalReference instanceToExclude)
+        AZStd::size_t PrefabUndoLinkUpdate::GetMemoryUsage() const
+        {
+            return m_linkDomNext.GetMemoryUsage() + m_linkDomPrevious.GetMemoryUsage() + PrefabUndoBase::GetMemoryUsage();
+        }
+
+        void PrefabUndoLinkUpdate::UpdateLink(const CompressedPrefabDom& linkDom, InstanceOptionalReference instanceToExclude)
         {
             LinkReference link = m_prefabSystemComponentInterface->FindLink(m_linkId);
 
@@ -319,7 +356,9 @@ namespace AzToolsFramework
                 return;
             }
 
-            link->get().SetLinkDom(linkDom);
+            PrefabDom linkDomValue;
+            linkDom.Load(linkDomValue);
+            link->get().SetLinkDom(linkDomValue);
 
             //propagate the link changes
             link->get().UpdateTarget();
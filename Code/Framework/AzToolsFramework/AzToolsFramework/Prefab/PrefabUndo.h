@@ -7,6 +7,7 @@
 
 #pragma once
 #include <AzToolsFramework/Undo/UndoSystem.h>
+#include <AzToolsFramework/Prefab/CompressedPrefabDom.h>
 #include <AzToolsFramework/Prefab/PrefabIdTypes.h>
 #include <AzToolsFramework/Prefab/Instance/InstanceToTemplateInterface.h>
 #include <AzToolsFramework/Prefab/Instance/InstanceEntityMapperInterface.h>
@@ -26,12 +27,16 @@ namespace AzToolsFramework
             explicit PrefabUndoBase(const AZStd::string& undoOperationName);
 
             bool Changed() const override { return m_changed; }
+            AZStd::size_t GetMemoryUsage() const override;
 
         protected:
+            //! Decompresses and applies a patch to the template of the undo step.
+            bool PatchTemplate(const CompressedPrefabDom& patch, InstanceOptionalReference instanceToExclude = AZStd::nullopt);
+
             TemplateId m_templateId;
 
-            PrefabDom m_redoPatch;
-            PrefabDom m_undoPatch;
+            CompressedPrefabDom m_redoPatch;
+            CompressedPrefabDom m_undoPatch;
 
             InstanceToTemplateInterface* m_instanceToTemplateInterface = nullptr;
 
@@ -102,6 +107,7 @@ namespace AzToolsFramework
 
             void Undo() override;
             void Redo() override;
+            AZStd::size_t GetMemoryUsage() const override;
 
             LinkId GetLinkId();
 
@@ -116,7 +122,7 @@ namespace AzToolsFramework
             InstanceAlias m_instanceAlias;
 
             LinkId m_linkId;
-            PrefabDom m_linkPatches;  //data for delete/update
+            CompressedPrefabDom m_linkPatches;  //data for delete/update
             LinkStatus m_linkStatus;
 
             PrefabSystemComponentInterface* m_prefabSystemComponentInterface = nullptr;
@@ -137,13 +143,14 @@ namespace AzToolsFramework
             void Redo() override;
             //! Overload to allow to apply the change, but prevent instanceToExclude from being refreshed.
             void Redo(InstanceOptionalReference instanceToExclude);
+            AZStd::size_t GetMemoryUsage() const override;
 
         private:
-            void UpdateLink(PrefabDom& linkDom, InstanceOptionalReference instanceToExclude = AZStd::nullopt);
+            void UpdateLink(const CompressedPrefabDom& linkDom, InstanceOptionalReference instanceToExclude = AZStd::nullopt);
 
             LinkId m_linkId;
-            PrefabDom m_linkDomNext;  //data for delete/update
-            PrefabDom m_linkDomPrevious; //stores the data for undo
+            CompressedPrefabDom m_linkDomNext;  //data for delete/update
+            CompressedPrefabDom m_linkDomPrevious; //stores the data for undo
 
             PrefabSystemComponentInterface* m_prefabSystemComponentInterface = nullptr;
         };
@@ -103,7 +103,7 @@ namespace AzToolsFramework
             // Clear out newly generated data and
             // replace with original data to ensure debug mode has the same data as profile/release
             // in the event of the consistency check failing.
-            m_entitySavedStates[entityId] = {AZStd::move(oldData), oldParentId};
+            Store(entityId, AZStd::move(oldData), oldParentId);
 
 #endif // ENABLE_UNDOCACHE_CONSISTENCY_CHECKS
         }
@@ -140,7 +140,7 @@ namespace AzToolsFramework
             // Capture it
             PrefabDom entityDom;
             m_instanceToTemplateInterface->GenerateDomForEntity(entityDom, *entity);
-            m_entitySavedStates[entityId] = {AZStd::move(entityDom), parentId};
+            m_entitySavedStates[entityId] = {CompressedPrefabDom(entityDom), parentId};
 
             AZLOG("Prefab Undo", "Correctly updated cache for entity of id %llu (%s)", static_cast<AZ::u64>(entityId), entity->GetName().c_str());
 
@@ -161,15 +161,15 @@ namespace AzToolsFramework
                 return false;
             }
 
-            outDom = AZStd::move(m_entitySavedStates[entityId].dom);
-            parentId = m_entitySavedStates[entityId].parentId;
-            m_entitySavedStates.erase(entityId);
+            it->second.dom.Load(outDom);
+            parentId = it->second.parentId;
+            m_entitySavedStates.erase(it);
             return true;
         }
 
         void PrefabUndoCache::Store(const AZ::EntityId& entityId, PrefabDom&& dom, const AZ::EntityId& parentId)
         {
-            m_entitySavedStates[entityId] = {AZStd::move(dom), parentId};
+            m_entitySavedStates[entityId] = {CompressedPrefabDom(dom), parentId};
         }
 
         void PrefabUndoCache::Clear()
@@ -10,6 +10,7 @@
 #include <AzCore/Component/EntityId.h>
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/std/containers/unordered_map.h>
+#include <AzToolsFramework/Prefab/CompressedPrefabDom.h>
 #include <AzToolsFramework/Prefab/PrefabDomTypes.h>
 #include <AzToolsFramework/Undo/UndoCacheInterface.h>
 
@@ -49,7 +50,7 @@ namespace AzToolsFramework
         private:
             struct PrefabUndoCacheItem
             {
-                PrefabDom dom;
+                CompressedPrefabDom dom;
                 AZ::EntityId parentId;
             };
             typedef AZStd::unordered_map<AZ::EntityId, PrefabUndoCacheItem> EntityCache;
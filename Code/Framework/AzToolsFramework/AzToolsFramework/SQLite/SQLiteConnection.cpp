@@ -106,6 +106,7 @@ namespace AzToolsFramework
                 FinalizeAll();
                 sqlite3_close(m_db);
                 m_db = NULL;
+                m_transactionDepth = 0;
             }
         }
 
@@ -209,14 +210,21 @@ namespace AzToolsFramework
             }
         }
 
-        void Connection::BeginTransaction()
+        void Connection::BeginTransaction(bool immediate)
         {
             AZ_Assert(m_db, "BeginTransaction:  Database is not open!");
             if (!m_db)
             {
                 return;
             }
-            sqlite3_exec(m_db, "BEGIN TRANSACTION;", NULL, NULL, NULL);
+
+            if (m_transactionDepth++ > 0)
+            {
+                // SQLite does not nest BEGIN, so inner transactions are savepoints of the outer one.
+                sqlite3_exec(m_db, "SAVEPOINT NestedTransaction;", NULL, NULL, NULL);
+                return;
+            }
+            sqlite3_exec(m_db, immediate ? "BEGIN IMMEDIATE TRANSACTION;" : "BEGIN TRANSACTION;", NULL, NULL, NULL);
         }
 
         void Connection::CommitTransaction()
@@ -226,6 +234,14 @@ namespace AzToolsFramework
             {
                 return;
             }
+
+            AZ_Assert(m_transactionDepth > 0, "CommitTransaction:  No transaction is active!");
+            if (--m_transactionDepth > 0)
+            {
+                sqlite3_exec(m_db, "RELEASE NestedTransaction;", NULL, NULL, NULL);
+                return;
+            }
+            m_transactionDepth = 0;
             sqlite3_exec(m_db, "COMMIT TRANSACTION;", NULL, NULL, NULL);
         }
 
@@ -236,9 +252,23 @@ namespace AzToolsFramework
             {
                 return;
             }
+
+            AZ_Assert(m_transactionDepth > 0, "RollbackTransaction:  No transaction is active!");
+            if (--m_transactionDepth > 0)
+            {
+                // rolling back to a savepoint leaves it on the stack, so release it as well.
+                sqlite3_exec(m_db, "ROLLBACK TO NestedTransaction; RELEASE NestedTransaction;", NULL, NULL, NULL);
+                return;
+            }
+            m_transactionDepth = 0;
             sqlite3_exec(m_db, "ROLLBACK;", NULL, NULL, NULL);
         }
 
+        bool Connection::IsInTransaction() const
+        {
+            return m_transactionDepth > 0;
+        }
+
         void Connection::Vacuum()
         {
             AZ_Assert(m_db, "Vacuum:  Database is not open!");
@@ -45,9 +45,13 @@ namespace AzToolsFramework
             bool IsOpen() const;
 
             // ----- Transaction support -----
-            void BeginTransaction();
+            //! Transactions nest: only the outermost one issues BEGIN / COMMIT, inner ones become savepoints
+            //! so that committing or rolling back an inner transaction does not end the enclosing one.
+            //! An immediate transaction takes the database write lock right away instead of on the first write.
+            void BeginTransaction(bool immediate = false);
             void CommitTransaction();
             void RollbackTransaction();
+            bool IsInTransaction() const;
             // -------------------------------
 
             //! SQLite-specific, compacts the database and cleans up any temporary space allocated.
@@ -86,6 +90,7 @@ namespace AzToolsFramework
 
         private:
             sqlite3* m_db;
+            int m_transactionDepth = 0;
             typedef AZStd::unordered_map< AZStd::string, StatementPrototype* > StatementContainer;
             StatementContainer m_statementPrototypes;
         };
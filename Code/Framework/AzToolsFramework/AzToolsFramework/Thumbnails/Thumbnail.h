@@ -8,6 +8,8 @@
 
 #if !defined(Q_MOC_RUN)
 #include <AzCore/Component/TickBus.h>
+#include <AzCore/std/containers/list.h>
+#include <AzCore/std/containers/unordered_map.h>
 
 AZ_PUSH_DISABLE_WARNING(4127 4251 4800, "-Wunknown-warning-option") // 4127: conditional expression is constant
                                                                     // 4251: 'QLocale::d': class 'QSharedDataPointer<QLocalePrivate>' needs to have dll-interface to be used by clients of class 'QLocale'
@@ -158,6 +160,8 @@ namespace AzToolsFramework
             EqualKey - equality function for storing thumbnail keys in the hashtable
             Hasher and EqualKey need to be provided on individual basis depending on
             what constitutes a unique key and how should the key collection be optimized
+            Once the cache holds more than maxCachedThumbnails, the least recently requested thumbnails that are not loading
+            are released, they are loaded again the next time they are requested
         */
         template<class ThumbnailType, class Hasher = AZStd::hash<SharedThumbnailKey>, class EqualKey = AZStd::equal_to<SharedThumbnailKey>>
         class ThumbnailCache
@@ -165,7 +169,9 @@ namespace AzToolsFramework
             , public AZ::TickBus::Handler
         {
         public:
-            ThumbnailCache();
+            static constexpr size_t DefaultMaxCachedThumbnails = 1024;
+
+            explicit ThumbnailCache(size_t maxCachedThumbnails = DefaultMaxCachedThumbnails);
             ~ThumbnailCache() override;
 
             //////////////////////////////////////////////////////////////////////////
@@ -176,10 +182,25 @@ namespace AzToolsFramework
             bool GetThumbnail(SharedThumbnailKey key, SharedThumbnail& thumbnail) override;
 
         protected:
-            AZStd::unordered_map<SharedThumbnailKey, SharedThumbnail, Hasher, EqualKey> m_cache;
+            //! Keys of the cached thumbnails, the most recently requested first
+            using RecentlyUsedList = AZStd::list<SharedThumbnailKey>;
+
+            struct CachedThumbnail
+            {
+                SharedThumbnail m_thumbnail;
+                typename RecentlyUsedList::iterator m_recentlyUsed;
+            };
+
+            AZStd::unordered_map<SharedThumbnailKey, CachedThumbnail, Hasher, EqualKey> m_cache;
+            RecentlyUsedList m_recentlyUsed;
+            size_t m_maxCachedThumbnails;
 
             //! Check if thumbnail key is handled by this provider, overload in derived class
             virtual bool IsSupportedThumbnail(SharedThumbnailKey key) const = 0;
+
+        private:
+            //! Releases the least recently requested thumbnails that are not loading until the cache fits its budget
+            void EvictThumbnails();
         };
 
         #define MAKE_TCACHE(cacheType, ...) QSharedPointer<cacheType>(new cacheType(__VA_ARGS__))
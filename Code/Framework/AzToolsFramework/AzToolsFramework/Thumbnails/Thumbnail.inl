@@ -12,7 +12,8 @@ namespace AzToolsFramework
     namespace Thumbnailer
     {
         template <class ThumbnailType, class Hasher, class EqualKey>
-        ThumbnailCache<ThumbnailType, Hasher, EqualKey>::ThumbnailCache()
+        ThumbnailCache<ThumbnailType, Hasher, EqualKey>::ThumbnailCache(size_t maxCachedThumbnails)
+            : m_maxCachedThumbnails(maxCachedThumbnails)
         {
             BusConnect();
         }
@@ -28,7 +29,7 @@ namespace AzToolsFramework
         {
             for (auto& kvp : m_cache)
             {
-                kvp.second->UpdateTime(deltaTime);
+                kvp.second.m_thumbnail->UpdateTime(deltaTime);
             }
         }
 
@@ -38,16 +39,36 @@ namespace AzToolsFramework
             auto it = m_cache.find(key);
             if (it != m_cache.end())
             {
-                thumbnail = it->second;
+                m_recentlyUsed.splice(m_recentlyUsed.begin(), m_recentlyUsed, it->second.m_recentlyUsed);
+                thumbnail = it->second.m_thumbnail;
                 return true;
             }
             if (IsSupportedThumbnail(key))
             {
                 thumbnail = QSharedPointer<ThumbnailType>(new ThumbnailType(key));
-                m_cache[key] = thumbnail;
+                m_recentlyUsed.push_front(key);
+                m_cache[key] = CachedThumbnail{ thumbnail, m_recentlyUsed.begin() };
+                EvictThumbnails();
                 return true;
             }
             return false;
         }
+
+        template <class ThumbnailType, class Hasher, class EqualKey>
+        void ThumbnailCache<ThumbnailType, Hasher, EqualKey>::EvictThumbnails()
+        {
+            // Thumbnails still loading are skipped, their load thread is using them
+            auto it = m_recentlyUsed.end();
+            while (m_cache.size() > m_maxCachedThumbnails && it != m_recentlyUsed.begin())
+            {
+                --it;
+                auto cacheIt = m_cache.find(*it);
+                if (cacheIt != m_cache.end() && cacheIt->second.m_thumbnail->GetState() != Thumbnail::State::Loading)
+                {
+                    m_cache.erase(cacheIt);
+                    it = m_recentlyUsed.erase(it);
+                }
+            }
+        }
     } // namespace Thumbnailer
 } // namespace AzToolsFramework
@@ -19,11 +19,15 @@ namespace AzToolsFramework
 {
     namespace Thumbnailer
     {
+        // Painted items request their thumbnail every frame of the busy animation, a request older than this is off screen
+        static constexpr qint64 s_thumbnailRequestTimeoutMs = 1000;
+
         ThumbnailContext::ThumbnailContext()
             : m_missingThumbnail(new MissingThumbnail())
             , m_loadingThumbnail(new LoadingThumbnail())
             , m_threadPool(this)
         {
+            m_requestTimer.start();
             ThumbnailContextRequestBus::Handler::BusConnect();
         }
 
@@ -49,6 +53,7 @@ namespace AzToolsFramework
 
         void ThumbnailContext::RedrawThumbnail()
         {
+            LoadQueuedThumbnails();
             AzToolsFramework::AssetBrowser::AssetBrowserViewRequestBus::Broadcast(&AzToolsFramework::AssetBrowser::AssetBrowserViewRequests::Update);
         }
 
@@ -70,26 +75,10 @@ namespace AzToolsFramework
                     {
                         return thumbnail;
                     }
-                    // if thumbnail is not loaded, start loading it, meanwhile return loading thumbnail
+                    // if thumbnail is not loaded, queue it for loading, meanwhile return loading thumbnail
                     if (thumbnail->GetState() == Thumbnail::State::Unloaded)
                     {
-                        // listen to the loading signal, so the anyone using it will update loading animation
-                        connect(m_loadingThumbnail.data(), &Thumbnail::Updated, key.data(), &ThumbnailKey::ThumbnailUpdatedSignal);
-                        AzQtComponents::StyledBusyLabel* busyLabel;
-                        AzToolsFramework::AssetBrowser::AssetBrowserComponentRequestBus::BroadcastResult(busyLabel, &AzToolsFramework::AssetBrowser::AssetBrowserComponentRequests::GetStyledBusyLabel);
-                        connect(busyLabel, &AzQtComponents::StyledBusyLabel::repaintNeeded, this, &ThumbnailContext::RedrawThumbnail);
-                        // once the thumbnail is loaded, disconnect it from loading thumbnail
-                        connect(thumbnail.data(), &Thumbnail::Updated, this , [this, key, thumbnail, busyLabel]()
-                            {
-                                disconnect(m_loadingThumbnail.data(), &Thumbnail::Updated, key.data(), &ThumbnailKey::ThumbnailUpdatedSignal);
-                                disconnect(busyLabel, &AzQtComponents::StyledBusyLabel::repaintNeeded, this, &ThumbnailContext::RedrawThumbnail);
-                                thumbnail->disconnect();
-                                connect(thumbnail.data(), &Thumbnail::Updated, key.data(), &ThumbnailKey::ThumbnailUpdatedSignal);
-                                connect(key.data(), &ThumbnailKey::UpdateThumbnailSignal, thumbnail.data(), &Thumbnail::Update);
-                                key->m_ready = true;
-                                Q_EMIT key->ThumbnailUpdatedSignal();
-                            });
-                        thumbnail->Load();
+                        QueueThumbnail(key, thumbnail);
                     }
                     if (thumbnail->GetState() == Thumbnail::State::Failed)
                     {
@@ -101,6 +90,100 @@ namespace AzToolsFramework
             return m_missingThumbnail;
         }
 
+        void ThumbnailContext::QueueThumbnail(SharedThumbnailKey key, SharedThumbnail thumbnail)
+        {
+            const qint64 requestTimeMs = m_requestTimer.elapsed();
+            auto lookupIt = m_queuedThumbnailLookup.find(thumbnail.data());
+            if (lookupIt != m_queuedThumbnailLookup.end())
+            {
+                lookupIt->second->m_lastRequestMs = requestTimeMs;
+                m_queuedThumbnails.splice(m_queuedThumbnails.begin(), m_queuedThumbnails, lookupIt->second);
+            }
+            else
+            {
+                // listen to the loading signal, so the anyone using it will update loading animation
+                connect(m_loadingThumbnail.data(), &Thumbnail::Updated, key.data(), &ThumbnailKey::ThumbnailUpdatedSignal);
+                m_queuedThumbnails.push_front(QueuedThumbnail{ key, thumbnail, requestTimeMs });
+                m_queuedThumbnailLookup.emplace(thumbnail.data(), m_queuedThumbnails.begin());
+            }
+            LoadQueuedThumbnails();
+        }
+
+        void ThumbnailContext::LoadQueuedThumbnails()
+        {
+            // the thumbnails nobody asked for recently stay unloaded until they are requested again
+            const qint64 staleRequestTimeMs = m_requestTimer.elapsed() - s_thumbnailRequestTimeoutMs;
+            while (!m_queuedThumbnails.empty() && m_queuedThumbnails.back().m_lastRequestMs < staleRequestTimeMs)
+            {
+                const QueuedThumbnail& queued = m_queuedThumbnails.back();
+                disconnect(m_loadingThumbnail.data(), &Thumbnail::Updated, queued.m_key.data(), &ThumbnailKey::ThumbnailUpdatedSignal);
+                m_queuedThumbnailLookup.erase(queued.m_thumbnail.data());
+                m_queuedThumbnails.pop_back();
+            }
+
+            // only hand the thread pool as many thumbnails as it can load at once, so a later request can still go first
+            const size_t maxLoadingThumbnails = static_cast<size_t>(AZStd::max(m_threadPool.maxThreadCount(), 1));
+            while (!m_queuedThumbnails.empty() && m_loadingThumbnails.size() < maxLoadingThumbnails)
+            {
+                QueuedThumbnail queued = AZStd::move(m_queuedThumbnails.front());
+                m_queuedThumbnailLookup.erase(queued.m_thumbnail.data());
+                m_queuedThumbnails.pop_front();
+                StartLoading(queued.m_key, queued.m_thumbnail);
+            }
+
+            UpdateBusyLabelConnection();
+        }
+
+        void ThumbnailContext::StartLoading(SharedThumbnailKey key, SharedThumbnail thumbnail)
+        {
+            if (thumbnail->GetState() != Thumbnail::State::Unloaded)
+            {
+                disconnect(m_loadingThumbnail.data(), &Thumbnail::Updated, key.data(), &ThumbnailKey::ThumbnailUpdatedSignal);
+                return;
+            }
+
+            m_loadingThumbnails.insert(thumbnail.data());
+            // once the thumbnail is loaded, disconnect it from loading thumbnail
+            connect(thumbnail.data(), &Thumbnail::Updated, this , [this, key, thumbnail]()
+                {
+                    disconnect(m_loadingThumbnail.data(), &Thumbnail::Updated, key.data(), &ThumbnailKey::ThumbnailUpdatedSignal);
+                    thumbnail->disconnect();
+                    connect(thumbnail.data(), &Thumbnail::Updated, key.data(), &ThumbnailKey::ThumbnailUpdatedSignal);
+                    connect(key.data(), &ThumbnailKey::UpdateThumbnailSignal, thumbnail.data(), &Thumbnail::Update);
+                    key->m_ready = true;
+                    m_loadingThumbnails.erase(thumbnail.data());
+                    Q_EMIT key->ThumbnailUpdatedSignal();
+                    LoadQueuedThumbnails();
+                });
+            thumbnail->Load();
+        }
+
+        void ThumbnailContext::UpdateBusyLabelConnection()
+        {
+            const bool busy = !m_queuedThumbnails.empty() || !m_loadingThumbnails.empty();
+            if (busy == m_busyLabelConnected)
+            {
+                return;
+            }
+
+            AzQtComponents::StyledBusyLabel* busyLabel = nullptr;
+            AzToolsFramework::AssetBrowser::AssetBrowserComponentRequestBus::BroadcastResult(busyLabel, &AzToolsFramework::AssetBrowser::AssetBrowserComponentRequests::GetStyledBusyLabel);
+            if (!busyLabel)
+            {
+                return;
+            }
+
+            if (busy)
+            {
+                connect(busyLabel, &AzQtComponents::StyledBusyLabel::repaintNeeded, this, &ThumbnailContext::RedrawThumbnail);
+            }
+            else
+            {
+                disconnect(busyLabel, &AzQtComponents::StyledBusyLabel::repaintNeeded, this, &ThumbnailContext::RedrawThumbnail);
+            }
+            m_busyLabelConnected = busy;
+        }
+
         void ThumbnailContext::RegisterThumbnailProvider(SharedThumbnailProvider providerToAdd)
         {
             auto it = AZStd::find_if(m_providers.begin(), m_providers.end(), [providerToAdd](const SharedThumbnailProvider& provider)
@@ -8,11 +8,15 @@
 
 #if !defined(Q_MOC_RUN)
 #include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/list.h>
 #include <AzCore/std/containers/set.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/unordered_set.h>
 #include <AzToolsFramework/Thumbnails/Thumbnail.h>
 #include <AzToolsFramework/Thumbnails/ThumbnailerBus.h>
 
 #include <QObject>
+#include <QElapsedTimer>
 #include <QList>
 #include <QThreadPool>
 #endif
@@ -33,6 +37,8 @@ namespace AzToolsFramework
             'PreviewContext' may provide thumbnails for Preview Widget
             'MaterialBrowser' may provide thumbnails for Material Browser
             etc.
+            Thumbnails are loaded in the order they were last requested, so the items currently painted load first.
+            Requests that are not repeated for a while, such as items scrolled out of view, are dropped before loading.
         */
         class ThumbnailContext
             : public QObject
@@ -71,6 +77,22 @@ namespace AzToolsFramework
                 }
             };
 
+            struct QueuedThumbnail
+            {
+                SharedThumbnailKey m_key;
+                SharedThumbnail m_thumbnail;
+                qint64 m_lastRequestMs;
+            };
+            using ThumbnailQueue = AZStd::list<QueuedThumbnail>;
+
+            //! Queues an unloaded thumbnail, or moves it to the front of the queue if it is already queued
+            void QueueThumbnail(SharedThumbnailKey key, SharedThumbnail thumbnail);
+            //! Drops the stale requests and starts loading queued thumbnails while the thread pool has free threads
+            void LoadQueuedThumbnails();
+            void StartLoading(SharedThumbnailKey key, SharedThumbnail thumbnail);
+            //! Keeps a single connection to the busy label animation while thumbnails are queued or loading
+            void UpdateBusyLabelConnection();
+
             //! Collection of thumbnail caches provided by this context
             AZStd::multiset<SharedThumbnailProvider, ProviderCompare> m_providers;
             //! Default missing thumbnail used when no thumbnail for given key can be found within this context
@@ -80,6 +102,13 @@ namespace AzToolsFramework
             //! There is only a limited number of threads on global threadPool, because there can be many thumbnails rendering at once
             //! an individual threadPool is needed to avoid deadlocks
             QThreadPool m_threadPool;
+            //! Thumbnails waiting to load, the most recently requested first
+            ThumbnailQueue m_queuedThumbnails;
+            AZStd::unordered_map<const Thumbnail*, ThumbnailQueue::iterator> m_queuedThumbnailLookup;
+            //! Thumbnails loading on the thread pool
+            AZStd::unordered_set<const Thumbnail*> m_loadingThumbnails;
+            QElapsedTimer m_requestTimer;
+            bool m_busyLabelConnected = false;
         };
     } // namespace Thumbnailer
 } // namespace AzToolsFramework
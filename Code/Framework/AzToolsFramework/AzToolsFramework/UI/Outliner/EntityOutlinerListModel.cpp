@@ -1200,6 +1200,11 @@ namespace AzToolsFramework
         {
             return;
         }
+        if (m_structureResetQueued)
+        {
+            // The queues are processed once the model reset is done
+            return;
+        }
 
         {
             AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::Editor, "EntityOutlinerListModel::ProcessEntityUpdates:ExpandQueue");
@@ -1275,12 +1280,24 @@ namespace AzToolsFramework
     void EntityOutlinerListModel::OnEntityInfoResetBegin()
     {
         emit EnableSelectionUpdates(false);
-        beginResetModel();
+        m_entityInfoResetInProgress = true;
+        if (m_structureResetQueued)
+        {
+            // The model reset already begun for the queued children changes becomes this one
+            m_structureResetQueued = false;
+        }
+        else
+        {
+            beginResetModel();
+        }
     }
 
     void EntityOutlinerListModel::OnEntityInfoResetEnd()
     {
+        m_entityInfoResetInProgress = false;
         m_layoutResetQueued = true;
+        m_selectedDescendantCache.clear();
+        m_entityNameMatchCache.clear();
         endResetModel();
         QTimer::singleShot(0, this, &EntityOutlinerListModel::ProcessEntityInfoResetEnd);
     }
@@ -1295,13 +1312,73 @@ namespace AzToolsFramework
         emit EnableSelectionUpdates(true);
     }
 
+    bool EntityOutlinerListModel::QueueStructureChange(bool requiresReset)
+    {
+        m_selectedDescendantCache.clear();
+        if (m_structureResetQueued || m_entityInfoResetInProgress)
+        {
+            return true;
+        }
+
+        if (m_structureChangeCount++ == 0)
+        {
+            QTimer::singleShot(0, this, [this]() { m_structureChangeCount = 0; });
+        }
+        if (!requiresReset && m_structureChangeCount <= s_maxIncrementalStructureChanges)
+        {
+            return false;
+        }
+
+        // Inserting rows one at a time costs the views and the proxy model a full pass for each row on large levels,
+        // so all the changes of the frame are covered by a single model reset instead
+        m_structureResetQueued = true;
+        beginResetModel();
+        QTimer::singleShot(0, this, &EntityOutlinerListModel::ProcessStructureReset);
+        return true;
+    }
+
+    void EntityOutlinerListModel::ProcessStructureReset()
+    {
+        if (!m_structureResetQueued)
+        {
+            // Ended by an entity info reset in the meantime
+            return;
+        }
+
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzToolsFramework);
+        m_structureResetQueued = false;
+        endResetModel();
+
+        // The reset collapsed and deselected every item of the views, restore them
+        for (const auto& expansionPair : m_entityExpansionState)
+        {
+            if (expansionPair.second && EditorEntityInfoRequestBus::HasHandlers(expansionPair.first))
+            {
+                m_entityExpandQueue.insert(expansionPair.first);
+            }
+        }
+
+        EntityIdList selectedEntityIds;
+        ToolsApplicationRequests::Bus::BroadcastResult(selectedEntityIds, &ToolsApplicationRequests::GetSelectedEntities);
+        m_entitySelectQueue.insert(selectedEntityIds.begin(), selectedEntityIds.end());
+
+        m_isFilterDirty = true;
+        QueueEntityUpdate(AZ::EntityId());
+        emit EnableSelectionUpdates(true);
+    }
+
     void EntityOutlinerListModel::OnEntityInfoUpdatedAddChildBegin(AZ::EntityId parentId, AZ::EntityId childId)
     {
         //add/remove operations trigger selection change signals which assert and break undo/redo operations in progress in inspector etc.
         //so disallow selection updates until change is complete
         emit EnableSelectionUpdates(false);
+        if (QueueStructureChange(false))
+        {
+            return;
+        }
         auto parentIndex = GetIndexFromEntity(parentId);
         auto childIndex = GetIndexFromEntity(childId);
+        m_childInsertInProgress = true;
         beginInsertRows(parentIndex, childIndex.row(), childIndex.row());
     }
 
@@ -1309,7 +1386,12 @@ namespace AzToolsFramework
     {
         (void)parentId;
         AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzToolsFramework);
-        endInsertRows();
+        if (m_childInsertInProgress)
+        {
+            m_childInsertInProgress = false;
+            endInsertRows();
+        }
+        m_entityNameMatchCache.erase(childId);
 
         //expand ancestors if a new descendant is already selected
         if ((IsSelected(childId) || HasSelectedDescendant(childId)) && !m_dropOperationInProgress)
@@ -1324,7 +1406,10 @@ namespace AzToolsFramework
         //must refresh partial lock/visibility of parents
         m_isFilterDirty = true;
         QueueAncestorUpdate(childId);
-        emit EnableSelectionUpdates(true);
+        if (!m_structureResetQueued)
+        {
+            emit EnableSelectionUpdates(true);
+        }
     }
 
     void EntityOutlinerListModel::OnEntityRuntimeActivationChanged(AZ::EntityId entityId, bool activeOnStart)
@@ -1338,9 +1423,9 @@ namespace AzToolsFramework
         //add/remove operations trigger selection change signals which assert and break undo/redo operations in progress in inspector etc.
         //so disallow selection updates until change is complete
         emit EnableSelectionUpdates(false);
-        auto parentIndex = GetIndexFromEntity(parentId);
-        auto childIndex = GetIndexFromEntity(childId);
-        beginResetModel();
+        (void)parentId;
+        (void)childId;
+        QueueStructureChange(true);
     }
 
     void EntityOutlinerListModel::OnEntityInfoUpdatedRemoveChildEnd(AZ::EntityId parentId, AZ::EntityId childId)
@@ -1348,12 +1433,9 @@ namespace AzToolsFramework
         (void)childId;
         AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzToolsFramework);
 
-        endResetModel();
-
         //must refresh partial lock/visibility of parents
         m_isFilterDirty = true;
         QueueAncestorUpdate(parentId);
-        emit EnableSelectionUpdates(true);
     }
 
     void EntityOutlinerListModel::OnEntityInfoUpdatedOrderBegin(AZ::EntityId parentId, AZ::EntityId childId, AZ::u64 index)
@@ -1375,6 +1457,7 @@ namespace AzToolsFramework
     void EntityOutlinerListModel::OnEntityInfoUpdatedSelection(AZ::EntityId entityId, bool selected)
     {
         //update all ancestors because they will show highlight if ancestor is selected
+        m_selectedDescendantCache.clear();
         QueueAncestorUpdate(entityId);
 
         //expand ancestors upon new selection
@@ -1404,6 +1487,7 @@ namespace AzToolsFramework
     void EntityOutlinerListModel::OnEntityInfoUpdatedName(AZ::EntityId entityId, const AZStd::string& name)
     {
         (void)name;
+        m_entityNameMatchCache.erase(entityId);
         QueueEntityUpdate(entityId);
 
         bool isSelected = false;
@@ -1452,6 +1536,19 @@ namespace AzToolsFramework
             CacheSelectionIfAppropriate();
         }
 
+        if (!m_filterString.empty() && AzFramework::StringFunc::Find(filter.c_str(), m_filterString.c_str()) != AZStd::string::npos)
+        {
+            // The new search string contains the previous one, so names that didn't match still can't
+            for (auto matchItr = m_entityNameMatchCache.begin(); matchItr != m_entityNameMatchCache.end();)
+            {
+                matchItr = matchItr->second ? m_entityNameMatchCache.erase(matchItr) : AZStd::next(matchItr);
+            }
+        }
+        else
+        {
+            m_entityNameMatchCache.clear();
+        }
+
         m_filterString = filter;
         InvalidateFilter();
 
@@ -1567,7 +1664,22 @@ namespace AzToolsFramework
 
     void EntityOutlinerListModel::InvalidateFilter()
     {
-        FilterEntity(AZ::EntityId());
+        if (m_filterString.empty() && m_componentFilters.empty())
+        {
+            // Every entity matches without search criteria, no need to walk the whole hierarchy
+            for (const auto& filteredPair : m_entityFilteredState)
+            {
+                if (filteredPair.second && IsExpanded(filteredPair.first) && EditorEntityInfoRequestBus::HasHandlers(filteredPair.first))
+                {
+                    QueueEntityToExpand(filteredPair.first, true);
+                }
+            }
+            m_entityFilteredState.clear();
+        }
+        else
+        {
+            FilterEntity(AZ::EntityId());
+        }
 
         // Emit data changed directly as it is immediately valid
         auto modelIndex = GetIndexFromEntity(AZ::EntityId());
@@ -1642,11 +1754,7 @@ namespace AzToolsFramework
 
         if (m_filterString.size() > 0)
         {
-            AZStd::string name;
-            EditorEntityInfoRequestBus::EventResult(name, entityId, &EditorEntityInfoRequestBus::Events::GetName);
-
-            if (AzFramework::StringFunc::Find(name.c_str(), m_filterString.c_str()) == AZStd::string::npos
-                && AZStd::to_string(static_cast<AZ::u64>(entityId)) != m_filterString)
+            if (!DoesNameMatchFilter(entityId) && AZStd::to_string(static_cast<AZ::u64>(entityId)) != m_filterString)
             {
                 isFilterMatch = false;
             }
@@ -1756,6 +1864,21 @@ namespace AzToolsFramework
         return isFilterMatch;
     }
 
+    bool EntityOutlinerListModel::DoesNameMatchFilter(const AZ::EntityId& entityId)
+    {
+        auto matchItr = m_entityNameMatchCache.find(entityId);
+        if (matchItr != m_entityNameMatchCache.end())
+        {
+            return matchItr->second;
+        }
+
+        AZStd::string name;
+        EditorEntityInfoRequestBus::EventResult(name, entityId, &EditorEntityInfoRequestBus::Events::GetName);
+        const bool isMatch = AzFramework::StringFunc::Find(name.c_str(), m_filterString.c_str()) != AZStd::string::npos;
+        m_entityNameMatchCache.emplace(entityId, isMatch);
+        return isMatch;
+    }
+
     bool EntityOutlinerListModel::IsFiltered(const AZ::EntityId& entityId) const
     {
         auto hiddenItr = m_entityFilteredState.find(entityId);
@@ -1774,7 +1897,13 @@ namespace AzToolsFramework
 
     bool EntityOutlinerListModel::HasSelectedDescendant(const AZ::EntityId& entityId) const
     {
-        //TODO result can be cached in mutable map and cleared when any descendant changes to avoid recursion in deep hierarchies
+        auto cacheItr = m_selectedDescendantCache.find(entityId);
+        if (cacheItr != m_selectedDescendantCache.end())
+        {
+            return cacheItr->second;
+        }
+
+        bool hasSelectedDescendant = false;
         EntityIdList children;
         EditorEntityInfoRequestBus::EventResult(children, entityId, &EditorEntityInfoRequestBus::Events::GetChildren);
         for (auto childId : children)
@@ -1783,10 +1912,12 @@ namespace AzToolsFramework
             EditorEntityInfoRequestBus::EventResult(isSelected, childId, &EditorEntityInfoRequestBus::Events::IsSelected);
             if (isSelected || HasSelectedDescendant(childId))
             {
-                return true;
+                hasSelectedDescendant = true;
+                break;
             }
         }
-        return false;
+        m_selectedDescendantCache.emplace(entityId, hasSelectedDescendant);
+        return hasSelectedDescendant;
     }
 
     bool EntityOutlinerListModel::AreAllDescendantsSameLockState(const AZ::EntityId& entityId) const
@@ -176,6 +176,9 @@ namespace AzToolsFramework
         void QueueEntityToExpand(AZ::EntityId entityId, bool expand);
         void ProcessEntityUpdates();
         void ProcessEntityInfoResetEnd();
+        //! Called before a child is added or removed, returns true if the change is covered by a model reset
+        bool QueueStructureChange(bool requiresReset);
+        void ProcessStructureReset();
         AZStd::unordered_set<AZ::EntityId> m_entitySelectQueue;
         AZStd::unordered_set<AZ::EntityId> m_entityExpandQueue;
         AZStd::unordered_set<AZ::EntityId> m_entityChangeQueue;
@@ -186,10 +189,21 @@ namespace AzToolsFramework
         bool m_autoExpandEnabled = true;
         bool m_layoutResetQueued = false;
 
+        // Children added or removed in a single frame past this count are batched into one model reset
+        static const AZ::u32 s_maxIncrementalStructureChanges = 16;
+        AZ::u32 m_structureChangeCount = 0;
+        bool m_structureResetQueued = false;
+        bool m_entityInfoResetInProgress = false;
+        bool m_childInsertInProgress = false;
+
         AZStd::string m_filterString;
         AZStd::vector<ComponentTypeValue> m_componentFilters;
         bool m_isFilterDirty = true;
 
+        //! Whether the name of an entity contains m_filterString, refined rather than rebuilt while the search string grows
+        bool DoesNameMatchFilter(const AZ::EntityId& entityId);
+        AZStd::unordered_map<AZ::EntityId, bool> m_entityNameMatchCache;
+
         void OnEntityCompositionChanged(const EntityIdList& entityIds) override;
 
         void OnEntityInitialized(const AZ::EntityId& entityId) override;
@@ -248,6 +262,8 @@ namespace AzToolsFramework
         AZStd::unordered_map<AZ::EntityId, bool> m_entityFilteredState;
 
         bool HasSelectedDescendant(const AZ::EntityId& entityId) const;
+        // Painting queries ChildSelectedRole for every visible row, cleared whenever the selection or the hierarchy changes
+        mutable AZStd::unordered_map<AZ::EntityId, bool> m_selectedDescendantCache;
 
         bool AreAllDescendantsSameLockState(const AZ::EntityId& entityId) const;
         bool AreAllDescendantsSameVisibleState(const AZ::EntityId& entityId) const;
@@ -189,6 +189,7 @@ namespace AzToolsFramework
         m_propertyEditor->SetSavedStateKey(entityUniqueSavedStateKey);
 
         m_propertyEditor->AddInstance(componentInstance, instanceTypeId, aggregateInstance, compareInstance);
+        m_hasCompareInstance |= compareInstance != nullptr;
 
         // When first instance is set, use its data to fill out the header.
         if (m_componentType.IsNull())
@@ -210,6 +211,8 @@ namespace AzToolsFramework
         ClearNotifications();
         //clear component cache
         m_components.clear();
+        m_hasCompareInstance = false;
+        m_isPropertyEditorDeferred = false;
 
         m_propertyEditor->ClearInstances();
         if (invalidateImmediately)
@@ -506,11 +509,25 @@ namespace AzToolsFramework
 
     void ComponentEditor::InvalidateAll(const char* filter)
     {
+        // A collapsed editor shows none of its properties, so building them waits until it's expanded.
+        // Filtering and the override indicator of the header both need the built properties, so those editors are built right away.
+        if (!filter && !m_hasCompareInstance && !IsExpanded())
+        {
+            m_isPropertyEditorDeferred = true;
+            return;
+        }
+
+        m_isPropertyEditorDeferred = false;
         m_propertyEditor->InvalidateAll(filter);
     }
 
     void ComponentEditor::QueuePropertyEditorInvalidation(PropertyModificationRefreshLevel refreshLevel)
     {
+        if (m_isPropertyEditorDeferred)
+        {
+            // Everything is refreshed when the deferred properties are built
+            return;
+        }
         m_propertyEditor->QueueInvalidation(refreshLevel);
     }
 
@@ -694,6 +711,11 @@ namespace AzToolsFramework
 
     void ComponentEditor::OnExpanderChanged(bool expanded)
     {
+        if (expanded && m_isPropertyEditorDeferred)
+        {
+            InvalidateAll();
+        }
+
         for (auto component : m_components)
         {
             EditorEntityInfoRequestBus::Event(component->GetEntityId(), &EditorEntityInfoRequestBus::Events::SetComponentExpanded, component->GetId(), expanded);
@@ -143,6 +143,10 @@ namespace AzToolsFramework
 
         AZStd::vector<AZ::Component*> m_components;
         AZ::Crc32 m_savedKeySeed;
+
+        bool m_hasCompareInstance = false;
+        /// True while the properties of a collapsed editor haven't been built yet
+        bool m_isPropertyEditorDeferred = false;
     };
 
 } // namespace AzToolsFramework
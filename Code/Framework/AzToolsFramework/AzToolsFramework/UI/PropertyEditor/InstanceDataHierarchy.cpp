@@ -6,6 +6,7 @@
  */
 #include "AzToolsFramework_precompiled.h"
 #include "InstanceDataHierarchy.h"
+#include <AzCore/std/algorithm.h>
 #include <AzCore/std/bind/bind.h>
 #include <AzCore/std/functional.h>
 #include <AzCore/std/sort.h>
@@ -585,6 +586,7 @@ namespace AzToolsFramework
                             serializeFieldElement.m_flags = AZ::SerializeContext::ClassElement::FLG_UI_ELEMENT;
 
                             m_curParentNode = node;
+                            m_curParentNode->m_mergeCursor = m_curParentNode->m_children.begin();
                             m_isMerging = i > 0; // Ensure we always add a node for the first instance, then compare
                             BeginNode(node->GetInstance(i), nullptr, &serializeFieldElement, dynamicEditDataProvider);
                             m_curParentNode->m_groupElementData = groupData;
@@ -970,22 +972,35 @@ namespace AzToolsFramework
             }
             else
             {
-                // Search through the parent's class elements to find a match
-                for (NodeContainer::iterator it = m_curParentNode->m_children.begin(); it != m_curParentNode->m_children.end(); ++it)
+                auto matchesElement = [classData, classElement, elementEditData](const InstanceDataNode& subElement)
                 {
-                    InstanceDataNode* subElement = &(*it);
-                    if (!subElement->m_matched &&
-                        subElement->m_classElement->m_nameCrc == classElement->m_nameCrc &&
-                        subElement->m_classData == classData &&
-                        (subElement->m_elementEditData == elementEditData ||
-                        (subElement->m_elementEditData && elementEditData &&
-                            subElement->m_elementEditData->m_name && elementEditData->m_name &&
-                            azstricmp(subElement->m_elementEditData->m_name, elementEditData->m_name) == 0)))
+                    return !subElement.m_matched &&
+                        subElement.m_classElement->m_nameCrc == classElement->m_nameCrc &&
+                        subElement.m_classData == classData &&
+                        (subElement.m_elementEditData == elementEditData ||
+                        (subElement.m_elementEditData && elementEditData &&
+                            subElement.m_elementEditData->m_name && elementEditData->m_name &&
+                            azstricmp(subElement.m_elementEditData->m_name, elementEditData->m_name) == 0));
+                };
+
+                // Search through the parent's class elements to find a match.
+                // Instances of the same type enumerate their elements in the same order, so the search starts after the last
+                // match and wraps around, which finds the match right away instead of scanning all the siblings.
+                NodeContainer& siblings = m_curParentNode->m_children;
+                NodeContainer::iterator matchIt = AZStd::find_if(m_curParentNode->m_mergeCursor, siblings.end(), matchesElement);
+                if (matchIt == siblings.end())
+                {
+                    matchIt = AZStd::find_if(siblings.begin(), m_curParentNode->m_mergeCursor, matchesElement);
+                    if (matchIt == m_curParentNode->m_mergeCursor)
                     {
-                        node = subElement;
-                        break;
+                        matchIt = siblings.end();
                     }
                 }
+                if (matchIt != siblings.end())
+                {
+                    node = &(*matchIt);
+                    m_curParentNode->m_mergeCursor = AZStd::next(matchIt);
+                }
             }
 
             if (node)
@@ -1011,6 +1026,7 @@ namespace AzToolsFramework
                 {
                     it->m_matched = false;
                 }
+                node->m_mergeCursor = node->m_children.begin();
             }
             else
             {
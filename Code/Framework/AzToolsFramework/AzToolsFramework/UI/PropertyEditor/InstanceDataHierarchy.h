@@ -158,6 +158,7 @@ namespace AzToolsFramework
         AZ::u32                                     m_comparisonFlags;
         const InstanceDataNode*                     m_comparisonNode;
         bool                                        m_matched;          // true if this node was matched across all instances, used internally when the hierarchy is built.
+        NodeContainer::iterator                     m_mergeCursor;      // Child after the last one matched while merging an instance, used internally when the hierarchy is built.
         Identifier                                  m_identifier;       // Local identifier for this node (name crc, or persistent Id / index among siblings in container case).
         const AZ::Edit::ElementData*                m_groupElementData; // Group data for this item
 
@@ -105,6 +105,16 @@ namespace AzToolsFramework
             return false;
         }
 
+        AZStd::size_t URSequencePoint::GetMemoryUsage() const
+        {
+            AZStd::size_t memoryUsage = 0;
+            for (const URSequencePoint* child : m_children)
+            {
+                memoryUsage += child->GetMemoryUsage();
+            }
+            return memoryUsage;
+        }
+
         void URSequencePoint::SetParent(URSequencePoint* parent)
         {
             if (m_parent != nullptr)
@@ -188,6 +198,7 @@ namespace AzToolsFramework
 
             m_SequencePointsBuffer.push_back(cmd);
             m_Cursor = int(m_SequencePointsBuffer.size()) - 1;
+            EnforceMemoryBudget();
 #ifdef _DEBUG
             CleanCheck();
 #endif
@@ -346,6 +357,58 @@ namespace AzToolsFramework
             }
         }
 
+        void UndoStack::SetMemoryBudget(AZStd::size_t memoryBudget)
+        {
+            if (m_memoryBudget != memoryBudget)
+            {
+                m_memoryBudget = memoryBudget;
+                EnforceMemoryBudget();
+            }
+        }
+
+        void UndoStack::EnforceMemoryBudget()
+        {
+            if (m_memoryBudget == 0 || m_SequencePointsBuffer.size() < 2)
+            {
+                return;
+            }
+
+            AZStd::size_t memoryUsage = 0;
+            for (const URSequencePoint* sequencePoint : m_SequencePointsBuffer)
+            {
+                memoryUsage += sequencePoint->GetMemoryUsage();
+            }
+
+            // only commands below the cursor can be removed, undoing past them is no longer possible afterwards
+            size_t evictCount = 0;
+            while (memoryUsage > m_memoryBudget && int(evictCount) < m_Cursor)
+            {
+                memoryUsage -= m_SequencePointsBuffer[evictCount]->GetMemoryUsage();
+                delete m_SequencePointsBuffer[evictCount];
+                ++evictCount;
+            }
+
+            if (evictCount > 0)
+            {
+                m_SequencePointsBuffer.erase(m_SequencePointsBuffer.begin(), m_SequencePointsBuffer.begin() + evictCount);
+                m_Cursor -= int(evictCount);
+                if (m_CleanPoint >= int(evictCount) - 1)
+                {
+                    m_CleanPoint -= int(evictCount);
+                }
+                else
+                {
+                    // the clean state was removed with the commands, same magic number as Slice
+                    m_CleanPoint = -2;
+                }
+
+                if (m_notify)
+                {
+                    m_notify->OnUndoStackChanged();
+                }
+            }
+        }
+
         URSequencePoint* UndoStack::Find(URCommandID id, const AZ::Uuid& typeOfCommand)
         {
             for (int idx = 0; idx < int(m_SequencePointsBuffer.size()); ++idx)
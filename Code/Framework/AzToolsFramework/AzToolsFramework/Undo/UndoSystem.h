@@ -74,6 +74,12 @@ namespace AzToolsFramework
             */
             virtual bool Changed() const = 0;
 
+            /**
+            Usage: override to report the bytes held by the class specific undo/redo state.
+            The base implementation returns the total of the children, the UndoStack uses it to stay within its memory budget.
+            */
+            virtual AZStd::size_t GetMemoryUsage() const;
+
             /**
             Usage: return the first command in the parent/child tree with a matching id
             returns NULL on failure to make any match
@@ -183,7 +189,18 @@ namespace AzToolsFramework
             */
             void Slice();
 
+            /**
+            Usage: caps the memory reported by the commands in the stack, 0 (the default) disables the cap.
+            The oldest commands are removed once the cap is exceeded, the most recent command always stays.
+            */
+            void SetMemoryBudget(AZStd::size_t memoryBudget);
+            AZStd::size_t GetMemoryBudget() const { return m_memoryBudget; }
+
         protected:
+            // removes the oldest commands until the stack fits in its memory budget
+            void EnforceMemoryBudget();
+
+
 #ifdef _DEBUG
             void CleanCheck();
 #endif
@@ -195,6 +212,7 @@ namespace AzToolsFramework
 
             SequencePointBuffer m_SequencePointsBuffer;
             IUndoNotify* m_notify;
+            AZStd::size_t m_memoryBudget = 0;
 
         private:
 
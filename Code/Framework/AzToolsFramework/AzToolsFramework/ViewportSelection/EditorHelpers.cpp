@@ -8,6 +8,7 @@
 #include "EditorHelpers.h"
 
 #include <AzCore/Console/Console.h>
+#include <AzCore/std/sort.h>
 #include <AzFramework/Entity/EntityDebugDisplayBus.h>
 #include <AzFramework/Viewport/CameraState.h>
 #include <AzFramework/Visibility/BoundsBus.h>
@@ -123,9 +124,11 @@ namespace AzToolsFramework
 
         const bool helpersVisible = HelpersVisible();
 
+        // entities whose selection bounds the pick ray hits, with the distance at which it enters them
+        m_pickCandidates.clear();
+
         // selecting new entities
         AZ::EntityId entityIdUnderCursor;
-        float closestDistance = std::numeric_limits<float>::max();
         for (size_t entityCacheIndex = 0; entityCacheIndex < m_entityDataCache->VisibleEntityDataCount(); ++entityCacheIndex)
         {
             const AZ::EntityId entityId = m_entityDataCache->GetVisibleEntityId(entityCacheIndex);
@@ -153,8 +156,8 @@ namespace AzToolsFramework
                     if (screenCoords.m_x >= screenPosition.m_x - iconRange && screenCoords.m_x <= screenPosition.m_x + iconRange &&
                         screenCoords.m_y >= screenPosition.m_y - iconRange && screenCoords.m_y <= screenPosition.m_y + iconRange)
                     {
-                        entityIdUnderCursor = entityId;
-                        break;
+                        // icons take precedence over any entity picked against its components
+                        return entityId;
                     }
                 }
             }
@@ -164,17 +167,36 @@ namespace AzToolsFramework
             if (const AZ::Aabb aabb = CalculateEditorEntitySelectionBounds(entityId, ViewportInfo{ viewportId }); aabb.IsValid())
             {
                 // coarse grain check
-                if (AabbIntersectMouseRay(mouseInteraction.m_mouseInteraction, aabb))
+                if (float aabbDistance; AabbIntersectMouseRay(mouseInteraction.m_mouseInteraction, aabb, aabbDistance))
                 {
-                    // if success, pick against specific component
-                    if (PickEntity(entityId, mouseInteraction.m_mouseInteraction, closestDistance, viewportId))
-                    {
-                        entityIdUnderCursor = entityId;
-                    }
+                    m_pickCandidates.push_back({ entityId, aabbDistance });
                 }
             }
         }
 
+        // pick against specific components from the nearest bounds to the farthest, a component can't be hit
+        // closer than its bounds so the remaining entities can be skipped once a hit is closer than their bounds
+        AZStd::sort(
+            m_pickCandidates.begin(), m_pickCandidates.end(),
+            [](const PickCandidate& lhs, const PickCandidate& rhs)
+            {
+                return lhs.m_aabbDistance < rhs.m_aabbDistance;
+            });
+
+        float closestDistance = std::numeric_limits<float>::max();
+        for (const PickCandidate& candidate : m_pickCandidates)
+        {
+            if (candidate.m_aabbDistance > closestDistance)
+            {
+                break;
+            }
+
+            if (PickEntity(candidate.m_entityId, mouseInteraction.m_mouseInteraction, closestDistance, viewportId))
+            {
+                entityIdUnderCursor = candidate.m_entityId;
+            }
+        }
+
         return entityIdUnderCursor;
     }
 
@@ -9,6 +9,7 @@
 
 #include <AzCore/Component/EntityId.h>
 #include <AzCore/Memory/Memory.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/functional.h>
 
 namespace AzFramework
@@ -60,6 +61,14 @@ namespace AzToolsFramework
             const AZStd::function<bool(AZ::EntityId)>& showIconCheck);
 
     private:
+        //! An entity whose selection bounds are hit by the pick ray.
+        struct PickCandidate
+        {
+            AZ::EntityId m_entityId;
+            float m_aabbDistance; //!< Distance along the pick ray to the selection bounds.
+        };
+
         const EditorVisibleEntityDataCache* m_entityDataCache = nullptr; //!< Entity Data queried by the EditorHelpers.
+        AZStd::vector<PickCandidate> m_pickCandidates; //!< Kept between mouse interactions to reuse its storage.
     };
 } // namespace AzToolsFramework
@@ -60,6 +60,13 @@ namespace AzToolsFramework
     }
 
     bool AabbIntersectMouseRay(const ViewportInteraction::MouseInteraction& mouseInteraction, const AZ::Aabb& aabb)
+    {
+        float distance;
+        return AabbIntersectMouseRay(mouseInteraction, aabb, distance);
+    }
+
+    bool AabbIntersectMouseRay(
+        const ViewportInteraction::MouseInteraction& mouseInteraction, const AZ::Aabb& aabb, float& distance)
     {
         AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzToolsFramework);
 
@@ -67,8 +74,20 @@ namespace AzToolsFramework
 
         AZ::Vector3 startNormal;
         float t, end;
-        return AZ::Intersect::IntersectRayAABB(
-                   mouseInteraction.m_mousePick.m_rayOrigin, rayScaledDir, rayScaledDir.GetReciprocal(), aabb, t, end, startNormal) > 0;
+        const int result = AZ::Intersect::IntersectRayAABB(
+            mouseInteraction.m_mousePick.m_rayOrigin, rayScaledDir, rayScaledDir.GetReciprocal(), aabb, t, end, startNormal);
+        if (result == AZ::Intersect::ISECT_RAY_AABB_ISECT)
+        {
+            // t is relative to the scaled direction
+            distance = t * s_pickRayLength;
+            return true;
+        }
+        if (result == AZ::Intersect::ISECT_RAY_AABB_SA_INSIDE)
+        {
+            distance = 0.0f;
+            return true;
+        }
+        return false;
     }
 
     bool PickEntity(
@@ -45,6 +45,12 @@ namespace AzToolsFramework
     //! in screen space intersected an aabb in world space.
     bool AabbIntersectMouseRay(const ViewportInteraction::MouseInteraction& mouseInteraction, const AZ::Aabb& aabb);
 
+    //! Given a mouse interaction, determine if the pick ray from its position
+    //! in screen space intersected an aabb in world space.
+    //! @param distance Distance along the pick ray where it enters the aabb (0 if it starts inside).
+    bool AabbIntersectMouseRay(
+        const ViewportInteraction::MouseInteraction& mouseInteraction, const AZ::Aabb& aabb, float& distance);
+
     //! Return if a mouse interaction (pick ray) did intersect the tested EntityId.
     bool PickEntity(
         AZ::EntityId entityId, const ViewportInteraction::MouseInteraction& mouseInteraction, float& closestDistance, int viewportId);
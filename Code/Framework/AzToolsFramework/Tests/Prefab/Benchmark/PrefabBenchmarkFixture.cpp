@@ -117,6 +117,21 @@ namespace Benchmark
         }
     }
 
+    void BM_Prefab::SetUpMockValidatorForReadNestedPrefab(AZ::IO::PathView rootPath)
+    {
+        SetUpMockValidatorForReadPrefab();
+
+        AZStd::vector<UnitTest::InstanceData> instancesData;
+        instancesData.reserve(m_paths.size());
+        for (size_t number = 0; number < m_paths.size(); ++number)
+        {
+            instancesData.emplace_back(UnitTest::PrefabTestDataUtils::CreateInstanceDataWithNoPatches(
+                AZStd::string::format("Instance%zu", number), m_paths[number]));
+        }
+
+        m_mockIOActionValidator->ReadPrefabDom(rootPath, UnitTest::PrefabTestDomUtils::CreatePrefabDom(instancesData));
+    }
+
     void BM_Prefab::DeleteInstances(const AzToolsFramework::Prefab::InstanceList& instancesToDelete)
     {
         for (AzToolsFramework::Prefab::Instance* instanceToDelete : instancesToDelete)
@@ -39,6 +39,8 @@ namespace Benchmark
         void CreateFakePaths(const unsigned int pathCount);
 
         void SetUpMockValidatorForReadPrefab();
+        //! Sets up a prefab at rootPath with one nested instance of each of the fake paths.
+        void SetUpMockValidatorForReadNestedPrefab(AZ::IO::PathView rootPath);
 
         void DeleteInstances(const AzToolsFramework::Prefab::InstanceList& instances);
 
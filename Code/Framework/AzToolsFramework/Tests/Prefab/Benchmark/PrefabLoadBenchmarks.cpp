@@ -47,6 +47,39 @@ namespace Benchmark
         ->Range(100, 1000)
         ->Unit(benchmark::kMillisecond)
         ->Complexity();
+
+    BENCHMARK_DEFINE_F(BM_PrefabLoad, LoadPrefab_NestedTemplates)(::benchmark::State& state)
+    {
+        const unsigned int numNestedTemplates = state.range();
+        CreateFakePaths(numNestedTemplates);
+        const AZ::IO::Path rootPath = AZ::IO::Path(m_pathString) / "root";
+
+        for (auto _ : state)
+        {
+            state.PauseTiming();
+
+            SetUpMockValidatorForReadNestedPrefab(rootPath);
+
+            m_prefabLoaderInterface = AZ::Interface<PrefabLoaderInterface>::Get();
+
+            state.ResumeTiming();
+
+            m_prefabLoaderInterface->LoadTemplateFromFile(rootPath);
+
+            state.PauseTiming();
+
+            ResetPrefabSystem();
+
+            state.ResumeTiming();
+        }
+
+        state.SetComplexityN(numNestedTemplates);
+    }
+    BENCHMARK_REGISTER_F(BM_PrefabLoad, LoadPrefab_NestedTemplates)
+        ->RangeMultiplier(10)
+        ->Range(100, 1000)
+        ->Unit(benchmark::kMillisecond)
+        ->Complexity();
 }
 
 #endif
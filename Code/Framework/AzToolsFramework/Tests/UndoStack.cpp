@@ -533,4 +533,63 @@ namespace UnitTest
         EXPECT_EQ(numUndos, counter);
         EXPECT_EQ(tracker, numUndos);
     }
+
+    class UndoMemoryUsageTest : public UndoIntSetter
+    {
+    public:
+        UndoMemoryUsageTest(int* value, int newValue, AZStd::size_t memoryUsage)
+            : UndoIntSetter(value, newValue)
+            , m_memoryUsage(memoryUsage)
+        {
+        }
+
+        AZStd::size_t GetMemoryUsage() const override { return m_memoryUsage; }
+
+    private:
+        AZStd::size_t m_memoryUsage;
+    };
+
+    TEST(UndoStack, MemoryBudget_Exceeded_OldestUndosRemoved)
+    {
+        UndoStack undoStack(nullptr);
+        undoStack.SetMemoryBudget(300);
+
+        int tracker = 0;
+        for (int i = 0; i < 5; i++)
+        {
+            undoStack.Post(aznew UndoMemoryUsageTest(&tracker, i + 1, 100));
+        }
+
+        int counter = 0;
+        while (undoStack.CanUndo())
+        {
+            undoStack.Undo();
+            counter++;
+        }
+
+        // only the three most recent undos fit in the budget
+        EXPECT_EQ(counter, 3);
+        EXPECT_EQ(tracker, 2);
+
+        while (undoStack.CanRedo())
+        {
+            undoStack.Redo();
+        }
+        EXPECT_EQ(tracker, 5);
+    }
+
+    TEST(UndoStack, MemoryBudget_SingleUndoOverBudget_UndoKept)
+    {
+        UndoStack undoStack(nullptr);
+        undoStack.SetMemoryBudget(100);
+
+        int tracker = 0;
+        undoStack.Post(aznew UndoMemoryUsageTest(&tracker, 1, 100));
+        undoStack.Post(aznew UndoMemoryUsageTest(&tracker, 2, 500));
+
+        EXPECT_TRUE(undoStack.CanUndo());
+        undoStack.Undo();
+        EXPECT_EQ(tracker, 1);
+        EXPECT_FALSE(undoStack.CanUndo());
+    }
 }
@@ -276,6 +276,58 @@ namespace UnitTest
         TestFGetCachedFileData(fileInArchiveFile, dataString.size(), dataString.data());
     }
 
+    TEST_F(ArchiveTestFixture, TestArchiveFGetCachedFileData_MemoryMappedPakFile)
+    {
+        constexpr const char* fileInArchiveFile = "config\\memorymapped.cfg";
+        constexpr AZStd::string_view dataString = "HELLO MAPPED WORLD";
+
+        AZ::IO::IArchive* archive = AZ::Interface<AZ::IO::IArchive>::Get();
+        ASSERT_NE(nullptr, archive);
+
+        AZ::IO::FileIOBase* fileIo = AZ::IO::FileIOBase::GetInstance();
+        ASSERT_NE(nullptr, fileIo);
+
+        auto console = AZ::Interface<AZ::IConsole>::Get();
+        ASSERT_NE(nullptr, console);
+
+        // Paks are only memory mapped if the option is enabled at the time the pak is opened.
+        console->PerformCommand("sys_PakMemoryMapped", { "true" });
+
+        const char* testArchivePath = "@usercache@/memorymapped.pak";
+        {
+            archive->ClosePack(testArchivePath);
+            fileIo->Remove(testArchivePath);
+
+            // Stored files are handed out as views into the mapped pak.
+            AZStd::intrusive_ptr<AZ::IO::INestedArchive> pArchive = archive->OpenArchive(testArchivePath, nullptr, AZ::IO::INestedArchive::FLAGS_CREATE_NEW);
+            ASSERT_NE(nullptr, pArchive);
+            EXPECT_EQ(0, pArchive->UpdateFile(fileInArchiveFile, dataString.data(), dataString.size(), AZ::IO::INestedArchive::METHOD_STORE, 0));
+            pArchive.reset();
+
+            EXPECT_TRUE(archive->OpenPack("@assets@", testArchivePath));
+            EXPECT_TRUE(archive->IsFileExist(fileInArchiveFile));
+        }
+
+        CVarIntValueScope previousLocationPriority{ *console, "sys_pakPriority" };
+        console->PerformCommand("sys_PakPriority", { AZ::CVarFixedString::format("%d", aznumeric_cast<int>(AZ::IO::ArchiveLocationPriority::ePakPriorityPakOnly)) });
+
+        TestFGetCachedFileData(fileInArchiveFile, dataString.size(), dataString.data());
+
+        {
+            // Reading part of a stored file comes straight from the mapping as well.
+            AZ::IO::HandleType fileHandle = archive->FOpen(fileInArchiveFile, "rb", 0);
+            ASSERT_NE(AZ::IO::InvalidHandle, fileHandle);
+            EXPECT_EQ(0u, archive->FSeek(fileHandle, 6, SEEK_SET));
+            char buffer[6]{};
+            EXPECT_EQ(sizeof(buffer), archive->FReadRaw(buffer, 1, sizeof(buffer), fileHandle));
+            EXPECT_EQ(0, memcmp(buffer, dataString.data() + 6, sizeof(buffer)));
+            archive->FClose(fileHandle);
+        }
+
+        EXPECT_TRUE(archive->ClosePack(testArchivePath));
+        console->PerformCommand("sys_PakMemoryMapped", { "false" });
+    }
+
     TEST_F(ArchiveTestFixture, TestArchiveOpenPacks_FindsMultiplePaks_Works)
     {
         AZ::IO::IArchive* archive = AZ::Interface<AZ::IO::IArchive>::Get();
@@ -1049,3 +1101,123 @@ namespace UnitTest
     {
     };
 }
+
+#if defined(HAVE_BENCHMARK)
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    class ArchiveReadBenchmarkFixture
+        : public ::benchmark::Fixture
+    {
+    public:
+        using ::benchmark::Fixture::SetUp, ::benchmark::Fixture::TearDown;
+
+        static constexpr const char* TestArchivePath = "@usercache@/benchmark.pak";
+        static constexpr size_t NumFiles = 64;
+        static constexpr size_t FileSize = 4 * 1024;
+
+        void SetUp(const ::benchmark::State& state) override
+        {
+            // all threads run SetUp, only one of them may start the application and create the archive
+            if (state.thread_index == 0)
+            {
+                if (!AZ::AllocatorInstance<AZ::SystemAllocator>::IsReady())
+                {
+                    AZ::AllocatorInstance<AZ::SystemAllocator>::Create();
+                    m_ownsSystemAllocator = true;
+                }
+
+                m_application = AZStd::make_unique<AzFramework::Application>();
+                AZ::SettingsRegistryInterface* registry = AZ::SettingsRegistry::Get();
+                auto projectPathKey =
+                    AZ::SettingsRegistryInterface::FixedValueString(AZ::SettingsRegistryMergeUtils::BootstrapSettingsRootKey) + "/project_path";
+                registry->Set(projectPathKey, "AutomatedTesting");
+                AZ::SettingsRegistryMergeUtils::MergeSettingsToRegistry_AddRuntimeFilePaths(*registry);
+                m_application->Start(AZ::ComponentApplication::Descriptor{});
+                AZ::UserSettingsComponentRequestBus::Broadcast(&AZ::UserSettingsComponentRequests::DisableSaveOnFinalize);
+
+                AZ::IO::IArchive* archive = AZ::Interface<AZ::IO::IArchive>::Get();
+                archive->ClosePack(TestArchivePath);
+                AZ::IO::FileIOBase::GetInstance()->Remove(TestArchivePath);
+
+                AZStd::intrusive_ptr<AZ::IO::INestedArchive> nestedArchive =
+                    archive->OpenArchive(TestArchivePath, nullptr, AZ::IO::INestedArchive::FLAGS_CREATE_NEW);
+                AZStd::vector<char> fileData(FileSize, 'a');
+                for (size_t i = 0; i < NumFiles; ++i)
+                {
+                    nestedArchive->UpdateFile(GetFileName(i), fileData.data(), fileData.size(),
+                        AZ::IO::INestedArchive::METHOD_COMPRESS, AZ::IO::INestedArchive::LEVEL_FASTEST);
+                }
+                nestedArchive.reset();
+                archive->OpenPack("@assets@", TestArchivePath);
+
+                // Only look inside the archive so the benchmark isn't measuring the file system
+                auto console = AZ::Interface<AZ::IConsole>::Get();
+                m_previousLocationPriority = AZStd::make_unique<UnitTest::CVarIntValueScope>(*console, "sys_pakPriority");
+                console->PerformCommand("sys_PakPriority",
+                    { AZ::CVarFixedString::format("%d", aznumeric_cast<int>(AZ::IO::ArchiveLocationPriority::ePakPriorityPakOnly)) });
+            }
+        }
+
+        void TearDown(const ::benchmark::State& state) override
+        {
+            if (state.thread_index == 0)
+            {
+                m_previousLocationPriority.reset();
+                AZ::Interface<AZ::IO::IArchive>::Get()->ClosePack(TestArchivePath);
+                AZ::IO::FileIOBase::GetInstance()->Remove(TestArchivePath);
+                m_application->Stop();
+                m_application.reset();
+
+                if (m_ownsSystemAllocator)
+                {
+                    AZ::AllocatorInstance<AZ::SystemAllocator>::Destroy();
+                    m_ownsSystemAllocator = false;
+                }
+            }
+        }
+
+        static AZ::IO::FixedMaxPathString GetFileName(size_t index)
+        {
+            return AZ::IO::FixedMaxPathString::format("benchmark/file%zu.dat", index);
+        }
+
+    private:
+        AZStd::unique_ptr<AzFramework::Application> m_application;
+        AZStd::unique_ptr<UnitTest::CVarIntValueScope> m_previousLocationPriority;
+        bool m_ownsSystemAllocator = false;
+    };
+
+    // Every thread opens, reads and closes its own files, which contends on the open file table and the list of archives.
+    BENCHMARK_DEFINE_F(ArchiveReadBenchmarkFixture, OpenReadClose)(::benchmark::State& state)
+    {
+        AZ::IO::IArchive* archive = AZ::Interface<AZ::IO::IArchive>::Get();
+        AZStd::vector<char> buffer(FileSize);
+        size_t fileIndex = state.thread_index;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZ::IO::HandleType fileHandle = archive->FOpen(GetFileName(fileIndex % NumFiles), "rb", 0);
+            archive->FReadRaw(buffer.data(), 1, buffer.size(), fileHandle);
+            archive->FClose(fileHandle);
+            fileIndex += state.threads;
+        }
+        state.SetBytesProcessed(state.iterations() * FileSize);
+    }
+    BENCHMARK_REGISTER_F(ArchiveReadBenchmarkFixture, OpenReadClose)->ThreadRange(1, 16)->UseRealTime();
+
+    // Searches the archives for files without opening them.
+    BENCHMARK_DEFINE_F(ArchiveReadBenchmarkFixture, FindFile)(::benchmark::State& state)
+    {
+        AZ::IO::IArchive* archive = AZ::Interface<AZ::IO::IArchive>::Get();
+        size_t fileIndex = state.thread_index;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            benchmark::DoNotOptimize(archive->IsFileExist(GetFileName(fileIndex % NumFiles)));
+            fileIndex += state.threads;
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+    BENCHMARK_REGISTER_F(ArchiveReadBenchmarkFixture, FindFile)->ThreadRange(1, 16)->UseRealTime();
+} // namespace Benchmark
+#endif // HAVE_BENCHMARK
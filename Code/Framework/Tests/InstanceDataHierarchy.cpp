@@ -1228,6 +1228,77 @@ namespace UnitTest
         }
     };
 
+    class InstanceDataHierarchyMergeInstancesTest
+        : public AllocatorsFixture
+    {
+    public:
+        class MergedContainer
+        {
+        public:
+            AZ_TYPE_INFO(MergedContainer, "{6A1F5E0C-9B54-4C2E-A8E3-2B7C1D0F4E61}");
+            AZ_CLASS_ALLOCATOR(MergedContainer, AZ::SystemAllocator, 0);
+
+            int m_first = 0;
+            AZStd::vector<int> m_values;
+            float m_last = 0.0f;
+
+            static void Reflect(AZ::SerializeContext& context)
+            {
+                context.Class<MergedContainer>()
+                    ->Field("first", &MergedContainer::m_first)
+                    ->Field("values", &MergedContainer::m_values)
+                    ->Field("last", &MergedContainer::m_last)
+                ;
+            }
+        };
+    };
+
+    TEST_F(InstanceDataHierarchyMergeInstancesTest, MergingInstances_MatchesEveryElementAcrossInstances)
+    {
+        using namespace AzToolsFramework;
+
+        AZ::SerializeContext serializeContext;
+        MergedContainer::Reflect(serializeContext);
+
+        MergedContainer instances[3];
+        instances[0].m_values = { 1, 2, 3, 4, 5 };
+        instances[1].m_values = { 1, 2, 3 };
+        instances[2].m_values = { 1, 2, 3, 4 };
+
+        InstanceDataHierarchy idh;
+        for (MergedContainer& instance : instances)
+        {
+            idh.AddRootInstance(&instance, azrtti_typeid<MergedContainer>());
+        }
+        idh.Build(&serializeContext, 0);
+
+        const auto& children = idh.GetChildren();
+        ASSERT_EQ(3, children.size());
+
+        auto it = children.begin();
+        EXPECT_EQ(AZ::Crc32("first"), it->GetElementMetadata()->m_nameCrc);
+        EXPECT_EQ(3, it->GetNumInstances());
+        ++it;
+
+        // Only the container elements shared by all the instances are kept
+        EXPECT_EQ(AZ::Crc32("values"), it->GetElementMetadata()->m_nameCrc);
+        ASSERT_EQ(3, it->GetChildren().size());
+        int expectedValue = 1;
+        for (const InstanceDataNode& element : it->GetChildren())
+        {
+            ASSERT_EQ(3, element.GetNumInstances());
+            for (size_t instanceIndex = 0; instanceIndex < element.GetNumInstances(); ++instanceIndex)
+            {
+                EXPECT_EQ(expectedValue, *static_cast<int*>(element.GetInstance(instanceIndex)));
+            }
+            ++expectedValue;
+        }
+        ++it;
+
+        EXPECT_EQ(AZ::Crc32("last"), it->GetElementMetadata()->m_nameCrc);
+        EXPECT_EQ(3, it->GetNumInstances());
+    }
+
     TEST_F(InstanceDataHierarchyBasicTest, Test)
     {
         run();
@@ -10,6 +10,7 @@
 #include <AzCore/Console/Console.h>
 #include <AzCore/Name/NameDictionary.h>
 #include <AzCore/Console/IConsole.h>
+#include <AzCore/Math/ShapeIntersection.h>
 #include <AzFramework/Visibility/OctreeSystemComponent.h>
 #include <random>
 
@@ -376,6 +377,129 @@ namespace UnitTest
         EnumerateMultipleEntriesHelper(m_octreeScene, bound1, bound2, bound3);
     }
 
+    TEST_F(OctreeTests, EnumerateFrustum_ManyEntries_AllOverlappingEntriesAreGathered)
+    {
+        // Validate that the vectorized culling of child nodes never culls a node with entries that overlap the frustum
+        const unsigned int seed = 1;
+        std::mt19937_64 rng(seed);
+        std::uniform_real_distribution<float> unif(-1.0f, 1.0f);
+
+        AZStd::vector<AzFramework::VisibilityEntry> visEntries(256);
+        for (AzFramework::VisibilityEntry& entry : visEntries)
+        {
+            const AZ::Vector3 aabbMin(unif(rng), unif(rng), unif(rng));
+            entry.m_boundingVolume = AZ::Aabb::CreateFromMinMax(aabbMin, aabbMin + AZ::Vector3(unif(rng), unif(rng), unif(rng)).GetAbs() * 0.05f);
+            m_octreeScene->InsertOrUpdateEntry(entry);
+        }
+        ASSERT_GT(m_octreeScene->GetNodeCount(), 1u);
+
+        for (uint32_t query = 0; query < 16; ++query)
+        {
+            const AZ::Quaternion frustumDirection = AZ::Quaternion::CreateFromAxisAngle(AZ::Vector3::CreateAxisZ(), unif(rng) * 0.5f);
+            const AZ::Transform frustumTransform = AZ::Transform::CreateFromQuaternionAndTranslation(frustumDirection, AZ::Vector3(unif(rng), -1.0f, unif(rng)));
+            const AZ::Frustum frustum = AZ::Frustum(AZ::ViewFrustumAttributes(frustumTransform, 1.0f, 2.0f * atanf(0.25f), 0.1f, 1.5f));
+
+            AZStd::vector<VisibilityEntry*> gatheredEntries;
+            m_octreeScene->Enumerate(frustum, [&gatheredEntries](const AzFramework::IVisibilityScene::NodeData& nodeData) { AppendEntries(gatheredEntries, nodeData); });
+
+            for (AzFramework::VisibilityEntry& entry : visEntries)
+            {
+                if (AZ::ShapeIntersection::Overlaps(frustum, entry.m_boundingVolume))
+                {
+                    EXPECT_NE(AZStd::find(gatheredEntries.begin(), gatheredEntries.end(), &entry), gatheredEntries.end());
+                }
+            }
+        }
+
+        for (AzFramework::VisibilityEntry& entry : visEntries)
+        {
+            m_octreeScene->RemoveEntry(entry);
+        }
+        ValidateEntryCountEqualsExpectedCount(m_octreeScene, 0);
+    }
+
+    TEST_F(OctreeTests, EnumerateFrustums_MultipleFrustums_ViewMasksMatchIndividualEnumerates)
+    {
+        const unsigned int seed = 1;
+        std::mt19937_64 rng(seed);
+        std::uniform_real_distribution<float> unif(-1.0f, 1.0f);
+
+        AZStd::vector<AzFramework::VisibilityEntry> visEntries(128);
+        for (AzFramework::VisibilityEntry& entry : visEntries)
+        {
+            const AZ::Vector3 aabbMin(unif(rng), unif(rng), unif(rng));
+            entry.m_boundingVolume = AZ::Aabb::CreateFromMinMax(aabbMin, aabbMin + AZ::Vector3(unif(rng), unif(rng), unif(rng)).GetAbs() * 0.05f);
+            m_octreeScene->InsertOrUpdateEntry(entry);
+        }
+
+        AZStd::vector<AZ::Frustum> frustums;
+        for (uint32_t frustumIndex = 0; frustumIndex < 8; ++frustumIndex)
+        {
+            const AZ::Quaternion frustumDirection = AZ::Quaternion::CreateFromAxisAngle(AZ::Vector3::CreateAxisZ(), unif(rng) * 0.5f);
+            const AZ::Transform frustumTransform = AZ::Transform::CreateFromQuaternionAndTranslation(frustumDirection, AZ::Vector3(unif(rng), -1.0f, unif(rng)));
+            frustums.push_back(AZ::Frustum(AZ::ViewFrustumAttributes(frustumTransform, 1.0f, 2.0f * atanf(0.25f), 0.1f, 1.5f)));
+        }
+
+        AZStd::vector<AZStd::vector<VisibilityEntry*>> gatheredEntriesPerView(frustums.size());
+        m_octreeScene->EnumerateFrustums(frustums, [&gatheredEntriesPerView](const AzFramework::IVisibilityScene::NodeData& nodeData, uint32_t viewMask)
+            {
+                EXPECT_NE(viewMask, 0u);
+                for (uint32_t view = 0; view < gatheredEntriesPerView.size(); ++view)
+                {
+                    if (viewMask & (1u << view))
+                    {
+                        AppendEntries(gatheredEntriesPerView[view], nodeData);
+                    }
+                }
+            });
+
+        for (uint32_t view = 0; view < frustums.size(); ++view)
+        {
+            AZStd::vector<VisibilityEntry*> gatheredEntries;
+            m_octreeScene->Enumerate(frustums[view], [&gatheredEntries](const AzFramework::IVisibilityScene::NodeData& nodeData) { AppendEntries(gatheredEntries, nodeData); });
+            EXPECT_EQ(gatheredEntriesPerView[view], gatheredEntries);
+        }
+
+        for (AzFramework::VisibilityEntry& entry : visEntries)
+        {
+            m_octreeScene->RemoveEntry(entry);
+        }
+    }
+
+    TEST_F(OctreeTests, InsertOrUpdateEntries_InsertAndMoveBatch_EntriesAreUpdated)
+    {
+        AzFramework::VisibilityEntry visEntries[4];
+        AZStd::vector<VisibilityEntry*> batch;
+        for (uint32_t i = 0; i < AZ_ARRAY_SIZE(visEntries); ++i)
+        {
+            const AZ::Vector3 aabbMin(-0.9f + 0.4f * i, -0.9f, -0.9f);
+            visEntries[i].m_boundingVolume = AZ::Aabb::CreateFromMinMax(aabbMin, aabbMin + AZ::Vector3(0.1f));
+            batch.push_back(&visEntries[i]);
+        }
+
+        m_octreeScene->InsertOrUpdateEntries(batch);
+        ValidateEntryCountEqualsExpectedCount(m_octreeScene, AZ_ARRAY_SIZE(visEntries));
+
+        // Move all entries to the positive Y half of the world, updating the batch must not insert them a second time
+        for (AzFramework::VisibilityEntry& entry : visEntries)
+        {
+            entry.m_boundingVolume.Translate(AZ::Vector3(0.0f, 1.5f, 0.0f));
+        }
+        m_octreeScene->InsertOrUpdateEntries(batch);
+        ValidateEntryCountEqualsExpectedCount(m_octreeScene, AZ_ARRAY_SIZE(visEntries));
+
+        AZStd::vector<VisibilityEntry*> gatheredEntries;
+        m_octreeScene->Enumerate(AZ::Aabb::CreateFromMinMax(AZ::Vector3(-1.0f, -1.0f, -1.0f), AZ::Vector3(1.0f, -0.1f, 1.0f)),
+            [&gatheredEntries](const AzFramework::IVisibilityScene::NodeData& nodeData) { AppendEntries(gatheredEntries, nodeData); });
+        EXPECT_TRUE(gatheredEntries.empty());
+
+        for (AzFramework::VisibilityEntry& entry : visEntries)
+        {
+            m_octreeScene->RemoveEntry(entry);
+        }
+        ValidateEntryCountEqualsExpectedCount(m_octreeScene, 0);
+    }
+
     TEST_F(OctreeTests, InsertOrUpdateEntry_OverFillRootNodeWithLargeEntries_EntriesAreNotLost)
     {
         // Validate that the octree works if you exceed the max entry count with large entries,
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzFramework/Spawnable/SpawnableCellStreamer.h>
+#include <AzTest/AzTest.h>
+
+namespace UnitTest
+{
+    class SpawnableCellStreamerTest : public AllocatorsFixture
+    {
+    public:
+        void SetUp() override
+        {
+            AllocatorsFixture::SetUp();
+
+            AzFramework::SpawnableCellStreamer::Settings settings;
+            settings.m_cellSize = 10.0f;
+            settings.m_spawnDistance = 10.0f;
+            settings.m_preloadDistance = 20.0f;
+            settings.m_unloadMargin = 5.0f;
+            m_streamer = aznew AzFramework::SpawnableCellStreamer(settings);
+        }
+
+        void TearDown() override
+        {
+            delete m_streamer;
+            m_streamer = nullptr;
+
+            AllocatorsFixture::TearDown();
+        }
+
+        AzFramework::SpawnableCellStreamer* m_streamer{ nullptr };
+    };
+
+    TEST_F(SpawnableCellStreamerTest, GetCellCoordinate_PositiveAndNegativePositions_RoundedDownToCell)
+    {
+        using CellCoordinate = AzFramework::SpawnableCellStreamer::CellCoordinate;
+
+        EXPECT_EQ((CellCoordinate{ 0, 0 }), m_streamer->GetCellCoordinate(AZ::Vector3(0.0f, 9.9f, 100.0f)));
+        EXPECT_EQ((CellCoordinate{ 2, 1 }), m_streamer->GetCellCoordinate(AZ::Vector3(25.0f, 10.0f, 0.0f)));
+        EXPECT_EQ((CellCoordinate{ -1, -3 }), m_streamer->GetCellCoordinate(AZ::Vector3(-0.1f, -25.0f, 0.0f)));
+    }
+
+    TEST_F(SpawnableCellStreamerTest, GetDistanceToCell_InsideAndOutsideCell_DistanceToClosestPoint)
+    {
+        using CellCoordinate = AzFramework::SpawnableCellStreamer::CellCoordinate;
+
+        EXPECT_FLOAT_EQ(0.0f, m_streamer->GetDistanceToCell(AZ::Vector3(5.0f, 5.0f, 50.0f), CellCoordinate{ 0, 0 }));
+        EXPECT_FLOAT_EQ(15.0f, m_streamer->GetDistanceToCell(AZ::Vector3(5.0f, 5.0f, 0.0f), CellCoordinate{ 2, 0 }));
+        EXPECT_FLOAT_EQ(5.0f, m_streamer->GetDistanceToCell(AZ::Vector3(13.0f, 14.0f, 0.0f), CellCoordinate{ 0, 0 }));
+    }
+
+    TEST_F(SpawnableCellStreamerTest, Update_NoRegisteredCells_NothingStreamed)
+    {
+        using CellCoordinate = AzFramework::SpawnableCellStreamer::CellCoordinate;
+        using CellState = AzFramework::SpawnableCellStreamer::CellState;
+
+        m_streamer->Update({ AZ::Vector3(5.0f, 5.0f, 0.0f) });
+        EXPECT_EQ(CellState::Unloaded, m_streamer->GetCellState(CellCoordinate{ 0, 0 }));
+    }
+} // namespace UnitTest
@@ -731,6 +731,52 @@ namespace UnitTest
     // DespawnAllEntities
     //
 
+    TEST_F(SpawnableEntitiesManagerTest, DespawnAllEntities_ReturnToPool_SpawnAllEntitiesReusesEntities)
+    {
+        static constexpr size_t NumEntities = 4;
+        FillSpawnable(NumEntities);
+        CreateSingleParent();
+
+        AZStd::vector<AZ::EntityId> spawnedIds;
+        auto callback =
+            [&spawnedIds](AzFramework::EntitySpawnTicket::Id, AzFramework::SpawnableConstEntityContainerView entities)
+            {
+                for (const AZ::Entity* entity : entities)
+                {
+                    spawnedIds.push_back(entity->GetId());
+                }
+            };
+
+        AzFramework::SpawnAllEntitiesOptionalArgs spawnArgs;
+        spawnArgs.m_completionCallback = callback;
+        m_manager->SpawnAllEntities(*m_ticket, AZStd::move(spawnArgs));
+
+        AzFramework::DespawnAllEntitiesOptionalArgs despawnArgs;
+        despawnArgs.m_returnToPool = true;
+        m_manager->DespawnAllEntities(*m_ticket, AZStd::move(despawnArgs));
+
+        AzFramework::SpawnAllEntitiesOptionalArgs respawnArgs;
+        respawnArgs.m_completionCallback = callback;
+        m_manager->SpawnAllEntities(*m_ticket, AZStd::move(respawnArgs));
+        m_manager->ProcessQueue(AzFramework::SpawnableEntitiesManager::CommandQueuePriority::Regular);
+
+        ASSERT_EQ(NumEntities * 2, spawnedIds.size());
+        for (size_t i = 0; i < NumEntities; ++i)
+        {
+            EXPECT_EQ(spawnedIds[i], spawnedIds[NumEntities + i]);
+
+            AZ::Entity* entity = nullptr;
+            AZ::ComponentApplicationBus::BroadcastResult(entity, &AZ::ComponentApplicationBus::Events::FindEntity, spawnedIds[i]);
+            ASSERT_NE(nullptr, entity);
+            EXPECT_EQ(AZ::Entity::State::Active, entity->GetState());
+        }
+
+        // The parent references still point to the reused parent.
+        auto childTransform = AZ::TransformBus::FindFirstHandler(spawnedIds[NumEntities + 1]);
+        ASSERT_NE(nullptr, childTransform);
+        EXPECT_EQ(spawnedIds[NumEntities], childTransform->GetParentId());
+    }
+
     TEST_F(SpawnableEntitiesManagerTest, DespawnAllEntities_DeleteTicketBeforeCall_NoCrash)
     {
         {
@@ -722,6 +722,74 @@ namespace UnitTest
         EXPECT_TRUE(actualChildWorldPos == expectedChildLocalPos);
     }
 
+    // Counts the transform change notifications of an entity.
+    class TransformChangedCounter
+        : public TransformNotificationBus::Handler
+    {
+    public:
+        explicit TransformChangedCounter(EntityId entityId)
+        {
+            TransformNotificationBus::Handler::BusConnect(entityId);
+        }
+
+        ~TransformChangedCounter()
+        {
+            TransformNotificationBus::Handler::BusDisconnect();
+        }
+
+        void OnTransformChanged([[maybe_unused]] const Transform& local, const Transform& world) override
+        {
+            ++m_count;
+            m_lastWorldTM = world;
+        }
+
+        int m_count = 0;
+        Transform m_lastWorldTM = Transform::CreateIdentity();
+    };
+
+    TEST_F(TransformComponentHierarchy, TransformBatch_MoveParentAndChild_ChildNotifiedOnceWhenBatchEnds)
+    {
+        TransformBus::Event(m_childId, &TransformBus::Events::SetParentRelative, m_parentId);
+        TransformChangedCounter parentCounter(m_parentId);
+        TransformChangedCounter childCounter(m_childId);
+
+        const AZ::Vector3 parentLocalPos(3.0f, 1.0f, 2.0f);
+        const AZ::Vector3 childLocalPos(5.0f, 7.0f, 4.0f);
+        {
+            ScopedTransformBatch batch;
+            TransformBus::Event(m_parentId, &TransformBus::Events::SetLocalTranslation, AZ::Vector3(1.0f, 1.0f, 1.0f));
+            TransformBus::Event(m_childId, &TransformBus::Events::SetLocalTranslation, childLocalPos);
+            TransformBus::Event(m_parentId, &TransformBus::Events::SetLocalTranslation, parentLocalPos);
+            EXPECT_EQ(parentCounter.m_count, 0);
+            EXPECT_EQ(childCounter.m_count, 0);
+        }
+
+        EXPECT_EQ(parentCounter.m_count, 1);
+        EXPECT_EQ(childCounter.m_count, 1);
+        EXPECT_TRUE(childCounter.m_lastWorldTM.GetTranslation().IsClose(parentLocalPos + childLocalPos));
+
+        AZ::Vector3 childWorldPos;
+        TransformBus::EventResult(childWorldPos, m_childId, &TransformBus::Events::GetWorldTranslation);
+        EXPECT_TRUE(childWorldPos.IsClose(parentLocalPos + childLocalPos));
+    }
+
+    TEST_F(TransformComponentHierarchy, TransformBatch_SetChildWorldAfterMovingParent_LocalRelativeToNewParentWorld)
+    {
+        TransformBus::Event(m_childId, &TransformBus::Events::SetParentRelative, m_parentId);
+
+        const AZ::Vector3 parentWorldPos(10.0f, 0.0f, 0.0f);
+        const AZ::Vector3 childWorldPos(12.0f, 3.0f, 0.0f);
+        {
+            ScopedTransformBatch batch;
+            TransformBus::Event(m_parentId, &TransformBus::Events::SetWorldTranslation, parentWorldPos);
+            TransformBus::Event(m_childId, &TransformBus::Events::SetWorldTranslation, childWorldPos);
+        }
+
+        AZ::Vector3 childLocalPos;
+        TransformBus::EventResult(childLocalPos, m_childId, &TransformBus::Events::GetLocalTranslation);
+        EXPECT_TRUE(childLocalPos.IsClose(childWorldPos - parentWorldPos));
+    }
+
     // Fixture provides TransformComponent that is static (or not static) on an entity that has been activated.
     template<bool IsStatic>
     class StaticOrMovableTransformComponent
@@ -7,6 +7,7 @@
 
 set(FILES
     ../AzCore/Tests/Main.cpp
+    Spawnable/SpawnableCellStreamerTests.cpp
     Spawnable/SpawnableEntitiesManagerTests.cpp
     ArchiveCompressionTests.cpp
     ArchiveTests.cpp
@@ -9,11 +9,14 @@
 
 #include <AzCore/Casting/numeric_cast.h>
 #include <AzCore/Debug/Trace.h>
+#include <AzCore/IO/FileIO.h>
 #include <AzCore/IO/Path/Path.h>
 #include <AzCore/IO/SystemFile.h>
 #include <AzCore/Settings/SettingsRegistryMergeUtils.h>
 #include <AzCore/Console/IConsole.h>
+#include <AzCore/std/chrono/clocks.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/std/sort.h>
 #include <AzCore/StringFunc/StringFunc.h>
 #include <AzCore/Utils/Utils.h>
 #include <AzFramework/Asset/AssetSystemBus.h>
@@ -56,6 +59,119 @@ namespace
         AzFramework::WindowRequestBus::Broadcast(&AzFramework::WindowRequestBus::Events::ResizeClientArea, newSize);
     }
 
+    AZ_CVAR(AZ::u32, bg_benchmarkFrames, 0, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "If > 0, records the time of this many frames after the warm-up frames, writes them to bg_benchmarkReportFile and exits");
+    AZ_CVAR(AZ::u32, bg_benchmarkWarmupFrames, 120, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "Number of frames run before the benchmark frames are recorded, to let the level finish loading");
+    AZ_CVAR(float, bg_benchmarkFixedTimestep, 1.0f / 60.0f, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "Delta time in seconds simulated by each benchmark frame so every run simulates the same frames, 0 uses the real frame time");
+    AZ_CVAR(AZ::CVarFixedString, bg_benchmarkReportFile, "@user@/Benchmark/FrameBenchmark.json", nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "The json file the benchmark frame times are written to");
+
+    //! Records the main loop frame times of a benchmark run and writes them to a json report with their statistics.
+    //! Frames taking more than twice the median are counted as hitches.
+    class FrameBenchmark
+    {
+    public:
+        FrameBenchmark()
+            : m_frameCount(bg_benchmarkFrames)
+            , m_warmupFrameCount(bg_benchmarkWarmupFrames)
+        {
+            m_frameTimesMs.reserve(m_frameCount);
+        }
+
+        bool IsEnabled() const
+        {
+            return m_frameCount > 0;
+        }
+
+        //! Returns the simulation delta time of the next frame, or the provided real frame time if there is no fixed timestep.
+        float GetFrameDeltaTime(float realFrameTime) const
+        {
+            return (IsEnabled() && bg_benchmarkFixedTimestep > 0.0f) ? static_cast<float>(bg_benchmarkFixedTimestep) : realFrameTime;
+        }
+
+        void BeginFrame()
+        {
+            m_frameStart = AZStd::chrono::high_resolution_clock::now();
+        }
+
+        //! Returns true once all the benchmark frames have been recorded.
+        bool EndFrame()
+        {
+            const AZStd::chrono::duration<double, AZStd::milli> frameTime = AZStd::chrono::high_resolution_clock::now() - m_frameStart;
+            if (m_warmupFrameCount > 0)
+            {
+                --m_warmupFrameCount;
+                return false;
+            }
+
+            m_frameTimesMs.push_back(frameTime.count());
+            return m_frameTimesMs.size() >= m_frameCount;
+        }
+
+        void WriteReport() const
+        {
+            if (m_frameTimesMs.empty())
+            {
+                return;
+            }
+
+            AZStd::vector<double> sortedFrameTimesMs = m_frameTimesMs;
+            AZStd::sort(sortedFrameTimesMs.begin(), sortedFrameTimesMs.end());
+            auto percentile = [&sortedFrameTimesMs](double fraction)
+            {
+                return sortedFrameTimesMs[static_cast<size_t>(fraction * (sortedFrameTimesMs.size() - 1) + 0.5)];
+            };
+
+            double totalMs = 0.0;
+            for (double frameTimeMs : m_frameTimesMs)
+            {
+                totalMs += frameTimeMs;
+            }
+            const double medianMs = percentile(0.5);
+            const size_t hitchCount = AZStd::count_if(m_frameTimesMs.begin(), m_frameTimesMs.end(),
+                [medianMs](double frameTimeMs) { return frameTimeMs > 2.0 * medianMs; });
+
+            AZStd::string report = AZStd::string::format(
+                "{\n    \"frames\": %zu,\n    \"fixed_timestep_s\": %f,\n    \"mean_ms\": %f,\n    \"min_ms\": %f,\n"
+                "    \"p50_ms\": %f,\n    \"p95_ms\": %f,\n    \"p99_ms\": %f,\n    \"max_ms\": %f,\n    \"hitches\": %zu,\n"
+                "    \"frame_ms\": [",
+                m_frameTimesMs.size(), static_cast<float>(bg_benchmarkFixedTimestep), totalMs / m_frameTimesMs.size(),
+                sortedFrameTimesMs.front(), medianMs, percentile(0.95), percentile(0.99), sortedFrameTimesMs.back(), hitchCount);
+            for (size_t frameIndex = 0; frameIndex < m_frameTimesMs.size(); ++frameIndex)
+            {
+                report += AZStd::string::format(frameIndex == 0 ? "%.4f" : ", %.4f", m_frameTimesMs[frameIndex]);
+            }
+            report += "]\n}\n";
+
+            AZ_TracePrintf("Launcher", "Benchmark: %zu frames, mean %.3fms, p50 %.3fms, p99 %.3fms, max %.3fms, %zu hitches\n",
+                m_frameTimesMs.size(), totalMs / m_frameTimesMs.size(), medianMs, percentile(0.99), sortedFrameTimesMs.back(), hitchCount);
+
+            AZ::IO::FileIOBase* fileIO = AZ::IO::FileIOBase::GetInstance();
+            const AZ::CVarFixedString reportFile = bg_benchmarkReportFile;
+            AZ::IO::HandleType fileHandle = AZ::IO::InvalidHandle;
+            if (fileIO)
+            {
+                fileIO->CreatePath(AZ::IO::PathView(reportFile.c_str()).ParentPath().Native().data());
+                fileIO->Open(reportFile.c_str(), AZ::IO::OpenMode::ModeWrite | AZ::IO::OpenMode::ModeText, fileHandle);
+            }
+            if (fileHandle == AZ::IO::InvalidHandle)
+            {
+                AZ_Error("Launcher", false, "Failed to write the benchmark report to %s", reportFile.c_str());
+                return;
+            }
+            fileIO->Write(fileHandle, report.data(), report.size());
+            fileIO->Close(fileHandle);
+        }
+
+    private:
+        AZStd::vector<double> m_frameTimesMs;
+        AZStd::chrono::high_resolution_clock::time_point m_frameStart;
+        AZ::u32 m_frameCount = 0;
+        AZ::u32 m_warmupFrameCount = 0;
+    };
+
     void ExecuteConsoleCommandFile(AzFramework::Application& application)
     {
         const AZStd::string_view customConCmdKey = "console-command-file";
@@ -228,8 +344,14 @@ namespace
         // how many things depend on the ITimer interface).
         bool continueRunning = true;
         ISystem* system = gEnv ? gEnv->pSystem : nullptr;
+        FrameBenchmark benchmark;
         while (continueRunning)
         {
+            if (benchmark.IsEnabled())
+            {
+                benchmark.BeginFrame();
+            }
+
             // Pump the system event loop
             gameApplication.PumpSystemEventLoopUntilEmpty();
 
@@ -243,7 +365,7 @@ namespace
             }
 
             // Update the AzFramework application tick bus
-            gameApplication.Tick(gEnv->pTimer->GetFrameTime());
+            gameApplication.Tick(benchmark.GetFrameDeltaTime(gEnv->pTimer->GetFrameTime()));
 
             // Post-update CrySystem
             if (system)
@@ -253,6 +375,16 @@ namespace
 
             // Check for quit requests
             continueRunning = !gameApplication.WasExitMainLoopRequested() && continueRunning;
+
+            if (benchmark.IsEnabled() && benchmark.EndFrame())
+            {
+                continueRunning = false;
+            }
+        }
+
+        if (benchmark.IsEnabled())
+        {
+            benchmark.WriteReport();
         }
     }
 }
@@ -59,6 +59,7 @@ namespace Audio
         eAMRT_DRAW_DEBUG_INFO           = AUDIO_BIT(20),
         eAMRT_CHANGE_LANGUAGE           = AUDIO_BIT(21),
         eAMRT_SET_AUDIO_PANNING_MODE    = AUDIO_BIT(22),
+        eAMRT_PRELOAD_HINT              = AUDIO_BIT(23),
     };
 
     enum EAudioCallbackManagerRequestType : TATLEnumFlagsType
@@ -385,6 +386,26 @@ namespace Audio
         const PanningMode m_panningMode;
     };
 
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    // Hints that a preload request will be needed soon, e.g. when streaming in the level area or cell that uses it.
+    // The files are streamed in by the deadline without taking a use count, so they stay evictable until
+    // the preload request is actually loaded.
+    template<>
+    struct SAudioManagerRequestData<eAMRT_PRELOAD_HINT>
+        : public SAudioManagerRequestDataBase
+    {
+        explicit SAudioManagerRequestData(const TAudioPreloadRequestID nRequestID = INVALID_AUDIO_PRELOAD_REQUEST_ID, const float fPassedDeadlineMS = 0.0f)
+            : SAudioManagerRequestDataBase(eAMRT_PRELOAD_HINT)
+            , nPreloadRequestID(nRequestID)
+            , fDeadlineMS(fPassedDeadlineMS)
+        {}
+
+        ~SAudioManagerRequestData<eAMRT_PRELOAD_HINT>() override {}
+
+        const TAudioPreloadRequestID nPreloadRequestID;
+        const float fDeadlineMS;
+    };
+
 
     ///////////////////////////////////////////////////////////////////////////////////////////////////
     // Audio Callback Manager Requests
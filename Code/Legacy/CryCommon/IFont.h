@@ -117,12 +117,13 @@ struct ICryFont
 #define TTFFLAG_SMOOTH_NONE                 0x00000000      // No smooth.
 #define TTFFLAG_SMOOTH_BLUR                 0x00000001      // Smooth by blurring it.
 #define TTFFLAG_SMOOTH_SUPERSAMPLE  0x00000002      // Smooth by rendering the characters into a bigger texture, and then resize it to the normal size using bilinear filtering.
+#define TTFFLAG_SMOOTH_DISTANCEFIELD    0x00000003  // Render the characters into a bigger texture, and store their signed distance field so they can be drawn sharp at any size.
 
 #define TTFFLAG_SMOOTH_MASK                 0x0000000f      // Mask for retrieving.
 #define TTFFLAG_SMOOTH_SHIFT                0                           // Shift amount for retrieving.
 
-#define TTFLAG_SMOOTH_AMOUNT_2X         0x00010000      // Blur / supersample [2x]
-#define TTFLAG_SMOOTH_AMOUNT_4X         0x00020000      // Blur / supersample [4x]
+#define TTFLAG_SMOOTH_AMOUNT_2X         0x00010000      // Blur / supersample / distance field [2x]
+#define TTFLAG_SMOOTH_AMOUNT_4X         0x00020000      // Blur / supersample / distance field [4x]
 
 #define TTFFLAG_SMOOTH_AMOUNT_MASK  0x000f0000      // Mask for retrieving.
 #define TTFFLAG_SMOOTH_AMOUNT_SHIFT 16                      // Shift amount for retrieving.
@@ -1058,6 +1058,9 @@ struct IAnimSequence
     // Sequence must be activated before animating.
     virtual void Animate(const SAnimContext& ec) = 0;
 
+    //! Returns the time the last Animate() took to evaluate and apply the tracks of the sequence, in milliseconds.
+    virtual float GetLastAnimateTimeMs() const = 0;
+
     //! Set time range of this sequence.
     virtual void SetTimeRange(Range timeRange) = 0;
 
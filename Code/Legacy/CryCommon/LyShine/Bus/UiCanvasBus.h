@@ -338,6 +338,10 @@ public: // member functions
     //! cleared and rebuilt on the next render.
     virtual void MarkRenderGraphDirty() = 0;
 
+    //! Mark the render graph for the canvas as dirty because of a change to the given element. When the
+    //! render graph is rebuilt the elements that did not change reuse the render graph calls they made last time.
+    virtual void MarkRenderGraphDirtyForElement([[maybe_unused]] AZ::EntityId elementId) { MarkRenderGraphDirty(); }
+
 public: // static member data
 
     //! Only one component on an entity can implement the events
@@ -55,6 +55,14 @@ namespace LogCVars
     int max_backup_directory_size_mb = 200; //200MB default
 };
 
+namespace
+{
+    // The file writer thread writes the queued lines at least this often
+    constexpr AZStd::chrono::milliseconds s_fileWriterInterval(100);
+    // Or as soon as this many bytes are queued
+    constexpr size_t s_fileWriterBatchSize = 64 * 1024;
+}
+
 #ifndef _RELEASE
 static CLog::LogStringType indentString ("    ");
 #endif
@@ -68,6 +76,7 @@ CLog::CLog(ISystem* pSystem)
     m_pSystem = pSystem;
     m_pLogVerbosity = 0;
     m_pLogWriteToFile = 0;
+    m_pLogWriteToFileAsync = 0;
     m_pLogWriteToFileVerbosity = 0;
     m_pLogVerbosityOverridesWriteToFile = 0;
     m_pLogIncludeTime = 0;
@@ -122,6 +131,9 @@ void CLog::RegisterConsoleVariables()
 
         //writing to game.log during game play causes stalls on consoles
         m_pLogWriteToFile = REGISTER_INT("log_WriteToFile", 1, VF_DUMPTODISK, "toggle whether to write log to file (game.log)");
+        m_pLogWriteToFileAsync = REGISTER_INT("log_WriteToFileAsync", 1, VF_DUMPTODISK,
+                "toggle whether log lines are written to file in batches by a background thread.\n"
+                "The queued lines are flushed when the log file is closed or the crash handler runs.");
 
         m_pLogWriteToFileVerbosity = REGISTER_INT("log_WriteToFileVerbosity", DEFAULT_VERBOSITY, VF_DUMPTODISK,
                 "defines the verbosity level for log messages written to files\n"
@@ -172,6 +184,8 @@ CLog::~CLog()
     assert (m_indentation == 0);
 #endif
 
+    StopFileWriter();
+
     CreateBackupFile();
 
     UnregisterConsoleVariables();
@@ -183,6 +197,7 @@ void CLog::UnregisterConsoleVariables()
 {
     m_pLogVerbosity = 0;
     m_pLogWriteToFile = 0;
+    m_pLogWriteToFileAsync = 0;
     m_pLogWriteToFileVerbosity = 0;
     m_pLogVerbosityOverridesWriteToFile = 0;
     m_pLogIncludeTime = 0;
@@ -192,9 +207,124 @@ void CLog::UnregisterConsoleVariables()
 //////////////////////////////////////////////////////////////////////////
 void CLog::CloseLogFile()
 {
+    AZStd::scoped_lock fileLock(m_logFileMutex);
+    WriteQueuedFileWrites();
     m_logFileHandle.Close();
 }
 
+//////////////////////////////////////////////////////////////////////////
+void CLog::QueueFileWrite(const LogStringType& line, bool bAdd)
+{
+    const bool writeAsync = m_pLogWriteToFileAsync ? m_pLogWriteToFileAsync->GetIVal() != 0 : true;
+    if (bAdd || !writeAsync)
+    {
+        // Adding to the prior line rewrites the end of the file, so everything queued before it goes first
+        AZStd::scoped_lock fileLock(m_logFileMutex);
+        WriteQueuedFileWrites();
+        if (bAdd)
+        {
+            // if adding to a prior line erase the \n at the end.
+            m_logFileHandle.Seek(-2, AZ::IO::SystemFile::SeekMode::SF_SEEK_END);
+        }
+        m_logFileHandle.Write(line.c_str(), line.size());
+        return;
+    }
+
+    bool wakeFileWriter = false;
+    {
+        AZStd::scoped_lock lock(m_queuedFileWritesMutex);
+        m_queuedFileWrites.append(line.c_str(), line.size());
+        wakeFileWriter = m_queuedFileWrites.size() >= s_fileWriterBatchSize;
+    }
+
+    if (!m_fileWriterThread.joinable())
+    {
+        StartFileWriter();
+    }
+    else if (wakeFileWriter)
+    {
+        m_fileWriterWakeUp.notify_one();
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CLog::FlushFileWrites()
+{
+    AZStd::scoped_lock fileLock(m_logFileMutex);
+    WriteQueuedFileWrites();
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CLog::WriteQueuedFileWrites()
+{
+    {
+        AZStd::scoped_lock lock(m_queuedFileWritesMutex);
+        m_fileWriteBatch.swap(m_queuedFileWrites);
+    }
+
+    if (!m_fileWriteBatch.empty())
+    {
+        if (m_logFileHandle.IsOpen())
+        {
+            m_logFileHandle.Write(m_fileWriteBatch.data(), m_fileWriteBatch.size());
+        }
+        m_fileWriteBatch.clear();
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CLog::StartFileWriter()
+{
+    {
+        AZStd::scoped_lock lock(m_queuedFileWritesMutex);
+        m_stopFileWriter = false;
+    }
+    m_fileWriterThreadDesc.m_name = "Log File Writer";
+    m_fileWriterThread = AZStd::thread([this]()
+        {
+            FileWriterThread();
+        }, &m_fileWriterThreadDesc);
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CLog::StopFileWriter()
+{
+    if (m_fileWriterThread.joinable())
+    {
+        {
+            AZStd::scoped_lock lock(m_queuedFileWritesMutex);
+            m_stopFileWriter = true;
+        }
+        m_fileWriterWakeUp.notify_one();
+        m_fileWriterThread.join();
+    }
+    FlushFileWrites();
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CLog::FileWriterThread()
+{
+    for (;;)
+    {
+        {
+            AZStd::unique_lock<AZStd::mutex> lock(m_queuedFileWritesMutex);
+            m_fileWriterWakeUp.wait_for(lock, s_fileWriterInterval, [this]()
+                {
+                    return m_stopFileWriter || m_queuedFileWrites.size() >= s_fileWriterBatchSize;
+                });
+            if (m_stopFileWriter)
+            {
+                return;
+            }
+            if (m_queuedFileWrites.empty())
+            {
+                continue;
+            }
+        }
+        FlushFileWrites();
+    }
+}
+
 //////////////////////////////////////////////////////////////////////////
 bool CLog::OpenLogFile(const char* filename, int mode)
 {
@@ -216,6 +346,7 @@ bool CLog::OpenLogFile(const char* filename, int mode)
     if (AZ::IO::FixedMaxPath logFilePath; fileSystem->ReplaceAlias(logFilePath, filename))
     {
         logFilePath = logFilePath.LexicallyNormal();
+        AZStd::scoped_lock fileLock(m_logFileMutex);
         m_logFileHandle.Open(logFilePath.c_str(), mode);
     }
 
@@ -1101,12 +1232,7 @@ void CLog::LogStringToFile(const char* szString, ELogType logType, bool bAdd, [[
                 m_bFirstLine = false;
             }
 #endif
-            if (bAdd)
-            {
-                // if adding to a prior line erase the \n at the end.
-                m_logFileHandle.Seek(-2, AZ::IO::SystemFile::SeekMode::SF_SEEK_END);
-            }
-            m_logFileHandle.Write(tempString.c_str(), tempString.size());
+            QueueFileWrite(tempString, bAdd);
 #if !defined(KEEP_LOG_FILE_OPEN)
             CloseLogFile();
 #endif
@@ -1353,6 +1479,9 @@ bool CLog::SetFileName(const char* fileNameOrAbsolutePath, bool backupLogs)
     {
         return false;
     }
+    // The queued lines belong to the previous log file
+    FlushFileWrites();
+
     azstrncpy(m_szFilename, AZ_ARRAY_SIZE(m_szFilename), fileNameOrAbsolutePath, sizeof(m_szFilename));
 
     CreateBackupFile();
@@ -1370,6 +1499,7 @@ bool CLog::SetFileName(const char* fileNameOrAbsolutePath, bool backupLogs)
             | AZ::IO::SystemFile::OpenMode::SF_OPEN_WRITE_ONLY;
         if(AZ::IO::SystemFile newLogFile; newLogFile.Open(m_szFilename, openMode))
         {
+            AZStd::scoped_lock fileLock(m_logFileMutex);
             m_logFileHandle = AZStd::move(newLogFile);
         }
     }
@@ -13,6 +13,11 @@
 #include <MultiThread.h>
 #include <MultiThread_Containers.h>
 
+#include <AzCore/std/parallel/condition_variable.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/string/string.h>
+
 //////////////////////////////////////////////////////////////////////
 #if defined(ANDROID) || defined(AZ_PLATFORM_MAC)
     #define MAX_TEMP_LENGTH_SIZE    4098
@@ -135,6 +140,17 @@ private: // -------------------------------------------------------------------
     bool OpenLogFile(const char* filename, int mode);
     void CloseLogFile();
 
+    //! Hands a line to the file writer thread, lines are written to the log file in batches.
+    //! Must be called from the main thread.
+    void QueueFileWrite(const LogStringType& line, bool bAdd);
+    //! Writes the queued lines to the log file from the calling thread.
+    void FlushFileWrites();
+    //! Writes the queued lines to the log file, m_logFileMutex must be held.
+    void WriteQueuedFileWrites();
+    void StartFileWriter();
+    void StopFileWriter();
+    void FileWriterThread();
+
     // will format the message into m_szTemp
     void FormatMessage(const char* szCommand, ...) PRINTF_PARAMS(2, 3);
 
@@ -152,6 +168,18 @@ private: // -------------------------------------------------------------------
     char m_szFilename[MAX_FILENAME_SIZE];            // can be with path
     mutable char m_sBackupFilename[MAX_FILENAME_SIZE];   // can be with path
     AZ::IO::SystemFile m_logFileHandle;
+    //! Held while the log file is opened, closed, written to or seeked
+    AZStd::mutex m_logFileMutex;
+
+    //! Lines waiting for the file writer thread
+    AZStd::string m_queuedFileWrites;
+    AZStd::mutex m_queuedFileWritesMutex;
+    //! The batch being written, swapped with m_queuedFileWrites to keep both allocations around
+    AZStd::string m_fileWriteBatch;
+    AZStd::condition_variable m_fileWriterWakeUp;
+    AZStd::thread_desc m_fileWriterThreadDesc;
+    AZStd::thread m_fileWriterThread;
+    bool m_stopFileWriter = false;
 
     bool m_backupLogs;
 
@@ -216,6 +244,7 @@ public: // -------------------------------------------------------------------
 
     ICVar*                 m_pLogVerbosity;                                             //
     ICVar*                 m_pLogWriteToFile;                                       //
+    ICVar*                 m_pLogWriteToFileAsync;                                  //
     ICVar*                 m_pLogWriteToFileVerbosity;                      //
     ICVar*                 m_pLogVerbosityOverridesWriteToFile;     //
     ICVar*                 m_pLogSpamDelay;                       //
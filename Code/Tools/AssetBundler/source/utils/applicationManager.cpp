@@ -15,6 +15,7 @@
 #include <AzCore/Memory/MemoryComponent.h>
 #include <AzCore/Module/DynamicModuleHandle.h>
 #include <AzCore/Module/ModuleManagerBus.h>
+#include <AzCore/Serialization/Utils.h>
 #include <AzCore/Slice/SliceSystemComponent.h>
 #include <AzCore/std/string/conversions.h>
 #include <AzCore/StringFunc/StringFunc.h>
@@ -340,6 +341,7 @@ namespace AssetBundler
             OutputBundlePathArg,
             BundleVersionArg,
             MaxBundleSizeArg,
+            AccessTraceFileArg,
             PlatformArg,
             AllowOverwritesFlag,
             VerboseFlag,
@@ -352,6 +354,7 @@ namespace AssetBundler
             OutputBundlePathArg,
             BundleVersionArg,
             MaxBundleSizeArg,
+            AccessTraceFileArg,
             PlatformArg,
             AssetCatalogFileArg,
             AllowOverwritesFlag,
@@ -1197,6 +1200,17 @@ namespace AssetBundler
             }
         }
 
+        // Read in Access Trace File arg
+        FilePath accessTraceFile;
+        if (parser->HasSwitch(AccessTraceFileArg))
+        {
+            if (parser->GetNumSwitchValues(AccessTraceFileArg) != 1)
+            {
+                return AZ::Failure(AZStd::string::format("Invalid command: \"--%s\" must have exactly one value.", AccessTraceFileArg));
+            }
+            accessTraceFile = FilePath(parser->GetSwitchValue(AccessTraceFileArg, 0));
+        }
+
         // Read in Platform arg
         auto platformOutcome = GetPlatformArg(parser);
         if (!platformOutcome.IsSuccess())
@@ -1224,6 +1238,7 @@ namespace AssetBundler
                 bundleParams.m_maxBundleSizeInMB = maxBundleListSize == 1 ? AZStd::stoi(maxBundleSizeList[0]) : AZStd::stoi(maxBundleSizeList[idx]);
             }
 
+            bundleParams.m_accessTraceFile = accessTraceFile;
             bundleParams.m_platformFlags = platformOutcome.GetValue();
             bundleParams.m_allowOverwrites = allowOverwrites;
             bundleParamsList.emplace_back(bundleParams);
@@ -2184,10 +2199,27 @@ namespace AssetBundler
             }
         }
 
+        // Load the access traces up front, they are shared by all the Bundles generated in parallel
+        AZStd::unordered_map<AZStd::string, AccessOrderMap> accessTraces;
+        for (const BundlesParams& params : paramsList)
+        {
+            const AZStd::string& accessTracePath = params.m_accessTraceFile.AbsolutePath();
+            if (!accessTracePath.empty() && accessTraces.find(accessTracePath) == accessTraces.end())
+            {
+                auto loadTraceOutcome = LoadAccessTrace(accessTracePath);
+                if (!loadTraceOutcome.IsSuccess())
+                {
+                    AZ_Error(AssetBundler::AppWindowName, false, loadTraceOutcome.GetError().c_str());
+                    return false;
+                }
+                accessTraces.emplace(accessTracePath, loadTraceOutcome.TakeValue());
+            }
+        }
+
         AZStd::atomic_uint failureCount = 0;
 
         // Create all Bundles
-        AZ::parallel_for_each(allBundleSettings.begin(), allBundleSettings.end(), [this, &failureCount](AZStd::pair<AzToolsFramework::AssetBundleSettings, BundlesParams> bundleSettings)
+        AZ::parallel_for_each(allBundleSettings.begin(), allBundleSettings.end(), [this, &failureCount, &accessTraces](AZStd::pair<AzToolsFramework::AssetBundleSettings, BundlesParams> bundleSettings)
             {
                 BundlesParams params = bundleSettings.second;
                 auto overrideOutcome = ApplyBundleSettingsOverrides(
@@ -2217,7 +2249,25 @@ namespace AssetBundler
 
                 AZ_TracePrintf(AssetBundler::AppWindowName, "Creating Bundle ( %s )...\n", bundleFilePath.AbsolutePath().c_str());
                 bool result = false;
-                AssetBundleCommandsBus::BroadcastResult(result, &AssetBundleCommandsBus::Events::CreateAssetBundle, bundleSettings.first);
+                auto accessTraceIt = accessTraces.find(params.m_accessTraceFile.AbsolutePath());
+                if (accessTraceIt == accessTraces.end())
+                {
+                    AssetBundleCommandsBus::BroadcastResult(result, &AssetBundleCommandsBus::Events::CreateAssetBundle, bundleSettings.first);
+                }
+                else
+                {
+                    AssetFileInfoList assetFileInfoList;
+                    AZ::IO::Path assetFileInfoListPath = AZ::IO::Path(AZStd::string_view{ AZ::Utils::GetEnginePath() }) / bundleSettings.first.m_assetFileInfoListPath;
+                    if (!AZ::Utils::LoadObjectFromFileInPlace(assetFileInfoListPath.c_str(), assetFileInfoList))
+                    {
+                        AZ_Error(AssetBundler::AppWindowName, false, "Failed to load Asset List file ( %s ).", assetFileInfoListPath.c_str());
+                        failureCount.fetch_add(1, AZStd::memory_order::memory_order_relaxed);
+                        return;
+                    }
+
+                    SortAssetFileInfoListByAccessOrder(assetFileInfoList, accessTraceIt->second);
+                    AssetBundleCommandsBus::BroadcastResult(result, &AssetBundleCommandsBus::Events::CreateAssetBundleFromList, bundleSettings.first, assetFileInfoList);
+                }
                 if (!result)
                 {
                     AZ_Error(AssetBundler::AppWindowName, false, "Unable to create bundle, target Bundle file path is ( %s ).", bundleFilePath.AbsolutePath().c_str());
@@ -2242,6 +2292,18 @@ namespace AssetBundler
 
         BundleSeedParams params = paramsOutcome.GetValue();
 
+        AccessOrderMap accessOrder;
+        if (!params.m_bundleParams.m_accessTraceFile.AbsolutePath().empty())
+        {
+            auto loadTraceOutcome = LoadAccessTrace(params.m_bundleParams.m_accessTraceFile.AbsolutePath());
+            if (!loadTraceOutcome.IsSuccess())
+            {
+                AZ_Error(AssetBundler::AppWindowName, false, loadTraceOutcome.GetError().c_str());
+                return false;
+            }
+            accessOrder = loadTraceOutcome.TakeValue();
+        }
+
         // If no platform was input we want to loop over all possible platforms and make bundles for whatever we find
         if (params.m_bundleParams.m_platformFlags == AzFramework::PlatformFlags::Platform_NONE)
         {
@@ -2326,6 +2388,11 @@ namespace AssetBundler
                     assetFileInfoList.m_fileInfoList.emplace_back(assetInfo);
                 }
 
+                if (!accessOrder.empty())
+                {
+                    SortAssetFileInfoListByAccessOrder(assetFileInfoList, accessOrder);
+                }
+
                 AZ_TracePrintf(AssetBundler::AppWindowName, "Creating Bundle ( %s )...\n", bundleSettings.m_bundleFilePath.c_str());
                 bool result = false;
                 AssetBundleCommandsBus::BroadcastResult(result, &AssetBundleCommandsBus::Events::CreateAssetBundleFromList, bundleSettings, assetFileInfoList);
@@ -2838,6 +2905,8 @@ namespace AssetBundler
         AZ_Printf(AppWindowName, "    --%-25s-Determines which versions of Open 3D Engine Bundles to generate. Current version is (%i).\n", BundleVersionArg, AzFramework::AssetBundleManifest::CurrentBundleVersion);
         AZ_Printf(AppWindowName, "    --%-25s-Sets the maximum size for Bundles (in MB). Default size is (%i MB).\n", MaxBundleSizeArg, AssetBundleSettings::GetMaxBundleSizeInMB());
         AZ_Printf(AppWindowName, "%-31s---Bundles larger than this limit will be divided into a series of smaller Bundles and named accordingly.\n", "");
+        AZ_Printf(AppWindowName, "    --%-25s-Orders the assets in the Bundles by their first access in a recorded runtime file access trace.\n", AccessTraceFileArg);
+        AZ_Printf(AppWindowName, "%-31s---Assets read together end up next to each other in the same Bundle. Expects one file path per line, in read order.\n", "");
         AZ_Printf(AppWindowName, "    --%-25s-Specifies the platform(s) that will be referenced when generating Bundles.\n", PlatformArg);
         AZ_Printf(AppWindowName, "%-31s---If no platforms are specified, Bundles will be generated for all available platforms.\n", "");
         AZ_Printf(AppWindowName, "    --%-25s-Allow destructive overwrites of files. Include this arg in automation.\n", AllowOverwritesFlag);
@@ -2855,6 +2924,8 @@ namespace AssetBundler
         AZ_Printf(AppWindowName, "    --%-25s-Determines which version of Open 3D Engine Bundles to generate. Current version is (%i).\n", BundleVersionArg, AzFramework::AssetBundleManifest::CurrentBundleVersion);
         AZ_Printf(AppWindowName, "    --%-25s-Sets the maximum size for a single Bundle (in MB). Default size is (%i MB).\n", MaxBundleSizeArg, AssetBundleSettings::GetMaxBundleSizeInMB());
         AZ_Printf(AppWindowName, "%-31s---Bundles larger than this limit will be divided into a series of smaller Bundles and named accordingly.\n", "");
+        AZ_Printf(AppWindowName, "    --%-25s-Orders the assets in the Bundles by their first access in a recorded runtime file access trace.\n", AccessTraceFileArg);
+        AZ_Printf(AppWindowName, "%-31s---Assets read together end up next to each other in the same Bundle. Expects one file path per line, in read order.\n", "");
         AZ_Printf(AppWindowName, "    --%-25s-Specifies the platform(s) that will be referenced when generating Bundles.\n", PlatformArg);
         AZ_Printf(AppWindowName, "%-31s---If no platforms are specified, Bundles will be generated for all available platforms.\n", "");
         AZ_Printf(AppWindowName, "    --%-25s-Allow destructive overwrites of files. Include this arg in automation.\n", AllowOverwritesFlag);
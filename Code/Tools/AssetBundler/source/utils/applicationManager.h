@@ -140,6 +140,9 @@ namespace AssetBundler
         int m_bundleVersion = -1;
         int m_maxBundleSizeInMB = -1;
 
+        // Optional runtime access trace used to order the assets in the Bundles
+        FilePath m_accessTraceFile;
+
         AzFramework::PlatformFlags m_platformFlags = AzFramework::PlatformFlags::Platform_NONE;
 
         bool m_allowOverwrites = false;
@@ -18,6 +18,9 @@
 #include <AzCore/IO/Path/Path.h>
 #include <AzCore/Settings/SettingsRegistryMergeUtils.h>
 #include <AzCore/std/algorithm.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/sort.h>
+#include <AzCore/std/string/conversions.h>
 #include <AzCore/std/string/regex.h>
 #include <AzCore/Utils/Utils.h>
 #include <cctype>
@@ -98,6 +101,7 @@ namespace AssetBundler
 
     // Bundles
     const char* BundlesCommand = "bundles";
+    const char* AccessTraceFileArg = "accessTraceFile";
 
     // Bundle Seed
     const char* BundleSeedCommand = "bundleSeed";
@@ -790,6 +794,86 @@ namespace AssetBundler
         return false;
     }
 
+    AZ::Outcome<AccessOrderMap, AZStd::string> LoadAccessTrace(const AZStd::string& absoluteFilePath)
+    {
+        // Traces of a full play session can be much larger than the usual text files
+        constexpr size_t MaxAccessTraceFileSize = 512 * 1024 * 1024;
+        auto readOutcome = AZ::Utils::ReadFile(absoluteFilePath, MaxAccessTraceFileSize);
+        if (!readOutcome.IsSuccess())
+        {
+            return AZ::Failure(AZStd::string::format("Unable to read access trace file ( %s ): %s", absoluteFilePath.c_str(), readOutcome.GetError().c_str()));
+        }
+
+        AccessOrderMap accessOrder;
+        AZStd::vector<AZStd::string> lines;
+        AzFramework::StringFunc::Tokenize(readOutcome.GetValue(), lines, "\r\n");
+        for (const AZStd::string& line : lines)
+        {
+            AZStd::string_view path = AzFramework::StringFunc::StripEnds(line, " \t");
+            if (path.empty() || path.starts_with('#'))
+            {
+                continue;
+            }
+
+            // Only the first access matters, the file is already in the bundle by the time it is read again
+            accessOrder.emplace(NormalizeAccessTracePath(path), accessOrder.size());
+        }
+
+        if (accessOrder.empty())
+        {
+            return AZ::Failure(AZStd::string::format("Access trace file ( %s ) does not contain any file.", absoluteFilePath.c_str()));
+        }
+
+        return AZ::Success(AZStd::move(accessOrder));
+    }
+
+    AZStd::string NormalizeAccessTracePath(AZStd::string_view filePath)
+    {
+        AZStd::string normalizedPath(filePath);
+        AZStd::replace(normalizedPath.begin(), normalizedPath.end(), AZ_WRONG_DATABASE_SEPARATOR, AZ_CORRECT_DATABASE_SEPARATOR);
+        AZStd::to_lower(normalizedPath.begin(), normalizedPath.end());
+
+        // Remove the file alias, the Asset List paths are relative to the product cache
+        if (normalizedPath.starts_with('@'))
+        {
+            size_t aliasEnd = normalizedPath.find('@', 1);
+            normalizedPath.erase(0, aliasEnd == AZStd::string::npos ? normalizedPath.size() : aliasEnd + 1);
+        }
+
+        while (normalizedPath.starts_with('/') || normalizedPath.starts_with("./"))
+        {
+            normalizedPath.erase(0, normalizedPath.starts_with('/') ? 1 : 2);
+        }
+        return normalizedPath;
+    }
+
+    void SortAssetFileInfoListByAccessOrder(AzToolsFramework::AssetFileInfoList& assetFileInfoList, const AccessOrderMap& accessOrder)
+    {
+        using AccessSortEntry = AZStd::pair<size_t, AzToolsFramework::AssetFileInfo*>;
+        constexpr size_t NotAccessed = AZStd::numeric_limits<size_t>::max();
+
+        AZStd::vector<AccessSortEntry> sortEntries;
+        sortEntries.reserve(assetFileInfoList.m_fileInfoList.size());
+        for (AzToolsFramework::AssetFileInfo& assetFileInfo : assetFileInfoList.m_fileInfoList)
+        {
+            auto accessIt = accessOrder.find(NormalizeAccessTracePath(assetFileInfo.m_assetRelativePath));
+            sortEntries.emplace_back(accessIt != accessOrder.end() ? accessIt->second : NotAccessed, &assetFileInfo);
+        }
+
+        AZStd::stable_sort(sortEntries.begin(), sortEntries.end(), [](const AccessSortEntry& lhs, const AccessSortEntry& rhs)
+            {
+                return lhs.first < rhs.first;
+            });
+
+        AZStd::vector<AzToolsFramework::AssetFileInfo> sortedFileInfoList;
+        sortedFileInfoList.reserve(sortEntries.size());
+        for (const AccessSortEntry& sortEntry : sortEntries)
+        {
+            sortedFileInfoList.emplace_back(AZStd::move(*sortEntry.second));
+        }
+        assetFileInfoList.m_fileInfoList = AZStd::move(sortedFileInfoList);
+    }
+
     QJsonObject ReadJson(const AZStd::string& filePath)
     {
         QByteArray byteArray;
@@ -11,8 +11,10 @@
 #include <AzCore/Debug/TraceMessageBus.h>
 #include <AzCore/IO/Path/Path.h>
 #include <AzCore/Outcome/Outcome.h>
+#include <AzCore/std/containers/unordered_map.h>
 #include <AzFramework/Platform/PlatformDefaults.h>
 #include <AzToolsFramework/Asset/AssetBundler.h>
+#include <AzToolsFramework/Asset/AssetSeedManager.h>
 #include <AzToolsFramework/Asset/AssetUtils.h>
 #include <QDir>
 #include <QStringList>
@@ -109,6 +111,7 @@ namespace AssetBundler
     ////////////////////////////////////////////////////////////////////////////////////////////
     // Bundles
     extern const char* BundlesCommand;
+    extern const char* AccessTraceFileArg;
     ////////////////////////////////////////////////////////////////////////////////////////////
 
     ////////////////////////////////////////////////////////////////////////////////////////////
@@ -223,6 +226,23 @@ namespace AssetBundler
         AZStd::string_view assetRoot,
         AZStd::string_view projectPath);
 
+    //! Map from normalized asset relative path to the position of its first access in a runtime access trace.
+    using AccessOrderMap = AZStd::unordered_map<AZStd::string, size_t>;
+
+    //! Loads a recorded runtime file access trace, such as the resource list written by the Archive or a Streamer read log.
+    //! The trace is a text file with one file path per line in the order the files were read. Paths may be relative to the
+    //! product cache or start with a file alias (ex: @products@/), empty lines and lines starting with '#' are ignored.
+    //! Returns the first access position of every file on success, error message on failure.
+    AZ::Outcome<AccessOrderMap, AZStd::string> LoadAccessTrace(const AZStd::string& absoluteFilePath);
+
+    //! Normalizes a path found in an access trace or an Asset List so both can be matched against each other.
+    AZStd::string NormalizeAccessTracePath(AZStd::string_view filePath);
+
+    //! Reorders the assets by their first access in the trace, assets missing from the trace are moved to the end in their original order.
+    //! Bundles are filled sequentially from the Asset List, so this both orders the entries within a bundle by access time and
+    //! groups assets that are read together into the same bundle, which keeps the reads of a load sequential on disk.
+    void SortAssetFileInfoListByAccessOrder(AzToolsFramework::AssetFileInfoList& assetFileInfoList, const AccessOrderMap& accessOrder);
+
     QJsonObject ReadJson(const AZStd::string& filePath);
     void SaveJson(const AZStd::string& filePath, const QJsonObject& jsonObject);
 
@@ -10,6 +10,7 @@
 #include <AzCore/Settings/SettingsRegistryImpl.h>
 #include <AzCore/Settings/SettingsRegistryMergeUtils.h>
 #include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/Utils/Utils.h>
 #include <Utils/Utils.h>
 #include <AzFramework/IO/LocalFileIO.h>
 
@@ -155,4 +156,48 @@ namespace AssetBundler
         EXPECT_FALSE(LooksLikeWildcardPattern("test"));
         EXPECT_FALSE(LooksLikeWildcardPattern("test/path.xml"));
     }
+
+    TEST_F(MockUtilsTest, LoadAccessTrace_ValidTrace_FirstAccessOrderIsKept)
+    {
+        AZStd::string traceFilePath = AZStd::string::format("%s/trace.txt", m_tempDir->GetDirectory());
+        EXPECT_TRUE(AZ::Utils::WriteFile("# comment\n@products@/Textures/A.dds\n\nlevels\\b.spawnable\r\n./textures/a.dds\nc.xml\n", traceFilePath).IsSuccess());
+
+        auto loadOutcome = LoadAccessTrace(traceFilePath);
+        ASSERT_TRUE(loadOutcome.IsSuccess());
+        const AccessOrderMap& accessOrder = loadOutcome.GetValue();
+        ASSERT_EQ(accessOrder.size(), 3);
+        EXPECT_EQ(accessOrder.at("textures/a.dds"), 0);
+        EXPECT_EQ(accessOrder.at("levels/b.spawnable"), 1);
+        EXPECT_EQ(accessOrder.at("c.xml"), 2);
+    }
+
+    TEST_F(MockUtilsTest, LoadAccessTrace_EmptyTrace_Fails)
+    {
+        AZStd::string traceFilePath = AZStd::string::format("%s/trace.txt", m_tempDir->GetDirectory());
+        EXPECT_TRUE(AZ::Utils::WriteFile("# nothing was read\n\n", traceFilePath).IsSuccess());
+
+        EXPECT_FALSE(LoadAccessTrace(traceFilePath).IsSuccess());
+    }
+
+    TEST_F(MockUtilsTest, SortAssetFileInfoListByAccessOrder_UnaccessedAssetsLast_ExpectAccessOrder)
+    {
+        AzToolsFramework::AssetFileInfoList assetFileInfoList;
+        for (const char* assetPath : { "unused1.xml", "Levels/b.spawnable", "unused2.xml", "textures/a.dds" })
+        {
+            AzToolsFramework::AssetFileInfo assetFileInfo;
+            assetFileInfo.m_assetRelativePath = assetPath;
+            assetFileInfoList.m_fileInfoList.emplace_back(assetFileInfo);
+        }
+
+        AccessOrderMap accessOrder;
+        accessOrder.emplace("textures/a.dds", 0);
+        accessOrder.emplace("levels/b.spawnable", 1);
+        SortAssetFileInfoListByAccessOrder(assetFileInfoList, accessOrder);
+
+        ASSERT_EQ(assetFileInfoList.m_fileInfoList.size(), 4);
+        EXPECT_STREQ(assetFileInfoList.m_fileInfoList[0].m_assetRelativePath.c_str(), "textures/a.dds");
+        EXPECT_STREQ(assetFileInfoList.m_fileInfoList[1].m_assetRelativePath.c_str(), "Levels/b.spawnable");
+        EXPECT_STREQ(assetFileInfoList.m_fileInfoList[2].m_assetRelativePath.c_str(), "unused1.xml");
+        EXPECT_STREQ(assetFileInfoList.m_fileInfoList[3].m_assetRelativePath.c_str(), "unused2.xml");
+    }
 }
@@ -391,6 +391,7 @@ bool AssetBuilderComponent::RunInResidentMode()
 
     AzFramework::SocketConnection::GetInstance()->AddMessageHandler(CreateJobsNetRequest::MessageType(), AZStd::bind(&AssetBuilderComponent::CreateJobsResidentHandler, this, _1, _2, _3, _4));
     AzFramework::SocketConnection::GetInstance()->AddMessageHandler(ProcessJobNetRequest::MessageType(), AZStd::bind(&AssetBuilderComponent::ProcessJobResidentHandler, this, _1, _2, _3, _4));
+    AzFramework::SocketConnection::GetInstance()->AddMessageHandler(ProcessJobBatchNetRequest::MessageType(), AZStd::bind(&AssetBuilderComponent::ProcessJobBatchResidentHandler, this, _1, _2, _3, _4));
 
     BuilderHelloRequest request;
     BuilderHelloResponse response;
@@ -641,6 +642,7 @@ bool AssetBuilderComponent::RunDebugTask(AZStd::string&& debugFile, bool runCrea
                 processRequest.m_jobDescription = jobDescriptions[i];
 
                 AssetBuilderSDK::ProcessJobResponse processResponse;
+                WarmUpBuilder(*builder);
                 ProcessJob(builder->m_processJobFunction, processRequest, processResponse);
 
                 AZStd::string responseFile;
@@ -778,6 +780,7 @@ bool AssetBuilderComponent::RunOneShotTask(const AZStd::string& task)
                 auto assetBuilderDescIt = m_assetBuilderDescMap.find(request.m_builderGuid);
                 if (assetBuilderDescIt != m_assetBuilderDescMap.end())
                 {
+                    WarmUpBuilder(*assetBuilderDescIt->second);
                     ProcessJob(assetBuilderDescIt->second->m_processJobFunction, request, response);
                 }
                 else
@@ -934,29 +937,27 @@ void AssetBuilderComponent::JobThread()
                 auto* netResponse = azrtti_cast<ProcessJobNetResponse*>(job->m_netResponse.get());
                 AZ_Assert(netRequest && netResponse, "Request or response is null");
 
-                AZ_TracePrintf("AssetBuilder", "Source = %s\n", netRequest->m_request.m_fullPath.c_str());
-                AZ_TracePrintf("AssetBuilder", "Platform = %s\n", netRequest->m_request.m_jobDescription.GetPlatformIdentifier().c_str());
+                ProcessResidentJob(netRequest->m_request, netResponse->m_response);
+                break;
+            }
+            case JobType::ProcessBatch:
+            {
+                using namespace AssetBuilderSDK;
 
-                auto assetBuilderDescIt = m_assetBuilderDescMap.find(netRequest->m_request.m_builderGuid);
-                if (assetBuilderDescIt != m_assetBuilderDescMap.end())
-                {
-                    auto* toolsCatalog = AZ::Interface<AssetProcessor::IToolsAssetCatalog>::Get();
-
-                    if (toolsCatalog)
-                    {
-                        toolsCatalog->SetActivePlatform(netRequest->m_request.m_jobDescription.GetPlatformIdentifier());
-                    }
-                    else
-                    {
-                        AZ_Warning("AssetBuilder", false, "Failed to retrieve IToolsAssetCatalog interface, cannot set current platform");
-                    }
-
-                    ProcessJob(assetBuilderDescIt->second->m_processJobFunction, netRequest->m_request, netResponse->m_response);
-                }
-                else
+                auto* netRequest = azrtti_cast<ProcessJobBatchNetRequest*>(job->m_netRequest.get());
+                auto* netResponse = azrtti_cast<ProcessJobBatchNetResponse*>(job->m_netResponse.get());
+                AZ_Assert(netRequest && netResponse, "Request or response is null");
+
+                AZ_TracePrintf("AssetBuilder", "Running processJob task for a batch of %zu jobs\n", netRequest->m_request.m_requests.size());
+
+                netResponse->m_response.m_responses.resize(netRequest->m_request.m_requests.size());
+                for (size_t jobIndex = 0; jobIndex < netRequest->m_request.m_requests.size(); ++jobIndex)
                 {
-                    AZ_Error("AssetBuilder", false, "Builder UUID [%s] does not exist in the AssetBuilderDescMap for source file %s",
-                        netRequest->m_request.m_builderGuid.ToString<AZStd::fixed_string<64>>().c_str(), netRequest->m_request.m_sourceFile.c_str());
+                    // errors of one job must not fail the next one
+                    AssetBuilderSDK::AssetBuilderTraceBus::Broadcast(&AssetBuilderSDK::AssetBuilderTraceBus::Events::ResetErrorCount);
+                    AssetBuilderSDK::AssetBuilderTraceBus::Broadcast(&AssetBuilderSDK::AssetBuilderTraceBus::Events::ResetWarningCount);
+
+                    ProcessResidentJob(netRequest->m_request.m_requests[jobIndex], netResponse->m_response.m_responses[jobIndex]);
                 }
                 break;
             }
@@ -983,6 +984,45 @@ void AssetBuilderComponent::JobThread()
     }
 }
 
+void AssetBuilderComponent::ProcessResidentJob(const AssetBuilderSDK::ProcessJobRequest& request, AssetBuilderSDK::ProcessJobResponse& outResponse)
+{
+    AZ_TracePrintf("AssetBuilder", "Source = %s\n", request.m_fullPath.c_str());
+    AZ_TracePrintf("AssetBuilder", "Platform = %s\n", request.m_jobDescription.GetPlatformIdentifier().c_str());
+
+    auto assetBuilderDescIt = m_assetBuilderDescMap.find(request.m_builderGuid);
+    if (assetBuilderDescIt != m_assetBuilderDescMap.end())
+    {
+        auto* toolsCatalog = AZ::Interface<AssetProcessor::IToolsAssetCatalog>::Get();
+
+        if (toolsCatalog)
+        {
+            toolsCatalog->SetActivePlatform(request.m_jobDescription.GetPlatformIdentifier());
+        }
+        else
+        {
+            AZ_Warning("AssetBuilder", false, "Failed to retrieve IToolsAssetCatalog interface, cannot set current platform");
+        }
+
+        WarmUpBuilder(*assetBuilderDescIt->second);
+        ProcessJob(assetBuilderDescIt->second->m_processJobFunction, request, outResponse);
+    }
+    else
+    {
+        AZ_Error("AssetBuilder", false, "Builder UUID [%s] does not exist in the AssetBuilderDescMap for source file %s",
+            request.m_builderGuid.ToString<AZStd::fixed_string<64>>().c_str(), request.m_sourceFile.c_str());
+    }
+}
+
+void AssetBuilderComponent::WarmUpBuilder(const AssetBuilderSDK::AssetBuilderDesc& builderDesc)
+{
+    // only the job thread runs jobs, so this needs no lock
+    if (builderDesc.m_warmUpFunction && m_warmedUpBuilders.insert(builderDesc.m_busId).second)
+    {
+        AZ_TracePrintf("AssetBuilder", "Warming up builder %s\n", builderDesc.m_name.c_str());
+        builderDesc.m_warmUpFunction();
+    }
+}
+
 void AssetBuilderComponent::CreateJobsResidentHandler(AZ::u32 /*typeId*/, AZ::u32 serial, const void* data, AZ::u32 dataLength)
 {
     using namespace AssetBuilderSDK;
@@ -997,6 +1037,13 @@ void AssetBuilderComponent::ProcessJobResidentHandler(AZ::u32 /*typeId*/, AZ::u3
     ResidentJobHandler<ProcessJobNetRequest, ProcessJobNetResponse>(serial, data, dataLength, JobType::Process);
 }
 
+void AssetBuilderComponent::ProcessJobBatchResidentHandler(AZ::u32 /*typeId*/, AZ::u32 serial, const void* data, AZ::u32 dataLength)
+{
+    using namespace AssetBuilderSDK;
+
+    ResidentJobHandler<ProcessJobBatchNetRequest, ProcessJobBatchNetResponse>(serial, data, dataLength, JobType::ProcessBatch);
+}
+
 //////////////////////////////////////////////////////////////////////////
 
 template<typename TRequest, typename TResponse>
@@ -10,6 +10,7 @@
 #include <AssetBuilderSDK/AssetBuilderBusses.h>
 #include <AssetBuilderSDK/AssetBuilderSDK.h>
 #include <AzCore/Component/Component.h>
+#include <AzCore/std/containers/unordered_set.h>
 #include <AzCore/std/parallel/binary_semaphore.h>
 #include <AzFramework/Network/SocketConnection.h>
 #include <AzToolsFramework/Application/ToolsApplication.h>
@@ -77,7 +78,8 @@ protected:
     enum class JobType
     {
         Create,
-        Process
+        Process,
+        ProcessBatch
     };
 
     //! Describes a job request that came in from the network connection
@@ -110,6 +112,7 @@ protected:
     void ResidentJobHandler(AZ::u32 serial, const void* data, AZ::u32 dataLength, JobType jobType);
     void CreateJobsResidentHandler(AZ::u32 typeId, AZ::u32 serial, const void* data, AZ::u32 dataLength);
     void ProcessJobResidentHandler(AZ::u32 typeId, AZ::u32 serial, const void* data, AZ::u32 dataLength);
+    void ProcessJobBatchResidentHandler(AZ::u32 typeId, AZ::u32 serial, const void* data, AZ::u32 dataLength);
 
     bool IsBuilderForFile(const AZStd::string& filePath, const AssetBuilderSDK::AssetBuilderDesc& builderDescription) const;
 
@@ -119,6 +122,12 @@ protected:
 
     void ProcessJob(const AssetBuilderSDK::ProcessJobFunction& job, const AssetBuilderSDK::ProcessJobRequest& request, AssetBuilderSDK::ProcessJobResponse& outResponse);
 
+    //! Looks up the builder of a process job request that came in from the network connection, warms it up if needed and runs the job
+    void ProcessResidentJob(const AssetBuilderSDK::ProcessJobRequest& request, AssetBuilderSDK::ProcessJobResponse& outResponse);
+
+    //! Calls the warm up function of the builder the first time one of its jobs runs in this process
+    void WarmUpBuilder(const AssetBuilderSDK::AssetBuilderDesc& builderDesc);
+
     //! Handles a builder registration request
     bool HandleRegisterBuilder(const AZStd::string& inputFilePath, const AZStd::string& outputFilePath) const;
 
@@ -135,6 +144,9 @@ protected:
     //! Map used to look up the asset builder to handle a request
     AZStd::unordered_map<AZ::Uuid, AZStd::unique_ptr<AssetBuilderSDK::AssetBuilderDesc>> m_assetBuilderDescMap;
 
+    //! Builders whose warm up function already ran in this process
+    AZStd::unordered_set<AZ::Uuid> m_warmedUpBuilders;
+
     //! List of loaded builders
     AZStd::vector<AZStd::unique_ptr<AssetBuilder::ExternalModuleAssetBuilderInfo>> m_assetBuilderInfoList;
 
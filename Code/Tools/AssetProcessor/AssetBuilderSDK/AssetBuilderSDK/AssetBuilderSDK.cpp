@@ -1166,6 +1166,31 @@ namespace AssetBuilderSDK
         return m_resultCode == ProcessJobResultCode::ProcessJobResult_Success;
     }
 
+    void ProcessJobBatchRequest::Reflect(AZ::ReflectContext* context)
+    {
+        if (AZ::SerializeContext* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
+        {
+            serializeContext->Class<ProcessJobBatchRequest>()->
+                Version(1)->
+                Field("Requests", &ProcessJobBatchRequest::m_requests);
+        }
+    }
+
+    void ProcessJobBatchResponse::Reflect(AZ::ReflectContext* context)
+    {
+        if (AZ::SerializeContext* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
+        {
+            serializeContext->Class<ProcessJobBatchResponse>()->
+                Version(1)->
+                Field("Responses", &ProcessJobBatchResponse::m_responses);
+        }
+    }
+
+    bool ProcessJobBatchResponse::Succeeded() const
+    {
+        return !m_responses.empty();
+    }
+
     void InitializeReflectContext(AZ::ReflectContext* context)
     {
         ProductPathDependency::Reflect(context);
@@ -1183,6 +1208,8 @@ namespace AssetBuilderSDK
         CreateJobsResponse::Reflect(context);
         ProcessJobRequest::Reflect(context);
         ProcessJobResponse::Reflect(context);
+        ProcessJobBatchRequest::Reflect(context);
+        ProcessJobBatchResponse::Reflect(context);
 
         BuilderHelloRequest::Reflect(context);
         BuilderHelloResponse::Reflect(context);
@@ -1190,6 +1217,8 @@ namespace AssetBuilderSDK
         CreateJobsNetResponse::Reflect(context);
         ProcessJobNetRequest::Reflect(context);
         ProcessJobNetResponse::Reflect(context);
+        ProcessJobBatchNetRequest::Reflect(context);
+        ProcessJobBatchNetResponse::Reflect(context);
     }
 
     void InitializeSerializationContext()
@@ -1291,14 +1320,15 @@ namespace AssetBuilderSDK
         if (AZ::SerializeContext* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
         {
             serializeContext->Class<AssetBuilderDesc>()
-                ->Version(2)
+                ->Version(3)
                 ->Field("Flags", &AssetBuilderDesc::m_flags)
                 ->Field("Name", &AssetBuilderDesc::m_name)
                 ->Field("Patterns", &AssetBuilderDesc::m_patterns)
                 ->Field("BusId", &AssetBuilderDesc::m_busId)
                 ->Field("Version", &AssetBuilderDesc::m_version)
                 ->Field("AnalysisFingerprint", &AssetBuilderDesc::m_analysisFingerprint)
-                ->Field("ProductsToKeepOnFailure", &AssetBuilderDesc::m_productsToKeepOnFailure);
+                ->Field("ProductsToKeepOnFailure", &AssetBuilderDesc::m_productsToKeepOnFailure)
+                ->Field("ProcessJobBatchSize", &AssetBuilderDesc::m_processJobBatchSize);
 
             serializeContext->RegisterGenericType<AZStd::vector<AssetBuilderDesc>>();
         }
@@ -1489,6 +1519,45 @@ namespace AssetBuilderSDK
         return ProcessJobNetRequest::MessageType();
     }
 
+    void ProcessJobBatchNetRequest::Reflect(AZ::ReflectContext* context)
+    {
+        auto serialize = azrtti_cast<AZ::SerializeContext*>(context);
+        if (serialize)
+        {
+            serialize->Class<ProcessJobBatchNetRequest>()
+                ->Version(1)
+                ->Field("Request", &ProcessJobBatchNetRequest::m_request);
+        }
+    }
+
+    unsigned int ProcessJobBatchNetRequest::MessageType()
+    {
+        static unsigned int messageType = AZ_CRC("AssetBuilderSDK::ProcessJobBatchNetRequest", 0x53809f7f);
+
+        return messageType;
+    }
+
+    unsigned int ProcessJobBatchNetRequest::GetMessageType() const
+    {
+        return MessageType();
+    }
+
+    void ProcessJobBatchNetResponse::Reflect(AZ::ReflectContext* context)
+    {
+        auto serialize = azrtti_cast<AZ::SerializeContext*>(context);
+        if (serialize)
+        {
+            serialize->Class<ProcessJobBatchNetResponse>()
+                ->Version(1)
+                ->Field("Response", &ProcessJobBatchNetResponse::m_response);
+        }
+    }
+
+    unsigned int ProcessJobBatchNetResponse::GetMessageType() const
+    {
+        return ProcessJobBatchNetRequest::MessageType();
+    }
+
     JobDependency::JobDependency(const AZStd::string& jobKey, const AZStd::string& platformIdentifier, const JobDependencyType& type, const SourceFileDependency& sourceFile)
         : m_jobKey(jobKey)
         , m_platformIdentifier(platformIdentifier)
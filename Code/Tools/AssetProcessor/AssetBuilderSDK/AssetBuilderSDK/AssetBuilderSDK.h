@@ -165,6 +165,9 @@ namespace AssetBuilderSDK
     //! Callback function type for processing jobs from process job requests
     typedef AZStd::function<void(const ProcessJobRequest& request, ProcessJobResponse& response)> ProcessJobFunction;
 
+    //! Callback function type for initializing the state a builder keeps warm for all the jobs of a builder process
+    typedef AZStd::function<void()> WarmUpFunction;
+
     //! Structure defining the type of pattern to use to apply
     struct AssetBuilderPattern
     {
@@ -261,6 +264,16 @@ namespace AssetBuilderSDK
         //! The builder type.  We set this to External by default, as that is the typical set up for custom builders (builders in gems and legacy dll builders).
         AssetBuilderType m_builderType = AssetBuilderType::External;
 
+        //! The optional warm up function callback, for external builders.  Builder processes are reused for many jobs, this is called once
+        //! per process before its first job of this builder, so that expensive state (scene SDKs, compiler toolchains, codecs) is set up
+        //! once and kept for all the following jobs rather than per job.
+        WarmUpFunction m_warmUpFunction;
+
+        //! The most jobs the asset processor sends to a builder process in a single request, for external builders.
+        //! Builders with many small jobs can raise this so that processing is not dominated by the cost of a request per job.
+        //! Jobs of a batch run one after the other in the same process, so only set this if your jobs are short.
+        AZ::u32 m_processJobBatchSize = 1;
+
         /** Analysis Fingerprint
          * you can optionally emit an analysis fingerprint, or leave this empty.  
          * The Analysis Fingerprint, used to quickly skip analysis if the source files modtime has not changed.
@@ -753,6 +766,31 @@ namespace AssetBuilderSDK
         static void Reflect(AZ::ReflectContext* context);
     };
 
+    //! ProcessJobBatchRequest holds several jobs of the same builder, sent to a builder process at once
+    struct ProcessJobBatchRequest
+    {
+        AZ_CLASS_ALLOCATOR(ProcessJobBatchRequest, AZ::SystemAllocator, 0);
+        AZ_TYPE_INFO(ProcessJobBatchRequest, "{020E005D-72D2-4413-8D1A-D321FD4F77C7}");
+
+        AZStd::vector<ProcessJobRequest> m_requests;
+
+        static void Reflect(AZ::ReflectContext* context);
+    };
+
+    //! ProcessJobBatchResponse holds the response of each job of a ProcessJobBatchRequest, in the same order
+    struct ProcessJobBatchResponse
+    {
+        AZ_CLASS_ALLOCATOR(ProcessJobBatchResponse, AZ::SystemAllocator, 0);
+        AZ_TYPE_INFO(ProcessJobBatchResponse, "{C4373F89-44AC-44E4-8738-419BF88C6091}");
+
+        AZStd::vector<ProcessJobResponse> m_responses;
+
+        //! Returns true if the batch was run. Jobs of the batch that failed report it in their own response.
+        bool Succeeded() const;
+
+        static void Reflect(AZ::ReflectContext* context);
+    };
+
     //! BuilderHelloRequest is sent by an AssetBuilder that is attempting to connect to the AssetProcessor to register itself as a worker
     class BuilderHelloRequest : public AzFramework::AssetSystem::BaseAssetProcessorMessage
     {
@@ -847,6 +885,35 @@ namespace AssetBuilderSDK
         ProcessJobResponse m_response;
     };
 
+    class ProcessJobBatchNetRequest : public AzFramework::AssetSystem::BaseAssetProcessorMessage
+    {
+    public:
+
+        AZ_CLASS_ALLOCATOR(ProcessJobBatchNetRequest, AZ::OSAllocator, 0);
+        AZ_RTTI(ProcessJobBatchNetRequest, "{6A6A96E2-B37D-4A11-871E-6E7DD5584E9C}", BaseAssetProcessorMessage);
+
+        static void Reflect(AZ::ReflectContext* context);
+        static unsigned int MessageType();
+
+        unsigned int GetMessageType() const override;
+
+        ProcessJobBatchRequest m_request;
+    };
+
+    class ProcessJobBatchNetResponse : public AzFramework::AssetSystem::BaseAssetProcessorMessage
+    {
+    public:
+
+        AZ_CLASS_ALLOCATOR(ProcessJobBatchNetResponse, AZ::OSAllocator, 0);
+        AZ_RTTI(ProcessJobBatchNetResponse, "{6F51B130-48B7-49B2-BEFC-A3A91ED2FA62}", BaseAssetProcessorMessage);
+
+        static void Reflect(AZ::ReflectContext* context);
+
+        unsigned int GetMessageType() const override;
+
+        ProcessJobBatchResponse m_response;
+    };
+
     //! JobCancelListener can be used by builders in their processJob method to listen for job cancellation request.
     //! The address of this listener is the jobid which can be found in the process job request.
     class JobCancelListener : public JobCommandBus::Handler
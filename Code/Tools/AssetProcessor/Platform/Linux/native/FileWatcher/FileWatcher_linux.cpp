@@ -1,15 +1,23 @@
 /*
  * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
- * 
+ *
  * SPDX-License-Identifier: Apache-2.0 OR MIT
  *
  */
 #include <native/FileWatcher/FileWatcher.h>
 
+#include <QDateTime>
 #include <QDirIterator>
+#include <QFileInfo>
 #include <QHash>
 #include <QMutex>
+#include <QPair>
+#include <QStringList>
 
+#include <algorithm>
+#include <chrono>
+#include <errno.h>
+#include <poll.h>
 #include <unistd.h>
 #include <sys/inotify.h>
 
@@ -19,19 +27,43 @@ static constexpr size_t s_iNotifyMaxEntries = 1024 * 16;         // Control the
 static constexpr size_t s_iNotifyEventSize = sizeof(struct inotify_event);
 static constexpr size_t s_iNotifyReadBufferSize = s_iNotifyMaxEntries * s_iNotifyEventSize;
 
+// Only completed writes are reported (IN_CLOSE_WRITE instead of IN_MODIFY), so a large file being written produces a single
+// modification instead of one per write call. Moves are watched so renames and git checkouts are seen on both sides.
+static constexpr uint32_t s_iNotifyWatchMask = IN_CREATE | IN_CLOSE_WRITE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO;
+
+static constexpr int s_eventQuietPeriodMS = 100;                 // Pending events are delivered once no new event arrived for this long
+static constexpr int s_eventMaxLatencyMS = 1000;                 // ...or at the latest this long after the first pending event
+static constexpr int s_pollFallbackIntervalMS = 2000;            // Rescan interval of folders that could not be watched by inotify
+static constexpr int s_idleWakeupMS = 250;                       // Upper bound on how long the watch thread sleeps, to notice shutdown
+
 struct FolderRootWatch::PlatformImplementation
 {
+    using Clock = std::chrono::steady_clock;
+    // Modification time and size of each file under a polled folder
+    using FolderSnapshot = QHash<QString, QPair<qint64, qint64>>;
+
     PlatformImplementation() = default;
 
     int                         m_iNotifyHandle = -1;
     QMutex                      m_handleToFolderMapLock;
     QHash<int, QString>         m_handleToFolderMap;
+    // Folders that could not be watched (usually because fs.inotify.max_user_watches was reached) are polled instead.
+    // Guarded by m_handleToFolderMapLock as well.
+    QHash<QString, FolderSnapshot> m_pollFolders;
+    bool                        m_watchLimitReported = false;
+
+    // Events that have not been delivered yet, coalesced per path. Only used by the watch thread.
+    QHash<QString, FileAction>  m_pendingEvents;
+    QStringList                 m_pendingOrder;
+    Clock::time_point           m_firstPendingEvent;
+    Clock::time_point           m_lastPendingEvent;
+    Clock::time_point           m_nextPoll;
 
     bool Initialize()
     {
         if (m_iNotifyHandle < 0)
         {
-            m_iNotifyHandle = inotify_init();
+            m_iNotifyHandle = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
         }
         return (m_iNotifyHandle >= 0);
     }
@@ -54,6 +86,7 @@ struct FolderRootWatch::PlatformImplementation
                 inotify_rm_watch(m_iNotifyHandle, watchHandle);
             }
             m_handleToFolderMap.clear();
+            m_pollFolders.clear();
             m_handleToFolderMapLock.unlock();
 
             ::close(m_iNotifyHandle);
@@ -61,53 +94,113 @@ struct FolderRootWatch::PlatformImplementation
         }
     }
 
-    void AddWatchFolder(QString folder)
+    static FolderSnapshot TakeSnapshot(const QString& folder)
     {
-        if (m_iNotifyHandle >= 0)
+        FolderSnapshot snapshot;
+        QDirIterator fileIter(folder, QDir::Files | QDir::Hidden | QDir::NoDotAndDotDot, QDirIterator::Subdirectories);
+        while (fileIter.hasNext())
+        {
+            fileIter.next();
+            QFileInfo fileInfo = fileIter.fileInfo();
+            snapshot.insert(fileInfo.absoluteFilePath(), qMakePair(fileInfo.lastModified().toMSecsSinceEpoch(), fileInfo.size()));
+        }
+        return snapshot;
+    }
+
+    //! Watches a single folder, falling back to polling it (and everything under it) if inotify refuses the watch.
+    //! Returns false if the folder is polled, in which case its sub folders must not be watched individually.
+    bool WatchSingleFolder(const QString& folder)
+    {
+        int watchHandle = inotify_add_watch(m_iNotifyHandle, folder.toUtf8().constData(), s_iNotifyWatchMask);
+        if (watchHandle < 0)
         {
-            // Clean up the path before accepting it as a watch folder
-            QString cleanPath = QDir::cleanPath(folder);
+            if (errno != ENOSPC)
+            {
+                // The folder may have been removed again already, or is not accessible; there is nothing to track
+                return true;
+            }
+
+            if (!m_watchLimitReported)
+            {
+                m_watchLimitReported = true;
+                AZ_Warning("FileWatcher", false, "The inotify watch limit was reached while watching '%s', folders past the limit will be polled "
+                    "every %d ms instead. Raise fs.inotify.max_user_watches (for example 'sysctl fs.inotify.max_user_watches=524288') "
+                    "to get immediate change notifications.", folder.toUtf8().constData(), s_pollFallbackIntervalMS);
+            }
 
-            // Add the folder to watch and track it
-            int watchHandle = inotify_add_watch(m_iNotifyHandle, 
-                                                cleanPath.toUtf8().constData(),
-                                                IN_CREATE | IN_CLOSE_WRITE | IN_DELETE | IN_DELETE_SELF | IN_MODIFY);
-            
+            FolderSnapshot snapshot = TakeSnapshot(folder);
             if (!m_handleToFolderMapLock.tryLock(s_handleToFolderMapLockTimeout))
             {
                 AZ_Error("FileWatcher", false, "Unable to obtain inotify handle lock on thread");
-                return;
+                return false;
             }
-            m_handleToFolderMap[watchHandle] = cleanPath;
+            m_pollFolders[folder] = AZStd::move(snapshot);
             m_handleToFolderMapLock.unlock();
+            return false;
+        }
+
+        if (!m_handleToFolderMapLock.tryLock(s_handleToFolderMapLockTimeout))
+        {
+            AZ_Error("FileWatcher", false, "Unable to obtain inotify handle lock on thread");
+            return true;
+        }
+        m_handleToFolderMap[watchHandle] = folder;
+        m_handleToFolderMapLock.unlock();
+        return true;
+    }
 
-            // Add all the subfolders to watch and track them
-            QDirIterator dirIter(folder, QDirIterator::Subdirectories | QDirIterator::FollowSymlinks);
+    //! Watches a folder and all of its sub folders. When reportExistingFiles is set, the files already in the tree are returned so
+    //! they can be reported as added; this is needed for folders that were created or moved in while the watch was not in place.
+    QStringList AddWatchFolder(QString folder, bool reportExistingFiles)
+    {
+        QStringList existingFiles;
+        if (m_iNotifyHandle < 0)
+        {
+            return existingFiles;
+        }
+
+        // Clean up the path before accepting it as a watch folder
+        QString cleanPath = QDir::cleanPath(folder);
 
-            while (dirIter.hasNext())
+        QStringList polledFolders;
+        if (!WatchSingleFolder(cleanPath))
+        {
+            polledFolders.append(cleanPath + QDir::separator());
+        }
+
+        // Add all the subfolders to watch and track them. Only folders take a watch, files are reported through their parent.
+        QDirIterator dirIter(cleanPath, QDir::Dirs | QDir::Hidden | QDir::NoDotAndDotDot, QDirIterator::Subdirectories | QDirIterator::FollowSymlinks);
+        while (dirIter.hasNext())
+        {
+            QString dirName = dirIter.next();
+            bool underPolledFolder = false;
+            for (const QString& polledFolder : polledFolders)
             {
-                QString dirName = dirIter.next();
-                if (dirName.endsWith("/.") || dirName.endsWith("/.."))
+                if (dirName.startsWith(polledFolder))
                 {
-                    continue;
+                    underPolledFolder = true;
+                    break;
                 }
-                
-                int watchHandle = inotify_add_watch(m_iNotifyHandle, 
-                                                    dirName.toUtf8().constData(),
-                                                    IN_CREATE | IN_CLOSE_WRITE | IN_DELETE | IN_DELETE_SELF | IN_MODIFY);
+            }
+            if (!underPolledFolder && !WatchSingleFolder(dirName))
+            {
+                polledFolders.append(dirName + QDir::separator());
+            }
+        }
 
-                if (!m_handleToFolderMapLock.tryLock(s_handleToFolderMapLockTimeout))
-                {
-                    AZ_Error("FileWatcher", false, "Unable to obtain inotify handle lock on thread");
-                    return;
-                }
-                m_handleToFolderMap[watchHandle] = dirName;
-                m_handleToFolderMapLock.unlock();
+        if (reportExistingFiles)
+        {
+            QDirIterator fileIter(cleanPath, QDir::Files | QDir::Hidden | QDir::NoDotAndDotDot, QDirIterator::Subdirectories | QDirIterator::FollowSymlinks);
+            while (fileIter.hasNext())
+            {
+                existingFiles.append(fileIter.next());
             }
         }
+        return existingFiles;
     }
 
-    void RemoveWatchFolder(int watchHandle)
+    //! Removes the watch of a folder that was moved away, along with the watches of all its sub folders.
+    void RemoveWatchFolderTree(const QString& folder)
     {
         if (m_iNotifyHandle >= 0)
         {
@@ -117,16 +210,195 @@ struct FolderRootWatch::PlatformImplementation
                 return;
             }
 
-            QHash<int, QString>::iterator handleToRemove = m_handleToFolderMap.find(watchHandle);
-            if (handleToRemove != m_handleToFolderMap.end())
+            const QString folderPrefix = folder + QDir::separator();
+            for (auto handleIter = m_handleToFolderMap.begin(); handleIter != m_handleToFolderMap.end();)
             {
-                inotify_rm_watch(m_iNotifyHandle, watchHandle);
-                m_handleToFolderMap.erase(handleToRemove);
+                if (handleIter.value() == folder || handleIter.value().startsWith(folderPrefix))
+                {
+                    inotify_rm_watch(m_iNotifyHandle, handleIter.key());
+                    handleIter = m_handleToFolderMap.erase(handleIter);
+                }
+                else
+                {
+                    ++handleIter;
+                }
+            }
+            for (auto pollIter = m_pollFolders.begin(); pollIter != m_pollFolders.end();)
+            {
+                if (pollIter.key() == folder || pollIter.key().startsWith(folderPrefix))
+                {
+                    pollIter = m_pollFolders.erase(pollIter);
+                }
+                else
+                {
+                    ++pollIter;
+                }
             }
 
             m_handleToFolderMapLock.unlock();
         }
     }
+
+    //! The kernel dropped the watch (the folder was deleted or its file system unmounted), just forget about the handle.
+    void ForgetWatchHandle(int watchHandle)
+    {
+        if (!m_handleToFolderMapLock.tryLock(s_handleToFolderMapLockTimeout))
+        {
+            AZ_Error("FileWatcher", false, "Unable to obtain inotify handle lock on thread");
+            return;
+        }
+        m_handleToFolderMap.remove(watchHandle);
+        m_handleToFolderMapLock.unlock();
+    }
+
+    bool GetWatchedFolder(int watchHandle, QString& folder)
+    {
+        if (!m_handleToFolderMapLock.tryLock(s_handleToFolderMapLockTimeout))
+        {
+            AZ_Error("FileWatcher", false, "Unable to obtain inotify handle lock on thread");
+            return false;
+        }
+        auto handleIter = m_handleToFolderMap.find(watchHandle);
+        bool found = handleIter != m_handleToFolderMap.end();
+        if (found)
+        {
+            folder = handleIter.value();
+        }
+        m_handleToFolderMapLock.unlock();
+        return found;
+    }
+
+    //! Queues an event, merging it with the event already pending for the same path. Tools such as git replace files by writing
+    //! and renaming, or delete and recreate them, which otherwise shows up as a burst of events for the same file.
+    void QueueEvent(const QString& path, FileAction action)
+    {
+        Clock::time_point now = Clock::now();
+        if (m_pendingEvents.isEmpty())
+        {
+            m_firstPendingEvent = now;
+        }
+        m_lastPendingEvent = now;
+
+        auto pendingIter = m_pendingEvents.find(path);
+        if (pendingIter == m_pendingEvents.end())
+        {
+            m_pendingEvents.insert(path, action);
+            m_pendingOrder.append(path);
+            return;
+        }
+
+        FileAction& pending = pendingIter.value();
+        if (action == FileAction::FileAction_Removed)
+        {
+            // Whatever happened before, the file is gone now. A file that was only added is still reported as removed since
+            // it may have been moved over a file that existed before.
+            pending = FileAction::FileAction_Removed;
+        }
+        else if (pending == FileAction::FileAction_Removed)
+        {
+            // Deleted and recreated, or replaced through a rename
+            pending = FileAction::FileAction_Modified;
+        }
+        // Added followed by modified stays added, and modified followed by added stays modified
+    }
+
+    bool HasPendingEvents() const
+    {
+        return !m_pendingEvents.isEmpty();
+    }
+
+    //! Returns how long the watch thread can sleep before pending events or polled folders need attention
+    int GetWaitTimeoutMS() const
+    {
+        Clock::time_point now = Clock::now();
+        auto msUntil = [&now](Clock::time_point deadline)
+        {
+            return static_cast<int>(std::chrono::duration_cast<std::chrono::milliseconds>(deadline - now).count());
+        };
+
+        int timeoutMS = s_idleWakeupMS;
+        if (!m_pendingEvents.isEmpty())
+        {
+            timeoutMS = std::min(timeoutMS, msUntil(m_lastPendingEvent + std::chrono::milliseconds(s_eventQuietPeriodMS)));
+            timeoutMS = std::min(timeoutMS, msUntil(m_firstPendingEvent + std::chrono::milliseconds(s_eventMaxLatencyMS)));
+        }
+        if (!m_pollFolders.isEmpty())
+        {
+            timeoutMS = std::min(timeoutMS, msUntil(m_nextPoll));
+        }
+        return std::max(timeoutMS, 0);
+    }
+
+    bool ShouldFlushEvents() const
+    {
+        if (m_pendingEvents.isEmpty())
+        {
+            return false;
+        }
+        Clock::time_point now = Clock::now();
+        return (now - m_lastPendingEvent >= std::chrono::milliseconds(s_eventQuietPeriodMS))
+            || (now - m_firstPendingEvent >= std::chrono::milliseconds(s_eventMaxLatencyMS));
+    }
+
+    //! Rescans the folders that are polled instead of watched, queuing the differences to their last snapshot
+    void PollFolders()
+    {
+        if (Clock::now() < m_nextPoll)
+        {
+            return;
+        }
+        m_nextPoll = Clock::now() + std::chrono::milliseconds(s_pollFallbackIntervalMS);
+
+        if (!m_handleToFolderMapLock.tryLock(s_handleToFolderMapLockTimeout))
+        {
+            AZ_Error("FileWatcher", false, "Unable to obtain inotify handle lock on thread");
+            return;
+        }
+        QStringList pollFolders = m_pollFolders.keys();
+        m_handleToFolderMapLock.unlock();
+
+        // Walk the folders without holding the lock, they may be large
+        for (const QString& folder : pollFolders)
+        {
+            FolderSnapshot snapshot = TakeSnapshot(folder);
+
+            if (!m_handleToFolderMapLock.tryLock(s_handleToFolderMapLockTimeout))
+            {
+                AZ_Error("FileWatcher", false, "Unable to obtain inotify handle lock on thread");
+                return;
+            }
+            auto pollIter = m_pollFolders.find(folder);
+            if (pollIter == m_pollFolders.end())
+            {
+                // Stopped or moved away in the meantime
+                m_handleToFolderMapLock.unlock();
+                continue;
+            }
+            FolderSnapshot previousSnapshot = AZStd::move(pollIter.value());
+            pollIter.value() = snapshot;
+            m_handleToFolderMapLock.unlock();
+
+            for (auto fileIter = snapshot.constBegin(); fileIter != snapshot.constEnd(); ++fileIter)
+            {
+                auto previousIter = previousSnapshot.constFind(fileIter.key());
+                if (previousIter == previousSnapshot.constEnd())
+                {
+                    QueueEvent(fileIter.key(), FileAction::FileAction_Added);
+                }
+                else if (previousIter.value() != fileIter.value())
+                {
+                    QueueEvent(fileIter.key(), FileAction::FileAction_Modified);
+                }
+            }
+            for (auto previousIter = previousSnapshot.constBegin(); previousIter != previousSnapshot.constEnd(); ++previousIter)
+            {
+                if (!snapshot.contains(previousIter.key()))
+                {
+                    QueueEvent(previousIter.key(), FileAction::FileAction_Removed);
+                }
+            }
+        }
+    }
 };
 
 //////////////////////////////////////////////////////////////////////////////
@@ -154,7 +426,7 @@ bool FolderRootWatch::Start()
     {
         return false;
     }
-    m_platformImpl->AddWatchFolder(m_root);
+    m_platformImpl->AddWatchFolder(m_root, false);
 
     m_shutdownThreadSignal = false;
     m_thread = std::thread([this]() { WatchFolderLoop(); });
@@ -180,55 +452,124 @@ void FolderRootWatch::WatchFolderLoop()
     char eventBuffer[s_iNotifyReadBufferSize];
     while (!m_shutdownThreadSignal)
     {
-        ssize_t bytesRead = ::read(m_platformImpl->m_iNotifyHandle, eventBuffer, s_iNotifyReadBufferSize);
-        if (bytesRead < 0)
+        struct pollfd pollHandle;
+        pollHandle.fd = m_platformImpl->m_iNotifyHandle;
+        pollHandle.events = POLLIN;
+        pollHandle.revents = 0;
+        if (pollHandle.fd < 0)
+        {
+            break;
+        }
+
+        int pollResult = ::poll(&pollHandle, 1, m_platformImpl->GetWaitTimeoutMS());
+        if (pollResult < 0 && errno != EINTR)
+        {
+            break;
+        }
+        if (pollResult > 0 && (pollHandle.revents & (POLLERR | POLLNVAL)))
         {
             // Break out of the loop when the notify handle was closed (outside of this thread)
             break;
         }
-        else if (bytesRead > 0)
+
+        if (pollResult > 0 && (pollHandle.revents & POLLIN))
         {
-            for (size_t index=0; index<bytesRead;)
+            ssize_t bytesRead = ::read(pollHandle.fd, eventBuffer, s_iNotifyReadBufferSize);
+            if (bytesRead < 0 && errno != EAGAIN && errno != EINTR)
+            {
+                break;
+            }
+
+            for (ssize_t index = 0; index < bytesRead;)
             {
                 struct inotify_event *event = ( struct inotify_event * ) &eventBuffer[ index ];
-                const char* eventName = event->name;
+                index += s_iNotifyEventSize + event->len;
+
+                if (event->mask & IN_Q_OVERFLOW)
+                {
+                    AZ_Warning("FileWatcher", false, "The inotify event queue overflowed, some file changes under '%s' were missed. "
+                        "Raise fs.inotify.max_queued_events to avoid this.", m_root.toUtf8().constData());
+                    continue;
+                }
+
+                if (event->mask & IN_IGNORED)
+                {
+                    // The watched folder itself was deleted, its handle is no longer valid
+                    m_platformImpl->ForgetWatchHandle(event->wd);
+                    continue;
+                }
 
-                if (event->mask & (IN_CREATE | IN_DELETE | IN_MODIFY | IN_MOVE ))
+                QString folder;
+                if (event->len == 0 || !m_platformImpl->GetWatchedFolder(event->wd, folder))
                 {
-                    QString pathStr = QString("%1%2%3").arg(m_platformImpl->m_handleToFolderMap[event->wd], QDir::separator(), event->name);
+                    continue;
+                }
+                QString pathStr = QString("%1%2%3").arg(folder, QDir::separator(), event->name);
 
-                    if (event->mask & (IN_CREATE | IN_MOVED_TO)) 
+                if (event->mask & (IN_CREATE | IN_MOVED_TO))
+                {
+                    if (event->mask & IN_ISDIR)
                     {
-                        if ( event->mask & IN_ISDIR ) 
+                        // New Directory, add it to the watch. Files may have been written into it before the watch was in place,
+                        // and a folder moved in arrives with all of its content.
+                        const QStringList existingFiles = m_platformImpl->AddWatchFolder(pathStr, true);
+                        for (const QString& existingFile : existingFiles)
                         {
-                            // New Directory, add it to the watch
-                            m_platformImpl->AddWatchFolder(pathStr);
-                        }
-                        else 
-                        {
-                            ProcessNewFileEvent(pathStr);
+                            m_platformImpl->QueueEvent(existingFile, FileAction::FileAction_Added);
                         }
                     }
-                    else if (event->mask & (IN_DELETE | IN_MOVED_FROM)) 
+                    else
                     {
-                        if (event->mask & IN_ISDIR) 
-                        {
-                            // Directory Deleted, remove it from the watch
-                            m_platformImpl->RemoveWatchFolder(event->wd);
-                        }
-                        else 
-                        {
-                            ProcessDeleteFileEvent(pathStr);
-                        }
+                        m_platformImpl->QueueEvent(pathStr, FileAction::FileAction_Added);
                     }
-                    else if ((event->mask & IN_MODIFY) && ((event->mask & IN_ISDIR) != IN_ISDIR))
+                }
+                else if (event->mask & (IN_DELETE | IN_MOVED_FROM))
+                {
+                    if (event->mask & IN_ISDIR)
                     {
-                        ProcessModifyFileEvent(pathStr);
+                        // In the move case no event is reported for the content of the folder, so the folder itself is
+                        // reported and its watches (which would keep reporting the old location) are removed.
+                        if (event->mask & IN_MOVED_FROM)
+                        {
+                            m_platformImpl->RemoveWatchFolderTree(pathStr);
+                        }
                     }
+                    m_platformImpl->QueueEvent(pathStr, FileAction::FileAction_Removed);
+                }
+                else if ((event->mask & IN_CLOSE_WRITE) && !(event->mask & IN_ISDIR))
+                {
+                    m_platformImpl->QueueEvent(pathStr, FileAction::FileAction_Modified);
                 }
-                index += s_iNotifyEventSize + event->len;
             }
         }
+
+        m_platformImpl->PollFolders();
+
+        if (m_platformImpl->ShouldFlushEvents() && !m_shutdownThreadSignal)
+        {
+            for (const QString& path : m_platformImpl->m_pendingOrder)
+            {
+                auto pendingIter = m_platformImpl->m_pendingEvents.find(path);
+                if (pendingIter == m_platformImpl->m_pendingEvents.end())
+                {
+                    continue;
+                }
+
+                switch (pendingIter.value())
+                {
+                case FileAction::FileAction_Added:
+                    ProcessNewFileEvent(path);
+                    break;
+                case FileAction::FileAction_Removed:
+                    ProcessDeleteFileEvent(path);
+                    break;
+                default:
+                    ProcessModifyFileEvent(path);
+                    break;
+                }
+            }
+            m_platformImpl->m_pendingEvents.clear();
+            m_platformImpl->m_pendingOrder.clear();
+        }
     }
 }
-
@@ -8,6 +8,7 @@
 
 #include "AssetDatabase.h"
 #include <AzCore/IO/SystemFile.h>
+#include <AzCore/std/algorithm.h>
 #include <AzToolsFramework/API/AssetDatabaseBus.h>
 #include <AzToolsFramework/SQLite/SQLiteQuery.h>
 #include <native/utilities/assetUtils.h>
@@ -1331,6 +1332,88 @@ namespace AssetProcessor
         }
     }
 
+    void AssetDatabaseConnection::BeginBatch()
+    {
+        if (m_batchNotificationMarks.empty())
+        {
+            ClearBatchIndex();
+        }
+        // take the write lock right away so that nothing can change underneath the in-memory index while the batch is open.
+        // nested batches become savepoints, so they can still be rolled back on their own.
+        m_databaseConnection->BeginTransaction(true);
+        m_batchNotificationMarks.push_back(m_pendingNotifications.size());
+    }
+
+    void AssetDatabaseConnection::CommitBatch()
+    {
+        AZ_Assert(!m_batchNotificationMarks.empty(), "CommitBatch called without a matching BeginBatch.");
+        if (m_batchNotificationMarks.empty())
+        {
+            return;
+        }
+
+        m_databaseConnection->CommitTransaction();
+        m_batchNotificationMarks.pop_back();
+        if (!m_batchNotificationMarks.empty())
+        {
+            return;
+        }
+
+        ClearBatchIndex();
+
+        // listeners may re-enter the database and even open a batch of their own, so swap the queue out first.
+        AZStd::vector<AZStd::function<void()>> notifications = AZStd::move(m_pendingNotifications);
+        m_pendingNotifications.clear();
+        for (const auto& notification : notifications)
+        {
+            notification();
+        }
+    }
+
+    void AssetDatabaseConnection::RollbackBatch()
+    {
+        AZ_Assert(!m_batchNotificationMarks.empty(), "RollbackBatch called without a matching BeginBatch.");
+        if (m_batchNotificationMarks.empty())
+        {
+            return;
+        }
+
+        m_databaseConnection->RollbackTransaction();
+
+        // nothing that happened in this batch reached the database, so nobody gets told about it.
+        m_pendingNotifications.resize(m_batchNotificationMarks.back());
+        m_batchNotificationMarks.pop_back();
+
+        // the index may now hold rows that were rolled back, it is cheap to rebuild.
+        ClearBatchIndex();
+    }
+
+    bool AssetDatabaseConnection::IsBatching() const
+    {
+        return !m_batchNotificationMarks.empty();
+    }
+
+    void AssetDatabaseConnection::NotifyAfterCommit(AZStd::function<void()> notification)
+    {
+        if (IsBatching())
+        {
+            m_pendingNotifications.push_back(AZStd::move(notification));
+            return;
+        }
+        notification();
+    }
+
+    void AssetDatabaseConnection::ClearBatchIndex()
+    {
+        m_batchSourcesByName.clear();
+        m_batchProductsByJobID.clear();
+    }
+
+    void AssetDatabaseConnection::RemoveFromBatchIndex(const SourceDatabaseEntry& entry)
+    {
+        m_batchSourcesByName.erase(SourceIndexKey(entry.m_scanFolderPK, entry.m_sourceName));
+    }
+
     bool AssetDatabaseConnection::GetScanFolderByScanFolderID(AZ::s64 scanfolderID, ScanFolderDatabaseEntry& entry)
     {
         bool found = false;
@@ -1467,6 +1550,8 @@ namespace AssetProcessor
 
         transaction.Commit();
 
+        ClearBatchIndex();
+
         return true;
     }
 
@@ -1553,8 +1638,20 @@ namespace AssetProcessor
 
     bool AssetDatabaseConnection::GetSourcesBySourceNameScanFolderId(QString exactSourceName, AZ::s64 scanFolderID, SourceDatabaseEntryContainer& container)
     {
+        SourceIndexKey indexKey(scanFolderID, exactSourceName.toUtf8().constData());
+        if (IsBatching())
+        {
+            auto indexed = m_batchSourcesByName.find(indexKey);
+            if (indexed != m_batchSourcesByName.end())
+            {
+                container.push_back(indexed->second);
+                return true;
+            }
+        }
+
         bool found = false;
-        bool succeeded = QuerySourceBySourceNameScanFolderID(exactSourceName.toUtf8().constData(),
+        size_t firstResult = container.size();
+        bool succeeded = QuerySourceBySourceNameScanFolderID(indexKey.second.c_str(),
             scanFolderID,
             [&](SourceDatabaseEntry& source)
         {
@@ -1563,6 +1660,11 @@ namespace AssetProcessor
             container.back() = AZStd::move(source);
             return true;  // return true to continue iterating over additional results, we are populating a container
         });
+
+        if (IsBatching() && found && succeeded && container.size() == firstResult + 1)
+        {
+            m_batchSourcesByName[indexKey] = container.back();
+        }
         return  found && succeeded;
     }
 
@@ -1663,8 +1765,16 @@ namespace AssetProcessor
             //now that its in the database get the id:
             entry.m_sourceID = m_databaseConnection->GetLastRowID();
 
-            AzToolsFramework::AssetDatabase::AssetDatabaseNotificationBus::Broadcast(
-                &AzToolsFramework::AssetDatabase::AssetDatabaseNotificationBus::Events::OnSourceFileChanged, entry);
+            if (IsBatching())
+            {
+                m_batchSourcesByName[SourceIndexKey(entry.m_scanFolderPK, entry.m_sourceName)] = entry;
+            }
+
+            NotifyAfterCommit([entry]()
+            {
+                AzToolsFramework::AssetDatabase::AssetDatabaseNotificationBus::Broadcast(
+                    &AzToolsFramework::AssetDatabase::AssetDatabaseNotificationBus::Events::OnSourceFileChanged, entry);
+            });
             return true;
         }
         else
@@ -1693,8 +1803,17 @@ namespace AssetProcessor
             bool bindResult = s_UpdateSourceQuery.BindAndStep(*m_databaseConnection, entry.m_scanFolderPK, entry.m_sourceName.c_str(), entry.m_sourceGuid, entry.m_sourceID, entry.m_analysisFingerprint.c_str());
             if (bindResult)
             {
-                AzToolsFramework::AssetDatabase::AssetDatabaseNotificationBus::Broadcast(
-                    &AzToolsFramework::AssetDatabase::AssetDatabaseNotificationBus::Events::OnSourceFileChanged, entry);
+                if (IsBatching())
+                {
+                    RemoveFromBatchIndex(existingEntry);
+                    m_batchSourcesByName[SourceIndexKey(entry.m_scanFolderPK, entry.m_sourceName)] = entry;
+                }
+
+                NotifyAfterCommit([entry]()
+                {
+                    AzToolsFramework::AssetDatabase::AssetDatabaseNotificationBus::Broadcast(
+                        &AzToolsFramework::AssetDatabase::AssetDatabaseNotificationBus::Events::OnSourceFileChanged, entry);
+                });
             }
             return bindResult;
         }
@@ -1702,6 +1821,7 @@ namespace AssetProcessor
 
     bool AssetDatabaseConnection::InvalidateSourceAnalysisFingerprints()
     {
+        m_batchSourcesByName.clear();
         return m_databaseConnection->ExecuteOneOffStatement(INVALIDATE_SOURCE_ANALYSISFINGEPRINTS);
     }
 
@@ -1717,8 +1837,14 @@ namespace AssetProcessor
 
         transaction.Commit();
 
-        AzToolsFramework::AssetDatabase::AssetDatabaseNotificationBus::Broadcast(
-            &AzToolsFramework::AssetDatabase::AssetDatabaseNotificationBus::Events::OnSourceFileRemoved, sourceID);
+        // the delete cascades to the jobs and products of the source, which the index only knows by job.
+        ClearBatchIndex();
+
+        NotifyAfterCommit([sourceID]()
+        {
+            AzToolsFramework::AssetDatabase::AssetDatabaseNotificationBus::Broadcast(
+                &AzToolsFramework::AssetDatabase::AssetDatabaseNotificationBus::Events::OnSourceFileRemoved, sourceID);
+        });
 
         return true;
     }
@@ -2016,6 +2142,8 @@ namespace AssetProcessor
 
         transaction.Commit();
 
+        m_batchProductsByJobID.erase(jobID);
+
         return true;
     }
 
@@ -2173,20 +2301,54 @@ namespace AssetProcessor
 
     bool AssetDatabaseConnection::GetProductsByJobID(AZ::s64 jobID, ProductDatabaseEntryContainer& container)
     {
-        bool found = false;
+        if (IsBatching())
+        {
+            auto indexed = m_batchProductsByJobID.find(jobID);
+            if (indexed != m_batchProductsByJobID.end())
+            {
+                container.insert(container.end(), indexed->second.begin(), indexed->second.end());
+                return !indexed->second.empty();
+            }
+        }
+
+        ProductDatabaseEntryContainer products;
         bool succeeded = QueryCombinedByJobID(jobID,
             [&](CombinedDatabaseEntry& combined)
             {
-                found = true;
-                container.push_back();
-                container.back() = AZStd::move(combined);
+                products.push_back();
+                products.back() = AZStd::move(combined);
                 return true; // continue fetching more results.
             });
+
+        bool found = !products.empty();
+        container.insert(container.end(), products.begin(), products.end());
+        if (IsBatching() && succeeded)
+        {
+            // an empty list is cached too, a job with no products is just as likely to be looked up again.
+            m_batchProductsByJobID[jobID] = AZStd::move(products);
+        }
         return found && succeeded;
     }
 
     bool AssetDatabaseConnection::GetProductByJobIDSubId(AZ::s64 jobID, AZ::u32 subID, AzToolsFramework::AssetDatabase::ProductDatabaseEntry& result)
     {
+        if (IsBatching())
+        {
+            // the index holds every product of a job it knows about, so a miss there is a miss in the database as well.
+            auto indexed = m_batchProductsByJobID.find(jobID);
+            if (indexed != m_batchProductsByJobID.end())
+            {
+                auto product = AZStd::find_if(indexed->second.begin(), indexed->second.end(),
+                    [subID](const ProductDatabaseEntry& candidate) { return candidate.m_subID == subID; });
+                if (product == indexed->second.end())
+                {
+                    return false;
+                }
+                result = *product;
+                return true;
+            }
+        }
+
         bool found = false;
         QueryProductByJobIDSubID(jobID, subID, 
             [&](ProductDatabaseEntry& resultFromDB)
@@ -2290,8 +2452,35 @@ namespace AssetProcessor
                 entry.m_productID = m_databaseConnection->GetLastRowID();
             }
 
-            AzToolsFramework::AssetDatabase::AssetDatabaseNotificationBus::Broadcast(
-                &AzToolsFramework::AssetDatabase::AssetDatabaseNotificationBus::Events::OnProductFileChanged, entry);
+            if (IsBatching())
+            {
+                if (wasAlreadyInDatabase && existingProductInDatabase.m_jobPK != entry.m_jobPK)
+                {
+                    m_batchProductsByJobID.erase(existingProductInDatabase.m_jobPK);
+                }
+
+                auto indexed = m_batchProductsByJobID.find(entry.m_jobPK);
+                if (indexed != m_batchProductsByJobID.end())
+                {
+                    AZ::s64 productID = entry.m_productID;
+                    auto product = AZStd::find_if(indexed->second.begin(), indexed->second.end(),
+                        [productID](const ProductDatabaseEntry& candidate) { return candidate.m_productID == productID; });
+                    if (product != indexed->second.end())
+                    {
+                        *product = entry;
+                    }
+                    else
+                    {
+                        indexed->second.push_back(entry);
+                    }
+                }
+            }
+
+            NotifyAfterCommit([entry]()
+            {
+                AzToolsFramework::AssetDatabase::AssetDatabaseNotificationBus::Broadcast(
+                    &AzToolsFramework::AssetDatabase::AssetDatabaseNotificationBus::Events::OnProductFileChanged, entry);
+            });
         }
         return true;
     }
@@ -2327,8 +2516,17 @@ namespace AssetProcessor
 
         if (wasEffective)
         {
-            AzToolsFramework::AssetDatabase::AssetDatabaseNotificationBus::Broadcast(
-                &AzToolsFramework::AssetDatabase::AssetDatabaseNotificationBus::Events::OnProductFileRemoved, productID);
+            for (auto& indexed : m_batchProductsByJobID)
+            {
+                indexed.second.erase(AZStd::remove_if(indexed.second.begin(), indexed.second.end(),
+                    [productID](const ProductDatabaseEntry& candidate) { return candidate.m_productID == productID; }), indexed.second.end());
+            }
+
+            NotifyAfterCommit([productID]()
+            {
+                AzToolsFramework::AssetDatabase::AssetDatabaseNotificationBus::Broadcast(
+                    &AzToolsFramework::AssetDatabase::AssetDatabaseNotificationBus::Events::OnProductFileRemoved, productID);
+            });
         }
         return wasEffective;
     }
@@ -2369,10 +2567,18 @@ namespace AssetProcessor
 
         transaction.Commit();
 
+        if (IsBatching())
+        {
+            m_batchProductsByJobID[jobID].clear();
+        }
+
         if (wasEffective)
         {
-            AzToolsFramework::AssetDatabase::AssetDatabaseNotificationBus::Broadcast(
-                &AzToolsFramework::AssetDatabase::AssetDatabaseNotificationBus::Events::OnProductFilesRemoved, productsToRemove);
+            NotifyAfterCommit([productsToRemove]()
+            {
+                AzToolsFramework::AssetDatabase::AssetDatabaseNotificationBus::Broadcast(
+                    &AzToolsFramework::AssetDatabase::AssetDatabaseNotificationBus::Events::OnProductFilesRemoved, productsToRemove);
+            });
         }
 
         return wasEffective;
@@ -2413,10 +2619,15 @@ namespace AssetProcessor
 
         transaction.Commit();
 
+        m_batchProductsByJobID.clear();
+
         if (wasEffective && getProductsSucceeded)
         {
-            AzToolsFramework::AssetDatabase::AssetDatabaseNotificationBus::Broadcast(
-                &AzToolsFramework::AssetDatabase::AssetDatabaseNotificationBus::Events::OnProductFilesRemoved, products);
+            NotifyAfterCommit([products]()
+            {
+                AzToolsFramework::AssetDatabase::AssetDatabaseNotificationBus::Broadcast(
+                    &AzToolsFramework::AssetDatabase::AssetDatabaseNotificationBus::Events::OnProductFilesRemoved, products);
+            });
         }
 
         return wasEffective;
@@ -3194,5 +3405,29 @@ namespace AssetProcessor
         return true;
     }
 
+    ScopedDatabaseBatch::ScopedDatabaseBatch(AssetDatabaseConnection* connection)
+        : m_connection(connection)
+    {
+        m_connection->BeginBatch();
+    }
+
+    ScopedDatabaseBatch::~ScopedDatabaseBatch()
+    {
+        if (m_connection)
+        {
+            m_connection->RollbackBatch();
+            m_connection = nullptr;
+        }
+    }
+
+    void ScopedDatabaseBatch::Commit()
+    {
+        if (m_connection)
+        {
+            m_connection->CommitBatch();
+            m_connection = nullptr;
+        }
+    }
+
 }//namespace AssetProcessor
 
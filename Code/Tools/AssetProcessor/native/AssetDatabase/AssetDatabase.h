@@ -11,6 +11,8 @@
 
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/Asset/AssetCommon.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/functional.h>
 #include <AzToolsFramework/AssetDatabase/AssetDatabaseConnection.h>
 
 #include <QtCore/QSet>
@@ -219,12 +221,51 @@ namespace AssetProcessor
         // updates the modtime and hash for a file if it exists.  Only returns true if the row existed and was successfully updated
         bool UpdateFileModTimeAndHashByFileNameAndScanFolderId(QString fileName, AZ::s64 scanFolderId, AZ::u64 modTime, AZ::u64 hash);
         bool RemoveFile(AZ::s64 sourceID);
+
+        //////////////////////////////////////////////////////////////////////////
+        //Batching
+        //A batch groups every write made until it is committed into a single transaction, instead of one per statement.
+        //While a batch is open sources by path and products by job are served from an in-memory index, and database
+        //notifications are held back until the commit so that listeners on other connections never query uncommitted rows.
+        //Batches nest, only the outermost batch commits to the database.
+        void BeginBatch();
+        void CommitBatch();
+        void RollbackBatch();
+        bool IsBatching() const;
+
     protected:
         void SetDatabaseVersion(AzToolsFramework::AssetDatabase::DatabaseVersion ver);
         void ExecuteCreateStatements();
 
     private:
+        using SourceIndexKey = AZStd::pair<AZ::s64, AZStd::string>; // scan folder ID, source name
+
+        // runs the notification now, or after the batch commits if one is open
+        void NotifyAfterCommit(AZStd::function<void()> notification);
+        void ClearBatchIndex();
+        void RemoveFromBatchIndex(const AzToolsFramework::AssetDatabase::SourceDatabaseEntry& entry);
+
         AZStd::vector<AZStd::string> m_createStatements; // contains all statements required to create the tables
+
+        AZStd::vector<AZStd::function<void()>> m_pendingNotifications;
+        AZStd::vector<size_t> m_batchNotificationMarks; // one per open batch, the pending notification count when it began
+        // the batch transaction holds the write lock, so no other connection can change these tables while it is open.
+        AZStd::unordered_map<SourceIndexKey, AzToolsFramework::AssetDatabase::SourceDatabaseEntry> m_batchSourcesByName;
+        AZStd::unordered_map<AZ::s64, AzToolsFramework::AssetDatabase::ProductDatabaseEntryContainer> m_batchProductsByJobID;
+    };
+
+    //! Limits a batch to a scope, rolling it back unless it was committed.
+    class ScopedDatabaseBatch
+    {
+    public:
+        explicit ScopedDatabaseBatch(AssetDatabaseConnection* connection);
+        ~ScopedDatabaseBatch();
+        void Commit();
+
+        ScopedDatabaseBatch(const ScopedDatabaseBatch& other) = delete;
+        ScopedDatabaseBatch& operator=(const ScopedDatabaseBatch& other) = delete;
+    private:
+        AssetDatabaseConnection* m_connection = nullptr;
     };
 }//namespace EditorFramework
 
@@ -38,27 +38,40 @@ namespace AssetProcessor
 
     bool FileStateCache::GetHash(const QString& absolutePath, FileHash* foundHash)
     {
-        LockGuardType scopeLock(m_mapMutex);
-        auto fileInfoItr = m_fileInfoMap.find(PathToKey(absolutePath));
-
-        if(fileInfoItr == m_fileInfoMap.end())
+        const QString key = PathToKey(absolutePath);
+        FileStateInfo hashedFileInfo;
         {
-            // No info on this file, return false
-            return false;
-        }
+            LockGuardType scopeLock(m_mapMutex);
+            auto fileInfoItr = m_fileInfoMap.find(key);
 
-        auto itr = m_fileHashMap.find(PathToKey(absolutePath));
+            if (fileInfoItr == m_fileInfoMap.end())
+            {
+                // No info on this file, return false
+                return false;
+            }
+            hashedFileInfo = fileInfoItr.value();
 
-        if (itr != m_fileHashMap.end())
-        {
-            *foundHash = itr.value();
-            return true;
+            auto itr = m_fileHashMap.find(key);
+
+            if (itr != m_fileHashMap.end())
+            {
+                *foundHash = itr.value();
+                return true;
+            }
         }
 
-        // There's no hash stored yet or its been invalidated, calculate it
-        *foundHash = AssetUtilities::GetFileHash(absolutePath.toUtf8().constData(), true);
+        // There's no hash stored yet or its been invalidated, calculate it.
+        // This is done unlocked so that files can be hashed from several threads at once.
+        FileHash hash = AssetUtilities::GetFileHash(absolutePath.toUtf8().constData(), true);
 
-        m_fileHashMap[PathToKey(absolutePath)] = *foundHash;
+        LockGuardType scopeLock(m_mapMutex);
+        auto fileInfoItr = m_fileInfoMap.find(key);
+        if (fileInfoItr != m_fileInfoMap.end() && fileInfoItr.value() == hashedFileInfo)
+        {
+            // only keep the hash if the file wasn't updated or removed while it was being hashed, otherwise it may be stale
+            m_fileHashMap.insert(key, hash);
+        }
+        *foundHash = hash;
         return true;
     }
 
@@ -7,6 +7,7 @@
 #include <QStringList>
 #include <QCoreApplication>
 #include <QElapsedTimer>
+#include <QThreadPool>
 
 #include <AzCore/Casting/lossy_cast.h>
 
@@ -20,6 +21,7 @@
 
 #include "native/AssetManager/assetProcessorManager.h"
 #include <AzCore/std/sort.h>
+#include <AzCore/std/parallel/atomic.h>
 #include <AzToolsFramework/API/AssetDatabaseBus.h>
 
 #include <native/AssetManager/PathDependencyManager.h>
@@ -55,6 +57,8 @@ namespace AssetProcessor
         // cache this up front.  Note that it can fail here, and will retry later.
         InitializeCacheRoot();
 
+        m_sharedProductCache = AssetUtilities::SharedProductCacheEnabled();
+
         m_absoluteDevFolderPath[0] = 0;
         m_absoluteDevGameFolderPath[0] = 0;
 
@@ -975,6 +979,11 @@ namespace AssetProcessor
                 continue;
             }
 
+            // write everything this job touches in a single transaction. Asset messages are sent once it has committed,
+            // since their listeners read the database from their own connections.
+            ScopedDatabaseBatch databaseBatch(m_stateData.get());
+            AZStd::vector<AssetNotificationMessage> assetMessages;
+
             if (m_stateData->GetSourcesBySourceNameScanFolderId(processedAsset.m_entry.m_databaseSourceName, scanFolder->ScanFolderID(), sources))
             {
                 AZ_Assert(sources.size() == 1, "Should have only found one source!!!");
@@ -1163,7 +1172,7 @@ namespace AssetProcessor
 
                         // we still need to tell everyone that its gone!
 
-                        Q_EMIT AssetMessage(message); // we notify that we are aware of a missing product either way.
+                        assetMessages.push_back(message); // we notify that we are aware of a missing product either way.
                     }
                     else
                     {
@@ -1178,7 +1187,7 @@ namespace AssetProcessor
                         else
                         {
                             AZ_TracePrintf(AssetProcessor::ConsoleChannel, "Deleting file %s because the recompiled input file no longer emitted that product.\n", fullProductPath.toUtf8().constData());
-                            Q_EMIT AssetMessage(message); // we notify that we are aware of a missing product either way.
+                            assetMessages.push_back(message); // we notify that we are aware of a missing product either way.
                         }
                     }
                 }
@@ -1339,11 +1348,17 @@ namespace AssetProcessor
                     }
                 }
 
-                Q_EMIT AssetMessage( message);
+                assetMessages.push_back(AZStd::move(message));
                 
                 AddKnownFoldersRecursivelyForFile(fullProductPath, m_cacheRootDir.absolutePath());
             }
 
+            databaseBatch.Commit();
+            for (const AssetNotificationMessage& assetMessage : assetMessages)
+            {
+                Q_EMIT AssetMessage(assetMessage);
+            }
+
             QString fullSourcePath = processedAsset.m_entry.GetAbsoluteSourcePath();
 
             // notify the system about inputs:
@@ -2824,6 +2839,11 @@ namespace AssetProcessor
     {
         int processedFileCount = 0;
 
+        if (m_allowModtimeSkippingFeature)
+        {
+            HashModifiedFilesFromScanner(filePaths);
+        }
+
         for (const AssetFileInfo& fileInfo : filePaths)
         {
             if (m_allowModtimeSkippingFeature)
@@ -2855,6 +2875,8 @@ namespace AssetProcessor
             AssessFileInternal(fileInfo.m_filePath, false, true);
         }
 
+        m_scannedFileHashes.clear();
+
         if (m_allowModtimeSkippingFeature)
         {
             AZ_TracePrintf(AssetProcessor::DebugChannel, "%d files reported from scanner.  %d unchanged files skipped, %d files processed\n", filePaths.size(), filePaths.size() - processedFileCount, processedFileCount);
@@ -2916,8 +2938,9 @@ namespace AssetProcessor
                 return false;
             }
 
-            AZ::u64 fileHash = AssetUtilities::GetFileHash(fileInfo.m_filePath.toUtf8().constData());
-                
+            auto scannedHashItr = m_scannedFileHashes.find(fileInfo.m_filePath.toUtf8().constData());
+            AZ::u64 fileHash = scannedHashItr != m_scannedFileHashes.end() ? scannedHashItr->second : AssetUtilities::GetFileHash(fileInfo.m_filePath.toUtf8().constData());
+
             if(fileHash != databaseHashValue)
             {
                 // File contents have changed
@@ -2960,6 +2983,56 @@ namespace AssetProcessor
         return false;
     }
 
+    void AssetProcessorManager::HashModifiedFilesFromScanner(const QSet<AssetFileInfo>& filePaths)
+    {
+        m_scannedFileHashes.clear();
+        if (m_buildersAddedOrRemoved || !AssetUtilities::ShouldUseFileHashing())
+        {
+            // CanSkipProcessingFile won't hash anything
+            return;
+        }
+
+        AZStd::vector<AZStd::pair<AZStd::string, AZ::u64>> filesToHash;
+        for (const AssetFileInfo& fileInfo : filePaths)
+        {
+            AZStd::string filePath = fileInfo.m_filePath.toUtf8().constData();
+            auto modTimeItr = m_fileModTimes.find(filePath);
+            auto hashItr = m_fileHashes.find(filePath);
+            if (modTimeItr == m_fileModTimes.end() || modTimeItr->second == 0 || hashItr == m_fileHashes.end() || hashItr->second == 0)
+            {
+                continue;
+            }
+
+            if (modTimeItr->second != aznumeric_cast<AZ::u64>(AssetUtilities::AdjustTimestamp(fileInfo.m_modTime)))
+            {
+                filesToHash.emplace_back(AZStd::move(filePath), 0);
+            }
+        }
+
+        if (filesToHash.empty())
+        {
+            return;
+        }
+
+        // a fresh checkout touches every modtime, so this can be every file of the project.  The hashes end up in the
+        // file state cache as well, where fingerprinting finds them for the files that did change.
+        AZStd::atomic<size_t> nextFile{ 0 };
+        QThreadPool hashThreadPool;
+        for (int threadIndex = 0; threadIndex < hashThreadPool.maxThreadCount(); ++threadIndex)
+        {
+            hashThreadPool.start([&filesToHash, &nextFile]()
+            {
+                for (size_t fileIndex = nextFile++; fileIndex < filesToHash.size(); fileIndex = nextFile++)
+                {
+                    filesToHash[fileIndex].second = AssetUtilities::GetFileHash(filesToHash[fileIndex].first.c_str());
+                }
+            });
+        }
+        hashThreadPool.waitForDone();
+
+        m_scannedFileHashes.insert(filesToHash.begin(), filesToHash.end());
+    }
+
     void AssetProcessorManager::AssessDeletedFile(QString filePath)
     {
         {
@@ -3156,6 +3229,12 @@ namespace AssetProcessor
         // Check to see whether we need to process this asset
         if (AnalyzeJob(job))
         {
+            // the fingerprint is final now, a job whose fingerprint was already processed by a server gets its products
+            // from the shared product cache instead of being processed again.
+            if (m_sharedProductCache)
+            {
+                job.m_checkServer = true;
+            }
             Q_EMIT AssetToProcess(job);
         }
         else
@@ -361,6 +361,10 @@ namespace AssetProcessor
         // Checks whether or not a file can be skipped for processing (ie, file content hasn't changed, builders haven't been added/removed, builders for the file haven't changed)
         bool CanSkipProcessingFile(const AssetFileInfo &fileInfo, AZ::u64& fileHash);
 
+        // Hashes, in parallel, the files from the scanner that CanSkipProcessingFile would otherwise hash one after the other:
+        // those with a different modtime than last time, which are only skipped if their contents are still the same.
+        void HashModifiedFilesFromScanner(const QSet<AssetFileInfo>& filePaths);
+
         AZ::s64 GenerateNewJobRunKey();
         // Attempt to erase a log file.  Failing to erase it is not a critical problem, but should be logged.
         // returns true if there is no log file there after this operation completes
@@ -423,6 +427,9 @@ namespace AssetProcessor
         // this map contains hashes of all files AP processed last time it ran
         AZStd::unordered_map<AZStd::string, AZ::u64> m_fileHashes;
 
+        // current hashes of the files from the scanner whose modtime changed since AP last ran, see HashModifiedFilesFromScanner
+        AZStd::unordered_map<AZStd::string, AZ::u64> m_scannedFileHashes;
+
         QSet<QString> m_knownFolders; // a cache of all known folder names, normalized to have forward slashes.
         typedef AZStd::unordered_map<AZ::u64, AzToolsFramework::AssetSystem::JobInfo> JobRunKeyToJobInfoMap;  // for when network requests come in about the jobInfo
 
@@ -548,6 +555,9 @@ namespace AssetProcessor
         // when true, a flag will be sent to builders process job indicating debug output/mode should be used
         bool m_builderDebugFlag = false;
 
+        // when true, every job checks the shared product cache of the server before being processed
+        bool m_sharedProductCache = false;
+
 protected Q_SLOTS:
         void FinishAnalysis(AZStd::string fileToCheck);
         //////////////////////////////////////////////////////////
@@ -8,6 +8,7 @@
 #include "native/AssetManager/assetScanner.h"
 #include "native/utilities/PlatformConfiguration.h"
 #include <QDir>
+#include <QThreadPool>
 
 using namespace AssetProcessor;
 
@@ -31,10 +32,22 @@ void AssetScannerWorker::StartScan()
     Q_EMIT ScanningStateChanged(AssetProcessor::AssetScanningStatus::Started);
     Q_EMIT ScanningStateChanged(AssetProcessor::AssetScanningStatus::InProgress);
 
-    for (int idx = 0; idx < m_platformConfiguration->GetScanFolderCount(); idx++)
+    AssetUtilities::ComputeProjectCacheRoot(m_projectCacheRoot);
+
+    // listing a folder is mostly waiting on the file system, so scan folders and their sub folders are walked in parallel.
+    // the pool is local so the walk neither competes with nor waits for the jobs running on the global pool.
     {
-        const ScanFolderInfo& scanFolderInfo = m_platformConfiguration->GetScanFolderAt(idx);
-        ScanForSourceFiles(scanFolderInfo, scanFolderInfo);
+        QThreadPool scanThreadPool;
+        for (int idx = 0; idx < m_platformConfiguration->GetScanFolderCount(); idx++)
+        {
+            const ScanFolderInfo& scanFolderInfo = m_platformConfiguration->GetScanFolderAt(idx);
+            scanThreadPool.start([this, &scanThreadPool, &scanFolderInfo]()
+            {
+                ScanForSourceFiles(scanThreadPool, scanFolderInfo.ScanPath(), scanFolderInfo.RecurseSubFolders(), scanFolderInfo);
+            });
+        }
+        // sub folders are queued before the task that found them finishes, so this also waits for them.
+        scanThreadPool.waitForDone();
     }
 
     // we want not to emit any signals until we're finished scanning
@@ -66,19 +79,19 @@ void AssetScannerWorker::StopScan()
     m_doScan = false;
 }
 
-void AssetScannerWorker::ScanForSourceFiles(const ScanFolderInfo& scanFolderInfo, const ScanFolderInfo& rootScanFolder)
+void AssetScannerWorker::ScanForSourceFiles(QThreadPool& threadPool, const QString& folderPath, bool recurseSubFolders, const ScanFolderInfo& rootScanFolder)
 {
     if (!m_doScan)
     {
         return;
     }
 
-    QDir dir(scanFolderInfo.ScanPath());
+    QDir dir(folderPath);
 
     QFileInfoList entries;
 
     //Only scan sub folders if recurseSubFolders flag is set
-    if (!scanFolderInfo.RecurseSubFolders())
+    if (!recurseSubFolders)
     {
         entries = dir.entryInfoList(QDir::NoDotAndDotDot | QDir::Files);
     }
@@ -87,6 +100,11 @@ void AssetScannerWorker::ScanForSourceFiles(const ScanFolderInfo& scanFolderInfo
         entries = dir.entryInfoList(QDir::Dirs | QDir::NoDotAndDotDot | QDir::Files);
     }
 
+    // collected locally so the lists are only locked once per folder
+    QSet<AssetFileInfo> fileList;
+    QSet<AssetFileInfo> folderList;
+    QSet<AssetFileInfo> excludedList;
+
     for (const QFileInfo& entry : entries)
     {
         if (!m_doScan) // scan was cancelled!
@@ -101,9 +119,7 @@ void AssetScannerWorker::ScanForSourceFiles(const ScanFolderInfo& scanFolderInfo
         AssetFileInfo assetFileInfo(absPath, modTime, fileSize, &rootScanFolder, isDirectory);
 
         // Skip over the Cache folder if the file entry is the project cache root
-        QDir projectCacheRoot;
-        AssetUtilities::ComputeProjectCacheRoot(projectCacheRoot);
-        QString relativeToProjectCacheRoot = projectCacheRoot.relativeFilePath(absPath);
+        QString relativeToProjectCacheRoot = m_projectCacheRoot.relativeFilePath(absPath);
         if (QDir::isRelativePath(relativeToProjectCacheRoot) && !relativeToProjectCacheRoot.startsWith(".."))
         {
             // The Cache folder should not be scanned
@@ -113,23 +129,30 @@ void AssetScannerWorker::ScanForSourceFiles(const ScanFolderInfo& scanFolderInfo
         // Filtering out excluded files
         if (m_platformConfiguration->IsFileExcluded(absPath))
         {
-            m_excludedList.insert(AZStd::move(assetFileInfo));
+            excludedList.insert(AZStd::move(assetFileInfo));
             continue;
         }
 
         if (isDirectory)
         {
             //Entry is a directory
-            m_folderList.insert(AZStd::move(assetFileInfo));
-            ScanFolderInfo tempScanFolderInfo(absPath, "", "", false, true);
-            ScanForSourceFiles(tempScanFolderInfo, rootScanFolder);
+            folderList.insert(AZStd::move(assetFileInfo));
+            threadPool.start([this, &threadPool, absPath, &rootScanFolder]()
+            {
+                ScanForSourceFiles(threadPool, absPath, true, rootScanFolder);
+            });
         }
         else
         {
             //Entry is a file
-            m_fileList.insert(AZStd::move(assetFileInfo));
+            fileList.insert(AZStd::move(assetFileInfo));
         }
     }
+
+    QMutexLocker locker(&m_listMutex);
+    m_fileList.unite(fileList);
+    m_folderList.unite(folderList);
+    m_excludedList.unite(excludedList);
 }
 
 void AssetScannerWorker::EmitFiles()
@@ -13,8 +13,12 @@
 #include <QString>
 #include <QSet>
 #include <QObject>
+#include <QDir>
+#include <QMutex>
 #endif
 
+class QThreadPool;
+
 namespace AssetProcessor
 {
     class PlatformConfiguration;
@@ -42,9 +46,10 @@ Q_SIGNALS:
         void StopScan();
 
     protected:
-        // scanFolderInfo - the folder we're currently scanning (this will sometimes be a fake scanfolder created when recursing through directories)
-        // rootScanFolder - the actual scan folder we started with, which will either be the same as scanFolderInfo or a parent folder
-        void ScanForSourceFiles(const ScanFolderInfo& scanFolderInfo, const ScanFolderInfo& rootScanFolder);
+        // folderPath - the folder we're currently scanning, either the scan folder itself or one of its sub folders
+        // recurseSubFolders - whether the sub folders of folderPath are scanned as well, each of them is queued on threadPool
+        // rootScanFolder - the actual scan folder we started with, which will either be folderPath or a parent folder
+        void ScanForSourceFiles(QThreadPool& threadPool, const QString& folderPath, bool recurseSubFolders, const ScanFolderInfo& rootScanFolder);
         void EmitFiles();
 
     private:
@@ -52,6 +57,8 @@ Q_SIGNALS:
         QSet<AssetFileInfo> m_fileList; // note:  neither QSet nor QString are qobject-derived
         QSet<AssetFileInfo> m_folderList;
         QSet<AssetFileInfo> m_excludedList;
+        QMutex m_listMutex; // guards the lists above while folders are scanned in parallel
+        QDir m_projectCacheRoot;
         PlatformConfiguration* m_platformConfiguration;
     };
 } // end namespace AssetProcessor
@@ -2328,6 +2328,68 @@ namespace UnitTests
         ASSERT_TRUE(entryAlreadyExists);
     }
 
+    TEST_F(AssetDatabaseTest, Batch_ProductsByJob_StayInSyncWithDatabase)
+    {
+        using namespace AzToolsFramework::AssetDatabase;
+        CreateCoverageTestData();
+
+        ScopedDatabaseBatch batch(&m_data->m_connection);
+
+        ProductDatabaseEntryContainer products;
+        ASSERT_TRUE(m_data->m_connection.GetProductsByJobID(m_data->m_job1.m_jobID, products));
+        EXPECT_EQ(products.size(), 2);
+
+        ProductDatabaseEntry newProduct = { m_data->m_job1.m_jobID, 5, "someproduct5.dds", AZ::Data::AssetType::CreateRandom() };
+        ASSERT_TRUE(m_data->m_connection.SetProduct(newProduct));
+        ASSERT_TRUE(m_data->m_connection.RemoveProduct(m_data->m_product1.m_productID));
+
+        ProductDatabaseEntry productFromIndex;
+        EXPECT_TRUE(m_data->m_connection.GetProductByJobIDSubId(m_data->m_job1.m_jobID, 5, productFromIndex));
+        EXPECT_EQ(productFromIndex, newProduct);
+        EXPECT_FALSE(m_data->m_connection.GetProductByJobIDSubId(m_data->m_job1.m_jobID, 1, productFromIndex));
+
+        products.clear();
+        ASSERT_TRUE(m_data->m_connection.GetProductsByJobID(m_data->m_job1.m_jobID, products));
+        ASSERT_EQ(products.size(), 2);
+
+        batch.Commit();
+        EXPECT_FALSE(m_data->m_connection.IsBatching());
+
+        ProductDatabaseEntryContainer productsFromDatabase;
+        ASSERT_TRUE(m_data->m_connection.GetProductsByJobID(m_data->m_job1.m_jobID, productsFromDatabase));
+        ASSERT_EQ(productsFromDatabase.size(), 2);
+        for (const ProductDatabaseEntry& product : products)
+        {
+            EXPECT_NE(AZStd::find(productsFromDatabase.begin(), productsFromDatabase.end(), product), productsFromDatabase.end());
+        }
+    }
+
+    TEST_F(AssetDatabaseTest, Batch_RolledBack_DiscardsWrites)
+    {
+        using namespace AzToolsFramework::AssetDatabase;
+        CreateCoverageTestData();
+
+        SourceDatabaseEntry newSource = { m_data->m_scanFolder.m_scanFolderID, "newfile.tif", AZ::Uuid::CreateRandom(), "AnalysisFingerprint3" };
+        {
+            ScopedDatabaseBatch batch(&m_data->m_connection);
+            ASSERT_TRUE(m_data->m_connection.SetSource(newSource));
+            ASSERT_TRUE(m_data->m_connection.RemoveProductsByJobID(m_data->m_job2.m_jobID));
+
+            SourceDatabaseEntryContainer sources;
+            EXPECT_TRUE(m_data->m_connection.GetSourcesBySourceNameScanFolderId("newfile.tif", m_data->m_scanFolder.m_scanFolderID, sources));
+            ProductDatabaseEntryContainer products;
+            EXPECT_FALSE(m_data->m_connection.GetProductsByJobID(m_data->m_job2.m_jobID, products));
+        }
+
+        EXPECT_FALSE(m_data->m_connection.IsBatching());
+
+        SourceDatabaseEntryContainer sources;
+        EXPECT_FALSE(m_data->m_connection.GetSourcesBySourceNameScanFolderId("newfile.tif", m_data->m_scanFolder.m_scanFolderID, sources));
+        ProductDatabaseEntryContainer products;
+        ASSERT_TRUE(m_data->m_connection.GetProductsByJobID(m_data->m_job2.m_jobID, products));
+        EXPECT_EQ(products.size(), 2);
+    }
+
     class QueryLoggingTraceHandler : public AZ::Debug::TraceMessageBus::Handler
     {
     public:
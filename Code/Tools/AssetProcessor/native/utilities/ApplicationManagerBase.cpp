@@ -1516,11 +1516,62 @@ void ApplicationManagerBase::RegisterBuilderInformation(const AssetBuilderSDK::A
                 }
             };
 
+        // Jobs of builders listed in the server settings may also be farmed out to builder agents on other machines
+        const bool remoteBuildAllowed = AssetUtilities::RemoteBuildersEnabled() && AssetUtilities::IsRemoteBuildAllowed(builderDesc.m_name);
+
+        // Builders with many small jobs may ask for several of them to be sent to a builder process in one request
+        const AZ::u32 processJobBatchSize = modifiedBuilderDesc.m_processJobBatchSize;
+
         // Also override the processJob function to run externally
-        modifiedBuilderDesc.m_processJobFunction = [builderFilePath](const AssetBuilderSDK::ProcessJobRequest& request, AssetBuilderSDK::ProcessJobResponse& response)
+        modifiedBuilderDesc.m_processJobFunction = [builderFilePath, remoteBuildAllowed, processJobBatchSize](const AssetBuilderSDK::ProcessJobRequest& request, AssetBuilderSDK::ProcessJobResponse& response)
             {
                 AssetBuilderSDK::JobCancelListener jobCancelListener(request.m_jobId);
 
+                if (remoteBuildAllowed)
+                {
+                    AssetProcessor::BuilderRef remoteBuilderRef;
+                    AssetProcessor::BuilderManagerBus::BroadcastResult(remoteBuilderRef, &AssetProcessor::BuilderManagerBusTraits::GetRemoteBuilder);
+
+                    AssetBuilderSDK::ProcessJobRequest remoteRequest = request;
+                    bool prepared = false;
+                    if (remoteBuilderRef)
+                    {
+                        AssetProcessor::AssetServerBus::BroadcastResult(prepared, &AssetProcessor::AssetServerBusTraits::PrepareRemoteJob, remoteRequest);
+                    }
+
+                    if (prepared)
+                    {
+                        AssetProcessor::BuilderRunJobOutcome result = remoteBuilderRef->RunJob<AssetBuilderSDK::ProcessJobNetRequest, AssetBuilderSDK::ProcessJobNetResponse>(remoteRequest, response, s_MaximumProcessJobsTimeSeconds, "process", builderFilePath, &jobCancelListener, request.m_tempDirPath);
+
+                        bool finished = false;
+                        if (result == AssetProcessor::BuilderRunJobOutcome::Ok)
+                        {
+                            AssetProcessor::AssetServerBus::BroadcastResult(finished, &AssetProcessor::AssetServerBusTraits::FinishRemoteJob, request, remoteRequest, response);
+                        }
+
+                        if (finished || result == AssetProcessor::BuilderRunJobOutcome::JobCancelled)
+                        {
+                            return;
+                        }
+
+                        // losing an agent or its products is not the job's fault, so build it here instead
+                        AZ_TracePrintf(AssetProcessor::DebugChannel, "Remote build of %s did not complete, processing locally.\n", request.m_sourceFile.c_str());
+                        response = AssetBuilderSDK::ProcessJobResponse();
+                    }
+                }
+
+                if (processJobBatchSize > 1)
+                {
+                    AssetProcessor::BuilderRunJobOutcome result = AssetProcessor::BuilderRunJobOutcome::ResponseFailure;
+                    AssetProcessor::BuilderManagerBus::BroadcastResult(result, &AssetProcessor::BuilderManagerBusTraits::RunProcessJobInBatch,
+                        request, response, processJobBatchSize, s_MaximumProcessJobsTimeSeconds, builderFilePath);
+                    if (result != AssetProcessor::BuilderRunJobOutcome::Ok)
+                    {
+                        AZ_TracePrintf(AssetProcessor::DebugChannel, "Batch holding the job for %s did not complete.\n", request.m_sourceFile.c_str());
+                    }
+                    return;
+                }
+
                 AssetProcessor::BuilderRef builderRef;
                 AssetProcessor::BuilderManagerBus::BroadcastResult(builderRef, &AssetProcessor::BuilderManagerBusTraits::GetBuilder);
 
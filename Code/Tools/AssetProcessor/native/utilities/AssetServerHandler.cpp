@@ -7,11 +7,36 @@
 
 #include <native/utilities/AssetServerHandler.h>
 #include <native/resourcecompiler/rcjob.h>
+#include <native/utilities/assetUtils.h>
+#include <AzCore/std/hash.h>
 #include <AzToolsFramework/Archive/ArchiveAPI.h>
 #include <QDir>
+#include <QDirIterator>
+#include <QTextStream>
 
 namespace AssetProcessor
 {
+    //! Folder on the server holding the uploaded inputs of remote jobs, one subfolder per distinct set of input contents
+    static const char* s_remoteContentFolderName = "RemoteContent";
+    //! Folder on the server holding the temp folders of remote jobs while they run
+    static const char* s_remoteJobsFolderName = "RemoteJobs";
+    //! Folder on the server holding one manifest per job fingerprint, listing the files of the job and the blob holding each
+    static const char* s_productManifestsFolderName = "ProductCache/Manifests";
+    //! Folder on the server holding the job files, stored once per distinct contents and shared by every manifest referring to them
+    static const char* s_productBlobsFolderName = "ProductCache/Blobs";
+
+    //! Remote builder agents may mount the network share somewhere else than the Asset Processor does,
+    //! so paths handed to them or received from them are translated between the two server addresses.
+    QString TranslateServerPath(const QString& path, const QString& fromAddress, const QString& toAddress)
+    {
+        const QString cleanPath = QDir::cleanPath(QDir::fromNativeSeparators(path));
+        const QString cleanFromAddress = QDir::cleanPath(QDir::fromNativeSeparators(fromAddress));
+        if (!cleanPath.startsWith(cleanFromAddress, Qt::CaseInsensitive))
+        {
+            return cleanPath;
+        }
+        return QDir::cleanPath(QDir::fromNativeSeparators(toAddress)) + cleanPath.mid(cleanFromAddress.length());
+    }
 
     QString ComputeArchiveFilePath(const AssetProcessor::BuilderParams& builderParams)
     {
@@ -28,6 +53,50 @@ namespace AssetProcessor
         return QString();
     }
 
+    QString ComputeManifestFilePath(const AssetProcessor::BuilderParams& builderParams)
+    {
+        QFileInfo fileInfo(builderParams.m_processJobRequest.m_sourceFile.c_str());
+        QString assetServerAddress = AssetUtilities::ServerAddress();
+        if (!assetServerAddress.isEmpty())
+        {
+            QDir manifestsDir(QDir(assetServerAddress).filePath(s_productManifestsFolderName));
+            return QDir(manifestsDir.filePath(fileInfo.path())).filePath(builderParams.GetServerKey() + ".manifest");
+        }
+
+        return QString();
+    }
+
+    QString ComputeBlobName(const QString& filePath)
+    {
+        // the size is part of the name so that two different files only collide if both their size and hash match.
+        AZ::u64 hash = AssetUtilities::GetFileHash(filePath.toUtf8().constData(), true);
+        return QString("%1_%2").arg(static_cast<qulonglong>(hash), 16, 16, QChar('0')).arg(QFileInfo(filePath).size());
+    }
+
+    //! Copies a file to the server through a uniquely named staging file and a rename, so that readers never see a partially written file.
+    //! Returns true if the file is on the server afterwards, whether it was copied by us or by another Asset Processor.
+    bool UploadFile(const QString& localPath, const QString& serverPath)
+    {
+        if (QFile::exists(serverPath))
+        {
+            return true;
+        }
+
+        QDir().mkpath(QFileInfo(serverPath).absolutePath());
+        const QString stagingPath = QString("%1_%2").arg(serverPath, AZ::Uuid::CreateRandom().ToString<AZStd::string>(false, false).c_str());
+        if (!QFile::copy(localPath, stagingPath))
+        {
+            return false;
+        }
+
+        if (!QFile::rename(stagingPath, serverPath))
+        {
+            QFile::remove(stagingPath);
+            return QFile::exists(serverPath);
+        }
+        return true;
+    }
+
     AssetServerHandler::AssetServerHandler()
     {
         AssetServerBus::Handler::BusConnect();
@@ -51,6 +120,13 @@ namespace AssetProcessor
         AssetUtilities::QuitListener listener;
         listener.BusConnect();
 
+        QString manifestAbsFilePath = ComputeManifestFilePath(builderParams);
+        if (QFile::exists(manifestAbsFilePath))
+        {
+            return RetrieveFromProductCache(builderParams, manifestAbsFilePath);
+        }
+
+        // servers that predate the product cache stored whole archives.
         QString archiveAbsFilePath = ComputeArchiveFilePath(builderParams);
         if (archiveAbsFilePath.isEmpty())
         {
@@ -84,67 +160,289 @@ namespace AssetProcessor
         AssetBuilderSDK::JobCancelListener jobCancelListener(builderParams.m_rcJob->GetJobEntry().m_jobRunKey);
         AssetUtilities::QuitListener listener;
         listener.BusConnect();
-        QString archiveAbsFilePath = ComputeArchiveFilePath(builderParams);
-        
-        if (archiveAbsFilePath.isEmpty())
+        QString manifestAbsFilePath = ComputeManifestFilePath(builderParams);
+
+        if (manifestAbsFilePath.isEmpty())
         {
-            AZ_Error(AssetProcessor::DebugChannel, false, "Creating archive operation failed. Archive Absolute Path is empty. \n");
+            AZ_Error(AssetProcessor::DebugChannel, false, "Storing job result failed. Manifest Absolute Path is empty. \n");
             return false;
         }
 
-        if (QFile::exists(archiveAbsFilePath))
+        if (QFile::exists(manifestAbsFilePath))
         {
-            // file already exists on the server 
-            AZ_TracePrintf(AssetProcessor::DebugChannel, "Creating archive operation cancelled. An archive of this asset already exists on server. \n");
+            // file already exists on the server
+            AZ_TracePrintf(AssetProcessor::DebugChannel, "Storing job result cancelled. A manifest for this job already exists on server. \n");
             return true;
         }
-        
-        if (listener.WasQuitRequested() || jobCancelListener.IsCancelled())
+
+        AZ_TracePrintf(AssetProcessor::DebugChannel, "Storing job result for job (%s, %s, %s) with fingerprint (%u).\n",
+            builderParams.m_rcJob->GetJobEntry().m_pathRelativeToWatchFolder.toUtf8().data(), builderParams.m_rcJob->GetJobKey().toUtf8().data(),
+            builderParams.m_rcJob->GetPlatformInfo().m_identifier.c_str(), builderParams.m_rcJob->GetOriginalFingerprint());
+
+        // pairs of (path of the file relative to the temp folder, absolute path of the file to upload)
+        AZStd::vector<AZStd::pair<QString, QString>> jobFiles;
+        const QDir tempDir(builderParams.GetTempJobDirectory());
+        QDirIterator tempDirIterator(tempDir.path(), QDir::Files, QDirIterator::Subdirectories);
+        while (tempDirIterator.hasNext())
+        {
+            const QString filePath = tempDirIterator.next();
+            jobFiles.emplace_back(tempDir.relativeFilePath(filePath), filePath);
+        }
+
+        // Source files intended to be copied into the cache don't go through the temp folder, they are added
+        // at the same relative location they have next to the source, which is where the job response expects them.
+        const QDir sourceDir = QFileInfo(builderParams.m_rcJob->GetJobEntry().GetAbsoluteSourcePath()).absoluteDir();
+        for (const AZStd::string& sourceFile : sourceFileList)
+        {
+            const QString filePath = sourceDir.absoluteFilePath(sourceFile.c_str());
+            if (!QFileInfo(filePath).exists())
+            {
+                AZ_Warning(AssetProcessor::DebugChannel, false, "Failed to store %s - source does not exist in expected location (sourceDir %s )", sourceFile.c_str(), sourceDir.path().toUtf8().data());
+                return false;
+            }
+            jobFiles.emplace_back(sourceDir.relativeFilePath(filePath), filePath);
+        }
+
+        const QDir blobsDir(QDir(AssetUtilities::ServerAddress()).filePath(s_productBlobsFolderName));
+        QString manifest;
+        QTextStream manifestStream(&manifest);
+        for (const auto& jobFile : jobFiles)
+        {
+            const QString& relativePath = jobFile.first;
+            const QString& filePath = jobFile.second;
+
+            if (listener.WasQuitRequested() || jobCancelListener.IsCancelled())
+            {
+                AZ_TracePrintf(AssetProcessor::DebugChannel, "Storing job result cancelled. \n");
+                return false;
+            }
+
+            // files with the same contents, be it from another platform, another job or an older version of this job, are only stored once.
+            const QString blobName = ComputeBlobName(filePath);
+            if (!UploadFile(filePath, blobsDir.filePath(blobName)))
+            {
+                AZ_Warning(AssetProcessor::DebugChannel, false, "Storing job result failed. Unable to upload %s to the server.\n", filePath.toUtf8().constData());
+                return false;
+            }
+            manifestStream << blobName << "\t" << relativePath << "\n";
+        }
+        manifestStream.flush();
+
+        // the manifest goes last, a job is only found in the cache once all of its blobs are there.
+        const QString stagingManifestPath = QString("%1_%2").arg(manifestAbsFilePath, AZ::Uuid::CreateRandom().ToString<AZStd::string>(false, false).c_str());
+        QDir().mkpath(QFileInfo(manifestAbsFilePath).absolutePath());
+        QFile stagingManifest(stagingManifestPath);
+        if (!stagingManifest.open(QIODevice::WriteOnly | QIODevice::Text) || stagingManifest.write(manifest.toUtf8()) < 0)
         {
-            AZ_TracePrintf(AssetProcessor::DebugChannel, "Creating archive operation cancelled. \n");
+            AZ_Error(AssetProcessor::DebugChannel, false, "Storing job result failed. Unable to write %s. \n", stagingManifestPath.toUtf8().constData());
+            stagingManifest.remove();
             return false;
         }
+        stagingManifest.close();
 
-        bool success = false;
+        if (!QFile::rename(stagingManifestPath, manifestAbsFilePath))
+        {
+            QFile::remove(stagingManifestPath);
+            return QFile::exists(manifestAbsFilePath);
+        }
+        return true;
+    }
 
-        AZ_TracePrintf(AssetProcessor::DebugChannel, "Creating archive for job (%s, %s, %s) with fingerprint (%u).\n",
+    bool AssetServerHandler::RetrieveFromProductCache(const AssetProcessor::BuilderParams& builderParams, const QString& manifestPath)
+    {
+        AssetBuilderSDK::JobCancelListener jobCancelListener(builderParams.m_rcJob->GetJobEntry().m_jobRunKey);
+        AssetUtilities::QuitListener listener;
+        listener.BusConnect();
+
+        QFile manifestFile(manifestPath);
+        if (!manifestFile.open(QIODevice::ReadOnly | QIODevice::Text))
+        {
+            AZ_Warning(AssetProcessor::DebugChannel, false, "Retrieving job result failed. Unable to read %s. \n", manifestPath.toUtf8().constData());
+            return false;
+        }
+
+        AZ_TracePrintf(AssetProcessor::DebugChannel, "Retrieving job result for job (%s, %s, %s) with fingerprint (%u).\n",
             builderParams.m_rcJob->GetJobEntry().m_pathRelativeToWatchFolder.toUtf8().data(), builderParams.m_rcJob->GetJobKey().toUtf8().data(),
             builderParams.m_rcJob->GetPlatformInfo().m_identifier.c_str(), builderParams.m_rcJob->GetOriginalFingerprint());
-        AzToolsFramework::ArchiveCommands::Bus::BroadcastResult(success, &AzToolsFramework::ArchiveCommands::CreateArchiveBlocking, archiveAbsFilePath.toUtf8().data(), builderParams.GetTempJobDirectory());
-        AZ_Error(AssetProcessor::DebugChannel, success, "Creating archive operation failed. \n");
 
-        if (success && sourceFileList.size())
+        const QDir blobsDir(QDir(AssetUtilities::ServerAddress()).filePath(s_productBlobsFolderName));
+        const QDir tempDir(builderParams.GetTempJobDirectory());
+        QStringList retrievedFiles;
+        bool success = true;
+        QTextStream manifestStream(&manifestFile);
+        while (success && !manifestStream.atEnd())
+        {
+            const QString line = manifestStream.readLine();
+            const int separator = line.indexOf('\t');
+            if (separator <= 0)
+            {
+                continue;
+            }
+
+            if (listener.WasQuitRequested() || jobCancelListener.IsCancelled())
+            {
+                AZ_TracePrintf(AssetProcessor::DebugChannel, "Retrieving job result cancelled. \n");
+                success = false;
+                break;
+            }
+
+            const QString blobPath = blobsDir.filePath(line.left(separator));
+            const QString localPath = tempDir.filePath(line.mid(separator + 1));
+            QDir().mkpath(QFileInfo(localPath).absolutePath());
+            QFile::remove(localPath);
+            if (!QFile::copy(blobPath, localPath))
+            {
+                AZ_Warning(AssetProcessor::DebugChannel, false, "Retrieving job result failed. Unable to retrieve %s from the server.\n", blobPath.toUtf8().constData());
+                success = false;
+                break;
+            }
+            retrievedFiles.push_back(localPath);
+        }
+
+        if (!success)
         {
-            // Check if any of our output products for this job was a source file which would not be in the temp folder
-            // If so add it to the archive
-            AddSourceFilesToArchive(builderParams, archiveAbsFilePath, sourceFileList);
+            // the job is processed locally instead, it should not find half of a result in its temp folder.
+            for (const QString& retrievedFile : retrievedFiles)
+            {
+                QFile::remove(retrievedFile);
+            }
         }
         return success;
     }
 
-    bool AssetServerHandler::AddSourceFilesToArchive(const AssetProcessor::BuilderParams& builderParams, const QString& archivePath, AZStd::vector<AZStd::string>& sourceFileList)
+    bool AssetServerHandler::PrepareRemoteJob(AssetBuilderSDK::ProcessJobRequest& remoteRequest)
     {
-        bool allSuccess{ true };
-        for (const auto& thisProduct : sourceFileList)
+        AssetBuilderSDK::JobCancelListener jobCancelListener(remoteRequest.m_jobId);
+        AssetUtilities::QuitListener listener;
+        listener.BusConnect();
+
+        if (!IsServerAddressValid())
         {
-            QFileInfo sourceFile{ builderParams.m_rcJob->GetJobEntry().GetAbsoluteSourcePath() };
-            QDir sourceDir{ sourceFile.absoluteDir() };
+            AZ_TracePrintf(AssetProcessor::DebugChannel, "Preparing remote job cancelled. Server address is not valid. \n");
+            return false;
+        }
+
+        const QString serverAddress = AssetUtilities::ServerAddress();
+        const QDir serverDir(serverAddress);
+        const QFileInfo sourceInfo(remoteRequest.m_fullPath.c_str());
+        const QDir sourceDir = sourceInfo.absoluteDir();
+
+        // sidecar files such as example.fbx.assetinfo are read by builders next to the source, so they travel with it.
+        QStringList inputFiles = sourceDir.entryList({ sourceInfo.fileName() + ".*" }, QDir::Files);
+        inputFiles.prepend(sourceInfo.fileName());
 
-            if (!QFileInfo(sourceDir.absoluteFilePath(thisProduct.c_str())).exists())
+        size_t contentHash = 0;
+        for (const QString& inputFile : inputFiles)
+        {
+            AZStd::hash_combine(contentHash, AZStd::string(inputFile.toUtf8().constData()));
+            AZStd::hash_combine(contentHash, AssetUtilities::GetFileHash(sourceDir.filePath(inputFile).toUtf8().constData(), true));
+        }
+
+        if (listener.WasQuitRequested() || jobCancelListener.IsCancelled())
+        {
+            AZ_TracePrintf(AssetProcessor::DebugChannel, "Preparing remote job cancelled. \n");
+            return false;
+        }
+
+        const QString contentFolder = serverDir.filePath(QString("%1/%2").arg(QString(s_remoteContentFolderName)).arg(static_cast<qulonglong>(contentHash), 16, 16, QChar('0')));
+        if (!QDir(contentFolder).exists())
+        {
+            // upload next to the final location and rename, so that an agent never sees a partially written folder.
+            const QString stagingFolder = QString("%1_%2").arg(contentFolder, AZ::Uuid::CreateRandom().ToString<AZStd::string>(false, false).c_str());
+            if (!QDir().mkpath(stagingFolder))
             {
-                AZ_Warning(AssetProcessor::DebugChannel, false, "Failed to add %s to %s - source does not exist in expected location (sourceDir %s )", thisProduct.c_str(), archivePath.toUtf8().data(), sourceDir.path().toUtf8().data());
-                allSuccess = false;
-                continue;
+                AZ_Warning(AssetProcessor::DebugChannel, false, "Preparing remote job failed. Unable to create %s on the server.\n", stagingFolder.toUtf8().constData());
+                return false;
+            }
+
+            for (const QString& inputFile : inputFiles)
+            {
+                if (!QFile::copy(sourceDir.filePath(inputFile), QDir(stagingFolder).filePath(inputFile)))
+                {
+                    AZ_Warning(AssetProcessor::DebugChannel, false, "Preparing remote job failed. Unable to upload %s to the server.\n", inputFile.toUtf8().constData());
+                    QDir(stagingFolder).removeRecursively();
+                    return false;
+                }
             }
-            bool success{ false };
-            AzToolsFramework::ArchiveCommands::Bus::BroadcastResult(success, &AzToolsFramework::ArchiveCommands::AddFileToArchiveBlocking, archivePath.toUtf8().data(), sourceDir.path().toUtf8().data(), thisProduct.c_str());
-            if (!success)
+
+            if (!QDir().rename(stagingFolder, contentFolder))
             {
-                AZ_Warning(AssetProcessor::DebugChannel, false, "Failed to add %s to %s", thisProduct.c_str(), archivePath.toUtf8().data());
-                allSuccess = false;
+                // another Asset Processor uploaded the same contents first, use theirs.
+                QDir(stagingFolder).removeRecursively();
+                if (!QDir(contentFolder).exists())
+                {
+                    AZ_Warning(AssetProcessor::DebugChannel, false, "Preparing remote job failed. Unable to create %s on the server.\n", contentFolder.toUtf8().constData());
+                    return false;
+                }
             }
+        }
 
+        const QString jobFolder = serverDir.filePath(QString("%1/%2").arg(QString(s_remoteJobsFolderName), AZ::Uuid::CreateRandom().ToString<AZStd::string>(false, false).c_str()));
+        if (!QDir().mkpath(jobFolder))
+        {
+            AZ_Warning(AssetProcessor::DebugChannel, false, "Preparing remote job failed. Unable to create %s on the server.\n", jobFolder.toUtf8().constData());
+            return false;
         }
-        return allSuccess;
+
+        const QString remoteServerAddress = AssetUtilities::RemoteServerAddress();
+        const QString remoteContentFolder = TranslateServerPath(contentFolder, serverAddress, remoteServerAddress);
+        remoteRequest.m_watchFolder = remoteContentFolder.toUtf8().constData();
+        remoteRequest.m_sourceFile = sourceInfo.fileName().toUtf8().constData();
+        remoteRequest.m_fullPath = QDir(remoteContentFolder).filePath(sourceInfo.fileName()).toUtf8().constData();
+        remoteRequest.m_tempDirPath = TranslateServerPath(jobFolder, serverAddress, remoteServerAddress).toUtf8().constData();
+
+        AZ_TracePrintf(AssetProcessor::DebugChannel, "Prepared remote job for %s in %s.\n", sourceInfo.fileName().toUtf8().constData(), remoteRequest.m_tempDirPath.c_str());
+        return true;
+    }
+
+    bool AssetServerHandler::FinishRemoteJob(const AssetBuilderSDK::ProcessJobRequest& localRequest, const AssetBuilderSDK::ProcessJobRequest& remoteRequest, AssetBuilderSDK::ProcessJobResponse& response)
+    {
+        const QString serverAddress = AssetUtilities::ServerAddress();
+        const QString remoteServerAddress = AssetUtilities::RemoteServerAddress();
+        const QDir jobDir(TranslateServerPath(remoteRequest.m_tempDirPath.c_str(), remoteServerAddress, serverAddress));
+        const QDir contentDir(TranslateServerPath(remoteRequest.m_watchFolder.c_str(), remoteServerAddress, serverAddress));
+        const QDir localTempDir(localRequest.m_tempDirPath.c_str());
+        const QDir localSourceDir = QFileInfo(localRequest.m_fullPath.c_str()).absoluteDir();
+
+        bool success = true;
+        for (AssetBuilderSDK::JobProduct& product : response.m_outputProducts)
+        {
+            // relative product paths are relative to the temp folder of the job.
+            QString productPath = QDir::fromNativeSeparators(product.m_productFileName.c_str());
+            productPath = QDir::isRelativePath(productPath) ? jobDir.filePath(productPath) : TranslateServerPath(productPath, remoteServerAddress, serverAddress);
+
+            QString localProductPath;
+            const QString pathInJob = jobDir.relativeFilePath(productPath);
+            const QString pathInContent = contentDir.relativeFilePath(productPath);
+            if (!pathInJob.startsWith(".."))
+            {
+                localProductPath = localTempDir.filePath(pathInJob);
+                QDir().mkpath(QFileInfo(localProductPath).absolutePath());
+                QFile::remove(localProductPath);
+                if (!QFile::copy(productPath, localProductPath))
+                {
+                    AZ_Warning(AssetProcessor::DebugChannel, false, "Finishing remote job failed. Unable to retrieve %s from the server.\n", productPath.toUtf8().constData());
+                    success = false;
+                    break;
+                }
+            }
+            else if (!pathInContent.startsWith(".."))
+            {
+                // builders that emit an input as a product refer to the uploaded copy, the original is the same file.
+                localProductPath = localSourceDir.filePath(pathInContent);
+            }
+            else
+            {
+                AZ_Warning(AssetProcessor::DebugChannel, false, "Finishing remote job failed. Product %s was written outside of the job folder.\n", productPath.toUtf8().constData());
+                success = false;
+                break;
+            }
+
+            product.m_productFileName = localProductPath.toUtf8().constData();
+        }
+
+        // the uploaded inputs stay, other jobs with the same inputs reuse them.
+        QDir(jobDir.path()).removeRecursively();
+        return success;
     }
 }// AssetProcessor
@@ -22,15 +22,21 @@ namespace AssetProcessor
         //////////////////////////////////////////////////////////////////////////
         // AssetServerBus::Handler overrides
         bool IsServerAddressValid();
-        //! StoreJobResult will store all the files in the the temp folder provided by AP to a zip file on the network drive 
-        //! whose file name will be based on the server key
+        //! StoreJobResult will store every file in the temp folder provided by AP on the network drive under a name derived from its contents,
+        //! so identical files are only stored once, and write a manifest named after the server key listing them.
         bool StoreJobResult(const AssetProcessor::BuilderParams& builderParams, AZStd::vector<AZStd::string>& sourceFileList)  override;
-        //! RetrieveJobResult will retrieve the zip file from the network share associated with the server key and unzip it to the temporary directory provided by AP.
+        //! RetrieveJobResult will copy the files listed in the manifest associated with the server key to the temporary directory provided by AP.
+        //! If there is no manifest, it falls back to the zip file older versions stored for the server key.
         bool RetrieveJobResult(const AssetProcessor::BuilderParams& builderParams) override;
+        //! PrepareRemoteJob copies the source file and its sidecar files into a folder on the network share named after a hash
+        //! of their contents, so jobs of every platform for the same inputs share one upload, and creates a job folder on
+        //! the share for the remote builder agent to use as its temp folder.
+        bool PrepareRemoteJob(AssetBuilderSDK::ProcessJobRequest& remoteRequest) override;
+        //! FinishRemoteJob copies the products out of the job folder into the local temp folder and deletes the job folder.
+        bool FinishRemoteJob(const AssetBuilderSDK::ProcessJobRequest& localRequest, const AssetBuilderSDK::ProcessJobRequest& remoteRequest, AssetBuilderSDK::ProcessJobResponse& response) override;
     protected:
-        //! Source files intended to be copied into the cache don't go through out temp folder so they need
-        //! to be added to the Archive in an additional step
-        bool AddSourceFilesToArchive(const AssetProcessor::BuilderParams& builderParams, const QString& archivePath, AZStd::vector<AZStd::string>& sourceFileList);
+        //! Copies the files listed in the manifest from the product cache to the temp folder of the job.
+        bool RetrieveFromProductCache(const AssetProcessor::BuilderParams& builderParams, const QString& manifestPath);
         
         //////////////////////////////////////////////////////////////////////////
     };
@@ -244,6 +244,14 @@ namespace AssetProcessor
         //! and put them in the temporary directory provided by the builderParam.
         //! This will return true if it was able to retrieve all the relevant job data from the server, otherwise return false. 
         virtual bool RetrieveJobResult(const AssetProcessor::BuilderParams& builderParams) = 0;
+        //! PrepareRemoteJob should make the inputs of the job available to remote builder agents and rewrite the request
+        //! so that it only refers to locations on the server, as seen by the agents.
+        //! This will return true if the job can be sent to a remote builder agent, otherwise return false.
+        virtual bool PrepareRemoteJob(AssetBuilderSDK::ProcessJobRequest& remoteRequest) = 0;
+        //! FinishRemoteJob should bring the products written by a remote builder agent back into the temporary directory
+        //! of the local request, update the product paths of the response to match, and clean up what PrepareRemoteJob left on the server.
+        //! This will return true if all the products were retrieved, otherwise return false.
+        virtual bool FinishRemoteJob(const AssetBuilderSDK::ProcessJobRequest& localRequest, const AssetBuilderSDK::ProcessJobRequest& remoteRequest, AssetBuilderSDK::ProcessJobResponse& response) = 0;
     };
 
     using AssetServerBus = AZ::EBus<AssetServerBusTraits>;
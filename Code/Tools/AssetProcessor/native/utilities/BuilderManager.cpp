@@ -6,6 +6,7 @@
  */
 
 #include "BuilderManager.h"
+#include <AzCore/std/algorithm.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/Utils/Utils.h>
 
@@ -28,6 +29,9 @@ namespace AssetProcessor
     // builder DLL, so we give them a large margin.
     static const int s_StartupConnectionWaitTimeS = 120;
 
+    //! Time in milliseconds a batch waits for more jobs of its builder before it is sent, unless it fills up first
+    static const int s_ProcessJobBatchWindowMS = 20;
+
     static const int s_MillisecondsInASecond = 1000;
 
     static const char* s_buildersFolderName = "Builders";
@@ -89,6 +93,11 @@ namespace AssetProcessor
         return true;
     }
 
+    bool Builder::IsRemote() const
+    {
+        return m_remote;
+    }
+
     void Builder::SetConnection(AZ::u32 connId)
     {
         m_connectionId = connId;
@@ -354,6 +363,8 @@ namespace AssetProcessor
                     }
                 });
 
+        m_allowRemoteBuilders = AssetUtilities::RemoteBuildersEnabled();
+
         m_quitListener.BusConnect();
         BusConnect();
     }
@@ -413,10 +424,15 @@ namespace AssetProcessor
             {
                 builder = itr->second;
             }
-            else if (m_allowUnmanagedBuilderConnections)
+            else if (m_allowUnmanagedBuilderConnections || m_allowRemoteBuilders)
             {
                 AZ_TracePrintf("BuilderManager", "External builder connection accepted\n");
                 builder = AddNewBuilder();
+                if (builder)
+                {
+                    // builders we did not start are agents on other machines, unless they are being debugged locally
+                    builder->m_remote = !m_allowUnmanagedBuilderConnections;
+                }
             }
             else
             {
@@ -480,7 +496,8 @@ namespace AssetProcessor
             {
                 auto& builder = itr->second;
 
-                if (!builder->m_busy)
+                // remote builders can't reach local files, they only take jobs through GetRemoteBuilder
+                if (!builder->m_busy && !builder->m_remote)
                 {
                     builder->PumpCommunicator();
 
@@ -526,6 +543,124 @@ namespace AssetProcessor
         return builderRef;
     }
 
+    BuilderRef BuilderManager::GetRemoteBuilder()
+    {
+        AZStd::unique_lock<AZStd::mutex> lock(m_buildersMutex);
+
+        for (auto itr = m_builders.begin(); itr != m_builders.end(); )
+        {
+            auto& builder = itr->second;
+
+            if (!builder->m_busy && builder->m_remote)
+            {
+                if (builder->IsValid())
+                {
+                    return BuilderRef(builder);
+                }
+                else
+                {
+                    itr = m_builders.erase(itr);
+                }
+            }
+            else
+            {
+                ++itr;
+            }
+        }
+
+        return {};
+    }
+
+    BuilderRunJobOutcome BuilderManager::RunProcessJobInBatch(const AssetBuilderSDK::ProcessJobRequest& request, AssetBuilderSDK::ProcessJobResponse& response,
+        AZ::u32 maxBatchSize, AZ::u32 processTimeoutLimitInSeconds, const AZStd::string& modulePath)
+    {
+        AZStd::shared_ptr<ProcessJobBatch> batch;
+        size_t indexInBatch = 0;
+        bool openedBatch = false;
+
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_batchesMutex);
+
+            AZStd::shared_ptr<ProcessJobBatch>& openBatch = m_openBatches[request.m_builderGuid];
+            if (!openBatch)
+            {
+                openBatch = AZStd::make_shared<ProcessJobBatch>();
+                openBatch->m_maxBatchSize = AZStd::max(maxBatchSize, 1u);
+                openedBatch = true;
+            }
+            batch = openBatch;
+
+            indexInBatch = batch->m_request.m_requests.size();
+            batch->m_request.m_requests.push_back(request);
+
+            if (batch->m_request.m_requests.size() >= batch->m_maxBatchSize)
+            {
+                // later jobs start the next batch
+                batch->m_full = true;
+                openBatch.reset();
+                batch->m_condition.notify_all();
+            }
+        }
+
+        if (openedBatch)
+        {
+            // the job that opened the batch gives the others a moment to join, then sends it
+            {
+                AZStd::unique_lock<AZStd::mutex> lock(m_batchesMutex);
+                batch->m_condition.wait_for(lock, AZStd::chrono::milliseconds(s_ProcessJobBatchWindowMS), [&batch]() { return batch->m_full; });
+
+                auto openBatchItr = m_openBatches.find(request.m_builderGuid);
+                if (openBatchItr != m_openBatches.end() && openBatchItr->second == batch)
+                {
+                    m_openBatches.erase(openBatchItr);
+                }
+            }
+
+            BuilderRunJobOutcome outcome = BuilderRunJobOutcome::ResponseFailure;
+            BuilderRef builderRef = GetBuilder();
+            if (builderRef)
+            {
+                // the jobs of a batch run one after the other, each of them gets the full time limit.
+                // Cancelling one job does not interrupt the others, the job is reported cancelled once the batch is done.
+                const AZ::u32 batchTimeoutLimitInSeconds = processTimeoutLimitInSeconds * aznumeric_cast<AZ::u32>(batch->m_request.m_requests.size());
+                int retryCount = 0;
+                do
+                {
+                    retryCount++;
+                    outcome = builderRef->RunJob<AssetBuilderSDK::ProcessJobBatchNetRequest, AssetBuilderSDK::ProcessJobBatchNetResponse>(batch->m_request, batch->m_response,
+                        batchTimeoutLimitInSeconds, "process", modulePath, nullptr, request.m_tempDirPath);
+                } while (outcome == BuilderRunJobOutcome::LostConnection && retryCount <= AssetProcessor::RetriesForJobNetworkError);
+
+                if (outcome == BuilderRunJobOutcome::Ok && batch->m_response.m_responses.size() != batch->m_request.m_requests.size())
+                {
+                    AZ_Error("BuilderManager", false, "Builder returned %zu responses for a batch of %zu jobs", batch->m_response.m_responses.size(), batch->m_request.m_requests.size());
+                    outcome = BuilderRunJobOutcome::FailedToDecodeResponse;
+                }
+            }
+            else
+            {
+                AZ_Error("BuilderManager", false, "Failed to retrieve a valid builder to process a batch of jobs");
+            }
+
+            AZStd::lock_guard<AZStd::mutex> lock(m_batchesMutex);
+            batch->m_outcome = outcome;
+            batch->m_done = true;
+            batch->m_condition.notify_all();
+        }
+        else
+        {
+            AZStd::unique_lock<AZStd::mutex> lock(m_batchesMutex);
+            batch->m_condition.wait(lock, [&batch]() { return batch->m_done; });
+        }
+
+        // every job of the batch only touches its own response, and the batch is no longer written to
+        if (batch->m_outcome == BuilderRunJobOutcome::Ok)
+        {
+            response = AZStd::move(batch->m_response.m_responses[indexInBatch]);
+        }
+        return batch->m_outcome;
+    }
+
     void BuilderManager::PumpIdleBuilders()
     {
         AZStd::lock_guard<AZStd::mutex> lock(m_buildersMutex);
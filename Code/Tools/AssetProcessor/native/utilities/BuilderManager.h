@@ -8,6 +8,7 @@
 
 #include <AzCore/std/string/string.h>
 #include <AzCore/std/parallel/binary_semaphore.h>
+#include <AzCore/std/parallel/condition_variable.h>
 #include <AzFramework/Process/ProcessWatcher.h>
 #include <AssetBuilderSDK/AssetBuilderSDK.h>
 #include <AzCore/std/smart_ptr/shared_ptr.h>
@@ -26,6 +27,17 @@ namespace AssetProcessor
     //! Indicates if job request files should be created on success.  Can be useful for debugging
     static const bool s_createRequestFileForSuccessfulJob = false;
 
+    enum class BuilderRunJobOutcome
+    {
+        Ok,
+        LostConnection,
+        ProcessTerminated,
+        JobCancelled,
+        ResponseFailure,
+        FailedToDecodeResponse,
+        FailedToWriteDebugRequest
+    };
+
     //! This EBUS is used to request a free builder from the builder manager pool
     class BuilderManagerBusTraits
         : public AZ::EBusTraits
@@ -39,21 +51,18 @@ namespace AssetProcessor
 
         //! Returns a builder for doing work
         virtual BuilderRef GetBuilder() = 0;
-    };
 
-    using BuilderManagerBus = AZ::EBus<BuilderManagerBusTraits>;
+        //! Returns an idle builder agent running on another machine, or an empty reference if none is free
+        virtual BuilderRef GetRemoteBuilder() = 0;
 
-    enum class BuilderRunJobOutcome
-    {
-        Ok,
-        LostConnection,
-        ProcessTerminated,
-        JobCancelled,
-        ResponseFailure,
-        FailedToDecodeResponse,
-        FailedToWriteDebugRequest
+        //! Sends the job to a builder in one request together with the other jobs of the same builder arriving in a short window,
+        //! up to maxBatchSize jobs, and blocks until the response of the job is received or the request fails.
+        virtual BuilderRunJobOutcome RunProcessJobInBatch(const AssetBuilderSDK::ProcessJobRequest& request, AssetBuilderSDK::ProcessJobResponse& response,
+            AZ::u32 maxBatchSize, AZ::u32 processTimeoutLimitInSeconds, const AZStd::string& modulePath) = 0;
     };
 
+    using BuilderManagerBus = AZ::EBus<BuilderManagerBusTraits>;
+
     //! Wrapper for managing a single builder process and sending job requests to it
     class Builder
     {
@@ -79,6 +88,9 @@ namespace AssetProcessor
         //! Returns true if the builder exe has established a connection
         bool IsConnected() const;
 
+        //! Returns true if the builder is an agent running on another machine, which can only access files on the asset server
+        bool IsRemote() const;
+
         //! Blocks waiting for the builder to establish a connection
         bool WaitForConnection();
 
@@ -117,6 +129,9 @@ namespace AssetProcessor
         //! Indicates if the builder is currently in use
         bool m_busy = false;
 
+        //! Indicates if the builder connected from another machine rather than being started by us
+        bool m_remote = false;
+
         AZStd::atomic<AZ::u32> m_connectionId = 0;
 
         //! Signals the exe has successfully established a connection
@@ -169,9 +184,25 @@ namespace AssetProcessor
 
         //BuilderManagerBus
         BuilderRef GetBuilder() override;
+        BuilderRef GetRemoteBuilder() override;
+        BuilderRunJobOutcome RunProcessJobInBatch(const AssetBuilderSDK::ProcessJobRequest& request, AssetBuilderSDK::ProcessJobResponse& response,
+            AZ::u32 maxBatchSize, AZ::u32 processTimeoutLimitInSeconds, const AZStd::string& modulePath) override;
 
     private:
 
+        //! Jobs of one builder collected to be sent to a builder process in a single request
+        struct ProcessJobBatch
+        {
+            AssetBuilderSDK::ProcessJobBatchRequest m_request;
+            AssetBuilderSDK::ProcessJobBatchResponse m_response;
+            AZ::u32 m_maxBatchSize = 1;
+            BuilderRunJobOutcome m_outcome = BuilderRunJobOutcome::ResponseFailure;
+            bool m_full = false;
+            bool m_done = false;
+            //! Signals m_full to the job that opened the batch and m_done to every job of the batch, guarded by m_batchesMutex
+            AZStd::condition_variable m_condition;
+        };
+
         //! Makes a new builder, adds it to the pool, and returns a shared pointer to it
         AZStd::shared_ptr<Builder> AddNewBuilder();
 
@@ -188,6 +219,14 @@ namespace AssetProcessor
         //! Indicates if we allow builders to connect that we haven't started up ourselves.  Useful for debugging
         bool m_allowUnmanagedBuilderConnections = false;
 
+        //! Indicates if builder agents on other machines may connect and take jobs, see AssetUtilities::RemoteBuildersEnabled
+        bool m_allowRemoteBuilders = false;
+
+        AZStd::mutex m_batchesMutex;
+
+        //! Batch that jobs of each builder currently join, keyed by the builder's bus ID.  Must be locked before accessing
+        AZStd::unordered_map<AZ::Uuid, AZStd::shared_ptr<ProcessJobBatch>> m_openBatches;
+
         //! Responsible for going through all the idle builders and pumping their communicators so they don't stall
         AZStd::thread m_pollingThread;
 
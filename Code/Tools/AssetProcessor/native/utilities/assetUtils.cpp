@@ -8,6 +8,7 @@
 
 #include <AzCore/Component/ComponentApplication.h>
 #include <AzCore/Math/Sha1.h>
+#include <AzCore/Math/XxHash64.h>
 
 #include "native/utilities/PlatformConfiguration.h"
 #include "native/AssetManager/FileStateCache.h"
@@ -36,7 +37,6 @@
 #include <AzFramework/API/ApplicationAPI.h>
 #include <AzFramework/Platform/PlatformDefaults.h>
 #include <AzToolsFramework/UI/Logging/LogLine.h>
-#include <xxhash/xxhash.h>
 
 #if defined(AZ_PLATFORM_WINDOWS)
 #   include <windows.h>
@@ -629,6 +629,65 @@ namespace AssetUtilities
         return QString();
     }
 
+    bool SharedProductCacheEnabled()
+    {
+        bool sharedProductCache = false;
+        if (auto settingsRegistry = AZ::SettingsRegistry::Get())
+        {
+            settingsRegistry->Get(sharedProductCache, AZ::SettingsRegistryInterface::FixedValueString(AssetProcessor::AssetProcessorSettingsKey)
+                + "/Server/sharedProductCache");
+        }
+        return sharedProductCache && !ServerAddress().isEmpty();
+    }
+
+    bool RemoteBuildersEnabled()
+    {
+        bool remoteBuilders = false;
+        if (auto settingsRegistry = AZ::SettingsRegistry::Get())
+        {
+            settingsRegistry->Get(remoteBuilders, AZ::SettingsRegistryInterface::FixedValueString(AssetProcessor::AssetProcessorSettingsKey)
+                + "/Server/remoteBuilders");
+        }
+        return remoteBuilders;
+    }
+
+    bool IsRemoteBuildAllowed(const AZStd::string& builderName)
+    {
+        AZStd::string builderNames;
+        if (auto settingsRegistry = AZ::SettingsRegistry::Get())
+        {
+            settingsRegistry->Get(builderNames, AZ::SettingsRegistryInterface::FixedValueString(AssetProcessor::AssetProcessorSettingsKey)
+                + "/Server/remoteBuilderNames");
+        }
+
+        AZStd::vector<AZStd::string> allowedBuilders;
+        AZ::StringFunc::Tokenize(builderNames, allowedBuilders, ',');
+        for (AZStd::string& allowedBuilder : allowedBuilders)
+        {
+            if (AZ::StringFunc::Equal(AZ::StringFunc::TrimWhiteSpace(allowedBuilder, true, true), builderName))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    QString RemoteServerAddress()
+    {
+        AZStd::string address;
+        if (auto settingsRegistry = AZ::SettingsRegistry::Get())
+        {
+            settingsRegistry->Get(address, AZ::SettingsRegistryInterface::FixedValueString(AssetProcessor::AssetProcessorSettingsKey)
+                + "/Server/remoteCacheServerAddress");
+        }
+
+        if (address.empty())
+        {
+            return ServerAddress();
+        }
+        return QString::fromUtf8(address.data(), aznumeric_cast<int>(address.size()));
+    }
+
     bool ShouldUseFileHashing()
     {
         // Check if the settings file is overridden, if so, use the override instead
@@ -1194,19 +1253,8 @@ namespace AssetUtilities
         {
             AZ::IO::SizeType bytesRead;
 
-            auto* state = XXH64_createState();
-
-            if(state == nullptr)
-            {
-                AZ_Assert(false, "Failed to create hash state");
-                return 0;
-            }
-
-            if (XXH64_reset(state, 0) == XXH_ERROR)
-            {
-                AZ_Assert(false, "Failed to reset hash state");
-                return 0;
-            }
+            // Same values as the xxhash library's XXH64 used previously, so the hashes stored in the asset database stay valid
+            AZ::XxHash64 hash;
 
             do
             {
@@ -1225,7 +1273,7 @@ namespace AssetUtilities
                     *bytesReadOut += bytesRead;
                 }
 
-                XXH64_update(state, buffer, bytesRead);
+                hash.Update(buffer, bytesRead);
 #ifdef AZ_TESTS_ENABLED
                 // Used by unit tests to force the race condition mentioned above, to verify the crash fix.
                 if(hashMsDelay > 0)
@@ -1236,11 +1284,7 @@ namespace AssetUtilities
 
             } while (bytesRead > 0);
 
-            auto hash = XXH64_digest(state);
-
-            XXH64_freeState(state);
-
-            return hash;
+            return hash.GetDigest();
         }
         return 0;
     }
@@ -90,6 +90,20 @@ namespace AssetUtilities
     //! Reads the server address from the config file.
     QString ServerAddress();
 
+    //! Checks the config file to see if every job should look for its products in the shared product cache of the server
+    //! before being processed, rather than only the jobs of the recognizers and builders that ask for it.
+    bool SharedProductCacheEnabled();
+
+    //! Checks the config file to see if AssetBuilder agents running on other machines may connect and take jobs.
+    bool RemoteBuildersEnabled();
+
+    //! Checks the config file to see if jobs of the given builder may be sent to a remote AssetBuilder agent.
+    //! Only builders that read nothing but the source file and its sidecar files should be listed.
+    bool IsRemoteBuildAllowed(const AZStd::string& builderName);
+
+    //! Reads the address of the server as seen by the remote AssetBuilder agents, which defaults to ServerAddress().
+    QString RemoteServerAddress();
+
     bool ShouldUseFileHashing();
 
     //! Determine the name of the current project - for example, AutomatedTesting
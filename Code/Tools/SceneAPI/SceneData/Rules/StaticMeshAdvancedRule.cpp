@@ -26,6 +26,7 @@ namespace AZ
                 : m_use32bitVertices(false)
                 , m_mergeMeshes(true)
                 , m_useCustomNormals(true)
+                , m_generateMeshlets(false)
             {
                 AZ::SceneAPI::Events::AssetImportRequestBus::Broadcast(&AZ::SceneAPI::Events::AssetImportRequestBus::Events::AreCustomNormalsUsed, m_useCustomNormals);
             }
@@ -60,6 +61,16 @@ namespace AZ
                 return m_useCustomNormals;
             }
 
+            void StaticMeshAdvancedRule::SetGenerateMeshlets(bool value)
+            {
+                m_generateMeshlets = value;
+            }
+
+            bool StaticMeshAdvancedRule::GenerateMeshlets() const
+            {
+                return m_generateMeshlets;
+            }
+
             void StaticMeshAdvancedRule::SetVertexColorStreamName(const AZStd::string& name)
             {
                 m_vertexColorStreamName = name;
@@ -89,11 +100,12 @@ namespace AZ
                     return;
                 }
 
-                serializeContext->Class<StaticMeshAdvancedRule, DataTypes::IMeshAdvancedRule>()->Version(6)
+                serializeContext->Class<StaticMeshAdvancedRule, DataTypes::IMeshAdvancedRule>()->Version(7)
                     ->Field("use32bitVertices", &StaticMeshAdvancedRule::m_use32bitVertices)
                     ->Field("mergeMeshes", &StaticMeshAdvancedRule::m_mergeMeshes)
                     ->Field("useCustomNormals", &StaticMeshAdvancedRule::m_useCustomNormals)
-                    ->Field("vertexColorStreamName", &StaticMeshAdvancedRule::m_vertexColorStreamName);
+                    ->Field("vertexColorStreamName", &StaticMeshAdvancedRule::m_vertexColorStreamName)
+                    ->Field("generateMeshlets", &StaticMeshAdvancedRule::m_generateMeshlets);
 
                 EditContext* editContext = serializeContext->GetEditContext();
                 if (editContext)
@@ -110,6 +122,8 @@ namespace AZ
                             ->Attribute(AZ::Edit::Attributes::TrueText, "32-bit")
                         ->DataElement(Edit::UIHandlers::Default, &StaticMeshAdvancedRule::m_mergeMeshes, "Merge Meshes", "Merge all meshes into one single mesh.")
                         ->DataElement(Edit::UIHandlers::Default, &StaticMeshAdvancedRule::m_useCustomNormals, "Use Custom Normals", "Use custom normals from DCC data or average them.")
+                        ->DataElement(Edit::UIHandlers::Default, &StaticMeshAdvancedRule::m_generateMeshlets, "Generate Meshlets",
+                            "Split the meshes into clusters of up to 124 triangles with bounds and normal cones, so dense meshes can be culled per cluster.")
                         ->DataElement("NodeListSelection", &StaticMeshAdvancedRule::m_vertexColorStreamName, "Vertex Color Stream",
                             "Select a vertex color stream to enable Vertex Coloring or 'Disable' to turn Vertex Coloring off.\n\n"
                             "Vertex Coloring works in conjunction with materials. If a material was previously generated,\n"
@@ -43,6 +43,9 @@ namespace AZ
                 void SetUseCustomNormals(bool value);
                 bool UseCustomNormals() const override;
 
+                void SetGenerateMeshlets(bool value);
+                bool GenerateMeshlets() const;
+
                 void SetVertexColorStreamName(const AZStd::string& name);
                 void SetVertexColorStreamName(AZStd::string&& name);
                 const AZStd::string& GetVertexColorStreamName() const override;
@@ -55,6 +58,7 @@ namespace AZ
                 bool m_use32bitVertices;
                 bool m_mergeMeshes;
                 bool m_useCustomNormals;
+                bool m_generateMeshlets;
             };
         } // SceneData
     } // SceneAPI
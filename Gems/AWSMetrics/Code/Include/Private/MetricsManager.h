@@ -116,7 +116,19 @@ namespace AWSMetrics
         //! @return Outcome of the operation.
         AZ::Outcome<void, AZStd::string> SendMetricsToFile(AZStd::shared_ptr<MetricsQueue> metricsQueue);
 
+        //! Append metrics events to the local metrics file, after the metrics events it already contains.
+        //! @param metricsQueue Metrics events to append.
+        //! @return Outcome of the operation.
+        AZ::Outcome<void, AZStd::string> AppendMetricsToFile(const MetricsQueue& metricsQueue);
+
+        //! Write the metrics events after the ones of the local metrics file by reading and serializing the whole file again.
+        //! Only used when the new metrics events can't be inserted at the end of the existing file.
+        //! @param metricsQueue Metrics events to append.
+        //! @return Outcome of the operation.
+        AZ::Outcome<void, AZStd::string> RewriteMetricsFile(const MetricsQueue& metricsQueue);
+
         //! Push metrics events to the front of the queue for retry.
+        //! Metrics events which don't fit in the queue anymore are moved to the local metrics file, and dropped if that fails.
         //! @param metricsEventsForRetry Metrics events for retry.
         void PushMetricsForRetry(MetricsQueue& metricsEventsForRetry);
 
@@ -22,6 +22,7 @@ namespace AWSMetrics
         //! Add a new metrics to the queue.
         //! @param metrics Metrics to add.
         void AddMetrics(const MetricsEvent& metrics);
+        void AddMetrics(MetricsEvent&& metrics);
 
         //! Append an existing metrics queue to the current queue.
         //! @param metricsQueue metrics queue to append.
@@ -33,8 +34,9 @@ namespace AWSMetrics
 
         //! Filter out lower priority metrics event in the queue if the queue size reaches the maximum capacity.
         //! @param maxSizeInBytes Maximum capacity of the queue.
-        //! @return Total number of metrics events dropped because of the size limit.
-        int FilterMetricsByPriority(size_t maxSizeInBytes);
+        //! @param filteredMetrics Optional queue receiving the metrics events filtered out, which are discarded otherwise.
+        //! @return Total number of metrics events filtered out because of the size limit.
+        int FilterMetricsByPriority(size_t maxSizeInBytes, MetricsQueue* filteredMetrics = nullptr);
 
         //! Empty the metrics queue.
         //! Unsubmitted metrics will be lost after this operation.
@@ -48,7 +50,7 @@ namespace AWSMetrics
 
         //! Serialize the metrics events queue to a string.
         //! @return Serialized string.
-        AZStd::string SerializeToJson();
+        AZStd::string SerializeToJson() const;
 
         //! Serialize the metrics queue to JSON for sending requests.
         //! @param writer JSON writer for the serialization.
@@ -21,6 +21,63 @@
 
 namespace AWSMetrics
 {
+    namespace
+    {
+        //! Number of bytes read from the end of the local metrics file to find where its JSON array ends.
+        constexpr AZ::u64 MetricsFileTailSizeInBytes = 64;
+
+        bool IsJsonWhitespace(char character)
+        {
+            return character == ' ' || character == '\n' || character == '\r' || character == '\t';
+        }
+
+        //! Find the closing bracket of the JSON array stored in the local metrics file.
+        //! @param fileIO File IO instance used to read the file.
+        //! @param fileHandle Handle of the file opened for reading.
+        //! @param closingBracketOffset Offset of the closing bracket from the start of the file.
+        //! @param isEmptyArray Whether the array contains no metrics event.
+        //! @return Whether the end of the array is found.
+        bool FindMetricsArrayEnd(AZ::IO::FileIOBase* fileIO, AZ::IO::HandleType fileHandle, AZ::u64& closingBracketOffset, bool& isEmptyArray)
+        {
+            AZ::u64 fileSize = 0;
+            if (!fileIO->Size(fileHandle, fileSize) || fileSize == 0)
+            {
+                return false;
+            }
+
+            const AZ::u64 tailSize = AZ::GetMin(fileSize, MetricsFileTailSizeInBytes);
+            char tail[MetricsFileTailSizeInBytes];
+            if (!fileIO->Seek(fileHandle, static_cast<AZ::s64>(fileSize - tailSize), AZ::IO::SeekType::SeekFromStart) ||
+                !fileIO->Read(fileHandle, tail, tailSize, true))
+            {
+                return false;
+            }
+
+            AZ::s64 index = static_cast<AZ::s64>(tailSize) - 1;
+            while (index >= 0 && IsJsonWhitespace(tail[index]))
+            {
+                --index;
+            }
+            if (index < 0 || tail[index] != ']')
+            {
+                return false;
+            }
+            closingBracketOffset = fileSize - tailSize + index;
+
+            do
+            {
+                --index;
+            } while (index >= 0 && IsJsonWhitespace(tail[index]));
+            if (index < 0)
+            {
+                return false;
+            }
+            isEmptyArray = tail[index] == '[';
+
+            return true;
+        }
+    }
+
     MetricsManager::MetricsManager()
         : m_clientConfiguration(AZStd::make_unique<ClientConfiguration>())
         , m_clientIdProvider(IdentityProvider::CreateIdentityProvider())
@@ -291,16 +348,44 @@ namespace AWSMetrics
             return;
         }
 
-        // Push failed events to the front of the queue and reserve the order.
-        AZStd::lock_guard<AZStd::mutex> lock(m_metricsMutex);
-        m_metricsQueue.PushMetricsToFront(metricsEventsForRetry);
+        MetricsQueue metricsEventsToSpill;
+        {
+            // Push failed events to the front of the queue and reserve the order.
+            AZStd::lock_guard<AZStd::mutex> lock(m_metricsMutex);
+            m_metricsQueue.PushMetricsToFront(metricsEventsForRetry);
 
-        // Filter metrics events by priority since the queue might be full.
-        m_globalStats.m_numDropped += m_metricsQueue.FilterMetricsByPriority(m_clientConfiguration->GetMaxQueueSizeInBytes());
+            // Filter metrics events by priority since the queue might be full.
+            m_metricsQueue.FilterMetricsByPriority(m_clientConfiguration->GetMaxQueueSizeInBytes(), &metricsEventsToSpill);
+        }
+
+        if (metricsEventsToSpill.GetNumMetrics() == 0)
+        {
+            return;
+        }
+
+        // Keep the metrics events which don't fit in memory in the local metrics file instead of dropping them,
+        // so an offline or slow connection doesn't grow the queue. They are resubmitted with the other local metrics.
+        AZ::Outcome<void, AZStd::string> outcome = AppendMetricsToFile(metricsEventsToSpill);
+        if (!outcome.IsSuccess())
+        {
+            AZ_Warning("AWSMetrics", false, "Failed to move the metrics events exceeding the queue size to the local metrics file: %s", outcome.GetError().c_str());
+            m_globalStats.m_numDropped += metricsEventsToSpill.GetNumMetrics();
+        }
     }
 
     AZ::Outcome<void, AZStd::string> MetricsManager::SendMetricsToFile(AZStd::shared_ptr<MetricsQueue> metricsQueue)
     {
+        // Do not modify the metrics queue in the request directly for identifying the metrics events for retry on failure.
+        return AppendMetricsToFile(*metricsQueue);
+    }
+
+    AZ::Outcome<void, AZStd::string> MetricsManager::AppendMetricsToFile(const MetricsQueue& metricsQueue)
+    {
+        if (metricsQueue.GetNumMetrics() == 0)
+        {
+            return AZ::Success();
+        }
+
         AZStd::lock_guard<AZStd::mutex> lock(m_metricsFileMutex);
 
         AZ::IO::FileIOBase* fileIO = AZ::IO::FileIOBase::GetDirectInstance();
@@ -311,23 +396,70 @@ namespace AWSMetrics
 
         const char* metricsFileFullPath = m_clientConfiguration->GetMetricsFileFullPath();
         const char* metricsFileDir = m_clientConfiguration->GetMetricsFileDir();
-        MetricsQueue existingMetricsEvents;
         if (!metricsFileFullPath || !metricsFileDir)
         {
             return AZ::Failure(AZStd::string{ "Failed to get the metrics file directory or path." });
         }
-        if (fileIO->Exists(metricsFileFullPath) && !existingMetricsEvents.ReadFromJson(metricsFileFullPath))
+
+        if (!fileIO->Exists(metricsFileFullPath))
         {
-            return AZ::Failure(AZStd::string{ "Failed to read the existing metrics on disk" });
+            if (!fileIO->Exists(metricsFileDir) && !fileIO->CreatePath(metricsFileDir))
+            {
+                return AZ::Failure(AZStd::string{ "Failed to create metrics directory" });
+            }
+
+            return RewriteMetricsFile(metricsQueue);
         }
-        else if (!fileIO->Exists(metricsFileDir) && !fileIO->CreatePath(metricsFileDir))
+
+        // Insert the new metrics events before the closing bracket of the existing JSON array, so the cost of a flush
+        // only depends on the number of new metrics events rather than on the number of metrics events already on disk.
+        AZ::IO::HandleType fileHandle;
+        if (!fileIO->Open(metricsFileFullPath, AZ::IO::OpenMode::ModeRead | AZ::IO::OpenMode::ModeUpdate | AZ::IO::OpenMode::ModeBinary, fileHandle))
         {
-            return AZ::Failure(AZStd::string{ "Failed to create metrics directory" });
+            return AZ::Failure(AZStd::string{ "Failed to open metrics file" });
         }
 
-        // Append a copy of the metrics queue in the request to the existing metrics events and keep the original submission order.
-        // Do not modify the metrics queue in the request directly for identifying the metrics events for retry on failure.
-        MetricsQueue metricsEventsInRequest = *metricsQueue;
+        AZ::u64 closingBracketOffset = 0;
+        bool isEmptyArray = false;
+        if (!FindMetricsArrayEnd(fileIO, fileHandle, closingBracketOffset, isEmptyArray))
+        {
+            fileIO->Close(fileHandle);
+            return RewriteMetricsFile(metricsQueue);
+        }
+
+        // The opening bracket of the serialized array becomes the separator or is skipped, its closing bracket replaces the existing one.
+        AZStd::string serializedMetrics = metricsQueue.SerializeToJson();
+        if (!isEmptyArray)
+        {
+            serializedMetrics[0] = ',';
+        }
+        const size_t firstCharacter = isEmptyArray ? 1 : 0;
+
+        bool written = fileIO->Seek(fileHandle, static_cast<AZ::s64>(closingBracketOffset), AZ::IO::SeekType::SeekFromStart) &&
+            fileIO->Write(fileHandle, serializedMetrics.c_str() + firstCharacter, serializedMetrics.size() - firstCharacter);
+        fileIO->Close(fileHandle);
+
+        if (!written)
+        {
+            return AZ::Failure(AZStd::string{ "Failed to write to the metrics file" });
+        }
+
+        return AZ::Success();
+    }
+
+    AZ::Outcome<void, AZStd::string> MetricsManager::RewriteMetricsFile(const MetricsQueue& metricsQueue)
+    {
+        AZ::IO::FileIOBase* fileIO = AZ::IO::FileIOBase::GetDirectInstance();
+        const char* metricsFileFullPath = m_clientConfiguration->GetMetricsFileFullPath();
+
+        MetricsQueue existingMetricsEvents;
+        if (fileIO->Exists(metricsFileFullPath) && !existingMetricsEvents.ReadFromJson(metricsFileFullPath))
+        {
+            return AZ::Failure(AZStd::string{ "Failed to read the existing metrics on disk" });
+        }
+
+        // Append a copy of the metrics events to the existing metrics events and keep the original submission order.
+        MetricsQueue metricsEventsInRequest = metricsQueue;
         existingMetricsEvents.AppendMetrics(metricsEventsInRequest);
         AZStd::string serializedMetrics = existingMetricsEvents.SerializeToJson();
 
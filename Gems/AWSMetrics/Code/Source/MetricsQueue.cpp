@@ -31,6 +31,13 @@ namespace AWSMetrics
     {
         m_sizeSerializedToJson += metrics.GetSizeInBytes();
 
+        m_metrics.emplace_back(metrics);
+    }
+
+    void MetricsQueue::AddMetrics(MetricsEvent&& metrics)
+    {
+        m_sizeSerializedToJson += metrics.GetSizeInBytes();
+
         m_metrics.emplace_back(AZStd::move(metrics));
     }
 
@@ -72,7 +79,7 @@ namespace AWSMetrics
         }
     }
 
-    int MetricsQueue::FilterMetricsByPriority(size_t maxSizeInBytes)
+    int MetricsQueue::FilterMetricsByPriority(size_t maxSizeInBytes, MetricsQueue* filteredMetrics)
     {
         if (GetSizeInBytes() < maxSizeInBytes)
         {
@@ -112,6 +119,10 @@ namespace AWSMetrics
                 m_sizeSerializedToJson += pair.first->GetSizeInBytes();
                 result.emplace_back(AZStd::move(*(pair.first)));
             }
+            else if (filteredMetrics)
+            {
+                filteredMetrics->AddMetrics(*(pair.first));
+            }
             else
             {
                 break;
@@ -141,7 +152,7 @@ namespace AWSMetrics
         return m_sizeSerializedToJson;
     }
 
-    AZStd::string MetricsQueue::SerializeToJson()
+    AZStd::string MetricsQueue::SerializeToJson() const
     {
         std::stringstream stringStream;
         AWSCore::JsonOutputStream jsonStream{stringStream};
@@ -178,7 +189,7 @@ namespace AWSMetrics
             if (curNum <= maxBatchedRecordsCount && curSizeInBytes <= maxPayloadSizeInBytes)
             {
                 m_sizeSerializedToJson -= curEvent.GetSizeInBytes();
-                bufferedEvents.AddMetrics(curEvent);
+                bufferedEvents.AddMetrics(AZStd::move(curEvent));
                 m_metrics.pop_front();
             }
             else
@@ -141,6 +141,32 @@ namespace AWSMetrics
         }
     }
 
+    TEST_F(MetricsQueueTest, FilterMetricsByPriority_WithFilteredMetricsQueue_KeepFilteredOutMetrics)
+    {
+        MetricsQueue queue;
+        for (int index = 0; index < NumTestMetrics; ++index)
+        {
+            MetricsEvent metrics;
+            metrics.AddAttribute(MetricsAttribute(AttrName, AttrValue));
+            metrics.SetEventPriority(index % 2);
+
+            queue.AddMetrics(metrics);
+        }
+
+        int maxCapacity = queue[0].GetSizeInBytes() * NumTestMetrics / 2;
+
+        MetricsQueue filteredMetrics;
+        ASSERT_EQ(queue.FilterMetricsByPriority(maxCapacity, &filteredMetrics), NumTestMetrics / 2);
+        ASSERT_EQ(queue.GetNumMetrics(), NumTestMetrics / 2);
+        ASSERT_EQ(filteredMetrics.GetNumMetrics(), NumTestMetrics / 2);
+        ASSERT_EQ(filteredMetrics.GetSizeInBytes(), queue.GetSizeInBytes());
+
+        for (int index = 0; index < filteredMetrics.GetNumMetrics(); ++index)
+        {
+            ASSERT_EQ(filteredMetrics[index].GetEventPriority(), 1);
+        }
+    }
+
     TEST_F(MetricsQueueTest, ClearMetrics_NoneEmptyQueue_Success)
     {
         MetricsQueue queue;
@@ -12,6 +12,7 @@
 #include <Atom/ImageProcessing/ImageObject.h>
 #include <Processing/ImageToProcess.h>
 #include <Processing/PixelFormatInfo.h>
+#include <Processing/Utils.h>
 
 #include <Compressors/ISPCTextureCompressor.h>
 
@@ -174,77 +175,117 @@ namespace ImageProcessingAtom
         // Allocate the destination image
         IImageObjectPtr destinationImage(sourceImage->AllocateImage(destinationFormat));
 
-        // Compress the images per mip
+        if (!IsASTCFormat(destinationFormat) && destinationFormat != ePixelFormat_BC3 && destinationFormat != ePixelFormat_BC6UH
+            && destinationFormat != ePixelFormat_BC7 && destinationFormat != ePixelFormat_BC7t)
+        {
+            // No valid pixel format
+            AZ_Assert(false, "Unhandled pixel format %d", destinationFormat);
+            return nullptr;
+        }
+
+        // Split every mip in strips of block rows, the strips of all the mips are compressed in parallel.
+        // The blocks are independent of each other, so the result is the same as compressing the mips whole.
+        struct CompressionStrip
+        {
+            uint32 m_mip;
+            uint32 m_firstBlockRow;
+            uint32 m_blockRowCount;
+        };
+        static constexpr uint32 PixelsPerStrip = 256 * 1024;
+        AZStd::vector<CompressionStrip> strips;
+
+        const PixelFormatInfo* destinationInfo = CPixelFormats::GetInstance().GetPixelFormatInfo(destinationFormat);
+        const uint32 blockHeight = destinationInfo->blockHeight;
         const uint32 mipCount = destinationImage->GetMipCount();
         for (uint32_t mip = 0; mip < mipCount; mip++)
         {
-            // Create rgba_surface as input
-            uint32 sourcePitch = 0;
-            AZ::u8* sourceImageData = nullptr;
-            sourceImage->GetImagePointer(mip, sourceImageData, sourcePitch);
-            rgba_surface sourceSurface = {};
+            const uint32 width = sourceImage->GetWidth(mip);
+            const uint32 height = sourceImage->GetHeight(mip);
+            if (height % blockHeight != 0 || width % destinationInfo->blockWidth != 0)
             {
-                sourceSurface.ptr = sourceImageData;
-                sourceSurface.width = sourceImage->GetWidth(mip);
-                sourceSurface.height = sourceImage->GetHeight(mip);
-                sourceSurface.stride = static_cast<int32_t>(sourcePitch);
+                // Partial blocks are left to the compressor, keep these (small) mips in one piece
+                strips.push_back({ mip, 0, 0 });
+                continue;
             }
 
-            // Get the mip image destination pointer
-            uint32_t destinationPitch = 0;
-            AZ::u8* destinationImageData = nullptr;
-            destinationImage->GetImagePointer(mip, destinationImageData, destinationPitch);
-
-            // Compress with the correct function, depending on the destination format
-            switch (destinationFormat)
-            {
-            case ePixelFormat_BC3:
-                CompressBlocksBC3(&sourceSurface, destinationImageData);
-                break;
-            case ePixelFormat_BC6UH:
+            const uint32 blockRows = height / blockHeight;
+            const uint32 blockRowsPerStrip = AZStd::max(1u, PixelsPerStrip / (width * blockHeight));
+            for (uint32 firstBlockRow = 0; firstBlockRow < blockRows; firstBlockRow += blockRowsPerStrip)
             {
-                // Get the profile setter
-                bc6h_enc_settings settings = {};
-                const auto setProfile = compressionProfile->GetBC6();
-                setProfile(&settings);
-
-                // Compress with BC6 half precision
-                CompressBlocksBC6H(&sourceSurface, destinationImageData, &settings);
+                strips.push_back({ mip, firstBlockRow, AZStd::min(blockRowsPerStrip, blockRows - firstBlockRow) });
             }
-            break;
-            case ePixelFormat_BC7:
-            case ePixelFormat_BC7t:
+        }
+
+        Utils::ParallelFor(aznumeric_cast<uint32>(strips.size()), [&](uint32 stripIndex)
             {
-                // Get the profile setter
-                bc7_enc_settings settings = {};
-                const auto setProfile = compressionProfile->GetBC7(discardAlpha);
-                setProfile(&settings);
+                const CompressionStrip& strip = strips[stripIndex];
 
-                // Compress with BC7
-                CompressBlocksBC7(&sourceSurface, destinationImageData, &settings);
-            }
-            break;
-            default:
-                if (IsASTCFormat(destinationFormat))
+                // Create rgba_surface as input
+                uint32 sourcePitch = 0;
+                AZ::u8* sourceImageData = nullptr;
+                sourceImage->GetImagePointer(strip.m_mip, sourceImageData, sourcePitch);
+                rgba_surface sourceSurface = {};
+                {
+                    sourceSurface.ptr = sourceImageData;
+                    sourceSurface.width = sourceImage->GetWidth(strip.m_mip);
+                    sourceSurface.height = sourceImage->GetHeight(strip.m_mip);
+                    sourceSurface.stride = static_cast<int32_t>(sourcePitch);
+                }
+
+                // Get the mip image destination pointer, the destination pitch is the size of a row of blocks
+                uint32_t destinationPitch = 0;
+                AZ::u8* destinationImageData = nullptr;
+                destinationImage->GetImagePointer(strip.m_mip, destinationImageData, destinationPitch);
+
+                if (strip.m_blockRowCount > 0)
+                {
+                    sourceSurface.ptr += strip.m_firstBlockRow * blockHeight * sourcePitch;
+                    sourceSurface.height = strip.m_blockRowCount * blockHeight;
+                    destinationImageData += strip.m_firstBlockRow * destinationPitch;
+                }
+
+                // Compress with the correct function, depending on the destination format
+                switch (destinationFormat)
+                {
+                case ePixelFormat_BC3:
+                    CompressBlocksBC3(&sourceSurface, destinationImageData);
+                    break;
+                case ePixelFormat_BC6UH:
+                {
+                    // Get the profile setter
+                    bc6h_enc_settings settings = {};
+                    const auto setProfile = compressionProfile->GetBC6();
+                    setProfile(&settings);
+
+                    // Compress with BC6 half precision
+                    CompressBlocksBC6H(&sourceSurface, destinationImageData, &settings);
+                }
+                break;
+                case ePixelFormat_BC7:
+                case ePixelFormat_BC7t:
+                {
+                    // Get the profile setter
+                    bc7_enc_settings settings = {};
+                    const auto setProfile = compressionProfile->GetBC7(discardAlpha);
+                    setProfile(&settings);
+
+                    // Compress with BC7
+                    CompressBlocksBC7(&sourceSurface, destinationImageData, &settings);
+                }
+                break;
+                default:
                 {
-                    const PixelFormatInfo* info = CPixelFormats::GetInstance().GetPixelFormatInfo(destinationFormat);
                     astc_enc_settings settings = {};
 
                     const auto setProfile = compressionProfile->GetASTC(discardAlpha);
-                    setProfile(&settings, info->blockWidth, info->blockHeight);
+                    setProfile(&settings, destinationInfo->blockWidth, destinationInfo->blockHeight);
 
                     // Compress with ASTC
                     CompressBlocksASTC(&sourceSurface, destinationImageData, &settings);
                 }
-                else
-                {
-                    // No valid pixel format
-                    AZ_Assert(false, "Unhandled pixel format %d", destinationFormat);
-                    return nullptr;
-                }
                 break;
-            }
-        }
+                }
+            });
 
         return destinationImage;
     }
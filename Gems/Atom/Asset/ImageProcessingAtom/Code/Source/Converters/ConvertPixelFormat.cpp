@@ -11,6 +11,7 @@
 #include <Processing/ImageObjectImpl.h>
 #include <Processing/ImageToProcess.h>
 #include <Processing/PixelFormatInfo.h>
+#include <Processing/Utils.h>
 
 #include <Compressors/Compressor.h>
 #include <Converters/PixelOperation.h>
@@ -141,26 +142,48 @@ namespace ImageProcessingAtom
         uint32 srcPixelBytes = CPixelFormats::GetInstance().GetPixelFormatInfo(srcFmt)->bitsPerBlock / 8;
         uint32 dstPixelBytes = CPixelFormats::GetInstance().GetPixelFormatInfo(dstFmt)->bitsPerBlock / 8;
 
+        // split the mips in ranges of pixels which are converted in parallel
+        struct PixelRange
+        {
+            uint32 m_mip;
+            uint32 m_firstPixel;
+            uint32 m_pixelCount;
+        };
+        static constexpr uint32 PixelsPerRange = 256 * 1024;
+        AZStd::vector<PixelRange> pixelRanges;
+
         const uint32 dwMips = dstImage->GetMipCount();
-        float r, g, b, a;
         for (uint32 dwMip = 0; dwMip < dwMips; ++dwMip)
         {
-            uint8* srcPixelBuf;
-            uint32 srcPitch;
-            srcImage->GetImagePointer(dwMip, srcPixelBuf, srcPitch);
-            uint8* dstPixelBuf;
-            uint32 dstPitch;
-            dstImage->GetImagePointer(dwMip, dstPixelBuf, dstPitch);
-
             const uint32 pixelCount = srcImage->GetPixelCount(dwMip);
-
-            for (uint32 i = 0; i < pixelCount; ++i, srcPixelBuf += srcPixelBytes, dstPixelBuf += dstPixelBytes)
+            for (uint32 firstPixel = 0; firstPixel < pixelCount; firstPixel += PixelsPerRange)
             {
-                srcOp->GetRGBA(srcPixelBuf, r, g, b, a);
-                dstOp->SetRGBA(dstPixelBuf, r, g, b, a);
+                pixelRanges.push_back({ dwMip, firstPixel, AZStd::min(PixelsPerRange, pixelCount - firstPixel) });
             }
         }
 
+        Utils::ParallelFor(aznumeric_cast<uint32>(pixelRanges.size()), [&](uint32 rangeIndex)
+            {
+                const PixelRange& range = pixelRanges[rangeIndex];
+
+                uint8* srcPixelBuf;
+                uint32 srcPitch;
+                srcImage->GetImagePointer(range.m_mip, srcPixelBuf, srcPitch);
+                uint8* dstPixelBuf;
+                uint32 dstPitch;
+                dstImage->GetImagePointer(range.m_mip, dstPixelBuf, dstPitch);
+
+                srcPixelBuf += range.m_firstPixel * srcPixelBytes;
+                dstPixelBuf += range.m_firstPixel * dstPixelBytes;
+
+                float r, g, b, a;
+                for (uint32 i = 0; i < range.m_pixelCount; ++i, srcPixelBuf += srcPixelBytes, dstPixelBuf += dstPixelBytes)
+                {
+                    srcOp->GetRGBA(srcPixelBuf, r, g, b, a);
+                    dstOp->SetRGBA(dstPixelBuf, r, g, b, a);
+                }
+            });
+
         m_img = dstImage;
     }
 } // namespace ImageProcessingAtom
@@ -12,6 +12,7 @@
 #include <Processing/PixelFormatInfo.h>
 #include <Processing/ImageConvert.h>
 #include <Processing/ImageFlags.h>
+#include <Processing/Utils.h>
 
 #include <Compressors/Compressor.h>
 #include <Converters/PixelOperation.h>
@@ -550,10 +551,12 @@ namespace ImageProcessingAtom
         IImageObjectPtr mippedSourceImage(IImageObject::CreateImage(outWidth, outHeight, maxMipCount, ePixelFormat_R32G32B32A32F));
         mippedSourceImage->CopyPropertiesFrom(m_image->Get());
 
-        for (int iSide = 0; iSide < 6; ++iSide)
-        {
-            for (int iMip = 0; iMip < (int)maxMipCount; iMip++)
+        // each face of each mip is filtered from the top mip of the source into its own region, so they are generated in parallel
+        Utils::ParallelFor(6 * maxMipCount, [&](AZ::u32 taskIndex)
             {
+                const int iSide = static_cast<int>(taskIndex / maxMipCount);
+                const int iMip = static_cast<int>(taskIndex % maxMipCount);
+
                 QRect srcRect;
                 QRect dstRect;
 
@@ -571,8 +574,7 @@ namespace ImageProcessingAtom
 
                 MipGenType mipGenType = (iMip == 0 ? MipGenType::point : MipGenType::box);
                 FilterImage(mipGenType, MipGenEvalType::sum, 0, 0, m_image->Get(), 0, mippedSourceImage, iMip, &srcRect, &dstRect);
-            }
-        }
+            });
 
         //replace the source cubemap with the mipped version
         delete srcCubemap;
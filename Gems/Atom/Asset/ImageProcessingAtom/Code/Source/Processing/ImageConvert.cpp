@@ -12,6 +12,7 @@
 #include <Processing/ImageConvert.h>
 #include <Processing/ImageAssetProducer.h>
 #include <Processing/ImageFlags.h>
+#include <Processing/Utils.h>
 #include <Converters/FIR-Weights.h>
 #include <Converters/Cubemap.h>
 #include <Converters/PixelOperation.h>
@@ -494,10 +495,11 @@ namespace ImageProcessingAtom
         float blurV = 0;
 
         // fill mipmap data for uncompressed output image
-        for (uint32 mip = 0; mip < outImage->GetMipCount(); mip++)
-        {
-            FilterImage(m_input->m_textureSetting.m_mipGenType, m_input->m_textureSetting.m_mipGenEval, blurH, blurV, m_image->Get(), 0, outImage, mip, nullptr, nullptr);
-        }
+        // every mip is filtered from the top mip of the source image, so they are generated in parallel
+        Utils::ParallelFor(outImage->GetMipCount(), [&](AZ::u32 mip)
+            {
+                FilterImage(m_input->m_textureSetting.m_mipGenType, m_input->m_textureSetting.m_mipGenEval, blurH, blurV, m_image->Get(), 0, outImage, mip, nullptr, nullptr);
+            });
 
         // transfer alpha coverage
         if (m_input->m_textureSetting.m_maintainAlphaCoverage)
@@ -10,6 +10,9 @@
 #include <Atom/RPI.Reflect/Image/StreamingImageAsset.h>
 #include <Atom/RPI.Reflect/Image/StreamingImageAssetHandler.h>
 #include <Atom/Utils/DdsFile.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
 #include <AzFramework/StringFunc/StringFunc.h>
 
 #include <Processing/ImageToProcess.h>
@@ -427,6 +430,30 @@ namespace ImageProcessingAtom
             }
             return true;
         }
+
+        void ParallelFor(AZ::u32 taskCount, const AZStd::function<void(AZ::u32 taskIndex)>& taskFunction)
+        {
+            if (taskCount <= 1 || !AZ::JobContext::GetGlobalContext())
+            {
+                for (AZ::u32 taskIndex = 0; taskIndex < taskCount; ++taskIndex)
+                {
+                    taskFunction(taskIndex);
+                }
+                return;
+            }
+
+            AZ::JobCompletion jobCompletion;
+            for (AZ::u32 taskIndex = 0; taskIndex < taskCount; ++taskIndex)
+            {
+                AZ::Job* job = AZ::CreateJobFunction([&taskFunction, taskIndex]()
+                    {
+                        taskFunction(taskIndex);
+                    }, true);
+                job->SetDependent(&jobCompletion);
+                job->Start();
+            }
+            jobCompletion.StartAndWaitForCompletion();
+        }
     }
 
 } // namespace ImageProcessingAtom
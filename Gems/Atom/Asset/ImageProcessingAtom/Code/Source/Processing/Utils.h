@@ -9,6 +9,7 @@
 
 #include <Atom/ImageProcessing/ImageObject.h>
 #include <AzCore/Asset/AssetCommon.h>
+#include <AzCore/std/function/function_template.h>
 
 namespace ImageProcessingAtom
 {
@@ -25,5 +26,9 @@ namespace ImageProcessingAtom
         IImageObjectPtr LoadImageFromImageAsset(const AZ::Data::Asset<AZ::RPI::StreamingImageAsset>& asset);
 
         bool SaveImageToDdsFile(IImageObjectPtr image, AZStd::string_view filePath);
+
+        //! Runs taskFunction for each task index in [0, taskCount) on the job system and returns once all of them are done.
+        //! The tasks run sequentially on the calling thread when there is a single task or no job manager.
+        void ParallelFor(AZ::u32 taskCount, const AZStd::function<void(AZ::u32 taskIndex)>& taskFunction);
     }
 }
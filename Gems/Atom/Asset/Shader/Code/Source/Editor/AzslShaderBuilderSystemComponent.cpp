@@ -45,6 +45,7 @@ namespace AZ
             PreprocessorOptions::Reflect(context);
             RHI::ShaderCompilerProfiling::Reflect(context);
             AtomShaderConfig::CapabilitiesConfigFile::Reflect(context);
+            ShaderCompileCacheOptions::Reflect(context);
             GlobalBuildOptions::Reflect(context);
             RHI::ShaderCompilerArguments::Reflect(context);
         }
@@ -24,9 +24,10 @@ namespace AZ
             if (auto* serializeContext = azrtti_cast<SerializeContext*>(context))
             {
                 serializeContext->Class<GlobalBuildOptions>()
-                    ->Version(1)
+                    ->Version(2)
                     ->Field("PreprocessorOptions", &GlobalBuildOptions::m_preprocessorSettings)
-                    ->Field("ShaderCompilerArguments", &GlobalBuildOptions::m_compilerArguments);
+                    ->Field("ShaderCompilerArguments", &GlobalBuildOptions::m_compilerArguments)
+                    ->Field("ShaderCompileCache", &GlobalBuildOptions::m_compileCache);
             }
         }
 
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <CommonFiles/Preprocessor.h>
+#include <CommonFiles/ShaderCompileCache.h>
 #include <Atom/RHI.Edit/ShaderCompilerArguments.h>
 
 namespace AZ
@@ -26,6 +27,9 @@ namespace AZ
 
             //! command line arguments related to warnings, optimizations, matrices order and others.
             RHI::ShaderCompilerArguments m_compilerArguments;
+
+            //! where and how the platform shader compiler outputs are cached.
+            ShaderCompileCacheOptions m_compileCache;
         };
 
         //! Reads the global options used when compiling shaders. The options are defined in <GameProject>/Config/shader_global_build_options.json
@@ -0,0 +1,264 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <CommonFiles/ShaderCompileCache.h>
+
+#include <Atom/RHI.Edit/Utils.h>
+#include <Atom/RPI.Edit/Common/JsonUtils.h>
+
+#include <AssetBuilderSDK/AssetBuilderSDK.h>
+
+#include <AzCore/Component/ComponentApplicationBus.h>
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/Math/Sha1.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Settings/SettingsRegistryMergeUtils.h>
+#include <AzCore/std/sort.h>
+#include <AzCore/std/string/conversions.h>
+
+#include <AzFramework/StringFunc/StringFunc.h>
+
+namespace AZ
+{
+    namespace ShaderBuilder
+    {
+        static constexpr char ShaderCompileCacheName[] = "ShaderCompileCache";
+
+        void ShaderCompileCacheOptions::Reflect(AZ::ReflectContext* context)
+        {
+            if (auto* serializeContext = azrtti_cast<SerializeContext*>(context))
+            {
+                serializeContext->Class<ShaderCompileCacheOptions>()
+                    ->Version(0)
+                    ->Field("Enabled", &ShaderCompileCacheOptions::m_enabled)
+                    ->Field("Folder", &ShaderCompileCacheOptions::m_folder)
+                    ->Field("MaxParallelCompiles", &ShaderCompileCacheOptions::m_maxParallelCompiles)
+                    ;
+            }
+        }
+
+        namespace ShaderCompileCache
+        {
+            // Bump when the entry layout or the key composition changes.
+            static constexpr AZ::u32 CacheEntryVersion = 1;
+            static constexpr AZ::u32 CacheEntryMagic = 0x43535A41; // "AZSC"
+
+            struct CacheEntryHeader
+            {
+                AZ::u32 m_magic = CacheEntryMagic;
+                AZ::u32 m_version = CacheEntryVersion;
+                AZ::u32 m_stageType = 0;
+                AZ::u32 m_dynamicBranchCount = 0;
+                AZ::u64 m_entryFunctionNameSize = 0;
+                AZ::u64 m_byteCodeSize = 0;
+                AZ::u64 m_sourceCodeSize = 0;
+            };
+
+            //! The compilers and the platform headers prepended to the shader code all live in the Builders folder next to the
+            //! executable, so the names, sizes and time stamps of its files stand in for the compiler version.
+            static const AZStd::string& GetCompilerFingerprint()
+            {
+                static const AZStd::string fingerprint = []()
+                {
+                    AZStd::string result;
+
+                    const char* executableFolder = nullptr;
+                    AZ::ComponentApplicationBus::BroadcastResult(executableFolder, &AZ::ComponentApplicationBus::Events::GetExecutableFolder);
+                    AZ::IO::FileIOBase* fileIO = AZ::IO::FileIOBase::GetInstance();
+                    if (!executableFolder || !fileIO)
+                    {
+                        return result;
+                    }
+
+                    AZStd::vector<AZStd::string> files;
+                    AZStd::vector<AZStd::string> foldersToVisit = { (AZ::IO::Path(executableFolder) / "Builders").Native() };
+                    while (!foldersToVisit.empty())
+                    {
+                        AZStd::string folder = AZStd::move(foldersToVisit.back());
+                        foldersToVisit.pop_back();
+                        fileIO->FindFiles(folder.c_str(), "*", [&](const char* path)
+                            {
+                                if (fileIO->IsDirectory(path))
+                                {
+                                    foldersToVisit.emplace_back(path);
+                                }
+                                else
+                                {
+                                    files.emplace_back(path);
+                                }
+                                return true;
+                            });
+                    }
+                    AZStd::sort(files.begin(), files.end());
+
+                    for (const AZStd::string& file : files)
+                    {
+                        AZ::u64 fileSize = 0;
+                        fileIO->Size(file.c_str(), fileSize);
+                        result += AZStd::string::format("%s|%llu|%llu\n", file.c_str(),
+                            static_cast<unsigned long long>(fileSize), static_cast<unsigned long long>(fileIO->ModificationTime(file.c_str())));
+                    }
+                    return result;
+                }();
+                return fingerprint;
+            }
+
+            static AZ::IO::Path GetCacheFolder(const ShaderCompileCacheOptions& options)
+            {
+                if (!options.m_folder.empty())
+                {
+                    return AZ::IO::Path(options.m_folder);
+                }
+
+                AZ::IO::Path projectUserPath;
+                if (auto settingsRegistry = AZ::SettingsRegistry::Get(); settingsRegistry)
+                {
+                    settingsRegistry->Get(projectUserPath.Native(), AZ::SettingsRegistryMergeUtils::FilePathKey_ProjectUserPath);
+                }
+                if (projectUserPath.empty())
+                {
+                    return {};
+                }
+                return projectUserPath / ShaderCompileCacheName;
+            }
+
+            static AZ::IO::Path GetEntryPath(const ShaderCompileCacheOptions& options, const AZStd::string& key)
+            {
+                AZ::IO::Path cacheFolder = GetCacheFolder(options);
+                if (cacheFolder.empty() || key.size() < 2)
+                {
+                    return {};
+                }
+                // Spread the entries over sub folders, there can be millions of them
+                return cacheFolder / key.substr(0, 2) / (key + ".azscc");
+            }
+
+            AZStd::string MakeKey(
+                const RHI::ShaderPlatformInterface& shaderPlatformInterface,
+                const AssetBuilderSDK::PlatformInfo& platformInfo,
+                const AZStd::string& entryFunctionName,
+                RHI::ShaderHardwareStage shaderStage,
+                const RHI::ShaderCompilerArguments& shaderCompilerArguments,
+                const AZStd::string& shaderSourceContent)
+            {
+                AZStd::string compilerArgumentsJson;
+                RPI::JsonUtils::SaveObjectToJsonString(shaderCompilerArguments, compilerArgumentsJson);
+
+                const AZStd::string header = AZStd::string::format("%u\n%s\n%u\n%s\n%s\n%u\n%s\n",
+                    CacheEntryVersion, shaderPlatformInterface.GetAPIName().GetCStr(), shaderPlatformInterface.GetAPIUniqueIndex(),
+                    platformInfo.m_identifier.c_str(), entryFunctionName.c_str(), static_cast<AZ::u32>(shaderStage), compilerArgumentsJson.c_str());
+                const AZStd::string& compilerFingerprint = GetCompilerFingerprint();
+
+                AZ::Sha1 sha;
+                sha.ProcessBytes(header.data(), header.size());
+                sha.ProcessBytes(compilerFingerprint.data(), compilerFingerprint.size());
+                sha.ProcessBytes(shaderSourceContent.data(), shaderSourceContent.size());
+                AZ::u32 digest[5];
+                sha.GetDigest(digest);
+
+                return AZStd::string::format("%08x%08x%08x%08x%08x", digest[0], digest[1], digest[2], digest[3], digest[4]);
+            }
+
+            bool Load(const ShaderCompileCacheOptions& options, const AZStd::string& key, RHI::ShaderPlatformInterface::StageDescriptor& stageDescriptor)
+            {
+                if (!options.m_enabled)
+                {
+                    return false;
+                }
+
+                const AZ::IO::Path entryPath = GetEntryPath(options, key);
+                if (entryPath.empty() || !AZ::IO::SystemFile::Exists(entryPath.c_str()))
+                {
+                    return false;
+                }
+
+                auto loadResult = RHI::LoadFileBytes(entryPath.c_str());
+                if (!loadResult.IsSuccess())
+                {
+                    return false;
+                }
+                const AZStd::vector<uint8_t>& entryData = loadResult.GetValue();
+
+                CacheEntryHeader header;
+                if (entryData.size() < sizeof(header))
+                {
+                    return false;
+                }
+                memcpy(&header, entryData.data(), sizeof(header));
+                if (header.m_magic != CacheEntryMagic || header.m_version != CacheEntryVersion ||
+                    entryData.size() != sizeof(header) + header.m_entryFunctionNameSize + header.m_byteCodeSize + header.m_sourceCodeSize)
+                {
+                    // Truncated or written by another version, it will be replaced by the next Store()
+                    return false;
+                }
+
+                const uint8_t* readPosition = entryData.data() + sizeof(header);
+                stageDescriptor.m_stageType = static_cast<RHI::ShaderHardwareStage>(header.m_stageType);
+                stageDescriptor.m_entryFunctionName.assign(reinterpret_cast<const char*>(readPosition), header.m_entryFunctionNameSize);
+                readPosition += header.m_entryFunctionNameSize;
+                stageDescriptor.m_byteCode.assign(readPosition, readPosition + header.m_byteCodeSize);
+                readPosition += header.m_byteCodeSize;
+                stageDescriptor.m_sourceCode.assign(reinterpret_cast<const char*>(readPosition), reinterpret_cast<const char*>(readPosition) + header.m_sourceCodeSize);
+                stageDescriptor.m_byProducts = {};
+                stageDescriptor.m_byProducts.m_dynamicBranchCount = header.m_dynamicBranchCount;
+                return true;
+            }
+
+            void Store(const ShaderCompileCacheOptions& options, const AZStd::string& key, const RHI::ShaderPlatformInterface::StageDescriptor& stageDescriptor)
+            {
+                if (!options.m_enabled || !stageDescriptor.m_byProducts.m_intermediatePaths.empty())
+                {
+                    return;
+                }
+
+                const AZ::IO::Path entryPath = GetEntryPath(options, key);
+                if (entryPath.empty())
+                {
+                    return;
+                }
+
+                CacheEntryHeader header;
+                header.m_stageType = static_cast<AZ::u32>(stageDescriptor.m_stageType);
+                header.m_dynamicBranchCount = stageDescriptor.m_byProducts.m_dynamicBranchCount;
+                header.m_entryFunctionNameSize = stageDescriptor.m_entryFunctionName.size();
+                header.m_byteCodeSize = stageDescriptor.m_byteCode.size();
+                header.m_sourceCodeSize = stageDescriptor.m_sourceCode.size();
+
+                // Write under a unique name and rename into place, so other builders (possibly on other machines) never read a partial entry
+                const AZ::IO::Path stagingPath = AZ::IO::Path(entryPath.Native() + "." + Uuid::CreateRandom().ToString<AZStd::string>(false, false));
+                {
+                    AZ::IO::SystemFile stagingFile;
+                    if (!stagingFile.Open(stagingPath.c_str(),
+                        AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_CREATE_PATH | AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY))
+                    {
+                        AZ_Warning(ShaderCompileCacheName, false, "Unable to write shader compile cache entry %s", stagingPath.c_str());
+                        return;
+                    }
+                    bool written = stagingFile.Write(&header, sizeof(header)) == sizeof(header);
+                    written = written && stagingFile.Write(stageDescriptor.m_entryFunctionName.data(), header.m_entryFunctionNameSize) == header.m_entryFunctionNameSize;
+                    written = written && stagingFile.Write(stageDescriptor.m_byteCode.data(), header.m_byteCodeSize) == header.m_byteCodeSize;
+                    written = written && stagingFile.Write(stageDescriptor.m_sourceCode.data(), header.m_sourceCodeSize) == header.m_sourceCodeSize;
+                    stagingFile.Close();
+                    if (!written)
+                    {
+                        AZ_Warning(ShaderCompileCacheName, false, "Failed to write shader compile cache entry %s", stagingPath.c_str());
+                        AZ::IO::SystemFile::Delete(stagingPath.c_str());
+                        return;
+                    }
+                }
+
+                if (!AZ::IO::SystemFile::Rename(stagingPath.c_str(), entryPath.c_str(), true))
+                {
+                    // Most likely another builder stored the same entry in the meantime
+                    AZ::IO::SystemFile::Delete(stagingPath.c_str());
+                }
+            }
+        } // namespace ShaderCompileCache
+    } // namespace ShaderBuilder
+} // namespace AZ
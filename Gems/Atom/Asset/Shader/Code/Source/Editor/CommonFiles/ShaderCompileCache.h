@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Atom/RHI.Edit/ShaderCompilerArguments.h>
+#include <Atom/RHI.Edit/ShaderPlatformInterface.h>
+
+#include <AzCore/std/string/string.h>
+
+namespace AssetBuilderSDK
+{
+    struct PlatformInfo;
+}
+
+namespace AZ
+{
+    namespace ShaderBuilder
+    {
+        //! Settings of the shader compile cache, part of the project-wide shader_global_build_options's file.
+        //! The cache stores the output of the platform shader compiler (DXC, SPIRV-Cross, metal...) per entry point, keyed by the
+        //! final shader source, the compiler arguments and the compiler binaries, so identical shader code is compiled only once
+        //! across variants, rebuilds and (when the folder is shared) machines.
+        struct ShaderCompileCacheOptions final
+        {
+            AZ_RTTI(ShaderCompileCacheOptions, "{5B8A1C3E-43D3-4A4F-9C0E-2F6B17D4E9A1}");
+
+            static void Reflect(AZ::ReflectContext* context);
+
+            bool m_enabled = true;
+
+            //! Folder holding the cache entries. It can be a network location shared by several machines.
+            //! When empty, the cache lives in <ProjectUserPath>/ShaderCompileCache.
+            AZStd::string m_folder;
+
+            //! Maximum number of shader compiler processes run at the same time for a single shader variant, 0 to let the builder decide.
+            AZ::u32 m_maxParallelCompiles = 0;
+        };
+
+        namespace ShaderCompileCache
+        {
+            //! Returns the cache key of an entry point compilation.
+            //! @shaderSourceContent is the complete source given to the compiler, including the variant's code prefix.
+            AZStd::string MakeKey(
+                const RHI::ShaderPlatformInterface& shaderPlatformInterface,
+                const AssetBuilderSDK::PlatformInfo& platformInfo,
+                const AZStd::string& entryFunctionName,
+                RHI::ShaderHardwareStage shaderStage,
+                const RHI::ShaderCompilerArguments& shaderCompilerArguments,
+                const AZStd::string& shaderSourceContent);
+
+            //! Fills @stageDescriptor with the cached compilation of @key. Returns false if there is no usable entry.
+            bool Load(const ShaderCompileCacheOptions& options, const AZStd::string& key, RHI::ShaderPlatformInterface::StageDescriptor& stageDescriptor);
+
+            //! Stores a successful compilation. Compilations with byproducts (debug symbols, disassembly...) are not cached,
+            //! since these files would be missing from a job using the cached entry.
+            void Store(const ShaderCompileCacheOptions& options, const AZStd::string& key, const RHI::ShaderPlatformInterface::StageDescriptor& stageDescriptor);
+        }
+    }
+}
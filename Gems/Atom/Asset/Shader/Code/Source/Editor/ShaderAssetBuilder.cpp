@@ -175,7 +175,8 @@ namespace AZ
             const ShaderResourceGroupAssets& srgAssets,
             BindingDependencies& bindingDependencies,
             const RootConstantData& rootConstantData,
-            const AssetBuilderSDK::ProcessJobRequest& request)
+            const AssetBuilderSDK::ProcessJobRequest& request,
+            const ShaderCompileCacheOptions& compileCacheOptions)
         {
             AssetBuilderSDK::JobCancelListener jobCancelListener(request.m_jobId);
 
@@ -244,6 +245,7 @@ namespace AZ
             // We always include the root shader variant (all options are unspecified) in the ShaderAsset itself.
             ShaderVariantCreationContext variantCreationContext = { variantAssetId, hlslSourcePath, hlslSourceContent.GetValue(), shaderSourceDataDescriptor,
                 tempDirPath, request.m_platformInfo, *shaderOptionGroupLayout, shaderEntryPoints, shaderAssetBuildTimestamp };
+            variantCreationContext.m_compileCacheOptions = &compileCacheOptions;
             AZ::Outcome<Data::Asset<RPI::ShaderVariantAsset>, AZStd::string> outcomeForShaderVariantAsset = ShaderVariantAssetBuilder::CreateShaderVariantAssetForAPI(
                 RPI::ShaderVariantListSourceData::VariantInfo(),
                 variantCreationContext,
@@ -492,7 +494,8 @@ namespace AZ
                         srgAssets,
                         bindingDependencies,
                         rootConstantData,
-                        request);
+                        request,
+                        buildOptions.m_compileCache);
                 if (compileResult != AssetBuilderSDK::ProcessJobResult_Success)
                 {
                     response.m_resultCode = compileResult;
@@ -45,6 +45,8 @@
 #include <AzCore/std/algorithm.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/std/sort.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/thread.h>
 #include <AzCore/Serialization/Json/JsonSerialization.h>
 
 #include "ShaderAssetBuilder.h"
@@ -592,7 +594,8 @@ namespace AZ
             const AZStd::string& hlslSourcePath,
             const AZStd::string& hlslSourceContent,
             const AZStd::string& pathToOmJson,
-            const AZStd::string& pathToIaJson)
+            const AZStd::string& pathToIaJson,
+            const ShaderCompileCacheOptions& compileCacheOptions)
         {
             const AZStd::string& tempDirPath = request.m_tempDirPath;
             RHI::ShaderPlatformInterface::ByProducts byproducts;
@@ -622,6 +625,7 @@ namespace AZ
 
             ShaderVariantCreationContext variantCreationContext = { Uuid::CreateRandom(), hlslSourcePath, hlslSourceContent, shaderSourceDataDescriptor,
                 tempDirPath, request.m_platformInfo, shaderOptionGroupLayout, shaderEntryPoints, shaderAssetBuildTimestamp };
+            variantCreationContext.m_compileCacheOptions = &compileCacheOptions;
             AZ::Outcome<Data::Asset<RPI::ShaderVariantAsset>, AZStd::string> outcomeForShaderVariantAsset = ShaderVariantAssetBuilder::CreateShaderVariantAssetForAPI(
                 variantInfo,
                 variantCreationContext,
@@ -783,7 +787,8 @@ namespace AZ
                     hlslSourcePath,
                     hlslSourceContent.GetValue(),
                     azslArtifactsOutcome.GetValue()[ShaderBuilderUtility::AzslSubProducts::om],
-                    azslArtifactsOutcome.GetValue()[ShaderBuilderUtility::AzslSubProducts::ia]);
+                    azslArtifactsOutcome.GetValue()[ShaderBuilderUtility::AzslSubProducts::ia],
+                    buildOptions.m_compileCache);
                 if (!success)
                 {
                     response.m_resultCode = AssetBuilderSDK::ProcessJobResult_Failed;
@@ -831,6 +836,22 @@ namespace AZ
             bool hasComputeProgram = false;
             bool hasRayTracingProgram = false;
 
+            // One platform compilation per entry point
+            struct EntryPointCompilation
+            {
+                AZStd::string m_entryName;
+                RHI::ShaderHardwareStage m_shaderStage;
+                AZStd::string m_sourcePath;
+                AZStd::string m_tempFolderPath;
+                AZStd::string m_cacheKey;
+                RHI::ShaderPlatformInterface::StageDescriptor m_descriptor;
+                bool m_compiled = false;
+            };
+            AZStd::vector<EntryPointCompilation> compilations;
+
+            const ShaderCompileCacheOptions* compileCacheOptions = variantCreationContext.m_compileCacheOptions;
+            const bool useCompileCache = compileCacheOptions && compileCacheOptions->m_enabled;
+
             const AZStd::unordered_map<AZStd::string, RPI::ShaderStageType>& shaderEntryPoints = variantCreationContext.m_shaderEntryPoints;
             for (const auto& shaderEntryPoint : shaderEntryPoints)
             {
@@ -840,9 +861,10 @@ namespace AZ
                 AZ_TracePrintf(ShaderVariantAssetBuilderName, "Entry Point: %s", shaderEntryName.c_str());
                 AZ_TracePrintf(ShaderVariantAssetBuilderName, "Begin compiling shader function \"%s\"", shaderEntryName.c_str());
 
-                auto assetBuilderShaderType = ShaderBuilderUtility::ToAssetBuilderShaderType(shaderStageType);
-
-                AZStd::string variantShaderSourcePath;
+                EntryPointCompilation& compilation = compilations.emplace_back();
+                compilation.m_entryName = shaderEntryName;
+                compilation.m_shaderStage = ShaderBuilderUtility::ToAssetBuilderShaderType(shaderStageType);
+                compilation.m_tempFolderPath = variantCreationContext.m_tempDirPath;
 
                 // Check if we need to prepend any code prefix
                 if (!azslData.m_shaderCodePrefix.empty())
@@ -854,39 +876,134 @@ namespace AZ
 
                     AZStd::string shaderAssetName = AZStd::string::format("%s_%s_%s_%u.hlsl", azslData.m_sources->m_azslFileName.c_str(), shaderEntryName.c_str(),
                         shaderPlatformInterface.GetAPIName().GetCStr(), variantStableId.GetIndex());
-                    AzFramework::StringFunc::Path::Join(variantCreationContext.m_tempDirPath.c_str(), shaderAssetName.c_str(), variantShaderSourcePath, true, true);
+                    AzFramework::StringFunc::Path::Join(variantCreationContext.m_tempDirPath.c_str(), shaderAssetName.c_str(), compilation.m_sourcePath, true, true);
 
-                    auto outcome = Utils::WriteFile(variantShaderSourceString, variantShaderSourcePath);
+                    auto outcome = Utils::WriteFile(variantShaderSourceString, compilation.m_sourcePath);
                     if (!outcome.IsSuccess())
                     {
-                        AZ_Error(ShaderVariantAssetBuilderName, false, "Failed to create file %s", variantShaderSourcePath.c_str());
+                        AZ_Error(ShaderVariantAssetBuilderName, false, "Failed to create file %s", compilation.m_sourcePath.c_str());
                         return false;
                     }
+
+                    if (useCompileCache)
+                    {
+                        compilation.m_cacheKey = ShaderCompileCache::MakeKey(shaderPlatformInterface, variantCreationContext.m_platformInfo,
+                            shaderEntryName, compilation.m_shaderStage, shaderCompilerArguments, variantShaderSourceString);
+                    }
                 }
                 else
                 {
-                    variantShaderSourcePath = variantCreationContext.m_hlslSourcePath;
+                    compilation.m_sourcePath = variantCreationContext.m_hlslSourcePath;
+
+                    if (useCompileCache)
+                    {
+                        compilation.m_cacheKey = ShaderCompileCache::MakeKey(shaderPlatformInterface, variantCreationContext.m_platformInfo,
+                            shaderEntryName, compilation.m_shaderStage, shaderCompilerArguments, variantCreationContext.m_hlslSourceContent);
+                    }
                 }
 
-                // Compile HLSL to the platform specific shader.
-                RHI::ShaderPlatformInterface::StageDescriptor descriptor;
-                bool shaderWasCompiled = shaderPlatformInterface.CompilePlatformInternal(
+                if (useCompileCache && ShaderCompileCache::Load(*compileCacheOptions, compilation.m_cacheKey, compilation.m_descriptor))
+                {
+                    AZ_TracePrintf(ShaderVariantAssetBuilderName, "Shader function \"%s\" found in the shader compile cache", shaderEntryName.c_str());
+                    compilation.m_compiled = true;
+                }
+            }
+
+            AZStd::vector<EntryPointCompilation*> pendingCompilations;
+            for (EntryPointCompilation& compilation : compilations)
+            {
+                if (!compilation.m_compiled)
+                {
+                    pendingCompilations.push_back(&compilation);
+                }
+            }
+
+            // Compile HLSL to the platform specific shader.
+            auto compileEntryPoint = [&](EntryPointCompilation& compilation)
+            {
+                compilation.m_compiled = shaderPlatformInterface.CompilePlatformInternal(
                     variantCreationContext.m_platformInfo,
-                    variantShaderSourcePath,
-                    shaderEntryName,
-                    assetBuilderShaderType,
-                    variantCreationContext.m_tempDirPath,
-                    descriptor,
+                    compilation.m_sourcePath,
+                    compilation.m_entryName,
+                    compilation.m_shaderStage,
+                    compilation.m_tempFolderPath,
+                    compilation.m_descriptor,
                     shaderCompilerArguments);
 
-                if (!shaderWasCompiled)
+                if (compilation.m_compiled && useCompileCache)
+                {
+                    ShaderCompileCache::Store(*compileCacheOptions, compilation.m_cacheKey, compilation.m_descriptor);
+                }
+            };
+
+            size_t maxParallelCompiles = 1;
+            if (compileCacheOptions)
+            {
+                maxParallelCompiles = compileCacheOptions->m_maxParallelCompiles > 0
+                    ? compileCacheOptions->m_maxParallelCompiles
+                    : AZStd::max(AZStd::thread::hardware_concurrency(), 1u);
+            }
+            const size_t workerCount = AZStd::min(pendingCompilations.size(), maxParallelCompiles);
+            if (workerCount > 1)
+            {
+                // The platform compilers name their intermediate files after the source file, which is shared by the entry points,
+                // so each entry point gets its own temporary folder when they are compiled at the same time.
+                for (EntryPointCompilation* compilation : pendingCompilations)
+                {
+                    AZStd::string entryTempFolder = AZStd::string::format("%s_%s", shaderPlatformInterface.GetAPIName().GetCStr(), compilation->m_entryName.c_str());
+                    AzFramework::StringFunc::Path::Join(variantCreationContext.m_tempDirPath.c_str(), entryTempFolder.c_str(), compilation->m_tempFolderPath, true, false);
+                    AZ::IO::SystemFile::CreateDir(compilation->m_tempFolderPath.c_str());
+                }
+
+                AZStd::atomic<size_t> nextCompilation{ 0 };
+                AZStd::vector<AZStd::thread> workers;
+                workers.reserve(workerCount);
+                for (size_t workerIndex = 0; workerIndex < workerCount; ++workerIndex)
+                {
+                    workers.emplace_back([&]()
+                        {
+                            for (size_t index = nextCompilation++; index < pendingCompilations.size(); index = nextCompilation++)
+                            {
+                                compileEntryPoint(*pendingCompilations[index]);
+                            }
+                        });
+                }
+                for (AZStd::thread& worker : workers)
+                {
+                    worker.join();
+                }
+            }
+            else
+            {
+                for (EntryPointCompilation* compilation : pendingCompilations)
+                {
+                    compileEntryPoint(*compilation);
+                }
+            }
+
+            for (EntryPointCompilation& compilation : compilations)
+            {
+                auto& shaderEntryName = compilation.m_entryName;
+                auto assetBuilderShaderType = compilation.m_shaderStage;
+                RHI::ShaderPlatformInterface::StageDescriptor& descriptor = compilation.m_descriptor;
+
+                if (!compilation.m_compiled)
                 {
                     isVariantValid = false;
                     AZ_Error(ShaderVariantAssetBuilderName, false, "Could not compile the shader function %s", shaderEntryName.c_str());
                     continue; // Using continue to report all the errors found
                 }
                 // bubble up the byproducts to the caller by moving them to the context.
-                variantCreationContext.m_outputByproducts.emplace(AZStd::move(descriptor.m_byProducts));
+                if (variantCreationContext.m_outputByproducts)
+                {
+                    variantCreationContext.m_outputByproducts->m_intermediatePaths.insert(
+                        descriptor.m_byProducts.m_intermediatePaths.begin(), descriptor.m_byProducts.m_intermediatePaths.end());
+                    variantCreationContext.m_outputByproducts->m_dynamicBranchCount = descriptor.m_byProducts.m_dynamicBranchCount;
+                }
+                else
+                {
+                    variantCreationContext.m_outputByproducts.emplace(descriptor.m_byProducts);
+                }
 
                 hasRasterProgram |= shaderPlatformInterface.IsShaderStageForRaster(assetBuilderShaderType);
                 hasComputeProgram |= shaderPlatformInterface.IsShaderStageForCompute(assetBuilderShaderType);
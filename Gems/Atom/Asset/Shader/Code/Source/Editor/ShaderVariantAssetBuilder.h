@@ -17,6 +17,7 @@
 #include <Atom/RPI.Edit/Shader/ShaderVariantListSourceData.h>
 
 #include "ShaderBuilderUtility.h"
+#include <CommonFiles/ShaderCompileCache.h>
 
 namespace AZ
 {
@@ -36,6 +37,7 @@ namespace AZ
             const MapOfStringToStageType& m_shaderEntryPoints;
             AZStd::sys_time_t m_shaderAssetBuildTimestamp; //!< Copied from the ShaderAsset, used to synchronize versions of the ShaderAsset and ShaderVariantAsset, especially during hot-reload.
             AZStd::optional<RHI::ShaderPlatformInterface::ByProducts> m_outputByproducts;
+            const ShaderCompileCacheOptions* m_compileCacheOptions = nullptr; //!< Optional. When set, compiler outputs are cached and entry points are compiled in parallel.
         };
 
         class ShaderVariantAssetBuilder
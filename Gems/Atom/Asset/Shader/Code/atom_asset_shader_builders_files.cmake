@@ -12,6 +12,8 @@ set(FILES
     Source/Editor/CommonFiles/GlobalBuildOptions.cpp
     Source/Editor/CommonFiles/Preprocessor.h
     Source/Editor/CommonFiles/Preprocessor.cpp
+    Source/Editor/CommonFiles/ShaderCompileCache.h
+    Source/Editor/CommonFiles/ShaderCompileCache.cpp
     Source/Editor/AtomShaderCapabilitiesConfigFile.cpp
     Source/Editor/AtomShaderCapabilitiesConfigFile.h
     Source/Editor/AzslData.h
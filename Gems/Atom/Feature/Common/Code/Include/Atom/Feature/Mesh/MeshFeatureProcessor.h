@@ -59,6 +59,8 @@ namespace AZ
             void DeInit();
             void Init(Data::Instance<RPI::Model> model);
             void BuildDrawPacketList(size_t modelLodIndex);
+            //! Rebuilds the draw packets of the lods the model streamed in or out since the last update.
+            void UpdateLodResidency();
             void SetRayTracingData();
             void SetSortKey(RHI::DrawItemSortKey sortKey);
             RHI::DrawItemSortKey GetSortKey();
@@ -66,7 +68,7 @@ namespace AZ
             RPI::Cullable::LodOverride GetLodOverride();
             void UpdateDrawPackets(bool forceUpdate = false);
             void BuildCullable();
-            void UpdateCullBounds(const TransformServiceFeatureProcessor* transformService);
+            void UpdateCullBounds(TransformServiceFeatureProcessor* transformService);
             void UpdateObjectSrg();
             bool MaterialRequiresForwardPassIblSpecular(Data::Instance<RPI::Material> material) const;
             void SetVisible(bool isVisible);
@@ -90,6 +92,9 @@ namespace AZ
 
             TransformServiceFeatureProcessorInterface::ObjectId m_objectId;
 
+            //! Lod residency of the model the draw packets were built for
+            uint32_t m_lodResidencyChangeId = 0;
+
             bool m_cullBoundsNeedsUpdate = false;
             bool m_cullableNeedsRebuild = false;
             bool m_objectSrgNeedsUpdate = true;
@@ -167,6 +172,13 @@ namespace AZ
                 "(For Testing) Invalidates all mesh draw packets, causing them to rebuild on the next frame."
             );
 
+            void DumpInstancingStats(const AZ::ConsoleCommandContainer& arguments);
+            AZ_CONSOLEFUNC(MeshFeatureProcessor,
+                DumpInstancingStats,
+                AZ::ConsoleFunctorFlags::Null,
+                "Prints how many mesh draw packets only differ by their object srg and could be combined into instanced draws."
+            );
+
             MeshFeatureProcessor(const MeshFeatureProcessor&) = delete;
 
             // RPI::SceneNotificationBus::Handler overrides...
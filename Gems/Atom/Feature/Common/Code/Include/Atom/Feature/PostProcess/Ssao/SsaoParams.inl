@@ -50,3 +50,7 @@ AZ_GFX_FLOAT_PARAM_FLOAT_OVERRIDE(float, BlurDepthFalloffStrength, m_blurDepthFa
 // Whether to downsample the depth buffer before SSAO and upsample the result
 AZ_GFX_BOOL_PARAM(EnableDownsample, m_enableDownsample, true)
 AZ_GFX_ANY_PARAM_BOOL_OVERRIDE(bool, EnableDownsample, m_enableDownsample)
+
+// Whether to downsample the depth buffer a second time so SSAO runs at quarter resolution, only used with EnableDownsample
+AZ_GFX_BOOL_PARAM(EnableQuarterResolution, m_enableQuarterResolution, false)
+AZ_GFX_ANY_PARAM_BOOL_OVERRIDE(bool, EnableQuarterResolution, m_enableQuarterResolution)
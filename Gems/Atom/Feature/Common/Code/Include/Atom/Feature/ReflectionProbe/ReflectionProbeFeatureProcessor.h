@@ -72,6 +72,9 @@ namespace AZ
             // notifies and removes the notification entry
             void HandleAssetNotification(Data::Asset<Data::AssetData> asset, CubeMapAssetNotificationType notificationType);
 
+            // starts the queued cubemap builds allowed by r_reflectionProbeMaxConcurrentBakes
+            void StartQueuedBakes();
+
             // list of reflection probes
             const size_t InitialProbeAllocationSize = 64;
             ReflectionProbeVector m_reflectionProbes;
@@ -87,6 +90,16 @@ namespace AZ
             typedef AZStd::vector<NotifyCubeMapAssetEntry> NotifyCubeMapAssetVector;
             NotifyCubeMapAssetVector m_notifyCubeMapAssets;
 
+            // cubemap builds waiting for a slot, in request order
+            // each build adds a cubemap render pipeline to the scene, so they are limited to avoid rendering several at once
+            struct QueuedBakeEntry
+            {
+                ReflectionProbeHandle m_probe;
+                BuildCubeMapCallback m_callback;
+            };
+            typedef AZStd::vector<QueuedBakeEntry> QueuedBakeVector;
+            QueuedBakeVector m_queuedBakes;
+
             // position structure for the box vertices
             struct Position
             {
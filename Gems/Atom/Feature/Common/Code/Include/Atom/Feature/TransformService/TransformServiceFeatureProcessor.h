@@ -49,6 +49,7 @@ namespace AZ
                 const AZ::Vector3& nonUniformScale = AZ::Vector3::CreateOne()) override;
             AZ::Transform GetTransformForId(ObjectId id) const override;
             AZ::Vector3 GetNonUniformScaleForId(ObjectId id) const override;
+            void SetBoundingSphereForId(ObjectId id, const AZ::Sphere& boundingSphere) override;
 
         private:
 
@@ -59,6 +60,12 @@ namespace AZ
                 uint32_t m_nextFreeSlot;
             };
 
+            // World space bounding sphere of an object, with the center in xyz and the radius in w.
+            struct Float4
+            {
+                float m_value[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+            };
+
             // Flag value for when the buffers have no empty spaces.
             static const uint32_t NoAvailableTransformIndices = -1;
 
@@ -67,11 +74,14 @@ namespace AZ
             // Prepare GPU buffers for object transformation matrices
             // Create the buffers if they don't exist. Otherwise, resize them if they are not large enough for the matrices
             void PrepareBuffers();
+
+            void SetBoundingSphere(uint32_t index, const AZ::Sphere& boundingSphere);
             
             Data::Instance<RPI::ShaderResourceGroup> m_sceneSrg;
             RHI::ShaderInputBufferIndex m_objectToWorldBufferIndex;
             RHI::ShaderInputBufferIndex m_objectToWorldInverseTransposeBufferIndex;
             RHI::ShaderInputBufferIndex m_objectToWorldHistoryBufferIndex;
+            RHI::ShaderInputBufferIndex m_objectBoundingSphereBufferIndex;
 
             // Stores transforms that are uploaded to a GPU buffer. Used slots have float12(matrix3x4) values, empty slots
             // have a uint32_t that points to the next empty slot like a linked list. m_firstAvailableMeshTransformIndex stores the first
@@ -81,16 +91,23 @@ namespace AZ
             AZStd::vector<Float4x3> m_objectToWorldInverseTransposeTransforms;
             AZStd::vector<Float4x3> m_objectToWorldHistoryTransforms;
 
+            // Stores the bounding spheres that are uploaded to a GPU buffer, using the same slots as the transforms. Empty slots
+            // have a negative radius so they can be skipped by GPU culling.
+            AZStd::vector<Float4> m_objectBoundingSpheres;
+
             static const size_t TransformValueSize = sizeof(decltype(m_objectToWorldTransforms)::value_type);
             static const size_t NormalValueSize = sizeof(decltype(m_objectToWorldInverseTransposeTransforms)::value_type);
+            static const size_t BoundingSphereValueSize = sizeof(decltype(m_objectBoundingSpheres)::value_type);
 
             Data::Instance<RPI::Buffer> m_objectToWorldBuffer;
             Data::Instance<RPI::Buffer> m_objectToWorldInverseTransposeBuffer;
             Data::Instance<RPI::Buffer> m_objectToWorldHistoryBuffer;
+            Data::Instance<RPI::Buffer> m_objectBoundingSphereBuffer;
 
             uint32_t m_firstAvailableTransformIndex = NoAvailableTransformIndices;
             bool m_deviceBufferNeedsUpdate = false;
             bool m_historyBufferNeedsUpdate = false;
+            bool m_boundingSphereBufferNeedsUpdate = false;
             bool m_isWriteable = true;     //prevents write access during certain parts of the frame (for threadsafety)
         };
     }
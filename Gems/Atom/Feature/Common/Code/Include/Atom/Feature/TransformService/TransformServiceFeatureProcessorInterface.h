@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <AzCore/Math/Sphere.h>
 #include <AzCore/Math/Transform.h>
 #include <AzCore/Math/Vector3.h>
 #include <Atom/RPI.Public/FeatureProcessor.h>
@@ -37,6 +38,9 @@ namespace AZ
             virtual AZ::Transform GetTransformForId(ObjectId) const = 0;
             //! Gets the non-uniform scale for a given id. Id must be one reserved earlier.
             virtual AZ::Vector3 GetNonUniformScaleForId(ObjectId id) const = 0;
+            //! Sets the world space bounding sphere for a given id, which is made available to shaders so objects can be culled on the GPU.
+            //! Id must be one reserved earlier.
+            virtual void SetBoundingSphereForId(ObjectId id, const AZ::Sphere& boundingSphere) = 0;
         };
     }
 }
@@ -27,6 +27,10 @@ namespace AZ
             //! Dump the Cpu Profiling Statistics to a json file.
             virtual bool CaptureCpuProfilingStatistics(const AZStd::string& outputFilePath) = 0;
 
+            //! Dump the last seconds of the continuous Cpu profiling capture, together with the pass' GPU timestamps when
+            //! r_gpuPassTiming is enabled, to a json file in the Chrome trace event format, which can be opened in Perfetto.
+            //! @param durationInSeconds How many seconds before the call are exported
+            virtual bool CaptureProfilingTrace(const AZStd::string& outputFilePath, float durationInSeconds) = 0;
         };
         using ProfilingCaptureRequestBus = EBus<ProfilingCaptureRequests>;
 
@@ -50,6 +54,11 @@ namespace AZ
             //! @param result Set to true if it's finished successfully
             //! @param info The output file path or error information which depends on the return. 
             virtual void OnCaptureCpuProfilingStatisticsFinished(bool result, const AZStd::string& info) = 0;
+
+            //! Notify when a profiling trace capture is finished
+            //! @param result Set to true if it's finished successfully
+            //! @param info The output file path or error information which depends on the return. 
+            virtual void OnCaptureProfilingTraceFinished(bool result, const AZStd::string& info) = 0;
         };
         using ProfilingCaptureNotificationBus = EBus<ProfilingCaptureNotifications>;
 
@@ -19,6 +19,7 @@
 #include <Atom/RPI.Reflect/Shader/ShaderOptionGroup.h>
 #include <Atom/RPI.Reflect/Shader/ShaderAsset.h>
 
+#include <Atom/RPI.Public/DynamicDraw/DynamicDrawInterface.h>
 #include <Atom/RPI.Public/RPIUtils.h>
 #include <Atom/RPI.Public/Scene.h>
 #include <Atom/RPI.Public/Shader/Shader.h>
@@ -93,6 +94,12 @@ namespace AZ
 
             m_processSrgs.clear();
             m_drawPackets.clear();
+            m_instancedDraws.clear();
+            m_instancedDrawLookup.clear();
+            for (ShaderData& shaderData : m_perObjectShaderData)
+            {
+                shaderData.m_defaultSRG = nullptr;
+            }
 
             m_litShader = nullptr;
             m_unlitShader = nullptr;
@@ -129,9 +136,10 @@ namespace AZ
             AZ_PROFILE_FUNCTION(Debug::ProfileCategory::AzRender);
             AZ_ATOM_PROFILE_FUNCTION("AuxGeom", "FixedShapeProcessor: ProcessObjects");
 
-            RHI::DrawPacketBuilder drawPacketBuilder;
+            m_instancedDraws.clear();
+            m_instancedDrawLookup.clear();
 
-            // Draw opaque shapes with LODs. This requires a separate draw packet per shape per view that it is in (usually only one)
+            // Draw opaque shapes with LODs. Shapes of the same type and LOD are batched together per view into a single instanced draw
 
             // We do each draw style together to reduce state changes
             for (int drawStyle = 0; drawStyle < DrawStyle_Count; ++drawStyle)
@@ -141,12 +149,10 @@ namespace AZ
                 // Skip this draw style if the owner scene doesn't have this drawListTag (which means this FP won't even create the RHI PipelineState for draw)
                 if (!m_scene->HasOutputForPipelineState(drawListTag))
                 {
-                    return;
+                    continue;
                 }
 
                 // Draw all of the opaque shapes of this draw style
-                // Possible TODO: Batch together shapes of the same type and LOD using instanced draw [ATOM-1032]
-                // Note that this optimization may not be worth it for shapes because of LODs
                 for (const auto& shape : bufferData->m_opaqueShapes[drawStyle])
                 {
                     PipelineStateOptions pipelineStateOptions;
@@ -170,13 +176,7 @@ namespace AZ
                             continue;
                         }
                         LodIndex lodIndex = GetLodIndexForShape(shape.m_shapeType, view.get(), position, scale);
-                        const RHI::DrawPacket* drawPacket = BuildDrawPacketForShape(
-                            drawPacketBuilder, shape, drawStyle, bufferData->m_viewProjOverrides, pipelineState, lodIndex);
-                        if (drawPacket)
-                        {
-                            m_drawPackets.emplace_back(drawPacket);
-                            view->AddDrawPacket(drawPacket);
-                        }
+                        AddShapeInstance(shape, drawStyle, bufferData->m_viewProjOverrides, pipelineState, lodIndex, view.get(), true);
                     }
                 }
 
@@ -192,22 +192,8 @@ namespace AZ
 
                     RPI::Ptr<RPI::PipelineStateForDraw> pipelineState = GetPipelineState(pipelineStateOptions);
 
-                    const RHI::DrawPacket* drawPacket =
-                        BuildDrawPacketForBox(drawPacketBuilder, box, drawStyle, bufferData->m_viewProjOverrides, pipelineState);
-                    if (drawPacket)
-                    {
-                        m_drawPackets.emplace_back(drawPacket);
-
-                        for (auto& view : fpPacket.m_views)
-                        {
-                            // If this view is ignoring packets with our draw list tag then skip this view
-                            if (!view->HasDrawListTag(drawListTag))
-                            {
-                                continue;
-                            }
-                            view->AddDrawPacket(drawPacket);
-                        }
-                    }
+                    // Boxes don't have LODs, so the same draw is added to all views
+                    AddBoxInstance(box, drawStyle, bufferData->m_viewProjOverrides, pipelineState, nullptr, true);
                 }
 
             }
@@ -222,7 +208,7 @@ namespace AZ
                 // Skip this draw style if the owner scene doesn't have this drawListTag (which means this FP won't even create the RHI PipelineState for draw)
                 if (!m_scene->HasOutputForPipelineState(drawListTag))
                 {
-                    return;
+                    continue;
                 }
 
                 // Draw all the shapes of this draw style
@@ -250,13 +236,7 @@ namespace AZ
                         RHI::DrawItemSortKey sortKey = view->GetSortKeyForPosition(position);
                         LodIndex lodIndex = GetLodIndexForShape(shape.m_shapeType, view.get(), position, scale);
 
-                        const RHI::DrawPacket* drawPacket = BuildDrawPacketForShape(
-                            drawPacketBuilder, shape, drawStyle, bufferData->m_viewProjOverrides, pipelineState, lodIndex, sortKey);
-                        if (drawPacket)
-                        {
-                            m_drawPackets.emplace_back(drawPacket);
-                            view->AddDrawPacket(drawPacket);
-                        }
+                        AddShapeInstance(shape, drawStyle, bufferData->m_viewProjOverrides, pipelineState, lodIndex, view.get(), false, sortKey);
                     }
                 }
 
@@ -282,16 +262,12 @@ namespace AZ
                             continue;
                         }
                         RHI::DrawItemSortKey sortKey = view->GetSortKeyForPosition(position);
-                        const RHI::DrawPacket* drawPacket = BuildDrawPacketForBox(
-                            drawPacketBuilder, box, drawStyle, bufferData->m_viewProjOverrides, pipelineState, sortKey);
-                        if (drawPacket)
-                        {
-                            m_drawPackets.emplace_back(drawPacket);
-                            view->AddDrawPacket(drawPacket);
-                        }
+                        AddBoxInstance(box, drawStyle, bufferData->m_viewProjOverrides, pipelineState, view.get(), false, sortKey);
                     }
                 }
             }
+
+            BuildInstancedDrawPackets(fpPacket);
         }
 
         bool FixedShapeProcessor::CreateSphereBuffersAndViews()
@@ -1307,11 +1283,7 @@ namespace AZ
             objectBuffers.m_streamBufferViews = { positionBufferView };
             objectBuffers.m_streamBufferViewsWithNormals = { positionBufferView, normalBufferView };
 
-            // Validate for each draw style
-            AZ::RHI::ValidateStreamBufferViews(m_objectStreamLayout[DrawStyle_Point], objectBuffers.m_streamBufferViews);
-            AZ::RHI::ValidateStreamBufferViews(m_objectStreamLayout[DrawStyle_Line], objectBuffers.m_streamBufferViews);
-            AZ::RHI::ValidateStreamBufferViews(m_objectStreamLayout[DrawStyle_Solid], objectBuffers.m_streamBufferViews);
-            AZ::RHI::ValidateStreamBufferViews(m_objectStreamLayout[DrawStyle_Shaded], objectBuffers.m_streamBufferViewsWithNormals);
+            // The stream buffer views are validated against the layouts once the instance stream is appended to them in BuildInstancedDrawPackets
 
             return true;
         }
@@ -1358,6 +1330,25 @@ namespace AZ
             {
                 layoutBuilder.AddBuffer()->Channel("NORMAL", RHI::Format::R32G32B32_FLOAT);
             }
+
+            // The instance stream matches the layout of ObjectInstanceData
+            auto instanceBuffer = layoutBuilder.AddBuffer(RHI::StreamStepFunction::PerInstance);
+            instanceBuffer->Channel("COLOR", RHI::Format::R32G32B32A32_FLOAT);
+            instanceBuffer->Channel("MODELTOWORLD0", RHI::Format::R32G32B32A32_FLOAT);
+            instanceBuffer->Channel("MODELTOWORLD1", RHI::Format::R32G32B32A32_FLOAT);
+            instanceBuffer->Channel("MODELTOWORLD2", RHI::Format::R32G32B32A32_FLOAT);
+            instanceBuffer->Channel("POINTSIZE", RHI::Format::R32_FLOAT);
+            if (includeNormals)
+            {
+                instanceBuffer->Padding(sizeof(float) * 3);
+                instanceBuffer->Channel("NORMALMATRIX0", RHI::Format::R32G32B32A32_FLOAT);
+                instanceBuffer->Channel("NORMALMATRIX1", RHI::Format::R32G32B32A32_FLOAT);
+                instanceBuffer->Channel("NORMALMATRIX2", RHI::Format::R32G32B32A32_FLOAT);
+            }
+            else
+            {
+                instanceBuffer->Padding(sizeof(float) * 15);
+            }
             layoutBuilder.SetTopology(topology);
             inputStreamLayout = layoutBuilder.End();
         }
@@ -1378,6 +1369,11 @@ namespace AZ
             }
 
             shaderData.m_drawListTag = shader->GetDrawListTag();
+
+            // Create a default SRG for draws that don't use a manual view projection override
+            shaderData.m_defaultSRG = RPI::ShaderResourceGroup::Create(shaderData.m_perObjectSrgAsset);
+            AZ_Assert(shaderData.m_defaultSRG != nullptr, "Creating the default SRG unexpectedly failed");
+            shaderData.m_defaultSRG->Compile();
         }
 
         void FixedShapeProcessor::LoadShaders()
@@ -1551,65 +1547,54 @@ namespace AZ
             }
         }
 
-        const RHI::DrawPacket* FixedShapeProcessor::BuildDrawPacketForShape(
-            RHI::DrawPacketBuilder& drawPacketBuilder,
+        void FixedShapeProcessor::FillInstanceData(
+            ObjectInstanceData& instance,
+            const AZ::Color& color,
+            const AZ::Matrix3x3& rotation,
+            const AZ::Vector3& position,
+            const AZ::Vector3& scale,
+            float pointSize)
+        {
+            color.StoreToFloat4(instance.m_color);
+
+            const AZ::Matrix3x4 drawMatrix = AZ::Matrix3x4::CreateFromMatrix3x3AndTranslation(rotation, position) * AZ::Matrix3x4::CreateScale(scale);
+            drawMatrix.StoreToRowMajorFloat12(instance.m_modelToWorld);
+
+            instance.m_pointSize = pointSize;
+            instance.m_padding[0] = instance.m_padding[1] = instance.m_padding[2] = 0.0f;
+
+            Matrix3x3 normalMatrix = rotation;
+            normalMatrix.MultiplyByScale(scale.GetReciprocal());
+            normalMatrix.GetRow(0).StoreToFloat4(&instance.m_normalMatrix[0]);
+            normalMatrix.GetRow(1).StoreToFloat4(&instance.m_normalMatrix[4]);
+            normalMatrix.GetRow(2).StoreToFloat4(&instance.m_normalMatrix[8]);
+        }
+
+        void FixedShapeProcessor::AddShapeInstance(
             const ShapeBufferEntry& shape,
             int drawStyle,
             const AZStd::vector<AZ::Matrix4x4>& viewProjOverrides,
             const RPI::Ptr<RPI::PipelineStateForDraw>& pipelineState,
             LodIndex lodIndex,
+            RPI::View* view,
+            bool isOpaque,
             RHI::DrawItemSortKey sortKey)
         {
-            ShaderData& shaderData = m_perObjectShaderData[drawStyle==DrawStyle_Shaded?1:0];
-
-            // Create a SRG for the shape to specify its transform and color
-            // [GFX TODO] [ATOM-2333] Try to avoid doing SRG create/compile per draw. Possibly using instancing.
-            auto srg = RPI::ShaderResourceGroup::Create(shaderData.m_perObjectSrgAsset);
-            if (!srg)
+            if (m_shapes[shape.m_shapeType].m_lodBuffers.empty())
             {
-                AZ_Warning("AuxGeom", false, "Failed to create a shader resource group for an AuxGeom draw, Ignoring the draw");
-                return nullptr;
+                return;
             }
 
-            const AZ::Matrix3x4 drawMatrix = AZ::Matrix3x4::CreateFromMatrix3x3AndTranslation(shape.m_rotationMatrix, shape.m_position) * AZ::Matrix3x4::CreateScale(shape.m_scale);
-            if (drawStyle == DrawStyle_Shaded)
-            {
-                Matrix3x3 rotation = shape.m_rotationMatrix;
-                rotation.MultiplyByScale(shape.m_scale.GetReciprocal());
-                srg->SetConstant(shaderData.m_colorIndex, shape.m_color);
-                srg->SetConstant(shaderData.m_modelToWorldIndex, drawMatrix);
-                srg->SetConstant(shaderData.m_normalMatrixIndex, rotation);
-            }
-            else
-            {
-                srg->SetConstant(shaderData.m_colorIndex, shape.m_color);
-                srg->SetConstant(shaderData.m_modelToWorldIndex, drawMatrix);
-            }
-            if (drawStyle == DrawStyle_Point)
-            {
-                srg->SetConstant(shaderData.m_pointSizeIndex, shape.m_pointSize);
-            }
-            if (shape.m_viewProjOverrideIndex >= 0)
-            {
-                srg->SetConstant(shaderData.m_viewProjectionOverrideIndex, viewProjOverrides[shape.m_viewProjOverrideIndex]);
-            }
+            ObjectInstanceData instance;
+            FillInstanceData(instance, shape.m_color, shape.m_rotationMatrix, shape.m_position, shape.m_scale, shape.m_pointSize);
 
-            pipelineState->UpdateSrgVariantFallback(srg);
-            
-            srg->Compile();
-            m_processSrgs.push_back(srg);
-            if (m_shapes[shape.m_shapeType].m_lodBuffers.size() > 0)
-            {
-                uint32_t indexCount = GetShapeIndexCount(shape.m_shapeType, drawStyle, lodIndex);
-                auto& indexBufferView = GetShapeIndexBufferView(shape.m_shapeType, drawStyle, lodIndex);
-                auto& streamBufferViews = GetShapeStreamBufferViews(shape.m_shapeType, lodIndex, drawStyle);
-                auto& drawListTag = shaderData.m_drawListTag;
+            uint32_t indexCount = GetShapeIndexCount(shape.m_shapeType, drawStyle, lodIndex);
+            auto& indexBufferView = GetShapeIndexBufferView(shape.m_shapeType, drawStyle, lodIndex);
+            auto& streamBufferViews = GetShapeStreamBufferViews(shape.m_shapeType, lodIndex, drawStyle);
 
-                return BuildDrawPacket(
-                    drawPacketBuilder, srg, indexCount, indexBufferView, streamBufferViews, drawListTag,
-                    pipelineState->GetRHIPipelineState(), sortKey);
-            }
-            return nullptr;
+            AddInstance(
+                instance, drawStyle, indexCount, indexBufferView, streamBufferViews, shape.m_viewProjOverrideIndex, viewProjOverrides,
+                pipelineState, view, isOpaque, sortKey);
         }
 
         const AZ::RHI::IndexBufferView& FixedShapeProcessor::GetBoxIndexBufferView(int drawStyle) const
@@ -1653,62 +1638,172 @@ namespace AZ
             }
         }
 
-        const RHI::DrawPacket* FixedShapeProcessor::BuildDrawPacketForBox(
-            RHI::DrawPacketBuilder& drawPacketBuilder,
+        void FixedShapeProcessor::AddBoxInstance(
             const BoxBufferEntry& box,
             int drawStyle,
             const AZStd::vector<AZ::Matrix4x4>& viewProjOverrides,
             const RPI::Ptr<RPI::PipelineStateForDraw>& pipelineState,
+            RPI::View* view,
+            bool isOpaque,
             RHI::DrawItemSortKey sortKey)
         {
-            ShaderData& shaderData = m_perObjectShaderData[drawStyle==DrawStyle_Shaded?1:0];
-            // Create a SRG for the box to specify its transform and color
-            auto srg = RPI::ShaderResourceGroup::Create(shaderData.m_perObjectSrgAsset);
-            if (!srg)
+            ObjectInstanceData instance;
+            FillInstanceData(instance, box.m_color, box.m_rotationMatrix, box.m_position, box.m_scale, box.m_pointSize);
+
+            uint32_t indexCount = GetBoxIndexCount(drawStyle);
+            auto& indexBufferView = GetBoxIndexBufferView(drawStyle);
+            auto& streamBufferViews = GetBoxStreamBufferViews(drawStyle);
+
+            AddInstance(
+                instance, drawStyle, indexCount, indexBufferView, streamBufferViews, box.m_viewProjOverrideIndex, viewProjOverrides,
+                pipelineState, view, isOpaque, sortKey);
+        }
+
+        void FixedShapeProcessor::AddInstance(
+            const ObjectInstanceData& instance,
+            int drawStyle,
+            uint32_t indexCount,
+            const RHI::IndexBufferView& indexBufferView,
+            const StreamBufferViewsForAllStreams& streamBufferViews,
+            int32_t viewProjOverrideIndex,
+            const AZStd::vector<AZ::Matrix4x4>& viewProjOverrides,
+            const RPI::Ptr<RPI::PipelineStateForDraw>& pipelineState,
+            RPI::View* view,
+            bool isOpaque,
+            RHI::DrawItemSortKey sortKey)
+        {
+            // Opaque instances don't need to be sorted, so they are appended to an existing draw with the same state if there is one
+            InstancedDrawKey key;
+            if (isOpaque)
+            {
+                key.m_indexBufferView = &indexBufferView;
+                key.m_pipelineState = pipelineState->GetRHIPipelineState();
+                key.m_view = view;
+                key.m_viewProjOverrideIndex = viewProjOverrideIndex;
+
+                auto drawIt = m_instancedDrawLookup.find(key);
+                if (drawIt != m_instancedDrawLookup.end())
+                {
+                    m_instancedDraws[drawIt->second].m_instances.push_back(instance);
+                    return;
+                }
+            }
+
+            ShaderData& shaderData = GetShaderDataForDrawStyle(drawStyle);
+
+            // Only draws with a view projection override need a SRG of their own, the transform and color are in the instance data
+            Data::Instance<RPI::ShaderResourceGroup> srg = shaderData.m_defaultSRG;
+            if (viewProjOverrideIndex >= 0)
             {
-                AZ_Warning("AuxGeom", false, "Failed to create a shader resource group for an AuxGeom draw, Ignoring the draw");
-                return nullptr;
+                srg = RPI::ShaderResourceGroup::Create(shaderData.m_perObjectSrgAsset);
+                if (!srg)
+                {
+                    AZ_Warning("AuxGeom", false, "Failed to create a shader resource group for an AuxGeom draw, Ignoring the draw");
+                    return;
+                }
+                srg->SetConstant(shaderData.m_viewProjectionOverrideIndex, viewProjOverrides[viewProjOverrideIndex]);
+                pipelineState->UpdateSrgVariantFallback(srg);
+                srg->Compile();
+                m_processSrgs.push_back(srg);
             }
-            const AZ::Matrix3x4 drawMatrix = AZ::Matrix3x4::CreateFromMatrix3x3AndTranslation(box.m_rotationMatrix, box.m_position) * AZ::Matrix3x4::CreateScale(box.m_scale);
-            if (drawStyle == DrawStyle_Shaded)
+
+            if (isOpaque)
             {
-                Matrix3x3 rotation = box.m_rotationMatrix;
-                rotation.MultiplyByScale(box.m_scale.GetReciprocal());
-                srg->SetConstant(shaderData.m_colorIndex, box.m_color);
-                srg->SetConstant(shaderData.m_modelToWorldIndex, drawMatrix);
-                srg->SetConstant(shaderData.m_normalMatrixIndex, rotation);
+                m_instancedDrawLookup.emplace(key, m_instancedDraws.size());
             }
-            else
+
+            InstancedDraw& draw = m_instancedDraws.emplace_back();
+            draw.m_drawStyle = drawStyle;
+            draw.m_indexCount = indexCount;
+            draw.m_indexBufferView = &indexBufferView;
+            draw.m_streamBufferViews = &streamBufferViews;
+            draw.m_drawListTag = shaderData.m_drawListTag;
+            draw.m_pipelineState = pipelineState->GetRHIPipelineState();
+            draw.m_srg = srg;
+            draw.m_view = view;
+            draw.m_sortKey = sortKey;
+            draw.m_instances.push_back(instance);
+        }
+
+        void FixedShapeProcessor::BuildInstancedDrawPackets(const RPI::FeatureProcessor::RenderPacket& fpPacket)
+        {
+            if (m_instancedDraws.empty())
             {
-                srg->SetConstant(shaderData.m_colorIndex, box.m_color);
-                srg->SetConstant(shaderData.m_modelToWorldIndex, drawMatrix);
+                return;
             }
-            if (drawStyle == DrawStyle_Point)
+
+            size_t instanceCount = 0;
+            for (const InstancedDraw& draw : m_instancedDraws)
             {
-                srg->SetConstant(shaderData.m_pointSizeIndex, box.m_pointSize);
+                instanceCount += draw.m_instances.size();
             }
-            if (box.m_viewProjOverrideIndex >= 0)
+
+            // The instance data of all draws of this frame is written to a single allocation from the dynamic ring buffer,
+            // and each draw reads its own range of instances from it
+            const uint32_t instanceStride = sizeof(ObjectInstanceData);
+            const uint32_t instanceBufferSize = aznumeric_cast<uint32_t>(instanceCount * instanceStride);
+            RHI::Ptr<RPI::DynamicBuffer> instanceBuffer = RPI::DynamicDrawInterface::Get()->GetDynamicBuffer(instanceBufferSize);
+            if (!instanceBuffer)
             {
-                srg->SetConstant(shaderData.m_viewProjectionOverrideIndex, viewProjOverrides[box.m_viewProjOverrideIndex]);
+                AZ_WarningOnce("AuxGeom", false, "Failed to allocate dynamic buffer of size %d.", instanceBufferSize);
+                return;
             }
-            pipelineState->UpdateSrgVariantFallback(srg);
-            srg->Compile();
-            m_processSrgs.push_back(srg);
 
-            uint32_t indexCount = GetBoxIndexCount(drawStyle);
-            auto& indexBufferView = GetBoxIndexBufferView(drawStyle);
-            auto& streamBufferViews = GetBoxStreamBufferViews(drawStyle);
-            auto& drawListTag = shaderData.m_drawListTag;
+            uint8_t* instanceBufferAddress = static_cast<uint8_t*>(instanceBuffer->GetBufferAddress());
+            const RHI::StreamBufferView instanceBufferView = instanceBuffer->GetStreamBufferView(instanceStride);
+
+            RHI::DrawPacketBuilder drawPacketBuilder;
+            uint32_t instanceOffset = 0;
+            for (InstancedDraw& draw : m_instancedDraws)
+            {
+                const uint32_t drawInstanceCount = aznumeric_cast<uint32_t>(draw.m_instances.size());
+                const uint32_t drawByteOffset = instanceOffset * instanceStride;
+                memcpy(instanceBufferAddress + drawByteOffset, draw.m_instances.data(), drawInstanceCount * instanceStride);
+                instanceOffset += drawInstanceCount;
+
+                StreamBufferViewsForAllStreams streamBufferViews = *draw.m_streamBufferViews;
+                streamBufferViews.push_back(RHI::StreamBufferView(
+                    *instanceBufferView.GetBuffer(), instanceBufferView.GetByteOffset() + drawByteOffset, drawInstanceCount * instanceStride,
+                    instanceStride));
+
+                if (!m_streamBufferViewsValidatedForLayout[draw.m_drawStyle])
+                {
+                    m_streamBufferViewsValidatedForLayout[draw.m_drawStyle] =
+                        RHI::ValidateStreamBufferViews(m_objectStreamLayout[draw.m_drawStyle], streamBufferViews);
+                }
 
-            return BuildDrawPacket(
-                drawPacketBuilder, srg, indexCount, indexBufferView, streamBufferViews, drawListTag, pipelineState->GetRHIPipelineState(),
-                sortKey);
+                const RHI::DrawPacket* drawPacket = BuildDrawPacket(
+                    drawPacketBuilder, draw.m_srg, draw.m_indexCount, drawInstanceCount, *draw.m_indexBufferView, streamBufferViews,
+                    draw.m_drawListTag, draw.m_pipelineState, draw.m_sortKey);
+                if (!drawPacket)
+                {
+                    continue;
+                }
+                m_drawPackets.emplace_back(drawPacket);
+
+                if (draw.m_view)
+                {
+                    draw.m_view->AddDrawPacket(drawPacket);
+                    continue;
+                }
+
+                for (auto& view : fpPacket.m_views)
+                {
+                    // If this view is ignoring packets with our draw list tag then skip this view
+                    if (!view->HasDrawListTag(draw.m_drawListTag))
+                    {
+                        continue;
+                    }
+                    view->AddDrawPacket(drawPacket);
+                }
+            }
         }
 
         const RHI::DrawPacket* FixedShapeProcessor::BuildDrawPacket(
             RHI::DrawPacketBuilder& drawPacketBuilder,
             AZ::Data::Instance<RPI::ShaderResourceGroup>& srg,
             uint32_t indexCount,
+            uint32_t instanceCount,
             const RHI::IndexBufferView& indexBufferView,
             const StreamBufferViewsForAllStreams& streamBufferViews,
             RHI::DrawListTag drawListTag,
@@ -1719,6 +1814,7 @@ namespace AZ
             drawIndexed.m_indexCount = indexCount;
             drawIndexed.m_indexOffset = 0;
             drawIndexed.m_vertexOffset = 0;
+            drawIndexed.m_instanceCount = instanceCount;
 
             drawPacketBuilder.Begin(nullptr);
             drawPacketBuilder.SetDrawArguments(drawIndexed);
@@ -21,6 +21,8 @@
 #include <Atom/RHI.Reflect/Limits.h>
 
 #include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/hash.h>
 
 #include "AuxGeomBase.h"
 
@@ -37,6 +39,7 @@ namespace AZ
         class Shader;
         class ShaderVariant;
         class ShaderOptionGroup;
+        class View;
     }
 
     namespace Render
@@ -118,6 +121,57 @@ namespace AZ
                 AZStd::vector<float> m_lodScreenPercentages;
             };
 
+            //! The per-instance data of a shape or box, which the object shaders read from the instance stream.
+            //! The layout has to match the instance stream channels set up in SetupInputStreamLayout.
+            struct ObjectInstanceData
+            {
+                float m_color[4];
+                float m_modelToWorld[12];   // row major float3x4
+                float m_pointSize;          // only used for DrawStyle_Point
+                float m_padding[3];
+                float m_normalMatrix[12];   // row major float3x3 with padded rows, only used for DrawStyle_Shaded
+            };
+
+            //! A draw of one or more instances of the same geometry with the same pipeline state
+            struct InstancedDraw
+            {
+                int m_drawStyle = DrawStyle_Line;
+                uint32_t m_indexCount = 0;
+                const RHI::IndexBufferView* m_indexBufferView = nullptr;
+                const StreamBufferViewsForAllStreams* m_streamBufferViews = nullptr;
+                RHI::DrawListTag m_drawListTag;
+                const RHI::PipelineState* m_pipelineState = nullptr;
+                Data::Instance<RPI::ShaderResourceGroup> m_srg;
+                RPI::View* m_view = nullptr; // if null the draw is added to every view with the draw list tag
+                RHI::DrawItemSortKey m_sortKey = 0;
+                AZStd::vector<ObjectInstanceData> m_instances;
+            };
+
+            //! Identifies the instanced draw that an opaque instance can be added to
+            struct InstancedDrawKey
+            {
+                const RHI::IndexBufferView* m_indexBufferView = nullptr;
+                const RHI::PipelineState* m_pipelineState = nullptr;
+                const RPI::View* m_view = nullptr;
+                int32_t m_viewProjOverrideIndex = -1;
+
+                bool operator==(const InstancedDrawKey& rhs) const
+                {
+                    return m_indexBufferView == rhs.m_indexBufferView && m_pipelineState == rhs.m_pipelineState && m_view == rhs.m_view &&
+                        m_viewProjOverrideIndex == rhs.m_viewProjOverrideIndex;
+                }
+            };
+
+            struct InstancedDrawKeyHasher
+            {
+                size_t operator()(const InstancedDrawKey& key) const
+                {
+                    size_t hash = 0;
+                    AZStd::hash_combine(hash, key.m_indexBufferView, key.m_pipelineState, key.m_view, key.m_viewProjOverrideIndex);
+                    return hash;
+                }
+            };
+
             struct PipelineStateOptions
             {
                 AuxGeomShapePerpectiveType m_perpectiveType = PerspectiveType_ViewProjection;
@@ -173,34 +227,64 @@ namespace AZ
             const StreamBufferViewsForAllStreams& GetShapeStreamBufferViews(AuxGeomShapeType shapeType, LodIndex lodIndex, int drawStyle) const;
             uint32_t GetShapeIndexCount(AuxGeomShapeType shapeType, int drawStyle, LodIndex lodIndex);
 
-            //! Uses the given drawPacketBuilder to build a draw packet for given shape and state and returns it
-            const RHI::DrawPacket* BuildDrawPacketForShape(
-                RHI::DrawPacketBuilder& drawPacketBuilder,
+            //! Fills the transform, normal matrix, color and point size of an instance
+            static void FillInstanceData(
+                ObjectInstanceData& instance,
+                const AZ::Color& color,
+                const AZ::Matrix3x3& rotation,
+                const AZ::Vector3& position,
+                const AZ::Vector3& scale,
+                float pointSize);
+
+            //! Adds an instance of the given shape to the draws of this frame
+            void AddShapeInstance(
                 const ShapeBufferEntry& shape,
                 int drawStyle,
                 const AZStd::vector<AZ::Matrix4x4>& viewProjOverrides,
                 const RPI::Ptr<RPI::PipelineStateForDraw>& pipelineState,
                 LodIndex lodIndex,
+                RPI::View* view,
+                bool isOpaque,
                 RHI::DrawItemSortKey sortKey = 0);
 
             const AZ::RHI::IndexBufferView& GetBoxIndexBufferView(int drawStyle) const;
             const StreamBufferViewsForAllStreams& GetBoxStreamBufferViews(int drawStyle) const;
             uint32_t GetBoxIndexCount(int drawStyle);
 
-            //! Uses the given drawPacketBuilder to build a draw packet for given box and state and returns it
-            const RHI::DrawPacket* BuildDrawPacketForBox(
-                RHI::DrawPacketBuilder& drawPacketBuilder,
+            //! Adds an instance of the given box to the draws of this frame
+            void AddBoxInstance(
                 const BoxBufferEntry& box,
                 int drawStyle,
-                const AZStd::vector<AZ::Matrix4x4>& overrideViewProjMatrices,
+                const AZStd::vector<AZ::Matrix4x4>& viewProjOverrides,
                 const RPI::Ptr<RPI::PipelineStateForDraw>& pipelineState,
+                RPI::View* view,
+                bool isOpaque,
                 RHI::DrawItemSortKey sortKey = 0);
 
+            //! Adds an instance to the draws of this frame. Opaque instances are appended to the draw using the same geometry, pipeline state,
+            //! view and view projection override, if there is one. Other instances get a draw of their own.
+            void AddInstance(
+                const ObjectInstanceData& instance,
+                int drawStyle,
+                uint32_t indexCount,
+                const RHI::IndexBufferView& indexBufferView,
+                const StreamBufferViewsForAllStreams& streamBufferViews,
+                int32_t viewProjOverrideIndex,
+                const AZStd::vector<AZ::Matrix4x4>& viewProjOverrides,
+                const RPI::Ptr<RPI::PipelineStateForDraw>& pipelineState,
+                RPI::View* view,
+                bool isOpaque,
+                RHI::DrawItemSortKey sortKey);
+
+            //! Writes the instance data of all draws into a dynamic buffer and builds their draw packets
+            void BuildInstancedDrawPackets(const RPI::FeatureProcessor::RenderPacket& fpPacket);
+
             //! Uses the given drawPacketBuilder to build a draw packet with the given data
             const RHI::DrawPacket* BuildDrawPacket(
                 RHI::DrawPacketBuilder& drawPacketBuilder,
                 AZ::Data::Instance<RPI::ShaderResourceGroup>& srg,
                 uint32_t indexCount,
+                uint32_t instanceCount,
                 const RHI::IndexBufferView& indexBufferView,
                 const StreamBufferViewsForAllStreams& streamBufferViews,
                 RHI::DrawListTag drawListTag,
@@ -231,8 +315,8 @@ namespace AZ
 
             enum ShapeLightingStyle
             {
-                ShapeLightingStyle_ConstantColor, // color from srg
-                ShapeLightingStyle_Directional, // color from srg * dot product(normal, hard coded direction)
+                ShapeLightingStyle_ConstantColor, // color from instance data
+                ShapeLightingStyle_Directional, // color from instance data * dot product(normal, hard coded direction)
 
                 ShapeLightingStyle_Count
             };
@@ -240,18 +324,22 @@ namespace AZ
             struct ShaderData
             {
                 AZ::Data::Asset<AZ::RPI::ShaderResourceGroupAsset> m_perObjectSrgAsset;
+                Data::Instance<RPI::ShaderResourceGroup> m_defaultSRG; // default SRG for draws not overriding the view projection matrix
                 AZ::RHI::DrawListTag m_drawListTag;
-                AZ::RHI::ShaderInputNameIndex m_colorIndex = "m_color";
-                AZ::RHI::ShaderInputNameIndex m_modelToWorldIndex = "m_modelToWorld";
-                AZ::RHI::ShaderInputNameIndex m_normalMatrixIndex = "m_normalMatrix";
                 AZ::RHI::ShaderInputNameIndex m_viewProjectionOverrideIndex = "m_viewProjectionOverride";
-                AZ::RHI::ShaderInputNameIndex m_pointSizeIndex = "m_pointSize";
             };
             ShaderData m_perObjectShaderData[ShapeLightingStyle_Count];
             ShaderData& GetShaderDataForDrawStyle(int drawStyle) {return m_perObjectShaderData[drawStyle == DrawStyle_Shaded];}
 
             AZStd::vector<AZStd::unique_ptr<const RHI::DrawPacket>> m_drawPackets;
 
+            //! The draws of the current frame, and the lookup of the draws that opaque instances are batched into
+            AZStd::vector<InstancedDraw> m_instancedDraws;
+            AZStd::unordered_map<InstancedDrawKey, size_t, InstancedDrawKeyHasher> m_instancedDrawLookup;
+
+            //! Flags to see if the stream buffer views with the instance stream have been validated for a draw style's layout
+            bool m_streamBufferViewsValidatedForLayout[DrawStyle_Count] = {};
+
             const AZ::RPI::Scene* m_scene = nullptr;
 
             bool m_needUpdatePipelineStates = false;
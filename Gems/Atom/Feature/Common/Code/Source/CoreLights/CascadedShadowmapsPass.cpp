@@ -154,9 +154,35 @@ namespace AZ
             }
 
             UpdateShadowmapImageSize();
+
+            for (const RPI::Ptr<RPI::Pass>& child : GetChildren())
+            {
+                static_cast<ShadowmapPass*>(child.get())->SetCachingEnabled(m_cachingEnabled);
+            }
+
             Base::BuildInternal();
         }
 
+        void CascadedShadowmapsPass::FrameBeginInternal(FramePrepareParams params)
+        {
+            if (m_cachingEnabled != ShadowmapPass::IsCachingEnabled())
+            {
+                QueueForBuildAndInitialization();
+            }
+            else if (m_cachingEnabled)
+            {
+                // Each cascade has its own array slice, so they are cached independently.
+                // Cascades follow the camera, so they are only reused while the camera and the light don't move.
+                for (const RPI::Ptr<RPI::Pass>& child : GetChildren())
+                {
+                    auto* pass = static_cast<ShadowmapPass*>(child.get());
+                    pass->SetUseCachedShadowmap(!pass->UpdateContentHash());
+                }
+            }
+
+            Base::FrameBeginInternal(params);
+        }
+
         void CascadedShadowmapsPass::GetPipelineViewTags(RPI::SortedPipelineViewTags& outTags) const
         {
             for (size_t childIndex = 0; childIndex < m_numberOfCascades; ++childIndex)
@@ -235,6 +261,12 @@ namespace AZ
             const uint32_t shadowmapWidth = static_cast<uint32_t>(m_atlas.GetBaseShadowmapSize());
             imageDescriptor.m_size = RHI::Size(shadowmapWidth, shadowmapWidth, 1);
             imageDescriptor.m_arraySize = m_atlas.GetArraySliceCount();
+
+            m_cachingEnabled = ShadowmapPass::IsCachingEnabled() && ShadowmapPass::ImportCachedShadowmapImage(*attachment, m_cachedShadowmapImage);
+            if (!m_cachingEnabled)
+            {
+                m_cachedShadowmapImage = nullptr;
+            }
         }
 
     } // namespace Render
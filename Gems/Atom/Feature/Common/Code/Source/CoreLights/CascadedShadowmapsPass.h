@@ -49,6 +49,7 @@ namespace AZ
 
             // RPI::Pass overrides...
             void BuildInternal() override;
+            void FrameBeginInternal(FramePrepareParams params) override;
             void GetPipelineViewTags(RPI::SortedPipelineViewTags& outTags) const override;
             void GetViewDrawListInfo(RHI::DrawListMask& outDrawListMask, RPI::PassesByDrawList& outPassesByDrawList, const RPI::PipelineViewTag& viewTag) const override;
 
@@ -76,6 +77,10 @@ namespace AZ
 
             ShadowmapAtlas m_atlas;
 
+            // Persistent shadowmap image replacing the transient attachment while shadowmaps are cached.
+            Data::Instance<RPI::AttachmentImage> m_cachedShadowmapImage;
+            bool m_cachingEnabled = false;
+
             ShadowmapSize m_shadowmapSize = ShadowmapSize::None;
             uint32_t m_arraySize = 1;
             bool m_updateChildren = true;
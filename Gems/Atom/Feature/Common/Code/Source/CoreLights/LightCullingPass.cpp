@@ -37,11 +37,16 @@
 #include <Atom/RPI.Public/Image/AttachmentImagePool.h>
 #include <Atom/RHI/ImagePool.h>
 #include <Atom/RPI.Public/Image/AttachmentImage.h>
+#include <AzCore/Console/IConsole.h>
 
 namespace AZ
 {
     namespace Render
     {
+        AZ_CVAR(bool, r_lightCullingClustered, false, nullptr, ConsoleFunctorFlags::Null,
+            "Cull lights and decals against each depth bin (froxel) of a tile instead of the whole tile. "
+            "This costs more in the light culling pass, but keeps fewer lights per bin with depth discontinuities and many overlapping lights.");
+
         enum PlaneType
         {
             PlaneLeft,
@@ -209,7 +214,8 @@ namespace AZ
                 AZStd::array<float, 2> m_gridPixel;
                 AZStd::array<float, 2> m_gridHalfPixel;
                 uint32_t             m_gridWidth;
-                uint32_t             m_padding[3];
+                uint32_t             m_clusteredCulling;
+                uint32_t             m_padding[2];
             } cullingConstants{};
 
             RPI::ViewPtr view = m_pipeline->GetDefaultView();
@@ -219,6 +225,7 @@ namespace AZ
             cullingConstants.m_gridHalfPixel[0] = cullingConstants.m_gridPixel[0] * 0.5f;
             cullingConstants.m_gridHalfPixel[1] = cullingConstants.m_gridPixel[1] * 0.5f;
             cullingConstants.m_gridWidth = GetTileDataBufferResolution().m_width;
+            cullingConstants.m_clusteredCulling = r_lightCullingClustered ? 1 : 0;
 
             m_shaderResourceGroup->SetConstant(m_constantDataIndex, cullingConstants);
         }
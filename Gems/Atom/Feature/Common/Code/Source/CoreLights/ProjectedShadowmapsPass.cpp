@@ -172,9 +172,48 @@ namespace AZ
             imageDescriptor.m_size = RHI::Size(shadowmapWidth, shadowmapWidth, 1);
             imageDescriptor.m_arraySize = m_atlas.GetArraySliceCount();
 
+            m_cachingEnabled = ShadowmapPass::IsCachingEnabled() && ShadowmapPass::ImportCachedShadowmapImage(*attachment, m_cachedShadowmapImage);
+            if (!m_cachingEnabled)
+            {
+                m_cachedShadowmapImage = nullptr;
+            }
+            for (const RPI::Ptr<RPI::Pass>& child : GetChildren())
+            {
+                static_cast<ShadowmapPass*>(child.get())->SetCachingEnabled(m_cachingEnabled);
+            }
+
             Base::BuildInternal();
         }
 
+        void ProjectedShadowmapsPass::FrameBeginInternal(FramePrepareParams params)
+        {
+            if (m_cachingEnabled != ShadowmapPass::IsCachingEnabled())
+            {
+                QueueForBuildAndInitialization();
+            }
+            else if (m_cachingEnabled)
+            {
+                // Several shadowmaps share an array slice and the first of them clears the slice,
+                // so all shadowmaps of a slice are rendered again when any of them changes.
+                AZStd::vector<bool> sliceIsDirty(m_atlas.GetArraySliceCount());
+                for (const RPI::Ptr<RPI::Pass>& child : GetChildren())
+                {
+                    auto* pass = static_cast<ShadowmapPass*>(child.get());
+                    if (pass->UpdateContentHash() && pass->GetArraySlice() < sliceIsDirty.size())
+                    {
+                        sliceIsDirty[pass->GetArraySlice()] = true;
+                    }
+                }
+                for (const RPI::Ptr<RPI::Pass>& child : GetChildren())
+                {
+                    auto* pass = static_cast<ShadowmapPass*>(child.get());
+                    pass->SetUseCachedShadowmap(pass->GetArraySlice() < sliceIsDirty.size() && !sliceIsDirty[pass->GetArraySlice()]);
+                }
+            }
+
+            Base::FrameBeginInternal(params);
+        }
+
         void ProjectedShadowmapsPass::GetPipelineViewTags(RPI::SortedPipelineViewTags& outTags) const
         {
             const size_t childrenCount = GetChildren().size();
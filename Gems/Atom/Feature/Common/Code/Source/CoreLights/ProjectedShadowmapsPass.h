@@ -67,6 +67,7 @@ namespace AZ
 
             // RPI::Pass overrides...
             void BuildInternal() override;
+            void FrameBeginInternal(FramePrepareParams params) override;
             void GetPipelineViewTags(RPI::SortedPipelineViewTags& outTags) const override;
             void GetViewDrawListInfo(RHI::DrawListMask& outDrawListMask, RPI::PassesByDrawList& outPassesByDrawList, const RPI::PipelineViewTag& viewTag) const override;
 
@@ -83,6 +84,10 @@ namespace AZ
             AZStd::vector<ShadowmapSizeWithIndices> m_sizes;
 
             ShadowmapAtlas m_atlas;
+
+            // Persistent shadowmap image replacing the transient attachment while shadowmaps are cached.
+            Data::Instance<RPI::AttachmentImage> m_cachedShadowmapImage;
+            bool m_cachingEnabled = false;
             bool m_updateChildren = true;
         };
     } // namespace Render
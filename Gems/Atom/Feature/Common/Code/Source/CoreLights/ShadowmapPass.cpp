@@ -6,13 +6,23 @@
  */
 
 #include <CoreLights/ShadowmapPass.h>
+#include <Atom/RHI/ShaderResourceGroup.h>
+#include <Atom/RPI.Public/Image/AttachmentImagePool.h>
+#include <Atom/RPI.Public/Image/ImageSystemInterface.h>
 #include <Atom/RPI.Public/Pass/PassUtils.h>
 #include <Atom/RPI.Public/Pass/ParentPass.h>
+#include <Atom/RPI.Public/RenderPipeline.h>
+#include <Atom/RPI.Public/View.h>
+#include <AzCore/Console/IConsole.h>
 
 namespace AZ
 {
     namespace Render
-    {        
+    {
+        AZ_CVAR(bool, r_shadowmapCaching, false, nullptr, ConsoleFunctorFlags::Null,
+            "Keep shadowmaps across frames and only render them again when the light view or a caster in it changes. "
+            "Skinned and vertex animated casters don't invalidate the cached shadowmaps.");
+
         RPI::Ptr<Render::ShadowmapPass> ShadowmapPass::Create(const RPI::PassDescriptor& descriptor)
         {
             return aznew ShadowmapPass(descriptor);
@@ -49,11 +59,48 @@ namespace AZ
             return Create(descriptor);
         }
 
+        bool ShadowmapPass::IsCachingEnabled()
+        {
+            return r_shadowmapCaching;
+        }
+
+        bool ShadowmapPass::ImportCachedShadowmapImage(RPI::PassAttachment& attachment, Data::Instance<RPI::AttachmentImage>& cachedImage)
+        {
+            RHI::ImageDescriptor imageDescriptor = attachment.m_descriptor.m_image;
+            imageDescriptor.m_bindFlags |= RHI::ImageBindFlags::DepthStencil | RHI::ImageBindFlags::ShaderRead;
+
+            if (!cachedImage ||
+                cachedImage->GetDescriptor().m_size != imageDescriptor.m_size ||
+                cachedImage->GetDescriptor().m_arraySize != imageDescriptor.m_arraySize ||
+                cachedImage->GetDescriptor().m_format != imageDescriptor.m_format)
+            {
+                Data::Instance<RPI::AttachmentImagePool> pool = RPI::ImageSystemInterface::Get()->GetSystemAttachmentPool();
+                const RHI::ClearValue clearValue = RHI::ClearValue::CreateDepth(1.f);
+                cachedImage = RPI::AttachmentImage::Create(*pool.get(), imageDescriptor, Name(attachment.m_path.GetCStr()), &clearValue, nullptr);
+                if (!cachedImage)
+                {
+                    AZ_Error("ShadowmapPass", false, "Failed to create the cached shadowmap image, shadowmaps are rendered every frame.");
+                    return false;
+                }
+            }
+
+            attachment.m_descriptor.m_image = imageDescriptor;
+            attachment.m_lifetime = RHI::AttachmentLifetimeType::Imported;
+            attachment.m_path = cachedImage->GetAttachmentId();
+            attachment.m_importedResource = cachedImage;
+            return true;
+        }
+
         void ShadowmapPass::SetArraySlice(uint16_t arraySlice)
         {
             m_arraySlice = arraySlice;
         }
 
+        uint16_t ShadowmapPass::GetArraySlice() const
+        {
+            return m_arraySlice;
+        }
+
         void ShadowmapPass::CreatePassTemplate()
         {
             AZStd::shared_ptr<RPI::PassTemplate> m_childTemplate = AZStd::make_shared<RPI::PassTemplate>();
@@ -86,6 +133,76 @@ namespace AZ
             m_clearEnabled = enabled;
         }
 
+        void ShadowmapPass::SetCachingEnabled(bool enabled)
+        {
+            m_cachingEnabled = enabled;
+            m_isContentHashValid = false;
+        }
+
+        bool ShadowmapPass::UpdateContentHash()
+        {
+            const size_t contentHash = CalculateContentHash();
+            const bool changed = !m_isContentHashValid || contentHash != m_contentHash;
+            m_contentHash = contentHash;
+            m_isContentHashValid = true;
+            return changed;
+        }
+
+        void ShadowmapPass::SetUseCachedShadowmap(bool useCachedShadowmap)
+        {
+            m_useCachedShadowmap = m_cachingEnabled && useCachedShadowmap;
+        }
+
+        size_t ShadowmapPass::CalculateContentHash() const
+        {
+            size_t hash = 0;
+            const AZStd::vector<RPI::ViewPtr>& views = m_pipeline->GetViews(GetPipelineViewTag());
+            if (views.empty())
+            {
+                return hash;
+            }
+            const RPI::ViewPtr& view = views.front();
+
+            const Matrix4x4& worldToClip = view->GetWorldToClipMatrix();
+            for (int32_t row = 0; row < 4; ++row)
+            {
+                for (int32_t column = 0; column < 4; ++column)
+                {
+                    AZStd::hash_combine(hash, worldToClip.GetElement(row, column));
+                }
+            }
+
+            // A caster that moves keeps its draw item, but recompiles its object SRG with the new transform.
+            for (const RHI::DrawItemProperties& drawItemProperties : view->GetDrawList(m_drawListTag))
+            {
+                const RHI::DrawItem* drawItem = drawItemProperties.m_item;
+                AZStd::hash_combine(hash, drawItem);
+                for (uint8_t srgIndex = 0; srgIndex < drawItem->m_shaderResourceGroupCount; ++srgIndex)
+                {
+                    AZStd::hash_combine(hash, drawItem->m_shaderResourceGroups[srgIndex]->GetUpdateCount());
+                }
+                if (drawItem->m_uniqueShaderResourceGroup)
+                {
+                    AZStd::hash_combine(hash, drawItem->m_uniqueShaderResourceGroup->GetUpdateCount());
+                }
+            }
+            return hash;
+        }
+
+        RHI::AttachmentLoadAction ShadowmapPass::GetLoadAction() const
+        {
+            if (m_useCachedShadowmap)
+            {
+                return RHI::AttachmentLoadAction::Load;
+            }
+            if (m_clearEnabled)
+            {
+                return RHI::AttachmentLoadAction::Clear;
+            }
+            // A persistent image still holds the shadowmaps rendered by the other passes of this slice.
+            return m_cachingEnabled ? RHI::AttachmentLoadAction::Load : RHI::AttachmentLoadAction::DontCare;
+        }
+
         void ShadowmapPass::SetViewportScissorFromImageSize(const RHI::Size& imageSize)
         {
             const RHI::Viewport viewport(
@@ -125,13 +242,31 @@ namespace AZ
             }
             const RHI::AttachmentId attachmentId = attachment->GetAttachmentId();
 
+            // The image is rebuilt, so nothing rendered into it can be reused.
+            m_isContentHashValid = false;
+            m_useCachedShadowmap = false;
+
             RHI::AttachmentLoadStoreAction action;
             action.m_clearValue = RHI::ClearValue::CreateDepth(1.f);
-            action.m_loadAction = m_clearEnabled ? RHI::AttachmentLoadAction::Clear : RHI::AttachmentLoadAction::DontCare;
+            action.m_loadAction = GetLoadAction();
             binding.m_unifiedScopeDesc = RHI::UnifiedScopeAttachmentDescriptor(attachmentId, imageViewDescriptor, action);
 
             Base::BuildInternal();
         }
 
+        void ShadowmapPass::FrameBeginInternal(FramePrepareParams params)
+        {
+            RPI::PassAttachmentBinding& binding = GetOutputBinding(0);
+            binding.m_unifiedScopeDesc.m_loadStoreAction.m_loadAction = GetLoadAction();
+
+            Base::FrameBeginInternal(params);
+
+            if (m_useCachedShadowmap)
+            {
+                // The shadowmap from a previous frame is kept, so there is nothing to draw.
+                m_drawListView = {};
+            }
+        }
+
       } // namespace Render
 } // namespace AZ
@@ -7,8 +7,10 @@
 #pragma once
 
 #include <Atom/RHI.Reflect/Size.h>
+#include <Atom/RPI.Public/Image/AttachmentImage.h>
 #include <Atom/RPI.Public/Pass/RasterPass.h>
 #include <Atom/RPI.Reflect/Pass/RasterPassData.h>
+#include <AzCore/std/hash.h>
 
 namespace AZ
 {
@@ -36,12 +38,35 @@ namespace AZ
             //! This function assumes the parent pass has a SkinnedMeshes input slot
             static RPI::Ptr<ShadowmapPass> CreateWithPassRequest(const Name& passName, AZStd::shared_ptr<RPI::RasterPassData> passData);
 
+            //! This returns true if shadowmaps are cached across frames (r_shadowmapCaching).
+            static bool IsCachingEnabled();
+
+            //! This replaces the transient shadowmap image attachment of a parent pass by a persistent image,
+            //! so the shadowmaps rendered into it can be reused in later frames.
+            //! The image is only recreated when the attachment descriptor differs from the one of the given image.
+            //! @return true if the attachment uses the persistent image.
+            static bool ImportCachedShadowmapImage(RPI::PassAttachment& attachment, Data::Instance<RPI::AttachmentImage>& cachedImage);
+
             //! This updates array slice for this shadowmap.
             void SetArraySlice(uint16_t arraySlice);
 
+            //! This returns the array slice of this shadowmap.
+            uint16_t GetArraySlice() const;
+
             //! This enable/disable clearing of the image view.
             void SetClearEnabled(bool enabled);
 
+            //! This enables/disables caching of the shadowmap across frames.
+            //! When enabled, the image view is loaded instead of discarded if it isn't cleared.
+            void SetCachingEnabled(bool enabled);
+
+            //! This updates the hash of the view and the draw items rendered into this shadowmap.
+            //! @return true if the shadowmap has to be rendered again because the hash changed since the last call.
+            bool UpdateContentHash();
+
+            //! This makes the pass keep the cached shadowmap of a previous frame instead of rendering its draw items.
+            void SetUseCachedShadowmap(bool useCachedShadowmap);
+
             //! This update viewport and scissor for this shadowmap from the given image size.
             void SetViewportScissorFromImageSize(const RHI::Size& imageSize);
 
@@ -54,9 +79,17 @@ namespace AZ
 
             // RHI::Pass overrides...
             void BuildInternal() override;
+            void FrameBeginInternal(FramePrepareParams params) override;
+
+            RHI::AttachmentLoadAction GetLoadAction() const;
+            size_t CalculateContentHash() const;
 
+            size_t m_contentHash = 0;
             uint16_t m_arraySlice = 0;
             bool m_clearEnabled = true;
+            bool m_cachingEnabled = false;
+            bool m_useCachedShadowmap = false;
+            bool m_isContentHashValid = false;
         };
     } // namespace Render
 } // namespace AZ
@@ -25,6 +25,9 @@ namespace AZ
         {
             static const char* BaseColorTextureMapName = "baseColor.textureMap";
 
+            // Like the image builder, the smallest mips are merged into the always resident tail mip chain until it holds this much per image
+            static constexpr uint32_t TailMipChainMaxBytesPerImage = 64 * 1024;
+
             static AZ::Data::AssetId GetImagePoolId()
             {
                 const Data::Instance<RPI::StreamingImagePool>& imagePool = RPI::ImageSystemInterface::Get()->GetSystemStreamingPool();
@@ -101,8 +104,8 @@ namespace AZ
         int DecalTextureArray::AddMaterial(const AZ::Data::AssetId materialAssetId)
         {
             AZ_Error("DecalTextureArray", FindMaterial(materialAssetId) == -1, "Adding material when it already exists in the array");
-            // Invalidate the existing texture array, as we need to repack it taking into account the new material.
-            m_textureArrayPacked = nullptr;
+            // The existing texture array stays in use until it is repacked with the new material.
+            m_needsPacking = true;
 
             MaterialData materialData;
             materialData.m_materialAssetId = materialAssetId;
@@ -121,14 +124,26 @@ namespace AZ
             return m_materials[index].m_materialAssetId;
         }
 
-        RHI::Size DecalTextureArray::GetImageDimensions() const
+        RHI::ImageDescriptor DecalTextureArray::GetSourceImageDescriptor() const
         {
-            AZ_Assert(m_materials.size() > 0, "GetImageDimensions() cannot be called until at least one material has been added");
+            AZ_Assert(m_materials.size() > 0, "GetSourceImageDescriptor() cannot be called until at least one material has been added");
+            // All textures in a texture array must have the same size, format and mips, so use the packed ones if there are any
+            if (!m_packedMipChains.empty())
+            {
+                return m_packedImageDescriptor;
+            }
+
+            // Otherwise none of the materials is packed and they are all loaded, so just pick the first
             const int iter = m_materials.begin();
-            // All textures in a texture array must have the same size, so just pick the first 
             const MaterialData& firstMaterial = m_materials[iter];
             const auto& baseColorAsset = GetBaseColorImageAsset(firstMaterial.m_materialAssetData);
-            return baseColorAsset->GetImageDescriptor().m_size;
+            return baseColorAsset->GetImageDescriptor();
+        }
+
+        RHI::Size DecalTextureArray::GetImageDimensions() const
+        {
+            AZ_Assert(m_materials.size() > 0, "GetImageDimensions() cannot be called until at least one material has been added");
+            return GetSourceImageDescriptor().m_size;
         }
 
         const AZ::Data::Instance<AZ::RPI::StreamingImage>& DecalTextureArray::GetPackedTexture() const
@@ -141,14 +156,14 @@ namespace AZ
             return GetStreamingImageAsset(materialAsset, AZ::Name(BaseColorTextureMapName)).IsReady();
         }
 
-        AZ::Data::Asset<AZ::RPI::ImageMipChainAsset> DecalTextureArray::BuildPackedMipChainAsset(const size_t numTexturesToCreate)
+        AZ::Data::Asset<AZ::RPI::ImageMipChainAsset> DecalTextureArray::BuildPackedMipChainAsset(
+            const Data::AssetId& assetId, const size_t numTexturesToCreate, const uint16_t startMip, const uint16_t mipCount)
         {
             RPI::ImageMipChainAssetCreator assetCreator;
-            const uint32_t mipLevels = GetNumMipLevels();
 
-            assetCreator.Begin(Data::AssetId(AZ::Uuid::CreateRandom()), mipLevels, aznumeric_cast<uint16_t>(numTexturesToCreate));
+            assetCreator.Begin(assetId, mipCount, aznumeric_cast<uint16_t>(numTexturesToCreate));
 
-            for (uint32_t mipLevel = 0; mipLevel < mipLevels; ++mipLevel)
+            for (uint16_t mipLevel = startMip; mipLevel < startMip + mipCount; ++mipLevel)
             {
                 const auto& layout = GetLayout(mipLevel);
                 assetCreator.BeginMip(layout);
@@ -168,6 +183,24 @@ namespace AZ
             return AZStd::move(asset);
         }
 
+        uint16_t DecalTextureArray::GetTailMipChainStart() const
+        {
+            const uint16_t mipLevels = GetNumMipLevels();
+            uint16_t tailMipChainStart = mipLevels - 1;
+            uint32_t tailMipChainBytesPerImage = GetLayout(tailMipChainStart).m_bytesPerImage;
+            while (tailMipChainStart > 0)
+            {
+                const uint32_t nextMipBytesPerImage = GetLayout(tailMipChainStart - 1).m_bytesPerImage;
+                if (tailMipChainBytesPerImage + nextMipBytesPerImage > TailMipChainMaxBytesPerImage)
+                {
+                    break;
+                }
+                tailMipChainBytesPerImage += nextMipBytesPerImage;
+                --tailMipChainStart;
+            }
+            return tailMipChainStart;
+        }
+
         RHI::ImageDescriptor DecalTextureArray::CreatePackedImageDescriptor(const uint16_t arraySize, const uint16_t mipLevels) const
         {
             const RHI::Size imageDimensions = GetImageDimensions();
@@ -188,21 +221,59 @@ namespace AZ
             }
 
             const size_t numTexturesToCreate = m_materials.array_size();
-            const auto mipChainAsset = BuildPackedMipChainAsset(numTexturesToCreate);
+            const RHI::ImageDescriptor sourceImageDescriptor = GetSourceImageDescriptor();
+            const uint16_t mipLevels = sourceImageDescriptor.m_mipLevels;
+            const uint16_t tailMipChainStart = GetTailMipChainStart();
+
+            // Each mip before the tail gets its own mip chain, so the streaming controller can expand and trim them one at a time
+            const Uuid packedAssetGuid = Uuid::CreateRandom();
+            AZStd::vector<Data::Asset<RPI::ImageMipChainAsset>> mipChainAssets;
+            AZStd::vector<uint16_t> mipChainStarts;
+            for (uint16_t mipChainStart = 0; mipChainStart <= tailMipChainStart; ++mipChainStart)
+            {
+                const uint16_t mipCount = mipChainStart == tailMipChainStart ? mipLevels - tailMipChainStart : 1;
+                const Data::AssetId mipChainAssetId(packedAssetGuid, aznumeric_cast<uint32_t>(mipChainAssets.size() + 1));
+                auto mipChainAsset = BuildPackedMipChainAsset(mipChainAssetId, numTexturesToCreate, mipChainStart, mipCount);
+                if (!mipChainAsset)
+                {
+                    AZ_Error("TextureArrayData", false, "Pack() call failed to build mip chain %u.", mipChainStart);
+                    return;
+                }
+                mipChainAssets.push_back(AZStd::move(mipChainAsset));
+                mipChainStarts.push_back(mipChainStart);
+            }
+
             RHI::ImageViewDescriptor imageViewDescriptor;
             imageViewDescriptor.m_isArray = true;
 
             RPI::StreamingImageAssetCreator assetCreator;
-            assetCreator.Begin(Data::AssetId(Uuid::CreateRandom()));
+            assetCreator.Begin(Data::AssetId(packedAssetGuid, 0));
             assetCreator.SetPoolAssetId(GetImagePoolId());
-            assetCreator.SetFlags(RPI::StreamingImageFlags::None);
-            assetCreator.SetImageDescriptor(CreatePackedImageDescriptor(aznumeric_cast<uint16_t>(numTexturesToCreate), GetNumMipLevels()));
+            assetCreator.SetFlags(mipChainAssets.size() == 1 ? RPI::StreamingImageFlags::NotStreamable : RPI::StreamingImageFlags::None);
+            assetCreator.SetImageDescriptor(CreatePackedImageDescriptor(aznumeric_cast<uint16_t>(numTexturesToCreate), mipLevels));
             assetCreator.SetImageViewDescriptor(imageViewDescriptor);
-            assetCreator.AddMipChainAsset(*mipChainAsset);
+            for (auto& mipChainAsset : mipChainAssets)
+            {
+                assetCreator.AddMipChainAsset(*mipChainAsset);
+            }
             Data::Asset<RPI::StreamingImageAsset> packedAsset;
             const bool createdOk = assetCreator.End(packedAsset);
             AZ_Error("TextureArrayData", createdOk, "Pack() call failed.");
-            m_textureArrayPacked = createdOk ? RPI::StreamingImage::FindOrCreate(packedAsset) : nullptr;
+            if (!createdOk)
+            {
+                return;
+            }
+            m_textureArrayPacked = RPI::StreamingImage::FindOrCreate(packedAsset);
+
+            // Keep the packed images so the next Pack() only needs to load the materials added after this one
+            m_packedMipChains = AZStd::move(mipChainAssets);
+            m_packedMipChainStarts = AZStd::move(mipChainStarts);
+            m_packedImageDescriptor = sourceImageDescriptor;
+            for (int iter = m_materials.begin(); iter != -1; iter = m_materials.next(iter))
+            {
+                m_materials[iter].m_isPacked = true;
+            }
+            m_needsPacking = false;
 
             // Free unused memory
             ClearAssets();
@@ -213,6 +284,11 @@ namespace AZ
             return m_materials.size();
         }
 
+        bool DecalTextureArray::HasFreeSlot() const
+        {
+            return m_materials.size() < m_materials.array_size();
+        }
+
         void DecalTextureArray::OnAssetReady(Data::Asset<Data::AssetData> asset)
         {
             AZ::Data::AssetBus::MultiHandler::BusDisconnect(asset.GetId());
@@ -227,19 +303,14 @@ namespace AZ
         uint16_t DecalTextureArray::GetNumMipLevels() const
         {
             AZ_Assert(m_materials.size() > 0, "GetNumMipLevels() cannot be called until at least one material has been added");
-            // All decals in a texture array must have the same number of mips, so just pick the first 
-            const int iter = m_materials.begin();
-            const MaterialData& firstMaterial = m_materials[iter];
-            const auto& baseColorAsset = GetBaseColorImageAsset(firstMaterial.m_materialAssetData);
-            return baseColorAsset->GetImageDescriptor().m_mipLevels;
+            return GetSourceImageDescriptor().m_mipLevels;
         }
 
         RHI::ImageSubresourceLayout DecalTextureArray::GetLayout(int mip) const
         {
             AZ_Assert(m_materials.size() > 0, "GetLayout() cannot be called unless at least one material has been added");
 
-            const int iter = m_materials.begin();
-            const auto& descriptor = GetBaseColorImageAsset(m_materials[iter].m_materialAssetData)->GetImageDescriptor();
+            const RHI::ImageDescriptor descriptor = GetSourceImageDescriptor();
             RHI::Size mipSize = descriptor.m_size;
             mipSize.m_width >>= mip;
             mipSize.m_height >>= mip;
@@ -251,23 +322,42 @@ namespace AZ
             // We always want to provide valid data to the AssetCreator for each texture.
             // If this spot in the array is empty, just provide some random image as filler.
             // (No decals will be indexing this spot anyway)
-            const bool isEmptySlot = !m_materials[arrayLevel].m_materialAssetData.GetId().IsValid();
+            const bool isEmptySlot = !m_materials[arrayLevel].m_materialAssetId.IsValid();
             if (isEmptySlot)
             {
                 arrayLevel = m_materials.begin();
             }
 
+            if (m_materials[arrayLevel].m_isPacked)
+            {
+                return GetPackedImageData(arrayLevel, mip);
+            }
+
             const auto image = GetBaseColorImageAsset(m_materials[arrayLevel].m_materialAssetData);
             const auto srcData = image->GetSubImageData(mip, 0);
             return srcData;
         }
 
+        AZStd::array_view<uint8_t> DecalTextureArray::GetPackedImageData(int arrayLevel, const int mip) const
+        {
+            // The mip chains are sorted from the most detailed one to the tail
+            for (size_t mipChainIndex = 0; mipChainIndex < m_packedMipChains.size(); ++mipChainIndex)
+            {
+                const RPI::ImageMipChainAsset* mipChainAsset = m_packedMipChains[mipChainIndex].Get();
+                const int mipChainStart = m_packedMipChainStarts[mipChainIndex];
+                if (mip < mipChainStart + mipChainAsset->GetMipLevelCount())
+                {
+                    return mipChainAsset->GetSubImageData(mip - mipChainStart, arrayLevel);
+                }
+            }
+            AZ_Assert(false, "GetPackedImageData() called with mip %d, which is not in the packed texture array", mip);
+            return {};
+        }
+
         AZ::RHI::Format DecalTextureArray::GetFormat() const
         {
             AZ_Assert(m_materials.size() > 0, "GetFormat() can only be called after at least one material has been added.");
-            const int iter = m_materials.begin();
-            const auto& baseColorAsset = GetBaseColorImageAsset(m_materials[iter].m_materialAssetData);
-            return baseColorAsset->GetImageDescriptor().m_format;
+            return GetSourceImageDescriptor().m_format;
         }
 
         bool DecalTextureArray::AreAllAssetsReady() const
@@ -285,6 +375,11 @@ namespace AZ
 
         bool DecalTextureArray::IsAssetReady(const MaterialData& materialData) const
         {
+            if (materialData.m_isPacked)
+            {
+                return true;
+            }
+
             const auto& id = materialData.m_materialAssetData.GetId();
             return id.IsValid() && materialData.m_materialAssetData.IsReady();
         }
@@ -306,7 +401,7 @@ namespace AZ
 
         void DecalTextureArray::QueueAssetLoad(MaterialData& materialData)
         {
-            if (materialData.m_materialAssetData.IsReady())
+            if (materialData.m_isPacked || materialData.m_materialAssetData.IsReady())
                 return;
 
             m_assetsCurrentlyLoading.emplace(materialData.m_materialAssetId);
@@ -329,7 +424,7 @@ namespace AZ
             if (m_materials.size() == 0)
                 return false;
 
-            return m_textureArrayPacked == nullptr;
+            return m_needsPacking;
         }
 
     }
@@ -29,6 +29,8 @@ namespace AZ
     {
         //! Helper class used by DecalTextureArrayFeatureProcessor.
         //! Given a set of images (all with the same dimensions and format), it can pack them together into a single textureArray that can be sent to the GPU.
+        //! Repacking only loads the materials added since the last pack, the images of the others are copied from the previous texture array.
+        //! The texture array is split in mip chains so the streaming image controller can stream its larger mips like other textures.
         class DecalTextureArray : public Data::AssetBus::MultiHandler
         {
         public:
@@ -36,6 +38,8 @@ namespace AZ
             int AddMaterial(const AZ::Data::AssetId materialAssetId);
             void RemoveMaterial(const int index);
             size_t NumMaterials() const;
+            //! Returns true if a material can be added without growing the texture array.
+            bool HasFreeSlot() const;
 
             AZ::Data::AssetId GetMaterialAssetId(const int index) const;
 
@@ -51,14 +55,20 @@ namespace AZ
                 AZ::Data::AssetId m_materialAssetId;
                 // We will clear this to nullptr as soon as it is packed in order to release the memory. Note that we might need to reload it in order to repack it.
                 AZ::Data::Asset<Data::AssetData> m_materialAssetData;
+                // True once the image of the material is in m_packedMipChains, so it doesn't need to be loaded again to repack.
+                bool m_isPacked = false;
             };
 
             void OnAssetReady(Data::Asset<Data::AssetData> asset) override;
 
             int FindMaterial(const AZ::Data::AssetId materialAssetId) const;
 
-            // packs the contents of the source images into a texture array readable by the GPU and returns it
-            AZ::Data::Asset<AZ::RPI::ImageMipChainAsset> BuildPackedMipChainAsset(const size_t numTexturesToCreate);
+            // packs the mips [startMip, startMip + mipCount) of the source images into a mip chain of a texture array readable by the GPU and returns it
+            AZ::Data::Asset<AZ::RPI::ImageMipChainAsset> BuildPackedMipChainAsset(
+                const Data::AssetId& assetId, const size_t numTexturesToCreate, const uint16_t startMip, const uint16_t mipCount);
+
+            // returns the first mip of the tail mip chain, the mips after it are small enough to always be resident
+            uint16_t GetTailMipChainStart() const;
 
             RHI::ImageDescriptor CreatePackedImageDescriptor(const uint16_t arraySize, const uint16_t mipLevels) const;
 
@@ -67,6 +77,8 @@ namespace AZ
             RHI::Format GetFormat() const;
             RHI::ImageSubresourceLayout GetLayout(int mip) const;
             AZStd::array_view<uint8_t> GetRawImageData(int arrayLevel, int mip) const;
+            AZStd::array_view<uint8_t> GetPackedImageData(int arrayLevel, int mip) const;
+            RHI::ImageDescriptor GetSourceImageDescriptor() const;
 
             bool AreAllAssetsReady() const;
             bool IsAssetReady(const MaterialData& materialData) const;
@@ -81,6 +93,13 @@ namespace AZ
 
             IndexableList<MaterialData> m_materials;
             Data::Instance<RPI::StreamingImage> m_textureArrayPacked;
+            bool m_needsPacking = false;
+
+            // Mip chains of m_textureArrayPacked, from the most detailed to the tail, and the first mip of each of them.
+            AZStd::vector<AZ::Data::Asset<AZ::RPI::ImageMipChainAsset>> m_packedMipChains;
+            AZStd::vector<uint16_t> m_packedMipChainStarts;
+            // Descriptor of the images in m_packedMipChains, all the images of the array share it.
+            RHI::ImageDescriptor m_packedImageDescriptor;
              
             AZStd::unordered_set<AZ::Data::AssetId> m_assetsCurrentlyLoading;
         };
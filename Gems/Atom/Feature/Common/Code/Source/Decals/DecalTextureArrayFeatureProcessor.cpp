@@ -6,6 +6,7 @@
  */
 
 #include <Decals/DecalTextureArrayFeatureProcessor.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Debug/EventTrace.h>
 #include <Atom/RHI/Factory.h>
 #include <Atom/RPI.Public/RPISystemInterface.h>
@@ -23,6 +24,10 @@ namespace AZ
 {
     namespace Render
     {
+        AZ_CVAR(uint32_t, r_decalMaxUnusedMaterials, 64, nullptr, ConsoleFunctorFlags::Null,
+            "Number of materials kept in the decal texture arrays after their last decal is released, so decals using them again don't "
+            "need to reload and repack them. The least recently used ones are evicted first.");
+
         namespace
         {
             static AZ::RHI::Size GetTextureSizeFromMaterialAsset(const AZ::RPI::MaterialAsset* materialAsset)
@@ -79,6 +84,7 @@ namespace AZ
             AZ::Data::AssetBus::MultiHandler::BusDisconnect();
 
             m_decalData.Clear();
+            m_unusedMaterials.clear();
             m_decalBufferHandler.Release();
         }
 
@@ -309,6 +315,10 @@ namespace AZ
                 if (iter != m_materialToTextureArrayLookupTable.end())
                 {
                     // This material is already loaded and registered with this feature processor
+                    if (iter->second.m_useCount == 0)
+                    {
+                        m_unusedMaterials.erase(AZStd::find(m_unusedMaterials.begin(), m_unusedMaterials.end(), material));
+                    }
                     iter->second.m_useCount++;
                     SetDecalTextureLocation(handle, iter->second.m_location);
                     return;
@@ -353,7 +363,21 @@ namespace AZ
             }
             else
             {
-                textureIndex = m_textureArrayList[textureArrayIndex].second.AddMaterial(materialAsset->GetId());
+                DecalTextureArray& decalTextureArray = m_textureArrayList[textureArrayIndex].second;
+                if (!decalTextureArray.HasFreeSlot())
+                {
+                    // Reuse the slot of the least recently used material of this size rather than growing the texture array
+                    const auto unusedMaterialIter = AZStd::find_if(m_unusedMaterials.begin(), m_unusedMaterials.end(),
+                        [this, textureArrayIndex](const AZ::Data::AssetId& unusedMaterial)
+                        {
+                            return m_materialToTextureArrayLookupTable.at(unusedMaterial).m_location.textureArrayIndex == textureArrayIndex;
+                        });
+                    if (unusedMaterialIter != m_unusedMaterials.end())
+                    {
+                        EvictUnusedMaterial(AZStd::distance(m_unusedMaterials.begin(), unusedMaterialIter));
+                    }
+                }
+                textureIndex = decalTextureArray.AddMaterial(materialAsset->GetId());
             }
 
             DecalLocation result;
@@ -446,18 +470,35 @@ namespace AZ
 
                 if (decalInformation.m_useCount == 0)
                 {
-                    m_materialToTextureArrayLookupTable.erase(iter);
-                    textureArray.RemoveMaterial(decalLocation.textureIndex);
-                }
-
-                if (textureArray.NumMaterials() == 0)
-                {
-                    m_textureArrayList.erase(decalLocation.textureArrayIndex);
+                    // Keep the material packed in case another decal uses it, up to the budget of unused materials
+                    m_unusedMaterials.push_back(material);
+                    while (m_unusedMaterials.size() > r_decalMaxUnusedMaterials)
+                    {
+                        const DecalLocation evictedLocation = EvictUnusedMaterial(0);
+                        if (m_textureArrayList[evictedLocation.textureArrayIndex].second.NumMaterials() == 0)
+                        {
+                            m_textureArrayList.erase(evictedLocation.textureArrayIndex);
+                        }
+                    }
                 }
             }
             return false;
         }
 
+        DecalTextureArrayFeatureProcessor::DecalLocation DecalTextureArrayFeatureProcessor::EvictUnusedMaterial(const size_t unusedMaterialIndex)
+        {
+            const AZ::Data::AssetId material = m_unusedMaterials[unusedMaterialIndex];
+            m_unusedMaterials.erase(m_unusedMaterials.begin() + unusedMaterialIndex);
+
+            const auto iter = m_materialToTextureArrayLookupTable.find(material);
+            AZ_Assert(iter != m_materialToTextureArrayLookupTable.end() && iter->second.m_useCount == 0, "Bad state");
+            const DecalLocation decalLocation = iter->second.m_location;
+            m_materialToTextureArrayLookupTable.erase(iter);
+
+            m_textureArrayList[decalLocation.textureArrayIndex].second.RemoveMaterial(decalLocation.textureIndex);
+            return decalLocation;
+        }
+
         void DecalTextureArrayFeatureProcessor::PackTexureArrays()
         {
             int iter = m_textureArrayList.begin();
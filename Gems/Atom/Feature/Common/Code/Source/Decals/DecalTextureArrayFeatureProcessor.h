@@ -115,6 +115,9 @@ namespace AZ
             void SetDecalTextureLocation(const DecalHandle& handle, const DecalLocation location);
             void QueueMaterialLoadForDecal(const AZ::Data::AssetId material, const DecalHandle handle);
             bool RemoveDecalFromTextureArrays(const DecalLocation decalLocation);
+            // Removes a material of m_unusedMaterials from its texture array, and returns where it was.
+            // The texture array is kept even if it is left empty.
+            DecalLocation EvictUnusedMaterial(const size_t unusedMaterialIndex);
             AZ::Data::AssetId GetMaterialUsedByDecal(const DecalHandle handle) const;
             void PackTexureArrays();
 
@@ -133,6 +136,10 @@ namespace AZ
             AsyncLoadTracker<DecalHandle> m_materialLoadTracker;
             AZStd::unordered_map< AZ::Data::AssetId, DecalLocationAndUseCount> m_materialToTextureArrayLookupTable;
 
+            // Materials no decal uses anymore, kept in their texture array in case a decal uses them again.
+            // Sorted from the least recently used one.
+            AZStd::vector<AZ::Data::AssetId> m_unusedMaterials;
+
             bool m_deviceBufferNeedsUpdate = false;
         };
     } // namespace Render
@@ -268,6 +268,14 @@ namespace AZ
             return m_cullable.m_isVisible;
         }
 
+        bool DiffuseProbeGrid::GetIsUpdateRequired() const
+        {
+            return m_renderObjectSrg == nullptr ||
+                !m_textureReadback.IsIdle() ||
+                m_irradianceClearRequired ||
+                m_remainingRelocationIterations > 0;
+        }
+
         uint32_t DiffuseProbeGrid::GetTotalProbeCount() const
         {
             return m_probeCountX * m_probeCountY * m_probeCountZ;
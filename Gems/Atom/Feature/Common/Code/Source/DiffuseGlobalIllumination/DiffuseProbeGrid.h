@@ -105,6 +105,14 @@ namespace AZ
             void ResetCullingVisibility();
             bool GetIsVisible() const;
 
+            // returns true if the grid can't skip its update this frame, e.g. it was just (re)created, relocated or is being baked
+            bool GetIsUpdateRequired() const;
+
+            // number of frames since the real-time probes were last updated, used to schedule the rolling grid updates
+            uint32_t GetFramesSinceUpdate() const { return m_framesSinceUpdate; }
+            void IncrementFramesSinceUpdate() { ++m_framesSinceUpdate; }
+            void ResetFramesSinceUpdate() { m_framesSinceUpdate = 0; }
+
             // compute total number of probes in the grid
             uint32_t GetTotalProbeCount() const;
 
@@ -222,6 +230,9 @@ namespace AZ
             // probe relocation settings
             int32_t m_remainingRelocationIterations = DefaultNumRelocationIterations;
 
+            // rolling update
+            uint32_t m_framesSinceUpdate = 0;
+
             // render data
             DiffuseProbeGridRenderData* m_renderData = nullptr;
 
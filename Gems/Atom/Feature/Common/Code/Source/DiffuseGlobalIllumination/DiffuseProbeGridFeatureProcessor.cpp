@@ -5,7 +5,9 @@
  *
  */
 
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/limits.h>
 #include <Atom/RPI.Public/RPIUtils.h>
 #include <Atom/RPI.Public/Scene.h>
 #include <Atom/RPI.Public/Shader/Shader.h>
@@ -25,6 +27,10 @@ namespace AZ
 {
     namespace Render
     {
+        AZ_CVAR(uint32_t, r_diffuseProbeGridUpdateProbeBudget, 0, nullptr, ConsoleFunctorFlags::Null,
+            "Maximum number of real-time diffuse probes ray traced and blended per frame, 0 updates every visible grid each frame. "
+            "Grids are updated whole, the stalest ones closest to the camera first, and at least one grid is updated each frame.");
+
         void DiffuseProbeGridFeatureProcessor::Reflect(ReflectContext* context)
         {
             if (auto* serializeContext = azrtti_cast<SerializeContext*>(context))
@@ -194,6 +200,99 @@ namespace AZ
                     m_visibleRealTimeDiffuseProbeGrids.push_back(diffuseProbeGrid);
                 }
             }
+
+            const uint32_t probeBudget = r_diffuseProbeGridUpdateProbeBudget;
+            if (probeBudget > 0 && m_visibleRealTimeDiffuseProbeGrids.size() > 1)
+            {
+                SelectRollingUpdateProbeGrids(probeBudget);
+            }
+
+            for (auto& diffuseProbeGrid : m_realTimeDiffuseProbeGrids)
+            {
+                diffuseProbeGrid->IncrementFramesSinceUpdate();
+            }
+            for (auto& diffuseProbeGrid : m_visibleRealTimeDiffuseProbeGrids)
+            {
+                diffuseProbeGrid->ResetFramesSinceUpdate();
+            }
+        }
+
+        void DiffuseProbeGridFeatureProcessor::SelectRollingUpdateProbeGrids(uint32_t probeBudget)
+        {
+            AZ_PROFILE_FUNCTION(Debug::ProfileCategory::AzRender);
+
+            AZStd::vector<Vector3> cameraPositions;
+            for (const RPI::RenderPipelinePtr& renderPipeline : GetParentScene()->GetRenderPipelines())
+            {
+                if (const RPI::ViewPtr& view = renderPipeline->GetDefaultView())
+                {
+                    cameraPositions.push_back(view->GetCameraTransform().GetTranslation());
+                }
+            }
+
+            // grids that can't skip their update come first, then the others by staleness weighted by proximity to the cameras
+            struct UpdateCandidate
+            {
+                size_t m_index = 0;
+                bool m_isUpdateRequired = false;
+                float m_priority = 0.0f;
+            };
+
+            AZStd::vector<UpdateCandidate> candidates;
+            candidates.reserve(m_visibleRealTimeDiffuseProbeGrids.size());
+            for (size_t index = 0; index < m_visibleRealTimeDiffuseProbeGrids.size(); ++index)
+            {
+                const DiffuseProbeGrid& diffuseProbeGrid = *m_visibleRealTimeDiffuseProbeGrids[index];
+
+                float cameraDistance = 0.0f;
+                if (!cameraPositions.empty())
+                {
+                    cameraDistance = AZStd::numeric_limits<float>::max();
+                    for (const Vector3& cameraPosition : cameraPositions)
+                    {
+                        cameraDistance = AZStd::min(cameraDistance, diffuseProbeGrid.GetAabbWs().GetDistance(cameraPosition));
+                    }
+                }
+
+                UpdateCandidate& candidate = candidates.emplace_back();
+                candidate.m_index = index;
+                candidate.m_isUpdateRequired = diffuseProbeGrid.GetIsUpdateRequired();
+                candidate.m_priority = aznumeric_cast<float>(diffuseProbeGrid.GetFramesSinceUpdate() + 1) / (1.0f + cameraDistance);
+            }
+
+            AZStd::sort(candidates.begin(), candidates.end(), [](const UpdateCandidate& lhs, const UpdateCandidate& rhs)
+            {
+                if (lhs.m_isUpdateRequired != rhs.m_isUpdateRequired)
+                {
+                    return lhs.m_isUpdateRequired;
+                }
+                return lhs.m_priority > rhs.m_priority;
+            });
+
+            AZStd::vector<bool> isSelected(m_visibleRealTimeDiffuseProbeGrids.size(), false);
+            uint32_t selectedProbeCount = 0;
+            for (const UpdateCandidate& candidate : candidates)
+            {
+                const uint32_t probeCount = m_visibleRealTimeDiffuseProbeGrids[candidate.m_index]->GetTotalProbeCount();
+                if (!candidate.m_isUpdateRequired && selectedProbeCount > 0 && selectedProbeCount + probeCount > probeBudget)
+                {
+                    continue;
+                }
+
+                isSelected[candidate.m_index] = true;
+                selectedProbeCount += probeCount;
+            }
+
+            // keep the selected grids in the sorted order of the visible list
+            size_t selectedCount = 0;
+            for (size_t index = 0; index < m_visibleRealTimeDiffuseProbeGrids.size(); ++index)
+            {
+                if (isSelected[index])
+                {
+                    m_visibleRealTimeDiffuseProbeGrids[selectedCount++] = m_visibleRealTimeDiffuseProbeGrids[index];
+                }
+            }
+            m_visibleRealTimeDiffuseProbeGrids.resize(selectedCount);
         }
 
         DiffuseProbeGridHandle DiffuseProbeGridFeatureProcessor::AddProbeGrid(const AZ::Transform& transform, const AZ::Vector3& extents, const AZ::Vector3& probeSpacing)
@@ -77,6 +77,7 @@ namespace AZ
             DiffuseProbeGridVector& GetRealTimeProbeGrids() { return m_realTimeDiffuseProbeGrids; }
 
             // retrieve the side list of probe grids that are using  real-time (raytraced) mode and visible (on screen)
+            // when r_diffuseProbeGridUpdateProbeBudget is set, this only contains the visible grids selected for an update this frame
             DiffuseProbeGridVector& GetVisibleRealTimeProbeGrids() { return m_visibleRealTimeDiffuseProbeGrids; }
 
         private:
@@ -108,6 +109,9 @@ namespace AZ
             void UpdatePipelineStates();
             void UpdatePasses();
 
+            // reduces the visible real-time list to the grids updated this frame within the probe budget
+            void SelectRollingUpdateProbeGrids(uint32_t probeBudget);
+
             // list of all diffuse probe grids
             const size_t InitialProbeGridAllocationSize = 64;
             DiffuseProbeGridVector m_diffuseProbeGrids;
@@ -548,6 +548,8 @@ namespace AZ
                 for (int32_t cmdListIdx = 0; cmdListIdx < drawData.CmdListsCount; cmdListIdx++)
                 {
                     const ImDrawList* drawList = drawData.CmdLists[cmdListIdx];
+                    const size_t firstDrawOfList = m_draws.size();
+                    ImTextureID lastTextureId = nullptr;
                     for (const ImDrawCmd& drawCmd : drawList->CmdBuffer)
                     {
                         AZ_Assert(drawCmd.UserCallback == nullptr, "ImGui UserCallbacks are not supported by the ImGui Pass");
@@ -558,18 +560,25 @@ namespace AZ
                         //otherwise it is possible to have a frame where scissor bounds can be bigger than window's bounds if we resize the window
                         scissorMaxX = AZStd::min(scissorMaxX, m_viewportWidth);
                         scissorMaxY = AZStd::min(scissorMaxY, m_viewportHeight);
-                        
-                        m_draws.push_back(
+
+                        const RHI::Scissor scissor(drawCmd.ClipRect.x, drawCmd.ClipRect.y, scissorMaxX, scissorMaxY);
+
+                        // The indices of a draw list are contiguous, so a command with the same texture and scissor
+                        // as the previous one of its list (which the clamping above can cause) extends its draw.
+                        if (m_draws.size() > firstDrawOfList && drawCmd.TextureId == lastTextureId)
+                        {
+                            DrawInfo& lastDraw = m_draws.back();
+                            if (lastDraw.m_scissor.m_minX == scissor.m_minX && lastDraw.m_scissor.m_minY == scissor.m_minY &&
+                                lastDraw.m_scissor.m_maxX == scissor.m_maxX && lastDraw.m_scissor.m_maxY == scissor.m_maxY)
                             {
-                                RHI::DrawIndexed(1, 0, vertexOffset, drawCmd.ElemCount, indexOffset),
-                                RHI::Scissor(
-                                    (drawCmd.ClipRect.x),
-                                    (drawCmd.ClipRect.y),
-                                             scissorMaxX,
-                                             scissorMaxY
-                                )
+                                lastDraw.m_drawIndexed.m_indexCount += drawCmd.ElemCount;
+                                indexOffset += drawCmd.ElemCount;
+                                continue;
                             }
-                        );
+                        }
+
+                        m_draws.push_back({ RHI::DrawIndexed(1, 0, vertexOffset, drawCmd.ElemCount, indexOffset), scissor });
+                        lastTextureId = drawCmd.TextureId;
 
                         indexOffset += drawCmd.ElemCount;
                     }
@@ -597,18 +606,20 @@ namespace AZ
             uint32_t firstIndex = (context.GetCommandListIndex() * numDraws) / context.GetCommandListCount();
             uint32_t lastIndex = ((context.GetCommandListIndex() + 1) * numDraws) / context.GetCommandListCount();
 
+            // All the draws share the same state, only their arguments and scissor change
+            RHI::DrawItem drawItem;
+            drawItem.m_pipelineState = m_pipelineState->GetRHIPipelineState();
+            drawItem.m_indexBufferView = &m_indexBufferView;
+            drawItem.m_shaderResourceGroupCount = 1;
+            drawItem.m_shaderResourceGroups = shaderResourceGroups;
+            drawItem.m_streamBufferViewCount = 1;
+            drawItem.m_streamBufferViews = m_vertexBufferView.data();
+            drawItem.m_scissorsCount = 1;
+
             for (uint32_t i = firstIndex; i < lastIndex; ++i)
             {
-                RHI::DrawItem drawItem;
-                drawItem.m_arguments = m_draws.at(i).m_drawIndexed;
-                drawItem.m_pipelineState = m_pipelineState->GetRHIPipelineState();
-                drawItem.m_indexBufferView = &m_indexBufferView;
-                drawItem.m_shaderResourceGroupCount = 1;
-                drawItem.m_shaderResourceGroups = shaderResourceGroups;
-                drawItem.m_streamBufferViewCount = 1;
-                drawItem.m_streamBufferViews = m_vertexBufferView.data();
-                drawItem.m_scissorsCount = 1;
-                drawItem.m_scissors = &m_draws.at(i).m_scissor;
+                drawItem.m_arguments = m_draws[i].m_drawIndexed;
+                drawItem.m_scissors = &m_draws[i].m_scissor;
 
                 context.GetCommandList()->Submit(drawItem);
             }
@@ -671,7 +682,8 @@ namespace AZ
                     memcpy(vertexBufferData + vertexBufferOffset, drawList->VtxBuffer.Data, vertexBufferByteSize);
                     vertexBufferOffset += drawList->VtxBuffer.size();
 
-                    ++drawCount;
+                    // Upper bound of the draws, commands sharing a scissor are merged in CompileResources()
+                    drawCount += aznumeric_cast<uint32_t>(drawList->CmdBuffer.size());
                 }
             }
 
@@ -144,22 +144,39 @@ namespace AZ
 
             if (model)
             {
-                size_t lodIndex = 0;
-                for (const Data::Instance<AZ::RPI::ModelLod>& lod : model->GetLods())
+                auto addMaterial = [&materials](size_t lodIndex, const Data::Instance<AZ::RPI::Material>& material)
                 {
-                    for (const AZ::RPI::ModelLod::Mesh& mesh : lod->GetMeshes())
+                    if (material)
                     {
-                        if (mesh.m_material)
-                        {
-                            const MaterialAssignmentId generalId = MaterialAssignmentId::CreateFromAssetOnly(mesh.m_material->GetAssetId());
-                            materials[generalId] = MaterialAssignment(mesh.m_material->GetAsset(), mesh.m_material);
+                        const MaterialAssignmentId generalId = MaterialAssignmentId::CreateFromAssetOnly(material->GetAssetId());
+                        materials[generalId] = MaterialAssignment(material->GetAsset(), material);
+
+                        const MaterialAssignmentId specificId = MaterialAssignmentId::CreateFromLodAndAsset(lodIndex, material->GetAssetId());
+                        materials[specificId] = MaterialAssignment(material->GetAsset(), material);
+                    }
+                };
 
-                            const MaterialAssignmentId specificId =
-                                MaterialAssignmentId::CreateFromLodAndAsset(lodIndex, mesh.m_material->GetAssetId());
-                            materials[specificId] = MaterialAssignment(mesh.m_material->GetAsset(), mesh.m_material);
+                const auto& lodAssets = model->GetModelAsset()->GetLodAssets();
+                for (size_t lodIndex = 0; lodIndex < model->GetLodCount(); ++lodIndex)
+                {
+                    if (const Data::Instance<AZ::RPI::ModelLod>& lod = model->GetLods()[lodIndex])
+                    {
+                        for (const AZ::RPI::ModelLod::Mesh& mesh : lod->GetMeshes())
+                        {
+                            addMaterial(lodIndex, mesh.m_material);
+                        }
+                    }
+                    else
+                    {
+                        // The lod isn't streamed in, its materials are created from the lod asset like the lod would
+                        for (const AZ::RPI::ModelLodAsset::Mesh& mesh : lodAssets[lodIndex]->GetMeshes())
+                        {
+                            if (mesh.GetMaterialAsset().IsReady())
+                            {
+                                addMaterial(lodIndex, AZ::RPI::Material::FindOrCreate(mesh.GetMaterialAsset()));
+                            }
                         }
                     }
-                    ++lodIndex;
                 }
             }
 
@@ -30,6 +30,8 @@
 #include <AzCore/RTTI/TypeInfo.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Asset/AssetCommon.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/hash.h>
 
 namespace AZ
 {
@@ -104,6 +106,11 @@ namespace AZ
                             meshDataIter->UpdateObjectSrg();
                         }
 
+                        if (meshDataIter->m_lodResidencyChangeId != meshDataIter->m_model->GetLodResidencyChangeId())
+                        {
+                            meshDataIter->UpdateLodResidency();
+                        }
+
                         // [GFX TODO] [ATOM-1357] Currently all of the draw packets have to be checked for material ID changes because
                         // material properties can impact which actual shader is used, which impacts the SRG in the draw packet.
                         // This is scheduled to be optimized so the work is only done on draw packets that need it instead of having
@@ -426,6 +433,66 @@ namespace AZ
             m_forceRebuildDrawPackets = true;
         }
 
+        void MeshFeatureProcessor::DumpInstancingStats([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
+        {
+            // Draw packets of the same mesh in the same model lod with the same material only differ by their object srg,
+            // so they could be drawn with a single instanced draw
+            struct InstanceGroupKey
+            {
+                const RPI::Model* m_model = nullptr;
+                size_t m_lodIndex = 0;
+                size_t m_meshIndex = 0;
+                const RPI::Material* m_material = nullptr;
+
+                bool operator==(const InstanceGroupKey& rhs) const
+                {
+                    return m_model == rhs.m_model && m_lodIndex == rhs.m_lodIndex && m_meshIndex == rhs.m_meshIndex && m_material == rhs.m_material;
+                }
+            };
+
+            struct InstanceGroupKeyHasher
+            {
+                size_t operator()(const InstanceGroupKey& key) const
+                {
+                    size_t hash = 0;
+                    AZStd::hash_combine(hash, key.m_model, key.m_lodIndex, key.m_meshIndex, key.m_material);
+                    return hash;
+                }
+            };
+
+            AZStd::unordered_map<InstanceGroupKey, uint32_t, InstanceGroupKeyHasher> instanceGroups;
+            size_t meshCount = 0;
+            size_t drawPacketCount = 0;
+            for (MeshDataInstance& meshDataInstance : m_meshData)
+            {
+                if (!meshDataInstance.m_model)
+                {
+                    continue;
+                }
+
+                ++meshCount;
+                for (size_t lodIndex = 0; lodIndex < meshDataInstance.m_drawPacketListsByLod.size(); ++lodIndex)
+                {
+                    MeshDataInstance::DrawPacketList& drawPacketList = meshDataInstance.m_drawPacketListsByLod[lodIndex];
+                    for (size_t meshIndex = 0; meshIndex < drawPacketList.size(); ++meshIndex)
+                    {
+                        const InstanceGroupKey key{ meshDataInstance.m_model.get(), lodIndex, meshIndex, drawPacketList[meshIndex].GetMaterial().get() };
+                        ++instanceGroups[key];
+                        ++drawPacketCount;
+                    }
+                }
+            }
+
+            size_t largestGroup = 0;
+            for (const auto& instanceGroup : instanceGroups)
+            {
+                largestGroup = AZStd::max(largestGroup, static_cast<size_t>(instanceGroup.second));
+            }
+
+            AZ_TracePrintf("MeshFeatureProcessor", "Meshes: %zu, Draw packets: %zu, Instance groups: %zu, Largest instance group: %zu\n",
+                meshCount, drawPacketCount, instanceGroups.size(), largestGroup);
+        }
+
         void MeshFeatureProcessor::OnRenderPipelineAdded(RPI::RenderPipelinePtr pipeline)
         {
             m_forceRebuildDrawPackets = true;;
@@ -577,6 +644,7 @@ namespace AZ
             }
 
             m_model = model;
+            m_lodResidencyChangeId = m_model->GetLodResidencyChangeId();
             const size_t modelLodCount = m_model->GetLodCount();
             m_drawPacketListsByLod.resize(modelLodCount);
             for (size_t modelLodIndex = 0; modelLodIndex < modelLodCount; ++modelLodIndex)
@@ -606,11 +674,17 @@ namespace AZ
         {
             AZ_PROFILE_FUNCTION(Debug::ProfileCategory::AzRender);
 
-            RPI::ModelLod& modelLod = *m_model->GetLods()[modelLodIndex];
-            const size_t meshCount = modelLod.GetMeshes().size();
-
             MeshDataInstance::DrawPacketList& drawPacketListOut = m_drawPacketListsByLod[modelLodIndex];
             drawPacketListOut.clear();
+
+            // The lod is still streaming in, culling draws a less detailed one in the meantime
+            if (!m_model->IsLodResident(modelLodIndex))
+            {
+                return;
+            }
+
+            RPI::ModelLod& modelLod = *m_model->GetLods()[modelLodIndex];
+            const size_t meshCount = modelLod.GetMeshes().size();
             drawPacketListOut.reserve(meshCount);
 
             m_hasForwardPassIblSpecularMaterial = false;
@@ -684,6 +758,22 @@ namespace AZ
             }
         }
 
+        void MeshDataInstance::UpdateLodResidency()
+        {
+            AZ_PROFILE_FUNCTION(Debug::ProfileCategory::AzRender);
+
+            m_lodResidencyChangeId = m_model->GetLodResidencyChangeId();
+            for (size_t modelLodIndex = 0; modelLodIndex < m_drawPacketListsByLod.size(); ++modelLodIndex)
+            {
+                // Draw packets keep their lod alive, so a lod streamed out is only released once its draw packets are cleared
+                if (m_model->IsLodResident(modelLodIndex) == m_drawPacketListsByLod[modelLodIndex].empty())
+                {
+                    BuildDrawPacketList(modelLodIndex);
+                    m_cullableNeedsRebuild = true;
+                }
+            }
+        }
+
         void MeshDataInstance::SetRayTracingData()
         {
             RayTracingFeatureProcessor* rayTracingFeatureProcessor = m_scene->GetFeatureProcessor<RayTracingFeatureProcessor>();
@@ -1005,6 +1095,7 @@ namespace AZ
             AZ_Assert(lodAssets.size() == modelLodCount, "Number of asset lods must match number of model lods");
 
             lodData.m_lods.resize(modelLodCount);
+            lodData.m_model = m_model.get();
             cullData.m_drawListMask.reset();
 
             const size_t lodCount = lodAssets.size();
@@ -1037,6 +1128,7 @@ namespace AZ
                 }
 
                 lod.m_drawPackets.clear();
+                lod.m_streamingImages.clear();
                 for (const RPI::MeshDrawPacket& meshDrawPacket : m_drawPacketListsByLod[lodIndex])
                 {
                     const RHI::DrawPacket* rhiDrawPacket = meshDrawPacket.GetRHIDrawPacket();
@@ -1048,6 +1140,26 @@ namespace AZ
 
                         lod.m_drawPackets.push_back(rhiDrawPacket);
                     }
+
+                    //collect the streaming images of the material, so culling can request the mips the lod needs on screen
+                    if (const Data::Instance<RPI::Material> material = meshDrawPacket.GetMaterial())
+                    {
+                        for (const RPI::MaterialPropertyValue& propertyValue : material->GetPropertyValues())
+                        {
+                            if (!propertyValue.Is<Data::Instance<RPI::Image>>())
+                            {
+                                continue;
+                            }
+
+                            Data::Instance<RPI::StreamingImage> streamingImage =
+                                azrtti_cast<RPI::StreamingImage*>(propertyValue.GetValue<Data::Instance<RPI::Image>>().get());
+                            if (streamingImage && streamingImage->IsStreamable() &&
+                                AZStd::find(lod.m_streamingImages.begin(), lod.m_streamingImages.end(), streamingImage) == lod.m_streamingImages.end())
+                            {
+                                lod.m_streamingImages.push_back(AZStd::move(streamingImage));
+                            }
+                        }
+                    }
                 }
             }
 
@@ -1067,7 +1179,7 @@ namespace AZ
             m_cullBoundsNeedsUpdate = true;
         }
 
-        void MeshDataInstance::UpdateCullBounds(const TransformServiceFeatureProcessor* transformService)
+        void MeshDataInstance::UpdateCullBounds(TransformServiceFeatureProcessor* transformService)
         {
             AZ_PROFILE_FUNCTION(Debug::ProfileCategory::AzRender);
             AZ_Assert(m_cullBoundsNeedsUpdate, "This function only needs to be called if the culling bounds need to be rebuilt");
@@ -1084,6 +1196,7 @@ namespace AZ
             localAabb.GetTransformedAabb(localToWorld).GetAsSphere(center, radius);
 
             m_cullable.m_cullData.m_boundingSphere = Sphere(center, radius);
+            transformService->SetBoundingSphereForId(m_objectId, m_cullable.m_cullData.m_boundingSphere);
             m_cullable.m_cullData.m_boundingObb = localAabb.GetTransformedObb(localToWorld);
             m_cullable.m_cullData.m_visibilityEntry.m_boundingVolume = localAabb.GetTransformedAabb(localToWorld);
             m_cullable.m_cullData.m_visibilityEntry.m_userData = &m_cullable;
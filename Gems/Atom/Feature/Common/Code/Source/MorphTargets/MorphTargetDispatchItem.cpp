@@ -15,6 +15,8 @@
 
 #include <Atom/RHI/Factory.h>
 #include <Atom/RHI/BufferView.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/std/math.h>
 
 #include <limits>
 
@@ -181,6 +183,11 @@ namespace AZ
             return m_rootConstantData.GetConstant<float>(m_weightIndex);
         }
 
+        bool MorphTargetDispatchItem::IsActive() const
+        {
+            return AZStd::abs(GetWeight()) > AZ::Constants::FloatEpsilon;
+        }
+
         const RHI::DispatchItem& MorphTargetDispatchItem::GetRHIDispatchItem() const
         {
             return m_dispatchItem;
@@ -61,6 +61,10 @@ namespace AZ
 
             void SetWeight(float weight);
             float GetWeight() const;
+
+            //! Returns false when the weight is too small for the morph target to contribute, so the dispatch can be skipped.
+            //! Negative weights are valid and still need to be dispatched.
+            bool IsActive() const;
         private:
             bool InitPerInstanceSRG();
             void InitRootConstants(const RHI::ConstantsLayout* rootConstantsLayout);
@@ -7,7 +7,6 @@
 
 #include <Atom/RHI/FrameScheduler.h>
 #include <Atom/RHI/CommandList.h>
-#include <Atom/RPI.Public/Buffer/BufferSystemInterface.h>
 #include <Atom/RPI.Public/Buffer/Buffer.h>
 #include <PostProcessing/DepthOfFieldCopyFocusDepthToCpuPass.h>
 
@@ -34,17 +33,13 @@ namespace AZ
 
         float DepthOfFieldCopyFocusDepthToCpuPass::GetFocusDepth()
         {
+            // Keep the last value until a newer copy has completed
             float depth = 0.0f;
-            if (m_readbackBuffer)
+            if (m_readbackRing.ReadLatest(&depth, sizeof(depth)))
             {
-                void* buf = m_readbackBuffer->Map(m_copyDescriptor.m_size, 0);
-                if (buf)
-                {
-                    memcpy(&depth, buf, sizeof(depth));
-                    m_readbackBuffer->Unmap();
-                }
+                m_focusDepth = depth;
             }
-            return depth;
+            return m_focusDepth;
         }
 
         void DepthOfFieldCopyFocusDepthToCpuPass::BuildInternal()
@@ -58,24 +53,22 @@ namespace AZ
 
             if (m_needsInitialize)
             {
-                RPI::CommonBufferDescriptor desc;
-                desc.m_bufferName = GetPathName().GetStringView();
-                desc.m_poolType = RPI::CommonBufferPoolType::ReadBack;
-                desc.m_byteCount = sizeof(float);
-                desc.m_elementSize = aznumeric_cast<uint32_t>(desc.m_byteCount);
-                desc.m_bufferData = nullptr;
-                m_readbackBuffer = RPI::BufferSystemInterface::Get()->CreateBufferFromCommonPool(desc);
+                m_readbackRing.Init(GetPathName().GetStringView(), sizeof(float));
 
                 m_copyDescriptor.m_sourceBuffer = m_bufferRef->GetRHIBuffer();
                 m_copyDescriptor.m_sourceOffset = 0;
-                m_copyDescriptor.m_destinationBuffer = m_readbackBuffer->GetRHIBuffer();
                 m_copyDescriptor.m_destinationOffset = 0;
                 m_copyDescriptor.m_size = sizeof(float);
 
                 m_needsInitialize = false;
             }
 
-            params.m_frameGraphBuilder->ImportScopeProducer(*this);
+            // Skip the copy of this frame if all the readback buffers are still in use by the GPU
+            m_copyDescriptor.m_destinationBuffer = m_readbackRing.BeginCopy();
+            if (m_copyDescriptor.m_destinationBuffer)
+            {
+                params.m_frameGraphBuilder->ImportScopeProducer(*this);
+            }
         }
 
         void DepthOfFieldCopyFocusDepthToCpuPass::SetupFrameGraphDependencies(RHI::FrameGraphInterface frameGraph)
@@ -87,6 +80,8 @@ namespace AZ
             desc.m_bufferViewDescriptor = m_bufferRef->GetBufferViewDescriptor();
             desc.m_loadStoreAction.m_loadAction = AZ::RHI::AttachmentLoadAction::DontCare;
             frameGraph.UseCopyAttachment(desc, AZ::RHI::ScopeAttachmentAccess::Read);
+
+            m_readbackRing.SignalCopyComplete(frameGraph);
         }
 
         void DepthOfFieldCopyFocusDepthToCpuPass::CompileResources(const RHI::FrameGraphCompileContext& context)
@@ -10,12 +10,14 @@
 #include <Atom/RHI/ScopeProducer.h>
 #include <Atom/RPI.Public/Pass/Pass.h>
 #include <Atom/RPI.Public/Buffer/Buffer.h>
+#include <Atom/RPI.Public/Buffer/BufferReadbackRing.h>
 
 namespace AZ
 {
     namespace Render
     {
         //! This pass is used to read back the depth value written to the buffer.
+        //! The value is read a few frames after the copy so the CPU never waits for the GPU.
         class DepthOfFieldCopyFocusDepthToCpuPass final
             : public RPI::Pass
             , public RHI::ScopeProducer
@@ -47,8 +49,9 @@ namespace AZ
             void FrameBeginInternal(FramePrepareParams params) override;
 
             RPI::Ptr<RPI::Buffer> m_bufferRef;
-            Data::Instance<RPI::Buffer> m_readbackBuffer;
+            RPI::BufferReadbackRing m_readbackRing;
             RHI::CopyBufferDescriptor m_copyDescriptor;
+            float m_focusDepth = 0.0f;
             bool m_needsInitialize = true;
         };
     }   // namespace RPI
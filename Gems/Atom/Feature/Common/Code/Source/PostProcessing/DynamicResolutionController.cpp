@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ * 
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <PostProcessing/DynamicResolutionController.h>
+
+#include <Atom/RPI.Public/Pass/ParentPass.h>
+#include <Atom/RPI.Public/Pass/PassSystemInterface.h>
+#include <Atom/RPI.Public/RenderPipeline.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Math/MathUtils.h>
+
+namespace AZ::Render
+{
+    AZ_CVAR(bool, r_dynamicResolution, false, nullptr, ConsoleFunctorFlags::Null,
+        "Scale the render resolution of the pipelines with a TaaPass to keep the GPU frame time under r_dynamicResolutionTargetFrameTimeMs. "
+        "Only the attachments whose size source applies the render scale are resized.");
+    AZ_CVAR(float, r_dynamicResolutionTargetFrameTimeMs, 16.6f, nullptr, ConsoleFunctorFlags::Null,
+        "GPU frame time in milliseconds the dynamic resolution tries to stay under.");
+    AZ_CVAR(float, r_dynamicResolutionMinScale, 0.5f, nullptr, ConsoleFunctorFlags::Null,
+        "Lowest render scale the dynamic resolution can use.");
+    AZ_CVAR(float, r_dynamicResolutionMaxScale, 1.0f, nullptr, ConsoleFunctorFlags::Null,
+        "Highest render scale the dynamic resolution can use.");
+
+    namespace
+    {
+        // Weight of the latest frame in the average GPU time
+        constexpr float AverageWeight = 0.1f;
+        // The render scale changes by multiples of this step, so small variations of the frame time don't resize the attachments
+        constexpr float ScaleStep = 0.05f;
+        // Largest change of the render scale in one adjustment
+        constexpr float MaxScaleChange = 0.1f;
+        // Frames between two adjustments, which also lets the average catch up with the previous change
+        constexpr uint32_t FramesBetweenChanges = 30;
+    }
+
+    void DynamicResolutionController::Update(RPI::RenderPipeline& pipeline)
+    {
+        RPI::ParentPass* rootPass = pipeline.GetRootPass().get();
+        float& renderScale = pipeline.GetRenderSettings().m_renderScale;
+
+        if (!r_dynamicResolution || !rootPass)
+        {
+            if (m_enabledTimestampQueries || renderScale != 1.0f)
+            {
+                Reset(&pipeline);
+            }
+            return;
+        }
+
+        if (!rootPass->IsTimestampQueryEnabled())
+        {
+            rootPass->SetTimestampQueryEnabled(true);
+            m_enabledTimestampQueries = true;
+        }
+
+        // The results are from a frame a few frames old, the average smooths the delay out
+        const uint64_t gpuDuration = GetGpuDurationInNanoseconds(*rootPass);
+        if (gpuDuration == 0)
+        {
+            return;
+        }
+
+        const float gpuTimeMs = static_cast<float>(gpuDuration) / 1000000.0f;
+        m_averageGpuTimeMs = m_averageGpuTimeMs > 0.0f ? AZ::Lerp(m_averageGpuTimeMs, gpuTimeMs, AverageWeight) : gpuTimeMs;
+
+        if (m_framesUntilNextChange > 0)
+        {
+            --m_framesUntilNextChange;
+            return;
+        }
+
+        // The cost of most passes is proportional to the pixel count, which is the square of the scale
+        const float targetTimeMs = AZStd::max(static_cast<float>(r_dynamicResolutionTargetFrameTimeMs), 1.0f);
+        const float scaleChange = AZStd::clamp(sqrtf(targetTimeMs / m_averageGpuTimeMs), 1.0f - MaxScaleChange, 1.0f + MaxScaleChange);
+
+        const float maxScale = AZStd::clamp(static_cast<float>(r_dynamicResolutionMaxScale), ScaleStep, 1.0f);
+        const float minScale = AZStd::clamp(static_cast<float>(r_dynamicResolutionMinScale), ScaleStep, maxScale);
+        const float newScale = AZStd::clamp(floorf(renderScale * scaleChange / ScaleStep + 0.5f) * ScaleStep, minScale, maxScale);
+
+        if (newScale != renderScale)
+        {
+            renderScale = newScale;
+            m_framesUntilNextChange = FramesBetweenChanges;
+        }
+    }
+
+    void DynamicResolutionController::Reset(RPI::RenderPipeline* pipeline)
+    {
+        if (pipeline)
+        {
+            pipeline->GetRenderSettings().m_renderScale = 1.0f;
+
+            // Leave the queries on if the pass timings still use them
+            RPI::ParentPass* rootPass = pipeline->GetRootPass().get();
+            if (m_enabledTimestampQueries && rootPass && !RPI::PassSystemInterface::Get()->IsGpuPassTimingEnabled())
+            {
+                rootPass->SetTimestampQueryEnabled(false);
+            }
+        }
+
+        m_averageGpuTimeMs = 0.0f;
+        m_framesUntilNextChange = 0;
+        m_enabledTimestampQueries = false;
+    }
+
+    uint64_t DynamicResolutionController::GetGpuDurationInNanoseconds(const RPI::Pass& pass)
+    {
+        // Only the render passes have timestamp results, their parents report empty ones
+        if (const RPI::ParentPass* parentPass = pass.AsParent())
+        {
+            uint64_t duration = 0;
+            for (const RPI::Ptr<RPI::Pass>& child : parentPass->GetChildren())
+            {
+                if (child->IsEnabled())
+                {
+                    duration += GetGpuDurationInNanoseconds(*child);
+                }
+            }
+            return duration;
+        }
+        return pass.GetLatestTimestampResult().GetDurationInNanoseconds();
+    }
+} // namespace AZ::Render
@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ * 
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/base.h>
+
+namespace AZ::RPI
+{
+    class Pass;
+    class RenderPipeline;
+}
+
+namespace AZ::Render
+{
+    //! Adjusts the render scale of a pipeline from the GPU time of its passes, to keep the frame under the target time
+    //! set by r_dynamicResolutionTargetFrameTimeMs. The render scale only resizes the attachments whose size source
+    //! applies it, an upsampling pass like the TaaPass restores the output resolution.
+    class DynamicResolutionController
+    {
+    public:
+        //! Updates the render scale of the pipeline from the latest timestamps, called once per frame.
+        void Update(RPI::RenderPipeline& pipeline);
+
+        //! Restores the full render scale and the timestamp queries the controller enabled.
+        void Reset(RPI::RenderPipeline* pipeline);
+
+    private:
+        //! Returns the sum of the GPU durations of the passes with timestamp results under the pass.
+        static uint64_t GetGpuDurationInNanoseconds(const RPI::Pass& pass);
+
+        //! GPU frame time averaged over the last frames, zero until the first results are collected
+        float m_averageGpuTimeMs = 0.0f;
+        //! Frames left before the render scale can change again, so the attachments aren't resized every frame
+        uint32_t m_framesUntilNextChange = 0;
+        bool m_enabledTimestampQueries = false;
+    };
+} // namespace AZ::Render
@@ -47,11 +47,15 @@ namespace AZ
             m_blurVerticalPass = azrtti_cast<FastDepthAwareBlurVerPass*>(m_blurParentPass->FindChildPass(Name("VerticalBlur")).get());
             m_downsamplePass = FindChildPass(Name("DepthDownsample")).get();
             m_upsamplePass = FindChildPass(Name("Upsample")).get();
+            m_quarterResDownsamplePass = FindChildPass(Name("QuarterResDepthDownsample")).get();
+            m_quarterResUpsamplePass = FindChildPass(Name("QuarterResUpsample")).get();
 
             AZ_Assert(m_blurHorizontalPass, "[SsaoParentPass] Could not retrieve horizontal blur pass.");
             AZ_Assert(m_blurVerticalPass, "[SsaoParentPass] Could not retrieve vertical blur pass.");
             AZ_Assert(m_downsamplePass, "[SsaoParentPass] Could not retrieve downsample pass.");
             AZ_Assert(m_upsamplePass, "[SsaoParentPass] Could not retrieve upsample pass.");
+            AZ_Assert(m_quarterResDownsamplePass, "[SsaoParentPass] Could not retrieve quarter resolution downsample pass.");
+            AZ_Assert(m_quarterResUpsamplePass, "[SsaoParentPass] Could not retrieve quarter resolution upsample pass.");
         }
 
         void SsaoParentPass::FrameBeginInternal(FramePrepareParams params)
@@ -70,6 +74,7 @@ namespace AZ
                         bool ssaoEnabled = ssaoSettings->GetEnabled();
                         bool blurEnabled = ssaoEnabled && ssaoSettings->GetEnableBlur();
                         bool downsampleEnabled = ssaoEnabled && ssaoSettings->GetEnableDownsample();
+                        bool quarterResolutionEnabled = downsampleEnabled && ssaoSettings->GetEnableQuarterResolution();
 
                         m_blurParentPass->SetEnabled(blurEnabled);
                         if (blurEnabled)
@@ -84,6 +89,10 @@ namespace AZ
 
                         m_downsamplePass->SetEnabled(downsampleEnabled);
                         m_upsamplePass->SetEnabled(downsampleEnabled);
+
+                        // The disabled passes fall back to their input, so SSAO and its blur run on the half resolution depth
+                        m_quarterResDownsamplePass->SetEnabled(quarterResolutionEnabled);
+                        m_quarterResUpsamplePass->SetEnabled(quarterResolutionEnabled);
                     }
                 }
             }
@@ -43,6 +43,8 @@ namespace AZ
             FastDepthAwareBlurVerPass* m_blurVerticalPass = nullptr;
             Pass* m_downsamplePass = nullptr;
             Pass* m_upsamplePass = nullptr;
+            Pass* m_quarterResDownsamplePass = nullptr;
+            Pass* m_quarterResUpsamplePass = nullptr;
         };
 
         // Computer shader pass that calculates SSAO from a linear depth buffer
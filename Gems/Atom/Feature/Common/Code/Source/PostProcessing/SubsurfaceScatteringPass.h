@@ -36,6 +36,7 @@ namespace AZ
 
             // output texture vertical dimension required by compute shader
             AZ::RHI::ShaderInputNameIndex m_screenSizeInputIndex = "m_screenSize";
+            AZ::RHI::ShaderInputNameIndex m_sampleScaleInputIndex = "m_sampleScale";
 
         };
     }   // namespace RPI
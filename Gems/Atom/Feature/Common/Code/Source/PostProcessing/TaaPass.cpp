@@ -45,8 +45,12 @@ namespace AZ::Render
     {
         struct TaaConstants
         {
-            AZStd::array<uint32_t, 2> m_size = { 1, 1 };
-            AZStd::array<float, 2> m_rcpSize = { 0.0, 0.0 };
+            AZStd::array<uint32_t, 2> m_inputSize = { 1, 1 };
+            AZStd::array<float, 2> m_inputRcpSize = { 0.0, 0.0 };
+            AZStd::array<uint32_t, 2> m_outputSize = { 1, 1 };
+            AZStd::array<float, 2> m_outputRcpSize = { 0.0, 0.0 };
+            AZStd::array<float, 2> m_jitterOffset = { 0.0, 0.0 };
+            AZStd::array<float, 2> m_padding = { 0.0, 0.0 };
             
             AZStd::array<float, 4> m_weights1 = { 0.0 };
             AZStd::array<float, 4> m_weights2 = { 0.0 };
@@ -54,13 +58,21 @@ namespace AZ::Render
         };
 
         TaaConstants cb;
-        RHI::Size inputSize = m_lastFrameAccumulationBinding->m_attachment->m_descriptor.m_image.m_size;
-        cb.m_size[0] = inputSize.m_width;
-        cb.m_size[1] = inputSize.m_height;
-        cb.m_rcpSize[0] = 1.0f / inputSize.m_width;
-        cb.m_rcpSize[1] = 1.0f / inputSize.m_height;
+        // The input is smaller than the accumulation when the render scale of the pipeline is below 1
+        RHI::Size inputSize = m_inputColorBinding->m_attachment->m_descriptor.m_image.m_size;
+        cb.m_inputSize[0] = inputSize.m_width;
+        cb.m_inputSize[1] = inputSize.m_height;
+        cb.m_inputRcpSize[0] = 1.0f / inputSize.m_width;
+        cb.m_inputRcpSize[1] = 1.0f / inputSize.m_height;
+
+        RHI::Size outputSize = m_lastFrameAccumulationBinding->m_attachment->m_descriptor.m_image.m_size;
+        cb.m_outputSize[0] = outputSize.m_width;
+        cb.m_outputSize[1] = outputSize.m_height;
+        cb.m_outputRcpSize[0] = 1.0f / outputSize.m_width;
+        cb.m_outputRcpSize[1] = 1.0f / outputSize.m_height;
         
         Offset jitterOffset = m_subPixelOffsets.at(m_offsetIndex);
+        cb.m_jitterOffset = { jitterOffset.m_xOffset, jitterOffset.m_yOffset };
         GenerateFilterWeights(Vector2(jitterOffset.m_xOffset, jitterOffset.m_yOffset));
         cb.m_weights1 = { m_filterWeights[0], m_filterWeights[1], m_filterWeights[2], m_filterWeights[3] };
         cb.m_weights2 = { m_filterWeights[4], m_filterWeights[5], m_filterWeights[6], m_filterWeights[7] };
@@ -74,6 +86,10 @@ namespace AZ::Render
     
     void TaaPass::FrameBeginInternal(FramePrepareParams params)
     {
+        // A new render scale resizes the attachments that apply it during this frame, the input size below is from
+        // the previous frame so the scale is only picked up by the jitter on the next frame
+        m_dynamicResolution.Update(*GetRenderPipeline());
+
         RHI::Size inputSize = m_inputColorBinding->m_attachment->m_descriptor.m_image.m_size;
         Vector2 rcpInputSize = Vector2(1.0 / inputSize.m_width, 1.0 / inputSize.m_height);
 
@@ -93,6 +109,8 @@ namespace AZ::Render
     
     void TaaPass::ResetInternal()
     {
+        m_dynamicResolution.Reset(GetRenderPipeline());
+
         m_accumulationAttachments[0].reset();
         m_accumulationAttachments[1].reset();
 
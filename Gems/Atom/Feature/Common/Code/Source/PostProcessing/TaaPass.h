@@ -9,6 +9,8 @@
 #include <Atom/RPI.Public/Pass/ComputePass.h>
 #include <Atom/RPI.Reflect/Pass/ComputePassData.h>
 
+#include <PostProcessing/DynamicResolutionController.h>
+
 namespace AZ::Render
 {
     //! Custom data for the Taa Pass.
@@ -96,5 +98,7 @@ namespace AZ::Render
 
         uint8_t m_accumulationOuptutIndex = 0;
 
+        DynamicResolutionController m_dynamicResolution;
+
     };
 } // namespace AZ::Render
@@ -13,18 +13,43 @@
 #include <Atom/RPI.Public/Pass/ParentPass.h>
 #include <Atom/RPI.Public/Pass/Pass.h>
 #include <Atom/RPI.Public/Pass/PassFilter.h>
+#include <Atom/RPI.Public/Pass/PassSystemInterface.h>
 
 #include <AtomCore/Serialization/Json/JsonUtils.h>
 
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/IO/SystemFile.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/Json/JsonSerializationSettings.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/time.h>
 
 namespace AZ
 {
     namespace Render
     {
+        AZ_CVAR(float, r_profilingTraceHitchThreshold, 0.0f, nullptr, ConsoleFunctorFlags::Null,
+            "When larger than 0, a frame that takes longer than this many milliseconds exports a profiling trace of the previous "
+            "r_profilingTraceDuration seconds to @user@/Profiling.");
+
+        AZ_CVAR(float, r_profilingTraceDuration, 5.0f, nullptr, ConsoleFunctorFlags::Null,
+            "The number of seconds that are exported to a profiling trace by r_captureProfilingTrace or a hitch.");
+
+        static void r_captureProfilingTrace(const AZ::ConsoleCommandContainer& arguments)
+        {
+            const AZStd::string outputFilePath = arguments.empty()
+                ? AZStd::string::format("@user@/Profiling/Trace_%llu.json", static_cast<unsigned long long>(AZStd::GetTimeUTCMilliSecond()))
+                : AZStd::string(arguments.front());
+
+            ProfilingCaptureRequestBus::Broadcast(&ProfilingCaptureRequestBus::Events::CaptureProfilingTrace,
+                outputFilePath, static_cast<float>(r_profilingTraceDuration));
+        }
+
+        AZ_CONSOLEFREEFUNC(r_captureProfilingTrace, ConsoleFunctorFlags::Null,
+            "Exports the last r_profilingTraceDuration seconds of Cpu time regions and GPU pass timestamps in the Chrome trace event format. "
+            "Optionally takes the output file path, which defaults to @user@/Profiling.");
+
         class ProfilingCaptureNotificationBusHandler final
             : public ProfilingCaptureNotificationBus::Handler
             , public AZ::BehaviorEBusHandler
@@ -33,7 +58,8 @@ namespace AZ
             AZ_EBUS_BEHAVIOR_BINDER(ProfilingCaptureNotificationBusHandler, "{E45E4F37-EC1F-4010-994B-4F80998BEF15}", AZ::SystemAllocator,
                 OnCaptureQueryTimestampFinished,
                 OnCaptureQueryPipelineStatisticsFinished,
-                OnCaptureCpuProfilingStatisticsFinished
+                OnCaptureCpuProfilingStatisticsFinished,
+                OnCaptureProfilingTraceFinished
             );
 
             void OnCaptureQueryTimestampFinished(bool result, const AZStd::string& info) override
@@ -51,6 +77,11 @@ namespace AZ
                 Call(FN_OnCaptureCpuProfilingStatisticsFinished, result, info);
             }
 
+            void OnCaptureProfilingTraceFinished(bool result, const AZStd::string& info) override
+            {
+                Call(FN_OnCaptureProfilingTraceFinished, result, info);
+            }
+
             static void Reflect(AZ::ReflectContext* context)
             {
                 if (AZ::BehaviorContext* behaviorContext = azrtti_cast<AZ::BehaviorContext*>(context))
@@ -76,6 +107,8 @@ namespace AZ
 
                 Name m_passName;
                 uint64_t m_timestampResultInNanoseconds;
+                // Only set when GPU pass timing is enabled, see r_gpuPassTiming
+                uint64_t m_averageTimestampResultInNanoseconds = 0;
             };
 
             AZ_TYPE_INFO(TimestampSerializer, "{FAAD85C2-5948-4D81-B54A-53502D69CBC0}");
@@ -139,6 +172,41 @@ namespace AZ
             AZStd::vector<CpuProfilingStatisticsSerializerEntry> m_cpuProfilingStatisticsSerializerEntries;
         };
 
+        // Intermediate class to serialize Cpu TimedRegion data and pass' GPU timestamps in the Chrome trace event format.
+        class ProfilingTraceSerializer
+        {
+        public:
+            // The trace shows the Cpu threads and the GPU as separate processes
+            static constexpr uint32_t CpuProcessId = 0;
+            static constexpr uint32_t GpuProcessId = 1;
+
+            class ProfilingTraceEvent
+            {
+            public:
+                AZ_TYPE_INFO(ProfilingTraceSerializer::ProfilingTraceEvent, "{6F2B6C55-1B8E-4C64-9C53-0E3E5B7A2D41}");
+                static void Reflect(AZ::ReflectContext* context);
+
+                AZStd::string m_name;
+                AZStd::string m_category;
+                // Complete event, which has a begin time and a duration
+                AZStd::string m_phase = "X";
+                double m_timestampInMicroseconds = 0.0;
+                double m_durationInMicroseconds = 0.0;
+                uint32_t m_processId = CpuProcessId;
+                uint32_t m_threadId = 0;
+            };
+
+            AZ_TYPE_INFO(ProfilingTraceSerializer, "{1C7A5E0B-8F0D-4E2A-A6EF-3B0C9D4F7E12}");
+            static void Reflect(AZ::ReflectContext* context);
+
+            ProfilingTraceSerializer() = default;
+            ProfilingTraceSerializer(const RHI::CpuProfiler::RecentTimeRegionMap& timeRegionMap,
+                const AZStd::vector<RPI::GpuFrameTimestamps>& gpuFrames, AZStd::sys_time_t startTick);
+
+            AZStd::vector<ProfilingTraceEvent> m_traceEvents;
+            AZStd::string m_displayTimeUnit = "ms";
+        };
+
         // --- DelayedQueryCaptureHelper ---
 
         bool DelayedQueryCaptureHelper::StartCapture(CaptureCallback&& captureCallback)
@@ -179,9 +247,20 @@ namespace AZ
 
         TimestampSerializer::TimestampSerializer(AZStd::vector<const RPI::Pass*>&& passes)
         {
+            // Export the rolling averages too if they are collected
+            AZStd::unordered_map<Name, uint64_t> averageDurations;
+            for (const RPI::GpuPassTiming& timing : RPI::PassSystemInterface::Get()->GetGpuPassTimings())
+            {
+                averageDurations[timing.m_passPath] = timing.m_averageDurationInNanoseconds;
+            }
+
             for (const RPI::Pass* pass : passes)
             {
-                m_timestampEntries.push_back({pass->GetName(), pass->GetLatestTimestampResult().GetDurationInNanoseconds()});
+                auto averageIt = averageDurations.find(pass->GetPathName());
+                m_timestampEntries.push_back({
+                    pass->GetName(),
+                    pass->GetLatestTimestampResult().GetDurationInNanoseconds(),
+                    averageIt != averageDurations.end() ? averageIt->second : 0 });
             }
         }
 
@@ -205,9 +284,10 @@ namespace AZ
             if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
             {
                 serializeContext->Class<TimestampSerializerEntry>()
-                    ->Version(1)
+                    ->Version(2)
                     ->Field("passName", &TimestampSerializerEntry::m_passName)
                     ->Field("timestampResultInNanoseconds", &TimestampSerializerEntry::m_timestampResultInNanoseconds)
+                    ->Field("averageTimestampResultInNanoseconds", &TimestampSerializerEntry::m_averageTimestampResultInNanoseconds)
                     ;
             }
         }
@@ -312,6 +392,90 @@ namespace AZ
             }
         }
 
+        // --- ProfilingTraceSerializer ---
+
+        ProfilingTraceSerializer::ProfilingTraceSerializer(const RHI::CpuProfiler::RecentTimeRegionMap& timeRegionMap,
+            const AZStd::vector<RPI::GpuFrameTimestamps>& gpuFrames, AZStd::sys_time_t startTick)
+        {
+            // Regions that were still running at the start tick begin earlier, so start the trace at the earliest region
+            AZStd::sys_time_t traceBeginTick = startTick;
+            for (const auto& threadEntry : timeRegionMap)
+            {
+                for (const RHI::CachedTimeRegion& timeRegion : threadEntry.second)
+                {
+                    traceBeginTick = AZStd::min(traceBeginTick, timeRegion.m_startTick);
+                }
+            }
+
+            const double microsecondsPerTick = 1000000.0 / static_cast<double>(AZStd::GetTimeTicksPerSecond());
+
+            uint32_t threadIndex = 0;
+            for (const auto& threadEntry : timeRegionMap)
+            {
+                for (const RHI::CachedTimeRegion& timeRegion : threadEntry.second)
+                {
+                    ProfilingTraceEvent& traceEvent = m_traceEvents.emplace_back();
+                    traceEvent.m_name = timeRegion.m_groupRegionName->m_regionName;
+                    traceEvent.m_category = timeRegion.m_groupRegionName->m_groupName;
+                    traceEvent.m_timestampInMicroseconds = (timeRegion.m_startTick - traceBeginTick) * microsecondsPerTick;
+                    traceEvent.m_durationInMicroseconds = (timeRegion.m_endTick - timeRegion.m_startTick) * microsecondsPerTick;
+                    traceEvent.m_processId = CpuProcessId;
+                    traceEvent.m_threadId = threadIndex;
+                }
+                ++threadIndex;
+            }
+
+            // The GPU clock isn't calibrated against the Cpu clock, so the passes of a frame are placed at the time their results were
+            // collected, which is a few frames after they were executed.
+            for (const RPI::GpuFrameTimestamps& gpuFrame : gpuFrames)
+            {
+                const double frameTimestampInMicroseconds = (gpuFrame.m_collectedTick - traceBeginTick) * microsecondsPerTick;
+                for (const RPI::GpuFrameTimestamps::PassTimestamp& passTimestamp : gpuFrame.m_passTimestamps)
+                {
+                    ProfilingTraceEvent& traceEvent = m_traceEvents.emplace_back();
+                    traceEvent.m_name = passTimestamp.m_passPath.GetCStr();
+                    traceEvent.m_category = "GPU";
+                    traceEvent.m_timestampInMicroseconds = frameTimestampInMicroseconds + passTimestamp.m_beginInMicroseconds;
+                    traceEvent.m_durationInMicroseconds = static_cast<double>(passTimestamp.m_durationInMicroseconds);
+                    traceEvent.m_processId = GpuProcessId;
+                }
+            }
+        }
+
+        void ProfilingTraceSerializer::Reflect(AZ::ReflectContext* context)
+        {
+            if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
+            {
+                serializeContext->Class<ProfilingTraceSerializer>()
+                    ->Version(1)
+                    ->Field("traceEvents", &ProfilingTraceSerializer::m_traceEvents)
+                    ->Field("displayTimeUnit", &ProfilingTraceSerializer::m_displayTimeUnit)
+                    ;
+            }
+
+            ProfilingTraceEvent::Reflect(context);
+        }
+
+        // --- ProfilingTraceEvent ---
+
+        void ProfilingTraceSerializer::ProfilingTraceEvent::Reflect(AZ::ReflectContext* context)
+        {
+            // The field names are defined by the Chrome trace event format
+            if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
+            {
+                serializeContext->Class<ProfilingTraceEvent>()
+                    ->Version(1)
+                    ->Field("name", &ProfilingTraceEvent::m_name)
+                    ->Field("cat", &ProfilingTraceEvent::m_category)
+                    ->Field("ph", &ProfilingTraceEvent::m_phase)
+                    ->Field("ts", &ProfilingTraceEvent::m_timestampInMicroseconds)
+                    ->Field("dur", &ProfilingTraceEvent::m_durationInMicroseconds)
+                    ->Field("pid", &ProfilingTraceEvent::m_processId)
+                    ->Field("tid", &ProfilingTraceEvent::m_threadId)
+                    ;
+            }
+        }
+
         // --- ProfilingCaptureSystemComponent ---
 
         void ProfilingCaptureSystemComponent::Reflect(AZ::ReflectContext* context)
@@ -331,6 +495,7 @@ namespace AZ
                     ->Event("CapturePassTimestamp", &ProfilingCaptureRequestBus::Events::CapturePassTimestamp)
                     ->Event("CapturePassPipelineStatistics", &ProfilingCaptureRequestBus::Events::CapturePassPipelineStatistics)
                     ->Event("CaptureCpuProfilingStatistics", &ProfilingCaptureRequestBus::Events::CaptureCpuProfilingStatistics)
+                    ->Event("CaptureProfilingTrace", &ProfilingCaptureRequestBus::Events::CaptureProfilingTrace)
                     ;
 
                 ProfilingCaptureNotificationBusHandler::Reflect(context);
@@ -339,11 +504,15 @@ namespace AZ
             TimestampSerializer::Reflect(context);
             PipelineStatisticsSerializer::Reflect(context);
             CpuProfilingStatisticsSerializer::Reflect(context);
+            ProfilingTraceSerializer::Reflect(context);
         }
 
         void ProfilingCaptureSystemComponent::Activate()
         {
             ProfilingCaptureRequestBus::Handler::BusConnect();
+
+            // Stay connected to detect hitches, see r_profilingTraceHitchThreshold
+            TickBus::Handler::BusConnect();
         }
 
         void ProfilingCaptureSystemComponent::Deactivate()
@@ -385,8 +554,11 @@ namespace AZ
                     AZ_Warning("ProfilingCaptureSystemComponent", false, captureInfo.c_str());
                 }
 
-                // Disable all the Timestamp queries in passes.
-                root->SetTimestampQueryEnabled(false);
+                // Disable all the Timestamp queries in passes, unless GPU pass timing keeps them enabled.
+                if (!RPI::PassSystemInterface::Get()->IsGpuPassTimingEnabled())
+                {
+                    root->SetTimestampQueryEnabled(false);
+                }
 
                 // Notify listeners that the pass' Timestamp queries capture has finished.
                 ProfilingCaptureNotificationBus::Broadcast(&ProfilingCaptureNotificationBus::Events::OnCaptureQueryTimestampFinished,
@@ -394,12 +566,6 @@ namespace AZ
                     captureInfo);
             });
 
-            // Start the TickBus.
-            if (captureStarted)
-            {
-                TickBus::Handler::BusConnect();
-            }
-
             return captureStarted;
         }
 
@@ -435,8 +601,11 @@ namespace AZ
                     AZ_Warning("ProfilingCaptureSystemComponent", false, captureInfo.c_str());
                 }
 
-                // Disable all the PipelineStatistics queries in passes.
-                root->SetPipelineStatisticsQueryEnabled(false);
+                // Disable all the PipelineStatistics queries in passes, unless GPU pass timing keeps them enabled.
+                if (!RPI::PassSystemInterface::Get()->IsGpuPassTimingEnabled())
+                {
+                    root->SetPipelineStatisticsQueryEnabled(false);
+                }
 
                 // Notify listeners that the pass' PipelineStatistics queries capture has finished.
                 ProfilingCaptureNotificationBus::Broadcast(&ProfilingCaptureNotificationBus::Events::OnCaptureQueryPipelineStatisticsFinished,
@@ -444,12 +613,6 @@ namespace AZ
                     captureInfo);
             });
 
-            // Start the TickBus.
-            if (captureStarted)
-            {
-                TickBus::Handler::BusConnect();
-            }
-
             return captureStarted;
         }
 
@@ -500,13 +663,50 @@ namespace AZ
 
             });
 
-            // Start the TickBus.
-            if (captureStarted)
+            return captureStarted;
+        }
+
+        bool ProfilingCaptureSystemComponent::CaptureProfilingTrace(const AZStd::string& outputFilePath, float durationInSeconds)
+        {
+            RHI::CpuProfiler* cpuProfiler = RHI::CpuProfiler::Get();
+            if (!cpuProfiler || !cpuProfiler->IsContinuousCaptureEnabled())
             {
-                TickBus::Handler::BusConnect();
+                AZ_Warning("ProfilingCaptureSystemComponent", false,
+                    "The continuous Cpu profiling capture is disabled, enable it with r_cpuProfilerContinuousCapture.");
+                return false;
             }
 
-            return captureStarted;
+            // The data is recorded continuously, so unlike the other captures this one doesn't need to wait for any frames.
+            const auto durationInTicks = static_cast<AZStd::sys_time_t>(durationInSeconds * AZStd::GetTimeTicksPerSecond());
+            const AZStd::sys_time_t startTick = AZStd::GetTimeNowTicks() - durationInTicks;
+
+            JsonSerializerSettings serializationSettings;
+            serializationSettings.m_keepDefaults = true;
+
+            ProfilingTraceSerializer serializer(cpuProfiler->GetRecentTimeRegions(startTick),
+                RPI::PassSystemInterface::Get()->GetGpuFrameTimestamps(startTick), startTick);
+            const auto saveResult = JsonSerializationUtils::SaveObjectToFile(&serializer,
+                outputFilePath, (ProfilingTraceSerializer*)nullptr, &serializationSettings);
+
+            AZStd::string captureInfo = outputFilePath;
+            if (!saveResult.IsSuccess())
+            {
+                captureInfo = AZStd::string::format("Failed to save profiling trace to file '%s'. Error: %s",
+                    outputFilePath.c_str(),
+                    saveResult.GetError().c_str());
+                AZ_Warning("ProfilingCaptureSystemComponent", false, captureInfo.c_str());
+            }
+            else
+            {
+                AZ_Printf("ProfilingCaptureSystemComponent", "Profiling trace was saved to file [%s]\n", outputFilePath.c_str());
+            }
+
+            // Notify listeners that the profiling trace capture has finished.
+            ProfilingCaptureNotificationBus::Broadcast(&ProfilingCaptureNotificationBus::Events::OnCaptureProfilingTraceFinished,
+                saveResult.IsSuccess(),
+                captureInfo);
+
+            return saveResult.IsSuccess();
         }
 
         AZStd::vector<const RPI::Pass*> ProfilingCaptureSystemComponent::CollectPassesRecursively(const RPI::Pass* root) const
@@ -544,18 +744,39 @@ namespace AZ
             return foundPasses;
         }
 
-        void ProfilingCaptureSystemComponent::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] ScriptTimePoint time)
+        void ProfilingCaptureSystemComponent::CheckForHitch(float deltaTime, ScriptTimePoint time)
         {
+            const float hitchThreshold = r_profilingTraceHitchThreshold;
+            if (hitchThreshold <= 0.0f || deltaTime * 1000.0f < hitchThreshold)
+            {
+                return;
+            }
+
+            // Skip hitches that are already part of the previous trace
+            const float traceDuration = r_profilingTraceDuration;
+            const double currentTimeInSeconds = time.GetSeconds();
+            if (m_hasCapturedHitch && currentTimeInSeconds - m_lastHitchCaptureTimeInSeconds < traceDuration)
+            {
+                return;
+            }
+            m_hasCapturedHitch = true;
+            m_lastHitchCaptureTimeInSeconds = currentTimeInSeconds;
+
+            AZ_Printf("ProfilingCaptureSystemComponent", "Frame took %.2f ms, exporting the profiling trace of the last %.1f seconds\n",
+                deltaTime * 1000.0f, traceDuration);
+            const AZStd::string outputFilePath = AZStd::string::format("@user@/Profiling/HitchTrace_%llu.json",
+                static_cast<unsigned long long>(AZStd::GetTimeUTCMilliSecond()));
+            CaptureProfilingTrace(outputFilePath, traceDuration);
+        }
+
+        void ProfilingCaptureSystemComponent::OnTick(float deltaTime, ScriptTimePoint time)
+        {
+            CheckForHitch(deltaTime, time);
+
             // Update the delayed captures
             m_timestampCapture.UpdateCapture();
             m_pipelineStatisticsCapture.UpdateCapture();
             m_cpuProfilingStatisticsCapture.UpdateCapture();
-
-            // Disconnect from the TickBus if all capture states are set to idle.
-            if (m_timestampCapture.IsIdle() && m_pipelineStatisticsCapture.IsIdle() && m_cpuProfilingStatisticsCapture.IsIdle())
-            {
-                TickBus::Handler::BusDisconnect();
-            }
         }
 
     }
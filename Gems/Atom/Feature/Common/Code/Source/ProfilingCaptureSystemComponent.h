@@ -69,6 +69,7 @@ namespace AZ
             bool CapturePassTimestamp(const AZStd::string& outputFilePath) override;
             bool CapturePassPipelineStatistics(const AZStd::string& outputFilePath) override;
             bool CaptureCpuProfilingStatistics(const AZStd::string& outputFilePath) override;
+            bool CaptureProfilingTrace(const AZStd::string& outputFilePath, float durationInSeconds) override;
 
         private:
             void OnTick(float deltaTime, ScriptTimePoint time) override;
@@ -78,9 +79,16 @@ namespace AZ
 
             AZStd::vector<AZ::RPI::Pass*> FindPasses(AZStd::vector<AZStd::string>&& passHierarchy) const;
 
+            // Exports a profiling trace when the frame took longer than r_profilingTraceHitchThreshold.
+            void CheckForHitch(float deltaTime, ScriptTimePoint time);
+
             DelayedQueryCaptureHelper m_timestampCapture;
             DelayedQueryCaptureHelper m_pipelineStatisticsCapture;
             DelayedQueryCaptureHelper m_cpuProfilingStatisticsCapture;
+
+            // Time of the last hitch that exported a trace, so the traces of consecutive hitches don't overlap.
+            double m_lastHitchCaptureTimeInSeconds = 0.0;
+            bool m_hasCapturedHitch = false;
         };
     }
 }
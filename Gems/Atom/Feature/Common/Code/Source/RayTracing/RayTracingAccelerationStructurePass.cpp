@@ -13,6 +13,7 @@
 #include <Atom/RPI.Public/RenderPipeline.h>
 #include <Atom/RPI.Public/Scene.h>
 #include <Atom/Feature/Mesh/MeshFeatureProcessor.h>
+#include <AzCore/Console/IConsole.h>
 #include <RayTracing/RayTracingFeatureProcessor.h>
 #include <RayTracing/RayTracingAccelerationStructurePass.h>
 
@@ -20,6 +21,10 @@ namespace AZ
 {
     namespace Render
     {
+        AZ_CVAR(uint32_t, r_rayTracingBlasBuildsPerFrame, 64, nullptr, ConsoleFunctorFlags::Null,
+            "Maximum number of sub-mesh BLAS objects built per frame, 0 builds all of them on the frame their mesh is added. "
+            "Meshes waiting for their BLAS are left out of the TLAS until it is built, the first waiting mesh is always built.");
+
         RPI::Ptr<RayTracingAccelerationStructurePass> RayTracingAccelerationStructurePass::Create(const RPI::PassDescriptor& descriptor)
         {
             RPI::Ptr<RayTracingAccelerationStructurePass> rayTracingAccelerationStructurePass = aznew RayTracingAccelerationStructurePass(descriptor);
@@ -56,8 +61,13 @@ namespace AZ
 
             if (rayTracingFeatureProcessor)
             {
-                if (rayTracingFeatureProcessor->GetRevision() != m_rayTracingRevision)
+                // the TLAS is also rebuilt while meshes are waiting for their BLAS, to add them once it is built
+                if (rayTracingFeatureProcessor->GetRevision() != m_rayTracingRevision || m_hasPendingBlasBuilds)
                 {
+                    // update the stored revision, even if we don't have any meshes to process
+                    m_rayTracingRevision = rayTracingFeatureProcessor->GetRevision();
+                    m_tlasNeedsBuild = true;
+
                     RHI::RayTracingBufferPools& rayTracingBufferPools = rayTracingFeatureProcessor->GetBufferPools();
                     RayTracingFeatureProcessor::MeshMap& rayTracingMeshes = rayTracingFeatureProcessor->GetMeshes();
                     uint32_t rayTracingSubMeshCount = rayTracingFeatureProcessor->GetSubMeshCount();
@@ -66,9 +76,32 @@ namespace AZ
                     RHI::RayTracingTlasDescriptor tlasDescriptor;
                     RHI::RayTracingTlasDescriptor* tlasDescriptorBuild = tlasDescriptor.Build();
 
+                    const uint32_t blasBuildBudget = r_rayTracingBlasBuildsPerFrame;
+                    m_hasPendingBlasBuilds = false;
+
                     uint32_t blasIndex = 0;
                     for (auto& rayTracingMesh : rayTracingMeshes)
                     {
+                        if (rayTracingMesh.second.m_blasBuilt == false)
+                        {
+                            // schedule the BLAS objects of newly added meshes within the budget, the others wait for a later frame
+                            // Note: the instance and hit group indices still count the waiting meshes, they must match the mesh info buffer
+                            const size_t subMeshCount = rayTracingMesh.second.m_subMeshes.size();
+                            if (blasBuildBudget > 0 && !m_blasBuildList.empty() && m_blasBuildList.size() + subMeshCount > blasBuildBudget)
+                            {
+                                m_hasPendingBlasBuilds = true;
+                                blasIndex++;
+                                continue;
+                            }
+
+                            for (auto& rayTracingSubMesh : rayTracingMesh.second.m_subMeshes)
+                            {
+                                m_blasBuildList.push_back(rayTracingSubMesh.m_blas);
+                            }
+
+                            rayTracingMesh.second.m_blasBuilt = true;
+                        }
+
                         for (auto& rayTracingSubMesh : rayTracingMesh.second.m_subMeshes)
                         {
                             tlasDescriptorBuild->Instance()
@@ -128,40 +161,29 @@ namespace AZ
                 return;
             }
 
-            if (!rayTracingFeatureProcessor->GetTlas()->GetTlasBuffer())
+            // build the BLAS objects scheduled this frame, they are referenced by the TLAS so they are built first
+            for (const RHI::Ptr<RHI::RayTracingBlas>& rayTracingBlas : m_blasBuildList)
             {
-                return;
+                context.GetCommandList()->BuildBottomLevelAccelerationStructure(*rayTracingBlas);
             }
+            m_blasBuildList.clear();
 
-            if (rayTracingFeatureProcessor->GetRevision() == m_rayTracingRevision)
+            if (!m_tlasNeedsBuild)
             {
                 // TLAS is up to date
                 return;
             }
+            m_tlasNeedsBuild = false;
 
-            // update the stored revision, even if we don't have any meshes to process
-            m_rayTracingRevision = rayTracingFeatureProcessor->GetRevision();
-
-            if (!rayTracingFeatureProcessor->GetSubMeshCount())
+            if (!rayTracingFeatureProcessor->GetTlas()->GetTlasBuffer())
             {
-                // no ray tracing meshes in the scene
                 return;
             }
 
-            // build newly added BLAS objects
-            // [GFX TODO][ATOM-14159] Add changelist for meshes in the RayTracingFeatureProcessor
-            RayTracingFeatureProcessor::MeshMap& rayTracingMeshes = rayTracingFeatureProcessor->GetMeshes();
-            for (auto& rayTracingMesh : rayTracingMeshes)
+            if (!rayTracingFeatureProcessor->GetSubMeshCount())
             {
-                if (rayTracingMesh.second.m_blasBuilt == false)
-                {
-                    for (auto& rayTracingSubMesh : rayTracingMesh.second.m_subMeshes)
-                    {
-                        context.GetCommandList()->BuildBottomLevelAccelerationStructure(*rayTracingSubMesh.m_blas);
-                    }
-
-                    rayTracingMesh.second.m_blasBuilt = true;
-                }
+                // no ray tracing meshes in the scene
+                return;
             }
 
             // build the TLAS object
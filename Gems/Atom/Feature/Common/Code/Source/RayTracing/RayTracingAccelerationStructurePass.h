@@ -9,7 +9,9 @@
 #include <Atom/RHI/ScopeProducer.h>
 #include <Atom/RPI.Public/Pass/Pass.h>
 #include <Atom/RPI.Public/Buffer/Buffer.h>
+#include <Atom/RHI/RayTracingAccelerationStructure.h>
 #include <Atom/RHI/RayTracingBufferPools.h>
+#include <AzCore/std/containers/vector.h>
 
 namespace AZ
 {
@@ -47,6 +49,15 @@ namespace AZ
 
             // revision number of the ray tracing data when the TLAS was built
             uint32_t m_rayTracingRevision = 0;
+
+            // BLAS objects scheduled to be built this frame
+            AZStd::vector<RHI::Ptr<RHI::RayTracingBlas>> m_blasBuildList;
+
+            // true if meshes are waiting for their BLAS to be built on a later frame
+            bool m_hasPendingBlasBuilds = false;
+
+            // true if the TLAS created this frame needs to be built
+            bool m_tlasNeedsBuild = false;
         };
     }   // namespace RPI
 }   // namespace AZ
@@ -96,6 +96,8 @@ namespace AZ
                 // decrement the mesh count by the number of meshes in the existing entry in case the number of meshes changed
                 m_subMeshCount -= aznumeric_cast<uint32_t>(itMesh->second.m_subMeshes.size());
                 m_meshes[objectIndex].m_subMeshes = subMeshes;
+                // the sub-meshes get new BLAS objects below, which need to be built
+                m_meshes[objectIndex].m_blasBuilt = false;
             }
 
             // create the BLAS buffers for each sub-mesh
@@ -17,12 +17,17 @@
 #include <Atom/RHI/RHISystemInterface.h>
 #include <Atom/RHI/PipelineState.h>
 #include <Atom/RHI.Reflect/InputStreamLayoutBuilder.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Debug/EventTrace.h>
 
 namespace AZ
 {
     namespace Render
     {
+        AZ_CVAR(uint32_t, r_reflectionProbeMaxConcurrentBakes, 1, nullptr, ConsoleFunctorFlags::Null,
+            "Maximum number of reflection probe cubemaps rendered at the same time, 0 starts every bake as soon as it is requested. "
+            "Other bakes wait in request order, and probes keep their current cubemap until their bake completes.");
+
         void ReflectionProbeFeatureProcessor::Reflect(ReflectContext* context)
         {
             if (auto* serializeContext = azrtti_cast<SerializeContext*>(context))
@@ -203,6 +208,8 @@ namespace AZ
                 meshFeatureProcessor->UpdateMeshReflectionProbes();
             }
 
+            StartQueuedBakes();
+
             // call Simulate on all reflection probes
             for (uint32_t probeIndex = 0; probeIndex < m_reflectionProbes.size(); ++probeIndex)
             {
@@ -236,6 +243,12 @@ namespace AZ
 
             AZ_Assert(itEntry != m_reflectionProbes.end(), "RemoveProbe called with a probe that is not in the probe list");
             m_reflectionProbes.erase(itEntry);
+
+            // drop the bakes that were still waiting for this probe
+            m_queuedBakes.erase(AZStd::remove_if(m_queuedBakes.begin(), m_queuedBakes.end(), [&](const QueuedBakeEntry& entry)
+            {
+                return (entry.m_probe == probe);
+            }), m_queuedBakes.end());
         }
 
         void ReflectionProbeFeatureProcessor::SetProbeOuterExtents(const ReflectionProbeHandle& probe, const Vector3& outerExtents)
@@ -272,7 +285,9 @@ namespace AZ
         void ReflectionProbeFeatureProcessor::BakeProbe(const ReflectionProbeHandle& probe, BuildCubeMapCallback callback, const AZStd::string& relativePath)
         {
             AZ_Assert(probe.get(), "BakeProbe called with an invalid handle");
-            probe->BuildCubeMap(callback);
+
+            // the cubemap build is started by Simulate() once a build slot is available
+            m_queuedBakes.push_back({ probe, callback });
 
             // check to see if this is an existing asset
             AZ::Data::AssetId assetId;
@@ -290,6 +305,43 @@ namespace AZ
             }
         }
 
+        void ReflectionProbeFeatureProcessor::StartQueuedBakes()
+        {
+            if (m_queuedBakes.empty())
+            {
+                return;
+            }
+
+            const uint32_t maxConcurrentBakes = r_reflectionProbeMaxConcurrentBakes;
+            uint32_t activeBakes = 0;
+            for (auto& reflectionProbe : m_reflectionProbes)
+            {
+                if (reflectionProbe->IsBuildingCubeMap())
+                {
+                    activeBakes++;
+                }
+            }
+
+            for (QueuedBakeVector::iterator itBake = m_queuedBakes.begin(); itBake != m_queuedBakes.end();)
+            {
+                if (maxConcurrentBakes > 0 && activeBakes >= maxConcurrentBakes)
+                {
+                    break;
+                }
+
+                // a probe baked again waits for its current build to finish
+                if (itBake->m_probe->IsBuildingCubeMap())
+                {
+                    ++itBake;
+                    continue;
+                }
+
+                itBake->m_probe->BuildCubeMap(itBake->m_callback);
+                activeBakes++;
+                itBake = m_queuedBakes.erase(itBake);
+            }
+        }
+
         bool ReflectionProbeFeatureProcessor::CheckCubeMapAssetNotification(const AZStd::string& relativePath, Data::Asset<RPI::StreamingImageAsset>& outCubeMapAsset, CubeMapAssetNotificationType& outNotificationType)
         {
             for (NotifyCubeMapAssetVector::iterator itNotification = m_notifyCubeMapAssets.begin(); itNotification != m_notifyCubeMapAssets.end(); ++itNotification)
@@ -24,11 +24,17 @@
 #include <Atom/RHI/CpuProfiler.h>
 #include <Atom/RHI/CommandList.h>
 
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Debug/EventTrace.h>
 #include <AzCore/Jobs/JobCompletion.h>
 #include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Math/Frustum.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/Math/ShapeIntersection.h>
 #include <AzCore/RTTI/TypeInfo.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/containers/bitset.h>
+#include <AzCore/std/limits.h>
 
 namespace AZ
 {
@@ -36,6 +42,59 @@ namespace AZ
     {
         const char* SkinnedMeshFeatureProcessor::s_featureProcessorName = "SkinnedMeshFeatureProcessor";
 
+        AZ_CVAR(bool,
+            r_skinningCullOffscreen,
+            true,
+            nullptr,
+            ConsoleFunctorFlags::Null,
+            "Skips skinning instances that are outside of the frustums of all views."
+        );
+
+        AZ_CVAR(uint32_t,
+            r_skinningMaxUpdateInterval,
+            1,
+            nullptr,
+            ConsoleFunctorFlags::Null,
+            "The number of frames between skinning updates of instances that cover at most r_skinningMinRateScreenPercentage of the screen. 1 skins all instances every frame."
+        );
+
+        AZ_CVAR(float,
+            r_skinningMinRateScreenPercentage,
+            0.05f,
+            nullptr,
+            ConsoleFunctorFlags::Null,
+            "Instances covering at most this percentage of the screen height are skinned every r_skinningMaxUpdateInterval frames."
+        );
+
+        AZ_CVAR(float,
+            r_skinningFullRateScreenPercentage,
+            0.25f,
+            nullptr,
+            ConsoleFunctorFlags::Null,
+            "Instances covering at least this percentage of the screen height are skinned every frame. The update interval is interpolated in between."
+        );
+
+        namespace
+        {
+            uint32_t GetSkinningUpdateInterval(float screenPercentage)
+            {
+                const uint32_t maxUpdateInterval = AZStd::max<uint32_t>(r_skinningMaxUpdateInterval, 1);
+                const float minRateScreenPercentage = r_skinningMinRateScreenPercentage;
+                const float fullRateScreenPercentage = r_skinningFullRateScreenPercentage;
+                if (maxUpdateInterval == 1 || screenPercentage >= fullRateScreenPercentage)
+                {
+                    return 1;
+                }
+                if (screenPercentage <= minRateScreenPercentage)
+                {
+                    return maxUpdateInterval;
+                }
+
+                const float t = (screenPercentage - minRateScreenPercentage) / (fullRateScreenPercentage - minRateScreenPercentage);
+                return aznumeric_cast<uint32_t>(AZ::Lerp(aznumeric_cast<float>(maxUpdateInterval), 1.0f, t) + 0.5f);
+            }
+        } // namespace
+
         void SkinnedMeshFeatureProcessor::Reflect(ReflectContext* context)
         {
             if (auto* serializeContext = azrtti_cast<SerializeContext*>(context))
@@ -154,7 +213,7 @@ namespace AZ
                                             for (size_t morphTargetIndex = 0; morphTargetIndex < renderProxy->m_morphTargetDispatchItemsByLod[lodIndex].size(); morphTargetIndex++)
                                             {
                                                 const MorphTargetDispatchItem* dispatchItem = renderProxy->m_morphTargetDispatchItemsByLod[lodIndex][morphTargetIndex].get();
-                                                if (dispatchItem && dispatchItem->GetWeight() > AZ::Constants::FloatEpsilon)
+                                                if (dispatchItem && dispatchItem->IsActive())
                                                 {
                                                     m_morphTargetDispatches.insert(&dispatchItem->GetRHIDispatchItem());
                                                 }
@@ -190,6 +249,10 @@ namespace AZ
                 MeshDataInstance& meshDataInstance = **renderProxy.m_meshHandle;
                 const RPI::Cullable& cullable = meshDataInstance.GetCullable();
 
+                // The lods that are selected by any view, and the lowest update interval required by the views that see the instance.
+                AZStd::bitset<RPI::ModelLodAsset::LodCountMax> visibleLods;
+                uint32_t updateInterval = AZStd::numeric_limits<uint32_t>::max();
+
                 for (const RPI::ViewPtr& viewPtr : packet.m_views)
                 {
                     RPI::View* view = viewPtr.get();
@@ -205,6 +268,13 @@ namespace AZ
                     //  do the enumeration for each view, keep track of the lowest lod for each entry,
                     //  and submit the appropriate dispatch item
 
+                    // The culling system runs concurrently with this function, so test the bounds against the view frustum directly.
+                    if (r_skinningCullOffscreen &&
+                        !ShapeIntersection::Overlaps(Frustum::CreateFromMatrixColumnMajor(view->GetWorldToClipMatrix()), cullable.m_cullData.m_boundingSphere))
+                    {
+                        continue;
+                    }
+
                     //the [1][1] element of a perspective projection matrix stores cot(FovY/2) (equal to 2*nearPlaneDistance/nearPlaneHeight),
                     //which is used to determine the (vertical) projected size in screen space
                     const float yScale = viewToClip.GetElement(1, 1);
@@ -216,6 +286,8 @@ namespace AZ
                     const float approxScreenPercentage = RPI::ModelLodUtils::ApproxScreenPercentage(
                         pos, cullable.m_lodData.m_lodSelectionRadius, cameraPos, yScale, isPerspective);
 
+                    updateInterval = AZStd::min(updateInterval, GetSkinningUpdateInterval(approxScreenPercentage));
+
                     for (size_t lodIndex = 0; lodIndex < cullable.m_lodData.m_lods.size(); ++lodIndex)
                     {
                         const RPI::Cullable::LodData::Lod& lod = cullable.m_lodData.m_lods[lodIndex];
@@ -223,16 +295,44 @@ namespace AZ
                         //Note that this supports overlapping lod ranges (to support cross-fading lods, for example)
                         if (approxScreenPercentage >= lod.m_screenCoverageMin && approxScreenPercentage <= lod.m_screenCoverageMax)
                         {
-                            AZStd::lock_guard lock(m_dispatchItemMutex);
-                            m_skinningDispatches.insert(&renderProxy.m_dispatchItemsByLod[lodIndex]->GetRHIDispatchItem());
-                            for (size_t morphTargetIndex = 0; morphTargetIndex < renderProxy.m_morphTargetDispatchItemsByLod[lodIndex].size(); morphTargetIndex++)
-                            {
-                                const MorphTargetDispatchItem* dispatchItem = renderProxy.m_morphTargetDispatchItemsByLod[lodIndex][morphTargetIndex].get();
-                                if (dispatchItem && dispatchItem->GetWeight() > AZ::Constants::FloatEpsilon)
-                                {
-                                    m_morphTargetDispatches.insert(&dispatchItem->GetRHIDispatchItem());
-                                }
-                            }
+                            visibleLods.set(lodIndex);
+                        }
+                    }
+                }
+
+                if (visibleLods.none())
+                {
+                    // The output stream of an instance that isn't skinned goes stale, so skin it as soon as it's visible again.
+                    renderProxy.m_framesSinceSkinningUpdate = AZStd::numeric_limits<uint32_t>::max();
+                    continue;
+                }
+
+                // Instances that are small on screen keep using the output stream of a previous frame in between updates.
+                if (renderProxy.m_framesSinceSkinningUpdate < AZStd::numeric_limits<uint32_t>::max())
+                {
+                    ++renderProxy.m_framesSinceSkinningUpdate;
+                }
+                if (renderProxy.m_framesSinceSkinningUpdate < updateInterval)
+                {
+                    continue;
+                }
+                renderProxy.m_framesSinceSkinningUpdate = 0;
+
+                AZStd::lock_guard lock(m_dispatchItemMutex);
+                for (size_t lodIndex = 0; lodIndex < cullable.m_lodData.m_lods.size(); ++lodIndex)
+                {
+                    if (!visibleLods.test(lodIndex))
+                    {
+                        continue;
+                    }
+
+                    m_skinningDispatches.insert(&renderProxy.m_dispatchItemsByLod[lodIndex]->GetRHIDispatchItem());
+                    for (size_t morphTargetIndex = 0; morphTargetIndex < renderProxy.m_morphTargetDispatchItemsByLod[lodIndex].size(); morphTargetIndex++)
+                    {
+                        const MorphTargetDispatchItem* dispatchItem = renderProxy.m_morphTargetDispatchItemsByLod[lodIndex][morphTargetIndex].get();
+                        if (dispatchItem && dispatchItem->IsActive())
+                        {
+                            m_morphTargetDispatches.insert(&dispatchItem->GetRHIDispatchItem());
                         }
                     }
                 }
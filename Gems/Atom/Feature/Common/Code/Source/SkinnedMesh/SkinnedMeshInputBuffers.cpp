@@ -660,6 +660,11 @@ namespace AZ
             modelCreator.End(modelAsset);
 
             instance->m_model = RPI::Model::FindOrCreate(modelAsset);
+            if (instance->m_model)
+            {
+                // The skinning dispatches pick their own lods, and all the lods write to the same skinned output buffer
+                instance->m_model->DisableLodStreaming();
+            }
             return instance;
         }
 
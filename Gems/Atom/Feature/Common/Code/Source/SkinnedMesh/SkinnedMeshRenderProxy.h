@@ -18,6 +18,7 @@
 
 #include <AzCore/base.h>
 #include <AzCore/Math/Vector3.h>
+#include <AzCore/std/limits.h>
 
 namespace AZ
 {
@@ -65,6 +66,8 @@ namespace AZ
 
             SkinnedMeshFeatureProcessor* m_featureProcessor = nullptr;
             bool m_isQueuedForCompile = false;
+            //! The number of frames since the instance was last skinned, used to reduce the update rate of small instances.
+            uint32_t m_framesSinceSkinningUpdate = AZStd::numeric_limits<uint32_t>::max();
         };
 
         using SkinnedMeshRenderProxyHandle = StableDynamicArrayHandle<SkinnedMeshRenderProxy>;
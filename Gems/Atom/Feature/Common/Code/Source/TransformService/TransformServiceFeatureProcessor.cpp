@@ -40,10 +40,13 @@ namespace AZ
             m_objectToWorldBufferIndex = m_sceneSrg->FindShaderInputBufferIndex(Name{"m_objectToWorldBuffer"});
             m_objectToWorldInverseTransposeBufferIndex = m_sceneSrg->FindShaderInputBufferIndex(Name{"m_objectToWorldInverseTransposeBuffer"});
             m_objectToWorldHistoryBufferIndex = m_sceneSrg->FindShaderInputBufferIndex(Name{"m_objectToWorldHistoryBuffer"});
+            m_objectBoundingSphereBufferIndex = m_sceneSrg->FindShaderInputBufferIndex(Name{"m_objectBoundingSphereBuffer"});
 
             m_deviceBufferNeedsUpdate = true;
+            m_boundingSphereBufferNeedsUpdate = true;
             m_objectToWorldTransforms.reserve(BufferReserveCount);
             m_objectToWorldInverseTransposeTransforms.reserve(BufferReserveCount);            
+            m_objectBoundingSpheres.reserve(BufferReserveCount);
 
             m_isWriteable = true;
 
@@ -54,10 +57,12 @@ namespace AZ
         {
             m_objectToWorldTransforms = {};
             m_objectToWorldInverseTransposeTransforms = {};
+            m_objectBoundingSpheres = {};
 
             m_objectToWorldBuffer = nullptr;
             m_objectToWorldInverseTransposeBuffer = nullptr;
             m_objectToWorldHistoryBuffer = nullptr;
+            m_objectBoundingSphereBuffer = nullptr;
 
             m_firstAvailableTransformIndex = NoAvailableTransformIndices;
 
@@ -128,6 +133,32 @@ namespace AZ
                     }
                 }
             }
+
+            {
+                const uint32_t elementCount = RHI::NextPowerOfTwo(GetMax<uint32_t>(1, static_cast<uint32_t>(m_objectBoundingSpheres.size())));
+                static const uint32_t elementSize = BoundingSphereValueSize;
+                const uint32_t byteCount = elementCount * elementSize;
+
+                // Create or resize
+                if (!m_objectBoundingSphereBuffer)
+                {
+                    // Create the bounding sphere buffer, grow by powers of two
+                    RPI::CommonBufferDescriptor desc2;
+                    desc2.m_poolType = RPI::CommonBufferPoolType::ReadOnly;
+                    desc2.m_bufferName = "m_objectBoundingSphereBuffer";
+                    desc2.m_byteCount = byteCount;
+                    desc2.m_elementSize = elementSize;
+
+                    m_objectBoundingSphereBuffer = RPI::BufferSystemInterface::Get()->CreateBufferFromCommonPool(desc2);
+                }
+                else
+                {
+                    if (byteCount > m_objectBoundingSphereBuffer->GetBufferSize())
+                    {
+                        m_objectBoundingSphereBuffer->Resize(byteCount);
+                    }
+                }
+            }
         }
 
         void TransformServiceFeatureProcessor::Render([[maybe_unused]] const FeatureProcessor::RenderPacket& packet)
@@ -140,15 +171,22 @@ namespace AZ
             m_sceneSrg->SetBufferView(m_objectToWorldBufferIndex, m_objectToWorldBuffer->GetBufferView());
             m_sceneSrg->SetBufferView(m_objectToWorldInverseTransposeBufferIndex, m_objectToWorldInverseTransposeBuffer->GetBufferView());
             m_sceneSrg->SetBufferView(m_objectToWorldHistoryBufferIndex, m_objectToWorldHistoryBuffer->GetBufferView());
+            m_sceneSrg->SetBufferView(m_objectBoundingSphereBufferIndex, m_objectBoundingSphereBuffer->GetBufferView());
         }
 
         void TransformServiceFeatureProcessor::OnBeginPrepareRender()
         {
             m_isWriteable = false;
 
-            if (m_historyBufferNeedsUpdate || m_deviceBufferNeedsUpdate)
+            if (m_historyBufferNeedsUpdate || m_deviceBufferNeedsUpdate || m_boundingSphereBufferNeedsUpdate)
             {
                 PrepareBuffers();
+                if (m_boundingSphereBufferNeedsUpdate)
+                {
+                    m_objectBoundingSphereBuffer->UpdateData(m_objectBoundingSpheres.data(), m_objectBoundingSpheres.size() * BoundingSphereValueSize);
+                    m_boundingSphereBufferNeedsUpdate = false;
+                }
+
                 if (m_historyBufferNeedsUpdate)
                 {
                     m_objectToWorldHistoryBuffer->UpdateData(m_objectToWorldHistoryTransforms.data(), m_objectToWorldHistoryTransforms.size() * TransformValueSize);
@@ -189,7 +227,9 @@ namespace AZ
                 m_objectToWorldTransforms.push_back();
                 m_objectToWorldInverseTransposeTransforms.push_back();
                 m_objectToWorldHistoryTransforms.push_back();
+                m_objectBoundingSpheres.push_back();
             }
+            SetBoundingSphere(modelIndex, AZ::Sphere(AZ::Vector3::CreateZero(), 0.0f));
             return ObjectId(modelIndex);
         }
 
@@ -201,6 +241,7 @@ namespace AZ
             {
                 m_objectToWorldTransforms.at(id.GetIndex()).m_nextFreeSlot = m_firstAvailableTransformIndex;
                 m_firstAvailableTransformIndex = id.GetIndex();
+                SetBoundingSphere(id.GetIndex(), AZ::Sphere(AZ::Vector3::CreateZero(), -1.0f));
                 id.Reset();
             }
         }
@@ -236,5 +277,23 @@ namespace AZ
             AZ::Matrix3x4 matrix3x4 = AZ::Matrix3x4::CreateFromRowMajorFloat12(m_objectToWorldTransforms.at(id.GetIndex()).m_transform);
             return matrix3x4.RetrieveScale();
         }
+
+        void TransformServiceFeatureProcessor::SetBoundingSphereForId(ObjectId id, const AZ::Sphere& boundingSphere)
+        {
+            AZ_Error("TransformServiceFeatureProcessor", m_isWriteable, "Transform data cannot be written to during this phase");
+            AZ_Error("TransformServiceFeatureProcessor", id.IsValid(), "Attempting to set the bounding sphere for an invalid handle.");
+            if (id.IsValid())
+            {
+                SetBoundingSphere(id.GetIndex(), boundingSphere);
+            }
+        }
+
+        void TransformServiceFeatureProcessor::SetBoundingSphere(uint32_t index, const AZ::Sphere& boundingSphere)
+        {
+            float* value = m_objectBoundingSpheres.at(index).m_value;
+            boundingSphere.GetCenter().StoreToFloat3(value);
+            value[3] = boundingSphere.GetRadius();
+            m_boundingSphereBufferNeedsUpdate = true;
+        }
     }
 }
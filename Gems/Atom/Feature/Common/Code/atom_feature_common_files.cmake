@@ -220,6 +220,8 @@ set(FILES
     Source/PostProcessing/DepthOfFieldCopyFocusDepthToCpuPass.cpp
     Source/PostProcessing/DepthUpsamplePass.cpp
     Source/PostProcessing/DepthUpsamplePass.h
+    Source/PostProcessing/DynamicResolutionController.cpp
+    Source/PostProcessing/DynamicResolutionController.h
     Source/PostProcessing/EyeAdaptationPass.cpp
     Source/PostProcessing/EyeAdaptationPass.h
     Source/PostProcessing/FastDepthAwareBlurPasses.cpp
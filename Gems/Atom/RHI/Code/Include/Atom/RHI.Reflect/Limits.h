@@ -68,6 +68,7 @@ namespace AZ
                 constexpr uint64_t StagingBufferBudgetInBytes          = 128ul * 1024 * 1024;
 
                 constexpr uint64_t AsyncQueueStagingBufferSizeInBytes  = 4ul   * 1024 * 1024;
+                constexpr uint32_t AsyncQueueStagingBufferCount        = 8;
                 constexpr uint64_t MediumStagingBufferPageSizeInBytes  = 2ul   * 1024 * 1024;
                 constexpr uint64_t LargestStagingBufferPageSizeInBytes = 128ul * 1024 * 1024;
                 constexpr uint64_t ImagePoolPageSizeInBytes            = 2ul   * 1024 * 1024;
@@ -90,6 +90,12 @@ namespace AZ
              * may choose to transfer memory down the heap level hierarchy in response to memory trim events from the driver.
              */
             AZStd::atomic_size_t m_residentInBytes{ 0 };
+
+            /**
+             * Fraction of the memory pages of the heap that could be released if the allocations were packed together,
+             * from 0 to 1. Only reported by pools that sub-allocate from pages, and updated when the pool collects garbage.
+             */
+            float m_fragmentation = 0.0f;
         };
 
         /**
@@ -41,6 +41,7 @@ namespace AZ
             static void Reflect(AZ::ReflectContext* context);
             AZ::u64  m_stagingBufferBudgetInBytes          = RHI::DefaultValues::Memory::StagingBufferBudgetInBytes;
             AZ::u64  m_asyncQueueStagingBufferSizeInBytes  = RHI::DefaultValues::Memory::AsyncQueueStagingBufferSizeInBytes;
+            AZ::u32  m_asyncQueueStagingBufferCount        = RHI::DefaultValues::Memory::AsyncQueueStagingBufferCount;
             AZ::u64  m_mediumStagingBufferPageSizeInBytes  = RHI::DefaultValues::Memory::MediumStagingBufferPageSizeInBytes;
             AZ::u64  m_largestStagingBufferPageSizeInBytes = RHI::DefaultValues::Memory::LargestStagingBufferPageSizeInBytes;
             AZ::u64  m_imagePoolPageSizeInBytes            = RHI::DefaultValues::Memory::ImagePoolPageSizeInBytes;
@@ -14,6 +14,16 @@ namespace AZ
 
     namespace RHI
     {
+        //! The compression applied to the data of streaming image sub-resources.
+        enum class StreamingImageCompression : uint32_t
+        {
+            //! The data is stored in the layout and format of the image.
+            None = 0,
+            //! Each sub-resource is stored as an individual zlib (deflate) stream.
+            Deflate,
+            Count
+        };
+
         class StreamingImagePoolDescriptor
             : public ResourcePoolDescriptor
         {
@@ -29,4 +39,6 @@ namespace AZ
             // Currently empty.
         };
     }
+
+    AZ_TYPE_INFO_SPECIALIZE(RHI::StreamingImageCompression, "{5C2B0D4E-9A61-4F3B-8E27-1D6C4A9F0B83}");
 }
@@ -8,6 +8,7 @@
 
 #include <Atom/RHI.Reflect/AttachmentId.h>
 #include <Atom/RHI.Reflect/TransientAttachmentStatistics.h>
+#include <Atom/RHI/AliasedHeapPlacement.h>
 #include <Atom/RHI/AliasingBarrierTracker.h>
 #include <Atom/RHI/BufferPool.h>
 #include <Atom/RHI/FreeListAllocator.h>
@@ -44,6 +45,9 @@ namespace AZ
         //! Aliased Heaps are used for allocating transient attachments (resources that are valid only during the duration of a frame).
         //! and they will reuse memory whenever possible, and will also track the necessary barriers that need to be inserted when aliasing happens.
         //! Aliased Heaps do not support aliased resources being used at the same time (even if the resources are compatible).
+        //! At the end of a frame the heap places the attachments of the frame from their lifetimes (see PlaceAliasedHeapResources),
+        //! and the following frames use that placement for the attachments that still match it, which keeps a lower watermark
+        //! than placing them in scope order. The other attachments are allocated above the placed ones.
         class AliasedHeap
             : public ResourcePool
         {
@@ -118,6 +122,13 @@ namespace AZ
         private:
             void DeactivateResourceInternal(const AttachmentId& attachmentId, Scope& scope, AliasedResourceType type);
 
+            //! Returns the heap address of an attachment, from the placement if it's still valid for the attachment
+            //! or from the first fit allocator otherwise.
+            VirtualAddress AllocateInternal(const AttachmentId& attachmentId, const ResourceMemoryRequirements& memRequirements, bool& placed);
+
+            //! Computes a new placement when the attachments of the frame changed.
+            void UpdatePlacement();
+
             /// Descriptor of the heap.
             AliasedHeapDescriptor m_descriptor;
 
@@ -147,9 +158,31 @@ namespace AZ
                 Resource* m_resource = nullptr;
                 uint32_t m_attachmentIndex = 0;
                 Scope* m_activateScope = nullptr;
+                bool m_placed = false;
             };
 
             AZStd::unordered_map<AttachmentId, AttachmentData> m_activeAttachmentLookup;
+
+            /// The attachments of the frame with their lifetimes, in the same order as the heap statistics attachments.
+            AZStd::vector<AliasedHeapPlacementRequest> m_placementRequests;
+
+            /// Hash of the placement requests the current placement was computed from.
+            size_t m_placementHash = 0;
+
+            struct PlacedAttachment
+            {
+                size_t m_heapOffset = 0;
+                size_t m_sizeInBytes = 0;
+            };
+
+            /// Attachments placed ahead of time, used when the attachment is activated again with the same size.
+            AZStd::unordered_map<AttachmentId, PlacedAttachment> m_placedAttachments;
+
+            /// Size of the range reserved at the bottom of the heap for the placed attachments.
+            size_t m_placementSize = 0;
+
+            /// First fit allocation of the reserved range, for the duration of a frame.
+            VirtualAddress m_placementReservation;
         };
     }
 }
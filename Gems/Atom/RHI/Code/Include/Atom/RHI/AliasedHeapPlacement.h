@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <Atom/RHI.Reflect/AttachmentId.h>
+#include <AtomCore/std/containers/array_view.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ
+{
+    namespace RHI
+    {
+        //! A transient resource to place in an Aliased Heap, alive from its first to its last scope (both included).
+        struct AliasedHeapPlacementRequest
+        {
+            AttachmentId m_attachmentId;
+            size_t m_sizeInBytes = 0;
+            size_t m_alignmentInBytes = 1;
+            uint32_t m_scopeIndexFirst = 0;
+            uint32_t m_scopeIndexLast = 0;
+        };
+
+        //! Computes heap offsets for a set of transient resources whose lifetimes are known up front.
+        //! Resources are placed from the largest to the smallest, each one at the lowest aligned offset that doesn't overlap
+        //! a placed resource alive during one of its scopes. Unlike placing them in scope order, large resources end up packed
+        //! at the bottom of the heap and the smaller ones fill the gaps, which keeps the peak heap size low.
+        //! @param requests The resources to place, with their power of two alignment.
+        //! @param heapOffsets Set to the offset in bytes of each request, in the same order.
+        //! @return The size in bytes of the heap needed by the placement.
+        size_t PlaceAliasedHeapResources(AZStd::array_view<AliasedHeapPlacementRequest> requests, AZStd::vector<size_t>& heapOffsets);
+    }
+}
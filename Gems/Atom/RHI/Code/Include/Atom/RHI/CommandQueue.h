@@ -49,6 +49,10 @@ namespace AZ
             using Command = AZStd::function<void(void* commandQueue)>;
             void QueueCommand(Command command);
             void FlushCommands();
+
+            //! Returns true if commands are waiting to be processed by the queue thread.
+            //! The command currently being processed is not counted.
+            bool HasPendingCommands();
             
             RHI::HardwareQueueClass GetHardwareQueueClass() const;
             const CommandQueueDescriptor& GetDescriptor() const;
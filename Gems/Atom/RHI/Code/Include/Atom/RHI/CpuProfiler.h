@@ -62,6 +62,7 @@ namespace AZ
         public:
             using ThreadTimeRegionMap = AZStd::unordered_map<AZStd::string, AZStd::vector<CachedTimeRegion>>;
             using TimeRegionMap = AZStd::unordered_map<AZStd::thread_id, ThreadTimeRegionMap>;
+            using RecentTimeRegionMap = AZStd::unordered_map<AZStd::thread_id, AZStd::vector<CachedTimeRegion>>;
 
             AZ_RTTI(CpuProfiler, "{127C1D0B-BE05-4E18-A8F6-24F3EED2ECA6}");
 
@@ -85,6 +86,15 @@ namespace AZ
             virtual void SetProfilerEnabled(bool enabled) = 0;
 
             virtual bool IsProfilerEnabled() const = 0 ;
+
+            //! Enable/Disable the continuous capture, which keeps the most recent regions of each thread in a ring buffer
+            //! regardless of whether the CpuProfiler is enabled, so they can be exported after a hitch occurred.
+            virtual void SetContinuousCaptureEnabled(bool enabled) = 0;
+            virtual bool IsContinuousCaptureEnabled() const = 0;
+
+            //! Get the regions of the continuous capture that ended at or after startTick.
+            //! Threads only keep a limited number of regions, so older regions of busy threads might be missing.
+            virtual RecentTimeRegionMap GetRecentTimeRegions(AZStd::sys_time_t startTick) = 0;
         };
 
     } // namespace RPI
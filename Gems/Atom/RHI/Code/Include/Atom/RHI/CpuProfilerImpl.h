@@ -10,6 +10,7 @@
 #include <Atom/RHI.Reflect/Base.h>
 
 #include <AzCore/Memory/OSAllocator.h>
+#include <AzCore/std/containers/array.h>
 #include <AzCore/std/containers/map.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/parallel/shared_mutex.h>
@@ -39,11 +40,16 @@ namespace AZ
             // Maximum stack size
             static constexpr uint32_t TimeRegionStackSize = 2048u;
 
+            // Number of completed regions that the continuous capture keeps per thread
+            static constexpr uint32_t RecentTimeRegionCount = 16384u;
+
             // Adds a region to the stack, gets called each time a region begins
             void RegionStackPushBack(TimeRegion& timeRegion);
 
             // Pops a region from the stack, gets called each time a region ends
-            void RegionStackPopBack();
+            // @param addCachedRegion Whether the region is added to the cached map, which is only collected while the profiler is enabled
+            // @param addRecentRegion Whether the region is added to the ring buffer of the continuous capture
+            void RegionStackPopBack(bool addCachedRegion, bool addRecentRegion);
 
             // Add a new cached time region. If the stack is empty, flush all entries to the cached map
             void AddCachedRegion(CachedTimeRegion&& timeRegionCached);
@@ -51,6 +57,12 @@ namespace AZ
             // Tries to flush the map to the passed parameter, only if the thread's mutex is unlocked
             void TryFlushCachedMap(CpuProfiler::ThreadTimeRegionMap& cachedRegionMap);
 
+            // Adds a completed region to the ring buffer of the continuous capture. Only called from the owning thread.
+            void AddRecentRegion(const CachedTimeRegion& timeRegion);
+
+            // Copies the regions of the ring buffer that ended at or after startTick. Can be called from any thread.
+            void CopyRecentRegions(AZStd::sys_time_t startTick, AZStd::vector<CachedTimeRegion>& timeRegions) const;
+
             AZStd::thread_id m_executingThreadId;
             // Keeps track of the current thread's stack depth
             uint32_t m_stackLevel = 0u;
@@ -76,6 +88,11 @@ namespace AZ
 
             // Keep track of the regions that have hit the size limit so we don't have to lock to check
             AZStd::map<AZStd::string, bool> m_hitSizeLimitMap;
+
+            // Ring buffer of the continuous capture. The owning thread is the only writer and never locks, readers detect
+            // entries that were overwritten while copying them through the write count.
+            AZStd::array<CachedTimeRegion, RecentTimeRegionCount> m_recentTimeRegions;
+            AZStd::atomic_uint64_t m_recentTimeRegionWriteCount = 0;
         };
 
         //! CpuProfiler will keep track of the registered threads, and
@@ -107,6 +124,9 @@ namespace AZ
             const TimeRegionMap& GetTimeRegionMap() const final;
             void SetProfilerEnabled(bool enabled) final;
             bool IsProfilerEnabled() const final;
+            void SetContinuousCaptureEnabled(bool enabled) final;
+            bool IsContinuousCaptureEnabled() const final;
+            RecentTimeRegionMap GetRecentTimeRegions(AZStd::sys_time_t startTick) final;
 
         private:
             // Lazily create and register the local thread data
@@ -126,6 +146,9 @@ namespace AZ
             // Enable/Disables the threads from profiling
             AZStd::atomic_bool m_enabled = false;
 
+            // Enable/Disables the threads from recording their regions in their ring buffers, see r_cpuProfilerContinuousCapture
+            AZStd::atomic_bool m_continuousCaptureEnabled = false;
+
             // This lock will only be contested when the CpuProfiler's Shutdown() method has been called
             AZStd::shared_mutex m_shutdownMutex;
 
@@ -43,6 +43,8 @@ namespace AZ
         /// Uniformly partitions the draw list and returns the sub-list denoted by the provided index.
         DrawListView GetDrawListPartition(DrawListView drawList, size_t partitionIndex, size_t partitionCount);
 
+        /// Sorts the draw list by the sort key and depth of its items in the order of the sort type.
+        /// Large draw lists are sorted with a stable radix sort.
         void SortDrawList(DrawList& drawList, DrawListSortType sortType);
     }
 }
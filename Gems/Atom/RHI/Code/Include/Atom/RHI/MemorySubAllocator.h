@@ -13,6 +13,7 @@
 #include <Atom/RHI.Reflect/MemoryEnums.h>
 
 #include <AzCore/Debug/EventTrace.h>
+#include <AzCore/std/sort.h>
 
 namespace AZ
 {
@@ -64,10 +65,16 @@ namespace AZ
 
             void DeAllocate(const_memory_allocation_reference pageView);
 
+            //! Releases the pages left unused and moves the most used pages in front of the others, so new
+            //! allocations fill them first and the sparsely used pages drain and get released over time.
             void GarbageCollect();
 
             void Shutdown();
 
+            //! Returns the fraction of the pages that would be released if the allocations were packed in as few pages
+            //! as possible, from 0 (no page to spare) to 1.
+            float ComputeFragmentation() const;
+
         private:
             page_allocator_pointer m_pageAllocator = nullptr;
             Descriptor m_descriptor;
@@ -183,6 +190,30 @@ namespace AZ
                 }
                 currentIdx++;
             }
+
+            // Most used pages first, the pages are searched in order when allocating.
+            AZStd::vector<size_t> pageOrder(m_pageContexts.size());
+            for (size_t i = 0; i < pageOrder.size(); ++i)
+            {
+                pageOrder[i] = i;
+            }
+
+            AZStd::stable_sort(pageOrder.begin(), pageOrder.end(), [this](size_t lhs, size_t rhs)
+            {
+                return m_pageContexts[lhs].m_allocator.GetAllocatedByteCount() > m_pageContexts[rhs].m_allocator.GetAllocatedByteCount();
+            });
+
+            AZStd::vector<memory_type_pointer> pages;
+            AZStd::vector<PageContext> pageContexts;
+            pages.reserve(pageOrder.size());
+            pageContexts.reserve(pageOrder.size());
+            for (size_t pageIdx : pageOrder)
+            {
+                pages.emplace_back(m_pages[pageIdx]);
+                pageContexts.emplace_back(AZStd::move(m_pageContexts[pageIdx]));
+            }
+            m_pages = AZStd::move(pages);
+            m_pageContexts = AZStd::move(pageContexts);
         }
 
         template <class Traits>
@@ -197,5 +228,24 @@ namespace AZ
             m_pageAllocator->DeAllocate(m_pages.data(), m_pages.size());
             m_pages.clear();
         }
+
+        template <class Traits>
+        float MemorySubAllocator<Traits>::ComputeFragmentation() const
+        {
+            if (m_pageContexts.empty() || m_descriptor.m_capacityInBytes == 0)
+            {
+                return 0.0f;
+            }
+
+            size_t allocatedByteCount = 0;
+            for (const PageContext& pageContext : m_pageContexts)
+            {
+                allocatedByteCount += pageContext.m_allocator.GetAllocatedByteCount();
+            }
+
+            const size_t requiredPageCount = AZStd::max<size_t>((allocatedByteCount + m_descriptor.m_capacityInBytes - 1) / m_descriptor.m_capacityInBytes, 1);
+            const size_t pageCount = m_pageContexts.size();
+            return pageCount > requiredPageCount ? static_cast<float>(pageCount - requiredPageCount) / static_cast<float>(pageCount) : 0.0f;
+        }
     }
 }
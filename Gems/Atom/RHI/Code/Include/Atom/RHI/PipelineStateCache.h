@@ -10,6 +10,8 @@
 #include <Atom/RHI/PipelineLibrary.h>
 #include <Atom/RHI/ThreadLocalContext.h>
 #include <AzCore/std/containers/bitset.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/Utils/TypeHash.h>
 
 namespace UnitTest
@@ -84,6 +86,10 @@ namespace AZ
          *      This is the fast-path case where multiple threads are now able to resolve pipeline states with very
          *      little performance overhead.
          *
+         * Pipeline states can also be acquired with AcquirePipelineStateAsync. On a cache miss the pipeline state is then compiled
+         * on a background job, and null is returned until the job has inserted the compiled pipeline state into the pending cache.
+         * This allows callers to fall back to a pipeline state that is already compiled instead of stalling on the compilation.
+         *
          * Example Usage:
          * @code{.cpp}
          *      // Create library instance.
@@ -114,6 +120,9 @@ namespace AZ
 
             static Ptr<PipelineStateCache> Create(Device& device);
 
+            /// Waits for pipeline states that are compiled on background jobs, since those jobs access the cache.
+            ~PipelineStateCache();
+
             /// Resets the caches of all pipeline libraries back to empty. All internal references to pipeline states are released.
             void Reset();
 
@@ -141,6 +150,17 @@ namespace AZ
              */
             const PipelineState* AcquirePipelineState(PipelineLibraryHandle library, const PipelineStateDescriptor& descriptor);
 
+            /**
+             * Acquires a pipeline state like AcquirePipelineState, except that a pipeline state which isn't in the cache yet is
+             * compiled on a background job instead of on the calling thread. Returns null while the job is compiling the pipeline
+             * state, so the caller can use a different pipeline state in the meantime and try again later. If no job context is
+             * available the pipeline state is compiled immediately.
+             */
+            const PipelineState* AcquirePipelineStateAsync(PipelineLibraryHandle library, const PipelineStateDescriptor& descriptor);
+
+            /// Blocks until all pipeline states that are compiled on background jobs are inserted into the cache.
+            void WaitForAsyncCompiles() const;
+
             /**
              * This method merges the global pending cache into the global read-only cache and clears all thread-local caches.
              * This reduces the total memory footprint of the caches and optimizes subsequent fetches. This method should be called
@@ -197,6 +217,9 @@ namespace AZ
                 // Tracks the number of pipeline states actively being compiled across all threads.
                 AZStd::atomic_uint32_t m_pendingCompileCount = {0};
 
+                // Hashes of the pipeline states that are compiled on background jobs. Guarded by the pending cache mutex.
+                AZStd::unordered_set<uint64_t> m_asyncCompileSet;
+
                 // Used to prime the thread libraries.
                 ConstPtr<PipelineLibraryData> m_serializedData;
             };
@@ -237,6 +260,16 @@ namespace AZ
                 const PipelineStateDescriptor& pipelineStateDescriptor,
                 PipelineStateHash pipelineStateHash);
 
+            /// Compiles the pipeline state of the entry on a background job and inserts it into the pending cache once it's done.
+            void CompilePipelineStateAsync(PipelineLibraryHandle handle, PipelineStateEntry pipelineStateEntry);
+
+            /// Returns the thread-local pipeline library, which is lazily initialized on first access. Returns null if the
+            /// library failed to initialize.
+            PipelineLibrary* GetThreadLibrary(const GlobalLibraryEntry& globalLibraryEntry, ThreadLibraryEntry& threadLibraryEntry);
+
+            /// Initializes the pipeline state with the descriptor of the matching pipeline state type.
+            ResultCode InitPipelineState(PipelineState& pipelineState, const PipelineStateDescriptor& descriptor, PipelineLibrary* pipelineLibrary);
+
             /// Resets the library without validating the handle or taking a lock.
             void ResetLibraryImpl(PipelineLibraryHandle handle);
 
@@ -249,6 +282,9 @@ namespace AZ
             /// This mutex guards library creation / reset / deletion.
             mutable AZStd::shared_mutex m_mutex;
 
+            /// The number of pipeline states that are compiled on background jobs across all libraries.
+            AZStd::atomic_uint32_t m_asyncCompileCount = {0};
+
             /// The set of library entries. The RHI::PipelineLibraryHandle maps into this array.
             GlobalLibrarySet m_globalLibrarySet;
 
@@ -52,6 +52,10 @@ namespace AZ
             //! Returns whether the group is currently queued for compilation.
             bool IsQueuedForCompile() const;
 
+            //! Returns the number of times new data was set on the group. Users can compare this against a previous
+            //! value to detect whether the group changed, without comparing the data itself.
+            uint64_t GetUpdateCount() const;
+
         protected:
             ShaderResourceGroup() = default;
 
@@ -63,6 +67,9 @@ namespace AZ
             // The binding slot cached from the layout.
             uint32_t m_bindingSlot = (uint32_t)-1;
 
+            // Incremented each time the data of the group is set.
+            uint64_t m_updateCount = 0;
+
             // Gates the Compile() function so that the SRG is only queued once.
             bool m_isQueuedForCompile = false;
         };
@@ -175,6 +175,11 @@ namespace AZ
             //! Returns the shader resource layout for this group.
             const ShaderResourceGroupLayout* GetLayout() const;
 
+            //! Returns true if both data structures use the same layout, bind the same views and samplers, and hold the
+            //! same constants. Views are compared by instance, not by the contents of their resources.
+            bool operator==(const ShaderResourceGroupData& rhs) const;
+            bool operator!=(const ShaderResourceGroupData& rhs) const;
+
         private:
             static const ConstPtr<ImageView> s_nullImageView;
             static const ConstPtr<BufferView> s_nullBufferView;
@@ -23,8 +23,13 @@ namespace AZ
          */
         struct StreamingImageSubresourceData
         {
-            /// Data to upload for this subresource. Format must match format of the image including block / row size.
+            /// Data to upload for this subresource. Format must match format of the image including block / row size,
+            /// unless the mip slice is compressed, in which case the data is decompressed by the pool first.
             const void* m_data = nullptr;
+
+            /// The size of m_data in bytes if the mip slice is compressed. Unused for uncompressed data as the size
+            /// follows from the subresource layout.
+            size_t m_compressedSize = 0;
         };
 
         /**
@@ -37,6 +42,10 @@ namespace AZ
 
             /// The layout of each image in the array.
             ImageSubresourceLayout m_subresourceLayout;
+
+            /// The compression applied to the subresource data. Compressed data can only be used with pools
+            /// that report support for the compression through StreamingImagePool::IsCompressionSupported.
+            StreamingImageCompression m_compression = StreamingImageCompression::None;
         };
         
         using CompleteCallback = AZStd::function<void()>;
@@ -119,6 +128,14 @@ namespace AZ
              */
             ResultCode TrimImage(Image& image, uint32_t targetMipLevel);
 
+            /**
+             * Returns whether the pool can take mip slices with the given compression. Compressed
+             * mip slices are uploaded as is and decompressed on the GPU before they're copied into
+             * the image, which reduces the amount of data transferred. Callers are expected to
+             * decompress the data on the CPU if the compression isn't supported.
+             */
+            bool IsCompressionSupported(StreamingImageCompression compression) const;
+
             const StreamingImagePoolDescriptor& GetDescriptor() const override final;
 
         protected:
@@ -130,6 +147,7 @@ namespace AZ
 
             bool ValidateInitRequest(const StreamingImageInitRequest& initRequest) const;
             bool ValidateExpandRequest(const StreamingImageExpandRequest& expandRequest) const;
+            bool ValidateMipSliceCompression(AZStd::array_view<StreamingImageMipSlice> mipSlices) const;
 
             //////////////////////////////////////////////////////////////////////////
             // Platform API
@@ -146,6 +164,9 @@ namespace AZ
             /// Called when an image mips are being trimmed.
             virtual ResultCode TrimImageInternal(Image& image, uint32_t targetMipLevel);
 
+            /// Called to check if the platform can decompress mip slices with the given compression on the GPU.
+            virtual bool IsCompressionSupportedInternal(StreamingImageCompression compression) const;
+
             //////////////////////////////////////////////////////////////////////////
 
             StreamingImagePoolDescriptor m_descriptor;
@@ -12,6 +12,7 @@
 #include <Atom/RHI.Reflect/TransientBufferDescriptor.h>
 #include <Atom/RHI.Reflect/TransientImageDescriptor.h>
 #include <Atom/RHI/MemoryStatisticsBuilder.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Debug/EventTrace.h>
 #include <AzCore/std/sort.h>
 
@@ -19,20 +20,50 @@ namespace AZ
 {
     namespace RHI
     {
+        AZ_CVAR(bool, r_transientAttachmentPlacement, true, nullptr, ConsoleFunctorFlags::Null,
+            "Place transient attachments from their lifetimes in the previous frame instead of in scope order.");
+
         void AliasedHeap::Begin(TransientAttachmentPoolCompileFlags compileFlags)
         {
             m_totalAllocations = 0;
             m_compileFlags = compileFlags;
             m_heapStats.m_watermarkSize = 0;
             m_heapStats.m_attachments.clear();
+            m_placementRequests.clear();
             m_barrierTracker->Reset();
+
+            if (m_placementSize > 0)
+            {
+                // The allocator is empty so the reservation lands at the bottom of the heap, where the placement starts.
+                m_placementReservation = m_firstFitAllocator.Allocate(m_placementSize, m_descriptor.m_alignment);
+                if (m_placementReservation.IsNull() || m_placementReservation.m_ptr != 0)
+                {
+                    if (m_placementReservation.IsValid())
+                    {
+                        m_firstFitAllocator.DeAllocate(m_placementReservation);
+                        m_firstFitAllocator.GarbageCollectForce();
+                    }
+                    m_placementReservation = VirtualAddress::CreateNull();
+                    m_placedAttachments.clear();
+                    m_placementSize = 0;
+                }
+            }
         }
 
         void AliasedHeap::End()
         {
+            if (m_placementReservation.IsValid())
+            {
+                m_firstFitAllocator.DeAllocate(m_placementReservation);
+                m_firstFitAllocator.GarbageCollectForce();
+                m_placementReservation = VirtualAddress::CreateNull();
+            }
+
             AZ_Assert(m_activeAttachmentLookup.empty() && m_firstFitAllocator.GetAllocationCount() == 0,
                 "There are still active allocations.");
 
+            UpdatePlacement();
+
             if (RHI::CheckBitsAny(m_compileFlags, TransientAttachmentPoolCompileFlags::GatherStatistics))
             {
                 AZStd::sort(m_heapStats.m_attachments.begin(), m_heapStats.m_attachments.end(),
@@ -51,6 +82,81 @@ namespace AZ
             m_barrierTracker->End();
         }
 
+        VirtualAddress AliasedHeap::AllocateInternal(
+            const AttachmentId& attachmentId, const ResourceMemoryRequirements& memRequirements, bool& placed)
+        {
+            placed = false;
+            auto placedIter = m_placedAttachments.find(attachmentId);
+            if (placedIter != m_placedAttachments.end() &&
+                placedIter->second.m_sizeInBytes == memRequirements.m_sizeInBytes &&
+                (memRequirements.m_alignmentInBytes == 0 || placedIter->second.m_heapOffset % memRequirements.m_alignmentInBytes == 0))
+            {
+                // Attachments activated in a different order than the placement was computed for may be alive at the same time.
+                const size_t heapOffsetMin = placedIter->second.m_heapOffset;
+                const size_t heapOffsetMax = heapOffsetMin + placedIter->second.m_sizeInBytes - 1;
+                placed = true;
+                for (const auto& activeAttachment : m_activeAttachmentLookup)
+                {
+                    const TransientAttachmentStatistics::Attachment& attachment =
+                        m_heapStats.m_attachments[activeAttachment.second.m_attachmentIndex];
+                    if (activeAttachment.second.m_placed &&
+                        attachment.m_heapOffsetMin <= heapOffsetMax && heapOffsetMin <= attachment.m_heapOffsetMax)
+                    {
+                        placed = false;
+                        break;
+                    }
+                }
+
+                if (placed)
+                {
+                    return VirtualAddress::CreateFromOffset(heapOffsetMin);
+                }
+            }
+
+            return m_firstFitAllocator.Allocate(memRequirements.m_sizeInBytes, memRequirements.m_alignmentInBytes);
+        }
+
+        void AliasedHeap::UpdatePlacement()
+        {
+            if (!r_transientAttachmentPlacement)
+            {
+                m_placedAttachments.clear();
+                m_placementSize = 0;
+                m_placementHash = 0;
+                return;
+            }
+
+            size_t hash = 0;
+            for (const AliasedHeapPlacementRequest& request : m_placementRequests)
+            {
+                AZStd::hash_combine(hash, request.m_attachmentId.GetHash(), request.m_sizeInBytes, request.m_alignmentInBytes,
+                    request.m_scopeIndexFirst, request.m_scopeIndexLast);
+            }
+
+            // The graph rarely changes between frames, only compute a placement when it does.
+            if (hash == m_placementHash)
+            {
+                return;
+            }
+            m_placementHash = hash;
+            m_placedAttachments.clear();
+            m_placementSize = 0;
+
+            AZStd::vector<size_t> heapOffsets;
+            const size_t placementSize = PlaceAliasedHeapResources(m_placementRequests, heapOffsets);
+
+            // Only keep the placement when it needs less memory than the allocations of this frame.
+            if (placementSize < m_heapStats.m_watermarkSize)
+            {
+                for (size_t i = 0; i < m_placementRequests.size(); ++i)
+                {
+                    m_placedAttachments[m_placementRequests[i].m_attachmentId] =
+                        PlacedAttachment{ heapOffsets[i], m_placementRequests[i].m_sizeInBytes };
+                }
+                m_placementSize = placementSize;
+            }
+        }
+
         RHI::ResultCode AliasedHeap::Init(Device& device, const AliasedHeapDescriptor& descriptor)
         {
             return Base::Init(
@@ -105,8 +211,8 @@ namespace AZ
         {
             ResourceMemoryRequirements memRequirements = GetDevice().GetResourceMemoryRequirements(descriptor.m_bufferDescriptor);
             
-            const size_t alignmentInBytes = memRequirements.m_alignmentInBytes;
-            RHI::VirtualAddress address = m_firstFitAllocator.Allocate(memRequirements.m_sizeInBytes, alignmentInBytes);
+            bool placed = false;
+            RHI::VirtualAddress address = AllocateInternal(descriptor.m_attachmentId, memRequirements, placed);
             if (address.IsNull())
             {
                 return ResultCode::OutOfMemory;
@@ -157,8 +263,10 @@ namespace AZ
             }
 
             const uint32_t attachmentIndex = static_cast<uint32_t>(m_heapStats.m_attachments.size());
-            m_activeAttachmentLookup.emplace(descriptor.m_attachmentId, AttachmentData{ buffer, attachmentIndex, &scope });
+            m_activeAttachmentLookup.emplace(descriptor.m_attachmentId, AttachmentData{ buffer, attachmentIndex, &scope, placed });
             m_heapStats.m_attachments.emplace_back();
+            m_placementRequests.push_back(AliasedHeapPlacementRequest{
+                descriptor.m_attachmentId, memRequirements.m_sizeInBytes, memRequirements.m_alignmentInBytes, scope.GetIndex(), scope.GetIndex() });
 
             RHI::TransientAttachmentStatistics::Attachment& attachment = m_heapStats.m_attachments.back();
             attachment.m_heapOffsetMin = heapOffsetInBytes;
@@ -194,6 +302,7 @@ namespace AZ
 
             TransientAttachmentStatistics::Attachment& attachment = m_heapStats.m_attachments[attachmentData.m_attachmentIndex];
             attachment.m_scopeOffsetMax = scope.GetIndex();
+            m_placementRequests[attachmentData.m_attachmentIndex].m_scopeIndexLast = scope.GetIndex();
 
             if (!CheckBitsAny(m_compileFlags, TransientAttachmentPoolCompileFlags::DontAllocateResources))
             {
@@ -209,9 +318,13 @@ namespace AZ
                 m_barrierTracker->AddResource(aliasedResource);
             }
             
-            const VirtualAddress heapAddress{attachment.m_heapOffsetMin};
-            m_firstFitAllocator.DeAllocate(heapAddress);
-            m_firstFitAllocator.GarbageCollectForce();
+            // Placed attachments live in the reserved range, which is released at the end of the frame.
+            if (!attachmentData.m_placed)
+            {
+                const VirtualAddress heapAddress{attachment.m_heapOffsetMin};
+                m_firstFitAllocator.DeAllocate(heapAddress);
+                m_firstFitAllocator.GarbageCollectForce();
+            }
             m_activeAttachmentLookup.erase(findIter);
         }
 
@@ -219,7 +332,8 @@ namespace AZ
         {
             ResourceMemoryRequirements memRequirements = GetDevice().GetResourceMemoryRequirements(descriptor.m_imageDescriptor);
 
-            VirtualAddress address = m_firstFitAllocator.Allocate(memRequirements.m_sizeInBytes, memRequirements.m_alignmentInBytes);
+            bool placed = false;
+            VirtualAddress address = AllocateInternal(descriptor.m_attachmentId, memRequirements, placed);
             if (address.IsNull())
             {
                 return ResultCode::OutOfMemory;
@@ -272,8 +386,10 @@ namespace AZ
             const size_t sizeInBytes = memRequirements.m_sizeInBytes;
 
             const uint32_t attachmentIndex = static_cast<uint32_t>(m_heapStats.m_attachments.size());
-            m_activeAttachmentLookup.emplace(descriptor.m_attachmentId, AttachmentData{ image, attachmentIndex, &scope });
+            m_activeAttachmentLookup.emplace(descriptor.m_attachmentId, AttachmentData{ image, attachmentIndex, &scope, placed });
             m_heapStats.m_attachments.emplace_back();
+            m_placementRequests.push_back(AliasedHeapPlacementRequest{
+                descriptor.m_attachmentId, sizeInBytes, memRequirements.m_alignmentInBytes, scope.GetIndex(), scope.GetIndex() });
 
             RHI::TransientAttachmentStatistics::Attachment& attachment = m_heapStats.m_attachments.back();
             attachment.m_heapOffsetMin = heapOffsetInBytes;
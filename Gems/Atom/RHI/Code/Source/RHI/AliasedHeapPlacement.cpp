@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#include <Atom/RHI/AliasedHeapPlacement.h>
+#include <Atom/RHI/interval_map.h>
+#include <Atom/RHI.Reflect/Bits.h>
+#include <AzCore/std/sort.h>
+
+namespace AZ
+{
+    namespace RHI
+    {
+        size_t PlaceAliasedHeapResources(AZStd::array_view<AliasedHeapPlacementRequest> requests, AZStd::vector<size_t>& heapOffsets)
+        {
+            heapOffsets.assign(requests.size(), 0);
+
+            AZStd::vector<uint32_t> order(requests.size());
+            for (uint32_t i = 0; i < order.size(); ++i)
+            {
+                order[i] = i;
+            }
+
+            AZStd::sort(order.begin(), order.end(), [&requests](uint32_t lhs, uint32_t rhs)
+            {
+                if (requests[lhs].m_sizeInBytes != requests[rhs].m_sizeInBytes)
+                {
+                    return requests[lhs].m_sizeInBytes > requests[rhs].m_sizeInBytes;
+                }
+                return lhs < rhs;
+            });
+
+            size_t heapSize = 0;
+            AZStd::vector<uint32_t> placed;
+            placed.reserve(requests.size());
+            for (uint32_t index : order)
+            {
+                const AliasedHeapPlacementRequest& request = requests[index];
+
+                // Heap ranges used by the placed resources that are alive at the same time, merged into disjoint intervals.
+                interval_map<size_t, bool> usedRanges;
+                for (uint32_t placedIndex : placed)
+                {
+                    const AliasedHeapPlacementRequest& other = requests[placedIndex];
+                    if (other.m_scopeIndexFirst <= request.m_scopeIndexLast && request.m_scopeIndexFirst <= other.m_scopeIndexLast)
+                    {
+                        usedRanges.assign(heapOffsets[placedIndex], heapOffsets[placedIndex] + other.m_sizeInBytes, true);
+                    }
+                }
+
+                // Lowest gap large enough for the resource.
+                size_t heapOffset = 0;
+                for (auto it = usedRanges.begin(); it != usedRanges.end(); ++it)
+                {
+                    if (heapOffset + request.m_sizeInBytes <= it.interval_begin())
+                    {
+                        break;
+                    }
+                    heapOffset = AZStd::max(heapOffset, AlignUp(it.interval_end(), AZStd::max<size_t>(request.m_alignmentInBytes, 1)));
+                }
+
+                heapOffsets[index] = heapOffset;
+                heapSize = AZStd::max(heapSize, heapOffset + request.m_sizeInBytes);
+                placed.push_back(index);
+            }
+
+            return heapSize;
+        }
+    }
+}
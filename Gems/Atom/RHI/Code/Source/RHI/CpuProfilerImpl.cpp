@@ -7,6 +7,8 @@
 
 #include <Atom/RHI/CpuProfilerImpl.h>
 
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Interface/Interface.h>
 #include <AzCore/std/smart_ptr/shared_ptr.h>
 
@@ -17,6 +19,20 @@ namespace AZ
 {
     namespace RHI
     {
+        AZ_CVAR(bool,
+            r_cpuProfilerContinuousCapture,
+            true,
+            [](const bool& enable)
+            {
+                if (CpuProfiler* cpuProfiler = CpuProfiler::Get())
+                {
+                    cpuProfiler->SetContinuousCaptureEnabled(enable);
+                }
+            },
+            ConsoleFunctorFlags::Null,
+            "Keeps the most recent time regions of every thread in a ring buffer, so they can be exported after a hitch occurred."
+        );
+
         thread_local CpuTimingLocalStorage* CpuProfilerImpl::ms_threadLocalStorage = nullptr;
 
         // --- CpuProfiler ---
@@ -79,6 +95,7 @@ namespace AZ
         {
             Interface<CpuProfiler>::Register(this);
             m_initialized = true;
+            m_continuousCaptureEnabled = static_cast<bool>(r_cpuProfilerContinuousCapture);
             Device* rhiDevice = GetRHIDevice().get();
             FrameEventBus::Handler::BusConnect(rhiDevice);
         }
@@ -96,6 +113,7 @@ namespace AZ
             AZStd::unique_lock<AZStd::shared_mutex> shutdownLock(m_shutdownMutex);
 
             m_enabled = false;
+            m_continuousCaptureEnabled = false;
 
             // Cleanup all TLS
             m_registeredThreads.clear();
@@ -109,7 +127,7 @@ namespace AZ
             // Try to lock here, the shutdownMutex will only be contested when the CpuProfiler is shutting down.
             if (m_shutdownMutex.try_lock_shared())
             {
-                if (m_enabled)
+                if (m_enabled || m_continuousCaptureEnabled)
                 {
                     // Lazy initialization, creates an instance of the Thread local data if it's not created, and registers it
                     RegisterThreadStorage();
@@ -127,9 +145,9 @@ namespace AZ
             // Try to lock here, the shutdownMutex will only be contested when the CpuProfiler is shutting down.
             if (m_shutdownMutex.try_lock_shared())
             {
-                if (m_enabled)
+                if ((m_enabled || m_continuousCaptureEnabled) && ms_threadLocalStorage)
                 {
-                    ms_threadLocalStorage->RegionStackPopBack();
+                    ms_threadLocalStorage->RegionStackPopBack(m_enabled, m_continuousCaptureEnabled);
                 }
 
                 m_shutdownMutex.unlock_shared();
@@ -173,6 +191,45 @@ namespace AZ
             return m_enabled;
         }
 
+        void CpuProfilerImpl::SetContinuousCaptureEnabled(bool enabled)
+        {
+            AZStd::unique_lock<AZStd::mutex> lock(m_threadRegisterMutex);
+
+            if (m_continuousCaptureEnabled == enabled)
+            {
+                return;
+            }
+
+            // The region stacks weren't maintained while nothing was recorded, so clear them like
+            // SetProfilerEnabled does
+            if (enabled && !m_enabled)
+            {
+                for (auto& threadLocal : m_registeredThreads)
+                {
+                    threadLocal->m_clearContainers = true;
+                }
+            }
+
+            m_continuousCaptureEnabled = enabled;
+        }
+
+        bool CpuProfilerImpl::IsContinuousCaptureEnabled() const
+        {
+            return m_continuousCaptureEnabled;
+        }
+
+        CpuProfiler::RecentTimeRegionMap CpuProfilerImpl::GetRecentTimeRegions(AZStd::sys_time_t startTick)
+        {
+            AZStd::unique_lock<AZStd::mutex> lock(m_threadRegisterMutex);
+
+            RecentTimeRegionMap recentTimeRegions;
+            for (auto& threadLocal : m_registeredThreads)
+            {
+                threadLocal->CopyRecentRegions(startTick, recentTimeRegions[threadLocal->m_executingThreadId]);
+            }
+            return recentTimeRegions;
+        }
+
         void CpuProfilerImpl::OnFrameBegin()
         {
             if (!m_enabled)
@@ -246,7 +303,7 @@ namespace AZ
             timeRegion.m_startTick = AZStd::GetTimeNowTicks();
         }
 
-        void CpuTimingLocalStorage::RegionStackPopBack()
+        void CpuTimingLocalStorage::RegionStackPopBack(bool addCachedRegion, bool addRecentRegion)
         {
             // Early out when the stack is empty, this might happen when the profiler was enabled while the thread encountered profiling markers
             if (m_timeRegionStack.empty())
@@ -267,8 +324,17 @@ namespace AZ
             // Decrement the stack
             m_stackLevel--;
 
+            const CachedTimeRegion cachedTimeRegion(back->m_groupRegionName, back->m_stackDepth, back->m_startTick, back->m_endTick);
+            if (addRecentRegion)
+            {
+                AddRecentRegion(cachedTimeRegion);
+            }
+
             // Add an entry to the cached region
-            AddCachedRegion(CachedTimeRegion(back->m_groupRegionName, back->m_stackDepth, back->m_startTick, back->m_endTick));
+            if (addCachedRegion)
+            {
+                AddCachedRegion(CachedTimeRegion(cachedTimeRegion));
+            }
         }
 
         // Gets called when region ends and all data is set
@@ -323,5 +389,44 @@ namespace AZ
                 m_cachedTimeRegionMutex.unlock();
             }
         }
+
+        void CpuTimingLocalStorage::AddRecentRegion(const CachedTimeRegion& timeRegion)
+        {
+            // Only the owning thread writes, so the count can be published without a read-modify-write
+            const uint64_t writeCount = m_recentTimeRegionWriteCount.load(AZStd::memory_order_relaxed);
+            m_recentTimeRegions[writeCount % RecentTimeRegionCount] = timeRegion;
+            m_recentTimeRegionWriteCount.store(writeCount + 1, AZStd::memory_order_release);
+        }
+
+        void CpuTimingLocalStorage::CopyRecentRegions(AZStd::sys_time_t startTick, AZStd::vector<CachedTimeRegion>& timeRegions) const
+        {
+            const uint64_t writeCount = m_recentTimeRegionWriteCount.load(AZStd::memory_order_acquire);
+            const uint64_t firstIndex = writeCount > RecentTimeRegionCount ? writeCount - RecentTimeRegionCount : 0;
+
+            AZStd::vector<CachedTimeRegion> copiedRegions;
+            copiedRegions.reserve(writeCount - firstIndex);
+            for (uint64_t index = firstIndex; index < writeCount; ++index)
+            {
+                copiedRegions.push_back(m_recentTimeRegions[index % RecentTimeRegionCount]);
+            }
+
+            // The owning thread keeps writing while the regions are copied. Drop the oldest entries, which might have been
+            // overwritten in the meantime, including the one that might be written right now.
+            AZStd::atomic_thread_fence(AZStd::memory_order_acquire);
+            const uint64_t newWriteCount = m_recentTimeRegionWriteCount.load(AZStd::memory_order_relaxed);
+            const uint64_t firstValidIndex = newWriteCount + 1 > RecentTimeRegionCount ? newWriteCount + 1 - RecentTimeRegionCount : 0;
+            const size_t overwrittenCount = firstValidIndex > firstIndex
+                ? AZStd::min(aznumeric_cast<size_t>(firstValidIndex - firstIndex), copiedRegions.size())
+                : 0;
+
+            timeRegions.reserve(timeRegions.size() + copiedRegions.size() - overwrittenCount);
+            for (size_t index = overwrittenCount; index < copiedRegions.size(); ++index)
+            {
+                if (copiedRegions[index].m_endTick >= startTick)
+                {
+                    timeRegions.push_back(copiedRegions[index]);
+                }
+            }
+        }
     }
 }
@@ -6,6 +6,8 @@
  */
 #include <Atom/RHI/DrawList.h>
 
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/std/containers/array.h>
 #include <AzCore/std/sort.h>
 
 namespace AZ
@@ -25,57 +27,172 @@ namespace AZ
             return DrawListView(&drawList[itemOffset], itemCount);
         }
 
-        void SortDrawList(DrawList& drawList, DrawListSortType sortType)
+        namespace
         {
-            switch (sortType)
+            // Draw lists with fewer items are sorted with a comparison sort, since the radix passes over the
+            // histograms are more expensive than sorting a handful of items.
+            constexpr size_t RadixSortItemCountMin = 256;
+
+            // Sort key with the most significant value in m_high, packed so unsigned comparisons of the
+            // key match the order of the sort type.
+            struct RadixSortKey
             {
-            case DrawListSortType::KeyThenDepth:
-                AZStd::sort(drawList.begin(), drawList.end(), [](const DrawItemProperties& a, const DrawItemProperties& b)
-                    {
-                        if (a.m_sortKey != b.m_sortKey)
+                uint64_t m_high;
+                uint64_t m_low;
+            };
+
+            uint64_t GetOrderedSortKey(DrawItemSortKey sortKey)
+            {
+                // Flipping the sign bit maps signed values to unsigned values with the same order.
+                return static_cast<uint64_t>(sortKey) ^ (uint64_t{ 1 } << 63);
+            }
+
+            uint32_t GetOrderedDepth(float depth)
+            {
+                // Flipping the sign bit of positive values and all bits of negative values maps floats to
+                // unsigned values with the same order.
+                uint32_t bits;
+                memcpy(&bits, &depth, sizeof(bits));
+                return bits ^ ((bits & 0x80000000u) ? 0xFFFFFFFFu : 0x80000000u);
+            }
+
+            RadixSortKey GetRadixSortKey(const DrawItemProperties& drawItem, DrawListSortType sortType)
+            {
+                switch (sortType)
+                {
+                case DrawListSortType::KeyThenDepth:
+                    return { GetOrderedSortKey(drawItem.m_sortKey), GetOrderedDepth(drawItem.m_depth) };
+                case DrawListSortType::KeyThenReverseDepth:
+                    return { GetOrderedSortKey(drawItem.m_sortKey), static_cast<uint32_t>(~GetOrderedDepth(drawItem.m_depth)) };
+                case DrawListSortType::DepthThenKey:
+                    return { GetOrderedDepth(drawItem.m_depth), GetOrderedSortKey(drawItem.m_sortKey) };
+                case DrawListSortType::ReverseDepthThenKey:
+                    return { static_cast<uint32_t>(~GetOrderedDepth(drawItem.m_depth)), GetOrderedSortKey(drawItem.m_sortKey) };
+                }
+                return { 0, 0 };
+            }
+
+            uint32_t GetRadixDigit(const RadixSortKey& key, size_t digitIndex)
+            {
+                const uint64_t value = digitIndex < sizeof(uint64_t) ? key.m_low : key.m_high;
+                return static_cast<uint32_t>(value >> ((digitIndex % sizeof(uint64_t)) * 8)) & 0xFF;
+            }
+
+            void ComparisonSortDrawList(DrawList& drawList, DrawListSortType sortType)
+            {
+                switch (sortType)
+                {
+                case DrawListSortType::KeyThenDepth:
+                    AZStd::sort(drawList.begin(), drawList.end(), [](const DrawItemProperties& a, const DrawItemProperties& b)
+                        {
+                            if (a.m_sortKey != b.m_sortKey)
+                            {
+                                return a.m_sortKey < b.m_sortKey;
+                            }
+                            return a.m_depth < b.m_depth;
+                        }
+                    );
+                    break;
+
+                case DrawListSortType::KeyThenReverseDepth:
+                    AZStd::sort(drawList.begin(), drawList.end(), [](const DrawItemProperties& a, const DrawItemProperties& b)
+                        {
+                            if (a.m_sortKey != b.m_sortKey)
+                            {
+                                return a.m_sortKey < b.m_sortKey;
+                            }
+                            return a.m_depth > b.m_depth;
+                        }
+                    );
+                    break;
+
+                case DrawListSortType::DepthThenKey:
+                    AZStd::sort(drawList.begin(), drawList.end(), [](const DrawItemProperties& a, const DrawItemProperties& b)
                         {
+                            if (a.m_depth != b.m_depth)
+                            {
+                                return a.m_depth < b.m_depth;
+                            }
                             return a.m_sortKey < b.m_sortKey;
                         }
-                        return a.m_depth < b.m_depth;
-                    }
-                );
-                break;
+                    );
+                    break;
 
-            case DrawListSortType::KeyThenReverseDepth:
-                AZStd::sort(drawList.begin(), drawList.end(), [](const DrawItemProperties& a, const DrawItemProperties& b)
-                    {
-                        if (a.m_sortKey != b.m_sortKey)
+                case DrawListSortType::ReverseDepthThenKey:
+                    AZStd::sort(drawList.begin(), drawList.end(), [](const DrawItemProperties& a, const DrawItemProperties& b)
                         {
+                            if (a.m_depth != b.m_depth)
+                            {
+                                return a.m_depth > b.m_depth;
+                            }
                             return a.m_sortKey < b.m_sortKey;
                         }
-                        return a.m_depth > b.m_depth;
+                    );
+                    break;
+                }
+            }
+
+            // Stable least significant digit radix sort with 8 bit digits. Digits that are the same for every item,
+            // such as the upper bytes of small sort keys, are skipped.
+            void RadixSortDrawList(DrawList& drawList, DrawListSortType sortType)
+            {
+                constexpr size_t DigitCount = sizeof(RadixSortKey);
+                constexpr size_t BucketCount = 256;
+
+                AZStd::array<AZStd::array<uint32_t, BucketCount>, DigitCount> histograms = {};
+                for (const DrawItemProperties& drawItem : drawList)
+                {
+                    const RadixSortKey key = GetRadixSortKey(drawItem, sortType);
+                    for (size_t digitIndex = 0; digitIndex < DigitCount; ++digitIndex)
+                    {
+                        ++histograms[digitIndex][GetRadixDigit(key, digitIndex)];
                     }
-                );
-                break;
+                }
 
-            case DrawListSortType::DepthThenKey:
-                AZStd::sort(drawList.begin(), drawList.end(), [](const DrawItemProperties& a, const DrawItemProperties& b)
+                const uint32_t itemCount = aznumeric_cast<uint32_t>(drawList.size());
+                DrawList scratchList(drawList.size());
+                DrawList* sourceList = &drawList;
+                DrawList* destinationList = &scratchList;
+                for (size_t digitIndex = 0; digitIndex < DigitCount; ++digitIndex)
+                {
+                    AZStd::array<uint32_t, BucketCount>& histogram = histograms[digitIndex];
+                    if (histogram[GetRadixDigit(GetRadixSortKey(sourceList->front(), sortType), digitIndex)] == itemCount)
                     {
-                        if (a.m_depth != b.m_depth)
-                        {
-                            return a.m_depth < b.m_depth;
-                        }
-                        return a.m_sortKey < b.m_sortKey;
+                        continue;
                     }
-                );
-                break;
 
-            case DrawListSortType::ReverseDepthThenKey:
-                AZStd::sort(drawList.begin(), drawList.end(), [](const DrawItemProperties& a, const DrawItemProperties& b)
+                    uint32_t offset = 0;
+                    for (uint32_t& bucket : histogram)
                     {
-                        if (a.m_depth != b.m_depth)
-                        {
-                            return a.m_depth > b.m_depth;
-                        }
-                        return a.m_sortKey < b.m_sortKey;
+                        const uint32_t count = bucket;
+                        bucket = offset;
+                        offset += count;
                     }
-                );
-                break;
+
+                    for (const DrawItemProperties& drawItem : *sourceList)
+                    {
+                        const uint32_t digit = GetRadixDigit(GetRadixSortKey(drawItem, sortType), digitIndex);
+                        (*destinationList)[histogram[digit]++] = drawItem;
+                    }
+                    AZStd::swap(sourceList, destinationList);
+                }
+
+                if (sourceList != &drawList)
+                {
+                    drawList.swap(scratchList);
+                }
+            }
+        }
+
+        void SortDrawList(DrawList& drawList, DrawListSortType sortType)
+        {
+            if (drawList.size() < RadixSortItemCountMin)
+            {
+                ComparisonSortDrawList(drawList, sortType);
+            }
+            else
+            {
+                RadixSortDrawList(drawList, sortType);
             }
         }
     }
@@ -24,6 +24,7 @@
 #include <Atom/RHI/ResourcePoolDatabase.h>
 #include <Atom/RHI/RayTracingShaderTable.h>
 
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Debug/EventTrace.h>
 #include <AzCore/Jobs/Algorithms.h>
 #include <AzCore/Jobs/JobCompletion.h>
@@ -33,6 +34,34 @@ namespace AZ
 {
     namespace RHI
     {
+        AZ_CVAR(bool, r_reportTransientAttachmentMemory, false, nullptr, ConsoleFunctorFlags::Null,
+            "Log the transient memory used by each transient attachment heap and attachment every frame.");
+
+        namespace
+        {
+            void ReportTransientAttachmentMemory(const TransientAttachmentStatistics& statistics)
+            {
+                constexpr double MegaByte = 1024.0 * 1024.0;
+
+                size_t totalWatermark = 0;
+                for (const TransientAttachmentStatistics::Heap& heap : statistics.m_heaps)
+                {
+                    totalWatermark += heap.m_watermarkSize;
+                }
+                AZ_Printf("RHI", "Transient attachment memory: %.2f MB peak over %zu heaps\n", totalWatermark / MegaByte, statistics.m_heaps.size());
+
+                for (const TransientAttachmentStatistics::Heap& heap : statistics.m_heaps)
+                {
+                    AZ_Printf("RHI", "  Heap %s: %.2f MB peak of %.2f MB\n", heap.m_name.GetCStr(), heap.m_watermarkSize / MegaByte, heap.m_heapSize / MegaByte);
+                    for (const TransientAttachmentStatistics::Attachment& attachment : heap.m_attachments)
+                    {
+                        AZ_Printf("RHI", "    %s: %.2f MB at offset %zu, scopes %zu to %zu\n", attachment.m_id.GetCStr(),
+                            attachment.m_sizeInBytes / MegaByte, attachment.m_heapOffsetMin, attachment.m_scopeOffsetMin, attachment.m_scopeOffsetMax);
+                    }
+                }
+            }
+        }
+
         ResultCode FrameScheduler::Init(Device& device, const FrameSchedulerDescriptor& descriptor)
         {
             ResultCode resultCode = ResultCode::Success;
@@ -176,6 +205,12 @@ namespace AZ
 
             m_compileRequest = compileRequest;
 
+            const bool reportTransientAttachmentMemory = r_reportTransientAttachmentMemory && m_transientAttachmentPool;
+            if (reportTransientAttachmentMemory)
+            {
+                m_compileRequest.m_statisticsFlags |= FrameSchedulerStatisticsFlags::GatherTransientAttachmentStatistics;
+            }
+
             {
                 AZ_ATOM_PROFILE_TIME_GROUP_REGION("RHI", "FrameScheduler: Compile: OnFrameCompile");
                 FrameEventBus::Broadcast(&FrameEventBus::Events::OnFrameCompile);
@@ -186,11 +221,16 @@ namespace AZ
             frameGraphCompileRequest.m_transientAttachmentPool = m_transientAttachmentPool.get();
             frameGraphCompileRequest.m_logVerbosity = compileRequest.m_logVerbosity;
             frameGraphCompileRequest.m_compileFlags = compileRequest.m_compileFlags;
-            frameGraphCompileRequest.m_statisticsFlags = compileRequest.m_statisticsFlags;
+            frameGraphCompileRequest.m_statisticsFlags = m_compileRequest.m_statisticsFlags;
 
             const MessageOutcome outcome = m_frameGraphCompiler->Compile(frameGraphCompileRequest);
             if (outcome.IsSuccess())
             {
+                if (reportTransientAttachmentMemory)
+                {
+                    ReportTransientAttachmentMemory(m_transientAttachmentPool->GetStatistics());
+                }
+
                 {
                     AZ_ATOM_PROFILE_TIME_GROUP_REGION("RHI", "FrameScheduler: Compile: OnFrameCompileEnd");
                     FrameEventBus::Broadcast(&FrameEventBus::Events::OnFrameCompileEnd, *m_frameGraph);
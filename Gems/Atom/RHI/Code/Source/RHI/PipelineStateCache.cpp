@@ -7,6 +7,8 @@
 
 #include <Atom/RHI/PipelineStateCache.h>
 #include <Atom/RHI/Factory.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/std/sort.h>
 #include <AzCore/std/parallel/exponential_backoff.h>
 
@@ -23,6 +25,20 @@ namespace AZ
             : m_device{&device}
         {}
 
+        PipelineStateCache::~PipelineStateCache()
+        {
+            WaitForAsyncCompiles();
+        }
+
+        void PipelineStateCache::WaitForAsyncCompiles() const
+        {
+            AZStd::exponential_backoff backoff;
+            while (m_asyncCompileCount > 0)
+            {
+                backoff.wait();
+            }
+        }
+
         void PipelineStateCache::ValidateCacheIntegrity() const
         {
 #if defined(AZ_ENABLE_TRACING)
@@ -64,6 +80,7 @@ namespace AZ
 
         void PipelineStateCache::Reset()
         {
+            WaitForAsyncCompiles();
             AZStd::unique_lock<AZStd::shared_mutex> lock(m_mutex);
 
             for (size_t i = 0; i < m_globalLibrarySet.size(); ++i)
@@ -115,6 +132,8 @@ namespace AZ
         {
             if (handle.IsValid())
             {
+                // Background compiles insert into the library, so they have to finish before it's released.
+                WaitForAsyncCompiles();
                 AZStd::unique_lock<AZStd::shared_mutex> lock(m_mutex);
                 AZ_Assert(m_globalLibraryActiveBits[handle.GetIndex()], "Releasing a library that is no longer valid.");
 
@@ -133,6 +152,7 @@ namespace AZ
         {
             if (handle.IsValid())
             {
+                WaitForAsyncCompiles();
                 AZStd::unique_lock<AZStd::shared_mutex> lock(m_mutex);
                 ResetLibraryImpl(handle);
             }
@@ -153,6 +173,7 @@ namespace AZ
             libraryEntry.m_readOnlyCache.clear();
             libraryEntry.m_pendingCacheMutex.lock();
             libraryEntry.m_pendingCache.clear();
+            libraryEntry.m_asyncCompileSet.clear();
             libraryEntry.m_pendingCacheMutex.unlock();
         }
 
@@ -301,21 +322,6 @@ namespace AZ
                 // No entry in the thread-local set. Request a pipeline state from the pending cache and add
                 // it to the thread-local cache to reduce contention on the pending cache.
                 {
-                    // Lazy-init the library on first access.
-                    if (!threadLibraryEntry.m_library)
-                    {
-                        Ptr<PipelineLibrary> pipelineLibrary = Factory::Get().CreatePipelineLibrary();
-                        RHI::ResultCode resultCode = pipelineLibrary->Init(*m_device, globalLibraryEntry.m_serializedData.get());
-                        if (resultCode != RHI::ResultCode::Success)
-                        {
-                            AZ_Warning("PipelineStateCache", false, "Failed to initialize pipeline library. PipelineLibrary usage is disabled.");
-                        }
-
-                        // We store a valid pointer even if initialization failed, to avoid attempting
-                        // to re-create it with every access.
-                        threadLibraryEntry.m_library = AZStd::move(pipelineLibrary);
-                    }
-
                     ConstPtr<PipelineState> pipelineState = CompilePipelineState(globalLibraryEntry, threadLibraryEntry, descriptor, pipelineStateHash);
 
                     [[maybe_unused]] bool success = InsertPipelineState(threadLocalCache, PipelineStateEntry(pipelineStateHash, pipelineState, descriptor));
@@ -353,8 +359,6 @@ namespace AZ
                 AZ_Assert(success, "PipelineStateEntry already exists in the pending cache.");
             }
 
-            ResultCode resultCode = ResultCode::InvalidArgument;
-
             // Increment the pending compile count on the global entry, which tracks how many pipeline states
             // are currently being compiled across all threads.
             if (Validation::IsEnabled())
@@ -362,43 +366,156 @@ namespace AZ
                 ++globalLibraryEntry.m_pendingCompileCount;
             }
 
-            // If the pipeline library failed to initialize, then we don't use it.
-            PipelineLibrary* pipelineLibrary = threadLibraryEntry.m_library.get();
-            if (!pipelineLibrary->IsInitialized())
+            // We no longer have the lock, but we own compilation of the pipeline state. Use the
+            // thread-local library to perform compilation without blocking other threads.
+            const ResultCode resultCode = InitPipelineState(*pipelineState, descriptor, GetThreadLibrary(globalLibraryEntry, threadLibraryEntry));
+
+            if (Validation::IsEnabled())
             {
-                pipelineLibrary = nullptr;
+                --globalLibraryEntry.m_pendingCompileCount;
             }
 
-            // We no longer have the lock, but we own compilation of the pipeline state. Use the
-            // thread-local library to perform compilation without blocking other threads.
+            // NOTE: We can't return null on a failure, since other threads will return the entry without compiling
+            // it. Instead, the pipeline state remains uninitialized.
+
+            AZ_Error("PipelineStateCache", resultCode == ResultCode::Success, "Failed to compile pipeline state. It will remain in an initialized state.");
+            return AZStd::move(pipelineState);
+        }
+
+        PipelineLibrary* PipelineStateCache::GetThreadLibrary(const GlobalLibraryEntry& globalLibraryEntry, ThreadLibraryEntry& threadLibraryEntry)
+        {
+            // Lazy-init the library on first access.
+            if (!threadLibraryEntry.m_library)
+            {
+                Ptr<PipelineLibrary> pipelineLibrary = Factory::Get().CreatePipelineLibrary();
+                RHI::ResultCode resultCode = pipelineLibrary->Init(*m_device, globalLibraryEntry.m_serializedData.get());
+                if (resultCode != RHI::ResultCode::Success)
+                {
+                    AZ_Warning("PipelineStateCache", false, "Failed to initialize pipeline library. PipelineLibrary usage is disabled.");
+                }
+
+                // We store a valid pointer even if initialization failed, to avoid attempting
+                // to re-create it with every access.
+                threadLibraryEntry.m_library = AZStd::move(pipelineLibrary);
+            }
+
+            // If the pipeline library failed to initialize, then we don't use it.
+            return threadLibraryEntry.m_library->IsInitialized() ? threadLibraryEntry.m_library.get() : nullptr;
+        }
+
+        ResultCode PipelineStateCache::InitPipelineState(PipelineState& pipelineState, const PipelineStateDescriptor& descriptor, PipelineLibrary* pipelineLibrary)
+        {
+            ResultCode resultCode = ResultCode::InvalidArgument;
             switch (descriptor.GetType())
             {
             case PipelineStateType::Draw:
-                resultCode = pipelineState->Init(*m_device, static_cast<const PipelineStateDescriptorForDraw&>(descriptor), pipelineLibrary);
+                resultCode = pipelineState.Init(*m_device, static_cast<const PipelineStateDescriptorForDraw&>(descriptor), pipelineLibrary);
                 break;
 
             case PipelineStateType::Dispatch:
-                resultCode = pipelineState->Init(*m_device, static_cast<const PipelineStateDescriptorForDispatch&>(descriptor), pipelineLibrary);
+                resultCode = pipelineState.Init(*m_device, static_cast<const PipelineStateDescriptorForDispatch&>(descriptor), pipelineLibrary);
                 break;
 
             case PipelineStateType::RayTracing:
-                resultCode = pipelineState->Init(*m_device, static_cast<const PipelineStateDescriptorForRayTracing&>(descriptor), pipelineLibrary);
+                resultCode = pipelineState.Init(*m_device, static_cast<const PipelineStateDescriptorForRayTracing&>(descriptor), pipelineLibrary);
                 break;
 
             default:
                 AZ_Assert(false, "Invalid pipeline state descriptor type specified.");
             }
+            return resultCode;
+        }
 
-            if (Validation::IsEnabled())
+        const PipelineState* PipelineStateCache::AcquirePipelineStateAsync(PipelineLibraryHandle handle, const PipelineStateDescriptor& descriptor)
+        {
+            AZ_PROFILE_FUNCTION(Debug::ProfileCategory::AzRender);
+
+            if (handle.IsNull())
             {
-                --globalLibraryEntry.m_pendingCompileCount;
+                return nullptr;
             }
 
-            // NOTE: We can't return null on a failure, since other threads will return the entry without compiling
-            // it. Instead, the pipeline state remains uninitialized.
+            if (!JobContext::GetGlobalContext())
+            {
+                return AcquirePipelineState(handle, descriptor);
+            }
 
-            AZ_Error("PipelineStateCache", resultCode == ResultCode::Success, "Failed to compile pipeline state. It will remain in an initialized state.");
-            return AZStd::move(pipelineState);
+            AZStd::shared_lock<AZStd::shared_mutex> lock(m_mutex);
+
+            GlobalLibraryEntry& globalLibraryEntry = m_globalLibrarySet[handle.GetIndex()];
+            const PipelineStateHash pipelineStateHash = descriptor.GetHash();
+
+            if (const PipelineState* pipelineState = FindPipelineState(globalLibraryEntry.m_readOnlyCache, descriptor))
+            {
+                return pipelineState;
+            }
+
+            ThreadLibrarySet& threadLibrarySet = m_threadLibrarySet.GetStorage();
+            if (const PipelineState* pipelineState = FindPipelineState(threadLibrarySet[handle.GetIndex()].m_threadLocalCache, descriptor))
+            {
+                return pipelineState;
+            }
+
+            {
+                AZStd::lock_guard<AZStd::mutex> pendingLock(globalLibraryEntry.m_pendingCacheMutex);
+
+                // The pending cache holds pipeline states that finished compiling on a background job this cycle, or that
+                // are compiled by an AcquirePipelineState call on another thread.
+                if (const PipelineState* pipelineState = FindPipelineState(globalLibraryEntry.m_pendingCache, descriptor))
+                {
+                    return pipelineState;
+                }
+
+                // Only the first request starts a background compile.
+                if (!globalLibraryEntry.m_asyncCompileSet.insert(static_cast<uint64_t>(pipelineStateHash)).second)
+                {
+                    return nullptr;
+                }
+            }
+
+            CompilePipelineStateAsync(handle, PipelineStateEntry(pipelineStateHash, nullptr, descriptor));
+            return nullptr;
+        }
+
+        void PipelineStateCache::CompilePipelineStateAsync(PipelineLibraryHandle handle, PipelineStateEntry pipelineStateEntry)
+        {
+            ++m_asyncCompileCount;
+
+            auto compileJob = [this, handle, pipelineStateEntry = AZStd::move(pipelineStateEntry)]()
+            {
+                AZ_PROFILE_SCOPE(Debug::ProfileCategory::AzRender, "PipelineStateCache: CompilePipelineStateAsync");
+
+                {
+                    // Libraries are reset or released under the exclusive lock, and Compact merges the pending cache under it.
+                    AZStd::shared_lock<AZStd::shared_mutex> lock(m_mutex);
+
+                    GlobalLibraryEntry& globalLibraryEntry = m_globalLibrarySet[handle.GetIndex()];
+                    ThreadLibraryEntry& threadLibraryEntry = m_threadLibrarySet.GetStorage()[handle.GetIndex()];
+
+                    const PipelineStateDescriptor& descriptor = AZStd::visit(
+                        [](const auto& descriptorVariant) -> const PipelineStateDescriptor& { return descriptorVariant; },
+                        pipelineStateEntry.m_pipelineStateDescriptorVariant);
+
+                    Ptr<PipelineState> pipelineState = Factory::Get().CreatePipelineState();
+                    [[maybe_unused]] const ResultCode resultCode =
+                        InitPipelineState(*pipelineState, descriptor, GetThreadLibrary(globalLibraryEntry, threadLibraryEntry));
+                    AZ_Error("PipelineStateCache", resultCode == ResultCode::Success, "Failed to compile pipeline state. It will remain in an initialized state.");
+
+                    // The library clears the set when it's reset, in which case the pipeline state is discarded. An AcquirePipelineState
+                    // call may also have compiled the same pipeline state in the meantime, in which case that pipeline state is kept.
+                    AZStd::lock_guard<AZStd::mutex> pendingLock(globalLibraryEntry.m_pendingCacheMutex);
+                    if (globalLibraryEntry.m_asyncCompileSet.erase(static_cast<uint64_t>(pipelineStateEntry.m_hash)) > 0)
+                    {
+                        InsertPipelineState(globalLibraryEntry.m_pendingCache, PipelineStateEntry(pipelineStateEntry.m_hash, pipelineState, descriptor));
+                    }
+                }
+
+                // The cache may be destroyed as soon as the count reaches zero, so it must not be accessed afterwards.
+                --m_asyncCompileCount;
+            };
+
+            AZ::Job* job = AZ::CreateJobFunction(AZStd::move(compileJob), true, nullptr);
+            job->Start();
         }
 
         PipelineStateCache::PipelineStateEntry::PipelineStateEntry(PipelineStateHash hash, ConstPtr<PipelineState> pipelineState, const PipelineStateDescriptor& descriptor)
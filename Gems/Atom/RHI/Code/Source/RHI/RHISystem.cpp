@@ -12,6 +12,7 @@
 #include <Atom/RHI/RHIUtils.h>
 
 #include <AzCore/Interface/Interface.h>
+#include <AzCore/Memory/MemoryBudgetTracker.h>
 
 #include <AzFramework/API/ApplicationAPI.h>
 #include <AzFramework/CommandLine/CommandLine.h>
@@ -22,6 +23,8 @@ namespace AZ
 {
     namespace RHI
     {
+        static constexpr const char* s_memoryBudgetProviderName = "RHI Pools";
+
         RHISystemInterface* RHISystemInterface::Get()
         {
             return Interface<RHISystemInterface>::Get();
@@ -100,6 +103,29 @@ namespace AZ
             frameSchedulerDescriptor.m_platformLimitsDescriptor = m_platformLimitsDescriptor;
             m_frameScheduler.Init(*m_device, frameSchedulerDescriptor);
 
+            if (auto* memoryBudgetTracker = AZ::Interface<AZ::MemoryBudgetTracker>::Get())
+            {
+                // The pool memory is allocated by the driver, outside of the AllocatorManager
+                memoryBudgetTracker->AddUsageProvider(AZ::MemoryBudgetCategory::Rendering, s_memoryBudgetProviderName, [this]()
+                {
+                    MemoryStatistics memoryStatistics;
+                    if (m_device->CompileMemoryStatistics(memoryStatistics, MemoryStatisticsReportFlags::Basic) != ResultCode::Success)
+                    {
+                        return size_t(0);
+                    }
+
+                    size_t reservedBytes = 0;
+                    for (const MemoryStatistics::Pool& pool : memoryStatistics.m_pools)
+                    {
+                        for (const HeapMemoryUsage& heapMemoryUsage : pool.m_memoryUsage.m_memoryUsagePerLevel)
+                        {
+                            reservedBytes += heapMemoryUsage.m_reservedInBytes;
+                        }
+                    }
+                    return reservedBytes;
+                });
+            }
+
             // Register draw list tags declared from content.
             for (const Name& drawListName : descriptor.m_drawListTags)
             {
@@ -192,6 +218,10 @@ namespace AZ
         void RHISystem::Shutdown()
         {
             Interface<RHISystemInterface>::Unregister(this);
+            if (auto* memoryBudgetTracker = AZ::Interface<AZ::MemoryBudgetTracker>::Get())
+            {
+                memoryBudgetTracker->RemoveUsageProvider(s_memoryBudgetProviderName);
+            }
             m_frameScheduler.Shutdown();
 
             m_platformLimitsDescriptor = nullptr;
@@ -57,6 +57,12 @@ namespace AZ
         void ShaderResourceGroup::SetData(const ShaderResourceGroupData& data)
         {
             m_data = data;
+            ++m_updateCount;
+        }
+
+        uint64_t ShaderResourceGroup::GetUpdateCount() const
+        {
+            return m_updateCount;
         }
 
         void ShaderResourceGroup::ReportMemoryUsage(MemoryStatisticsBuilder& builder) const
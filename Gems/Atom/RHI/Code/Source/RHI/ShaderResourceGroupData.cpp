@@ -334,5 +334,36 @@ namespace AZ
             return m_constantsData.GetConstantData();
         }
 
+        bool ShaderResourceGroupData::operator==(const ShaderResourceGroupData& rhs) const
+        {
+            if (m_shaderResourceGroupLayout != rhs.m_shaderResourceGroupLayout ||
+                m_imageViews != rhs.m_imageViews ||
+                m_bufferViews != rhs.m_bufferViews ||
+                m_imageViewsUnboundedArray != rhs.m_imageViewsUnboundedArray ||
+                m_bufferViewsUnboundedArray != rhs.m_bufferViewsUnboundedArray ||
+                m_samplers.size() != rhs.m_samplers.size())
+            {
+                return false;
+            }
+
+            for (size_t i = 0; i < m_samplers.size(); ++i)
+            {
+                if (m_samplers[i].GetHash() != rhs.m_samplers[i].GetHash())
+                {
+                    return false;
+                }
+            }
+
+            const AZStd::array_view<uint8_t> constantData = GetConstantData();
+            const AZStd::array_view<uint8_t> rhsConstantData = rhs.GetConstantData();
+            return constantData.size() == rhsConstantData.size() &&
+                (constantData.empty() || ::memcmp(constantData.data(), rhsConstantData.data(), constantData.size()) == 0);
+        }
+
+        bool ShaderResourceGroupData::operator!=(const ShaderResourceGroupData& rhs) const
+        {
+            return !(*this == rhs);
+        }
+
     } // namespace RHI
 } // namespace AZ
@@ -7,12 +7,16 @@
 #include <Atom/RHI/ShaderResourceGroupPool.h>
 #include <Atom/RHI/BufferView.h>
 #include <Atom/RHI/ImageView.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Debug/EventTrace.h>
 
 namespace AZ
 {
     namespace RHI
     {
+        AZ_CVAR(bool, r_skipUnchangedShaderResourceGroupCompiles, true, nullptr, ConsoleFunctorFlags::Null,
+            "Skips queuing shader resource groups for compile when their data is the same as the data they were last compiled with.");
+
         ShaderResourceGroupPool::ShaderResourceGroupPool() {}
 
         ShaderResourceGroupPool::~ShaderResourceGroupPool() {}
@@ -112,6 +116,12 @@ namespace AZ
 
             AZ_Assert(!shaderResourceGroup.IsQueuedForCompile(), "Attempting to compile an SRG that's already been queued for compile. Only compile an SRG once per frame.");            
 
+            // Resource invalidations go through QueueForCompile(group), so a group whose views are rebuilt is still compiled.
+            if (r_skipUnchangedShaderResourceGroupCompiles && shaderResourceGroup.GetData() == groupData)
+            {
+                return;
+            }
+
             CalculateGroupDataDiff(shaderResourceGroup, groupData);
 
             shaderResourceGroup.SetData(groupData);
@@ -45,6 +45,11 @@ namespace AZ
                     AZ_Error("StreamingImagePool", false, "Streaming images may only contain read-only bind flags.");
                     return false;
                 }
+
+                if (!ValidateMipSliceCompression(initRequest.m_tailMipSlices))
+                {
+                    return false;
+                }
             }
 
             AZ_UNUSED(initRequest);
@@ -65,12 +70,30 @@ namespace AZ
                     AZ_Error("StreamingImagePool", false, "Attempted to expand image more than the number of mips available.");
                     return false;
                 }
+
+                if (!ValidateMipSliceCompression(expandRequest.m_mipSlices))
+                {
+                    return false;
+                }
             }
 
             AZ_UNUSED(expandRequest);
             return true;
         }
 
+        bool StreamingImagePool::ValidateMipSliceCompression(AZStd::array_view<StreamingImageMipSlice> mipSlices) const
+        {
+            for (const StreamingImageMipSlice& mipSlice : mipSlices)
+            {
+                if (mipSlice.m_compression != StreamingImageCompression::None && !IsCompressionSupportedInternal(mipSlice.m_compression))
+                {
+                    AZ_Error("StreamingImagePool", false, "Mip slice uses a compression that isn't supported by this pool. Decompress the data first.");
+                    return false;
+                }
+            }
+            return true;
+        }
+
         ResultCode StreamingImagePool::Init(Device& device, const StreamingImagePoolDescriptor& descriptor)
         {
             AZ_TRACE_METHOD();
@@ -170,6 +193,11 @@ namespace AZ
             return RHI::ResultCode::Success;
         }
 
+        bool StreamingImagePool::IsCompressionSupported(StreamingImageCompression compression) const
+        {
+            return compression == StreamingImageCompression::None || IsCompressionSupportedInternal(compression);
+        }
+
         const StreamingImagePoolDescriptor& StreamingImagePool::GetDescriptor() const
         {
             return m_descriptor;
@@ -194,5 +222,10 @@ namespace AZ
         {
             return ResultCode::Unimplemented;
         }
+
+        bool StreamingImagePool::IsCompressionSupportedInternal(StreamingImageCompression) const
+        {
+            return false;
+        }
     }
 }
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "RHITestFixture.h"
+#include <Atom/RHI/AliasedHeapPlacement.h>
+
+namespace UnitTest
+{
+    using namespace AZ;
+
+    class AliasedHeapPlacementTests
+        : public RHITestFixture
+    {
+    protected:
+        static RHI::AliasedHeapPlacementRequest CreateRequest(const char* name, size_t size, uint32_t scopeFirst, uint32_t scopeLast)
+        {
+            RHI::AliasedHeapPlacementRequest request;
+            request.m_attachmentId = RHI::AttachmentId{ name };
+            request.m_sizeInBytes = size;
+            request.m_alignmentInBytes = 256;
+            request.m_scopeIndexFirst = scopeFirst;
+            request.m_scopeIndexLast = scopeLast;
+            return request;
+        }
+
+        static void ValidatePlacement(AZStd::array_view<RHI::AliasedHeapPlacementRequest> requests, const AZStd::vector<size_t>& heapOffsets)
+        {
+            ASSERT_EQ(heapOffsets.size(), requests.size());
+            for (size_t i = 0; i < requests.size(); ++i)
+            {
+                EXPECT_EQ(heapOffsets[i] % requests[i].m_alignmentInBytes, 0);
+                for (size_t j = i + 1; j < requests.size(); ++j)
+                {
+                    const bool aliveTogether = requests[i].m_scopeIndexFirst <= requests[j].m_scopeIndexLast &&
+                        requests[j].m_scopeIndexFirst <= requests[i].m_scopeIndexLast;
+                    const bool overlap = heapOffsets[i] < heapOffsets[j] + requests[j].m_sizeInBytes &&
+                        heapOffsets[j] < heapOffsets[i] + requests[i].m_sizeInBytes;
+                    EXPECT_FALSE(aliveTogether && overlap);
+                }
+            }
+        }
+    };
+
+    TEST_F(AliasedHeapPlacementTests, TestEmpty)
+    {
+        AZStd::vector<size_t> heapOffsets;
+        EXPECT_EQ(RHI::PlaceAliasedHeapResources({}, heapOffsets), 0);
+        EXPECT_TRUE(heapOffsets.empty());
+    }
+
+    TEST_F(AliasedHeapPlacementTests, TestDisjointLifetimesAlias)
+    {
+        const AZStd::vector<RHI::AliasedHeapPlacementRequest> requests = {
+            CreateRequest("A", 1024, 0, 1),
+            CreateRequest("B", 512, 2, 3),
+            CreateRequest("C", 2048, 4, 4),
+        };
+
+        AZStd::vector<size_t> heapOffsets;
+        EXPECT_EQ(RHI::PlaceAliasedHeapResources(requests, heapOffsets), 2048);
+        ValidatePlacement(requests, heapOffsets);
+        EXPECT_EQ(heapOffsets[0], 0);
+        EXPECT_EQ(heapOffsets[1], 0);
+        EXPECT_EQ(heapOffsets[2], 0);
+    }
+
+    TEST_F(AliasedHeapPlacementTests, TestLowerPeakThanScopeOrder)
+    {
+        // In scope order A and B are placed first, and C doesn't fit in the range A frees.
+        const AZStd::vector<RHI::AliasedHeapPlacementRequest> requests = {
+            CreateRequest("A", 1024, 0, 0),
+            CreateRequest("B", 1024, 0, 2),
+            CreateRequest("C", 2048, 1, 2),
+        };
+
+        AZStd::vector<size_t> heapOffsets;
+        EXPECT_EQ(RHI::PlaceAliasedHeapResources(requests, heapOffsets), 3072);
+        ValidatePlacement(requests, heapOffsets);
+    }
+
+    TEST_F(AliasedHeapPlacementTests, TestFillsGaps)
+    {
+        const AZStd::vector<RHI::AliasedHeapPlacementRequest> requests = {
+            CreateRequest("A", 4096, 0, 1),
+            CreateRequest("B", 4096, 1, 2),
+            CreateRequest("C", 1000, 2, 3),
+            CreateRequest("D", 3000, 3, 4),
+            CreateRequest("E", 256, 0, 4),
+        };
+
+        AZStd::vector<size_t> heapOffsets;
+        EXPECT_EQ(RHI::PlaceAliasedHeapResources(requests, heapOffsets), 8448);
+        ValidatePlacement(requests, heapOffsets);
+    }
+}
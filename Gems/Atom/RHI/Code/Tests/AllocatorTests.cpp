@@ -8,6 +8,8 @@
 #include "RHITestFixture.h"
 #include <Atom/RHI/PoolAllocator.h>
 #include <Atom/RHI/FreeListAllocator.h>
+#include <Atom/RHI/MemorySubAllocator.h>
+#include <Atom/RHI/Object.h>
 #include <AzCore/Math/Random.h>
 #include <AzCore/std/time.h>
 #include <AzCore/UnitTest/UnitTest.h>
@@ -18,6 +20,48 @@ using namespace AZ;
 
 namespace UnitTest
 {
+    class TestMemoryPage
+        : public RHI::Object
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(TestMemoryPage, AZ::SystemAllocator, 0);
+    };
+
+    class TestMemoryPageAllocator
+    {
+    public:
+        static const size_t PageSize = 4 * 1024;
+
+        TestMemoryPage* Allocate()
+        {
+            m_pages.emplace_back(aznew TestMemoryPage());
+            return m_pages.back().get();
+        }
+
+        void DeAllocate(TestMemoryPage* page)
+        {
+            m_pages.erase(AZStd::remove(m_pages.begin(), m_pages.end(), page), m_pages.end());
+        }
+
+        void DeAllocate(TestMemoryPage** pages, size_t count)
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                DeAllocate(pages[i]);
+            }
+        }
+
+        size_t GetPageSize() const
+        {
+            return PageSize;
+        }
+
+        AZStd::vector<RHI::Ptr<TestMemoryPage>> m_pages;
+    };
+
+    using TestMemorySubAllocator =
+        RHI::MemorySubAllocator<RHI::MemorySubAllocatorTraits<TestMemoryPage, TestMemoryPageAllocator, RHI::FreeListAllocator>>;
+
     class AllocatorTest
         : public RHITestFixture
     {
@@ -274,4 +318,49 @@ namespace UnitTest
         testDescriptor.m_addressBase = descriptor.m_addressBase.m_ptr;
         run(testDescriptor);
     }
+
+    TEST_F(AllocatorTest, MemorySubAllocatorCompactsPages)
+    {
+        TestMemoryPageAllocator pageAllocator;
+        TestMemorySubAllocator::Descriptor descriptor;
+        descriptor.m_alignmentInBytes = 256;
+        descriptor.m_garbageCollectLatency = 0;
+        descriptor.m_inactivePageCycles = 0;
+
+        TestMemorySubAllocator subAllocator;
+        subAllocator.Init(descriptor, pageAllocator);
+
+        const size_t allocationSize = TestMemoryPageAllocator::PageSize / 4;
+        AZStd::vector<TestMemorySubAllocator::memory_allocation> allocations;
+        for (size_t i = 0; i < 16; ++i)
+        {
+            allocations.push_back(subAllocator.Allocate(allocationSize, descriptor.m_alignmentInBytes));
+        }
+        EXPECT_EQ(pageAllocator.m_pages.size(), 4u);
+        EXPECT_EQ(subAllocator.ComputeFragmentation(), 0.0f);
+
+        // Keep one allocation in the first two pages and three in the third one.
+        for (size_t i : { 1, 2, 3, 5, 6, 7, 11 })
+        {
+            subAllocator.DeAllocate(allocations[i]);
+        }
+        subAllocator.GarbageCollect();
+        EXPECT_EQ(pageAllocator.m_pages.size(), 4u);
+        EXPECT_FLOAT_EQ(subAllocator.ComputeFragmentation(), 0.25f);
+
+        // The most used page that isn't full is filled first.
+        TestMemorySubAllocator::memory_allocation allocation = subAllocator.Allocate(allocationSize, descriptor.m_alignmentInBytes);
+        EXPECT_EQ(allocation.m_memory, allocations[8].m_memory);
+
+        // The sparse pages are released once their allocations are gone.
+        subAllocator.DeAllocate(allocations[0]);
+        subAllocator.DeAllocate(allocations[4]);
+        subAllocator.GarbageCollect();
+        subAllocator.GarbageCollect();
+        EXPECT_EQ(pageAllocator.m_pages.size(), 2u);
+        EXPECT_EQ(subAllocator.ComputeFragmentation(), 0.0f);
+
+        subAllocator.Shutdown();
+        EXPECT_TRUE(pageAllocator.m_pages.empty());
+    }
 }
@@ -18,6 +18,10 @@
 
 #include <Tests/Factory.h>
 
+#if defined(HAVE_BENCHMARK)
+#include <benchmark/benchmark.h>
+#endif
+
 namespace UnitTest
 {
     using namespace AZ;
@@ -417,6 +421,92 @@ namespace UnitTest
 
         delete drawPacket;
     }
+
+    static RHI::DrawList CreateRandomDrawList(SimpleLcgRandom& random, size_t drawItemCount)
+    {
+        // Use few distinct keys and depths so the sort has to order many ties.
+        RHI::DrawList drawList(drawItemCount);
+        for (RHI::DrawItemProperties& drawItem : drawList)
+        {
+            drawItem.m_sortKey = static_cast<RHI::DrawItemSortKey>(random.GetRandom() % 64) - 32;
+            drawItem.m_depth = static_cast<float>(random.GetRandom() % 256) * 0.25f - 32.0f;
+            drawItem.m_drawFilterMask = static_cast<RHI::DrawFilterMask>(random.GetRandom());
+        }
+        return drawList;
+    }
+
+    TEST_F(DrawPacketTest, SortDrawList_LargeDrawList_MatchesStableComparisonSort)
+    {
+        AZ::SimpleLcgRandom random(s_randomSeed);
+        const RHI::DrawList unsortedList = CreateRandomDrawList(random, 4096);
+
+        auto compareKeyThenDepth = [](const RHI::DrawItemProperties& a, const RHI::DrawItemProperties& b)
+        {
+            return a.m_sortKey != b.m_sortKey ? a.m_sortKey < b.m_sortKey : a.m_depth < b.m_depth;
+        };
+        auto compareKeyThenReverseDepth = [](const RHI::DrawItemProperties& a, const RHI::DrawItemProperties& b)
+        {
+            return a.m_sortKey != b.m_sortKey ? a.m_sortKey < b.m_sortKey : a.m_depth > b.m_depth;
+        };
+        auto compareDepthThenKey = [](const RHI::DrawItemProperties& a, const RHI::DrawItemProperties& b)
+        {
+            return a.m_depth != b.m_depth ? a.m_depth < b.m_depth : a.m_sortKey < b.m_sortKey;
+        };
+        auto compareReverseDepthThenKey = [](const RHI::DrawItemProperties& a, const RHI::DrawItemProperties& b)
+        {
+            return a.m_depth != b.m_depth ? a.m_depth > b.m_depth : a.m_sortKey < b.m_sortKey;
+        };
+
+        auto expectSortMatches = [&unsortedList](RHI::DrawListSortType sortType, auto compare)
+        {
+            RHI::DrawList sortedList = unsortedList;
+            RHI::SortDrawList(sortedList, sortType);
+
+            RHI::DrawList expectedList = unsortedList;
+            AZStd::stable_sort(expectedList.begin(), expectedList.end(), compare);
+
+            ASSERT_EQ(sortedList.size(), expectedList.size());
+            for (size_t i = 0; i < sortedList.size(); ++i)
+            {
+                EXPECT_EQ(sortedList[i], expectedList[i]);
+            }
+        };
+
+        expectSortMatches(RHI::DrawListSortType::KeyThenDepth, compareKeyThenDepth);
+        expectSortMatches(RHI::DrawListSortType::KeyThenReverseDepth, compareKeyThenReverseDepth);
+        expectSortMatches(RHI::DrawListSortType::DepthThenKey, compareDepthThenKey);
+        expectSortMatches(RHI::DrawListSortType::ReverseDepthThenKey, compareReverseDepthThenKey);
+    }
 }
 
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    class DrawListSortBenchmark
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    };
+
+    BENCHMARK_DEFINE_F(DrawListSortBenchmark, SortDrawList_KeyThenDepth)(benchmark::State& state)
+    {
+        AZ::SimpleLcgRandom random(1234);
+        const AZ::RHI::DrawList unsortedList = UnitTest::CreateRandomDrawList(random, static_cast<size_t>(state.range(0)));
+
+        AZ::RHI::DrawList drawList;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            state.PauseTiming();
+            drawList = unsortedList;
+            state.ResumeTiming();
+
+            AZ::RHI::SortDrawList(drawList, AZ::RHI::DrawListSortType::KeyThenDepth);
+            benchmark::DoNotOptimize(drawList.data());
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    BENCHMARK_REGISTER_F(DrawListSortBenchmark, SortDrawList_KeyThenDepth)->RangeMultiplier(8)->Range(64, 65536)->Unit(benchmark::kMicrosecond);
+} // namespace Benchmark
+#endif // HAVE_BENCHMARK
+
 AZ_UNIT_TEST_HOOK(DEFAULT_UNIT_TEST_ENV);
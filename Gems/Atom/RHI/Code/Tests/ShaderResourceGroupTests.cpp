@@ -763,4 +763,21 @@ namespace UnitTest
             EXPECT_NE(otherLayout->GetHash(), layout->GetHash());
         }
     }
+
+    TEST_F(ShaderResourceGroupTests, SRGDataCompare_ChangedConstant_NotEqual)
+    {
+        RHI::ConstPtr<RHI::ShaderResourceGroupLayout> srgLayout = CreateLayout();
+        RHI::ShaderResourceGroupData srgData(srgLayout.get());
+        RHI::ShaderResourceGroupData otherSrgData(srgLayout.get());
+
+        EXPECT_TRUE(srgData == otherSrgData);
+        EXPECT_FALSE(srgData == RHI::ShaderResourceGroupData());
+
+        const RHI::ShaderInputConstantIndex floatValueIndex = srgLayout->FindShaderInputConstantIndex(Name("m_floatValue"));
+        EXPECT_TRUE(srgData.SetConstant(floatValueIndex, 1.0f));
+        EXPECT_TRUE(srgData != otherSrgData);
+
+        EXPECT_TRUE(otherSrgData.SetConstant(floatValueIndex, 1.0f));
+        EXPECT_TRUE(srgData == otherSrgData);
+    }
 }
@@ -175,6 +175,8 @@ set(FILES
     Source/RHI/AsyncWorkQueue.cpp
     Include/Atom/RHI/AliasedHeap.h
     Source/RHI/AliasedHeap.cpp
+    Include/Atom/RHI/AliasedHeapPlacement.h
+    Source/RHI/AliasedHeapPlacement.cpp
     Include/Atom/RHI/AliasedAttachmentAllocator.h
     Include/Atom/RHI/AliasingBarrierTracker.h
     Source/RHI/AliasingBarrierTracker.cpp
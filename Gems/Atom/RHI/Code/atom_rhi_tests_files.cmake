@@ -7,6 +7,7 @@
 
 set(FILES
     Tests/RHITestFixture.h
+    Tests/AliasedHeapPlacementTests.cpp
     Tests/AllocatorTests.cpp
     Tests/BufferTests.cpp
     Tests/DrawPacketTests.cpp
@@ -29,6 +29,7 @@ namespace AZ
         void AsyncUploadQueue::Init(RHI::Device& deviceBase, const Descriptor& descriptor)
         {
             Base::Init(deviceBase);
+            m_descriptor = descriptor;
             auto& device = static_cast<Device&>(deviceBase);
             ID3D12DeviceX* dx12Device = device.GetDevice();
 
@@ -156,39 +157,45 @@ namespace AZ
                 size_t pendingByteOffset = 0;
                 size_t pendingByteCount = byteCount;
                 ID3D12CommandQueue* dx12CommandQueue = static_cast<ID3D12CommandQueue*>(commandQueue);
+                FramePacket* framePacket = GetRecordingFramePacket();
 
                 while (pendingByteCount > 0)
                 {
                     AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::AzRender, "Upload Buffer Chunk");
 
-                    FramePacket* framePacket = BeginFramePacket();
+                    if (framePacket->m_dataOffset == m_descriptor.m_stagingSizeInBytes)
+                    {
+                        EndFramePacket(dx12CommandQueue);
+                        framePacket = BeginFramePacket();
+                    }
 
-                    const size_t bytesToCopy = AZStd::min(pendingByteCount, m_descriptor.m_stagingSizeInBytes);
+                    // Small uploads are packed after the ones already recorded in the frame packet.
+                    const size_t bytesToCopy = AZStd::min(pendingByteCount, m_descriptor.m_stagingSizeInBytes - framePacket->m_dataOffset);
 
                     {
                         AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::AzRender, "Copy CPU buffer");
-                        memcpy(framePacket->m_stagingResourceData, sourceData + pendingByteOffset, bytesToCopy);
+                        memcpy(framePacket->m_stagingResourceData + framePacket->m_dataOffset, sourceData + pendingByteOffset, bytesToCopy);
                     }
 
                     m_commandList->CopyBufferRegion(
                         dx12Buffer.get(),
                         byteOffset + pendingByteOffset,
                         framePacket->m_stagingResource.get(),
-                        0,
+                        framePacket->m_dataOffset,
                         bytesToCopy);
 
+                    framePacket->m_dataOffset += static_cast<uint32_t>(bytesToCopy);
                     pendingByteOffset += bytesToCopy;
                     pendingByteCount -= bytesToCopy;
-
-                    EndFramePacket(dx12CommandQueue);
                 }
 
                 if (dx12FenceToSignal)
                 {
-                    dx12CommandQueue->Signal(dx12FenceToSignal.get(), dx12FenceToSignalValue);
+                    m_pendingSignals.emplace_back(dx12FenceToSignal, dx12FenceToSignalValue);
                 }
 
-                dx12CommandQueue->Signal(m_uploadFence.Get(), queueValue);
+                m_pendingSignals.emplace_back(m_uploadFence.Get(), queueValue);
+                EndFramePacketIfIdle(dx12CommandQueue);
             });
 
             return queueValue;
@@ -222,10 +229,31 @@ namespace AZ
             FramePacket& framePacket = m_framePackets[m_frameIndex];
             commandQueue->Signal(framePacket.m_fence.Get(), framePacket.m_fence.GetPendingValue());
 
+            // Signal the uploads batched in this frame packet, in the order they were queued.
+            for (const auto& [fence, fenceValue] : m_pendingSignals)
+            {
+                commandQueue->Signal(fence.get(), fenceValue);
+            }
+            m_pendingSignals.clear();
+
             m_frameIndex = (m_frameIndex + 1) % m_descriptor.m_frameCount;
             m_recordingFrame = false;
         }
 
+        AsyncUploadQueue::FramePacket* AsyncUploadQueue::GetRecordingFramePacket()
+        {
+            return m_recordingFrame ? &m_framePackets[m_frameIndex] : BeginFramePacket();
+        }
+
+        void AsyncUploadQueue::EndFramePacketIfIdle(ID3D12CommandQueue* commandQueue)
+        {
+            // The next command will record into the same frame packet and end it.
+            if (m_recordingFrame && !m_copyQueue->HasPendingCommands())
+            {
+                EndFramePacket(commandQueue);
+            }
+        }
+
         // [GFX TODO][ATOM-4205] Stage/Upload 3D streaming images more efficiently.
         uint64_t AsyncUploadQueue::QueueUpload(const RHI::StreamingImageExpandRequest& request, uint32_t residentMip)
         {
@@ -245,7 +273,11 @@ namespace AZ
             {
                 AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::AzRender, "Upload Image");
                 ID3D12CommandQueue* dx12CommandQueue = static_cast<ID3D12CommandQueue*>(commandQueue);
-                FramePacket* framePacket = BeginFramePacket();
+                FramePacket* framePacket = GetRecordingFramePacket();
+
+                // Buffer uploads batched in the frame packet may leave the staging offset unaligned for placed footprints.
+                framePacket->m_dataOffset = static_cast<uint32_t>(AZStd::min<size_t>(
+                    RHI::AlignUp(framePacket->m_dataOffset, D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT), m_descriptor.m_stagingSizeInBytes));
 
                 uint32_t arraySize = request.m_image->GetDescriptor().m_arraySize;
                 uint16_t imageMipLevels = request.m_image->GetDescriptor().m_mipLevels;
@@ -436,9 +468,8 @@ namespace AZ
                     }
                 }
 
-                EndFramePacket(dx12CommandQueue);
-
-                dx12CommandQueue->Signal(m_uploadFence.Get(), fenceValue);
+                m_pendingSignals.emplace_back(m_uploadFence.Get(), fenceValue);
+                EndFramePacketIfIdle(dx12CommandQueue);
 
                 if (request.m_completeCallback && !request.m_waitForUpload)
                 {
@@ -507,6 +538,13 @@ namespace AZ
                 AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::AzRender, "QueueTileMapping");
 
                 ID3D12CommandQueue* dx12CommandQueue = static_cast<ID3D12CommandQueue*>(commandQueue);
+
+                // Uploads batched before the tile mapping are submitted first to keep the queue order.
+                if (m_recordingFrame)
+                {
+                    EndFramePacket(dx12CommandQueue);
+                }
+
                 const uint32_t tileCount = request.m_sourceRegionSize.NumTiles;
 
                 // DX12 requires that we pass the full array of range counts (even though they are all 1).
@@ -38,7 +38,7 @@ namespace AZ
             struct Descriptor
             {
                 size_t m_stagingSizeInBytes = RHI::DefaultValues::Memory::AsyncQueueStagingBufferSizeInBytes;
-                size_t m_frameCount = RHI::Limits::Device::FrameCountMax;
+                size_t m_frameCount = RHI::DefaultValues::Memory::AsyncQueueStagingBufferCount;
 
                 Descriptor() = default;
                 Descriptor(size_t stagingSizeInBytes);
@@ -85,8 +85,16 @@ namespace AZ
             // Begin the frame packet which m_frameIndex point to and get ready to start recording copy command by using this frame packet 
             FramePacket* BeginFramePacket();
             void EndFramePacket(ID3D12CommandQueue* commandQueue);
+            // Returns the frame packet being recorded, or begins a new one if there is none.
+            // Uploads are batched in the same frame packet until it is full or the copy queue runs out of commands.
+            FramePacket* GetRecordingFramePacket();
+            // Ends the frame packet being recorded if no other command is waiting to be batched into it.
+            void EndFramePacketIfIdle(ID3D12CommandQueue* commandQueue);
             bool m_recordingFrame = false;
 
+            // Fences to signal after the frame packet being recorded is submitted
+            AZStd::vector<AZStd::pair<RHI::Ptr<ID3D12Fence>, uint64_t>> m_pendingSignals;
+
             AZStd::vector<FramePacket> m_framePackets; 
             size_t m_frameIndex = 0;
 
@@ -75,11 +75,17 @@ namespace AZ
         {
             m_subAllocatorMutex.lock();
             m_subAllocator.GarbageCollect();
+            m_fragmentation = m_subAllocator.ComputeFragmentation();
             m_subAllocatorMutex.unlock();
 
             m_pageAllocator.Collect();
         }
 
+        float BufferMemoryAllocator::GetFragmentation() const
+        {
+            return m_fragmentation;
+        }
+
         BufferMemoryView BufferMemoryAllocator::Allocate(size_t sizeInBytes, size_t overrideSubAllocAlignment)
         {
             AZ_TRACE_METHOD();
@@ -34,6 +34,9 @@ namespace AZ
 
             void DeAllocate(const BufferMemoryView& memory);
 
+            //! Returns the fragmentation of the pages computed by the last garbage collection.
+            float GetFragmentation() const;
+
         private:
             BufferMemoryView AllocateUnique(const RHI::BufferDescriptor& bufferDescriptor);
 
@@ -46,6 +49,7 @@ namespace AZ
             AZStd::mutex m_subAllocatorMutex;
             MemoryFreeListSubAllocator m_subAllocator;
             size_t m_subAllocationAlignment = Alignment::Buffer;
+            float m_fragmentation = 0.0f;
         };
     }
 }
@@ -242,6 +242,7 @@ namespace AZ
         void BufferPool::OnFrameEnd()
         {
             m_allocator.GarbageCollect();
+            m_memoryUsage.GetHeapMemoryUsage(GetDescriptor().m_heapMemoryLevel).m_fragmentation = m_allocator.GetFragmentation();
             Base::OnFrameEnd();
         }
 
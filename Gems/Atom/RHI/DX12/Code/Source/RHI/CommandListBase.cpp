@@ -122,7 +122,7 @@ namespace AZ
             QueueTransitionBarrier(barrier);
         }
 
-        void CommandListBase::QueueTransitionBarrier(const D3D12_RESOURCE_TRANSITION_BARRIER& transitionBarrier)
+        void CommandListBase::QueueTransitionBarrier(const D3D12_RESOURCE_TRANSITION_BARRIER& transitionBarrier, D3D12_RESOURCE_BARRIER_FLAGS flags)
         {
             if (transitionBarrier.StateBefore != transitionBarrier.StateAfter)
             {
@@ -130,7 +130,7 @@ namespace AZ
 
                 D3D12_RESOURCE_BARRIER& barrierDesc = m_queuedBarriers.back();
                 barrierDesc.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
-                barrierDesc.Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE;
+                barrierDesc.Flags = flags;
                 barrierDesc.Transition = transitionBarrier;
             }
             else if (transitionBarrier.StateBefore == D3D12_RESOURCE_STATE_UNORDERED_ACCESS)
@@ -35,7 +35,7 @@ namespace AZ
 
             void QueueUAVBarrier(ID3D12Resource* resource);
             void QueueTransitionBarrier(ID3D12Resource* resource, D3D12_RESOURCE_STATES stateBefore, D3D12_RESOURCE_STATES stateAfter);
-            void QueueTransitionBarrier(const D3D12_RESOURCE_TRANSITION_BARRIER& barrier);
+            void QueueTransitionBarrier(const D3D12_RESOURCE_TRANSITION_BARRIER& barrier, D3D12_RESOURCE_BARRIER_FLAGS flags = D3D12_RESOURCE_BARRIER_FLAG_NONE);
             void QueueAliasingBarrier(const D3D12_RESOURCE_ALIASING_BARRIER& barrier);
 
             void FlushBarriers();
@@ -90,7 +90,10 @@ namespace AZ
 
             m_commandQueueContext.Init(*this);
 
-            m_asyncUploadQueue.Init(*this, AsyncUploadQueue::Descriptor(RHI::RHISystemInterface::Get()->GetPlatformLimitsDescriptor()->m_platformDefaultValues.m_asyncQueueStagingBufferSizeInBytes));
+            const RHI::PlatformDefaultValues& platformDefaultValues = RHI::RHISystemInterface::Get()->GetPlatformLimitsDescriptor()->m_platformDefaultValues;
+            AsyncUploadQueue::Descriptor asyncUploadQueueDescriptor(platformDefaultValues.m_asyncQueueStagingBufferSizeInBytes);
+            asyncUploadQueueDescriptor.m_frameCount = platformDefaultValues.m_asyncQueueStagingBufferCount;
+            m_asyncUploadQueue.Init(*this, asyncUploadQueueDescriptor);
 
             m_samplerCache.SetCapacity(SamplerCacheCapacity);
 
@@ -20,6 +20,7 @@
 #include <Atom/RHI/ImageScopeAttachment.h>
 #include <Atom/RHI/ScopeAttachment.h>
 #include <Atom/RHI/SwapChainFrameAttachment.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Debug/EventTrace.h>
 
 // #define AZ_DX12_FRAMESCHEDULER_LOG_TRANSITIONS
@@ -28,6 +29,9 @@ namespace AZ
 {
     namespace DX12
     {
+        AZ_CVAR(bool, r_splitResourceBarriers, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Split the transitions of attachments between non-adjacent scopes of the same queue into begin and end barriers.");
+
         AZStd::string GetResourceStateDebugString(D3D12_RESOURCE_STATES state)
         {
             AZStd::string result;
@@ -371,6 +375,25 @@ namespace AZ
             return {};
         }
     
+        void FrameGraphCompiler::QueuePrologueTransition(Scope* previousUsageScope, Scope& scopeAfter, const D3D12_RESOURCE_TRANSITION_BARRIER& transition)
+        {
+            const bool canSplit = r_splitResourceBarriers &&
+                previousUsageScope &&
+                previousUsageScope->GetHardwareQueueClass() == scopeAfter.GetHardwareQueueClass() &&
+                scopeAfter.GetIndex() > previousUsageScope->GetIndex() + 1 &&
+                transition.StateBefore != transition.StateAfter;
+
+            if (canSplit)
+            {
+                previousUsageScope->QueueSplitBeginTransition(transition);
+                scopeAfter.QueueSplitEndTransition(transition);
+            }
+            else
+            {
+                scopeAfter.QueuePrologueTransition(transition);
+            }
+        }
+
         void FrameGraphCompiler::CompileResourceBarriers(Scope* rootScope, const RHI::FrameGraphAttachmentDatabase& attachmentDatabase)
         {
             AZ_ATOM_PROFILE_FUNCTION("RHI", "FrameGraphCompiler: CompileResourceBarriers(DX12)");
@@ -435,6 +458,7 @@ namespace AZ
             buffer.m_initialAttachmentState = D3D12_RESOURCE_STATE_COMMON;
 
             Scope* scopeBefore = rootScope;
+            Scope* previousUsageScope = nullptr;
             while (scopeAttachment)
             {
                 Scope& scopeAfter = static_cast<Scope&>(scopeAttachment->GetScope());
@@ -451,12 +475,13 @@ namespace AZ
                 if (onSameQueue && !inCommonState)
                 {
                     logger.LogPrologueTransition(scopeAfter);
-                    scopeAfter.QueuePrologueTransition(transition);
+                    QueuePrologueTransition(previousUsageScope, scopeAfter, transition);
                 }
 
                 scopeAttachment = scopeAttachment->GetNext();
                 transition.StateBefore = transition.StateAfter;
                 scopeBefore = &scopeAfter;
+                previousUsageScope = &scopeAfter;
                 logger.SetStateBefore(transition.StateBefore);
             }
         }
@@ -522,6 +547,7 @@ namespace AZ
             }
             
             Scope* scopeBefore = nullptr;
+            Scope* previousUsageScope = nullptr;
             while (scopeAttachment)
             {
                 Scope& scopeAfter = static_cast<Scope&>(scopeAttachment->GetScope());
@@ -561,7 +587,7 @@ namespace AZ
                         }
                         else
                         {
-                            scopeAfter.QueuePrologueTransition(transition);
+                            QueuePrologueTransition(previousUsageScope, scopeAfter, transition);
                         }
                     }
 
@@ -669,6 +695,7 @@ namespace AZ
                 scopeAttachment = scopeAttachment->GetNext();
                 image.SetAttachmentState(transition.StateAfter, &viewRange);
                 scopeBefore = &scopeAfter;
+                previousUsageScope = &scopeAfter;
                 logger.SetStateBefore(transition.StateBefore);
             }
 
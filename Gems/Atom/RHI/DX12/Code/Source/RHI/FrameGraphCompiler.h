@@ -47,6 +47,11 @@ namespace AZ
 
             //Returns pre-discard transition state.
             static AZStd::optional<D3D12_RESOURCE_STATES> GetDiscardResourceState(const RHI::ScopeAttachment& scopeAttachment, D3D12_RESOURCE_FLAGS bindflags);
+
+            // Queues the transition of a resource between two consecutive usages. If other scopes of the same queue run
+            // between them, the transition is split so it starts when previousUsageScope ends and only needs to be finished
+            // when scopeAfter begins. Otherwise it's queued in the prologue of scopeAfter.
+            static void QueuePrologueTransition(Scope* previousUsageScope, Scope& scopeAfter, const D3D12_RESOURCE_TRANSITION_BARRIER& transition);
             
             void CompileResourceBarriers(Scope* rootScope, const RHI::FrameGraphAttachmentDatabase& attachmentDatabase);
             void CompileBufferBarriers(Scope* rootScope, RHI::BufferFrameAttachment& frameGraphAttachment);
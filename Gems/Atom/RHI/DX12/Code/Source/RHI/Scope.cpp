@@ -40,6 +40,8 @@ namespace AZ
             m_prologueTransitionBarrierRequests.clear();
             m_epilogueTransitionBarrierRequests.clear();
             m_preDiscardTransitionBarrierRequests.clear();
+            m_splitBeginTransitionBarrierRequests.clear();
+            m_splitEndTransitionBarrierRequests.clear();
             m_resolveTransitionBarrierRequests.clear();
             m_aliasingBarriers.clear();
             m_depthStencilAttachment = nullptr;
@@ -143,6 +145,16 @@ namespace AZ
         {
             m_preDiscardTransitionBarrierRequests.push_back(barrier);
         }
+
+        void Scope::QueueSplitBeginTransition(const D3D12_RESOURCE_TRANSITION_BARRIER& barrier)
+        {
+            m_splitBeginTransitionBarrierRequests.push_back(barrier);
+        }
+
+        void Scope::QueueSplitEndTransition(const D3D12_RESOURCE_TRANSITION_BARRIER& barrier)
+        {
+            m_splitEndTransitionBarrierRequests.push_back(barrier);
+        }
   
         bool Scope::IsInDiscardResourceRequests(ID3D12Resource* nativeResource) const
         {
@@ -322,7 +334,12 @@ namespace AZ
                     commandList.QueueTransitionBarrier(barrier);
                 }
 
-                commandList.FlushBarriers();
+                // The pre-discard transitions only need their own batch when a discard depends on them,
+                // otherwise they are submitted with the rest of the prologue barriers.
+                if (!m_discardResourceRequests.empty())
+                {
+                    commandList.FlushBarriers();
+                }
 
                 for (ID3D12Resource* resource : m_discardResourceRequests)
                 {
@@ -344,6 +361,11 @@ namespace AZ
                     commandList.QueueTransitionBarrier(barrier);
                 }
 
+                for (const auto& barrier : m_splitEndTransitionBarrierRequests)
+                {
+                    commandList.QueueTransitionBarrier(barrier, D3D12_RESOURCE_BARRIER_FLAG_END_ONLY);
+                }
+
                 commandList.FlushBarriers();
                 
                 for (const auto& request : m_clearRenderTargetRequests)
@@ -422,6 +444,12 @@ namespace AZ
                 {
                     commandList.QueueTransitionBarrier(request);
                 }
+
+                // Left queued so they're batched with the barriers of the next scope recorded in the command list.
+                for (const auto& request : m_splitBeginTransitionBarrierRequests)
+                {
+                    commandList.QueueTransitionBarrier(request, D3D12_RESOURCE_BARRIER_FLAG_BEGIN_ONLY);
+                }
             }
 
             PIXEndEvent(commandList.GetCommandList());
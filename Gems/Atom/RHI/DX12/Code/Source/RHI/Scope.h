@@ -47,6 +47,10 @@ namespace AZ
             void QueueResolveTransition(const D3D12_RESOURCE_TRANSITION_BARRIER& transitionBarrier);
             void QueuePreDiscardTransition(const D3D12_RESOURCE_TRANSITION_BARRIER& transitionBarrier);
 
+            // Split transition barriers, begun at the end of a scope and ended at the beginning of a later scope on the same queue.
+            void QueueSplitBeginTransition(const D3D12_RESOURCE_TRANSITION_BARRIER& transitionBarrier);
+            void QueueSplitEndTransition(const D3D12_RESOURCE_TRANSITION_BARRIER& transitionBarrier);
+
             bool HasSignalFence() const;
             bool HasWaitFences() const;
 
@@ -83,6 +87,10 @@ namespace AZ
             AZStd::vector<D3D12_RESOURCE_TRANSITION_BARRIER> m_epilogueTransitionBarrierRequests;
             AZStd::vector<D3D12_RESOURCE_TRANSITION_BARRIER> m_preDiscardTransitionBarrierRequests;
 
+            /// Split transition barriers begun in the epilogue and ended in the prologue of the scope.
+            AZStd::vector<D3D12_RESOURCE_TRANSITION_BARRIER> m_splitBeginTransitionBarrierRequests;
+            AZStd::vector<D3D12_RESOURCE_TRANSITION_BARRIER> m_splitEndTransitionBarrierRequests;
+
             /// A set of transition barriers for resolving a multisample image.
             AZStd::vector<D3D12_RESOURCE_TRANSITION_BARRIER> m_resolveTransitionBarrierRequests;
 
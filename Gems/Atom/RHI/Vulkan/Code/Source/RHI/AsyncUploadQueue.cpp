@@ -99,40 +99,42 @@ namespace AZ
                 AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::AzRender, "Upload Buffer");
                 size_t pendingByteOffset = 0;
                 size_t pendingByteCount = byteCount;
-                FramePacket* framePacket = nullptr;
                 Queue* vulkanQueue = static_cast<Queue*>(queue);
 
-                // Insert a barrier to wait for anybody using this buffer range.
-                // We need to create a command list to insert the barrier.
-                BeginFramePacket(vulkanQueue);
-                EmmitPrologueMemoryBarrier(*buffer, 0, pendingByteCount);
-                EndFramePacket(vulkanQueue);
+                // The prologue barriers, the copies and the epilogue barrier are recorded in the same frame packet
+                // when the data fits in one staging buffer, so small uploads only need one submission.
+                FramePacket* framePacket = BeginFramePacket(vulkanQueue);
 
                 while (pendingByteCount > 0)
                 {
                     AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::AzRender, "Upload Buffer Chunk");
 
-                    framePacket = BeginFramePacket(vulkanQueue);
-                    const size_t bytesToCopy = AZStd::min(pendingByteCount, m_descriptor.m_stagingSizeInBytes);
+                    if (framePacket->m_dataOffset == m_descriptor.m_stagingSizeInBytes)
+                    {
+                        EndFramePacket(vulkanQueue);
+                        framePacket = BeginFramePacket(vulkanQueue);
+                    }
+
+                    const size_t bytesToCopy = AZStd::min(pendingByteCount, m_descriptor.m_stagingSizeInBytes - framePacket->m_dataOffset);
+                    // Wait for anybody using this buffer range.
                     EmmitPrologueMemoryBarrier(*buffer, pendingByteOffset, bytesToCopy);
 
-                    void* mapped = framePacket->m_stagingBuffer->GetBufferMemoryView()->Map(RHI::HostMemoryAccess::Write);
-                    memcpy(mapped, sourceData + pendingByteOffset, bytesToCopy);
+                    uint8_t* mapped = reinterpret_cast<uint8_t*>(framePacket->m_stagingBuffer->GetBufferMemoryView()->Map(RHI::HostMemoryAccess::Write));
+                    memcpy(mapped + framePacket->m_dataOffset, sourceData + pendingByteOffset, bytesToCopy);
                     framePacket->m_stagingBuffer->GetBufferMemoryView()->Unmap(RHI::HostMemoryAccess::Write);
 
                     RHI::CopyBufferDescriptor copyDescriptor;
                     copyDescriptor.m_sourceBuffer = framePacket->m_stagingBuffer.get();
-                    copyDescriptor.m_sourceOffset = 0;
+                    copyDescriptor.m_sourceOffset = framePacket->m_dataOffset;
                     copyDescriptor.m_destinationBuffer = buffer;
                     copyDescriptor.m_destinationOffset = static_cast<uint32_t>(pendingByteOffset);
                     copyDescriptor.m_size = static_cast<uint32_t>(bytesToCopy);
 
                     m_commandList->Submit(RHI::CopyItem(copyDescriptor));
 
+                    framePacket->m_dataOffset += static_cast<uint32_t>(bytesToCopy);
                     pendingByteOffset += bytesToCopy;
                     pendingByteCount -= bytesToCopy;
-
-                    EndFramePacket(vulkanQueue);
                 }
 
                 AZStd::vector<Fence*> fencesToSignal;
@@ -370,7 +372,6 @@ namespace AZ
 
                 // Set pipeline barriers after the copy.
                 VkPipelineStageFlags waitStage = GetResourcePipelineStateFlags(image->GetDescriptor().m_bindFlags) & device.GetSupportedPipelineStageFlags();
-                EndFramePacket(vulkanQueue);
                 ProcessEndOfUpload(
                     vulkanQueue,
                     waitStage,
@@ -50,7 +50,7 @@ namespace AZ
             {
                 Device* m_device = nullptr;
                 size_t m_stagingSizeInBytes = RHI::DefaultValues::Memory::AsyncQueueStagingBufferSizeInBytes;
-                uint32_t m_frameCount = RHI::Limits::Device::FrameCountMax;
+                uint32_t m_frameCount = RHI::DefaultValues::Memory::AsyncQueueStagingBufferCount;
 
                 Descriptor() = default;
                 Descriptor(size_t stagingSizeInBytes);
@@ -100,6 +100,7 @@ namespace AZ
 
             // Handles the end of the upload. This includes emitting the epilogue barriers and doing any
             // necessary cross queue synchronization and ownership transfer (if needed).
+            // The epilogue is recorded in the frame packet being recorded if there is one, so the upload is a single submission.
             template<typename ...Args>
             void ProcessEndOfUpload(
                 Queue* queue,
@@ -128,7 +129,10 @@ namespace AZ
             const AZStd::vector<Fence*> fencesToSignal,
             Args&& ...args)
         {
-            BeginFramePacket(queue);
+            if (!m_recordingFrame)
+            {
+                BeginFramePacket(queue);
+            }
 
             EmmitEpilogueMemoryBarrier(
                 *m_commandList,
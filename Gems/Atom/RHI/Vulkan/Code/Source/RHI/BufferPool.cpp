@@ -32,6 +32,8 @@ namespace AZ
         void BufferPool::GarbageCollect()
         {
             m_memoryAllocator.GarbageCollect();
+            m_memoryUsage.GetHeapMemoryUsage(m_memoryAllocator.GetDescriptor().m_heapMemoryLevel).m_fragmentation =
+                m_memoryAllocator.GetFragmentation();
         }
 
         BufferPoolResolver* BufferPool::GetResolver()
@@ -88,7 +88,7 @@ namespace AZ
         {
             m_descriptor = descriptor;
             AZ_Assert(m_isInitialized == false, "CommandListAllocator already initialized!");
-            AZ_Assert(descriptor.m_frameCountMax <= MaxFamilyQueueCount, "Too many family types");
+            AZ_Assert(descriptor.m_familyQueueCount <= MaxFamilyQueueCount, "Too many family types");
 
             for (uint32_t queueFamilyIndex = 0; queueFamilyIndex < m_descriptor.m_familyQueueCount; ++queueFamilyIndex)
             {
@@ -118,7 +118,9 @@ namespace AZ
 
         void CommandListAllocator::Collect()
         {
-            for (uint32_t queueIdx = 0; queueIdx < RHI::HardwareQueueClassCount; ++queueIdx)
+            // Queue family indices aren't limited to the number of hardware queue classes, so every family
+            // needs to recycle its per thread command pools.
+            for (uint32_t queueIdx = 0; queueIdx < m_descriptor.m_familyQueueCount; ++queueIdx)
             {
                 m_commandListSubAllocators[queueIdx].ForEach([](Internal::CommandListSubAllocator& commandListSubAllocator)
                 {
@@ -133,7 +135,7 @@ namespace AZ
         {
             if (m_isInitialized)
             {
-                for (uint32_t queueIdx = 0; queueIdx < RHI::HardwareQueueClassCount; ++queueIdx)
+                for (uint32_t queueIdx = 0; queueIdx < m_descriptor.m_familyQueueCount; ++queueIdx)
                 {
                     m_commandListSubAllocators[queueIdx].ForEach([](Internal::CommandListSubAllocator& commandListSubAllocator)
                     {
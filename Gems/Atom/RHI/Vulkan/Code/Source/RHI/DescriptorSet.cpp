@@ -77,8 +77,14 @@ namespace AZ
             }
             else
             {
+                // Only acceleration structure descriptors need the native acceleration structures, so other buffer
+                // descriptors don't allocate them on every compile.
+                const bool isAccelerationStructure = type == VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR;
                 data.m_bufferViewsInfo.resize(bufViews.size());
-                data.m_accelerationStructures.resize(bufViews.size());
+                if (isAccelerationStructure)
+                {
+                    data.m_accelerationStructures.resize(bufViews.size());
+                }
                 for (size_t i = 0; i < bufViews.size(); ++i)
                 {
                     VkDescriptorBufferInfo bufferInfo = {};
@@ -109,7 +115,7 @@ namespace AZ
                     data.m_bufferViewsInfo[i] = bufferInfo;
                     
                     // if this is a buffer view of a RayTracingTLAS we need to store the vkAccelerationStructureKHR with it
-                    if (bufferView && (type == VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR))
+                    if (bufferView && isAccelerationStructure)
                     {
                         data.m_accelerationStructures[i] = static_cast<const BufferView&>(*bufferView.get()).GetNativeAccelerationStructure();
                     }
@@ -176,6 +182,7 @@ namespace AZ
             data.m_layoutIndex = layoutIndex;
 
             VkDescriptorImageInfo imageInfo = {};
+            data.m_imageViewsInfo.reserve(samplers.size());
             for (const RHI::SamplerState& samplerState : samplers)
             {
                 Sampler::Descriptor samplerDesc;
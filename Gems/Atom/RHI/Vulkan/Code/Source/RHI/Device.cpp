@@ -419,8 +419,10 @@ namespace AZ
             if (!m_asyncUploadQueue)
             {
                 m_asyncUploadQueue = aznew AsyncUploadQueue();
-                AsyncUploadQueue::Descriptor asyncUploadQueueDescriptor(RHI::RHISystemInterface::Get()->GetPlatformLimitsDescriptor()->m_platformDefaultValues.m_asyncQueueStagingBufferSizeInBytes);
+                const RHI::PlatformDefaultValues& platformDefaultValues = RHI::RHISystemInterface::Get()->GetPlatformLimitsDescriptor()->m_platformDefaultValues;
+                AsyncUploadQueue::Descriptor asyncUploadQueueDescriptor(platformDefaultValues.m_asyncQueueStagingBufferSizeInBytes);
                 asyncUploadQueueDescriptor.m_device = this;
+                asyncUploadQueueDescriptor.m_frameCount = platformDefaultValues.m_asyncQueueStagingBufferCount;
                 m_asyncUploadQueue->Init(asyncUploadQueueDescriptor);
             }
 
@@ -26,6 +26,8 @@ namespace AZ
         void ImagePool::GarbageCollect()
         {
             m_memoryAllocator.GarbageCollect();
+            m_memoryUsage.GetHeapMemoryUsage(m_memoryAllocator.GetDescriptor().m_heapMemoryLevel).m_fragmentation =
+                m_memoryAllocator.GetFragmentation();
         }
 
         void ImagePool::OnFrameEnd()
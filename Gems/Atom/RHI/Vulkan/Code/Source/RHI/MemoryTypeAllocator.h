@@ -47,6 +47,9 @@ namespace AZ
 
             const Descriptor& GetDescriptor() const;
 
+            //! Returns the fragmentation of the pages computed by the last garbage collection.
+            float GetFragmentation() const;
+
         private:
             View AllocateUnique(const uint64_t sizeInBytes);
 
@@ -59,6 +62,7 @@ namespace AZ
             PageAllocator m_pageAllocator;
             AZStd::mutex m_subAllocatorMutex;
             SubAllocator m_subAllocator;
+            float m_fragmentation = 0.0f;
         };
 
         template<typename SubAllocator, typename View>
@@ -99,6 +103,7 @@ namespace AZ
             {
                 AZStd::lock_guard<AZStd::mutex> lock(m_subAllocatorMutex);
                 m_subAllocator.GarbageCollect();
+                m_fragmentation = m_subAllocator.ComputeFragmentation();
             }
 
             m_pageAllocator.Collect();
@@ -151,6 +156,12 @@ namespace AZ
             return m_descriptor;
         }
 
+        template<typename SubAllocator, typename View>
+        float MemoryTypeAllocator<SubAllocator, View>::GetFragmentation() const
+        {
+            return m_fragmentation;
+        }
+
         template<typename SubAllocator, typename View>
         View MemoryTypeAllocator<SubAllocator, View>::AllocateUnique(const uint64_t sizeInBytes)
         {
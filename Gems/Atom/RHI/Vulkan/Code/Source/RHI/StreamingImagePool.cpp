@@ -191,6 +191,8 @@ namespace AZ
         void StreamingImagePool::OnFrameEnd()
         {
             m_memoryAllocator.GarbageCollect();
+            m_memoryUsage.GetHeapMemoryUsage(m_memoryAllocator.GetDescriptor().m_heapMemoryLevel).m_fragmentation =
+                m_memoryAllocator.GetFragmentation();
             Base::OnFrameEnd();
         }
 
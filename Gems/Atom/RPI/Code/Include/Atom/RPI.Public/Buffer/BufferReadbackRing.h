@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ * 
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <Atom/RHI/FrameGraphInterface.h>
+#include <Atom/RHI.Reflect/Limits.h>
+#include <Atom/RPI.Public/Buffer/Buffer.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/string/string_view.h>
+
+namespace AZ
+{
+    namespace RHI
+    {
+        class Fence;
+    }
+
+    namespace RPI
+    {
+        //! A ring of readback buffers for small values the GPU writes every frame and the CPU reads a few frames later.
+        //! Each copy targets its own buffer and signals its own fence, the CPU only maps buffers whose fence is already
+        //! signaled so it never waits for the GPU. When every buffer is still in flight the copy of the frame is skipped.
+        class BufferReadbackRing
+        {
+        public:
+            static constexpr uint32_t SlotCount = RHI::Limits::Device::FrameCountMax;
+
+            BufferReadbackRing() = default;
+            ~BufferReadbackRing();
+
+            //! Creates the readback buffers and their fences.
+            bool Init(AZStd::string_view name, uint32_t byteCount);
+            void Shutdown();
+            bool IsInitialized() const;
+
+            //! Returns the buffer to copy the data of this frame to, nullptr if no buffer is available and the copy should be skipped.
+            RHI::Buffer* BeginCopy();
+
+            //! Signals the fence of the buffer returned by BeginCopy() when the copy scope completes.
+            //! Called from the SetupFrameGraphDependencies() of the scope doing the copy.
+            void SignalCopyComplete(RHI::FrameGraphInterface frameGraph);
+
+            //! Copies the data of the most recent completed copy, without waiting for the GPU.
+            //! @return false if no copy has completed since the last call
+            bool ReadLatest(void* outData, uint32_t byteCount);
+
+        private:
+            enum class SlotState : uint32_t
+            {
+                Free,
+                InFlight,
+                Ready
+            };
+
+            struct Slot
+            {
+                Data::Instance<Buffer> m_buffer;
+                RHI::Ptr<RHI::Fence> m_fence;
+                SlotState m_state = SlotState::Free;
+                uint64_t m_copyIndex = 0;
+            };
+
+            //! Moves the slots whose copy completed to the ready state.
+            void PollFences();
+
+            static constexpr uint32_t InvalidSlot = SlotCount;
+
+            AZStd::array<Slot, SlotCount> m_slots;
+            uint32_t m_byteCount = 0;
+            uint32_t m_copySlot = InvalidSlot;
+            uint64_t m_copyCount = 0;
+        };
+    }   // namespace RPI
+}   // namespace AZ
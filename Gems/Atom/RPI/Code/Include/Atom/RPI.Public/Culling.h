@@ -13,6 +13,7 @@
 #include <AzCore/RTTI/RTTI.h>
 #include <AzCore/Interface/Interface.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/containers/small_vector.h>
 #include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/parallel/mutex.h>
 
@@ -26,6 +27,7 @@
 #include <AzFramework/Visibility/IVisibilitySystem.h>
 
 #include <Atom/RPI.Public/View.h>
+#include <Atom/RPI.Public/Image/StreamingImage.h>
 #include <Atom/RHI/DrawList.h>
 
 #include <AtomCore/std/parallel/concurrency_checker.h>
@@ -45,6 +47,7 @@ namespace AZ
 
     namespace RPI
     {
+        class Model;
         class Scene;
 
         struct Cullable
@@ -78,11 +81,19 @@ namespace AZ
                 {
                     float m_screenCoverageMin;
                     float m_screenCoverageMax;
-                    AZStd::vector<const RHI::DrawPacket*> m_drawPackets;
+                    //! Most meshes have a handful of draw packets per lod, keep them inline so a cullable doesn't allocate per lod
+                    AZStd::small_vector<const RHI::DrawPacket*, 4> m_drawPackets;
+                    //! Streaming images sampled by the draw packets. Each time the lod is added to a view, their target mip
+                    //! is set from the projected size of the lod.
+                    AZStd::vector<Data::Instance<StreamingImage>> m_streamingImages;
                 };
 
                 AZStd::vector<Lod> m_lods;
 
+                //! Optional model the lods are drawn from. If it streams its lods, the lods selected in views are requested from it,
+                //! and until they are resident the closest less detailed lod with draw packets is drawn instead.
+                Model* m_model = nullptr;
+
                 //! Used for determining which lod(s) to select (usually is smaller than the bounding sphere radius)
                 //! Suggest setting to: 0.5f*localAabb.GetExtents().GetMaxElement()
                 float m_lodSelectionRadius = 1.0f;
@@ -230,6 +241,26 @@ namespace AZ
             //! Sets a list of occlusion planes to be used during the culling process.
             void SetOcclusionPlanes(const OcclusionPlaneVector& occlusionPlanes) { m_occlusionPlanes = occlusionPlanes; }
 
+            //! A low poly mesh that occludes the objects behind it, e.g. the walls of a building.
+            //! The mesh has to be fully contained by the geometry it represents, otherwise objects that are visible can be culled.
+            struct OcclusionMesh
+            {
+                // Object space vertex positions, three floats per vertex
+                AZStd::vector<float> m_positions;
+                // Three indices per triangle, the triangles are rendered double-sided
+                AZStd::vector<uint32_t> m_indices;
+
+                Matrix4x4 m_objectToWorld = Matrix4x4::CreateIdentity();
+
+                // World space bounds of the mesh
+                Aabb m_aabb = Aabb::CreateNull();
+            };
+            using OcclusionMeshVector = AZStd::vector<OcclusionMesh>;
+
+            //! Sets a list of occlusion meshes to be rendered into the occlusion buffer of each view during the culling process.
+            //! The meshes closest to the view are rendered first, up to r_occlusionMeshTriangleBudget triangles per view.
+            void SetOcclusionMeshes(const OcclusionMeshVector& occlusionMeshes) { m_occlusionMeshes = occlusionMeshes; }
+
             //! Notifies the CullingScene that culling will begin for this frame.
             void BeginCulling(const AZStd::vector<ViewPtr>& views);
 
@@ -266,11 +297,15 @@ namespace AZ
         protected:
             size_t CountObjectsInScene();
 
+            //! Renders the visible occlusion meshes into the occlusion buffer of the view.
+            void RenderOcclusionMeshes(View& view, const Frustum& frustum, MaskedOcclusionCulling& maskedOcclusionCulling) const;
+
             const Scene* m_parentScene = nullptr;
             AzFramework::IVisibilityScene* m_visScene = nullptr;
             CullingDebugContext m_debugCtx;
             AZStd::concurrency_checker m_cullDataConcurrencyCheck;
             OcclusionPlaneVector m_occlusionPlanes;
+            OcclusionMeshVector m_occlusionMeshes;
         };
         
 
@@ -15,6 +15,8 @@
 #include <Atom/RPI.Public/Base.h>
 #include <Atom/RPI.Public/Buffer/Buffer.h>
 
+#include <AzCore/std/parallel/atomic.h>
+
 
 namespace AZ
 {
@@ -28,6 +30,9 @@ namespace AZ
         //! Limitation: the allocation may fail if the request buffer size is larger than the ring buffer size or
         //!     there isn't enough unused memory available within the ring buffer. User may increase the input of Init(ringBufferSize)
         //!     to increase the ring buffer's size. 
+        //! Allocate can be called from any thread without locking. Small allocations are served from a chunk of the ring buffer
+        //! owned by the calling thread, which is refilled from the ring buffer with an atomic operation. FrameEnd, Init and Shutdown
+        //! must not be called while other threads are allocating.
         class DynamicBufferAllocator
         {
             AZ_RTTI(AZ::RPI::DynamicBufferAllocator, "{82B047B3-C845-4F77-9852-747E39C53081}");
@@ -44,6 +49,7 @@ namespace AZ
 
             //! Allocate a dynamic buffer with specified size and alignment
             //! It may return nullptr if the input size is larger than ring buffer size or there isn't enough unused memory available within the ring buffer
+            //! This function is thread safe.
             RHI::Ptr<DynamicBuffer> Allocate(uint32_t size, uint32_t alignment);
 
             //! Get an IndexBufferView for a DynamicBuffer used as an index buffer
@@ -58,16 +64,36 @@ namespace AZ
             //! Enable/disable buffer allocation warning if allocation fails
             void SetEnableAllocationWarning(bool enable);
 
+            //! Returns the number of bytes allocated from the ring buffer in the last finished frame, including the unused parts of the threads' chunks
+            uint32_t GetLastFrameAllocatedSize() const;
+
+            //! Returns the highest number of bytes allocated from the ring buffer in a single frame since initialization
+            uint32_t GetPeakFrameAllocatedSize() const;
+
+            uint32_t GetRingBufferSize() const;
+
         private:
             // Get buffer's offset;
             uint32_t GetBufferAddressOffset(RHI::Ptr<DynamicBuffer> dynamicBuffer);
 
-            // The position where the buffer is available.
-            uint32_t m_currentPosition = 0;
+            // Allocate a range of the ring buffer and return its position. Returns false if there isn't enough memory available.
+            bool AllocateFromRing(uint32_t size, uint32_t& allocatePosition, bool reportFailure = true);
+
+            // Allocate a range from the chunk of the calling thread, refilling the chunk from the ring buffer if needed.
+            bool AllocateFromThreadChunk(uint32_t size, uint32_t alignment, uint32_t& allocatePosition);
+
+            // The state of the ring buffer which is updated with atomic operations so threads can allocate without locking.
+            // The lower 32 bits are the position where the buffer is available, the upper 32 bits are the allocated size of current frame.
+            AZStd::atomic<uint64_t> m_ringState{ 0 };
             // The upper bound limit of the allocation of current frame 
             uint32_t m_endPositionLimit = 0;
-            // The allocated buffer size of current frame
-            uint32_t m_currentAllocatedSize = 0;
+
+            // Identifies the current frame of this allocator. Chunks of threads with a different epoch are out of date.
+            AZStd::atomic<uint64_t> m_epoch{ 0 };
+
+            // Allocation statistics
+            uint32_t m_lastFrameAllocatedSize = 0;
+            uint32_t m_peakFrameAllocatedSize = 0;
 
             uint32_t m_ringBufferSize = 0;
             void* m_ringBufferStartAddress = 0;
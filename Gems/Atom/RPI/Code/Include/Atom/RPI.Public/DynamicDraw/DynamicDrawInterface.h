@@ -33,6 +33,14 @@ namespace AZ
             uint32_t m_indexCount = 0;
         };
 
+        //! Usage of the ring buffer that dynamic buffers are allocated from, in bytes
+        struct DynamicBufferStatistics
+        {
+            uint32_t m_ringBufferSize = 0;
+            uint32_t m_lastFrameAllocatedSize = 0;
+            uint32_t m_peakFrameAllocatedSize = 0; //!< The high-water mark of the allocated size of a frame
+        };
+
         //! Interface of dynamic draw system which provide access to system dynamic buffer
         //! and some draw functions
         class DynamicDrawInterface
@@ -59,8 +67,12 @@ namespace AZ
 
             //! Get a DynamicBuffer from DynamicDrawSystem.
             //! The returned buffer will be invalidated every time the RPISystem's RenderTick is called
+            //! This function is thread safe and can be called from jobs.
             virtual RHI::Ptr<DynamicBuffer> GetDynamicBuffer(uint32_t size, uint32_t alignment = 1) = 0;
 
+            //! Get the usage of the dynamic buffer memory
+            virtual DynamicBufferStatistics GetDynamicBufferStatistics() const = 0;
+
             //! Draw a geometry to a scene with a given material
             virtual void DrawGeometry(Data::Instance<Material> material, const GeometryData& geometry, ScenePtr scene) = 0;
 
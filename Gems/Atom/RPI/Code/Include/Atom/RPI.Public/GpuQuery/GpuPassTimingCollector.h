@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ * 
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <Atom/RPI.Public/GpuQuery/GpuQueryTypes.h>
+
+#include <AzCore/Name/Name.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/time.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        class Pass;
+        class ParentPass;
+
+        //! The GPU timing of a pass, averaged over the last frames
+        struct GpuPassTiming
+        {
+            Name m_passPath;
+            uint64_t m_averageDurationInNanoseconds = 0;
+            uint64_t m_latestDurationInNanoseconds = 0;
+            uint64_t m_maxDurationInNanoseconds = 0; //!< The highest duration of the averaged frames
+            PipelineStatisticsResult m_latestPipelineStatistics;
+        };
+
+        //! The GPU timestamps of the passes of a single frame
+        struct GpuFrameTimestamps
+        {
+            struct PassTimestamp
+            {
+                Name m_passPath;
+                uint64_t m_beginInMicroseconds = 0; //!< Relative to the earliest pass of the frame
+                uint64_t m_durationInMicroseconds = 0;
+            };
+
+            //! The CPU time at which the results were collected. The GPU clock isn't calibrated against the CPU clock,
+            //! and the frame was executed on the GPU a few frames before its results became available.
+            AZStd::sys_time_t m_collectedTick = 0;
+            //! The passes with results, in pass hierarchy order, so parent passes precede their children
+            AZStd::vector<PassTimestamp> m_passTimestamps;
+        };
+
+        //! Enables the timestamp and pipeline statistics queries of all passes in the pass hierarchy, including passes that
+        //! are added to it later, and keeps rolling averages of their results.
+        //! The collector is owned by the pass system and can be toggled with the r_gpuPassTiming cvar.
+        class GpuPassTimingCollector
+        {
+        public:
+            //! The number of frames the timings are averaged over
+            static constexpr uint32_t RollingAverageFrameCount = 64;
+            //! The number of frames the per frame timestamps are kept for, about ten seconds at 60 frames per second
+            static constexpr uint32_t FrameHistoryCount = 600;
+
+            void SetEnabled(bool enable);
+            bool IsEnabled() const;
+
+            //! Enables the queries of the passes in the hierarchy if the collector is enabled. Queries of passes that were
+            //! removed from the hierarchy are disabled when the collector is disabled again.
+            //! @param hierarchyChanged Whether passes were built since the last call. Queries are only updated if they changed.
+            void UpdateQueries(ParentPass& rootPass, bool hierarchyChanged);
+
+            //! Adds the latest query results of all passes to the rolling averages. Passes that are no longer part of the
+            //! hierarchy are dropped.
+            void CollectResults(const ParentPass& rootPass);
+
+            //! Returns the timings of all passes with results, in pass hierarchy order
+            AZStd::vector<GpuPassTiming> GetPassTimings() const;
+
+            //! Returns the timestamps of the frames whose results were collected at or after startTick, from the oldest
+            //! to the most recent frame
+            AZStd::vector<GpuFrameTimestamps> GetFrameTimestamps(AZStd::sys_time_t startTick) const;
+
+        private:
+            struct PassSamples
+            {
+                AZStd::array<uint64_t, RollingAverageFrameCount> m_durations = {};
+                uint64_t m_durationSum = 0;
+                uint32_t m_sampleCount = 0;
+                uint32_t m_nextSample = 0;
+                uint32_t m_order = 0;
+                uint64_t m_lastCollectedFrame = 0;
+                PipelineStatisticsResult m_latestPipelineStatistics;
+            };
+
+            struct PassBeginTick
+            {
+                uint64_t m_beginInTicks = 0;
+                RHI::HardwareQueueClass m_hardwareQueueClass = RHI::HardwareQueueClass::Graphics;
+            };
+
+            void CollectResultsRecursively(const Pass& pass, uint32_t& order, GpuFrameTimestamps& frameTimestamps);
+
+            AZStd::unordered_map<Name, PassSamples> m_passSamples;
+            uint64_t m_frameCounter = 0;
+
+            // Ring buffer of the timestamps of the last frames
+            AZStd::vector<GpuFrameTimestamps> m_frameHistory;
+            uint32_t m_nextHistoryFrame = 0;
+            // The begin ticks of the passes of the frame that is being collected, converted after all passes are collected
+            AZStd::vector<PassBeginTick> m_passBeginTicks;
+            bool m_enabled = false;
+            // Whether the queries of the hierarchy need to be updated regardless of hierarchy changes
+            bool m_queriesDirty = false;
+        };
+    }   // namespace RPI
+}   // namespace AZ
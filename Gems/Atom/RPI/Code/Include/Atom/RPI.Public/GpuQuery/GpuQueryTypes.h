@@ -44,6 +44,7 @@ namespace AZ
             uint64_t GetDurationInNanoseconds() const;
             uint64_t GetDurationInTicks() const;
             uint64_t GetTimestampBeginInTicks() const;
+            RHI::HardwareQueueClass GetHardwareQueueClass() const;
 
             void Add(const TimestampResult& extent);
 
@@ -17,6 +17,10 @@ namespace AZ
 {
     namespace RPI
     {
+        //! Streams the mips of each image the views request through StreamingImage::SetTargetMip(), the images most
+        //! below their requested mip first. Mips no view requested for a while are trimmed, and so are the least needed
+        //! ones when the resident mips exceed r_streamingImageMemoryBudgetMB. Images no view requests mips for are
+        //! fully streamed in.
         class DefaultStreamingImageController final
             : public StreamingImageController
         {
@@ -38,8 +42,21 @@ namespace AZ
             void UpdateInternal(size_t timestamp, const StreamingImageContextList& contexts) override;
             ///////////////////////////////////////////////////////////////////
 
-            // A work queue for doing initial setup after an image is attached.
-            AZStd::vector<StreamingImageContextPtr> m_recentlyAttachedContexts;
+            class Context final
+                : public StreamingImageContext
+            {
+            public:
+                AZ_CLASS_ALLOCATOR(Context, AZ::ThreadPoolAllocator, 0);
+
+                // Whether a view ever requested a mip of the image
+                bool m_hasTargetMip = false;
+
+                // The last timestamp every resident mip of the image was needed
+                size_t m_residentMipsNeededTimestamp = 0;
+            };
+
+            // The contexts of the attached images, contexts of detached images are dropped on the next update.
+            AZStd::vector<AZStd::intrusive_ptr<Context>> m_imageContexts;
         };
     }
 }
@@ -114,6 +114,12 @@ namespace AZ
             //! Returns the most detailed mip level currently resident in memory, where a value of 0 is the highest detailed mip.
             uint16_t GetResidentMipLevel();
 
+            //! Returns the index of the mip chain holding the provided mip level.
+            size_t GetMipChainIndex(size_t mipLevel) const;
+
+            //! Returns the most detailed mip level of the provided mip chain.
+            size_t GetMipLevel(size_t mipChainIndex) const;
+
         private:
             StreamingImage() = default;
 
@@ -99,6 +99,11 @@ namespace AZ
             //! This gets incremented every time a change is made, like by calling SetPropertyValue().
             ChangeId GetCurrentChangeId() const;
 
+            //! Returns an ID that only changes when the shader collection changes, like when a shader option, an enabled shader, a draw list
+            //! or a render state is modified, or when the material is reinitialized. Changes that only affect SRG data don't increment it,
+            //! so clients that bake the shader collection (like draw packets) can skip rebuilding it.
+            ChangeId GetShaderCollectionChangeId() const;
+
             //! Return the set of shaders to be run by this material.
             const ShaderCollection& GetShaderCollection() const;
 
@@ -186,6 +191,9 @@ namespace AZ
             //! code can use to initialize a ChangeId that is immediately dirty).
             ChangeId m_currentChangeId = DEFAULT_CHANGE_ID + 1;
 
+            //! Tracks each change made to the shader collection, see GetShaderCollectionChangeId().
+            ChangeId m_shaderCollectionChangeId = DEFAULT_CHANGE_ID + 1;
+
             //! Records the m_currentChangeId when the material was last compiled.
             ChangeId m_compiledChangeId = DEFAULT_CHANGE_ID;
         };
@@ -47,7 +47,7 @@ namespace AZ
             void SetSortKey(RHI::DrawItemSortKey sortKey) { m_sortKey = sortKey; };
             bool SetShaderOption(const Name& shaderOptionName, RPI::ShaderOptionValue value);
 
-            Data::Instance<Material> GetMaterial();
+            Data::Instance<Material> GetMaterial() const;
 
         private:
             bool DoUpdate(const Scene& parentScene);
@@ -87,6 +87,9 @@ namespace AZ
             // Set the stencil value for this draw packet
             uint8_t m_stencilRef = 0;
 
+            // Whether a shader fell back to its root variant while the pipeline state of its final variant is compiled
+            bool m_hasPendingPipelineStates = false;
+
             //! A map matches the index of UV names of this material to the custom names from the model.
             MaterialModelUvOverrideMap m_materialModelUvMap;
 
@@ -18,6 +18,7 @@
 
 #include <AzCore/std/containers/fixed_vector.h>
 #include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/parallel/atomic.h>
 
 namespace AZ
 {
@@ -33,7 +34,7 @@ namespace AZ
 
             static Data::Instance<Model> FindOrCreate(const Data::Asset<ModelAsset>& modelAsset);
 
-            ~Model() = default;
+            ~Model();
 
             //! Blocks the CPU until the streaming upload is complete. Returns immediately if no
             //! streaming upload is currently pending.
@@ -43,8 +44,24 @@ namespace AZ
             size_t GetLodCount() const;
 
             //! Returns the full list of Lods, where index 0 is the most detailed, and N-1 is the least.
+            //! When the lods of the model are streamed, only the least detailed lod is always resident and the entries of the
+            //! other lods are null until they are requested and streamed in.
             AZStd::array_view<Data::Instance<ModelLod>> GetLods() const;
 
+            //! Returns whether the lod at the provided index is resident.
+            bool IsLodResident(size_t lodIndex) const;
+
+            //! Requests the lod at the provided index to be resident. It is streamed in by the next ModelSystem update if the
+            //! mesh memory budget allows it, and streamed out once it hasn't been requested for a while.
+            //! This is thread safe, culling calls it for the lods selected in views.
+            void RequestLod(size_t lodIndex);
+
+            //! Returns an id which changes each time a lod is streamed in or out.
+            uint32_t GetLodResidencyChangeId() const;
+
+            //! Makes all the lods resident and stops streaming them. Used by models whose lods are selected outside of culling.
+            void DisableLodStreaming();
+
             //! Returns whether a buffer upload is pending.
             bool IsUploadPending() const;
 
@@ -93,7 +110,19 @@ namespace AZ
             static Data::Instance<Model> CreateInternal(ModelAsset& modelAsset);
             RHI::ResultCode Init(ModelAsset& modelAsset);
 
+            // Functions used by the ModelSystem to stream the lods...
+
+            //! Returns a mask of the lods requested since the last call.
+            uint32_t ConsumeRequestedLods();
+
+            //! Returns the size of the gpu buffers of a lod.
+            size_t GetLodMemorySize(size_t lodIndex) const;
+
+            bool StreamInLod(size_t lodIndex);
+            void StreamOutLod(size_t lodIndex);
+
             AZStd::fixed_vector<Data::Instance<ModelLod>, ModelLodAsset::LodCountMax> m_lods;
+            AZStd::fixed_vector<size_t, ModelLodAsset::LodCountMax> m_lodMemorySizes;
             Data::Asset<ModelAsset> m_modelAsset;
 
             AZStd::unordered_set<AZ::Name> m_uvNames;
@@ -101,6 +130,10 @@ namespace AZ
             // Tracks whether buffers have all been streamed up to the GPU.
             bool m_isUploadPending = false;
 
+            bool m_isStreamingLods = false;
+            AZStd::atomic<uint32_t> m_requestedLodsMask{ 0 };
+            uint32_t m_lodResidencyChangeId = 0;
+
             AZ::Aabb m_aabb;
         };
     } // namespace RPI
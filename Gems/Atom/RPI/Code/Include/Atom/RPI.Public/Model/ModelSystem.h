@@ -7,6 +7,11 @@
 #pragma once
 
 #include <Atom/RPI.Reflect/Asset/AssetHandler.h>
+#include <Atom/RPI.Reflect/Model/ModelLodAsset.h>
+
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
 
 namespace AZ
 {
@@ -14,15 +19,40 @@ namespace AZ
 
     namespace RPI
     {
+        class Model;
+
         //! Manages system-wide initialization and support for Model classes
         class ModelSystem
         {
+            friend class Model;
         public:
             static void Reflect(AZ::ReflectContext* context);
             static void GetAssetHandlers(AssetHandlerPtrList& assetHandlers);
 
             void Init();
             void Shutdown();
+
+            //! Streams the lods of the models in and out from the lods culling requested since the last update,
+            //! within the mesh memory budget.
+            void Update();
+
+        private:
+            struct StreamingModel
+            {
+                Model* m_model = nullptr;
+                //! The last update in which each lod was requested
+                AZStd::array<uint64_t, ModelLodAsset::LodCountMax> m_lodRequestedUpdates{};
+            };
+
+            //! Returns false if there is no model system to stream the lods of the model.
+            static bool RegisterStreamingModel(Model* model);
+            static void UnregisterStreamingModel(Model* model);
+
+            static ModelSystem* s_modelSystem;
+
+            AZStd::mutex m_streamingModelsMutex;
+            AZStd::vector<StreamingModel> m_streamingModels;
+            uint64_t m_updateIndex = 0;
         };
     } // namespace RPI
 } // namespace AZ
@@ -143,6 +143,9 @@ namespace AZ
             void SetEnabled(bool enabled);
             virtual bool IsEnabled() const;
 
+            //! Returns whether the pass is skipped when rendering because no other pass consumes its outputs.
+            bool IsPruned() const;
+
             bool HasDrawListTag() const;
             bool HasPipelineViewTag() const;
 
@@ -438,6 +441,9 @@ namespace AZ
 
                         // Whether the pass should gather pipeline statics
                         uint64_t m_pipelineStatisticsQueryEnabled : 1;
+
+                        // Whether the pass system found that no other pass consumes the outputs of this pass, see PassSystem::PrunePasses()
+                        uint64_t m_pruned : 1;
                     };
                     uint64_t m_allFlags = 0;
                 };
@@ -50,6 +50,9 @@ namespace AZ
             //! @param updateImportedAttachments - Imported attchments will only update if this is true.
             void Update(bool updateImportedAttachments = false);
 
+            //! Returns the size the image attachment would have without the render scale of the pipeline
+            RHI::Size GetUnscaledImageSize() const;
+
             //! Sets all formats to nearest device supported formats and warns if changes where made
             void ValidateDeviceFormats(const AZStd::vector<RHI::Format>& formatFallbacks, RHI::FormatCapabilities capabilities = RHI::FormatCapabilities::None);
 
@@ -84,6 +87,13 @@ namespace AZ
             //! Multiply source size by these values to obtain new size
             PassAttachmentSizeMultipliers m_sizeMultipliers;
 
+            //! Whether the size follows the render scale of the pipeline
+            PassAttachmentRenderScale m_renderScale = PassAttachmentRenderScale::Inherit;
+
+            //! The size of the image without the render scale, only valid if m_isRenderScaled is true
+            RHI::Size m_unscaledImageSize;
+            bool m_isRenderScaled = false;
+
             //! The source attachment from which to derive this attachment's array size
             //! If null, keep this attachment's array size as is
             const PassAttachmentBinding* m_arraySizeSource = nullptr;
@@ -72,6 +72,10 @@ namespace AZ
             void SetHotReloading(bool hotReloading) override;
             void SetTargetedPassDebuggingName(const AZ::Name& targetPassName) override;
             const AZ::Name& GetTargetedPassDebuggingName() const override;
+            void SetGpuPassTimingEnabled(bool enable) override;
+            bool IsGpuPassTimingEnabled() const override;
+            AZStd::vector<GpuPassTiming> GetGpuPassTimings() const override;
+            AZStd::vector<GpuFrameTimestamps> GetGpuFrameTimestamps(AZStd::sys_time_t startTick) const override;
             void ConnectEvent(OnReadyLoadTemplatesEvent::Handler& handler) override;
             PassSystemState GetState() const override;
 
@@ -104,6 +108,10 @@ namespace AZ
             // Calls Initialize() on passes queued in m_initializePassList
             void InitializePasses();
 
+            // Flags the leaf passes whose outputs are never consumed so they are skipped when rendering.
+            // Only runs when the pass hierarchy changed, the result is kept until the next change.
+            void PrunePasses();
+
             // Validates Pass Hierarchy after building
             void Validate();
 
@@ -133,12 +141,18 @@ namespace AZ
             // Whether the Pass Hierarchy changed
             bool m_passHierarchyChanged = true;
 
+            // Value of r_passPruning when the passes were last pruned
+            bool m_passPruningEnabled = false;
+
             // Whether the Pass System is currently hot reloading passes 
             bool m_isHotReloading = false;
 
             // Name of the pass targeted for debugging
             AZ::Name m_targetedPassDebugName;
 
+            // Attaches queries to all passes and averages their results when GPU pass timing is enabled
+            GpuPassTimingCollector m_gpuPassTiming;
+
             // Counts the number of passes
             int32_t m_passCounter = 0;
 
@@ -11,6 +11,7 @@
 #include <AzCore/RTTI/RTTI.h>
 #include <AzCore/std/string/string_view.h>
 
+#include <Atom/RPI.Public/GpuQuery/GpuPassTimingCollector.h>
 #include <Atom/RPI.Public/Pass/PassDefines.h>
 
 #include <Atom/RPI.Reflect/Base.h>
@@ -115,6 +116,18 @@ namespace AZ
             virtual void SetTargetedPassDebuggingName(const AZ::Name& targetPassName) = 0;
             virtual const AZ::Name& GetTargetedPassDebuggingName() const = 0;
 
+            //! Enables timestamp and pipeline statistics queries on every pass in all render pipelines, including passes that
+            //! are created later, and keeps rolling averages of their results.
+            virtual void SetGpuPassTimingEnabled(bool enable) = 0;
+            virtual bool IsGpuPassTimingEnabled() const = 0;
+
+            //! Returns the GPU timing of all passes, averaged over the last frames. Empty if GPU pass timing is disabled.
+            virtual AZStd::vector<GpuPassTiming> GetGpuPassTimings() const = 0;
+
+            //! Returns the GPU timestamps of the passes of the frames whose results were collected at or after startTick.
+            //! Empty if GPU pass timing is disabled.
+            virtual AZStd::vector<GpuFrameTimestamps> GetGpuFrameTimestamps(AZStd::sys_time_t startTick) const = 0;
+
             // --- Pass Factory related functionality ---
 
             //! Directly creates a pass given a PassDescriptor
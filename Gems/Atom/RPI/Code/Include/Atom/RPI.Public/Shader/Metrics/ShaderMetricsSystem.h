@@ -42,12 +42,14 @@ namespace AZ
 
             virtual const ShaderVariantMetrics& GetMetrics() const final;
 
+            void PrefetchShaderVariants() const final;
+
             void RequestShaderVariant(const ShaderAsset* shader, const ShaderVariantId& shaderVariantId, const ShaderVariantSearchResult& result) final;
 
             bool m_isEnabled = false;
 
             //! Lock for m_metrics
-            AZStd::mutex m_metricsMutex;
+            mutable AZStd::mutex m_metricsMutex;
 
             //! List of RPI shader requests.
             ShaderVariantMetrics m_metrics;
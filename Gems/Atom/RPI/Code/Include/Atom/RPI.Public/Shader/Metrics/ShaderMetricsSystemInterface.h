@@ -50,6 +50,10 @@ namespace AZ
             //! Gets the shader metrics.
             virtual const ShaderVariantMetrics& GetMetrics() const = 0;
 
+            //! Queues the loading of all shader variants in the metrics, so the variants that were requested in a previous
+            //! session are ready before they're drawn. This is intended to be called while a level is loading.
+            virtual void PrefetchShaderVariants() const = 0;
+
             //! Requests a shader variant.
             //! @param[in]  shader The shader for which to request a specific variant.
             //! @param[in] shaderVariantId The requested shader variant.
@@ -105,6 +105,10 @@ namespace AZ
             /// Acquires a pipeline state directly from a descriptor.
             const RHI::PipelineState* AcquirePipelineState(const RHI::PipelineStateDescriptor& descriptor) const;
 
+            /// Acquires a pipeline state directly from a descriptor, compiling it on a background job if it's not cached yet.
+            /// Returns null until the pipeline state finished compiling.
+            const RHI::PipelineState* AcquirePipelineStateAsync(const RHI::PipelineStateDescriptor& descriptor) const;
+
             /// Finds and returns the shader resource group asset with the requested name. Returns an empty handle if no matching group was found.
             const Data::Asset<ShaderResourceGroupAsset>& FindShaderResourceGroupAsset(const Name& shaderResourceGroupName) const;
 
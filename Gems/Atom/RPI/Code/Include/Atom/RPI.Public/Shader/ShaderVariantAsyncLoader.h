@@ -46,11 +46,23 @@ namespace AZ
                 }
             };
 
+            struct PairOfShaderAssetIdAndShaderVariantStableId
+            {
+                Data::AssetId m_shaderAssetId;
+                ShaderVariantStableId m_shaderVariantStableId;
+
+                bool operator==(const PairOfShaderAssetIdAndShaderVariantStableId& anotherPair) const
+                {
+                    return (m_shaderAssetId == anotherPair.m_shaderAssetId && m_shaderVariantStableId == anotherPair.m_shaderVariantStableId);
+                }
+            };
+
             ///////////////////////////////////////////////////////////////////
             // IShaderVariantFinder overrides
             bool QueueLoadShaderVariantAssetByVariantId(Data::Asset<ShaderAsset> shaderAsset, const ShaderVariantId& shaderVariantId) override;
             bool QueueLoadShaderVariantTreeAsset(const Data::AssetId& shaderAssetId) override;
             bool QueueLoadShaderVariantAsset(const Data::AssetId& shaderVariantTreeAssetId, ShaderVariantStableId variantStableId) override;
+            bool QueueLoadShaderVariantAssetByStableId(const Data::AssetId& shaderAssetId, ShaderVariantStableId variantStableId) override;
 
             Data::Asset<ShaderVariantAsset> GetShaderVariantAssetByVariantId(
                 Data::Asset<ShaderAsset> shaderAsset, const ShaderVariantId& shaderVariantId) override;
@@ -99,6 +111,9 @@ namespace AZ
             //! This is a list of AssetId of ShaderVariantAsset.
             AZStd::vector<PairOfShaderAssetAndShaderVariantId> m_newShaderVariantPendingRequests;
 
+            //! This is a list of shader variants that are loaded ahead of time by their stable id.
+            AZStd::vector<PairOfShaderAssetIdAndShaderVariantStableId> m_prefetchShaderVariantPendingRequests;
+
             //! This is a list of AssetId of ShaderAsset (Do not confuse with the AssetId ShaderVariantTreeAsset).
             AZStd::vector<Data::AssetId> m_shaderVariantTreePendingRequests;
 
@@ -149,4 +164,15 @@ namespace AZStd
             return retVal;
         }
     };
+
+    template<>
+    struct hash<AZ::RPI::ShaderVariantAsyncLoader::PairOfShaderAssetIdAndShaderVariantStableId>
+    {
+        size_t operator()(const AZ::RPI::ShaderVariantAsyncLoader::PairOfShaderAssetIdAndShaderVariantStableId& pair) const
+        {
+            size_t retVal = pair.m_shaderAssetId.m_guid.GetHash();
+            AZStd::hash_combine(retVal, pair.m_shaderAssetId.m_subId, pair.m_shaderVariantStableId.GetIndex());
+            return retVal;
+        }
+    };
 } // namespace AZStd
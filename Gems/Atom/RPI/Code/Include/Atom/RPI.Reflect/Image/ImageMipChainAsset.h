@@ -79,6 +79,18 @@ namespace AZ
             //! Returns the total size of pixel data across all mips in this chain. 
             size_t GetImageDataSize() const;
 
+            //! Returns the compression applied to the sub-image data. If the data is compressed GetSubImageData returns
+            //! the compressed data and the RHI pool either has to support the compression or the data needs to be
+            //! decompressed before it's uploaded. See DecompressSubImage.
+            RHI::StreamingImageCompression GetCompression() const;
+
+            //! Returns the size in bytes of a sub-image after decompression.
+            size_t GetDecompressedSubImageSize(uint32_t subImageIndex) const;
+
+            //! Decompresses a single sub-image into the provided buffer, which needs to be at least
+            //! GetDecompressedSubImageSize bytes. Returns false if the data couldn't be decompressed.
+            bool DecompressSubImage(uint32_t subImageIndex, void* output, size_t outputSize) const;
+
         protected:
             // AssetData overrides...
             bool HandleAutoReload() override { return false; }
@@ -115,6 +127,9 @@ namespace AZ
 
             // [Serialized] Flat image data interpreted by m_subImages.
             AZStd::vector<uint8_t> m_imageData;
+
+            // [Serialized] Compression applied to each of the sub-images in m_imageData.
+            RHI::StreamingImageCompression m_compression = RHI::StreamingImageCompression::None;
         };
 
         class ImageMipChainAssetHandler final
@@ -40,6 +40,10 @@ namespace AZ
             //! Every mip level must have the same number of array elements matching arraySize passed in Begin().
             void AddSubImage(const void* data, size_t dataSize);
 
+            //! Declares the compression that was applied to the data passed to AddSubImage. The data is stored as is,
+            //! so every sub-image has to be compressed individually. Defaults to no compression.
+            void SetCompression(RHI::StreamingImageCompression compression);
+
             //! Ends construction of the current mip level. This must be called after adding all sub images.
             void EndMip();
             
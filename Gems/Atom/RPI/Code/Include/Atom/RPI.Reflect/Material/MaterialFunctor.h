@@ -127,14 +127,22 @@ namespace AZ
                     ShaderResourceGroup* shaderResourceGroup,
                     const MaterialPropertyFlags* materialPropertyDependencies
                 );
+
+                //! Returns whether the functor changed any shader option, enabled shader, draw list or render state of the ShaderCollection.
+                bool HasShaderCollectionChanged() const { return m_shaderCollectionChanged; }
+
             private:
                 bool SetShaderOptionValue(ShaderCollection::Item& shaderItem, ShaderOptionIndex optionIndex, ShaderOptionValue value);
+                void SetShaderEnabled(ShaderCollection::Item& shaderItem, bool enabled);
+                void SetShaderDrawListTagOverride(ShaderCollection::Item& shaderItem, const Name& drawListTagName);
+                void ApplyShaderRenderStateOverlay(ShaderCollection::Item& shaderItem, const RHI::RenderStates& renderStatesOverlay);
 
                 const AZStd::vector<MaterialPropertyValue>& m_materialPropertyValues;
                 RHI::ConstPtr<MaterialPropertiesLayout> m_materialPropertiesLayout;
                 ShaderCollection*     m_shaderCollection;
                 ShaderResourceGroup*  m_shaderResourceGroup;
                 const MaterialPropertyFlags* m_materialPropertyDependencies = nullptr;
+                bool m_shaderCollectionChanged = false;
             };
 
             class EditorContext
@@ -18,6 +18,7 @@
 
 #include <AzCore/Asset/AssetCommon.h>
 #include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/Vector3.h>
 #include <AzCore/Name/Name.h>
 
 namespace AZ
@@ -77,6 +78,29 @@ namespace AZ
                     BufferAssetView m_bufferAssetView;
                 };
 
+                //! A cluster of neighboring triangles of the mesh, with bounds to cull it independently from the rest of the mesh.
+                //! The triangles of a meshlet are contiguous in the index buffer of the mesh.
+                struct Meshlet final
+                {
+                    AZ_TYPE_INFO(Meshlet, "{B52F5185-064E-418E-9886-9AD00EB8ABC3}");
+
+                    static void Reflect(AZ::ReflectContext* context);
+
+                    //! First index of the meshlet, relative to the index buffer view of the mesh
+                    uint32_t m_indexOffset = 0;
+                    uint32_t m_triangleCount = 0;
+
+                    //! Model-space bounding sphere of the triangles
+                    AZ::Vector3 m_center = AZ::Vector3::CreateZero();
+                    float m_radius = 0.0f;
+
+                    //! Cone of the triangle normals. All the triangles face away from a camera at position p when
+                    //! dot(m_center - p, m_coneAxis) >= m_coneCutoff * length(m_center - p) + m_radius.
+                    //! A cutoff of 1 means the normals are spread too much for the meshlet to be backface culled.
+                    AZ::Vector3 m_coneAxis = AZ::Vector3::CreateAxisZ();
+                    float m_coneCutoff = 1.0f;
+                };
+
                 //! Returns the number of vertices in this mesh
                 uint32_t GetVertexCount() const;
 
@@ -103,6 +127,9 @@ namespace AZ
                 //! Return an array view of the list of all stream buffer info (not including the index buffer)
                 AZStd::array_view<StreamBufferInfo> GetStreamBufferInfoList() const;
 
+                //! Returns the meshlets of the mesh, empty unless the model was built with meshlets.
+                AZStd::array_view<Meshlet> GetMeshlets() const;
+
                 //! A helper method for returning a specific buffer asset view.
                 //! It will return nullptr if the semantic buffer is not found.
                 //! For example, to get a position buffer for a mesh with AZ::Name("POSITION").
@@ -135,6 +162,8 @@ namespace AZ
                 // expected that the user calls GetStreamBufferInfo with the required semantics
                 // and pieces the layout together themselves.
                 AZStd::fixed_vector<StreamBufferInfo, RHI::Limits::Pipeline::StreamCountMax> m_streamBufferInfo;
+
+                AZStd::vector<Meshlet> m_meshlets;
             };
 
             //! Returns an array view into the collection of meshes owned by this lod
@@ -52,6 +52,10 @@ namespace AZ
             //! Begin and BeginMesh must be called first
             void SetMeshIndexBuffer(const BufferAssetView& bufferAssetView);
 
+            //! Sets the meshlets of the current SubMesh, which index into its index buffer view.
+            //! Begin and BeginMesh must be called first
+            void SetMeshMeshlets(AZStd::array_view<ModelLodAsset::Mesh::Meshlet> meshlets);
+
             //! Adds a BufferAssetView to the current SubMesh as a stream buffer that matches the given semantic name.
             //! Begin and BeginMesh must be called first
             bool AddMeshStreamBuffer(
@@ -28,12 +28,13 @@ namespace AZ
                 if (auto* serializeContext = azrtti_cast<SerializeContext*>(context))
                 {
                     serializeContext->Class<ComputePassData, RenderPassData>()
-                        ->Version(1)
+                        ->Version(2)
                         ->Field("ShaderAsset", &ComputePassData::m_shaderReference)
                         ->Field("Target Thread Count X", &ComputePassData::m_totalNumberOfThreadsX)
                         ->Field("Target Thread Count Y", &ComputePassData::m_totalNumberOfThreadsY)
                         ->Field("Target Thread Count Z", &ComputePassData::m_totalNumberOfThreadsZ)
                         ->Field("Make Fullscreen Pass", &ComputePassData::m_makeFullscreenPass)
+                        ->Field("Use Async Compute", &ComputePassData::m_useAsyncCompute)
                         ;
                 }
             }
@@ -45,6 +46,10 @@ namespace AZ
             uint32_t m_totalNumberOfThreadsZ = 0;
 
             bool m_makeFullscreenPass = false;
+
+            //! Whether the pass is scheduled on the compute queue, so it can overlap with passes on the graphics queue.
+            //! The frame graph adds the fences between the queues based on the attachments of the pass.
+            bool m_useAsyncCompute = false;
         };
     } // namespace RPI
 } // namespace AZ
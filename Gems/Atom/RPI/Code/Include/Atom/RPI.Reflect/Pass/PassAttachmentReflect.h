@@ -193,6 +193,18 @@ namespace AZ
             float m_depthMultiplier = 1.0f;
         };
 
+        //! How the render scale of the pipeline affects the size of an attachment (see PipelineRenderSettings::m_renderScale)
+        enum class PassAttachmentRenderScale : uint32_t
+        {
+            //! The attachment has the same scale as its size source
+            Inherit,
+            //! The unscaled size of the source is multiplied by the render scale, used by the attachments rendered at the
+            //! scaled render resolution that are sized from the output resolution
+            Apply,
+            //! The unscaled size of the source is used, for the output of a pass upsampling render scaled inputs
+            Remove
+        };
+
         //! Used to query an attachment size from a source attachment using a PassAttachmentRef
         //! The size of the attachment is then multiplied by the width, height and depth multipliers
         //! See Pass::CreateAttachmentFromDesc
@@ -208,6 +220,9 @@ namespace AZ
             //! The source attachment's size will be multiplied by
             //! these values to obtain the new attachment's size
             PassAttachmentSizeMultipliers m_multipliers;
+
+            //! Whether the size follows the render scale of the pipeline
+            PassAttachmentRenderScale m_renderScale = PassAttachmentRenderScale::Inherit;
         };
 
         //! Describes a PassAttachment, used for building attachments in a data-driven manner.
@@ -280,5 +295,6 @@ namespace AZ
     }   // namespace RPI
 
     AZ_TYPE_INFO_SPECIALIZE(RPI::PassSlotType, "{D0189293-1ABE-4672-BDE6-5652F4B3866C}");
+    AZ_TYPE_INFO_SPECIALIZE(RPI::PassAttachmentRenderScale, "{5FC037C3-61BE-4943-88AC-516F814B73EA}");
 
 }   // namespace AZ
@@ -59,6 +59,13 @@ namespace AZ
             virtual bool QueueLoadShaderVariantAsset(
                 const Data::AssetId& shaderVariantTreeAssetId, ShaderVariantStableId variantStableId) = 0;
 
+            //! Queues the loading of a shader variant that is known to be needed ahead of time, for example a variant that was
+            //! recorded by the ShaderMetricsSystem in a previous session. Unlike QueueLoadShaderVariantAssetByVariantId() the
+            //! ShaderAsset doesn't need to be loaded, and the ShaderVariantTreeAsset is queued for loading if needed.
+            //! The caller is notified via ShaderVariantFinderNotificationBus like for the other requests.
+            //! Returns true if the request was queued successfully.
+            virtual bool QueueLoadShaderVariantAssetByStableId(const Data::AssetId& shaderAssetId, ShaderVariantStableId variantStableId) = 0;
+
             //! This is a quick blocking call that will return a valid asset only if it's been fully loaded already,
             //! Otherwise it returns an invalid asset and the caller is supposed to call QueueLoadShaderVariantAssetByVariantId().
             virtual Data::Asset<ShaderVariantAsset> GetShaderVariantAssetByVariantId(
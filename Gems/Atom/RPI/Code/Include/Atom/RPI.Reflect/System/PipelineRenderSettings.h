@@ -33,10 +33,11 @@ namespace AZ
                 if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
                 {
                     serializeContext->Class<PipelineRenderSettings>()
-                        ->Version(0)
+                        ->Version(1)
                         ->Field("Size", &PipelineRenderSettings::m_size)
                         ->Field("Format", &PipelineRenderSettings::m_format)
                         ->Field("MultisampleState", &PipelineRenderSettings::m_multisampleState)
+                        ->Field("RenderScale", &PipelineRenderSettings::m_renderScale)
                         ;
                 }
             }
@@ -52,6 +53,10 @@ namespace AZ
             //! The pipeline can specify a custom MSAA state that passes can then chose to query
             //! Example use case: choose whether to render at 2x MSAA, 4x, 8x or no MSAA
             RHI::MultisampleState m_multisampleState;
+
+            //! The pipeline can scale the resolution of the attachments whose size source applies the render scale
+            //! Example use case: dynamic resolution, with a temporal upsampler restoring the output resolution
+            float m_renderScale = 1.0f;
         };
 
     } // namespace RPI
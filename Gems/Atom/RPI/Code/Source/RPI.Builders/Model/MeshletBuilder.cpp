@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ * 
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Model/MeshletBuilder.h>
+
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/std/containers/fixed_vector.h>
+
+namespace AZ::RPI
+{
+    namespace
+    {
+        AZ::Vector3 GetPosition(const AZStd::vector<float>& positions, uint32_t vertexIndex)
+        {
+            return AZ::Vector3(positions[vertexIndex * 3], positions[vertexIndex * 3 + 1], positions[vertexIndex * 3 + 2]);
+        }
+
+        // Computes the bounding sphere and the normal cone of the triangles of a meshlet.
+        void ComputeMeshletBounds(
+            ModelLodAsset::Mesh::Meshlet& meshlet, const AZStd::vector<uint32_t>& indices, const AZStd::vector<float>& positions)
+        {
+            AZ::Aabb aabb = AZ::Aabb::CreateNull();
+            const uint32_t indexEnd = meshlet.m_indexOffset + meshlet.m_triangleCount * 3;
+            for (uint32_t index = meshlet.m_indexOffset; index < indexEnd; ++index)
+            {
+                aabb.AddPoint(GetPosition(positions, indices[index]));
+            }
+
+            meshlet.m_center = aabb.GetCenter();
+            float radiusSq = 0.0f;
+            for (uint32_t index = meshlet.m_indexOffset; index < indexEnd; ++index)
+            {
+                radiusSq = AZ::GetMax(radiusSq, meshlet.m_center.GetDistanceSq(GetPosition(positions, indices[index])));
+            }
+            meshlet.m_radius = sqrtf(radiusSq);
+
+            AZStd::fixed_vector<AZ::Vector3, MeshletBuilder::MaxTriangleCount> triangleNormals;
+            AZ::Vector3 normalSum = AZ::Vector3::CreateZero();
+            for (uint32_t index = meshlet.m_indexOffset; index < indexEnd; index += 3)
+            {
+                const AZ::Vector3 p0 = GetPosition(positions, indices[index]);
+                const AZ::Vector3 normal = (GetPosition(positions, indices[index + 1]) - p0).Cross(GetPosition(positions, indices[index + 2]) - p0);
+                
+                // Degenerate triangles can't be seen from any side
+                if (normal.GetLengthSq() > 0.0f)
+                {
+                    triangleNormals.push_back(normal.GetNormalized());
+                    normalSum += triangleNormals.back();
+                }
+            }
+
+            if (triangleNormals.empty() || normalSum.GetLengthSq() == 0.0f)
+            {
+                return;
+            }
+
+            meshlet.m_coneAxis = normalSum.GetNormalized();
+            float minAxisDot = 1.0f;
+            for (const AZ::Vector3& normal : triangleNormals)
+            {
+                minAxisDot = AZ::GetMin(minAxisDot, normal.Dot(meshlet.m_coneAxis));
+            }
+
+            // The triangles face away from the camera when the view direction is within 90 degrees minus the cone spread of the axis,
+            // so the cutoff is the sine of the spread. Past 90 degrees of spread some triangle always faces the camera.
+            meshlet.m_coneCutoff = minAxisDot <= 0.0f ? 1.0f : sqrtf(1.0f - minAxisDot * minAxisDot);
+        }
+    }
+
+    AZStd::vector<ModelLodAsset::Mesh::Meshlet> MeshletBuilder::BuildMeshlets(AZStd::vector<uint32_t>& indices, const AZStd::vector<float>& positions)
+    {
+        AZStd::vector<ModelLodAsset::Mesh::Meshlet> meshlets;
+
+        const uint32_t vertexCount = static_cast<uint32_t>(positions.size() / 3);
+        const uint32_t triangleCount = static_cast<uint32_t>(indices.size() / 3);
+        if (triangleCount == 0 || indices.size() % 3 != 0)
+        {
+            return meshlets;
+        }
+
+        // Triangles using each vertex
+        AZStd::vector<uint32_t> vertexTriangleOffsets(vertexCount + 1, 0);
+        for (uint32_t vertexIndex : indices)
+        {
+            ++vertexTriangleOffsets[vertexIndex + 1];
+        }
+        for (uint32_t vertexIndex = 0; vertexIndex < vertexCount; ++vertexIndex)
+        {
+            vertexTriangleOffsets[vertexIndex + 1] += vertexTriangleOffsets[vertexIndex];
+        }
+        AZStd::vector<uint32_t> vertexTriangles(indices.size());
+        {
+            AZStd::vector<uint32_t> vertexTriangleCounts(vertexCount, 0);
+            for (uint32_t index = 0; index < indices.size(); ++index)
+            {
+                const uint32_t vertexIndex = indices[index];
+                vertexTriangles[vertexTriangleOffsets[vertexIndex] + vertexTriangleCounts[vertexIndex]++] = index / 3;
+            }
+        }
+
+        static constexpr uint32_t InvalidIndex = static_cast<uint32_t>(-1);
+
+        AZStd::vector<uint32_t> reorderedIndices;
+        reorderedIndices.reserve(indices.size());
+        AZStd::vector<uint8_t> isTriangleAdded(triangleCount, 0);
+        // Meshlet that last added each vertex, so checking whether a vertex is in the current meshlet is a lookup
+        AZStd::vector<uint32_t> vertexMeshlets(vertexCount, InvalidIndex);
+        AZStd::fixed_vector<uint32_t, MaxVertexCount> meshletVertices;
+
+        ModelLodAsset::Mesh::Meshlet meshlet;
+        uint32_t meshletIndex = 0;
+        uint32_t nextSeedTriangle = 0;
+
+        auto getNewVertexCount = [&](uint32_t triangle)
+        {
+            uint32_t newVertexCount = 0;
+            for (uint32_t corner = 0; corner < 3; ++corner)
+            {
+                newVertexCount += vertexMeshlets[indices[triangle * 3 + corner]] != meshletIndex ? 1 : 0;
+            }
+            return newVertexCount;
+        };
+
+        auto finishMeshlet = [&]()
+        {
+            ComputeMeshletBounds(meshlet, reorderedIndices, positions);
+            meshlets.push_back(meshlet);
+
+            meshlet = {};
+            meshlet.m_indexOffset = static_cast<uint32_t>(reorderedIndices.size());
+            meshletVertices.clear();
+            ++meshletIndex;
+        };
+
+        for (uint32_t addedTriangleCount = 0; addedTriangleCount < triangleCount; ++addedTriangleCount)
+        {
+            // Prefer the neighboring triangle sharing the most vertices with the meshlet
+            uint32_t bestTriangle = InvalidIndex;
+            uint32_t bestNewVertexCount = 4;
+            for (uint32_t vertexIndex : meshletVertices)
+            {
+                for (uint32_t offset = vertexTriangleOffsets[vertexIndex]; offset < vertexTriangleOffsets[vertexIndex + 1]; ++offset)
+                {
+                    const uint32_t triangle = vertexTriangles[offset];
+                    if (isTriangleAdded[triangle])
+                    {
+                        continue;
+                    }
+
+                    const uint32_t newVertexCount = getNewVertexCount(triangle);
+                    if (newVertexCount < bestNewVertexCount)
+                    {
+                        bestTriangle = triangle;
+                        bestNewVertexCount = newVertexCount;
+                    }
+                }
+            }
+
+            // No neighbor left, continue from the next triangle in the original order
+            if (bestTriangle == InvalidIndex)
+            {
+                while (isTriangleAdded[nextSeedTriangle])
+                {
+                    ++nextSeedTriangle;
+                }
+                bestTriangle = nextSeedTriangle;
+                bestNewVertexCount = getNewVertexCount(bestTriangle);
+            }
+
+            if (meshlet.m_triangleCount == MaxTriangleCount || meshletVertices.size() + bestNewVertexCount > MaxVertexCount)
+            {
+                // The triangle is next to the full meshlet, so it starts the next one
+                finishMeshlet();
+            }
+
+            isTriangleAdded[bestTriangle] = 1;
+            for (uint32_t corner = 0; corner < 3; ++corner)
+            {
+                const uint32_t vertexIndex = indices[bestTriangle * 3 + corner];
+                if (vertexMeshlets[vertexIndex] != meshletIndex)
+                {
+                    vertexMeshlets[vertexIndex] = meshletIndex;
+                    meshletVertices.push_back(vertexIndex);
+                }
+                reorderedIndices.push_back(vertexIndex);
+            }
+            ++meshlet.m_triangleCount;
+        }
+        finishMeshlet();
+
+        indices = AZStd::move(reorderedIndices);
+        return meshlets;
+    }
+} // namespace AZ::RPI
@@ -0,0 +1,30 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ * 
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Atom/RPI.Reflect/Model/ModelLodAsset.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ::RPI
+{
+    //! Splits the triangles of a mesh into meshlets, so they can be culled in clusters instead of with the whole mesh.
+    class MeshletBuilder
+    {
+    public:
+        //! Limits of a meshlet, which match the usual limits of a mesh shader workgroup
+        static constexpr uint32_t MaxVertexCount = 64;
+        static constexpr uint32_t MaxTriangleCount = 124;
+
+        //! Greedily grows each meshlet with the triangle adding the fewest new vertices, and reorders the
+        //! indices so the triangles of each meshlet are contiguous.
+        //! @param indices   Triangle list indices of the mesh, reordered in place.
+        //! @param positions Vertex positions of the mesh, with three floats per vertex.
+        //! @return The meshlets, in the order of the reordered indices.
+        static AZStd::vector<ModelLodAsset::Mesh::Meshlet> BuildMeshlets(AZStd::vector<uint32_t>& indices, const AZStd::vector<float>& positions);
+    };
+} // namespace AZ::RPI
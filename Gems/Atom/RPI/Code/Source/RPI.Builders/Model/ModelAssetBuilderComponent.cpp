@@ -7,6 +7,7 @@
 
 #include <Model/ModelAssetBuilderComponent.h>
 #include <Model/MaterialAssetBuilderComponent.h>
+#include <Model/MeshletBuilder.h>
 #include <Model/MorphTargetExporter.h>
 #include <Atom/RPI.Edit/Common/AssetUtils.h>
 
@@ -108,7 +109,7 @@ namespace AZ
             if (auto* serialize = azrtti_cast<SerializeContext*>(context))
             {
                 serialize->Class<ModelAssetBuilderComponent, SceneAPI::SceneCore::ExportingComponent>()
-                    ->Version(27);  // [ATOM-15658]
+                    ->Version(28);  // Meshlets
             }
         }
 
@@ -410,6 +411,15 @@ namespace AZ
                         lodMeshes = MergeMeshesByMaterialUid(lodMeshes);
                     }
 
+                    // Meshlets are built last, since merging meshes appends their indices
+                    if (staticMeshAdvancedRule && staticMeshAdvancedRule->GenerateMeshlets())
+                    {
+                        for (ProductMeshContent& mesh : lodMeshes)
+                        {
+                            mesh.m_meshlets = MeshletBuilder::BuildMeshlets(mesh.m_indices, mesh.m_positions);
+                        }
+                    }
+
 #if defined(AZ_RPI_MESHES_SHARE_COMMON_BUFFERS)
                     // We shouldn't need a mesh name for the buffer names since meshed are sharing common buffers
                     m_meshName = "";
@@ -1215,6 +1225,7 @@ namespace AZ
                 meshView.m_clothDataView = RHI::BufferViewDescriptor::CreateTyped(0, meshClothDataCount, ClothDataFormat);
             }
 
+            meshView.m_meshlets = mesh.m_meshlets;
             meshView.m_materialUid = mesh.m_materialUid;
 
             return meshView;
@@ -1339,6 +1350,7 @@ namespace AZ
                     lodBufferInfo.m_clothDataFloatCount += meshClothDataFloatCount;
                 }
 
+                meshView.m_meshlets = mesh.m_meshlets;
                 meshView.m_materialUid = mesh.m_materialUid;
 
                 if (!mesh.m_skinJointIndices.empty() && !mesh.m_skinWeights.empty())
@@ -1812,6 +1824,7 @@ namespace AZ
             BufferAssetView indexBufferAssetView(lodIndexBuffer.GetBufferAsset(), meshView.m_indexView);
 
             lodAssetCreator.SetMeshIndexBuffer(AZStd::move(indexBufferAssetView));
+            lodAssetCreator.SetMeshMeshlets(meshView.m_meshlets);
 
             {
                 // Build the mesh's Aabb
@@ -117,6 +117,9 @@ namespace AZ
                 // Morph targets
                 AZStd::vector<RPI::PackedCompressedMorphTargetDelta> m_morphTargetVertexData;
 
+                //! Set when the indices are reordered into meshlets
+                AZStd::vector<ModelLodAsset::Mesh::Meshlet> m_meshlets;
+
                 MaterialUid m_materialUid;
                 bool CanBeMerged() const { return m_clothData.empty(); }
                 bool m_hasMorphedColors = false;
@@ -174,6 +177,8 @@ namespace AZ
 
                 RHI::BufferViewDescriptor m_clothDataView;
 
+                AZStd::vector<ModelLodAsset::Mesh::Meshlet> m_meshlets;
+
                 MaterialUid m_materialUid;
             };
             using ProductMeshViewList = AZStd::vector<ProductMeshView>;
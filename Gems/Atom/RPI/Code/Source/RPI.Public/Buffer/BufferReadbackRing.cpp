@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ * 
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Atom/RPI.Public/Buffer/BufferReadbackRing.h>
+#include <Atom/RPI.Public/Buffer/BufferSystemInterface.h>
+
+#include <Atom/RHI/Factory.h>
+#include <Atom/RHI/Fence.h>
+#include <Atom/RHI/RHISystemInterface.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        BufferReadbackRing::~BufferReadbackRing()
+        {
+            Shutdown();
+        }
+
+        bool BufferReadbackRing::Init(AZStd::string_view name, uint32_t byteCount)
+        {
+            Shutdown();
+
+            RHI::Ptr<RHI::Device> device = RHI::RHISystemInterface::Get()->GetDevice();
+            for (uint32_t slotIndex = 0; slotIndex < SlotCount; ++slotIndex)
+            {
+                Slot& slot = m_slots[slotIndex];
+
+                CommonBufferDescriptor desc;
+                desc.m_bufferName = AZStd::string::format("%.*s_%u", AZ_STRING_ARG(name), slotIndex);
+                desc.m_poolType = CommonBufferPoolType::ReadBack;
+                desc.m_byteCount = byteCount;
+                desc.m_elementSize = byteCount;
+                desc.m_bufferData = nullptr;
+                slot.m_buffer = BufferSystemInterface::Get()->CreateBufferFromCommonPool(desc);
+
+                slot.m_fence = RHI::Factory::Get().CreateFence();
+                if (!slot.m_buffer || slot.m_fence->Init(*device, RHI::FenceState::Reset) != RHI::ResultCode::Success)
+                {
+                    AZ_Error("BufferReadbackRing", false, "Failed to create the readback buffers of %.*s", AZ_STRING_ARG(name));
+                    Shutdown();
+                    return false;
+                }
+            }
+
+            m_byteCount = byteCount;
+            return true;
+        }
+
+        void BufferReadbackRing::Shutdown()
+        {
+            for (Slot& slot : m_slots)
+            {
+                slot = Slot{};
+            }
+            m_byteCount = 0;
+            m_copySlot = InvalidSlot;
+            m_copyCount = 0;
+        }
+
+        bool BufferReadbackRing::IsInitialized() const
+        {
+            return m_byteCount > 0;
+        }
+
+        RHI::Buffer* BufferReadbackRing::BeginCopy()
+        {
+            // The copy of the previous frame was never scheduled, its fence won't be signaled
+            if (m_copySlot != InvalidSlot)
+            {
+                m_slots[m_copySlot].m_state = SlotState::Free;
+                m_copySlot = InvalidSlot;
+            }
+
+            if (!IsInitialized())
+            {
+                return nullptr;
+            }
+
+            PollFences();
+
+            // Prefer a free slot, otherwise overwrite the oldest result that wasn't read so the newest one stays readable
+            uint64_t newestReadyCopy = 0;
+            for (const Slot& slot : m_slots)
+            {
+                if (slot.m_state == SlotState::Ready)
+                {
+                    newestReadyCopy = AZStd::max(newestReadyCopy, slot.m_copyIndex);
+                }
+            }
+
+            for (uint32_t slotIndex = 0; slotIndex < SlotCount; ++slotIndex)
+            {
+                const Slot& slot = m_slots[slotIndex];
+                if (slot.m_state == SlotState::Free)
+                {
+                    m_copySlot = slotIndex;
+                    break;
+                }
+                if (slot.m_state == SlotState::Ready && slot.m_copyIndex < newestReadyCopy &&
+                    (m_copySlot == InvalidSlot || slot.m_copyIndex < m_slots[m_copySlot].m_copyIndex))
+                {
+                    m_copySlot = slotIndex;
+                }
+            }
+
+            if (m_copySlot == InvalidSlot)
+            {
+                return nullptr;
+            }
+
+            Slot& slot = m_slots[m_copySlot];
+            slot.m_fence->Reset();
+            slot.m_state = SlotState::InFlight;
+            slot.m_copyIndex = ++m_copyCount;
+            return slot.m_buffer->GetRHIBuffer();
+        }
+
+        void BufferReadbackRing::SignalCopyComplete(RHI::FrameGraphInterface frameGraph)
+        {
+            if (m_copySlot != InvalidSlot)
+            {
+                frameGraph.SignalFence(*m_slots[m_copySlot].m_fence);
+                m_copySlot = InvalidSlot;
+            }
+        }
+
+        bool BufferReadbackRing::ReadLatest(void* outData, uint32_t byteCount)
+        {
+            AZ_Assert(byteCount <= m_byteCount || !IsInitialized(), "BufferReadbackRing: Reading %u bytes from %u byte buffers", byteCount, m_byteCount);
+            if (!IsInitialized())
+            {
+                return false;
+            }
+
+            PollFences();
+
+            Slot* newestSlot = nullptr;
+            for (Slot& slot : m_slots)
+            {
+                if (slot.m_state == SlotState::Ready && (!newestSlot || slot.m_copyIndex > newestSlot->m_copyIndex))
+                {
+                    newestSlot = &slot;
+                }
+            }
+
+            if (!newestSlot)
+            {
+                return false;
+            }
+
+            // The copy has completed, so mapping the buffer doesn't synchronize with the GPU
+            bool result = false;
+            if (void* data = newestSlot->m_buffer->Map(byteCount, 0))
+            {
+                memcpy(outData, data, byteCount);
+                newestSlot->m_buffer->Unmap();
+                result = true;
+            }
+
+            // Older results are out of date
+            for (Slot& slot : m_slots)
+            {
+                if (slot.m_state == SlotState::Ready)
+                {
+                    slot.m_state = SlotState::Free;
+                }
+            }
+            return result;
+        }
+
+        void BufferReadbackRing::PollFences()
+        {
+            for (Slot& slot : m_slots)
+            {
+                if (slot.m_state == SlotState::InFlight && slot.m_fence->GetFenceState() == RHI::FenceState::Signaled)
+                {
+                    slot.m_state = SlotState::Ready;
+                }
+            }
+        }
+    }   // namespace RPI
+}   // namespace AZ
@@ -8,6 +8,7 @@
 #include <Atom/RPI.Public/AuxGeom/AuxGeomDraw.h>
 #include <Atom/RPI.Public/AuxGeom/AuxGeomFeatureProcessorInterface.h>
 #include <Atom/RPI.Public/Culling.h>
+#include <Atom/RPI.Public/Model/Model.h>
 #include <Atom/RPI.Public/Model/ModelLodUtils.h>
 #include <Atom/RPI.Public/RPISystemInterface.h>
 #include <Atom/RPI.Public/Scene.h>
@@ -43,6 +44,10 @@ namespace AZ
     {
         AZ_CVAR(bool, r_CullInParallel, true, nullptr, ConsoleFunctorFlags::Null, "");
         AZ_CVAR(uint32_t, r_CullWorkPerBatch, 500, nullptr, ConsoleFunctorFlags::Null, "");
+        AZ_CVAR(float, r_streamingImageMipBias, 0.0f, nullptr, ConsoleFunctorFlags::Null,
+            "Bias added to the mip level requested for the streaming images of visible objects. Negative values request sharper mips.");
+        AZ_CVAR(uint32_t, r_occlusionMeshTriangleBudget, 32768, nullptr, ConsoleFunctorFlags::Null,
+            "Maximum number of occlusion mesh triangles that is rendered into the occlusion buffer of a view, the meshes closest to the view are rendered first");
 
         void DebugDrawWorldCoordinateAxes(AuxGeomDraw* auxGeom)
         {
@@ -498,12 +503,66 @@ namespace AZ
                     return MaskedOcclusionCulling::VISIBLE;
                 }
 
-                // test against the occlusion buffer, which contains only the manually placed occlusion planes
+                // test against the occlusion buffer, which contains the occlusion planes and occlusion meshes
                 return m_jobData->m_maskedOcclusionCulling->TestRect(ndcMinX, ndcMinY, ndcMaxX, ndcMaxY, minDepth);
             }
 #endif
         };
 
+#if AZ_TRAIT_MASKED_OCCLUSION_CULLING_SUPPORTED
+        void CullingScene::RenderOcclusionMeshes(View& view, const Frustum& frustum, MaskedOcclusionCulling& maskedOcclusionCulling) const
+        {
+            if (m_occlusionMeshes.empty())
+            {
+                return;
+            }
+
+            AZ_PROFILE_SCOPE(Debug::ProfileCategory::AzRender, "CullingScene::RenderOcclusionMeshes()");
+
+            // frustum cull occlusion meshes
+            using VisibleOcclusionMesh = AZStd::pair<const OcclusionMesh*, float>;
+            AZStd::small_vector<VisibleOcclusionMesh, 64> visibleOccluders;
+            for (const auto& occlusionMesh : m_occlusionMeshes)
+            {
+                if (ShapeIntersection::Overlaps(frustum, occlusionMesh.m_aabb))
+                {
+                    // occluder is visible, compute view space distance and add to list
+                    float depth = (view.GetWorldToViewMatrix() * occlusionMesh.m_aabb.GetMin()).GetZ();
+                    depth = AZStd::max(depth, (view.GetWorldToViewMatrix() * occlusionMesh.m_aabb.GetMax()).GetZ());
+
+                    visibleOccluders.push_back(AZStd::make_pair(&occlusionMesh, depth));
+                }
+            }
+
+            // sort the occlusion meshes by view space distance, front-to-back, so the closest and usually most effective
+            // occluders are rendered first when the triangle budget is exceeded
+            AZStd::sort(visibleOccluders.begin(), visibleOccluders.end(), [](const VisibleOcclusionMesh& LHS, const VisibleOcclusionMesh& RHS)
+            {
+                return LHS.second > RHS.second;
+            });
+
+            uint32_t remainingTriangles = r_occlusionMeshTriangleBudget;
+            for (const VisibleOcclusionMesh& occlusionMesh : visibleOccluders)
+            {
+                const uint32_t numTriangles = aznumeric_cast<uint32_t>(occlusionMesh.first->m_indices.size() / 3);
+                if (numTriangles > remainingTriangles)
+                {
+                    break;
+                }
+                remainingTriangles -= numTriangles;
+
+                // the occlusion buffer expects a column major matrix that transforms column vectors
+                float objectToClip[16];
+                (view.GetWorldToClipMatrix() * occlusionMesh.first->m_objectToWorld).StoreToColumnMajorFloat16(objectToClip);
+
+                // the positions are tightly packed (x, y, z) floats, which are transformed to clip space by the occlusion buffer
+                maskedOcclusionCulling.RenderTriangles(occlusionMesh.first->m_positions.data(), occlusionMesh.first->m_indices.data(),
+                    aznumeric_cast<int>(numTriangles), objectToClip, MaskedOcclusionCulling::BACKFACE_NONE, MaskedOcclusionCulling::CLIP_PLANE_ALL,
+                    MaskedOcclusionCulling::VertexLayout(12, 4, 8));
+            }
+        }
+#endif
+
         void CullingScene::ProcessCullables(const Scene& scene, View& view, AZ::Job& parentJob)
         {
             AZ_PROFILE_SCOPE_DYNAMIC(Debug::ProfileCategory::AzRender, "CullingScene::ProcessCullables() - %s", view.GetName().GetCStr());
@@ -537,12 +596,13 @@ namespace AZ
 
 #if AZ_TRAIT_MASKED_OCCLUSION_CULLING_SUPPORTED
             // setup occlusion culling, if necessary
-            MaskedOcclusionCulling* maskedOcclusionCulling = m_occlusionPlanes.empty() ? nullptr : view.GetMaskedOcclusionCulling();
+            const bool hasOccluders = !m_occlusionPlanes.empty() || !m_occlusionMeshes.empty();
+            MaskedOcclusionCulling* maskedOcclusionCulling = hasOccluders ? view.GetMaskedOcclusionCulling() : nullptr;
             if (maskedOcclusionCulling)
             {
                 // frustum cull occlusion planes
                 using VisibleOcclusionPlane = AZStd::pair<OcclusionPlane, float>;
-                AZStd::vector<VisibleOcclusionPlane> visibleOccluders;
+                AZStd::small_vector<VisibleOcclusionPlane, 16> visibleOccluders;
                 for (const auto& occlusionPlane : m_occlusionPlanes)
                 {
                     if (ShapeIntersection::Overlaps(frustum, occlusionPlane.m_aabb))
@@ -581,6 +641,8 @@ namespace AZ
                     // render into the occlusion buffer, specifying BACKFACE_NONE so it functions as a double-sided occluder
                     maskedOcclusionCulling->RenderTriangles((float*)verts, indices, 2, nullptr, MaskedOcclusionCulling::BACKFACE_NONE);
                 }
+
+                RenderOcclusionMeshes(view, frustum, *maskedOcclusionCulling);
             }
 #endif
 
@@ -641,6 +703,25 @@ namespace AZ
             }
         }
 
+        static void SetStreamingImageTargetMips(const Cullable::LodData::Lod& lod, float approxScreenPercentage)
+        {
+            // Like the lod screen coverage, the projected size is measured against a 1080p screen
+            static const float ReferenceScreenHeight = 1080.0f;
+
+            // There is no uv density information, so textures are assumed to cover the object once:
+            // the object needs about one texel per pixel of its projected diameter.
+            const float projectedSizeInPixels = AZStd::GetMax(approxScreenPercentage * ReferenceScreenHeight, 1.0f);
+            const float mipBias = r_streamingImageMipBias;
+            for (const Data::Instance<StreamingImage>& image : lod.m_streamingImages)
+            {
+                const RHI::ImageDescriptor& descriptor = image->GetDescriptor();
+                const float textureSize = aznumeric_cast<float>(AZStd::GetMax(descriptor.m_size.m_width, descriptor.m_size.m_height));
+                const float targetMip = floorf(log2f(textureSize / projectedSizeInPixels) + mipBias);
+                const float lastMip = aznumeric_cast<float>(AZStd::GetMax<uint16_t>(descriptor.m_mipLevels, 1) - 1);
+                image->SetTargetMip(aznumeric_cast<uint16_t>(AZStd::GetClamp(targetMip, 0.0f, lastMip)));
+            }
+        }
+
         uint32_t AddLodDataToView(const Vector3& pos, const Cullable::LodData& lodData, RPI::View& view)
         {
 #ifdef AZ_CULL_PROFILE_DETAILED
@@ -659,8 +740,28 @@ namespace AZ
 
             uint32_t numVisibleDrawPackets = 0;
 
-            auto addLodToDrawPacket = [&](const Cullable::LodData::Lod& lod)
+            size_t lastAddedLodIndex = lodData.m_lods.size();
+            auto addLodToDrawPacket = [&](size_t lodIndex)
             {
+                if (lodData.m_model)
+                {
+                    lodData.m_model->RequestLod(lodIndex);
+
+                    // Fall back to the closest less detailed lod while the selected one is streaming in
+                    while (lodData.m_lods[lodIndex].m_drawPackets.empty() && lodIndex + 1 < lodData.m_lods.size())
+                    {
+                        ++lodIndex;
+                    }
+
+                    // Overlapping lods can fall back to the same one
+                    if (lodIndex == lastAddedLodIndex)
+                    {
+                        return;
+                    }
+                    lastAddedLodIndex = lodIndex;
+                }
+
+                const Cullable::LodData::Lod& lod = lodData.m_lods[lodIndex];
 #ifdef AZ_CULL_PROFILE_VERBOSE
                 AZ_PROFILE_SCOPE_DYNAMIC(Debug::ProfileCategory::AzRender, "add draw packets: %zu", lod.m_drawPackets.size());
 #endif
@@ -669,22 +770,24 @@ namespace AZ
                 {
                     view.AddDrawPacket(drawPacket, pos);
                 }
+                SetStreamingImageTargetMips(lod, approxScreenPercentage);
             };
 
             if (lodData.m_lodOverride == Cullable::NoLodOverride)
             {
-                for (const Cullable::LodData::Lod& lod : lodData.m_lods)
+                for (size_t lodIndex = 0; lodIndex < lodData.m_lods.size(); ++lodIndex)
                 {
+                    const Cullable::LodData::Lod& lod = lodData.m_lods[lodIndex];
                     //Note that this supports overlapping lod ranges (to suport cross-fading lods, for example)
                     if (approxScreenPercentage >= lod.m_screenCoverageMin && approxScreenPercentage <= lod.m_screenCoverageMax)
                     {
-                        addLodToDrawPacket(lod);
+                        addLodToDrawPacket(lodIndex);
                     }
                 }
             }
             else if(lodData.m_lodOverride < lodData.m_lods.size())
             {
-                addLodToDrawPacket(lodData.m_lods.at(lodData.m_lodOverride));
+                addLodToDrawPacket(lodData.m_lodOverride);
             }
 
             return numVisibleDrawPackets;
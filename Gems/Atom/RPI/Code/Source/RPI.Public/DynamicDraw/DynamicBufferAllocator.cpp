@@ -10,10 +10,45 @@
 #include <Atom/RPI.Public/DynamicDraw/DynamicBufferAllocator.h>
 #include <Atom/RPI.Public/DynamicDraw/DynamicBuffer.h>
 
+#include <AzCore/std/algorithm.h>
+
 namespace AZ
 {
     namespace RPI
     {
+        namespace
+        {
+            // Allocations up to this size are served from the chunk of the calling thread
+            constexpr uint32_t MaxThreadChunkAllocationSize = 16 * 1024;
+            constexpr uint32_t ThreadChunkSize = 64 * 1024;
+
+            uint32_t GetRingPosition(uint64_t ringState)
+            {
+                return aznumeric_cast<uint32_t>(ringState & 0xFFFFFFFF);
+            }
+
+            uint32_t GetRingAllocatedSize(uint64_t ringState)
+            {
+                return aznumeric_cast<uint32_t>(ringState >> 32);
+            }
+
+            uint64_t MakeRingState(uint32_t position, uint32_t allocatedSize)
+            {
+                return (aznumeric_cast<uint64_t>(allocatedSize) << 32) | position;
+            }
+
+            // Epochs are unique across all allocators and frames, so a thread's chunk is never used after the frame or allocator it came from
+            AZStd::atomic<uint64_t> s_nextEpoch{ 0 };
+
+            struct ThreadChunk
+            {
+                uint64_t m_epoch = 0;
+                uint32_t m_position = 0;
+                uint32_t m_endPosition = 0;
+            };
+            thread_local ThreadChunk s_threadChunk;
+        }
+
         void DynamicBufferAllocator::Init(uint32_t ringBufferSize)
         {
             if (m_ringBuffer)
@@ -39,8 +74,11 @@ namespace AZ
             m_ringBufferSize = ringBufferSize;
             m_ringBufferStartAddress = m_ringBuffer->Map(m_ringBufferSize, 0);
             
-            m_currentPosition = 0;
+            m_ringState = 0;
             m_endPositionLimit = 0;
+            m_epoch = ++s_nextEpoch;
+            m_lastFrameAllocatedSize = 0;
+            m_peakFrameAllocatedSize = 0;
             m_currentFrame = 0;
             for (uint32_t frame = 0; frame < AZ::RHI::Limits::Device::FrameCountMax; frame++)
             {
@@ -56,7 +94,7 @@ namespace AZ
         }
 
         // [GFX TODO][ATOM-13182] Add unit tests for DynamicBufferAllocator's Allocate function 
-        RHI::Ptr<DynamicBuffer> DynamicBufferAllocator::Allocate(uint32_t size, [[maybe_unused]]uint32_t alignment)
+        RHI::Ptr<DynamicBuffer> DynamicBufferAllocator::Allocate(uint32_t size, uint32_t alignment)
         {
             size = RHI::AlignUp(size, alignment);
             uint32_t allocatePosition = 0;
@@ -73,59 +111,119 @@ namespace AZ
                 return nullptr;
             }
 
-            // Return if the allocation of current frame has reached limit
-            if (m_endPositionLimit == m_currentPosition && m_currentAllocatedSize > 0)
+            // Small allocations come from the chunk of the calling thread so threads don't contend on the ring buffer.
+            // Larger ones, or small ones when a new chunk doesn't fit, are allocated from the ring buffer directly.
+            bool allocated = size <= MaxThreadChunkAllocationSize && AllocateFromThreadChunk(size, alignment, allocatePosition);
+            if (!allocated && !AllocateFromRing(size, allocatePosition))
             {
-                AZ_WarningOnce("RPI", !m_enableAllocationWarning, "DynamicBufferAllocator::Allocate: no more buffer is available");
                 return nullptr;
             }
 
-            if (m_endPositionLimit > m_currentPosition)
+            RHI::Ptr<DynamicBuffer> allocatedBuffer = aznew DynamicBuffer();
+            allocatedBuffer->m_address = (uint8_t*)m_ringBufferStartAddress + allocatePosition;
+            allocatedBuffer->m_size = size;
+            allocatedBuffer->m_allocator = this;
+            return allocatedBuffer;
+        }
+
+        bool DynamicBufferAllocator::AllocateFromThreadChunk(uint32_t size, uint32_t alignment, uint32_t& allocatePosition)
+        {
+            ThreadChunk& chunk = s_threadChunk;
+            const uint64_t epoch = m_epoch.load(AZStd::memory_order_relaxed);
+
+            if (chunk.m_epoch == epoch)
             {
-                if (m_endPositionLimit - m_currentPosition >= size)
-                {
-                    allocatePosition = m_currentPosition;
-                    m_currentPosition += size;
-                }
-                else
+                const uint32_t position = RHI::AlignUp(chunk.m_position, alignment);
+                if (position <= chunk.m_endPosition && chunk.m_endPosition - position >= size)
                 {
-                    AZ_WarningOnce("RPI", !m_enableAllocationWarning, "DynamicBufferAllocator::Allocate: requested size (%d bytes) is larger than the size left (%d bytes)", size, m_endPositionLimit - m_currentPosition);
-                    return nullptr;
+                    allocatePosition = position;
+                    chunk.m_position = position + size;
+                    return true;
                 }
             }
-            else
+
+            // Refill the chunk. The rest of the old chunk is left unused until the ring buffer wraps around.
+            const uint32_t chunkSize = AZStd::min(ThreadChunkSize, m_ringBufferSize);
+            uint32_t chunkPosition = 0;
+            if (chunkSize < size || !AllocateFromRing(chunkSize, chunkPosition, false))
             {
-                if (m_ringBufferSize - m_currentPosition >= size)
+                return false;
+            }
+
+            chunk.m_epoch = epoch;
+            chunk.m_position = chunkPosition;
+            chunk.m_endPosition = chunkPosition + chunkSize;
+
+            const uint32_t position = RHI::AlignUp(chunk.m_position, alignment);
+            if (position > chunk.m_endPosition || chunk.m_endPosition - position < size)
+            {
+                return false;
+            }
+            allocatePosition = position;
+            chunk.m_position = position + size;
+            return true;
+        }
+
+        bool DynamicBufferAllocator::AllocateFromRing(uint32_t size, uint32_t& allocatePosition, bool reportFailure)
+        {
+            uint64_t ringState = m_ringState.load(AZStd::memory_order_relaxed);
+            uint64_t newRingState = 0;
+            do
+            {
+                const uint32_t currentPosition = GetRingPosition(ringState);
+                const uint32_t currentAllocatedSize = GetRingAllocatedSize(ringState);
+                uint32_t newPosition = 0;
+
+                // Return if the allocation of current frame has reached limit
+                if (m_endPositionLimit == currentPosition && currentAllocatedSize > 0)
+                {
+                    AZ_WarningOnce("RPI", !m_enableAllocationWarning || !reportFailure, "DynamicBufferAllocator::Allocate: no more buffer is available");
+                    return false;
+                }
+
+                if (m_endPositionLimit > currentPosition)
                 {
-                    allocatePosition = m_currentPosition;
-                    m_currentPosition += size;
-                    if (m_ringBufferSize == m_currentPosition)
+                    if (m_endPositionLimit - currentPosition >= size)
+                    {
+                        allocatePosition = currentPosition;
+                        newPosition = currentPosition + size;
+                    }
+                    else
                     {
-                        m_currentPosition = 0;
+                        AZ_WarningOnce("RPI", !m_enableAllocationWarning || !reportFailure, "DynamicBufferAllocator::Allocate: requested size (%d bytes) is larger than the size left (%d bytes)", size, m_endPositionLimit - currentPosition);
+                        return false;
                     }
                 }
                 else
                 {
-                    if (m_endPositionLimit >= size)
+                    if (m_ringBufferSize - currentPosition >= size)
                     {
-                        allocatePosition = 0;
-                        m_currentPosition = size;
+                        allocatePosition = currentPosition;
+                        newPosition = currentPosition + size;
+                        if (m_ringBufferSize == newPosition)
+                        {
+                            newPosition = 0;
+                        }
                     }
                     else
                     {
-                        AZ_WarningOnce("RPI", !m_enableAllocationWarning, "DynamicBufferAllocator::Allocate: requested size (%d bytes) is larger than the size left (%d bytes)", size, m_endPositionLimit);
-                        return nullptr;
+                        if (m_endPositionLimit >= size)
+                        {
+                            allocatePosition = 0;
+                            newPosition = size;
+                        }
+                        else
+                        {
+                            AZ_WarningOnce("RPI", !m_enableAllocationWarning || !reportFailure, "DynamicBufferAllocator::Allocate: requested size (%d bytes) is larger than the size left (%d bytes)", size, m_endPositionLimit);
+                            return false;
+                        }
                     }
                 }
-            }
 
-            m_currentAllocatedSize += size;
+                newRingState = MakeRingState(newPosition, currentAllocatedSize + size);
+            } while (!m_ringState.compare_exchange_weak(ringState, newRingState, AZStd::memory_order_relaxed));
 
-            RHI::Ptr<DynamicBuffer> allocatedBuffer = aznew DynamicBuffer();
-            allocatedBuffer->m_address = (uint8_t*)m_ringBufferStartAddress + allocatePosition;
-            allocatedBuffer->m_size = size;
-            allocatedBuffer->m_allocator = this;
-            return allocatedBuffer;
+            return true;
         }
 
         RHI::IndexBufferView DynamicBufferAllocator::GetIndexBufferView(RHI::Ptr<DynamicBuffer> dynamicBuffer, RHI::IndexFormat format)
@@ -158,20 +256,42 @@ namespace AZ
             m_enableAllocationWarning = enable;
         }
 
+        uint32_t DynamicBufferAllocator::GetLastFrameAllocatedSize() const
+        {
+            return m_lastFrameAllocatedSize;
+        }
+
+        uint32_t DynamicBufferAllocator::GetPeakFrameAllocatedSize() const
+        {
+            return m_peakFrameAllocatedSize;
+        }
+
+        uint32_t DynamicBufferAllocator::GetRingBufferSize() const
+        {
+            return m_ringBufferSize;
+        }
+
         void DynamicBufferAllocator::FrameEnd()
         {
             uint32_t nextFrame = (m_currentFrame + 1) % AZ::RHI::Limits::Device::FrameCountMax;
 
+            const uint64_t ringState = m_ringState.load();
+            const uint32_t currentPosition = GetRingPosition(ringState);
+
+            m_lastFrameAllocatedSize = GetRingAllocatedSize(ringState);
+            m_peakFrameAllocatedSize = AZStd::max(m_peakFrameAllocatedSize, m_lastFrameAllocatedSize);
+
             // The saved frame start position will become available since it's old than FrameCountMax. The saved start position of next frame is the new limit
             m_endPositionLimit = m_frameStartPositions[nextFrame];
 
             // Save start position for current frame
-            m_frameStartPositions[m_currentFrame] = m_currentPosition;
+            m_frameStartPositions[m_currentFrame] = currentPosition;
 
             m_currentFrame = nextFrame;
 
-            m_currentAllocatedSize = 0;
-
+            // Reset the allocated size and invalidate the chunks of all threads, they belong to the finished frame
+            m_ringState = MakeRingState(currentPosition, 0);
+            m_epoch = ++s_nextEpoch;
         }
     }
 }
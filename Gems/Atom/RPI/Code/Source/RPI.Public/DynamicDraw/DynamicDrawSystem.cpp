@@ -48,10 +48,22 @@ namespace AZ
 
         RHI::Ptr<DynamicBuffer> DynamicDrawSystem::GetDynamicBuffer(uint32_t size, uint32_t alignment)
         {
-            AZStd::lock_guard<AZStd::mutex> lock(m_mutexBufferAlloc);
+            // The allocator is thread safe, so dynamic buffers can be allocated from jobs without locking
             return m_bufferAlloc->Allocate(size, alignment);
         }
 
+        DynamicBufferStatistics DynamicDrawSystem::GetDynamicBufferStatistics() const
+        {
+            DynamicBufferStatistics statistics;
+            if (m_bufferAlloc)
+            {
+                statistics.m_ringBufferSize = m_bufferAlloc->GetRingBufferSize();
+                statistics.m_lastFrameAllocatedSize = m_bufferAlloc->GetLastFrameAllocatedSize();
+                statistics.m_peakFrameAllocatedSize = m_bufferAlloc->GetPeakFrameAllocatedSize();
+            }
+            return statistics;
+        }
+
         RHI::Ptr<DynamicDrawContext> DynamicDrawSystem::CreateDynamicDrawContext(Scene* scene)
         {
             if (!scene)
@@ -122,10 +134,8 @@ namespace AZ
 
         void DynamicDrawSystem::FrameEnd()
         {
-            {
-                AZStd::lock_guard<AZStd::mutex> lock(m_mutexBufferAlloc);
-                m_bufferAlloc->FrameEnd();
-            }
+            // No allocations happen while the frame ends
+            m_bufferAlloc->FrameEnd();
 
             // Clean up released dynamic draw contexts (which use count is 1)
             {
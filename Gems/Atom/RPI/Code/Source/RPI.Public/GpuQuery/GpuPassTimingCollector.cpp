@@ -0,0 +1,234 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ * 
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Atom/RPI.Public/GpuQuery/GpuPassTimingCollector.h>
+#include <Atom/RPI.Public/Pass/ParentPass.h>
+#include <Atom/RPI.Public/Pass/PassSystemInterface.h>
+
+#include <Atom/RHI/RHIUtils.h>
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/sort.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        AZ_CVAR(bool,
+            r_gpuPassTiming,
+            false,
+            [](const bool& enable)
+            {
+                if (PassSystemInterface* passSystem = PassSystemInterface::Get())
+                {
+                    passSystem->SetGpuPassTimingEnabled(enable);
+                }
+            },
+            ConsoleFunctorFlags::Null,
+            "Enables timestamp and pipeline statistics queries on every pass and keeps rolling averages of their results. Use r_printGpuPassTimings to print them."
+        );
+
+        static void r_printGpuPassTimings([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
+        {
+            PassSystemInterface* passSystem = PassSystemInterface::Get();
+            if (!passSystem || !passSystem->IsGpuPassTimingEnabled())
+            {
+                AZ_Printf("GpuPassTiming", "GPU pass timing is disabled, enable it with r_gpuPassTiming.\n");
+                return;
+            }
+
+            AZStd::vector<GpuPassTiming> timings = passSystem->GetGpuPassTimings();
+            AZStd::sort(timings.begin(), timings.end(), [](const GpuPassTiming& lhs, const GpuPassTiming& rhs)
+                {
+                    return lhs.m_averageDurationInNanoseconds > rhs.m_averageDurationInNanoseconds;
+                });
+
+            AZ_Printf("GpuPassTiming", "Average (ms) | Max (ms) | Pass\n");
+            for (const GpuPassTiming& timing : timings)
+            {
+                AZ_Printf("GpuPassTiming", "%12.3f | %8.3f | %s\n",
+                    timing.m_averageDurationInNanoseconds / 1000000.0,
+                    timing.m_maxDurationInNanoseconds / 1000000.0,
+                    timing.m_passPath.GetCStr());
+            }
+        }
+
+        AZ_CONSOLEFREEFUNC(r_printGpuPassTimings, ConsoleFunctorFlags::Null,
+            "Prints the GPU timings of all passes, averaged over the last frames, from the slowest to the fastest one.");
+
+        void GpuPassTimingCollector::SetEnabled(bool enable)
+        {
+            if (m_enabled != enable)
+            {
+                m_enabled = enable;
+                m_queriesDirty = true;
+                m_passSamples.clear();
+                m_frameHistory.clear();
+                m_nextHistoryFrame = 0;
+            }
+        }
+
+        bool GpuPassTimingCollector::IsEnabled() const
+        {
+            return m_enabled;
+        }
+
+        void GpuPassTimingCollector::UpdateQueries(ParentPass& rootPass, bool hierarchyChanged)
+        {
+            // Parent passes forward the query state to all of their children
+            if (m_queriesDirty || (m_enabled && hierarchyChanged))
+            {
+                rootPass.SetTimestampQueryEnabled(m_enabled);
+                rootPass.SetPipelineStatisticsQueryEnabled(m_enabled);
+                m_queriesDirty = false;
+            }
+        }
+
+        void GpuPassTimingCollector::CollectResults(const ParentPass& rootPass)
+        {
+            if (!m_enabled)
+            {
+                return;
+            }
+
+            ++m_frameCounter;
+
+            if (m_frameHistory.empty())
+            {
+                m_frameHistory.resize(FrameHistoryCount);
+            }
+            GpuFrameTimestamps& frameTimestamps = m_frameHistory[m_nextHistoryFrame];
+            m_nextHistoryFrame = (m_nextHistoryFrame + 1) % FrameHistoryCount;
+            frameTimestamps.m_collectedTick = AZStd::GetTimeNowTicks();
+            frameTimestamps.m_passTimestamps.clear();
+            m_passBeginTicks.clear();
+
+            uint32_t order = 0;
+            for (const Ptr<Pass>& child : rootPass.GetChildren())
+            {
+                CollectResultsRecursively(*child, order, frameTimestamps);
+            }
+
+            // Make the begin timestamps relative to the earliest pass of the frame
+            if (!m_passBeginTicks.empty())
+            {
+                const RHI::Ptr<RHI::Device> device = RHI::GetRHIDevice();
+                const auto earliestPass = AZStd::min_element(m_passBeginTicks.begin(), m_passBeginTicks.end(),
+                    [](const PassBeginTick& lhs, const PassBeginTick& rhs)
+                    {
+                        return lhs.m_beginInTicks < rhs.m_beginInTicks;
+                    });
+                const uint64_t frameBeginInTicks = earliestPass->m_beginInTicks;
+                for (size_t i = 0; i < m_passBeginTicks.size(); ++i)
+                {
+                    frameTimestamps.m_passTimestamps[i].m_beginInMicroseconds = static_cast<uint64_t>(device->GpuTimestampToMicroseconds(
+                        m_passBeginTicks[i].m_beginInTicks - frameBeginInTicks, m_passBeginTicks[i].m_hardwareQueueClass).count());
+                }
+            }
+
+            // Drop the passes that were removed from the hierarchy
+            for (auto it = m_passSamples.begin(); it != m_passSamples.end();)
+            {
+                if (it->second.m_lastCollectedFrame != m_frameCounter)
+                {
+                    it = m_passSamples.erase(it);
+                }
+                else
+                {
+                    ++it;
+                }
+            }
+        }
+
+        void GpuPassTimingCollector::CollectResultsRecursively(const Pass& pass, uint32_t& order, GpuFrameTimestamps& frameTimestamps)
+        {
+            if (!pass.IsEnabled())
+            {
+                return;
+            }
+
+            // The results of the queries are only available a few frames after they were enabled
+            const TimestampResult timestampResult = pass.GetLatestTimestampResult();
+            const uint64_t duration = timestampResult.GetDurationInNanoseconds();
+            if (duration > 0)
+            {
+                frameTimestamps.m_passTimestamps.push_back({ pass.GetPathName(), 0, duration / 1000 });
+                m_passBeginTicks.push_back({ timestampResult.GetTimestampBeginInTicks(), timestampResult.GetHardwareQueueClass() });
+
+                PassSamples& samples = m_passSamples[pass.GetPathName()];
+                samples.m_durationSum += duration;
+                if (samples.m_sampleCount == RollingAverageFrameCount)
+                {
+                    samples.m_durationSum -= samples.m_durations[samples.m_nextSample];
+                }
+                else
+                {
+                    ++samples.m_sampleCount;
+                }
+                samples.m_durations[samples.m_nextSample] = duration;
+                samples.m_nextSample = (samples.m_nextSample + 1) % RollingAverageFrameCount;
+                samples.m_order = order++;
+                samples.m_lastCollectedFrame = m_frameCounter;
+                samples.m_latestPipelineStatistics = pass.GetLatestPipelineStatisticsResult();
+            }
+
+            if (const ParentPass* parentPass = pass.AsParent())
+            {
+                for (const Ptr<Pass>& child : parentPass->GetChildren())
+                {
+                    CollectResultsRecursively(*child, order, frameTimestamps);
+                }
+            }
+        }
+
+        AZStd::vector<GpuPassTiming> GpuPassTimingCollector::GetPassTimings() const
+        {
+            AZStd::vector<AZStd::pair<uint32_t, GpuPassTiming>> orderedTimings;
+            orderedTimings.reserve(m_passSamples.size());
+            for (const auto& [passPath, samples] : m_passSamples)
+            {
+                GpuPassTiming timing;
+                timing.m_passPath = passPath;
+                timing.m_averageDurationInNanoseconds = samples.m_durationSum / samples.m_sampleCount;
+                timing.m_latestDurationInNanoseconds =
+                    samples.m_durations[(samples.m_nextSample + RollingAverageFrameCount - 1) % RollingAverageFrameCount];
+                timing.m_maxDurationInNanoseconds =
+                    *AZStd::max_element(samples.m_durations.begin(), samples.m_durations.begin() + samples.m_sampleCount);
+                timing.m_latestPipelineStatistics = samples.m_latestPipelineStatistics;
+                orderedTimings.emplace_back(samples.m_order, AZStd::move(timing));
+            }
+
+            AZStd::sort(orderedTimings.begin(), orderedTimings.end(), [](const auto& lhs, const auto& rhs)
+                {
+                    return lhs.first < rhs.first;
+                });
+
+            AZStd::vector<GpuPassTiming> timings;
+            timings.reserve(orderedTimings.size());
+            for (auto& orderedTiming : orderedTimings)
+            {
+                timings.push_back(AZStd::move(orderedTiming.second));
+            }
+            return timings;
+        }
+
+        AZStd::vector<GpuFrameTimestamps> GpuPassTimingCollector::GetFrameTimestamps(AZStd::sys_time_t startTick) const
+        {
+            AZStd::vector<GpuFrameTimestamps> frames;
+            for (size_t i = 0; i < m_frameHistory.size(); ++i)
+            {
+                const GpuFrameTimestamps& frame = m_frameHistory[(m_nextHistoryFrame + i) % m_frameHistory.size()];
+                if (frame.m_collectedTick >= startTick && !frame.m_passTimestamps.empty())
+                {
+                    frames.push_back(frame);
+                }
+            }
+            return frames;
+        }
+    }   // namespace RPI
+}   // namespace AZ
@@ -8,14 +8,39 @@
 #include <Atom/RPI.Public/Image/DefaultStreamingImageController.h>
 #include <Atom/RPI.Public/Image/StreamingImage.h>
 
+#include <Atom/RHI.Reflect/ImageSubresource.h>
+
 #include <AtomCore/Instance/InstanceDatabase.h>
 
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/sort.h>
 
 namespace AZ
 {
     namespace RPI
     {
+        AZ_CVAR(uint32_t, r_streamingImageMemoryBudgetMB, 0, nullptr, ConsoleFunctorFlags::Null,
+            "Budget for the resident mips of streaming images in megabytes, the least needed mips are trimmed past it. 0 disables the budget.");
+        AZ_CVAR(uint32_t, r_streamingImageEvictFrames, 60, nullptr, ConsoleFunctorFlags::Null,
+            "Number of updates a resident mip chain of a streaming image has to go without being requested by a view before it is trimmed.");
+
+        namespace
+        {
+            // Returns the size of the mips from firstMip to the end of the image.
+            uint64_t GetMipsMemorySize(const RHI::ImageDescriptor& descriptor, uint16_t firstMip)
+            {
+                uint64_t memorySize = 0;
+                for (uint16_t mipLevel = firstMip; mipLevel < descriptor.m_mipLevels; ++mipLevel)
+                {
+                    const RHI::Size mipSize = descriptor.m_size.GetReducedMip(mipLevel);
+                    const RHI::ImageSubresourceLayout layout = RHI::GetImageSubresourceLayout(mipSize, descriptor.m_format);
+                    memorySize += static_cast<uint64_t>(layout.m_bytesPerImage) * mipSize.m_depth * descriptor.m_arraySize;
+                }
+                return memorySize;
+            }
+        }
+
         Data::Instance<DefaultStreamingImageController> DefaultStreamingImageController::FindOrCreate(const Data::Asset<DefaultStreamingImageControllerAsset>& asset)
         {
             return azrtti_cast<DefaultStreamingImageController*>(
@@ -51,36 +76,131 @@ namespace AZ
 
         StreamingImageContextPtr DefaultStreamingImageController::CreateContextInternal()
         {
-            StreamingImageContextPtr context = aznew StreamingImageContext();
-            m_recentlyAttachedContexts.emplace_back(context);
+            AZStd::intrusive_ptr<Context> context = aznew Context();
+            m_imageContexts.emplace_back(context);
             return context;
         }
 
         void DefaultStreamingImageController::UpdateInternal(size_t timestamp, const StreamingImageContextList& contexts)
         {
-            AZ_UNUSED(timestamp);
             AZ_UNUSED(contexts);
 
             const uint32_t maxExpandsCount = 20;
+            const size_t evictFrames = r_streamingImageEvictFrames;
+            const uint64_t memoryBudget = static_cast<uint64_t>(r_streamingImageMemoryBudgetMB) * 1024 * 1024;
+
+            struct ImageStreamingState
+            {
+                Context* m_context = nullptr;
+                StreamingImage* m_image = nullptr;
+                size_t m_residentMipChain = 0;
+                size_t m_targetMipChain = 0;
+                size_t m_tailMipChain = 0;
+                uint64_t m_residentMemorySize = 0;
+            };
+            AZStd::vector<ImageStreamingState> images;
+            images.reserve(m_imageContexts.size());
+            uint64_t residentMemorySize = 0;
+
+            size_t attachedContextCount = 0;
+            for (AZStd::intrusive_ptr<Context>& context : m_imageContexts)
+            {
+                StreamingImage* image = context->TryGetImage();
+                if (!image)
+                {
+                    continue;
+                }
+                m_imageContexts[attachedContextCount++] = context;
+
+                if (!image->IsStreamable())
+                {
+                    continue;
+                }
+
+                const RHI::ImageDescriptor& descriptor = image->GetDescriptor();
+                const uint16_t lastMip = descriptor.m_mipLevels - 1;
+
+                // The target mip is reset after every update, so it only holds what the views requested since the last update.
+                // Once views request mips for the image, it only keeps its tail when none of them does.
+                uint16_t targetMip = 0;
+                if (context->GetTargetMip() <= lastMip)
+                {
+                    context->m_hasTargetMip = true;
+                    targetMip = context->GetTargetMip();
+                }
+                else if (context->m_hasTargetMip)
+                {
+                    targetMip = lastMip;
+                }
+
+                ImageStreamingState state;
+                state.m_context = context.get();
+                state.m_image = image;
+                state.m_residentMipChain = image->GetMipChainIndex(image->GetResidentMipLevel());
+                state.m_targetMipChain = image->GetMipChainIndex(targetMip);
+                state.m_tailMipChain = image->GetMipChainIndex(lastMip);
+                state.m_residentMemorySize = GetMipsMemorySize(descriptor, image->GetResidentMipLevel());
+                residentMemorySize += state.m_residentMemorySize;
+
+                if (state.m_targetMipChain <= state.m_residentMipChain)
+                {
+                    context->m_residentMipsNeededTimestamp = timestamp;
+                }
+                else if (timestamp - context->m_residentMipsNeededTimestamp > evictFrames)
+                {
+                    // Trim the mips that haven't been needed for a while
+                    TrimToMipChainLevel(image, state.m_targetMipChain);
+                    residentMemorySize -= state.m_residentMemorySize;
+                    state.m_residentMipChain = state.m_targetMipChain;
+                    state.m_residentMemorySize = GetMipsMemorySize(descriptor, aznumeric_cast<uint16_t>(image->GetMipLevel(state.m_targetMipChain)));
+                    residentMemorySize += state.m_residentMemorySize;
+                }
+                images.push_back(state);
+            }
+            m_imageContexts.resize(attachedContextCount);
+
+            // The images the furthest from their target mip stream in first
+            AZStd::sort(images.begin(), images.end(), [](const ImageStreamingState& lhs, const ImageStreamingState& rhs)
+            {
+                const int64_t lhsMissingMipChains = static_cast<int64_t>(lhs.m_residentMipChain) - static_cast<int64_t>(lhs.m_targetMipChain);
+                const int64_t rhsMissingMipChains = static_cast<int64_t>(rhs.m_residentMipChain) - static_cast<int64_t>(rhs.m_targetMipChain);
+                return lhsMissingMipChains > rhsMissingMipChains;
+            });
+
             uint32_t mipsExpandsPerUpdate = 0;
+            for (const ImageStreamingState& state : images)
+            {
+                if (state.m_targetMipChain >= state.m_residentMipChain || mipsExpandsPerUpdate >= maxExpandsCount)
+                {
+                    break;
+                }
+
+                const uint64_t targetMemorySize = GetMipsMemorySize(
+                    state.m_image->GetDescriptor(), aznumeric_cast<uint16_t>(state.m_image->GetMipLevel(state.m_targetMipChain)));
+                if (memoryBudget > 0 && residentMemorySize - state.m_residentMemorySize + targetMemorySize > memoryBudget)
+                {
+                    continue;
+                }
+
+                // Expansions already in flight are not queued again, the next update accounts for them once they are resident
+                QueueExpandToMipChainLevel(state.m_image, state.m_targetMipChain);
+                residentMemorySize += targetMemorySize - state.m_residentMemorySize;
+                ++mipsExpandsPerUpdate;
+            }
 
-            // [GFX TODO] [ATOM-551] Streaming image control of DefaultStreamingImageController
-            // For now we always stream in all the mips. Of course we need to make this smarter at some point.
-            if (!m_recentlyAttachedContexts.empty())
+            // Over the budget, trim one mip chain at a time from the images needing their mips the least
+            for (auto it = images.rbegin(); it != images.rend() && memoryBudget > 0 && residentMemorySize > memoryBudget; ++it)
             {
-                for (auto& context : m_recentlyAttachedContexts)
+                ImageStreamingState& state = *it;
+                while (state.m_residentMipChain < state.m_tailMipChain && residentMemorySize > memoryBudget)
                 {
-                    if (StreamingImage* image = context->TryGetImage())
-                    {
-                        QueueExpandToMipChainLevel(image, 0);
-                        mipsExpandsPerUpdate++;
-                        if (mipsExpandsPerUpdate >= maxExpandsCount)
-                        {
-                            break;
-                        }
-                    }
+                    ++state.m_residentMipChain;
+                    TrimToMipChainLevel(state.m_image, state.m_residentMipChain);
+                    const uint64_t trimmedMemorySize = GetMipsMemorySize(
+                        state.m_image->GetDescriptor(), aznumeric_cast<uint16_t>(state.m_image->GetMipLevel(state.m_residentMipChain)));
+                    residentMemorySize -= state.m_residentMemorySize - trimmedMemorySize;
+                    state.m_residentMemorySize = trimmedMemorySize;
                 }
-                m_recentlyAttachedContexts.erase(m_recentlyAttachedContexts.begin(), m_recentlyAttachedContexts.begin() + mipsExpandsPerUpdate);
             }
         }
     }
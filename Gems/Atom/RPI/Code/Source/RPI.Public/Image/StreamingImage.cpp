@@ -16,6 +16,7 @@
 #include <Atom/RHI/Factory.h>
 
 #include <AzCore/Debug/EventTrace.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
 #include <AtomCore/Instance/InstanceDatabase.h>
 
 // Enable this define to debug output streaming image initialization and expanding process.
@@ -25,6 +26,59 @@ namespace AZ
 {
     namespace RPI
     {
+        namespace
+        {
+            // CPU decompressed copy of a mip chain, used for pools that can't decompress the mip chain on the GPU.
+            // The copy needs to stay alive until the RHI pool has finished uploading the mip slices.
+            struct DecompressedMipChain
+            {
+                AZStd::vector<uint8_t> m_imageData;
+                AZStd::vector<RHI::StreamingImageSubresourceData> m_subImageDatas;
+                ImageMipChainAsset::MipSliceList m_mipSlices;
+            };
+
+            AZStd::shared_ptr<DecompressedMipChain> DecompressMipChain(const ImageMipChainAsset& mipChainAsset)
+            {
+                AZ_TRACE_METHOD();
+
+                const uint32_t subImageCount = static_cast<uint32_t>(mipChainAsset.GetSubImageCount());
+                AZStd::vector<size_t> subImageOffsets;
+                subImageOffsets.reserve(subImageCount);
+                size_t imageDataSize = 0;
+                for (uint32_t subImageIndex = 0; subImageIndex < subImageCount; ++subImageIndex)
+                {
+                    subImageOffsets.push_back(imageDataSize);
+                    imageDataSize += mipChainAsset.GetDecompressedSubImageSize(subImageIndex);
+                }
+
+                auto result = AZStd::make_shared<DecompressedMipChain>();
+                result->m_imageData.resize(imageDataSize);
+                result->m_subImageDatas.resize(subImageCount);
+                for (uint32_t subImageIndex = 0; subImageIndex < subImageCount; ++subImageIndex)
+                {
+                    uint8_t* subImageData = result->m_imageData.data() + subImageOffsets[subImageIndex];
+                    if (!mipChainAsset.DecompressSubImage(
+                        subImageIndex, subImageData, mipChainAsset.GetDecompressedSubImageSize(subImageIndex)))
+                    {
+                        AZ_Error("StreamingImage", false, "Failed to decompress sub-image %u of mip chain.", subImageIndex);
+                        return nullptr;
+                    }
+                    result->m_subImageDatas[subImageIndex].m_data = subImageData;
+                }
+
+                const uint16_t arraySize = mipChainAsset.GetArraySize();
+                for (const RHI::StreamingImageMipSlice& sourceMipSlice : mipChainAsset.GetMipSlices())
+                {
+                    RHI::StreamingImageMipSlice mipSlice;
+                    mipSlice.m_subresources = AZStd::array_view<RHI::StreamingImageSubresourceData>(
+                        &result->m_subImageDatas[arraySize * result->m_mipSlices.size()], arraySize);
+                    mipSlice.m_subresourceLayout = sourceMipSlice.m_subresourceLayout;
+                    result->m_mipSlices.push_back(mipSlice);
+                }
+                return result;
+            }
+        }
+
         Data::Instance<StreamingImage> StreamingImage::FindOrCreate(const Data::Asset<StreamingImageAsset>& streamingImageAsset)
         {
             return Data::InstanceDatabase<StreamingImage>::Instance().FindOrCreate(
@@ -153,6 +207,18 @@ namespace AZ
                 initRequest.m_descriptor = imageAsset.GetImageDescriptor();
                 initRequest.m_tailMipSlices = mipChainTailAsset.GetMipSlices();
 
+                // The tail is uploaded synchronously, so the decompressed copy only needs to live for the duration of InitImage.
+                AZStd::shared_ptr<DecompressedMipChain> decompressedTail;
+                if (!rhiPool->IsCompressionSupported(mipChainTailAsset.GetCompression()))
+                {
+                    decompressedTail = DecompressMipChain(mipChainTailAsset);
+                    if (!decompressedTail)
+                    {
+                        return RHI::ResultCode::Fail;
+                    }
+                    initRequest.m_tailMipSlices = decompressedTail->m_mipSlices;
+                }
+
                 // NOTE: Initialization can fail due to out-of-memory errors. Need to handle it at runtime.
                 resultCode = rhiPool->InitImage(initRequest);
             }
@@ -249,6 +315,16 @@ namespace AZ
             return m_image->GetResidentMipLevel();
         }
 
+        size_t StreamingImage::GetMipChainIndex(size_t mipLevel) const
+        {
+            return m_imageAsset->GetMipChainIndex(mipLevel);
+        }
+
+        size_t StreamingImage::GetMipLevel(size_t mipChainIndex) const
+        {
+            return m_imageAsset->GetMipLevel(mipChainIndex);
+        }
+
         RHI::ResultCode StreamingImage::TrimToMipChainLevel(size_t mipChainIndex)
         {
             AZ_Assert(mipChainIndex < m_mipChains.size(), "Exceeded number of mip chains.");
@@ -446,7 +522,20 @@ namespace AZ
                 request.m_image = GetRHIImage();
                 request.m_mipSlices = mipSlices;
 
-                request.m_completeCallback = [=]()
+                // Pools that can't decompress the mip chain on the GPU get a CPU decompressed copy instead.
+                AZStd::shared_ptr<DecompressedMipChain> decompressedMipChain;
+                if (!m_rhiPool->IsCompressionSupported(mipChainAsset->GetCompression()))
+                {
+                    decompressedMipChain = DecompressMipChain(*mipChainAsset);
+                    if (!decompressedMipChain)
+                    {
+                        return RHI::ResultCode::Fail;
+                    }
+                    request.m_mipSlices = decompressedMipChain->m_mipSlices;
+                }
+
+                // The decompressed copy is held by the callback so it stays alive until the upload is done.
+                request.m_completeCallback = [=, decompressedMipChain = AZStd::move(decompressedMipChain)]()
                 {
 #ifdef AZ_RPI_STREAMING_IMAGE_DEBUG_LOG
                     AZ_TracePrintf("StreamingImage", "Upload mipchain done [%s]\n", mipChainAsset.GetHint().c_str());
@@ -97,7 +97,9 @@ namespace AZ
             }
 
             MaterialPropertyFlags prevOverrideFlags = m_propertyOverrideFlags;
-            AZStd::vector<MaterialPropertyValue> prevPropertyValues = m_propertyValues;
+            // The values are reset so the new SRG and shader collection receive all of them, even the ones that didn't change
+            AZStd::vector<MaterialPropertyValue> prevPropertyValues = AZStd::move(m_propertyValues);
+            m_propertyValues.clear();
 
             // Initialize the shader runtime data like shader constant buffers and shader variants by applying the 
             // material's property values. This will feed through the normal runtime material value-change data flow, which may
@@ -139,6 +141,7 @@ namespace AZ
             // the material, but some materials might not have any properties, and we need
             // the material to be invalidated particularly when hot-reloading.
             ++m_currentChangeId;
+            ++m_shaderCollectionChangeId;
             // Set all dirty for the first use.
             m_propertyDirtyFlags.set();
 
@@ -329,6 +332,11 @@ namespace AZ
 
 
                             functor->Process(processContext);
+
+                            if (processContext.HasShaderCollectionChanged())
+                            {
+                                ++m_shaderCollectionChangeId;
+                            }
                         }
                     }
                     else
@@ -360,6 +368,11 @@ namespace AZ
             return m_currentChangeId;
         }
 
+        Material::ChangeId Material::GetShaderCollectionChangeId() const
+        {
+            return m_shaderCollectionChangeId;
+        }
+
         MaterialPropertyIndex Material::FindPropertyIndex(const Name& name) const
         {
             return m_layout->FindPropertyIndex(name);
@@ -483,9 +496,17 @@ namespace AZ
             }
 
             MaterialPropertyValue& savedPropertyValue = m_propertyValues[index.GetIndex()];
+            m_propertyOverrideFlags.set(index.GetIndex());
+
+            // Setting the value a property already has, like scripts animating the value every frame do, doesn't need to
+            // touch the SRG or the functors
+            if (savedPropertyValue.Is<Type>() && savedPropertyValue.GetValue<Type>() == value)
+            {
+                return true;
+            }
+
             savedPropertyValue = value;
             m_propertyDirtyFlags.set(index.GetIndex());
-            m_propertyOverrideFlags.set(index.GetIndex());
 
             for(auto& outputId : propertyDescriptor->GetOutputConnections())
             {
@@ -511,6 +532,7 @@ namespace AZ
                     {
                         return false;
                     }
+                    ++m_shaderCollectionChangeId;
                 }
                 else
                 {
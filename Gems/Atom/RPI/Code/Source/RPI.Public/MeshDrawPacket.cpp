@@ -27,6 +27,14 @@ namespace AZ
             "(For Testing) Forces usage of root shader variant in the mesh draw packet level, ignoring any other shader variants that may exist."
         );
 
+        AZ_CVAR(bool,
+            r_asyncPipelineStateCompile,
+            false,
+            nullptr,
+            ConsoleFunctorFlags::Null,
+            "Compiles the pipeline states of shader variants on background jobs. Meshes are drawn with the root shader variant until they're compiled."
+        );
+
         MeshDrawPacket::MeshDrawPacket(
             ModelLod& modelLod,
             size_t modelLodMeshIndex,
@@ -47,7 +55,7 @@ namespace AZ
             }
         }
 
-        Data::Instance<Material> MeshDrawPacket::GetMaterial()
+        Data::Instance<Material> MeshDrawPacket::GetMaterial() const
         {
             return m_material;
         }
@@ -111,10 +119,12 @@ namespace AZ
             //      - MeshDrawPacket::Update() is called. But since the GetCurrentChangeId() hasn't changed since last time, DoUpdate() is not called.
             //      - The mesh continues rendering with only the "foo" change applied, indefinitely.
 
-            if (forceUpdate || (!m_material->NeedsCompile() && m_materialChangeId != m_material->GetCurrentChangeId()))
+            // Material changes that only touch SRG data are picked up by the SRG compile, only shader collection changes need a rebuild.
+            // Draw packets that fell back to the root shader variant are rebuilt until the pipeline states of the final variants are compiled.
+            if (forceUpdate || m_hasPendingPipelineStates || (!m_material->NeedsCompile() && m_materialChangeId != m_material->GetShaderCollectionChangeId()))
             {
                 DoUpdate(parentScene);
-                m_materialChangeId = m_material->GetCurrentChangeId();
+                m_materialChangeId = m_material->GetShaderCollectionChangeId();
                 return true;
             }
 
@@ -151,6 +161,7 @@ namespace AZ
             AZStd::fixed_vector<ModelLod::StreamBufferViewList, RHI::DrawPacketBuilder::DrawItemCountMax> streamBufferViewsPerShader;
 
             m_perDrawSrgs.clear();
+            m_hasPendingPipelineStates = false;
 
             auto appendShader = [&](const ShaderCollection::Item& shaderItem)
             {
@@ -226,33 +237,75 @@ namespace AZ
                 }
 
                 const ShaderVariantId finalVariantId = shaderOptions.GetShaderVariantId();
-                const ShaderVariant& variant = r_forceRootShaderVariantUsage ? shader->GetRootVariant() : shader->GetVariant(finalVariantId);
-
-                RHI::PipelineStateDescriptorForDraw pipelineStateDescriptor;
-                variant.ConfigurePipelineState(pipelineStateDescriptor);
-
-                // Render states need to merge the runtime variation.
-                // This allows materials to customize the render states that the shader uses.
-                const RHI::RenderStates& renderStatesOverlay = *shaderItem.GetRenderStatesOverlay();
-                RHI::MergeStateInto(renderStatesOverlay, pipelineStateDescriptor.m_renderStates);
+                const ShaderVariant* variant = r_forceRootShaderVariantUsage ? &shader->GetRootVariant() : &shader->GetVariant(finalVariantId);
 
                 streamBufferViewsPerShader.push_back();
                 auto& streamBufferViews = streamBufferViewsPerShader.back();
 
+                RHI::PipelineStateDescriptorForDraw pipelineStateDescriptor;
                 UvStreamTangentBitmask uvStreamTangentBitmask;
 
-                if (!m_modelLod->GetStreamsForMesh(
-                    pipelineStateDescriptor.m_inputStreamLayout,
-                    streamBufferViews,
-                    &uvStreamTangentBitmask,
-                    variant.GetInputContract(),
-                    m_modelLodMeshIndex,
-                    m_materialModelUvMap,
-                    m_material->GetAsset()->GetMaterialTypeAsset()->GetUvNameMap()))
+                auto configurePipelineState = [&](const ShaderVariant& shaderVariant)
+                {
+                    pipelineStateDescriptor = RHI::PipelineStateDescriptorForDraw();
+                    shaderVariant.ConfigurePipelineState(pipelineStateDescriptor);
+
+                    // Render states need to merge the runtime variation.
+                    // This allows materials to customize the render states that the shader uses.
+                    const RHI::RenderStates& renderStatesOverlay = *shaderItem.GetRenderStatesOverlay();
+                    RHI::MergeStateInto(renderStatesOverlay, pipelineStateDescriptor.m_renderStates);
+
+                    streamBufferViews.clear();
+                    uvStreamTangentBitmask.Reset();
+
+                    if (!m_modelLod->GetStreamsForMesh(
+                        pipelineStateDescriptor.m_inputStreamLayout,
+                        streamBufferViews,
+                        &uvStreamTangentBitmask,
+                        shaderVariant.GetInputContract(),
+                        m_modelLodMeshIndex,
+                        m_materialModelUvMap,
+                        m_material->GetAsset()->GetMaterialTypeAsset()->GetUvNameMap()))
+                    {
+                        return false;
+                    }
+
+                    parentScene.ConfigurePipelineState(drawListTag, pipelineStateDescriptor);
+                    return true;
+                };
+
+                if (!configurePipelineState(*variant))
                 {
                     return false;
                 }
 
+                const RHI::PipelineState* pipelineState = nullptr;
+                if (r_asyncPipelineStateCompile && !variant->IsRootVariant())
+                {
+                    pipelineState = shader->AcquirePipelineStateAsync(pipelineStateDescriptor);
+                    if (!pipelineState)
+                    {
+                        // The pipeline state is compiled in the background, so draw with the root variant meanwhile.
+                        m_hasPendingPipelineStates = true;
+                        variant = &shader->GetRootVariant();
+                        if (!configurePipelineState(*variant))
+                        {
+                            return false;
+                        }
+                    }
+                }
+
+                if (!pipelineState)
+                {
+                    pipelineState = shader->AcquirePipelineState(pipelineStateDescriptor);
+                }
+
+                if (!pipelineState)
+                {
+                    AZ_Error("MeshDrawPacket", false, "Shader '%s'. Failed to acquire default pipeline state", shaderItem.GetShaderAsset()->GetName().GetCStr());
+                    return false;
+                }
+
                 Data::Instance<ShaderResourceGroup> drawSrg;
                 if (drawSrgAsset)
                 {
@@ -260,7 +313,7 @@ namespace AZ
                     // If the DrawSrg exists we must create and bind it, otherwise the CommandList will fail validation for SRG being null
                     drawSrg = RPI::ShaderResourceGroup::Create(drawSrgAsset);
 
-                    if (!variant.IsFullyBaked() && drawSrgAsset->GetLayout()->HasShaderVariantKeyFallbackEntry())
+                    if (!variant->IsFullyBaked() && drawSrgAsset->GetLayout()->HasShaderVariantKeyFallbackEntry())
                     {
                         drawSrg->SetShaderVariantKeyFallbackValue(shaderOptions.GetShaderVariantKeyFallbackValue());
                     }
@@ -279,15 +332,6 @@ namespace AZ
                     drawSrg->Compile();
                 }
 
-                parentScene.ConfigurePipelineState(drawListTag, pipelineStateDescriptor);
-
-                const RHI::PipelineState* pipelineState = shader->AcquirePipelineState(pipelineStateDescriptor);
-                if (!pipelineState)
-                {
-                    AZ_Error("MeshDrawPacket", false, "Shader '%s'. Failed to acquire default pipeline state", shaderItem.GetShaderAsset()->GetName().GetCStr());
-                    return false;
-                }
-
                 RHI::DrawPacketBuilder::DrawRequest drawRequest;
                 drawRequest.m_listTag = drawListTag;
                 drawRequest.m_pipelineState = pipelineState;
@@ -6,9 +6,11 @@
  */
 
 #include <Atom/RPI.Public/Model/Model.h>
+#include <Atom/RPI.Public/Model/ModelSystem.h>
 
 #include <Atom/RHI/Factory.h>
 
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Debug/EventTrace.h>
 #include <AtomCore/Instance/InstanceDatabase.h>
 #include <AzCore/Debug/Timer.h>
@@ -22,6 +24,9 @@ namespace AZ
 {
     namespace RPI
     {
+        AZ_CVAR(bool, r_meshLodStreaming, true, nullptr, ConsoleFunctorFlags::Null,
+            "Only keeps the least detailed lod of models resident and streams the other lods in when culling selects them. Applies to models created afterwards.");
+
         Data::Instance<Model> Model::FindOrCreate(const Data::Asset<ModelAsset>& modelAsset)
         {
             return Data::InstanceDatabase<Model>::Instance().FindOrCreate(
@@ -29,6 +34,14 @@ namespace AZ
                 modelAsset);
         }
 
+        Model::~Model()
+        {
+            if (m_isStreamingLods)
+            {
+                ModelSystem::UnregisterStreamingModel(this);
+            }
+        }
+
         size_t Model::GetLodCount() const
         {
             return m_lods.size();
@@ -39,6 +52,77 @@ namespace AZ
             return m_lods;
         }
 
+        bool Model::IsLodResident(size_t lodIndex) const
+        {
+            return lodIndex < m_lods.size() && m_lods[lodIndex];
+        }
+
+        void Model::RequestLod(size_t lodIndex)
+        {
+            if (m_isStreamingLods)
+            {
+                m_requestedLodsMask.fetch_or(1u << lodIndex, AZStd::memory_order_relaxed);
+            }
+        }
+
+        uint32_t Model::GetLodResidencyChangeId() const
+        {
+            return m_lodResidencyChangeId;
+        }
+
+        void Model::DisableLodStreaming()
+        {
+            if (!m_isStreamingLods)
+            {
+                return;
+            }
+
+            ModelSystem::UnregisterStreamingModel(this);
+            m_isStreamingLods = false;
+            for (size_t lodIndex = 0; lodIndex + 1 < m_lods.size(); ++lodIndex)
+            {
+                if (!m_lods[lodIndex])
+                {
+                    StreamInLod(lodIndex);
+                }
+            }
+        }
+
+        uint32_t Model::ConsumeRequestedLods()
+        {
+            return m_requestedLodsMask.exchange(0, AZStd::memory_order_relaxed);
+        }
+
+        size_t Model::GetLodMemorySize(size_t lodIndex) const
+        {
+            return m_lodMemorySizes[lodIndex];
+        }
+
+        bool Model::StreamInLod(size_t lodIndex)
+        {
+            AZ_PROFILE_FUNCTION(Debug::ProfileCategory::AzRender);
+
+            // The buffers are created right away and their data is uploaded by the asynchronous streaming upload of the buffer pool
+            Data::Instance<ModelLod> lodInstance = ModelLod::FindOrCreate(m_modelAsset->GetLodAssets()[lodIndex]);
+            if (!lodInstance)
+            {
+                return false;
+            }
+
+            m_lods[lodIndex] = AZStd::move(lodInstance);
+            ++m_lodResidencyChangeId;
+            return true;
+        }
+
+        void Model::StreamOutLod(size_t lodIndex)
+        {
+            AZ_Assert(lodIndex + 1 < m_lods.size(), "The last lod of a model is always resident");
+
+            // Meshes keep using the lod until they rebuild their draw packets for the new residency
+            m_lods[lodIndex] = nullptr;
+            ++m_lodResidencyChangeId;
+        }
+
         Data::Instance<Model> Model::CreateInternal(ModelAsset& modelAsset)
         {
             AZ_PROFILE_FUNCTION(Debug::ProfileCategory::AzRender);
@@ -60,6 +144,9 @@ namespace AZ
             m_aabb = modelAsset.GetAabb();
 
             m_lods.resize(modelAsset.GetLodAssets().size());
+            m_lodMemorySizes.resize(m_lods.size());
+
+            m_isStreamingLods = r_meshLodStreaming && m_lods.size() > 1;
 
             for (size_t lodIndex = 0; lodIndex < m_lods.size(); ++lodIndex)
             {
@@ -71,16 +158,24 @@ namespace AZ
                     return RHI::ResultCode::Fail;
                 }
 
-                Data::Instance<ModelLod> lodInstance = ModelLod::FindOrCreate(lodAsset);
-                if (lodInstance == nullptr)
+                // The uv names and the memory size come from the lod asset, so they are known before the lod is streamed in
+                AZStd::unordered_set<Data::AssetId> lodBufferAssetIds;
+                auto addBufferMemorySize = [this, lodIndex, &lodBufferAssetIds](const BufferAssetView& bufferAssetView)
                 {
-                    return RHI::ResultCode::Fail;
-                }
+                    const Data::Asset<BufferAsset>& bufferAsset = bufferAssetView.GetBufferAsset();
+                    if (bufferAsset && lodBufferAssetIds.insert(bufferAsset.GetId()).second)
+                    {
+                        m_lodMemorySizes[lodIndex] += bufferAsset->GetBufferDescriptor().m_byteCount;
+                    }
+                };
 
-                for (const AZ::RPI::ModelLod::Mesh& mesh : lodInstance->GetMeshes())
+                for (const ModelLodAsset::Mesh& mesh : lodAsset->GetMeshes())
                 {
-                    for (const AZ::RPI::ModelLod::StreamBufferInfo& stream : mesh.m_streamInfo)
+                    addBufferMemorySize(mesh.GetIndexBufferAssetView());
+                    for (const ModelLodAsset::Mesh::StreamBufferInfo& stream : mesh.GetStreamBufferInfoList())
                     {
+                        addBufferMemorySize(stream.m_bufferAssetView);
+
                         if (stream.m_semantic.m_name.GetStringView().starts_with(RHI::ShaderSemantic::UvStreamSemantic))
                         {
                             // For unnamed UVs, use the semantic instead.
@@ -96,11 +191,39 @@ namespace AZ
                     }
                 }
 
+                // Only the last lod is created up front when the other ones are streamed
+                if (m_isStreamingLods && lodIndex + 1 < m_lods.size())
+                {
+                    continue;
+                }
+
+                Data::Instance<ModelLod> lodInstance = ModelLod::FindOrCreate(lodAsset);
+                if (lodInstance == nullptr)
+                {
+                    return RHI::ResultCode::Fail;
+                }
+
                 m_lods[lodIndex] = AZStd::move(lodInstance);
             }
 
             m_modelAsset = { &modelAsset, AZ::Data::AssetLoadBehavior::PreLoad };
             m_isUploadPending = true;
+
+            if (m_isStreamingLods)
+            {
+                m_isStreamingLods = ModelSystem::RegisterStreamingModel(this);
+                if (!m_isStreamingLods)
+                {
+                    // Without a model system to stream them, all the lods are resident
+                    for (size_t lodIndex = 0; lodIndex + 1 < m_lods.size(); ++lodIndex)
+                    {
+                        if (!StreamInLod(lodIndex))
+                        {
+                            return RHI::ResultCode::Fail;
+                        }
+                    }
+                }
+            }
             return RHI::ResultCode::Success;
         }
 
@@ -111,7 +234,10 @@ namespace AZ
                 AZ_PROFILE_SCOPE_STALL_DYNAMIC(Debug::ProfileCategory::AzRender, "Model::WaitForUpload - %s", GetDatabaseName());
                 for (const Data::Instance<ModelLod>& lod : m_lods)
                 {
-                    lod->WaitForUpload();
+                    if (lod)
+                    {
+                        lod->WaitForUpload();
+                    }
                 }
                 m_isUploadPending = false;
             }
@@ -15,10 +15,22 @@
 
 #include <AtomCore/Instance/InstanceDatabase.h>
 
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Debug/EventTrace.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/sort.h>
+
 namespace AZ
 {
     namespace RPI
     {
+        AZ_CVAR(uint32_t, r_meshLodMemoryBudgetMB, 0, nullptr, ConsoleFunctorFlags::Null,
+            "Budget for the streamed lods of models in megabytes, lods past it aren't streamed in and the least needed ones are streamed out. 0 disables the budget.");
+        AZ_CVAR(uint32_t, r_meshLodEvictFrames, 60, nullptr, ConsoleFunctorFlags::Null,
+            "Number of updates a streamed lod of a model has to go without being requested by a view before it is streamed out.");
+
+        ModelSystem* ModelSystem::s_modelSystem = nullptr;
+
         void ModelSystem::Reflect(AZ::ReflectContext* context)
         {
             ModelLodAsset::Reflect(context);
@@ -52,12 +64,163 @@ namespace AZ
                 return Model::CreateInternal(*(azrtti_cast<ModelAsset*>(modelAsset)));
             };
             Data::InstanceDatabase<Model>::Create(azrtti_typeid<ModelAsset>(), modelInstanceHandler);
+
+            s_modelSystem = this;
         }
 
         void ModelSystem::Shutdown()
         {
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_streamingModelsMutex);
+                m_streamingModels.clear();
+                s_modelSystem = nullptr;
+            }
+
             Data::InstanceDatabase<Model>::Destroy();
             Data::InstanceDatabase<ModelLod>::Destroy();
         }
+
+        void ModelSystem::Update()
+        {
+            AZ_PROFILE_FUNCTION(Debug::ProfileCategory::AzRender);
+
+            AZStd::lock_guard<AZStd::mutex> lock(m_streamingModelsMutex);
+            ++m_updateIndex;
+
+            const uint64_t memoryBudget = static_cast<uint64_t>(r_meshLodMemoryBudgetMB) * 1024 * 1024;
+            const uint64_t evictUpdates = r_meshLodEvictFrames;
+
+            struct LodReference
+            {
+                StreamingModel* m_streamingModel = nullptr;
+                size_t m_lodIndex = 0;
+
+                uint64_t GetRequestedUpdate() const
+                {
+                    return m_streamingModel->m_lodRequestedUpdates[m_lodIndex];
+                }
+            };
+
+            AZStd::vector<LodReference> residentLods;
+            AZStd::vector<LodReference> requestedLods;
+            uint64_t residentMemorySize = 0;
+
+            for (StreamingModel& streamingModel : m_streamingModels)
+            {
+                Model* model = streamingModel.m_model;
+                const uint32_t requestedLodsMask = model->ConsumeRequestedLods();
+
+                // The last lod is always resident
+                const size_t streamedLodCount = model->GetLodCount() - 1;
+                for (size_t lodIndex = 0; lodIndex < streamedLodCount; ++lodIndex)
+                {
+                    uint64_t& requestedUpdate = streamingModel.m_lodRequestedUpdates[lodIndex];
+                    if (requestedLodsMask & (1u << lodIndex))
+                    {
+                        requestedUpdate = m_updateIndex;
+                    }
+
+                    if (model->IsLodResident(lodIndex))
+                    {
+                        if (m_updateIndex - requestedUpdate > evictUpdates)
+                        {
+                            model->StreamOutLod(lodIndex);
+                        }
+                        else
+                        {
+                            residentMemorySize += model->GetLodMemorySize(lodIndex);
+                            residentLods.push_back({ &streamingModel, lodIndex });
+                        }
+                    }
+                    else if (requestedUpdate == m_updateIndex)
+                    {
+                        requestedLods.push_back({ &streamingModel, lodIndex });
+                    }
+                }
+            }
+
+            // Over budget, stream out the lods that went the longest without being requested
+            if (memoryBudget > 0 && residentMemorySize > memoryBudget)
+            {
+                AZStd::sort(residentLods.begin(), residentLods.end(), [](const LodReference& lhs, const LodReference& rhs)
+                {
+                    return lhs.GetRequestedUpdate() < rhs.GetRequestedUpdate();
+                });
+
+                for (const LodReference& lod : residentLods)
+                {
+                    // Lods still requested by a view are kept, the budget only stops new ones from streaming in
+                    if (residentMemorySize <= memoryBudget || lod.GetRequestedUpdate() == m_updateIndex)
+                    {
+                        break;
+                    }
+                    residentMemorySize -= lod.m_streamingModel->m_model->GetLodMemorySize(lod.m_lodIndex);
+                    lod.m_streamingModel->m_model->StreamOutLod(lod.m_lodIndex);
+                }
+            }
+
+            // The most detailed lods are requested by the objects covering the most of the screen, so they are streamed in first
+            AZStd::sort(requestedLods.begin(), requestedLods.end(), [](const LodReference& lhs, const LodReference& rhs)
+            {
+                return lhs.m_lodIndex < rhs.m_lodIndex;
+            });
+
+            const uint32_t maxStreamInCount = 20;
+            uint32_t streamInCount = 0;
+            for (const LodReference& lod : requestedLods)
+            {
+                if (streamInCount == maxStreamInCount)
+                {
+                    break;
+                }
+
+                Model* model = lod.m_streamingModel->m_model;
+                const size_t lodMemorySize = model->GetLodMemorySize(lod.m_lodIndex);
+                if (memoryBudget > 0 && residentMemorySize + lodMemorySize > memoryBudget)
+                {
+                    continue;
+                }
+
+                if (model->StreamInLod(lod.m_lodIndex))
+                {
+                    residentMemorySize += lodMemorySize;
+                    ++streamInCount;
+                }
+            }
+        }
+
+        bool ModelSystem::RegisterStreamingModel(Model* model)
+        {
+            if (!s_modelSystem)
+            {
+                return false;
+            }
+
+            AZStd::lock_guard<AZStd::mutex> lock(s_modelSystem->m_streamingModelsMutex);
+            StreamingModel streamingModel;
+            streamingModel.m_model = model;
+            s_modelSystem->m_streamingModels.push_back(streamingModel);
+            return true;
+        }
+
+        void ModelSystem::UnregisterStreamingModel(Model* model)
+        {
+            if (!s_modelSystem)
+            {
+                return;
+            }
+
+            AZStd::lock_guard<AZStd::mutex> lock(s_modelSystem->m_streamingModelsMutex);
+            auto& streamingModels = s_modelSystem->m_streamingModels;
+            auto it = AZStd::find_if(streamingModels.begin(), streamingModels.end(), [model](const StreamingModel& streamingModel)
+            {
+                return streamingModel.m_model == model;
+            });
+            if (it != streamingModels.end())
+            {
+                *it = streamingModels.back();
+                streamingModels.pop_back();
+            }
+        }
     } // namespace RPI
 } // namespace AZ
@@ -133,6 +133,7 @@ namespace AZ
             m_dispatchItem.m_arguments = dispatchArgs;
 
             m_isFullscreenPass = passData->m_makeFullscreenPass;
+            m_hardwareQueueClass = passData->m_useAsyncCompute ? RHI::HardwareQueueClass::Compute : RHI::HardwareQueueClass::Graphics;
 
             // Setup pipeline state...
             RHI::PipelineStateDescriptorForDispatch pipelineStateDescriptor;
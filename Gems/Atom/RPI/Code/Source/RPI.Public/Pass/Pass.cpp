@@ -101,6 +101,11 @@ namespace AZ
             return m_flags.m_enabled;
         }
 
+        bool Pass::IsPruned() const
+        {
+            return m_flags.m_pruned;
+        }
+
         // --- Error Logging ---
 
         void Pass::LogError(AZStd::string&& message)
@@ -670,6 +675,11 @@ namespace AZ
             {
                 attachment->m_sizeSource = source;
                 attachment->m_sizeMultipliers = desc.m_sizeSource.m_multipliers;
+                attachment->m_renderScale = desc.m_sizeSource.m_renderScale;
+                if (attachment->m_renderScale == PassAttachmentRenderScale::Apply)
+                {
+                    attachment->m_renderPipelineSource = m_pipeline;
+                }
             }
 
             if (desc.m_formatSource.m_pass == PipelineKeyword)                // if source is pipeline
@@ -1270,7 +1280,7 @@ namespace AZ
         {
             AZ_RPI_BREAK_ON_TARGET_PASS;
 
-            if (!IsEnabled())
+            if (!IsEnabled() || m_flags.m_pruned)
             {
                 UpdateConnectedBindings();
                 return;
@@ -1514,6 +1524,10 @@ namespace AZ
 
                 stringOutput += "- ";
                 stringOutput += m_name.GetStringView();
+                if (m_flags.m_pruned)
+                {
+                    stringOutput += " (pruned)";
+                }
                 stringOutput += "\n";
             }
         }
@@ -50,6 +50,7 @@ namespace AZ
             clone->m_multisampleSource = this->m_multisampleSource;
             clone->m_sizeSource = this->m_sizeSource;
             clone->m_sizeMultipliers = this->m_sizeMultipliers;
+            clone->m_renderScale = this->m_renderScale;
             clone->m_arraySizeSource = this->m_arraySizeSource;
             clone->m_generateFullMipChain = this->m_generateFullMipChain;
 
@@ -135,11 +136,34 @@ namespace AZ
                 {
                     RHI::Size sourceSize = m_renderPipelineSource->GetRenderSettings().m_size;
                     m_descriptor.m_image.m_size = m_sizeMultipliers.ApplyModifiers(sourceSize);
+                    m_isRenderScaled = false;
                 }
                 else if(m_sizeSource && m_sizeSource->m_attachment)
                 {
-                    RHI::Size sourceSize = m_sizeSource->m_attachment->m_descriptor.m_image.m_size;
+                    const PassAttachment* sourceAttachment = m_sizeSource->m_attachment.get();
+                    RHI::Size sourceSize = sourceAttachment->m_descriptor.m_image.m_size;
                     m_descriptor.m_image.m_size = m_sizeMultipliers.ApplyModifiers(sourceSize);
+
+                    // Attachments sized from a render scaled source are render scaled too, unless they remove the scale
+                    m_isRenderScaled = sourceAttachment->m_isRenderScaled && m_renderScale != PassAttachmentRenderScale::Remove;
+                    if (m_isRenderScaled || m_renderScale != PassAttachmentRenderScale::Inherit)
+                    {
+                        m_unscaledImageSize = m_sizeMultipliers.ApplyModifiers(sourceAttachment->GetUnscaledImageSize());
+                    }
+
+                    if (m_renderScale == PassAttachmentRenderScale::Apply && m_renderPipelineSource)
+                    {
+                        const float renderScale = m_renderPipelineSource->GetRenderSettings().m_renderScale;
+                        PassAttachmentSizeMultipliers renderScaleMultipliers;
+                        renderScaleMultipliers.m_widthMultiplier = renderScale;
+                        renderScaleMultipliers.m_heightMultiplier = renderScale;
+                        m_descriptor.m_image.m_size = renderScaleMultipliers.ApplyModifiers(m_unscaledImageSize);
+                        m_isRenderScaled = true;
+                    }
+                    else if (m_renderScale == PassAttachmentRenderScale::Remove)
+                    {
+                        m_descriptor.m_image.m_size = m_unscaledImageSize;
+                    }
                 }
 
                 if (m_arraySizeSource && m_arraySizeSource->m_attachment)
@@ -160,6 +184,11 @@ namespace AZ
             }
         }
 
+        RHI::Size PassAttachment::GetUnscaledImageSize() const
+        {
+            return m_isRenderScaled ? m_unscaledImageSize : m_descriptor.m_image.m_size;
+        }
+
         void PassAttachment::OnAttached(const PassAttachmentBinding& binding)
         {
             // Auto-infer image and buffer bind flags...
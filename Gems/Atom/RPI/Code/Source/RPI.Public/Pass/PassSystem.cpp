@@ -8,12 +8,14 @@
 #include <AzCore/Asset/AssetManager.h>
 #include <AzCore/Asset/AssetManagerBus.h>
 #include <AzCore/Component/Entity.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Debug/EventTrace.h>
 #include <AzCore/IO/FileIO.h>
 #include <AzCore/IO/SystemFile.h>
 #include <AzCore/Serialization/Utils.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/std/sort.h>
+#include <AzCore/std/containers/unordered_set.h>
 #include <AzCore/Interface/Interface.h>
 
 #include <AtomCore/Serialization/Json/JsonUtils.h>
@@ -45,6 +47,8 @@ namespace AZ
 {
     namespace RPI
     {
+        AZ_CVAR(bool, r_passPruning, true, nullptr, ConsoleFunctorFlags::Null,
+            "Skip the passes whose outputs are never consumed by another pass. Disable to inspect the outputs of those passes.");
 
         PassSystemInterface* PassSystemInterface::Get()
         {
@@ -273,6 +277,117 @@ namespace AZ
             m_state = PassSystemState::Idle;
         }
 
+        namespace
+        {
+            void CollectLeafPasses(Pass* pass, AZStd::vector<Pass*>& leafPasses)
+            {
+                if (ParentPass* parent = pass->AsParent())
+                {
+                    for (const Ptr<Pass>& child : parent->GetChildren())
+                    {
+                        CollectLeafPasses(child.get(), leafPasses);
+                    }
+                }
+                else
+                {
+                    leafPasses.push_back(pass);
+                }
+            }
+
+            bool IsOutputSlot(PassSlotType slotType)
+            {
+                return slotType == PassSlotType::Output || slotType == PassSlotType::InputOutput;
+            }
+        }
+
+        void PassSystem::PrunePasses()
+        {
+            const bool pruningEnabled = r_passPruning;
+            if (!m_passHierarchyChanged && pruningEnabled == m_passPruningEnabled)
+            {
+                return;
+            }
+            m_passPruningEnabled = pruningEnabled;
+
+            AZ_ATOM_PROFILE_FUNCTION("RPI", "PassSystem: PrunePasses");
+
+            AZStd::vector<Pass*> leafPasses;
+            CollectLeafPasses(m_rootPass.get(), leafPasses);
+
+            // Bindings and attachments read by a pass that isn't pruned. Consumers are found through both, so outputs
+            // forwarded through parent slots or written into an attachment owned by another pass are accounted for.
+            AZStd::unordered_set<const PassAttachmentBinding*> consumedBindings;
+            AZStd::unordered_set<const PassAttachment*> consumedAttachments;
+            auto markConsumed = [&](const PassAttachmentBinding& binding)
+            {
+                if (binding.m_attachment)
+                {
+                    consumedAttachments.insert(binding.m_attachment.get());
+                }
+                // Follow the connections up to the binding producing the attachment, including the fallbacks used when disabled
+                AZStd::vector<const PassAttachmentBinding*> pendingBindings = { &binding };
+                while (!pendingBindings.empty())
+                {
+                    const PassAttachmentBinding* pendingBinding = pendingBindings.back();
+                    pendingBindings.pop_back();
+                    if (pendingBinding && consumedBindings.insert(pendingBinding).second)
+                    {
+                        pendingBindings.push_back(pendingBinding->m_connectedBinding);
+                        pendingBindings.push_back(pendingBinding->m_fallbackBinding);
+                    }
+                }
+            };
+
+            // The outputs of the pipelines are consumed outside of the pass hierarchy
+            for (const Ptr<Pass>& pipelinePass : m_rootPass->GetChildren())
+            {
+                for (const PassAttachmentBinding& binding : pipelinePass->m_attachmentBindings)
+                {
+                    if (IsOutputSlot(binding.m_slotType))
+                    {
+                        markConsumed(binding);
+                    }
+                }
+            }
+
+            // Passes are visited in reverse execution order so consumers are resolved before the passes producing their inputs.
+            // The enabled state is ignored so passes can be enabled and disabled without pruning them again.
+            for (auto passIt = leafPasses.rbegin(); passIt != leafPasses.rend(); ++passIt)
+            {
+                Pass* pass = *passIt;
+
+                bool hasOutput = false;
+                bool consumed = !pruningEnabled || pass->m_attachmentReadback != nullptr;
+                for (const PassAttachmentBinding& binding : pass->m_attachmentBindings)
+                {
+                    if (!IsOutputSlot(binding.m_slotType))
+                    {
+                        continue;
+                    }
+
+                    hasOutput = true;
+                    // Outputs without an attachment yet or writing to an imported attachment are kept
+                    consumed = consumed ||
+                        !binding.m_attachment ||
+                        binding.m_attachment->m_lifetime == RHI::AttachmentLifetimeType::Imported ||
+                        consumedBindings.count(&binding) > 0 ||
+                        consumedAttachments.count(binding.m_attachment.get()) > 0;
+                }
+
+                // Passes without outputs only have side effects the pass system doesn't know about
+                consumed = consumed || !hasOutput;
+
+                pass->m_flags.m_pruned = !consumed;
+                if (consumed)
+                {
+                    for (const PassAttachmentBinding& binding : pass->m_attachmentBindings)
+                    {
+                        markConsumed(binding);
+                    }
+                }
+            }
+        }
+
         void PassSystem::Validate()
         {
             m_state = PassSystemState::ValidatingPasses;
@@ -300,6 +415,7 @@ namespace AZ
             RemovePasses();
             BuildPasses();
             InitializePasses();
+            PrunePasses();
             Validate();
         }
 
@@ -309,6 +425,7 @@ namespace AZ
             AZ_ATOM_PROFILE_FUNCTION("RPI", "PassSystem: FrameUpdate");
 
             ProcessQueuedChanges();
+            m_gpuPassTiming.UpdateQueries(*m_rootPass, m_passHierarchyChanged);
 
             m_state = PassSystemState::Rendering;
             Pass::FramePrepareParams params{ &frameGraphBuilder };
@@ -323,6 +440,8 @@ namespace AZ
 
             m_rootPass->FrameEnd();
 
+            m_gpuPassTiming.CollectResults(*m_rootPass);
+
             // remove any pipelines that are marked as ExecuteOnce
             // the immediate children of m_rootPass are the top-level nodes of each pipeline
             for (const Ptr<Pass>& pass : m_rootPass->GetChildren())
@@ -387,6 +506,26 @@ namespace AZ
             return m_targetedPassDebugName;
         }
 
+        void PassSystem::SetGpuPassTimingEnabled(bool enable)
+        {
+            m_gpuPassTiming.SetEnabled(enable);
+        }
+
+        bool PassSystem::IsGpuPassTimingEnabled() const
+        {
+            return m_gpuPassTiming.IsEnabled();
+        }
+
+        AZStd::vector<GpuPassTiming> PassSystem::GetGpuPassTimings() const
+        {
+            return m_gpuPassTiming.GetPassTimings();
+        }
+
+        AZStd::vector<GpuFrameTimestamps> PassSystem::GetGpuFrameTimestamps(AZStd::sys_time_t startTick) const
+        {
+            return m_gpuPassTiming.GetFrameTimestamps(startTick);
+        }
+
         void PassSystem::ConnectEvent(OnReadyLoadTemplatesEvent::Handler& handler)
         {
             handler.Connect(m_loadTemplatesEvent);
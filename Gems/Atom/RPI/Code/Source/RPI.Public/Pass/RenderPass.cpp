@@ -209,6 +209,7 @@ namespace AZ
 
         void RenderPass::SetupFrameGraphDependencies(RHI::FrameGraphInterface frameGraph)
         {
+            frameGraph.SetHardwareQueueClass(m_hardwareQueueClass);
             DeclareAttachmentsToFrameGraph(frameGraph);
             DeclarePassDependenciesToFrameGraph(frameGraph);
             AddScopeQueryToFrameGraph(frameGraph);
@@ -535,7 +536,7 @@ namespace AZ
                 const uint32_t TimestampResultQueryCount = 2u;
                 uint64_t timestampResult[TimestampResultQueryCount] = {0};
                 query->GetLatestResult(&timestampResult, sizeof(uint64_t) * TimestampResultQueryCount);
-                m_timestampResult = TimestampResult(timestampResult[0], timestampResult[1], RHI::HardwareQueueClass::Graphics);
+                m_timestampResult = TimestampResult(timestampResult[0], timestampResult[1], m_hardwareQueueClass);
             });
 
             ExecuteOnPipelineStatisticsQuery([this](RHI::Ptr<Query> query)
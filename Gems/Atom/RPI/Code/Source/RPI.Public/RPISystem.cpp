@@ -268,6 +268,9 @@ namespace AZ
             // Query system update is to increment the frame count
             m_querySystem.Update();
 
+            // Stream model lods in and out from the lods culling requested last frame
+            m_modelSystem.Update();
+
             // Collect draw packets for each scene and prepare RPI system SRGs
             // [GFX TODO] We may parallel scenes' prepare render.
             for (auto& scenePtr : m_scenes)
@@ -7,8 +7,10 @@
 
 #include <Atom/RPI.Public/Shader/Metrics/ShaderMetricsSystem.h>
 #include <Atom/RPI.Public/Shader/Metrics/ShaderMetrics.h>
+#include <Atom/RPI.Reflect/Shader/IShaderVariantFinder.h>
 #include <Atom/RPI.Reflect/Shader/ShaderAsset.h>
 
+#include <AzCore/Console/IConsole.h>
 
 #include <AzCore/Interface/Interface.h>
 #include <AzCore/IO/SystemFile.h>
@@ -29,6 +31,17 @@ namespace AZ
             return AZStd::string(shaderMetricPath) + AZ_CORRECT_FILESYSTEM_SEPARATOR_STRING + "ShaderMetrics.json";
         }
 
+        static void r_prefetchShaderVariants([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
+        {
+            if (ShaderMetricsSystemInterface* shaderMetrics = ShaderMetricsSystemInterface::Get())
+            {
+                shaderMetrics->PrefetchShaderVariants();
+            }
+        }
+
+        AZ_CONSOLEFREEFUNC(r_prefetchShaderVariants, ConsoleFunctorFlags::Null,
+            "Queues the loading of all shader variants recorded in the shader metrics.");
+
         ShaderMetricsSystemInterface* ShaderMetricsSystemInterface::Get()
         {
             return Interface<ShaderMetricsSystemInterface>::Get();
@@ -105,6 +118,25 @@ namespace AZ
             return m_metrics;
         }
 
+        void ShaderMetricsSystem::PrefetchShaderVariants() const
+        {
+            IShaderVariantFinder* shaderVariantFinder = AZ::Interface<IShaderVariantFinder>::Get();
+            if (!shaderVariantFinder)
+            {
+                return;
+            }
+
+            AZStd::lock_guard<AZStd::mutex> lock(m_metricsMutex);
+            for (const ShaderVariantRequest& request : m_metrics.m_requests)
+            {
+                // Requests that resolved to the root variant don't have their own asset.
+                if (request.m_shaderVariantStableId != RootShaderVariantStableId)
+                {
+                    shaderVariantFinder->QueueLoadShaderVariantAssetByStableId(request.m_shaderId, request.m_shaderVariantStableId);
+                }
+            }
+        }
+
         void ShaderMetricsSystem::RequestShaderVariant(const ShaderAsset* shader, const ShaderVariantId& shaderVariantId, const ShaderVariantSearchResult& result)
         {
             if (!m_isEnabled)
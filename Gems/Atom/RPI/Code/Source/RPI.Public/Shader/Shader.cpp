@@ -366,6 +366,11 @@ namespace AZ
             return m_pipelineStateCache->AcquirePipelineState(m_pipelineLibraryHandle, descriptor);
         }
 
+        const RHI::PipelineState* Shader::AcquirePipelineStateAsync(const RHI::PipelineStateDescriptor& descriptor) const
+        {
+            return m_pipelineStateCache->AcquirePipelineStateAsync(m_pipelineLibraryHandle, descriptor);
+        }
+
         const Data::Asset<ShaderResourceGroupAsset>& Shader::FindShaderResourceGroupAsset(const Name& shaderResourceGroupName) const
         {
             return m_asset->FindShaderResourceGroupAsset(shaderResourceGroupName);
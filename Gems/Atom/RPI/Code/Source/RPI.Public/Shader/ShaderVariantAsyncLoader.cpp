@@ -34,6 +34,7 @@ namespace AZ
         void ShaderVariantAsyncLoader::ThreadServiceLoop()
         {
             AZStd::unordered_set<ShaderVariantAsyncLoader::PairOfShaderAssetAndShaderVariantId> newShaderVariantPendingRequests;
+            AZStd::unordered_set<ShaderVariantAsyncLoader::PairOfShaderAssetIdAndShaderVariantStableId> prefetchShaderVariantPendingRequests;
             AZStd::unordered_set<Data::AssetId> shaderVariantTreePendingRequests;
             AZStd::unordered_set<Data::AssetId> shaderVariantPendingRequests;
             while (true)
@@ -45,9 +46,11 @@ namespace AZ
                         {
                             return m_isServiceShutdown.load() ||
                                 !m_newShaderVariantPendingRequests.empty() ||
+                                !m_prefetchShaderVariantPendingRequests.empty() ||
                                 !m_shaderVariantTreePendingRequests.empty() ||
                                 !m_shaderVariantPendingRequests.empty() ||
                                 !newShaderVariantPendingRequests.empty() ||
+                                !prefetchShaderVariantPendingRequests.empty() ||
                                 !shaderVariantTreePendingRequests.empty() ||
                                 !shaderVariantPendingRequests.empty();
                         }
@@ -70,6 +73,13 @@ namespace AZ
                         });
                     m_newShaderVariantPendingRequests.clear();
 
+                    AZStd::for_each(
+                        m_prefetchShaderVariantPendingRequests.begin(), m_prefetchShaderVariantPendingRequests.end(),
+                        [&](const ShaderVariantAsyncLoader::PairOfShaderAssetIdAndShaderVariantStableId& pair) {
+                            prefetchShaderVariantPendingRequests.insert(pair);
+                        });
+                    m_prefetchShaderVariantPendingRequests.clear();
+
                     AZStd::for_each(m_shaderVariantTreePendingRequests.begin(), m_shaderVariantTreePendingRequests.end(),
                         [&](const Data::AssetId& assetId)
                         {
@@ -118,6 +128,35 @@ namespace AZ
                     pairItor++;
                 }
 
+                // Prefetched variants already know their stable id, so they only need the ShaderVariantCollection of their
+                // tree to exist, which happens as soon as the tree is queued for loading.
+                auto prefetchItor = prefetchShaderVariantPendingRequests.begin();
+                while (prefetchItor != prefetchShaderVariantPendingRequests.end())
+                {
+                    Data::AssetId shaderVariantTreeAssetId;
+                    {
+                        AZStd::unique_lock<decltype(m_mutex)> lock(m_mutex);
+                        auto assetIdFindIt = m_shaderAssetIdToShaderVariantTreeAssetId.find(prefetchItor->m_shaderAssetId);
+                        if (assetIdFindIt != m_shaderAssetIdToShaderVariantTreeAssetId.end() &&
+                            m_shaderVariantData.find(assetIdFindIt->second) != m_shaderVariantData.end())
+                        {
+                            shaderVariantTreeAssetId = assetIdFindIt->second;
+                        }
+                    }
+
+                    if (shaderVariantTreeAssetId.IsValid())
+                    {
+                        uint32_t shaderVariantProductSubId = ShaderVariantAsset::MakeAssetProductSubId(
+                            RHI::Factory::Get().GetAPIUniqueIndex(), prefetchItor->m_shaderVariantStableId);
+                        shaderVariantPendingRequests.insert(Data::AssetId(shaderVariantTreeAssetId.m_guid, shaderVariantProductSubId));
+                        prefetchItor = prefetchShaderVariantPendingRequests.erase(prefetchItor);
+                        continue;
+                    }
+
+                    shaderVariantTreePendingRequests.insert(prefetchItor->m_shaderAssetId);
+                    prefetchItor++;
+                }
+
 
                 auto variantTreeItor = shaderVariantTreePendingRequests.begin();
                 while (variantTreeItor != shaderVariantTreePendingRequests.end())
@@ -166,6 +205,7 @@ namespace AZ
             Data::AssetBus::MultiHandler::BusDisconnect();
 
             m_newShaderVariantPendingRequests.clear();
+            m_prefetchShaderVariantPendingRequests.clear();
             m_shaderVariantTreePendingRequests.clear();
             m_shaderVariantPendingRequests.clear();
             m_shaderVariantData.clear();
@@ -213,6 +253,25 @@ namespace AZ
             return true;
         }
 
+        bool ShaderVariantAsyncLoader::QueueLoadShaderVariantAssetByStableId(
+            const Data::AssetId& shaderAssetId, ShaderVariantStableId variantStableId)
+        {
+            if (m_isServiceShutdown.load())
+            {
+                return false;
+            }
+
+            AZ_Assert(variantStableId != RootShaderVariantStableId, "Root Variants Are Found inside ShaderAssets");
+
+            {
+                AZStd::unique_lock<decltype(m_mutex)> lock(m_mutex);
+                PairOfShaderAssetIdAndShaderVariantStableId pair = {shaderAssetId, variantStableId};
+                m_prefetchShaderVariantPendingRequests.push_back(pair);
+            }
+            m_workCondition.notify_one();
+            return true;
+        }
+
         bool ShaderVariantAsyncLoader::QueueLoadShaderVariantTreeAsset(const Data::AssetId& shaderAssetId)
         {
             if (m_isServiceShutdown.load())
@@ -7,6 +7,7 @@
 
 #include <Atom/RPI.Reflect/Image/ImageMipChainAsset.h>
 
+#include <AzCore/Compression/Compression.h>
 #include <AzCore/Serialization/SerializeContext.h>
 
 namespace AZ
@@ -22,13 +23,14 @@ namespace AZ
             if (auto* serializeContext = azrtti_cast<SerializeContext*>(context))
             {
                 serializeContext->Class<ImageMipChainAsset, Data::AssetData>()
-                    ->Version(0)
+                    ->Version(1)
                     ->Field("m_mipLevels", &ImageMipChainAsset::m_mipLevels)
                     ->Field("m_arraySize", &ImageMipChainAsset::m_arraySize)
                     ->Field("m_mipToSubImageOffset", &ImageMipChainAsset::m_mipToSubImageOffset)
                     ->Field("m_subImageLayouts", &ImageMipChainAsset::m_subImageLayouts)
                     ->Field("m_subImageDataOffsets", &ImageMipChainAsset::m_subImageDataOffsets)
                     ->Field("m_imageData", &ImageMipChainAsset::m_imageData)
+                    ->Field("m_compression", &ImageMipChainAsset::m_compression)
                     ;
             }
         }
@@ -78,6 +80,45 @@ namespace AZ
             return m_imageData.size();
         }
 
+        RHI::StreamingImageCompression ImageMipChainAsset::GetCompression() const
+        {
+            return m_compression;
+        }
+
+        size_t ImageMipChainAsset::GetDecompressedSubImageSize(uint32_t subImageIndex) const
+        {
+            const RHI::ImageSubresourceLayout& layout = m_subImageLayouts[subImageIndex / m_arraySize];
+            return static_cast<size_t>(layout.m_bytesPerImage) * layout.m_size.m_depth;
+        }
+
+        bool ImageMipChainAsset::DecompressSubImage(uint32_t subImageIndex, void* output, size_t outputSize) const
+        {
+            AZStd::array_view<uint8_t> subImageData = GetSubImageData(subImageIndex);
+            const size_t decompressedSize = GetDecompressedSubImageSize(subImageIndex);
+            AZ_Assert(outputSize >= decompressedSize, "Output buffer is too small for the decompressed sub-image.");
+            AZ_UNUSED(outputSize);
+
+            switch (m_compression)
+            {
+            case RHI::StreamingImageCompression::None:
+                memcpy(output, subImageData.data(), AZStd::min(subImageData.size(), decompressedSize));
+                return subImageData.size() == decompressedSize;
+            case RHI::StreamingImageCompression::Deflate:
+            {
+                ZLib zlib;
+                zlib.StartDecompressor();
+                unsigned int remainingSize = static_cast<unsigned int>(decompressedSize);
+                zlib.Decompress(subImageData.data(), static_cast<unsigned int>(subImageData.size()),
+                    output, remainingSize, ZLib::FT_FINISH);
+                zlib.StopDecompressor();
+                return remainingSize == 0;
+            }
+            default:
+                AZ_Assert(false, "Unsupported mip chain compression %u.", static_cast<uint32_t>(m_compression));
+                return false;
+            }
+        }
+
         void ImageMipChainAsset::CopyFrom(const ImageMipChainAsset& source)
         {
             m_mipLevels = source.m_mipLevels;
@@ -86,6 +127,7 @@ namespace AZ
             m_subImageLayouts = source.m_subImageLayouts;
             m_subImageDataOffsets = source.m_subImageDataOffsets;
             m_imageData = source.m_imageData;
+            m_compression = source.m_compression;
 
             Init();
         }
@@ -105,6 +147,10 @@ namespace AZ
                 const uintptr_t ptrOffset = m_subImageDataOffsets[subImageIndex];
                 const uintptr_t ptrBase = reinterpret_cast<uintptr_t>(m_imageData.data());
                 m_subImageDatas[subImageIndex].m_data = reinterpret_cast<const void*>(ptrBase + ptrOffset);
+                if (m_compression != RHI::StreamingImageCompression::None)
+                {
+                    m_subImageDatas[subImageIndex].m_compressedSize = m_subImageDataOffsets[subImageIndex + 1] - ptrOffset;
+                }
             }
 
             for (uint16_t mipSliceIndex = 0; mipSliceIndex < m_mipLevels; ++mipSliceIndex)
@@ -112,6 +158,7 @@ namespace AZ
                 RHI::StreamingImageMipSlice mipSlice;
                 mipSlice.m_subresources = AZStd::array_view<RHI::StreamingImageSubresourceData>(&m_subImageDatas[m_arraySize * mipSliceIndex], m_arraySize);
                 mipSlice.m_subresourceLayout = m_subImageLayouts[mipSliceIndex];
+                mipSlice.m_compression = m_compression;
                 m_mipSlices.push_back(mipSlice);
             }
         }
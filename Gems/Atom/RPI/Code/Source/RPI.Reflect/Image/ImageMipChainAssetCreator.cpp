@@ -107,6 +107,14 @@ namespace AZ
             ++m_subImageOffset;
         }
 
+        void ImageMipChainAssetCreator::SetCompression(RHI::StreamingImageCompression compression)
+        {
+            if (ValidateIsReady())
+            {
+                m_asset->m_compression = compression;
+            }
+        }
+
         void ImageMipChainAssetCreator::EndMip()
         {
             if (!ValidateIsBuildingMip())
@@ -54,6 +54,12 @@ namespace AZ
             }
             else if (shaderItem.MaterialOwnsShaderOption(optionIndex))
             {
+                if (shaderOptionGroup->GetValue(optionIndex) == value)
+                {
+                    return true;
+                }
+
+                m_shaderCollectionChanged = true;
                 return shaderOptionGroup->SetValue(optionIndex, value);
             }
             else
@@ -106,32 +112,56 @@ namespace AZ
 
         void MaterialFunctor::RuntimeContext::SetShaderEnabled(AZStd::size_t shaderIndex, bool enabled)
         {
-            (*m_shaderCollection)[shaderIndex].SetEnabled(enabled);
+            SetShaderEnabled((*m_shaderCollection)[shaderIndex], enabled);
         }
 
         void MaterialFunctor::RuntimeContext::SetShaderEnabled(const AZ::Name& shaderTag, bool enabled)
         {
-            (*m_shaderCollection)[shaderTag].SetEnabled(enabled);
+            SetShaderEnabled((*m_shaderCollection)[shaderTag], enabled);
+        }
+
+        void MaterialFunctor::RuntimeContext::SetShaderEnabled(ShaderCollection::Item& shaderItem, bool enabled)
+        {
+            if (shaderItem.IsEnabled() != enabled)
+            {
+                shaderItem.SetEnabled(enabled);
+                m_shaderCollectionChanged = true;
+            }
         }
 
         void MaterialFunctor::RuntimeContext::SetShaderDrawListTagOverride(AZStd::size_t shaderIndex, const Name& drawListTagName)
         {
-            (*m_shaderCollection)[shaderIndex].SetDrawListTagOverride(drawListTagName);
+            SetShaderDrawListTagOverride((*m_shaderCollection)[shaderIndex], drawListTagName);
         }
 
         void MaterialFunctor::RuntimeContext::SetShaderDrawListTagOverride(const AZ::Name& shaderTag, const Name& drawListTagName)
         {
-            (*m_shaderCollection)[shaderTag].SetDrawListTagOverride(drawListTagName);
+            SetShaderDrawListTagOverride((*m_shaderCollection)[shaderTag], drawListTagName);
+        }
+
+        void MaterialFunctor::RuntimeContext::SetShaderDrawListTagOverride(ShaderCollection::Item& shaderItem, const Name& drawListTagName)
+        {
+            const RHI::DrawListTag previousDrawListTag = shaderItem.GetDrawListTagOverride();
+            shaderItem.SetDrawListTagOverride(drawListTagName);
+            m_shaderCollectionChanged |= shaderItem.GetDrawListTagOverride() != previousDrawListTag;
         }
 
         void MaterialFunctor::RuntimeContext::ApplyShaderRenderStateOverlay(AZStd::size_t shaderIndex, const RHI::RenderStates& renderStatesOverlay)
         {
-            RHI::MergeStateInto(renderStatesOverlay, *((*m_shaderCollection)[shaderIndex].GetRenderStatesOverlay()));
+            ApplyShaderRenderStateOverlay((*m_shaderCollection)[shaderIndex], renderStatesOverlay);
         }
 
         void MaterialFunctor::RuntimeContext::ApplyShaderRenderStateOverlay(const AZ::Name& shaderTag, const RHI::RenderStates& renderStatesOverlay)
         {
-            RHI::MergeStateInto(renderStatesOverlay, *((*m_shaderCollection)[shaderTag].GetRenderStatesOverlay()));
+            ApplyShaderRenderStateOverlay((*m_shaderCollection)[shaderTag], renderStatesOverlay);
+        }
+
+        void MaterialFunctor::RuntimeContext::ApplyShaderRenderStateOverlay(ShaderCollection::Item& shaderItem, const RHI::RenderStates& renderStatesOverlay)
+        {
+            RHI::RenderStates* renderStates = shaderItem.GetRenderStatesOverlay();
+            const RHI::RenderStates previousRenderStates = *renderStates;
+            RHI::MergeStateInto(renderStatesOverlay, *renderStates);
+            m_shaderCollectionChanged |= !(*renderStates == previousRenderStates);
         }
 
         MaterialFunctor::EditorContext::EditorContext(
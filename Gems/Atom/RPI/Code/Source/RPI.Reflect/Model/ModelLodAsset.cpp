@@ -36,16 +36,34 @@ namespace AZ
             if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
             {
                 serializeContext->Class<ModelLodAsset::Mesh>()
-                    ->Version(0)
+                    ->Version(1)
                     ->Field("Material", &ModelLodAsset::Mesh::m_materialAsset)
                     ->Field("Name", &ModelLodAsset::Mesh::m_name)
                     ->Field("AABB", &ModelLodAsset::Mesh::m_aabb)
                     ->Field("IndexBufferAssetView", &ModelLodAsset::Mesh::m_indexBufferAssetView)
                     ->Field("StreamBufferInfo", &ModelLodAsset::Mesh::m_streamBufferInfo)
+                    ->Field("Meshlets", &ModelLodAsset::Mesh::m_meshlets)
                     ;
             }
 
             StreamBufferInfo::Reflect(context);
+            Meshlet::Reflect(context);
+        }
+
+        void ModelLodAsset::Mesh::Meshlet::Reflect(AZ::ReflectContext* context)
+        {
+            if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
+            {
+                serializeContext->Class<ModelLodAsset::Mesh::Meshlet>()
+                    ->Version(0)
+                    ->Field("IndexOffset", &ModelLodAsset::Mesh::Meshlet::m_indexOffset)
+                    ->Field("TriangleCount", &ModelLodAsset::Mesh::Meshlet::m_triangleCount)
+                    ->Field("Center", &ModelLodAsset::Mesh::Meshlet::m_center)
+                    ->Field("Radius", &ModelLodAsset::Mesh::Meshlet::m_radius)
+                    ->Field("ConeAxis", &ModelLodAsset::Mesh::Meshlet::m_coneAxis)
+                    ->Field("ConeCutoff", &ModelLodAsset::Mesh::Meshlet::m_coneCutoff)
+                    ;
+            }
         }
 
         void ModelLodAsset::Mesh::StreamBufferInfo::Reflect(AZ::ReflectContext* context)
@@ -99,6 +117,11 @@ namespace AZ
             return AZStd::array_view<ModelLodAsset::Mesh::StreamBufferInfo>(m_streamBufferInfo);
         }
 
+        AZStd::array_view<ModelLodAsset::Mesh::Meshlet> ModelLodAsset::Mesh::GetMeshlets() const
+        {
+            return AZStd::array_view<ModelLodAsset::Mesh::Meshlet>(m_meshlets);
+        }
+
         void ModelLodAsset::AddMesh(const Mesh& mesh)
         {
             m_meshes.push_back(mesh);
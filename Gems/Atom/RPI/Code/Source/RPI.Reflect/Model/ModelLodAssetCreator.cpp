@@ -52,6 +52,14 @@ namespace AZ
             }
         }
 
+        void ModelLodAssetCreator::SetMeshMeshlets(AZStd::array_view<ModelLodAsset::Mesh::Meshlet> meshlets)
+        {
+            if (ValidateIsMeshReady())
+            {
+                m_currentMesh.m_meshlets.assign(meshlets.begin(), meshlets.end());
+            }
+        }
+
         void ModelLodAssetCreator::SetMeshAabb(AZ::Aabb&& aabb)
         {
             if (ValidateIsMeshReady())
@@ -288,6 +296,7 @@ namespace AZ
                 AZ::Aabb aabb = sourceMesh.GetAabb();
                 creator.SetMeshAabb(AZStd::move(aabb));
                 creator.SetMeshMaterialAsset(sourceMesh.GetMaterialAsset());
+                creator.SetMeshMeshlets(sourceMesh.GetMeshlets());
 
                 // Mesh index buffer view
                 const BufferAssetView& sourceIndexBufferView = sourceMesh.GetIndexBufferAssetView();
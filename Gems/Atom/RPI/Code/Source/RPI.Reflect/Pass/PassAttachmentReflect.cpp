@@ -186,10 +186,17 @@ namespace AZ
         {
             if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
             {
+                serializeContext->Enum<PassAttachmentRenderScale>()
+                    ->Value("Inherit", PassAttachmentRenderScale::Inherit)
+                    ->Value("Apply", PassAttachmentRenderScale::Apply)
+                    ->Value("Remove", PassAttachmentRenderScale::Remove)
+                    ;
+
                 serializeContext->Class<PassAttachmentSizeSource>()
-                    ->Version(0)
+                    ->Version(1)
                     ->Field("Source", &PassAttachmentSizeSource::m_source)
                     ->Field("Multipliers", &PassAttachmentSizeSource::m_multipliers)
+                    ->Field("RenderScale", &PassAttachmentSizeSource::m_renderScale)
                     ;
             }
         }
@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ * 
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzTest/AzTest.h>
+
+#include <AzCore/std/sort.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+#include <Model/MeshletBuilder.h>
+
+namespace UnitTest
+{
+    using namespace AZ;
+
+    class MeshletBuilderTests
+        : public AllocatorsFixture
+    {
+    protected:
+        // Builds a flat grid of quads in the xy plane, facing +z
+        static void CreateGrid(uint32_t quadsPerSide, AZStd::vector<uint32_t>& indices, AZStd::vector<float>& positions)
+        {
+            const uint32_t verticesPerSide = quadsPerSide + 1;
+            for (uint32_t y = 0; y < verticesPerSide; ++y)
+            {
+                for (uint32_t x = 0; x < verticesPerSide; ++x)
+                {
+                    positions.push_back(static_cast<float>(x));
+                    positions.push_back(static_cast<float>(y));
+                    positions.push_back(0.0f);
+                }
+            }
+
+            for (uint32_t y = 0; y < quadsPerSide; ++y)
+            {
+                for (uint32_t x = 0; x < quadsPerSide; ++x)
+                {
+                    const uint32_t corner = y * verticesPerSide + x;
+                    indices.insert(indices.end(), { corner, corner + 1, corner + verticesPerSide + 1 });
+                    indices.insert(indices.end(), { corner, corner + verticesPerSide + 1, corner + verticesPerSide });
+                }
+            }
+        }
+    };
+
+    TEST_F(MeshletBuilderTests, BuildMeshlets_EmptyMesh_ReturnsNoMeshlet)
+    {
+        AZStd::vector<uint32_t> indices;
+        AZStd::vector<float> positions;
+        EXPECT_TRUE(RPI::MeshletBuilder::BuildMeshlets(indices, positions).empty());
+    }
+
+    TEST_F(MeshletBuilderTests, BuildMeshlets_Grid_MeshletsCoverAllTrianglesWithinLimits)
+    {
+        AZStd::vector<uint32_t> indices;
+        AZStd::vector<float> positions;
+        CreateGrid(32, indices, positions);
+        const AZStd::vector<uint32_t> originalIndices = indices;
+
+        const AZStd::vector<RPI::ModelLodAsset::Mesh::Meshlet> meshlets = RPI::MeshletBuilder::BuildMeshlets(indices, positions);
+        ASSERT_FALSE(meshlets.empty());
+        ASSERT_EQ(indices.size(), originalIndices.size());
+
+        uint32_t expectedIndexOffset = 0;
+        for (const RPI::ModelLodAsset::Mesh::Meshlet& meshlet : meshlets)
+        {
+            EXPECT_EQ(meshlet.m_indexOffset, expectedIndexOffset);
+            EXPECT_GT(meshlet.m_triangleCount, 0u);
+            EXPECT_LE(meshlet.m_triangleCount, RPI::MeshletBuilder::MaxTriangleCount);
+
+            AZStd::unordered_set<uint32_t> meshletVertices;
+            for (uint32_t index = meshlet.m_indexOffset; index < meshlet.m_indexOffset + meshlet.m_triangleCount * 3; ++index)
+            {
+                meshletVertices.insert(indices[index]);
+
+                // Every vertex is inside the bounding sphere
+                const uint32_t vertex = indices[index];
+                const Vector3 position(positions[vertex * 3], positions[vertex * 3 + 1], positions[vertex * 3 + 2]);
+                EXPECT_LE(position.GetDistance(meshlet.m_center), meshlet.m_radius + 0.001f);
+            }
+            EXPECT_LE(meshletVertices.size(), RPI::MeshletBuilder::MaxVertexCount);
+
+            // All the triangles of the grid face +z
+            EXPECT_TRUE(meshlet.m_coneAxis.IsClose(Vector3::CreateAxisZ()));
+            EXPECT_NEAR(meshlet.m_coneCutoff, 0.0f, 0.001f);
+
+            expectedIndexOffset += meshlet.m_triangleCount * 3;
+        }
+        EXPECT_EQ(expectedIndexOffset, indices.size());
+
+        // The triangles are only reordered, each keeps its winding
+        auto sortTriangles = [](const AZStd::vector<uint32_t>& triangleIndices)
+        {
+            AZStd::vector<uint64_t> triangles;
+            for (size_t index = 0; index < triangleIndices.size(); index += 3)
+            {
+                triangles.push_back(
+                    (static_cast<uint64_t>(triangleIndices[index]) << 42) | (static_cast<uint64_t>(triangleIndices[index + 1]) << 21) |
+                    triangleIndices[index + 2]);
+            }
+            AZStd::sort(triangles.begin(), triangles.end());
+            return triangles;
+        };
+        EXPECT_EQ(sortTriangles(indices), sortTriangles(originalIndices));
+    }
+
+    TEST_F(MeshletBuilderTests, BuildMeshlets_OppositeTriangles_CannotBeBackfaceCulled)
+    {
+        // Two triangles on the same vertices with opposite windings
+        AZStd::vector<uint32_t> indices = { 0, 1, 2, 0, 2, 1 };
+        AZStd::vector<float> positions = { 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f };
+
+        const AZStd::vector<RPI::ModelLodAsset::Mesh::Meshlet> meshlets = RPI::MeshletBuilder::BuildMeshlets(indices, positions);
+        ASSERT_EQ(meshlets.size(), 1);
+        EXPECT_EQ(meshlets[0].m_triangleCount, 2u);
+        EXPECT_FLOAT_EQ(meshlets[0].m_coneCutoff, 1.0f);
+    }
+} // namespace UnitTest
@@ -23,6 +23,7 @@
 
 #include <AtomCore/Instance/InstanceDatabase.h>
 
+#include <AzCore/Compression/Compression.h>
 #include <AzCore/Interface/Interface.h>
 #include <AzCore/std/containers/intrusive_list.h>
 
@@ -633,6 +634,59 @@ namespace UnitTest
         ValidateMipChainAsset(serializedMipChain.Get(), mipLevels, arraySize, pixelSize);
     }
 
+    TEST_F(StreamingImageTests, MipChainAssetDeflateDecompress)
+    {
+        using namespace AZ;
+
+        const uint16_t mipLevels = 3;
+        const uint16_t arraySize = 2;
+        const uint16_t pixelSize = 4;
+        const uint32_t imageSize = 1 << mipLevels;
+
+        AZStd::vector<AZStd::vector<uint8_t>> sourceDatas;
+
+        RPI::ImageMipChainAssetCreator assetCreator;
+        assetCreator.Begin(Data::AssetId(AZ::Uuid::CreateRandom()), mipLevels, arraySize);
+        assetCreator.SetCompression(RHI::StreamingImageCompression::Deflate);
+        for (uint32_t mipLevel = 0; mipLevel < mipLevels; ++mipLevel)
+        {
+            const uint32_t mipSize = imageSize >> mipLevel;
+            assetCreator.BeginMip(BuildSubImageLayout(mipSize, pixelSize));
+            for (uint32_t arrayIndex = 0; arrayIndex < arraySize; ++arrayIndex)
+            {
+                AZStd::vector<uint8_t> data = BuildImageData(mipSize, mipSize, pixelSize);
+
+                ZLib zlib;
+                zlib.StartCompressor();
+                unsigned int remainingSize = static_cast<unsigned int>(data.size());
+                AZStd::vector<uint8_t> compressedData(zlib.GetMinCompressedBufferSize(remainingSize));
+                const unsigned int compressedSize = zlib.Compress(data.data(), remainingSize,
+                    compressedData.data(), static_cast<unsigned int>(compressedData.size()), ZLib::FT_FINISH);
+                zlib.StopCompressor();
+                ASSERT_EQ(remainingSize, 0u);
+
+                assetCreator.AddSubImage(compressedData.data(), compressedSize);
+                sourceDatas.push_back(AZStd::move(data));
+            }
+            assetCreator.EndMip();
+        }
+
+        Data::Asset<RPI::ImageMipChainAsset> mipChain;
+        ASSERT_TRUE(assetCreator.End(mipChain));
+        EXPECT_EQ(mipChain->GetCompression(), RHI::StreamingImageCompression::Deflate);
+
+        for (uint32_t subImageIndex = 0; subImageIndex < mipChain->GetSubImageCount(); ++subImageIndex)
+        {
+            const AZStd::vector<uint8_t>& sourceData = sourceDatas[subImageIndex];
+            EXPECT_EQ(mipChain->GetDecompressedSubImageSize(subImageIndex), sourceData.size());
+            EXPECT_EQ(mipChain->GetMipSlices()[subImageIndex / arraySize].m_compression, RHI::StreamingImageCompression::Deflate);
+
+            AZStd::vector<uint8_t> decompressedData(sourceData.size());
+            EXPECT_TRUE(mipChain->DecompressSubImage(subImageIndex, decompressedData.data(), decompressedData.size()));
+            EXPECT_EQ(decompressedData, sourceData);
+        }
+    }
+
     TEST_F(StreamingImageTests, PoolAssetCreation)
     {
         using namespace AZ;
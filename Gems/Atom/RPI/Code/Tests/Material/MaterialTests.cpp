@@ -273,6 +273,26 @@ namespace UnitTest
         EXPECT_EQ(srgData.GetConstant<uint32_t>(srgData.FindShaderInputConstantIndex(Name{ "m_enum" })), 3u);
     }
 
+    TEST_F(MaterialTests, TestSetPropertyValue_OnlyChangedValuesInvalidateMaterial)
+    {
+        Data::Instance<Material> material = Material::FindOrCreate(m_testMaterialAsset);
+
+        const MaterialPropertyIndex floatIndex = material->FindPropertyIndex(Name{ "MyFloat" });
+        const Material::ChangeId changeId = material->GetCurrentChangeId();
+        const Material::ChangeId shaderCollectionChangeId = material->GetShaderCollectionChangeId();
+
+        // Setting the current value again is a no-op
+        EXPECT_TRUE(material->SetPropertyValue<float>(floatIndex, material->GetPropertyValue<float>(floatIndex)));
+        EXPECT_EQ(changeId, material->GetCurrentChangeId());
+        EXPECT_FALSE(material->NeedsCompile());
+
+        // A property connected to a shader constant needs a compile but doesn't change the shader collection
+        EXPECT_TRUE(material->SetPropertyValue<float>(floatIndex, material->GetPropertyValue<float>(floatIndex) + 1.0f));
+        EXPECT_NE(changeId, material->GetCurrentChangeId());
+        EXPECT_EQ(shaderCollectionChangeId, material->GetShaderCollectionChangeId());
+        EXPECT_TRUE(material->NeedsCompile());
+    }
+
     TEST_F(MaterialTests, TestSetPropertyValueToMultipleShaderSettings)
     {
         Data::Asset<ShaderAsset> shaderAsset = CreateTestShaderAsset(Uuid::CreateRandom(), m_testMaterialSrgAsset);
@@ -481,6 +481,27 @@ namespace UnitTest
         TestPassConstructionAndValidation();
     }
 
+    TEST_F(PassTests, PruneUnconsumedPasses)
+    {
+        // Output the lighting buffer from the parent so nothing consumes the post process pass output
+        m_data->m_parentPass.m_connections[0].m_attachmentRef.m_pass = "ForwardPass";
+        m_data->m_parentPass.m_connections[0].m_attachmentRef.m_attachment = "LightingOutput";
+        m_data->AddPassTemplatesToLibrary();
+
+        Ptr<Pass> parentPass = m_passSystem->CreatePassFromTemplate(Name("ParentPass"), Name("ParentPass"));
+        PassSystemInterface::Get()->GetRootPass()->AddChild(parentPass);
+        m_passSystem->ProcessQueuedChanges();
+
+        ParentPass* parent = parentPass->AsParent();
+        EXPECT_FALSE(parent->FindChildPass(Name("DepthPrePass"))->IsPruned());
+        EXPECT_FALSE(parent->FindChildPass(Name("LightCullPass"))->IsPruned());
+        EXPECT_FALSE(parent->FindChildPass(Name("ForwardPass"))->IsPruned());
+        EXPECT_TRUE(parent->FindChildPass(Name("PostProcessPass"))->IsPruned());
+
+        parentPass->QueueForRemoval();
+        m_passSystem->ProcessQueuedChanges();
+    }
+
     TEST_F(PassTests, FormatFilterFailure)
     {
         TestFormatFilterFailure();
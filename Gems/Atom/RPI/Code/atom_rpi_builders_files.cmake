@@ -14,6 +14,8 @@ set(FILES
     Source/RPI.Builders/Material/MaterialBuilder.h
     Source/RPI.Builders/Model/MaterialAssetBuilderComponent.cpp
     Source/RPI.Builders/Model/MaterialAssetBuilderComponent.h
+    Source/RPI.Builders/Model/MeshletBuilder.cpp
+    Source/RPI.Builders/Model/MeshletBuilder.h
     Source/RPI.Builders/Model/ModelAssetBuilderComponent.cpp
     Source/RPI.Builders/Model/ModelAssetBuilderComponent.h
     Source/RPI.Builders/Model/ModelExporterComponent.cpp
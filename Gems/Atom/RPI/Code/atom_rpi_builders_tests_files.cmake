@@ -10,6 +10,7 @@ set(FILES
     Tests.Builders/AtomRPIBuildersTests.cpp
     Tests.Builders/BuilderTestFixture.cpp
     Tests.Builders/BuilderTestFixture.h
+    Tests.Builders/MeshletBuilderTest.cpp
     Tests.Builders/PassBuilderTest.cpp
     Tests.Builders/ResourcePoolBuilderTest.cpp
 )
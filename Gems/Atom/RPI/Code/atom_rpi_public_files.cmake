@@ -30,6 +30,7 @@ set(FILES
     Include/Atom/RPI.Public/AuxGeom/AuxGeomFeatureProcessorInterface.h
     Include/Atom/RPI.Public/Buffer/Buffer.h
     Include/Atom/RPI.Public/Buffer/BufferPool.h
+    Include/Atom/RPI.Public/Buffer/BufferReadbackRing.h
     Include/Atom/RPI.Public/Buffer/BufferSystem.h
     Include/Atom/RPI.Public/Buffer/BufferSystemInterface.h
     Include/Atom/RPI.Public/ColorManagement/TransformColor.h
@@ -90,6 +91,7 @@ set(FILES
     Include/Atom/RPI.Public/Shader/Metrics/ShaderMetricsSystem.h
     Include/Atom/RPI.Public/Shader/Metrics/ShaderMetricsSystemInterface.h
     Include/Atom/RPI.Public/Shader/ShaderVariantAsyncLoader.h
+    Include/Atom/RPI.Public/GpuQuery/GpuPassTimingCollector.h
     Include/Atom/RPI.Public/GpuQuery/GpuQuerySystem.h
     Include/Atom/RPI.Public/GpuQuery/GpuQuerySystemInterface.h
     Include/Atom/RPI.Public/GpuQuery/GpuQueryTypes.h
@@ -112,6 +114,7 @@ set(FILES
     Source/RPI.Public/AuxGeomFeatureProcessorInterface.cpp
     Source/RPI.Public/Buffer/Buffer.cpp
     Source/RPI.Public/Buffer/BufferPool.cpp
+    Source/RPI.Public/Buffer/BufferReadbackRing.cpp
     Source/RPI.Public/Buffer/BufferSystem.cpp
     Source/RPI.Public/DynamicDraw/DynamicBuffer.cpp
     Source/RPI.Public/DynamicDraw/DynamicBufferAllocator.cpp
@@ -167,6 +170,7 @@ set(FILES
     Source/RPI.Public/ColorManagement/GeneratedTransforms/AcesCg_To_LinearSrgb.inl
     Source/RPI.Public/ColorManagement/GeneratedTransforms/XYZ_To_AcesCg.inl
     Source/RPI.Public/ColorManagement/TransformColor.cpp
+    Source/RPI.Public/GpuQuery/GpuPassTimingCollector.cpp
     Source/RPI.Public/GpuQuery/GpuQuerySystem.cpp
     Source/RPI.Public/GpuQuery/GpuQueryTypes.cpp
     Source/RPI.Public/GpuQuery/Query.cpp
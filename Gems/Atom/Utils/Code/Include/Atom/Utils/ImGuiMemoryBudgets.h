@@ -0,0 +1,29 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Memory/MemoryBudgetTracker.h>
+
+namespace AZ
+{
+    namespace Render
+    {
+        //! Overlay showing the memory used by each subsystem against its budget.
+        class ImGuiMemoryBudgets
+        {
+        public:
+            ImGuiMemoryBudgets() = default;
+            ~ImGuiMemoryBudgets() = default;
+
+            //! Draws the usage from the last update of the tracker.
+            void Draw(bool& draw, const AZ::MemoryBudgetTracker& tracker);
+        };
+    } // namespace Render
+}  // namespace AZ
+
+#include "ImGuiMemoryBudgets.inl"
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/std/algorithm.h>
+
+namespace AZ
+{
+    namespace Render
+    {
+        inline void ImGuiMemoryBudgets::Draw(bool& draw, const AZ::MemoryBudgetTracker& tracker)
+        {
+            constexpr float BytesPerMegabyte = 1024.0f * 1024.0f;
+
+            ImGui::SetNextWindowSize(ImVec2(500.0f, 260.0f), ImGuiCond_FirstUseEver);
+            if (ImGui::Begin("Memory Budgets", &draw, ImGuiWindowFlags_None))
+            {
+                ImGui::Text("Total: %.2f MB", tracker.GetTotalUsedBytes() / BytesPerMegabyte);
+                ImGui::Separator();
+
+                ImGui::Columns(3, "budgets", false);
+                ImGui::SetColumnWidth(0, 100.0f);
+                ImGui::SetColumnWidth(1, 150.0f);
+
+                ImGui::Text("Category");
+                ImGui::NextColumn();
+                ImGui::Text("Used / Budget (MB)");
+                ImGui::NextColumn();
+                ImGui::Text("Usage");
+                ImGui::NextColumn();
+
+                for (AZ::u32 categoryIndex = 0; categoryIndex < static_cast<AZ::u32>(AZ::MemoryBudgetCategory::Count); ++categoryIndex)
+                {
+                    const AZ::MemoryBudgetCategory category = static_cast<AZ::MemoryBudgetCategory>(categoryIndex);
+                    const AZ::MemoryBudgetTracker::CategoryUsage& usage = tracker.GetUsage(category);
+                    const float usedMegabytes = usage.GetUsedBytes() / BytesPerMegabyte;
+
+                    ImGui::Text("%s", AZ::ToString(category));
+                    ImGui::NextColumn();
+
+                    if (usage.m_budgetBytes == 0)
+                    {
+                        ImGui::Text("%.2f / -", usedMegabytes);
+                        ImGui::NextColumn();
+                        ImGui::NextColumn();
+                        continue;
+                    }
+
+                    const float budgetMegabytes = usage.m_budgetBytes / BytesPerMegabyte;
+                    const ImVec4 color = usage.IsOverBudget() ? ImVec4(1.0f, 0.0f, 0.0f, 1.0f) : ImVec4(1.0f, 1.0f, 1.0f, 1.0f);
+                    ImGui::TextColored(color, "%.2f / %.2f", usedMegabytes, budgetMegabytes);
+                    ImGui::NextColumn();
+
+                    ImGui::ProgressBar(AZStd::min(usedMegabytes / budgetMegabytes, 1.0f), ImVec2(-1.0f, 0.0f));
+                    ImGui::NextColumn();
+                }
+                ImGui::Columns(1);
+
+                ImGui::Separator();
+                ImGui::TextWrapped("Updated every mem_budgetUpdateInterval seconds. Budgets are set with the mem_budget*MB cvars.");
+            }
+            ImGui::End();
+        }
+    } // namespace Render
+} // namespace AZ
@@ -18,6 +18,8 @@ set(FILES
     Include/Atom/Utils/ImGuiPassTree.inl
     Include/Atom/Utils/ImGuiFrameVisualizer.h
     Include/Atom/Utils/ImGuiFrameVisualizer.inl
+    Include/Atom/Utils/ImGuiMemoryBudgets.h
+    Include/Atom/Utils/ImGuiMemoryBudgets.inl
     Include/Atom/Utils/ImGuiTransientAttachmentProfiler.h
     Include/Atom/Utils/ImGuiTransientAttachmentProfiler.inl
     Include/Atom/Utils/PpmFile.h
@@ -32,6 +32,7 @@ namespace AZ
         None = 0,
         Blur = 1,
         SuperSample = 2,
+        DistanceField = 3, // glyphs are stored as signed distance fields so they stay sharp at any scale
     };
 
     // smoothing amounts
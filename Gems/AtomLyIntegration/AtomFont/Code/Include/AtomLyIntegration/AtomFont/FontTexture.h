@@ -101,6 +101,8 @@ namespace AZ
 
         FONT_TEXTURE_TYPE* GetBuffer() { return m_buffer; }
 
+        FontSmoothMethod GetSmoothMethod() const { return m_smoothMethod; }
+
         uint32_t GetSlotChar(int slotIndex) const;
         TextureSlot* GetCharSlot(uint32_t character, const AtomFont::GlyphSize& glyphSize = AtomFont::defaultGlyphSize);
         TextureSlot* GetGradientSlot();
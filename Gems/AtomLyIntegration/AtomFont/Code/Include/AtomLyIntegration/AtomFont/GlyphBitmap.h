@@ -34,6 +34,10 @@ namespace AZ
 
         int BlitScaledTo8(unsigned char* buffer, int srcX, int srcY, int srcWidth, int srcHeight, int destX, int destY, int destWidth, int destHeight, int destBufferWidth);
 
+        //! Downsamples this bitmap by scale into an 8 bit signed distance field, where 128 is the glyph edge
+        //! and spread is the distance (in destination pixels) to reach fully inside or fully outside.
+        int BlitDistanceFieldTo8(unsigned char* destBuffer, int destWidth, int destHeight, int destBufferWidth, int scale, int spread);
+
         int GetWidth() { return m_width; }
         int GetHeight() { return m_height; }
 
@@ -154,6 +154,12 @@ namespace AZ
         int             CreateSlotList(int listSize);
         int             ReleaseSlotList();
 
+        //! The factor glyphs are scaled up by when rendering them for a distance field
+        int             GetDistanceFieldScale() const;
+
+        //! Distance, in glyph bitmap pixels, over which the distance field goes from fully inside to fully outside a glyph
+        static const int DistanceFieldSpread = 4;
+
         CacheSlotList  m_slotList;
         CacheTable     m_cacheTable;
 
@@ -146,6 +146,9 @@ bool AZ::FFont::Load(const char* fontFilePath, unsigned int width, unsigned int
     case TTFFLAG_SMOOTH_SUPERSAMPLE:
         smoothMethod = AZ::FontSmoothMethod::SuperSample;
         break;
+    case TTFFLAG_SMOOTH_DISTANCEFIELD:
+        smoothMethod = AZ::FontSmoothMethod::DistanceField;
+        break;
     }
 
     int smoothAmountFlag = (flags & TTFFLAG_SMOOTH_AMOUNT_MASK);
@@ -645,8 +648,11 @@ uint32_t AZ::FFont::WriteTextQuadsToBuffers(SVF_P2F_C4B_T2F_F4B* verts, uint16_t
     size_t vertexOffset = 0;
     size_t indexOffset = 0;
 
+    // A value of 2 tells the UI shader the font texture holds signed distance fields rather than alpha
+    const uint8 texHasColorChannel = (m_fontTexture && m_fontTexture->GetSmoothMethod() == AZ::FontSmoothMethod::DistanceField) ? 2 : 0;
+
     // Local function that is passed into CreateQuadsForText as the AddQuad function
-    AddFunction AddQuad = [&vertexData, &indexData, &vertexOffset, &indexOffset, maxQuads, &numQuadsWritten]
+    AddFunction AddQuad = [&vertexData, &indexData, &vertexOffset, &indexOffset, maxQuads, &numQuadsWritten, texHasColorChannel]
             (const Vec3& v0, const Vec3& v1, const Vec3& v2, const Vec3& v3, const Vec2& tc0, const Vec2& tc1, const Vec2& tc2, const Vec2& tc3, uint32_t packedColor)
         {
             Vec2 xy0(v0);
@@ -669,7 +675,7 @@ uint32_t AZ::FFont::WriteTextQuadsToBuffers(SVF_P2F_C4B_T2F_F4B* verts, uint16_t
                 vertexData[vertexOffset].color.dcolor = packedColor;
                 vertexData[vertexOffset].st = tc0;
                 vertexData[vertexOffset].texIndex = 0;
-                vertexData[vertexOffset].texHasColorChannel = 0;
+                vertexData[vertexOffset].texHasColorChannel = texHasColorChannel;
                 vertexData[vertexOffset].texIndex2 = 0;
                 vertexData[vertexOffset].pad = 0;
 
@@ -677,7 +683,7 @@ uint32_t AZ::FFont::WriteTextQuadsToBuffers(SVF_P2F_C4B_T2F_F4B* verts, uint16_t
                 vertexData[vertexOffset + 1].color.dcolor = packedColor;
                 vertexData[vertexOffset + 1].st = tc1;
                 vertexData[vertexOffset + 1].texIndex = 0;
-                vertexData[vertexOffset + 1].texHasColorChannel = 0;
+                vertexData[vertexOffset + 1].texHasColorChannel = texHasColorChannel;
                 vertexData[vertexOffset + 1].texIndex2 = 0;
                 vertexData[vertexOffset + 1].pad = 0;
 
@@ -685,7 +691,7 @@ uint32_t AZ::FFont::WriteTextQuadsToBuffers(SVF_P2F_C4B_T2F_F4B* verts, uint16_t
                 vertexData[vertexOffset + 2].color.dcolor = packedColor;
                 vertexData[vertexOffset + 2].st = tc2;
                 vertexData[vertexOffset + 2].texIndex = 0;
-                vertexData[vertexOffset + 2].texHasColorChannel = 0;
+                vertexData[vertexOffset + 2].texHasColorChannel = texHasColorChannel;
                 vertexData[vertexOffset + 2].texIndex2 = 0;
                 vertexData[vertexOffset + 2].pad = 0;
 
@@ -693,7 +699,7 @@ uint32_t AZ::FFont::WriteTextQuadsToBuffers(SVF_P2F_C4B_T2F_F4B* verts, uint16_t
                 vertexData[vertexOffset + 3].color.dcolor = packedColor;
                 vertexData[vertexOffset + 3].st = tc3;
                 vertexData[vertexOffset + 3].texIndex = 0;
-                vertexData[vertexOffset + 3].texHasColorChannel = 0;
+                vertexData[vertexOffset + 3].texHasColorChannel = texHasColorChannel;
                 vertexData[vertexOffset + 3].texIndex2 = 0;
                 vertexData[vertexOffset + 3].pad = 0;
 
@@ -111,6 +111,10 @@ namespace AtomFontInternal
         {
             smoothMethod = AZ::FontSmoothMethod::SuperSample;
         }
+        else if (value == "distancefield")
+        {
+            smoothMethod = AZ::FontSmoothMethod::DistanceField;
+        }
         return smoothMethod;
     }
 
@@ -11,6 +11,8 @@
 
 #include <AtomLyIntegration/AtomFont/AtomFont_precompiled.h>
 #include <AtomLyIntegration/AtomFont/GlyphBitmap.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/vector.h>
 #include <math.h>
 
 
@@ -234,4 +236,111 @@ int AZ::GlyphBitmap::BlitScaledTo8(unsigned char* destBuffer, [[maybe_unused]] i
 
     return 1;
 }
+
+//-------------------------------------------------------------------------------------------------
+namespace
+{
+    // Offset to the nearest seed pixel, used by the 8 point sequential signed euclidean distance transform (8SSEDT)
+    struct DistanceFieldPoint
+    {
+        int m_dx;
+        int m_dy;
+
+        int DistanceSq() const { return m_dx * m_dx + m_dy * m_dy; }
+    };
+
+    const int DistanceFieldInfinity = 9999;
+
+    void CompareDistanceFieldPoint(AZStd::vector<DistanceFieldPoint>& grid, int width, int height, int x, int y, int offsetX, int offsetY)
+    {
+        const int neighbourX = x + offsetX;
+        const int neighbourY = y + offsetY;
+        if (neighbourX < 0 || neighbourY < 0 || neighbourX >= width || neighbourY >= height)
+        {
+            return;
+        }
+
+        const DistanceFieldPoint& neighbour = grid[neighbourY * width + neighbourX];
+        DistanceFieldPoint candidate = { neighbour.m_dx + offsetX, neighbour.m_dy + offsetY };
+        DistanceFieldPoint& point = grid[y * width + x];
+        if (candidate.DistanceSq() < point.DistanceSq())
+        {
+            point = candidate;
+        }
+    }
+
+    void PropagateDistanceField(AZStd::vector<DistanceFieldPoint>& grid, int width, int height)
+    {
+        for (int y = 0; y < height; ++y)
+        {
+            for (int x = 0; x < width; ++x)
+            {
+                CompareDistanceFieldPoint(grid, width, height, x, y, -1, 0);
+                CompareDistanceFieldPoint(grid, width, height, x, y, 0, -1);
+                CompareDistanceFieldPoint(grid, width, height, x, y, -1, -1);
+                CompareDistanceFieldPoint(grid, width, height, x, y, 1, -1);
+            }
+            for (int x = width - 1; x >= 0; --x)
+            {
+                CompareDistanceFieldPoint(grid, width, height, x, y, 1, 0);
+            }
+        }
+
+        for (int y = height - 1; y >= 0; --y)
+        {
+            for (int x = width - 1; x >= 0; --x)
+            {
+                CompareDistanceFieldPoint(grid, width, height, x, y, 1, 0);
+                CompareDistanceFieldPoint(grid, width, height, x, y, 0, 1);
+                CompareDistanceFieldPoint(grid, width, height, x, y, -1, 1);
+                CompareDistanceFieldPoint(grid, width, height, x, y, 1, 1);
+            }
+            for (int x = 0; x < width; ++x)
+            {
+                CompareDistanceFieldPoint(grid, width, height, x, y, -1, 0);
+            }
+        }
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+int AZ::GlyphBitmap::BlitDistanceFieldTo8(unsigned char* destBuffer, int destWidth, int destHeight, int destBufferWidth, int scale, int spread)
+{
+    const DistanceFieldPoint seed = { 0, 0 };
+    const DistanceFieldPoint empty = { DistanceFieldInfinity, DistanceFieldInfinity };
+
+    // distance from every pixel to the nearest pixel inside, and outside, the glyph
+    AZStd::vector<DistanceFieldPoint> toInside(m_width * m_height);
+    AZStd::vector<DistanceFieldPoint> toOutside(m_width * m_height);
+    for (int i = 0; i < m_width * m_height; ++i)
+    {
+        const bool inside = m_buffer[i] >= 128;
+        toInside[i] = inside ? seed : empty;
+        toOutside[i] = inside ? empty : seed;
+    }
+
+    PropagateDistanceField(toInside, m_width, m_height);
+    PropagateDistanceField(toOutside, m_width, m_height);
+
+    const float range = static_cast<float>(2 * spread * scale);
+
+    for (int y = 0; y < destHeight; ++y)
+    {
+        const int srcY = AZStd::min(y * scale + scale / 2, m_height - 1);
+
+        for (int x = 0; x < destWidth; ++x)
+        {
+            const int srcX = AZStd::min(x * scale + scale / 2, m_width - 1);
+            const int srcIndex = srcY * m_width + srcX;
+
+            // positive outside the glyph, negative inside it
+            const float distance = sqrtf(static_cast<float>(toInside[srcIndex].DistanceSq())) - sqrtf(static_cast<float>(toOutside[srcIndex].DistanceSq()));
+            const float value = AZStd::clamp(0.5f - distance / range, 0.0f, 1.0f);
+
+            destBuffer[y * destBufferWidth + x] = static_cast<unsigned char>(value * 255.0f);
+        }
+    }
+
+    return 1;
+}
 //-------------------------------------------------------------------------------------------------
@@ -71,6 +71,13 @@ int AZ::GlyphCache::Create(int iCacheSize, int glyphBitmapWidth, int glyphBitmap
         }
     }
     break;
+    case AZ::FontSmoothMethod::DistanceField:
+    {
+        const int distanceFieldScale = GetDistanceFieldScale();
+        iScaledGlyphWidth = m_glyphBitmapWidth * distanceFieldScale;
+        iScaledGlyphHeight = m_glyphBitmapHeight * distanceFieldScale;
+    }
+    break;
     }
 
     if (iScaledGlyphWidth)
@@ -189,7 +196,27 @@ int AZ::GlyphCache::PreCacheGlyph(uint32_t character, const AtomFont::GlyphSize&
         UnCacheGlyph(slot->m_currentCharacter, slot->m_glyphSize);
     }
 
-    if (m_scaleBitmap)
+    if (m_smoothMethod == AZ::FontSmoothMethod::DistanceField)
+    {
+        m_scaleBitmap->Clear();
+
+        if (!m_fontRenderer.GetGlyph(m_scaleBitmap, &slot->m_horizontalAdvance, &slot->m_characterWidth, &slot->m_characterHeight, slot->m_characterOffsetX, slot->m_characterOffsetY, 0, 0, character, fontHintParams))
+        {
+            return 0;
+        }
+
+        // The glyph was rendered scaled up, bring the metrics back to the glyph bitmap resolution
+        const int distanceFieldScale = GetDistanceFieldScale();
+        slot->m_horizontalAdvance /= distanceFieldScale;
+        slot->m_characterWidth = static_cast<uint8_t>((slot->m_characterWidth + distanceFieldScale - 1) / distanceFieldScale);
+        slot->m_characterHeight = static_cast<uint8_t>((slot->m_characterHeight + distanceFieldScale - 1) / distanceFieldScale);
+        slot->m_characterOffsetX /= distanceFieldScale;
+        slot->m_characterOffsetY /= distanceFieldScale;
+
+        m_scaleBitmap->BlitDistanceFieldTo8(slot->m_glyphBitmap.GetBuffer(), slot->m_glyphBitmap.GetWidth(), slot->m_glyphBitmap.GetHeight(),
+            slot->m_glyphBitmap.GetWidth(), distanceFieldScale, DistanceFieldSpread);
+    }
+    else if (m_scaleBitmap)
     {
         int iOffsetMult = 1;
 
@@ -237,6 +264,14 @@ int AZ::GlyphCache::PreCacheGlyph(uint32_t character, const AtomFont::GlyphSize&
     return 1;
 }
 
+//-------------------------------------------------------------------------------------------------
+int AZ::GlyphCache::GetDistanceFieldScale() const
+{
+    // distance fields get rendered at 4x unless smooth_amount asks for 2x
+    return (m_smoothAmount == AZ::FontSmoothAmount::x2) ? 2 : 4;
+}
+
+//-------------------------------------------------------------------------------------------------
 int AZ::GlyphCache::UnCacheGlyph(uint32_t character, const AtomFont::GlyphSize& glyphSize)
 {
     CacheTable::iterator pItor = m_cacheTable.find(GetCacheSlotKey(character, glyphSize));
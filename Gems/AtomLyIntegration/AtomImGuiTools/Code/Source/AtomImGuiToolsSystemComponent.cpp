@@ -11,6 +11,7 @@
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/EditContextConstants.inl>
 #include <Atom/RPI.Public/Pass/PassSystemInterface.h>
+#include <AzCore/Interface/Interface.h>
 #include <AzFramework/Components/ConsoleBus.h>
 
 namespace AtomImGuiTools
@@ -103,6 +104,13 @@ namespace AtomImGuiTools
         {
             m_imguiShaderMetrics.Draw(m_showShaderMetrics, AZ::RPI::ShaderMetricsSystemInterface::Get()->GetMetrics());
         }
+        if (m_showMemoryBudgets)
+        {
+            if (auto* memoryBudgetTracker = AZ::Interface<AZ::MemoryBudgetTracker>::Get())
+            {
+                m_imguiMemoryBudgets.Draw(m_showMemoryBudgets, *memoryBudgetTracker);
+            }
+        }
     }
 
     void AtomImGuiToolsSystemComponent::OnImGuiMainMenuUpdate()
@@ -123,6 +131,7 @@ namespace AtomImGuiTools
                     AZ::RHI::FrameSchedulerStatisticsFlags::GatherTransientAttachmentStatistics, m_showTransientAttachmentProfiler);
             }
             ImGui::MenuItem("Shader Metrics", "", &m_showShaderMetrics);
+            ImGui::MenuItem("Memory Budgets", "", &m_showMemoryBudgets);
             ImGui::EndMenu();
         }
     }
@@ -16,6 +16,7 @@
 #include <imgui/imgui.h>
 #include <Atom/Utils/ImGuiCpuProfiler.h>
 #include <Atom/Utils/ImGuiGpuProfiler.h>
+#include <Atom/Utils/ImGuiMemoryBudgets.h>
 #include <Atom/Utils/ImGuiPassTree.h>
 #include <Atom/Utils/ImGuiShaderMetrics.h>
 #include <Atom/Utils/ImGuiTransientAttachmentProfiler.h>
@@ -70,6 +71,9 @@ namespace AtomImGuiTools
 
         AZ::Render::ImGuiShaderMetrics m_imguiShaderMetrics;
         bool m_showShaderMetrics = false;
+
+        AZ::Render::ImGuiMemoryBudgets m_imguiMemoryBudgets;
+        bool m_showMemoryBudgets = false;
 #endif
     };
 
@@ -90,6 +90,12 @@ namespace AZ
                             "Enable Downsample",
                             "Enables depth downsampling before SSAO. Slightly lower quality but 2x as fast as regular SSAO.")
 
+                        ->DataElement(Edit::UIHandlers::CheckBox,
+                            &SsaoComponentConfig::m_enableQuarterResolution,
+                            "Quarter Resolution",
+                            "Downsamples the depth a second time so SSAO runs at quarter resolution, with two depth aware upsamples. "
+                            "Softer occlusion but a fraction of the cost at high resolutions. Only used when downsampling is enabled.")
+
 
                         // Overrides
                         ->ClassElement(AZ::Edit::ClassElements::Group, "Overrides")
@@ -587,6 +587,12 @@ namespace Audio
                     eResult = m_oFileCacheMgr.TryLoadRequest(pRequestData->nPreloadRequest, ((rRequest.nFlags & eARF_EXECUTE_BLOCKING) != 0), pRequestData->bAutoLoadOnly);
                     break;
                 }
+                case eAMRT_PRELOAD_HINT:
+                {
+                    auto const pRequestData = static_cast<const SAudioManagerRequestDataInternal<eAMRT_PRELOAD_HINT>*>(rRequest.pData.get());
+                    eResult = m_oFileCacheMgr.TryPreloadHint(pRequestData->nPreloadRequest, pRequestData->fDeadlineMS);
+                    break;
+                }
                 case eAMRT_UNLOAD_SINGLE_REQUEST:
                 {
                     auto const pRequestData = static_cast<const SAudioManagerRequestDataInternal<eAMRT_UNLOAD_SINGLE_REQUEST>*>(rRequest.pData.get());
@@ -825,6 +831,15 @@ namespace Audio
 
                             auto const pPositionedObject = static_cast<CATLAudioObject*>(pObject);
 
+                            if (pPositionedObject->IsVirtual())
+                            {
+                                // Only track the position, the middleware gets it once the object becomes real again.
+                                pPositionedObject->SetPosition(pRequestData->oPosition);
+                                pPositionedObject->SetPositionPending();
+                                eResult = eARS_SUCCESS;
+                                break;
+                            }
+
                             AudioSystemImplementationRequestBus::BroadcastResult(eResult, &AudioSystemImplementationRequestBus::Events::SetPosition,
                                 pPositionedObject->GetImplDataPtr(),
                                 pRequestData->oPosition);
@@ -1261,6 +1276,10 @@ namespace Audio
             // If the AudioObject uses Obstruction/Occlusion then set the values before activating the trigger.
             auto const pPositionedAudioObject = static_cast<CATLAudioObject*>(pAudioObject);
 
+            // Make sure the middleware has the current position before anything starts playing on it,
+            // the object manager will virtualize it again on its next update if it's still irrelevant.
+            pPositionedAudioObject->SetVirtual(false);
+
             if (pPositionedAudioObject->CanRunRaycasts() && !pPositionedAudioObject->HasActiveEvents())
             {
                 pPositionedAudioObject->RunRaycasts(m_oSharedData.m_oActiveListenerPosition);
@@ -18,6 +18,7 @@
 #include <MathConversion.h>
 
 #include <AudioInternalInterfaces.h>
+#include <IAudioSystemImplementation.h>
 #include <SoundCVars.h>
 #include <ATLUtils.h>
 
@@ -343,6 +344,7 @@ namespace Audio
         CATLAudioObjectBase::Clear();
         m_oPosition = SATLWorldPosition();
         m_raycastProcessor.Reset();
+        m_nFlags &= ~(eAOF_VIRTUAL | eAOF_PENDING_POSITION);
     }
 
     ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -399,6 +401,24 @@ namespace Audio
     }
 
 
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    void CATLAudioObject::SetVirtual(const bool bVirtual)
+    {
+        if (bVirtual)
+        {
+            m_nFlags |= eAOF_VIRTUAL;
+        }
+        else if (IsVirtual())
+        {
+            if ((m_nFlags & eAOF_PENDING_POSITION) != 0)
+            {
+                AudioSystemImplementationRequestBus::Broadcast(&AudioSystemImplementationRequestBus::Events::SetPosition, m_pImplData, m_oPosition);
+            }
+
+            m_nFlags &= ~(eAOF_VIRTUAL | eAOF_PENDING_POSITION);
+        }
+    }
+
     ///////////////////////////////////////////////////////////////////////////////////////////////////
     void CATLAudioObject::SetRaycastCalcType(const EAudioObjectObstructionCalcType calcType)
     {
@@ -400,6 +400,23 @@ namespace Audio
         }
         void UpdateVelocity(const float fUpdateIntervalMS);
 
+        // Virtual objects keep tracking their position in the ATL but don't send updates to the middleware,
+        // the last known position is sent when they become real again.
+        void SetVirtual(const bool bVirtual);
+        bool IsVirtual() const
+        {
+            return (m_nFlags & eAOF_VIRTUAL) != 0;
+        }
+        void SetPositionPending()
+        {
+            m_nFlags |= eAOF_PENDING_POSITION;
+        }
+
+        const SATLWorldPosition& GetPosition() const
+        {
+            return m_oPosition;
+        }
+
     private:
         TATLEnumFlagsType m_nFlags;
         float m_fPreviousVelocity;
@@ -411,10 +428,6 @@ namespace Audio
 #if !defined(AUDIO_RELEASE)
     public:
         void DrawDebugInfo(IRenderAuxGeom& auxGeom, const AZ::Vector3& vListenerPos, const CATLDebugNameStore* const pDebugNameStore) const;
-        const SATLWorldPosition& GetPosition() const
-        {
-            return m_oPosition;
-        }
 #endif // !AUDIO_RELEASE
     };
 
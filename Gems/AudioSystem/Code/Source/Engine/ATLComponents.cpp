@@ -10,6 +10,8 @@
 
 #include <AzCore/IO/FileIO.h>
 #include <AzCore/std/functional.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/sort.h>
 #include <AzCore/std/string/string_view.h>
 #include <AzCore/StringFunc/StringFunc.h>
 
@@ -311,11 +313,13 @@ namespace Audio
 
         m_raycastManager.ProcessRaycastResults(fUpdateIntervalMS);
 
+        UpdateVirtualization(rListenerPosition);
+
         for (auto& audioObjectPair : m_cAudioObjects)
         {
             CATLAudioObject* const pObject = audioObjectPair.second;
 
-            if (pObject->HasActiveEvents())
+            if (pObject->HasActiveEvents() && !pObject->IsVirtual())
             {
                 AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::Audio, "Inner Per-Object CAudioObjectManager::Update");
 
@@ -347,6 +351,53 @@ namespace Audio
         }
     }
 
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    void CAudioObjectManager::UpdateVirtualization(const SATLWorldPosition& rListenerPosition)
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Audio);
+
+        const float virtualizationDistance = Audio::CVars::s_VirtualizationDistance;
+        const size_t voiceBudget = static_cast<size_t>(static_cast<AZ::u32>(Audio::CVars::s_AudioObjectVoiceBudget));
+        const float maxDistanceSq = (virtualizationDistance > 0.f) ? (virtualizationDistance * virtualizationDistance) : AZStd::numeric_limits<float>::max();
+        const AZ::Vector3 listenerPosition(rListenerPosition.GetPositionVec());
+
+        m_voiceCandidates.clear();
+
+        for (auto& audioObjectPair : m_cAudioObjects)
+        {
+            CATLAudioObject* const pObject = audioObjectPair.second;
+            const float distanceSq = listenerPosition.GetDistanceSq(pObject->GetPosition().GetPositionVec());
+
+            if (distanceSq > maxDistanceSq)
+            {
+                pObject->SetVirtual(true);
+            }
+            else if (voiceBudget > 0 && pObject->HasActiveEvents())
+            {
+                m_voiceCandidates.emplace_back(distanceSq, pObject);
+            }
+            else
+            {
+                pObject->SetVirtual(false);
+            }
+        }
+
+        // Only the nearest playing objects within the budget stay real.
+        if (m_voiceCandidates.size() > voiceBudget)
+        {
+            AZStd::partial_sort(m_voiceCandidates.begin(), m_voiceCandidates.begin() + voiceBudget, m_voiceCandidates.end(),
+                [](const AZStd::pair<float, CATLAudioObject*>& lhs, const AZStd::pair<float, CATLAudioObject*>& rhs)
+                {
+                    return lhs.first < rhs.first;
+                });
+        }
+
+        for (size_t i = 0; i < m_voiceCandidates.size(); ++i)
+        {
+            m_voiceCandidates[i].second->SetVirtual(i >= voiceBudget);
+        }
+    }
+
     ///////////////////////////////////////////////////////////////////////////////////////////////////
     bool CAudioObjectManager::ReserveID(TAudioObjectID& rAudioObjectID)
     {
@@ -1879,6 +1930,22 @@ namespace Audio
         return nNumActiveAudioObjects;
     }
 
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    size_t CAudioObjectManager::GetNumVirtualAudioObjects() const
+    {
+        size_t numVirtualAudioObjects = 0;
+
+        for (auto& audioObjectPair : m_cAudioObjects)
+        {
+            if (audioObjectPair.second->IsVirtual())
+            {
+                ++numVirtualAudioObjects;
+            }
+        }
+
+        return numVirtualAudioObjects;
+    }
+
     ///////////////////////////////////////////////////////////////////////////////////////////////////
     void CAudioObjectManager::DrawPerObjectDebugInfo(IRenderAuxGeom& rAuxGeom, const AZ::Vector3& rListenerPos) const
     {
@@ -1912,6 +1979,7 @@ namespace Audio
         static const float fOverloadColor[4] = { 1.0f, 0.3f, 0.3f, 0.9f };
 
         size_t activeObjects = 0;
+        size_t virtualObjects = 0;
         size_t aliveObjects = m_cAudioObjects.size();
         size_t remainingObjects = (m_cObjectPool.m_nReserveSize > aliveObjects ? m_cObjectPool.m_nReserveSize - aliveObjects : 0);
         const float fHeaderPosY = fPosY;
@@ -1958,9 +2026,14 @@ namespace Audio
             {
                 ++activeObjects;
             }
+
+            if (audioObject->IsVirtual())
+            {
+                ++virtualObjects;
+            }
         }
 
-        static const char* headerFormat = "Audio Objects [Active : %3zu | Alive: %3zu | Pool: %3zu | Remaining: %3zu]";
+        static const char* headerFormat = "Audio Objects [Active : %3zu | Virtual: %3zu | Alive: %3zu | Pool: %3zu | Remaining: %3zu]";
         const bool overloaded = (m_cAudioObjects.size() > m_cObjectPool.m_nReserveSize);
 
         rAuxGeom.Draw2dLabel(
@@ -1971,6 +2044,7 @@ namespace Audio
             false,
             headerFormat,
             activeObjects,
+            virtualObjects,
             aliveObjects,
             m_cObjectPool.m_nReserveSize,
             remainingObjects);
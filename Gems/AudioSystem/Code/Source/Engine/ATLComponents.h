@@ -137,6 +137,7 @@ namespace Audio
         void SetDebugNameStore(CATLDebugNameStore* const pDebugNameStore);
         size_t GetNumAudioObjects() const;
         size_t GetNumActiveAudioObjects() const;
+        size_t GetNumVirtualAudioObjects() const;
         const TActiveObjectMap& GetActiveAudioObjects() const
         {
             return m_cAudioObjects;
@@ -155,7 +156,10 @@ namespace Audio
         CATLAudioObject* GetInstance();
         bool ReleaseInstance(CATLAudioObject* const pOldObject);
 
+        void UpdateVirtualization(const SATLWorldPosition& rListenerPosition);
+
         TActiveObjectMap m_cAudioObjects;
+        AZStd::vector<AZStd::pair<float, CATLAudioObject*>> m_voiceCandidates;
         CInstanceManager<CATLAudioObject, TAudioObjectID> m_cObjectPool;
         float m_fTimeSinceLastVelocityUpdateMS;
 
@@ -50,6 +50,8 @@ namespace Audio
     {
         eAOF_NONE = 0,
         eAOF_TRACK_VELOCITY = AUDIO_BIT(0),
+        eAOF_VIRTUAL = AUDIO_BIT(1),            // the object is out of range or over the voice budget, middleware updates are skipped
+        eAOF_PENDING_POSITION = AUDIO_BIT(2),   // the position changed while virtual and still needs to be sent to the middleware
     };
 
     ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -404,6 +406,9 @@ namespace Audio
 
         IATLAudioFileEntryData* m_implData;
 
+        // When the file was last loaded, hinted or released, removable files are evicted least recently used first.
+        AZStd::chrono::system_clock::time_point m_timeLastUsed;
+
 #if !defined(AUDIO_RELEASE)
         AZStd::chrono::system_clock::time_point m_timeCached;
 #endif // !AUDIO_RELEASE
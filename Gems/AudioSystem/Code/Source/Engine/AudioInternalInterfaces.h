@@ -359,6 +359,23 @@ namespace Audio
         PanningMode m_panningMode;
     };
 
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    template<>
+    struct SAudioManagerRequestDataInternal<eAMRT_PRELOAD_HINT>
+        : public SAudioManagerRequestDataInternalBase
+    {
+        SAudioManagerRequestDataInternal(const SAudioManagerRequestData<eAMRT_PRELOAD_HINT>* const pAMRData)
+            : SAudioManagerRequestDataInternalBase(pAMRData->eType)
+            , nPreloadRequest(pAMRData->nPreloadRequestID)
+            , fDeadlineMS(pAMRData->fDeadlineMS)
+        {}
+
+        ~SAudioManagerRequestDataInternal<eAMRT_PRELOAD_HINT>() override {}
+
+        const TAudioPreloadRequestID nPreloadRequest;
+        const float fDeadlineMS;
+    };
+
     ///////////////////////////////////////////////////////////////////////////////////////////////////
     // Audio Callback Manager Requests (Internal)
     ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -795,6 +812,7 @@ namespace Audio
                 { eAMRT_DRAW_DEBUG_INFO, "DRAW DEBUG" },
                 { eAMRT_CHANGE_LANGUAGE, "CHANGE LANGUAGE" },
                 { eAMRT_SET_AUDIO_PANNING_MODE, "SET PANNING MODE" },
+                { eAMRT_PRELOAD_HINT, "PRELOAD HINT" },
             };
             static const AZStd::unordered_map<const EAudioCallbackManagerRequestType, const AZStd::string> callbackRequests
             {
@@ -102,6 +102,14 @@ namespace Audio
         AZ_Assert(0 == (request.nFlags & eARF_THREAD_SAFE_PUSH), "AudioSystem::PushRequest - called with flag THREAD_SAFE_PUSH!");
         AZ_Assert(0 == (request.nFlags & eARF_EXECUTE_BLOCKING), "AudioSystem::PushRequest - called with flag EXECUTE_BLOCKING!");
 
+        if (TryCoalesceRequest(request))
+        {
+            return;
+        }
+
+        // Anything that isn't coalesced must be processed after the updates that were pushed before it.
+        FlushCoalescedRequests();
+
         AudioSystemInternalRequestBus::QueueBroadcast(&AudioSystemInternalRequestBus::Events::ProcessRequestByPriority, request);
     }
 
@@ -168,6 +176,9 @@ namespace Audio
         // Main Thread!
         AZ_Assert(gEnv->mMainThreadId == CryGetCurrentThreadId(), "AudioSystem::ExternalUpdate - called from non-Main thread!");
 
+        // Send this frame's position and Rtpc updates over to the audio thread...
+        FlushCoalescedRequests();
+
         // Notify callbacks on the pending callbacks queue...
         // These are requests that were completed then queued for callback processing to happen here.
         ExecuteRequestCompletionCallbacks(m_pendingCallbacksQueue, m_pendingCallbacksMutex);
@@ -279,6 +290,9 @@ namespace Audio
         m_apAudioProxies.clear();
         m_apAudioProxiesToBeFreed.clear();
 
+        m_coalescedRequests.clear();
+        m_coalescedRequestIndices.clear();
+
         // Release the audio implementation...
         SAudioRequest request;
         SAudioManagerRequestData<eAMRT_RELEASE_AUDIO_IMPL> requestData;
@@ -657,6 +671,72 @@ namespace Audio
         }
     }
 
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    void CAudioSystem::ProcessRequestBatch(TAudioRequestBatch requestBatch)
+    {
+        AZ_PROFILE_SCOPE_DYNAMIC(AZ::Debug::ProfileCategory::Audio, "Batched Requests: %zu", requestBatch.size());
+
+        for (CAudioRequestInternal& request : requestBatch)
+        {
+            ProcessRequestByPriority(request);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    bool CAudioSystem::TryCoalesceRequest(const CAudioRequestInternal& request)
+    {
+        // Main Thread!
+        // Only plain updates can be merged, requests that want callbacks need every instance to be processed.
+        if (!Audio::CVars::s_CoalesceObjectUpdates || request.nFlags != eARF_PRIORITY_NORMAL
+            || request.nAudioObjectID == INVALID_AUDIO_OBJECT_ID || !request.pData
+            || request.pData->eRequestType != eART_AUDIO_OBJECT_REQUEST)
+        {
+            return false;
+        }
+
+        TAudioControlID controlID = INVALID_AUDIO_CONTROL_ID;
+        auto const objectRequestData = static_cast<const SAudioObjectRequestDataInternalBase*>(request.pData.get());
+        if (objectRequestData->eType == eAORT_SET_RTPC_VALUE)
+        {
+            controlID = static_cast<const SAudioObjectRequestDataInternal<eAORT_SET_RTPC_VALUE>*>(objectRequestData)->nControlID;
+        }
+        else if (objectRequestData->eType != eAORT_SET_POSITION)
+        {
+            return false;
+        }
+
+        const TCoalescedRequestKey key(request.nAudioObjectID, controlID);
+        auto iter = m_coalescedRequestIndices.find(key);
+        if (iter != m_coalescedRequestIndices.end())
+        {
+            // a newer value replaces the one that hasn't been sent yet
+            m_coalescedRequests[iter->second] = request;
+        }
+        else
+        {
+            m_coalescedRequestIndices.emplace(key, m_coalescedRequests.size());
+            m_coalescedRequests.push_back(request);
+        }
+
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    void CAudioSystem::FlushCoalescedRequests()
+    {
+        // Main Thread!
+        if (m_coalescedRequests.empty())
+        {
+            return;
+        }
+
+        TAudioRequestBatch requestBatch;
+        requestBatch.swap(m_coalescedRequests);
+        m_coalescedRequestIndices.clear();
+
+        AudioSystemInternalRequestBus::QueueBroadcast(&AudioSystemInternalRequestBus::Events::ProcessRequestBatch, AZStd::move(requestBatch));
+    }
+
     ///////////////////////////////////////////////////////////////////////////////////////////////////
     bool CAudioSystem::ProcessRequests(TAudioRequests& requestQueue)
     {
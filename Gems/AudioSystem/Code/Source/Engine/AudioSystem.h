@@ -13,6 +13,7 @@
 #include <AudioInternalInterfaces.h>
 
 #include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/containers/vector.h>
 
 #include <AzCore/std/parallel/binary_semaphore.h>
@@ -47,6 +48,8 @@ namespace Audio
     };
 
 
+    using TAudioRequestBatch = AZStd::vector<CAudioRequestInternal, Audio::AudioSystemStdAllocator>;
+
     ///////////////////////////////////////////////////////////////////////////////////////////////////
     class AudioSystemInternalRequests
         : public AZ::EBusTraits
@@ -63,6 +66,7 @@ namespace Audio
         ///////////////////////////////////////////////////////////////////////////////////////////////
 
         virtual void ProcessRequestByPriority(CAudioRequestInternal audioRequestData) = 0;
+        virtual void ProcessRequestBatch(TAudioRequestBatch audioRequestBatch) = 0;
     };
 
     using AudioSystemInternalRequestBus = AZ::EBus<AudioSystemInternalRequests>;
@@ -90,6 +94,7 @@ namespace Audio
         void PushRequestBlocking(const SAudioRequest& audioRequestData) override;
         void PushRequestThreadSafe(const SAudioRequest& audioRequestData) override;
         void ProcessRequestByPriority(CAudioRequestInternal audioRequestInternalData) override;
+        void ProcessRequestBatch(TAudioRequestBatch audioRequestBatch) override;
 
         void ExternalUpdate() override;
 
@@ -136,6 +141,9 @@ namespace Audio
         void ExecuteRequestCompletionCallbacks(TAudioRequests& requestQueue, AZStd::mutex& requestQueueMutex, bool bTryLock = false);
         void ExtractCompletedRequests(TAudioRequests& rRequestQueue, TAudioRequests& rSyncCallbacksQueue);
 
+        bool TryCoalesceRequest(const CAudioRequestInternal& request);
+        void FlushCoalescedRequests();
+
         bool m_bSystemInitialized;
 
         using duration_ms = AZStd::chrono::duration<float, AZStd::milli>;
@@ -153,6 +161,11 @@ namespace Audio
         AZStd::mutex m_threadSafeCallbacksMutex;
         AZStd::mutex m_pendingCallbacksMutex;
 
+        // Position and Rtpc updates pushed from the main thread are merged per audio object (and Rtpc) and sent to the
+        // audio thread as one batch, only the last value pushed in a frame gets processed.
+        using TCoalescedRequestKey = AZStd::pair<TAudioObjectID, TAudioControlID>;
+        TAudioRequestBatch m_coalescedRequests;
+        AZStd::unordered_map<TCoalescedRequestKey, size_t> m_coalescedRequestIndices;
 
         // Synchronization objects
         AZStd::binary_semaphore m_mainEvent;
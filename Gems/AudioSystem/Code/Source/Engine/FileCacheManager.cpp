@@ -12,6 +12,7 @@
 #include <AzCore/IO/Path/Path.h>
 #include <AzCore/std/string/conversions.h>
 #include <AzCore/std/parallel/binary_semaphore.h>
+#include <AzCore/std/sort.h>
 #include <AzCore/StringFunc/StringFunc.h>
 #include <AzFramework/Archive/IArchive.h>
 
@@ -219,6 +220,12 @@ namespace Audio
                     auto itFileEntry = m_audioFileEntries.find(fileId);
                     if (itFileEntry != m_audioFileEntries.end())
                     {
+                        // The file might still be streaming in from a preload hint, it's needed now.
+                        if (!loadSynchronously && itFileEntry->second->m_flags.AreAnyFlagsActive(eAFF_LOADING))
+                        {
+                            RescheduleFileCacheEntryInternal(itFileEntry->second, AZ::IO::IStreamerTypes::s_deadlineNow);
+                        }
+
                         const bool tempResult = TryCacheFileCacheEntryInternal(itFileEntry->second, fileId, loadSynchronously);
                         fullSuccess = (fullSuccess && tempResult);
                         fullFailure = (fullFailure && !tempResult);
@@ -236,6 +243,39 @@ namespace Audio
         return (fullSuccess ? eARS_SUCCESS : (fullFailure ? eARS_FAILURE : eARS_PARTIAL_SUCCESS));
     }
 
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    EAudioRequestStatus CFileCacheManager::TryPreloadHint(const TAudioPreloadRequestID preloadRequestID, const float deadlineMS)
+    {
+        auto itPreload = m_preloadRequests.find(preloadRequestID);
+        if (itPreload == m_preloadRequests.end())
+        {
+            return eARS_FAILURE;
+        }
+
+        const AZStd::chrono::microseconds deadline(static_cast<AZ::s64>(AZ::GetMax(deadlineMS, 0.0f) * 1000.0f));
+        bool fullSuccess = true;
+
+        for (auto fileId : itPreload->second->m_cFileEntryIDs)
+        {
+            auto itFileEntry = m_audioFileEntries.find(fileId);
+            if (itFileEntry != m_audioFileEntries.end())
+            {
+                CATLAudioFileEntry* const audioFileEntry = itFileEntry->second;
+
+                if (audioFileEntry->m_flags.AreAnyFlagsActive(eAFF_LOADING))
+                {
+                    RescheduleFileCacheEntryInternal(audioFileEntry, deadline);
+                }
+
+                // Keep the use count as it is, a hinted file stays removable until its preload request gets loaded.
+                const bool tempResult = TryCacheFileCacheEntryInternal(audioFileEntry, fileId, false, true, audioFileEntry->m_useCount, deadline);
+                fullSuccess = (fullSuccess && tempResult);
+            }
+        }
+
+        return (fullSuccess ? eARS_SUCCESS : eARS_PARTIAL_SUCCESS);
+    }
+
     ///////////////////////////////////////////////////////////////////////////////////////////////
     EAudioRequestStatus CFileCacheManager::TryUnloadRequest(const TAudioPreloadRequestID preloadRequestID)
     {
@@ -254,7 +294,9 @@ namespace Audio
                     auto itFileEntry = m_audioFileEntries.find(fileId);
                     if (itFileEntry != m_audioFileEntries.end())
                     {
-                        const bool tempResult = UncacheFileCacheEntryInternal(itFileEntry->second, true);
+                        // Retained files stay resident as removable, they get evicted when their memory is needed.
+                        const bool retain = Audio::CVars::s_FileCacheRetainUnloadedFiles && itFileEntry->second->m_flags.AreAnyFlagsActive(eAFF_USE_COUNTED);
+                        const bool tempResult = UncacheFileCacheEntryInternal(itFileEntry->second, !retain);
                         fullSuccess = (fullSuccess && tempResult);
                         fullFailure = (fullFailure && !tempResult);
                     }
@@ -304,6 +346,8 @@ namespace Audio
             --audioFileEntry->m_useCount;
         }
 
+        audioFileEntry->m_timeLastUsed = AZStd::chrono::system_clock::now();
+
         if (audioFileEntry->m_useCount < 1 || ignoreUsedCount)
         {
             // Must be cached to proceed.
@@ -496,7 +540,7 @@ namespace Audio
             if (requestSize <= maxAvailableSize)
             {
                 // Here we need to cleanup first before allowing the new request to be allocated.
-                TryToUncacheFiles();
+                TryToUncacheFiles(requestSize);
 
                 // We should only indicate success if there's actually really enough room for the new entry!
                 success = (m_maxByteTotal - m_currentByteTotal) >= requestSize;
@@ -617,7 +661,8 @@ namespace Audio
                 auto iter = m_audioFileEntries.find(fileId);
                 if (iter != m_audioFileEntries.end())
                 {
-                    cached = iter->second->m_flags.AreAnyFlagsActive(eAFF_CACHED);
+                    // Removable files are only resident because they were retained or hinted, nothing holds them loaded.
+                    cached = iter->second->m_flags.AreAnyFlagsActive(eAFF_CACHED) && !iter->second->m_flags.AreAnyFlagsActive(eAFF_REMOVABLE);
                 }
                 allLoaded = (allLoaded && cached);
                 anyLoaded = (anyLoaded || cached);
@@ -732,16 +777,45 @@ namespace Audio
     }
 
     ///////////////////////////////////////////////////////////////////////////////////////////////
-    void CFileCacheManager::TryToUncacheFiles()
+    void CFileCacheManager::TryToUncacheFiles(const size_t requiredBytes)
     {
+        AZStd::vector<CATLAudioFileEntry*, Audio::AudioSystemStdAllocator> removableEntries;
+
         for (auto& audioFileEntryPair : m_audioFileEntries)
         {
             CATLAudioFileEntry* const audioFileEntry = audioFileEntryPair.second;
 
             if (audioFileEntry && audioFileEntry->m_flags.AreAllFlagsActive(eAFF_CACHED | eAFF_REMOVABLE))
             {
-                UncacheFileCacheEntryInternal(audioFileEntry, true);
+                removableEntries.push_back(audioFileEntry);
+            }
+        }
+
+        // Evict the least recently used files first, and only as many as needed to free the required amount of memory.
+        AZStd::sort(removableEntries.begin(), removableEntries.end(),
+            [](const CATLAudioFileEntry* lhs, const CATLAudioFileEntry* rhs)
+            {
+                return lhs->m_timeLastUsed < rhs->m_timeLastUsed;
+            });
+
+        for (CATLAudioFileEntry* const audioFileEntry : removableEntries)
+        {
+            if ((m_maxByteTotal - m_currentByteTotal) >= requiredBytes)
+            {
+                break;
             }
+
+            UncacheFileCacheEntryInternal(audioFileEntry, true);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    void CFileCacheManager::RescheduleFileCacheEntryInternal(CATLAudioFileEntry* const audioFileEntry, const AZStd::chrono::microseconds deadline)
+    {
+        if (audioFileEntry->m_asyncStreamRequest)
+        {
+            auto streamer = AZ::Interface<AZ::IO::IStreamer>::Get();
+            streamer->QueueRequest(streamer->RescheduleRequest(audioFileEntry->m_asyncStreamRequest, deadline, AZ::IO::IStreamerTypes::s_priorityHigh));
         }
     }
 
@@ -783,11 +857,13 @@ namespace Audio
         [[maybe_unused]] const TAudioFileEntryID fileEntryId,
         [[maybe_unused]] const bool loadSynchronously,
         const bool overrideUseCount /* = false */,
-        const size_t useCount /* = 0 */)
+        const size_t useCount /* = 0 */,
+        const AZStd::chrono::microseconds deadline /* = AZ::IO::IStreamerTypes::s_noDeadline */)
     {
         AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Audio);
 
         bool success = false;
+        audioFileEntry->m_timeLastUsed = AZStd::chrono::system_clock::now();
 
         if (!audioFileEntry->m_filePath.empty() && !audioFileEntry->m_flags.AreAnyFlagsActive(eAFF_CACHED | eAFF_LOADING))
         {
@@ -834,7 +910,7 @@ namespace Audio
                         audioFileEntry->m_memoryBlock,
                         audioFileEntry->m_fileSize,
                         audioFileEntry->m_fileSize,
-                        AZ::IO::IStreamerTypes::s_noDeadline,
+                        deadline,
                         AZ::IO::IStreamerTypes::s_priorityHigh);
 
                     streamer->SetRequestCompleteCallback(
@@ -10,6 +10,8 @@
 
 #include <AzCore/EBus/EBus.h>
 #include <AzCore/IO/GenericStreams.h>
+#include <AzCore/IO/IStreamerTypes.h>
+#include <AzCore/std/limits.h>
 #include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/XML/rapidxml.h>
@@ -63,6 +65,7 @@ namespace Audio
         void UpdateLocalizedFileCacheEntries();
 
         EAudioRequestStatus TryLoadRequest(const TAudioPreloadRequestID preloadRequestID, const bool loadSynchronously, const bool autoLoadOnly);
+        EAudioRequestStatus TryPreloadHint(const TAudioPreloadRequestID preloadRequestID, const float deadlineMS);
         EAudioRequestStatus TryUnloadRequest(const TAudioPreloadRequestID preloadRequestID);
         EAudioRequestStatus UnloadDataByScope(const EATLDataScope dataScope);
 
@@ -89,9 +92,11 @@ namespace Audio
 
         bool AllocateMemoryBlockInternal(CATLAudioFileEntry* const audioFileEntry);
         void UncacheFile(CATLAudioFileEntry* const audioFileEntry);
-        void TryToUncacheFiles();
+        void TryToUncacheFiles(const size_t requiredBytes = AZStd::numeric_limits<size_t>::max());
         void UpdateLocalizedFileEntryData(CATLAudioFileEntry* const audioFileEntry);
-        bool TryCacheFileCacheEntryInternal(CATLAudioFileEntry* const audioFileEntry, const TAudioFileEntryID fileID, const bool loadSynchronously, const bool overrideUseCount = false, const size_t useCount = 0);
+        bool TryCacheFileCacheEntryInternal(CATLAudioFileEntry* const audioFileEntry, const TAudioFileEntryID fileID, const bool loadSynchronously, const bool overrideUseCount = false, const size_t useCount = 0,
+            const AZStd::chrono::microseconds deadline = AZ::IO::IStreamerTypes::s_noDeadline);
+        void RescheduleFileCacheEntryInternal(CATLAudioFileEntry* const audioFileEntry, const AZStd::chrono::microseconds deadline);
 
         // Internal members
         TATLPreloadRequestLookup& m_preloadRequests;
@@ -128,6 +128,29 @@ namespace Audio::CVars
         "An audio object needs to move by this distance in order to issue a position update to the audio system.\n"
         "Usage: s_PositionUpdateThreshold=5.0\n");
 
+    AZ_CVAR(bool, s_CoalesceObjectUpdates, true,
+        nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Merges the position and Rtpc updates of each audio object pushed during a frame, only the last value is sent to the audio thread.\n"
+        "Usage: s_CoalesceObjectUpdates=false\n");
+
+    AZ_CVAR(float, s_VirtualizationDistance, 0.f,
+        nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Audio objects further than this distance from the listener become virtual, their position, obstruction and\n"
+        "middleware updates are skipped until they come back in range or start a trigger. 0 disables distance virtualization.\n"
+        "Usage: s_VirtualizationDistance=150.0\n");
+
+    AZ_CVAR(AZ::u32, s_AudioObjectVoiceBudget, 0,
+        nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Maximum number of playing audio objects that get updated in the middleware, the nearest ones to the listener are kept\n"
+        "and the rest become virtual. 0 means no budget.\n"
+        "Usage: s_AudioObjectVoiceBudget=64\n");
+
+    AZ_CVAR(bool, s_FileCacheRetainUnloadedFiles, true,
+        nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Keeps the files of unloaded preload requests in the file cache until their memory is needed, they are then evicted\n"
+        "least recently used first. Loading the preload request again while its files are still resident is instant.\n"
+        "Usage: s_FileCacheRetainUnloadedFiles=false\n");
+
     AZ_CVAR(float, s_VelocityTrackingThreshold, 0.1f,
         nullptr, AZ::ConsoleFunctorFlags::Null,
         "An audio object needs to have its velocity changed by this amount in order to issue an 'object_speed' Rtpc update to the audio system.\n"
@@ -28,6 +28,10 @@ namespace Audio::CVars
     AZ_CVAR_EXTERNED(float, s_RaycastSmoothFactor);
 
     AZ_CVAR_EXTERNED(float, s_PositionUpdateThreshold);
+    AZ_CVAR_EXTERNED(bool, s_CoalesceObjectUpdates);
+    AZ_CVAR_EXTERNED(float, s_VirtualizationDistance);
+    AZ_CVAR_EXTERNED(AZ::u32, s_AudioObjectVoiceBudget);
+    AZ_CVAR_EXTERNED(bool, s_FileCacheRetainUnloadedFiles);
     AZ_CVAR_EXTERNED(float, s_VelocityTrackingThreshold);
     AZ_CVAR_EXTERNED(AZ::u32, s_AudioProxiesInitType);
 
@@ -322,6 +322,40 @@ TEST_F(ATLAudioObjectTest, OnAudioRaycastResults_MultiRaycastHit_NonZeroOcclusio
     EXPECT_LE(data.fOcclusion, 1.f);
 }
 
+TEST_F(ATLAudioObjectTest, SetVirtual_PositionPendingWhileVirtual_PositionSentOnRevive)
+{
+    NiceMock<AudioSystemImplementationMock> implMock;
+    implMock.AudioSystemImplementationRequestBus::Handler::BusConnect();
+
+    CATLAudioObject audioObject(testAudioObjectId, nullptr);
+    audioObject.SetVirtual(true);
+    EXPECT_TRUE(audioObject.IsVirtual());
+
+    audioObject.SetPosition(SATLWorldPosition(AZ::Vector3(1.f, 2.f, 3.f)));
+    audioObject.SetPositionPending();
+
+    EXPECT_CALL(implMock, SetPosition(::testing::_, ::testing::_)).Times(1);
+    audioObject.SetVirtual(false);
+    EXPECT_FALSE(audioObject.IsVirtual());
+
+    implMock.AudioSystemImplementationRequestBus::Handler::BusDisconnect();
+}
+
+TEST_F(ATLAudioObjectTest, SetVirtual_NoPositionPending_NothingSentOnRevive)
+{
+    NiceMock<AudioSystemImplementationMock> implMock;
+    implMock.AudioSystemImplementationRequestBus::Handler::BusConnect();
+
+    CATLAudioObject audioObject(testAudioObjectId, nullptr);
+    audioObject.SetVirtual(true);
+
+    EXPECT_CALL(implMock, SetPosition(::testing::_, ::testing::_)).Times(0);
+    audioObject.SetVirtual(false);
+    EXPECT_FALSE(audioObject.IsVirtual());
+
+    implMock.AudioSystemImplementationRequestBus::Handler::BusDisconnect();
+}
+
 
 class AudioRaycastManager_Test
     : public AudioRaycastManager
@@ -58,7 +58,11 @@ namespace Blast
         // Add shapes for each of the visible chunks
         AddShapes(m_chunkIndices, m_family.GetPxAsset(), m_physicsMaterialId);
 
-        m_entity->Init();
+        // Entities recycled by the EntityProvider are already initialized
+        if (m_entity->GetState() == AZ::Entity::State::Constructed)
+        {
+            m_entity->Init();
+        }
         m_entity->Activate();
 
         auto transform = AZ::Transform::CreateFromQuaternionAndTranslation(
@@ -7,25 +7,99 @@
 #include "StdAfx.h"
 
 #include <Actor/EntityProvider.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/smart_ptr/weak_ptr.h>
 
 namespace Blast
 {
+    AZ_CVAR(AZ::u32, blast_entityPoolSize, 256, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Maximum number of deactivated chunk actor entities each Blast family keeps around for reuse.");
+
+    struct EntityProviderImpl::EntityPool
+    {
+        struct PooledEntity
+        {
+            AZStd::vector<AZ::Uuid> m_componentIds;
+            AZStd::unique_ptr<AZ::Entity> m_entity;
+        };
+
+        AZStd::unique_ptr<AZ::Entity> Acquire(const AZStd::vector<AZ::Uuid>& componentIds)
+        {
+            for (auto it = m_entities.begin(); it != m_entities.end(); ++it)
+            {
+                if (it->m_componentIds == componentIds)
+                {
+                    AZStd::unique_ptr<AZ::Entity> entity = AZStd::move(it->m_entity);
+                    m_entities.erase(it);
+                    return entity;
+                }
+            }
+            return nullptr;
+        }
+
+        void Release(AZ::Entity* entity, const AZStd::vector<AZ::Uuid>& componentIds)
+        {
+            if (m_entities.size() >= static_cast<AZ::u32>(blast_entityPoolSize))
+            {
+                delete entity;
+                return;
+            }
+
+            if (entity->GetState() == AZ::Entity::State::Active)
+            {
+                entity->Deactivate();
+            }
+            m_entities.push_back({componentIds, AZStd::unique_ptr<AZ::Entity>(entity)});
+        }
+
+        AZStd::vector<PooledEntity> m_entities;
+    };
+
     AZStd::shared_ptr<EntityProvider> EntityProvider::Create()
     {
         return AZStd::make_shared<EntityProviderImpl>();
     }
 
+    EntityProviderImpl::EntityProviderImpl()
+        : m_pool(AZStd::make_shared<EntityPool>())
+    {
+    }
+
     AZStd::shared_ptr<AZ::Entity> EntityProviderImpl::CreateEntity(const AZStd::vector<AZ::Uuid>& componentIds)
     {
-        auto entity = AZStd::make_shared<AZ::Entity>();
-        for (auto componentId : componentIds)
+        AZStd::unique_ptr<AZ::Entity> entity = m_pool->Acquire(componentIds);
+        if (!entity)
         {
-            if (!entity->CreateComponent(componentId))
+            entity = AZStd::make_unique<AZ::Entity>();
+            for (auto componentId : componentIds)
             {
-                return nullptr;
+                if (!entity->CreateComponent(componentId))
+                {
+                    return nullptr;
+                }
             }
         }
-        return entity;
+
+        AZStd::weak_ptr<EntityPool> pool = m_pool;
+        return AZStd::shared_ptr<AZ::Entity>(
+            entity.release(),
+            [pool, componentIds](AZ::Entity* releasedEntity)
+            {
+                if (auto entityPool = pool.lock())
+                {
+                    entityPool->Release(releasedEntity, componentIds);
+                }
+                else
+                {
+                    delete releasedEntity;
+                }
+            });
+    }
+
+    size_t EntityProviderImpl::GetPooledEntityCount() const
+    {
+        return m_pool->m_entities.size();
     }
 } // namespace Blast
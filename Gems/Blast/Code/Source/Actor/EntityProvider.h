@@ -26,11 +26,25 @@ namespace Blast
         virtual AZStd::shared_ptr<AZ::Entity> CreateEntity(const AZStd::vector<AZ::Uuid>& componentIds) = 0;
     };
 
+    //! Entity provider that recycles entities instead of deleting them.
+    //! When the last reference to a provided entity goes away the entity is deactivated and kept, up to
+    //! blast_entityPoolSize entities, so actors created by later fractures can reuse it with its components.
     class EntityProviderImpl : public EntityProvider
     {
     public:
+        EntityProviderImpl();
         ~EntityProviderImpl() = default;
 
         AZStd::shared_ptr<AZ::Entity> CreateEntity(const AZStd::vector<AZ::Uuid>& componentIds) override;
+
+        //! Returns the number of entities currently waiting in the pool.
+        size_t GetPooledEntityCount() const;
+
+    private:
+        struct EntityPool;
+
+        // Shared with the deleters of provided entities, so entities released after the provider is gone are
+        // simply deleted.
+        AZStd::shared_ptr<EntityPool> m_pool;
     };
 } // namespace Blast
@@ -32,6 +32,17 @@ namespace Blast
             m_materialMap, entityId, &AZ::Render::MaterialComponentRequests::GetMaterialOverrides);
     }
 
+    ActorRenderManager::~ActorRenderManager()
+    {
+        for (auto& meshHandle : m_chunkMeshHandles)
+        {
+            if (meshHandle.IsValid())
+            {
+                m_meshFeatureProcessor->ReleaseMesh(meshHandle);
+            }
+        }
+    }
+
     void ActorRenderManager::OnActorCreated(const BlastActor& actor)
     {
         AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Physics);
@@ -41,8 +52,15 @@ namespace Blast
         for (uint32_t chunkId : chunkIndices)
         {
             m_chunkActors[chunkId] = &actor;
-            m_chunkMeshHandles[chunkId] =
-                m_meshFeatureProcessor->AcquireMesh(AZ::Render::MeshHandleDescriptor{ m_meshData->GetMeshAsset(chunkId) }, m_materialMap);
+            if (m_chunkMeshHandles[chunkId].IsValid())
+            {
+                m_meshFeatureProcessor->SetVisible(m_chunkMeshHandles[chunkId], true);
+            }
+            else
+            {
+                m_chunkMeshHandles[chunkId] = m_meshFeatureProcessor->AcquireMesh(
+                    AZ::Render::MeshHandleDescriptor{ m_meshData->GetMeshAsset(chunkId) }, m_materialMap);
+            }
         }
     }
 
@@ -54,7 +72,7 @@ namespace Blast
 
         for (uint32_t chunkId : chunkIndices)
         {
-            m_meshFeatureProcessor->ReleaseMesh(m_chunkMeshHandles[chunkId]);
+            m_meshFeatureProcessor->SetVisible(m_chunkMeshHandles[chunkId], false);
             m_chunkActors[chunkId] = nullptr;
         }
     }
@@ -29,10 +29,15 @@ namespace Blast
             AZ::Render::MeshFeatureProcessorInterface* meshFeatureProcessor, BlastMeshData* meshData,
             AZ::EntityId entityId, uint32_t chunkCount, const AZ::Vector3& scale);
 
+        // Releases all chunk meshes that were acquired during the lifetime of the manager.
+        ~ActorRenderManager();
+
         // Callback that makes meshes corresponding to the actor visible and follows it's transform.
+        // Chunk meshes are acquired the first time their chunk becomes visible and reused afterwards.
         void OnActorCreated(const BlastActor& actor);
 
         // Callback that makes meshes corresponding to the actor invisible.
+        // The meshes are kept, as chunks of a destroyed actor usually reappear on the actors it splits into.
         void OnActorDestroyed(const BlastActor& actor);
 
         // Update positions of entities with render meshes corresponding to their right dynamic bodies.
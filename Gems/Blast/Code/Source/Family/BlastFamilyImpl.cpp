@@ -245,7 +245,6 @@ namespace Blast
         actorDesc.m_chunkIndices = m_actorFactory->CalculateVisibleChunks(*this, *actorDesc.m_tkActor);
         actorDesc.m_isStatic = m_actorFactory->CalculateIsStatic(*this, *actorDesc.m_tkActor, actorDesc.m_chunkIndices);
         actorDesc.m_isLeafChunk = m_actorFactory->CalculateIsLeafChunk(*actorDesc.m_tkActor, actorDesc.m_chunkIndices);
-        actorDesc.m_entity = m_entityProvider->CreateEntity(m_actorFactory->CalculateComponents(actorDesc.m_isStatic));
         actorDesc.m_parentCenterOfMass = transform.GetTranslation();
         actorDesc.m_parentLinearVelocity = AZ::Vector3::CreateZero();
         actorDesc.m_bodyConfiguration = configuration;
@@ -254,12 +253,15 @@ namespace Blast
         return actorDesc;
     }
 
-    void BlastFamilyImpl::CreateActors(const AZStd::vector<BlastActorDesc>& actorDescs)
+    void BlastFamilyImpl::CreateActors(AZStd::vector<BlastActorDesc> actorDescs)
     {
         AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Physics);
 
         for (auto& actorDesc : actorDescs)
         {
+            // Entities are requested only now, after the split parents have been destroyed, so the entity provider
+            // can hand their entities straight back to the children.
+            actorDesc.m_entity = m_entityProvider->CreateEntity(m_actorFactory->CalculateComponents(actorDesc.m_isStatic));
             BlastActor* actor = m_actorFactory->CreateActor(actorDesc);
             m_actorTracker.AddActor(actor);
             DispatchActorCreated(*actor);
@@ -51,7 +51,7 @@ namespace Blast
         void receive(const Nv::Blast::TkEvent* events, uint32_t eventCount) override;
 
     private:
-        void CreateActors(const AZStd::vector<BlastActorDesc>& tkActors);
+        void CreateActors(AZStd::vector<BlastActorDesc> actorDescs);
         void DestroyActors(const AZStd::unordered_set<BlastActor*>& actors);
 
         void DispatchActorCreated(const BlastActor& actor);
@@ -116,9 +116,10 @@ namespace Blast
 
         // ActorRenderManager::OnActorDestroyed
         {
-            EXPECT_CALL(*m_mockMeshFeatureProcessor, ReleaseMesh(_))
-                .Times(aznumeric_cast<int>(m_actorFactory->m_mockActors[0]->GetChunkIndices().size()))
-                .WillRepeatedly(Return(true));
+            // Meshes are hidden and kept for reuse rather than released
+            EXPECT_CALL(*m_mockMeshFeatureProcessor, SetVisible(_, false))
+                .Times(aznumeric_cast<int>(m_actorFactory->m_mockActors[0]->GetChunkIndices().size()));
+            EXPECT_CALL(*m_mockMeshFeatureProcessor, ReleaseMesh(_)).Times(0);
 
             actorRenderManager->OnActorDestroyed(*m_actorFactory->m_mockActors[0]);
             for (auto chunkId : m_actorFactory->m_mockActors[0]->m_chunkIndices)
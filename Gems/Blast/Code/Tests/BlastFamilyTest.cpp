@@ -170,4 +170,21 @@ namespace Blast
             blastFamily.reset();
         }
     }
+
+    TEST_F(BlastFamilyTest, EntityProvider_ReleasedEntity_IsReusedForMatchingComponents)
+    {
+        EntityProviderImpl entityProvider;
+
+        AZStd::shared_ptr<AZ::Entity> entity = entityProvider.CreateEntity({});
+        ASSERT_TRUE(entity);
+        const AZ::EntityId entityId = entity->GetId();
+
+        entity.reset();
+        EXPECT_EQ(entityProvider.GetPooledEntityCount(), 1u);
+
+        entity = entityProvider.CreateEntity({});
+        ASSERT_TRUE(entity);
+        EXPECT_EQ(entity->GetId(), entityId);
+        EXPECT_EQ(entityProvider.GetPooledEntityCount(), 0u);
+    }
 } // namespace Blast
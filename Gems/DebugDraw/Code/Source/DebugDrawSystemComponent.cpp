@@ -27,6 +27,8 @@
 #include <AzToolsFramework/Entity/EditorEntityContextComponent.h>
 #endif // DEBUGDRAW_GEM_EDITOR
 
+#include <Atom/RPI.Public/AuxGeom/AuxGeomDraw.h>
+#include <Atom/RPI.Public/AuxGeom/AuxGeomFeatureProcessorInterface.h>
 #include <Atom/RPI.Public/RPISystemInterface.h>
 #include <Atom/RPI.Public/Scene.h>
 
@@ -269,17 +271,46 @@ namespace DebugDraw
         AzFramework::DebugDisplayRequests* debugDisplay =
             AzFramework::DebugDisplayRequestBus::FindFirstHandler(debugDisplayBus);
 
+        // Shapes go straight to the aux geom queue of the scene, lines are submitted in a single batch
+        // and the fixed shapes are instanced by aux geom, only text goes through the debug display
+        AZ::RPI::AuxGeomDrawPtr auxGeom;
+        if (const AZ::RPI::SceneId* sceneId = AZ::RPI::SceneNotificationBus::GetCurrentBusId())
+        {
+            auxGeom = AZ::RPI::AuxGeomFeatureProcessorInterface::GetDrawQueueForScene(
+                AZ::RPI::RPISystemInterface::Get()->GetScene(*sceneId));
+        }
+
+        if (auxGeom)
+        {
+            OnTickAabbs(*auxGeom);
+            OnTickLines(*auxGeom);
+            OnTickObbs(*auxGeom);
+            OnTickRays(*auxGeom);
+            OnTickSpheres(*auxGeom);
+        }
+
         if (debugDisplay)
         {
-            OnTickAabbs(*debugDisplay);
-            OnTickLines(*debugDisplay);
-            OnTickObbs(*debugDisplay);
-            OnTickRays(*debugDisplay);
-            OnTickSpheres(*debugDisplay);
             OnTickText(*debugDisplay);
         }
     }
 
+    void DebugDrawSystemComponent::DrawLineBatch(AZ::RPI::AuxGeomDraw& auxGeom, AZ::u8 lineWidth)
+    {
+        if (m_batchPoints.empty())
+        {
+            return;
+        }
+
+        AZ::RPI::AuxGeomDraw::AuxGeomDynamicDrawArguments drawArgs;
+        drawArgs.m_verts = m_batchPoints.data();
+        drawArgs.m_vertCount = aznumeric_cast<uint32_t>(m_batchPoints.size());
+        drawArgs.m_colors = m_batchColors.data();
+        drawArgs.m_colorCount = aznumeric_cast<uint32_t>(m_batchColors.size());
+        drawArgs.m_size = lineWidth;
+        auxGeom.DrawLines(drawArgs);
+    }
+
     template <typename F>
     void DebugDrawSystemComponent::removeExpiredDebugElementsFromVector(AZStd::vector<F>& vectorToExpire)
     {
@@ -290,7 +321,7 @@ namespace DebugDraw
         vectorToExpire.erase(removalCondition, std::end(vectorToExpire));
     }
 
-    void DebugDrawSystemComponent::OnTickAabbs(AzFramework::DebugDisplayRequests& debugDisplay)
+    void DebugDrawSystemComponent::OnTickAabbs(AZ::RPI::AuxGeomDraw& auxGeom)
     {
         AZStd::lock_guard<AZStd::mutex> locker(m_activeAabbsMutex);
 
@@ -308,14 +339,13 @@ namespace DebugDraw
                 AZ::Vector3 currentCenter = transformedAabb.GetCenter();
                 transformedAabb.Set(transformedAabb.GetMin() - currentCenter + aabbElement.m_worldLocation, transformedAabb.GetMax() - currentCenter + aabbElement.m_worldLocation);
             }
-            debugDisplay.SetColor(aabbElement.m_color);
-            debugDisplay.DrawSolidBox(transformedAabb.GetMin(), transformedAabb.GetMax());
+            auxGeom.DrawAabb(transformedAabb, aabbElement.m_color, AZ::RPI::AuxGeomDraw::DrawStyle::Solid);
         }
 
         removeExpiredDebugElementsFromVector(m_activeAabbs);
     }
 
-    void DebugDrawSystemComponent::OnTickLines(AzFramework::DebugDisplayRequests& debugDisplay)
+    void DebugDrawSystemComponent::OnTickLines(AZ::RPI::AuxGeomDraw& auxGeom)
     {
         AZStd::lock_guard<AZStd::mutex> locker(m_activeLinesMutex);
         size_t numActiveLines = m_activeLines.size();
@@ -349,14 +379,18 @@ namespace DebugDraw
                     &AZ::TransformBus::Events::GetWorldTranslation);
             }
 
-            debugDisplay.SetColor(lineElement.m_color);
-            debugDisplay.DrawLine(lineElement.m_startWorldLocation, lineElement.m_endWorldLocation);
+            m_batchPoints.push_back(lineElement.m_startWorldLocation);
+            m_batchPoints.push_back(lineElement.m_endWorldLocation);
+            m_batchColors.push_back(lineElement.m_color);
+            m_batchColors.push_back(lineElement.m_color);
         }
 
+        DrawLineBatch(auxGeom, 1);
+
         removeExpiredDebugElementsFromVector(m_activeLines);
     }
 
-    void DebugDrawSystemComponent::OnTickObbs(AzFramework::DebugDisplayRequests& debugDisplay)
+    void DebugDrawSystemComponent::OnTickObbs(AZ::RPI::AuxGeomDraw& auxGeom)
     {
         AZStd::lock_guard<AZStd::mutex> locker(m_activeObbsMutex);
 
@@ -384,16 +418,23 @@ namespace DebugDraw
             {
                 obbElement.m_worldLocation = transformedObb.GetPosition();
             }
-            debugDisplay.SetColor(obbElement.m_color);
-            debugDisplay.DrawSolidOBB(obbElement.m_worldLocation, transformedObb.GetAxisX(), transformedObb.GetAxisY(), transformedObb.GetAxisZ(), transformedObb.GetHalfLengths());
+            transformedObb.SetPosition(obbElement.m_worldLocation);
+            auxGeom.DrawObb(transformedObb, AZ::Vector3::CreateZero(), obbElement.m_color, AZ::RPI::AuxGeomDraw::DrawStyle::Solid);
         }
 
         removeExpiredDebugElementsFromVector(m_activeObbs);
     }
 
-    void DebugDrawSystemComponent::OnTickRays(AzFramework::DebugDisplayRequests& debugDisplay)
+    void DebugDrawSystemComponent::OnTickRays(AZ::RPI::AuxGeomDraw& auxGeom)
     {
         AZStd::lock_guard<AZStd::mutex> locker(m_activeRaysMutex);
+        size_t numActiveRays = m_activeRays.size();
+
+        m_batchPoints.clear();
+        m_batchColors.clear();
+
+        m_batchPoints.reserve(numActiveRays * 2);
+        m_batchColors.reserve(numActiveRays * 2);
 
         // Draw ray elements and remove any that are expired
         for (auto& rayElement : m_activeRays)
@@ -415,16 +456,19 @@ namespace DebugDraw
             float coneHeight = rayElement.m_worldDirection.GetLength() * conePercentHeight;
             AZ::Vector3 coneBaseLocation = endWorldLocation - rayElement.m_worldDirection * conePercentHeight;
             float coneRadius = AZ::GetClamp(coneHeight * 0.07f, 0.05f, 0.2f);
-            debugDisplay.SetColor(rayElement.m_color);
-            debugDisplay.SetLineWidth(5.0f);
-            debugDisplay.DrawLine(rayElement.m_worldLocation, coneBaseLocation);
-            debugDisplay.DrawSolidCone(coneBaseLocation, rayElement.m_worldDirection, coneRadius, coneHeight, false);
+            m_batchPoints.push_back(rayElement.m_worldLocation);
+            m_batchPoints.push_back(coneBaseLocation);
+            m_batchColors.push_back(rayElement.m_color);
+            m_batchColors.push_back(rayElement.m_color);
+            auxGeom.DrawCone(coneBaseLocation, rayElement.m_worldDirection, coneRadius, coneHeight, rayElement.m_color, AZ::RPI::AuxGeomDraw::DrawStyle::Solid);
         }
 
+        DrawLineBatch(auxGeom, 5);
+
         removeExpiredDebugElementsFromVector(m_activeRays);
     }
 
-    void DebugDrawSystemComponent::OnTickSpheres(AzFramework::DebugDisplayRequests& debugDisplay)
+    void DebugDrawSystemComponent::OnTickSpheres(AZ::RPI::AuxGeomDraw& auxGeom)
     {
         AZStd::lock_guard<AZStd::mutex> locker(m_activeSpheresMutex);
 
@@ -436,8 +480,7 @@ namespace DebugDraw
             {
                 AZ::TransformBus::EventResult(sphereElement.m_worldLocation, sphereElement.m_targetEntityId, &AZ::TransformBus::Events::GetWorldTranslation);
             }
-            debugDisplay.SetColor(sphereElement.m_color);
-            debugDisplay.DrawBall(sphereElement.m_worldLocation, sphereElement.m_radius, true);
+            auxGeom.DrawSphere(sphereElement.m_worldLocation, sphereElement.m_radius, sphereElement.m_color, AZ::RPI::AuxGeomDraw::DrawStyle::Shaded);
         }
 
         removeExpiredDebugElementsFromVector(m_activeSpheres);
@@ -27,6 +27,7 @@
 #include <AzToolsFramework/Entity/EditorEntityContextBus.h>
 #endif // DEBUGDRAW_GEM_EDITOR
 
+#include <Atom/RPI.Public/AuxGeom/AuxGeomDraw.h>
 #include <Atom/RPI.Public/SceneBus.h>
 #include <Atom/Bootstrap/BootstrapNotificationBus.h>
 
@@ -122,13 +123,16 @@ namespace DebugDraw
         void OnEntityDeactivated(const AZ::EntityId& entityId) override;
 
         // Ticking functions for drawing debug elements
-        void OnTickAabbs(AzFramework::DebugDisplayRequests& debugDisplay);
-        void OnTickLines(AzFramework::DebugDisplayRequests& debugDisplay);
-        void OnTickObbs(AzFramework::DebugDisplayRequests& debugDisplay);
-        void OnTickRays(AzFramework::DebugDisplayRequests& debugDisplay);
-        void OnTickSpheres(AzFramework::DebugDisplayRequests& debugDisplay);
+        void OnTickAabbs(AZ::RPI::AuxGeomDraw& auxGeom);
+        void OnTickLines(AZ::RPI::AuxGeomDraw& auxGeom);
+        void OnTickObbs(AZ::RPI::AuxGeomDraw& auxGeom);
+        void OnTickRays(AZ::RPI::AuxGeomDraw& auxGeom);
+        void OnTickSpheres(AZ::RPI::AuxGeomDraw& auxGeom);
         void OnTickText(AzFramework::DebugDisplayRequests& debugDisplay);
 
+        // Submits the lines gathered in m_batchPoints and m_batchColors with a single aux geom draw
+        void DrawLineBatch(AZ::RPI::AuxGeomDraw& auxGeom, AZ::u8 lineWidth);
+
         // Element creation functions, used when DebugDraw components register themselves
         void CreateAabbEntryForComponent(const AZ::EntityId& componentEntityId, const DebugDrawAabbElement& element);
         void CreateLineEntryForComponent(const AZ::EntityId& componentEntityId, const DebugDrawLineElement& element);
@@ -307,6 +307,7 @@ namespace EMotionFX
                 return;
             }
 
+            InterpolateSampledPoses(sampleMotions);
             mTransformData->GetCurrentPose()->ApplyMorphWeightsToActorInstance();
             ApplyMorphSetup();
 
@@ -345,6 +346,7 @@ namespace EMotionFX
                 return;
             }
 
+            InterpolateSampledPoses(sampleMotions);
             mSelfAttachment->UpdateJointTransforms(*mTransformData->GetCurrentPose());
             mTransformData->GetCurrentPose()->ApplyMorphWeightsToActorInstance();
             ApplyMorphSetup();
@@ -1355,6 +1357,9 @@ namespace EMotionFX
             // Make sure the LOD level is valid and update it.
             mLODLevel = MCore::Clamp<uint32>(m_requestedLODLevel, 0, mActor->GetNumLODLevels() - 1);
 
+            // The joints enabled by the new LOD level have no valid transforms in the sampled poses yet.
+            m_hasSampledPoses = false;
+
             /*// update the transform data
                 MorphSetup* morphSetup = mActor->GetMorphSetup(mLODLevel);
                 if (morphSetup)
@@ -1936,6 +1941,67 @@ namespace EMotionFX
         return mMotionSamplingRate;
     }
 
+    void ActorInstance::SetMotionSamplingInterpolation(bool enabled)
+    {
+        m_motionSamplingInterpolation = enabled;
+        if (!enabled)
+        {
+            m_previousSampledPose.reset();
+            m_lastSampledPose.reset();
+            m_hasSampledPoses = false;
+        }
+    }
+
+    bool ActorInstance::GetMotionSamplingInterpolation() const
+    {
+        return m_motionSamplingInterpolation;
+    }
+
+    void ActorInstance::SetSharedMotionSamplingEnabled(bool enabled)
+    {
+        m_sharedMotionSampling = enabled;
+    }
+
+    bool ActorInstance::GetSharedMotionSamplingEnabled() const
+    {
+        return m_sharedMotionSampling;
+    }
+
+    void ActorInstance::InterpolateSampledPoses(bool sampleMotions)
+    {
+        // The ragdoll drives the pose itself, and without a sampling rate every update samples anyway.
+        if (!m_motionSamplingInterpolation || mMotionSamplingRate <= 0.0f || m_ragdollInstance || (!mAnimGraphInstance && !mMotionSystem))
+        {
+            m_hasSampledPoses = false;
+            return;
+        }
+
+        Pose* currentPose = mTransformData->GetCurrentPose();
+        if (sampleMotions)
+        {
+            if (!m_lastSampledPose)
+            {
+                m_previousSampledPose = AZStd::make_unique<Pose>();
+                m_previousSampledPose->LinkToActorInstance(this);
+                m_lastSampledPose = AZStd::make_unique<Pose>();
+                m_lastSampledPose->LinkToActorInstance(this);
+            }
+
+            m_previousSampledPose->InitFromPose(m_hasSampledPoses ? m_lastSampledPose.get() : currentPose);
+            m_lastSampledPose->InitFromPose(currentPose);
+            m_hasSampledPoses = true;
+        }
+        else if (!m_hasSampledPoses)
+        {
+            return;
+        }
+
+        // The sampling timer restarts at every sample, so it runs from zero to the sampling rate in between two samples.
+        const float weight = MCore::Clamp(mMotionSamplingTimer / mMotionSamplingRate, 0.0f, 1.0f);
+        currentPose->InitFromPose(m_previousSampledPose.get());
+        currentPose->Blend(m_lastSampledPose.get(), weight);
+    }
+
     void ActorInstance::IncreaseNumAttachmentRefs(uint8 numToIncreaseWith)
     {
         mNumAttachmentRefs += numToIncreaseWith;
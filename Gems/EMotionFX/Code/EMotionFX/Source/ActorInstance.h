@@ -36,6 +36,7 @@ namespace EMotionFX
     class Attachment;
     class AnimGraphInstance;
     class MorphSetupInstance;
+    class Pose;
     class RagdollInstance;
 
 
@@ -878,6 +879,24 @@ namespace EMotionFX
         float GetMotionSamplingTimer() const;
         float GetMotionSamplingRate() const;
 
+        /**
+         * Enable or disable interpolation between motion samples when a motion sampling rate is set.
+         * When enabled, the frames in between two samples blend from the previous towards the last sampled pose rather than holding
+         * the last sampled pose, which removes the stepping of animations updated at a low rate at the cost of one sample interval of latency.
+         * @param enabled True to interpolate between the sampled poses.
+         */
+        void SetMotionSamplingInterpolation(bool enabled);
+        bool GetMotionSamplingInterpolation() const;
+
+        /**
+         * Enable or disable reusing motion poses sampled by other instances of the same actor.
+         * This only has an effect when shared motion sampling is enabled in the actor manager, see ActorManager::SetSharedMotionSamplingEnabled().
+         * Disable it for characters close to the camera, or for instances with custom disabled joints.
+         * @param enabled True to allow sharing sampled poses, which is the default.
+         */
+        void SetSharedMotionSamplingEnabled(bool enabled);
+        bool GetSharedMotionSamplingEnabled() const;
+
         MCORE_INLINE uint32 GetNumNodes() const         { return mActor->GetSkeleton()->GetNumNodes(); }
 
         void UpdateVisualizeScale();                    // not automatically called on creation for performance reasons (this method relatively is slow as it updates all meshes)
@@ -913,6 +932,11 @@ namespace EMotionFX
         float                   mBoundsUpdatePassedTime;/**< The time passed since the last bounds update. */
         float                   mMotionSamplingRate;    /**< The motion sampling rate in seconds, where 0.1 would mean to update 10 times per second. A value of 0 or lower means to update every frame. */
         float                   mMotionSamplingTimer;   /**< The time passed since the last time we sampled motions/anim graphs. */
+        AZStd::unique_ptr<Pose> m_previousSampledPose;  /**< The pose sampled before the last one, used to interpolate between motion samples. */
+        AZStd::unique_ptr<Pose> m_lastSampledPose;      /**< The last sampled pose, which is the target of the interpolation. */
+        bool                    m_motionSamplingInterpolation = false; /**< Interpolate between motion samples when a motion sampling rate is set? */
+        bool                    m_hasSampledPoses = false; /**< Are the sampled poses valid for the current skeletal LOD level? */
+        bool                    m_sharedMotionSampling = true; /**< Reuse motion poses sampled by other instances when enabled in the actor manager? */
         float                   mVisualizeScale;        /**< Some visualization scale factor when rendering for example normals, to be at a nice size, relative to the character. */
         uint32                  mLODLevel;              /**< The current LOD level, where 0 is the highest detail. */
         uint32                  m_requestedLODLevel;    /**< Requested LOD level. The actual LOD level will be updated as soon as all transforms for the requested LOD level are ready. */
@@ -1032,5 +1056,12 @@ namespace EMotionFX
          * newly enabled joints (the ones that were not present and thus also not updated in the lower LOD level)will contain incorrect data.
          */
         void UpdateLODLevel();
+
+        /**
+         * Store the current pose when motions got sampled and output the interpolated pose in between motion samples.
+         * This only does something when motion sampling interpolation is enabled and a motion sampling rate is set.
+         * @param sampleMotions True when motions got sampled this update.
+         */
+        void InterpolateSampledPoses(bool sampleMotions);
     };
 }   // namespace EMotionFX
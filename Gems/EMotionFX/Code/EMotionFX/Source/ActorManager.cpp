@@ -312,6 +312,11 @@ namespace EMotionFX
         LockActors();
         LockActorInstances();
 
+        if (m_sharedMotionSamplingEnabled)
+        {
+            m_sharedMotionSampleCache.BeginFrame();
+        }
+
         // execute the schedule
         // this makes all the callback OnUpdate calls etc
         mScheduler->Execute(timePassedInSeconds);
@@ -321,6 +326,39 @@ namespace EMotionFX
     }
 
 
+    void ActorManager::SetSharedMotionSamplingEnabled(bool enabled)
+    {
+        m_sharedMotionSamplingEnabled = enabled;
+        if (!enabled)
+        {
+            m_sharedMotionSampleCache.Clear();
+        }
+    }
+
+
+    bool ActorManager::GetSharedMotionSamplingEnabled() const
+    {
+        return m_sharedMotionSamplingEnabled;
+    }
+
+
+    SharedMotionSampleCache& ActorManager::GetSharedMotionSampleCache()
+    {
+        return m_sharedMotionSampleCache;
+    }
+
+
+    SharedMotionSampleCache* ActorManager::FindSharedMotionSampleCache(const ActorInstance* actorInstance)
+    {
+        if (!m_sharedMotionSamplingEnabled || !actorInstance->GetSharedMotionSamplingEnabled())
+        {
+            return nullptr;
+        }
+
+        return &m_sharedMotionSampleCache;
+    }
+
+
     // unregister all the actors
     void ActorManager::UnregisterAllActors()
     {
@@ -12,6 +12,7 @@
 #include "EMotionFXConfig.h"
 #include "BaseObject.h"
 #include "MemoryCategories.h"
+#include "SharedMotionSampleCache.h"
 #include <MCore/Source/MultiThreadManager.h>
 #include <MCore/Source/Array.h>
 #include <AzCore/std/smart_ptr/weak_ptr.h>
@@ -245,6 +246,25 @@ namespace EMotionFX
          */
         void UpdateActorInstances(float timePassedInSeconds);
 
+        /**
+         * Enable or disable sharing sampled motion poses between actor instances.
+         * When enabled, instances of the same actor playing the same motion at nearly the same time reuse a single sampled pose,
+         * which is meant for large crowds of background characters. Sample times get quantized to the time step of the cache.
+         * Actor instances can opt out using ActorInstance::SetSharedMotionSamplingEnabled().
+         * @param enabled Set to true to share sampled poses.
+         */
+        void SetSharedMotionSamplingEnabled(bool enabled);
+        bool GetSharedMotionSamplingEnabled() const;
+
+        SharedMotionSampleCache& GetSharedMotionSampleCache();
+
+        /**
+         * Get the shared motion sample cache to sample the motions of the given actor instance with.
+         * @param actorInstance The actor instance to sample motions for.
+         * @result The cache, or nullptr in case the actor instance should sample its motions itself.
+         */
+        SharedMotionSampleCache* FindSharedMotionSampleCache(const ActorInstance* actorInstance);
+
         void DestroyAllActorInstances();
         void DestroyAllActors();
 
@@ -260,6 +280,8 @@ namespace EMotionFX
         ActorUpdateScheduler*           mScheduler;             /**< The update scheduler to use. */
         MCore::MutexRecursive           mActorLock;             /**< The multithread lock for touching the actors array. */
         MCore::MutexRecursive           mActorInstanceLock;     /**< The multithread lock for touching the actor instances array. */
+        SharedMotionSampleCache         m_sharedMotionSampleCache; /**< Sampled motion poses shared between actor instances. */
+        bool                            m_sharedMotionSamplingEnabled = false; /**< Share sampled motion poses between actor instances? */
 
         /**
          * The constructor, which initializes using the multi processor scheduler.
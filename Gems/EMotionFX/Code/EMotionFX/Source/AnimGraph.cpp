@@ -82,6 +82,7 @@ namespace EMotionFX
 
     void AnimGraph::RecursiveReinit()
     {
+        InvalidateExecutionPlan();
         if (!mRootStateMachine)
         {
             return;
@@ -93,6 +94,7 @@ namespace EMotionFX
 
     bool AnimGraph::InitAfterLoading()
     {
+        InvalidateExecutionPlan();
         if (!mRootStateMachine)
         {
             return false;
@@ -703,6 +705,7 @@ namespace EMotionFX
     void AnimGraph::SetRootStateMachine(AnimGraphStateMachine* stateMachine)
     {
         mRootStateMachine = stateMachine;
+        InvalidateExecutionPlan();
         if (mRootStateMachine)
         {
             // make sure the name is always the same for the root state machine
@@ -711,10 +714,33 @@ namespace EMotionFX
     }
 
 
+    const AnimGraphExecutionPlan& AnimGraph::GetExecutionPlan()
+    {
+        if (m_executionPlanDirty)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_executionPlanMutex);
+            if (m_executionPlanDirty)
+            {
+                m_executionPlan.Build(*this);
+                m_executionPlanDirty = false;
+            }
+        }
+
+        return m_executionPlan;
+    }
+
+
+    void AnimGraph::InvalidateExecutionPlan()
+    {
+        m_executionPlanDirty = true;
+    }
+
+
     // add an object
     void AnimGraph::AddObject(AnimGraphObject* object)
     {
         MCore::LockGuard lock(mLock);
+        InvalidateExecutionPlan();
 
         // assign the index and add it to the objects array
         object->SetObjectIndex(static_cast<uint32>(mObjects.size()));
@@ -740,6 +766,7 @@ namespace EMotionFX
     void AnimGraph::RemoveObject(AnimGraphObject* object)
     {
         MCore::LockGuard lock(mLock);
+        InvalidateExecutionPlan();
 
         const size_t objectIndex = object->GetObjectIndex();
 
@@ -11,8 +11,11 @@
 #include <AzCore/RTTI/ReflectContext.h>
 #include <AzCore/Serialization/ObjectStream.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/std/string/string_view.h>
+#include <EMotionFX/Source/AnimGraphExecutionPlan.h>
 #include <EMotionFX/Source/AnimGraphObjectIds.h>
 #include <EMotionFX/Source/BaseObject.h>
 #include <EMotionFX/Source/EMotionFXConfig.h>
@@ -385,6 +388,11 @@ namespace EMotionFX
         void ReserveNumNodes(uint32 numNodes);
         uint32 CalcNumMotionNodes() const;
 
+        /// Get the execution plan shared by all anim graph instances, it gets rebuilt first in case the graph changed since it was last used.
+        const AnimGraphExecutionPlan& GetExecutionPlan();
+        /// Mark the execution plan as outdated, call this whenever nodes, ports or connections change.
+        void InvalidateExecutionPlan();
+
         size_t GetNumAnimGraphInstances() const                                               { return m_animGraphInstances.size(); }
         AnimGraphInstance* GetAnimGraphInstance(size_t index) const                           { return m_animGraphInstances[index]; }
         void ReserveNumAnimGraphInstances(size_t numInstances);
@@ -422,6 +430,9 @@ namespace EMotionFX
         AnimGraphStateMachine*                          mRootStateMachine;
         AnimGraphGameControllerSettings*                mGameControllerSettings;
         MCore::Mutex                                    mLock;
+        AnimGraphExecutionPlan                          m_executionPlan;
+        AZStd::mutex                                    m_executionPlanMutex;
+        AZStd::atomic_bool                              m_executionPlanDirty{ true };
         uint32                                          mID;                    /**< The unique identification number for this anim graph. */
         bool                                            mAutoUnregister;        /**< Specifies whether we will automatically unregister this anim graph set from this anim graph manager or not, when deleting this object. */
         bool                                            mRetarget;              /**< Is retargeting enabled on default? */
@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/std/containers/stack.h>
+#include <EMotionFX/Source/AnimGraph.h>
+#include <EMotionFX/Source/AnimGraphAttributeTypes.h>
+#include <EMotionFX/Source/AnimGraphExecutionPlan.h>
+#include <EMotionFX/Source/AnimGraphNode.h>
+#include <EMotionFX/Source/AnimGraphStateMachine.h>
+#include <EMotionFX/Source/BlendTree.h>
+#include <EMotionFX/Source/BlendTreeConnection.h>
+
+
+namespace EMotionFX
+{
+    void AnimGraphExecutionPlan::Build(const AnimGraph& animGraph)
+    {
+        Clear();
+
+        const uint32 numNodes = animGraph.GetNumNodes();
+        m_nodeInfos.resize(numNodes);
+        for (uint32 i = 0; i < numNodes; ++i)
+        {
+            const AnimGraphNode* node = animGraph.GetNode(i);
+            NodeInfo& info = m_nodeInfos[i];
+            info.m_node = node;
+
+            const AZStd::vector<AnimGraphNode::Port>& outputPorts = node->GetOutputPorts();
+            for (size_t portIndex = 0; portIndex < outputPorts.size(); ++portIndex)
+            {
+                if (outputPorts[portIndex].mCompatibleTypes[0] == AttributePose::TYPE_ID)
+                {
+                    info.m_poseOutputPorts.emplace_back(static_cast<AZ::u16>(portIndex));
+                }
+            }
+
+            for (const AnimGraphNode::Port& inputPort : node->GetInputPorts())
+            {
+                if (inputPort.mConnection && inputPort.mConnection->GetSourceNode())
+                {
+                    info.m_inputNodes.emplace_back(inputPort.mConnection->GetSourceNode());
+                }
+            }
+        }
+
+        for (uint32 i = 0; i < numNodes; ++i)
+        {
+            const BlendTree* blendTree = azrtti_cast<const BlendTree*>(animGraph.GetNode(i));
+            if (blendTree)
+            {
+                BuildEvaluationOrder(*blendTree, m_nodeInfos[i]);
+            }
+        }
+
+        const AnimGraphStateMachine* rootStateMachine = animGraph.GetRootStateMachine();
+        if (rootStateMachine)
+        {
+            CalcMaxNumPoses(rootStateMachine);
+            const NodeInfo* rootInfo = FindNodeInfo(rootStateMachine);
+            m_maxNumPoses = rootInfo ? rootInfo->m_maxNumPoses : 0;
+        }
+    }
+
+
+    void AnimGraphExecutionPlan::Clear()
+    {
+        m_nodeInfos.clear();
+        m_maxNumPoses = 0;
+    }
+
+
+    const AnimGraphExecutionPlan::NodeInfo* AnimGraphExecutionPlan::FindNodeInfo(const AnimGraphNode* node) const
+    {
+        const uint32 nodeIndex = node->GetNodeIndex();
+        if (nodeIndex >= m_nodeInfos.size() || m_nodeInfos[nodeIndex].m_node != node)
+        {
+            return nullptr;
+        }
+
+        return &m_nodeInfos[nodeIndex];
+    }
+
+
+    // Post order walk over the incoming connections, starting at the node that provides the output of the blend tree.
+    void AnimGraphExecutionPlan::BuildEvaluationOrder(const BlendTree& blendTree, NodeInfo& outInfo) const
+    {
+        AnimGraphNode* finalNode = blendTree.GetRealFinalNode();
+        if (!finalNode || !FindNodeInfo(finalNode))
+        {
+            return;
+        }
+
+        AZStd::vector<bool> visited(m_nodeInfos.size(), false);
+        AZStd::stack<AZStd::pair<AnimGraphNode*, size_t>> stack;
+        stack.push({ finalNode, 0 });
+        visited[finalNode->GetNodeIndex()] = true;
+        while (!stack.empty())
+        {
+            AZStd::pair<AnimGraphNode*, size_t>& current = stack.top();
+            const NodeInfo& currentInfo = m_nodeInfos[current.first->GetNodeIndex()];
+            if (current.second < currentInfo.m_inputNodes.size())
+            {
+                AnimGraphNode* inputNode = currentInfo.m_inputNodes[current.second++];
+                if (FindNodeInfo(inputNode) && !visited[inputNode->GetNodeIndex()])
+                {
+                    visited[inputNode->GetNodeIndex()] = true;
+                    stack.push({ inputNode, 0 });
+                }
+            }
+            else
+            {
+                outInfo.m_evaluationOrder.emplace_back(current.first);
+                stack.pop();
+            }
+        }
+    }
+
+
+    void AnimGraphExecutionPlan::CalcMaxNumPoses(const AnimGraphNode* node)
+    {
+        const NodeInfo* info = FindNodeInfo(node);
+        if (!info)
+        {
+            return;
+        }
+
+        size_t largestChild = 0;
+        size_t secondLargestChild = 0;
+        for (const AnimGraphNode* childNode : node->GetChildNodes())
+        {
+            CalcMaxNumPoses(childNode);
+            const NodeInfo* childInfo = FindNodeInfo(childNode);
+            const size_t childMaxNumPoses = childInfo ? childInfo->m_maxNumPoses : 0;
+            if (childMaxNumPoses > largestChild)
+            {
+                secondLargestChild = largestChild;
+                largestChild = childMaxNumPoses;
+            }
+            else if (childMaxNumPoses > secondLargestChild)
+            {
+                secondLargestChild = childMaxNumPoses;
+            }
+        }
+
+        size_t innerMaxNumPoses = largestChild;
+        if (azrtti_istypeof<BlendTree>(node))
+        {
+            innerMaxNumPoses = CalcBlendTreeMaxNumPoses(*info);
+        }
+        else if (azrtti_istypeof<AnimGraphStateMachine>(node))
+        {
+            // A transition outputs both the source and the target state.
+            innerMaxNumPoses = largestChild + secondLargestChild;
+        }
+
+        m_nodeInfos[node->GetNodeIndex()].m_maxNumPoses = innerMaxNumPoses + info->m_poseOutputPorts.size();
+    }
+
+
+    // Walks the evaluation order, keeping the poses of a node alive until its last consumer got evaluated.
+    size_t AnimGraphExecutionPlan::CalcBlendTreeMaxNumPoses(const NodeInfo& blendTreeInfo) const
+    {
+        AZStd::vector<size_t> numRemainingConsumers(m_nodeInfos.size(), 0);
+        for (const AnimGraphNode* node : blendTreeInfo.m_evaluationOrder)
+        {
+            for (const AnimGraphNode* inputNode : m_nodeInfos[node->GetNodeIndex()].m_inputNodes)
+            {
+                if (FindNodeInfo(inputNode))
+                {
+                    numRemainingConsumers[inputNode->GetNodeIndex()]++;
+                }
+            }
+        }
+
+        size_t numLivePoses = 0;
+        size_t maxNumPoses = 0;
+        for (const AnimGraphNode* node : blendTreeInfo.m_evaluationOrder)
+        {
+            const NodeInfo& info = m_nodeInfos[node->GetNodeIndex()];
+            maxNumPoses = AZStd::max(maxNumPoses, numLivePoses + info.m_maxNumPoses);
+            numLivePoses += info.m_poseOutputPorts.size();
+
+            for (const AnimGraphNode* inputNode : info.m_inputNodes)
+            {
+                const NodeInfo* inputInfo = FindNodeInfo(inputNode);
+                if (inputInfo && --numRemainingConsumers[inputNode->GetNodeIndex()] == 0)
+                {
+                    numLivePoses -= inputInfo->m_poseOutputPorts.size();
+                }
+            }
+        }
+
+        return AZStd::max(maxNumPoses, numLivePoses);
+    }
+} // namespace EMotionFX
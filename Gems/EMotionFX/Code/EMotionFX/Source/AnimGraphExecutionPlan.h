@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/containers/vector.h>
+#include <EMotionFX/Source/EMotionFXConfig.h>
+
+
+namespace EMotionFX
+{
+    // forward declarations
+    class AnimGraph;
+    class AnimGraphNode;
+    class BlendTree;
+
+    //! Topology of an anim graph, compiled once per anim graph and shared by all of its anim graph instances.
+    //! Nodes use it to request and release their poses and to update the ref counts of their inputs without scanning
+    //! their ports every frame. It also holds the evaluation order of every blend tree, sources before their consumers,
+    //! along with the number of poses needed to evaluate the graph, so the pose pools can be sized up front.
+    class EMFX_API AnimGraphExecutionPlan
+    {
+    public:
+        struct EMFX_API NodeInfo
+        {
+            const AnimGraphNode* m_node = nullptr;
+            AZStd::vector<AZ::u16> m_poseOutputPorts;           //!< Output ports holding a pose.
+            AZStd::vector<AnimGraphNode*> m_inputNodes;         //!< Source node of each connected input port, in port order.
+            AZStd::vector<AnimGraphNode*> m_evaluationOrder;    //!< For blend trees, the nodes feeding the final node, sources first.
+            size_t m_maxNumPoses = 0;                           //!< Peak number of poses in use while outputting the node, including its own.
+        };
+
+        void Build(const AnimGraph& animGraph);
+        void Clear();
+
+        //! Returns the info for the given node, or nullptr in case the node wasn't part of the anim graph when the plan got built.
+        const NodeInfo* FindNodeInfo(const AnimGraphNode* node) const;
+
+        //! Peak number of poses in use at once while outputting the whole anim graph.
+        size_t GetMaxNumPoses() const { return m_maxNumPoses; }
+
+    private:
+        void BuildEvaluationOrder(const BlendTree& blendTree, NodeInfo& outInfo) const;
+        void CalcMaxNumPoses(const AnimGraphNode* node);
+        size_t CalcBlendTreeMaxNumPoses(const NodeInfo& blendTreeInfo) const;
+
+        AZStd::vector<NodeInfo> m_nodeInfos; // Indexed by node index.
+        size_t m_maxNumPoses = 0;
+    };
+} // namespace EMotionFX
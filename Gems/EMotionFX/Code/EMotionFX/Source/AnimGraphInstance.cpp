@@ -225,6 +225,16 @@ namespace EMotionFX
         AnimGraphPosePool& posePool = GetEMotionFX().GetThreadData(threadIndex)->GetPosePool();
         posePool.ResetMaxUsedPoses();
 
+        // Reserve the poses needed to output the whole graph up front, so the pool doesn't grow while outputting.
+        if (!m_parentAnimGraphInstance)
+        {
+            const uint32 maxNumPoses = static_cast<uint32>(mAnimGraph->GetExecutionPlan().GetMaxNumPoses());
+            if (posePool.GetNumPoses() < maxNumPoses)
+            {
+                posePool.Resize(maxNumPoses);
+            }
+        }
+
         // calculate the anim graph output
         AnimGraphNode* rootNode = GetRootNode();
 
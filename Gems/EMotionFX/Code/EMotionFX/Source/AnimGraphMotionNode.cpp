@@ -20,6 +20,8 @@
 #include "MotionInstancePool.h"
 #include "Motion.h"
 #include "EMotionFXManager.h"
+#include "ActorManager.h"
+#include "TransformData.h"
 #include "MotionEventTable.h"
 #include "AnimGraph.h"
 #include <EMotionFX/Source/MotionData/MotionData.h>
@@ -462,7 +464,14 @@ namespace EMotionFX
         outputPose->InitFromBindPose(actorInstance); // TODO: is this really needed?
 
         // we use as input pose the same as the output, as this blend tree node takes no input
-        motionInstance->GetMotion()->Update(&outputTransformPose, &outputTransformPose, motionInstance);
+        if (SharedMotionSampleCache* sharedSampleCache = GetActorManager().FindSharedMotionSampleCache(actorInstance))
+        {
+            sharedSampleCache->SamplePose(motionInstance, actorInstance->GetTransformData()->GetBindPose(), &outputTransformPose);
+        }
+        else
+        {
+            motionInstance->GetMotion()->Update(&outputTransformPose, &outputTransformPose, motionInstance);
+        }
 
         // compensate for motion extraction
         // we already moved our actor instance's position and rotation at this point
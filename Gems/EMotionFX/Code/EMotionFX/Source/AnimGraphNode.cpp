@@ -170,6 +170,7 @@ namespace EMotionFX
 
     void AnimGraphNode::RemoveAllConnections()
     {
+        InvalidateExecutionPlan();
         for (BlendTreeConnection* connection : mConnections)
         {
             delete connection;
@@ -189,6 +190,7 @@ namespace EMotionFX
             mConnections.push_back(connection);
             mInputPorts[targetPort].mConnection = connection;
             sourceNode->mOutputPorts[sourcePort].mConnection = connection;
+            InvalidateExecutionPlan();
             return connection;
         }
         return nullptr;
@@ -459,6 +461,7 @@ namespace EMotionFX
     // remove a given connection
     void AnimGraphNode::RemoveConnection(BlendTreeConnection* connection, bool delFromMem)
     {
+        InvalidateExecutionPlan();
         mInputPorts[connection->GetTargetPort()].mConnection = nullptr;
 
         AnimGraphNode* sourceNode = connection->GetSourceNode();
@@ -498,6 +501,7 @@ namespace EMotionFX
         {
             if (mConnections[i]->GetId() == connectionId)
             {
+                InvalidateExecutionPlan();
                 mInputPorts[mConnections[i]->GetTargetPort()].mConnection = nullptr;
 
                 AnimGraphNode* sourceNode = mConnections[i]->GetSourceNode();
@@ -539,6 +543,7 @@ namespace EMotionFX
     void AnimGraphNode::InitInputPorts(uint32 numPorts)
     {
         mInputPorts.resize(numPorts);
+        InvalidateExecutionPlan();
     }
 
 
@@ -546,6 +551,7 @@ namespace EMotionFX
     void AnimGraphNode::InitOutputPorts(uint32 numPorts)
     {
         mOutputPorts.resize(numPorts);
+        InvalidateExecutionPlan();
     }
 
 
@@ -588,6 +594,7 @@ namespace EMotionFX
     {
         const size_t currentSize = mOutputPorts.size();
         mOutputPorts.emplace_back();
+        InvalidateExecutionPlan();
         return static_cast<uint32>(currentSize);
     }
 
@@ -597,6 +604,7 @@ namespace EMotionFX
     {
         const size_t currentSize = mInputPorts.size();
         mInputPorts.emplace_back();
+        InvalidateExecutionPlan();
         return static_cast<uint32>(currentSize);
     }
 
@@ -665,6 +673,27 @@ namespace EMotionFX
     }
 
 
+    void AnimGraphNode::InvalidateExecutionPlan()
+    {
+        if (mAnimGraph)
+        {
+            mAnimGraph->InvalidateExecutionPlan();
+        }
+    }
+
+
+    const AnimGraphExecutionPlan::NodeInfo* AnimGraphNode::FindExecutionPlanInfo() const
+    {
+        // The editor changes ports and connections in many places, so only rely on the plan at runtime.
+        if (!mAnimGraph || GetEMotionFX().GetIsInEditorMode())
+        {
+            return nullptr;
+        }
+
+        return mAnimGraph->GetExecutionPlan().FindNodeInfo(this);
+    }
+
+
     // setup an output port to output a given local pose
     void AnimGraphNode::SetupOutputPortAsPose(const char* name, uint32 outputPortNr, uint32 portID)
     {
@@ -678,6 +707,7 @@ namespace EMotionFX
         SetOutputPortName(outputPortNr, name);
         mOutputPorts[outputPortNr].Clear();
         mOutputPorts[outputPortNr].mCompatibleTypes[0] = AttributePose::TYPE_ID;    // setup the compatible types of this port
+        InvalidateExecutionPlan();
         mOutputPorts[outputPortNr].mPortID = portID;
     }
 
@@ -695,6 +725,7 @@ namespace EMotionFX
         SetOutputPortName(outputPortNr, name);
         mOutputPorts[outputPortNr].Clear();
         mOutputPorts[outputPortNr].mCompatibleTypes[0] = AttributeMotionInstance::TYPE_ID;  // setup the compatible types of this port
+        InvalidateExecutionPlan();
         mOutputPorts[outputPortNr].mPortID = portID;
     }
 
@@ -712,6 +743,7 @@ namespace EMotionFX
         SetOutputPortName(outputPortNr, name);
         mOutputPorts[outputPortNr].Clear();
         mOutputPorts[outputPortNr].mCompatibleTypes[0] = attributeTypeID;
+        InvalidateExecutionPlan();
         mOutputPorts[outputPortNr].mPortID = portID;
     }
 
@@ -2069,21 +2101,35 @@ namespace EMotionFX
 
         const uint32 threadIndex = animGraphInstance->GetActorInstance()->GetThreadIndex();
         AnimGraphPosePool& posePool = GetEMotionFX().GetThreadData(threadIndex)->GetPosePool();
+        auto freePose = [this, animGraphInstance, &posePool](uint32 portIndex)
+        {
+            MCore::Attribute* attribute = GetOutputAttribute(animGraphInstance, portIndex);
+            MCORE_ASSERT(attribute->GetType() == AttributePose::TYPE_ID);
+
+            AttributePose* poseAttribute = static_cast<AttributePose*>(attribute);
+            AnimGraphPose* pose = poseAttribute->GetValue();
+            if (pose)
+            {
+                posePool.FreePose(pose);
+            }
+            poseAttribute->SetValue(nullptr);
+        };
+
+        if (const AnimGraphExecutionPlan::NodeInfo* planInfo = FindExecutionPlanInfo())
+        {
+            for (const AZ::u16 portIndex : planInfo->m_poseOutputPorts)
+            {
+                freePose(portIndex);
+            }
+            return;
+        }
+
         const size_t numOutputs = mOutputPorts.size();
         for (size_t i = 0; i < numOutputs; ++i)
         {
             if (mOutputPorts[i].mCompatibleTypes[0] == AttributePose::TYPE_ID)
             {
-                MCore::Attribute* attribute = GetOutputAttribute(animGraphInstance, static_cast<uint32>(i));
-                MCORE_ASSERT(attribute->GetType() == AttributePose::TYPE_ID);
-
-                AttributePose* poseAttribute = static_cast<AttributePose*>(attribute);
-                AnimGraphPose* pose = poseAttribute->GetValue();
-                if (pose)
-                {
-                    posePool.FreePose(pose);
-                }
-                poseAttribute->SetValue(nullptr);
+                freePose(static_cast<uint32>(i));
             }
         }
     }
@@ -2096,18 +2142,31 @@ namespace EMotionFX
         const uint32 threadIndex = actorInstance->GetThreadIndex();
 
         AnimGraphPosePool& posePool = GetEMotionFX().GetThreadData(threadIndex)->GetPosePool();
+        auto requestPose = [this, animGraphInstance, actorInstance, &posePool](uint32 portIndex)
+        {
+            MCore::Attribute* attribute = GetOutputAttribute(animGraphInstance, portIndex);
+            MCORE_ASSERT(attribute->GetType() == AttributePose::TYPE_ID);
+
+            AnimGraphPose* pose = posePool.RequestPose(actorInstance);
+            AttributePose* poseAttribute = static_cast<AttributePose*>(attribute);
+            poseAttribute->SetValue(pose);
+        };
+
+        if (const AnimGraphExecutionPlan::NodeInfo* planInfo = FindExecutionPlanInfo())
+        {
+            for (const AZ::u16 portIndex : planInfo->m_poseOutputPorts)
+            {
+                requestPose(portIndex);
+            }
+            return;
+        }
 
         const size_t numOutputs = mOutputPorts.size();
         for (size_t i = 0; i < numOutputs; ++i)
         {
             if (mOutputPorts[i].mCompatibleTypes[0] == AttributePose::TYPE_ID)
             {
-                MCore::Attribute* attribute = GetOutputAttribute(animGraphInstance, static_cast<uint32>(i));
-                MCORE_ASSERT(attribute->GetType() == AttributePose::TYPE_ID);
-
-                AnimGraphPose* pose = posePool.RequestPose(actorInstance);
-                AttributePose* poseAttribute = static_cast<AttributePose*>(attribute);
-                poseAttribute->SetValue(pose);
+                requestPose(static_cast<uint32>(i));
             }
         }
     }
@@ -2116,6 +2175,15 @@ namespace EMotionFX
     // free all poses from all incoming nodes
     void AnimGraphNode::FreeIncomingPoses(AnimGraphInstance* animGraphInstance)
     {
+        if (const AnimGraphExecutionPlan::NodeInfo* planInfo = FindExecutionPlanInfo())
+        {
+            for (AnimGraphNode* inputNode : planInfo->m_inputNodes)
+            {
+                inputNode->DecreaseRef(animGraphInstance);
+            }
+            return;
+        }
+
         for (const Port& inputPort : mInputPorts)
         {
             const BlendTreeConnection* connection = inputPort.mConnection;
@@ -2131,6 +2199,15 @@ namespace EMotionFX
     // free all poses from all incoming nodes
     void AnimGraphNode::FreeIncomingRefDatas(AnimGraphInstance* animGraphInstance)
     {
+        if (const AnimGraphExecutionPlan::NodeInfo* planInfo = FindExecutionPlanInfo())
+        {
+            for (AnimGraphNode* inputNode : planInfo->m_inputNodes)
+            {
+                inputNode->DecreaseRefDataRef(animGraphInstance);
+            }
+            return;
+        }
+
         for (const Port& port : mInputPorts)
         {
             const BlendTreeConnection* connection = port.mConnection;
@@ -2263,6 +2340,15 @@ namespace EMotionFX
     // increase input ref counts
     void AnimGraphNode::IncreaseInputRefDataRefCounts(AnimGraphInstance* animGraphInstance)
     {
+        if (const AnimGraphExecutionPlan::NodeInfo* planInfo = FindExecutionPlanInfo())
+        {
+            for (AnimGraphNode* inputNode : planInfo->m_inputNodes)
+            {
+                inputNode->IncreaseRefDataRefCount(animGraphInstance);
+            }
+            return;
+        }
+
         for (const Port& port : mInputPorts)
         {
             const BlendTreeConnection* connection = port.mConnection;
@@ -2278,6 +2364,15 @@ namespace EMotionFX
     // increase input ref counts
     void AnimGraphNode::IncreaseInputRefCounts(AnimGraphInstance* animGraphInstance)
     {
+        if (const AnimGraphExecutionPlan::NodeInfo* planInfo = FindExecutionPlanInfo())
+        {
+            for (AnimGraphNode* inputNode : planInfo->m_inputNodes)
+            {
+                inputNode->IncreasePoseRefCount(animGraphInstance);
+            }
+            return;
+        }
+
         for (const Port& port : mInputPorts)
         {
             const BlendTreeConnection* connection = port.mConnection;
@@ -2293,6 +2388,7 @@ namespace EMotionFX
     void AnimGraphNode::RelinkPortConnections()
     {
         // After deserializing, nodes hold an array of incoming connections. Each node port caches a pointer to its connection object which we need to link.
+        InvalidateExecutionPlan();
         for (BlendTreeConnection* connection : mConnections)
         {
             AnimGraphNode* sourceNode = connection->GetSourceNode();
@@ -15,6 +15,7 @@
 #include "EMotionFXConfig.h"
 #include <MCore/Source/StringIdPool.h>
 #include "AnimGraphAttributeTypes.h"
+#include "AnimGraphExecutionPlan.h"
 #include "BlendTreeConnection.h"
 #include "AnimGraphObject.h"
 #include "AnimGraphInstance.h"
@@ -968,5 +969,10 @@ namespace EMotionFX
 
         void RecursiveCountChildNodes(uint32& numNodes) const;
         void RecursiveCountNodeConnections(uint32& numConnections) const;
+
+        // Call whenever ports or connections change, so the anim graph recompiles its execution plan.
+        void InvalidateExecutionPlan();
+        // Returns the execution plan info of this node, or nullptr if the ports have to be scanned instead, like while editing.
+        const AnimGraphExecutionPlan::NodeInfo* FindExecutionPlanInfo() const;
     };
 } // namespace EMotionFX
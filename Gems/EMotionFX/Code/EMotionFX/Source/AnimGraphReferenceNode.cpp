@@ -1018,6 +1018,7 @@ namespace EMotionFX
         // Remove all input ports
         mInputPorts.clear();
         m_parameterIndexByPortIndex.clear();
+        InvalidateExecutionPlan();
 
         // Get the ValueParameters from the AnimGraph
         if (m_animGraphAsset && m_animGraphAsset.Get()->GetAnimGraph())
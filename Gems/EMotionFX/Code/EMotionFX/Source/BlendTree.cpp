@@ -310,6 +310,7 @@ namespace EMotionFX
     void BlendTree::SetVirtualFinalNode(AnimGraphNode* node)
     {
         mVirtualFinalNode = node;
+        InvalidateExecutionPlan();
 
         AnimGraphNotificationBus::Broadcast(&AnimGraphNotificationBus::Events::OnVirtualFinalNodeSet, this);
     }
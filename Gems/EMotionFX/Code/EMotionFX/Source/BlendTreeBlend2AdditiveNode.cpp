@@ -206,18 +206,9 @@ namespace EMotionFX
         Pose& outputLocalPose = outputPose->GetPose();
 
         // If we use a mask, overwrite those nodes.
-        const size_t numNodes = uniqueData->mMask.size();
-        if (numNodes > 0)
+        if (!uniqueData->mMask.empty())
         {
-            Transform transform;
-            for (size_t n = 0; n < numNodes; ++n)
-            {
-                const float finalWeight = blendWeight;// * uniqueData->mWeights[n];
-                const uint32 nodeIndex = uniqueData->mMask[n];
-                transform = outputLocalPose.GetLocalSpaceTransform(nodeIndex);
-                transform.ApplyAdditive(additivePose.GetLocalSpaceTransform(nodeIndex), finalWeight);
-                outputLocalPose.SetLocalSpaceTransform(nodeIndex, transform);
-            }
+            outputLocalPose.ApplyAdditiveMasked(additivePose, blendWeight, uniqueData->mMask);
         }
     }
 
@@ -209,18 +209,9 @@ namespace EMotionFX
         *outputPose = *nodeA->GetMainOutputPose(animGraphInstance);
         Pose& outputLocalPose = outputPose->GetPose();
 
-        const size_t numNodes = uniqueData->mMask.size();
-        if (numNodes > 0)
+        if (!uniqueData->mMask.empty())
         {
-            Transform transform;
-            for (size_t n = 0; n < numNodes; ++n)
-            {
-                const float finalWeight = blendWeight /* * uniqueData->mWeights[n]*/;
-                const uint32 nodeIndex = uniqueData->mMask[n];
-                transform = outputLocalPose.GetLocalSpaceTransform(nodeIndex);
-                transform.Blend(localMaskPose.GetLocalSpaceTransform(nodeIndex), finalWeight);
-                outputLocalPose.SetLocalSpaceTransform(nodeIndex, transform);
-            }
+            outputLocalPose.BlendMasked(&localMaskPose, blendWeight, uniqueData->mMask);
         }
     }
 
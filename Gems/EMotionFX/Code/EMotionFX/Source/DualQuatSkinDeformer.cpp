@@ -88,6 +88,13 @@ namespace EMotionFX
             boneInfo.mDualQuat.FromRotationTranslation(skinTransform.mRotation, skinTransform.mPosition);
         }
 
+        // Skin small meshes on the calling thread, creating a job for a single batch only adds scheduling overhead.
+        if (numVertices <= s_numVerticesPerBatch)
+        {
+            SkinRange(mMesh, 0, numVertices, m_bones);
+            return;
+        }
+
         AZ::JobCompletion jobCompletion;
 
         // Split up the skinned vertices into batches.
@@ -0,0 +1,1713 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/SimdMath.h>
+#include <AzCore/Outcome/Outcome.h>
+#include <AzCore/std/algorithm.h>
+#include <EMotionFX/Source/Actor.h>
+#include <EMotionFX/Source/ActorInstance.h>
+#include <EMotionFX/Source/EMotionFXManager.h>
+#include <EMotionFX/Source/MorphSetup.h>
+#include <EMotionFX/Source/MorphSetupInstance.h>
+#include <EMotionFX/Source/MotionData/CompressedUniformMotionData.h>
+#include <EMotionFX/Source/MotionData/NonUniformMotionData.h>
+#include <EMotionFX/Source/Node.h>
+#include <EMotionFX/Source/Pose.h>
+#include <EMotionFX/Source/Skeleton.h>
+#include <EMotionFX/Source/TransformData.h>
+
+#include <EMotionFX/Source/Importer/SharedFileFormatStructs.h>
+#include <EMotionFX/Source/Importer/MotionFileFormat.h>
+#include <EMotionFX/Exporters/ExporterLib/Exporter/Exporter.h>
+#include <MCore/Source/CompressedQuaternion.h>
+#include <MCore/Source/LogManager.h>
+
+namespace EMotionFX
+{
+    namespace
+    {
+        constexpr float QuantizedMaxValue = 65535.0f;
+        constexpr float SmallestThreeMaxValue = 32767.0f;
+        constexpr float SmallestThreeRange = 0.707106781f; // The three smallest components of a unit quaternion are within [-1/sqrt(2), 1/sqrt(2)].
+        constexpr AZ::u32 SmallestThreeBits = 15;
+        constexpr AZ::u32 BatchSize = 4;
+
+        AZ::u16 QuantizeValue(float value, float minValue, float scale)
+        {
+            if (scale <= 0.0f)
+            {
+                return 0;
+            }
+            return static_cast<AZ::u16>(AZ::GetClamp((value - minValue) / scale + 0.5f, 0.0f, QuantizedMaxValue));
+        }
+
+        float DequantizeValue(float quantized, float minValue, float scale)
+        {
+            return minValue + quantized * scale;
+        }
+
+        // Calculates the quantization range of a track and returns whether quantizing it stays within the given error.
+        template<typename GetValueFunc>
+        bool CalcQuantizationRange(size_t numValues, float maxError, const GetValueFunc& getValue, float& outMin, float& outScale)
+        {
+            float minValue = getValue(0);
+            float maxValue = minValue;
+            for (size_t i = 1; i < numValues; ++i)
+            {
+                minValue = AZ::GetMin(minValue, getValue(i));
+                maxValue = AZ::GetMax(maxValue, getValue(i));
+            }
+
+            outMin = minValue;
+            outScale = (maxValue - minValue) / QuantizedMaxValue;
+            for (size_t i = 0; i < numValues; ++i)
+            {
+                const float value = getValue(i);
+                const float decoded = DequantizeValue(QuantizeValue(value, outMin, outScale), outMin, outScale);
+                if (AZ::GetAbs(decoded - value) > maxError)
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        bool CalcQuantizationRange(const AZStd::vector<AZ::Vector3>& values, float maxError, AZ::Vector3& outMin, AZ::Vector3& outScale)
+        {
+            for (int c = 0; c < 3; ++c)
+            {
+                float minValue = 0.0f;
+                float scale = 0.0f;
+                if (!CalcQuantizationRange(values.size(), maxError, [&values, c](size_t i) { return values[i].GetElement(c); }, minValue, scale))
+                {
+                    return false;
+                }
+                outMin.SetElement(c, minValue);
+                outScale.SetElement(c, scale);
+            }
+            return true;
+        }
+
+        bool IsRotationClose(const AZ::Quaternion& a, const AZ::Quaternion& b, float maxError)
+        {
+            // Both q and -q describe the same rotation.
+            return a.IsClose(b, maxError) || a.IsClose(-b, maxError);
+        }
+
+        // Stores the index of the largest component in 2 bits followed by the three other components in 15 bits each.
+        // The largest component is made positive by negating the quaternion if needed, so its sign does not have to be stored.
+        void EncodeSmallestThree(const AZ::Quaternion& rotation, AZ::u16* outValues)
+        {
+            const AZ::Quaternion normalized = rotation.GetNormalized();
+            const float components[4] = { normalized.GetX(), normalized.GetY(), normalized.GetZ(), normalized.GetW() };
+
+            AZ::u32 largestIndex = 0;
+            for (AZ::u32 i = 1; i < 4; ++i)
+            {
+                if (AZ::GetAbs(components[i]) > AZ::GetAbs(components[largestIndex]))
+                {
+                    largestIndex = i;
+                }
+            }
+            const float sign = (components[largestIndex] < 0.0f) ? -1.0f : 1.0f;
+
+            AZ::u64 packed = largestIndex;
+            AZ::u32 shift = 2;
+            for (AZ::u32 i = 0; i < 4; ++i)
+            {
+                if (i == largestIndex)
+                {
+                    continue;
+                }
+                const float normalizedValue = AZ::GetClamp((components[i] * sign + SmallestThreeRange) / (2.0f * SmallestThreeRange), 0.0f, 1.0f);
+                packed |= static_cast<AZ::u64>(normalizedValue * SmallestThreeMaxValue + 0.5f) << shift;
+                shift += SmallestThreeBits;
+            }
+
+            outValues[0] = static_cast<AZ::u16>(packed);
+            outValues[1] = static_cast<AZ::u16>(packed >> 16);
+            outValues[2] = static_cast<AZ::u16>(packed >> 32);
+        }
+
+        AZ::Quaternion DecodeSmallestThree(const AZ::u16* values)
+        {
+            const AZ::u64 packed = static_cast<AZ::u64>(values[0]) | (static_cast<AZ::u64>(values[1]) << 16) | (static_cast<AZ::u64>(values[2]) << 32);
+            const AZ::u32 largestIndex = static_cast<AZ::u32>(packed & 3);
+
+            float components[4];
+            float sumSquares = 0.0f;
+            AZ::u32 shift = 2;
+            for (AZ::u32 i = 0; i < 4; ++i)
+            {
+                if (i == largestIndex)
+                {
+                    continue;
+                }
+                const float quantized = static_cast<float>((packed >> shift) & ((1 << SmallestThreeBits) - 1));
+                components[i] = (quantized / SmallestThreeMaxValue) * (2.0f * SmallestThreeRange) - SmallestThreeRange;
+                sumSquares += components[i] * components[i];
+                shift += SmallestThreeBits;
+            }
+            components[largestIndex] = AZ::Sqrt(AZ::GetMax(0.0f, 1.0f - sumSquares));
+
+            return AZ::Quaternion(components[0], components[1], components[2], components[3]);
+        }
+
+        bool CanEncodeSmallestThree(const AZStd::vector<AZ::Quaternion>& rotations, float maxError)
+        {
+            AZ::u16 encoded[3];
+            for (const AZ::Quaternion& rotation : rotations)
+            {
+                EncodeSmallestThree(rotation, encoded);
+                if (!IsRotationClose(rotation.GetNormalized(), DecodeSmallestThree(encoded), maxError))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        bool IsConstantTrack(const AZStd::vector<AZ::Vector3>& values, float maxError)
+        {
+            return AZStd::all_of(values.begin(), values.end(), [&values, maxError](const AZ::Vector3& value) { return value.IsClose(values[0], maxError); });
+        }
+
+        bool IsConstantTrack(const AZStd::vector<AZ::Quaternion>& values, float maxError)
+        {
+            return AZStd::all_of(values.begin(), values.end(), [&values, maxError](const AZ::Quaternion& value) { return IsRotationClose(value, values[0], maxError); });
+        }
+
+        bool IsConstantTrack(const AZStd::vector<float>& values, float maxError)
+        {
+            return AZStd::all_of(values.begin(), values.end(), [&values, maxError](float value) { return AZ::IsClose(value, values[0], maxError); });
+        }
+
+        bool IsInIgnoreList(const AZStd::vector<size_t>& ignoreList, size_t index)
+        {
+            return AZStd::find(ignoreList.begin(), ignoreList.end(), index) != ignoreList.end();
+        }
+    } // namespace
+
+    // Uncompressed, evenly spaced samples of all tracks. Empty vectors are tracks that are not animated.
+    struct CompressedUniformMotionData::SourceTracks
+    {
+        struct Joint
+        {
+            AZStd::vector<AZ::Vector3> m_positions;
+            AZStd::vector<AZ::Quaternion> m_rotations;
+            AZStd::vector<AZ::Vector3> m_scales;
+        };
+
+        AZStd::vector<Joint> m_joints;
+        AZStd::vector<AZStd::vector<float>> m_morphs;
+        AZStd::vector<AZStd::vector<float>> m_floats;
+    };
+
+    CompressedUniformMotionData::~CompressedUniformMotionData()
+    {
+        ClearAllData();
+    }
+
+    MotionData* CompressedUniformMotionData::CreateNew() const
+    {
+        return aznew CompressedUniformMotionData();
+    }
+
+    const char* CompressedUniformMotionData::GetSceneSettingsName() const
+    {
+        return "Compressed Evenly Spaced Keyframes (smallest, slightly slower)";
+    }
+
+    void CompressedUniformMotionData::InitTracks(size_t numJoints, size_t numMorphs, size_t numFloats, size_t numSamples, float sampleRate)
+    {
+        if (numSamples > 0)
+        {
+            AZ_Error("EMotionFX", sampleRate > 0.0f, "Sample rate should be larger than zero.");
+        }
+        Clear();
+        Resize(numJoints, numMorphs, numFloats);
+        m_numSamples = numSamples;
+        SetSampleRate(sampleRate);
+        UpdateDuration();
+    }
+
+    void CompressedUniformMotionData::InitFromNonUniformData(const NonUniformMotionData* motionData, bool keepSameSampleRate, float newSampleRate, bool updateDuration)
+    {
+        AZ_Assert(newSampleRate > 0.0f, "Expected the sample rate to be larger than zero.");
+        float sampleRate = keepSameSampleRate ? motionData->GetSampleRate() : newSampleRate;
+
+        // Calculate the sample spacing and number of samples required.
+        float sampleSpacing = 0.0f;
+        size_t numSamples = 0;
+        MotionData::CalculateSampleInformation(motionData->GetDuration(), sampleRate, numSamples, sampleSpacing);
+
+        InitTracks(motionData->GetNumJoints(), motionData->GetNumMorphs(), motionData->GetNumFloats(), numSamples, sampleRate);
+        CopyBaseMotionData(motionData);
+        SetSampleRate(sampleRate);
+        if (updateDuration)
+        {
+            UpdateDuration();
+        }
+
+        // Resample all animated tracks, these are stored losslessly until Optimize is called.
+        SourceTracks source;
+        source.m_joints.resize(GetNumJoints());
+        source.m_morphs.resize(GetNumMorphs());
+        source.m_floats.resize(GetNumFloats());
+
+        for (size_t i = 0; i < source.m_joints.size(); ++i)
+        {
+            if (!motionData->IsJointAnimated(i))
+            {
+                continue;
+            }
+
+            SourceTracks::Joint& joint = source.m_joints[i];
+            const bool posAnimated = motionData->IsJointPositionAnimated(i);
+            const bool rotAnimated = motionData->IsJointRotationAnimated(i);
+            if (posAnimated) { joint.m_positions.resize(numSamples); }
+            if (rotAnimated) { joint.m_rotations.resize(numSamples); }
+            EMFX_SCALECODE
+            (
+                const bool scaleAnimated = motionData->IsJointScaleAnimated(i);
+                if (scaleAnimated) { joint.m_scales.resize(numSamples); }
+            )
+
+            for (size_t s = 0; s < numSamples; ++s)
+            {
+                const float keyTime = s * sampleSpacing;
+                const Transform transform = motionData->SampleJointTransform(keyTime, i);
+                if (posAnimated) joint.m_positions[s] = transform.mPosition;
+                if (rotAnimated) joint.m_rotations[s] = transform.mRotation.GetNormalized();
+                EMFX_SCALECODE
+                (
+                    if (scaleAnimated) joint.m_scales[s] = transform.mScale;
+                )
+            }
+        }
+
+        for (size_t i = 0; i < source.m_morphs.size(); ++i)
+        {
+            if (motionData->IsMorphAnimated(i))
+            {
+                source.m_morphs[i].resize(numSamples);
+                for (size_t s = 0; s < numSamples; ++s)
+                {
+                    source.m_morphs[i][s] = motionData->SampleMorph(s * sampleSpacing, i);
+                }
+            }
+        }
+
+        for (size_t i = 0; i < source.m_floats.size(); ++i)
+        {
+            if (motionData->IsFloatAnimated(i))
+            {
+                source.m_floats[i].resize(numSamples);
+                for (size_t s = 0; s < numSamples; ++s)
+                {
+                    source.m_floats[i][s] = motionData->SampleFloat(s * sampleSpacing, i);
+                }
+            }
+        }
+
+        Compress(source, nullptr);
+    }
+
+    void CompressedUniformMotionData::Optimize(const OptimizeSettings& settings)
+    {
+        SourceTracks source;
+        ExtractSourceTracks(source);
+        Compress(source, &settings);
+
+        if (settings.m_updateDuration)
+        {
+            UpdateDuration();
+        }
+    }
+
+    void CompressedUniformMotionData::ExtractSourceTracks(SourceTracks& outSource) const
+    {
+        outSource.m_joints.clear();
+        outSource.m_joints.resize(m_jointTracks.size());
+        outSource.m_morphs.clear();
+        outSource.m_morphs.resize(m_morphTracks.size());
+        outSource.m_floats.clear();
+        outSource.m_floats.resize(m_floatTracks.size());
+
+        for (size_t s = 0; s < m_numSamples; ++s)
+        {
+            const FramePair frames = GetFramePair(s);
+            for (size_t i = 0; i < m_jointTracks.size(); ++i)
+            {
+                const JointTracks& tracks = m_jointTracks[i];
+                const StaticJointData& staticData = m_staticJointData[i];
+                SourceTracks::Joint& joint = outSource.m_joints[i];
+                if (tracks.m_position.m_format != TrackFormat::NotAnimated)
+                {
+                    joint.m_positions.emplace_back(SampleVector3(tracks.m_position, staticData.m_staticTransform.mPosition, frames));
+                }
+                if (tracks.m_rotation.m_format != TrackFormat::NotAnimated)
+                {
+                    joint.m_rotations.emplace_back(SampleRotation(tracks.m_rotation, staticData.m_staticTransform.mRotation, frames));
+                }
+#ifndef EMFX_SCALE_DISABLED
+                if (tracks.m_scale.m_format != TrackFormat::NotAnimated)
+                {
+                    joint.m_scales.emplace_back(SampleVector3(tracks.m_scale, staticData.m_staticTransform.mScale, frames));
+                }
+#endif
+            }
+
+            for (size_t i = 0; i < m_morphTracks.size(); ++i)
+            {
+                if (m_morphTracks[i].m_format != TrackFormat::NotAnimated)
+                {
+                    outSource.m_morphs[i].emplace_back(SampleFloatTrack(m_morphTracks[i], m_staticMorphData[i].m_staticValue, frames));
+                }
+            }
+
+            for (size_t i = 0; i < m_floatTracks.size(); ++i)
+            {
+                if (m_floatTracks[i].m_format != TrackFormat::NotAnimated)
+                {
+                    outSource.m_floats[i].emplace_back(SampleFloatTrack(m_floatTracks[i], m_staticFloatData[i].m_staticValue, frames));
+                }
+            }
+        }
+    }
+
+    void CompressedUniformMotionData::Compress(const SourceTracks& source, const OptimizeSettings* settings)
+    {
+        AZ_Assert(source.m_joints.size() == m_jointTracks.size() && source.m_morphs.size() == m_morphTracks.size() && source.m_floats.size() == m_floatTracks.size(),
+            "Expected the source tracks to match the number of joints, morphs and floats.");
+
+        m_vector3Batches.clear();
+        m_quantizedFrames.clear();
+        m_rawFrames.clear();
+        m_quantizedFrameStride = 0;
+        m_rawFrameStride = 0;
+
+        struct PendingVector3Track
+        {
+            TrackInfo* m_track;
+            AZ::Vector3 m_min;
+            AZ::Vector3 m_scale;
+        };
+        AZStd::vector<PendingVector3Track> quantizedPositions;
+        AZStd::vector<PendingVector3Track> quantizedScales;
+        AZStd::vector<TrackInfo*> quantizedRotations;
+        AZStd::vector<TrackInfo*> quantizedFloats;
+
+        auto makeRaw = [this](TrackInfo& track, AZ::u32 numValues)
+        {
+            track.m_format = TrackFormat::Raw;
+            track.m_offset = m_rawFrameStride;
+            m_rawFrameStride += numValues;
+        };
+
+        // Without settings everything is stored losslessly. Otherwise pick the smallest format within the error bounds,
+        // tracks that can't be quantized accurately enough fall back to raw floats.
+        auto chooseVector3Format = [&](const AZStd::vector<AZ::Vector3>& values, bool lossless, float maxError, TrackInfo& track,
+            AZ::Vector3& inOutStaticValue, AZStd::vector<PendingVector3Track>& quantizedTracks)
+        {
+            track = TrackInfo();
+            if (values.empty() || m_numSamples == 0)
+            {
+                return;
+            }
+            AZ_Assert(values.size() == m_numSamples, "Expected a sample for every frame.");
+
+            AZ::Vector3 minValue = AZ::Vector3::CreateZero();
+            AZ::Vector3 scale = AZ::Vector3::CreateZero();
+            if (!lossless && IsConstantTrack(values, maxError))
+            {
+                inOutStaticValue = values[0];
+            }
+            else if (!lossless && CalcQuantizationRange(values, maxError, minValue, scale))
+            {
+                track.m_format = TrackFormat::Quantized;
+                quantizedTracks.push_back({ &track, minValue, scale });
+            }
+            else
+            {
+                makeRaw(track, 3);
+            }
+        };
+
+        auto chooseFloatFormat = [&](const AZStd::vector<float>& values, bool lossless, float maxError, TrackInfo& track, float& inOutStaticValue)
+        {
+            track = TrackInfo();
+            if (values.empty() || m_numSamples == 0)
+            {
+                return;
+            }
+            AZ_Assert(values.size() == m_numSamples, "Expected a sample for every frame.");
+
+            if (!lossless && IsConstantTrack(values, maxError))
+            {
+                inOutStaticValue = values[0];
+            }
+            else if (!lossless && CalcQuantizationRange(values.size(), maxError, [&values](size_t i) { return values[i]; }, track.m_min, track.m_scale))
+            {
+                track.m_format = TrackFormat::Quantized;
+                quantizedFloats.push_back(&track);
+            }
+            else
+            {
+                makeRaw(track, 1);
+            }
+        };
+
+        for (size_t i = 0; i < m_jointTracks.size(); ++i)
+        {
+            const SourceTracks::Joint& joint = source.m_joints[i];
+            JointTracks& tracks = m_jointTracks[i];
+            Transform& staticTransform = m_staticJointData[i].m_staticTransform;
+
+            // Root motion is very sensitive to errors, so ignored joints are kept lossless.
+            const bool lossless = !settings || IsInIgnoreList(settings->m_jointIgnoreList, i);
+            chooseVector3Format(joint.m_positions, lossless, settings ? settings->m_maxPosError : 0.0f, tracks.m_position, staticTransform.mPosition, quantizedPositions);
+#ifndef EMFX_SCALE_DISABLED
+            chooseVector3Format(joint.m_scales, lossless, settings ? settings->m_maxScaleError : 0.0f, tracks.m_scale, staticTransform.mScale, quantizedScales);
+#endif
+
+            tracks.m_rotation = TrackInfo();
+            if (!joint.m_rotations.empty() && m_numSamples > 0)
+            {
+                AZ_Assert(joint.m_rotations.size() == m_numSamples, "Expected a sample for every frame.");
+                if (!lossless && IsConstantTrack(joint.m_rotations, settings->m_maxRotError))
+                {
+                    staticTransform.mRotation = joint.m_rotations[0].GetNormalized();
+                }
+                else if (!lossless && CanEncodeSmallestThree(joint.m_rotations, settings->m_maxRotError))
+                {
+                    tracks.m_rotation.m_format = TrackFormat::Quantized;
+                    quantizedRotations.push_back(&tracks.m_rotation);
+                }
+                else
+                {
+                    makeRaw(tracks.m_rotation, 4);
+                }
+            }
+        }
+
+        for (size_t i = 0; i < m_morphTracks.size(); ++i)
+        {
+            const bool lossless = !settings || IsInIgnoreList(settings->m_morphIgnoreList, i);
+            chooseFloatFormat(source.m_morphs[i], lossless, settings ? settings->m_maxMorphError : 0.0f, m_morphTracks[i], m_staticMorphData[i].m_staticValue);
+        }
+
+        for (size_t i = 0; i < m_floatTracks.size(); ++i)
+        {
+            const bool lossless = !settings || IsInIgnoreList(settings->m_floatIgnoreList, i);
+            chooseFloatFormat(source.m_floats[i], lossless, settings ? settings->m_maxFloatError : 0.0f, m_floatTracks[i], m_staticFloatData[i].m_staticValue);
+        }
+
+        // Lay out the quantized frame: position batches, scale batches, rotations and finally morphs and floats.
+        auto assignBatches = [this](const AZStd::vector<PendingVector3Track>& pendingTracks)
+        {
+            for (size_t p = 0; p < pendingTracks.size(); ++p)
+            {
+                const AZ::u32 lane = static_cast<AZ::u32>(p % BatchSize);
+                if (lane == 0)
+                {
+                    Vector3Batch& newBatch = m_vector3Batches.emplace_back();
+                    newBatch.m_offset = m_quantizedFrameStride;
+                    m_quantizedFrameStride += 3 * BatchSize;
+                }
+
+                Vector3Batch& batch = m_vector3Batches.back();
+                const PendingVector3Track& pending = pendingTracks[p];
+                for (int c = 0; c < 3; ++c)
+                {
+                    batch.m_min[c * BatchSize + lane] = pending.m_min.GetElement(c);
+                    batch.m_scale[c * BatchSize + lane] = pending.m_scale.GetElement(c);
+                }
+                pending.m_track->m_offset = static_cast<AZ::u32>(m_vector3Batches.size() - 1);
+                pending.m_track->m_lane = static_cast<AZ::u8>(lane);
+            }
+        };
+        assignBatches(quantizedPositions);
+        assignBatches(quantizedScales);
+
+        for (TrackInfo* track : quantizedRotations)
+        {
+            track->m_offset = m_quantizedFrameStride;
+            m_quantizedFrameStride += 3;
+        }
+
+        for (TrackInfo* track : quantizedFloats)
+        {
+            track->m_offset = m_quantizedFrameStride;
+            m_quantizedFrameStride += 1;
+        }
+
+        // Write the interleaved frames.
+        m_quantizedFrames.resize(m_numSamples * m_quantizedFrameStride, 0);
+        m_rawFrames.resize(m_numSamples * m_rawFrameStride, 0.0f);
+
+        for (size_t s = 0; s < m_numSamples; ++s)
+        {
+            AZ::u16* quantizedFrame = m_quantizedFrames.data() + s * m_quantizedFrameStride;
+            float* rawFrame = m_rawFrames.data() + s * m_rawFrameStride;
+
+            auto writeVector3 = [this, quantizedFrame, rawFrame](const TrackInfo& track, const AZ::Vector3& value)
+            {
+                if (track.m_format == TrackFormat::Quantized)
+                {
+                    const Vector3Batch& batch = m_vector3Batches[track.m_offset];
+                    for (int c = 0; c < 3; ++c)
+                    {
+                        const AZ::u32 index = c * BatchSize + track.m_lane;
+                        quantizedFrame[batch.m_offset + index] = QuantizeValue(value.GetElement(c), batch.m_min[index], batch.m_scale[index]);
+                    }
+                }
+                else if (track.m_format == TrackFormat::Raw)
+                {
+                    value.StoreToFloat3(rawFrame + track.m_offset);
+                }
+            };
+
+            auto writeFloat = [quantizedFrame, rawFrame](const TrackInfo& track, float value)
+            {
+                if (track.m_format == TrackFormat::Quantized)
+                {
+                    quantizedFrame[track.m_offset] = QuantizeValue(value, track.m_min, track.m_scale);
+                }
+                else if (track.m_format == TrackFormat::Raw)
+                {
+                    rawFrame[track.m_offset] = value;
+                }
+            };
+
+            for (size_t i = 0; i < m_jointTracks.size(); ++i)
+            {
+                const SourceTracks::Joint& joint = source.m_joints[i];
+                const JointTracks& tracks = m_jointTracks[i];
+                if (tracks.m_position.m_format != TrackFormat::NotAnimated)
+                {
+                    writeVector3(tracks.m_position, joint.m_positions[s]);
+                }
+#ifndef EMFX_SCALE_DISABLED
+                if (tracks.m_scale.m_format != TrackFormat::NotAnimated)
+                {
+                    writeVector3(tracks.m_scale, joint.m_scales[s]);
+                }
+#endif
+                if (tracks.m_rotation.m_format == TrackFormat::Quantized)
+                {
+                    EncodeSmallestThree(joint.m_rotations[s], quantizedFrame + tracks.m_rotation.m_offset);
+                }
+                else if (tracks.m_rotation.m_format == TrackFormat::Raw)
+                {
+                    joint.m_rotations[s].GetNormalized().StoreToFloat4(rawFrame + tracks.m_rotation.m_offset);
+                }
+            }
+
+            for (size_t i = 0; i < m_morphTracks.size(); ++i)
+            {
+                if (m_morphTracks[i].m_format != TrackFormat::NotAnimated)
+                {
+                    writeFloat(m_morphTracks[i], source.m_morphs[i][s]);
+                }
+            }
+
+            for (size_t i = 0; i < m_floatTracks.size(); ++i)
+            {
+                if (m_floatTracks[i].m_format != TrackFormat::NotAnimated)
+                {
+                    writeFloat(m_floatTracks[i], source.m_floats[i][s]);
+                }
+            }
+        }
+    }
+
+    CompressedUniformMotionData::FramePair CompressedUniformMotionData::GetFramePair(float sampleTime) const
+    {
+        FramePair frames;
+        if (m_numSamples == 0)
+        {
+            return frames;
+        }
+
+        // Calculate the sample indices to interpolate between, and the interpolation fraction.
+        size_t indexA;
+        size_t indexB;
+        CalculateInterpolationIndicesUniform(sampleTime, m_sampleSpacing, m_duration, m_numSamples, indexA, indexB, frames.m_t);
+        frames.m_quantizedA = m_quantizedFrames.data() + indexA * m_quantizedFrameStride;
+        frames.m_quantizedB = m_quantizedFrames.data() + indexB * m_quantizedFrameStride;
+        frames.m_rawA = m_rawFrames.data() + indexA * m_rawFrameStride;
+        frames.m_rawB = m_rawFrames.data() + indexB * m_rawFrameStride;
+        return frames;
+    }
+
+    CompressedUniformMotionData::FramePair CompressedUniformMotionData::GetFramePair(size_t sampleIndex) const
+    {
+        AZ_Assert(sampleIndex < m_numSamples, "Sample index %zu is out of range.", sampleIndex);
+        FramePair frames;
+        frames.m_quantizedA = m_quantizedFrames.data() + sampleIndex * m_quantizedFrameStride;
+        frames.m_quantizedB = frames.m_quantizedA;
+        frames.m_rawA = m_rawFrames.data() + sampleIndex * m_rawFrameStride;
+        frames.m_rawB = frames.m_rawA;
+        return frames;
+    }
+
+    AZ::Vector3 CompressedUniformMotionData::SampleVector3(const TrackInfo& track, const AZ::Vector3& staticValue, const FramePair& frames) const
+    {
+        switch (track.m_format)
+        {
+            case TrackFormat::Raw:
+            {
+                const AZ::Vector3 valueA = AZ::Vector3::CreateFromFloat3(frames.m_rawA + track.m_offset);
+                const AZ::Vector3 valueB = AZ::Vector3::CreateFromFloat3(frames.m_rawB + track.m_offset);
+                return valueA.Lerp(valueB, frames.m_t);
+            }
+
+            case TrackFormat::Quantized:
+            {
+                const Vector3Batch& batch = m_vector3Batches[track.m_offset];
+                AZ::Vector3 result;
+                for (int c = 0; c < 3; ++c)
+                {
+                    const AZ::u32 index = batch.m_offset + c * BatchSize + track.m_lane;
+                    const float quantized = AZ::Lerp(static_cast<float>(frames.m_quantizedA[index]), static_cast<float>(frames.m_quantizedB[index]), frames.m_t);
+                    result.SetElement(c, DequantizeValue(quantized, batch.m_min[c * BatchSize + track.m_lane], batch.m_scale[c * BatchSize + track.m_lane]));
+                }
+                return result;
+            }
+
+            default:
+            {
+                return staticValue;
+            }
+        }
+    }
+
+    AZ::Vector3 CompressedUniformMotionData::SampleVector3(const TrackInfo& track, const AZ::Vector3& staticValue, const FramePair& frames, Vector3BatchCache& cache) const
+    {
+        if (track.m_format != TrackFormat::Quantized)
+        {
+            return SampleVector3(track, staticValue, frames);
+        }
+
+        // Joints are mostly sampled in order, so every batch only gets decoded once per pose.
+        if (cache.m_batchIndex != track.m_offset)
+        {
+            SampleVector3Batch(track.m_offset, frames, cache.m_values);
+            cache.m_batchIndex = track.m_offset;
+        }
+        return cache.m_values[track.m_lane];
+    }
+
+    void CompressedUniformMotionData::SampleVector3Batch(AZ::u32 batchIndex, const FramePair& frames, AZ::Vector3* outValues) const
+    {
+        using namespace AZ::Simd;
+
+        const Vector3Batch& batch = m_vector3Batches[batchIndex];
+        const Vec4::FloatType t = Vec4::Splat(frames.m_t);
+
+        float components[3][BatchSize];
+        for (AZ::u32 c = 0; c < 3; ++c)
+        {
+            const AZ::u16* quantizedA = frames.m_quantizedA + batch.m_offset + c * BatchSize;
+            const AZ::u16* quantizedB = frames.m_quantizedB + batch.m_offset + c * BatchSize;
+            const Vec4::FloatType valueA = Vec4::ConvertToFloat(Vec4::LoadImmediate(quantizedA[0], quantizedA[1], quantizedA[2], quantizedA[3]));
+            const Vec4::FloatType valueB = Vec4::ConvertToFloat(Vec4::LoadImmediate(quantizedB[0], quantizedB[1], quantizedB[2], quantizedB[3]));
+
+            // Interpolate the quantized values first, dequantizing is linear so this matches interpolating the decoded values.
+            const Vec4::FloatType quantized = Vec4::Madd(Vec4::Sub(valueB, valueA), t, valueA);
+            const Vec4::FloatType decoded = Vec4::Madd(quantized, Vec4::LoadUnaligned(&batch.m_scale[c * BatchSize]), Vec4::LoadUnaligned(&batch.m_min[c * BatchSize]));
+            Vec4::StoreUnaligned(components[c], decoded);
+        }
+
+        for (AZ::u32 lane = 0; lane < BatchSize; ++lane)
+        {
+            outValues[lane].Set(components[0][lane], components[1][lane], components[2][lane]);
+        }
+    }
+
+    AZ::Quaternion CompressedUniformMotionData::SampleRotation(const TrackInfo& track, const AZ::Quaternion& staticValue, const FramePair& frames) const
+    {
+        switch (track.m_format)
+        {
+            case TrackFormat::Raw:
+            {
+                const AZ::Quaternion valueA = AZ::Quaternion::CreateFromFloat4(frames.m_rawA + track.m_offset);
+                const AZ::Quaternion valueB = AZ::Quaternion::CreateFromFloat4(frames.m_rawB + track.m_offset);
+                return valueA.NLerp(valueB, frames.m_t);
+            }
+
+            case TrackFormat::Quantized:
+            {
+                const AZ::Quaternion valueA = DecodeSmallestThree(frames.m_quantizedA + track.m_offset);
+                const AZ::Quaternion valueB = DecodeSmallestThree(frames.m_quantizedB + track.m_offset);
+                return valueA.NLerp(valueB, frames.m_t);
+            }
+
+            default:
+            {
+                return staticValue;
+            }
+        }
+    }
+
+    float CompressedUniformMotionData::SampleFloatTrack(const TrackInfo& track, float staticValue, const FramePair& frames) const
+    {
+        switch (track.m_format)
+        {
+            case TrackFormat::Raw:
+            {
+                return AZ::Lerp(frames.m_rawA[track.m_offset], frames.m_rawB[track.m_offset], frames.m_t);
+            }
+
+            case TrackFormat::Quantized:
+            {
+                const float quantized = AZ::Lerp(static_cast<float>(frames.m_quantizedA[track.m_offset]), static_cast<float>(frames.m_quantizedB[track.m_offset]), frames.m_t);
+                return DequantizeValue(quantized, track.m_min, track.m_scale);
+            }
+
+            default:
+            {
+                return staticValue;
+            }
+        }
+    }
+
+    Transform CompressedUniformMotionData::SampleJointTransform(const SampleSettings& settings, AZ::u32 jointSkeletonIndex) const
+    {
+        const Actor* actor = settings.m_actorInstance->GetActor();
+        const MotionLinkData* motionLinkData = FindMotionLinkData(actor);
+
+        const AZ::u32 transformDataIndex = motionLinkData->GetJointDataLinks()[jointSkeletonIndex];
+        if (m_additive && transformDataIndex == InvalidIndex32)
+        {
+            return Transform::CreateIdentity();
+        }
+
+        const Skeleton* skeleton = actor->GetSkeleton();
+        const bool inPlace = (settings.m_inPlace && skeleton->GetNode(jointSkeletonIndex)->GetIsRootNode());
+
+        // Sample the interpolated data.
+        Transform result;
+        if (transformDataIndex != InvalidIndex32 && !inPlace)
+        {
+            result = SampleJointTransform(settings.m_sampleTime, transformDataIndex);
+        }
+        else
+        {
+            if (settings.m_inputPose && !inPlace)
+            {
+                result = settings.m_inputPose->GetLocalSpaceTransform(jointSkeletonIndex);
+            }
+            else
+            {
+                result = settings.m_actorInstance->GetTransformData()->GetBindPose()->GetLocalSpaceTransform(jointSkeletonIndex);
+            }
+        }
+
+        // Apply retargeting.
+        if (settings.m_retarget)
+        {
+            BasicRetarget(settings.m_actorInstance, motionLinkData, jointSkeletonIndex, result);
+        }
+
+        // Apply runtime motion mirroring.
+        if (settings.m_mirror && actor->GetHasMirrorInfo())
+        {
+            const Pose* bindPose = settings.m_actorInstance->GetTransformData()->GetBindPose();
+            const Actor::NodeMirrorInfo& mirrorInfo = actor->GetNodeMirrorInfo(jointSkeletonIndex);
+            Transform mirrored = bindPose->GetLocalSpaceTransform(jointSkeletonIndex);
+            AZ::Vector3 mirrorAxis = AZ::Vector3::CreateZero();
+            mirrorAxis.SetElement(mirrorInfo.mAxis, 1.0f);
+            const AZ::u16 motionSource = actor->GetNodeMirrorInfo(jointSkeletonIndex).mSourceNode;
+            mirrored.ApplyDeltaMirrored(bindPose->GetLocalSpaceTransform(motionSource), result, mirrorAxis, mirrorInfo.mFlags);
+            result = mirrored;
+        }
+
+        return result;
+    }
+
+    void CompressedUniformMotionData::SamplePose(const SampleSettings& settings, Pose* outputPose) const
+    {
+        AZ_Assert(settings.m_actorInstance, "Expecting a valid actor instance.");
+        const Actor* actor = settings.m_actorInstance->GetActor();
+        const MotionLinkData* motionLinkData = FindMotionLinkData(actor);
+
+        const FramePair frames = GetFramePair(settings.m_sampleTime);
+        Vector3BatchCache positionCache;
+#ifndef EMFX_SCALE_DISABLED
+        Vector3BatchCache scaleCache;
+#endif
+
+        const AZStd::vector<AZ::u32>& jointLinks = motionLinkData->GetJointDataLinks();
+        const ActorInstance* actorInstance = settings.m_actorInstance;
+        const Skeleton* skeleton = actor->GetSkeleton();
+        const Pose* bindPose = actorInstance->GetTransformData()->GetBindPose();
+        const AZ::u32 numNodes = actorInstance->GetNumEnabledNodes();
+        for (AZ::u32 i = 0; i < numNodes; ++i)
+        {
+            const AZ::u32 skeletonJointIndex = actorInstance->GetEnabledNode(i);
+            const bool inPlace = (settings.m_inPlace && skeleton->GetNode(skeletonJointIndex)->GetIsRootNode());
+
+            // Sample the interpolated data.
+            Transform result;
+            const AZ::u32 jointDataIndex = jointLinks[skeletonJointIndex];
+            if (jointDataIndex != InvalidIndex32 && !inPlace)
+            {
+                const StaticJointData& staticJointData = m_staticJointData[jointDataIndex];
+                const JointTracks& tracks = m_jointTracks[jointDataIndex];
+                result.mPosition = SampleVector3(tracks.m_position, staticJointData.m_staticTransform.mPosition, frames, positionCache);
+                result.mRotation = SampleRotation(tracks.m_rotation, staticJointData.m_staticTransform.mRotation, frames);
+#ifndef EMFX_SCALE_DISABLED
+                result.mScale = SampleVector3(tracks.m_scale, staticJointData.m_staticTransform.mScale, frames, scaleCache);
+#endif
+            }
+            else
+            {
+                if (m_additive && jointDataIndex == InvalidIndex32)
+                {
+                    result = Transform::CreateIdentity();
+                }
+                else
+                {
+                    if (settings.m_inputPose && !inPlace)
+                    {
+                        result = settings.m_inputPose->GetLocalSpaceTransform(skeletonJointIndex);
+                    }
+                    else
+                    {
+                        result = bindPose->GetLocalSpaceTransform(skeletonJointIndex);
+                    }
+                }
+            }
+
+            // Apply retargeting.
+            if (settings.m_retarget)
+            {
+                BasicRetarget(settings.m_actorInstance, motionLinkData, skeletonJointIndex, result);
+            }
+
+            outputPose->SetLocalSpaceTransformDirect(skeletonJointIndex, result);
+        }
+
+        // Apply runtime motion mirroring.
+        if (settings.m_mirror && actor->GetHasMirrorInfo())
+        {
+            outputPose->Mirror(motionLinkData);
+        }
+
+        // Output morph target weights.
+        const MorphSetupInstance* morphSetup = actorInstance->GetMorphSetupInstance();
+        const AZ::u32 numMorphTargets = morphSetup->GetNumMorphTargets();
+        for (AZ::u32 i = 0; i < numMorphTargets; ++i)
+        {
+            const AZ::u32 morphTargetId = morphSetup->GetMorphTarget(i)->GetID();
+            const AZ::Outcome<size_t> morphIndex = FindMorphIndexByNameId(morphTargetId);
+            if (morphIndex.IsSuccess())
+            {
+                const size_t realIndex = morphIndex.GetValue();
+                outputPose->SetMorphWeight(i, SampleFloatTrack(m_morphTracks[realIndex], m_staticMorphData[realIndex].m_staticValue, frames));
+            }
+            else
+            {
+                if (settings.m_inputPose)
+                {
+                    outputPose->SetMorphWeight(i, settings.m_inputPose->GetMorphWeight(i));
+                }
+                else
+                {
+                    outputPose->SetMorphWeight(i, bindPose->GetMorphWeight(i));
+                }
+            }
+        }
+
+        // Since we used the SetLocalTransformDirect, make sure we manually invalidate all model space transforms.
+        outputPose->InvalidateAllModelSpaceTransforms();
+    }
+
+    float CompressedUniformMotionData::SampleMorph(float sampleTime, size_t morphDataIndex) const
+    {
+        return SampleFloatTrack(m_morphTracks[morphDataIndex], m_staticMorphData[morphDataIndex].m_staticValue, GetFramePair(sampleTime));
+    }
+
+    float CompressedUniformMotionData::SampleFloat(float sampleTime, size_t floatDataIndex) const
+    {
+        return SampleFloatTrack(m_floatTracks[floatDataIndex], m_staticFloatData[floatDataIndex].m_staticValue, GetFramePair(sampleTime));
+    }
+
+    AZ::Vector3 CompressedUniformMotionData::SampleJointPosition(float sampleTime, size_t jointDataIndex) const
+    {
+        return SampleVector3(m_jointTracks[jointDataIndex].m_position, m_staticJointData[jointDataIndex].m_staticTransform.mPosition, GetFramePair(sampleTime));
+    }
+
+    AZ::Quaternion CompressedUniformMotionData::SampleJointRotation(float sampleTime, size_t jointDataIndex) const
+    {
+        return SampleRotation(m_jointTracks[jointDataIndex].m_rotation, m_staticJointData[jointDataIndex].m_staticTransform.mRotation, GetFramePair(sampleTime));
+    }
+
+#ifndef EMFX_SCALE_DISABLED
+    AZ::Vector3 CompressedUniformMotionData::SampleJointScale(float sampleTime, size_t jointDataIndex) const
+    {
+        return SampleVector3(m_jointTracks[jointDataIndex].m_scale, m_staticJointData[jointDataIndex].m_staticTransform.mScale, GetFramePair(sampleTime));
+    }
+#endif
+
+    Transform CompressedUniformMotionData::SampleJointTransform(float sampleTime, size_t jointDataIndex) const
+    {
+        const FramePair frames = GetFramePair(sampleTime);
+        const JointTracks& tracks = m_jointTracks[jointDataIndex];
+        const StaticJointData& staticData = m_staticJointData[jointDataIndex];
+
+        return Transform
+        (
+            SampleVector3(tracks.m_position, staticData.m_staticTransform.mPosition, frames),
+            SampleRotation(tracks.m_rotation, staticData.m_staticTransform.mRotation, frames)
+#ifndef EMFX_SCALE_DISABLED
+            ,SampleVector3(tracks.m_scale, staticData.m_staticTransform.mScale, frames)
+#endif
+        );
+    }
+
+    void CompressedUniformMotionData::ResizeSampleData(size_t numJoints, size_t numMorphs, size_t numFloats)
+    {
+        m_jointTracks.resize(numJoints);
+        m_morphTracks.resize(numMorphs);
+        m_floatTracks.resize(numFloats);
+    }
+
+    void CompressedUniformMotionData::AddJointSampleData([[maybe_unused]] size_t jointDataIndex)
+    {
+        AZ_Assert(jointDataIndex == m_jointTracks.size(), "Expected the size of the jointTracks vector to be a different size. Is it in sync with the m_staticJointData vector?");
+        m_jointTracks.emplace_back();
+    }
+
+    void CompressedUniformMotionData::AddMorphSampleData([[maybe_unused]] size_t morphDataIndex)
+    {
+        AZ_Assert(morphDataIndex == m_morphTracks.size(), "Expected the size of the morphTracks vector to be a different size. Is it in sync with the m_staticMorphData vector?");
+        m_morphTracks.emplace_back();
+    }
+
+    void CompressedUniformMotionData::AddFloatSampleData([[maybe_unused]] size_t floatDataIndex)
+    {
+        AZ_Assert(floatDataIndex == m_floatTracks.size(), "Expected the size of the floatTracks vector to be a different size. Is it in sync with the m_staticFloatData vector?");
+        m_floatTracks.emplace_back();
+    }
+
+    void CompressedUniformMotionData::RemoveJointSampleData(size_t jointDataIndex)
+    {
+        m_jointTracks.erase(m_jointTracks.begin() + jointDataIndex);
+    }
+
+    void CompressedUniformMotionData::RemoveMorphSampleData(size_t morphDataIndex)
+    {
+        m_morphTracks.erase(m_morphTracks.begin() + morphDataIndex);
+    }
+
+    void CompressedUniformMotionData::RemoveFloatSampleData(size_t floatDataIndex)
+    {
+        m_floatTracks.erase(m_floatTracks.begin() + floatDataIndex);
+    }
+
+    void CompressedUniformMotionData::ClearAllData()
+    {
+        m_jointTracks.clear();
+        m_jointTracks.shrink_to_fit();
+        m_morphTracks.clear();
+        m_morphTracks.shrink_to_fit();
+        m_floatTracks.clear();
+        m_floatTracks.shrink_to_fit();
+        m_vector3Batches.clear();
+        m_vector3Batches.shrink_to_fit();
+        m_quantizedFrames.clear();
+        m_quantizedFrames.shrink_to_fit();
+        m_rawFrames.clear();
+        m_rawFrames.shrink_to_fit();
+
+        m_quantizedFrameStride = 0;
+        m_rawFrameStride = 0;
+        m_numSamples = 0;
+    }
+
+    void CompressedUniformMotionData::ScaleData(float scaleFactor)
+    {
+        for (const JointTracks& tracks : m_jointTracks)
+        {
+            const TrackInfo& track = tracks.m_position;
+            if (track.m_format == TrackFormat::Quantized)
+            {
+                // Scaling the range scales all decoded values, batches never mix position and scale tracks.
+                Vector3Batch& batch = m_vector3Batches[track.m_offset];
+                for (AZ::u32 c = 0; c < 3; ++c)
+                {
+                    batch.m_min[c * BatchSize + track.m_lane] *= scaleFactor;
+                    batch.m_scale[c * BatchSize + track.m_lane] *= scaleFactor;
+                }
+            }
+            else if (track.m_format == TrackFormat::Raw)
+            {
+                for (size_t s = 0; s < m_numSamples; ++s)
+                {
+                    float* position = m_rawFrames.data() + s * m_rawFrameStride + track.m_offset;
+                    position[0] *= scaleFactor;
+                    position[1] *= scaleFactor;
+                    position[2] *= scaleFactor;
+                }
+            }
+        }
+    }
+
+    void CompressedUniformMotionData::ClearAllJointTransformSamples()
+    {
+        for (JointTracks& tracks : m_jointTracks)
+        {
+            tracks = JointTracks();
+        }
+    }
+
+    void CompressedUniformMotionData::ClearAllMorphSamples()
+    {
+        for (TrackInfo& track : m_morphTracks)
+        {
+            track = TrackInfo();
+        }
+    }
+
+    void CompressedUniformMotionData::ClearAllFloatSamples()
+    {
+        for (TrackInfo& track : m_floatTracks)
+        {
+            track = TrackInfo();
+        }
+    }
+
+    void CompressedUniformMotionData::ClearJointPositionSamples(size_t jointDataIndex)
+    {
+        m_jointTracks[jointDataIndex].m_position = TrackInfo();
+    }
+
+    void CompressedUniformMotionData::ClearJointRotationSamples(size_t jointDataIndex)
+    {
+        m_jointTracks[jointDataIndex].m_rotation = TrackInfo();
+    }
+
+#ifndef EMFX_SCALE_DISABLED
+    void CompressedUniformMotionData::ClearJointScaleSamples(size_t jointDataIndex)
+    {
+        m_jointTracks[jointDataIndex].m_scale = TrackInfo();
+    }
+#endif
+
+    void CompressedUniformMotionData::ClearJointTransformSamples(size_t jointDataIndex)
+    {
+        m_jointTracks[jointDataIndex] = JointTracks();
+    }
+
+    void CompressedUniformMotionData::ClearMorphSamples(size_t morphDataIndex)
+    {
+        m_morphTracks[morphDataIndex] = TrackInfo();
+    }
+
+    void CompressedUniformMotionData::ClearFloatSamples(size_t floatDataIndex)
+    {
+        m_floatTracks[floatDataIndex] = TrackInfo();
+    }
+
+    bool CompressedUniformMotionData::IsJointPositionAnimated(size_t jointDataIndex) const
+    {
+        return m_jointTracks[jointDataIndex].m_position.m_format != TrackFormat::NotAnimated;
+    }
+
+    bool CompressedUniformMotionData::IsJointRotationAnimated(size_t jointDataIndex) const
+    {
+        return m_jointTracks[jointDataIndex].m_rotation.m_format != TrackFormat::NotAnimated;
+    }
+
+#ifndef EMFX_SCALE_DISABLED
+    bool CompressedUniformMotionData::IsJointScaleAnimated(size_t jointDataIndex) const
+    {
+        return m_jointTracks[jointDataIndex].m_scale.m_format != TrackFormat::NotAnimated;
+    }
+#endif
+
+    bool CompressedUniformMotionData::IsJointAnimated(size_t jointDataIndex) const
+    {
+#ifndef EMFX_SCALE_DISABLED
+        return IsJointPositionAnimated(jointDataIndex) || IsJointRotationAnimated(jointDataIndex) || IsJointScaleAnimated(jointDataIndex);
+#else
+        return IsJointPositionAnimated(jointDataIndex) || IsJointRotationAnimated(jointDataIndex);
+#endif
+    }
+
+    bool CompressedUniformMotionData::IsMorphAnimated(size_t morphDataIndex) const
+    {
+        return m_morphTracks[morphDataIndex].m_format != TrackFormat::NotAnimated;
+    }
+
+    bool CompressedUniformMotionData::IsFloatAnimated(size_t floatDataIndex) const
+    {
+        return m_floatTracks[floatDataIndex].m_format != TrackFormat::NotAnimated;
+    }
+
+    CompressedUniformMotionData::TrackFormat CompressedUniformMotionData::GetJointPositionFormat(size_t jointDataIndex) const
+    {
+        return m_jointTracks[jointDataIndex].m_position.m_format;
+    }
+
+    CompressedUniformMotionData::TrackFormat CompressedUniformMotionData::GetJointRotationFormat(size_t jointDataIndex) const
+    {
+        return m_jointTracks[jointDataIndex].m_rotation.m_format;
+    }
+
+#ifndef EMFX_SCALE_DISABLED
+    CompressedUniformMotionData::TrackFormat CompressedUniformMotionData::GetJointScaleFormat(size_t jointDataIndex) const
+    {
+        return m_jointTracks[jointDataIndex].m_scale.m_format;
+    }
+#endif
+
+    CompressedUniformMotionData::TrackFormat CompressedUniformMotionData::GetMorphFormat(size_t morphDataIndex) const
+    {
+        return m_morphTracks[morphDataIndex].m_format;
+    }
+
+    CompressedUniformMotionData::TrackFormat CompressedUniformMotionData::GetFloatFormat(size_t floatDataIndex) const
+    {
+        return m_floatTracks[floatDataIndex].m_format;
+    }
+
+    size_t CompressedUniformMotionData::GetSampleDataSizeInBytes() const
+    {
+        return m_jointTracks.size() * sizeof(JointTracks) +
+            (m_morphTracks.size() + m_floatTracks.size()) * sizeof(TrackInfo) +
+            m_vector3Batches.size() * sizeof(Vector3Batch) +
+            m_quantizedFrames.size() * sizeof(AZ::u16) +
+            m_rawFrames.size() * sizeof(float);
+    }
+
+    size_t CompressedUniformMotionData::GetNumSamples() const
+    {
+        return m_numSamples;
+    }
+
+    float CompressedUniformMotionData::GetSampleSpacing() const
+    {
+        return m_sampleSpacing;
+    }
+
+    void CompressedUniformMotionData::UpdateSampleSpacing()
+    {
+        if (m_sampleRate > AZ::Constants::FloatEpsilon)
+        {
+            m_sampleSpacing = 1.0f / m_sampleRate;
+        }
+        else
+        {
+            m_sampleSpacing = 0.0f;
+        }
+    }
+
+    void CompressedUniformMotionData::SetSampleRate(float sampleRate)
+    {
+        MotionData::SetSampleRate(sampleRate);
+        UpdateSampleSpacing();
+    }
+
+    void CompressedUniformMotionData::UpdateDuration()
+    {
+        m_duration = (m_numSamples > 0) ? (m_numSamples - 1) * m_sampleSpacing : 0.0f;
+    }
+
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // SERIALIZATION
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    struct File_CompressedUniformMotionData_Info
+    {
+        AZ::u32 m_numJoints = 0;
+        AZ::u32 m_numMorphs = 0;
+        AZ::u32 m_numFloats = 0;
+        AZ::u32 m_numSamples = 0;
+        float m_sampleRate = 30.0f;
+        AZ::u32 m_numVector3Batches = 0;
+        AZ::u32 m_quantizedFrameStride = 0;
+        AZ::u32 m_rawFrameStride = 0;
+
+        // Followed by:
+        // File_CompressedUniformMotionData_Joint[m_numJoints]
+        // File_CompressedUniformMotionData_Float[m_numMorphs]
+        // File_CompressedUniformMotionData_Float[m_numFloats]
+        // File_CompressedUniformMotionData_Vector3Batch[m_numVector3Batches]
+        // AZ::u16[m_numSamples * m_quantizedFrameStride]
+        // float[m_numSamples * m_rawFrameStride]
+    };
+
+    struct File_CompressedUniformMotionData_Track
+    {
+        AZ::u32 m_offset = 0;
+        float m_min = 0.0f;
+        float m_scale = 0.0f;
+        AZ::u8 m_lane = 0;
+        AZ::u8 m_format = 0;    // See CompressedUniformMotionData::TrackFormat.
+        AZ::u8 m_padding[2] = { 0, 0 };
+    };
+
+    struct File_CompressedUniformMotionData_Joint
+    {
+        FileFormat::File16BitQuaternion m_staticRot { 0, 0, 0, (1 << 15) - 1 };  // First frames rotation.
+        FileFormat::File16BitQuaternion m_bindPoseRot { 0, 0, 0, (1 << 15) - 1 };// Bind pose rotation.
+        FileFormat::FileVector3         m_staticPos { 0.0f, 0.0f, 0.0f };        // First frame position.
+        FileFormat::FileVector3         m_staticScale { 1.0f, 1.0f, 1.0f };      // First frame scale.
+        FileFormat::FileVector3         m_bindPosePos { 0.0f, 0.0f, 0.0f };      // Bind pose position.
+        FileFormat::FileVector3         m_bindPoseScale { 1.0f, 1.0f, 1.0f };    // Bind pose scale.
+        File_CompressedUniformMotionData_Track m_positionTrack;
+        File_CompressedUniformMotionData_Track m_rotationTrack;
+        File_CompressedUniformMotionData_Track m_scaleTrack;
+
+        // Followed by:
+        // string : The name of the joint.
+    };
+
+    struct File_CompressedUniformMotionData_Float
+    {
+        float m_staticValue = 0.0f; // The static (first frame) value.
+        File_CompressedUniformMotionData_Track m_track;
+
+        // Followed by:
+        // String: The name of the channel.
+    };
+
+    struct File_CompressedUniformMotionData_Vector3Batch
+    {
+        AZ::u32 m_offset = 0;
+        float m_min[12];
+        float m_scale[12];
+    };
+    //---------------------------------------------------------------------------------------
+
+    size_t CompressedUniformMotionData::CalcStreamSaveSizeInBytes([[maybe_unused]] const SaveSettings& saveSettings) const
+    {
+        size_t numBytes = sizeof(File_CompressedUniformMotionData_Info);
+
+        for (size_t i = 0; i < GetNumJoints(); ++i)
+        {
+            numBytes += sizeof(File_CompressedUniformMotionData_Joint);
+            numBytes += ExporterLib::GetStringChunkSize(GetJointName(i));
+        }
+
+        for (size_t i = 0; i < GetNumMorphs(); ++i)
+        {
+            numBytes += sizeof(File_CompressedUniformMotionData_Float);
+            numBytes += ExporterLib::GetStringChunkSize(GetMorphName(i));
+        }
+
+        for (size_t i = 0; i < GetNumFloats(); ++i)
+        {
+            numBytes += sizeof(File_CompressedUniformMotionData_Float);
+            numBytes += ExporterLib::GetStringChunkSize(GetFloatName(i));
+        }
+
+        numBytes += m_vector3Batches.size() * sizeof(File_CompressedUniformMotionData_Vector3Batch);
+        numBytes += m_quantizedFrames.size() * sizeof(AZ::u16);
+        numBytes += m_rawFrames.size() * sizeof(float);
+        return numBytes;
+    }
+
+    AZ::u32 CompressedUniformMotionData::GetStreamSaveVersion() const
+    {
+        return 1;
+    }
+
+    bool CompressedUniformMotionData::Save(MCore::Stream* stream, const SaveSettings& saveSettings) const
+    {
+        const MCore::Endian::EEndianType targetEndianType = saveSettings.m_targetEndianType;
+
+        auto toFileTrack = [targetEndianType](const TrackInfo& track)
+        {
+            File_CompressedUniformMotionData_Track fileTrack;
+            fileTrack.m_offset = track.m_offset;
+            fileTrack.m_min = track.m_min;
+            fileTrack.m_scale = track.m_scale;
+            fileTrack.m_lane = track.m_lane;
+            fileTrack.m_format = static_cast<AZ::u8>(track.m_format);
+            ExporterLib::ConvertUnsignedInt(&fileTrack.m_offset, targetEndianType);
+            ExporterLib::ConvertFloat(&fileTrack.m_min, targetEndianType);
+            ExporterLib::ConvertFloat(&fileTrack.m_scale, targetEndianType);
+            return fileTrack;
+        };
+
+        // Write the info chunk.
+        File_CompressedUniformMotionData_Info info;
+        info.m_numJoints = static_cast<AZ::u32>(GetNumJoints());
+        info.m_numMorphs = static_cast<AZ::u32>(GetNumMorphs());
+        info.m_numFloats = static_cast<AZ::u32>(GetNumFloats());
+        info.m_numSamples = static_cast<AZ::u32>(GetNumSamples());
+        info.m_sampleRate = GetSampleRate();
+        info.m_numVector3Batches = static_cast<AZ::u32>(m_vector3Batches.size());
+        info.m_quantizedFrameStride = m_quantizedFrameStride;
+        info.m_rawFrameStride = m_rawFrameStride;
+
+        if (saveSettings.m_logDetails)
+        {
+            MCore::LogDetailedInfo("- CompressedUniformMotionData:");
+            MCore::LogDetailedInfo("  + NumSamples           = %d", info.m_numSamples);
+            MCore::LogDetailedInfo("  + NumVector3Batches    = %d", info.m_numVector3Batches);
+            MCore::LogDetailedInfo("  + QuantizedFrameStride = %d", info.m_quantizedFrameStride);
+            MCore::LogDetailedInfo("  + RawFrameStride       = %d", info.m_rawFrameStride);
+        }
+
+        ExporterLib::ConvertUnsignedInt(&info.m_numJoints, targetEndianType);
+        ExporterLib::ConvertUnsignedInt(&info.m_numMorphs, targetEndianType);
+        ExporterLib::ConvertUnsignedInt(&info.m_numFloats, targetEndianType);
+        ExporterLib::ConvertUnsignedInt(&info.m_numSamples, targetEndianType);
+        ExporterLib::ConvertFloat(&info.m_sampleRate, targetEndianType);
+        ExporterLib::ConvertUnsignedInt(&info.m_numVector3Batches, targetEndianType);
+        ExporterLib::ConvertUnsignedInt(&info.m_quantizedFrameStride, targetEndianType);
+        ExporterLib::ConvertUnsignedInt(&info.m_rawFrameStride, targetEndianType);
+        if (stream->Write(&info, sizeof(File_CompressedUniformMotionData_Info)) == 0)
+        {
+            return false;
+        }
+
+        // Write the joints.
+        for (size_t i = 0; i < GetNumJoints(); ++i)
+        {
+            const JointTracks& tracks = m_jointTracks[i];
+            File_CompressedUniformMotionData_Joint jointChunk;
+            ExporterLib::CopyVector(jointChunk.m_staticPos, AZ::PackedVector3f(GetJointStaticPosition(i)));
+            ExporterLib::Copy16BitQuaternion(jointChunk.m_staticRot, MCore::Compressed16BitQuaternion(GetJointStaticRotation(i)));
+            ExporterLib::CopyVector(jointChunk.m_bindPosePos, AZ::PackedVector3f(GetJointBindPosePosition(i)));
+            ExporterLib::Copy16BitQuaternion(jointChunk.m_bindPoseRot, MCore::Compressed16BitQuaternion(GetJointBindPoseRotation(i)));
+#ifndef EMFX_SCALE_DISABLED
+            ExporterLib::CopyVector(jointChunk.m_staticScale, AZ::PackedVector3f(GetJointStaticScale(i)));
+            ExporterLib::CopyVector(jointChunk.m_bindPoseScale, AZ::PackedVector3f(GetJointBindPoseScale(i)));
+            jointChunk.m_scaleTrack = toFileTrack(tracks.m_scale);
+#endif
+            jointChunk.m_positionTrack = toFileTrack(tracks.m_position);
+            jointChunk.m_rotationTrack = toFileTrack(tracks.m_rotation);
+
+            if (saveSettings.m_logDetails)
+            {
+                MCore::LogDetailedInfo("- Motion Joint: %s", GetJointName(i).c_str());
+                MCore::LogDetailedInfo("   + Position Format: %d", jointChunk.m_positionTrack.m_format);
+                MCore::LogDetailedInfo("   + Rotation Format: %d", jointChunk.m_rotationTrack.m_format);
+                MCore::LogDetailedInfo("   + Scale Format:    %d", jointChunk.m_scaleTrack.m_format);
+            }
+
+            ExporterLib::ConvertFileVector3(&jointChunk.m_staticPos, targetEndianType);
+            ExporterLib::ConvertFile16BitQuaternion(&jointChunk.m_staticRot, targetEndianType);
+            ExporterLib::ConvertFileVector3(&jointChunk.m_staticScale, targetEndianType);
+            ExporterLib::ConvertFileVector3(&jointChunk.m_bindPosePos, targetEndianType);
+            ExporterLib::ConvertFile16BitQuaternion(&jointChunk.m_bindPoseRot, targetEndianType);
+            ExporterLib::ConvertFileVector3(&jointChunk.m_bindPoseScale, targetEndianType);
+            if (stream->Write(&jointChunk, sizeof(File_CompressedUniformMotionData_Joint)) == 0)
+            {
+                return false;
+            }
+            ExporterLib::SaveString(GetJointName(i), stream, targetEndianType);
+        }
+
+        // Write the morph and float channels.
+        auto saveFloatChannels = [&](const AZStd::vector<TrackInfo>& tracks, const AZStd::vector<StaticFloatData>& staticData, bool isMorph)
+        {
+            for (size_t i = 0; i < tracks.size(); ++i)
+            {
+                const AZStd::string& channelName = isMorph ? GetMorphName(i) : GetFloatName(i);
+                if (channelName.empty())
+                {
+                    MCore::LogError("Cannot save %s channel with empty name.", isMorph ? "morph" : "float");
+                    return false;
+                }
+
+                File_CompressedUniformMotionData_Float floatChunk;
+                floatChunk.m_staticValue = staticData[i].m_staticValue;
+                floatChunk.m_track = toFileTrack(tracks[i]);
+                ExporterLib::ConvertFloat(&floatChunk.m_staticValue, targetEndianType);
+                if (stream->Write(&floatChunk, sizeof(File_CompressedUniformMotionData_Float)) == 0)
+                {
+                    return false;
+                }
+                ExporterLib::SaveString(channelName, stream, targetEndianType);
+            }
+            return true;
+        };
+        if (!saveFloatChannels(m_morphTracks, m_staticMorphData, /*isMorph=*/true) ||
+            !saveFloatChannels(m_floatTracks, m_staticFloatData, /*isMorph=*/false))
+        {
+            return false;
+        }
+
+        // Write the batches.
+        for (const Vector3Batch& batch : m_vector3Batches)
+        {
+            File_CompressedUniformMotionData_Vector3Batch batchChunk;
+            batchChunk.m_offset = batch.m_offset;
+            AZStd::copy(batch.m_min, batch.m_min + 12, batchChunk.m_min);
+            AZStd::copy(batch.m_scale, batch.m_scale + 12, batchChunk.m_scale);
+            ExporterLib::ConvertUnsignedInt(&batchChunk.m_offset, targetEndianType);
+            MCore::Endian::ConvertFloatTo(batchChunk.m_min, targetEndianType, 12);
+            MCore::Endian::ConvertFloatTo(batchChunk.m_scale, targetEndianType, 12);
+            if (stream->Write(&batchChunk, sizeof(File_CompressedUniformMotionData_Vector3Batch)) == 0)
+            {
+                return false;
+            }
+        }
+
+        // Write the frames in one go.
+        if (!m_quantizedFrames.empty())
+        {
+            AZStd::vector<AZ::u16> quantizedFrames = m_quantizedFrames;
+            MCore::Endian::ConvertUnsignedInt16To(quantizedFrames.data(), targetEndianType, static_cast<AZ::u32>(quantizedFrames.size()));
+            if (stream->Write(quantizedFrames.data(), quantizedFrames.size() * sizeof(AZ::u16)) == 0)
+            {
+                return false;
+            }
+        }
+
+        if (!m_rawFrames.empty())
+        {
+            AZStd::vector<float> rawFrames = m_rawFrames;
+            MCore::Endian::ConvertFloatTo(rawFrames.data(), targetEndianType, static_cast<AZ::u32>(rawFrames.size()));
+            if (stream->Write(rawFrames.data(), rawFrames.size() * sizeof(float)) == 0)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool CompressedUniformMotionData::ReadVersion1(MCore::Stream* stream, const ReadSettings& readSettings)
+    {
+        // Read the info header.
+        File_CompressedUniformMotionData_Info info;
+        if (stream->Read(&info, sizeof(File_CompressedUniformMotionData_Info)) == 0)
+        {
+            return false;
+        }
+        const MCore::Endian::EEndianType sourceEndianType = readSettings.m_sourceEndianType;
+        MCore::Endian::ConvertUnsignedInt32(&info.m_numJoints, sourceEndianType);
+        MCore::Endian::ConvertUnsignedInt32(&info.m_numMorphs, sourceEndianType);
+        MCore::Endian::ConvertUnsignedInt32(&info.m_numFloats, sourceEndianType);
+        MCore::Endian::ConvertUnsignedInt32(&info.m_numSamples, sourceEndianType);
+        MCore::Endian::ConvertFloat(&info.m_sampleRate, sourceEndianType);
+        MCore::Endian::ConvertUnsignedInt32(&info.m_numVector3Batches, sourceEndianType);
+        MCore::Endian::ConvertUnsignedInt32(&info.m_quantizedFrameStride, sourceEndianType);
+        MCore::Endian::ConvertUnsignedInt32(&info.m_rawFrameStride, sourceEndianType);
+
+        if (readSettings.m_logDetails)
+        {
+            MCore::LogDetailedInfo("- CompressedUniformMotionData:");
+            MCore::LogDetailedInfo("  + NumJoints            = %d", info.m_numJoints);
+            MCore::LogDetailedInfo("  + NumMorphs            = %d", info.m_numMorphs);
+            MCore::LogDetailedInfo("  + NumFloats            = %d", info.m_numFloats);
+            MCore::LogDetailedInfo("  + NumSamples           = %d", info.m_numSamples);
+            MCore::LogDetailedInfo("  + SampleRate           = %f", info.m_sampleRate);
+            MCore::LogDetailedInfo("  + NumVector3Batches    = %d", info.m_numVector3Batches);
+            MCore::LogDetailedInfo("  + QuantizedFrameStride = %d", info.m_quantizedFrameStride);
+            MCore::LogDetailedInfo("  + RawFrameStride       = %d", info.m_rawFrameStride);
+        }
+
+        InitTracks(info.m_numJoints, info.m_numMorphs, info.m_numFloats, info.m_numSamples, info.m_sampleRate);
+        m_quantizedFrameStride = info.m_quantizedFrameStride;
+        m_rawFrameStride = info.m_rawFrameStride;
+
+        // Reject tracks pointing outside of the frames, so corrupt files can't make sampling read out of bounds.
+        auto fromFileTrack = [&info, sourceEndianType](File_CompressedUniformMotionData_Track fileTrack, AZ::u32 numValues, bool isVector3, TrackInfo& outTrack)
+        {
+            MCore::Endian::ConvertUnsignedInt32(&fileTrack.m_offset, sourceEndianType);
+            MCore::Endian::ConvertFloat(&fileTrack.m_min, sourceEndianType);
+            MCore::Endian::ConvertFloat(&fileTrack.m_scale, sourceEndianType);
+            outTrack.m_offset = fileTrack.m_offset;
+            outTrack.m_min = fileTrack.m_min;
+            outTrack.m_scale = fileTrack.m_scale;
+            outTrack.m_lane = fileTrack.m_lane;
+            outTrack.m_format = static_cast<TrackFormat>(fileTrack.m_format);
+
+            switch (outTrack.m_format)
+            {
+                case TrackFormat::NotAnimated:
+                    return true;
+                case TrackFormat::Raw:
+                    return static_cast<AZ::u64>(outTrack.m_offset) + numValues <= info.m_rawFrameStride;
+                case TrackFormat::Quantized:
+                    if (isVector3)
+                    {
+                        return outTrack.m_offset < info.m_numVector3Batches && outTrack.m_lane < BatchSize;
+                    }
+                    return static_cast<AZ::u64>(outTrack.m_offset) + (numValues == 4 ? 3 : 1) <= info.m_quantizedFrameStride;
+                default:
+                    return false;
+            }
+        };
+
+        // Read all joints.
+        AZStd::string name;
+        for (size_t i = 0; i < GetNumJoints(); ++i)
+        {
+            File_CompressedUniformMotionData_Joint jointInfo;
+            if (stream->Read(&jointInfo, sizeof(File_CompressedUniformMotionData_Joint)) == 0)
+            {
+                return false;
+            }
+
+            // Convert endian.
+            AZ::Vector3 staticPos(jointInfo.m_staticPos.mX, jointInfo.m_staticPos.mY, jointInfo.m_staticPos.mZ);
+            AZ::Vector3 staticScale(jointInfo.m_staticScale.mX, jointInfo.m_staticScale.mY, jointInfo.m_staticScale.mZ);
+            MCore::Compressed16BitQuaternion staticRot(jointInfo.m_staticRot.mX, jointInfo.m_staticRot.mY, jointInfo.m_staticRot.mZ, jointInfo.m_staticRot.mW);
+            AZ::Vector3 bindPosePos(jointInfo.m_bindPosePos.mX, jointInfo.m_bindPosePos.mY, jointInfo.m_bindPosePos.mZ);
+            AZ::Vector3 bindPoseScale(jointInfo.m_bindPoseScale.mX, jointInfo.m_bindPoseScale.mY, jointInfo.m_bindPoseScale.mZ);
+            MCore::Compressed16BitQuaternion bindPoseRot(jointInfo.m_bindPoseRot.mX, jointInfo.m_bindPoseRot.mY, jointInfo.m_bindPoseRot.mZ, jointInfo.m_bindPoseRot.mW);
+            MCore::Endian::ConvertVector3(&staticPos, sourceEndianType);
+            MCore::Endian::Convert16BitQuaternion(&staticRot, sourceEndianType);
+            MCore::Endian::ConvertVector3(&staticScale, sourceEndianType);
+            MCore::Endian::ConvertVector3(&bindPosePos, sourceEndianType);
+            MCore::Endian::Convert16BitQuaternion(&bindPoseRot, sourceEndianType);
+            MCore::Endian::ConvertVector3(&bindPoseScale, sourceEndianType);
+
+            // Update the values.
+            SetJointStaticPosition(i, staticPos);
+            SetJointStaticRotation(i, staticRot.ToQuaternion().GetNormalized());
+            SetJointBindPosePosition(i, bindPosePos);
+            SetJointBindPoseRotation(i, bindPoseRot.ToQuaternion().GetNormalized());
+            EMFX_SCALECODE
+            (
+                SetJointStaticScale(i, staticScale);
+                SetJointBindPoseScale(i, bindPoseScale);
+            )
+
+            JointTracks& tracks = m_jointTracks[i];
+            bool tracksValid = fromFileTrack(jointInfo.m_positionTrack, 3, /*isVector3=*/true, tracks.m_position);
+            tracksValid &= fromFileTrack(jointInfo.m_rotationTrack, 4, /*isVector3=*/false, tracks.m_rotation);
+#ifndef EMFX_SCALE_DISABLED
+            tracksValid &= fromFileTrack(jointInfo.m_scaleTrack, 3, /*isVector3=*/true, tracks.m_scale);
+#endif
+            if (!tracksValid)
+            {
+                AZ_Error("EMotionFX", false, "Invalid track data for joint %zu, cannot load motion data.", i);
+                return false;
+            }
+
+            // Read the name.
+            name = MotionData::ReadStringFromStream(stream, sourceEndianType);
+            SetJointName(i, name);
+
+            if (readSettings.m_logDetails)
+            {
+                MCore::LogDetailedInfo("  + [%zu] Joint = '%s'", i, name.c_str());
+                MCore::LogDetailedInfo("    - PositionFormat = %d", jointInfo.m_positionTrack.m_format);
+                MCore::LogDetailedInfo("    - RotationFormat = %d", jointInfo.m_rotationTrack.m_format);
+                MCore::LogDetailedInfo("    - ScaleFormat    = %d", jointInfo.m_scaleTrack.m_format);
+            }
+        }
+
+        // Load the morph and float channels.
+        for (size_t i = 0; i < GetNumMorphs() + GetNumFloats(); ++i)
+        {
+            const bool isMorph = (i < GetNumMorphs());
+            const size_t channelIndex = isMorph ? i : i - GetNumMorphs();
+
+            File_CompressedUniformMotionData_Float floatInfo;
+            if (stream->Read(&floatInfo, sizeof(File_CompressedUniformMotionData_Float)) == 0)
+            {
+                return false;
+            }
+            MCore::Endian::ConvertFloat(&floatInfo.m_staticValue, sourceEndianType);
+            name = MotionData::ReadStringFromStream(stream, sourceEndianType);
+
+            TrackInfo& track = isMorph ? m_morphTracks[channelIndex] : m_floatTracks[channelIndex];
+            if (!fromFileTrack(floatInfo.m_track, 1, /*isVector3=*/false, track))
+            {
+                AZ_Error("EMotionFX", false, "Invalid track data for %s channel '%s', cannot load motion data.", isMorph ? "morph" : "float", name.c_str());
+                return false;
+            }
+
+            if (readSettings.m_logDetails)
+            {
+                MCore::LogDetailedInfo("  + %s: '%s'", isMorph ? "Morph" : "Float", name.c_str());
+                MCore::LogDetailedInfo("       + Format       = %d", floatInfo.m_track.m_format);
+                MCore::LogDetailedInfo("       + Static value = %f", floatInfo.m_staticValue);
+            }
+
+            if (isMorph)
+            {
+                SetMorphName(channelIndex, name);
+                SetMorphStaticValue(channelIndex, floatInfo.m_staticValue);
+            }
+            else
+            {
+                SetFloatName(channelIndex, name);
+                SetFloatStaticValue(channelIndex, floatInfo.m_staticValue);
+            }
+        }
+
+        // Load the batches.
+        m_vector3Batches.resize(info.m_numVector3Batches);
+        for (Vector3Batch& batch : m_vector3Batches)
+        {
+            File_CompressedUniformMotionData_Vector3Batch batchChunk;
+            if (stream->Read(&batchChunk, sizeof(File_CompressedUniformMotionData_Vector3Batch)) == 0)
+            {
+                return false;
+            }
+            MCore::Endian::ConvertUnsignedInt32(&batchChunk.m_offset, sourceEndianType);
+            MCore::Endian::ConvertFloat(batchChunk.m_min, sourceEndianType, 12);
+            MCore::Endian::ConvertFloat(batchChunk.m_scale, sourceEndianType, 12);
+            if (static_cast<AZ::u64>(batchChunk.m_offset) + 3 * BatchSize > info.m_quantizedFrameStride)
+            {
+                AZ_Error("EMotionFX", false, "Invalid batch data, cannot load motion data.");
+                return false;
+            }
+
+            batch.m_offset = batchChunk.m_offset;
+            AZStd::copy(batchChunk.m_min, batchChunk.m_min + 12, batch.m_min);
+            AZStd::copy(batchChunk.m_scale, batchChunk.m_scale + 12, batch.m_scale);
+        }
+
+        // Load the frames.
+        m_quantizedFrames.resize(static_cast<size_t>(info.m_numSamples) * info.m_quantizedFrameStride);
+        if (!m_quantizedFrames.empty())
+        {
+            if (stream->Read(m_quantizedFrames.data(), m_quantizedFrames.size() * sizeof(AZ::u16)) == 0)
+            {
+                return false;
+            }
+            MCore::Endian::ConvertUnsignedInt16(m_quantizedFrames.data(), sourceEndianType, static_cast<AZ::u32>(m_quantizedFrames.size()));
+        }
+
+        m_rawFrames.resize(static_cast<size_t>(info.m_numSamples) * info.m_rawFrameStride);
+        if (!m_rawFrames.empty())
+        {
+            if (stream->Read(m_rawFrames.data(), m_rawFrames.size() * sizeof(float)) == 0)
+            {
+                return false;
+            }
+            MCore::Endian::ConvertFloat(m_rawFrames.data(), sourceEndianType, static_cast<AZ::u32>(m_rawFrames.size()));
+        }
+
+        return true;
+    }
+
+    bool CompressedUniformMotionData::Read(MCore::Stream* stream, const ReadSettings& readSettings)
+    {
+        switch (readSettings.m_version)
+        {
+            case 1:
+            {
+                return ReadVersion1(stream, readSettings);
+            }
+            break;
+
+            default:
+            {
+                AZ_Error("EMotionFX", false, "Unsupported CompressedUniformMotionData version (version=%d), cannot load motion data.", readSettings.m_version);
+            }
+        }
+
+        return false;
+    }
+} // namespace EMotionFX
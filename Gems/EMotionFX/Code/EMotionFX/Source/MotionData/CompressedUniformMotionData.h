@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <EMotionFX/Source/Allocators.h>
+#include <EMotionFX/Source/EMotionFXConfig.h>
+#include <EMotionFX/Source/MotionData/MotionData.h>
+#include <EMotionFX/Source/Transform.h>
+
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Memory/Memory.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace EMotionFX
+{
+    class Pose;
+
+    //! Evenly spaced keyframes, compressed per track.
+    //! Every track is stored either as a constant, as 16 bit values quantized to the range of that track or as raw floats,
+    //! picking the smallest format that stays within the error bounds passed to Optimize. Rotations are quantized using the
+    //! smallest three encoding. The samples of all tracks are interleaved per frame, so sampling a pose only touches two
+    //! small contiguous blocks of memory. Positions and scales are quantized in batches of four joints which are decoded
+    //! together using SIMD.
+    class EMFX_API CompressedUniformMotionData
+        : public MotionData
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(CompressedUniformMotionData, MotionAllocator, 0)
+        AZ_RTTI(CompressedUniformMotionData, "{FE295302-C186-4EE7-A6F5-2490C14388BE}", MotionData)
+
+        enum class TrackFormat : AZ::u8
+        {
+            NotAnimated = 0,
+            Raw = 1,
+            Quantized = 2
+        };
+
+        CompressedUniformMotionData() = default;
+        ~CompressedUniformMotionData() override;
+
+        void InitFromNonUniformData(const NonUniformMotionData* motionData, bool keepSameSampleRate=true, float newSampleRate=30.0f, bool updateDuration=false) override;
+        void Optimize(const OptimizeSettings& settings) override;
+        bool Read(MCore::Stream* stream, const ReadSettings& readSettings) override;
+        bool Save(MCore::Stream* stream, const SaveSettings& saveSettings) const override;
+        size_t CalcStreamSaveSizeInBytes(const SaveSettings& saveSettings) const override;
+        AZ::u32 GetStreamSaveVersion() const override;
+        const char* GetSceneSettingsName() const override;
+
+        // Overloaded.
+        Transform SampleJointTransform(const SampleSettings& settings, AZ::u32 jointSkeletonIndex) const override;
+        void SamplePose(const SampleSettings& settings, Pose* outputPose) const override;
+        float SampleMorph(float sampleTime, size_t morphDataIndex) const override;
+        float SampleFloat(float sampleTime, size_t floatDataIndex) const override;
+        Transform SampleJointTransform(float sampleTime, size_t jointDataIndex) const override;
+        AZ::Vector3 SampleJointPosition(float sampleTime, size_t jointDataIndex) const override;
+        AZ::Quaternion SampleJointRotation(float sampleTime, size_t jointDataIndex) const override;
+
+        void ClearAllJointTransformSamples() override;
+        void ClearAllMorphSamples() override;
+        void ClearAllFloatSamples() override;
+        void ClearJointPositionSamples(size_t jointDataIndex) override;
+        void ClearJointRotationSamples(size_t jointDataIndex) override;
+        void ClearJointTransformSamples(size_t jointDataIndex) override;
+        void ClearMorphSamples(size_t morphDataIndex) override;
+        void ClearFloatSamples(size_t floatDataIndex) override;
+
+        bool IsJointPositionAnimated(size_t jointDataIndex) const override;
+        bool IsJointRotationAnimated(size_t jointDataIndex) const override;
+        bool IsJointAnimated(size_t jointDataIndex) const override;
+        bool IsMorphAnimated(size_t morphDataIndex) const override;
+        bool IsFloatAnimated(size_t floatDataIndex) const override;
+
+#ifndef EMFX_SCALE_DISABLED
+        void ClearJointScaleSamples(size_t jointDataIndex) override;
+        bool IsJointScaleAnimated(size_t jointDataIndex) const override;
+        AZ::Vector3 SampleJointScale(float sampleTime, size_t jointDataIndex) const override;
+#endif
+
+        // Compression statistics.
+        TrackFormat GetJointPositionFormat(size_t jointDataIndex) const;
+        TrackFormat GetJointRotationFormat(size_t jointDataIndex) const;
+        TrackFormat GetMorphFormat(size_t morphDataIndex) const;
+        TrackFormat GetFloatFormat(size_t floatDataIndex) const;
+#ifndef EMFX_SCALE_DISABLED
+        TrackFormat GetJointScaleFormat(size_t jointDataIndex) const;
+#endif
+        size_t GetSampleDataSizeInBytes() const;
+
+        size_t GetNumSamples() const;
+        float GetSampleSpacing() const;
+        void SetSampleRate(float sampleRate) override;
+        void UpdateDuration() override;
+
+    private:
+        // For quantized vector tracks m_offset is the batch index and m_lane the track within that batch.
+        // For quantized rotation and float tracks m_offset is the offset in the quantized frame, for raw tracks the offset in the raw frame.
+        struct EMFX_API TrackInfo
+        {
+            AZ::u32 m_offset = 0;
+            float m_min = 0.0f;
+            float m_scale = 0.0f;
+            AZ::u8 m_lane = 0;
+            TrackFormat m_format = TrackFormat::NotAnimated;
+        };
+
+        struct EMFX_API JointTracks
+        {
+            TrackInfo m_position;
+            TrackInfo m_rotation;
+#ifndef EMFX_SCALE_DISABLED
+            TrackInfo m_scale;
+#endif
+        };
+
+        // Quantization ranges of four vector tracks, stored per component as x0..x3, y0..y3, z0..z3 to match the frame layout.
+        // Unused lanes have a zero range so they decode to zero.
+        struct EMFX_API Vector3Batch
+        {
+            AZ::u32 m_offset = 0; // Offset of the twelve values of this batch in the quantized frame.
+            float m_min[12] = {};
+            float m_scale[12] = {};
+        };
+
+        struct FramePair
+        {
+            const AZ::u16* m_quantizedA = nullptr;
+            const AZ::u16* m_quantizedB = nullptr;
+            const float* m_rawA = nullptr;
+            const float* m_rawB = nullptr;
+            float m_t = 0.0f;
+        };
+
+        struct Vector3BatchCache
+        {
+            AZ::u32 m_batchIndex = InvalidIndex32;
+            AZ::Vector3 m_values[4];
+        };
+
+        struct SourceTracks;
+
+        MotionData* CreateNew() const override;
+        void ResizeSampleData(size_t numJoints, size_t numMorphs, size_t numFloats) override;
+        void ClearAllData() override;
+        void AddJointSampleData(size_t jointDataIndex) override;
+        void AddMorphSampleData(size_t morphDataIndex) override;
+        void AddFloatSampleData(size_t floatDataIndex) override;
+        void RemoveJointSampleData(size_t jointDataIndex) override;
+        void RemoveMorphSampleData(size_t morphDataIndex) override;
+        void RemoveFloatSampleData(size_t floatDataIndex) override;
+        void ScaleData(float scaleFactor) override;
+
+        void UpdateSampleSpacing();
+        void InitTracks(size_t numJoints, size_t numMorphs, size_t numFloats, size_t numSamples, float sampleRate);
+        bool ReadVersion1(MCore::Stream* stream, const ReadSettings& readSettings);
+        void ExtractSourceTracks(SourceTracks& outSource) const;
+        void Compress(const SourceTracks& source, const OptimizeSettings* settings);
+
+        FramePair GetFramePair(float sampleTime) const;
+        FramePair GetFramePair(size_t sampleIndex) const;
+        AZ::Vector3 SampleVector3(const TrackInfo& track, const AZ::Vector3& staticValue, const FramePair& frames) const;
+        AZ::Vector3 SampleVector3(const TrackInfo& track, const AZ::Vector3& staticValue, const FramePair& frames, Vector3BatchCache& cache) const;
+        void SampleVector3Batch(AZ::u32 batchIndex, const FramePair& frames, AZ::Vector3* outValues) const;
+        AZ::Quaternion SampleRotation(const TrackInfo& track, const AZ::Quaternion& staticValue, const FramePair& frames) const;
+        float SampleFloatTrack(const TrackInfo& track, float staticValue, const FramePair& frames) const;
+
+        AZStd::vector<JointTracks> m_jointTracks;
+        AZStd::vector<TrackInfo> m_morphTracks;
+        AZStd::vector<TrackInfo> m_floatTracks;
+        AZStd::vector<Vector3Batch> m_vector3Batches;
+        AZStd::vector<AZ::u16> m_quantizedFrames; // m_numSamples frames of m_quantizedFrameStride values.
+        AZStd::vector<float> m_rawFrames;         // m_numSamples frames of m_rawFrameStride values.
+        AZ::u32 m_quantizedFrameStride = 0;
+        AZ::u32 m_rawFrameStride = 0;
+        size_t m_numSamples = 0;
+        float m_sampleSpacing = 1.0f / 30.0f;
+    };
+} // namespace EMotionFX
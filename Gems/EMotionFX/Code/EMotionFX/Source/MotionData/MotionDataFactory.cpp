@@ -6,6 +6,7 @@
  */
 
 #include <EMotionFX/Source/MotionData/MotionDataFactory.h>
+#include <EMotionFX/Source/MotionData/CompressedUniformMotionData.h>
 #include <EMotionFX/Source/MotionData/MotionData.h>
 #include <EMotionFX/Source/MotionData/NonUniformMotionData.h>
 #include <EMotionFX/Source/MotionData/UniformMotionData.h>
@@ -21,6 +22,7 @@ namespace EMotionFX
     {
         Register(aznew UniformMotionData());
         Register(aznew NonUniformMotionData());
+        Register(aznew CompressedUniformMotionData());
     }
 
     void MotionDataFactory::Clear()
@@ -10,6 +10,8 @@
 #include <EMotionFX/Source/PlayBackInfo.h>
 #include <EMotionFX/Source/RepositioningLayerPass.h>
 #include <EMotionFX/Source/ActorInstance.h>
+#include <EMotionFX/Source/ActorManager.h>
+#include <EMotionFX/Source/EMotionFXManager.h>
 #include <EMotionFX/Source/EventHandler.h>
 #include <EMotionFX/Source/EventManager.h>
 #include <EMotionFX/Source/TransformData.h>
@@ -305,6 +307,10 @@ namespace EMotionFX
 
         Pose* tempActorPose = &tempAnimGraphPose->GetPose();
 
+        // A single motion gets sampled on top of the bind pose, which makes it shareable with other instances of the same actor.
+        SharedMotionSampleCache* sharedSampleCache = GetActorManager().FindSharedMotionSampleCache(mActorInstance);
+        const Pose* bindPose = mActorInstance->GetTransformData()->GetBindPose();
+
         const uint32 numMotionInstances = mMotionInstances.GetLength();
         if (numMotionInstances > 0)
         {
@@ -347,7 +353,14 @@ namespace EMotionFX
                     Pose* finalPose = transformData->GetCurrentPose();
                     finalPose->InitFromBindPose(mActorInstance);
 
-                    instance->GetMotion()->Update(finalPose, finalPose, instance); // output the results of the single motion
+                    if (sharedSampleCache)
+                    {
+                        sharedSampleCache->SamplePose(instance, bindPose, finalPose);
+                    }
+                    else
+                    {
+                        instance->GetMotion()->Update(finalPose, finalPose, instance); // output the results of the single motion
+                    }
 
                     // compensate for motion extraction
                     if (instance->GetMotionExtractionEnabled() && motionExtractionEnabled && !instance->GetMotion()->GetMotionData()->IsAdditive())
@@ -367,7 +380,14 @@ namespace EMotionFX
                     Pose* finalPose = transformData->GetCurrentPose();
 
                     finalPose->InitFromBindPose(mActorInstance);
-                    instance->GetMotion()->Update(finalPose, tempActorPose, instance); // output the results of the single motion
+                    if (sharedSampleCache)
+                    {
+                        sharedSampleCache->SamplePose(instance, bindPose, tempActorPose);
+                    }
+                    else
+                    {
+                        instance->GetMotion()->Update(finalPose, tempActorPose, instance); // output the results of the single motion
+                    }
 
                     // compensate for motion extraction
                     if (instance->GetMotionExtractionEnabled() && motionExtractionEnabled && !instance->GetMotion()->GetMotionData()->IsAdditive())
@@ -15,14 +15,22 @@
 #include <EMotionFX/Source/Allocators.h>
 #include <MCore/Source/LogManager.h>
 
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/Jobs/JobCompletion.h>
 #include <AzCore/Jobs/JobManagerBus.h>
 #include <AzCore/Jobs/JobContext.h>
+#include <AzCore/std/chrono/clocks.h>
+#include <AzCore/std/sort.h>
 
 
 namespace EMotionFX
 {
+    AZ_CVAR(float, emfx_animationBudgetMs, 0.0f, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Time budget in milliseconds for sampling the actor instances with a motion sampling rate, summed over all threads. Zero disables the budget.");
+    AZ_CVAR(bool, emfx_spreadAnimationSampling, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "If enabled, actor instances with a motion sampling rate that are due at the same time get spread over the following updates.");
+
     AZ_CLASS_ALLOCATOR_IMPL(MultiThreadScheduler, ActorUpdateAllocator, 0)
 
     // constructor
@@ -31,6 +39,8 @@ namespace EMotionFX
     {
         mSteps.SetMemoryCategory(EMFX_MEMCATEGORY_UPDATESCHEDULERS);
         mCleanTimer     = 0.0f; // time passed since last schedule cleanup, in seconds
+        mSampleTimeAccum = 0;
+        mAverageSampleTime = 0.0f;
         mSteps.Reserve(1000);
     }
 
@@ -146,6 +156,9 @@ namespace EMotionFX
         mNumUpdated.SetValue(0);
         mNumVisible.SetValue(0);
         mNumSampled.SetValue(0);
+        mSampleTimeAccum = 0;
+
+        CalcSampleMotions(timePassedInSeconds);
 
         for (uint32 s = 0; s < numSteps; ++s)
         {
@@ -168,8 +181,9 @@ namespace EMotionFX
                     continue;
                 }
 
+                const bool sampleMotions = currentStep.mSampleMotions[c];
                 AZ::JobContext* jobContext = nullptr;
-                AZ::Job* job = AZ::CreateJobFunction([this, timePassedInSeconds, actorInstance]()
+                AZ::Job* job = AZ::CreateJobFunction([this, timePassedInSeconds, actorInstance, sampleMotions]()
                 {
                     AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::Animation, "MultiThreadScheduler::Execute::ActorInstanceUpdateJob");
 
@@ -182,22 +196,20 @@ namespace EMotionFX
                         mNumVisible.Increment();
                     }
 
-                    // check if we want to sample motions
-                    bool sampleMotions = false;
-                    actorInstance->SetMotionSamplingTimer(actorInstance->GetMotionSamplingTimer() + timePassedInSeconds);
-                    if (actorInstance->GetMotionSamplingTimer() >= actorInstance->GetMotionSamplingRate())
+                    // update the actor instance, measuring the cost of the ones that sample for the animation time budget
+                    if (isVisible && sampleMotions)
                     {
-                        sampleMotions = true;
-                        actorInstance->SetMotionSamplingTimer(0.0f);
+                        mNumSampled.Increment();
 
-                        if (isVisible)
-                        {
-                            mNumSampled.Increment();
-                        }
+                        const AZStd::chrono::system_clock::time_point startTime = AZStd::chrono::system_clock::now();
+                        actorInstance->UpdateTransformations(timePassedInSeconds, isVisible, sampleMotions);
+                        const AZStd::chrono::microseconds updateTime = AZStd::chrono::system_clock::now() - startTime;
+                        mSampleTimeAccum += static_cast<AZ::u64>(updateTime.count());
+                    }
+                    else
+                    {
+                        actorInstance->UpdateTransformations(timePassedInSeconds, isVisible, sampleMotions);
                     }
-
-                    // update the actor instance
-                    actorInstance->UpdateTransformations(timePassedInSeconds, isVisible, sampleMotions);
                 }, true, jobContext);
 
                 job->SetDependent(&jobCompletion);               
@@ -208,6 +220,107 @@ namespace EMotionFX
 
             jobCompletion.StartAndWaitForCompletion();
         } // for all steps
+
+        // update the running average of the update time of a sampling actor instance
+        const uint32 numSampled = mNumSampled.GetValue();
+        if (numSampled > 0)
+        {
+            const float sampleTime = static_cast<float>(mSampleTimeAccum.load()) / static_cast<float>(numSampled);
+            mAverageSampleTime = (mAverageSampleTime > 0.0f) ? MCore::LinearInterpolate<float>(mAverageSampleTime, sampleTime, 0.1f) : sampleTime;
+        }
+    }
+
+
+    // decide which actor instances sample their motions during this update
+    void MultiThreadScheduler::CalcSampleMotions(float timePassedInSeconds)
+    {
+        mDeferrableSamples.clear();
+        uint32 numMandatorySamples = 0;
+        float numExpectedSamples = 0.0f;
+
+        const uint32 numSteps = mSteps.GetLength();
+        for (uint32 s = 0; s < numSteps; ++s)
+        {
+            ScheduleStep& step = mSteps[s];
+            const size_t numStepEntries = step.mActorInstances.size();
+            step.mSampleMotions.assign(numStepEntries, false);
+
+            for (uint32 c = 0; c < numStepEntries; ++c)
+            {
+                ActorInstance* actorInstance = step.mActorInstances[c];
+                if (actorInstance->GetIsEnabled() == false)
+                {
+                    continue;
+                }
+
+                const float samplingRate = actorInstance->GetMotionSamplingRate();
+                const float samplingTimer = actorInstance->GetMotionSamplingTimer() + timePassedInSeconds;
+                actorInstance->SetMotionSamplingTimer(samplingTimer);
+
+                const bool isVisible = actorInstance->GetIsVisible();
+                if (samplingRate > 0.0f && isVisible)
+                {
+                    numExpectedSamples += AZ::GetMin(timePassedInSeconds / samplingRate, 1.0f);
+                }
+
+                if (samplingTimer < samplingRate)
+                {
+                    continue;
+                }
+
+                // Invisible actor instances don't output their poses, so there is nothing to gain by deferring them.
+                if (samplingRate <= 0.0f || !isVisible || samplingTimer >= samplingRate * 2.0f)
+                {
+                    step.mSampleMotions[c] = true;
+                    actorInstance->SetMotionSamplingTimer(0.0f);
+                    if (isVisible)
+                    {
+                        numMandatorySamples++;
+                    }
+                    continue;
+                }
+
+                mDeferrableSamples.push_back({ s, c, samplingTimer / samplingRate });
+            }
+        }
+
+        if (mDeferrableSamples.empty())
+        {
+            return;
+        }
+
+        // On average this many actor instances with a sampling rate are due per update, allowing a single extra one lets
+        // instances that became due at the same time drift apart within a few updates.
+        size_t maxDeferrableSamples = mDeferrableSamples.size();
+        if (emfx_spreadAnimationSampling)
+        {
+            maxDeferrableSamples = AZStd::min(maxDeferrableSamples, static_cast<size_t>(ceilf(numExpectedSamples)) + 1);
+        }
+
+        const float budget = static_cast<float>(emfx_animationBudgetMs) * 1000.0f;
+        if (budget > 0.0f && mAverageSampleTime > 0.0f)
+        {
+            const float remainingBudget = budget - static_cast<float>(numMandatorySamples) * mAverageSampleTime;
+            const size_t numFittingSamples = (remainingBudget > 0.0f) ? static_cast<size_t>(remainingBudget / mAverageSampleTime) : 0;
+            maxDeferrableSamples = AZStd::min(maxDeferrableSamples, numFittingSamples);
+        }
+
+        // Sample the most overdue actor instances first, the timers of the others keep running which raises their priority next update.
+        if (maxDeferrableSamples < mDeferrableSamples.size())
+        {
+            AZStd::sort(mDeferrableSamples.begin(), mDeferrableSamples.end(), [](const DeferrableSample& a, const DeferrableSample& b)
+                {
+                    return a.mPriority > b.mPriority;
+                });
+        }
+
+        for (size_t i = 0; i < maxDeferrableSamples; ++i)
+        {
+            const DeferrableSample& sample = mDeferrableSamples[i];
+            ScheduleStep& step = mSteps[sample.mStep];
+            step.mSampleMotions[sample.mEntry] = true;
+            step.mActorInstances[sample.mEntry]->SetMotionSamplingTimer(0.0f);
+        }
     }
 
 
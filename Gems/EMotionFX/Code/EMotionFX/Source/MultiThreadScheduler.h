@@ -12,6 +12,8 @@
 #include "ActorUpdateScheduler.h"
 #include "Actor.h"
 #include <MCore/Source/MultiThreadManager.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
 
 namespace EMotionFX
 {
@@ -51,6 +53,7 @@ namespace EMotionFX
         {
             MCore::Array<Actor::Dependency>     mDependencies;      /**< The dependencies of this scheduler step. No actor instances with the same dependencies are allowed to be added to this step. */
             AZStd::vector<ActorInstance*>       mActorInstances;    /**< The actor instances used inside this step. Each array entry will execute in another thread. */
+            AZStd::vector<bool>                 mSampleMotions;     /**< Per actor instance in this step, should motions be sampled during the current update? */
 
             /**
              * The constructor.
@@ -129,10 +132,39 @@ namespace EMotionFX
         const ScheduleStep& GetScheduleStep(uint32 index) const { return mSteps[index]; }
         uint32 GetNumScheduleSteps() const { return mSteps.GetLength(); }
 
+        /**
+         * Get the average time it took to update an actor instance that sampled its motions, in microseconds.
+         * This is used to estimate how many motion samples fit inside the animation time budget.
+         * @result The running average of the update time of sampling actor instances, or zero when nothing got sampled yet.
+         */
+        float GetAverageSampleTimeInMicroSeconds() const { return mAverageSampleTime; }
+
     protected:
+        /**
+         * An actor instance with a motion sampling rate that is due to sample motions.
+         */
+        struct DeferrableSample
+        {
+            uint32  mStep;          /**< The schedule step the actor instance is in. */
+            uint32  mEntry;         /**< The index of the actor instance inside the step. */
+            float   mPriority;      /**< How far the actor instance is overdue, relative to its sampling rate. */
+        };
+
         MCore::Array< ScheduleStep >    mSteps;         /**< An array of update steps, that together form the schedule. */
         float                           mCleanTimer;    /**< The time passed since the last automatic call to the Optimize method. */
         MCore::MutexRecursive           mMutex;
+        AZStd::vector<DeferrableSample> mDeferrableSamples;     /**< The actor instances that are due to sample their motions but which may be deferred to a later update. */
+        AZStd::atomic<AZ::u64>          mSampleTimeAccum;       /**< The summed update time of the sampling actor instances during the current update, in microseconds. */
+        float                           mAverageSampleTime;     /**< The running average of the update time of a sampling actor instance, in microseconds. */
+
+        /**
+         * Decide which actor instances sample their motions during this update.
+         * Actor instances without a motion sampling rate always sample. The ones with a sampling rate that are due get spread over the
+         * following updates, so that actor instances that switched LOD level at the same time don't keep sampling in the same update,
+         * and limited to what fits in the animation time budget. Actor instances that are overdue by a whole sampling interval are never deferred.
+         * @param timePassedInSeconds The time passed, in seconds, since the last call to the update.
+         */
+        void CalcSampleMotions(float timePassedInSeconds);
 
         bool HasActorInstanceInSteps(const ActorInstance* actorInstance) const;
 
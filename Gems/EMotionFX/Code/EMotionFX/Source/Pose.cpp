@@ -14,9 +14,147 @@
 #include <EMotionFX/Source/Pose.h>
 #include <EMotionFX/Source/PoseDataFactory.h>
 #include <EMotionFX/Source/TransformData.h>
+#include <MCore/Source/AzCoreConversions.h>
+#include <AzCore/Math/SimdMath.h>
 
 namespace EMotionFX
 {
+    namespace
+    {
+        using Vec4 = AZ::Simd::Vec4;
+
+        // Number of joints processed per iteration by the batched blend functions below.
+        constexpr size_t JointBatchSize = 4;
+
+        // Normalized lerp of four quaternions at once, matching MCore::NLerp(). The quaternions are transposed so each
+        // register holds the same component of all four joints, which lets the dot products, the hemisphere correction
+        // and the normalization run in parallel lanes rather than once per joint.
+        void NLerpBatch(Vec4::FloatType* rotations, const Vec4::FloatType* targets, Vec4::FloatArgType weight)
+        {
+            Vec4::FloatType from[JointBatchSize];
+            Vec4::FloatType to[JointBatchSize];
+            Vec4::Mat4x4Transpose(rotations, from);
+            Vec4::Mat4x4Transpose(targets, to);
+
+            // Negate the target weight for the lanes where the quaternions are in opposite hemispheres.
+            const Vec4::FloatType dot = Vec4::Madd(from[0], to[0], Vec4::Madd(from[1], to[1], Vec4::Madd(from[2], to[2], Vec4::Mul(from[3], to[3]))));
+            const Vec4::FloatType signMask = Vec4::And(Vec4::CmpLt(dot, Vec4::ZeroFloat()), Vec4::Splat(-0.0f));
+            const Vec4::FloatType fromWeight = Vec4::Sub(Vec4::Splat(1.0f), weight);
+            const Vec4::FloatType toWeight = Vec4::Xor(weight, signMask);
+
+            Vec4::FloatType result[JointBatchSize];
+            for (size_t i = 0; i < JointBatchSize; ++i)
+            {
+                result[i] = Vec4::Madd(to[i], toWeight, Vec4::Mul(from[i], fromWeight));
+            }
+
+            const Vec4::FloatType lengthSq = Vec4::Madd(result[0], result[0], Vec4::Madd(result[1], result[1], Vec4::Madd(result[2], result[2], Vec4::Mul(result[3], result[3]))));
+            const Vec4::FloatType invLength = Vec4::SqrtInv(lengthSq);
+            for (size_t i = 0; i < JointBatchSize; ++i)
+            {
+                result[i] = Vec4::Mul(result[i], invLength);
+            }
+
+            Vec4::Mat4x4Transpose(result, rotations);
+        }
+
+        // Blend the local space transforms of the joints towards the dest pose, with the same result as Transform::Blend().
+        template <typename JointIndexFunction>
+        void BlendJoints(Pose& pose, const Pose& destPose, float weight, size_t numJoints, const JointIndexFunction& getJointIndex)
+        {
+            const Vec4::FloatType batchWeight = Vec4::Splat(weight);
+            Transform* transforms[JointBatchSize];
+            Vec4::FloatType rotations[JointBatchSize];
+            Vec4::FloatType targets[JointBatchSize];
+
+            size_t i = 0;
+            for (; i + JointBatchSize <= numJoints; i += JointBatchSize)
+            {
+                for (size_t lane = 0; lane < JointBatchSize; ++lane)
+                {
+                    const uint32 jointIndex = getJointIndex(i + lane);
+                    Transform& transform = const_cast<Transform&>(pose.GetLocalSpaceTransform(jointIndex));
+                    const Transform& destTransform = destPose.GetLocalSpaceTransform(jointIndex);
+                    transform.mPosition = transform.mPosition.Lerp(destTransform.mPosition, weight);
+                    EMFX_SCALECODE
+                    (
+                        transform.mScale = transform.mScale.Lerp(destTransform.mScale, weight);
+                    )
+
+                    transforms[lane] = &transform;
+                    rotations[lane] = transform.mRotation.GetSimdValue();
+                    targets[lane] = destTransform.mRotation.GetSimdValue();
+                }
+
+                NLerpBatch(rotations, targets, batchWeight);
+                for (size_t lane = 0; lane < JointBatchSize; ++lane)
+                {
+                    transforms[lane]->mRotation = AZ::Quaternion(rotations[lane]);
+                }
+            }
+
+            // The joints that don't fill up a whole batch.
+            for (; i < numJoints; ++i)
+            {
+                const uint32 jointIndex = getJointIndex(i);
+                Transform& transform = const_cast<Transform&>(pose.GetLocalSpaceTransform(jointIndex));
+                transform.Blend(destPose.GetLocalSpaceTransform(jointIndex), weight);
+            }
+        }
+
+        // Apply the additive position and scale and return the rotation to interpolate towards.
+        // Pose::ApplyAdditive() pre-multiplies the additive rotation while Transform::ApplyAdditive() post-multiplies it.
+        AZ::Quaternion ApplyAdditivePositionScale(Transform& transform, const Transform& additiveTransform, float weight, bool preMultiplyRotation)
+        {
+            transform.mPosition += additiveTransform.mPosition * weight;
+            EMFX_SCALECODE
+            (
+                transform.mScale *= AZ::Vector3::CreateOne().Lerp(additiveTransform.mScale, weight);
+            )
+            return preMultiplyRotation ? additiveTransform.mRotation * transform.mRotation : transform.mRotation * additiveTransform.mRotation;
+        }
+
+        // Apply the additive pose to the local space transforms of the joints.
+        template <typename JointIndexFunction>
+        void ApplyAdditiveJoints(Pose& pose, const Pose& additivePose, float weight, bool preMultiplyRotation, size_t numJoints, const JointIndexFunction& getJointIndex)
+        {
+            const Vec4::FloatType batchWeight = Vec4::Splat(weight);
+            Transform* transforms[JointBatchSize];
+            Vec4::FloatType rotations[JointBatchSize];
+            Vec4::FloatType targets[JointBatchSize];
+
+            size_t i = 0;
+            for (; i + JointBatchSize <= numJoints; i += JointBatchSize)
+            {
+                for (size_t lane = 0; lane < JointBatchSize; ++lane)
+                {
+                    const uint32 jointIndex = getJointIndex(i + lane);
+                    Transform& transform = const_cast<Transform&>(pose.GetLocalSpaceTransform(jointIndex));
+                    const AZ::Quaternion target = ApplyAdditivePositionScale(transform, additivePose.GetLocalSpaceTransform(jointIndex), weight, preMultiplyRotation);
+
+                    transforms[lane] = &transform;
+                    rotations[lane] = transform.mRotation.GetSimdValue();
+                    targets[lane] = target.GetSimdValue();
+                }
+
+                NLerpBatch(rotations, targets, batchWeight);
+                for (size_t lane = 0; lane < JointBatchSize; ++lane)
+                {
+                    transforms[lane]->mRotation = AZ::Quaternion(rotations[lane]);
+                }
+            }
+
+            // The joints that don't fill up a whole batch.
+            for (; i < numJoints; ++i)
+            {
+                const uint32 jointIndex = getJointIndex(i);
+                Transform& transform = const_cast<Transform&>(pose.GetLocalSpaceTransform(jointIndex));
+                const AZ::Quaternion target = ApplyAdditivePositionScale(transform, additivePose.GetLocalSpaceTransform(jointIndex), weight, preMultiplyRotation);
+                transform.mRotation = MCore::NLerp(transform.mRotation, target, weight);
+            }
+        }
+    } // namespace
+
     // default constructor
     Pose::Pose()
     {
@@ -881,14 +1019,8 @@ namespace EMotionFX
     {
         if (mActorInstance)
         {
-            uint32 nodeNr;
-            const uint32 numNodes = mActorInstance->GetNumEnabledNodes();
-            for (uint32 i = 0; i < numNodes; ++i)
-            {
-                nodeNr = mActorInstance->GetEnabledNode(i);
-                Transform& curTransform = const_cast<Transform&>(GetLocalSpaceTransform(nodeNr));
-                curTransform.Blend(destPose->GetLocalSpaceTransform(nodeNr), weight);
-            }
+            const ActorInstance* actorInstance = mActorInstance;
+            BlendJoints(*this, *destPose, weight, actorInstance->GetNumEnabledNodes(), [actorInstance](size_t i) { return actorInstance->GetEnabledNode(static_cast<uint32>(i)); });
 
             // blend the morph weights
             const uint32 numMorphs = mMorphWeights.GetLength();
@@ -907,12 +1039,7 @@ namespace EMotionFX
         }
         else
         {
-            const uint32 numNodes = mActor->GetSkeleton()->GetNumNodes();
-            for (uint32 i = 0; i < numNodes; ++i)
-            {
-                Transform& curTransform = const_cast<Transform&>(GetLocalSpaceTransform(i));
-                curTransform.Blend(destPose->GetLocalSpaceTransform(i), weight);
-            }
+            BlendJoints(*this, *destPose, weight, mActor->GetSkeleton()->GetNumNodes(), [](size_t i) { return static_cast<uint32>(i); });
 
             // blend the morph weights
             const uint32 numMorphs = mMorphWeights.GetLength();
@@ -934,6 +1061,13 @@ namespace EMotionFX
     }
 
 
+    void Pose::BlendMasked(const Pose* destPose, float weight, const AZStd::vector<uint32>& jointIndices)
+    {
+        BlendJoints(*this, *destPose, weight, jointIndices.size(), [&jointIndices](size_t i) { return jointIndices[i]; });
+        InvalidateAllModelSpaceTransforms();
+    }
+
+
     Pose& Pose::MakeRelativeTo(const Pose& other)
     {
         AZ_Assert(mLocalSpaceTransforms.GetLength() == other.mLocalSpaceTransforms.GetLength(), "Poses must be of the same size");
@@ -992,36 +1126,14 @@ namespace EMotionFX
             AZ_Assert(mLocalSpaceTransforms.GetLength() == additivePose.mLocalSpaceTransforms.GetLength(), "Poses must be of the same size");
             if (mActorInstance)
             {
-                const uint32 numNodes = mActorInstance->GetNumEnabledNodes();
-                for (uint32 i = 0; i < numNodes; ++i)
-                {
-                    uint16 nodeNr = mActorInstance->GetEnabledNode(i);
-                    Transform& transform = const_cast<Transform&>(GetLocalSpaceTransform(nodeNr));
-                    const Transform& additiveTransform = additivePose.GetLocalSpaceTransform(nodeNr);
-                    transform.mPosition += additiveTransform.mPosition * weight;
-                    transform.mRotation = transform.mRotation.NLerp(additiveTransform.mRotation * transform.mRotation, weight);
-                    EMFX_SCALECODE
-                    (
-                        transform.mScale *= AZ::Vector3::CreateOne().Lerp(additiveTransform.mScale, weight);
-                    )
-                    transform.mRotation.Normalize();
-                }
+                const ActorInstance* actorInstance = mActorInstance;
+                ApplyAdditiveJoints(*this, additivePose, weight, /*preMultiplyRotation=*/true, actorInstance->GetNumEnabledNodes(),
+                    [actorInstance](size_t i) { return actorInstance->GetEnabledNode(static_cast<uint32>(i)); });
             }
             else
             {
-                const uint32 numNodes = mLocalSpaceTransforms.GetLength();
-                for (uint32 i = 0; i < numNodes; ++i)
-                {
-                    Transform& transform = const_cast<Transform&>(GetLocalSpaceTransform(i));
-                    const Transform& additiveTransform = additivePose.GetLocalSpaceTransform(i);
-                    transform.mPosition += additiveTransform.mPosition * weight;
-                    transform.mRotation = transform.mRotation.NLerp(additiveTransform.mRotation * transform.mRotation, weight);
-                    EMFX_SCALECODE
-                    (
-                        transform.mScale *= AZ::Vector3::CreateOne().Lerp(additiveTransform.mScale, weight);
-                    )
-                    transform.mRotation.Normalize();
-                }
+                ApplyAdditiveJoints(*this, additivePose, weight, /*preMultiplyRotation=*/true, mLocalSpaceTransforms.GetLength(),
+                    [](size_t i) { return static_cast<uint32>(i); });
             }
 
             const uint32 numMorphs = mMorphWeights.GetLength();
@@ -1037,6 +1149,14 @@ namespace EMotionFX
     }
 
 
+    Pose& Pose::ApplyAdditiveMasked(const Pose& additivePose, float weight, const AZStd::vector<uint32>& jointIndices)
+    {
+        ApplyAdditiveJoints(*this, additivePose, weight, /*preMultiplyRotation=*/false, jointIndices.size(), [&jointIndices](size_t i) { return jointIndices[i]; });
+        InvalidateAllModelSpaceTransforms();
+        return *this;
+    }
+
+
     Pose& Pose::ApplyAdditive(const Pose& additivePose)
     {
         AZ_Assert(mLocalSpaceTransforms.GetLength() == additivePose.mLocalSpaceTransforms.GetLength(), "Poses must be of the same size");
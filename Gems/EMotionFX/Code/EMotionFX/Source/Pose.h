@@ -8,6 +8,7 @@
 #pragma once
 
 #include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
 #include <MCore/Source/AlignedArray.h>
 #include <EMotionFX/Source/PoseData.h>
 #include <EMotionFX/Source/Transform.h>
@@ -133,6 +134,14 @@ namespace EMotionFX
          */
         void Blend(const Pose* destPose, float weight);
 
+        /**
+         * Blend the transforms of the given joints only, for example the mask of a blend node.
+         * @param destPose The destination pose to blend into.
+         * @param weight The weight value to use, which must be in range of [0..1], where 1.0 is the dest pose.
+         * @param jointIndices The skeleton indices of the joints to blend.
+         */
+        void BlendMasked(const Pose* destPose, float weight, const AZStd::vector<uint32>& jointIndices);
+
         /**
          * Additively blend the transforms for all enabled nodes in the actor instance.
          * You can see this as: thisPose += destPose * weight.
@@ -163,6 +172,14 @@ namespace EMotionFX
         Pose& ApplyAdditive(const Pose& additivePose);
         Pose& ApplyAdditive(const Pose& additivePose, float weight);
 
+        /**
+         * Apply the additive pose to the given joints only, the same way Transform::ApplyAdditive() does.
+         * @param additivePose The additive pose to apply.
+         * @param weight The weight value to use, which must be in range of [0..1].
+         * @param jointIndices The skeleton indices of the joints to apply the additive pose to.
+         */
+        Pose& ApplyAdditiveMasked(const Pose& additivePose, float weight, const AZStd::vector<uint32>& jointIndices);
+
         void Mirror(const MotionLinkData* motionLinkData);
 
         Pose& operator=(const Pose& other);
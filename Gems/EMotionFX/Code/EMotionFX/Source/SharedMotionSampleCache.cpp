@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/std/hash.h>
+#include <EMotionFX/Source/ActorInstance.h>
+#include <EMotionFX/Source/Motion.h>
+#include <EMotionFX/Source/MotionData/MotionData.h>
+#include <EMotionFX/Source/MotionInstance.h>
+#include <EMotionFX/Source/Pose.h>
+#include <EMotionFX/Source/SharedMotionSampleCache.h>
+
+
+namespace EMotionFX
+{
+    namespace
+    {
+        enum SampleFlags : AZ::u8
+        {
+            SAMPLEFLAG_MIRROR   = 1 << 0,
+            SAMPLEFLAG_RETARGET = 1 << 1,
+            SAMPLEFLAG_INPLACE  = 1 << 2
+        };
+    } // namespace
+
+
+    bool SharedMotionSampleCache::Key::operator==(const Key& other) const
+    {
+        return m_actor == other.m_actor &&
+            m_motion == other.m_motion &&
+            m_sampleIndex == other.m_sampleIndex &&
+            m_lodLevel == other.m_lodLevel &&
+            m_flags == other.m_flags;
+    }
+
+
+    size_t SharedMotionSampleCache::KeyHasher::operator()(const Key& key) const
+    {
+        size_t hash = 0;
+        AZStd::hash_combine(hash, key.m_actor, key.m_motion, key.m_sampleIndex, key.m_lodLevel, key.m_flags);
+        return hash;
+    }
+
+
+    SharedMotionSampleCache::SharedMotionSampleCache() = default;
+    SharedMotionSampleCache::~SharedMotionSampleCache() = default;
+
+
+    void SharedMotionSampleCache::BeginFrame()
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        m_sampledPoses.clear();
+        m_numUsedPoses = 0;
+        m_numSharedSamples = 0;
+    }
+
+
+    void SharedMotionSampleCache::SamplePose(const MotionInstance* motionInstance, const Pose* bindPose, Pose* outputPose)
+    {
+        const ActorInstance* actorInstance = motionInstance->GetActorInstance();
+        const Motion* motion = motionInstance->GetMotion();
+        const MotionData* motionData = motion->GetMotionData();
+
+        Key key;
+        key.m_actor = actorInstance->GetActor();
+        key.m_motion = motion;
+        key.m_sampleIndex = static_cast<AZ::s32>(AZStd::floor(motionInstance->GetCurrentTime() / m_timeStep + 0.5f));
+        key.m_lodLevel = actorInstance->GetLODLevel();
+        key.m_flags = (motionInstance->GetMirrorMotion() ? SAMPLEFLAG_MIRROR : 0) |
+            (motionInstance->GetRetargetingEnabled() ? SAMPLEFLAG_RETARGET : 0) |
+            (motionInstance->GetIsInPlace() ? SAMPLEFLAG_INPLACE : 0);
+
+        // Poses are only written before they get inserted and stay untouched until the next frame, so they can be copied without holding the lock.
+        const Pose* sharedPose = nullptr;
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            const auto iterator = m_sampledPoses.find(key);
+            if (iterator != m_sampledPoses.end())
+            {
+                sharedPose = iterator->second;
+                m_numSharedSamples++;
+            }
+        }
+
+        if (sharedPose)
+        {
+            outputPose->InitFromPose(sharedPose);
+            return;
+        }
+
+        MotionData::SampleSettings sampleSettings;
+        sampleSettings.m_actorInstance = actorInstance;
+        sampleSettings.m_inPlace = motionInstance->GetIsInPlace();
+        sampleSettings.m_mirror = motionInstance->GetMirrorMotion();
+        sampleSettings.m_retarget = motionInstance->GetRetargetingEnabled();
+        sampleSettings.m_sampleTime = AZ::GetClamp(key.m_sampleIndex * m_timeStep, 0.0f, motionData->GetDuration());
+        sampleSettings.m_inputPose = bindPose;
+        motionData->SamplePose(sampleSettings, outputPose);
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        if (m_numUsedPoses >= m_maxNumPoses || m_sampledPoses.find(key) != m_sampledPoses.end())
+        {
+            return;
+        }
+
+        if (m_numUsedPoses == m_poses.size())
+        {
+            m_poses.emplace_back(AZStd::make_unique<Pose>());
+        }
+
+        Pose* pose = m_poses[m_numUsedPoses++].get();
+        pose->LinkToActorInstance(actorInstance);
+        pose->InitFromPose(outputPose);
+        m_sampledPoses.emplace(key, pose);
+    }
+
+
+    void SharedMotionSampleCache::SetTimeStep(float timeStep)
+    {
+        AZ_Assert(timeStep > 0.0f, "The time step has to be bigger than zero.");
+        m_timeStep = timeStep;
+    }
+
+
+    float SharedMotionSampleCache::GetTimeStep() const
+    {
+        return m_timeStep;
+    }
+
+
+    void SharedMotionSampleCache::SetMaxNumPoses(size_t maxNumPoses)
+    {
+        m_maxNumPoses = maxNumPoses;
+    }
+
+
+    size_t SharedMotionSampleCache::GetMaxNumPoses() const
+    {
+        return m_maxNumPoses;
+    }
+
+
+    size_t SharedMotionSampleCache::GetNumSampledPoses() const
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        return m_numUsedPoses;
+    }
+
+
+    size_t SharedMotionSampleCache::GetNumSharedSamples() const
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        return m_numSharedSamples;
+    }
+
+
+    void SharedMotionSampleCache::Clear()
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        m_sampledPoses.clear();
+        m_poses.clear();
+        m_numUsedPoses = 0;
+        m_numSharedSamples = 0;
+    }
+} // namespace EMotionFX
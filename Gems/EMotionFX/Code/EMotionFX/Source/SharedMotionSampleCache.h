@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <EMotionFX/Source/EMotionFXConfig.h>
+
+
+namespace EMotionFX
+{
+    // forward declarations
+    class Actor;
+    class Motion;
+    class MotionInstance;
+    class Pose;
+
+    //! Shares sampled motion poses between actor instances within a frame.
+    //! Instances of the same actor, at the same skeletal LOD level, playing the same motion at the same time step (the sample
+    //! time gets quantized to the time step) reuse the pose sampled by whichever of them got updated first. This turns the
+    //! per instance sampling cost into a per unique clip cost for crowds. Only the sampling is shared, motion extraction
+    //! compensation and blending still happen per instance. All functions are safe to call from the update threads.
+    class EMFX_API SharedMotionSampleCache
+    {
+    public:
+        SharedMotionSampleCache();
+        ~SharedMotionSampleCache();
+
+        //! Drop the poses sampled during the previous frame, the pose buffers are kept for reuse.
+        void BeginFrame();
+
+        //! Sample the motion of the given motion instance on top of the bind pose, reusing a pose sampled earlier this frame when possible.
+        //! @param motionInstance The motion instance to sample.
+        //! @param bindPose The bind pose of the actor instance, used for joints that aren't animated by the motion.
+        //! @param outputPose The pose to write the result to.
+        void SamplePose(const MotionInstance* motionInstance, const Pose* bindPose, Pose* outputPose);
+
+        //! The interval in seconds sample times get quantized to. Bigger steps increase the number of instances sharing a pose.
+        void SetTimeStep(float timeStep);
+        float GetTimeStep() const;
+
+        //! The maximum number of poses kept per frame, once reached the remaining instances sample on their own.
+        void SetMaxNumPoses(size_t maxNumPoses);
+        size_t GetMaxNumPoses() const;
+
+        //! The number of poses sampled and the number of times a pose got reused during the current frame.
+        size_t GetNumSampledPoses() const;
+        size_t GetNumSharedSamples() const;
+
+        void Clear();
+
+    private:
+        struct Key
+        {
+            const Actor* m_actor = nullptr;
+            const Motion* m_motion = nullptr;
+            AZ::s32 m_sampleIndex = 0;
+            AZ::u32 m_lodLevel = 0;
+            AZ::u8 m_flags = 0;
+
+            bool operator==(const Key& other) const;
+        };
+
+        struct KeyHasher
+        {
+            size_t operator()(const Key& key) const;
+        };
+
+        mutable AZStd::mutex m_mutex;
+        AZStd::unordered_map<Key, Pose*, KeyHasher> m_sampledPoses;
+        AZStd::vector<AZStd::unique_ptr<Pose>> m_poses;
+        size_t m_numUsedPoses = 0;
+        size_t m_numSharedSamples = 0;
+        size_t m_maxNumPoses = 256;
+        float m_timeStep = 1.0f / 30.0f;
+    };
+} // namespace EMotionFX
@@ -6,6 +6,9 @@
  */
 
 // include the required headers
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Math/SimdMath.h>
 #include "EMotionFXConfig.h"
 #include "SoftSkinDeformer.h"
 #include "Mesh.h"
@@ -23,6 +26,53 @@ namespace EMotionFX
 {
     AZ_CLASS_ALLOCATOR_IMPL(SoftSkinDeformer, DeformerAllocator, 0)
 
+    namespace
+    {
+        // Blend the bone matrices of all influences into a single skinning matrix, so every vertex attribute only gets transformed once
+        // instead of once per influence. The rows are accumulated using SIMD multiply-adds.
+        AZ_FORCE_INLINE AZ::Matrix3x4 BlendSkinningMatrix(const AZ::Matrix3x4* boneMatrices, const SkinningInfoVertexAttributeLayer* layer, uint32 orgVertex)
+        {
+            using namespace AZ::Simd;
+            Vec4::FloatType row0 = Vec4::ZeroFloat();
+            Vec4::FloatType row1 = Vec4::ZeroFloat();
+            Vec4::FloatType row2 = Vec4::ZeroFloat();
+
+            const size_t numInfluences = layer->GetNumInfluences(orgVertex);
+            for (size_t i = 0; i < numInfluences; ++i)
+            {
+                const SkinInfluence* influence = layer->GetInfluence(orgVertex, i);
+                const Vec4::FloatType* boneRows = boneMatrices[influence->GetBoneNr()].GetSimdValues();
+                const Vec4::FloatType weight = Vec4::Splat(influence->GetWeight());
+                row0 = Vec4::Madd(boneRows[0], weight, row0);
+                row1 = Vec4::Madd(boneRows[1], weight, row1);
+                row2 = Vec4::Madd(boneRows[2], weight, row2);
+            }
+
+            return AZ::Matrix3x4(row0, row1, row2);
+        }
+
+        template <bool SkinTangents, bool SkinBitangents>
+        void SkinVertices(const AZ::Matrix3x4* boneMatrices, uint32 startVertex, uint32 endVertex,
+            AZ::Vector3* __restrict positions, AZ::Vector3* __restrict normals, AZ::Vector4* __restrict tangents, AZ::Vector3* __restrict bitangents,
+            const uint32* __restrict orgVerts, const SkinningInfoVertexAttributeLayer* layer)
+        {
+            for (uint32 v = startVertex; v < endVertex; ++v)
+            {
+                const AZ::Matrix3x4 skinMatrix = BlendSkinningMatrix(boneMatrices, layer, orgVerts[v]);
+                positions[v] = skinMatrix * positions[v];
+                normals[v] = skinMatrix.TransformVector(normals[v]);
+                if constexpr (SkinTangents)
+                {
+                    tangents[v].Set(skinMatrix.TransformVector(tangents[v].GetAsVector3()), tangents[v].GetW());
+                }
+                if constexpr (SkinBitangents)
+                {
+                    bitangents[v] = skinMatrix.TransformVector(bitangents[v]);
+                }
+            }
+        }
+    } // namespace
+
     // constructor
     SoftSkinDeformer::SoftSkinDeformer(Mesh* mesh)
         : MeshDeformer(mesh)
@@ -102,100 +152,47 @@ namespace EMotionFX
         AZ::Vector4* __restrict tangents     = static_cast<AZ::Vector4*>(mMesh->FindVertexData(Mesh::ATTRIB_TANGENTS));
         AZ::Vector3* __restrict bitangents   = static_cast<AZ::Vector3*>(mMesh->FindVertexData(Mesh::ATTRIB_BITANGENTS));
         AZ::u32*     __restrict orgVerts     = static_cast<AZ::u32*>(mMesh->FindVertexData(Mesh::ATTRIB_ORGVTXNUMBERS));
-        SkinVertexRange(0, mMesh->GetNumVertices(), positions, normals, tangents, bitangents, orgVerts, layer);
-    }
-
 
-    void SoftSkinDeformer::SkinVertexRange(uint32 startVertex, uint32 endVertex, AZ::Vector3* positions, AZ::Vector3* normals, AZ::Vector4* tangents, AZ::Vector3* bitangents, uint32* orgVerts, SkinningInfoVertexAttributeLayer* layer)
-    {
-        AZ::Vector3 newPos, newNormal;
-        AZ::Vector3 vtxPos, normal;
-        AZ::Vector4 tangent, newTangent;
-        AZ::Vector3 bitangent, newBitangent;
-
-        // if there are tangents and bitangents to skin
-        if (tangents && bitangents)
+        // Small meshes are skinned right away, large ones get split into batches that are skinned by the job system.
+        const uint32 numVertices = mMesh->GetNumVertices();
+        if (numVertices <= s_numVerticesPerBatch)
         {
-            for (uint32 v = startVertex; v < endVertex; ++v)
-            {
-                newPos = AZ::Vector3::CreateZero();
-                newNormal = AZ::Vector3::CreateZero();
-                newTangent = AZ::Vector4::CreateZero();
-                newBitangent = AZ::Vector3::CreateZero();
-
-                vtxPos  = positions[v];
-                normal  = normals[v];
-                tangent = tangents[v];
-                bitangent = bitangents[v];
-
-                const uint32 orgVertex = orgVerts[v]; // get the original vertex number
-                const size_t numInfluences = layer->GetNumInfluences(orgVertex);
-                for (size_t i = 0; i < numInfluences; ++i)
-                {
-                    const SkinInfluence* influence = layer->GetInfluence(orgVertex, i);
-                    MCore::Skin(mBoneMatrices[influence->GetBoneNr()], &vtxPos, &normal, &tangent, &bitangent, &newPos, &newNormal, &newTangent, &newBitangent, influence->GetWeight());
-                }
-
-                newTangent.SetW(tangents[v].GetW());
-
-                // output the skinned values
-                positions[v]    = newPos;
-                normals[v]      = newNormal;
-                tangents[v]     = newTangent;
-                bitangents[v]   = newBitangent;
-            }
+            SkinVertexRange(0, numVertices, positions, normals, tangents, bitangents, orgVerts, layer);
+            return;
         }
-        else if (tangents) // only tangents but no bitangents
-        {
-            for (uint32 v = startVertex; v < endVertex; ++v)
-            {
-                newPos = AZ::Vector3::CreateZero();
-                newNormal = AZ::Vector3::CreateZero();
-                newTangent = AZ::Vector4::CreateZero();
 
-                vtxPos  = positions[v];
-                normal  = normals[v];
-                tangent = tangents[v];
+        AZ::JobCompletion jobCompletion;
+        for (uint32 startVertex = 0; startVertex < numVertices; startVertex += s_numVerticesPerBatch)
+        {
+            const uint32 endVertex = AZStd::min(startVertex + s_numVerticesPerBatch, numVertices);
 
-                const uint32 orgVertex = orgVerts[v]; // get the original vertex number
-                const size_t numInfluences = layer->GetNumInfluences(orgVertex);
-                for (size_t i = 0; i < numInfluences; ++i)
+            AZ::JobContext* jobContext = nullptr;
+            AZ::Job* job = AZ::CreateJobFunction([this, startVertex, endVertex, positions, normals, tangents, bitangents, orgVerts, layer]()
                 {
-                    const SkinInfluence* influence = layer->GetInfluence(orgVertex, i);
-                    MCore::Skin(mBoneMatrices[influence->GetBoneNr()], &vtxPos, &normal, &tangent, &newPos, &newNormal, &newTangent, influence->GetWeight());
-                }
-
-                newTangent.SetW(tangents[v].GetW());
+                    SkinVertexRange(startVertex, endVertex, positions, normals, tangents, bitangents, orgVerts, layer);
+                }, /*isAutoDelete=*/true, jobContext);
 
-                // output the skinned values
-                positions[v]    = newPos;
-                normals[v]      = newNormal;
-                tangents[v]     = newTangent;
-            }
+            job->SetDependent(&jobCompletion);
+            job->Start();
         }
-        else // there are no tangents and bitangents to skin
-        {
-            for (uint32 v = startVertex; v < endVertex; ++v)
-            {
-                newPos = AZ::Vector3::CreateZero();
-                newNormal = AZ::Vector3::CreateZero();
 
-                vtxPos  = positions[v];
-                normal  = normals[v];
+        jobCompletion.StartAndWaitForCompletion();
+    }
 
-                // skin the vertex
-                const uint32 orgVertex = orgVerts[v]; // get the original vertex number
-                const size_t numInfluences = layer->GetNumInfluences(orgVertex);
-                for (size_t i = 0; i < numInfluences; ++i)
-                {
-                    const SkinInfluence* influence = layer->GetInfluence(orgVertex, i);
-                    MCore::Skin(mBoneMatrices[influence->GetBoneNr()], &vtxPos, &normal, &newPos, &newNormal, influence->GetWeight());
-                }
 
-                // output the skinned values
-                positions[v]    = newPos;
-                normals[v]      = newNormal;
-            }
+    void SoftSkinDeformer::SkinVertexRange(uint32 startVertex, uint32 endVertex, AZ::Vector3* positions, AZ::Vector3* normals, AZ::Vector4* tangents, AZ::Vector3* bitangents, uint32* orgVerts, SkinningInfoVertexAttributeLayer* layer)
+    {
+        if (tangents && bitangents)
+        {
+            SkinVertices<true, true>(mBoneMatrices.data(), startVertex, endVertex, positions, normals, tangents, bitangents, orgVerts, layer);
+        }
+        else if (tangents)
+        {
+            SkinVertices<true, false>(mBoneMatrices.data(), startVertex, endVertex, positions, normals, tangents, bitangents, orgVerts, layer);
+        }
+        else
+        {
+            SkinVertices<false, false>(mBoneMatrices.data(), startVertex, endVertex, positions, normals, tangents, bitangents, orgVerts, layer);
         }
     }
 
@@ -151,5 +151,8 @@ namespace EMotionFX
         }
 
         void SkinVertexRange(uint32 startVertex, uint32 endVertex, AZ::Vector3* positions, AZ::Vector3* normals, AZ::Vector4* tangents, AZ::Vector3* bitangents, uint32* orgVerts, SkinningInfoVertexAttributeLayer* layer);
+
+        //! Number of vertices per batch/job used for multi-threaded software skinning, meshes up to this size are skinned on the calling thread.
+        static constexpr AZ::u32 s_numVerticesPerBatch = 10000;
     };
 } // namespace EMotionFX
@@ -116,6 +116,8 @@ set(FILES
     Source/RecorderBus.h
     Source/RepositioningLayerPass.cpp
     Source/RepositioningLayerPass.h
+    Source/SharedMotionSampleCache.cpp
+    Source/SharedMotionSampleCache.h
     Source/SimulatedObjectBus.h
     Source/SimulatedObjectSetup.cpp
     Source/SimulatedObjectSetup.h
@@ -158,6 +160,8 @@ set(FILES
     Source/AnimGraphEntryNode.h
     Source/AnimGraphEventBuffer.cpp
     Source/AnimGraphEventBuffer.h
+    Source/AnimGraphExecutionPlan.cpp
+    Source/AnimGraphExecutionPlan.h
     Source/AnimGraphExitNode.cpp
     Source/AnimGraphExitNode.h
     Source/AnimGraphGameControllerSettings.cpp
@@ -345,6 +349,8 @@ set(FILES
     Source/EventInfo.h
     Source/EventManager.cpp
     Source/EventManager.h
+    Source/MotionData/CompressedUniformMotionData.cpp
+    Source/MotionData/CompressedUniformMotionData.h
     Source/MotionData/MotionData.cpp
     Source/MotionData/MotionData.h
     Source/MotionData/MotionDataFactory.cpp
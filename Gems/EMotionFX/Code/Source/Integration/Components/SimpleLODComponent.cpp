@@ -34,10 +34,11 @@ namespace EMotionFX
             if (serializeContext)
             {
                 serializeContext->Class<Configuration>()
-                    ->Version(2)
+                    ->Version(3)
                     ->Field("LODDistances", &Configuration::m_lodDistances)
                     ->Field("EnableLODSampling", &Configuration::m_enableLodSampling)
                     ->Field("LODSampleRates", &Configuration::m_lodSampleRates)
+                    ->Field("InterpolateLODSampling", &Configuration::m_interpolateLodSampling)
                     ;
 
                 AZ::EditContext* editContext = serializeContext->GetEditContext();
@@ -61,7 +62,10 @@ namespace EMotionFX
                             ->Attribute(AZ::Edit::Attributes::Visibility, &SimpleLODComponent::Configuration::GetEnableLodSampling)
                             ->Attribute(AZ::Edit::Attributes::ContainerCanBeModified, false)
                             ->Attribute(AZ::Edit::Attributes::AutoExpand, true)
-                            ->ElementAttribute(AZ::Edit::Attributes::Step, 1.0f);
+                            ->ElementAttribute(AZ::Edit::Attributes::Step, 1.0f)
+                        ->DataElement(0, &SimpleLODComponent::Configuration::m_interpolateLodSampling,
+                            "Interpolate LOD sampling", "Blend between the anim graph samples of LODs with a lower sample rate, which removes stepping at the cost of one sample of latency.")
+                            ->Attribute(AZ::Edit::Attributes::Visibility, &SimpleLODComponent::Configuration::GetEnableLodSampling);
                 }
             }
         }
@@ -212,6 +216,7 @@ namespace EMotionFX
                     const float animGraphSampleRate = configuration.m_lodSampleRates[lodByDistance];
                     const float updateRateInSeconds = animGraphSampleRate > 0.0f ? 1.0f / animGraphSampleRate : 0.0f;
                     actorInstance->SetMotionSamplingRate(updateRateInSeconds);
+                    actorInstance->SetMotionSamplingInterpolation(configuration.m_interpolateLodSampling);
                 }
             }
         }
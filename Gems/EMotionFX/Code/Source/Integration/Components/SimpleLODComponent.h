@@ -51,6 +51,7 @@ namespace EMotionFX
                 AZStd::vector<float> m_lodDistances;         // LOD distances that decide which lod the actor should choose.
                 AZStd::vector<float> m_lodSampleRates;       // Per LOD sample rate.
                 bool m_enableLodSampling = false;            // Enable per LOD sampling rate. This will allow animation to sample at a lower rate for performance improvement.
+                bool m_interpolateLodSampling = false;       // Interpolate between the samples of LODs with a lower sample rate, rather than holding the last sampled pose.
             };
 
             SimpleLODComponent(const Configuration* config = nullptr);
@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Tests/AnimGraphFixture.h>
+#include <EMotionFX/Source/AnimGraph.h>
+#include <EMotionFX/Source/AnimGraphExecutionPlan.h>
+#include <EMotionFX/Source/AnimGraphMotionNode.h>
+#include <EMotionFX/Source/AnimGraphPosePool.h>
+#include <EMotionFX/Source/AnimGraphStateMachine.h>
+#include <EMotionFX/Source/BlendTree.h>
+#include <EMotionFX/Source/BlendTreeBlend2Node.h>
+#include <EMotionFX/Source/BlendTreeFinalNode.h>
+#include <EMotionFX/Source/BlendTreeFloatConstantNode.h>
+#include <EMotionFX/Source/EMotionFXManager.h>
+#include <EMotionFX/Source/ThreadData.h>
+
+namespace EMotionFX
+{
+    class AnimGraphExecutionPlanFixture
+        : public AnimGraphFixture
+    {
+    public:
+        void ConstructGraph() override
+        {
+            AnimGraphFixture::ConstructGraph();
+            m_blendTreeAnimGraph = AnimGraphFactory::Create<OneBlendTreeNodeAnimGraph>();
+            m_rootStateMachine = m_blendTreeAnimGraph->GetRootStateMachine();
+            m_blendTree = m_blendTreeAnimGraph->GetBlendTreeNode();
+
+            /*
+                +---------+
+                | motionA |---+
+                +---------+   |   +--------+   +-------+
+                              +-->| blend2 |-->| final |
+                +---------+   |   +--------+   +-------+
+                | motionB |---+       ^
+                +---------+           |
+                +-------+             |
+                | float |-------------+
+                +-------+
+            */
+            m_finalNode = aznew BlendTreeFinalNode();
+            m_blendTree->AddChildNode(m_finalNode);
+            m_blend2Node = aznew BlendTreeBlend2Node();
+            m_blendTree->AddChildNode(m_blend2Node);
+            m_motionNodeA = aznew AnimGraphMotionNode();
+            m_blendTree->AddChildNode(m_motionNodeA);
+            m_motionNodeB = aznew AnimGraphMotionNode();
+            m_blendTree->AddChildNode(m_motionNodeB);
+            m_floatNode = aznew BlendTreeFloatConstantNode();
+            m_blendTree->AddChildNode(m_floatNode);
+
+            m_finalNode->AddConnection(m_blend2Node, BlendTreeBlend2Node::PORTID_OUTPUT_POSE, BlendTreeFinalNode::PORTID_INPUT_POSE);
+            m_blend2Node->AddConnection(m_motionNodeA, AnimGraphMotionNode::PORTID_OUTPUT_POSE, BlendTreeBlend2Node::INPUTPORT_POSE_A);
+            m_blend2Node->AddConnection(m_motionNodeB, AnimGraphMotionNode::PORTID_OUTPUT_POSE, BlendTreeBlend2Node::INPUTPORT_POSE_B);
+            m_blend2Node->AddConnection(m_floatNode, BlendTreeFloatConstantNode::OUTPUTPORT_RESULT, BlendTreeBlend2Node::INPUTPORT_WEIGHT);
+
+            m_blendTreeAnimGraph->InitAfterLoading();
+        }
+
+        void SetUp() override
+        {
+            AnimGraphFixture::SetUp();
+            m_animGraphInstance->Destroy();
+            m_animGraphInstance = m_blendTreeAnimGraph->GetAnimGraphInstance(m_actorInstance, m_motionSet);
+        }
+
+        static size_t FindEvaluationIndex(const AnimGraphExecutionPlan::NodeInfo& blendTreeInfo, const AnimGraphNode* node)
+        {
+            const auto it = AZStd::find(blendTreeInfo.m_evaluationOrder.begin(), blendTreeInfo.m_evaluationOrder.end(), node);
+            return static_cast<size_t>(it - blendTreeInfo.m_evaluationOrder.begin());
+        }
+
+    protected:
+        AZStd::unique_ptr<OneBlendTreeNodeAnimGraph> m_blendTreeAnimGraph;
+        BlendTree* m_blendTree = nullptr;
+        BlendTreeFinalNode* m_finalNode = nullptr;
+        BlendTreeBlend2Node* m_blend2Node = nullptr;
+        AnimGraphMotionNode* m_motionNodeA = nullptr;
+        AnimGraphMotionNode* m_motionNodeB = nullptr;
+        BlendTreeFloatConstantNode* m_floatNode = nullptr;
+    };
+
+    TEST_F(AnimGraphExecutionPlanFixture, EvaluationOrderHasSourcesFirst)
+    {
+        const AnimGraphExecutionPlan& plan = m_blendTreeAnimGraph->GetExecutionPlan();
+        const AnimGraphExecutionPlan::NodeInfo* blendTreeInfo = plan.FindNodeInfo(m_blendTree);
+        ASSERT_NE(blendTreeInfo, nullptr);
+        ASSERT_EQ(blendTreeInfo->m_evaluationOrder.size(), 5u);
+
+        const size_t blend2Index = FindEvaluationIndex(*blendTreeInfo, m_blend2Node);
+        EXPECT_LT(FindEvaluationIndex(*blendTreeInfo, m_motionNodeA), blend2Index);
+        EXPECT_LT(FindEvaluationIndex(*blendTreeInfo, m_motionNodeB), blend2Index);
+        EXPECT_LT(FindEvaluationIndex(*blendTreeInfo, m_floatNode), blend2Index);
+        EXPECT_EQ(blendTreeInfo->m_evaluationOrder.back(), m_finalNode);
+    }
+
+    TEST_F(AnimGraphExecutionPlanFixture, NodeInfoMatchesPorts)
+    {
+        const AnimGraphExecutionPlan& plan = m_blendTreeAnimGraph->GetExecutionPlan();
+
+        const AnimGraphExecutionPlan::NodeInfo* blend2Info = plan.FindNodeInfo(m_blend2Node);
+        ASSERT_NE(blend2Info, nullptr);
+        ASSERT_EQ(blend2Info->m_poseOutputPorts.size(), 1u);
+        EXPECT_EQ(blend2Info->m_poseOutputPorts[0], BlendTreeBlend2Node::OUTPUTPORT_POSE);
+        ASSERT_EQ(blend2Info->m_inputNodes.size(), 3u);
+        EXPECT_EQ(blend2Info->m_inputNodes[0], m_motionNodeA);
+        EXPECT_EQ(blend2Info->m_inputNodes[1], m_motionNodeB);
+        EXPECT_EQ(blend2Info->m_inputNodes[2], m_floatNode);
+
+        const AnimGraphExecutionPlan::NodeInfo* floatInfo = plan.FindNodeInfo(m_floatNode);
+        ASSERT_NE(floatInfo, nullptr);
+        EXPECT_TRUE(floatInfo->m_poseOutputPorts.empty());
+
+        // Both motion poses and the blended pose are alive while the blend node outputs.
+        EXPECT_GE(plan.GetMaxNumPoses(), 3u);
+    }
+
+    TEST_F(AnimGraphExecutionPlanFixture, RebuildsAfterConnectionChange)
+    {
+        ASSERT_EQ(m_blendTreeAnimGraph->GetExecutionPlan().FindNodeInfo(m_blend2Node)->m_inputNodes.size(), 3u);
+
+        m_blend2Node->RemoveConnection(m_motionNodeB, AnimGraphMotionNode::PORTID_OUTPUT_POSE, BlendTreeBlend2Node::INPUTPORT_POSE_B);
+
+        const AnimGraphExecutionPlan::NodeInfo* blend2Info = m_blendTreeAnimGraph->GetExecutionPlan().FindNodeInfo(m_blend2Node);
+        ASSERT_NE(blend2Info, nullptr);
+        ASSERT_EQ(blend2Info->m_inputNodes.size(), 2u);
+        EXPECT_EQ(blend2Info->m_inputNodes[0], m_motionNodeA);
+        EXPECT_EQ(blend2Info->m_inputNodes[1], m_floatNode);
+    }
+
+    TEST_F(AnimGraphExecutionPlanFixture, OutputReservesPoses)
+    {
+        GetEMotionFX().Update(0.0f);
+        Evaluate();
+
+        const AnimGraphPosePool& posePool = GetEMotionFX().GetThreadData(m_actorInstance->GetThreadIndex())->GetPosePool();
+        EXPECT_GE(posePool.GetNumPoses(), m_blendTreeAnimGraph->GetExecutionPlan().GetMaxNumPoses());
+    }
+} // namespace EMotionFX
@@ -0,0 +1,256 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/UnitTest/UnitTest.h>
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/string/string.h>
+#include <EMotionFX/Source/MotionData/CompressedUniformMotionData.h>
+#include <EMotionFX/Source/MotionData/NonUniformMotionData.h>
+#include <EMotionFX/Source/MotionData/UniformMotionData.h>
+#include <MCore/Source/MemoryFile.h>
+#include <Tests/SystemComponentFixture.h>
+
+namespace EMotionFX
+{
+    class CompressedUniformMotionDataTests
+        : public SystemComponentFixture
+        , public UnitTest::TraceBusRedirector
+    {
+    public:
+        void SetUp()
+        {
+            UnitTest::TraceBusRedirector::BusConnect();
+            SystemComponentFixture::SetUp();
+            FillSourceMotionData();
+        }
+
+        void TearDown()
+        {
+            m_sourceData.Clear();
+            SystemComponentFixture::TearDown();
+            UnitTest::TraceBusRedirector::BusDisconnect();
+        }
+
+    protected:
+        // Five animated joints, so the positions use one full and one partially filled batch, plus a static joint,
+        // a joint that only has constant keys and an animated morph.
+        void FillSourceMotionData()
+        {
+            for (size_t i = 0; i < NumJoints; ++i)
+            {
+                m_sourceData.AddJoint(AZStd::string::format("Joint%zu", i), Transform::CreateIdentity(), Transform::CreateIdentity());
+            }
+            m_sourceData.AddMorph("Morph", 0.0f);
+
+            for (size_t i = 0; i < NumAnimatedJoints; ++i)
+            {
+                m_sourceData.AllocateJointPositionSamples(i, NumKeys);
+                m_sourceData.AllocateJointRotationSamples(i, NumKeys);
+                for (size_t k = 0; k < NumKeys; ++k)
+                {
+                    const float time = k / 30.0f;
+                    const float offset = static_cast<float>(i);
+                    const AZ::Vector3 position(AZ::Sin(time + offset), AZ::Cos(time) * 2.0f, offset * 0.5f * time);
+                    const AZ::Quaternion rotation = AZ::Quaternion::CreateRotationZ(time * (offset + 1.0f)) * AZ::Quaternion::CreateRotationX(time);
+                    m_sourceData.SetJointPositionSample(i, k, { time, position });
+                    m_sourceData.SetJointRotationSample(i, k, { time, MCore::Compressed16BitQuaternion(rotation) });
+                }
+            }
+
+            m_sourceData.AllocateJointPositionSamples(ConstantJoint, NumKeys);
+            for (size_t k = 0; k < NumKeys; ++k)
+            {
+                m_sourceData.SetJointPositionSample(ConstantJoint, k, { k / 30.0f, AZ::Vector3(1.0f, 2.0f, 3.0f) });
+            }
+
+            m_sourceData.AllocateMorphSamples(0, NumKeys);
+            for (size_t k = 0; k < NumKeys; ++k)
+            {
+                const float time = k / 30.0f;
+                m_sourceData.SetMorphSample(0, k, { time, time * 0.5f });
+            }
+
+            m_sourceData.UpdateDuration();
+        }
+
+        static bool IsRotationClose(const AZ::Quaternion& a, const AZ::Quaternion& b, float tolerance)
+        {
+            return a.IsClose(b, tolerance) || a.IsClose(-b, tolerance);
+        }
+
+        static constexpr size_t NumAnimatedJoints = 5;
+        static constexpr size_t StaticJoint = 5;
+        static constexpr size_t ConstantJoint = 6;
+        static constexpr size_t NumJoints = 7;
+        static constexpr size_t NumKeys = 61;
+
+        NonUniformMotionData m_sourceData;
+    };
+
+    TEST_F(CompressedUniformMotionDataTests, InitFromNonUniformData_IsLossless)
+    {
+        CompressedUniformMotionData motionData;
+        motionData.InitFromNonUniformData(&m_sourceData);
+
+        EXPECT_EQ(motionData.GetNumJoints(), NumJoints);
+        EXPECT_EQ(motionData.GetNumSamples(), NumKeys);
+        EXPECT_FLOAT_EQ(motionData.GetDuration(), m_sourceData.GetDuration());
+        for (size_t i = 0; i < NumAnimatedJoints; ++i)
+        {
+            EXPECT_EQ(motionData.GetJointPositionFormat(i), CompressedUniformMotionData::TrackFormat::Raw);
+            EXPECT_EQ(motionData.GetJointRotationFormat(i), CompressedUniformMotionData::TrackFormat::Raw);
+        }
+        EXPECT_FALSE(motionData.IsJointAnimated(StaticJoint));
+
+        for (size_t k = 0; k < NumKeys; ++k)
+        {
+            const float time = k / 30.0f;
+            for (size_t i = 0; i < NumJoints; ++i)
+            {
+                EXPECT_TRUE(motionData.SampleJointPosition(time, i).IsClose(m_sourceData.SampleJointPosition(time, i), 0.00001f));
+                EXPECT_TRUE(IsRotationClose(motionData.SampleJointRotation(time, i), m_sourceData.SampleJointRotation(time, i), 0.00001f));
+            }
+            EXPECT_NEAR(motionData.SampleMorph(time, 0), m_sourceData.SampleMorph(time, 0), 0.00001f);
+        }
+    }
+
+    TEST_F(CompressedUniformMotionDataTests, Optimize_StaysWithinErrorBounds)
+    {
+        CompressedUniformMotionData motionData;
+        motionData.InitFromNonUniformData(&m_sourceData);
+
+        MotionData::OptimizeSettings settings;
+        settings.m_maxPosError = 0.001f;
+        settings.m_maxRotError = 0.001f;
+        settings.m_maxMorphError = 0.001f;
+        motionData.Optimize(settings);
+
+        for (size_t i = 0; i < NumAnimatedJoints; ++i)
+        {
+            EXPECT_EQ(motionData.GetJointPositionFormat(i), CompressedUniformMotionData::TrackFormat::Quantized);
+            EXPECT_EQ(motionData.GetJointRotationFormat(i), CompressedUniformMotionData::TrackFormat::Quantized);
+        }
+        EXPECT_EQ(motionData.GetMorphFormat(0), CompressedUniformMotionData::TrackFormat::Quantized);
+
+        // Sample in between keys as well, interpolating the decoded keys shouldn't add error for positions and morphs.
+        for (size_t k = 0; k < (NumKeys - 1) * 2; ++k)
+        {
+            const float time = k / 60.0f;
+            for (size_t i = 0; i < NumJoints; ++i)
+            {
+                EXPECT_TRUE(motionData.SampleJointPosition(time, i).IsClose(m_sourceData.SampleJointPosition(time, i), settings.m_maxPosError));
+                EXPECT_TRUE(IsRotationClose(motionData.SampleJointRotation(time, i), m_sourceData.SampleJointRotation(time, i), settings.m_maxRotError * 2.0f));
+            }
+            EXPECT_NEAR(motionData.SampleMorph(time, 0), m_sourceData.SampleMorph(time, 0), settings.m_maxMorphError);
+        }
+    }
+
+    TEST_F(CompressedUniformMotionDataTests, Optimize_ConstantTrackBecomesStatic)
+    {
+        CompressedUniformMotionData motionData;
+        motionData.InitFromNonUniformData(&m_sourceData);
+        EXPECT_TRUE(motionData.IsJointPositionAnimated(ConstantJoint));
+
+        motionData.Optimize(MotionData::OptimizeSettings());
+        EXPECT_FALSE(motionData.IsJointPositionAnimated(ConstantJoint));
+        EXPECT_TRUE(motionData.GetJointStaticPosition(ConstantJoint).IsClose(AZ::Vector3(1.0f, 2.0f, 3.0f)));
+        EXPECT_TRUE(motionData.SampleJointPosition(0.5f, ConstantJoint).IsClose(AZ::Vector3(1.0f, 2.0f, 3.0f)));
+    }
+
+    TEST_F(CompressedUniformMotionDataTests, Optimize_IgnoredJointStaysLossless)
+    {
+        CompressedUniformMotionData motionData;
+        motionData.InitFromNonUniformData(&m_sourceData);
+
+        MotionData::OptimizeSettings settings;
+        settings.m_jointIgnoreList = { 0 };
+        motionData.Optimize(settings);
+
+        EXPECT_EQ(motionData.GetJointPositionFormat(0), CompressedUniformMotionData::TrackFormat::Raw);
+        EXPECT_EQ(motionData.GetJointRotationFormat(0), CompressedUniformMotionData::TrackFormat::Raw);
+        EXPECT_EQ(motionData.GetJointPositionFormat(1), CompressedUniformMotionData::TrackFormat::Quantized);
+    }
+
+    TEST_F(CompressedUniformMotionDataTests, Optimize_IsSmallerThanUniformMotionData)
+    {
+        UniformMotionData uniformData;
+        uniformData.InitFromNonUniformData(&m_sourceData);
+
+        CompressedUniformMotionData motionData;
+        motionData.InitFromNonUniformData(&m_sourceData);
+        motionData.Optimize(MotionData::OptimizeSettings());
+
+        const MotionData::SaveSettings saveSettings;
+        EXPECT_LT(motionData.CalcStreamSaveSizeInBytes(saveSettings), uniformData.CalcStreamSaveSizeInBytes(saveSettings));
+    }
+
+    TEST_F(CompressedUniformMotionDataTests, SaveAndRead_MatchesOriginal)
+    {
+        CompressedUniformMotionData motionData;
+        motionData.InitFromNonUniformData(&m_sourceData);
+
+        // Keep one raw joint so both frame streams get saved.
+        MotionData::OptimizeSettings settings;
+        settings.m_jointIgnoreList = { 0 };
+        motionData.Optimize(settings);
+
+        MCore::MemoryFile file;
+        file.Open();
+        const MotionData::SaveSettings saveSettings;
+        ASSERT_TRUE(motionData.Save(&file, saveSettings));
+        EXPECT_EQ(file.GetFileSize(), motionData.CalcStreamSaveSizeInBytes(saveSettings));
+
+        file.Seek(0);
+        CompressedUniformMotionData loadedData;
+        ASSERT_TRUE(loadedData.Read(&file, MotionData::ReadSettings()));
+
+        ASSERT_EQ(loadedData.GetNumJoints(), motionData.GetNumJoints());
+        ASSERT_EQ(loadedData.GetNumMorphs(), motionData.GetNumMorphs());
+        EXPECT_EQ(loadedData.GetNumSamples(), motionData.GetNumSamples());
+        EXPECT_FLOAT_EQ(loadedData.GetDuration(), motionData.GetDuration());
+        for (size_t i = 0; i < NumJoints; ++i)
+        {
+            EXPECT_STREQ(loadedData.GetJointName(i).c_str(), motionData.GetJointName(i).c_str());
+            EXPECT_EQ(loadedData.GetJointPositionFormat(i), motionData.GetJointPositionFormat(i));
+            EXPECT_EQ(loadedData.GetJointRotationFormat(i), motionData.GetJointRotationFormat(i));
+        }
+
+        for (size_t k = 0; k < NumKeys; ++k)
+        {
+            const float time = k / 30.0f;
+            for (size_t i = 0; i < NumJoints; ++i)
+            {
+                EXPECT_TRUE(loadedData.SampleJointPosition(time, i).IsClose(motionData.SampleJointPosition(time, i), 0.00001f));
+                EXPECT_TRUE(IsRotationClose(loadedData.SampleJointRotation(time, i), motionData.SampleJointRotation(time, i), 0.00001f));
+            }
+            EXPECT_FLOAT_EQ(loadedData.SampleMorph(time, 0), motionData.SampleMorph(time, 0));
+        }
+    }
+
+    TEST_F(CompressedUniformMotionDataTests, Scale_ScalesQuantizedAndRawPositions)
+    {
+        CompressedUniformMotionData motionData;
+        motionData.InitFromNonUniformData(&m_sourceData);
+
+        MotionData::OptimizeSettings settings;
+        settings.m_jointIgnoreList = { 0 };
+        motionData.Optimize(settings);
+
+        AZStd::vector<AZ::Vector3> expectedPositions;
+        for (size_t i = 0; i < NumJoints; ++i)
+        {
+            expectedPositions.emplace_back(motionData.SampleJointPosition(0.5f, i) * 2.0f);
+        }
+
+        motionData.Scale(2.0f);
+        for (size_t i = 0; i < NumJoints; ++i)
+        {
+            EXPECT_TRUE(motionData.SampleJointPosition(0.5f, i).IsClose(expectedPositions[i], 0.0001f));
+        }
+    }
+} // namespace EMotionFX
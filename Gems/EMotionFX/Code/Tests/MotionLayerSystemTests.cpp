@@ -10,9 +10,11 @@
 #include <TestAssetCode/ActorFactory.h>
 #include <TestAssetCode/SimpleActors.h>
 
+#include <EMotionFX/Source/ActorManager.h>
 #include <EMotionFX/Source/Motion.h>
 #include <EMotionFX/Source/MotionData/UniformMotionData.h>
 #include <EMotionFX/Source/MotionSystem.h>
+#include <EMotionFX/Source/SharedMotionSampleCache.h>
 
 namespace EMotionFX
 {
@@ -191,4 +193,47 @@ namespace EMotionFX
         motion1->Destroy();
         actorInstance->Destroy();
     }
+
+    TEST_F(MotionLayerSystemFixture, SharedMotionSamplingReusesPose)
+    {
+        auto actor = ActorFactory::CreateAndInit<SimpleJointChainActor>(5);
+        ActorInstance* actorInstanceA = ActorInstance::Create(actor.get());
+        ActorInstance* actorInstanceB = ActorInstance::Create(actor.get());
+        ActorInstance* actorInstanceC = ActorInstance::Create(actor.get());
+        actorInstanceC->SetSharedMotionSamplingEnabled(false);
+
+        Motion* motion = aznew Motion("motion");
+        motion->SetMotionData(aznew UniformMotionData());
+        motion->GetMotionData()->SetDuration(10.0f);
+
+        PlayBackInfo playBackInfo;
+        playBackInfo.mBlendInTime = 0.0f;
+        playBackInfo.mNumLoops = EMFX_LOOPFOREVER;
+        playBackInfo.mPlayNow = true;
+        actorInstanceA->GetMotionSystem()->PlayMotion(motion, &playBackInfo);
+        actorInstanceB->GetMotionSystem()->PlayMotion(motion, &playBackInfo);
+        actorInstanceC->GetMotionSystem()->PlayMotion(motion, &playBackInfo);
+
+        ActorManager& actorManager = GetActorManager();
+        actorManager.SetSharedMotionSamplingEnabled(true);
+        const SharedMotionSampleCache& sampleCache = actorManager.GetSharedMotionSampleCache();
+
+        GetEMotionFX().Update(0.5f);
+        EXPECT_EQ(sampleCache.GetNumSampledPoses(), 1u);
+        EXPECT_EQ(sampleCache.GetNumSharedSamples(), 1u);
+
+        // Entries only live for a single frame.
+        GetEMotionFX().Update(0.5f);
+        EXPECT_EQ(sampleCache.GetNumSampledPoses(), 1u);
+        EXPECT_EQ(sampleCache.GetNumSharedSamples(), 1u);
+
+        actorManager.SetSharedMotionSamplingEnabled(false);
+        GetEMotionFX().Update(0.5f);
+        EXPECT_EQ(sampleCache.GetNumSampledPoses(), 0u);
+
+        motion->Destroy();
+        actorInstanceC->Destroy();
+        actorInstanceB->Destroy();
+        actorInstanceA->Destroy();
+    }
 } // namespace EMotionFX
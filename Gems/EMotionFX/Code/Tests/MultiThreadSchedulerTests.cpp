@@ -41,4 +41,43 @@ namespace EMotionFX
 
         actorInstance->Destroy();
     }
+
+    TEST_F(SystemComponentFixture, SpreadsMotionSamplingOverUpdates)
+    {
+        ActorUpdateScheduler* baseScheduler = GetEMotionFX().GetActorManager()->GetScheduler();
+        ASSERT_EQ(baseScheduler->GetType(), MultiThreadScheduler::TYPE_ID) << "Expected multi thread scheduler.";
+
+        // All actor instances get the same sampling rate at the same time, like after a LOD switch.
+        constexpr size_t numActorInstances = 8;
+        constexpr float samplingRate = 0.1f;
+        constexpr float timeDelta = 1.0f / 60.0f;
+        AZStd::unique_ptr<JackNoMeshesActor> actor = ActorFactory::CreateAndInit<JackNoMeshesActor>();
+        AZStd::vector<ActorInstance*> actorInstances;
+        for (size_t i = 0; i < numActorInstances; ++i)
+        {
+            ActorInstance* actorInstance = ActorInstance::Create(actor.get());
+            actorInstance->SetMotionSamplingRate(samplingRate);
+            actorInstances.emplace_back(actorInstance);
+        }
+
+        // On average 8 / 6 actor instances are due per update, which allows two plus one extra sample per update.
+        AZ::u32 numSampled = 0;
+        for (size_t frame = 0; frame < 60; ++frame)
+        {
+            baseScheduler->Execute(timeDelta);
+            EXPECT_LE(baseScheduler->GetNumSampledActorInstances(), 3u);
+            numSampled += baseScheduler->GetNumSampledActorInstances();
+
+            for (const ActorInstance* actorInstance : actorInstances)
+            {
+                EXPECT_LT(actorInstance->GetMotionSamplingTimer(), samplingRate * 2.0f) << "No actor instance should be deferred for a whole sampling interval.";
+            }
+        }
+        EXPECT_GE(numSampled, static_cast<AZ::u32>(numActorInstances * 5));
+
+        for (ActorInstance* actorInstance : actorInstances)
+        {
+            actorInstance->Destroy();
+        }
+    }
 } // namespace EMotionFX
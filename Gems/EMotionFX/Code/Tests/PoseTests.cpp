@@ -869,6 +869,71 @@ namespace EMotionFX
         }
     }
 
+    TEST_P(PoseTestsBlendWeightParam, BlendMasked)
+    {
+        const float blendWeight = GetParam();
+        const Pose* sourcePose = m_actorInstance->GetTransformData()->GetBindPose();
+
+        Pose destPose;
+        destPose.LinkToActorInstance(m_actorInstance);
+        destPose.InitFromBindPose(m_actor.get());
+        for (AZ::u32 i = 0; i < m_actor->GetSkeleton()->GetNumNodes(); ++i)
+        {
+            const float floatI = static_cast<float>(i);
+            const Transform transform(AZ::Vector3(0.0f, floatI, 0.0f),
+                AZ::Quaternion::CreateFromAxisAngle(AZ::Vector3(0.0f, 0.0f, 1.0f), floatI));
+            destPose.SetLocalSpaceTransform(i, transform);
+        }
+
+        // Blend all joints except the second one, so there is a full batch of four joints in the mask.
+        const AZStd::vector<AZ::u32> mask = { 4, 0, 2, 3 };
+        Pose blendedPose;
+        blendedPose.LinkToActorInstance(m_actorInstance);
+        blendedPose.InitFromBindPose(m_actor.get());
+        blendedPose.BlendMasked(&destPose, blendWeight, mask);
+
+        for (AZ::u32 i = 0; i < m_actor->GetSkeleton()->GetNumNodes(); ++i)
+        {
+            Transform expectedResult = sourcePose->GetLocalSpaceTransform(i);
+            if (AZStd::find(mask.begin(), mask.end(), i) != mask.end())
+            {
+                expectedResult.Blend(destPose.GetLocalSpaceTransform(i), blendWeight);
+            }
+            EXPECT_THAT(blendedPose.GetLocalSpaceTransform(i), IsClose(expectedResult));
+        }
+    }
+
+    TEST_P(PoseTestsBlendWeightParam, ApplyAdditiveMasked)
+    {
+        const float blendWeight = GetParam();
+        const Pose* sourcePose = m_actorInstance->GetTransformData()->GetBindPose();
+
+        Pose additivePose;
+        additivePose.LinkToActorInstance(m_actorInstance);
+        additivePose.InitFromBindPose(m_actor.get());
+        for (AZ::u32 i = 0; i < m_actor->GetSkeleton()->GetNumNodes(); ++i)
+        {
+            const float floatI = static_cast<float>(i);
+            const Transform transform(AZ::Vector3(floatI, 0.0f, floatI),
+                AZ::Quaternion::CreateFromAxisAngle(AZ::Vector3(1.0f, 0.0f, 0.0f), floatI));
+            additivePose.SetLocalSpaceTransform(i, transform);
+        }
+
+        const AZStd::vector<AZ::u32> mask = { 0, 1, 2, 3, 4 };
+        Pose resultPose;
+        resultPose.LinkToActorInstance(m_actorInstance);
+        resultPose.InitFromBindPose(m_actor.get());
+        resultPose.ApplyAdditiveMasked(additivePose, blendWeight, mask);
+
+        for (AZ::u32 i = 0; i < m_actor->GetSkeleton()->GetNumNodes(); ++i)
+        {
+            Transform expectedResult = sourcePose->GetLocalSpaceTransform(i);
+            expectedResult.ApplyAdditive(additivePose.GetLocalSpaceTransform(i), blendWeight);
+            EXPECT_THAT(resultPose.GetLocalSpaceTransform(i), IsClose(expectedResult));
+            CheckIfRotationIsNormalized(resultPose.GetLocalSpaceTransform(i).mRotation);
+        }
+    }
+
     ///////////////////////////////////////////////////////////////////////////
 
     enum PoseTestsMultiplyFunction
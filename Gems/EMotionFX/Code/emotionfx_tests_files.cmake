@@ -24,6 +24,7 @@ set(FILES
     Tests/AnimGraphEventHandlerCounter.h
     Tests/AnimGraphEventHandlerCounter.cpp
     Tests/AnimGraphEventTests.cpp
+    Tests/AnimGraphExecutionPlanTests.cpp
     Tests/AnimGraphFixture.cpp
     Tests/AnimGraphFixture.h
     Tests/AnimGraphFuzzTests.cpp
@@ -76,6 +77,7 @@ set(FILES
     Tests/BlendTreeTwoLinkIKNodeTests.cpp
     Tests/BoolLogicNodeTests.cpp
     Tests/ColliderCommandTests.cpp
+    Tests/CompressedUniformMotionDataTests.cpp
     Tests/EMotionFXTest.cpp
     Tests/EmotionFXMathLibTests.cpp
     Tests/EventManagerTests.cpp
@@ -8,6 +8,9 @@
 #include "FastNoise_precompiled.h"
 
 #include "FastNoiseGradientComponent.h"
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Jobs/Algorithms.h>
+#include <AzCore/Jobs/JobContext.h>
 #include <AzCore/Math/MathUtils.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
@@ -18,6 +21,12 @@
 
 namespace FastNoiseGem
 {
+    namespace Internal
+    {
+        //! Number of values each job generates when a GetValues batch is split across job threads.
+        //! Batches with fewer than two chunks worth of values are generated on the calling thread.
+        static constexpr size_t GetValuesJobChunkSize = 1024;
+    }
 
     AZ::u32 FastNoiseGradientConfig::GetCellularParameterVisibility() const
     {
@@ -313,6 +322,42 @@ namespace FastNoiseGem
         return 0.0f;
     }
 
+    void FastNoiseGradientComponent::GetValues(AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outValues) const
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
+        AZ_Assert(positions.size() == outValues.size(), "GetValues: the positions and the output values have different sizes");
+
+        AZStd::vector<AZ::Vector3> uvws(positions.begin(), positions.end());
+        AZStd::vector<bool> wasPointRejected(positions.size(), false);
+        const bool shouldNormalizeOutput = false;
+        GradientSignal::GradientTransformRequestBus::Event(
+            GetEntityId(), &GradientSignal::GradientTransformRequestBus::Events::TransformPositionsToUVW, positions,
+            AZStd::span<AZ::Vector3>(uvws), shouldNormalizeOutput, AZStd::span<bool>(wasPointRejected));
+
+        // the generator only reads its permutation tables, so several threads can sample it at once
+        const auto generateValue = [this, &uvws, &wasPointRejected, &outValues](size_t index)
+        {
+            const AZ::Vector3& uvw = uvws[index];
+            // Generator returns a range between [-1, 1], map that to [0, 1]
+            outValues[index] = wasPointRejected[index]
+                ? 0.0f
+                : AZ::GetClamp((m_generator.GetNoise(uvw.GetX(), uvw.GetY(), uvw.GetZ()) + 1.0f) / 2.0f, 0.0f, 1.0f);
+        };
+
+        AZ::JobContext* jobContext = AZ::JobContext::GetGlobalContext();
+        if (jobContext == nullptr || positions.size() < Internal::GetValuesJobChunkSize * 2)
+        {
+            for (size_t index = 0; index < positions.size(); ++index)
+            {
+                generateValue(index);
+            }
+            return;
+        }
+
+        AZ::parallel_for(size_t(0), positions.size(), generateValue,
+            AZ::simple_partitioner(Internal::GetValuesJobChunkSize), jobContext);
+    }
+
     template <typename TValueType, TValueType FastNoiseGradientConfig::*TConfigMember, void (FastNoise::*TMethod)(TValueType)>
     void FastNoiseGradientComponent::SetConfigValue(TValueType value)
     {
@@ -262,6 +262,45 @@ TEST_F(FastNoiseTestApp, FastNoise_ComponentMatchesConfiguration)
     reinterpret_cast<FastNoiseGradientComponentTester*>(noiseComp)->AssertTrue(cfg);
 }
 
+TEST_F(FastNoiseTestApp, FastNoise_GetValuesMatchesGetValue)
+{
+    AZ::Entity* noiseEntity = aznew AZ::Entity("noise_entity");
+    ASSERT_TRUE(noiseEntity != nullptr);
+
+    FastNoiseGem::FastNoiseGradientConfig cfg;
+    cfg.m_noiseType = FastNoise::NoiseType::SimplexFractal;
+    cfg.m_frequency = 0.37f;
+    noiseEntity->CreateComponent<FastNoiseGem::FastNoiseGradientComponent>(cfg);
+    noiseEntity->CreateComponent<MockGradientTransformComponent>();
+
+    noiseEntity->Init();
+    noiseEntity->Activate();
+
+    AZStd::vector<AZ::Vector3> positions;
+    for (int y = 0; y < 13; ++y)
+    {
+        for (int x = 0; x < 13; ++x)
+        {
+            positions.push_back(AZ::Vector3(x * 1.3f - 4.0f, y * 0.7f + 2.0f, 1.5f));
+        }
+    }
+
+    AZStd::vector<float> values(positions.size(), -1.0f);
+    GradientSignal::GradientRequestBus::Event(
+        noiseEntity->GetId(), &GradientSignal::GradientRequestBus::Events::GetValues, positions, AZStd::span<float>(values));
+
+    for (size_t index = 0; index < positions.size(); ++index)
+    {
+        GradientSignal::GradientSampleParams params(positions[index]);
+        float sample = -1.0f;
+        GradientSignal::GradientRequestBus::EventResult(sample, noiseEntity->GetId(), &GradientSignal::GradientRequestBus::Events::GetValue, params);
+        EXPECT_EQ(values[index], sample);
+    }
+
+    noiseEntity->Deactivate();
+    delete noiseEntity;
+}
+
 #if FASTNOISE_EDITOR
 #include <EditorFastNoiseGradientComponent.h>
 
@@ -9,6 +9,7 @@
 #include <AzCore/EBus/EBus.h>
 #include <AzCore/Component/EntityId.h>
 #include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/span.h>
 
 namespace GradientSignal
 {
@@ -48,6 +49,23 @@ namespace GradientSignal
         */
         virtual float GetValue(const GradientSampleParams& sampleParams) const = 0;
 
+        /**
+        * Given a list of positions, generate a value for each of them. The same thread safety rules as GetValue apply.
+        * The default implementation calls GetValue for every position, gradients that can do better (e.g. by only
+        * looking up their dependencies and taking their locks once per list) should override it.
+        * @param positions The positions to sample
+        * @param outValues The generated values, must be the same size as positions
+        */
+        virtual void GetValues(AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outValues) const
+        {
+            AZ_Assert(positions.size() == outValues.size(), "GetValues: the positions and the output values have different sizes");
+
+            for (size_t index = 0; index < positions.size(); ++index)
+            {
+                outValues[index] = GetValue(GradientSampleParams(positions[index]));
+            }
+        }
+
         /**
         * Call to check the hierarchy to see if a given entityId exists in the gradient signal chain
         */
@@ -10,6 +10,7 @@
 #include <AzCore/EBus/EBus.h>
 #include <AzCore/Math/Aabb.h>
 #include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/span.h>
 
 namespace GradientSignal
 {
@@ -27,6 +28,19 @@ namespace GradientSignal
         virtual ~GradientTransformRequests() = default;
 
         virtual void TransformPositionToUVW(const AZ::Vector3& inPosition, AZ::Vector3& outUVW, const bool shouldNormalizeOutput, bool& wasPointRejected) const = 0;
+
+        //! Batched version of TransformPositionToUVW, all the spans must be the same size.
+        virtual void TransformPositionsToUVW(
+            AZStd::span<const AZ::Vector3> inPositions, AZStd::span<AZ::Vector3> outUVW, const bool shouldNormalizeOutput, AZStd::span<bool> wasPointRejected) const
+        {
+            AZ_Assert(inPositions.size() == outUVW.size() && inPositions.size() == wasPointRejected.size(),
+                "TransformPositionsToUVW: the input and output lists have different sizes");
+
+            for (size_t index = 0; index < inPositions.size(); ++index)
+            {
+                TransformPositionToUVW(inPositions[index], outUVW[index], shouldNormalizeOutput, wasPointRejected[index]);
+            }
+        }
         virtual void GetGradientLocalBounds(AZ::Aabb& bounds) const = 0;
         virtual void GetGradientEncompassingBounds(AZ::Aabb& bounds) const = 0;
     };
@@ -14,6 +14,7 @@
 #include <AzCore/RTTI/ReflectContext.h>
 #include <AzCore/RTTI/RTTI.h>
 #include <AzCore/Serialization/EditContextConstants.inl>
+#include <AzCore/std/containers/vector.h>
 #include <GradientSignal/Ebuses/GradientRequestBus.h>
 #include <GradientSignal/Ebuses/GradientTransformRequestBus.h>
 #include <GradientSignal/Util.h>
@@ -32,6 +33,9 @@ namespace GradientSignal
 
         inline float GetValue(const GradientSampleParams& sampleParams) const;
 
+        //! Samples the gradient for a list of positions with a single request, outValues must be the same size as positions.
+        inline void GetValues(AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outValues) const;
+
         bool IsEntityInHierarchy(const AZ::EntityId& entityId) const;
 
         AZ::EntityId m_gradientId;
@@ -145,4 +149,71 @@ namespace GradientSignal
 
         return output * m_opacity;
     }
+
+    inline void GradientSampler::GetValues(AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outValues) const
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
+        AZ_Assert(positions.size() == outValues.size(), "GetValues: the positions and the output values have different sizes");
+
+        // Values are left at 0 if the gradient isn't set or the request fails
+        AZStd::fill(outValues.begin(), outValues.end(), 0.0f);
+
+        if (m_opacity <= 0.0f || !m_gradientId.IsValid())
+        {
+            return;
+        }
+
+        //apply transform if set
+        AZStd::vector<AZ::Vector3> transformedPositions;
+        if (m_enableTransform && GradientSamplerUtil::AreTransformParamsSet(*this))
+        {
+            AZ::Matrix3x4 matrix3x4;
+            matrix3x4.SetFromEulerDegrees(m_rotate);
+            matrix3x4.MultiplyByScale(m_scale);
+            matrix3x4.SetTranslation(m_translate);
+
+            transformedPositions.reserve(positions.size());
+            for (const AZ::Vector3& position : positions)
+            {
+                transformedPositions.push_back(matrix3x4 * position);
+            }
+            positions = transformedPositions;
+        }
+
+        const bool applyLevels = m_enableLevels && GradientSamplerUtil::AreLevelParamsSet(*this);
+
+        {
+            // Same locking and cyclic dependency detection as GetValue
+            auto& surfaceDataContext = SurfaceData::SurfaceDataSystemRequestBus::GetOrCreateContext(false);
+            typename SurfaceData::SurfaceDataSystemRequestBus::Context::DispatchLockGuard scopeLock(surfaceDataContext.m_contextMutex);
+
+            if (m_isRequestInProgress)
+            {
+                AZ_ErrorOnce("GradientSignal", !m_isRequestInProgress, "Detected cyclic dependences with gradient entity references");
+                return;
+            }
+
+            m_isRequestInProgress = true;
+
+            GradientRequestBus::Event(m_gradientId, &GradientRequestBus::Events::GetValues, positions, outValues);
+
+            m_isRequestInProgress = false;
+        }
+
+        for (float& output : outValues)
+        {
+            if (m_invertInput)
+            {
+                output = 1.0f - output;
+            }
+
+            //apply levels if set
+            if (applyLevels)
+            {
+                output = GetLevels(output, m_inputMid, m_inputMin, m_inputMax, m_outputMin, m_outputMax);
+            }
+
+            output *= m_opacity;
+        }
+    }
 }
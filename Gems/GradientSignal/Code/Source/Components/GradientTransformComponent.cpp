@@ -327,7 +327,25 @@ namespace GradientSignal
         AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
 
         AZStd::lock_guard<decltype(m_cacheMutex)> lock(m_cacheMutex);
+        TransformPositionToUVWUnlocked(inPosition, outUVW, shouldNormalizeOutput, wasPointRejected);
+    }
+
+    void GradientTransformComponent::TransformPositionsToUVW(
+        AZStd::span<const AZ::Vector3> inPositions, AZStd::span<AZ::Vector3> outUVW, const bool shouldNormalizeOutput, AZStd::span<bool> wasPointRejected) const
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
+        AZ_Assert(inPositions.size() == outUVW.size() && inPositions.size() == wasPointRejected.size(),
+            "TransformPositionsToUVW: the input and output lists have different sizes");
+
+        AZStd::lock_guard<decltype(m_cacheMutex)> lock(m_cacheMutex);
+        for (size_t index = 0; index < inPositions.size(); ++index)
+        {
+            TransformPositionToUVWUnlocked(inPositions[index], outUVW[index], shouldNormalizeOutput, wasPointRejected[index]);
+        }
+    }
 
+    void GradientTransformComponent::TransformPositionToUVWUnlocked(const AZ::Vector3& inPosition, AZ::Vector3& outUVW, const bool shouldNormalizeOutput, bool& wasPointRejected) const
+    {
         //transforming coordinate into "local" relative space of shape bounds
         outUVW = m_shapeTransformInverse * inPosition;
 
@@ -208,6 +208,28 @@ namespace GradientSignal
         return 0.0f;
     }
 
+    void ImageGradientComponent::GetValues(AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outValues) const
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
+        AZ_Assert(positions.size() == outValues.size(), "GetValues: the positions and the output values have different sizes");
+
+        // Positions are used as-is when there's no gradient transform, same as GetValue
+        AZStd::vector<AZ::Vector3> uvws(positions.begin(), positions.end());
+        AZStd::vector<bool> wasPointRejected(positions.size(), false);
+        const bool shouldNormalizeOutput = true;
+        GradientTransformRequestBus::Event(
+            GetEntityId(), &GradientTransformRequestBus::Events::TransformPositionsToUVW, positions, AZStd::span<AZ::Vector3>(uvws), shouldNormalizeOutput,
+            AZStd::span<bool>(wasPointRejected));
+
+        AZStd::lock_guard<decltype(m_imageMutex)> imageLock(m_imageMutex);
+        for (size_t index = 0; index < positions.size(); ++index)
+        {
+            outValues[index] = wasPointRejected[index]
+                ? 0.0f
+                : GetValueFromImageAsset(m_configuration.m_imageAsset, uvws[index], m_configuration.m_tilingX, m_configuration.m_tilingY, 0.0f);
+        }
+    }
+
     AZStd::string ImageGradientComponent::GetImageAssetPath() const
     {
         AZStd::string assetPathString;
@@ -255,13 +255,39 @@ namespace GradientSignal
         return false;
     }
 
+    float MixedGradientComponent::MixLayerValue(MixedGradientLayer::MixingOperation operation, float result, float currentUnpremultiplied)
+    {
+        switch (operation)
+        {
+        default:
+        case MixedGradientLayer::MixingOperation::Initialize:
+            //reset the result of the mixed/combined layers to the current value
+            return currentUnpremultiplied;
+        case MixedGradientLayer::MixingOperation::Multiply:
+            return result * currentUnpremultiplied;
+        case MixedGradientLayer::MixingOperation::Add:
+            return result + currentUnpremultiplied;
+        case MixedGradientLayer::MixingOperation::Subtract:
+            return result - currentUnpremultiplied;
+        case MixedGradientLayer::MixingOperation::Min:
+            return AZStd::min(currentUnpremultiplied, result);
+        case MixedGradientLayer::MixingOperation::Max:
+            return AZStd::max(currentUnpremultiplied, result);
+        case MixedGradientLayer::MixingOperation::Average:
+            return (result + currentUnpremultiplied) / 2.0f;
+        case MixedGradientLayer::MixingOperation::Normal:
+            return currentUnpremultiplied;
+        case MixedGradientLayer::MixingOperation::Overlay:
+            return (result >= 0.5f) ? (1.0f - (2.0f * (1.0f - result) * (1.0f - currentUnpremultiplied))) : (2.0f * result * currentUnpremultiplied);
+        }
+    }
+
     float MixedGradientComponent::GetValue(const GradientSampleParams& sampleParams) const
     {
         AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
 
         //accumulate the mixed/combined result of all layers and operations
         float result = 0.0f;
-        float operationResult = 0.0f;
 
         for (const auto& layer : m_configuration.m_layers)
         {
@@ -272,39 +298,11 @@ namespace GradientSignal
                 float current = layer.m_gradientSampler.GetValue(sampleParams);
                 // unpremultiplied alpha (we clamp the end result)
                 float currentUnpremultiplied = current / layer.m_gradientSampler.m_opacity;
-                switch (layer.m_operation)
+                if (layer.m_operation == MixedGradientLayer::MixingOperation::Initialize)
                 {
-                default:
-                case MixedGradientLayer::MixingOperation::Initialize:
-                    //reset the result of the mixed/combined layers to the current value
                     result = 0.0f;
-                    operationResult = currentUnpremultiplied;
-                    break;
-                case MixedGradientLayer::MixingOperation::Multiply:
-                    operationResult = result * currentUnpremultiplied;
-                    break;
-                case MixedGradientLayer::MixingOperation::Add:
-                    operationResult = result + currentUnpremultiplied;
-                    break;
-                case MixedGradientLayer::MixingOperation::Subtract:
-                    operationResult = result - currentUnpremultiplied;
-                    break;
-                case MixedGradientLayer::MixingOperation::Min:
-                    operationResult = AZStd::min(currentUnpremultiplied, result);
-                    break;
-                case MixedGradientLayer::MixingOperation::Max:
-                    operationResult = AZStd::max(currentUnpremultiplied, result);
-                    break;
-                case MixedGradientLayer::MixingOperation::Average:
-                    operationResult = (result + currentUnpremultiplied) / 2.0f;
-                    break;
-                case MixedGradientLayer::MixingOperation::Normal:
-                    operationResult = currentUnpremultiplied;
-                    break;
-                case MixedGradientLayer::MixingOperation::Overlay:
-                    operationResult = (result >= 0.5f) ? (1.0f - (2.0f * (1.0f - result) * (1.0f - currentUnpremultiplied))) : (2.0f * result * currentUnpremultiplied);
-                    break;
                 }
+                const float operationResult = MixLayerValue(layer.m_operation, result, currentUnpremultiplied);
                 // blend layers (re-applying opacity, which is why we needed to use unpremultiplied)
                 result = (result * (1.0f - layer.m_gradientSampler.m_opacity)) + (operationResult * layer.m_gradientSampler.m_opacity);
             }
@@ -313,6 +311,38 @@ namespace GradientSignal
         return AZ::GetClamp(result, 0.0f, 1.0f);
     }
 
+    void MixedGradientComponent::GetValues(AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outValues) const
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
+        AZ_Assert(positions.size() == outValues.size(), "GetValues: the positions and the output values have different sizes");
+
+        // Same as GetValue, but each layer is sampled for all the positions at once and mixed into outValues
+        AZStd::fill(outValues.begin(), outValues.end(), 0.0f);
+        AZStd::vector<float> layerValues(positions.size());
+
+        for (const auto& layer : m_configuration.m_layers)
+        {
+            const float opacity = layer.m_gradientSampler.m_opacity;
+            if (layer.m_enabled && opacity != 0.0f)
+            {
+                layer.m_gradientSampler.GetValues(positions, layerValues);
+
+                const bool initialize = layer.m_operation == MixedGradientLayer::MixingOperation::Initialize;
+                for (size_t index = 0; index < positions.size(); ++index)
+                {
+                    const float result = initialize ? 0.0f : outValues[index];
+                    const float operationResult = MixLayerValue(layer.m_operation, result, layerValues[index] / opacity);
+                    outValues[index] = (result * (1.0f - opacity)) + (operationResult * opacity);
+                }
+            }
+        }
+
+        for (float& value : outValues)
+        {
+            value = AZ::GetClamp(value, 0.0f, 1.0f);
+        }
+    }
+
     bool MixedGradientComponent::IsEntityInHierarchy(const AZ::EntityId& entityId) const
     {
         for (const auto& layer : m_configuration.m_layers)
@@ -98,6 +98,7 @@ namespace GradientSignal
         //////////////////////////////////////////////////////////////////////////
         // GradientRequestBus
         float GetValue(const GradientSampleParams& sampleParams) const override;
+        void GetValues(AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outValues) const override;
         bool IsEntityInHierarchy(const AZ::EntityId& entityId) const override;
 
     protected:
@@ -109,6 +110,9 @@ namespace GradientSignal
         MixedGradientLayer* GetLayer(int layerIndex) override;
 
     private:
+        // Combines the unpremultiplied value of a layer with the result of the previous layers
+        static float MixLayerValue(MixedGradientLayer::MixingOperation operation, float result, float currentUnpremultiplied);
+
         MixedGradientConfig m_configuration;
         LmbrCentral::DependencyMonitor m_dependencyMonitor;
     };
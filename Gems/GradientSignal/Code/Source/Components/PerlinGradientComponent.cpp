@@ -192,6 +192,36 @@ namespace GradientSignal
         return 0.0f;
     }
 
+    void PerlinGradientComponent::GetValues(AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outValues) const
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
+        AZ_Assert(positions.size() == outValues.size(), "GetValues: the positions and the output values have different sizes");
+
+        if (!m_perlinImprovedNoise)
+        {
+            AZStd::fill(outValues.begin(), outValues.end(), 0.0f);
+            return;
+        }
+
+        AZStd::vector<AZ::Vector3> uvws(positions.begin(), positions.end());
+        AZStd::vector<bool> wasPointRejected(positions.size(), false);
+        const bool shouldNormalizeOutput = false;
+        GradientTransformRequestBus::Event(
+            GetEntityId(), &GradientTransformRequestBus::Events::TransformPositionsToUVW, positions, AZStd::span<AZ::Vector3>(uvws), shouldNormalizeOutput,
+            AZStd::span<bool>(wasPointRejected));
+
+        const int octaves = m_configuration.m_octave;
+        const float amplitude = m_configuration.m_amplitude;
+        const float frequency = m_configuration.m_frequency;
+        for (size_t index = 0; index < positions.size(); ++index)
+        {
+            const AZ::Vector3& uvw = uvws[index];
+            outValues[index] = wasPointRejected[index]
+                ? 0.0f
+                : m_perlinImprovedNoise->GenerateOctaveNoise(uvw.GetX(), uvw.GetY(), uvw.GetZ(), octaves, amplitude, frequency);
+        }
+    }
+
     int PerlinGradientComponent::GetRandomSeed() const
     {
         return m_configuration.m_randomSeed;
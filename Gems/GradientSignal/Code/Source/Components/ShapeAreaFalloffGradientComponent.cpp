@@ -10,6 +10,7 @@
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/algorithm.h>
 #include <LmbrCentral/Shape/ShapeComponentBus.h>
 #include <AzCore/Debug/Profiler.h>
 
@@ -174,6 +175,30 @@ namespace GradientSignal
         return GetRatio(m_configuration.m_falloffWidth, 0.0f, distance);
     }
 
+    void ShapeAreaFalloffGradientComponent::GetValues(AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outValues) const
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
+
+        AZ_Assert(positions.size() == outValues.size(), "GetValues: the positions and the output values have different sizes");
+
+        // a missing shape leaves the distances at 0, like GetValue
+        AZStd::fill(outValues.begin(), outValues.end(), 0.0f);
+        LmbrCentral::ShapeComponentRequestsBus::Event(m_configuration.m_shapeEntityId, &LmbrCentral::ShapeComponentRequestsBus::Events::DistanceSquaredFromPoints, positions, outValues);
+
+        for (float& value : outValues)
+        {
+            const float distance = sqrtf(value);
+            if (m_configuration.m_falloffWidth == 0.0f)
+            {
+                value = (distance > 0.0f) ? 0.0f : 1.0f;
+            }
+            else
+            {
+                value = GetRatio(m_configuration.m_falloffWidth, 0.0f, distance);
+            }
+        }
+    }
+
     AZ::EntityId ShapeAreaFalloffGradientComponent::GetShapeEntityId() const
     {
         return m_configuration.m_shapeEntityId;
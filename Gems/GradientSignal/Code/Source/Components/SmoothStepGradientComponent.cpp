@@ -176,6 +176,17 @@ namespace GradientSignal
         return output;
     }
 
+    void SmoothStepGradientComponent::GetValues(AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outValues) const
+    {
+        AZ_Assert(positions.size() == outValues.size(), "GetValues: the positions and the output values have different sizes");
+
+        m_configuration.m_gradientSampler.GetValues(positions, outValues);
+        for (float& value : outValues)
+        {
+            value = m_configuration.m_smoothStep.GetSmoothedValue(AZ::GetClamp(value, 0.0f, 1.0f));
+        }
+    }
+
     bool SmoothStepGradientComponent::IsEntityInHierarchy(const AZ::EntityId& entityId) const
     {
         return m_configuration.m_gradientSampler.IsEntityInHierarchy(entityId);
@@ -21,11 +21,18 @@ AZ_PUSH_DISABLE_WARNING(4251 4996, "-Wunknown-warning-option")
 AZ_POP_DISABLE_WARNING
 
 #include <AWSNativeSDKInit/AWSNativeSDKInit.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/std/algorithm.h>
 #include <AzCore/std/string/conversions.h>
 #include "HttpRequestManager.h"
 
 namespace HttpRequestor
 {
+    AZ_CVAR(AZ::u32, http_requestorWorkerCount, 4, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Number of threads sending the queued HttpRequestor requests, read when the HttpRequestor manager is created.");
+    AZ_CVAR(bool, http_requestorCoalesceRequests, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "When true, identical queued GET requests are sent once and the response is given to all of their callbacks.");
+
     const char* Manager::s_loggingName = "GemHttpRequestManager";
 
     Manager::Manager()
@@ -36,8 +43,22 @@ namespace HttpRequestor
         m_runThread = true;
         // Shutdown will be handled by the InitializationManager - no need to call in the destructor
         AWSNativeSDKInit::InitializationManager::InitAwsApi();
+
+        const AZ::u32 workerCount = AZStd::max(static_cast<AZ::u32>(http_requestorWorkerCount), 1u);
+
+        // A single client is shared by all the workers, so the connections it opens are kept alive and reused
+        // by the following requests to the same host instead of paying a new TCP and TLS handshake each time.
+        Aws::Client::ClientConfiguration config;
+        config.enableTcpKeepAlive = AZ_TRAIT_AZFRAMEWORK_AWS_ENABLE_TCP_KEEP_ALIVE_SUPPORTED;
+        config.maxConnections = workerCount;
+        m_httpClient = Aws::Http::CreateHttpClient(config);
+
         auto function = AZStd::bind(&Manager::ThreadFunction, this);
-        m_thread = AZStd::thread(function, &desc);
+        m_threads.reserve(workerCount);
+        for (AZ::u32 i = 0; i < workerCount; ++i)
+        {
+            m_threads.emplace_back(function, &desc);
+        }
     }
 
     Manager::~Manager()
@@ -45,145 +66,190 @@ namespace HttpRequestor
         // NativeSDK Shutdown does not need to be called here - will be taken care of by the InitializationManager
         m_runThread = false;
         m_requestConditionVar.notify_all();
-        if (m_thread.joinable())
+        for (AZStd::thread& thread : m_threads)
         {
-            m_thread.join();
+            if (thread.joinable())
+            {
+                thread.join();
+            }
         }
-
+        m_httpClient.reset();
     }
 
     void Manager::AddRequest(Parameters && httpRequestParameters)
     {
         {
             AZStd::lock_guard<AZStd::mutex> lock(m_requestMutex);
-            m_requestsToHandle.push(AZStd::move(httpRequestParameters));
+            m_requestsToHandle.push_back(AZStd::move(httpRequestParameters));
         }
-        m_requestConditionVar.notify_all();
+        m_requestConditionVar.notify_one();
     }
 
     void Manager::AddTextRequest(TextParameters && httpTextRequestParameters)
     {
         {
             AZStd::lock_guard<AZStd::mutex> lock(m_requestMutex);
-            m_textRequestsToHandle.push(AZStd::move(httpTextRequestParameters));
+            m_textRequestsToHandle.push_back(AZStd::move(httpTextRequestParameters));
         }
-        m_requestConditionVar.notify_all();
+        m_requestConditionVar.notify_one();
     }
 
     void Manager::ThreadFunction()
     {
-        // Run the thread as long as directed
-        while (m_runThread)
+        // Run the thread as long as directed, the queued requests are still sent once shutdown is requested
+        while (HandleNextRequest())
         {
-            HandleRequestBatch();
         }
     }
 
-    void Manager::HandleRequestBatch()
+    template<typename ParametersType>
+    void Manager::PopCoalescedRequests(AZStd::deque<ParametersType>& queue, AZStd::vector<ParametersType>& outRequests)
     {
-        // Lock mutex and wait for work to be signalled via the condition variable
-        AZStd::unique_lock<AZStd::mutex> lock(m_requestMutex);
-        m_requestConditionVar.wait(lock, [&] { return !m_runThread || !m_requestsToHandle.empty() || !m_textRequestsToHandle.empty(); });
+        outRequests.push_back(AZStd::move(queue.front()));
+        queue.pop_front();
 
-        // Swap queues
-        AZStd::queue<Parameters> requestsToHandle;
-        requestsToHandle.swap(m_requestsToHandle);
+        // Only requests without side effects can share a response
+        const ParametersType& request = outRequests.front();
+        if (!http_requestorCoalesceRequests || request.GetMethod() != Aws::Http::HttpMethod::HTTP_GET || request.GetBodyStream() != nullptr)
+        {
+            return;
+        }
 
-        AZStd::queue<TextParameters> textRequestsToHandle;
-        textRequestsToHandle.swap(m_textRequestsToHandle);
+        for (auto it = queue.begin(); it != queue.end();)
+        {
+            if (it->GetMethod() == Aws::Http::HttpMethod::HTTP_GET && it->GetBodyStream() == nullptr &&
+                it->GetURI() == request.GetURI() && it->GetHeaders() == request.GetHeaders())
+            {
+                outRequests.push_back(AZStd::move(*it));
+                it = queue.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+    }
 
-        // Release lock
-        lock.unlock();
+    bool Manager::HandleNextRequest()
+    {
+        AZStd::vector<Parameters> requests;
+        AZStd::vector<TextParameters> textRequests;
+        {
+            // Lock mutex and wait for work to be signalled via the condition variable
+            AZStd::unique_lock<AZStd::mutex> lock(m_requestMutex);
+            m_requestConditionVar.wait(lock, [&] { return !m_runThread || !m_requestsToHandle.empty() || !m_textRequestsToHandle.empty(); });
+
+            if (!m_requestsToHandle.empty())
+            {
+                PopCoalescedRequests(m_requestsToHandle, requests);
+            }
+            else if (!m_textRequestsToHandle.empty())
+            {
+                PopCoalescedRequests(m_textRequestsToHandle, textRequests);
+            }
+            else
+            {
+                return false;
+            }
+        }
 
         // Handle requests
-        while (!requestsToHandle.empty())
+        if (!requests.empty())
         {
-            HandleRequest(requestsToHandle.front());
-            requestsToHandle.pop();
+            HandleRequest(requests);
         }
-
-        while (!textRequestsToHandle.empty())
+        else
         {
-            HandleTextRequest(textRequestsToHandle.front());
-            textRequestsToHandle.pop();
+            HandleTextRequest(textRequests);
         }
+        return true;
     }
 
-    void Manager::HandleRequest(const Parameters& httpRequestParameters)
+    void Manager::HandleRequest(const AZStd::vector<Parameters>& httpRequestParameters)
     {
-        Aws::Client::ClientConfiguration config;
-        config.enableTcpKeepAlive = AZ_TRAIT_AZFRAMEWORK_AWS_ENABLE_TCP_KEEP_ALIVE_SUPPORTED;
-        std::shared_ptr<Aws::Http::HttpClient> httpClient = Aws::Http::CreateHttpClient(config);
+        auto respond = [&httpRequestParameters](const Aws::Utils::Json::JsonView& json, Aws::Http::HttpResponseCode responseCode)
+        {
+            for (const Parameters& parameters : httpRequestParameters)
+            {
+                parameters.GetCallback()(json, responseCode);
+            }
+        };
 
-        auto httpRequest = Aws::Http::CreateHttpRequest(httpRequestParameters.GetURI(), httpRequestParameters.GetMethod(), Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+        const Parameters& request = httpRequestParameters.front();
+        auto httpRequest = Aws::Http::CreateHttpRequest(request.GetURI(), request.GetMethod(), Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
 
         AZ_Assert(httpRequest, "HttpRequest not created!");
 
-        for (const auto & it : httpRequestParameters.GetHeaders())
+        for (const auto & it : request.GetHeaders())
         {
             httpRequest->SetHeaderValue(it.first.c_str(), it.second.c_str());
         }
 
-        if( httpRequestParameters.GetBodyStream() != nullptr)
+        if( request.GetBodyStream() != nullptr)
         {
-            httpRequest->AddContentBody(httpRequestParameters.GetBodyStream());
-            httpRequest->SetContentLength(AZStd::to_string(httpRequestParameters.GetBodyStream()->str().length()).c_str());
+            httpRequest->AddContentBody(request.GetBodyStream());
+            httpRequest->SetContentLength(AZStd::to_string(request.GetBodyStream()->str().length()).c_str());
         }
         
-        auto httpResponse = httpClient->MakeRequest(httpRequest);
+        auto httpResponse = m_httpClient->MakeRequest(httpRequest);
 
         if (!httpResponse)
         {
-            httpRequestParameters.GetCallback()(Aws::Utils::Json::JsonValue(), Aws::Http::HttpResponseCode::INTERNAL_SERVER_ERROR);
+            respond(Aws::Utils::Json::JsonValue(), Aws::Http::HttpResponseCode::INTERNAL_SERVER_ERROR);
             return;
         }
 
         if (httpResponse->GetResponseCode() != Aws::Http::HttpResponseCode::OK)
         {
-            httpRequestParameters.GetCallback()(Aws::Utils::Json::JsonValue(), httpResponse->GetResponseCode());
+            respond(Aws::Utils::Json::JsonValue(), httpResponse->GetResponseCode());
             return;
         }
 
         Aws::Utils::Json::JsonValue json(httpResponse->GetResponseBody());
         if (json.WasParseSuccessful())
         {
-            httpRequestParameters.GetCallback()(AZStd::move(json), httpResponse->GetResponseCode());
+            respond(json, httpResponse->GetResponseCode());
         }
         else
         {
-            httpRequestParameters.GetCallback()(Aws::Utils::Json::JsonValue(), Aws::Http::HttpResponseCode::INTERNAL_SERVER_ERROR);
+            respond(Aws::Utils::Json::JsonValue(), Aws::Http::HttpResponseCode::INTERNAL_SERVER_ERROR);
         }
     }
 
-    void Manager::HandleTextRequest(const TextParameters & httpRequestParameters)
+    void Manager::HandleTextRequest(const AZStd::vector<TextParameters>& httpTextRequestParameters)
     {
-        Aws::Client::ClientConfiguration config;
-        config.enableTcpKeepAlive = AZ_TRAIT_AZFRAMEWORK_AWS_ENABLE_TCP_KEEP_ALIVE_SUPPORTED;
-        std::shared_ptr<Aws::Http::HttpClient> httpClient = Aws::Http::CreateHttpClient(config);
+        auto respond = [&httpTextRequestParameters](const AZStd::string& data, Aws::Http::HttpResponseCode responseCode)
+        {
+            for (const TextParameters& parameters : httpTextRequestParameters)
+            {
+                parameters.GetCallback()(data, responseCode);
+            }
+        };
 
-        auto httpRequest = Aws::Http::CreateHttpRequest(httpRequestParameters.GetURI(), httpRequestParameters.GetMethod(), Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+        const TextParameters& request = httpTextRequestParameters.front();
+        auto httpRequest = Aws::Http::CreateHttpRequest(request.GetURI(), request.GetMethod(), Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
         
-        for (const auto & it : httpRequestParameters.GetHeaders())
+        for (const auto & it : request.GetHeaders())
         {
             httpRequest->SetHeaderValue(it.first.c_str(), it.second.c_str());
         }
 
-        if (httpRequestParameters.GetBodyStream() != nullptr)
+        if (request.GetBodyStream() != nullptr)
         {
-            httpRequest->AddContentBody(httpRequestParameters.GetBodyStream());
+            httpRequest->AddContentBody(request.GetBodyStream());
         }
 
-        auto httpResponse = httpClient->MakeRequest(httpRequest);
+        auto httpResponse = m_httpClient->MakeRequest(httpRequest);
 
         if (!httpResponse)
         {
-            httpRequestParameters.GetCallback()(AZStd::string(), Aws::Http::HttpResponseCode::INTERNAL_SERVER_ERROR);
+            respond(AZStd::string(), Aws::Http::HttpResponseCode::INTERNAL_SERVER_ERROR);
             return;
         }
 
         if (httpResponse->GetResponseCode() != Aws::Http::HttpResponseCode::OK)
         {
-            httpRequestParameters.GetCallback()(AZStd::string(), httpResponse->GetResponseCode());
+            respond(AZStd::string(), httpResponse->GetResponseCode());
             return;
         }
 
@@ -191,6 +257,6 @@ namespace HttpRequestor
         // TODO(aaj): it feels like there should be some limit maybe 1 MB?
         std::istreambuf_iterator<char> eos;
         AZStd::string data(std::istreambuf_iterator<char>(httpResponse->GetResponseBody()), eos);
-        httpRequestParameters.GetCallback()(AZStd::move(data), httpResponse->GetResponseCode());
+        respond(data, httpResponse->GetResponseCode());
     }
 }
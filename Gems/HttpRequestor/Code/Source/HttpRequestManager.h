@@ -7,7 +7,8 @@
 
 #pragma once
 
-#include <AzCore/std/containers/queue.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/mutex.h>
@@ -17,6 +18,14 @@
 #include <HttpRequestor/HttpRequestParameters.h>
 #include <HttpRequestor/HttpTextRequestParameters.h>
 
+namespace Aws
+{
+    namespace Http
+    {
+        class HttpClient;
+    }
+}
+
 namespace HttpRequestor
 {
     class Manager
@@ -32,25 +41,33 @@ namespace HttpRequestor
         void AddTextRequest(TextParameters && httpTextRequestParameters);
 
     private:
-        // RequestManager thread loop.
+        // RequestManager thread loop, run by each of the worker threads.
         void ThreadFunction();
 
-        // Called by ThreadFunction. Waits for timeout or until notified and processes any requests queued up.
-        void HandleRequestBatch();
+        // Called by ThreadFunction. Waits until notified and handles the request at the head of a queue, along with the queued requests identical to it.
+        // Returns false once the manager is shutting down and both queues are empty.
+        bool HandleNextRequest();
+
+        // Perform an HTTP request, block until a response is received, then give the returned JSON to the callback of each of the requests to parse.
+        // All the requests must be identical, the first one is sent. Returns the HTTPResponseCode to the callbacks to handle any errors.
+        void HandleRequest(const AZStd::vector<Parameters> & httpRequestParameters);
 
-        // Perform an HTTP request, block until a response is received, then give the returned JSON to the callback to parse. Returns the HTTPResponseCode to the callback to handle any errors.
-        void HandleRequest(const Parameters & httpRequestParameters);
+        // Perform an HTTP request, block until a response is received, then give the returned TEXT to the callback of each of the requests to parse.
+        // All the requests must be identical, the first one is sent. Returns the HTTPResponseCode to the callbacks to handle any errors.
+        void HandleTextRequest(const AZStd::vector<TextParameters> & httpTextRequestParameters);
 
-        // Perform an HTTP request, block until a response is received, then give the returned TEXT to the callback to parse. Returns the HTTPResponseCode to the callback to handle any errors.
-        void HandleTextRequest(const TextParameters & httpTextRequestParameters);
+        // Moves the request at the head of the queue to outRequests, followed by the queued requests it can be coalesced with.
+        template<typename ParametersType>
+        static void PopCoalescedRequests(AZStd::deque<ParametersType>& queue, AZStd::vector<ParametersType>& outRequests);
 
     private:
-        AZStd::queue<Parameters>                m_requestsToHandle;                 // Queue of requests that will be made in order of time received
-        AZStd::queue<TextParameters>            m_textRequestsToHandle;             // Queue of requests for TEXT blobs that will be made in order of time received
+        AZStd::deque<Parameters>                m_requestsToHandle;                 // Queue of requests that will be made in order of time received
+        AZStd::deque<TextParameters>            m_textRequestsToHandle;             // Queue of requests for TEXT blobs that will be made in order of time received
         AZStd::mutex                            m_requestMutex;                     // Member variables for synchronization
         AZStd::condition_variable               m_requestConditionVar;
-        AZStd::atomic<bool>                     m_runThread;                        // Run flag used to signal the worker thread
-        AZStd::thread                           m_thread;                           // This is the thread that will be used for all async operations
+        AZStd::atomic<bool>                     m_runThread;                        // Run flag used to signal the worker threads
+        AZStd::vector<AZStd::thread>            m_threads;                          // These are the threads that will be used for all async operations
+        std::shared_ptr<Aws::Http::HttpClient>  m_httpClient;                       // Client shared by the worker threads, keeps its connections alive between requests
         static const char*                      s_loggingName;                      // Name to use for log messages etc...
     };
 
@@ -56,4 +56,22 @@ TEST_F(Integ_HttpTest, HttpRequesterTest)
     EXPECT_NE(Aws::Http::HttpResponseCode::REQUEST_NOT_MADE, resultCode);
 }
 
+TEST_F(Integ_HttpTest, HttpRequesterTest_IdenticalRequests_AllCallbacksCalled)
+{
+    constexpr int requestCount = 8;
+    AZStd::atomic<int> callbackCount{ 0 };
+    for (int i = 0; i < requestCount; ++i)
+    {
+        m_httpRequestManager->AddTextRequest(HttpRequestor::TextParameters("https://httpbin.org/ip", Aws::Http::HttpMethod::HTTP_GET, [&callbackCount](const AZStd::string&, Aws::Http::HttpResponseCode)
+        {
+            ++callbackCount;
+        }));
+    }
+
+    // The queued requests are all handled before the manager shuts down
+    m_httpRequestManager.reset();
+
+    EXPECT_EQ(requestCount, callbackCount);
+}
+
 AZ_UNIT_TEST_HOOK(DEFAULT_UNIT_TEST_ENV);
@@ -19,11 +19,35 @@
 #include <AzCore/std/algorithm.h>
 #include <AzCore/std/containers/array.h>
 #include <AzFramework/Entity/EntityDebugDisplayBus.h>
+#include <Shape/ShapeBatchUtil.h>
 #include <Shape/ShapeDisplay.h>
 #include <random>
 
 namespace LmbrCentral
 {
+    /// Returns the mask of the points within [min, max] on every axis, like Aabb::Contains.
+    static ShapeBatchUtil::Vec4::FloatType BoxContainsBatch(
+        const AZ::Vector3x4& points, const AZ::Vector3x4& min, const AZ::Vector3x4& max)
+    {
+        using ShapeBatchUtil::Vec4;
+        const Vec4::FloatType insideX = Vec4::And(Vec4::CmpGtEq(points.GetX(), min.GetX()), Vec4::CmpLtEq(points.GetX(), max.GetX()));
+        const Vec4::FloatType insideY = Vec4::And(Vec4::CmpGtEq(points.GetY(), min.GetY()), Vec4::CmpLtEq(points.GetY(), max.GetY()));
+        const Vec4::FloatType insideZ = Vec4::And(Vec4::CmpGtEq(points.GetZ(), min.GetZ()), Vec4::CmpLtEq(points.GetZ(), max.GetZ()));
+        return Vec4::And(insideX, Vec4::And(insideY, insideZ));
+    }
+
+    /// Returns the squared distance of the points from the box [min, max], like Aabb::GetDistanceSq.
+    static ShapeBatchUtil::Vec4::FloatType BoxDistanceSqBatch(
+        const AZ::Vector3x4& points, const AZ::Vector3x4& min, const AZ::Vector3x4& max)
+    {
+        using ShapeBatchUtil::Vec4;
+        const AZ::Vector3x4 closest(
+            Vec4::Clamp(points.GetX(), min.GetX(), max.GetX()),
+            Vec4::Clamp(points.GetY(), min.GetY(), max.GetY()),
+            Vec4::Clamp(points.GetZ(), min.GetZ(), max.GetZ()));
+        return (points - closest).GetLengthSq();
+    }
+
     BoxShape::BoxShape()
         : m_nonUniformScaleChangedHandler([this](const AZ::Vector3& scale) {this->OnNonUniformScaleChanged(scale); })
     {
@@ -146,6 +170,88 @@ namespace LmbrCentral
         return m_intersectionDataCache.m_obb.GetDistanceSq(point);
     }
 
+    void BoxShape::ArePointsInside(AZStd::span<const AZ::Vector3> points, AZStd::span<bool> outInside)
+    {
+        AZ_Assert(points.size() == outInside.size(), "ArePointsInside: the points and the output values have different sizes");
+
+        m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_boxShapeConfig, m_currentNonUniformScale);
+
+        if (m_intersectionDataCache.m_axisAligned)
+        {
+            const AZ::Aabb& aabb = m_intersectionDataCache.m_aabb;
+            const AZ::Vector3x4 min = AZ::Vector3x4::CreateSplat(aabb.GetMin());
+            const AZ::Vector3x4 max = AZ::Vector3x4::CreateSplat(aabb.GetMax());
+            ShapeBatchUtil::ForEachBatch(points,
+                [&](const AZ::Vector3x4& batch, size_t index)
+                {
+                    ShapeBatchUtil::StoreMask(BoxContainsBatch(batch, min, max), &outInside[index]);
+                },
+                [&](const AZ::Vector3& point, size_t index)
+                {
+                    outInside[index] = aabb.Contains(point);
+                });
+            return;
+        }
+
+        // test in the local space of the obb, with the inverse rotation applied to all the points of a batch at once
+        const AZ::Obb& obb = m_intersectionDataCache.m_obb;
+        const AZ::Quaternion localFromWorldRotation = obb.GetRotation().GetInverseFast();
+        const AZ::Vector3x4 position = AZ::Vector3x4::CreateSplat(obb.GetPosition());
+        const AZ::Vector3x4 min = AZ::Vector3x4::CreateSplat(-obb.GetHalfLengths());
+        const AZ::Vector3x4 max = AZ::Vector3x4::CreateSplat(obb.GetHalfLengths());
+        ShapeBatchUtil::ForEachBatch(points,
+            [&](const AZ::Vector3x4& batch, size_t index)
+            {
+                const AZ::Vector3x4 local = AZ::TransformVector(localFromWorldRotation, batch - position);
+                ShapeBatchUtil::StoreMask(BoxContainsBatch(local, min, max), &outInside[index]);
+            },
+            [&](const AZ::Vector3& point, size_t index)
+            {
+                outInside[index] = obb.Contains(point);
+            });
+    }
+
+    void BoxShape::DistanceSquaredFromPoints(AZStd::span<const AZ::Vector3> points, AZStd::span<float> outDistancesSquared)
+    {
+        AZ_Assert(points.size() == outDistancesSquared.size(), "DistanceSquaredFromPoints: the points and the output values have different sizes");
+
+        m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_boxShapeConfig, m_currentNonUniformScale);
+
+        using ShapeBatchUtil::Vec4;
+        if (m_intersectionDataCache.m_axisAligned)
+        {
+            const AZ::Aabb& aabb = m_intersectionDataCache.m_aabb;
+            const AZ::Vector3x4 min = AZ::Vector3x4::CreateSplat(aabb.GetMin());
+            const AZ::Vector3x4 max = AZ::Vector3x4::CreateSplat(aabb.GetMax());
+            ShapeBatchUtil::ForEachBatch(points,
+                [&](const AZ::Vector3x4& batch, size_t index)
+                {
+                    Vec4::StoreUnaligned(&outDistancesSquared[index], BoxDistanceSqBatch(batch, min, max));
+                },
+                [&](const AZ::Vector3& point, size_t index)
+                {
+                    outDistancesSquared[index] = aabb.GetDistanceSq(point);
+                });
+            return;
+        }
+
+        const AZ::Obb& obb = m_intersectionDataCache.m_obb;
+        const AZ::Quaternion localFromWorldRotation = obb.GetRotation().GetInverseFast();
+        const AZ::Vector3x4 position = AZ::Vector3x4::CreateSplat(obb.GetPosition());
+        const AZ::Vector3x4 min = AZ::Vector3x4::CreateSplat(-obb.GetHalfLengths());
+        const AZ::Vector3x4 max = AZ::Vector3x4::CreateSplat(obb.GetHalfLengths());
+        ShapeBatchUtil::ForEachBatch(points,
+            [&](const AZ::Vector3x4& batch, size_t index)
+            {
+                const AZ::Vector3x4 local = AZ::TransformVector(localFromWorldRotation, batch - position);
+                Vec4::StoreUnaligned(&outDistancesSquared[index], BoxDistanceSqBatch(local, min, max));
+            },
+            [&](const AZ::Vector3& point, size_t index)
+            {
+                outDistancesSquared[index] = obb.GetDistanceSq(point);
+            });
+    }
+
     bool BoxShape::IntersectRay(const AZ::Vector3& src, const AZ::Vector3& dir, float& distance)
     {
         m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_boxShapeConfig, m_currentNonUniformScale);
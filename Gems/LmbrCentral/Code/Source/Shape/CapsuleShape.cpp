@@ -14,6 +14,7 @@
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <MathConversion.h>
+#include <Shape/ShapeBatchUtil.h>
 
 namespace LmbrCentral
 {
@@ -174,6 +175,88 @@ namespace LmbrCentral
         return powf(AZStd::max(distance, 0.0f), 2.0f);
     }
 
+    void CapsuleShape::ArePointsInside(AZStd::span<const AZ::Vector3> points, AZStd::span<bool> outInside)
+    {
+        AZ_Assert(points.size() == outInside.size(), "ArePointsInside: the points and the output values have different sizes");
+
+        m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_capsuleShapeConfig);
+
+        using ShapeBatchUtil::Vec4;
+        const bool isSphere = m_intersectionDataCache.m_isSphere;
+        const float radiusSquared = powf(m_intersectionDataCache.m_radius, 2.0f);
+        const float axisLengthSquared = powf(m_intersectionDataCache.m_internalHeight, 2.0f);
+        const AZ::Vector3x4 baseLanes = AZ::Vector3x4::CreateSplat(m_intersectionDataCache.m_basePlaneCenterPoint);
+        const AZ::Vector3x4 topLanes = AZ::Vector3x4::CreateSplat(m_intersectionDataCache.m_topPlaneCenterPoint);
+        const AZ::Vector3x4 axisVectorLanes = AZ::Vector3x4::CreateSplat(m_intersectionDataCache.m_axisVector);
+        const Vec4::FloatType radiusSquaredLanes = Vec4::Splat(radiusSquared);
+        const Vec4::FloatType axisLengthSquaredLanes = Vec4::Splat(axisLengthSquared);
+        // same early out as AZ::Intersect::PointCylinder for a cylinder without volume
+        const bool hasCylinder = !isSphere && axisLengthSquared > 0.0f && radiusSquared > 0.0f;
+
+        ShapeBatchUtil::ForEachBatch(points,
+            [&](const AZ::Vector3x4& batch, size_t index)
+            {
+                // same tests as the scalar version, combined instead of returning early
+                const AZ::Vector3x4 baseToPoint = batch - baseLanes;
+                const Vec4::FloatType baseLengthSquared = baseToPoint.GetLengthSq();
+                Vec4::FloatType inside = Vec4::CmpLt(baseLengthSquared, radiusSquaredLanes);
+                if (!isSphere)
+                {
+                    inside = Vec4::Or(inside, Vec4::CmpLt((batch - topLanes).GetLengthSq(), radiusSquaredLanes));
+                }
+                if (hasCylinder)
+                {
+                    const Vec4::FloatType dotProduct = baseToPoint.Dot(axisVectorLanes);
+                    const Vec4::FloatType distanceSquared = Vec4::Sub(
+                        baseLengthSquared, Vec4::Div(Vec4::Mul(dotProduct, dotProduct), axisLengthSquaredLanes));
+                    const Vec4::FloatType insideCylinder = Vec4::And(
+                        Vec4::And(Vec4::CmpGtEq(dotProduct, Vec4::ZeroFloat()), Vec4::CmpLtEq(dotProduct, axisLengthSquaredLanes)),
+                        Vec4::CmpLtEq(distanceSquared, radiusSquaredLanes));
+                    inside = Vec4::Or(inside, insideCylinder);
+                }
+                ShapeBatchUtil::StoreMask(inside, &outInside[index]);
+            },
+            [&](const AZ::Vector3& point, size_t index)
+            {
+                outInside[index] = IsPointInside(point);
+            });
+    }
+
+    void CapsuleShape::DistanceSquaredFromPoints(AZStd::span<const AZ::Vector3> points, AZStd::span<float> outDistancesSquared)
+    {
+        AZ_Assert(points.size() == outDistancesSquared.size(), "DistanceSquaredFromPoints: the points and the output values have different sizes");
+
+        m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_capsuleShapeConfig);
+
+        // distance to the closest point of the segment between the centers of the end caps, like Distance::Point_Lineseg
+        using ShapeBatchUtil::Vec4;
+        const AZ::Vector3& base = m_intersectionDataCache.m_basePlaneCenterPoint;
+        const AZ::Vector3 segment = m_intersectionDataCache.m_topPlaneCenterPoint - base;
+        const float segmentLengthSquared = segment.GetLengthSq();
+        const AZ::Vector3x4 baseLanes = AZ::Vector3x4::CreateSplat(base);
+        const AZ::Vector3x4 segmentLanes = AZ::Vector3x4::CreateSplat(segment);
+        const Vec4::FloatType segmentLengthSquaredLanes = Vec4::Splat(segmentLengthSquared);
+        const Vec4::FloatType radiusLanes = Vec4::Splat(m_intersectionDataCache.m_radius);
+
+        ShapeBatchUtil::ForEachBatch(points,
+            [&](const AZ::Vector3x4& batch, size_t index)
+            {
+                AZ::Vector3x4 baseToPoint = batch - baseLanes;
+                if (segmentLengthSquared > 0.0f)
+                {
+                    const Vec4::FloatType t = Vec4::Div(
+                        Vec4::Clamp(baseToPoint.Dot(segmentLanes), Vec4::ZeroFloat(), segmentLengthSquaredLanes), segmentLengthSquaredLanes);
+                    baseToPoint -= segmentLanes * t;
+                }
+                const Vec4::FloatType distance = Vec4::Max(Vec4::Sub(baseToPoint.GetLength(), radiusLanes), Vec4::ZeroFloat());
+                Vec4::StoreUnaligned(&outDistancesSquared[index], Vec4::Mul(distance, distance));
+            },
+            [&](const AZ::Vector3& point, size_t index)
+            {
+                outDistancesSquared[index] = DistanceSquaredFromPoint(point);
+            });
+    }
+
     bool CapsuleShape::IntersectRay(const AZ::Vector3& src, const AZ::Vector3& dir, float& distance)
     {
         m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_capsuleShapeConfig);
@@ -16,7 +16,9 @@
 #include <AzCore/Math/MathUtils.h>
 #include <AzCore/Math/Random.h>
 #include <AzCore/Math/Sfmt.h>
+#include <AzCore/std/algorithm.h>
 #include <AzFramework/Entity/EntityDebugDisplayBus.h>
+#include <Shape/ShapeBatchUtil.h>
 #include <Shape/ShapeDisplay.h>
 
 #include "Cry_GeoDistance.h"
@@ -250,6 +252,74 @@ namespace LmbrCentral
             m_intersectionDataCache.m_radius);
     }
 
+    void CylinderShape::ArePointsInside(AZStd::span<const AZ::Vector3> points, AZStd::span<bool> outInside)
+    {
+        AZ_Assert(points.size() == outInside.size(), "ArePointsInside: the points and the output values have different sizes");
+
+        m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_cylinderShapeConfig);
+
+        const AZ::Vector3& baseCenterPoint = m_intersectionDataCache.m_baseCenterPoint;
+        const AZ::Vector3& axisVector = m_intersectionDataCache.m_axisVector;
+        const float axisLengthSquared = powf(m_intersectionDataCache.m_height, 2.0f);
+        const float radiusSquared = powf(m_intersectionDataCache.m_radius, 2.0f);
+
+        // if the cylinder shape has no volume then no point can be inside
+        if (axisLengthSquared <= 0.0f || radiusSquared <= 0.0f)
+        {
+            AZStd::fill(outInside.begin(), outInside.end(), false);
+            return;
+        }
+
+        // same test as AZ::Intersect::PointCylinder
+        using ShapeBatchUtil::Vec4;
+        const AZ::Vector3x4 baseCenterPointLanes = AZ::Vector3x4::CreateSplat(baseCenterPoint);
+        const AZ::Vector3x4 axisVectorLanes = AZ::Vector3x4::CreateSplat(axisVector);
+        const Vec4::FloatType axisLengthSquaredLanes = Vec4::Splat(axisLengthSquared);
+        const Vec4::FloatType radiusSquaredLanes = Vec4::Splat(radiusSquared);
+
+        ShapeBatchUtil::ForEachBatch(points,
+            [&](const AZ::Vector3x4& batch, size_t index)
+            {
+                const AZ::Vector3x4 baseCenterPointToPoint = batch - baseCenterPointLanes;
+                const Vec4::FloatType dotProduct = baseCenterPointToPoint.Dot(axisVectorLanes);
+                const Vec4::FloatType distanceSquared = Vec4::Sub(
+                    baseCenterPointToPoint.GetLengthSq(), Vec4::Div(Vec4::Mul(dotProduct, dotProduct), axisLengthSquaredLanes));
+                const Vec4::FloatType inside = Vec4::And(
+                    Vec4::And(Vec4::CmpGtEq(dotProduct, Vec4::ZeroFloat()), Vec4::CmpLtEq(dotProduct, axisLengthSquaredLanes)),
+                    Vec4::CmpLtEq(distanceSquared, radiusSquaredLanes));
+                ShapeBatchUtil::StoreMask(inside, &outInside[index]);
+            },
+            [&](const AZ::Vector3& point, size_t index)
+            {
+                outInside[index] = AZ::Intersect::PointCylinder(baseCenterPoint, axisVector, axisLengthSquared, radiusSquared, point);
+            });
+    }
+
+    void CylinderShape::DistanceSquaredFromPoints(AZStd::span<const AZ::Vector3> points, AZStd::span<float> outDistancesSquared)
+    {
+        AZ_Assert(points.size() == outDistancesSquared.size(), "DistanceSquaredFromPoints: the points and the output values have different sizes");
+
+        m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_cylinderShapeConfig);
+
+        const AZ::Vector3& baseCenterPoint = m_intersectionDataCache.m_baseCenterPoint;
+        if (m_cylinderShapeConfig.m_height <= 0.0f || m_cylinderShapeConfig.m_radius <= 0.0f)
+        {
+            for (size_t index = 0; index < points.size(); ++index)
+            {
+                outDistancesSquared[index] = (baseCenterPoint - points[index]).GetLengthSq();
+            }
+            return;
+        }
+
+        // the distance to the caps and the side is branchy, only the cache update is shared by the batch
+        const AZ::Vector3 topCenterPoint = baseCenterPoint + m_intersectionDataCache.m_axisVector;
+        for (size_t index = 0; index < points.size(); ++index)
+        {
+            outDistancesSquared[index] = Distance::Point_CylinderSq(
+                points[index], baseCenterPoint, topCenterPoint, m_intersectionDataCache.m_radius);
+        }
+    }
+
     bool CylinderShape::IntersectRay(const AZ::Vector3& src, const AZ::Vector3& dir, float& distance)
     {
         m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_cylinderShapeConfig);
@@ -44,6 +44,8 @@ namespace LmbrCentral
         AZ::Crc32 GetShapeType() override { return AZ_CRC("Cylinder", 0x9b045bea); }
         bool IsPointInside(const AZ::Vector3& point) override;
         float DistanceSquaredFromPoint(const AZ::Vector3& point) override;
+        void ArePointsInside(AZStd::span<const AZ::Vector3> points, AZStd::span<bool> outInside) override;
+        void DistanceSquaredFromPoints(AZStd::span<const AZ::Vector3> points, AZStd::span<float> outDistancesSquared) override;
         AZ::Aabb GetEncompassingAabb() override;
         void GetTransformAndLocalBounds(AZ::Transform& transform, AZ::Aabb& bounds) override;
         AZ::Vector3 GenerateRandomPointInside(AZ::RandomDistributionType randomDistribution) override;
@@ -23,6 +23,46 @@
 
 namespace LmbrCentral
 {
+    /// Upper bound of the number of bands of PolygonPrismEdgeBands.
+    static constexpr size_t MaxEdgeBandCount = 256;
+    /// Extra height of each edge when bucketing it in bands, larger than the distance at which the crossing test
+    /// counts an edge as touched by the ray (the square root of the crossing epsilon).
+    static constexpr float EdgeBandMargin = 0.02f;
+    /// Squared distance under which the ray of the crossing test intersects an edge.
+    static constexpr float CrossingTestEpsilon = 0.0001f;
+
+    /// Returns if the ray of the 'crossing test' from localPointFlattened along the x axis crosses an edge of the polygon.
+    static bool RayCrossesEdge(
+        const AZ::Vector3& localPointFlattened, const AZ::Vector3& point,
+        const AZ::Vector3& segmentStart, const AZ::Vector3& segmentEnd)
+    {
+        const float projectRayLength = 1000.0f;
+        const AZ::Vector3 localEndFlattened = localPointFlattened + AZ::Vector3::CreateAxisX() * projectRayLength;
+
+        AZ::Vector3 closestPosRay, closestPosSegment;
+        float rayProportion, segmentProportion;
+        AZ::Intersect::ClosestSegmentSegment(localPointFlattened, localEndFlattened, segmentStart, segmentEnd, rayProportion, segmentProportion, closestPosRay, closestPosSegment);
+        const float delta = (closestPosRay - closestPosSegment).GetLengthSq();
+
+        // have we crossed/touched a line on the polygon
+        if (delta < CrossingTestEpsilon)
+        {
+            const AZ::Vector3 highestVertex = segmentStart.GetY() > segmentEnd.GetY() ? segmentStart : segmentEnd;
+
+            const float threshold = (highestVertex - point).Dot(AZ::Vector3::CreateAxisY());
+            if (AZ::IsClose(segmentProportion, 0.0f, AZ::Constants::FloatEpsilon))
+            {
+                // if at beginning of segment, only count intersection if segment is going up (y-axis)
+                // (prevent counting segments twice when intersecting at vertex)
+                return threshold > 0.0f;
+            }
+
+            return true;
+        }
+
+        return false;
+    }
+
     /// Generates solid polygon prism mesh.
     /// Applies non-uniform scale, but does not apply any scale from the transform, which is assumed to be applied separately elsewhere.
     static void GenerateSolidPolygonPrismMesh(
@@ -357,21 +397,57 @@ namespace LmbrCentral
     {
         m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, *m_polygonPrism, m_currentNonUniformScale);
 
-        // initial early aabb rejection test
-        // note: will implicitly do height test too
-        if (!GetEncompassingAabb().Contains(point))
+        return IsPointInsideCached(point);
+    }
+
+    float PolygonPrismShape::DistanceSquaredFromPoint(const AZ::Vector3& point)
+    {
+        m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, *m_polygonPrism, m_currentNonUniformScale);
+
+        return PolygonPrismUtil::DistanceSquaredFromPoint(
+            *m_polygonPrism, point, m_currentTransform, &m_intersectionDataCache.m_edgeBands);
+    }
+
+    void PolygonPrismShape::ArePointsInside(AZStd::span<const AZ::Vector3> points, AZStd::span<bool> outInside)
+    {
+        AZ_Assert(points.size() == outInside.size(), "ArePointsInside: the points and the output values have different sizes");
+
+        // update the cache once for the whole batch, instead of once per point
+        m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, *m_polygonPrism, m_currentNonUniformScale);
+
+        for (size_t index = 0; index < points.size(); ++index)
         {
-            return false;
+            outInside[index] = IsPointInsideCached(points[index]);
         }
-
-        return PolygonPrismUtil::IsPointInside(*m_polygonPrism, point, m_currentTransform);
     }
 
-    float PolygonPrismShape::DistanceSquaredFromPoint(const AZ::Vector3& point)
+    void PolygonPrismShape::DistanceSquaredFromPoints(AZStd::span<const AZ::Vector3> points, AZStd::span<float> outDistancesSquared)
     {
+        AZ_Assert(points.size() == outDistancesSquared.size(), "DistanceSquaredFromPoints: the points and the output values have different sizes");
+
         m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, *m_polygonPrism, m_currentNonUniformScale);
 
-        return PolygonPrismUtil::DistanceSquaredFromPoint(*m_polygonPrism, point, m_currentTransform);;
+        for (size_t index = 0; index < points.size(); ++index)
+        {
+            outDistancesSquared[index] = PolygonPrismUtil::DistanceSquaredFromPoint(
+                *m_polygonPrism, points[index], m_currentTransform, &m_intersectionDataCache.m_edgeBands);
+        }
+    }
+
+    bool PolygonPrismShape::IsPointInsideCached(const AZ::Vector3& point) const
+    {
+        // initial early aabb rejection test
+        // note: will implicitly do height test too
+        if (!m_intersectionDataCache.m_aabb.Contains(point))
+        {
+            return false;
+        }
+
+        // it's fine to invert the transform including scale here, because it won't affect whether the point is inside the prism
+        const AZ::Vector3 localPoint =
+            m_intersectionDataCache.m_localFromWorldUniformScale.TransformPoint(point) / m_polygonPrism->GetNonUniformScale();
+
+        return m_intersectionDataCache.m_edgeBands.IsPointInside(localPoint, point, m_polygonPrism->GetHeight());
     }
 
     bool PolygonPrismShape::IntersectRay(const AZ::Vector3& src, const AZ::Vector3& dir, float& distance)
@@ -389,6 +465,108 @@ namespace LmbrCentral
         GenerateSolidPolygonPrismMesh(
             polygonPrism.m_vertexContainer.GetVertices(),
             polygonPrism.GetHeight(), currentNonUniformScale, m_triangles);
+
+        AZ::Transform worldFromLocalUniformScale = currentTransform;
+        worldFromLocalUniformScale.SetUniformScale(worldFromLocalUniformScale.GetUniformScale());
+        m_localFromWorldUniformScale = worldFromLocalUniformScale.GetInverse();
+        m_edgeBands.Build(polygonPrism.m_vertexContainer.GetVertices());
+    }
+
+    void PolygonPrismEdgeBands::Build(const AZStd::vector<AZ::Vector2>& vertices)
+    {
+        m_edgeVertices.clear();
+        m_bandEdges.clear();
+        m_bandOffsets.clear();
+
+        const size_t vertexCount = vertices.size();
+        if (vertexCount == 0)
+        {
+            m_bandsMinY = 0.0f;
+            m_bandsPerUnit = 0.0f;
+            return;
+        }
+
+        float minY = vertices[0].GetY();
+        float maxY = minY;
+        m_edgeVertices.reserve(vertexCount * 2);
+        for (size_t i = 0; i < vertexCount; ++i)
+        {
+            m_edgeVertices.push_back(AZ::Vector2ToVector3(vertices[i]));
+            m_edgeVertices.push_back(AZ::Vector2ToVector3(vertices[(i + 1) % vertexCount]));
+            minY = AZ::GetMin(minY, vertices[i].GetY());
+            maxY = AZ::GetMax(maxY, vertices[i].GetY());
+        }
+
+        const size_t bandCount = AZ::GetClamp<size_t>(vertexCount, 1, MaxEdgeBandCount);
+        m_bandsMinY = minY - EdgeBandMargin;
+        m_bandsPerUnit = static_cast<float>(bandCount) / (maxY - minY + 2.0f * EdgeBandMargin);
+
+        // first pass counts the edges of each band, second pass fills them in
+        AZStd::vector<AZStd::pair<AZ::u32, AZ::u32>> edgeBandRanges;
+        edgeBandRanges.reserve(vertexCount);
+        m_bandOffsets.resize(bandCount + 1, 0);
+        for (size_t edge = 0; edge < vertexCount; ++edge)
+        {
+            const float edgeMinY = AZ::GetMin(m_edgeVertices[edge * 2].GetY(), m_edgeVertices[edge * 2 + 1].GetY()) - EdgeBandMargin;
+            const float edgeMaxY = AZ::GetMax(m_edgeVertices[edge * 2].GetY(), m_edgeVertices[edge * 2 + 1].GetY()) + EdgeBandMargin;
+            const AZ::u32 firstBand = static_cast<AZ::u32>(
+                AZ::GetClamp((edgeMinY - m_bandsMinY) * m_bandsPerUnit, 0.0f, static_cast<float>(bandCount - 1)));
+            const AZ::u32 lastBand = static_cast<AZ::u32>(
+                AZ::GetClamp((edgeMaxY - m_bandsMinY) * m_bandsPerUnit, 0.0f, static_cast<float>(bandCount - 1)));
+            edgeBandRanges.emplace_back(firstBand, lastBand);
+            for (AZ::u32 band = firstBand; band <= lastBand; ++band)
+            {
+                m_bandOffsets[band + 1]++;
+            }
+        }
+
+        for (size_t band = 0; band < bandCount; ++band)
+        {
+            m_bandOffsets[band + 1] += m_bandOffsets[band];
+        }
+
+        m_bandEdges.resize(m_bandOffsets[bandCount]);
+        AZStd::vector<AZ::u32> bandFill(m_bandOffsets.begin(), m_bandOffsets.end() - 1);
+        for (size_t edge = 0; edge < vertexCount; ++edge)
+        {
+            for (AZ::u32 band = edgeBandRanges[edge].first; band <= edgeBandRanges[edge].second; ++band)
+            {
+                m_bandEdges[bandFill[band]++] = static_cast<AZ::u32>(edge);
+            }
+        }
+    }
+
+    bool PolygonPrismEdgeBands::IsPointInside(const AZ::Vector3& localPoint, const AZ::Vector3& point, const float height) const
+    {
+        // ensure the point is not above or below the prism (in its local space)
+        if (localPoint.GetZ() < 0.0f || localPoint.GetZ() > height || m_bandOffsets.empty())
+        {
+            return false;
+        }
+
+        // the ray can't get close to an edge outside of the band of the point
+        const float bandPosition = (localPoint.GetY() - m_bandsMinY) * m_bandsPerUnit;
+        const size_t bandCount = m_bandOffsets.size() - 1;
+        if (!(bandPosition >= 0.0f && bandPosition < static_cast<float>(bandCount)))
+        {
+            return false;
+        }
+
+        const size_t band = static_cast<size_t>(bandPosition);
+        const AZ::Vector3 localPointFlattened = AZ::Vector3(localPoint.GetX(), localPoint.GetY(), 0.0f);
+
+        size_t intersections = 0;
+        for (AZ::u32 i = m_bandOffsets[band]; i < m_bandOffsets[band + 1]; ++i)
+        {
+            const AZ::u32 edge = m_bandEdges[i];
+            if (RayCrossesEdge(localPointFlattened, point, m_edgeVertices[edge * 2], m_edgeVertices[edge * 2 + 1]))
+            {
+                intersections++;
+            }
+        }
+
+        // odd inside, even outside - bitwise AND to convert to bool
+        return intersections & 1;
     }
 
     void DrawPolygonPrismShape(
@@ -452,9 +630,6 @@ namespace LmbrCentral
         {
             using namespace PolygonPrismUtil;
 
-            const float epsilon = 0.0001f;
-            const float projectRayLength = 1000.0f;
-
             const AZStd::vector<AZ::Vector2>& vertices = polygonPrism.m_vertexContainer.GetVertices();
             const size_t vertexCount = vertices.size();
 
@@ -473,7 +648,6 @@ namespace LmbrCentral
             }
 
             const AZ::Vector3 localPointFlattened = AZ::Vector3(localPoint.GetX(), localPoint.GetY(), 0.0f);
-            const AZ::Vector3 localEndFlattened = localPointFlattened + AZ::Vector3::CreateAxisX() * projectRayLength;
 
             size_t intersections = 0;
             // use 'crossing test' algorithm to decide if the point lies within the volume or not
@@ -483,30 +657,9 @@ namespace LmbrCentral
                 const AZ::Vector3 segmentStart = AZ::Vector2ToVector3(vertices[i]);
                 const AZ::Vector3 segmentEnd = AZ::Vector2ToVector3(vertices[(i + 1) % vertexCount]);
 
-                AZ::Vector3 closestPosRay, closestPosSegment;
-                float rayProportion, segmentProportion;
-                AZ::Intersect::ClosestSegmentSegment(localPointFlattened, localEndFlattened, segmentStart, segmentEnd, rayProportion, segmentProportion, closestPosRay, closestPosSegment);
-                const float delta = (closestPosRay - closestPosSegment).GetLengthSq();
-
-                // have we crossed/touched a line on the polygon
-                if (delta < epsilon)
+                if (RayCrossesEdge(localPointFlattened, point, segmentStart, segmentEnd))
                 {
-                    const AZ::Vector3 highestVertex = segmentStart.GetY() > segmentEnd.GetY() ? segmentStart : segmentEnd;
-
-                    const float threshold = (highestVertex - point).Dot(AZ::Vector3::CreateAxisY());
-                    if (AZ::IsClose(segmentProportion, 0.0f, AZ::Constants::FloatEpsilon))
-                    {
-                        // if at beginning of segment, only count intersection if segment is going up (y-axis)
-                        // (prevent counting segments twice when intersecting at vertex)
-                        if (threshold > 0.0f)
-                        {
-                            intersections++;
-                        }
-                    }
-                    else
-                    {
-                        intersections++;
-                    }
+                    intersections++;
                 }
             }
 
@@ -514,7 +667,9 @@ namespace LmbrCentral
             return intersections & 1;
         }
 
-        float DistanceSquaredFromPoint(const AZ::PolygonPrism& polygonPrism, const AZ::Vector3& point, const AZ::Transform& worldFromLocal)
+        float DistanceSquaredFromPoint(
+            const AZ::PolygonPrism& polygonPrism, const AZ::Vector3& point, const AZ::Transform& worldFromLocal,
+            const PolygonPrismEdgeBands* edgeBands)
         {
             const float height = polygonPrism.GetHeight();
             const AZ::Vector3& nonUniformScale = polygonPrism.GetNonUniformScale();
@@ -537,7 +692,21 @@ namespace LmbrCentral
             const AZ::Vector3 worldPointFlattened = worldFromLocalNoScale.TransformPoint(localPointFlattened);
 
             // first test if the point is contained within the polygon (flatten)
-            if (IsPointInside(polygonPrism, worldPointFlattened, worldFromLocal))
+            bool insidePolygon = false;
+            if (edgeBands)
+            {
+                AZ::Transform worldFromLocalUniformScale = worldFromLocal;
+                worldFromLocalUniformScale.SetUniformScale(worldFromLocalUniformScale.GetUniformScale());
+                const AZ::Vector3 localPointFlattenedScaled =
+                    worldFromLocalUniformScale.GetInverse().TransformPoint(worldPointFlattened) / nonUniformScale;
+                insidePolygon = edgeBands->IsPointInside(localPointFlattenedScaled, worldPointFlattened, height);
+            }
+            else
+            {
+                insidePolygon = IsPointInside(polygonPrism, worldPointFlattened, worldFromLocal);
+            }
+
+            if (insidePolygon)
             {
                 if (localPoint.GetZ() < bottom)
                 {
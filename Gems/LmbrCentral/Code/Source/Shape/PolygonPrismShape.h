@@ -21,6 +21,28 @@ namespace LmbrCentral
 {
     struct ShapeDrawParams;
 
+    /// Edges of the polygon of a polygon prism, bucketed in bands along the local y axis.
+    /// The crossing test used to check if a point is inside the polygon then only visits the edges of the band
+    /// of the point, instead of every edge of the polygon.
+    class PolygonPrismEdgeBands
+    {
+    public:
+        void Build(const AZStd::vector<AZ::Vector2>& vertices);
+
+        /// Same result as PolygonPrismUtil::IsPointInside.
+        /// @param localPoint The point in the local space of the prism, including its non-uniform scale.
+        /// @param point The point in world space.
+        /// @param height The height of the prism.
+        bool IsPointInside(const AZ::Vector3& localPoint, const AZ::Vector3& point, float height) const;
+
+    private:
+        AZStd::vector<AZ::Vector3> m_edgeVertices; ///< Start and end of each edge, flattened to z = 0.
+        AZStd::vector<AZ::u32> m_bandEdges; ///< Indices of the edges close to each band.
+        AZStd::vector<AZ::u32> m_bandOffsets; ///< First index of each band in m_bandEdges, followed by the end of the last band.
+        float m_bandsMinY = 0.0f; ///< Local y of the start of the first band.
+        float m_bandsPerUnit = 0.0f; ///< Inverse of the height of a band.
+    };
+
     /// Buffer to store triangles of top and bottom of Polygon Prism.
     struct PolygonPrismMesh
     {
@@ -61,6 +83,8 @@ namespace LmbrCentral
         void GetTransformAndLocalBounds(AZ::Transform& transform, AZ::Aabb& bounds) override;
         bool IsPointInside(const AZ::Vector3& point) override;
         float DistanceSquaredFromPoint(const AZ::Vector3& point) override;
+        void ArePointsInside(AZStd::span<const AZ::Vector3> points, AZStd::span<bool> outInside) override;
+        void DistanceSquaredFromPoints(AZStd::span<const AZ::Vector3> points, AZStd::span<float> outDistancesSquared) override;
         bool IntersectRay(const AZ::Vector3& src, const AZ::Vector3& dir, float& distance) override;
 
         // PolygonShapeShapeComponentRequestBus::Handler
@@ -100,8 +124,13 @@ namespace LmbrCentral
 
             AZ::Aabb m_aabb; ///< Aabb of polygon prism shape.
             AZStd::vector<AZ::Vector3> m_triangles; ///< Triangles comprising the polygon prism shape (for intersection testing).
+            AZ::Transform m_localFromWorldUniformScale; ///< Inverse of the world transform, uniform scale included.
+            PolygonPrismEdgeBands m_edgeBands; ///< Edges of the polygon (for point containment testing).
         };
 
+        /// Returns if a point in world space is inside the prism, using the intersection data cache.
+        bool IsPointInsideCached(const AZ::Vector3& point) const;
+
         AZ::PolygonPrismPtr m_polygonPrism; ///< Reference to the underlying polygon prism data.
         PolygonPrismIntersectionDataCache m_intersectionDataCache; ///< Caches transient intersection data.
         AZ::Transform m_currentTransform = AZ::Transform::CreateIdentity(); ///< Caches the current transform for this shape.
@@ -129,7 +158,10 @@ namespace LmbrCentral
         bool IsPointInside(const AZ::PolygonPrism& polygonPrism, const AZ::Vector3& point, const AZ::Transform& transform);
 
         /// Return distance squared from point in world space from polygon prism shape
-        float DistanceSquaredFromPoint(const AZ::PolygonPrism& polygonPrism, const AZ::Vector3& point, const AZ::Transform& transform);
+        /// @param edgeBands (Optional) Edges of the polygon prism, to speed up the containment test.
+        float DistanceSquaredFromPoint(
+            const AZ::PolygonPrism& polygonPrism, const AZ::Vector3& point, const AZ::Transform& transform,
+            const PolygonPrismEdgeBands* edgeBands = nullptr);
 
         /// Return if a ray is intersecting the polygon prism.
         bool IntersectRay(
@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/SimdMath.h>
+#include <AzCore/Math/Vector3Batch.h>
+#include <AzCore/std/containers/span.h>
+
+namespace LmbrCentral
+{
+    /// Helpers for the batched ShapeComponentRequests queries, processing Simd::Vec4::ElementCount points at a time.
+    namespace ShapeBatchUtil
+    {
+        using Vec4 = AZ::Simd::Vec4;
+        static constexpr size_t LaneCount = static_cast<size_t>(Vec4::ElementCount);
+
+        /// Calls batchFunc(const AZ::Vector3x4& points, size_t index) for each full batch of points starting at index,
+        /// and scalarFunc(const AZ::Vector3& point, size_t index) for the remaining points.
+        template<typename BatchFunc, typename ScalarFunc>
+        void ForEachBatch(AZStd::span<const AZ::Vector3> points, BatchFunc&& batchFunc, ScalarFunc&& scalarFunc)
+        {
+            const size_t count = points.size();
+            const size_t batchCount = count - count % LaneCount;
+            for (size_t index = 0; index < batchCount; index += LaneCount)
+            {
+                batchFunc(AZ::Vector3x4::CreateGather(points.data() + index), index);
+            }
+
+            for (size_t index = batchCount; index < count; ++index)
+            {
+                scalarFunc(points[index], index);
+            }
+        }
+
+        /// Writes the lanes of a comparison mask to LaneCount bools.
+        inline void StoreMask(Vec4::FloatArgType mask, bool* outValues)
+        {
+            AZ_ALIGN(int32_t lanes[LaneCount], 16);
+            Vec4::StoreAligned(lanes, Vec4::CastToInt(mask));
+            for (size_t lane = 0; lane < LaneCount; ++lane)
+            {
+                outValues[lane] = lanes[lane] != 0;
+            }
+        }
+    } // namespace ShapeBatchUtil
+} // namespace LmbrCentral
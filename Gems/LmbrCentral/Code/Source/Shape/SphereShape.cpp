@@ -14,6 +14,7 @@
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Math/IntersectSegment.h>
 #include <AzFramework/Entity/EntityDebugDisplayBus.h>
+#include <Shape/ShapeBatchUtil.h>
 #include <Shape/ShapeDisplay.h>
 
 namespace LmbrCentral
@@ -118,6 +119,54 @@ namespace LmbrCentral
         return powf(AZStd::max(distance, 0.0f), 2.0f);
     }
 
+    void SphereShape::ArePointsInside(AZStd::span<const AZ::Vector3> points, AZStd::span<bool> outInside)
+    {
+        AZ_Assert(points.size() == outInside.size(), "ArePointsInside: the points and the output values have different sizes");
+
+        m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_sphereShapeConfig);
+
+        using ShapeBatchUtil::Vec4;
+        const AZ::Vector3& center = m_intersectionDataCache.m_position;
+        const float radiusSquared = powf(m_intersectionDataCache.m_radius, 2.0f);
+        const AZ::Vector3x4 centerLanes = AZ::Vector3x4::CreateSplat(center);
+        const Vec4::FloatType radiusSquaredLanes = Vec4::Splat(radiusSquared);
+
+        ShapeBatchUtil::ForEachBatch(points,
+            [&](const AZ::Vector3x4& batch, size_t index)
+            {
+                ShapeBatchUtil::StoreMask(Vec4::CmpLt((batch - centerLanes).GetLengthSq(), radiusSquaredLanes), &outInside[index]);
+            },
+            [&](const AZ::Vector3& point, size_t index)
+            {
+                outInside[index] = AZ::Intersect::PointSphere(center, radiusSquared, point);
+            });
+    }
+
+    void SphereShape::DistanceSquaredFromPoints(AZStd::span<const AZ::Vector3> points, AZStd::span<float> outDistancesSquared)
+    {
+        AZ_Assert(points.size() == outDistancesSquared.size(), "DistanceSquaredFromPoints: the points and the output values have different sizes");
+
+        m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_sphereShapeConfig);
+
+        using ShapeBatchUtil::Vec4;
+        const AZ::Vector3& center = m_intersectionDataCache.m_position;
+        const float radius = m_intersectionDataCache.m_radius;
+        const AZ::Vector3x4 centerLanes = AZ::Vector3x4::CreateSplat(center);
+        const Vec4::FloatType radiusLanes = Vec4::Splat(radius);
+
+        ShapeBatchUtil::ForEachBatch(points,
+            [&](const AZ::Vector3x4& batch, size_t index)
+            {
+                const Vec4::FloatType distance = Vec4::Max(Vec4::Sub((centerLanes - batch).GetLength(), radiusLanes), Vec4::ZeroFloat());
+                Vec4::StoreUnaligned(&outDistancesSquared[index], Vec4::Mul(distance, distance));
+            },
+            [&](const AZ::Vector3& point, size_t index)
+            {
+                const float distance = (center - point).GetLength() - radius;
+                outDistancesSquared[index] = powf(AZStd::max(distance, 0.0f), 2.0f);
+            });
+    }
+
     bool SphereShape::IntersectRay(const AZ::Vector3& src, const AZ::Vector3& dir, float& distance)
     {
         m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_sphereShapeConfig);
@@ -15,6 +15,7 @@
 #include <AzFramework/Components/NonUniformScaleComponent.h>
 #include <Shape/BoxShapeComponent.h>
 #include <AzCore/UnitTest/TestTypes.h>
+#include <Tests/ShapeBatchTestUtils.h>
 #include <AZTestShared/Math/MathTestHelpers.h>
 #include <AzFramework/UnitTest/TestDebugDisplayRequests.h>
 
@@ -652,4 +653,25 @@ namespace UnitTest
         EXPECT_THAT(debugDrawAabb.GetMin(), IsClose(shapeAabb.GetMin()));
         EXPECT_THAT(debugDrawAabb.GetMax(), IsClose(shapeAabb.GetMax()));
     }
+
+    TEST_F(BoxShapeTest, BatchQueriesMatchSingleQueriesAxisAligned)
+    {
+        AZ::Entity entity;
+        CreateBox(
+            AZ::Transform::CreateTranslation(AZ::Vector3(10.0f, 37.0f, 32.0f)) *
+            AZ::Transform::CreateUniformScale(2.0f),
+            AZ::Vector3(6.0f, 1.0f, 5.0f), entity);
+
+        ExpectBatchQueriesMatchSingleQueries(entity.GetId());
+    }
+
+    TEST_F(BoxShapeTest, BatchQueriesMatchSingleQueriesRotatedNonUniformScale)
+    {
+        AZ::Entity entity;
+        const AZ::Transform transform = AZ::Transform::CreateFromQuaternionAndTranslation(
+            AZ::Quaternion(0.26f, 0.74f, 0.22f, 0.58f), AZ::Vector3(12.0f, -16.0f, 3.0f));
+        CreateBoxWithNonUniformScale(transform, AZ::Vector3(0.5f, 2.0f, 3.0f), AZ::Vector3(4.0f, 3.0f, 7.0f), entity);
+
+        ExpectBatchQueriesMatchSingleQueries(entity.GetId());
+    }
 }
@@ -13,6 +13,7 @@
 #include <AzFramework/Components/TransformComponent.h>
 #include <Shape/CapsuleShapeComponent.h>
 #include <AzCore/UnitTest/TestTypes.h>
+#include <Tests/ShapeBatchTestUtils.h>
 
 namespace UnitTest
 {
@@ -349,4 +350,26 @@ namespace UnitTest
 
         EXPECT_NEAR(distance, 2.0f, 1e-2f);
     }
+
+    TEST_F(CapsuleShapeTest, BatchQueriesMatchSingleQueries)
+    {
+        AZ::Entity entity;
+        CreateCapsule(
+            AZ::Transform::CreateTranslation(AZ::Vector3(-4.0f, -12.0f, -3.0f)) *
+            AZ::Transform::CreateRotationX(AZ::Constants::QuarterPi) *
+            AZ::Transform::CreateRotationY(AZ::Constants::QuarterPi) *
+            AZ::Transform::CreateUniformScale(1.5f),
+            1.5f, 6.0f, entity);
+
+        ExpectBatchQueriesMatchSingleQueries(entity.GetId());
+    }
+
+    TEST_F(CapsuleShapeTest, BatchQueriesMatchSingleQueriesSphere)
+    {
+        // the height is less than twice the radius, so the capsule is a sphere
+        AZ::Entity entity;
+        CreateCapsule(AZ::Transform::CreateTranslation(AZ::Vector3(3.0f, 2.0f, 1.0f)), 2.0f, 3.0f, entity);
+
+        ExpectBatchQueriesMatchSingleQueries(entity.GetId());
+    }
 }
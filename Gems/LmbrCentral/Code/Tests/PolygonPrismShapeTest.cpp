@@ -16,6 +16,7 @@
 #include <Shape/PolygonPrismShapeComponent.h>
 #include <AzCore/UnitTest/TestTypes.h>
 #include <AZTestShared/Math/MathTestHelpers.h>
+#include <Tests/ShapeBatchTestUtils.h>
 
 namespace UnitTest
 {
@@ -506,6 +507,47 @@ namespace UnitTest
     }
 
     // ccw
+    TEST_F(PolygonPrismShapeTest, PolygonShapeComponent_BatchQueriesMatchSingleQueries)
+    {
+        AZ::Entity entity;
+        AZ::Transform transform = AZ::Transform::CreateFromQuaternionAndTranslation(
+            AZ::Quaternion::CreateRotationY(AZ::DegToRad(45.0f)), AZ::Vector3(3.0f, 4.0f, 5.0f));
+        transform.MultiplyByUniformScale(1.5f);
+
+        // concave polygon with many vertices, so the edges are spread over several bands
+        AZStd::vector<AZ::Vector2> vertices;
+        const int pointCount = 24;
+        for (int i = 0; i < pointCount; ++i)
+        {
+            const float angle = AZ::Constants::TwoPi * static_cast<float>(i) / static_cast<float>(pointCount);
+            const float radius = (i % 2 == 0) ? 4.0f : 2.0f;
+            vertices.push_back(AZ::Vector2(radius * cosf(angle), radius * sinf(angle)));
+        }
+
+        const AZ::Vector3 nonUniformScale(2.0f, 1.2f, 0.5f);
+        CreatePolygonPrismWithNonUniformScale(transform, 2.0f, vertices, nonUniformScale, entity);
+
+        ExpectBatchQueriesMatchSingleQueries(entity.GetId());
+
+        // the shape only tests the edges close to each point, which should match testing all the edges
+        AZ::PolygonPrismPtr polygonPrism;
+        LmbrCentral::PolygonPrismShapeComponentRequestBus::EventResult(
+            polygonPrism, entity.GetId(), &LmbrCentral::PolygonPrismShapeComponentRequests::GetPolygonPrism);
+        ASSERT_TRUE(polygonPrism);
+        for (float y = -5.0f; y < 5.0f; y += 0.37f)
+        {
+            for (float x = -5.0f; x < 5.0f; x += 0.37f)
+            {
+                const AZ::Vector3 point = transform.TransformPoint(nonUniformScale * AZ::Vector3(x, y, 1.0f));
+
+                bool inside = false;
+                LmbrCentral::ShapeComponentRequestsBus::EventResult(
+                    inside, entity.GetId(), &LmbrCentral::ShapeComponentRequests::IsPointInside, point);
+                EXPECT_EQ(inside, LmbrCentral::PolygonPrismUtil::IsPointInside(*polygonPrism, point, transform));
+            }
+        }
+    }
+
     TEST_F(PolygonPrismShapeTest, GetRayIntersectPolygonPrismSuccess1)
     {
         AZ::Entity entity;
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzTest/AzTest.h>
+
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/std/containers/vector.h>
+#include <LmbrCentral/Shape/ShapeComponentBus.h>
+
+namespace UnitTest
+{
+    /// Checks that the batched queries of a shape give the same results as the single point queries,
+    /// for a grid of points covering the encompassing aabb of the shape and some space around it.
+    /// The grid size isn't a multiple of the batch size, so the points left after the last full batch are tested too.
+    inline void ExpectBatchQueriesMatchSingleQueries(AZ::EntityId entityId)
+    {
+        AZ::Aabb aabb = AZ::Aabb::CreateNull();
+        LmbrCentral::ShapeComponentRequestsBus::EventResult(
+            aabb, entityId, &LmbrCentral::ShapeComponentRequests::GetEncompassingAabb);
+        ASSERT_TRUE(aabb.IsValid());
+        aabb.Expand(AZ::Vector3(1.0f));
+
+        // offset the grid so points don't land exactly on the surface of the shapes being tested
+        constexpr int gridSize = 11;
+        const AZ::Vector3 step = aabb.GetExtents() / static_cast<float>(gridSize);
+        const AZ::Vector3 start = aabb.GetMin() + step * 0.37f;
+
+        AZStd::vector<AZ::Vector3> points;
+        for (int z = 0; z < gridSize; ++z)
+        {
+            for (int y = 0; y < gridSize; ++y)
+            {
+                for (int x = 0; x < gridSize; ++x)
+                {
+                    points.push_back(start + step * AZ::Vector3(static_cast<float>(x), static_cast<float>(y), static_cast<float>(z)));
+                }
+            }
+        }
+
+        AZStd::vector<bool> batchInside(points.size(), false);
+        AZStd::vector<float> batchDistancesSquared(points.size(), 0.0f);
+        LmbrCentral::ShapeComponentRequestsBus::Event(
+            entityId, &LmbrCentral::ShapeComponentRequests::ArePointsInside, points, batchInside);
+        LmbrCentral::ShapeComponentRequestsBus::Event(
+            entityId, &LmbrCentral::ShapeComponentRequests::DistanceSquaredFromPoints, points, batchDistancesSquared);
+
+        for (size_t index = 0; index < points.size(); ++index)
+        {
+            bool inside = false;
+            LmbrCentral::ShapeComponentRequestsBus::EventResult(
+                inside, entityId, &LmbrCentral::ShapeComponentRequests::IsPointInside, points[index]);
+            EXPECT_EQ(batchInside[index], inside);
+
+            float distanceSquared = 0.0f;
+            LmbrCentral::ShapeComponentRequestsBus::EventResult(
+                distanceSquared, entityId, &LmbrCentral::ShapeComponentRequests::DistanceSquaredFromPoint, points[index]);
+            EXPECT_NEAR(batchDistancesSquared[index], distanceSquared, 1e-3f * AZ::GetMax(1.0f, distanceSquared));
+        }
+    }
+}
@@ -11,6 +11,7 @@
 #include <AzCore/Math/Color.h>
 #include <AzCore/Math/Transform.h>
 #include <AzCore/Component/ComponentBus.h>
+#include <AzCore/std/containers/span.h>
 
 #include <AzFramework/Viewport/ViewportColors.h>
 
@@ -143,6 +144,35 @@ namespace LmbrCentral
         /// @return float indicating square distance point is from shape
         virtual float DistanceSquaredFromPoint(const AZ::Vector3& point) = 0;
 
+        /// @brief Checks for each of the given points if it is inside the shape or outside it.
+        /// The default implementation calls IsPointInside for every point, shapes that can do better
+        /// (e.g. by updating their intersection data once per list and testing several points at a time) should override it.
+        /// @param points The points to be tested
+        /// @param outInside Set to whether each point is inside, must be the same size as points
+        virtual void ArePointsInside(AZStd::span<const AZ::Vector3> points, AZStd::span<bool> outInside)
+        {
+            AZ_Assert(points.size() == outInside.size(), "ArePointsInside: the points and the output values have different sizes");
+
+            for (size_t index = 0; index < points.size(); ++index)
+            {
+                outInside[index] = IsPointInside(points[index]);
+            }
+        }
+
+        /// @brief Returns the min squared distance each of the given points is from the shape.
+        /// The default implementation calls DistanceSquaredFromPoint for every point, see ArePointsInside.
+        /// @param points The points to calculate the square distance from
+        /// @param outDistancesSquared Set to the square distance of each point from the shape, must be the same size as points
+        virtual void DistanceSquaredFromPoints(AZStd::span<const AZ::Vector3> points, AZStd::span<float> outDistancesSquared)
+        {
+            AZ_Assert(points.size() == outDistancesSquared.size(), "DistanceSquaredFromPoints: the points and the output values have different sizes");
+
+            for (size_t index = 0; index < points.size(); ++index)
+            {
+                outDistancesSquared[index] = DistanceSquaredFromPoint(points[index]);
+            }
+        }
+
         /// @brief Returns a random position inside the volume.
         /// @param randomDistribution An enum representing the different random distributions to use.
         virtual AZ::Vector3 GenerateRandomPointInside(AZ::RandomDistributionType /*randomDistribution*/)
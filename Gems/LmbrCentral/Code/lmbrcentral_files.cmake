@@ -140,6 +140,7 @@ set(FILES
     Source/Shape/ShapeComponentConverters.h
     Source/Shape/ShapeComponentConverters.cpp
     Source/Shape/ShapeComponentConverters.inl
+    Source/Shape/ShapeBatchUtil.h
     Source/Shape/ShapeGeometryUtil.h
     Source/Shape/ShapeGeometryUtil.cpp
     Source/Unhandled/Material/MaterialAssetTypeInfo.cpp
@@ -18,6 +18,7 @@ set(FILES
     Tests/LmbrCentralReflectionTest.h
     Tests/LmbrCentralReflectionTest.cpp
     Tests/LmbrCentralTest.cpp
+    Tests/ShapeBatchTestUtils.h
     Tests/ShapeGeometryUtilTest.cpp
     Tests/SpawnerComponentTest.cpp
     Tests/SplineComponentTests.cpp
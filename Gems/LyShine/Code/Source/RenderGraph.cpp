@@ -124,63 +124,9 @@ namespace LyShine
             renderer->SetSrgbWrite(true);
         }
 #endif
-        if (!uiRenderer->IsReady())
-        {
-            return;
-        }
-
-        AZ::RHI::Ptr<AZ::RPI::DynamicDrawContext> dynamicDraw = uiRenderer->GetDynamicDrawContext();
-        const UiRenderer::UiShaderData& uiShaderData = uiRenderer->GetUiShaderData();
-
-        // Set render state
-        dynamicDraw->SetStencilState(uiRenderer->GetBaseState().m_stencilState);
-        dynamicDraw->SetTarget0BlendState(uiRenderer->GetBaseState().m_blendState);
-
-        dynamicDraw->SetShaderVariant(uiRenderer->GetCurrentShaderVariant());
-
-        // Set up per draw SRG
-        AZ::Data::Instance<AZ::RPI::ShaderResourceGroup> drawSrg = dynamicDraw->NewDrawSrg();
-
-        // Set textures
-        uint32_t isClampTextureMode = 0;
-        for (int i = 0; i < m_numTextures; ++i)
-        {
-            const AZ::RHI::ImageView* imageView = m_textures[i].m_texture ? m_textures[i].m_texture->GetImageView() : nullptr;
-
-            if (!imageView)
-            {
-                // Default to white texture
-                auto image = AZ::RPI::ImageSystemInterface::Get()->GetSystemImage(AZ::RPI::SystemImage::White);
-                imageView = image->GetImageView();
-            }
-
-            if (imageView)
-            {
-                drawSrg->SetImageView(uiShaderData.m_imageInputIndex, imageView, i);
-                if (m_textures[i].m_isClampTextureMode)
-                {
-                    isClampTextureMode |= (1 << i);
-                }
-            }
-        }
-
-        // Set sampler state per texture
-        drawSrg->SetConstant(uiShaderData.m_isClampInputIndex, isClampTextureMode);
-
-        // Set projection matrix
-        drawSrg->SetConstant(uiShaderData.m_viewProjInputIndex, uiRenderer->GetModelViewProjectionMatrix());
-
-        drawSrg->Compile();
-
-        // Add the indexed primitives to the dynamic draw context for drawing
-        //
-        // [LYSHINE_ATOM_TODO][ATOM-15073] - need to combine into a single DrawIndexed call to take advantage of the draw call
-        // optimization done by this RenderGraph. This option will be added to DynamicDrawContext. For
-        // now we could combine the vertices ourselves
-        for (const IRenderer::DynUiPrimitive& primitive : m_primitives)
-        {
-            dynamicDraw->DrawIndexed(primitive.m_vertices, primitive.m_numVertices, primitive.m_indices, primitive.m_numIndices, AZ::RHI::IndexFormat::Uint16, drawSrg);
-        }
+        // The primitives are merged with the ones of the neighbouring render nodes that use the same state, and drawn when the
+        // state changes or at the end of the frame
+        uiRenderer->AddToBatch(m_primitives, m_totalNumVertices, m_totalNumIndices, m_textures, m_numTextures);
     }
 
     ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -519,6 +465,9 @@ namespace LyShine
             TransformationMatrices backupMatrices;
             gEnv->pRenderer->Set2DModeNonZeroTopLeft(m_viewportX, m_viewportY, m_viewportWidth, m_viewportHeight, backupMatrices);
  
+            // the queued primitives belong to the previous render target
+            uiRenderer->FlushBatch();
+
             // this will change the viewport
             gEnv->pRenderer->SetRenderTarget(m_renderTargetHandle, m_renderTargetDepthSurface);
 
@@ -538,6 +487,8 @@ namespace LyShine
                 renderNode->Render(uiRenderer);
             }
 
+            uiRenderer->FlushBatch();
+
             gEnv->pRenderer->SetRenderTarget(0); // restore render target
 
             gEnv->pRenderer->Unset2DMode(backupMatrices);
@@ -622,6 +573,9 @@ namespace LyShine
         m_isDirty = true;
         m_renderToRenderTargetCount = 0;
 
+        m_recordingStack.clear();
+        m_replayNestLevel = 0;
+
 #ifndef _RELEASE  
         m_wasBuiltThisFrame = true;
         m_timeGraphLastBuiltMs = AZStd::GetTimeUTCMilliSecond();
@@ -631,6 +585,14 @@ namespace LyShine
     ////////////////////////////////////////////////////////////////////////////////////////////////////
     void RenderGraph::BeginMask(bool isMaskingEnabled, bool useAlphaTest, bool drawBehind, bool drawInFront)
     {
+        if (RenderGraphRecording::Command* command = RecordCommand(RenderGraphRecording::CommandType::BeginMask))
+        {
+            command->m_isMaskingEnabled = isMaskingEnabled;
+            command->m_useAlphaTest = useAlphaTest;
+            command->m_drawBehind = drawBehind;
+            command->m_drawInFront = drawInFront;
+        }
+
         // this uses pool allocator
         MaskRenderNode* maskRenderNode = new MaskRenderNode(m_currentMask, isMaskingEnabled, useAlphaTest, drawBehind, drawInFront);
 
@@ -641,6 +603,8 @@ namespace LyShine
     ////////////////////////////////////////////////////////////////////////////////////////////////////
     void RenderGraph::StartChildrenForMask()
     {
+        RecordCommand(RenderGraphRecording::CommandType::StartChildrenForMask);
+
         AZ_Assert(m_currentMask, "Calling StartChildrenForMask while not defining a mask");
         m_renderNodeListStack.pop();
         m_renderNodeListStack.push(&m_currentMask->GetContentRenderNodeList());
@@ -649,6 +613,8 @@ namespace LyShine
     ////////////////////////////////////////////////////////////////////////////////////////////////////
     void RenderGraph::EndMask()
     {
+        RecordCommand(RenderGraphRecording::CommandType::EndMask);
+
         AZ_Assert(m_currentMask, "Calling EndMask while not defining a mask");
         if (m_currentMask)
         {
@@ -675,6 +641,15 @@ namespace LyShine
     void RenderGraph::BeginRenderToTexture(int renderTargetHandle, SDepthTexture* renderTargetDepthSurface,
         const AZ::Vector2& viewportTopLeft, const AZ::Vector2& viewportSize, const AZ::Color& clearColor)
     {
+        if (RenderGraphRecording::Command* command = RecordCommand(RenderGraphRecording::CommandType::BeginRenderToTexture))
+        {
+            command->m_renderTargetHandle = renderTargetHandle;
+            command->m_renderTargetDepthSurface = renderTargetDepthSurface;
+            command->m_viewportTopLeft = viewportTopLeft;
+            command->m_viewportSize = viewportSize;
+            command->m_clearColor = clearColor;
+        }
+
 #ifdef LYSHINE_ATOM_TODO // keeping this code for future phase (masks and render targets)
         // this uses pool allocator
         RenderTargetRenderNode* renderTargetRenderNode = new RenderTargetRenderNode(
@@ -696,6 +671,8 @@ namespace LyShine
     ////////////////////////////////////////////////////////////////////////////////////////////////////
     void RenderGraph::EndRenderToTexture()
     {
+        RecordCommand(RenderGraphRecording::CommandType::EndRenderToTexture);
+
 #ifdef LYSHINE_ATOM_TODO // keeping this code for future phase (masks and render targets)
         AZ_Assert(m_currentRenderTarget, "Calling EndRenderToTexture while not defining a render target node");
         if (m_currentRenderTarget)
@@ -734,6 +711,16 @@ namespace LyShine
     void RenderGraph::AddPrimitiveAtom(IRenderer::DynUiPrimitive* primitive, const AZ::Data::Instance<AZ::RPI::Image>& texture,
         bool isClampTextureMode, bool isTextureSRGB, bool isTexturePremultipliedAlpha, BlendMode blendMode)
     {
+        if (RenderGraphRecording::Command* command = RecordCommand(RenderGraphRecording::CommandType::AddPrimitive))
+        {
+            command->m_primitive = primitive;
+            command->m_texture = texture;
+            command->m_isClampTextureMode = isClampTextureMode;
+            command->m_isTextureSRGB = isTextureSRGB;
+            command->m_isTexturePremultipliedAlpha = isTexturePremultipliedAlpha;
+            command->m_blendMode = blendMode;
+        }
+
         AZStd::vector<RenderNode*>* renderNodeList = m_renderNodeListStack.top();
 
         int texUnit = -1;
@@ -808,6 +795,17 @@ namespace LyShine
             ITexture* texture, ITexture* maskTexture,
             bool isClampTextureMode, bool isTextureSRGB, bool isTexturePremultipliedAlpha, BlendMode blendMode)
     {
+        if (RenderGraphRecording::Command* command = RecordCommand(RenderGraphRecording::CommandType::AddAlphaMaskPrimitive))
+        {
+            command->m_primitive = primitive;
+            command->m_legacyTexture = texture;
+            command->m_legacyMaskTexture = maskTexture;
+            command->m_isClampTextureMode = isClampTextureMode;
+            command->m_isTextureSRGB = isTextureSRGB;
+            command->m_isTexturePremultipliedAlpha = isTexturePremultipliedAlpha;
+            command->m_blendMode = blendMode;
+        }
+
 #ifdef LYSHINE_ATOM_TODO // keeping this code for future phase (masks and render targets)
         AZStd::vector<RenderNode*>* renderNodeList = m_renderNodeListStack.top();
 
@@ -923,6 +921,12 @@ namespace LyShine
 
         m_dynamicQuads.push_back(quad);
 
+        // the quad is deleted when the graph is reset, so anything recorded while it was added can't be replayed
+        for (RenderGraphRecording* recording : m_recordingStack)
+        {
+            recording->m_hasDynamicPrimitives = true;
+        }
+
         return &quad->m_primitive;
     }
 
@@ -1073,6 +1077,95 @@ namespace LyShine
         return m_renderNodes.empty();
     }
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    void RenderGraph::BeginRecording(RenderGraphRecording* recording)
+    {
+        // the outer recording replays this one rather than holding a copy of its commands
+        if (RenderGraphRecording::Command* command = RecordCommand(RenderGraphRecording::CommandType::Replay))
+        {
+            command->m_recording = recording;
+        }
+
+        recording->m_commands.clear();
+        recording->m_isValid = false;
+        recording->m_hasDynamicPrimitives = false;
+        m_recordingStack.push_back(recording);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    void RenderGraph::EndRecording()
+    {
+        AZ_Assert(!m_recordingStack.empty(), "Calling EndRecording while not recording");
+        if (!m_recordingStack.empty())
+        {
+            RenderGraphRecording* recording = m_recordingStack.back();
+            m_recordingStack.pop_back();
+
+            recording->m_isValid = !recording->m_hasDynamicPrimitives;
+            recording->m_generation = m_recordingGeneration;
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    bool RenderGraph::CanReplay(const RenderGraphRecording* recording) const
+    {
+        return recording && recording->m_isValid && recording->m_generation == m_recordingGeneration;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    void RenderGraph::Replay(const RenderGraphRecording* recording)
+    {
+        if (RenderGraphRecording::Command* command = RecordCommand(RenderGraphRecording::CommandType::Replay))
+        {
+            command->m_recording = recording;
+        }
+
+        // the calls made while replaying are already part of the recordings
+        m_replayNestLevel++;
+
+        for (const RenderGraphRecording::Command& command : recording->m_commands)
+        {
+            switch (command.m_type)
+            {
+            case RenderGraphRecording::CommandType::BeginMask:
+                BeginMask(command.m_isMaskingEnabled, command.m_useAlphaTest, command.m_drawBehind, command.m_drawInFront);
+                break;
+            case RenderGraphRecording::CommandType::StartChildrenForMask:
+                StartChildrenForMask();
+                break;
+            case RenderGraphRecording::CommandType::EndMask:
+                EndMask();
+                break;
+            case RenderGraphRecording::CommandType::BeginRenderToTexture:
+                BeginRenderToTexture(command.m_renderTargetHandle, command.m_renderTargetDepthSurface,
+                    command.m_viewportTopLeft, command.m_viewportSize, command.m_clearColor);
+                break;
+            case RenderGraphRecording::CommandType::EndRenderToTexture:
+                EndRenderToTexture();
+                break;
+            case RenderGraphRecording::CommandType::AddPrimitive:
+                AddPrimitiveAtom(command.m_primitive, command.m_texture, command.m_isClampTextureMode,
+                    command.m_isTextureSRGB, command.m_isTexturePremultipliedAlpha, command.m_blendMode);
+                break;
+            case RenderGraphRecording::CommandType::AddAlphaMaskPrimitive:
+                AddAlphaMaskPrimitive(command.m_primitive, command.m_legacyTexture, command.m_legacyMaskTexture,
+                    command.m_isClampTextureMode, command.m_isTextureSRGB, command.m_isTexturePremultipliedAlpha, command.m_blendMode);
+                break;
+            case RenderGraphRecording::CommandType::Replay:
+                Replay(command.m_recording);
+                break;
+            }
+        }
+
+        m_replayNestLevel--;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    void RenderGraph::InvalidateRecordings()
+    {
+        m_recordingGeneration++;
+    }
+
 #ifndef _RELEASE
     ////////////////////////////////////////////////////////////////////////////////////////////////////
     void RenderGraph::ValidateGraph()
@@ -1541,4 +1634,17 @@ namespace LyShine
         return flags;
     }
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    RenderGraphRecording::Command* RenderGraph::RecordCommand(RenderGraphRecording::CommandType type)
+    {
+        if (m_recordingStack.empty() || m_replayNestLevel > 0)
+        {
+            return nullptr;
+        }
+
+        AZStd::vector<RenderGraphRecording::Command>& commands = m_recordingStack.back()->m_commands;
+        commands.emplace_back();
+        commands.back().m_type = type;
+        return &commands.back();
+    }
 }
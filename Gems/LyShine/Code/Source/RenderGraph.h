@@ -13,6 +13,8 @@
 #include <AzCore/std/containers/stack.h>
 #include <AzCore/std/containers/set.h>
 #include <AzCore/Math/Color.h>
+#include <AzCore/Math/Vector2.h>
+#include <AzCore/Memory/SystemAllocator.h>
 
 #include <Atom/RPI.Reflect/Image/Image.h>
 #include <AtomCore/Instance/Instance.h>
@@ -95,14 +97,10 @@ namespace LyShine
 #endif
 
     public: // data
-        static const int MaxTextures = 16;
+        static const int MaxTextures = UiRenderer::MaxBatchTextures;
 
     private: // types
-        struct TextureUsage
-        {
-            AZ::Data::Instance<AZ::RPI::Image>  m_texture;
-            bool                                m_isClampTextureMode;
-        };
+        using TextureUsage = UiRenderer::BatchTexture;
 
     private: // data
         TextureUsage    m_textures[MaxTextures];
@@ -223,6 +221,71 @@ namespace LyShine
         int         m_nestLevel = 0;
     };
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    // The calls made to the render graph while rendering an element and its children. When the element
+    // is next rendered into a rebuilt graph, and nothing changed in the element or its children since, the
+    // recording is replayed instead of rendering the element again.
+    class RenderGraphRecording
+    {
+    public: // functions
+        AZ_CLASS_ALLOCATOR(RenderGraphRecording, AZ::SystemAllocator, 0);
+
+        //! Stop the recording from being replayed, the element gets rendered again when the graph is next built
+        void Invalidate() { m_isValid = false; }
+
+    private: // types
+        friend class RenderGraph;
+
+        enum class CommandType
+        {
+            BeginMask,
+            StartChildrenForMask,
+            EndMask,
+            BeginRenderToTexture,
+            EndRenderToTexture,
+            AddPrimitive,
+            AddAlphaMaskPrimitive,
+            Replay
+        };
+
+        struct Command
+        {
+            CommandType                         m_type = CommandType::AddPrimitive;
+
+            // primitives
+            IRenderer::DynUiPrimitive*          m_primitive = nullptr;
+            AZ::Data::Instance<AZ::RPI::Image>  m_texture;
+            ITexture*                           m_legacyTexture = nullptr;
+            ITexture*                           m_legacyMaskTexture = nullptr;
+            BlendMode                           m_blendMode = BlendMode::Normal;
+            bool                                m_isClampTextureMode = false;
+            bool                                m_isTextureSRGB = false;
+            bool                                m_isTexturePremultipliedAlpha = false;
+
+            // masks
+            bool                                m_isMaskingEnabled = false;
+            bool                                m_useAlphaTest = false;
+            bool                                m_drawBehind = false;
+            bool                                m_drawInFront = false;
+
+            // render targets
+            int                                 m_renderTargetHandle = -1;
+            SDepthTexture*                      m_renderTargetDepthSurface = nullptr;
+            AZ::Vector2                         m_viewportTopLeft = AZ::Vector2::CreateZero();
+            AZ::Vector2                         m_viewportSize = AZ::Vector2::CreateZero();
+            AZ::Color                           m_clearColor = AZ::Color::CreateZero();
+
+            // the recording of a child element
+            const RenderGraphRecording*         m_recording = nullptr;
+        };
+
+    private: // data
+        AZStd::vector<Command>  m_commands;
+        AZ::u32                 m_generation = 0;
+        bool                    m_isValid = false;
+        bool                    m_hasDynamicPrimitives = false;  //!< primitives owned by the graph don't outlive it, so can't be replayed
+    };
+
     ////////////////////////////////////////////////////////////////////////////////////////////////////
     // The RenderGraph is owned by the canvas component
     class RenderGraph : public IRenderGraph
@@ -282,6 +345,20 @@ namespace LyShine
         //! Test whether the render graph contains any render nodes
         bool IsEmpty();
 
+        //! Record the calls made to the graph until the matching EndRecording. A recording started while recording another
+        //! one is replayed as part of the outer one.
+        void BeginRecording(RenderGraphRecording* recording);
+        void EndRecording();
+
+        //! Test whether a recording is still valid, and can be replayed instead of rendering its element again
+        bool CanReplay(const RenderGraphRecording* recording) const;
+
+        //! Make the calls held by a valid recording again
+        void Replay(const RenderGraphRecording* recording);
+
+        //! Invalidate all the recordings made so far, for changes that can't be attributed to an element
+        void InvalidateRecordings();
+
 #ifndef _RELEASE
         // A debug-only function useful for debugging, not called but calls can be added during debugging
         void ValidateGraph();
@@ -310,6 +387,9 @@ namespace LyShine
         //! Given a blend mode and whether the shader will be outputing premultiplied alpha, return state flags
         int GetBlendModeState(LyShine::BlendMode blendMode, bool isShaderOutputPremultAlpha) const;
 
+        //! Add a command to the recording in progress, returns null when not recording
+        RenderGraphRecording::Command* RecordCommand(RenderGraphRecording::CommandType type);
+
     protected:  // data
 
         AZStd::vector<RenderNode*>  m_renderNodes;
@@ -329,6 +409,10 @@ namespace LyShine
         AZStd::vector<RenderTargetRenderNode*>  m_renderTargetRenderNodes;
         int                         m_renderTargetNestLevel = 0;
 
+        AZStd::vector<RenderGraphRecording*>    m_recordingStack;
+        int                         m_replayNestLevel = 0;
+        AZ::u32                     m_recordingGeneration = 0;
+
 #ifndef _RELEASE
         // A debug-only variable used to track whether the rendergraph was rebuilt this frame
         mutable bool                m_wasBuiltThisFrame = false;
@@ -1825,10 +1825,33 @@ void UiCanvasComponent::MarkRenderGraphDirty()
     // the render graph will be cleared.
     if (!m_isRendering)
     {
+        m_renderGraph.InvalidateRecordings();
         m_renderGraph.SetDirtyFlag(true);
     }
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UiCanvasComponent::MarkRenderGraphDirtyForElement(AZ::EntityId elementId)
+{
+    // As in MarkRenderGraphDirty, never invalidate the render graph while rendering
+    if (!m_isRendering)
+    {
+        AZ::Entity* element = nullptr;
+        EBUS_EVENT_RESULT(element, AZ::ComponentApplicationBus, FindEntity, elementId);
+        UiElementComponent* elementComponent = element ? element->FindComponent<UiElementComponent>() : nullptr;
+        if (elementComponent)
+        {
+            // only this element, its children and its parents have to be rendered again
+            elementComponent->InvalidateRenderGraphRecording();
+            m_renderGraph.SetDirtyFlag(true);
+        }
+        else
+        {
+            MarkRenderGraphDirty();
+        }
+    }
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void UiCanvasComponent::UpdateCanvas(float deltaTime, bool isInGame)
 {
@@ -1967,6 +1990,11 @@ void UiCanvasComponent::GetDebugInfoInteractables(AZ::EntityId& activeInteractab
     hoverInteractable = m_hoverInteractable;
 }
 
+void UiCanvasComponent::GetDebugInfoLayouts(UiLayoutManager::DebugInfoLayouts& info) const
+{
+    info = m_layoutManager->GetDebugInfoLayouts();
+}
+
 void UiCanvasComponent::GetDebugInfoNumElements(DebugInfoNumElements& info) const
 {
     info.m_numElements = 0;
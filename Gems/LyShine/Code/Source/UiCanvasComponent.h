@@ -229,6 +229,7 @@ public: // member functions
 
     // UiCanvasComponentImplementationInterface
     void MarkRenderGraphDirty() override;
+    void MarkRenderGraphDirtyForElement(AZ::EntityId elementId) override;
     // ~UiCanvasComponentImplementationInterface
 
     void UpdateCanvas(float deltaTime, bool isInGame);
@@ -273,6 +274,7 @@ public: // member functions
 
     void GetDebugInfoInteractables(AZ::EntityId& activeInteractable,  AZ::EntityId& hoverInteractable) const;
     void GetDebugInfoNumElements(DebugInfoNumElements& info) const;
+    void GetDebugInfoLayouts(UiLayoutManager::DebugInfoLayouts& info) const;
     void GetDebugInfoRenderGraph(LyShineDebug::DebugInfoRenderGraph& info) const;
     void DebugInfoCountChildren(const AZ::EntityId entity, bool parentEnabled, DebugInfoNumElements& info) const;
 
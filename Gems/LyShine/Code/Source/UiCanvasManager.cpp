@@ -1036,14 +1036,15 @@ void UiCanvasManager::DebugDisplayCanvasData(int setting) const
         yOffset += lineSpacing;
     };
 
-    char buffer[200];
+    char buffer[256];
 
     sprintf_s(buffer, "There are %d loaded UI canvases", static_cast<int>(m_loadedCanvases.size()));
     WriteLine(buffer, white);
 
-    sprintf_s(buffer, "NN: %20s %2s %2s %2s %11s %5s %5s %5s %5s %5s %5s %5s %5s %5s %5s %20s %20s",
+    sprintf_s(buffer, "NN: %20s %2s %2s %2s %11s %5s %5s %5s %5s %5s %5s %5s %5s %5s %5s %5s %5s %7s %20s %20s",
         "Name", "En", "Po", "Na", "DrawOrder",
-        "nElem", "nEnab", "nRend", "nRCtl", "nImg", "nText", "nMask", "nFadr", "nIntr", "nUpdt", "ActiveInt", "HoverInt");
+        "nElem", "nEnab", "nRend", "nRCtl", "nImg", "nText", "nMask", "nFadr", "nIntr", "nUpdt",
+        "nLayt", "nSkip", "LaytUs", "ActiveInt", "HoverInt");
     WriteLine(buffer, white);
 
     int totalEnabled = 0;
@@ -1114,7 +1115,11 @@ void UiCanvasManager::DebugDisplayCanvasData(int setting) const
         UiCanvasComponent::DebugInfoNumElements info;
         canvas->GetDebugInfoNumElements(info);
 
-        sprintf_s(buffer, "%2d: %20s %2s %2s %2s %11d %5d %5d %5d %5d %5d %5d %5d %5d %5d %5d %20s %20s",
+        // Layouts applied and skipped by the last layout recompute and the time it took
+        UiLayoutManager::DebugInfoLayouts layoutInfo;
+        canvas->GetDebugInfoLayouts(layoutInfo);
+
+        sprintf_s(buffer, "%2d: %20s %2s %2s %2s %11d %5d %5d %5d %5d %5d %5d %5d %5d %5d %5d %5d %5d %7d %20s %20s",
             i, leafName.c_str(),
             enabledString, posEnabledString, navEnabledString,
             drawOrder,
@@ -1123,6 +1128,7 @@ void UiCanvasManager::DebugDisplayCanvasData(int setting) const
             info.m_numImageElements, info.m_numTextElements,
             info.m_numMaskElements, info.m_numFaderElements,
             info.m_numInteractableElements,info.m_numUpdateElements,
+            layoutInfo.m_numLayoutsApplied, layoutInfo.m_numLayoutsSkipped, layoutInfo.m_recomputeTimeMicroseconds,
             activeInteractableName.c_str(), hoverInteractableName.c_str());
 
         const AZ::Vector3& color = isCanvasEnabled ? white : grey;
@@ -60,6 +60,8 @@ UiElementComponent::~UiElementComponent()
         }
     }
 
+    delete m_renderGraphRecording;
+
     // In normal (correct) usage we have nothing to do here.
     // But if a user calls DeleteEntity or just deletes an entity pointer they can delete a UI element
     // and leave its parent with a dangling child pointer.
@@ -137,6 +139,28 @@ void UiElementComponent::RenderElement(LyShine::IRenderGraph* renderGraph, bool
         }
     }
 
+    // If nothing changed in this element or its children since the render graph was last built then
+    // make the same render graph calls again rather than rendering the element
+    LyShine::RenderGraph* recordingRenderGraph = nullptr;
+    if (isInGame)
+    {
+        recordingRenderGraph = dynamic_cast<LyShine::RenderGraph*>(renderGraph);
+        if (recordingRenderGraph)
+        {
+            if (recordingRenderGraph->CanReplay(m_renderGraphRecording))
+            {
+                recordingRenderGraph->Replay(m_renderGraphRecording);
+                return;
+            }
+
+            if (!m_renderGraphRecording)
+            {
+                m_renderGraphRecording = new LyShine::RenderGraphRecording;
+            }
+            recordingRenderGraph->BeginRecording(m_renderGraphRecording);
+        }
+    }
+
     // If a component is connected to the UiRenderControl bus then we give control of rendering this element
     // and its children to that component, otherwise follow the standard render path
     if (m_renderControlInterface)
@@ -159,6 +183,11 @@ void UiElementComponent::RenderElement(LyShine::IRenderGraph* renderGraph, bool
             GetChildElementComponent(i)->RenderElement(renderGraph, isInGame);
         }
     }
+
+    if (recordingRenderGraph)
+    {
+        recordingRenderGraph->EndRecording();
+    }
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -921,10 +950,10 @@ void UiElementComponent::SetIsEnabled(bool isEnabled)
             DoRecursiveEnabledNotification(m_isEnabled);
         }
 
-        // tell the canvas to invalidate the render graph
+        // tell the canvas to invalidate the render graph, the other elements can still reuse their render graph calls
         if (m_canvas)
         {
-            m_canvas->MarkRenderGraphDirty();
+            m_canvas->MarkRenderGraphDirtyForElement(GetEntityId());
         }
     }
 }
@@ -1312,6 +1341,22 @@ AZStd::vector<AZ::EntityId> UiElementComponent::GetSliceEntityChildren()
     return GetChildEntityIds();
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UiElementComponent::InvalidateRenderGraphRecording()
+{
+    // The recordings of the parents replay the recording of this element, so they have to be rendered again too
+    for (UiElementComponent* parent = m_parentElementComponent; parent; parent = parent->m_parentElementComponent)
+    {
+        if (parent->m_renderGraphRecording)
+        {
+            parent->m_renderGraphRecording->Invalidate();
+        }
+    }
+
+    // Changes to this element can affect how its children render (fading or masking for example)
+    InvalidateRenderGraphRecordingRecursive();
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 // PUBLIC STATIC MEMBER FUNCTIONS
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1577,6 +1622,20 @@ void UiElementComponent::SetParentReferences(AZ::Entity* parent, UiElementCompon
     m_parentElementComponent = parentElementComponent;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UiElementComponent::InvalidateRenderGraphRecordingRecursive()
+{
+    if (m_renderGraphRecording)
+    {
+        m_renderGraphRecording->Invalidate();
+    }
+
+    for (UiElementComponent* child : m_childElementComponents)
+    {
+        child->InvalidateRenderGraphRecordingRecursive();
+    }
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void UiElementComponent::OnPatchEnd(const AZ::DataPatchNodeInfo& patchInfo)
 {
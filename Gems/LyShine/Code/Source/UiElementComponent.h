@@ -24,6 +24,11 @@ class UiTransform2dComponent;
 class UiRenderInterface;
 class UiRenderControlInterface;
 
+namespace LyShine
+{
+    class RenderGraphRecording;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 class UiElementComponent
     : public AZ::Component
@@ -148,6 +153,10 @@ public: // member functions
     // Used to check that FixupPostLoad has been called
     bool IsFullyInitialized() const;
 
+    //! Render this element, its children and its parents again the next time the render graph is built,
+    //! rather than replaying the render graph calls recorded the last time they were rendered
+    void InvalidateRenderGraphRecording();
+
     // Used to check that cached child pointers are setup
     bool AreChildPointersValid() const;
 
@@ -255,6 +264,9 @@ private: // member functions
     // helper function for setting the multiple parent reference that we store
     void SetParentReferences(AZ::Entity* parent, UiElementComponent* parentElementComponent);
 
+    // helper function for invalidating the render graph recordings of this element and its descendants
+    void InvalidateRenderGraphRecordingRecursive();
+
     //! Ensures m_childEntityIdOrder is updated for any data patches to the old m_children
     void OnPatchEnd(const AZ::DataPatchNodeInfo& patchInfo);
 
@@ -289,6 +301,9 @@ private: // data
     UiRenderInterface* m_renderInterface = nullptr;
     UiRenderControlInterface* m_renderControlInterface = nullptr;
 
+    //! The render graph calls made when this element and its children were last rendered in game, created on first render
+    LyShine::RenderGraphRecording* m_renderGraphRecording = nullptr;
+
     bool m_isEnabled = true;
     bool m_isRenderEnabled = true;
 
@@ -433,7 +433,7 @@ void UiFaderComponent::MarkRenderGraphDirty()
     // tell the canvas to invalidate the render graph
     AZ::EntityId canvasEntityId;
     EBUS_EVENT_ID_RESULT(canvasEntityId, GetEntityId(), UiElementBus, GetCanvasEntityId);
-    EBUS_EVENT_ID(canvasEntityId, UiCanvasComponentImplementationBus, MarkRenderGraphDirty);
+    EBUS_EVENT_ID(canvasEntityId, UiCanvasComponentImplementationBus, MarkRenderGraphDirtyForElement, GetEntityId());
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
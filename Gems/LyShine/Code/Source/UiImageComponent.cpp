@@ -2348,7 +2348,7 @@ void UiImageComponent::MarkRenderGraphDirty()
     // tell the canvas to invalidate the render graph (never want to do this while rendering)
     AZ::EntityId canvasEntityId;
     EBUS_EVENT_ID_RESULT(canvasEntityId, GetEntityId(), UiElementBus, GetCanvasEntityId);
-    EBUS_EVENT_ID(canvasEntityId, UiCanvasComponentImplementationBus, MarkRenderGraphDirty);
+    EBUS_EVENT_ID(canvasEntityId, UiCanvasComponentImplementationBus, MarkRenderGraphDirtyForElement, GetEntityId());
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -10,6 +10,9 @@
 #include <LyShine/Bus/UiLayoutBus.h>
 #include <LyShine/Bus/UiElementBus.h>
 #include <LyShine/Bus/UiLayoutControllerBus.h>
+#include <LyShine/Bus/UiTransformBus.h>
+
+#include <AzCore/std/time.h>
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 // PUBLIC MEMBER FUNCTIONS
@@ -32,6 +35,7 @@ void UiLayoutManager::MarkToRecomputeLayout(AZ::EntityId entityId)
 {
     if (UiLayoutControllerBus::FindFirstHandler(entityId))
     {
+        m_markedLayouts.insert(entityId);
         AddToRecomputeLayoutList(entityId);
     }
 }
@@ -55,6 +59,9 @@ void UiLayoutManager::MarkToRecomputeLayoutsAffectedByLayoutCellChange(AZ::Entit
 
         if (usesLayoutCells)
         {
+            // The parents below the top one may not change size, they still have to apply their layout
+            m_markedLayouts.insert(parent);
+
             topParent = parent;
             parent.SetInvalid();
             EBUS_EVENT_ID_RESULT(parent, topParent, UiElementBus, GetParentEntityId);
@@ -75,17 +82,28 @@ void UiLayoutManager::MarkToRecomputeLayoutsAffectedByLayoutCellChange(AZ::Entit
 void UiLayoutManager::UnmarkAllLayouts()
 {
     m_elementsToRecomputeLayout.clear();
+    m_markedLayouts.clear();
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void UiLayoutManager::RecomputeMarkedLayouts()
 {
+#ifndef _RELEASE
+    AZStd::sys_time_t startTime = AZStd::GetTimeNowMicroSecond();
+    m_debugInfoLayouts.m_numLayoutsApplied = 0;
+    m_debugInfoLayouts.m_numLayoutsSkipped = 0;
+#endif
+
     for (auto element : m_elementsToRecomputeLayout)
     {
-        ComputeLayoutForElementAndDescendants(element);
+        ComputeLayoutForElementAndInvalidDescendants(element);
     }
 
     UnmarkAllLayouts();
+
+#ifndef _RELEASE
+    m_debugInfoLayouts.m_recomputeTimeMicroseconds = static_cast<int>(AZStd::GetTimeNowMicroSecond() - startTime);
+#endif
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -134,23 +152,12 @@ void UiLayoutManager::AddToRecomputeLayoutList(AZ::EntityId entityId)
             }
         }
 
-        // Remove element's children from the list
-        LyShine::EntityArray descendants;
-        EBUS_EVENT_ID(entityId, UiElementBus, FindDescendantElements,
-            []([[maybe_unused]] const AZ::Entity* entity) { return true; },
-            descendants);
-
+        // Remove element's children from the list. Walking up from the elements in the list is cheaper than
+        // collecting all the descendants of the element, which can be a large subtree
         m_elementsToRecomputeLayout.remove_if(
-            [descendants](const AZ::EntityId& e)
+            [this, entityId](const AZ::EntityId& e)
             {
-                for (auto descendant : descendants)
-                {
-                    if (descendant->GetId() == e)
-                    {
-                        return true;
-                    }
-                }
-                return false;
+                return IsParentOfElement(entityId, e);
             }
             );
 
@@ -159,6 +166,68 @@ void UiLayoutManager::AddToRecomputeLayoutList(AZ::EntityId entityId)
     }
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UiLayoutManager::ComputeLayoutForElementAndInvalidDescendants(AZ::EntityId entityId)
+{
+    // Get a list of layout children
+    auto FindLayoutChildren = [](const AZ::Entity* entity)
+        {
+            return (UiLayoutControllerBus::FindFirstHandler(entity->GetId())) ? true : false;
+        };
+
+    LyShine::EntityArray layoutChildren;
+    EBUS_EVENT_ID(entityId, UiElementBus, FindDescendantElements, FindLayoutChildren, layoutChildren);
+
+    // Descendants are ordered parents first, so by the time a descendant is checked its parents have applied their
+    // layouts and its new size is known. Only descendants that were marked or changed size need their layout applied.
+    AZStd::vector<bool> appliedLayoutWidths(layoutChildren.size(), false);
+
+    EBUS_EVENT_ID(entityId, UiLayoutControllerBus, ApplyLayoutWidth);
+    for (size_t i = 0; i < layoutChildren.size(); ++i)
+    {
+        AZ::EntityId layoutChildId = layoutChildren[i]->GetId();
+        if (IsLayoutInvalid(layoutChildId))
+        {
+            EBUS_EVENT_ID(layoutChildId, UiLayoutControllerBus, ApplyLayoutWidth);
+            appliedLayoutWidths[i] = true;
+        }
+    }
+
+    // The cell heights can depend on the widths (wrapped text for example) so a layout that applied its width
+    // always applies its height
+    int numLayoutsApplied = 1;
+    EBUS_EVENT_ID(entityId, UiLayoutControllerBus, ApplyLayoutHeight);
+    for (size_t i = 0; i < layoutChildren.size(); ++i)
+    {
+        AZ::EntityId layoutChildId = layoutChildren[i]->GetId();
+        if (appliedLayoutWidths[i] || IsLayoutInvalid(layoutChildId))
+        {
+            EBUS_EVENT_ID(layoutChildId, UiLayoutControllerBus, ApplyLayoutHeight);
+            numLayoutsApplied++;
+        }
+    }
+
+#ifndef _RELEASE
+    m_debugInfoLayouts.m_numLayoutsApplied += numLayoutsApplied;
+    m_debugInfoLayouts.m_numLayoutsSkipped += static_cast<int>(layoutChildren.size()) + 1 - numLayoutsApplied;
+#else
+    AZ_UNUSED(numLayoutsApplied);
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool UiLayoutManager::IsLayoutInvalid(AZ::EntityId entityId) const
+{
+    if (m_markedLayouts.find(entityId) != m_markedLayouts.end())
+    {
+        return true;
+    }
+
+    bool hasSizeChanged = true;
+    EBUS_EVENT_ID_RESULT(hasSizeChanged, entityId, UiTransformBus, HasCanvasSpaceSizeChanged);
+    return hasSizeChanged;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 bool UiLayoutManager::IsParentOfElement(AZ::EntityId checkParentEntity, AZ::EntityId checkChildEntity)
 {
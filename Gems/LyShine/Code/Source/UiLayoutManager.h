@@ -7,11 +7,23 @@
 #pragma once
 
 #include <LyShine/Bus/UiLayoutManagerBus.h>
+#include <AzCore/std/containers/unordered_set.h>
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 class UiLayoutManager
     : public UiLayoutManagerBus::Handler
 {
+public: // types
+
+#ifndef _RELEASE
+    struct DebugInfoLayouts
+    {
+        int m_numLayoutsApplied = 0;            //!< layouts applied by the last recompute of the marked layouts
+        int m_numLayoutsSkipped = 0;            //!< descendant layouts the last recompute left alone because they were unchanged
+        int m_recomputeTimeMicroseconds = 0;    //!< time taken by the last recompute of the marked layouts
+    };
+#endif
+
 public: // member functions
 
     UiLayoutManager(AZ::EntityId canvasEntityId);
@@ -27,6 +39,10 @@ public: // member functions
 
     bool HasMarkedLayouts() const { return !m_elementsToRecomputeLayout.empty(); }
 
+#ifndef _RELEASE
+    const DebugInfoLayouts& GetDebugInfoLayouts() const { return m_debugInfoLayouts; }
+#endif
+
 private: // member functions
 
     AZ_DISABLE_COPY_MOVE(UiLayoutManager);
@@ -34,8 +50,21 @@ private: // member functions
     void AddToRecomputeLayoutList(AZ::EntityId entityId);
     bool IsParentOfElement(AZ::EntityId checkParentEntity, AZ::EntityId checkChildEntity);
 
+    //! Like ComputeLayoutForElementAndDescendants, but only applies the layouts of descendants that were marked
+    //! or whose size has changed since the rect change notifications were last sent
+    void ComputeLayoutForElementAndInvalidDescendants(AZ::EntityId entityId);
+    bool IsLayoutInvalid(AZ::EntityId entityId) const;
+
 private: // data
 
     //! Elements that need to recompute their layouts. Parents should be ahead of their children
     AZStd::list<AZ::EntityId> m_elementsToRecomputeLayout;
+
+    //! All the elements that were marked, including the ones left out of m_elementsToRecomputeLayout because
+    //! a parent is in the list. Layouts of descendants outside of this set only get applied when their size changed.
+    AZStd::unordered_set<AZ::EntityId> m_markedLayouts;
+
+#ifndef _RELEASE
+    DebugInfoLayouts m_debugInfoLayouts;
+#endif
 };
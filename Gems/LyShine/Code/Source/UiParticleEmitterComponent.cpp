@@ -2103,5 +2103,5 @@ void UiParticleEmitterComponent::MarkRenderGraphDirty()
     // tell the canvas to invalidate the render graph
     AZ::EntityId canvasEntityId;
     EBUS_EVENT_ID_RESULT(canvasEntityId, GetEntityId(), UiElementBus, GetCanvasEntityId);
-    EBUS_EVENT_ID(canvasEntityId, UiCanvasComponentImplementationBus, MarkRenderGraphDirty);
+    EBUS_EVENT_ID(canvasEntityId, UiCanvasComponentImplementationBus, MarkRenderGraphDirtyForElement, GetEntityId());
 }
@@ -189,6 +189,8 @@ void UiRenderer::BeginUiFrameRender()
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void UiRenderer::EndUiFrameRender()
 {
+    FlushBatch();
+
     // We never want to leave a texture bound that could get unloaded before the next render
     // So bind the global white texture for all the texture units we use.
     BindNullTexture();
@@ -303,6 +305,115 @@ void UiRenderer::DecrementStencilRef()
     --m_stencilRef;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UiRenderer::AddToBatch(const IRenderer::DynUiPrimitiveList& primitives, int numVertices, int numIndices,
+    const BatchTexture* textures, int numTextures)
+{
+    if (!IsReady() || numIndices == 0)
+    {
+        return;
+    }
+
+    const AZ::Matrix4x4 modelViewProjMat = GetModelViewProjectionMatrix();
+
+    uint8 textureRemap[MaxBatchTextures];
+    if (!IsBatchCompatible(modelViewProjMat, numVertices) || !MapBatchTextures(textures, numTextures, textureRemap))
+    {
+        FlushBatch();
+
+        // all the textures fit in an empty batch
+        MapBatchTextures(textures, numTextures, textureRemap);
+    }
+
+    if (m_batch.m_indices.empty())
+    {
+        m_batch.m_baseState = m_baseState;
+        m_batch.m_stencilRef = m_stencilRef;
+        m_batch.m_modelViewProjMat = modelViewProjMat;
+    }
+
+    m_batch.m_vertices.reserve(m_batch.m_vertices.size() + numVertices);
+    m_batch.m_indices.reserve(m_batch.m_indices.size() + numIndices);
+
+    for (const IRenderer::DynUiPrimitive& primitive : primitives)
+    {
+        // the indices of each primitive start at zero, offset them past the vertices already in the batch
+        const uint16 firstVertex = static_cast<uint16>(m_batch.m_vertices.size());
+        for (int i = 0; i < primitive.m_numIndices; ++i)
+        {
+            m_batch.m_indices.push_back(firstVertex + primitive.m_indices[i]);
+        }
+
+        for (int i = 0; i < primitive.m_numVertices; ++i)
+        {
+            SVF_P2F_C4B_T2F_F4B& vertex = m_batch.m_vertices.emplace_back(primitive.m_vertices[i]);
+            vertex.texIndex = textureRemap[vertex.texIndex];
+            vertex.texIndex2 = textureRemap[vertex.texIndex2];
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UiRenderer::FlushBatch()
+{
+    if (m_batch.m_indices.empty())
+    {
+        return;
+    }
+
+    // Set render state
+    m_dynamicDraw->SetStencilState(m_batch.m_baseState.m_stencilState);
+    m_dynamicDraw->SetTarget0BlendState(m_batch.m_baseState.m_blendState);
+    m_dynamicDraw->SetStencilReference(static_cast<uint8_t>(m_batch.m_stencilRef));
+    m_dynamicDraw->SetShaderVariant(m_batch.m_baseState.m_useAlphaTest ? m_uiShaderData.m_shaderVariantAlphaTest : m_uiShaderData.m_shaderVariantDefault);
+
+    // Set up per draw SRG
+    AZ::Data::Instance<AZ::RPI::ShaderResourceGroup> drawSrg = m_dynamicDraw->NewDrawSrg();
+
+    // Set textures
+    uint32_t isClampTextureMode = 0;
+    for (int i = 0; i < m_batch.m_numTextures; ++i)
+    {
+        const AZ::RHI::ImageView* imageView = m_batch.m_textures[i].m_texture ? m_batch.m_textures[i].m_texture->GetImageView() : nullptr;
+
+        if (!imageView)
+        {
+            // Default to white texture
+            auto image = AZ::RPI::ImageSystemInterface::Get()->GetSystemImage(AZ::RPI::SystemImage::White);
+            imageView = image->GetImageView();
+        }
+
+        if (imageView)
+        {
+            drawSrg->SetImageView(m_uiShaderData.m_imageInputIndex, imageView, i);
+            if (m_batch.m_textures[i].m_isClampTextureMode)
+            {
+                isClampTextureMode |= (1 << i);
+            }
+        }
+    }
+
+    // Set sampler state per texture
+    drawSrg->SetConstant(m_uiShaderData.m_isClampInputIndex, isClampTextureMode);
+
+    // Set projection matrix
+    drawSrg->SetConstant(m_uiShaderData.m_viewProjInputIndex, m_batch.m_modelViewProjMat);
+
+    drawSrg->Compile();
+
+    m_dynamicDraw->DrawIndexed(m_batch.m_vertices.data(), static_cast<uint32_t>(m_batch.m_vertices.size()),
+        m_batch.m_indices.data(), static_cast<uint32_t>(m_batch.m_indices.size()), AZ::RHI::IndexFormat::Uint16, drawSrg);
+
+    // Keep the buffers for the next batch
+    m_batch.m_vertices.clear();
+    m_batch.m_indices.clear();
+    for (int i = 0; i < m_batch.m_numTextures; ++i)
+    {
+        m_batch.m_textures[i].m_texture = nullptr;
+    }
+    m_batch.m_numTextures = 0;
+}
+
 #ifdef LYSHINE_ATOM_TODO
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void UiRenderer::SetTexture(ITexture* texture, int texUnit, bool clamp)
@@ -328,6 +439,69 @@ void UiRenderer::SetTexture(ITexture* texture, int texUnit, bool clamp)
 #endif
 
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool UiRenderer::IsBatchCompatible(const AZ::Matrix4x4& modelViewProjMat, int numVertices) const
+{
+    if (m_batch.m_indices.empty())
+    {
+        return true;
+    }
+
+    return m_batch.m_baseState.m_blendState == m_baseState.m_blendState &&
+        m_batch.m_baseState.m_stencilState == m_baseState.m_stencilState &&
+        m_batch.m_baseState.m_useAlphaTest == m_baseState.m_useAlphaTest &&
+        m_batch.m_stencilRef == m_stencilRef &&
+        m_batch.m_modelViewProjMat == modelViewProjMat &&
+        m_batch.m_vertices.size() + numVertices < static_cast<size_t>(std::numeric_limits<uint16>::max());
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool UiRenderer::MapBatchTextures(const BatchTexture* textures, int numTextures, uint8 (&textureRemap)[MaxBatchTextures])
+{
+    // First find the textures already in the batch so the batch stays untouched when the rest doesn't fit
+    int numNewTextures = 0;
+    for (int i = 0; i < numTextures; ++i)
+    {
+        textureRemap[i] = MaxBatchTextures;
+        for (int batchIndex = 0; batchIndex < m_batch.m_numTextures; ++batchIndex)
+        {
+            if (m_batch.m_textures[batchIndex].m_texture == textures[i].m_texture &&
+                m_batch.m_textures[batchIndex].m_isClampTextureMode == textures[i].m_isClampTextureMode)
+            {
+                textureRemap[i] = static_cast<uint8>(batchIndex);
+                break;
+            }
+        }
+
+        if (textureRemap[i] == MaxBatchTextures)
+        {
+            ++numNewTextures;
+        }
+    }
+
+    if (m_batch.m_numTextures + numNewTextures > MaxBatchTextures)
+    {
+        return false;
+    }
+
+    for (int i = 0; i < numTextures; ++i)
+    {
+        if (textureRemap[i] == MaxBatchTextures)
+        {
+            textureRemap[i] = static_cast<uint8>(m_batch.m_numTextures);
+            m_batch.m_textures[m_batch.m_numTextures++] = textures[i];
+        }
+    }
+
+    // Vertices only reference the textures of their primitive list, map the unused units to the first texture
+    for (int i = numTextures; i < MaxBatchTextures; ++i)
+    {
+        textureRemap[i] = numTextures > 0 ? textureRemap[0] : 0;
+    }
+
+    return true;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void UiRenderer::BindNullTexture()
 {
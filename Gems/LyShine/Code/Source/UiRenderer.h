@@ -11,6 +11,11 @@
 #include <Atom/RPI.Public/ViewportContext.h>
 #include <Atom/RHI.Reflect/RenderStates.h>
 #include <Atom/Bootstrap/BootstrapNotificationBus.h>
+#include <Atom/RPI.Reflect/Image/Image.h>
+#include <AtomCore/Instance/Instance.h>
+#include <AzCore/Math/Matrix4x4.h>
+#include <AzCore/std/containers/vector.h>
+#include <IRenderer.h>
 
 #ifndef _RELEASE
 #include <AzCore/std/containers/unordered_set.h>
@@ -66,6 +71,16 @@ public: // types
         bool m_useAlphaTest = false;
     };
 
+    // A texture used by a batch of primitives, the primitive vertices reference it by its index in the batch
+    struct BatchTexture
+    {
+        AZ::Data::Instance<AZ::RPI::Image>  m_texture;
+        bool                                m_isClampTextureMode = false;
+    };
+
+    //! The number of texture units of the UI shader
+    static constexpr int MaxBatchTextures = 16;
+
 public: // member functions
 
     //! Constructor, constructed by the LyShine class
@@ -120,6 +135,16 @@ public: // member functions
     //! Decrement the current stencil reference value
     void DecrementStencilRef();
 
+    //! Queue primitives for drawing using the current state. Consecutive primitive lists are merged into a single draw call
+    //! while their state matches and all their textures fit in the texture units, this includes primitive lists of different
+    //! canvases. The primitive data is copied, so it only has to stay valid during the call.
+    //! \param textures The textures referenced by the texIndex and texIndex2 of the primitive vertices
+    void AddToBatch(const IRenderer::DynUiPrimitiveList& primitives, int numVertices, int numIndices,
+        const BatchTexture* textures, int numTextures);
+
+    //! Draw the queued primitives. This happens automatically at the end of the frame and when the state changes.
+    void FlushBatch();
+
 #ifndef _RELEASE
     //! Setup to record debug texture data before rendering
     void DebugSetRecordingOptionForTextureData(int recordingOption);
@@ -151,6 +176,12 @@ private: // member functions
     //! Store shader data for later use
     void CacheShaderData(const AZ::RHI::Ptr<AZ::RPI::DynamicDrawContext>& dynamicDraw);
 
+    //! Return whether primitives drawn with the current state can be added to the queued batch
+    bool IsBatchCompatible(const AZ::Matrix4x4& modelViewProjMat, int numVertices) const;
+
+    //! Find or add the given textures to the batch, returns false without changing the batch if they don't fit
+    bool MapBatchTextures(const BatchTexture* textures, int numTextures, uint8 (&textureRemap)[MaxBatchTextures]);
+
 protected: // attributes
 
     static constexpr char LogName[] = "UiRenderer";
@@ -165,6 +196,19 @@ protected: // attributes
     // Set by user when viewport context is not the main/default viewport
     AZStd::shared_ptr<AZ::RPI::ViewportContext> m_viewportContext;
 
+    // The primitives queued for the next draw call, and the state they are drawn with
+    struct Batch
+    {
+        BaseState m_baseState;
+        uint32 m_stencilRef = 0;
+        AZ::Matrix4x4 m_modelViewProjMat = AZ::Matrix4x4::CreateIdentity();
+        BatchTexture m_textures[MaxBatchTextures];
+        int m_numTextures = 0;
+        AZStd::vector<SVF_P2F_C4B_T2F_F4B> m_vertices;
+        AZStd::vector<uint16> m_indices;
+    };
+    Batch m_batch;
+
 #ifndef _RELEASE
     int m_debugTextureDataRecordLevel = 0;
     AZStd::unordered_set<ITexture*> m_texturesUsedInFrame; // LYSHINE_ATOM_TODO - convert to RPI::Image
@@ -784,14 +784,90 @@ void CAnimComponentNode::InitializeTrackDefaultValue(IAnimTrack* pTrack, const C
     }
 }
 
+//////////////////////////////////////////////////////////////////////////
+void CAnimComponentNode::EvaluateTracks(const SAnimContext& ac)
+{
+    const int trackCount = NumTracks();
+    m_evaluatedTrackValues.clear();
+    m_evaluatedTrackValues.resize(trackCount);
+    m_tracksEvaluated = true;
+
+    if (m_skipComponentAnimationUpdates || ac.resetting)
+    {
+        return;
+    }
+
+    for (int paramIndex = 0; paramIndex < trackCount; paramIndex++)
+    {
+        IAnimTrack* pTrack = m_tracks[paramIndex].get();
+
+        if ((pTrack->HasKeys() == false) || (pTrack->GetFlags() & IAnimTrack::eAnimTrackFlags_Disabled) || pTrack->IsMasked(ac.trackMask))
+        {
+            continue;
+        }
+
+        // Character Animation and AssetBlend tracks are evaluated by Animate() as they drive other systems directly
+        if (m_paramTypeToBehaviorPropertyInfoMap.find(pTrack->GetParameterType()) == m_paramTypeToBehaviorPropertyInfoMap.end())
+        {
+            continue;
+        }
+
+        EvaluatedTrackValue& trackValue = m_evaluatedTrackValues[paramIndex];
+        switch (pTrack->GetValueType())
+        {
+            case AnimValueType::Float:
+            {
+                pTrack->GetValue(ac.time, trackValue.m_floatValue, /*applyMultiplier= */ true);
+                trackValue.m_evaluated = true;
+                break;
+            }
+            case AnimValueType::Vector:     // fall-through
+            case AnimValueType::RGB:
+            {
+                Vec3 vec3Value(.0f, .0f, .0f);
+                pTrack->GetValue(ac.time, vec3Value, /*applyMultiplier= */ true);
+                trackValue.m_vector3Value.Set(vec3Value.x, vec3Value.y, vec3Value.z);
+                for (int subTrackIndex = 0; subTrackIndex < 3; ++subTrackIndex)
+                {
+                    trackValue.m_subTracksHaveKeys[subTrackIndex] = pTrack->GetSubTrack(subTrackIndex)->HasKeys();
+                }
+                trackValue.m_evaluated = true;
+                break;
+            }
+            case AnimValueType::Quat:
+            {
+                pTrack->GetValue(ac.time, trackValue.m_quaternionValue);
+                trackValue.m_evaluated = true;
+                break;
+            }
+            case AnimValueType::Bool:
+            {
+                pTrack->GetValue(ac.time, trackValue.m_boolValue);
+                trackValue.m_evaluated = true;
+                break;
+            }
+            default:
+                break;
+        }
+    }
+}
+
 //////////////////////////////////////////////////////////////////////////
 void CAnimComponentNode::Animate(SAnimContext& ac)
 {
     if (m_skipComponentAnimationUpdates)
     {
+        m_tracksEvaluated = false;
         return;
     }
 
+    // use the values evaluated ahead by the sequence if there are some, otherwise evaluate them now
+    if (!m_tracksEvaluated || m_evaluatedTrackValues.size() != m_tracks.size())
+    {
+        EvaluateTracks(ac);
+    }
+    m_tracksEvaluated = false;
+
     // Evaluate all tracks
 
     // indices used for character animation (SimpleAnimationComponent)
@@ -847,15 +923,15 @@ void CAnimComponentNode::Animate(SAnimContext& ac)
                 {
                     BehaviorPropertyInfo& propertyInfo = findIter->second;
                     Maestro::SequenceComponentRequests::AnimatablePropertyAddress animatableAddress(m_componentId, propertyInfo.m_animNodeParamInfo.name);
+                    const EvaluatedTrackValue& trackValue = m_evaluatedTrackValues[paramIndex];
 
                     switch (pTrack->GetValueType())
                     {
                         case AnimValueType::Float:
                         {
-                            if (pTrack->HasKeys())
+                            if (trackValue.m_evaluated)
                             {
-                                float floatValue = .0f;
-                                pTrack->GetValue(ac.time, floatValue, /*applyMultiplier= */ true);
+                                const float floatValue = trackValue.m_floatValue;
                                 Maestro::SequenceComponentRequests::AnimatedFloatValue value(floatValue);
 
                                 Maestro::SequenceComponentRequests::AnimatedFloatValue prevValue(floatValue);
@@ -871,10 +947,14 @@ void CAnimComponentNode::Animate(SAnimContext& ac)
                         case AnimValueType::Vector:     // fall-through
                         case AnimValueType::RGB:
                         {
+                            if (!trackValue.m_evaluated)
+                            {
+                                break;
+                            }
+
                             float tolerance = AZ::Constants::FloatEpsilon;
-                            Vec3 vec3Value(.0f, .0f, .0f);
-                            pTrack->GetValue(ac.time, vec3Value, /*applyMultiplier= */ true);
-                            AZ::Vector3 vector3Value(vec3Value.x, vec3Value.y, vec3Value.z);
+                            AZ::Vector3 vector3Value(trackValue.m_vector3Value);
+                            Vec3 vec3Value(vector3Value.GetX(), vector3Value.GetY(), vector3Value.GetZ());
 
                             if (pTrack->GetValueType() == AnimValueType::RGB)
                             {
@@ -894,9 +974,9 @@ void CAnimComponentNode::Animate(SAnimContext& ac)
                             prevValue.GetValue(vector3PrevValue);
 
                             // Check sub-tracks for keys. If there are none, use the prevValue for that track (essentially making a non-keyed track a no-op)                    
-                            vector3Value.Set(pTrack->GetSubTrack(0)->HasKeys() ? vector3Value.GetX() : vector3PrevValue.GetX(),
-                                pTrack->GetSubTrack(1)->HasKeys() ? vector3Value.GetY() : vector3PrevValue.GetY(),
-                                pTrack->GetSubTrack(2)->HasKeys() ? vector3Value.GetZ() : vector3PrevValue.GetZ());
+                            vector3Value.Set(trackValue.m_subTracksHaveKeys[0] ? vector3Value.GetX() : vector3PrevValue.GetX(),
+                                trackValue.m_subTracksHaveKeys[1] ? vector3Value.GetY() : vector3PrevValue.GetY(),
+                                trackValue.m_subTracksHaveKeys[2] ? vector3Value.GetZ() : vector3PrevValue.GetZ());
                             value.SetValue(vector3Value);
 
                             if (!value.IsClose(prevValue, tolerance))
@@ -908,12 +988,11 @@ void CAnimComponentNode::Animate(SAnimContext& ac)
                         }
                         case AnimValueType::Quat:
                         {
-                            if (pTrack->HasKeys())
+                            if (trackValue.m_evaluated)
                             {
                                 float tolerance = AZ::Constants::FloatEpsilon;
 
-                                AZ::Quaternion quaternionValue(AZ::Quaternion::CreateIdentity());
-                                pTrack->GetValue(ac.time, quaternionValue);
+                                const AZ::Quaternion quaternionValue(trackValue.m_quaternionValue);
                                 Maestro::SequenceComponentRequests::AnimatedQuaternionValue value(quaternionValue);
                                 Maestro::SequenceComponentRequests::AnimatedQuaternionValue prevValue(quaternionValue);
                                 Maestro::SequenceComponentRequestBus::Event(m_pSequence->GetSequenceEntityId(), &Maestro::SequenceComponentRequestBus::Events::GetAnimatedPropertyValue, prevValue, GetParentAzEntityId(), animatableAddress);
@@ -930,10 +1009,9 @@ void CAnimComponentNode::Animate(SAnimContext& ac)
                         }
                         case AnimValueType::Bool:
                         {
-                            if (pTrack->HasKeys())
+                            if (trackValue.m_evaluated)
                             {
-                                bool boolValue = true;
-                                pTrack->GetValue(ac.time, boolValue);
+                                const bool boolValue = trackValue.m_boolValue;
                                 Maestro::SequenceComponentRequests::AnimatedBoolValue value(boolValue);
 
                                 Maestro::SequenceComponentRequests::AnimatedBoolValue prevValue(boolValue);
@@ -47,6 +47,14 @@ public:
     void OnResetHard() override;
     //////////////////////////////////////////////////////////////////////////
 
+    // Evaluates the component property tracks at the context time, for the next Animate() to apply.
+    // Only the tracks of this node are read (nothing is sent on the buses), so the nodes of a sequence
+    // can be evaluated in parallel before being animated.
+    void EvaluateTracks(const SAnimContext& ac);
+
+    // Drops the values of the last EvaluateTracks() if Animate() didn't apply them.
+    void DiscardEvaluatedTracks() { m_tracksEvaluated = false; }
+
     //////////////////////////////////////////////////////////////////////////
     // Overrides from IAnimNode
     // ComponentNodes use reflection for typing - return invalid for this pure virtual for the legacy system
@@ -168,6 +176,17 @@ private:
     
     void AddPropertyToParamInfoMap(const CAnimParamType& paramType);
 
+    // value of a component property track evaluated by EvaluateTracks()
+    struct EvaluatedTrackValue
+    {
+        bool m_evaluated = false;
+        float m_floatValue = .0f;
+        AZ::Vector3 m_vector3Value = AZ::Vector3::CreateZero();
+        AZ::Quaternion m_quaternionValue = AZ::Quaternion::CreateIdentity();
+        bool m_boolValue = true;
+        bool m_subTracksHaveKeys[3] = { false, false, false };
+    };
+
     int m_refCount;     // intrusive_ptr ref counter
 
     AZ::Uuid                                m_componentTypeId;
@@ -179,6 +198,10 @@ private:
     // helper class responsible for animating Character Tracks (aka 'Animation' tracks in the TrackView UI)
     CCharacterTrackAnimator*   m_characterTrackAnimator = nullptr;
 
+    // track values waiting to be applied by Animate(), indexed like m_tracks
+    AZStd::vector<EvaluatedTrackValue> m_evaluatedTrackValues;
+    bool m_tracksEvaluated = false;
+
     bool m_skipComponentAnimationUpdates;
 };
 #endif // CRYINCLUDE_CRYMOVIE_ANIMCOMPONENTNODE_H
@@ -11,6 +11,10 @@
 
 #include "Maestro_precompiled.h"
 
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/std/chrono/clocks.h>
 #include <Maestro/Bus/EditorSequenceComponentBus.h>
 
 #include "AnimSequence.h"
@@ -661,6 +665,9 @@ void CAnimSequence::Animate(const SAnimContext& ec)
         return;
     }
 
+    AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Movie);
+    const auto animateStart = AZStd::chrono::high_resolution_clock::now();
+
     SAnimContext animContext = ec;
     animContext.sequence = this;
     m_time = animContext.time;
@@ -672,25 +679,63 @@ void CAnimSequence::Animate(const SAnimContext& ec)
         m_activeDirector->Animate(animContext);
     }
 
-    for (AnimNodes::iterator it = m_nodes.begin(); it != m_nodes.end(); ++it)
+    const auto isNodeAnimated = [this](IAnimNode* animNode)
     {
-        // Make sure correct animation block is binded to node.
-        IAnimNode* animNode = it->get();
-
         // All other (inactive) director nodes are skipped.
         if (animNode->GetType() == AnimNodeType::Director)
         {
-            continue;
+            return false;
         }
 
         // If this is a descendant of a director node and that director is currently not active, skip this one.
         IAnimNode* parentDirector = animNode->HasDirectorAsParent();
         if (parentDirector && parentDirector != m_activeDirector)
         {
-            continue;
+            return false;
+        }
+
+        return !animNode->AreFlagsSetOnNodeOrAnyParent(eAnimNodeFlags_Disabled);
+    };
+
+    // Track values only depend on the keys of their own node, evaluate them in parallel so the serial pass
+    // below only has to push the changed values to the animated components.
+    AZStd::vector<CAnimComponentNode*> componentNodes;
+    if (CMovieSystem::m_mov_parallelTrackEvaluationMinNodes > 0 && AZ::JobContext::GetGlobalContext() != nullptr)
+    {
+        for (AnimNodes::iterator it = m_nodes.begin(); it != m_nodes.end(); ++it)
+        {
+            IAnimNode* animNode = it->get();
+            if (animNode->GetType() == AnimNodeType::Component && isNodeAnimated(animNode))
+            {
+                componentNodes.push_back(static_cast<CAnimComponentNode*>(animNode));
+            }
+        }
+    }
+
+    const bool evaluateInParallel =
+        componentNodes.size() >= static_cast<size_t>(AZStd::max(CMovieSystem::m_mov_parallelTrackEvaluationMinNodes, 1));
+    if (evaluateInParallel)
+    {
+        AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::Movie, "CAnimSequence::Animate - EvaluateTracks");
+
+        AZ::JobCompletion jobCompletion;
+        for (CAnimComponentNode* componentNode : componentNodes)
+        {
+            AZ::Job* job = AZ::CreateJobFunction([componentNode, &animContext]()
+                {
+                    componentNode->EvaluateTracks(animContext);
+                }, true);
+            job->SetDependent(&jobCompletion);
+            job->Start();
         }
+        jobCompletion.StartAndWaitForCompletion();
+    }
 
-        if (animNode->AreFlagsSetOnNodeOrAnyParent(eAnimNodeFlags_Disabled))
+    for (AnimNodes::iterator it = m_nodes.begin(); it != m_nodes.end(); ++it)
+    {
+        // Make sure correct animation block is binded to node.
+        IAnimNode* animNode = it->get();
+        if (!isNodeAnimated(animNode))
         {
             continue;
         }
@@ -698,6 +743,17 @@ void CAnimSequence::Animate(const SAnimContext& ec)
         // Animate node.
         animNode->Animate(animContext);
     }
+
+    if (evaluateInParallel)
+    {
+        // values of nodes an earlier node disabled while animating must not be applied later
+        for (CAnimComponentNode* componentNode : componentNodes)
+        {
+            componentNode->DiscardEvaluatedTracks();
+        }
+    }
+
+    m_lastAnimateTimeMs = AZStd::chrono::duration<float, AZStd::milli>(AZStd::chrono::high_resolution_clock::now() - animateStart).count();
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -104,6 +104,7 @@ public:
 
     void StillUpdate();
     void Animate(const SAnimContext& ec);
+    float GetLastAnimateTimeMs() const override { return m_lastAnimateTimeMs; }
     void Render();
 
     void InitPostLoad() override;
@@ -206,6 +207,7 @@ private:
     int m_activeDirectorNodeId;
 
     float m_time;
+    float m_lastAnimateTimeMs = 0.0f;
 
     SequenceType m_sequenceType;       // indicates if this sequence is connected to a legacy sequence entity or Sequence Component
 
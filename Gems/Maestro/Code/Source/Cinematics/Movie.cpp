@@ -40,6 +40,7 @@
 
 int CMovieSystem::m_mov_NoCutscenes = 0;
 float CMovieSystem::m_mov_cameraPrecacheTime = 1.f;
+int CMovieSystem::m_mov_parallelTrackEvaluationMinNodes = 16;
 #if !defined(_RELEASE)
 int CMovieSystem::m_mov_DebugEvents = 0;
 int CMovieSystem::m_mov_debugCamShake = 0;
@@ -227,6 +228,8 @@ CMovieSystem::CMovieSystem(ISystem* pSystem)
 
     REGISTER_CVAR2("mov_NoCutscenes", &m_mov_NoCutscenes, 0, 0, "Disable playing of Cut-Scenes");
     REGISTER_CVAR2("mov_cameraPrecacheTime", &m_mov_cameraPrecacheTime, 1.f, VF_NULL, "");
+    REGISTER_CVAR2("mov_parallelTrackEvaluationMinNodes", &m_mov_parallelTrackEvaluationMinNodes, 16, VF_NULL,
+        "Minimum number of animated component nodes in a sequence to evaluate their tracks in parallel jobs.\n0 evaluates them serially.");
     m_mov_overrideCam = REGISTER_STRING("mov_overrideCam", "", VF_NULL, "Set the camera used for the sequence which overrides the camera track info in the sequence.\nUse the Camera Name for Object Entity Cameras (Legacy) or the Entity ID for Component Entity Cameras.");
 
     DoNodeStaticInitialisation();
@@ -8,6 +8,7 @@
 #include "BaseHttpServer.h"
 #include "DataCache.h"
 
+#include <cstdlib>
 #include <sstream>
 
 using namespace Metastream;
@@ -60,6 +61,47 @@ Metastream::HttpResponse Metastream::BaseHttpServer::GetDataValues(const std::st
     return response;
 }
 
+HttpResponse BaseHttpServer::GetDataChanges(const std::string& tableName, AZ::u64 sinceRevision) const
+{
+    int code = 404;
+    std::string body(m_cache->GetTableChangesJSON(tableName, sinceRevision));
+
+    if (!body.empty())
+    {
+        code = 200;
+    }
+
+    HttpResponse response;
+    response.code = code;
+    response.body = body.c_str();
+    return response;
+}
+
+HttpResponse BaseHttpServer::HandleQuery(const std::map<std::string, std::string>& query) const
+{
+    auto table = query.find("table");
+    if (table == query.end())
+    {
+        return GetDataTables();
+    }
+
+    // Consumers polling for changes pass back the revision of their last reply, 0 to get every value
+    auto since = query.find("since");
+    if (since != query.end())
+    {
+        return GetDataChanges(table->second, strtoull(since->second.c_str(), nullptr, 10));
+    }
+
+    auto key = query.find("key");
+    if (key != query.end())
+    {
+        std::vector<std::string> keyList = SplitValueList(key->second, ',');
+        return GetDataValues(table->second, keyList);
+    }
+
+    return GetDataKeys(table->second);
+}
+
 std::map<std::string, std::string> BaseHttpServer::TokenizeQuery(const char* queryString)
 {
     std::map<std::string, std::string> queryMap;
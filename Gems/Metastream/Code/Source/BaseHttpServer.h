@@ -6,6 +6,8 @@
  */
 #pragma once
 
+#include <AzCore/base.h>
+
 #include <map>
 #include <string>
 #include <vector>
@@ -63,6 +65,12 @@ namespace Metastream
         // Return a JSON object containing a set of values.
         HttpResponse GetDataValues(const std::string& tableName, const std::vector<std::string>& keys) const;
 
+        // Return a JSON object containing the values of a table changed after a revision, and the table's current revision.
+        HttpResponse GetDataChanges(const std::string& tableName, AZ::u64 sinceRevision) const;
+
+        // Handle a query from the "/data" end point or the web socket, shared by all the servers.
+        HttpResponse HandleQuery(const std::map<std::string, std::string>& query) const;
+
         //---------------------------------------------------------------------
         // Helper functions
 
@@ -249,6 +249,21 @@ namespace Metastream
     }
 
 
+    std::string DataCache::GetTableChangesJSON(const std::string& tableName, AZ::u64 sinceRevision) const
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutexDatabase);
+        std::string json;
+
+        auto it = m_database.find(tableName);
+
+        if (it != m_database.end())
+        {
+            json = it->second->GetChangesJSON(sinceRevision);
+        }
+
+        return json;
+    }
+
     void DataCache::ClearCache()
     {
         AZStd::lock_guard<AZStd::mutex> lock(m_mutexDatabase);
@@ -351,6 +366,49 @@ namespace Metastream
         return std::string(buffer.GetString());
     }
 
+    std::string DataCache::Document::GetChangesJSON(AZ::u64 sinceRevision) const
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+
+        if (m_hasCachedChanges && m_cachedChangesSinceRevision == sinceRevision && m_cachedChangesRevision == m_revision)
+        {
+            return m_cachedChangesJSON;
+        }
+
+        rapidjson::Document jsonDoc;
+        jsonDoc.SetObject();
+        rapidjson::Value values(rapidjson::kObjectType);
+
+        for (rapidjson::Value::ConstMemberIterator itr = m_jsonDoc.MemberBegin(); itr != m_jsonDoc.MemberEnd(); ++itr)
+        {
+            auto revisionItr = m_keyRevisions.find(std::string(itr->name.GetString()));
+            if (revisionItr != m_keyRevisions.end() && revisionItr->second > sinceRevision)
+            {
+                rapidjson::Value v;
+                v.CopyFrom(itr->value, jsonDoc.GetAllocator());
+                values.AddMember(rapidjson::Value().SetString(itr->name.GetString(), jsonDoc.GetAllocator()), v, jsonDoc.GetAllocator());
+            }
+        }
+
+        uint64_t revisionValue = m_revision;
+        rapidjson::Value revision(revisionValue);
+        jsonDoc.AddMember("revision", revision, jsonDoc.GetAllocator());
+        jsonDoc.AddMember("values", values, jsonDoc.GetAllocator());
+
+        rapidjson::StringBuffer buffer;
+        buffer.Clear();
+
+        rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+        jsonDoc.Accept(writer);
+
+        m_cachedChangesJSON = buffer.GetString();
+        m_cachedChangesSinceRevision = sinceRevision;
+        m_cachedChangesRevision = m_revision;
+        m_hasCachedChanges = true;
+
+        return m_cachedChangesJSON;
+    }
+
     std::string DataCache::Document::GetJSON() const
     {
         AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
@@ -372,6 +430,8 @@ namespace Metastream
             m_jsonDoc.RemoveMember(ToJson(key));
 
         m_jsonDoc.AddMember(ToJson(key), value, m_allocator);
+
+        m_keyRevisions[key] = ++m_revision;
     }
 
     void DataCache::Document::AddToArray(const std::string& arrayName, rapidjson::Value& value)
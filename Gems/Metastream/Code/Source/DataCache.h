@@ -50,6 +50,11 @@ namespace Metastream
         std::string GetDatabasesJSON() const;
         std::string GetTableKeysJSON(const std::string& tableName) const;
         std::string GetTableKeyValuesJSON(const std::string& tableName, const std::vector<std::string>& keyList) const;
+
+        // Returns {"revision":N,"values":{...}} with the keys of a table changed after sinceRevision, where N is the
+        // current revision of the table to pass back as sinceRevision to only get the next changes.
+        // Consumers polling at the same revision share a single serialization of the changes.
+        std::string GetTableChangesJSON(const std::string& tableName, AZ::u64 sinceRevision) const;
         
         void ClearCache();
     
@@ -62,6 +67,7 @@ namespace Metastream
 
                 std::string GetKeysJSON() const;
                 std::string GetKeyValuesJSON(const std::vector<std::string>& keyList) const;
+                std::string GetChangesJSON(AZ::u64 sinceRevision) const;
                 std::string GetJSON() const;
                 
                 void Add(const std::string & key, rapidjson::Value & value);
@@ -84,6 +90,7 @@ namespace Metastream
             private:
                 typedef AZStd::shared_ptr<rapidjson::Value> rapidJsonValuePtr;
                 typedef AZStd::map<std::string, rapidJsonValuePtr> JsonValueMap;
+                typedef AZStd::map<std::string, AZ::u64> KeyRevisionMap;
                 enum class ValueType {Array, Object};
                 rapidJsonValuePtr FindValue(const std::string & name, ValueType type);
                 void RemoveValue(const std::string &objectName, ValueType type);
@@ -94,6 +101,16 @@ namespace Metastream
                 rapidjson::Document                     m_jsonDoc;
                 rapidjson::Document::AllocatorType &    m_allocator;
                 JsonValueMap                            m_jsonValues;
+
+                // Revision of the document, incremented each time a key is added, and the revision each key last changed at
+                AZ::u64                                 m_revision = 0;
+                KeyRevisionMap                          m_keyRevisions;
+
+                // Last serialized changes, reused while the revision and the requested revision are the same
+                mutable std::string                     m_cachedChangesJSON;
+                mutable AZ::u64                         m_cachedChangesSinceRevision = 0;
+                mutable AZ::u64                         m_cachedChangesRevision = 0;
+                mutable bool                            m_hasCachedChanges = false;
         };
 
         typedef AZStd::shared_ptr<Document> DocumentPtr;
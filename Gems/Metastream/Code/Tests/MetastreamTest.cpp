@@ -18,6 +18,7 @@
 
 #include <Metastream_Traits_Platform.h>
 #include "MetastreamGem.h"
+#include "DataCache.h"
 
 using ::testing::NiceMock;
 using ::testing::Return;
@@ -149,3 +150,21 @@ TEST_F(MetastreamTest, ServerStartupShutdownTest_FT)
     EXPECT_EQ(server.GetDatabasesJSON(), "{\"tables\":[]}");
     EXPECT_FALSE(server.IsServerEnabled());
 }
+
+TEST_F(MetastreamTest, DataCacheTableChanges_OnlyReturnsKeysChangedAfterRevision)
+{
+    Metastream::DataCache cache;
+
+    EXPECT_EQ(cache.GetTableChangesJSON("testtable", 0), "");
+
+    cache.AddToCache("testtable", "a", true);
+    cache.AddToCache("testtable", "b", AZ::s64(2));
+    EXPECT_EQ(cache.GetTableChangesJSON("testtable", 0), "{\"revision\":2,\"values\":{\"a\":true,\"b\":2}}");
+
+    cache.AddToCache("testtable", "a", false);
+    EXPECT_EQ(cache.GetTableChangesJSON("testtable", 2), "{\"revision\":3,\"values\":{\"a\":false}}");
+
+    // Asking again at the same revision returns the same changes
+    EXPECT_EQ(cache.GetTableChangesJSON("testtable", 2), "{\"revision\":3,\"values\":{\"a\":false}}");
+    EXPECT_EQ(cache.GetTableChangesJSON("testtable", 3), "{\"revision\":3,\"values\":{}}");
+}
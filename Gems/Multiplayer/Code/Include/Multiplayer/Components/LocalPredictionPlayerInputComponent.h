@@ -96,6 +96,8 @@ namespace Multiplayer
 
         AZ::TimeMs m_lastInputReceivedTimeMs = AZ::TimeMs{ 0 };
         AZ::TimeMs m_lastCorrectionSentTimeMs = AZ::TimeMs{ 0 };
+        AZ::TimeMs m_lastInputSentTimeMs = AZ::TimeMs{ 0 };
+        uint32_t m_unsentInputCount = 0; // Inputs processed locally but not yet sent, they ride along in the next input array
 
         ClientInputId m_clientInputId = ClientInputId{ 0 }; // Clients incrementing inputId
         ClientInputId m_lastClientInputId = ClientInputId{ 0 }; // Last inputId processed by the server
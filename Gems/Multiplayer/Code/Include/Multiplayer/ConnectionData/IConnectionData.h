@@ -39,9 +39,24 @@ namespace Multiplayer
         virtual EntityReplicationManager& GetReplicationManager() = 0;
 
         //! Creates and manages sending updates to the remote endpoint.
+        //! Equivalent to calling BeginUpdate, SerializeUpdates and EndUpdate in sequence.
         //! @param hostTimeMs current server game time in milliseconds
         virtual void Update(AZ::TimeMs hostTimeMs) = 0;
 
+        //! First phase of Update, activates pending entities and checks whether updates should be sent.
+        //! Must be called from the main thread.
+        //! @return true if SerializeUpdates and EndUpdate should be called this frame
+        virtual bool BeginUpdate() = 0;
+
+        //! Second phase of Update, gathers and serializes the entity updates for the remote endpoint.
+        //! Only touches state owned by this connection data, so different connections may be serialized concurrently.
+        virtual void SerializeUpdates() = 0;
+
+        //! Final phase of Update, sends the serialized entity updates and any pending rpcs.
+        //! Must be called from the main thread.
+        //! @param hostTimeMs current server game time in milliseconds
+        virtual void EndUpdate(AZ::TimeMs hostTimeMs) = 0;
+
         //! Returns whether update messages can be sent to the connection.
         //! @return true if update messages can be sent
         virtual bool CanSendUpdates() const = 0;
@@ -10,6 +10,7 @@
 #include <AzCore/Time/ITime.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/containers/array.h>
+#include <AzCore/std/parallel/mutex.h>
 #include <Multiplayer/MultiplayerTypes.h>
 
 namespace AzNetworking
@@ -48,6 +49,9 @@ namespace Multiplayer
         };
         AZStd::vector<ComponentStats> m_componentStats;
 
+        //! Guards the Record functions, property updates can be serialized for several connections concurrently
+        AZStd::mutex m_recordMutex;
+
         void ReserveComponentStats(NetComponentId netComponentId, uint16_t propertyCount, uint16_t rpcCount);
         void RecordPropertySent(NetComponentId netComponentId, PropertyIndex propertyId, uint32_t totalBytes);
         void RecordPropertyReceived(NetComponentId netComponentId, PropertyIndex propertyId, uint32_t totalBytes);
@@ -19,6 +19,7 @@
 namespace Multiplayer
 {
     //! The default number of rewindable samples for us to store.
+    //! History memory scales linearly with this, network properties can override it using the RewindHistorySize autocomponent attribute.
     static constexpr uint32_t RewindHistorySize = 128;
 
     AZ_TYPE_SAFE_INTEGRAL(HostId, uint32_t);
@@ -17,9 +17,9 @@ namespace Multiplayer
 {
     //! @class RewindableArray
     //! @brief Data structure that has a compile-time upper bound, provides array semantics and supports network serialization
-    template <typename TYPE, uint32_t SIZE>
+    template <typename TYPE, uint32_t SIZE, AZStd::size_t REWIND_SIZE = Multiplayer::RewindHistorySize>
     class RewindableArray
-        : public AZStd::array<RewindableObject<TYPE, Multiplayer::RewindHistorySize>, SIZE>
+        : public AZStd::array<RewindableObject<TYPE, REWIND_SIZE>, SIZE>
     {
     public:
         //! Serialization method for array contained rewindable objects
@@ -9,8 +9,8 @@
 
 namespace Multiplayer
 {
-    template <typename TYPE, uint32_t SIZE>
-    bool RewindableArray<TYPE, SIZE>::Serialize(AzNetworking::ISerializer& serializer)
+    template <typename TYPE, uint32_t SIZE, AZStd::size_t REWIND_SIZE>
+    bool RewindableArray<TYPE, SIZE, REWIND_SIZE>::Serialize(AzNetworking::ISerializer& serializer)
     {
         for (uint32_t i = 0; i < SIZE; ++i)
         {
@@ -23,8 +23,8 @@ namespace Multiplayer
         return serializer.IsValid();
     }
 
-    template <typename TYPE, uint32_t SIZE>
-    bool RewindableArray<TYPE, SIZE>::Serialize(AzNetworking::ISerializer& serializer, AzNetworking::IBitset& deltaRecord)
+    template <typename TYPE, uint32_t SIZE, AZStd::size_t REWIND_SIZE>
+    bool RewindableArray<TYPE, SIZE, REWIND_SIZE>::Serialize(AzNetworking::ISerializer& serializer, AzNetworking::IBitset& deltaRecord)
     {
         for (uint32_t i = 0; i < SIZE; ++i)
         {
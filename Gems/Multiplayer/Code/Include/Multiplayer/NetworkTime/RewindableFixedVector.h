@@ -17,7 +17,7 @@ namespace Multiplayer
 {
     //! @class RewindableFixedVector
     //! @brief Data structure that has a compile-time upper bound, provides vector semantics and supports network serialization
-    template <typename TYPE, uint32_t SIZE>
+    template <typename TYPE, uint32_t SIZE, AZStd::size_t REWIND_SIZE = Multiplayer::RewindHistorySize>
     class RewindableFixedVector
     {
     public:
@@ -51,17 +51,17 @@ namespace Multiplayer
 
         //! Copy buffer from the provided vector
         //! @param RHS instance to copy from
-        constexpr RewindableFixedVector<TYPE, SIZE>& operator=(const RewindableFixedVector<TYPE, SIZE>& rhs);
+        constexpr RewindableFixedVector<TYPE, SIZE, REWIND_SIZE>& operator=(const RewindableFixedVector<TYPE, SIZE, REWIND_SIZE>& rhs);
 
         //! Equality operator, returns true if the current instance is equal to RHS
         //! @param rhs the FixedSizeVector instance to test for equality against
         //! @return bool true if equal, false if not
-        constexpr bool operator ==(const RewindableFixedVector<TYPE, SIZE>& rhs) const;
+        constexpr bool operator ==(const RewindableFixedVector<TYPE, SIZE, REWIND_SIZE>& rhs) const;
 
         //! Inequality operator, returns true if the current instance is not equal to RHS
         //! @param rhs the FixedSizeVector instance to test for inequality against
         //! @return bool false if equal, true if not equal
-        constexpr bool operator !=(const RewindableFixedVector<TYPE, SIZE>& rhs) const;
+        constexpr bool operator !=(const RewindableFixedVector<TYPE, SIZE, REWIND_SIZE>& rhs) const;
 
         //! Resizes the vector to the requested number of elements, initializing new elements if necessary
         //! @param count the number of elements to size the vector to
@@ -105,17 +105,17 @@ namespace Multiplayer
         //! Gets the size of the vector
         constexpr uint32_t size() const;
 
-        typedef const RewindableObject<TYPE, Multiplayer::RewindHistorySize>* const_iterator;
+        typedef const RewindableObject<TYPE, REWIND_SIZE>* const_iterator;
         const_iterator begin() const { return m_container.cbegin(); }
         const_iterator end() const { return m_container.cbegin() + aznumeric_cast<size_t>(size()); }
-        typedef RewindableObject<TYPE, Multiplayer::RewindHistorySize>* iterator;
+        typedef RewindableObject<TYPE, REWIND_SIZE>* iterator;
         constexpr iterator begin() { return m_container.begin(); }
         constexpr iterator end() { return m_container.begin() + aznumeric_cast<size_t>(size()); }
 
     private:
-        AZStd::array<RewindableObject<TYPE, Multiplayer::RewindHistorySize>, SIZE> m_container;
+        AZStd::array<RewindableObject<TYPE, REWIND_SIZE>, SIZE> m_container;
         // Synchronized value for vector size, prefer using size() locally which checks m_container.size()
-        RewindableObject<uint32_t, Multiplayer::RewindHistorySize> m_rewindableSize;
+        RewindableObject<uint32_t, REWIND_SIZE> m_rewindableSize;
     };
 }
 
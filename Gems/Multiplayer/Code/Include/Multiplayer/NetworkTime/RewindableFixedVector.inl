@@ -9,21 +9,21 @@
 
 namespace Multiplayer
 {
-    template <typename TYPE, uint32_t SIZE>
-    constexpr RewindableFixedVector<TYPE, SIZE>::RewindableFixedVector(const TYPE& initialValue, uint32_t count)
+    template <typename TYPE, uint32_t SIZE, AZStd::size_t REWIND_SIZE>
+    constexpr RewindableFixedVector<TYPE, SIZE, REWIND_SIZE>::RewindableFixedVector(const TYPE& initialValue, uint32_t count)
     {
         m_container.fill(initialValue);
         m_rewindableSize = count;
     }
 
-    template <typename TYPE, uint32_t SIZE>
-    RewindableFixedVector<TYPE, SIZE>::~RewindableFixedVector()
+    template <typename TYPE, uint32_t SIZE, AZStd::size_t REWIND_SIZE>
+    RewindableFixedVector<TYPE, SIZE, REWIND_SIZE>::~RewindableFixedVector()
     {
         ;
     }
 
-    template <typename TYPE, uint32_t SIZE>
-    bool RewindableFixedVector<TYPE, SIZE>::Serialize(AzNetworking::ISerializer& serializer)
+    template <typename TYPE, uint32_t SIZE, AZStd::size_t REWIND_SIZE>
+    bool RewindableFixedVector<TYPE, SIZE, REWIND_SIZE>::Serialize(AzNetworking::ISerializer& serializer)
     {
         if(!m_rewindableSize.Serialize(serializer))
         {
@@ -41,8 +41,8 @@ namespace Multiplayer
         return serializer.IsValid();
     }
 
-    template <typename TYPE, uint32_t SIZE>
-    bool RewindableFixedVector<TYPE, SIZE>::Serialize(AzNetworking::ISerializer& serializer, AzNetworking::IBitset& deltaRecord)
+    template <typename TYPE, uint32_t SIZE, AZStd::size_t REWIND_SIZE>
+    bool RewindableFixedVector<TYPE, SIZE, REWIND_SIZE>::Serialize(AzNetworking::ISerializer& serializer, AzNetworking::IBitset& deltaRecord)
     {
         if (deltaRecord.GetBit(SIZE))
         {
@@ -77,8 +77,8 @@ namespace Multiplayer
         return serializer.IsValid();
     }
     
-    template <typename TYPE, uint32_t SIZE>
-    constexpr bool RewindableFixedVector<TYPE, SIZE>::copy_values(const TYPE* buffer, uint32_t bufferSize)
+    template <typename TYPE, uint32_t SIZE, AZStd::size_t REWIND_SIZE>
+    constexpr bool RewindableFixedVector<TYPE, SIZE, REWIND_SIZE>::copy_values(const TYPE* buffer, uint32_t bufferSize)
     {
         if (!resize(bufferSize))
         {
@@ -93,8 +93,8 @@ namespace Multiplayer
         return true;
     }
 
-    template <typename TYPE, uint32_t SIZE>
-    constexpr RewindableFixedVector<TYPE, SIZE>& RewindableFixedVector<TYPE, SIZE>::operator=(const RewindableFixedVector<TYPE, SIZE>& rhs)
+    template <typename TYPE, uint32_t SIZE, AZStd::size_t REWIND_SIZE>
+    constexpr RewindableFixedVector<TYPE, SIZE, REWIND_SIZE>& RewindableFixedVector<TYPE, SIZE, REWIND_SIZE>::operator=(const RewindableFixedVector<TYPE, SIZE, REWIND_SIZE>& rhs)
     {
         resize(rhs.size());
         for (uint32_t idx = 0; idx < size(); ++idx)
@@ -104,20 +104,20 @@ namespace Multiplayer
         return *this;
     }
 
-    template <typename TYPE, uint32_t SIZE>
-    constexpr bool RewindableFixedVector<TYPE, SIZE>::operator ==(const RewindableFixedVector<TYPE, SIZE>& rhs) const
+    template <typename TYPE, uint32_t SIZE, AZStd::size_t REWIND_SIZE>
+    constexpr bool RewindableFixedVector<TYPE, SIZE, REWIND_SIZE>::operator ==(const RewindableFixedVector<TYPE, SIZE, REWIND_SIZE>& rhs) const
     {
         return m_container == rhs.m_container && m_rewindableSize == rhs.m_rewindableSize;
     }
 
-    template <typename TYPE, uint32_t SIZE>
-    constexpr bool RewindableFixedVector<TYPE, SIZE>::operator !=(const RewindableFixedVector<TYPE, SIZE>& rhs) const
+    template <typename TYPE, uint32_t SIZE, AZStd::size_t REWIND_SIZE>
+    constexpr bool RewindableFixedVector<TYPE, SIZE, REWIND_SIZE>::operator !=(const RewindableFixedVector<TYPE, SIZE, REWIND_SIZE>& rhs) const
     {
         return !(*this == rhs);
     }
 
-    template <typename TYPE, uint32_t SIZE>
-    constexpr bool RewindableFixedVector<TYPE, SIZE>::resize(uint32_t count)
+    template <typename TYPE, uint32_t SIZE, AZStd::size_t REWIND_SIZE>
+    constexpr bool RewindableFixedVector<TYPE, SIZE, REWIND_SIZE>::resize(uint32_t count)
     {
         if (count > SIZE)
         {
@@ -141,8 +141,8 @@ namespace Multiplayer
         return true;
     }
 
-    template <typename TYPE, uint32_t SIZE>
-    constexpr bool RewindableFixedVector<TYPE, SIZE>::resize_no_construct(uint32_t count)
+    template <typename TYPE, uint32_t SIZE, AZStd::size_t REWIND_SIZE>
+    constexpr bool RewindableFixedVector<TYPE, SIZE, REWIND_SIZE>::resize_no_construct(uint32_t count)
     {
         if (count > SIZE)
         {
@@ -154,8 +154,8 @@ namespace Multiplayer
         return true;
     }
 
-    template <typename TYPE, uint32_t SIZE>
-    constexpr void RewindableFixedVector<TYPE, SIZE>::clear()
+    template <typename TYPE, uint32_t SIZE, AZStd::size_t REWIND_SIZE>
+    constexpr void RewindableFixedVector<TYPE, SIZE, REWIND_SIZE>::clear()
     {
         for (uint32_t idx = 0; idx < SIZE; ++idx)
         {
@@ -164,22 +164,22 @@ namespace Multiplayer
         m_rewindableSize = 0;
     }
 
-    template <typename TYPE, uint32_t SIZE>
-    constexpr const TYPE& RewindableFixedVector<TYPE, SIZE>::operator[](uint32_t index) const
+    template <typename TYPE, uint32_t SIZE, AZStd::size_t REWIND_SIZE>
+    constexpr const TYPE& RewindableFixedVector<TYPE, SIZE, REWIND_SIZE>::operator[](uint32_t index) const
     {
         AZ_Assert(index < size(), "Out of bounds access (requested %u, reserved %u)", index, size());
         return m_container[index].Get();
     }
 
-    template <typename TYPE, uint32_t SIZE>
-    constexpr TYPE& RewindableFixedVector<TYPE, SIZE>::operator[](uint32_t index)
+    template <typename TYPE, uint32_t SIZE, AZStd::size_t REWIND_SIZE>
+    constexpr TYPE& RewindableFixedVector<TYPE, SIZE, REWIND_SIZE>::operator[](uint32_t index)
     {
         AZ_Assert(index < size(), "Out of bounds access (requested %u, reserved %u)", index, size());
         return m_container[index].Modify();
     }
 
-    template <typename TYPE, uint32_t SIZE>
-    constexpr bool RewindableFixedVector<TYPE, SIZE>::push_back(const TYPE& value)
+    template <typename TYPE, uint32_t SIZE, AZStd::size_t REWIND_SIZE>
+    constexpr bool RewindableFixedVector<TYPE, SIZE, REWIND_SIZE>::push_back(const TYPE& value)
     {
         if (size() < SIZE)
         {
@@ -191,8 +191,8 @@ namespace Multiplayer
         return false;
     }
 
-    template <typename TYPE, uint32_t SIZE>
-    constexpr bool RewindableFixedVector<TYPE, SIZE>::pop_back()
+    template <typename TYPE, uint32_t SIZE, AZStd::size_t REWIND_SIZE>
+    constexpr bool RewindableFixedVector<TYPE, SIZE, REWIND_SIZE>::pop_back()
     {
         if (size() > 0)
         {
@@ -204,21 +204,21 @@ namespace Multiplayer
         return false;
     }
 
-    template <typename TYPE, uint32_t SIZE>
-    constexpr bool RewindableFixedVector<TYPE, SIZE>::empty() const
+    template <typename TYPE, uint32_t SIZE, AZStd::size_t REWIND_SIZE>
+    constexpr bool RewindableFixedVector<TYPE, SIZE, REWIND_SIZE>::empty() const
     {
         return m_rewindableSize.Get() == 0;
     }
 
-    template <typename TYPE, uint32_t SIZE>
-    constexpr const TYPE& RewindableFixedVector<TYPE, SIZE>::back() const
+    template <typename TYPE, uint32_t SIZE, AZStd::size_t REWIND_SIZE>
+    constexpr const TYPE& RewindableFixedVector<TYPE, SIZE, REWIND_SIZE>::back() const
     {
         AZ_Assert(size() > 0, "Attempted to get back element of an empty RewindableFixedVector");
         return m_container[m_rewindableSize - 1].Get();
     }
 
-    template <typename TYPE, uint32_t SIZE>
-    constexpr uint32_t RewindableFixedVector<TYPE, SIZE>::size() const
+    template <typename TYPE, uint32_t SIZE, AZStd::size_t REWIND_SIZE>
+    constexpr uint32_t RewindableFixedVector<TYPE, SIZE, REWIND_SIZE>::size() const
     {
         return m_rewindableSize;
     }
@@ -17,6 +17,7 @@
 namespace Multiplayer
 {
     AZ_CVAR(AZ::TimeMs, cl_InputRateMs, AZ::TimeMs{ 33 }, nullptr, AZ::ConsoleFunctorFlags::Null, "Rate at which to sample and process client inputs");
+    AZ_CVAR(AZ::TimeMs, cl_InputSendIntervalMs, AZ::TimeMs{ 0 }, nullptr, AZ::ConsoleFunctorFlags::Null, "Minimum time between sending client inputs, inputs in between are carried by the redundant input array of the next send. Larger values trade loss tolerance for upstream bandwidth");
     AZ_CVAR(AZ::TimeMs, cl_MaxRewindHistoryMs, AZ::TimeMs{ 2000 }, nullptr, AZ::ConsoleFunctorFlags::Null, "Maximum number of milliseconds to keep for server correction rewind and replay");
 #ifndef AZ_RELEASE_BUILD
     AZ_CVAR(float, cl_DebugHackTimeMultiplier, 1.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "Scalar value used to simulate clock hacking cheats for validating bank time system and anticheat");
@@ -548,9 +549,21 @@ namespace Multiplayer
             }
 
             // Send the input to server (only when we are not migrating)
-            if (!IsMigrating())
+            // Inputs are coalesced when several are produced in one update or the send interval hasn't elapsed, the redundant
+            // elements of the next input array carry any unsent inputs, as long as there are never more of them than the array holds
+            const AZ::TimeMs currentTimeMs = AZ::GetElapsedTimeMs();
+            const bool lastInputThisUpdate = (m_moveAccumulator < inputRate);
+            const bool sendIntervalElapsed = (currentTimeMs - m_lastInputSentTimeMs) >= cl_InputSendIntervalMs;
+            const bool redundancyExhausted = (m_unsentInputCount + 1 >= NetworkInputArray::MaxElements);
+            if (!IsMigrating() && (redundancyExhausted || (lastInputThisUpdate && sendIntervalElapsed)))
             {
                 SendClientInput(inputArray, hashSerializer.GetHash(), processInputResult);
+                m_lastInputSentTimeMs = currentTimeMs;
+                m_unsentInputCount = 0;
+            }
+            else
+            {
+                ++m_unsentInputCount;
             }
         }
     }
@@ -46,8 +46,27 @@ namespace Multiplayer
     }
 
     void ClientToServerConnectionData::Update(AZ::TimeMs hostTimeMs)
+    {
+        if (BeginUpdate())
+        {
+            SerializeUpdates();
+            EndUpdate(hostTimeMs);
+        }
+    }
+
+    bool ClientToServerConnectionData::BeginUpdate()
     {
         m_entityReplicationManager.ActivatePendingEntities();
+        return true;
+    }
+
+    void ClientToServerConnectionData::SerializeUpdates()
+    {
+        m_entityReplicationManager.SerializeUpdates();
+    }
+
+    void ClientToServerConnectionData::EndUpdate(AZ::TimeMs hostTimeMs)
+    {
         m_entityReplicationManager.SendUpdates(hostTimeMs);
     }
 }
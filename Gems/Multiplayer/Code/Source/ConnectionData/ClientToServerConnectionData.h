@@ -29,6 +29,9 @@ namespace Multiplayer
         AzNetworking::IConnection* GetConnection() const override;
         EntityReplicationManager& GetReplicationManager() override;
         void Update(AZ::TimeMs hostTimeMs) override;
+        bool BeginUpdate() override;
+        void SerializeUpdates() override;
+        void EndUpdate(AZ::TimeMs hostTimeMs) override;
         bool CanSendUpdates() const override;
         void SetCanSendUpdates(bool canSendUpdates) override;
         //! @}
@@ -66,6 +66,15 @@ namespace Multiplayer
     }
 
     void ServerToClientConnectionData::Update(AZ::TimeMs hostTimeMs)
+    {
+        if (BeginUpdate())
+        {
+            SerializeUpdates();
+            EndUpdate(hostTimeMs);
+        }
+    }
+
+    bool ServerToClientConnectionData::BeginUpdate()
     {
         m_entityReplicationManager.ActivatePendingEntities();
 
@@ -73,11 +82,19 @@ namespace Multiplayer
         {
             NetBindComponent* netBindComponent = m_controlledEntity.GetNetBindComponent();
             // potentially false if we just migrated the player, if that is the case, don't send any more updates
-            if (netBindComponent != nullptr && (netBindComponent->GetNetEntityRole() == NetEntityRole::Authority))
-            {
-                m_entityReplicationManager.SendUpdates(hostTimeMs);
-            }
+            return (netBindComponent != nullptr) && (netBindComponent->GetNetEntityRole() == NetEntityRole::Authority);
         }
+        return false;
+    }
+
+    void ServerToClientConnectionData::SerializeUpdates()
+    {
+        m_entityReplicationManager.SerializeUpdates();
+    }
+
+    void ServerToClientConnectionData::EndUpdate(AZ::TimeMs hostTimeMs)
+    {
+        m_entityReplicationManager.SendUpdates(hostTimeMs);
     }
 
     void ServerToClientConnectionData::OnControlledEntityRemove()
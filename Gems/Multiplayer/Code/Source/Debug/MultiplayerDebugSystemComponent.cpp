@@ -8,12 +8,17 @@
 #include <Source/Debug/MultiplayerDebugSystemComponent.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Interface/Interface.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Console/ILogger.h>
+#include <AzCore/Utils/Utils.h>
 #include <AzNetworking/Framework/INetworking.h>
 #include <AzNetworking/Framework/INetworkInterface.h>
 #include <Multiplayer/IMultiplayer.h>
 
 namespace Multiplayer
 {
+    static constexpr char DefaultStatsCsvPath[] = "@user@/MultiplayerStats.csv";
+
     void MultiplayerDebugSystemComponent::Reflect(AZ::ReflectContext* context)
     {
         if (AZ::SerializeContext* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
@@ -52,17 +57,6 @@ namespace Multiplayer
 #endif
     }
 
-#ifdef IMGUI_ENABLED
-    void MultiplayerDebugSystemComponent::OnImGuiMainMenuUpdate()
-    {
-        if (ImGui::BeginMenu("Multiplayer"))
-        {
-            ImGui::Checkbox("Networking Stats", &m_displayNetworkingStats);
-            ImGui::Checkbox("Multiplayer Stats", &m_displayMultiplayerStats);
-            ImGui::EndMenu();
-        }
-    }
-
     void AccumulatePerSecondValues(const MultiplayerStats& stats, const MultiplayerStats::Metric& metric, float& outCallsPerSecond, float& outBytesPerSecond)
     {
         uint64_t summedCalls = 0;
@@ -77,6 +71,101 @@ namespace Multiplayer
         outBytesPerSecond += (summedBytes > 0 && totalTimeSeconds > 0.0f) ? static_cast<float>(summedBytes) / totalTimeSeconds : 0.0f;
     }
 
+    static void AppendMetricCsvRow
+    (
+        AZStd::string& outCsv,
+        const MultiplayerStats& stats,
+        const char* componentName,
+        const char* category,
+        const char* name,
+        const MultiplayerStats::Metric& metric
+    )
+    {
+        float callsPerSecond = 0.0f;
+        float bytesPerSecond = 0.0f;
+        AccumulatePerSecondValues(stats, metric, callsPerSecond, bytesPerSecond);
+        outCsv += AZStd::string::format
+        (
+            "%s,%s,%s,%llu,%llu,%.2f,%.2f\n",
+            componentName,
+            category,
+            name,
+            aznumeric_cast<AZ::u64>(metric.m_totalCalls),
+            aznumeric_cast<AZ::u64>(metric.m_totalBytes),
+            callsPerSecond,
+            bytesPerSecond
+        );
+    }
+
+    bool ExportMultiplayerStatsCsv(const char* filePath)
+    {
+        IMultiplayer* multiplayer = AZ::Interface<IMultiplayer>::Get();
+        MultiplayerComponentRegistry* componentRegistry = GetMultiplayerComponentRegistry();
+        if ((multiplayer == nullptr) || (componentRegistry == nullptr))
+        {
+            return false;
+        }
+
+        const MultiplayerStats& stats = multiplayer->GetStats();
+        AZStd::string csv = "Component,Category,Name,Total Calls,Total Bytes,Calls/Sec,Bytes/Sec\n";
+        for (AZStd::size_t componentIndex = 0; componentIndex < stats.m_componentStats.size(); ++componentIndex)
+        {
+            const NetComponentId netComponentId = aznumeric_cast<NetComponentId>(componentIndex);
+            const AZStd::string componentName = AZStd::string::format
+            (
+                "%s::%s", componentRegistry->GetComponentGemName(netComponentId), componentRegistry->GetComponentName(netComponentId)
+            );
+            const MultiplayerStats::ComponentStats& componentStats = stats.m_componentStats[componentIndex];
+            for (AZStd::size_t index = 0; index < componentStats.m_propertyUpdatesSent.size(); ++index)
+            {
+                const char* propertyName = componentRegistry->GetComponentPropertyName(netComponentId, aznumeric_cast<PropertyIndex>(index));
+                AppendMetricCsvRow(csv, stats, componentName.c_str(), "PropertyUpdates Sent", propertyName, componentStats.m_propertyUpdatesSent[index]);
+            }
+            for (AZStd::size_t index = 0; index < componentStats.m_propertyUpdatesRecv.size(); ++index)
+            {
+                const char* propertyName = componentRegistry->GetComponentPropertyName(netComponentId, aznumeric_cast<PropertyIndex>(index));
+                AppendMetricCsvRow(csv, stats, componentName.c_str(), "PropertyUpdates Recv", propertyName, componentStats.m_propertyUpdatesRecv[index]);
+            }
+            for (AZStd::size_t index = 0; index < componentStats.m_rpcsSent.size(); ++index)
+            {
+                const char* rpcName = componentRegistry->GetComponentRpcName(netComponentId, aznumeric_cast<RpcIndex>(index));
+                AppendMetricCsvRow(csv, stats, componentName.c_str(), "RemoteProcedures Sent", rpcName, componentStats.m_rpcsSent[index]);
+            }
+            for (AZStd::size_t index = 0; index < componentStats.m_rpcsRecv.size(); ++index)
+            {
+                const char* rpcName = componentRegistry->GetComponentRpcName(netComponentId, aznumeric_cast<RpcIndex>(index));
+                AppendMetricCsvRow(csv, stats, componentName.c_str(), "RemoteProcedures Recv", rpcName, componentStats.m_rpcsRecv[index]);
+            }
+        }
+
+        const AZ::Outcome<void, AZStd::string> result = AZ::Utils::WriteFile(csv, filePath);
+        if (!result.IsSuccess())
+        {
+            AZLOG_WARN("Failed to export multiplayer stats: %s", result.GetError().c_str());
+            return false;
+        }
+        AZLOG_INFO("Exported multiplayer stats to %s", filePath);
+        return true;
+    }
+
+    void net_ExportMultiplayerStatsCsv(const AZ::ConsoleCommandContainer& arguments)
+    {
+        const AZ::CVarFixedString filePath = arguments.empty() ? AZ::CVarFixedString(DefaultStatsCsvPath) : AZ::CVarFixedString(arguments.front());
+        ExportMultiplayerStatsCsv(filePath.c_str());
+    }
+    AZ_CONSOLEFREEFUNC(net_ExportMultiplayerStatsCsv, AZ::ConsoleFunctorFlags::DontReplicate, "Writes the per component property and rpc bandwidth stats to a csv file, optionally taking the output path");
+
+#ifdef IMGUI_ENABLED
+    void MultiplayerDebugSystemComponent::OnImGuiMainMenuUpdate()
+    {
+        if (ImGui::BeginMenu("Multiplayer"))
+        {
+            ImGui::Checkbox("Networking Stats", &m_displayNetworkingStats);
+            ImGui::Checkbox("Multiplayer Stats", &m_displayMultiplayerStats);
+            ImGui::EndMenu();
+        }
+    }
+
     bool DrawMetricsRow(const char* name, bool expandable, uint64_t totalCalls, uint64_t totalBytes, float callsPerSecond, float bytesPerSecond)
     {
         const ImGuiTreeNodeFlags flags = expandable ? ImGuiTreeNodeFlags_SpanFullWidth
@@ -278,6 +367,10 @@ namespace Multiplayer
                 ImGui::Text("Total networked entities: %llu", aznumeric_cast<AZ::u64>(stats.m_entityCount));
                 ImGui::Text("Total client connections: %llu", aznumeric_cast<AZ::u64>(stats.m_clientConnectionCount));
                 ImGui::Text("Total server connections: %llu", aznumeric_cast<AZ::u64>(stats.m_serverConnectionCount));
+                if (ImGui::Button("Export CSV"))
+                {
+                    ExportMultiplayerStatsCsv(DefaultStatsCsvPath);
+                }
                 ImGui::NewLine();
 
                 static ImGuiTableFlags flags = ImGuiTableFlags_BordersV
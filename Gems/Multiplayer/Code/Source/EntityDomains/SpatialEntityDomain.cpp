@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ * 
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/EntityDomains/SpatialEntityDomain.h>
+#include <Multiplayer/IMultiplayer.h>
+#include <Multiplayer/Components/NetBindComponent.h>
+#include <Source/NetworkEntity/NetworkEntityTracker.h>
+#include <AzCore/Component/TransformBus.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/std/algorithm.h>
+
+namespace Multiplayer 
+{
+    AZ_CVAR(float, sv_SpatialDomainRebalanceRate, 0.05f, nullptr, AZ::ConsoleFunctorFlags::Null, "Maximum fraction of a region's extent a shared border may move in a single rebalance");
+    AZ_CVAR(float, sv_SpatialDomainRebalanceThreshold, 0.1f, nullptr, AZ::ConsoleFunctorFlags::Null, "Relative tick cost difference between neighbouring hosts below which borders are left alone");
+    AZ_CVAR(float, sv_SpatialDomainMinExtent, 64.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "Minimum extent in meters a region may shrink to along its split axis when rebalancing");
+
+    SpatialEntityDomain::SpatialEntityDomain(const AZ::Aabb& region, uint32_t splitAxis, bool ownsMinSide)
+        : m_region(region)
+        , m_splitAxis(static_cast<int32_t>(splitAxis))
+        , m_ownsMinSide(ownsMinSide)
+    {
+        AZ_Assert(splitAxis < 3, "Split axis must be 0, 1 or 2");
+    }
+
+    void SpatialEntityDomain::SetRegion(const AZ::Aabb& region)
+    {
+        m_region = region;
+    }
+
+    const AZ::Aabb& SpatialEntityDomain::GetRegion() const
+    {
+        return m_region;
+    }
+
+    float SpatialEntityDomain::GetBorder() const
+    {
+        return m_ownsMinSide ? m_region.GetMax().GetElement(m_splitAxis) : m_region.GetMin().GetElement(m_splitAxis);
+    }
+
+    float SpatialEntityDomain::RebalanceBorder(float localTickCostMs, float neighbourTickCostMs)
+    {
+        const float totalCostMs = localTickCostMs + neighbourTickCostMs;
+        if (totalCostMs <= 0.0f)
+        {
+            return GetBorder();
+        }
+
+        // Positive when the neighbour is busier and this region should grow
+        const float relativeDifference = (neighbourTickCostMs - localTickCostMs) / totalCostMs;
+        if (AZStd::abs(relativeDifference) < sv_SpatialDomainRebalanceThreshold)
+        {
+            return GetBorder();
+        }
+
+        AZ::Vector3 regionMin = m_region.GetMin();
+        AZ::Vector3 regionMax = m_region.GetMax();
+        const float extent = regionMax.GetElement(m_splitAxis) - regionMin.GetElement(m_splitAxis);
+        const float maxShrink = AZStd::max(extent - static_cast<float>(sv_SpatialDomainMinExtent), 0.0f);
+        const float growth = AZStd::max(relativeDifference * static_cast<float>(sv_SpatialDomainRebalanceRate) * extent, -maxShrink);
+
+        if (m_ownsMinSide)
+        {
+            regionMax.SetElement(m_splitAxis, regionMax.GetElement(m_splitAxis) + growth);
+        }
+        else
+        {
+            regionMin.SetElement(m_splitAxis, regionMin.GetElement(m_splitAxis) - growth);
+        }
+        m_region = AZ::Aabb::CreateFromMinMax(regionMin, regionMax);
+        return GetBorder();
+    }
+
+    bool SpatialEntityDomain::IsInDomain(const ConstNetworkEntityHandle& entityHandle) const
+    {
+        const AZ::Entity* entity = entityHandle.GetEntity();
+        if ((entity == nullptr) || (entity->GetTransform() == nullptr))
+        {
+            return false;
+        }
+        return m_region.Contains(entity->GetTransform()->GetWorldTranslation());
+    }
+
+    void SpatialEntityDomain::ActivateTracking([[maybe_unused]] const INetworkEntityManager::OwnedEntitySet& ownedEntitySet)
+    {
+        ;
+    }
+
+    void SpatialEntityDomain::RetrieveEntitiesNotInDomain(EntitiesNotInDomain& outEntitiesNotInDomain) const
+    {
+        NetworkEntityTracker* networkEntityTracker = GetNetworkEntityTracker();
+        if (networkEntityTracker == nullptr)
+        {
+            return;
+        }
+
+        for (const auto& iter : *networkEntityTracker)
+        {
+            ConstNetworkEntityHandle entityHandle(iter.second, networkEntityTracker);
+            const NetBindComponent* netBindComponent = entityHandle.GetNetBindComponent();
+            // Only entities this host is authoritative over can leave its domain
+            if ((netBindComponent != nullptr) && (netBindComponent->GetNetEntityRole() == NetEntityRole::Authority) && !IsInDomain(entityHandle))
+            {
+                outEntitiesNotInDomain.emplace(iter.first);
+            }
+        }
+    }
+
+    void SpatialEntityDomain::DebugDraw() const
+    {
+        ;
+    }
+}
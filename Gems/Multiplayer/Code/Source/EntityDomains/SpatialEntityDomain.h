@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ * 
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Multiplayer/EntityDomains/IEntityDomain.h>
+#include <AzCore/Math/Aabb.h>
+
+namespace Multiplayer 
+{
+    //! @class SpatialEntityDomain
+    //! @brief An entity domain that owns every authoritative entity positioned within an axis aligned region of the world.
+    //! Adjacent hosts own neighbouring regions that share a border along a single split axis. Entities that move across the border
+    //! leave the domain and are migrated to the neighbouring host through the normal entity exit domain handling.
+    class SpatialEntityDomain
+        : public IEntityDomain
+    {
+    public:
+        //! Constructor.
+        //! @param region      the region of the world owned by this domain
+        //! @param splitAxis   the axis (0, 1 or 2) along which this region borders its neighbour
+        //! @param ownsMinSide true if this region is on the minimum side of the shared border, false if the neighbour is
+        SpatialEntityDomain(const AZ::Aabb& region, uint32_t splitAxis, bool ownsMinSide);
+        SpatialEntityDomain(const SpatialEntityDomain& rhs) = default;
+
+        //! Sets the region of the world owned by this domain.
+        //! @param region the new region owned by this domain
+        void SetRegion(const AZ::Aabb& region);
+
+        //! Returns the region of the world owned by this domain.
+        //! @return the region owned by this domain
+        const AZ::Aabb& GetRegion() const;
+
+        //! Returns the position of the border shared with the neighbouring domain along the split axis.
+        //! @return the position of the shared border
+        float GetBorder() const;
+
+        //! Moves the shared border towards the more expensive host so that work flows to the cheaper one.
+        //! Both hosts evaluate this with the same pair of tick costs and move the border by the same amount, so their regions stay adjacent.
+        //! @param localTickCostMs    the average tick cost of this host in milliseconds
+        //! @param neighbourTickCostMs the average tick cost of the neighbouring host in milliseconds
+        //! @return the new position of the shared border
+        float RebalanceBorder(float localTickCostMs, float neighbourTickCostMs);
+
+        //! IEntityDomain overrides.
+        //! @{
+        bool IsInDomain(const ConstNetworkEntityHandle& entityHandle) const override;
+        void ActivateTracking(const INetworkEntityManager::OwnedEntitySet& ownedEntitySet) override;
+        void RetrieveEntitiesNotInDomain(EntitiesNotInDomain& outEntitiesNotInDomain) const override;
+        void DebugDraw() const override;
+        //! @}
+
+    private:
+
+        AZ::Aabb m_region = AZ::Aabb::CreateNull();
+        int32_t m_splitAxis = 0;
+        bool m_ownsMinSide = true;
+    };
+}
@@ -30,6 +30,7 @@ namespace Multiplayer
 
     void MultiplayerStats::RecordPropertySent(NetComponentId netComponentId, PropertyIndex propertyId, uint32_t totalBytes)
     {
+        AZStd::lock_guard<AZStd::mutex> lock(m_recordMutex);
         const uint16_t netComponentIndex = aznumeric_cast<uint16_t>(netComponentId);
         const uint16_t propertyIndex = aznumeric_cast<uint16_t>(propertyId);
         m_componentStats[netComponentIndex].m_propertyUpdatesSent[propertyIndex].m_totalCalls++;
@@ -40,6 +41,7 @@ namespace Multiplayer
 
     void MultiplayerStats::RecordPropertyReceived(NetComponentId netComponentId, PropertyIndex propertyId, uint32_t totalBytes)
     {
+        AZStd::lock_guard<AZStd::mutex> lock(m_recordMutex);
         const uint16_t netComponentIndex = aznumeric_cast<uint16_t>(netComponentId);
         const uint16_t propertyIndex = aznumeric_cast<uint16_t>(propertyId);
         m_componentStats[netComponentIndex].m_propertyUpdatesRecv[propertyIndex].m_totalCalls++;
@@ -50,6 +52,7 @@ namespace Multiplayer
 
     void MultiplayerStats::RecordRpcSent(NetComponentId netComponentId, RpcIndex rpcId, uint32_t totalBytes)
     {
+        AZStd::lock_guard<AZStd::mutex> lock(m_recordMutex);
         const uint16_t netComponentIndex = aznumeric_cast<uint16_t>(netComponentId);
         const uint16_t rpcIndex = aznumeric_cast<uint16_t>(rpcId);
         m_componentStats[netComponentIndex].m_rpcsSent[rpcIndex].m_totalCalls++;
@@ -60,6 +63,7 @@ namespace Multiplayer
 
     void MultiplayerStats::RecordRpcReceived(NetComponentId netComponentId, RpcIndex rpcId, uint32_t totalBytes)
     {
+        AZStd::lock_guard<AZStd::mutex> lock(m_recordMutex);
         const uint16_t netComponentIndex = aznumeric_cast<uint16_t>(netComponentId);
         const uint16_t rpcIndex = aznumeric_cast<uint16_t>(rpcId);
         m_componentStats[netComponentIndex].m_rpcsRecv[rpcIndex].m_totalCalls++;
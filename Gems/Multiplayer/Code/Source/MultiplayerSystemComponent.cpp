@@ -11,6 +11,7 @@
 #include <ConnectionData/ClientToServerConnectionData.h>
 #include <ConnectionData/ServerToClientConnectionData.h>
 #include <EntityDomains/FullOwnershipEntityDomain.h>
+#include <EntityDomains/SpatialEntityDomain.h>
 #include <ReplicationWindows/NullReplicationWindow.h>
 #include <ReplicationWindows/ServerToClientReplicationWindow.h>
 #include <Source/AutoGen/AutoComponentTypes.h>
@@ -18,6 +19,8 @@
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Serialization/Utils.h>
 #include <AzCore/Interface/Interface.h>
+#include <AzCore/Jobs/Algorithms.h>
+#include <AzCore/Jobs/JobContext.h>
 #include <AzCore/Component/TransformBus.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Console/ILogger.h>
@@ -76,8 +79,10 @@ namespace Multiplayer
     AZ_CVAR(AZ::CVarFixedString, sv_gamerules, "norules", nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "GameRules server works with");
     AZ_CVAR(ProtocolType, sv_protocol, ProtocolType::Udp, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "This flag controls whether we use TCP or UDP for game networking");
     AZ_CVAR(bool, sv_isDedicated, true, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Whether the host command creates an independent or client hosted server");
+    AZ_CVAR(bool, sv_useSpatialEntityDomain, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Whether the host owns only the entities within its spatial region instead of the entire world");
     AZ_CVAR(AZ::TimeMs, cl_defaultNetworkEntityActivationTimeSliceMs, AZ::TimeMs{ 0 }, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Max Ms to use to activate entities coming from the network, 0 means instantiate everything");
     AZ_CVAR(AZ::TimeMs, sv_serverSendRateMs, AZ::TimeMs{ 50 }, nullptr, AZ::ConsoleFunctorFlags::Null, "Minimum number of milliseconds between each network update");
+    AZ_CVAR(bool, sv_parallelReplicationSerialize, true, nullptr, AZ::ConsoleFunctorFlags::Null, "Whether entity updates for multiple connections are serialized in parallel using the job system");
     AZ_CVAR(AZ::CVarFixedString, sv_defaultPlayerSpawnAsset, "prefabs/player.network.spawnable", nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "The default spawnable to use when a new player connects");
 
     void MultiplayerSystemComponent::Reflect(AZ::ReflectContext* context)
@@ -200,12 +205,16 @@ namespace Multiplayer
 
         // Send out the game state update to all connections
         {
-            auto sendNetworkUpdates = [hostTimeMs, &stats](IConnection& connection)
+            AZStd::vector<IConnectionData*> updatingConnections;
+            auto beginNetworkUpdates = [&updatingConnections, &stats](IConnection& connection)
             {
                 if (connection.GetUserData() != nullptr)
                 {
                     IConnectionData* connectionData = reinterpret_cast<IConnectionData*>(connection.GetUserData());
-                    connectionData->Update(hostTimeMs);
+                    if (connectionData->BeginUpdate())
+                    {
+                        updatingConnections.push_back(connectionData);
+                    }
                     if (connectionData->GetConnectionDataType() == ConnectionDataType::ServerToClient)
                     {
                         stats.m_clientConnectionCount++;
@@ -216,8 +225,29 @@ namespace Multiplayer
                     }
                 }
             };
+            m_networkInterface->GetConnectionSet().VisitConnections(beginNetworkUpdates);
+
+            // Serializing updates only reads entity state and writes per connection state, so connections can be serialized in parallel
+            // Sending stays on the main thread since the network interface is shared by all connections
+            if (sv_parallelReplicationSerialize && (updatingConnections.size() > 1) && (AZ::JobContext::GetGlobalContext() != nullptr))
+            {
+                AZ::parallel_for(size_t(0), updatingConnections.size(), [&updatingConnections](size_t index)
+                {
+                    updatingConnections[index]->SerializeUpdates();
+                });
+            }
+            else
+            {
+                for (IConnectionData* connectionData : updatingConnections)
+                {
+                    connectionData->SerializeUpdates();
+                }
+            }
 
-            m_networkInterface->GetConnectionSet().VisitConnections(sendNetworkUpdates);
+            for (IConnectionData* connectionData : updatingConnections)
+            {
+                connectionData->EndUpdate(hostTimeMs);
+            }
         }
 
         MultiplayerPackets::SyncConsole packet;
@@ -542,7 +572,15 @@ namespace Multiplayer
 
                 const AZ::Aabb worldBounds = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-16384.0f), AZ::Vector3(16384.0f));
                 //const AZ::Aabb worldBounds = AZ::Interface<IPhysics>.Get()->GetWorldBounds();
-                AZStd::unique_ptr<IEntityDomain> newDomain = AZStd::make_unique<FullOwnershipEntityDomain>();
+                AZStd::unique_ptr<IEntityDomain> newDomain;
+                if (sv_useSpatialEntityDomain)
+                {
+                    newDomain = AZStd::make_unique<SpatialEntityDomain>(worldBounds, 0, true);
+                }
+                else
+                {
+                    newDomain = AZStd::make_unique<FullOwnershipEntityDomain>();
+                }
                 m_networkEntityManager.Initialize(InvalidHostId, AZStd::move(newDomain));
             }
         }
@@ -27,6 +27,7 @@
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Console/ILogger.h>
 #include <AzCore/Math/Transform.h>
+#include <AzCore/std/sort.h>
 
 namespace Multiplayer
 {
@@ -35,7 +36,14 @@ namespace Multiplayer
     // Take out a few extra bytes for special headers, we currently only use 1 byte for the count of entity updates
     constexpr uint32_t ReplicationManagerPacketOverhead = 16;
 
+    // Fraction of a second of unused entity update budget that can be carried over
+    constexpr float EntityUpdateBudgetBurstSeconds = 0.1f;
+    // Weight of the latest send when tracking the average entity update size
+    constexpr float EntityUpdateSizeSmoothing = 0.1f;
+
     AZ_CVAR(bool, bg_replicationWindowImmediateAddRemove, true, nullptr, AZ::ConsoleFunctorFlags::Null, "Update replication windows immediately on visibility Add/Removes.");
+    AZ_CVAR(uint32_t, sv_MaxEntityUpdateBytesPerSecond, 0, nullptr, AZ::ConsoleFunctorFlags::Null, "The maximum rate of entity update bytes sent per connection, autonomous entities are always sent. 0 disables the limit");
+    AZ_CVAR(float, sv_MinEntitySendPriority, 0.01f, nullptr, AZ::ConsoleFunctorFlags::Null, "The minimum rate at which the send priority of a pending entity update grows, so irrelevant entities are still sent eventually");
 
     EntityReplicationManager::EntityReplicationManager(AzNetworking::IConnection& connection, AzNetworking::IConnectionListener& connectionListener, Mode updateMode)
         : m_updateMode(updateMode)
@@ -92,10 +100,38 @@ namespace Multiplayer
         }
     }
 
-    void EntityReplicationManager::SendUpdates(AZ::TimeMs hostTimeMs)
+    void EntityReplicationManager::SerializeUpdates()
     {
         m_frameTimeMs = AZ::GetElapsedTimeMs();
+        UpdateEntityUpdateByteBudget();
+
+        m_serializedReplicators = GenerateEntityUpdateList();
+
+        // prep a replication record for send, at this point, everything needs to be sent
+        for (EntityReplicator* replicator : m_serializedReplicators)
+        {
+            replicator->GetPropertyPublisher()->PrepareSerialization();
+        }
+
+        // Serialize everything up front, packetizing and sending is left to SendUpdates on the main thread
+        m_serializedUpdateMessages.clear();
+        for (EntityReplicator* replicator : m_serializedReplicators)
+        {
+            m_serializedUpdateMessages.push_back(replicator->GenerateUpdatePacket());
+        }
+
+        m_updatesSerialized = true;
+    }
+
+    void EntityReplicationManager::SendUpdates(AZ::TimeMs hostTimeMs)
+    {
+        if (!m_updatesSerialized)
+        {
+            SerializeUpdates();
+        }
+
         SendEntityUpdates(hostTimeMs);
+        m_updatesSerialized = false;
 
         SendEntityRpcs(m_deferredRpcMessagesReliable, true);
         SendEntityRpcs(m_deferredRpcMessagesUnreliable, false);
@@ -115,10 +151,11 @@ namespace Multiplayer
         );
     }
 
-    void EntityReplicationManager::SendEntityUpdatesPacketHelper
+    uint32_t EntityReplicationManager::SendEntityUpdatesPacketHelper
     (
         AZ::TimeMs hostTimeMs,
         EntityReplicatorList& toSendList,
+        EntityUpdateMessageList& toSendMessages,
         uint32_t maxPayloadSize,
         AzNetworking::IConnection& connection
     )
@@ -128,11 +165,11 @@ namespace Multiplayer
         MultiplayerPackets::EntityUpdates entityUpdatePacket;
         entityUpdatePacket.SetHostTimeMs(hostTimeMs);
         entityUpdatePacket.SetHostFrameId(GetNetworkTime()->GetHostFrameId());
-        // Serialize everything
+        // Pack as many of the serialized updates as will fit
         while (!toSendList.empty())
         {
             EntityReplicator* replicator = toSendList.front();
-            NetworkEntityUpdateMessage updateMessage(replicator->GenerateUpdatePacket());
+            const NetworkEntityUpdateMessage& updateMessage = toSendMessages.front();
 
             const uint32_t nextMessageSize = updateMessage.GetEstimatedSerializeSize();
 
@@ -149,6 +186,7 @@ namespace Multiplayer
             entityUpdatePacket.ModifyEntityMessages().push_back(updateMessage);
             replicatorUpdatedList.push_back(replicator);
             toSendList.pop_front();
+            toSendMessages.pop_front();
 
             if (largeEntityDetected)
             {
@@ -172,6 +210,8 @@ namespace Multiplayer
         {
             replicator->GetPropertyPublisher()->FinalizeSerialization(sentId);
         }
+
+        return pendingPacketSize;
     }
 
     EntityReplicationManager::EntityReplicatorList EntityReplicationManager::GenerateEntityUpdateList()
@@ -184,8 +224,16 @@ namespace Multiplayer
         // Generate a list of all our entities that need updates
         EntityReplicatorList toSendList;
 
-        uint32_t elementsAdded = 0;
-        for (auto iter = m_replicatorsPendingSend.begin(); iter != m_replicatorsPendingSend.end() && elementsAdded < m_replicationWindow->GetMaxEntityReplicatorSendCount(); )
+        struct PrioritizedReplicator
+        {
+            EntityReplicator* m_replicator;
+            float m_priority;
+        };
+        AZStd::vector<PrioritizedReplicator> candidates;
+        candidates.reserve(m_replicatorsPendingSend.size());
+
+        const ReplicationSet& replicationSet = m_replicationWindow->GetReplicationSet();
+        for (auto iter = m_replicatorsPendingSend.begin(); iter != m_replicatorsPendingSend.end(); )
         {
             EntityReplicator* replicator = GetEntityReplicator(*iter);
             bool clearPendingSend = true;
@@ -225,19 +273,21 @@ namespace Multiplayer
                         }
                         else
                         {
-                            if (elementsAdded < m_replicationWindow->GetMaxEntityReplicatorSendCount())
-                            {
-                                toSendList.push_back(replicator);
-                            }
+                            // The longer an entity waits for a send, the higher its priority grows, at a rate scaled by its relevance to the window
+                            auto windowIter = replicationSet.find(replicator->GetEntityHandle());
+                            const float relevance = (windowIter != replicationSet.end()) ? windowIter->second.m_priority : 0.0f;
+                            float& accumulatedPriority = m_sendPriorityAccumulators[entityId];
+                            accumulatedPriority += AZStd::max(relevance, static_cast<float>(sv_MinEntitySendPriority));
+                            candidates.push_back({ replicator, accumulatedPriority });
                         }
                     }
-                    ++elementsAdded;
                 }
             }
 
             if (clearPendingSend)
             {
                 m_remoteEntitiesPendingCreation.erase(*iter);
+                m_sendPriorityAccumulators.erase(*iter);
                 iter = m_replicatorsPendingSend.erase(iter);
             }
             else
@@ -246,26 +296,73 @@ namespace Multiplayer
             }
         }
 
+        size_t maxSendCount = m_replicationWindow->GetMaxEntityReplicatorSendCount();
+        if (sv_MaxEntityUpdateBytesPerSecond > 0)
+        {
+            // Estimate how many updates fit into the remaining bandwidth budget
+            const float budgetedCount = AZStd::max(m_entityUpdateByteBudget, 0.0f) / AZStd::max(m_averageEntityUpdateSize, 1.0f);
+            maxSendCount = AZStd::min(maxSendCount, static_cast<size_t>(budgetedCount));
+        }
+
+        if (candidates.size() > maxSendCount)
+        {
+            AZStd::sort(candidates.begin(), candidates.end(), [](const PrioritizedReplicator& lhs, const PrioritizedReplicator& rhs)
+            {
+                return lhs.m_priority > rhs.m_priority;
+            });
+            candidates.resize(maxSendCount);
+        }
+
+        for (const PrioritizedReplicator& candidate : candidates)
+        {
+            m_sendPriorityAccumulators.erase(candidate.m_replicator->GetEntityHandle().GetNetEntityId());
+            toSendList.push_back(candidate.m_replicator);
+        }
+
         return toSendList;
     }
 
-    void EntityReplicationManager::SendEntityUpdates(AZ::TimeMs hostTimeMs)
+    void EntityReplicationManager::UpdateEntityUpdateByteBudget()
     {
-        EntityReplicatorList toSendList = GenerateEntityUpdateList();
-    
-        AZLOG(NET_ReplicationInfo, "Sending %zd updates from %d to %d", toSendList.size(), (uint8_t)GetNetworkEntityManager()->GetHostId(), (uint8_t)GetRemoteHostId());
-    
-        // prep a replication record for send, at this point, everything needs to be sent
-        for (EntityReplicator* replicator : toSendList)
+        const uint32_t bytesPerSecond = sv_MaxEntityUpdateBytesPerSecond;
+        if (bytesPerSecond == 0)
         {
-            replicator->GetPropertyPublisher()->PrepareSerialization();
+            return;
         }
+
+        const AZ::TimeMs elapsedMs = (m_lastByteBudgetUpdateMs > AZ::TimeMs{ 0 }) ? m_frameTimeMs - m_lastByteBudgetUpdateMs : AZ::TimeMs{ 0 };
+        m_lastByteBudgetUpdateMs = m_frameTimeMs;
+
+        // Cap the accumulated budget so an idle connection can't burst far beyond its rate, but always allow at least one full packet
+        const float maxBudget = AZStd::max(static_cast<float>(bytesPerSecond) * EntityUpdateBudgetBurstSeconds, static_cast<float>(m_maxPayloadSize));
+        const float refill = static_cast<float>(bytesPerSecond) * static_cast<float>(static_cast<int64_t>(elapsedMs)) / 1000.0f;
+        m_entityUpdateByteBudget = AZStd::min(m_entityUpdateByteBudget + refill, maxBudget);
+    }
+
+    void EntityReplicationManager::SendEntityUpdates(AZ::TimeMs hostTimeMs)
+    {
+        EntityReplicatorList& toSendList = m_serializedReplicators;
+        EntityUpdateMessageList& toSendMessages = m_serializedUpdateMessages;
+        AZ_Assert(toSendList.size() == toSendMessages.size(), "Every replicator pending send requires a serialized update message");
+
+        AZLOG(NET_ReplicationInfo, "Sending %zd updates from %d to %d", toSendList.size(), (uint8_t)GetNetworkEntityManager()->GetHostId(), (uint8_t)GetRemoteHostId());
+
+        const size_t sentUpdateCount = toSendList.size();
+        uint32_t sentBytes = 0;
     
         // While our to send list is not empty, build up another packet to send
         do
         {
-            SendEntityUpdatesPacketHelper(hostTimeMs, toSendList, m_maxPayloadSize, m_connection);
+            sentBytes += SendEntityUpdatesPacketHelper(hostTimeMs, toSendList, toSendMessages, m_maxPayloadSize, m_connection);
         } while (!toSendList.empty());
+
+        if (sentUpdateCount > 0)
+        {
+            // Track the average update size to estimate how many updates fit into the budget next time
+            const float averageSize = static_cast<float>(sentBytes) / static_cast<float>(sentUpdateCount);
+            m_averageEntityUpdateSize += (averageSize - m_averageEntityUpdateSize) * EntityUpdateSizeSmoothing;
+            m_entityUpdateByteBudget -= static_cast<float>(sentBytes);
+        }
     }
 
     void EntityReplicationManager::SendEntityRpcs(RpcMessages& deferredRpcs, bool reliable)
@@ -333,6 +430,11 @@ namespace Multiplayer
             m_replicatorsPendingSend.clear();
         }
 
+        // Drop any serialized updates not yet sent, they reference the replicators being destroyed
+        m_serializedReplicators.clear();
+        m_serializedUpdateMessages.clear();
+        m_updatesSerialized = false;
+
         m_entityReplicatorMap.clear();
     }
 
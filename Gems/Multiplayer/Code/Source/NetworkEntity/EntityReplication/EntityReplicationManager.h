@@ -20,6 +20,7 @@
 #include <AzCore/std/containers/map.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/limits.h>
 #include <AzCore/EBus/Event.h>
 #include <AzCore/EBus/ScheduledEvent.h>
@@ -57,6 +58,10 @@ namespace Multiplayer
         HostId GetRemoteHostId() const;
 
         void ActivatePendingEntities();
+        //! Gathers and serializes the entity updates that the next SendUpdates call will send.
+        //! Only modifies state owned by this manager, so managers for different connections can serialize concurrently
+        //! provided no network entities are modified while doing so.
+        void SerializeUpdates();
         void SendUpdates(AZ::TimeMs hostTimeMs);
         void Clear(bool forMigration);
 
@@ -114,10 +119,21 @@ namespace Multiplayer
         bool DispatchOrphanedRpc(NetworkEntityRpcMessage& message, EntityReplicator* entityReplicator);
 
         using EntityReplicatorList = AZStd::deque<EntityReplicator*>;
+        using EntityUpdateMessageList = AZStd::deque<NetworkEntityUpdateMessage>;
         EntityReplicatorList GenerateEntityUpdateList();
 
-        void SendEntityUpdatesPacketHelper(AZ::TimeMs hostTimeMs, EntityReplicatorList& toSendList, uint32_t maxPayloadSize, AzNetworking::IConnection& connection);
+        //! Sends a single entity update packet, removing the sent replicators and their update messages from the front of the lists.
+        //! @return the number of entity update bytes sent
+        uint32_t SendEntityUpdatesPacketHelper
+        (
+            AZ::TimeMs hostTimeMs,
+            EntityReplicatorList& toSendList,
+            EntityUpdateMessageList& toSendMessages,
+            uint32_t maxPayloadSize,
+            AzNetworking::IConnection& connection
+        );
 
+        void UpdateEntityUpdateByteBudget();
         void SendEntityUpdates(AZ::TimeMs hostTimeMs);
         void SendEntityRpcs(RpcMessages& deferredRpcs, bool reliable);
 
@@ -182,6 +198,8 @@ namespace Multiplayer
         AZStd::deque<NetEntityId> m_entitiesPendingActivation;
         AZStd::set<NetEntityId> m_replicatorsPendingRemoval;
         AZStd::unordered_set<NetEntityId> m_replicatorsPendingSend;
+        //! Send priorities of pending entity updates, accumulated for every send they miss out on
+        AZStd::unordered_map<NetEntityId, float> m_sendPriorityAccumulators;
 
         // Deferred RPC Sends
         RpcMessages m_deferredRpcMessagesReliable;
@@ -198,9 +216,17 @@ namespace Multiplayer
         AZStd::unique_ptr<IReplicationWindow> m_replicationWindow;
         AZStd::unique_ptr<IEntityDomain> m_remoteEntityDomain;
 
+        // Replicators and their update messages generated by SerializeUpdates, waiting to be sent by SendUpdates
+        EntityReplicatorList m_serializedReplicators;
+        EntityUpdateMessageList m_serializedUpdateMessages;
+        bool m_updatesSerialized = false;
+
         AZ::TimeMs m_entityActivationTimeSliceMs = AZ::TimeMs{ 0 };
         AZ::TimeMs m_entityPendingRemovalMs = AZ::TimeMs{ 0 };
         AZ::TimeMs m_frameTimeMs = AZ::TimeMs{ 0 };
+        AZ::TimeMs m_lastByteBudgetUpdateMs = AZ::TimeMs{ 0 };
+        float m_entityUpdateByteBudget = 0.0f;
+        float m_averageEntityUpdateSize = 64.0f;
         HostId m_remoteHostId = InvalidHostId;
         uint32_t m_maxRemoteEntitiesPendingCreationCount = AZStd::numeric_limits<uint32_t>::max();
         uint32_t m_maxPayloadSize = 0;
@@ -126,7 +126,8 @@ namespace Multiplayer
         // If we reach the maximum outstanding records, reset the replication state
         if (m_sentRecords.size() >= net_EntityReplicatorRecordsMax)
         {
-            return PrepareAddEntityRecord();
+            // The remote entity already exists at this point, so an Autonomous endpoint must not have its predicted values stomped
+            return (m_pendingRecord.GetRemoteNetworkRole() == NetEntityRole::Autonomous) ? PrepareRebaseEntityRecord() : PrepareAddEntityRecord();
         }
 
         // We need to clear out old records, and build up a list of everything that has changed since the last acked packet
@@ -17,6 +17,10 @@ namespace AzNetworking
 
 namespace Multiplayer
 {
+    //! Publishes the replicated properties of a single entity to a single connection.
+    //! Updates are sent unreliably and delta compressed against the last state the remote endpoint acknowledged: every
+    //! update carries all changes since the most recent acked record, so a lost packet is healed by the next update
+    //! without any resends. If too many records stay unacknowledged, the full state is sent again instead.
     class PropertyPublisher
     {
     public:
@@ -9,7 +9,7 @@
 
 #include <Multiplayer/MultiplayerTypes.h>
 #include <Multiplayer/NetworkEntity/NetworkEntityHandle.h>
-#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/flat_hash_map.h>
 #include <AzCore/Component/Entity.h>
 
 namespace Multiplayer
@@ -20,7 +20,7 @@ namespace Multiplayer
     {
     public:
 
-        using EntityMap = AZStd::unordered_map<NetEntityId, AZ::Entity*>;
+        using EntityMap = AZStd::flat_hash_map<NetEntityId, AZ::Entity*>;
         using iterator = EntityMap::iterator;
         using const_iterator = EntityMap::const_iterator;
 
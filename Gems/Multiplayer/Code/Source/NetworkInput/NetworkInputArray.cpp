@@ -62,8 +62,9 @@ namespace Multiplayer
                 {
                     return false;
                 }
-                // Start with previous value
+                // Start with previous value, elements hold consecutive inputs so the id is predicted rather than sent
                 m_inputs[i].m_networkInput = m_inputs[i - 1].m_networkInput;
+                m_inputs[i].m_networkInput.SetClientInputId(m_inputs[i - 1].m_networkInput.GetClientInputId() - ClientInputId{ 1 });
                 // Then apply delta
                 AzNetworking::DeltaSerializerApply applySerializer(deltaSerializer);
                 if (!applySerializer.ApplyDelta(m_inputs[i].m_networkInput))
@@ -74,9 +75,14 @@ namespace Multiplayer
             else
             {
                 AzNetworking::SerializerDelta deltaSerializer;
-                // Create the delta
+                // Create the delta against the previous value with the predicted id, so consecutive ids cost nothing
+                NetworkInput& previousInput = m_inputs[i - 1].m_networkInput;
+                const ClientInputId previousInputId = previousInput.GetClientInputId();
+                previousInput.SetClientInputId(previousInputId - ClientInputId{ 1 });
                 AzNetworking::DeltaSerializerCreate createSerializer(deltaSerializer);
-                if (!createSerializer.CreateDelta(m_inputs[i - 1].m_networkInput, m_inputs[i].m_networkInput))
+                const bool deltaCreated = createSerializer.CreateDelta(previousInput, m_inputs[i].m_networkInput);
+                previousInput.SetClientInputId(previousInputId);
+                if (!deltaCreated)
                 {
                     return false;
                 }
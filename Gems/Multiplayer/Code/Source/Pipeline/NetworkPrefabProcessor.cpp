@@ -6,12 +6,15 @@
  */
 
 #include <Multiplayer/IMultiplayerTools.h>
+#include <Multiplayer/Components/MultiplayerComponent.h>
 #include <Multiplayer/Components/NetBindComponent.h>
 #include <Pipeline/NetBindMarkerComponent.h>
 #include <Pipeline/NetworkPrefabProcessor.h>
 #include <Pipeline/NetworkSpawnableHolderComponent.h>
 
+#include <AzCore/Component/ComponentApplicationBus.h>
 #include <AzCore/Serialization/Utils.h>
+#include <AzCore/std/algorithm.h>
 #include <AzFramework/Components/TransformComponent.h>
 #include <AzFramework/Spawnable/Spawnable.h>
 #include <AzToolsFramework/Prefab/Instance/Instance.h>
@@ -31,8 +34,20 @@ namespace Multiplayer
             mpTools->SetDidProcessNetworkPrefabs(false);
         }
 
-        context.ListPrefabs([&context](AZStd::string_view prefabName, PrefabDom& prefab) {
-            ProcessPrefab(context, prefabName, prefab);
+        // Dedicated servers never render or play audio, so client only components are stripped from server platform spawnables
+        AZStd::vector<AZ::Crc32> serverStrippedServices;
+        const AZ::PlatformTagSet& platformTags = context.GetPlatformTags();
+        if (platformTags.find(AZ::Crc32(m_serverPlatformTag)) != platformTags.end())
+        {
+            serverStrippedServices.reserve(m_serverStrippedServices.size());
+            for (const AZStd::string& serviceName : m_serverStrippedServices)
+            {
+                serverStrippedServices.emplace_back(AZ::Crc32(serviceName));
+            }
+        }
+
+        context.ListPrefabs([&context, &serverStrippedServices](AZStd::string_view prefabName, PrefabDom& prefab) {
+            ProcessPrefab(context, prefabName, prefab, serverStrippedServices);
         });
 
         if (mpTools && !context.GetProcessedObjects().empty())
@@ -45,7 +60,10 @@ namespace Multiplayer
     {
         if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(context); serializeContext != nullptr)
         {
-            serializeContext->Class<NetworkPrefabProcessor, PrefabProcessor>()->Version(1);
+            serializeContext->Class<NetworkPrefabProcessor, PrefabProcessor>()
+                ->Version(2)
+                ->Field("ServerPlatformTag", &NetworkPrefabProcessor::m_serverPlatformTag)
+                ->Field("ServerStrippedServices", &NetworkPrefabProcessor::m_serverStrippedServices);
         }
     }
 
@@ -93,7 +111,120 @@ namespace Multiplayer
         });
     }
 
-    void NetworkPrefabProcessor::ProcessPrefab(PrefabProcessorContext& context, AZStd::string_view prefabName, PrefabDom& prefab)
+    //! Removes every component providing one of the stripped services, along with any component that requires a stripped service.
+    //! Multiplayer components are never removed since they have to match across server and client, anything they require is kept.
+    //! @return the number of components removed from the entity
+    static size_t StripServerComponents(AZ::Entity& entity, const AZStd::vector<AZ::Crc32>& strippedServices)
+    {
+        struct ComponentServices
+        {
+            AZ::Component* m_component = nullptr;
+            AZ::ComponentDescriptor::DependencyArrayType m_provided;
+            AZ::ComponentDescriptor::DependencyArrayType m_required;
+            bool m_pinned = false;
+            bool m_stripped = false;
+        };
+
+        const auto containsService = [](const AZ::ComponentDescriptor::DependencyArrayType& services, AZ::ComponentServiceType service)
+        {
+            return AZStd::find(services.begin(), services.end(), service) != services.end();
+        };
+
+        AZStd::vector<ComponentServices> components;
+        components.reserve(entity.GetComponents().size());
+        for (AZ::Component* component : entity.GetComponents())
+        {
+            ComponentServices& services = components.emplace_back();
+            services.m_component = component;
+            services.m_pinned = (azrtti_cast<MultiplayerComponent*>(component) != nullptr) || (azrtti_cast<NetBindComponent*>(component) != nullptr);
+
+            AZ::ComponentDescriptor* descriptor = nullptr;
+            AZ::ComponentDescriptorBus::EventResult(descriptor, component->RTTI_GetType(), &AZ::ComponentDescriptorBus::Events::GetDescriptor);
+            if (descriptor)
+            {
+                descriptor->GetProvidedServices(services.m_provided, component);
+                descriptor->GetRequiredServices(services.m_required, component);
+            }
+
+            services.m_stripped = !services.m_pinned && AZStd::any_of(services.m_provided.begin(), services.m_provided.end(),
+                [&strippedServices](AZ::ComponentServiceType service)
+                {
+                    return AZStd::find(strippedServices.begin(), strippedServices.end(), AZ::Crc32(service)) != strippedServices.end();
+                });
+        }
+
+        // A service is lost if only stripped components provide it, services that were never provided are left for entity activation to report
+        const auto isServiceLost = [&components, &containsService](AZ::ComponentServiceType service)
+        {
+            bool providedByStripped = false;
+            for (const ComponentServices& services : components)
+            {
+                if (containsService(services.m_provided, service))
+                {
+                    if (!services.m_stripped)
+                    {
+                        return false;
+                    }
+                    providedByStripped = true;
+                }
+            }
+            return providedByStripped;
+        };
+
+        // Iterate until stable, either a component loses its dependency and is stripped too, or a pinned component restores its providers
+        bool changed = true;
+        while (changed)
+        {
+            changed = false;
+            for (ComponentServices& services : components)
+            {
+                if (services.m_stripped)
+                {
+                    continue;
+                }
+
+                for (AZ::ComponentServiceType required : services.m_required)
+                {
+                    if (!isServiceLost(required))
+                    {
+                        continue;
+                    }
+
+                    if (services.m_pinned)
+                    {
+                        for (ComponentServices& provider : components)
+                        {
+                            if (provider.m_stripped && containsService(provider.m_provided, required))
+                            {
+                                provider.m_stripped = false;
+                                provider.m_pinned = true;
+                            }
+                        }
+                    }
+                    else
+                    {
+                        services.m_stripped = true;
+                    }
+                    changed = true;
+                    break;
+                }
+            }
+        }
+
+        size_t strippedCount = 0;
+        for (ComponentServices& services : components)
+        {
+            if (services.m_stripped && entity.RemoveComponent(services.m_component))
+            {
+                delete services.m_component;
+                ++strippedCount;
+            }
+        }
+        return strippedCount;
+    }
+
+    void NetworkPrefabProcessor::ProcessPrefab(PrefabProcessorContext& context, AZStd::string_view prefabName, PrefabDom& prefab,
+        const AZStd::vector<AZ::Crc32>& serverStrippedServices)
     {
         using namespace AzToolsFramework::Prefab;
 
@@ -122,9 +253,23 @@ namespace Multiplayer
         AZStd::vector<AZ::Entity*> prefabNetEntities;
         GatherNetEntities(sourceInstance.get(), netEntityToInstanceMap, prefabNetEntities);
 
+        size_t strippedComponentCount = 0;
+        if (!serverStrippedServices.empty())
+        {
+            sourceInstance->GetAllEntitiesInHierarchy([&strippedComponentCount, &serverStrippedServices](AZStd::unique_ptr<AZ::Entity>& entity)
+            {
+                strippedComponentCount += StripServerComponents(*entity, serverStrippedServices);
+                return true;
+            });
+        }
+
         if (prefabNetEntities.empty())
         {
-            // No networked entities in the prefab, no need to do anything in this processor.
+            // No networked entities in the prefab, only store the stripped prefab if any components were removed.
+            if (strippedComponentCount > 0 && !PrefabDomUtils::StoreInstanceInPrefabDom(*sourceInstance, prefab))
+            {
+                AZ_Error("NetworkPrefabProcessor", false, "Saving server stripped Prefab Instance within a Prefab Dom failed.");
+            }
             return;
         }
 
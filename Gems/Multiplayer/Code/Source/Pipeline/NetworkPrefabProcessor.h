@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
 #include <AzToolsFramework/Prefab/Spawnable/PrefabProcessor.h>
 
 namespace AzToolsFramework::Prefab::PrefabConversionUtils
@@ -33,6 +35,14 @@ namespace Multiplayer
         static void Reflect(AZ::ReflectContext* context);
 
     protected:
-        static void ProcessPrefab(PrefabProcessorContext& context, AZStd::string_view prefabName, PrefabDom& prefab);
+        static void ProcessPrefab(PrefabProcessorContext& context, AZStd::string_view prefabName, PrefabDom& prefab,
+            const AZStd::vector<AZ::Crc32>& serverStrippedServices);
+
+        //! Platform tag identifying dedicated server asset platforms, see AssetProcessorPlatformConfig.setreg.
+        AZStd::string m_serverPlatformTag{ "server" };
+
+        //! Components providing any of these services are removed from spawnables processed for the server platform.
+        //! This keeps render, audio and UI components and the assets they reference out of dedicated server builds.
+        AZStd::vector<AZStd::string> m_serverStrippedServices;
     };
 }
@@ -163,7 +163,8 @@ namespace Multiplayer
                 const AZ::Vector3 supportNormal = controlledEntityPosition - visEntry->m_boundingVolume.GetCenter();
                 const AZ::Vector3 closestPosition = visEntry->m_boundingVolume.GetSupport(supportNormal);
                 const float gatherDistanceSquared = controlledEntityPosition.GetDistanceSq(closestPosition);
-                const float priority = (gatherDistanceSquared > 0.0f) ? 1.0f / gatherDistanceSquared : 0.0f;
+                // Entities overlapping the player are the most relevant, rather than the least
+                const float priority = 1.0f / AZStd::max(gatherDistanceSquared, 1.0f);
 
                 NetworkEntityHandle entityHandle(entryNetBindComponent, networkEntityTracker);
                 AddEntityToReplicationSet(entityHandle, priority, gatherDistanceSquared);
@@ -289,6 +290,12 @@ namespace Multiplayer
         const bool isInReplicationSet = m_replicationSet.find(entityHandle) != m_replicationSet.end();
         if (!isInReplicationSet)
         {
+            if (isQueueFull && !isBetterChoice)
+            {
+                // Don't evict a more relevant entity for this one
+                return;
+            }
+
             if (isQueueFull)  // if our set is full, then we need to remove the worst priority in our set
             {
                 ConstNetworkEntityHandle removeEnt = m_candidateQueue.top().m_entityHandle;
@@ -5,6 +5,7 @@
  *
  */
 
+#include <AzCore/Component/ComponentApplicationBus.h>
 #include <AzFramework/Components/TransformComponent.h>
 #include <AzFramework/Spawnable/Spawnable.h>
 #include <AzToolsFramework/Prefab/PrefabSystemComponentInterface.h>
@@ -16,6 +17,38 @@
 
 namespace UnitTest
 {
+    //! Stand-in for a render or audio component that dedicated servers don't need.
+    class ClientOnlyTestComponent : public AZ::Component
+    {
+    public:
+        AZ_COMPONENT(ClientOnlyTestComponent, "{5B6B8F5E-2A1C-4D0B-9D7E-3C1A4E6F8B21}");
+
+        static void Reflect(AZ::ReflectContext* context)
+        {
+            if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
+            {
+                serializeContext->Class<ClientOnlyTestComponent, AZ::Component>()->Version(1);
+            }
+        }
+
+        static void GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided)
+        {
+            provided.push_back(AZ_CRC_CE("ClientOnlyTestService"));
+        }
+
+        void Activate() override {}
+        void Deactivate() override {}
+    };
+
+    class ServerStrippingNetworkPrefabProcessor : public Multiplayer::NetworkPrefabProcessor
+    {
+    public:
+        ServerStrippingNetworkPrefabProcessor()
+        {
+            m_serverStrippedServices.push_back("ClientOnlyTestService");
+        }
+    };
+
     class PrefabProcessingTestFixture : public ::testing::Test
     {
     public:
@@ -106,4 +139,45 @@ namespace UnitTest
         EXPECT_EQ(1, AZStd::count_if(entityList.begin(), entityList.end(), countEntityCallback(netEntityName)));
     }
 
+    TEST_F(PrefabProcessingTestFixture, NetworkPrefabProcessor_ProcessPrefabForServerPlatform_ClientOnlyComponentsAreStripped)
+    {
+        using AzToolsFramework::Prefab::PrefabConversionUtils::PrefabProcessorContext;
+
+        AZStd::unique_ptr<AZ::ComponentDescriptor> clientOnlyDescriptor(ClientOnlyTestComponent::CreateDescriptor());
+        AZ::ComponentApplicationBus::Broadcast(&AZ::ComponentApplicationRequests::RegisterComponentDescriptor, clientOnlyDescriptor.get());
+
+        AZStd::vector<AZ::Entity*> entities;
+
+        const AZStd::string netEntityName = "networked_entity";
+        AZ::Entity* netEntity = CreateSourceEntity(netEntityName.c_str(), true, AZ::Transform::CreateIdentity());
+        netEntity->CreateComponent<ClientOnlyTestComponent>();
+        entities.emplace_back(netEntity);
+
+        AzToolsFramework::Prefab::PrefabDom prefabDom;
+        ConvertEntitiesToPrefab(entities, prefabDom);
+
+        const AZStd::string prefabName = "testPrefab";
+        PrefabProcessorContext prefabProcessorContext{AZ::Uuid::CreateRandom()};
+        prefabProcessorContext.SetPlatformTags({ AZ_CRC_CE("server") });
+        prefabProcessorContext.AddPrefab(prefabName, AZStd::move(prefabDom));
+
+        ServerStrippingNetworkPrefabProcessor processor;
+        processor.Process(prefabProcessorContext);
+
+        EXPECT_TRUE(prefabProcessorContext.HasCompletedSuccessfully());
+
+        const auto& processedObjects = prefabProcessorContext.GetProcessedObjects();
+        ASSERT_EQ(processedObjects.size(), 1);
+
+        // The networked entity keeps its multiplayer and transform components but loses the client only one
+        const AzFramework::Spawnable* netSpawnable = azrtti_cast<const AzFramework::Spawnable*>(&processedObjects[0].GetAsset());
+        const AzFramework::Spawnable::EntityList& entityList = netSpawnable->GetEntities();
+        ASSERT_EQ(entityList.size(), 1);
+        EXPECT_EQ(entityList[0]->GetName(), netEntityName);
+        EXPECT_NE(entityList[0]->FindComponent<Multiplayer::NetBindComponent>(), nullptr);
+        EXPECT_NE(entityList[0]->FindComponent<AzFramework::TransformComponent>(), nullptr);
+        EXPECT_EQ(entityList[0]->FindComponent<ClientOnlyTestComponent>(), nullptr);
+
+        AZ::ComponentApplicationBus::Broadcast(&AZ::ComponentApplicationRequests::UnregisterComponentDescriptor, clientOnlyDescriptor.get());
+    }
 } // namespace UnitTest
@@ -113,4 +113,29 @@ namespace UnitTest
             }
         }
     }
+
+    TEST_F(RewindableContainerTests, CustomHistorySizeArrayTest)
+    {
+        static constexpr AZStd::size_t ShortHistorySize = 4;
+        Multiplayer::RewindableArray<uint32_t, RewindableContainerSize, ShortHistorySize> test;
+        static_assert(sizeof(test) < sizeof(Multiplayer::RewindableArray<uint32_t, RewindableContainerSize>), "Shorter history should use less memory");
+
+        test.fill(0);
+        for (uint32_t idx = 0; idx < ShortHistorySize * 2; ++idx)
+        {
+            test[0] = idx;
+            Multiplayer::GetNetworkTime()->IncrementHostFrameId();
+        }
+
+        // Frames still within the history rewind exactly
+        for (uint32_t idx = ShortHistorySize; idx < ShortHistorySize * 2; ++idx)
+        {
+            Multiplayer::ScopedAlterTime time(static_cast<Multiplayer::HostFrameId>(idx), AZ::TimeMs{ 0 }, AzNetworking::InvalidConnectionId);
+            EXPECT_EQ(idx, test[0].Get());
+        }
+
+        // Anything older clamps to the oldest value still held
+        Multiplayer::ScopedAlterTime time(static_cast<Multiplayer::HostFrameId>(1), AZ::TimeMs{ 0 }, AzNetworking::InvalidConnectionId);
+        EXPECT_EQ(ShortHistorySize, test[0].Get());
+    }
 }
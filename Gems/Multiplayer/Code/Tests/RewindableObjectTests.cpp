@@ -11,6 +11,13 @@
 #include <AzCore/Console/LoggerSystemComponent.h>
 #include <AzCore/Time/TimeSystemComponent.h>
 #include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/containers/vector.h>
+
+#if defined(HAVE_BENCHMARK)
+#include <benchmark/benchmark.h>
+#endif
 
 namespace UnitTest
 {
@@ -134,3 +141,85 @@ namespace UnitTest
         }
     }
 }
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    class RewindableObjectBenchmark
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        using UnitTest::AllocatorsBenchmarkFixture::SetUp;
+        using UnitTest::AllocatorsBenchmarkFixture::TearDown;
+
+        void SetUp(benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            m_loggerComponent = AZStd::make_unique<AZ::LoggerSystemComponent>();
+            m_timeComponent = AZStd::make_unique<AZ::TimeSystemComponent>();
+            m_networkTime = AZStd::make_unique<Multiplayer::NetworkTime>();
+        }
+
+        void TearDown(benchmark::State& state) override
+        {
+            m_networkTime.reset();
+            m_timeComponent.reset();
+            m_loggerComponent.reset();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        //! Simulates a frame of writes to every object followed by a rollback over the requested number of frames,
+        //! reading back every object at each rewound frame as a resimulation would.
+        template <AZStd::size_t HistorySize>
+        void RunRollback(benchmark::State& state)
+        {
+            static constexpr uint32_t ObjectCount = 256;
+            const uint32_t rollbackFrames = aznumeric_cast<uint32_t>(AZStd::min<int64_t>(state.range(0), HistorySize - 1));
+
+            AZStd::vector<Multiplayer::RewindableObject<float, HistorySize>> objects(ObjectCount, Multiplayer::RewindableObject<float, HistorySize>(0.0f));
+            Multiplayer::INetworkTime* networkTime = Multiplayer::GetNetworkTime();
+
+            float sum = 0.0f;
+            for ([[maybe_unused]] auto _ : state)
+            {
+                networkTime->IncrementHostFrameId();
+                const Multiplayer::HostFrameId headFrame = networkTime->GetHostFrameId();
+                for (uint32_t index = 0; index < ObjectCount; ++index)
+                {
+                    objects[index] = static_cast<float>(static_cast<uint32_t>(headFrame) + index);
+                }
+
+                for (uint32_t frameOffset = rollbackFrames; frameOffset > 0; --frameOffset)
+                {
+                    Multiplayer::ScopedAlterTime time(headFrame - static_cast<Multiplayer::HostFrameId>(frameOffset), AZ::TimeMs{ 0 }, AzNetworking::InvalidConnectionId);
+                    for (uint32_t index = 0; index < ObjectCount; ++index)
+                    {
+                        sum += objects[index].Get();
+                    }
+                }
+                benchmark::DoNotOptimize(sum);
+            }
+
+            state.counters["HistoryBytes"] = static_cast<double>(sizeof(Multiplayer::RewindableObject<float, HistorySize>) * ObjectCount);
+            state.SetItemsProcessed(state.iterations() * ObjectCount * (rollbackFrames + 1));
+        }
+
+        AZStd::unique_ptr<AZ::LoggerSystemComponent> m_loggerComponent;
+        AZStd::unique_ptr<AZ::TimeSystemComponent> m_timeComponent;
+        AZStd::unique_ptr<Multiplayer::NetworkTime> m_networkTime;
+    };
+
+    BENCHMARK_DEFINE_F(RewindableObjectBenchmark, Rollback_DefaultHistory)(benchmark::State& state)
+    {
+        RunRollback<Multiplayer::RewindHistorySize>(state);
+    }
+
+    BENCHMARK_DEFINE_F(RewindableObjectBenchmark, Rollback_ShortHistory)(benchmark::State& state)
+    {
+        RunRollback<32>(state);
+    }
+
+    BENCHMARK_REGISTER_F(RewindableObjectBenchmark, Rollback_DefaultHistory)->RangeMultiplier(4)->Range(1, 64)->Unit(benchmark::kMicrosecond);
+    BENCHMARK_REGISTER_F(RewindableObjectBenchmark, Rollback_ShortHistory)->RangeMultiplier(4)->Range(1, 16)->Unit(benchmark::kMicrosecond);
+} // namespace Benchmark
+#endif // HAVE_BENCHMARK
@@ -7,11 +7,136 @@
 
 #include "LZ4Compressor.h"
 
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/sort.h>
+#include <AzCore/std/string/string.h>
+
 #include <lz4.h>
 #include <lz4hc.h>
 
 namespace MultiplayerCompression
 {
+    struct LZ4Compressor::DictionaryContext
+    {
+        AZ_CLASS_ALLOCATOR(LZ4Compressor::DictionaryContext, AZ::SystemAllocator, 0);
+
+        // A zero initialized stream is equivalent to a freshly reset one
+        LZ4_stream_t m_dictionaryStream{};
+        LZ4_stream_t m_workingStream{};
+    };
+
+    LZ4Compressor::LZ4Compressor() = default;
+
+    LZ4Compressor::LZ4Compressor(AZStd::shared_ptr<const CompressionDictionary> dictionary)
+        : m_dictionary(AZStd::move(dictionary))
+    {
+        if (m_dictionary && !m_dictionary->empty())
+        {
+            // Hashing the dictionary is the expensive part, so do it once and copy the resulting state for each packet
+            m_dictionaryContext = AZStd::make_unique<DictionaryContext>();
+            LZ4_loadDict(&m_dictionaryContext->m_dictionaryStream, reinterpret_cast<const char*>(m_dictionary->data()), aznumeric_cast<int>(m_dictionary->size()));
+        }
+    }
+
+    LZ4Compressor::~LZ4Compressor() = default;
+
+    LZ4Compressor::CompressionDictionary LZ4Compressor::TrainDictionary(const AZStd::vector<CompressionDictionary>& samples, size_t maxDictionarySize)
+    {
+        // Count how many samples contain each short byte sequence
+        constexpr size_t SegmentLength = sizeof(uint64_t);
+        struct SegmentStats
+        {
+            uint32_t m_sampleCount = 0;
+            size_t m_lastSample = 0;
+        };
+
+        auto readSegment = [](const uint8_t* data)
+        {
+            uint64_t segment = 0;
+            memcpy(&segment, data, SegmentLength);
+            return segment;
+        };
+
+        AZStd::unordered_map<uint64_t, SegmentStats> segments;
+        for (size_t sampleIndex = 0; sampleIndex < samples.size(); ++sampleIndex)
+        {
+            const CompressionDictionary& sample = samples[sampleIndex];
+            for (size_t offset = 0; offset + SegmentLength <= sample.size(); ++offset)
+            {
+                SegmentStats& stats = segments[readSegment(sample.data() + offset)];
+                if (stats.m_lastSample != sampleIndex + 1)
+                {
+                    stats.m_lastSample = sampleIndex + 1;
+                    ++stats.m_sampleCount;
+                }
+            }
+        }
+
+        auto getSampleCount = [&segments, &readSegment](const uint8_t* data)
+        {
+            auto iter = segments.find(readSegment(data));
+            return (iter != segments.end()) ? iter->second.m_sampleCount : 0;
+        };
+
+        // Gather runs of bytes covered by sequences that recur in at least two samples, scored by how often they recur
+        AZStd::unordered_map<AZStd::string, uint64_t> fragments;
+        for (const CompressionDictionary& sample : samples)
+        {
+            size_t offset = 0;
+            while (offset + SegmentLength <= sample.size())
+            {
+                if (getSampleCount(sample.data() + offset) < 2)
+                {
+                    ++offset;
+                    continue;
+                }
+
+                const size_t runStart = offset;
+                uint64_t runScore = 0;
+                while ((offset + SegmentLength <= sample.size()) && (getSampleCount(sample.data() + offset) >= 2))
+                {
+                    runScore += getSampleCount(sample.data() + offset);
+                    ++offset;
+                }
+                const size_t runEnd = offset - 1 + SegmentLength;
+                fragments[AZStd::string(reinterpret_cast<const char*>(sample.data() + runStart), runEnd - runStart)] += runScore;
+            }
+        }
+
+        AZStd::vector<AZStd::pair<uint64_t, const AZStd::string*>> rankedFragments;
+        rankedFragments.reserve(fragments.size());
+        for (const auto& fragment : fragments)
+        {
+            rankedFragments.emplace_back(fragment.second, &fragment.first);
+        }
+        AZStd::sort(rankedFragments.begin(), rankedFragments.end(), [](const auto& lhs, const auto& rhs)
+        {
+            return lhs.first > rhs.first;
+        });
+
+        // Keep the best fragments that fit, then emit them in reverse so the best end up closest to the compressed data
+        size_t dictionarySize = 0;
+        size_t selectedCount = 0;
+        for (; selectedCount < rankedFragments.size(); ++selectedCount)
+        {
+            const size_t fragmentSize = rankedFragments[selectedCount].second->size();
+            if (dictionarySize + fragmentSize > maxDictionarySize)
+            {
+                break;
+            }
+            dictionarySize += fragmentSize;
+        }
+
+        CompressionDictionary dictionary;
+        dictionary.reserve(dictionarySize);
+        for (size_t i = selectedCount; i > 0; --i)
+        {
+            const AZStd::string& fragment = *rankedFragments[i - 1].second;
+            dictionary.insert(dictionary.end(), fragment.begin(), fragment.end());
+        }
+        return dictionary;
+    }
+
     size_t LZ4Compressor::GetMaxChunkSize(size_t maxCompSize) const
     {
         return maxCompSize;
@@ -54,8 +179,20 @@ namespace MultiplayerCompression
 
         AZ_Warning("Multiplayer Compressor", compDataSize >= compWorstCaseSize, "Outbuffer size (%lu B) passed to Compress() is less than estimated worst case (%lu B)", compDataSize, compWorstCaseSize);
 
-        // Note that this returns a non-negative int so we are narrowing into a size_t here
-        compSize = LZ4_compressHC(reinterpret_cast<const char*>(uncompData), reinterpret_cast<char*>(compData), uncompSize);
+        if (m_dictionaryContext)
+        {
+            // Start from the preloaded dictionary state so every packet can reference the dictionary but not previous packets,
+            // which may have been lost or reordered. The fast compressor is used here, since preloading a high compression
+            // dictionary costs more than it gains on packet sized inputs
+            m_dictionaryContext->m_workingStream = m_dictionaryContext->m_dictionaryStream;
+            compSize = LZ4_compress_fast_continue(&m_dictionaryContext->m_workingStream, reinterpret_cast<const char*>(uncompData),
+                reinterpret_cast<char*>(compData), aznumeric_cast<int>(uncompSize), aznumeric_cast<int>(compDataSize), 1);
+        }
+        else
+        {
+            // Note that this returns a non-negative int so we are narrowing into a size_t here
+            compSize = LZ4_compressHC(reinterpret_cast<const char*>(uncompData), reinterpret_cast<char*>(compData), uncompSize);
+        }
 
         if (compSize == 0)
         {
@@ -83,7 +220,10 @@ namespace MultiplayerCompression
             return AzNetworking::CompressorError::Uninitialized;
         }
 
-        const int uncompSize = LZ4_decompress_safe(reinterpret_cast<const char*>(compData), reinterpret_cast<char*>(uncompData), compDataSize, uncompDataSize);
+        const int uncompSize = m_dictionaryContext
+            ? LZ4_decompress_safe_usingDict(reinterpret_cast<const char*>(compData), reinterpret_cast<char*>(uncompData), compDataSize, uncompDataSize,
+                reinterpret_cast<const char*>(m_dictionary->data()), aznumeric_cast<int>(m_dictionary->size()))
+            : LZ4_decompress_safe(reinterpret_cast<const char*>(compData), reinterpret_cast<char*>(uncompData), compDataSize, uncompDataSize);
         consumedSizeOut = compDataSize;
 
         if (uncompSize < 0)
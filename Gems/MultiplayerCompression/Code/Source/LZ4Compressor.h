@@ -8,6 +8,9 @@
 #pragma once
 
 #include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzNetworking/Framework/ICompressor.h>
 
 namespace MultiplayerCompression
@@ -19,6 +22,10 @@ namespace MultiplayerCompression
     * Implements an LZ4 Compressor against GridMate's Compressor interface for use with the Multiplayer Gem.
     * Handles edge and error cases specific to LZ4 that are otherwise not covered in GridMate Carrier 
     * (where a Compressor is applied). 
+    *
+    * Optionally compresses against a shared dictionary trained offline from captured traffic (see TrainDictionary).
+    * Small, repetitive packets such as entity updates compress poorly on their own, but most of their content
+    * can be referenced from the dictionary instead. Both endpoints must use the same dictionary.
     */
     class LZ4Compressor
         : public AzNetworking::ICompressor
@@ -26,7 +33,20 @@ namespace MultiplayerCompression
     public:
         AZ_CLASS_ALLOCATOR(LZ4Compressor, AZ::SystemAllocator, 0);
 
-        LZ4Compressor() = default;
+        //! Raw dictionary contents, LZ4 only references the last 64KB.
+        using CompressionDictionary = AZStd::vector<uint8_t>;
+
+        LZ4Compressor();
+        explicit LZ4Compressor(AZStd::shared_ptr<const CompressionDictionary> dictionary);
+        ~LZ4Compressor();
+
+        //! Builds a dictionary from captured, uncompressed packet payloads.
+        //! Byte sequences that recur across many samples are kept, with the most common placed last since they are closest to
+        //! the compressed data and therefore cheapest to reference.
+        //! @param samples           uncompressed packet payloads to train from
+        //! @param maxDictionarySize maximum size of the returned dictionary in bytes
+        //! @return the trained dictionary, empty if the samples had no content in common
+        static CompressionDictionary TrainDictionary(const AZStd::vector<CompressionDictionary>& samples, size_t maxDictionarySize);
 
         const char* GetName() const { return CompressorName; }
         AzNetworking::CompressorType GetType() const { return CompressorType;  };
@@ -37,5 +57,12 @@ namespace MultiplayerCompression
 
         AzNetworking::CompressorError Compress(const void* uncompData, size_t uncompSize, void* compData, size_t compDataSize, size_t& compSize);
         AzNetworking::CompressorError Decompress(const void* compData, size_t compDataSize, void* uncompData, size_t uncompDataSize, size_t& consumedSize, size_t& uncompSize);
+
+    private:
+        //! LZ4 stream state with the dictionary preloaded, kept per compressor instance and so per connection for TCP.
+        struct DictionaryContext;
+
+        AZStd::shared_ptr<const CompressionDictionary> m_dictionary;
+        AZStd::unique_ptr<DictionaryContext> m_dictionaryContext;
     };
 }
@@ -8,13 +8,54 @@
 #include "MultiplayerCompressionFactory.h"
 #include "LZ4Compressor.h"
 
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/Utils/Utils.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 
 namespace MultiplayerCompression
 {
+    AZ_CVAR(AZ::CVarFixedString, net_CompressionDictionary, "", nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "Path to a dictionary trained from captured traffic to compress packets against, empty disables dictionary compression. "
+        "Must match on both endpoints and be set before creating the network interface.");
+
+    // LZ4 only references the last 64KB of a dictionary, anything larger is almost certainly the wrong file
+    static constexpr size_t MaxDictionaryFileSize = 1024 * 1024;
+
     AZStd::unique_ptr<AzNetworking::ICompressor> MultiplayerCompressionFactory::Create()
     {
-        return AZStd::make_unique<LZ4Compressor>();
+        if (!m_dictionaryLoaded)
+        {
+            LoadDictionary();
+        }
+        return AZStd::make_unique<LZ4Compressor>(m_dictionary);
+    }
+
+    void MultiplayerCompressionFactory::LoadDictionary()
+    {
+        m_dictionaryLoaded = true;
+
+        const AZ::CVarFixedString dictionaryPath = static_cast<AZ::CVarFixedString>(net_CompressionDictionary);
+        if (dictionaryPath.empty())
+        {
+            return;
+        }
+
+        AZ::IO::FixedMaxPath resolvedPath{ AZStd::string_view(dictionaryPath) };
+        if (AZ::IO::FileIOBase* fileIo = AZ::IO::FileIOBase::GetInstance())
+        {
+            fileIo->ResolvePath(resolvedPath, AZ::IO::PathView(dictionaryPath));
+        }
+
+        auto readResult = AZ::Utils::ReadFile<LZ4Compressor::CompressionDictionary>(resolvedPath.Native(), MaxDictionaryFileSize);
+        if (!readResult.IsSuccess())
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Failed to load compression dictionary %s: %s", dictionaryPath.c_str(), readResult.GetError().c_str());
+            return;
+        }
+
+        m_dictionary = AZStd::make_shared<const LZ4Compressor::CompressionDictionary>(readResult.TakeValue());
     }
 
     AZ::Name MultiplayerCompressionFactory::GetFactoryName() const
@@ -10,6 +10,7 @@
 #include <AzCore/Component/Component.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzNetworking/Framework/ICompressor.h>
+#include "LZ4Compressor.h"
 
 namespace MultiplayerCompression
 {
@@ -26,6 +27,11 @@ namespace MultiplayerCompression
         AZ::Name GetFactoryName() const override;
 
     private:
+        //! Loads the dictionary configured by net_CompressionDictionary the first time a compressor is created.
+        void LoadDictionary();
+
         const AZ::Name m_name = AZ::Name("MultiplayerCompressor");
+        AZStd::shared_ptr<const LZ4Compressor::CompressionDictionary> m_dictionary;
+        bool m_dictionaryLoaded = false;
     };
 }
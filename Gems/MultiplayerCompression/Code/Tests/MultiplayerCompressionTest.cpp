@@ -11,6 +11,7 @@
 #include <LZ4Compressor.h>
 
 #include <AzCore/Compression/Compression.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzNetworking/DataStructures/ByteBuffer.h>
 #include <AzNetworking/Serialization/NetworkInputSerializer.h>
 #include <AzTest/AzTest.h>
@@ -126,4 +127,53 @@ TEST_F(MultiplayerCompressionTest, MultiplayerCompressionTest_NullTest)
     EXPECT_TRUE(decompressStatus == AzNetworking::CompressorError::Uninitialized);
 }
 
+TEST_F(MultiplayerCompressionTest, MultiplayerCompressionTest_DictionaryTest)
+{
+    // Build small packets that share a common layout but differ in a few bytes, similar to entity updates
+    auto makePacket = [](uint8_t variant)
+    {
+        MultiplayerCompression::LZ4Compressor::CompressionDictionary packet;
+        for (uint8_t i = 0; i < 96; ++i)
+        {
+            packet.push_back(static_cast<uint8_t>((i * 37) ^ 0x5A));
+        }
+        packet[10] = variant;
+        packet[50] = static_cast<uint8_t>(variant * 3);
+        return packet;
+    };
+
+    AZStd::vector<MultiplayerCompression::LZ4Compressor::CompressionDictionary> samples;
+    for (uint8_t i = 0; i < 16; ++i)
+    {
+        samples.push_back(makePacket(i));
+    }
+
+    auto dictionary = AZStd::make_shared<const MultiplayerCompression::LZ4Compressor::CompressionDictionary>(
+        MultiplayerCompression::LZ4Compressor::TrainDictionary(samples, 4096));
+    ASSERT_FALSE(dictionary->empty());
+    EXPECT_LE(dictionary->size(), 4096);
+
+    const MultiplayerCompression::LZ4Compressor::CompressionDictionary packet = makePacket(200);
+    char compressedBuffer[256];
+    char plainCompressedBuffer[256];
+    uint8_t decompressedBuffer[256];
+    size_t compressedSize = 0;
+    size_t plainCompressedSize = 0;
+    size_t consumedSize = 0;
+    size_t uncompressedSize = 0;
+
+    MultiplayerCompression::LZ4Compressor dictionaryCompressor(dictionary);
+    ASSERT_TRUE(dictionaryCompressor.Compress(packet.data(), packet.size(), compressedBuffer, sizeof(compressedBuffer), compressedSize) == AzNetworking::CompressorError::Ok);
+
+    MultiplayerCompression::LZ4Compressor plainCompressor;
+    ASSERT_TRUE(plainCompressor.Compress(packet.data(), packet.size(), plainCompressedBuffer, sizeof(plainCompressedBuffer), plainCompressedSize) == AzNetworking::CompressorError::Ok);
+    EXPECT_LT(compressedSize, plainCompressedSize);
+
+    // A separate instance stands in for the remote endpoint
+    MultiplayerCompression::LZ4Compressor remoteCompressor(dictionary);
+    ASSERT_TRUE(remoteCompressor.Decompress(compressedBuffer, compressedSize, decompressedBuffer, sizeof(decompressedBuffer), consumedSize, uncompressedSize) == AzNetworking::CompressorError::Ok);
+    EXPECT_EQ(uncompressedSize, packet.size());
+    EXPECT_TRUE(memcmp(decompressedBuffer, packet.data(), packet.size()) == 0);
+}
+
 AZ_UNIT_TEST_HOOK(DEFAULT_UNIT_TEST_ENV);
@@ -230,6 +230,14 @@ namespace NvCloth
         //! Width valid values are > 0.
         virtual void SetAcceleationFilterWidth(AZ::u32 width) = 0;
 
+        //! Freezes the cloth in its current state so solvers skip it, or resumes its simulation.
+        //! @note Changing colliders, constraints or transform can resume the simulation,
+        //!       freeze it again after applying those changes to keep it frozen.
+        virtual void FreezeSimulation(bool freeze) = 0;
+
+        //! Returns true if the cloth is frozen and solvers are skipping it.
+        virtual bool IsSimulationFrozen() const = 0;
+
         //! Set a list of spheres to collide with cloth's particles.
         //! x,y,z represents the position and w the radius of the sphere.
         //!
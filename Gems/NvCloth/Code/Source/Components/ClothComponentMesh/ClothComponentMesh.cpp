@@ -7,6 +7,7 @@
 
 #include <AzCore/Interface/Interface.h>
 #include <AzCore/Console/IConsole.h>
+#include <AzCore/Math/MathUtils.h>
 #include <AzCore/Math/PackedVector3.h>
 
 #include <AtomLyIntegration/CommonFeatures/Mesh/MeshComponentBus.h>
@@ -23,6 +24,7 @@
 #include <Components/ClothComponentMesh/ClothDebugDisplay.h>
 #include <Components/ClothComponentMesh/ClothComponentMesh.h>
 
+#include <AzFramework/Components/CameraBus.h>
 #include <AzFramework/Physics/PhysicsScene.h>
 #include <AzFramework/Physics/WindBus.h>
 #include <AzFramework/Physics/Common/PhysicsTypes.h>
@@ -35,6 +37,27 @@ namespace NvCloth
     AZ_CVAR(float, cloth_SecondsToDelaySimulationOnActorSpawned, 0.25f, nullptr, AZ::ConsoleFunctorFlags::Null,
         "The amount of time in seconds the cloth simulation will be delayed to avoid sudden impulses when actors are spawned.");
 
+    AZ_CVAR(bool, cloth_LodEnabled, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "When enabled cloth simulation quality and update rate are reduced with the distance to the active camera.");
+
+    AZ_CVAR(float, cloth_LodStartDistance, 10.0f, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Distance in meters to the active camera where cloth level of detail starts reducing simulation quality.");
+
+    AZ_CVAR(float, cloth_LodEndDistance, 40.0f, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Distance in meters to the active camera where cloth level of detail reaches its lowest simulation quality.");
+
+    AZ_CVAR(float, cloth_LodMinSolverFrequencyScale, 0.25f, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Scale applied to the cloth solver frequency at the lowest level of detail.");
+
+    AZ_CVAR(AZ::u32, cloth_LodMaxUpdateInterval, 4, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Number of simulation steps between collider, skinning and render data updates at the lowest level of detail.");
+
+    AZ_CVAR(float, cloth_LodFreezeDistance, 0.0f, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Distance in meters to the active camera beyond which cloth simulation is frozen. Zero disables freezing by distance.");
+
+    AZ_CVAR(bool, cloth_LodFreezeWhenNotVisible, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "When level of detail is enabled, freezes cloth simulation of actors that are not visible.");
+
     // Helper class to map an RPI buffer from a buffer asset view.
     template<typename T>
     class MappedBuffer
@@ -239,6 +262,10 @@ namespace NvCloth
         m_meshClothInfo = {};
         m_actorClothColliders.reset();
         m_actorClothSkinning.reset();
+        m_isSimulationFrozen = false;
+        m_updateThisSimulation = true;
+        m_simulationsSinceLastUpdate = 0;
+        m_solverFrequencyScale = 1.0f;
         m_clothConstraints.reset();
         m_motionConstraints.clear();
         m_separationConstraints.clear();
@@ -251,6 +278,17 @@ namespace NvCloth
     {
         AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Cloth);
 
+        if (m_actorClothSkinning)
+        {
+            m_actorClothSkinning->UpdateActorVisibility();
+        }
+
+        UpdateSimulationLod();
+        if (m_isSimulationFrozen || !m_updateThisSimulation)
+        {
+            return;
+        }
+
         UpdateSimulationCollisions();
 
         if (m_actorClothSkinning)
@@ -268,6 +306,12 @@ namespace NvCloth
     {
         AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Cloth);
 
+        // Frozen cloth hasn't changed and skipped updates keep rendering the last result
+        if (m_isSimulationFrozen || !m_updateThisSimulation)
+        {
+            return;
+        }
+
         // Next buffer index of the render data
         m_renderDataBufferIndex = (m_renderDataBufferIndex + 1) % RenderDataBufferSize;
 
@@ -321,6 +365,79 @@ namespace NvCloth
         return m_renderDataBuffer[m_renderDataBufferIndex];
     }
 
+    void ClothComponentMesh::UpdateSimulationLod()
+    {
+        if (!cloth_LodEnabled)
+        {
+            if (m_isSimulationFrozen || m_solverFrequencyScale != 1.0f)
+            {
+                m_cloth->GetClothConfigurator()->FreezeSimulation(false);
+                m_cloth->GetClothConfigurator()->SetSolverFrequency(m_config.m_solverFrequency);
+            }
+            m_isSimulationFrozen = false;
+            m_updateThisSimulation = true;
+            m_solverFrequencyScale = 1.0f;
+            return;
+        }
+
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Cloth);
+
+        float distanceToCamera = 0.0f;
+        if (Camera::ActiveCameraRequestBus::HasHandlers())
+        {
+            AZ::Transform cameraTransform = AZ::Transform::CreateIdentity();
+            Camera::ActiveCameraRequestBus::BroadcastResult(cameraTransform, &Camera::ActiveCameraRequestBus::Events::GetActiveCameraTransform);
+            distanceToCamera = cameraTransform.GetTranslation().GetDistance(m_worldPosition);
+        }
+
+        const bool wasSimulationFrozen = m_isSimulationFrozen;
+        m_isSimulationFrozen =
+            (cloth_LodFreezeDistance > 0.0f && distanceToCamera >= cloth_LodFreezeDistance) ||
+            (cloth_LodFreezeWhenNotVisible && m_actorClothSkinning && !m_actorClothSkinning->IsActorVisible());
+
+        if (m_isSimulationFrozen)
+        {
+            // Changes applied to cloth while frozen (transform, colliders) wake it up, so it's frozen again before every simulation.
+            m_cloth->GetClothConfigurator()->FreezeSimulation(true);
+            return;
+        }
+
+        if (wasSimulationFrozen)
+        {
+            // The actor kept moving while frozen, override the simulation with skinning for a short time
+            // to avoid a sudden impulse, the same way it's done when an actor becomes visible.
+            m_cloth->GetClothConfigurator()->FreezeSimulation(false);
+            m_cloth->GetClothConfigurator()->ClearInertia();
+            m_timeClothSkinningUpdates = 0.0f;
+            m_simulationsSinceLastUpdate = 0;
+        }
+
+        const float lodStartDistance = cloth_LodStartDistance;
+        const float lodRange = AZ::GetMax(static_cast<float>(cloth_LodEndDistance) - lodStartDistance, AZ::Constants::FloatEpsilon);
+        const float lodFactor = AZ::GetClamp((distanceToCamera - lodStartDistance) / lodRange, 0.0f, 1.0f);
+
+        const float solverFrequencyScale = AZ::Lerp(1.0f, AZ::GetClamp(static_cast<float>(cloth_LodMinSolverFrequencyScale), 0.0f, 1.0f), lodFactor);
+        if (!AZ::IsClose(solverFrequencyScale, m_solverFrequencyScale, 0.01f))
+        {
+            m_solverFrequencyScale = solverFrequencyScale;
+            m_cloth->GetClothConfigurator()->SetSolverFrequency(m_config.m_solverFrequency * m_solverFrequencyScale);
+        }
+
+        const AZ::u32 maxUpdateInterval = AZ::GetMax<AZ::u32>(cloth_LodMaxUpdateInterval, 1);
+        const AZ::u32 updateInterval = 1 + static_cast<AZ::u32>(lodFactor * (maxUpdateInterval - 1) + 0.5f);
+
+        // Always update while skinning overrides the simulation, skipping those updates would cause the impulse it's avoiding
+        const bool isSkinningOverridingSimulation =
+            m_actorClothSkinning && m_timeClothSkinningUpdates <= cloth_SecondsToDelaySimulationOnActorSpawned;
+
+        ++m_simulationsSinceLastUpdate;
+        m_updateThisSimulation = isSkinningOverridingSimulation || m_simulationsSinceLastUpdate >= updateInterval;
+        if (m_updateThisSimulation)
+        {
+            m_simulationsSinceLastUpdate = 0;
+        }
+    }
+
     void ClothComponentMesh::UpdateSimulationCollisions()
     {
         if (m_actorClothColliders)
@@ -354,8 +471,7 @@ namespace NvCloth
             // While the actor is not visible the skinned joints are not updated. Then when
             // it becomes visible the jump to the new skinned positions causes a sudden
             // impulse to cloth simulation. To avoid this undesired effect we will override cloth simulation during
-            // a short amount of time.
-            m_actorClothSkinning->UpdateActorVisibility();
+            // a short amount of time. Actor visibility is updated at the beginning of OnPreSimulation.
             if (!m_actorClothSkinning->WasActorVisible() &&
                 m_actorClothSkinning->IsActorVisible())
             {
@@ -722,7 +838,7 @@ namespace NvCloth
         clothConfig->SetTetherConstraintScale(m_config.m_tetherConstraintScale);
 
         // Quality parameters
-        clothConfig->SetSolverFrequency(m_config.m_solverFrequency);
+        clothConfig->SetSolverFrequency(m_config.m_solverFrequency * m_solverFrequencyScale);
         clothConfig->SetAcceleationFilterWidth(m_config.m_accelerationFilterIterations);
 
         // Fabric Phases
@@ -79,6 +79,7 @@ namespace NvCloth
         void OnWindChanged(const AZ::Aabb& aabb) override;
 
     private:
+        void UpdateSimulationLod();
         void UpdateSimulationCollisions();
         void UpdateSimulationSkinning(float deltaTime);
         void UpdateSimulationConstraints();
@@ -130,6 +131,12 @@ namespace NvCloth
         AZStd::unique_ptr<ActorClothSkinning> m_actorClothSkinning;
         float m_timeClothSkinningUpdates = 0.0f;
 
+        // Level of detail state, see cloth_Lod* console variables.
+        bool m_isSimulationFrozen = false;
+        bool m_updateThisSimulation = true;
+        AZ::u32 m_simulationsSinceLastUpdate = 0;
+        float m_solverFrequencyScale = 1.0f;
+
         // Cloth Constraints
         AZStd::unique_ptr<ClothConstraints> m_clothConstraints;
         AZStd::vector<AZ::Vector4> m_motionConstraints;
@@ -440,6 +440,24 @@ namespace NvCloth
         m_nvCloth->setAcceleationFilterWidth(width);
     }
 
+    void Cloth::FreezeSimulation(bool freeze)
+    {
+        // A sleeping cloth is skipped by NvCloth solvers until it's woken up
+        if (freeze)
+        {
+            m_nvCloth->putToSleep();
+        }
+        else
+        {
+            m_nvCloth->wakeUp();
+        }
+    }
+
+    bool Cloth::IsSimulationFrozen() const
+    {
+        return m_nvCloth->isAsleep();
+    }
+
     void Cloth::SetSphereColliders(const AZStd::vector<AZ::Vector4>& spheres)
     {
         m_nvCloth->setSpheres(
@@ -103,6 +103,8 @@ namespace NvCloth
         void SetTetherConstraintScale(float scale) override;
         void SetSolverFrequency(float frequency) override;
         void SetAcceleationFilterWidth(AZ::u32 width) override;
+        void FreezeSimulation(bool freeze) override;
+        bool IsSimulationFrozen() const override;
         void SetSphereColliders(const AZStd::vector<AZ::Vector4>& spheres) override;
         void SetSphereColliders(AZStd::vector<AZ::Vector4>&& spheres) override;
         void SetCapsuleColliders(const AZStd::vector<AZ::u32>& capsuleIndices) override;
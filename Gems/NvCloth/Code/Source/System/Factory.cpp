@@ -5,6 +5,8 @@
  *
  */
 
+#include <AzCore/Console/IConsole.h>
+
 #include <System/Factory.h>
 #include <System/Solver.h>
 #include <System/Fabric.h>
@@ -15,8 +17,16 @@
 #include <NvCloth/Range.h>
 #include <NvCloth/Factory.h>
 
+#if NV_CLOTH_ENABLE_CUDA
+#include <cuda.h>
+#endif
+
 namespace NvCloth
 {
+    AZ_CVAR(bool, cloth_GpuSolver, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "When enabled the cloth system will simulate on GPU if NvCloth was built with CUDA support, falling back to CPU otherwise. "
+        "Takes effect the next time the cloth system is initialized.");
+
     namespace
     {
         AZ::u64 ClothIdCounter = 1;
@@ -24,6 +34,16 @@ namespace NvCloth
 
     void Factory::Init()
     {
+        if (!m_nvFactory && cloth_GpuSolver)
+        {
+            if (InitGpuFactory())
+            {
+                AZ_Printf("Cloth", "NVIDIA NvCloth Gem using GPU for cloth simulation.\n");
+                return;
+            }
+            AZ_Warning("Cloth", false, "NvCloth failed to create a GPU factory, falling back to CPU.");
+        }
+
         // Create a CPU NvCloth Factory
         if (!m_nvFactory)
         {
@@ -44,6 +64,52 @@ namespace NvCloth
     void Factory::Destroy()
     {
         m_nvFactory.reset();
+
+        // The context has to outlive the factory and all the objects created from it
+        DestroyGpuContext();
+    }
+
+    bool Factory::IsUsingGpu() const
+    {
+        return m_nvFactory && m_gpuContext != nullptr;
+    }
+
+    bool Factory::InitGpuFactory()
+    {
+#if NV_CLOTH_ENABLE_CUDA
+        CUdevice device = 0;
+        CUcontext context = nullptr;
+        if (cuInit(0) != CUDA_SUCCESS ||
+            cuDeviceGet(&device, 0) != CUDA_SUCCESS ||
+            cuCtxCreate(&context, 0, device) != CUDA_SUCCESS)
+        {
+            return false;
+        }
+        m_gpuContext = context;
+
+        m_nvFactory = NvFactoryUniquePtr(NvClothCreateFactoryCUDA(context));
+        if (!m_nvFactory || !SystemComponent::CheckLastClothError())
+        {
+            m_nvFactory.reset();
+            DestroyGpuContext();
+            SystemComponent::ResetLastClothError();
+            return false;
+        }
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    void Factory::DestroyGpuContext()
+    {
+#if NV_CLOTH_ENABLE_CUDA
+        if (m_gpuContext)
+        {
+            cuCtxDestroy(static_cast<CUcontext>(m_gpuContext));
+        }
+#endif
+        m_gpuContext = nullptr;
     }
 
     AZStd::unique_ptr<Solver> Factory::CreateSolver(const AZStd::string& name)
@@ -21,7 +21,8 @@ namespace NvCloth
 
     //! This class knows how to construct Solver, Cloth and Fabric objects.
     //!
-    //! All objects constructed by this factory will run on CPU.
+    //! All objects constructed by this factory will run on CPU, unless cloth_GpuSolver
+    //! is enabled and NvCloth was built with CUDA support, in which case they will run on GPU.
     class Factory
     {
     public:
@@ -32,6 +33,9 @@ namespace NvCloth
         virtual void Init();
         virtual void Destroy();
 
+        //! Returns true if the objects constructed by this factory run on GPU.
+        bool IsUsingGpu() const;
+
         AZStd::unique_ptr<Solver> CreateSolver(const AZStd::string& name);
 
         AZStd::unique_ptr<Fabric> CreateFabric(const FabricCookedData& fabricCookedData);
@@ -41,8 +45,15 @@ namespace NvCloth
             Fabric* fabric);
 
     protected:
+        //! Tries to create a GPU NvCloth factory, returns false if it's not supported or failed.
+        bool InitGpuFactory();
+        void DestroyGpuContext();
+
         //! NvCloth factory object.
         NvFactoryUniquePtr m_nvFactory;
+
+        //! Platform context used by the GPU factory, null when running on CPU.
+        void* m_gpuContext = nullptr;
     };
 
 } // namespace NvCloth
@@ -616,4 +616,19 @@ namespace UnitTest
             EXPECT_NEAR(nvClothPreviousParticles[i].w, initialParticles[i].GetW() / globalMass, Tolerance);
         }
     }
+
+    TEST_F(NvClothSystemCloth, Cloth_ClothConfigurationFreezeSimulation_NativeClothIsAsleepUntilResumed)
+    {
+        EXPECT_FALSE(m_cloth->GetClothConfigurator()->IsSimulationFrozen());
+
+        m_cloth->GetClothConfigurator()->FreezeSimulation(true);
+
+        EXPECT_TRUE(m_cloth->GetClothConfigurator()->IsSimulationFrozen());
+        EXPECT_TRUE(m_nvCloth->isAsleep());
+
+        m_cloth->GetClothConfigurator()->FreezeSimulation(false);
+
+        EXPECT_FALSE(m_cloth->GetClothConfigurator()->IsSimulationFrozen());
+        EXPECT_FALSE(m_nvCloth->isAsleep());
+    }
 } // namespace UnitTest
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <AzCore/EBus/EBus.h>
+#include <AzCore/std/functional.h>
 #include <AzFramework/Physics/Shape.h>
 #include <AzFramework/Physics/SimulatedBodies/RigidBody.h>
 
@@ -73,6 +74,25 @@ namespace PhysX
         /// References: https://docs.nvidia.com/gameworks/content/gameworkslibrary/physx/guide/Manual/Geometry.html#triangle-meshes,
         /// https://docs.nvidia.com/gameworks/content/gameworkslibrary/physx/guide/Manual/Startup.html#cooking
         virtual physx::PxCooking* GetCooking() = 0;
+
+        /// Called on the main thread once an asynchronous cook has completed.
+        /// @param succeeded Whether cooking succeeded.
+        /// @param cookedData The cooked mesh data, empty if cooking failed.
+        using CookedMeshCallback = AZStd::function<void(bool succeeded, AZStd::vector<AZ::u8>&& cookedData)>;
+
+        /// Cooks a convex mesh to a memory buffer on a job thread.
+        /// Results are shared through the cooked mesh cache, so identical meshes are only cooked once.
+        /// @param vertices The vertex data, owned by the cooking job until it completes.
+        /// @param callback Invoked on the main thread with the result.
+        virtual void CookConvexMeshToMemoryAsync(AZStd::vector<AZ::Vector3> vertices, CookedMeshCallback callback) = 0;
+
+        /// Cooks a triangle mesh to a memory buffer on a job thread.
+        /// Results are shared through the cooked mesh cache, so identical meshes are only cooked once.
+        /// @param vertices The vertex data, owned by the cooking job until it completes.
+        /// @param indices The index data, owned by the cooking job until it completes.
+        /// @param callback Invoked on the main thread with the result.
+        virtual void CookTriangleMeshToMemoryAsync(AZStd::vector<AZ::Vector3> vertices, AZStd::vector<AZ::u32> indices,
+            CookedMeshCallback callback) = 0;
     };
 
     using SystemRequestsBus = AZ::EBus<SystemRequests>;
@@ -6,6 +6,7 @@
  */
 
 #include <AzCore/std/limits.h>
+#include <AzCore/std/containers/small_vector.h>
 #include <Common/PhysXSceneQueryHelpers.h>
 #include <PhysX/MathConversion.h>
 #include <PhysX/PhysXLocks.h>
@@ -156,7 +157,7 @@ namespace PhysX
             float closestHitDistance = FLT_MAX;
 
             int numShapes = actor->getNbShapes();
-            AZStd::vector<physx::PxShape*> shapes(numShapes);
+            AZStd::small_vector<physx::PxShape*, 8> shapes(numShapes);
             actor->getShapes(shapes.data(), numShapes);
 
             {
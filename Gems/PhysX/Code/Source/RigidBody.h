@@ -101,6 +101,9 @@ namespace PhysX
 
         bool ShouldStartAsleep() const { return m_startAsleep; }
 
+        //! True if the scene writes this body's simulated pose back to its entity in bulk, instead of the owning RigidBodyComponent.
+        bool UsesBulkTransformWriteBack() const { return m_bulkTransformWriteBack; }
+
         void SetName(const AZStd::string& entityName);
         const AZStd::string& GetName() const;
 
@@ -125,6 +128,7 @@ namespace PhysX
         AZStd::string m_name;
         PhysX::ActorData m_actorUserData;
         bool m_startAsleep = false;
+        bool m_bulkTransformWriteBack = false;
     };
 
     AZ_POP_DISABLE_WARNING
@@ -8,11 +8,13 @@
 #include <PhysX_precompiled.h>
 
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Math/Transform.h>
 #include <AzFramework/Physics/Utils.h>
 #include <AzFramework/Entity/GameEntityContextBus.h>
 #include <AzFramework/Physics/PhysicsScene.h>
+#include <AzFramework/Physics/PhysicsSystem.h>
 #include <AzFramework/Physics/SystemBus.h>
 #include <AzFramework/Physics/Common/PhysicsSimulatedBody.h>
 #include <PhysX/ColliderComponentBus.h>
@@ -23,7 +25,9 @@
 
 namespace PhysX
 {
-
+    AZ_CVAR(bool, physx_bulkTransformWriteBack, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "If true, rigid bodies created in scenes with active actors enabled have their simulated pose written back to the entity by the scene "
+        "in a single pass over the active actors, instead of every rigid body component updating its entity after each simulation step.");
 
     void RigidBodyComponent::Reflect(AZ::ReflectContext* context)
     {
@@ -229,6 +233,12 @@ namespace PhysX
             return;
         }
 
+        // The scene already wrote back the pose of the body if it moved, see PhysXScene::WriteBackActiveBodyTransforms
+        if (m_bulkTransformWriteBack && !IsKinematic())
+        {
+            return;
+        }
+
         auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
         if (sceneInterface == nullptr)
         {
@@ -297,6 +307,20 @@ namespace PhysX
         {
             m_configuration.m_startSimulationEnabled = false; //enable physics will enable this when called.
             m_rigidBodyHandle = sceneInterface->AddSimulatedBody(m_attachedSceneHandle, &m_configuration);
+
+            // The bulk write back only visits active actors and doesn't interpolate, other bodies keep updating their entity here
+            m_bulkTransformWriteBack = false;
+            if (physx_bulkTransformWriteBack && !m_configuration.m_interpolateMotion)
+            {
+                auto* physicsSystem = AZ::Interface<AzPhysics::SystemInterface>::Get();
+                AzPhysics::Scene* scene = physicsSystem ? physicsSystem->GetScene(m_attachedSceneHandle) : nullptr;
+                auto* rigidBody = azdynamic_cast<PhysX::RigidBody*>(GetRigidBody());
+                if (scene && scene->GetConfiguration().m_enableActiveActors && rigidBody)
+                {
+                    rigidBody->m_bulkTransformWriteBack = true;
+                    m_bulkTransformWriteBack = true;
+                }
+            }
         }
 
         // Listen to the PhysX system for events concerning this entity.
@@ -8,9 +8,14 @@
 
 #include <Scene/PhysXScene.h>
 
+#include <AzCore/Component/TransformBus.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Debug/ProfilerBus.h>
+#include <AzCore/Jobs/Algorithms.h>
+#include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/std/containers/variant.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/thread.h>
 #include <AzFramework/Physics/Character.h>
 #include <AzFramework/Physics/Collision/CollisionEvents.h>
 #include <AzFramework/Physics/Configuration/RigidBodyConfiguration.h>
@@ -25,10 +30,15 @@
 #include <PhysX/Utils.h>
 #include <PhysXCharacters/API/CharacterController.h>
 #include <PhysXCharacters/API/CharacterUtils.h>
+#include <System/PhysXCpuDispatcher.h>
 #include <System/PhysXSystem.h>
 
 namespace PhysX
 {
+    AZ_CVAR(AZ::u32, physx_sceneWorkerBudget, 0, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Number of job worker threads each newly created scene may run its simulation tasks on, 0 allows every worker. "
+        "Scenes get neighbouring blocks of workers, so many small scenes simulated in parallel spread over the whole pool.");
+
     AZ_CLASS_ALLOCATOR_IMPL(PhysXScene, AZ::SystemAllocator, 0);
 
     /*static*/ thread_local AZStd::vector<physx::PxRaycastHit> PhysXScene::s_rayCastBuffer;
@@ -37,9 +47,34 @@ namespace PhysX
 
     namespace Internal
     {
+        //! Number of requests each job processes when a query batch is split across job threads.
+        //! Batches with fewer than two chunks worth of requests are processed on the calling thread.
+        static constexpr size_t BatchQueryJobChunkSize = 16;
+
+        //! Builds the worker affinity mask for a scene with a limited worker budget.
+        //! @return The mask, or AZ::JobAnyWorkerAffinityMask if the budget covers every worker.
+        AZ::u64 GetSceneWorkerAffinityMask(AzPhysics::SceneIndex sceneIndex, AZ::u32 workerBudget)
+        {
+            AZ::JobContext* jobContext = AZ::JobContext::GetGlobalContext();
+            const AZ::u32 numWorkers = jobContext ? AZStd::min(jobContext->GetJobManager().GetNumWorkerThreads(), 64u) : 0;
+            if (workerBudget == 0 || workerBudget >= numWorkers)
+            {
+                return AZ::JobAnyWorkerAffinityMask;
+            }
+
+            const AZ::u32 firstWorker = (aznumeric_cast<AZ::u32>(sceneIndex) * workerBudget) % numWorkers;
+            AZ::u64 workerMask = 0;
+            for (AZ::u32 i = 0; i < workerBudget; ++i)
+            {
+                workerMask |= static_cast<AZ::u64>(1) << ((firstWorker + i) % numWorkers);
+            }
+            return workerMask;
+        }
+
         physx::PxScene* CreatePxScene(const AzPhysics::SceneConfiguration& config,
             SceneSimulationFilterCallback* filterCallback,
-            SceneSimulationEventCallback* simEventCallback)
+            SceneSimulationEventCallback* simEventCallback,
+            physx::PxCpuDispatcher* cpuDispatcher)
         {
             const physx::PxTolerancesScale tolerancesScale = physx::PxTolerancesScale();
             physx::PxSceneDesc sceneDesc(tolerancesScale);
@@ -101,7 +136,21 @@ namespace PhysX
 
             if (auto* physXSystem = GetPhysXSystem())
             {
-                sceneDesc.cpuDispatcher = physXSystem->GetPxCpuDispathcher();
+                sceneDesc.cpuDispatcher = cpuDispatcher ? cpuDispatcher : physXSystem->GetPxCpuDispathcher();
+
+                // The CPU dispatcher is still required with GPU dynamics, it runs the parts of the pipeline that stay on the CPU
+                if (config.m_enableGpuDynamics)
+                {
+                    if (physx::PxCudaContextManager* cudaContextManager = physXSystem->GetPxCudaContextManager())
+                    {
+                        sceneDesc.cudaContextManager = cudaContextManager;
+                        sceneDesc.flags |= physx::PxSceneFlag::eENABLE_GPU_DYNAMICS;
+                        sceneDesc.broadPhaseType = physx::PxBroadPhaseType::eGPU;
+
+                        // GPU rigid bodies only support the persistent contact manifold narrow phase
+                        sceneDesc.flags |= physx::PxSceneFlag::eENABLE_PCM;
+                    }
+                }
                 if (physx::PxScene * pxScene = physXSystem->GetPxPhysics()->createScene(sceneDesc))
                 {
                     if (physx::PxPvdSceneClient* pvdClient = pxScene->getScenePvdClient())
@@ -465,7 +514,17 @@ namespace PhysX
         PhysXScene::s_sweepBuffer = {};
         PhysXScene::s_overlapBuffer = {};
 
-        m_pxScene = Internal::CreatePxScene(m_config, &m_collisionFilterCallback, &m_simulationEventCallback);
+#if !defined(AZ_PLATFORM_LINUX)
+        // Scenes with a worker budget get their own dispatcher, Linux uses the PhysX default dispatcher, see PhysXSystem::InitializePhysXSdk
+        const AZ::u64 workerAffinityMask =
+            Internal::GetSceneWorkerAffinityMask(AZStd::get<AzPhysics::HandleTypeIndex::Index>(m_sceneHandle), physx_sceneWorkerBudget);
+        if (workerAffinityMask != AZ::JobAnyWorkerAffinityMask)
+        {
+            m_cpuDispatcher.reset(PhysXCpuDispatcherCreate(workerAffinityMask));
+        }
+#endif
+
+        m_pxScene = Internal::CreatePxScene(m_config, &m_collisionFilterCallback, &m_simulationEventCallback, m_cpuDispatcher.get());
         AZ_Assert(m_pxScene != nullptr, "PhysX::Scene creation failed.");
 
         m_pxScene->userData = this;
@@ -477,6 +536,12 @@ namespace PhysX
     {
         m_physicsSystemConfigChanged.Disconnect();
 
+        // Async queries are running on job threads against this scene, they have to finish before anything is released
+        while (m_pendingAsyncQueries.load() > 0)
+        {
+            AZStd::this_thread::yield();
+        }
+
         for (auto& simulatedBody : m_simulatedBodies)
         {
             if (simulatedBody.second != nullptr)
@@ -568,16 +633,27 @@ namespace PhysX
             physx::PxActor** activeActors = m_pxScene->getActiveActors(numActiveActors);
             AzPhysics::SimulatedBodyHandleList activeBodyHandles;
             activeBodyHandles.reserve(numActiveActors);
+            m_activeBodyTransforms.clear();
             for (physx::PxU32 i = 0; i < numActiveActors; ++i)
             {
                 if (ActorData* actorData = Utils::GetUserData(activeActors[i]))
                 {
                     activeBodyHandles.emplace_back(actorData->GetBodyHandle());
+
+                    // Read the poses for the bulk write back while the scene is locked once, instead of once per rigid body component
+                    auto* rigidBody = azdynamic_cast<RigidBody*>(actorData->GetRigidBody());
+                    if (rigidBody && rigidBody->UsesBulkTransformWriteBack() && !rigidBody->IsKinematic())
+                    {
+                        const physx::PxTransform pose = static_cast<physx::PxRigidActor*>(activeActors[i])->getGlobalPose();
+                        m_activeBodyTransforms.push_back({ actorData->GetEntityId(), PxMathConvert(pose.q), PxMathConvert(pose.p) });
+                    }
                 }
             }
             m_sceneActiveSimulatedBodies.Signal(m_sceneHandle, activeBodyHandles);
         }
 
+        WriteBackActiveBodyTransforms();
+
         FlushQueuedEvents();
         ClearDeferedDeletions();
 
@@ -589,6 +665,29 @@ namespace PhysX
         UpdateAzProfilerDataPoints();
     }
 
+    void PhysXScene::WriteBackActiveBodyTransforms()
+    {
+        if (m_activeBodyTransforms.empty())
+        {
+            return;
+        }
+
+        AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::Physics, "PhysXScene::WriteBackActiveBodyTransforms");
+
+        // Each entity gets a single world transform update which keeps its scale, rather than separate rotation and translation updates
+        for (const ActiveBodyTransform& bodyTransform : m_activeBodyTransforms)
+        {
+            if (AZ::TransformInterface* transformInterface = AZ::TransformBus::FindFirstHandler(bodyTransform.m_entityId))
+            {
+                AZ::Transform worldTransform = transformInterface->GetWorldTM();
+                worldTransform.SetRotation(bodyTransform.m_orientation);
+                worldTransform.SetTranslation(bodyTransform.m_position);
+                transformInterface->SetWorldTM(worldTransform);
+            }
+        }
+        m_activeBodyTransforms.clear();
+    }
+
     void PhysXScene::FlushQueuedEvents()
     {
         //send queued trigger events
@@ -845,12 +944,27 @@ namespace PhysX
 
     AzPhysics::SceneQueryHitsList PhysXScene::QuerySceneBatch(const AzPhysics::SceneQueryRequests& requests)
     {
-        AzPhysics::SceneQueryHitsList results;
-        results.reserve(requests.size());
-        for (auto& request : requests)
+        AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::Physics, "PhysXScene::QuerySceneBatch");
+
+        AzPhysics::SceneQueryHitsList results(requests.size());
+        AZ::JobContext* jobContext = AZ::JobContext::GetGlobalContext();
+        if (jobContext == nullptr || requests.size() < Internal::BatchQueryJobChunkSize * 2)
         {
-            results.emplace_back(QueryScene(request.get()));
+            for (size_t i = 0; i < requests.size(); ++i)
+            {
+                results[i] = QueryScene(requests[i].get());
+            }
+            return results;
         }
+
+        // Scene queries only take the shared scene read lock and use thread local hit buffers, so chunks of the batch can run
+        // concurrently. Each request writes to its own slot, keeping the results in the same order as the requests.
+        AZ::parallel_for(size_t(0), requests.size(),
+            [this, &requests, &results](size_t index)
+            {
+                results[index] = QueryScene(requests[index].get());
+            },
+            AZ::simple_partitioner(Internal::BatchQueryJobChunkSize), jobContext);
         return results;
     }
 
@@ -861,11 +975,26 @@ namespace PhysX
         return false;
     }
 
-    [[nodiscard]] bool PhysXScene::QuerySceneAsyncBatch([[maybe_unused]] AzPhysics::SceneQuery::AsyncRequestId requestId,
-        [[maybe_unused]] const AzPhysics::SceneQueryRequests& requests, [[maybe_unused]] AzPhysics::SceneQuery::AsyncBatchCallback callback)
+    [[nodiscard]] bool PhysXScene::QuerySceneAsyncBatch(AzPhysics::SceneQuery::AsyncRequestId requestId,
+        const AzPhysics::SceneQueryRequests& requests, AzPhysics::SceneQuery::AsyncBatchCallback callback)
     {
-        AZ_Warning("Physx", false, "Currently unimplemented."); // LYN-2306
-        return false;
+        AZ::JobContext* jobContext = AZ::JobContext::GetGlobalContext();
+        if (jobContext == nullptr || !callback)
+        {
+            return false;
+        }
+
+        // The requests are shared pointers so the copy keeps them alive until the job is done, the callback runs on the job thread.
+        ++m_pendingAsyncQueries;
+        AZ::Job* job = AZ::CreateJobFunction(
+            [this, requestId, requests, callback = AZStd::move(callback)]()
+            {
+                callback(requestId, QuerySceneBatch(requests));
+                --m_pendingAsyncQueries;
+            },
+            true, jobContext);
+        job->Start();
+        return true;
     }
 
     void PhysXScene::SuppressCollisionEvents(
@@ -6,6 +6,8 @@
  */
 #pragma once
 
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzFramework/Physics/PhysicsScene.h>
 #include <AzFramework/Physics/Common/PhysicsEvents.h>
 #include <AzFramework/Physics/Common/PhysicsSimulatedBody.h>
@@ -21,6 +23,8 @@ namespace physx
 
 namespace PhysX
 {
+    class PhysXCpuDispatcher;
+
     //! PhysX implementation of the AzPhysics::Scene.
     class PhysXScene
         : public AzPhysics::Scene
@@ -74,6 +78,7 @@ namespace PhysX
         void DisableSimulationOfBodyInternal(AzPhysics::SimulatedBody& body);
 
         void FlushQueuedEvents();
+        void WriteBackActiveBodyTransforms();
         void ClearDeferedDeletions();
         void ProcessTriggerEvents();
         void ProcessCollisionEvents();
@@ -87,6 +92,15 @@ namespace PhysX
 
         AZStd::vector<AZStd::pair<AZ::Crc32, AzPhysics::SimulatedBody*>> m_simulatedBodies; //this will become a SimulatedBody with LYN-1334
         AZStd::vector<AzPhysics::SimulatedBody*> m_deferredDeletions;
+
+        //! Simulated pose of an active rigid body that uses the bulk transform write back.
+        struct ActiveBodyTransform
+        {
+            AZ::EntityId m_entityId;
+            AZ::Quaternion m_orientation;
+            AZ::Vector3 m_position;
+        };
+        AZStd::vector<ActiveBodyTransform> m_activeBodyTransforms; //!< Poses gathered from the active actors after each simulation step.
         AZStd::queue<AzPhysics::SimulatedBodyIndex> m_freeSceneSlots;
 
         AzPhysics::SystemEvents::OnConfigurationChangedEvent::Handler m_physicsSystemConfigChanged;
@@ -97,10 +111,12 @@ namespace PhysX
         AZ::u64 m_raycastBufferSize = 32; //!< Maximum number of hits that will be returned from a raycast.
         AZ::u64 m_shapecastBufferSize = 32; //!< Maximum number of hits that can be returned from a shapecast.
         AZ::u64 m_overlapBufferSize = 32; //!< Maximum number of overlaps that can be returned from an overlap query.
+        AZStd::atomic<AZ::u32> m_pendingAsyncQueries{ 0 }; //!< Number of async query batches still running on job threads.
 
         SceneSimulationFilterCallback m_collisionFilterCallback; //!< Handles the filtering of collision pairs reported from PhysX.
         SceneSimulationEventCallback m_simulationEventCallback; //!< Handles the collision and trigger events reported from PhysX.
         physx::PxScene* m_pxScene = nullptr; //!< The physx scene
+        AZStd::unique_ptr<PhysXCpuDispatcher> m_cpuDispatcher; //!< Dispatcher limited to the scene's worker budget, the system dispatcher is used when null.
         physx::PxControllerManager* m_controllerManager = nullptr; //!< The physx controller manager
 
         AZ::Vector3 m_gravity; // cache the gravity of the scene to avoid a lock in GetGravity().
@@ -11,20 +11,45 @@
 
 namespace PhysX
 {
-    PhysXCpuDispatcher* PhysXCpuDispatcherCreate()
+    PhysXCpuDispatcher* PhysXCpuDispatcherCreate(AZ::u64 workerAffinityMask)
+    {
+        return aznew PhysXCpuDispatcher(workerAffinityMask);
+    }
+
+    PhysXCpuDispatcher::PhysXCpuDispatcher(AZ::u64 workerAffinityMask)
+        : m_workerAffinityMask(workerAffinityMask)
     {
-        return aznew PhysXCpuDispatcher();
     }
 
     void PhysXCpuDispatcher::submitTask(physx::PxBaseTask& task)
     {
         auto azJob = aznew PhysXJob(task);
+        azJob->SetPriorityClass(AZ::JobPriorityClass::Critical);
+        if (m_workerAffinityMask != AZ::JobAnyWorkerAffinityMask)
+        {
+            azJob->SetWorkerAffinityMask(m_workerAffinityMask);
+        }
         azJob->Start();
     }
 
     physx::PxU32 PhysXCpuDispatcher::getWorkerCount() const
     {
-        return AZ::JobContext::GetGlobalContext()->GetJobManager().GetNumWorkerThreads();
+        const AZ::u32 numWorkers = AZ::JobContext::GetGlobalContext()->GetJobManager().GetNumWorkerThreads();
+        if (m_workerAffinityMask == AZ::JobAnyWorkerAffinityMask)
+        {
+            return numWorkers;
+        }
+
+        // PhysX sizes its task splits by this count, so only report the workers the tasks can actually run on
+        physx::PxU32 allowedWorkers = 0;
+        for (AZ::u32 workerIndex = 0; workerIndex < numWorkers && workerIndex < 64; ++workerIndex)
+        {
+            if (m_workerAffinityMask & (static_cast<AZ::u64>(1) << workerIndex))
+            {
+                ++allowedWorkers;
+            }
+        }
+        return allowedWorkers;
     }
 } // namespace PhysX
 
@@ -7,26 +7,32 @@
 
 #pragma once
 #include <PxPhysicsAPI.h>
+#include <AzCore/Jobs/JobManagerDesc.h>
 #include <System/PhysXAllocator.h>
 
 namespace PhysX
 {
     //! CPU dispatcher which directs tasks submitted by PhysX to the Open 3D Engine scheduling system.
+    //! Tasks run in the critical priority class so simulation isn't held up by normal and background jobs.
     class PhysXCpuDispatcher
         : public physx::PxCpuDispatcher
     {
     public:
         AZ_CLASS_ALLOCATOR(PhysXCpuDispatcher, PhysXAllocator, 0);
 
-        PhysXCpuDispatcher() = default;
+        //! @param workerAffinityMask Job worker threads the tasks are allowed to run on, see AZ::Job::SetWorkerAffinityMask.
+        explicit PhysXCpuDispatcher(AZ::u64 workerAffinityMask = AZ::JobAnyWorkerAffinityMask);
         ~PhysXCpuDispatcher() = default;
         
     private:
         // PxCpuDispatcher implementation
         void submitTask(physx::PxBaseTask& task) override;
         physx::PxU32 getWorkerCount() const override;
+
+        AZ::u64 m_workerAffinityMask = AZ::JobAnyWorkerAffinityMask;
     };
 
     //! Creates a CPU dispatcher which directs tasks submitted by PhysX to the Open 3D Engine scheduling system.
-    PhysXCpuDispatcher* PhysXCpuDispatcherCreate();
+    //! @param workerAffinityMask Job worker threads the tasks are allowed to run on, all workers by default.
+    PhysXCpuDispatcher* PhysXCpuDispatcherCreate(AZ::u64 workerAffinityMask = AZ::JobAnyWorkerAffinityMask);
 } // namespace PhysX
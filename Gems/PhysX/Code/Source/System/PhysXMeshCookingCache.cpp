@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <PhysX_precompiled.h>
+#include <System/PhysXMeshCookingCache.h>
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/Utils/Utils.h>
+
+namespace PhysX
+{
+    AZ_CVAR(bool, physx_meshCookingDiskCache, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "If enabled, meshes cooked at run-time are persisted under @user@ and reused in later sessions.");
+    AZ_CVAR(AZ::u32, physx_meshCookingCacheBudgetKb, 32 * 1024, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Maximum size in kilobytes of cooked mesh data kept in memory, the in-memory cache is flushed once exceeded.");
+
+    namespace Internal
+    {
+        constexpr const char* MeshCookingCacheFolder = "@user@/PhysX/MeshCookingCache";
+        constexpr size_t MaxCachedMeshFileSize = 64 * 1024 * 1024;
+
+        // 64 bit FNV-1a, continued from the provided hash so several buffers can feed a single key.
+        // Unlike AZStd::hash the result is stable between runs, which the disk cache relies on.
+        AZ::u64 HashBytes(AZ::u64 hash, const void* data, size_t size)
+        {
+            constexpr AZ::u64 fnvPrime = 1099511628211ULL;
+            const AZ::u8* bytes = static_cast<const AZ::u8*>(data);
+            for (size_t i = 0; i < size; ++i)
+            {
+                hash ^= bytes[i];
+                hash *= fnvPrime;
+            }
+            return hash;
+        }
+
+        template<typename T>
+        AZ::u64 HashValue(AZ::u64 hash, const T& value)
+        {
+            return HashBytes(hash, &value, sizeof(T));
+        }
+
+        // Returns the file IO to use for the disk cache, or null if it's disabled or there's no user folder to write to.
+        AZ::IO::FileIOBase* GetDiskCacheFileIO()
+        {
+            AZ::IO::FileIOBase* fileIo = AZ::IO::FileIOBase::GetInstance();
+            if (!physx_meshCookingDiskCache || fileIo == nullptr || fileIo->GetAlias("@user@") == nullptr)
+            {
+                return nullptr;
+            }
+            return fileIo;
+        }
+    } // namespace Internal
+
+    AZ::u64 MeshCookingCache::ComputeMeshHash(MeshType meshType, const AZ::Vector3* vertices, AZ::u32 vertexCount,
+        const AZ::u32* indices, AZ::u32 indexCount, const physx::PxCookingParams& cookingParams)
+    {
+        AZ::u64 hash = 14695981039346656037ULL;
+
+        // Cooked data is only valid for the SDK version and cooking params it was produced with
+        hash = Internal::HashValue(hash, static_cast<AZ::u32>(PX_PHYSICS_VERSION));
+        hash = Internal::HashValue(hash, static_cast<AZ::u32>(meshType));
+        hash = Internal::HashValue(hash, cookingParams.areaTestEpsilon);
+        hash = Internal::HashValue(hash, cookingParams.planeTolerance);
+        hash = Internal::HashValue(hash, static_cast<AZ::u32>(cookingParams.convexMeshCookingType));
+        hash = Internal::HashValue(hash, static_cast<AZ::u32>(cookingParams.meshPreprocessParams));
+        hash = Internal::HashValue(hash, cookingParams.meshWeldTolerance);
+        hash = Internal::HashValue(hash, static_cast<AZ::u32>(cookingParams.midphaseDesc.getType()));
+        hash = Internal::HashValue(hash, cookingParams.gaussMapLimit);
+        hash = Internal::HashValue(hash, cookingParams.buildGPUData);
+        hash = Internal::HashValue(hash, cookingParams.scale.length);
+
+        // AZ::Vector3 may be padded, only the components take part in the key
+        hash = Internal::HashValue(hash, vertexCount);
+        for (AZ::u32 i = 0; i < vertexCount; ++i)
+        {
+            hash = Internal::HashValue(hash, vertices[i].GetX());
+            hash = Internal::HashValue(hash, vertices[i].GetY());
+            hash = Internal::HashValue(hash, vertices[i].GetZ());
+        }
+
+        hash = Internal::HashValue(hash, indexCount);
+        if (indices && indexCount > 0)
+        {
+            hash = Internal::HashBytes(hash, indices, indexCount * sizeof(AZ::u32));
+        }
+
+        return hash;
+    }
+
+    bool MeshCookingCache::Find(AZ::u64 meshHash, CookedData& result)
+    {
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            auto entry = m_entries.find(meshHash);
+            if (entry != m_entries.end())
+            {
+                result = entry->second;
+                return true;
+            }
+        }
+
+        AZ::IO::FileIOBase* fileIo = Internal::GetDiskCacheFileIO();
+        if (fileIo == nullptr)
+        {
+            return false;
+        }
+
+        const AZStd::string cachePath = GetDiskCachePath(meshHash);
+        if (!fileIo->Exists(cachePath.c_str()))
+        {
+            return false;
+        }
+
+        auto readResult = AZ::Utils::ReadFile<CookedData>(cachePath, Internal::MaxCachedMeshFileSize);
+        if (!readResult.IsSuccess())
+        {
+            AZ_Warning("PhysX", false, "Failed to read cooked mesh cache entry %s: %s", cachePath.c_str(), readResult.GetError().c_str());
+            return false;
+        }
+
+        result = readResult.TakeValue();
+        StoreInMemory(meshHash, result);
+        return true;
+    }
+
+    void MeshCookingCache::Store(AZ::u64 meshHash, const CookedData& cookedData)
+    {
+        if (cookedData.empty())
+        {
+            return;
+        }
+
+        StoreInMemory(meshHash, cookedData);
+
+        AZ::IO::FileIOBase* fileIo = Internal::GetDiskCacheFileIO();
+        if (fileIo == nullptr)
+        {
+            return;
+        }
+
+        fileIo->CreatePath(Internal::MeshCookingCacheFolder);
+
+        // Write to a temporary file first so a concurrent reader never sees a partially written entry
+        const AZStd::string cachePath = GetDiskCachePath(meshHash);
+        const AZStd::string tempPath = cachePath + ".tmp";
+        {
+            AZ::IO::FileIOStream stream(tempPath.c_str(), AZ::IO::OpenMode::ModeWrite | AZ::IO::OpenMode::ModeBinary);
+            if (!stream.IsOpen() || stream.Write(cookedData.size(), cookedData.data()) != cookedData.size())
+            {
+                AZ_Warning("PhysX", false, "Failed to write cooked mesh cache entry %s", tempPath.c_str());
+                return;
+            }
+        }
+
+        fileIo->Remove(cachePath.c_str());
+        fileIo->Rename(tempPath.c_str(), cachePath.c_str());
+    }
+
+    void MeshCookingCache::Clear()
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        m_entries.clear();
+        m_memoryUsage = 0;
+    }
+
+    size_t MeshCookingCache::GetMemoryUsage() const
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        return m_memoryUsage;
+    }
+
+    AZStd::string MeshCookingCache::GetDiskCachePath(AZ::u64 meshHash) const
+    {
+        return AZStd::string::format("%s/%016llx.pxcooked", Internal::MeshCookingCacheFolder, static_cast<unsigned long long>(meshHash));
+    }
+
+    void MeshCookingCache::StoreInMemory(AZ::u64 meshHash, const CookedData& cookedData)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+
+        const size_t budget = static_cast<size_t>(static_cast<AZ::u32>(physx_meshCookingCacheBudgetKb)) * 1024;
+        if (m_memoryUsage + cookedData.size() > budget)
+        {
+            // Entries are cheap to restore from the disk cache, so a full flush is preferred over tracking usage order
+            m_entries.clear();
+            m_memoryUsage = 0;
+            if (cookedData.size() > budget)
+            {
+                return;
+            }
+        }
+
+        auto insertResult = m_entries.emplace(meshHash, cookedData);
+        if (insertResult.second)
+        {
+            m_memoryUsage += cookedData.size();
+        }
+    }
+} // namespace PhysX
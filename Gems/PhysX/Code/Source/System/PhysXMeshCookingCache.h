@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <PxPhysicsAPI.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/string/string.h>
+#include <AzFramework/Physics/ShapeConfiguration.h>
+
+namespace PhysX
+{
+    //! Content addressed cache of cooked PhysX mesh data.
+    //! Meshes are keyed by a hash of their vertices, indices, mesh type and the cooking params used, so identical
+    //! geometry built at run-time (procedural or player placed pieces) is only cooked once.
+    //! Entries are kept in memory and, when physx_meshCookingDiskCache is enabled, persisted under @user@ so they
+    //! survive between sessions. All functions are safe to call from job threads.
+    class MeshCookingCache
+    {
+    public:
+        using MeshType = Physics::CookedMeshShapeConfiguration::MeshType;
+        using CookedData = AZStd::vector<AZ::u8>;
+
+        //! Computes the cache key for a mesh.
+        //! @param meshType Whether the mesh will be cooked as a convex or a triangle mesh.
+        //! @param vertices Pointer to beginning of vertex data.
+        //! @param vertexCount Number of vertices in the mesh.
+        //! @param indices Pointer to beginning of index data, may be null for convex meshes.
+        //! @param indexCount Number of indices in the mesh.
+        //! @param cookingParams The params the mesh will be cooked with.
+        //! @return Hash of the mesh content.
+        static AZ::u64 ComputeMeshHash(MeshType meshType, const AZ::Vector3* vertices, AZ::u32 vertexCount,
+            const AZ::u32* indices, AZ::u32 indexCount, const physx::PxCookingParams& cookingParams);
+
+        //! Looks up cooked data, checking the in-memory cache first and then the disk cache.
+        //! @param meshHash The key returned by ComputeMeshHash.
+        //! @param result Receives the cooked data on success.
+        //! @return True if the mesh was found in the cache.
+        bool Find(AZ::u64 meshHash, CookedData& result);
+
+        //! Adds cooked data to the in-memory cache and, if enabled, writes it to the disk cache.
+        //! @param meshHash The key returned by ComputeMeshHash.
+        //! @param cookedData The cooked mesh data.
+        void Store(AZ::u64 meshHash, const CookedData& cookedData);
+
+        //! Drops all in-memory entries, the disk cache is left untouched.
+        void Clear();
+
+        //! Returns the total size in bytes of the cooked data held in memory.
+        size_t GetMemoryUsage() const;
+
+    private:
+        AZStd::string GetDiskCachePath(AZ::u64 meshHash) const;
+        void StoreInMemory(AZ::u64 meshHash, const CookedData& cookedData);
+
+        mutable AZStd::mutex m_mutex;
+        AZStd::unordered_map<AZ::u64, CookedData> m_entries;
+        size_t m_memoryUsage = 0;
+    };
+} // namespace PhysX
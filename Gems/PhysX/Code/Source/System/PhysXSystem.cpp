@@ -6,6 +6,7 @@
  */
 #include <PhysX_precompiled.h>
 
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Math/MathUtils.h>
 #include <AzCore/Memory/SystemAllocator.h>
 
@@ -25,6 +26,10 @@ namespace PhysX
 {
     AZ_CLASS_ALLOCATOR_IMPL(PhysXSystem, AZ::SystemAllocator, 0);
 
+    AZ_CVAR(bool, physx_parallelSceneSimulation, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "If true, all scenes start simulating before any of them is waited on, so independent scenes run in parallel. "
+        "Combine with physx_sceneWorkerBudget to keep many small scenes from competing for the same workers.");
+
 #ifdef ENABLE_PHYSX_TIMESTEP_WARNING
     namespace FrameTimeWarning
     {
@@ -140,6 +145,26 @@ namespace PhysX
 
         auto simulateScenes = [this](float timeStep)
         {
+            if (physx_parallelSceneSimulation)
+            {
+                // Start every scene before waiting on any of them so their simulation tasks overlap on the job workers
+                for (auto& scenePtr : m_sceneList)
+                {
+                    if (scenePtr != nullptr && scenePtr->IsEnabled())
+                    {
+                        scenePtr->StartSimulation(timeStep);
+                    }
+                }
+                for (auto& scenePtr : m_sceneList)
+                {
+                    if (scenePtr != nullptr && scenePtr->IsEnabled())
+                    {
+                        scenePtr->FinishSimulation();
+                    }
+                }
+                return;
+            }
+
             for (auto& scenePtr : m_sceneList)
             {
                 if (scenePtr != nullptr && scenePtr->IsEnabled())
@@ -433,6 +458,15 @@ namespace PhysX
         delete m_cpuDispatcher;
         m_cpuDispatcher = nullptr;
 
+#if PX_SUPPORT_GPU_PHYSX
+        if (m_cudaContextManager)
+        {
+            m_cudaContextManager->release();
+            m_cudaContextManager = nullptr;
+        }
+#endif
+        m_cudaContextManagerCreated = false;
+
         m_physXSdk.m_cooking->release();
         m_physXSdk.m_cooking = nullptr;
 
@@ -447,6 +481,26 @@ namespace PhysX
         m_physXSdk.m_foundation = nullptr;
     }
 
+    physx::PxCudaContextManager* PhysXSystem::GetPxCudaContextManager()
+    {
+        if (!m_cudaContextManagerCreated)
+        {
+            m_cudaContextManagerCreated = true;
+#if PX_SUPPORT_GPU_PHYSX
+            physx::PxCudaContextManagerDesc cudaContextManagerDesc;
+            m_cudaContextManager = PxCreateCudaContextManager(*m_physXSdk.m_foundation, cudaContextManagerDesc, PxGetProfilerCallback());
+            if (m_cudaContextManager && !m_cudaContextManager->contextIsValid())
+            {
+                m_cudaContextManager->release();
+                m_cudaContextManager = nullptr;
+            }
+#endif
+            AZ_Warning("PhysXSystem", m_cudaContextManager != nullptr,
+                "No compatible CUDA device is available for PhysX GPU dynamics, scenes will be simulated on the CPU.");
+        }
+        return m_cudaContextManager;
+    }
+
     const PhysXSystemConfiguration& PhysXSystem::GetPhysXConfiguration() const
     {
         return m_systemConfig;
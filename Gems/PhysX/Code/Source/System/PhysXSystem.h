@@ -27,6 +27,7 @@ namespace physx
     class PxPhysics;
     class PxCooking;
     class PxCpuDispatcher;
+    class PxCudaContextManager;
 }
 
 namespace PhysX
@@ -78,6 +79,9 @@ namespace PhysX
             AZ_Assert(m_cpuDispatcher, "PhysX CPU dispatcher was not created");
             return m_cpuDispatcher;
         }
+        //! Returns the CUDA context manager used by scenes with GPU dynamics enabled, creating it on first use.
+        //! @return The context manager, or nullptr if the PhysX SDK was built without GPU support or no compatible device is available.
+        physx::PxCudaContextManager* GetPxCudaContextManager();
         void SetCollisionLayerName(int index, const AZStd::string& layerName);
         void CreateCollisionGroup(const AZStd::string& groupName, const AzPhysics::CollisionGroup& group);
         //TEMP -- until these are fully moved over here
@@ -111,6 +115,8 @@ namespace PhysX
         PxAzProfilerCallback m_pxAzProfilerCallback;
 
         physx::PxCpuDispatcher* m_cpuDispatcher = nullptr;
+        physx::PxCudaContextManager* m_cudaContextManager = nullptr;
+        bool m_cudaContextManagerCreated = false; //!< Creation is only attempted once, devices don't become compatible at runtime.
 
         enum class State : AZ::u8
         {
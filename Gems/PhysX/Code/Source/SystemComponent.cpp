@@ -7,8 +7,10 @@
 #include <PhysX_precompiled.h>
 #include <Source/SystemComponent.h>
 
+#include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <PhysX/MeshAsset.h>
 #include <PhysX/HeightFieldAsset.h>
@@ -212,6 +214,13 @@ namespace PhysX
 
     void SystemComponent::Deactivate()
     {
+        // Cooking jobs use the buses and PhysX cooking, let them finish before tearing either down
+        while (m_pendingCookingJobs.load() > 0)
+        {
+            AZStd::this_thread::yield();
+        }
+        m_meshCookingCache.Clear();
+
         AZ::TickBus::Handler::BusDisconnect();
         Physics::CollisionRequestBus::Handler::BusDisconnect();
         PhysX::SystemRequestsBus::Handler::BusDisconnect();
@@ -283,32 +292,91 @@ namespace PhysX
 
     bool SystemComponent::CookConvexMeshToMemory(const AZ::Vector3* vertices, AZ::u32 vertexCount, AZStd::vector<AZ::u8>& result)
     {
-        physx::PxDefaultMemoryOutputStream memoryStream;
-        
-        bool cookingResult = Utils::CookConvexToPxOutputStream(vertices, vertexCount, memoryStream);
-        
-        if(cookingResult)
-        {
-            result.insert(result.end(), memoryStream.getData(), memoryStream.getData() + memoryStream.getSize());
-        }
-        
-        return cookingResult;
+        return CookMeshToMemoryCached(Physics::CookedMeshShapeConfiguration::MeshType::Convex,
+            vertices, vertexCount, nullptr, 0, result);
     }
 
     bool SystemComponent::CookTriangleMeshToMemory(const AZ::Vector3* vertices, AZ::u32 vertexCount,
         const AZ::u32* indices, AZ::u32 indexCount, AZStd::vector<AZ::u8>& result)
     {
+        return CookMeshToMemoryCached(Physics::CookedMeshShapeConfiguration::MeshType::TriangleMesh,
+            vertices, vertexCount, indices, indexCount, result);
+    }
+
+    bool SystemComponent::CookMeshToMemoryCached(MeshCookingCache::MeshType meshType, const AZ::Vector3* vertices, AZ::u32 vertexCount,
+        const AZ::u32* indices, AZ::u32 indexCount, AZStd::vector<AZ::u8>& result)
+    {
+        const AZ::u64 meshHash = MeshCookingCache::ComputeMeshHash(meshType, vertices, vertexCount, indices, indexCount,
+            m_physXSystem->GetPxCooking()->getParams());
+
+        AZStd::vector<AZ::u8> cookedData;
+        if (m_meshCookingCache.Find(meshHash, cookedData))
+        {
+            result.insert(result.end(), cookedData.begin(), cookedData.end());
+            return true;
+        }
+
         physx::PxDefaultMemoryOutputStream memoryStream;
-        bool cookingResult = Utils::CookTriangleMeshToToPxOutputStream(vertices, vertexCount, indices, indexCount, memoryStream);
+        const bool cookingResult = (meshType == Physics::CookedMeshShapeConfiguration::MeshType::Convex)
+            ? Utils::CookConvexToPxOutputStream(vertices, vertexCount, memoryStream)
+            : Utils::CookTriangleMeshToToPxOutputStream(vertices, vertexCount, indices, indexCount, memoryStream);
 
         if (cookingResult)
         {
-            result.insert(result.end(), memoryStream.getData(), memoryStream.getData() + memoryStream.getSize());
+            cookedData.assign(memoryStream.getData(), memoryStream.getData() + memoryStream.getSize());
+            m_meshCookingCache.Store(meshHash, cookedData);
+            result.insert(result.end(), cookedData.begin(), cookedData.end());
         }
 
         return cookingResult;
     }
 
+    void SystemComponent::CookConvexMeshToMemoryAsync(AZStd::vector<AZ::Vector3> vertices, CookedMeshCallback callback)
+    {
+        StartCookingJob(
+            [this, vertices = AZStd::move(vertices)](AZStd::vector<AZ::u8>& result)
+            {
+                return CookConvexMeshToMemory(vertices.data(), aznumeric_cast<AZ::u32>(vertices.size()), result);
+            },
+            AZStd::move(callback));
+    }
+
+    void SystemComponent::CookTriangleMeshToMemoryAsync(AZStd::vector<AZ::Vector3> vertices, AZStd::vector<AZ::u32> indices,
+        CookedMeshCallback callback)
+    {
+        StartCookingJob(
+            [this, vertices = AZStd::move(vertices), indices = AZStd::move(indices)](AZStd::vector<AZ::u8>& result)
+            {
+                return CookTriangleMeshToMemory(vertices.data(), aznumeric_cast<AZ::u32>(vertices.size()),
+                    indices.data(), aznumeric_cast<AZ::u32>(indices.size()), result);
+            },
+            AZStd::move(callback));
+    }
+
+    void SystemComponent::StartCookingJob(AZStd::function<bool(AZStd::vector<AZ::u8>&)> cookFunction, CookedMeshCallback callback)
+    {
+        ++m_pendingCookingJobs;
+        AZ::Job* job = AZ::CreateJobFunction(
+            [this, cookFunction = AZStd::move(cookFunction), callback = AZStd::move(callback)]() mutable
+            {
+                AZStd::vector<AZ::u8> cookedData;
+                const bool succeeded = cookFunction(cookedData);
+
+                // Shapes are created from the cooked data on the main thread, so the result is handed back there
+                AZ::TickBus::QueueFunction(
+                    [succeeded, cookedData = AZStd::move(cookedData), callback = AZStd::move(callback)]() mutable
+                    {
+                        if (callback)
+                        {
+                            callback(succeeded, AZStd::move(cookedData));
+                        }
+                    });
+                --m_pendingCookingJobs;
+            },
+            true);
+        job->Start();
+    }
+
     physx::PxConvexMesh* SystemComponent::CreateConvexMeshFromCooked(const void* cookedMeshData, AZ::u32 bufferSize)
     {
         physx::PxDefaultMemoryInputData inpStream(reinterpret_cast<physx::PxU8*>(const_cast<void*>(cookedMeshData)), bufferSize);
@@ -12,6 +12,7 @@
 #include <AzCore/Component/Component.h>
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/Interface/Interface.h>
 #include <AzFramework/Physics/Character.h>
 #include <AzFramework/Physics/SimulatedBodies/RigidBody.h>
@@ -30,6 +31,7 @@
 #include <Configuration/PhysXSettingsRegistryManager.h>
 #include <DefaultWorldComponent.h>
 #include <Material.h>
+#include <System/PhysXMeshCookingCache.h>
 
 namespace AzPhysics
 {
@@ -89,6 +91,9 @@ namespace PhysX
 
         physx::PxFilterData CreateFilterData(const AzPhysics::CollisionLayer& layer, const AzPhysics::CollisionGroup& group) override;
         physx::PxCooking* GetCooking() override;
+        void CookConvexMeshToMemoryAsync(AZStd::vector<AZ::Vector3> vertices, CookedMeshCallback callback) override;
+        void CookTriangleMeshToMemoryAsync(AZStd::vector<AZ::Vector3> vertices, AZStd::vector<AZ::u32> indices,
+            CookedMeshCallback callback) override;
 
         // CollisionRequestBus
         AzPhysics::CollisionLayer GetCollisionLayerByName(const AZStd::string& layerName) override;
@@ -149,6 +154,13 @@ namespace PhysX
 
         void ActivatePhysXSystem();
 
+        //! Cooks a mesh through the cooked mesh cache, only cooking it if an identical mesh hasn't been cooked before.
+        bool CookMeshToMemoryCached(MeshCookingCache::MeshType meshType, const AZ::Vector3* vertices, AZ::u32 vertexCount,
+            const AZ::u32* indices, AZ::u32 indexCount, AZStd::vector<AZ::u8>& result);
+
+        //! Runs cookFunction on a job thread and queues the callback to the main thread with its result.
+        void StartCookingJob(AZStd::function<bool(AZStd::vector<AZ::u8>&)> cookFunction, CookedMeshCallback callback);
+
         bool m_enabled; ///< If false, this component will not activate itself in the Activate() function.
 
         AZStd::unique_ptr<WindProvider> m_windProvider;
@@ -158,6 +170,8 @@ namespace PhysX
 
         PhysXSystem* m_physXSystem = nullptr;
         bool m_isTickingPhysics = false;
+        MeshCookingCache m_meshCookingCache;
+        AZStd::atomic<AZ::u32> m_pendingCookingJobs{ 0 }; ///< Cooking jobs still running, waited on before the system shuts down.
         AzPhysics::SystemEvents::OnInitializedEvent::Handler m_onSystemInitializedHandler;
         AzPhysics::SystemEvents::OnConfigurationChangedEvent::Handler m_onSystemConfigChangedHandler;
     };
@@ -41,6 +41,9 @@ namespace PhysX::Benchmarks
             {{512, 1024}, {32, 512}},
             {{2048, 4096}, {64, 512}}
         };
+
+        // Batch benchmarks use a fixed scene of {boxes, max radius} and vary the number of requests per batch
+        static const std::vector<std::pair<int64_t, int64_t>> BatchBenchmarkConfig = {{1024, 1024}, {32, 32}, {16, 4096}};
     }
 
     class PhysXSceneQueryBenchmarkFixture
@@ -210,6 +213,46 @@ namespace PhysX::Benchmarks
         Utils::ReportStandardDeviationAndMeanCounters(state, executionTimes);
     }
 
+    //! Accepts 3 parameters from \state, see PhysXSceneQueryBenchmarkFixture::SetUp for the first two.
+    //!
+    //! \state.range(2) - number of raycast requests in each batch
+    BENCHMARK_DEFINE_F(PhysXSceneQueryBenchmarkFixture, BM_RaycastBatchRandomBoxes)(benchmark::State& state)
+    {
+        const auto batchSize = aznumeric_cast<AZ::u32>(state.range(2));
+
+        AzPhysics::SceneQueryRequests requests;
+        requests.reserve(batchSize);
+        for (AZ::u32 i = 0; i < batchSize; ++i)
+        {
+            auto request = AZStd::make_shared<AzPhysics::RayCastRequest>();
+            request->m_start = AZ::Vector3::CreateZero();
+            request->m_direction = m_boxes[i % m_numBoxes].GetNormalized();
+            request->m_distance = 2000.0f;
+            requests.emplace_back(AZStd::move(request));
+        }
+
+        AZStd::vector<int64_t> executionTimes;
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        for (auto _ : state)
+        {
+            auto start = std::chrono::system_clock::now();
+
+            AzPhysics::SceneQueryHitsList results = sceneInterface->QuerySceneBatch(m_testSceneHandle, requests);
+
+            auto timeElasped = std::chrono::nanoseconds(std::chrono::system_clock::now() - start);
+            executionTimes.emplace_back(timeElasped.count());
+
+            benchmark::DoNotOptimize(results);
+        }
+
+        state.SetItemsProcessed(state.iterations() * batchSize);
+
+        //get the P50, P90, P99 percentiles of each call and the standard deviation and mean
+        Utils::ReportPercentiles(state, executionTimes);
+        Utils::ReportStandardDeviationAndMeanCounters(state, executionTimes);
+    }
+
     BENCHMARK_REGISTER_F(PhysXSceneQueryBenchmarkFixture, BM_RaycastRandomBoxes)
         ->RangeMultiplier(2)
         ->Ranges(SceneQueryConstants::BenchmarkConfigs[0])
@@ -234,5 +277,10 @@ namespace PhysX::Benchmarks
         ->Ranges(SceneQueryConstants::BenchmarkConfigs[3])
         ->Unit(::benchmark::kNanosecond)
         ;
+    BENCHMARK_REGISTER_F(PhysXSceneQueryBenchmarkFixture, BM_RaycastBatchRandomBoxes)
+        ->RangeMultiplier(4)
+        ->Ranges(SceneQueryConstants::BatchBenchmarkConfig)
+        ->Unit(::benchmark::kMicrosecond)
+        ;
 }
 #endif
@@ -8,6 +8,7 @@
 
 #include <AzCore/Component/Entity.h>
 #include <AzCore/Component/TransformBus.h>
+#include <AzCore/std/parallel/semaphore.h>
 
 #include <AzTest/AzTest.h>
 #include <Tests/PhysXTestCommon.h>
@@ -1010,4 +1011,92 @@ namespace PhysX
             }
         }
     }
+
+    TEST_F(PhysXSceneQueryFixture, QuerySceneBatch_LargeBatch_ReturnsHitsInRequestOrder)
+    {
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        //setup bodies
+        const AZStd::vector<AZ::Vector3> positions = {
+            AZ::Vector3(10.0f, 0.0f, 0.0f),
+            AZ::Vector3(-10.0f, 0.0f, 0.0f),
+            AZ::Vector3(0.0f, 10.0f, 0.0f),
+            AZ::Vector3(0.0f, -10.0f, 0.0f),
+            AZ::Vector3(0.0f, 0.0f, 10.0f),
+            AZ::Vector3(0.0f, 0.0f, -10.0f)
+        };
+
+        AZStd::vector<AzPhysics::SimulatedBodyHandle> simBodies;
+        for (const AZ::Vector3& pos : positions)
+        {
+            simBodies.emplace_back(TestUtils::AddSphereToScene(m_testSceneHandle, pos, 1.0f));
+        }
+
+        //create enough raycast requests for the batch to be split across job threads
+        constexpr size_t numRequests = 256;
+        AzPhysics::SceneQueryRequests requests;
+        for (size_t i = 0; i < numRequests; i++)
+        {
+            AZStd::shared_ptr<AzPhysics::RayCastRequest> request = AZStd::make_shared<AzPhysics::RayCastRequest>();
+            request->m_start = AZ::Vector3::CreateZero();
+            request->m_direction = positions[i % positions.size()].GetNormalized();
+            request->m_distance = 200.0f;
+
+            requests.emplace_back(AZStd::move(request));
+        }
+
+        //run query
+        AzPhysics::SceneQueryHitsList results = sceneInterface->QuerySceneBatch(m_testSceneHandle, requests);
+
+        //verify each result from each request has the expected targeted simulated body
+        ASSERT_EQ(results.size(), requests.size());
+        for (size_t i = 0; i < results.size(); i++)
+        {
+            const AzPhysics::SceneQueryHits& requestResult = results[i];
+            ASSERT_EQ(requestResult.m_hits.size(), 1);
+            EXPECT_TRUE(requestResult.m_hits[0].m_bodyHandle == simBodies[i % simBodies.size()]);
+        }
+    }
+
+    TEST_F(PhysXSceneQueryFixture, QuerySceneAsyncBatch_CallbackReceivesExpectedHits)
+    {
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        const AZ::Vector3 position(10.0f, 0.0f, 0.0f);
+        const AzPhysics::SimulatedBodyHandle simBody = TestUtils::AddSphereToScene(m_testSceneHandle, position, 1.0f);
+
+        constexpr size_t numRequests = 64;
+        AzPhysics::SceneQueryRequests requests;
+        for (size_t i = 0; i < numRequests; i++)
+        {
+            AZStd::shared_ptr<AzPhysics::RayCastRequest> request = AZStd::make_shared<AzPhysics::RayCastRequest>();
+            request->m_start = AZ::Vector3::CreateZero();
+            request->m_direction = position.GetNormalized();
+            request->m_distance = 200.0f;
+
+            requests.emplace_back(AZStd::move(request));
+        }
+
+        constexpr AzPhysics::SceneQuery::AsyncRequestId requestId = 42;
+        AzPhysics::SceneQuery::AsyncRequestId receivedRequestId = 0;
+        AzPhysics::SceneQueryHitsList results;
+        AZStd::semaphore completed;
+        const bool queued = sceneInterface->QuerySceneAsyncBatch(m_testSceneHandle, requestId, requests,
+            [&receivedRequestId, &results, &completed](AzPhysics::SceneQuery::AsyncRequestId id, AzPhysics::SceneQueryHitsList hits)
+            {
+                receivedRequestId = id;
+                results = AZStd::move(hits);
+                completed.release();
+            });
+        ASSERT_TRUE(queued);
+        completed.acquire();
+
+        EXPECT_EQ(receivedRequestId, requestId);
+        ASSERT_EQ(results.size(), requests.size());
+        for (const AzPhysics::SceneQueryHits& requestResult : results)
+        {
+            ASSERT_EQ(requestResult.m_hits.size(), 1);
+            EXPECT_TRUE(requestResult.m_hits[0].m_bodyHandle == simBody);
+        }
+    }
 }
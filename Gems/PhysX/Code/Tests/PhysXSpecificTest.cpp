@@ -12,6 +12,7 @@
 #include <AzTest/AzTest.h>
 #include <AzCore/Asset/AssetManager.h>
 #include <AzCore/UnitTest/UnitTest.h>
+#include <AzCore/std/parallel/thread.h>
 
 #include <AzFramework/Physics/SystemBus.h>
 #include <AzFramework/Physics/Collision/CollisionGroups.h>
@@ -30,6 +31,7 @@
 #include <PhysX/MathConversion.h>
 #include <PhysX/PhysXLocks.h>
 #include <PhysX/SystemComponentBus.h>
+#include <System/PhysXMeshCookingCache.h>
 #include <Tests/PhysXTestCommon.h>
 
 namespace PhysX
@@ -881,6 +883,77 @@ namespace PhysX
         rigidBody = nullptr;
     }
 
+    TEST_F(PhysXSpecificTest, MeshCookingCache_DifferentMeshContent_ProducesDifferentHashes)
+    {
+        const physx::PxCookingParams cookingParams{ physx::PxTolerancesScale() };
+        PointList testPoints = TestUtils::GeneratePyramidPoints(1.0f);
+
+        const AZ::u64 convexHash = MeshCookingCache::ComputeMeshHash(Physics::CookedMeshShapeConfiguration::MeshType::Convex,
+            testPoints.data(), static_cast<AZ::u32>(testPoints.size()), nullptr, 0, cookingParams);
+        EXPECT_EQ(convexHash, MeshCookingCache::ComputeMeshHash(Physics::CookedMeshShapeConfiguration::MeshType::Convex,
+            testPoints.data(), static_cast<AZ::u32>(testPoints.size()), nullptr, 0, cookingParams));
+        EXPECT_NE(convexHash, MeshCookingCache::ComputeMeshHash(Physics::CookedMeshShapeConfiguration::MeshType::TriangleMesh,
+            testPoints.data(), static_cast<AZ::u32>(testPoints.size()), nullptr, 0, cookingParams));
+
+        testPoints[0].SetZ(testPoints[0].GetZ() + 0.5f);
+        EXPECT_NE(convexHash, MeshCookingCache::ComputeMeshHash(Physics::CookedMeshShapeConfiguration::MeshType::Convex,
+            testPoints.data(), static_cast<AZ::u32>(testPoints.size()), nullptr, 0, cookingParams));
+    }
+
+    TEST_F(PhysXSpecificTest, CookTriangleMeshToMemory_SameMeshCookedTwice_ReturnsIdenticalData)
+    {
+        VertexIndexData cubeMeshData = TestUtils::GenerateCubeMeshData(3.0f);
+
+        AZStd::vector<AZ::u8> firstCookedData;
+        AZStd::vector<AZ::u8> secondCookedData;
+        bool firstResult = false;
+        bool secondResult = false;
+        Physics::SystemRequestBus::BroadcastResult(firstResult, &Physics::SystemRequests::CookTriangleMeshToMemory,
+            cubeMeshData.first.data(), static_cast<AZ::u32>(cubeMeshData.first.size()),
+            cubeMeshData.second.data(), static_cast<AZ::u32>(cubeMeshData.second.size()),
+            firstCookedData);
+        Physics::SystemRequestBus::BroadcastResult(secondResult, &Physics::SystemRequests::CookTriangleMeshToMemory,
+            cubeMeshData.first.data(), static_cast<AZ::u32>(cubeMeshData.first.size()),
+            cubeMeshData.second.data(), static_cast<AZ::u32>(cubeMeshData.second.size()),
+            secondCookedData);
+
+        EXPECT_TRUE(firstResult);
+        EXPECT_TRUE(secondResult);
+        EXPECT_FALSE(firstCookedData.empty());
+        EXPECT_EQ(firstCookedData, secondCookedData);
+    }
+
+    TEST_F(PhysXSpecificTest, CookConvexMeshToMemoryAsync_CallbackReceivesCookedData)
+    {
+        const PointList testPoints = TestUtils::GeneratePyramidPoints(1.0f);
+
+        AZStd::vector<AZ::u8> expectedCookedData;
+        Physics::SystemRequestBus::Broadcast(&Physics::SystemRequests::CookConvexMeshToMemory,
+            testPoints.data(), static_cast<AZ::u32>(testPoints.size()), expectedCookedData);
+
+        bool callbackInvoked = false;
+        bool cookingResult = false;
+        AZStd::vector<AZ::u8> cookedData;
+        SystemRequestsBus::Broadcast(&SystemRequests::CookConvexMeshToMemoryAsync, testPoints,
+            [&callbackInvoked, &cookingResult, &cookedData](bool succeeded, AZStd::vector<AZ::u8>&& result)
+            {
+                callbackInvoked = true;
+                cookingResult = succeeded;
+                cookedData = AZStd::move(result);
+            });
+
+        // The result is queued to the main thread once the cooking job completes
+        for (int attempt = 0; attempt < 1000 && !callbackInvoked; ++attempt)
+        {
+            AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(1));
+            AZ::TickBus::ExecuteQueuedEvents();
+        }
+
+        ASSERT_TRUE(callbackInvoked);
+        EXPECT_TRUE(cookingResult);
+        EXPECT_EQ(cookedData, expectedCookedData);
+    }
+
     TEST_F(PhysXSpecificTest, Shape_ConstructorDestructor_PxShapeReferenceCounterIsCorrect)
     {
         // Create physx::PxShape object
@@ -7,7 +7,11 @@
 
 #include <Generation/Components/MeshOptimizer/MeshOptimizerComponent.h>
 #include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Debug/Profiler.h>
 #include <AzCore/Debug/Trace.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/RTTI/RTTI.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/base.h>
@@ -15,6 +19,7 @@
 #include <AzCore/std/containers/array.h>
 #include <AzCore/std/containers/list.h>
 #include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/unordered_set.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/iterator.h>
 #include <AzCore/std/limits.h>
@@ -248,7 +253,37 @@ namespace AZ::SceneGenerationComponents
             return indexes;
         };
 
-        // Iterate over them. We had to build the array before as this method can insert new nodes, so using the iterator directly would fail.
+        // Everything a mesh needs to be optimized for one of the mesh groups selecting it, and the optimized data.
+        struct MeshOptimization
+        {
+            const IMeshData* m_mesh = nullptr;
+            NodeIndex m_nodeIndex;
+            const IMeshGroup* m_meshGroup = nullptr;
+            AZStd::string m_name;
+            bool m_hasBlendShapes = false;
+
+            AZStd::vector<AZStd::reference_wrapper<const IMeshVertexUVData>> m_uvDatas;
+            AZStd::vector<AZStd::reference_wrapper<const IMeshVertexTangentData>> m_tangentDatas;
+            AZStd::vector<AZStd::reference_wrapper<const IMeshVertexBitangentData>> m_bitangentDatas;
+            AZStd::vector<AZStd::reference_wrapper<const ISkinWeightData>> m_skinWeightDatas;
+            AZStd::vector<AZStd::reference_wrapper<const IMeshVertexColorData>> m_colorDatas;
+            AZStd::vector<NodeIndex> m_blendShapeNodeIndexes;
+
+            AZStd::tuple<
+                AZStd::unique_ptr<IMeshData>,
+                AZStd::vector<AZStd::unique_ptr<MeshVertexUVData>>,
+                AZStd::vector<AZStd::unique_ptr<MeshVertexTangentData>>,
+                AZStd::vector<AZStd::unique_ptr<MeshVertexBitangentData>>,
+                AZStd::vector<AZStd::unique_ptr<MeshVertexColorData>>,
+                AZStd::unique_ptr<ISkinWeightData>
+            > m_optimizedMesh;
+            AZStd::vector<AZStd::unique_ptr<IBlendShapeData>> m_optimizedBlendShapes;
+        };
+        AZStd::vector<MeshOptimization> optimizations;
+        AZStd::unordered_set<AZStd::string> optimizedNames;
+
+        // Gather the work first, the meshes are independent of each other so they are optimized in parallel while the graph and the
+        // manifest are only read. The optimized nodes are added to the graph afterwards, in the same order as the meshes.
         for (const auto& [mesh, nodeIndex] : meshes)
         {
             // A Mesh can have multiple child nodes that contain other data streams, like uvs and tangents
@@ -259,12 +294,6 @@ namespace AZ::SceneGenerationComponents
             const auto skinWeightDatasView = Containers::MakeDerivedFilterView<ISkinWeightData>(childNodes(nodeIndex));
             const auto colorDatasView = Containers::MakeDerivedFilterView<IMeshVertexColorData>(childNodes(nodeIndex));
 
-            const AZStd::vector<AZStd::reference_wrapper<const IMeshVertexUVData>> uvDatas(uvDatasView.begin(), uvDatasView.end());
-            const AZStd::vector<AZStd::reference_wrapper<const IMeshVertexTangentData>> tangentDatas(tangentDatasView.begin(), tangentDatasView.end());
-            const AZStd::vector<AZStd::reference_wrapper<const IMeshVertexBitangentData>> bitangentDatas(bitangentDatasView.begin(), bitangentDatasView.end());
-            const AZStd::vector<AZStd::reference_wrapper<const ISkinWeightData>> skinWeightDatas(skinWeightDatasView.begin(), skinWeightDatasView.end());
-            const AZStd::vector<AZStd::reference_wrapper<const IMeshVertexColorData>> colorDatas(colorDatasView.begin(), colorDatasView.end());
-
             const AZStd::string_view nodePath(graph.GetNodeName(nodeIndex).GetPath(), graph.GetNodeName(nodeIndex).GetPathLength());
 
             for (const IMeshGroup& meshGroup : meshGroups)
@@ -275,79 +304,129 @@ namespace AZ::SceneGenerationComponents
                     continue;
                 }
 
-                const AZStd::string name =
+                AZStd::string name =
                     AZStd::string(graph.GetNodeName(nodeIndex).GetName(), graph.GetNodeName(nodeIndex).GetNameLength()).append(SceneAPI::Utilities::OptimizedMeshSuffix);
-                if (graph.Find(name).IsValid())
+                if (graph.Find(name).IsValid() || !optimizedNames.insert(name).second)
                 {
                     AZ_TracePrintf(AZ::SceneAPI::Utilities::LogWindow, "Optimized mesh already exists at '%s', there must be multiple mesh groups that have selected this mesh. Skipping the additional ones.", name.c_str());
                     continue;
                 }
 
-                const bool hasBlendShapes = HasAnyBlendShapeChild(graph, nodeIndex);
+                MeshOptimization& optimization = optimizations.emplace_back();
+                optimization.m_mesh = mesh;
+                optimization.m_nodeIndex = nodeIndex;
+                optimization.m_meshGroup = &meshGroup;
+                optimization.m_name = AZStd::move(name);
+                optimization.m_hasBlendShapes = HasAnyBlendShapeChild(graph, nodeIndex);
+                optimization.m_uvDatas.assign(uvDatasView.begin(), uvDatasView.end());
+                optimization.m_tangentDatas.assign(tangentDatasView.begin(), tangentDatasView.end());
+                optimization.m_bitangentDatas.assign(bitangentDatasView.begin(), bitangentDatasView.end());
+                optimization.m_skinWeightDatas.assign(skinWeightDatasView.begin(), skinWeightDatasView.end());
+                optimization.m_colorDatas.assign(colorDatasView.begin(), colorDatasView.end());
+                optimization.m_blendShapeNodeIndexes = nodeIndexes(Containers::MakeDerivedFilterView<IBlendShapeData>(childNodes(nodeIndex)));
+            }
+        }
 
-                auto [optimizedMesh, optimizedUVs, optimizedTangents, optimizedBitangents, optimizedVertexColors, optimizedSkinWeights] = OptimizeMesh(mesh, mesh, uvDatas, tangentDatas, bitangentDatas, colorDatas, skinWeightDatas, meshGroup, hasBlendShapes);
+        const auto optimize = [&graph](MeshOptimization& optimization)
+        {
+            optimization.m_optimizedMesh = OptimizeMesh(optimization.m_mesh, optimization.m_mesh, optimization.m_uvDatas, optimization.m_tangentDatas,
+                optimization.m_bitangentDatas, optimization.m_colorDatas, optimization.m_skinWeightDatas, *optimization.m_meshGroup, optimization.m_hasBlendShapes);
 
-                const NodeIndex optimizedMeshNodeIndex = graph.AddChild(graph.GetNodeParent(nodeIndex), name.c_str(), AZStd::move(optimizedMesh));
+            for (const NodeIndex& blendShapeNodeIndex : optimization.m_blendShapeNodeIndexes)
+            {
+                const IBlendShapeData* blendShapeNode = static_cast<const IBlendShapeData*>(graph.GetNodeContent(blendShapeNodeIndex).get());
+                auto [optimizedBlendShape, _1, _2, _3 , _4, _5] = OptimizeMesh(blendShapeNode, optimization.m_mesh, {}, {}, {}, {}, {}, *optimization.m_meshGroup, optimization.m_hasBlendShapes);
+                optimization.m_optimizedBlendShapes.emplace_back(AZStd::move(optimizedBlendShape));
+            }
+        };
 
-                auto addOptimizedNodes = [&graph, &optimizedMeshNodeIndex](const auto& originalNodeIndexes, auto& optimizedNodes)
+        if (optimizations.size() > 1 && AZ::JobContext::GetGlobalContext())
+        {
+            AZ::JobCompletion jobCompletion;
+            for (MeshOptimization& optimization : optimizations)
+            {
+                AZ::Job* job = AZ::CreateJobFunction([&optimize, &optimization]()
                 {
-                    AZ_PUSH_DISABLE_WARNING(, "-Wrange-loop-analysis") // remove when we upgrade from clang 6.0
-                    for (const auto& [originalNodeIndex, optimizedNode] : Containers::Views::MakePairView(originalNodeIndexes, optimizedNodes))
-                    AZ_POP_DISABLE_WARNING
-                    {
-                        const AZStd::string optimizedName {graph.GetNodeName(originalNodeIndex).GetName(), graph.GetNodeName(originalNodeIndex).GetNameLength()};
-                        const NodeIndex optimizedNodeIndex = graph.AddChild(optimizedMeshNodeIndex, optimizedName.c_str(), AZStd::move(optimizedNode));
-                        if (graph.IsNodeEndPoint(originalNodeIndex))
-                        {
-                            graph.MakeEndPoint(optimizedNodeIndex);
-                        }
-                    }
-                };
-                addOptimizedNodes(nodeIndexes(Containers::MakeDerivedFilterView<IMeshVertexUVData>(childNodes(nodeIndex))), optimizedUVs);
-                addOptimizedNodes(nodeIndexes(Containers::MakeDerivedFilterView<IMeshVertexTangentData>(childNodes(nodeIndex))), optimizedTangents);
-                addOptimizedNodes(nodeIndexes(Containers::MakeDerivedFilterView<IMeshVertexBitangentData>(childNodes(nodeIndex))), optimizedBitangents);
-                addOptimizedNodes(nodeIndexes(Containers::MakeDerivedFilterView<IMeshVertexColorData>(childNodes(nodeIndex))), optimizedVertexColors);
+                    AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::AzToolsFramework, "MeshOptimizerComponent::OptimizeMeshes::MeshJob");
+                    optimize(optimization);
+                }, true);
+                job->SetDependent(&jobCompletion);
+                job->Start();
+            }
+            jobCompletion.StartAndWaitForCompletion();
+        }
+        else
+        {
+            for (MeshOptimization& optimization : optimizations)
+            {
+                optimize(optimization);
+            }
+        }
 
-                if (optimizedSkinWeights)
-                {
-                    const NodeIndex optimizedSkinNodeIndex = graph.AddChild(optimizedMeshNodeIndex, "skinWeights", AZStd::move(optimizedSkinWeights));
-                    graph.MakeEndPoint(optimizedSkinNodeIndex);
-                }
+        // Add the optimized nodes. We had to build the array before as this inserts new nodes, so using the graph iterators directly would fail.
+        for (MeshOptimization& optimization : optimizations)
+        {
+            const NodeIndex nodeIndex = optimization.m_nodeIndex;
+            auto& [optimizedMesh, optimizedUVs, optimizedTangents, optimizedBitangents, optimizedVertexColors, optimizedSkinWeights] = optimization.m_optimizedMesh;
 
-                for (const NodeIndex& blendShapeNodeIndex : nodeIndexes(Containers::MakeDerivedFilterView<IBlendShapeData>(childNodes(nodeIndex))))
-                {
-                    const IBlendShapeData* blendShapeNode = static_cast<IBlendShapeData*>(graph.GetNodeContent(blendShapeNodeIndex).get());
-                    auto [optimizedBlendShape, _1, _2, _3 , _4, _5] = OptimizeMesh(blendShapeNode, mesh, {}, {}, {}, {}, {}, meshGroup, hasBlendShapes);
+            const NodeIndex optimizedMeshNodeIndex = graph.AddChild(graph.GetNodeParent(nodeIndex), optimization.m_name.c_str(), AZStd::move(optimizedMesh));
 
-                    const AZStd::string optimizedName {graph.GetNodeName(blendShapeNodeIndex).GetName(), graph.GetNodeName(blendShapeNodeIndex).GetNameLength()};
-                    const NodeIndex optimizedNodeIndex = graph.AddChild(optimizedMeshNodeIndex, optimizedName.c_str(), AZStd::move(optimizedBlendShape));
-                    if (graph.IsNodeEndPoint(blendShapeNodeIndex))
+            auto addOptimizedNodes = [&graph, &optimizedMeshNodeIndex](const auto& originalNodeIndexes, auto& optimizedNodes)
+            {
+                AZ_PUSH_DISABLE_WARNING(, "-Wrange-loop-analysis") // remove when we upgrade from clang 6.0
+                for (const auto& [originalNodeIndex, optimizedNode] : Containers::Views::MakePairView(originalNodeIndexes, optimizedNodes))
+                AZ_POP_DISABLE_WARNING
+                {
+                    const AZStd::string optimizedName {graph.GetNodeName(originalNodeIndex).GetName(), graph.GetNodeName(originalNodeIndex).GetNameLength()};
+                    const NodeIndex optimizedNodeIndex = graph.AddChild(optimizedMeshNodeIndex, optimizedName.c_str(), AZStd::move(optimizedNode));
+                    if (graph.IsNodeEndPoint(originalNodeIndex))
                     {
                         graph.MakeEndPoint(optimizedNodeIndex);
                     }
                 }
+            };
+            addOptimizedNodes(nodeIndexes(Containers::MakeDerivedFilterView<IMeshVertexUVData>(childNodes(nodeIndex))), optimizedUVs);
+            addOptimizedNodes(nodeIndexes(Containers::MakeDerivedFilterView<IMeshVertexTangentData>(childNodes(nodeIndex))), optimizedTangents);
+            addOptimizedNodes(nodeIndexes(Containers::MakeDerivedFilterView<IMeshVertexBitangentData>(childNodes(nodeIndex))), optimizedBitangents);
+            addOptimizedNodes(nodeIndexes(Containers::MakeDerivedFilterView<IMeshVertexColorData>(childNodes(nodeIndex))), optimizedVertexColors);
+
+            if (optimizedSkinWeights)
+            {
+                const NodeIndex optimizedSkinNodeIndex = graph.AddChild(optimizedMeshNodeIndex, "skinWeights", AZStd::move(optimizedSkinWeights));
+                graph.MakeEndPoint(optimizedSkinNodeIndex);
+            }
 
-                const AZStd::array optimizedChildTypes {
-                    azrtti_typeid<IMeshData>(),
-                    azrtti_typeid<IMeshVertexUVData>(),
-                    azrtti_typeid<IMeshVertexTangentData>(),
-                    azrtti_typeid<IMeshVertexBitangentData>(),
-                    azrtti_typeid<IMeshVertexColorData>(),
-                    azrtti_typeid<ISkinWeightData>(),
-                    azrtti_typeid<IBlendShapeData>(),
-                };
-                for (const NodeIndex& childNodeIndex : nodeIndexes(childNodes(nodeIndex)))
+            for (size_t blendShapeIndex = 0; blendShapeIndex < optimization.m_blendShapeNodeIndexes.size(); ++blendShapeIndex)
+            {
+                const NodeIndex& blendShapeNodeIndex = optimization.m_blendShapeNodeIndexes[blendShapeIndex];
+                const AZStd::string optimizedName {graph.GetNodeName(blendShapeNodeIndex).GetName(), graph.GetNodeName(blendShapeNodeIndex).GetNameLength()};
+                const NodeIndex optimizedNodeIndex = graph.AddChild(optimizedMeshNodeIndex, optimizedName.c_str(), AZStd::move(optimization.m_optimizedBlendShapes[blendShapeIndex]));
+                if (graph.IsNodeEndPoint(blendShapeNodeIndex))
                 {
-                    const AZStd::shared_ptr<SceneAPI::DataTypes::IGraphObject>& childNode = graph.GetNodeContent(childNodeIndex);
+                    graph.MakeEndPoint(optimizedNodeIndex);
+                }
+            }
 
-                    if (!AZStd::any_of(optimizedChildTypes.begin(), optimizedChildTypes.end(), [&childNode](const AZ::Uuid& typeId) { return AZ::RttiIsTypeOf(typeId, childNode.get()); }))
+            const AZStd::array optimizedChildTypes {
+                azrtti_typeid<IMeshData>(),
+                azrtti_typeid<IMeshVertexUVData>(),
+                azrtti_typeid<IMeshVertexTangentData>(),
+                azrtti_typeid<IMeshVertexBitangentData>(),
+                azrtti_typeid<IMeshVertexColorData>(),
+                azrtti_typeid<ISkinWeightData>(),
+                azrtti_typeid<IBlendShapeData>(),
+            };
+            for (const NodeIndex& childNodeIndex : nodeIndexes(childNodes(nodeIndex)))
+            {
+                const AZStd::shared_ptr<SceneAPI::DataTypes::IGraphObject>& childNode = graph.GetNodeContent(childNodeIndex);
+
+                if (!AZStd::any_of(optimizedChildTypes.begin(), optimizedChildTypes.end(), [&childNode](const AZ::Uuid& typeId) { return AZ::RttiIsTypeOf(typeId, childNode.get()); }))
+                {
+                    const AZStd::string optimizedName {graph.GetNodeName(childNodeIndex).GetName(), graph.GetNodeName(childNodeIndex).GetNameLength()};
+                    const NodeIndex optimizedNodeIndex = graph.AddChild(optimizedMeshNodeIndex, optimizedName.c_str(), childNode);
+                    if (graph.IsNodeEndPoint(childNodeIndex))
                     {
-                        const AZStd::string optimizedName {graph.GetNodeName(childNodeIndex).GetName(), graph.GetNodeName(childNodeIndex).GetNameLength()};
-                        const NodeIndex optimizedNodeIndex = graph.AddChild(optimizedMeshNodeIndex, optimizedName.c_str(), childNode);
-                        if (graph.IsNodeEndPoint(childNodeIndex))
-                        {
-                            graph.MakeEndPoint(optimizedNodeIndex);
-                        }
+                        graph.MakeEndPoint(optimizedNodeIndex);
                     }
                 }
             }
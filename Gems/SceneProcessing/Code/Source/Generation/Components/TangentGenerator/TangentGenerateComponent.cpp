@@ -30,12 +30,27 @@
 
 #include <AzToolsFramework/Debug/TraceContext.h>
 
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/Math/Vector4.h>
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 
 
 namespace AZ::SceneGenerationComponents
 {
+    // The tangent generation of a single mesh, once its tangent and bitangent layers have been added to the scene graph.
+    struct TangentGenerateComponent::MeshTangentWork
+    {
+        AZ::SceneAPI::Containers::SceneGraph* m_graph = nullptr;
+        AZ::SceneAPI::Containers::SceneGraph::NodeIndex m_nodeIndex;
+        AZ::SceneAPI::DataTypes::IMeshData* m_meshData = nullptr;
+        AZStd::vector<AZ::TangentGeneration::Mesh::MikkT::MikktCustomData> m_meshTangents;
+        AZStd::vector<AZStd::pair<AZ::SceneData::GraphData::BlendShapeData*, size_t>> m_blendShapeTangents;
+    };
+
     TangentGenerateComponent::TangentGenerateComponent()
     {
         BindToCall(&TangentGenerateComponent::GenerateTangentData);
@@ -98,20 +113,76 @@ namespace AZ::SceneGenerationComponents
             meshes.emplace_back(mesh, nodeIndex);
         }
 
+        // The required tangent spaces only depend on the manifest, so collect them once for all meshes.
+        const AZStd::vector<AZ::SceneAPI::DataTypes::TangentSpace> requiredSpaces = CollectRequiredTangentSpaces(context.GetScene());
+
         // Iterate over them. We had to build the array before as this method can insert new nodes, so using the iterator directly would fail.
+        // Only the new tangent and bitangent nodes are added here, the tangents themselves are generated afterwards.
+        AZStd::vector<MeshTangentWork> meshWork;
+        meshWork.reserve(meshes.size());
         for (auto& [mesh, nodeIndex] : meshes)
         {
-            // Generate tangents for the mesh (if this is desired or needed).
-            if (!GenerateTangentsForMesh(context.GetScene(), nodeIndex, mesh))
+            MeshTangentWork& work = meshWork.emplace_back();
+            work.m_graph = &graph;
+            work.m_nodeIndex = nodeIndex;
+            work.m_meshData = mesh;
+
+            // Create the tangent layers for the mesh (if this is desired or needed).
+            if (!GenerateTangentsForMesh(context.GetScene(), nodeIndex, mesh, requiredSpaces, work))
             {
                 return AZ::SceneAPI::Events::ProcessingResult::Failure;
             }
+        }
+
+        // The scene graph and the manifest are no longer modified, and every mesh only writes to its own data, so the meshes are processed in parallel.
+        bool allSuccess = true;
+        if (meshWork.size() > 1 && AZ::JobContext::GetGlobalContext())
+        {
+            AZStd::atomic_bool jobsSuccess{ true };
+            AZ::JobCompletion jobCompletion;
+            for (MeshTangentWork& work : meshWork)
+            {
+                AZ::Job* job = AZ::CreateJobFunction([this, &work, &jobsSuccess]()
+                {
+                    AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::AzToolsFramework, "TangentGenerateComponent::GenerateTangentData::MeshJob");
+                    if (!RunTangentWork(work))
+                    {
+                        jobsSuccess = false;
+                    }
+                }, true);
+                job->SetDependent(&jobCompletion);
+                job->Start();
+            }
+            jobCompletion.StartAndWaitForCompletion();
+            allSuccess = jobsSuccess;
+        }
+        else
+        {
+            for (MeshTangentWork& work : meshWork)
+            {
+                allSuccess &= RunTangentWork(work);
+            }
+        }
+
+        return allSuccess ? AZ::SceneAPI::Events::ProcessingResult::Success : AZ::SceneAPI::Events::ProcessingResult::Failure;
+    }
 
-            // Now that we have the tangents and bitangents, calculate the tangent w values for the ones that we imported from the scene file, as they only have xyz.
-            UpdateFbxTangentWValues(graph, nodeIndex, mesh);
+
+    bool TangentGenerateComponent::RunTangentWork(MeshTangentWork& work)
+    {
+        bool allSuccess = true;
+        for (AZ::TangentGeneration::Mesh::MikkT::MikktCustomData& meshTangents : work.m_meshTangents)
+        {
+            allSuccess &= AZ::TangentGeneration::Mesh::MikkT::GenerateTangents(meshTangents);
+        }
+        for (const auto& blendShapeTangents : work.m_blendShapeTangents)
+        {
+            allSuccess &= AZ::TangentGeneration::BlendShape::MikkT::GenerateTangents(blendShapeTangents.first, blendShapeTangents.second);
         }
 
-        return AZ::SceneAPI::Events::ProcessingResult::Success;
+        // Now that we have the tangents and bitangents, calculate the tangent w values for the ones that we imported from the scene file, as they only have xyz.
+        UpdateFbxTangentWValues(*work.m_graph, work.m_nodeIndex, work.m_meshData);
+        return allSuccess;
     }
 
 
@@ -185,7 +256,8 @@ namespace AZ::SceneGenerationComponents
         }
     }
 
-    bool TangentGenerateComponent::GenerateTangentsForMesh(AZ::SceneAPI::Containers::Scene& scene, const AZ::SceneAPI::Containers::SceneGraph::NodeIndex& nodeIndex, AZ::SceneAPI::DataTypes::IMeshData* meshData)
+    bool TangentGenerateComponent::GenerateTangentsForMesh(AZ::SceneAPI::Containers::Scene& scene, const AZ::SceneAPI::Containers::SceneGraph::NodeIndex& nodeIndex, AZ::SceneAPI::DataTypes::IMeshData* meshData,
+        const AZStd::vector<AZ::SceneAPI::DataTypes::TangentSpace>& collectedSpaces, MeshTangentWork& outWork)
     {
         AZ::SceneAPI::Containers::SceneGraph& graph = scene.GetGraph();
 
@@ -202,7 +274,7 @@ namespace AZ::SceneGenerationComponents
         AZ::SceneAPI::DataTypes::IMeshVertexBitangentData*  fbxBitangentData = AZ::SceneAPI::SceneData::TangentsRule::FindBitangentData(graph, nodeIndex, 0, AZ::SceneAPI::DataTypes::TangentSpace::FromSourceScene);
 
         // Check what tangent spaces we need.
-        AZStd::vector<AZ::SceneAPI::DataTypes::TangentSpace> requiredSpaces = CollectRequiredTangentSpaces(scene);
+        AZStd::vector<AZ::SceneAPI::DataTypes::TangentSpace> requiredSpaces = collectedSpaces;
 
         // If we have no tangent rules, so if the required spaces is empty.
         if (requiredSpaces.empty())
@@ -241,11 +313,19 @@ namespace AZ::SceneGenerationComponents
                 // Generate using MikkT space.
                 case AZ::SceneAPI::DataTypes::TangentSpace::MikkT:
                 {
-                    allSuccess &= AZ::TangentGeneration::Mesh::MikkT::GenerateTangents(
-                        scene.GetManifest(), graph, nodeIndex, const_cast<AZ::SceneAPI::DataTypes::IMeshData*>(meshData), uvSetIndex);
+                    AZ::TangentGeneration::Mesh::MikkT::MikktCustomData meshTangents;
+                    if (AZ::TangentGeneration::Mesh::MikkT::CreateTangentLayers(
+                        scene.GetManifest(), graph, nodeIndex, const_cast<AZ::SceneAPI::DataTypes::IMeshData*>(meshData), uvSetIndex, meshTangents))
+                    {
+                        outWork.m_meshTangents.emplace_back(meshTangents);
+                    }
+                    else
+                    {
+                        allSuccess = false;
+                    }
                     for (AZ::SceneData::GraphData::BlendShapeData* blendShape : blendShapes)
                     {
-                        allSuccess &= AZ::TangentGeneration::BlendShape::MikkT::GenerateTangents(blendShape, uvSetIndex);
+                        outWork.m_blendShapeTangents.emplace_back(blendShape, uvSetIndex);
                     }
                 }
                 break;
@@ -111,7 +111,7 @@ namespace AZ::TangentGeneration::Mesh::MikkT
     }
 
 
-    bool GenerateTangents(AZ::SceneAPI::Containers::SceneManifest& manifest, AZ::SceneAPI::Containers::SceneGraph& graph, const AZ::SceneAPI::Containers::SceneGraph::NodeIndex& nodeIndex, AZ::SceneAPI::DataTypes::IMeshData* meshData, size_t uvSet)
+    bool CreateTangentLayers(AZ::SceneAPI::Containers::SceneManifest& manifest, AZ::SceneAPI::Containers::SceneGraph& graph, const AZ::SceneAPI::Containers::SceneGraph::NodeIndex& nodeIndex, AZ::SceneAPI::DataTypes::IMeshData* meshData, size_t uvSet, MikktCustomData& outCustomData)
     {
         // Create tangent and bitangent data sets and relate them to the given UV set.
         AZ::SceneAPI::DataTypes::IMeshVertexUVData*         uvData          = AZ::SceneAPI::SceneData::TangentsRule::FindUVData(graph, nodeIndex, uvSet);
@@ -129,8 +129,16 @@ namespace AZ::TangentGeneration::Mesh::MikkT
             return false;
         }
 
-        //----------------------------------
+        outCustomData.m_meshData        = meshData;
+        outCustomData.m_uvData          = uvData;
+        outCustomData.m_tangentData     = tangentData;
+        outCustomData.m_bitangentData   = bitangentData;
+        return true;
+    }
+
 
+    bool GenerateTangents(MikktCustomData& customData)
+    {
         // Provide the MikkT interface.
         SMikkTSpaceInterface mikkInterface;
         mikkInterface.m_getNumFaces         = GetNumFaces;
@@ -141,13 +149,6 @@ namespace AZ::TangentGeneration::Mesh::MikkT
         mikkInterface.m_setTSpaceBasic      = nullptr;//SetTSpaceBasic;
         mikkInterface.m_getNumVerticesOfFace= GetNumVerticesOfFace;
 
-        // Set the MikkT custom data.
-        MikktCustomData customData;
-        customData.m_meshData       = meshData;
-        customData.m_uvData         = uvData;
-        customData.m_tangentData    = tangentData;
-        customData.m_bitangentData  = bitangentData;
-
         // Generate the tangents.
         SMikkTSpaceContext mikkContext;
         mikkContext.m_pInterface    = &mikkInterface;
@@ -160,4 +161,11 @@ namespace AZ::TangentGeneration::Mesh::MikkT
 
         return true;
     }
+
+
+    bool GenerateTangents(AZ::SceneAPI::Containers::SceneManifest& manifest, AZ::SceneAPI::Containers::SceneGraph& graph, const AZ::SceneAPI::Containers::SceneGraph::NodeIndex& nodeIndex, AZ::SceneAPI::DataTypes::IMeshData* meshData, size_t uvSet)
+    {
+        MikktCustomData customData;
+        return CreateTangentLayers(manifest, graph, nodeIndex, meshData, uvSet, customData) && GenerateTangents(customData);
+    }
 } // namespace AZ::TangentGeneration::MikkT
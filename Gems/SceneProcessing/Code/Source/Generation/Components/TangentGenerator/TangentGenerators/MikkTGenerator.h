@@ -24,6 +24,13 @@ namespace AZ::TangentGeneration::Mesh::MikkT
         AZ::SceneAPI::DataTypes::IMeshVertexBitangentData*  m_bitangentData;
     };
 
+    // Creates the tangent and bitangent data sets for the given UV set in the scene graph and fills outCustomData with the data to generate them from.
+    // This adds nodes to the scene graph and names them using the manifest, so it must not run concurrently with other graph changes.
+    bool CreateTangentLayers(AZ::SceneAPI::Containers::SceneManifest& manifest, AZ::SceneAPI::Containers::SceneGraph& graph, const AZ::SceneAPI::Containers::SceneGraph::NodeIndex& nodeIndex, AZ::SceneAPI::DataTypes::IMeshData* meshData, size_t uvSet, MikktCustomData& outCustomData);
+
+    // Generates the tangents into the data sets created by CreateTangentLayers. This only touches the data of a single mesh, so meshes can be processed in parallel.
+    bool GenerateTangents(MikktCustomData& customData);
+
     // The main generation method.
     bool GenerateTangents(AZ::SceneAPI::Containers::SceneManifest& manifest, AZ::SceneAPI::Containers::SceneGraph& graph, const AZ::SceneAPI::Containers::SceneGraph::NodeIndex& nodeIndex, AZ::SceneAPI::DataTypes::IMeshData* meshData, size_t uvSet);
 } // namespace AZ::TangentGeneration::MikkT
@@ -504,6 +504,7 @@ namespace ScriptCanvasBuilder
         request.graph = sourceGraph;
         request.rawSaveDebugOutput = ScriptCanvas::Grammar::g_saveRawTranslationOuputToFile;
         request.printModelToConsole = ScriptCanvas::Grammar::g_printAbstractCodeModel;
+        request.saveNativeSource = ScriptCanvas::Grammar::g_translateToNativeSource;
 
         ScriptCanvas::Translation::Result translationResult = TranslateToLua(request);
         auto outcome = translationResult.IsSuccess(ScriptCanvas::Translation::TargetFlags::Lua);
@@ -512,6 +513,18 @@ namespace ScriptCanvasBuilder
             return AZ::Failure(outcome.GetError());
         }
 
+        if (request.saveNativeSource)
+        {
+            auto cppErrors = translationResult.m_errors.find(ScriptCanvas::Translation::TargetFlags::Cpp);
+            if (cppErrors != translationResult.m_errors.end())
+            {
+                for (const auto& error : cppErrors->second)
+                {
+                    AZ_TracePrintf(s_scriptCanvasBuilder, "No native source for %s, graph stays interpreted: %s", input.fileNameOnly.c_str(), error.c_str());
+                }
+            }
+        }
+
         const auto& translation = translationResult.m_translations.find(ScriptCanvas::Translation::TargetFlags::Lua)->second;
 
         AZ::IO::MemoryStream inputStream(translation.m_text.data(), translation.m_text.size());
@@ -686,6 +699,12 @@ namespace ScriptCanvasBuilder
     ScriptCanvas::Translation::Result TranslateToLua(ScriptCanvas::Grammar::Request& request)
     {
         request.translationTargetFlags = ScriptCanvas::Translation::TargetFlags::Lua;
+
+        if (request.saveNativeSource)
+        {
+            request.translationTargetFlags |= ScriptCanvas::Translation::TargetFlags::Cpp | ScriptCanvas::Translation::TargetFlags::Hpp;
+        }
+
         return ScriptCanvas::Translation::ParseAndTranslateGraph(request);
     }
 }
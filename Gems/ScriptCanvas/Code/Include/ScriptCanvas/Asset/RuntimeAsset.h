@@ -73,6 +73,7 @@ namespace ScriptCanvas
         // populate all on initial load at run time
         AZStd::vector<Execution::CloneSource> m_cloneSources;
         AZStd::vector<AZ::BehaviorValueParameter> m_activationInputStorage;
+        AZStd::vector<Execution::ActivationInputPush> m_activationInputPushFunctions;
         Execution::ActivationInputRange m_activationInputRange;
 
         bool RequiresStaticInitialization() const;
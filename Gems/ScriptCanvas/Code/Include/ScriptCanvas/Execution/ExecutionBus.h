@@ -75,6 +75,21 @@ namespace ScriptCanvas
             PerformanceReportByAsset byAsset;
         };
 
+        // Timing of a single node, over all the execution paths it was reached through. Times are in microseconds, exclusive time
+        // runs from the node being signaled until the next node gets signaled, inclusive time adds the nodes signaled after it.
+        struct PerformanceNodeReport
+        {
+            AZ_TYPE_INFO(PerformanceNodeReport, "{A5AD55C1-08A9-484C-AA0C-B24D7EE7D5F2}");
+            AZ_CLASS_ALLOCATOR(PerformanceNodeReport, AZ::SystemAllocator, 0);
+
+            AZ::Data::AssetId assetId;
+            AZ::EntityId nodeId;
+            AZStd::string nodeName;
+            AZStd::sys_time_t exclusiveTime = 0;
+            AZStd::sys_time_t inclusiveTime = 0;
+            AZ::u32 executionCount = 0;
+        };
+
         void FinalizePerformanceReport(PerformanceKey key, const AZ::Data::AssetId& assetId);
 
         class PerformanceScope
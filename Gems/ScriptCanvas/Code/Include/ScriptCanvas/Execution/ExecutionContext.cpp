@@ -149,7 +149,16 @@ namespace ScriptCanvas
                 parameters.push_back(bvp);
             }
 
+            AZStd::vector<ActivationInputPush>& pushFunctions = runtimeData.m_activationInputPushFunctions;
+            pushFunctions.reserve(parameters.size());
+
+            for (const AZ::BehaviorValueParameter& parameter : parameters)
+            {
+                pushFunctions.push_back(GetActivationInputPush(behaviorContext, parameter));
+            }
+
             range.inputs = parameters.begin();
+            range.pushFunctions = pushFunctions.begin();
             range.nodeableCount = runtimeData.m_input.m_nodeables.size();
             range.variableCount = runtimeData.m_input.m_variables.size();
             range.entityIdCount = runtimeData.m_input.m_entityIds.size();
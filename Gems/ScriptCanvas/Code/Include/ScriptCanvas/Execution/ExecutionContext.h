@@ -9,6 +9,8 @@
 
 #include <ScriptCanvas/Core/Core.h>
 
+struct lua_State;
+
 namespace ScriptCanvas
 {
     class RuntimeComponent;
@@ -20,6 +22,9 @@ namespace ScriptCanvas
     {
         using ActivationInputArray = AZStd::array<AZ::BehaviorValueParameter, 128>;
 
+        // pushes one activation input to Lua, resolved once per asset instead of once per input on every activation
+        using ActivationInputPush = void(*)(lua_State*, AZ::BehaviorValueParameter&);
+
         struct ActivationData
         {
             const RuntimeDataOverrides& variableOverrides;
@@ -34,6 +39,7 @@ namespace ScriptCanvas
         struct ActivationInputRange
         {
             AZ::BehaviorValueParameter* inputs = nullptr;
+            const ActivationInputPush* pushFunctions = nullptr;
             bool requiresDependencyConstructionParameters = false;
             size_t nodeableCount = 0;
             size_t variableCount = 0;
@@ -13,6 +13,7 @@
 #include "Interpreted/ExecutionStateInterpretedPure.h"
 #include "Interpreted/ExecutionStateInterpretedPerActivation.h"
 #include "Interpreted/ExecutionStateInterpretedSingleton.h"
+#include "Native/ExecutionStateNative.h"
 
 #include "ExecutionState.h"
 
@@ -38,6 +39,10 @@ namespace ScriptCanvas
             return AZStd::make_shared<ExecutionStateInterpretedPure>(config);
 
         case Grammar::ExecutionStateSelection::InterpretedPureOnGraphStart:
+            if (ExecutionStateNativePureOnGraphStart::IsAvailable(config))
+            {
+                return AZStd::make_shared<ExecutionStateNativePureOnGraphStart>(config);
+            }
             return AZStd::make_shared<ExecutionStateInterpretedPureOnGraphStart>(config);
 
         case Grammar::ExecutionStateSelection::InterpretedObject:
@@ -56,6 +56,28 @@ namespace ExecutionInterpretedAPICpp
             : nullptr;
     }
 
+    void PushActivationInputConstCharPtr(lua_State* lua, AZ::BehaviorValueParameter& argument)
+    {
+        lua_pushstring(lua, reinterpret_cast<const char*>(argument.GetValueAddress()));
+    }
+
+    void PushActivationInputString(lua_State* lua, AZ::BehaviorValueParameter& argument)
+    {
+        auto value = reinterpret_cast<const AZStd::string*>(argument.GetValueAddress());
+        lua_pushlstring(lua, value->data(), value->size());
+    }
+
+    void PushActivationInputStringView(lua_State* lua, AZ::BehaviorValueParameter& argument)
+    {
+        auto value = reinterpret_cast<const AZStd::string_view*>(argument.GetValueAddress());
+        lua_pushlstring(lua, value->data(), value->size());
+    }
+
+    void PushActivationInputUnresolved(lua_State* lua, AZ::BehaviorValueParameter& argument)
+    {
+        ScriptCanvas::Execution::StackPush(lua, AZ::ScriptContext::FromNativeContext(lua)->GetBoundContext(), argument);
+    }
+
     int DeleteNodeable(lua_State* lua)
     {
         AZ::LuaUserData* userData = reinterpret_cast<AZ::LuaUserData*>(lua_touserdata(lua, -1));
@@ -446,6 +468,47 @@ namespace ScriptCanvas
             }
         }
 
+        ActivationInputPush GetActivationInputPush(AZ::BehaviorContext& behaviorContext, const AZ::BehaviorValueParameter& parameter)
+        {
+            using namespace ExecutionInterpretedAPICpp;
+
+            // strings are pushed as Lua strings, matching StackPush
+            if (parameter.m_typeId == azrtti_typeid<const char*>())
+            {
+                return &PushActivationInputConstCharPtr;
+            }
+            else if (parameter.m_typeId == azrtti_typeid<AZStd::string>())
+            {
+                return &PushActivationInputString;
+            }
+            else if (parameter.m_typeId == azrtti_typeid<AZStd::string_view>())
+            {
+                return &PushActivationInputStringView;
+            }
+
+            AZ::BehaviorClass* behaviorClass = nullptr;
+            if (AZ::LuaPushToStack pushToStack = AZ::ToLuaStack(&behaviorContext, &parameter, nullptr, behaviorClass))
+            {
+                return pushToStack;
+            }
+
+            return &PushActivationInputUnresolved;
+        }
+
+        void PushActivationArgs(lua_State* lua, const ActivationInputRange& range)
+        {
+            if (!range.pushFunctions)
+            {
+                PushActivationArgs(lua, range.inputs, range.totalCount);
+                return;
+            }
+
+            for (size_t i = 0; i < range.totalCount; ++i)
+            {
+                range.pushFunctions[i](lua, range.inputs[i]);
+            }
+        }
+
         int GetRandomSwitchControlNumber(lua_State* lua)
         {
             lua_pushnumber(lua, MathNodeUtilities::GetRandom(lua_Number(0), lua_tonumber(lua, -1)));
@@ -697,7 +760,7 @@ namespace ScriptCanvas
             ActivationInputArray storage;
             ActivationData data(args.runtimeOverrides, storage);
             ActivationInputRange range = Execution::Context::CreateActivateInputRange(data, args.executionState->GetEntityId());
-            PushActivationArgs(lua, range.inputs, range.totalCount);
+            PushActivationArgs(lua, range);
             return range.totalCount;
         }
 
@@ -13,6 +13,7 @@
 #include <AzCore/RTTI/BehaviorContext.h>
 
 #include <ScriptCanvas/Core/NodeableOut.h>
+#include <ScriptCanvas/Execution/ExecutionContext.h>
 #include <ScriptCanvas/Grammar/PrimitivesDeclarations.h>
 
 struct lua_State;
@@ -36,6 +37,9 @@ namespace ScriptCanvas
 
         AZStd::string CreateStringFastFromId(const AZ::Uuid& uuid);
 
+        // resolves how the activation input is pushed to Lua, so activation doesn't search the BehaviorContext for every input
+        ActivationInputPush GetActivationInputPush(AZ::BehaviorContext& behaviorContext, const AZ::BehaviorValueParameter& parameter);
+
         int CallExecutionOut(lua_State* lua);
 
         int InterpretedSafeCall(lua_State* lua, int argCount, int returnValueCount);
@@ -50,6 +54,8 @@ namespace ScriptCanvas
 
         void PushActivationArgs(lua_State* lua, AZ::BehaviorValueParameter* arguments, size_t numArguments);
 
+        void PushActivationArgs(lua_State* lua, const ActivationInputRange& range);
+
         void RegisterAPI(lua_State* lua);
 
         // Lua: (ebus handler) userdata, (out name) string, (out implementation) function
@@ -15,6 +15,8 @@
 #include <ScriptCanvas/Grammar/DebugMap.h>
 #include <ScriptCanvas/Execution/ExecutionState.h>
 #include <ScriptCanvas/Execution/Interpreted/ExecutionStateInterpreted.h>
+#include <ScriptCanvas/PerformanceTracker.h>
+#include <ScriptCanvas/SystemComponent.h>
 
 #include <Libraries/UnitTesting/UnitTestBus.h>
 
@@ -48,6 +50,36 @@ namespace ExecutionInterpretedDebugAPIcpp
             }
         }
     }
+
+    bool IsObserved(ExecutionStateInterpreted& executionState)
+    {
+        bool isObserved{};
+        ExecutionNotificationsBus::BroadcastResult(isObserved, &ExecutionNotifications::IsGraphObserved, executionState.GetEntityId(), executionState.GetGraphIdentifier());
+        return isObserved;
+    }
+
+    // Node profiling turns on the debug signals of unobserved graphs, which skip the signal data and the notifications.
+    bool ProfileSignal(ExecutionStateInterpreted& executionState, const AZ::Data::AssetId& assetId, const Grammar::DebugExecution& debugExecution, bool isInput)
+    {
+        if (!sc_profileNodes)
+        {
+            return true;
+        }
+
+        if (PerformanceTracker* tracker = SystemComponent::ModPerformanceTracker())
+        {
+            if (isInput)
+            {
+                tracker->ReportNodeSignalIn(assetId, debugExecution.m_namedEndpoint);
+            }
+            else
+            {
+                tracker->ReportNodeSignalOut(assetId, debugExecution.m_namedEndpoint);
+            }
+        }
+
+        return IsObserved(executionState);
+    }
 }
 
 namespace ScriptCanvas
@@ -60,9 +92,7 @@ namespace ScriptCanvas
             AZ_Assert(executionState, "Error in compiled lua file, 1st argument to DebugIsTraced is not an ExecutionStateInterpreted");
             if (executionState)
             {
-                bool isObserved{};
-                ExecutionNotificationsBus::BroadcastResult(isObserved, &ExecutionNotifications::IsGraphObserved, executionState->GetEntityId(), executionState->GetGraphIdentifier());
-                lua_pushboolean(lua, isObserved);
+                lua_pushboolean(lua, sc_profileNodes || ExecutionInterpretedDebugAPIcpp::IsObserved(*executionState));
             }
             else
             {
@@ -96,6 +126,11 @@ namespace ScriptCanvas
 
             if (const Grammar::DebugExecution* debugIn = executionState->GetDebugSymbolIn(debugExecutionIndex))
             {
+                if (!ExecutionInterpretedDebugAPIcpp::ProfileSignal(*executionState, executionState->GetAssetId(), *debugIn, true))
+                {
+                    return 0;
+                }
+
                 InputSignal inSignal(GraphInfo(executionState->GetEntityId(), executionState->GetGraphIdentifier()));
                 inSignal.m_endpoint = debugIn->m_namedEndpoint;
                 ExecutionInterpretedDebugAPIcpp::PopulateSignalData(lua, 3, inSignal, debugIn->m_data);
@@ -120,6 +155,11 @@ namespace ScriptCanvas
 
             if (const Grammar::DebugExecution* debugIn = executionState->GetDebugSymbolIn(debugExecutionIndex, subgraphId))
             {
+                if (!ExecutionInterpretedDebugAPIcpp::ProfileSignal(*executionState, subgraphId, *debugIn, true))
+                {
+                    return 0;
+                }
+
                 InputSignal inSignal(GraphInfo(executionState->GetEntityId(), executionState->GetGraphIdentifier(subgraphId)));
                 inSignal.m_endpoint = debugIn->m_namedEndpoint;
                 ExecutionInterpretedDebugAPIcpp::PopulateSignalData(lua, 4, inSignal, debugIn->m_data);
@@ -141,6 +181,11 @@ namespace ScriptCanvas
 
             if (const Grammar::DebugExecution* debugOut = executionState->GetDebugSymbolOut(debugExecutionIndex))
             {
+                if (!ExecutionInterpretedDebugAPIcpp::ProfileSignal(*executionState, executionState->GetAssetId(), *debugOut, false))
+                {
+                    return 0;
+                }
+
                 OutputSignal outSignal(GraphInfo(executionState->GetEntityId(), executionState->GetGraphIdentifier()));
                 outSignal.m_endpoint = debugOut->m_namedEndpoint;
                 ExecutionInterpretedDebugAPIcpp::PopulateSignalData(lua, 3, outSignal, debugOut->m_data);
@@ -165,6 +210,11 @@ namespace ScriptCanvas
 
             if (const Grammar::DebugExecution* debugOut = executionState->GetDebugSymbolOut(debugExecutionIndex, subgraphId))
             {
+                if (!ExecutionInterpretedDebugAPIcpp::ProfileSignal(*executionState, subgraphId, *debugOut, false))
+                {
+                    return 0;
+                }
+
                 OutputSignal outSignal(GraphInfo(executionState->GetEntityId(), executionState->GetGraphIdentifier(subgraphId)));
                 outSignal.m_endpoint = debugOut->m_namedEndpoint;
                 ExecutionInterpretedDebugAPIcpp::PopulateSignalData(lua, 4, outSignal, debugOut->m_data);
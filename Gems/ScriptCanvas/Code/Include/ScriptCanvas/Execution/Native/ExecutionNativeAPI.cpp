@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "ExecutionNativeAPI.h"
+
+#include <AzCore/RTTI/BehaviorContext.h>
+#include <AzCore/std/containers/fixed_vector.h>
+#include <ScriptCanvas/Utils/BehaviorContextUtils.h>
+
+namespace ExecutionNativeAPICpp
+{
+    constexpr size_t k_maxArgumentCount = 16;
+    constexpr double k_numberEqualityTolerance = 0.000001;
+}
+
+namespace ScriptCanvas
+{
+    namespace Execution
+    {
+        const AZ::BehaviorMethod* FindNativeMethod(AZStd::string_view className, AZStd::string_view methodName)
+        {
+            const AZ::BehaviorMethod* method = nullptr;
+            constexpr bool warnOnMissing = false;
+
+            if (className.empty())
+            {
+                BehaviorContextUtils::FindFree(method, methodName, warnOnMissing);
+            }
+            else
+            {
+                const AZ::BehaviorClass* behaviorClass = nullptr;
+                BehaviorContextUtils::FindClass(method, behaviorClass, className, methodName, PropertyStatus::None, nullptr, warnOnMissing);
+            }
+
+            return method;
+        }
+
+        Datum CallNativeMethod(const AZ::BehaviorMethod* method, AZStd::initializer_list<const Datum*> arguments)
+        {
+            using namespace ExecutionNativeAPICpp;
+
+            if (arguments.size() != method->GetNumArguments() || arguments.size() > k_maxArgumentCount)
+            {
+                AZ_Error("ScriptCanvas", false, "Native call of %s failed, expected %zu arguments, got %zu", method->m_name.c_str(), method->GetNumArguments(), arguments.size());
+                return Datum();
+            }
+
+            AZStd::fixed_vector<AZ::BehaviorValueParameter, k_maxArgumentCount> parameters;
+            size_t argumentIndex = 0;
+            for (const Datum* argument : arguments)
+            {
+                auto parameterOutcome = argument->ToBehaviorValueParameter(*method->GetArgument(argumentIndex++));
+                if (!parameterOutcome.IsSuccess())
+                {
+                    AZ_Error("ScriptCanvas", false, "Native call of %s failed: %s", method->m_name.c_str(), parameterOutcome.GetError().c_str());
+                    return Datum();
+                }
+
+                parameters.push_back(parameterOutcome.TakeValue());
+            }
+
+            const unsigned int parameterCount = aznumeric_caster(parameters.size());
+
+            if (method->HasResult())
+            {
+                auto resultOutcome = Datum::CallBehaviorContextMethodResult(method, method->GetResult(), parameters.data(), parameterCount, method->m_name);
+                if (resultOutcome.IsSuccess())
+                {
+                    return resultOutcome.TakeValue();
+                }
+
+                AZ_Error("ScriptCanvas", false, "%s", resultOutcome.GetError().c_str());
+            }
+            else
+            {
+                auto callOutcome = Datum::CallBehaviorContextMethod(method, parameters.data(), parameterCount);
+                AZ_Error("ScriptCanvas", callOutcome.IsSuccess(), "%s", callOutcome.IsSuccess() ? "" : callOutcome.GetError().c_str());
+            }
+
+            return Datum();
+        }
+
+        bool NativeCompare(const ComparisonOutcome& outcome)
+        {
+            if (outcome.IsSuccess())
+            {
+                return outcome.GetValue();
+            }
+
+            AZ_Error("ScriptCanvas", false, "Native comparison failed: %s", outcome.GetError().c_str());
+            return false;
+        }
+
+        bool NativeIsClose(const Datum& lhs, const Datum& rhs)
+        {
+            return AZStd::abs(NativeToNumber(lhs) - NativeToNumber(rhs)) <= ExecutionNativeAPICpp::k_numberEqualityTolerance;
+        }
+
+        bool NativeToBoolean(const Datum& datum)
+        {
+            const Data::BooleanType* value = datum.GetAs<Data::BooleanType>();
+            return value && *value;
+        }
+
+        Data::NumberType NativeToNumber(const Datum& datum)
+        {
+            const Data::NumberType* value = datum.GetAs<Data::NumberType>();
+            return value ? *value : Data::NumberType(0);
+        }
+
+        const Data::StringType& NativeToString(const Datum& datum)
+        {
+            static const Data::StringType k_emptyString;
+            const Data::StringType* value = datum.GetAs<Data::StringType>();
+            return value ? *value : k_emptyString;
+        }
+    }
+}
@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/base.h>
+#include <AzCore/std/string/string_view.h>
+
+#include <ScriptCanvas/Core/Datum.h>
+
+namespace AZ
+{
+    class BehaviorMethod;
+}
+
+namespace ScriptCanvas
+{
+    namespace Execution
+    {
+        // Functions called by the C++ source generated from graphs (see Translation::GraphToCPlusPlus). Values are kept in Datums,
+        // so BehaviorContext methods are called directly, the same way nodes did before graphs got translated to Lua.
+
+        // Finds a method by class and method name, or a free function when className is empty. Returns nullptr when it doesn't exist.
+        const AZ::BehaviorMethod* FindNativeMethod(AZStd::string_view className, AZStd::string_view methodName);
+
+        // Calls the method with the arguments converted to its parameters. Returns the result, or an empty Datum when the method
+        // has no result or the call failed.
+        Datum CallNativeMethod(const AZ::BehaviorMethod* method, AZStd::initializer_list<const Datum*> arguments);
+
+        bool NativeCompare(const ComparisonOutcome& outcome);
+
+        // Number equality uses the same tolerance as the interpreted translation.
+        bool NativeIsClose(const Datum& lhs, const Datum& rhs);
+
+        bool NativeToBoolean(const Datum& datum);
+
+        Data::NumberType NativeToNumber(const Datum& datum);
+
+        const Data::StringType& NativeToString(const Datum& datum);
+    }
+}
@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "ExecutionStateNative.h"
+
+#include <ScriptCanvas/Execution/NativeHostDefinitions.h>
+
+namespace ScriptCanvas
+{
+    bool ExecutionStateNativePureOnGraphStart::IsAvailable(const ExecutionStateConfig& config)
+    {
+        return IsNativeGraphStartRegistered(GetNativeGraphName(config.asset.GetId()));
+    }
+
+    ExecutionStateNativePureOnGraphStart::ExecutionStateNativePureOnGraphStart(const ExecutionStateConfig& config)
+        : ExecutionState(config)
+        , m_nativeName(GetNativeGraphName(config.asset.GetId()))
+    {}
+
+    void ExecutionStateNativePureOnGraphStart::Execute()
+    {
+        const RuntimeContext context(GetScriptCanvasId());
+        const bool isCalled = CallNativeGraphStart(m_nativeName, context);
+        AZ_Error("ScriptCanvas", isCalled, "Native start of graph %s is no longer registered", m_nativeName.c_str());
+    }
+
+    ExecutionMode ExecutionStateNativePureOnGraphStart::GetExecutionMode() const
+    {
+        return ExecutionMode::Native;
+    }
+
+    void ExecutionStateNativePureOnGraphStart::Initialize()
+    {}
+
+    void ExecutionStateNativePureOnGraphStart::StopExecution()
+    {}
+}
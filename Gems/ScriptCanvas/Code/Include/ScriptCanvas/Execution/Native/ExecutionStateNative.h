@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/string/string.h>
+
+#include "Execution/ExecutionState.h"
+
+namespace ScriptCanvas
+{
+    // Executes a pure graph with an On Graph Start, using the start function compiled from its C++ translation instead of the Lua
+    // script. Selected when the hosting gem registered the native version of the graph, see RegisterNativeGraphStart.
+    class ExecutionStateNativePureOnGraphStart
+        : public ExecutionState
+    {
+    public:
+        AZ_RTTI(ExecutionStateNativePureOnGraphStart, "{5B0C7AD2-1F5E-4E0B-9C27-0E4C5F2B8A61}", ExecutionState);
+        AZ_CLASS_ALLOCATOR(ExecutionStateNativePureOnGraphStart, AZ::SystemAllocator, 0);
+
+        static bool IsAvailable(const ExecutionStateConfig& config);
+
+        ExecutionStateNativePureOnGraphStart(const ExecutionStateConfig& config);
+
+        void Execute() override;
+
+        ExecutionMode GetExecutionMode() const override;
+
+        void Initialize() override;
+
+        void StopExecution() override;
+
+    private:
+        AZStd::string m_nativeName;
+    };
+}
@@ -32,6 +32,18 @@ namespace ScriptCanvas
         return false;
     }
 
+    AZStd::string GetNativeGraphName(const AZ::Data::AssetId& assetId)
+    {
+        return assetId.m_guid.ToString<AZStd::string>();
+    }
+
+    bool IsNativeGraphStartRegistered(AZStd::string_view name)
+    {
+        using namespace NativeHostDefinitionsCPP;
+
+        return s_functionMap.find(name) != s_functionMap.end();
+    }
+
     bool RegisterNativeGraphStart(AZStd::string_view name, GraphStartFunction function)
     {
         using namespace NativeHostDefinitionsCPP;
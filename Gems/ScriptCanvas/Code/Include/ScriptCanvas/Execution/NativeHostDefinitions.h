@@ -5,6 +5,9 @@
  *
  */
 
+#include <AzCore/Asset/AssetCommon.h>
+#include <AzCore/std/string/string.h>
+
 #include "NativeHostDeclarations.h"
 
 namespace ScriptCanvas
@@ -14,6 +17,11 @@ namespace ScriptCanvas
     using GraphStartFunction = void(*)(const RuntimeContext&);
 
     bool CallNativeGraphStart(AZStd::string_view name, const RuntimeContext& context);
+
+    // the name the C++ translation of a graph registers its start function with
+    AZStd::string GetNativeGraphName(const AZ::Data::AssetId& assetId);
+
+    bool IsNativeGraphStartRegistered(AZStd::string_view name);
     
     bool RegisterNativeGraphStart(AZStd::string_view name, GraphStartFunction function);
     
@@ -246,6 +246,7 @@ namespace ScriptCanvas
         AZ_CVAR_EXTERNED(bool, g_printAbstractCodeModelAtPrefabTime);
         AZ_CVAR_EXTERNED(bool, g_saveRawTranslationOuputToFile);
         AZ_CVAR_EXTERNED(bool, g_saveRawTranslationOuputToFileAtPrefabTime);
+        AZ_CVAR_EXTERNED(bool, g_translateToNativeSource);
 
         struct DependencyInfo
         {
@@ -265,6 +266,7 @@ namespace ScriptCanvas
             bool addDebugInformation = true;
             bool rawSaveDebugOutput = false;
             bool printModelToConsole = false;
+            bool saveNativeSource = false;
         };
 
         struct Source
@@ -6,6 +6,10 @@
  */
 #pragma once
 
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/parallel/thread.h>
+#include <ScriptCanvas/Core/Endpoint.h>
 #include <ScriptCanvas/Execution/ExecutionBus.h>
 #include <ScriptCanvas/Execution/ExecutionPerformanceTimer.h>
 
@@ -13,6 +17,8 @@ namespace ScriptCanvas
 {
     namespace Execution
     {
+        AZ_CVAR_EXTERNED(bool, sc_profileNodes);
+
         class PerformanceTimer;
                 
         class PerformanceTracker
@@ -35,6 +41,8 @@ namespace ScriptCanvas
 
             void ClearSnapshotReport();
 
+            void ClearNodeReport();
+
             void FinalizeReport(PerformanceKey key, const AZ::Data::AssetId& assetId);
 
             PerformanceTrackingReport GetGlobalReport() const;
@@ -44,6 +52,12 @@ namespace ScriptCanvas
             // Not thread safe
             const PerformanceReport& GetGlobalReportFull() const;
 
+            AZStd::vector<PerformanceNodeReport> GetNodeReport() const;
+
+            // The exclusive time of every execution path in the collapsed stack format read by flamegraph.pl and compatible viewers,
+            // one "graph;node;node microseconds" line per path.
+            AZStd::string GetNodeReportCollapsedStacks() const;
+
             PerformanceTrackingReport GetSnapshotReport() const;
             
             PerformanceTrackingReport GetSnapshotReportByAsset(const AZ::Data::AssetId& assetId) const;
@@ -51,6 +65,12 @@ namespace ScriptCanvas
             // Not thread safe
             const PerformanceReport& GetSnapshotReportFull() const;
 
+            // Node timing is driven by the debug signals, which only graphs executing their debug configuration send. An execution
+            // path is the chain of nodes leading up to a node, where each node got signaled by an output of the one before it.
+            void ReportNodeSignalIn(const AZ::Data::AssetId& assetId, const NamedEndpoint& endpoint);
+
+            void ReportNodeSignalOut(const AZ::Data::AssetId& assetId, const NamedEndpoint& endpoint);
+
         private:
             static PerformanceTrackingReport* ModOrCreateReport(PerformanceReportByAsset& reports, AZ::Data::AssetId key);
             static PerformanceTrackingReport GetReportByAsset(const PerformanceReportByAsset& report, AZ::Data::AssetId key);
@@ -87,6 +107,69 @@ namespace ScriptCanvas
             void ReportLatentTime(PerformanceKey key, const AZ::Data::AssetId& assetId, AZStd::sys_time_t);
 
             void ReportInitializationTime(PerformanceKey key, const AZ::Data::AssetId& assetId, AZStd::sys_time_t);
+
+            static constexpr size_t k_noNodePath = AZStd::numeric_limits<size_t>::max();
+            static constexpr AZ::u32 k_maxNodePathDepth = 64;
+
+            struct NodeKey
+            {
+                AZ::Data::AssetId assetId;
+                AZ::EntityId nodeId;
+
+                bool operator==(const NodeKey& other) const;
+            };
+
+            struct NodeKeyHasher
+            {
+                size_t operator()(const NodeKey& key) const;
+            };
+
+            struct NodePathKey
+            {
+                size_t parent;
+                NodeKey node;
+
+                bool operator==(const NodePathKey& other) const;
+            };
+
+            struct NodePathKeyHasher
+            {
+                size_t operator()(const NodePathKey& key) const;
+            };
+
+            struct NodePath
+            {
+                size_t parent = k_noNodePath;
+                AZ::u32 depth = 0;
+                NodeKey node;
+                AZStd::string nodeName;
+                AZStd::sys_time_t exclusiveTicks = 0;
+                AZ::u32 executionCount = 0;
+                // entry paths are signaled by their output only
+                bool isEntry = false;
+            };
+
+            struct NodeThreadState
+            {
+                // the node signaled last, which is charged with the time until the next signal
+                size_t openPath = k_noNodePath;
+                AZStd::sys_time_t openTicks = 0;
+                // the node whose output got signaled last, the parent of the next node signaled
+                size_t parentPath = k_noNodePath;
+                AZStd::unordered_map<NodeKey, size_t, NodeKeyHasher> lastPathByNode;
+            };
+
+            mutable AZStd::mutex m_nodeMutex;
+            AZStd::vector<NodePath> m_nodePaths;
+            AZStd::unordered_map<NodePathKey, size_t, NodePathKeyHasher> m_nodePathIndices;
+            AZStd::unordered_map<AZStd::thread_id, NodeThreadState> m_nodeThreadStates;
+
+            void CloseOpenNodePath(NodeThreadState& state, AZStd::sys_time_t nowTicks);
+
+            size_t GetOrCreateNodePath(size_t parent, const AZ::Data::AssetId& assetId, const NamedEndpoint& endpoint);
+
+            // inclusive ticks of every path, indexed like m_nodePaths
+            AZStd::vector<AZStd::sys_time_t> GetNodePathInclusiveTicks() const;
         };
     }
 }
@@ -1,14 +1,59 @@
 /*
  * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
- * 
+ *
  * SPDX-License-Identifier: Apache-2.0 OR MIT
  *
  */
 
 #include "GraphToCPlusPlus.h"
 
+#include <cmath>
+
+#include <AzCore/std/sort.h>
+#include <ScriptCanvas/Data/Data.h>
+#include <ScriptCanvas/Execution/NativeHostDefinitions.h>
 #include <ScriptCanvas/Grammar/AbstractCodeModel.h>
+#include <ScriptCanvas/Grammar/ParsingUtilities.h>
 #include <ScriptCanvas/Grammar/Primitives.h>
+#include <ScriptCanvas/Grammar/PrimitivesExecution.h>
+
+namespace GraphToCPlusPlusCpp
+{
+    constexpr const char* k_constantPrefix = "k_nativeConstant";
+
+    AZStd::string ToStringLiteral(AZStd::string_view text)
+    {
+        AZStd::string literal = "\"";
+
+        for (const char character : text)
+        {
+            switch (character)
+            {
+            case '\\':
+                literal += "\\\\";
+                break;
+            case '"':
+                literal += "\\\"";
+                break;
+            case '\n':
+                literal += "\\n";
+                break;
+            case '\r':
+                literal += "\\r";
+                break;
+            case '\t':
+                literal += "\\t";
+                break;
+            default:
+                literal += character;
+                break;
+            }
+        }
+
+        literal += "\"";
+        return literal;
+    }
+}
 
 namespace ScriptCanvas
 {
@@ -29,42 +74,349 @@ namespace ScriptCanvas
         }
 
         GraphToCPlusPlus::GraphToCPlusPlus(const Grammar::AbstractCodeModel& model)
-            : GraphToX(CreateCPlusPluseConfig(), model) 
-        {
-            WriteHeaderDotH();
-            WriteHeaderDotCPP();
-            
-            TranslateDependenciesDotH();
-            TranslateDependenciesDotCPP();
-                        
-            TranslateNamespaceOpen();
-            {
-                TranslateClassOpen();
-                {
-                    TranslateVariables();
-                    TranslateHandlers();
-                    TranslateConstruction();
-                    TranslateDestruction();
-                    TranslateStartNode();
+            : GraphToX(CreateCPlusPluseConfig(), model)
+            , m_className(Grammar::ToIdentifier(model.GetSource().m_name))
+        {
+            MarkTranslationStart();
+
+            // the start function is translated first, it determines the methods and constants the rest of the files refer to
+            if (CheckGraphSupported())
+            {
+                TranslateStartNode();
+            }
+
+            if (IsSuccessfull())
+            {
+                WriteHeaderDotH();
+                WriteHeaderDotCPP();
+
+                TranslateNamespaceOpen();
+                {
+                    TranslateClassOpen();
+                    TranslateClassClose();
+                    TranslateMethodTable();
+                    TranslateRegistration();
+                    m_dotCPP.Write(m_startFunction.GetOutput());
+                }
+                TranslateNamespaceClose();
+            }
+
+            MarkTranslationStop();
+        }
+
+        void GraphToCPlusPlus::AddUnsupported(Grammar::ExecutionTreeConstPtr execution, AZStd::string_view reason)
+        {
+            if (execution && !execution->GetName().empty())
+            {
+                m_unsupported.push_back(AZStd::string::format("%s: %.*s (%s)", m_className.c_str(), aznumeric_cast<int>(reason.size()), reason.data(), execution->GetName().c_str()));
+            }
+            else
+            {
+                m_unsupported.push_back(AZStd::string::format("%s: %.*s", m_className.c_str(), aznumeric_cast<int>(reason.size()), reason.data()));
+            }
+        }
+
+        bool GraphToCPlusPlus::CheckGraphSupported()
+        {
+            if (m_model.GetExecutionCharacteristics() != Grammar::ExecutionCharacteristics::Pure)
+            {
+                AddUnsupported(nullptr, "graph requires per entity state");
+            }
+
+            if (!m_model.GetStart())
+            {
+                AddUnsupported(nullptr, "graph has no On Graph Start");
+            }
+
+            if (!m_model.GetFunctions().empty())
+            {
+                AddUnsupported(nullptr, "graph defines functions");
+            }
+
+            if (!m_model.GetEBusHandlings().empty() || !m_model.GetEventHandlings().empty())
+            {
+                AddUnsupported(nullptr, "graph handles events");
+            }
+
+            if (!m_model.GetNodeableParse().empty())
+            {
+                AddUnsupported(nullptr, "graph uses nodeables");
+            }
+
+            if (!m_model.GetOrderedDependencies().orderedAssetIds.empty())
+            {
+                AddUnsupported(nullptr, "graph depends on other graphs");
+            }
+
+            const Grammar::ParsedRuntimeInputs& runtimeInputs = m_model.GetRuntimeInputs();
+            if (!runtimeInputs.m_nodeables.empty() || !runtimeInputs.m_variables.empty() || !runtimeInputs.m_entityIds.empty() || !runtimeInputs.m_staticVariables.empty())
+            {
+                AddUnsupported(nullptr, "graph requires input from its runtime component");
+            }
+
+            return m_unsupported.empty();
+        }
+
+        AZStd::string GraphToCPlusPlus::GetOperand(Grammar::ExecutionTreeConstPtr execution, size_t index)
+        {
+            const Grammar::VariableConstPtr& input = execution->GetInput(index).m_value;
+
+            // matches GraphToLua::IsInputNamed, everything else is a value written in place
+            if (input->m_source != execution || input->m_requiresCreationFunction)
+            {
+                return GetVariableName(execution, input);
+            }
+
+            // function local statics, so values that allocate, like strings, are only constructed once
+            const AZStd::string name = AZStd::string::format("%s%zu", GraphToCPlusPlusCpp::k_constantPrefix, m_constantCount++);
+            m_startFunction.WriteLineIndented("static const ScriptCanvas::Datum %s(%s);", name.c_str(), ToValue(execution, input->m_datum).c_str());
+            return name;
+        }
+
+        AZStd::vector<AZStd::string> GraphToCPlusPlus::GetOperands(Grammar::ExecutionTreeConstPtr execution)
+        {
+            AZStd::vector<AZStd::string> operands;
+            operands.reserve(execution->GetInputCount());
+
+            for (size_t index = 0; index < execution->GetInputCount(); ++index)
+            {
+                operands.push_back(GetOperand(execution, index));
+            }
+
+            return operands;
+        }
+
+        AZStd::string GraphToCPlusPlus::GetVariableName(Grammar::ExecutionTreeConstPtr execution, Grammar::VariableConstPtr variable)
+        {
+            if (variable->m_isMember)
+            {
+                AddUnsupported(execution, "member variables are not supported");
+            }
+
+            return variable->m_name;
+        }
+
+        bool GraphToCPlusPlus::IsSuccessfull() const
+        {
+            return GraphToX::IsSuccessfull() && m_unsupported.empty();
+        }
+
+        AZStd::string GraphToCPlusPlus::ToArithmeticExpression(Grammar::ExecutionTreeConstPtr execution, const AZStd::vector<AZStd::string>& operands)
+        {
+            if (operands.size() < 2)
+            {
+                AddUnsupported(execution, "arithmetic requires at least two operands");
+                return "";
+            }
+
+            const Data::Type& type = execution->GetInput(0).m_value->m_datum.GetType();
+
+            if (type == Data::Type::String() && execution->GetSymbol() == Grammar::Symbol::OperatorAddition)
+            {
+                AZStd::string expression = AZStd::string::format("ScriptCanvas::Data::StringType(ScriptCanvas::Execution::NativeToString(%s))", operands[0].c_str());
+
+                for (size_t index = 1; index < operands.size(); ++index)
+                {
+                    expression += AZStd::string::format(" + ScriptCanvas::Execution::NativeToString(%s)", operands[index].c_str());
+                }
+
+                return AZStd::string::format("ScriptCanvas::Datum(%s)", expression.c_str());
+            }
+
+            if (type != Data::Type::Number())
+            {
+                AddUnsupported(execution, AZStd::string::format("arithmetic on %s is not supported", Data::GetName(type).c_str()));
+                return "";
+            }
+
+            const char* operatorString = nullptr;
+
+            switch (execution->GetSymbol())
+            {
+            case Grammar::Symbol::OperatorAddition:
+                operatorString = " + ";
+                break;
+            case Grammar::Symbol::OperatorDivision:
+                operatorString = " / ";
+                break;
+            case Grammar::Symbol::OperatorMultiplication:
+                operatorString = " * ";
+                break;
+            case Grammar::Symbol::OperatorSubraction:
+                operatorString = " - ";
+                break;
+            default:
+                AddUnsupported(execution, "unknown arithmetic operator");
+                return "";
+            }
+
+            // left to right, the same order the Lua translation evaluates in
+            AZStd::string expression = AZStd::string::format("ScriptCanvas::Execution::NativeToNumber(%s)", operands[0].c_str());
+
+            for (size_t index = 1; index < operands.size(); ++index)
+            {
+                expression = AZStd::string::format("(%s%sScriptCanvas::Execution::NativeToNumber(%s))", expression.c_str(), operatorString, operands[index].c_str());
+            }
+
+            return AZStd::string::format("ScriptCanvas::Datum(%s)", expression.c_str());
+        }
+
+        AZStd::string GraphToCPlusPlus::ToFunctionCallExpression(Grammar::ExecutionTreeConstPtr execution, const AZStd::vector<AZStd::string>& operands)
+        {
+            if (execution->GetEventType() != EventType::Count)
+            {
+                AddUnsupported(execution, "sending events is not supported");
+                return "";
+            }
+
+            const AZStd::string& methodName = execution->GetName();
+            if (methodName.empty())
+            {
+                AddUnsupported(execution, "function call without a name");
+                return "";
+            }
+
+            const Grammar::LexicalScope& lexicalScope = execution->GetNameLexicalScope();
+            AZStd::string className;
+
+            if (lexicalScope.m_type == Grammar::LexicalScopeType::Class && lexicalScope.m_namespaces.size() == 1)
+            {
+                className = lexicalScope.m_namespaces.front();
+            }
+            else if (lexicalScope.m_type != Grammar::LexicalScopeType::Namespace || !lexicalScope.m_namespaces.empty())
+            {
+                AddUnsupported(execution, "only free functions and methods of a single class are supported");
+                return "";
+            }
+
+            auto methodIter = AZStd::find_if(m_methods.begin(), m_methods.end(), [&](const MethodReference& method)
+                {
+                    return method.m_className == className && method.m_methodName == methodName;
+                });
+
+            const size_t methodIndex = aznumeric_caster(AZStd::distance(m_methods.begin(), methodIter));
+            if (methodIter == m_methods.end())
+            {
+                m_methods.push_back({ className, methodName });
+            }
+
+            AZStd::string arguments;
+            for (const AZStd::string& operand : operands)
+            {
+                arguments += arguments.empty() ? " &" : ", &";
+                arguments += operand;
+            }
+
+            return AZStd::string::format("ScriptCanvas::Execution::CallNativeMethod(%sCPP::s_methods[%zu], {%s%s})"
+                , m_className.c_str(), methodIndex, arguments.c_str(), arguments.empty() ? "" : " ");
+        }
+
+        AZStd::string GraphToCPlusPlus::ToLogicalExpression(Grammar::ExecutionTreeConstPtr execution, const AZStd::vector<AZStd::string>& operands)
+        {
+            const Grammar::Symbol symbol = execution->GetSymbol();
+
+            if (symbol == Grammar::Symbol::IsNull)
+            {
+                AddUnsupported(execution, "null checks are not supported");
+                return "";
+            }
+
+            if (symbol == Grammar::Symbol::LogicalNOT && operands.size() == 1)
+            {
+                return AZStd::string::format("ScriptCanvas::Datum(!ScriptCanvas::Execution::NativeToBoolean(%s))", operands[0].c_str());
+            }
+
+            if (operands.size() != 2)
+            {
+                AddUnsupported(execution, "logical expression with an unexpected number of operands");
+                return "";
+            }
+
+            const char* lhs = operands[0].c_str();
+            const char* rhs = operands[1].c_str();
+
+            if (Grammar::IsFloatingPointNumberEqualityComparison(execution))
+            {
+                return AZStd::string::format("ScriptCanvas::Datum(%sScriptCanvas::Execution::NativeIsClose(%s, %s))", symbol == Grammar::Symbol::CompareEqual ? "" : "!", lhs, rhs);
+            }
+
+            switch (symbol)
+            {
+            case Grammar::Symbol::LogicalAND:
+                return AZStd::string::format("ScriptCanvas::Datum(ScriptCanvas::Execution::NativeToBoolean(%s) && ScriptCanvas::Execution::NativeToBoolean(%s))", lhs, rhs);
+            case Grammar::Symbol::LogicalOR:
+                return AZStd::string::format("ScriptCanvas::Datum(ScriptCanvas::Execution::NativeToBoolean(%s) || ScriptCanvas::Execution::NativeToBoolean(%s))", lhs, rhs);
+            case Grammar::Symbol::CompareEqual:
+                return AZStd::string::format("ScriptCanvas::Datum(ScriptCanvas::Execution::NativeCompare(%s == %s))", lhs, rhs);
+            case Grammar::Symbol::CompareGreater:
+                return AZStd::string::format("ScriptCanvas::Datum(ScriptCanvas::Execution::NativeCompare(%s > %s))", lhs, rhs);
+            case Grammar::Symbol::CompareGreaterEqual:
+                return AZStd::string::format("ScriptCanvas::Datum(ScriptCanvas::Execution::NativeCompare(%s >= %s))", lhs, rhs);
+            case Grammar::Symbol::CompareLess:
+                return AZStd::string::format("ScriptCanvas::Datum(ScriptCanvas::Execution::NativeCompare(%s < %s))", lhs, rhs);
+            case Grammar::Symbol::CompareLessEqual:
+                return AZStd::string::format("ScriptCanvas::Datum(ScriptCanvas::Execution::NativeCompare(%s <= %s))", lhs, rhs);
+            case Grammar::Symbol::CompareNotEqual:
+                return AZStd::string::format("ScriptCanvas::Datum(ScriptCanvas::Execution::NativeCompare(%s != %s))", lhs, rhs);
+            default:
+                AddUnsupported(execution, "unknown logical expression");
+                return "";
+            }
+        }
+
+        AZStd::string GraphToCPlusPlus::ToValue(Grammar::ExecutionTreeConstPtr execution, const Datum& datum)
+        {
+            switch (datum.GetType().GetType())
+            {
+            case Data::eType::Boolean:
+                return *datum.GetAs<Data::BooleanType>() ? "true" : "false";
+
+            case Data::eType::Number:
+            {
+                const Data::NumberType value = *datum.GetAs<Data::NumberType>();
+                if (std::isfinite(value))
+                {
+                    return AZStd::string::format("ScriptCanvas::Data::NumberType(%.17g)", value);
                 }
-                TranslateClassClose();
+                break;
             }
-            TranslateNamespaceClose();
+
+            case Data::eType::String:
+                return AZStd::string::format("ScriptCanvas::Data::StringType(%s)", GraphToCPlusPlusCpp::ToStringLiteral(*datum.GetAs<Data::StringType>()).c_str());
+
+            default:
+                break;
+            }
+
+            AddUnsupported(execution, AZStd::string::format("values of type %s can't be written as C++", Data::GetName(datum.GetType()).c_str()));
+            return "";
         }
 
-        AZ::Outcome<void, AZStd::pair<AZStd::string, AZStd::string>> GraphToCPlusPlus::Translate(const Grammar::AbstractCodeModel& model, AZStd::string& dotH, AZStd::string& dotCPP)
+        AZ::Outcome<AZStd::pair<TargetResult, TargetResult>, ErrorList> GraphToCPlusPlus::Translate(const Grammar::AbstractCodeModel& model)
         {
             GraphToCPlusPlus translation(model);
 
             if (translation.IsSuccessfull())
             {
-                dotH = AZStd::move(translation.m_dotH.MoveOutput());
-                dotCPP = AZStd::move(translation.m_dotCPP.MoveOutput());
-                return AZ::Success();
+                TargetResult dotH;
+                dotH.m_text = translation.m_dotH.MoveOutput();
+                dotH.m_duration = 0;
+
+                TargetResult dotCPP;
+                dotCPP.m_text = translation.m_dotCPP.MoveOutput();
+                dotCPP.m_subgraphInterface = model.GetInterface();
+                dotCPP.m_duration = translation.GetTranslationDuration();
+
+                return AZ::Success(AZStd::make_pair(AZStd::move(dotH), AZStd::move(dotCPP)));
             }
             else
             {
-                return AZ::Failure(AZStd::make_pair(AZStd::string(".h errors"), AZStd::string(".cpp errors")));
+                if (translation.m_unsupported.empty())
+                {
+                    translation.AddUnsupported(nullptr, "translation failed");
+                }
+
+                return AZ::Failure(AZStd::move(translation.m_unsupported));
             }
         }
 
@@ -76,47 +428,223 @@ namespace ScriptCanvas
             m_dotH.WriteSpace();
             SingleLineComment(m_dotH);
             m_dotH.WriteSpace();
-            m_dotH.WriteLine("class %s", GetGraphName().data());
+            m_dotH.WriteLine("class %s", m_className.c_str());
         }
 
         void GraphToCPlusPlus::TranslateClassOpen()
         {
             m_dotH.WriteIndent();
-            m_dotH.WriteLine("class %s", GetGraphName().data());
+            m_dotH.WriteLine("class %s", m_className.c_str());
             m_dotH.WriteIndent();
             m_dotH.WriteLine("{");
+            m_dotH.WriteLineIndented("public:");
             m_dotH.Indent();
+            m_dotH.WriteLineIndented("// Resolves the BehaviorContext methods the graph calls, and registers the start function for native execution.");
+            m_dotH.WriteLineIndented("// Returns false, leaving the graph to its Lua translation, when any of them is missing.");
+            m_dotH.WriteLineIndented("static bool Register();");
+            m_dotH.WriteNewLine();
+            m_dotH.WriteLineIndented("static void %s(const RuntimeContext& context);", Grammar::k_OnGraphStartFunctionName);
         }
 
-        void GraphToCPlusPlus::TranslateConstruction()
+        void GraphToCPlusPlus::TranslateExecutionTreeChildren(Grammar::ExecutionTreeConstPtr execution)
         {
+            for (size_t childIndex = 0; childIndex < execution->GetChildrenCount(); ++childIndex)
+            {
+                const auto& child = execution->GetChild(childIndex);
 
+                if (child.m_execution && !child.m_execution->IsInternalOut())
+                {
+                    TranslateExecutionTreeEntry(child.m_execution);
+                }
+            }
         }
 
-        void GraphToCPlusPlus::TranslateDependencies()
+        void GraphToCPlusPlus::TranslateExecutionTreeEntry(Grammar::ExecutionTreeConstPtr execution)
         {
-            TranslateDependenciesDotH();
-            TranslateDependenciesDotCPP();
-        }
+            if (!m_unsupported.empty())
+            {
+                return;
+            }
 
-        void GraphToCPlusPlus::TranslateDependenciesDotH()
-        {
+            const Grammar::Symbol symbol = execution->GetSymbol();
+
+            switch (symbol)
+            {
+            case Grammar::Symbol::Break:
+            case Grammar::Symbol::Cycle:
+            case Grammar::Symbol::ForEach:
+            case Grammar::Symbol::RandomSwitch:
+            case Grammar::Symbol::Switch:
+            case Grammar::Symbol::UserOut:
+            case Grammar::Symbol::While:
+                AddUnsupported(execution, AZStd::string::format("%s is not supported", Grammar::GetSymbolName(symbol)));
+                return;
+
+            case Grammar::Symbol::IfCondition:
+                TranslateExecutionTreeIfCondition(execution);
+                return;
+
+            case Grammar::Symbol::CompareEqual:
+            case Grammar::Symbol::CompareGreater:
+            case Grammar::Symbol::CompareGreaterEqual:
+            case Grammar::Symbol::CompareLess:
+            case Grammar::Symbol::CompareLessEqual:
+            case Grammar::Symbol::CompareNotEqual:
+            case Grammar::Symbol::IsNull:
+            case Grammar::Symbol::LogicalAND:
+            case Grammar::Symbol::LogicalNOT:
+            case Grammar::Symbol::LogicalOR:
+            case Grammar::Symbol::FunctionCall:
+            case Grammar::Symbol::OperatorAddition:
+            case Grammar::Symbol::OperatorDivision:
+            case Grammar::Symbol::OperatorMultiplication:
+            case Grammar::Symbol::OperatorSubraction:
+            case Grammar::Symbol::VariableAssignment:
+                TranslateExecutionTreeFunctionCall(execution);
+                break;
 
+            case Grammar::Symbol::VariableDeclaration:
+            {
+                auto variable = execution->GetInput(0).m_value;
+                m_startFunction.WriteLineIndented("ScriptCanvas::Datum %s(%s);", variable->m_name.c_str(), ToValue(execution, variable->m_datum).c_str());
+                break;
+            }
+
+            default:
+                break;
+            }
+
+            TranslateExecutionTreeChildren(execution);
         }
 
-        void GraphToCPlusPlus::TranslateDependenciesDotCPP()
+        void GraphToCPlusPlus::TranslateExecutionTreeFunctionCall(Grammar::ExecutionTreeConstPtr execution)
         {
+            if (execution->GetNodeable()
+                || !execution->GetConversions().empty()
+                || !execution->GetPropertyExtractionSources().empty()
+                || Grammar::IsExecutedPropertyExtraction(execution)
+                || Grammar::IsEventConnectCall(execution)
+                || Grammar::IsEventDisconnectCall(execution)
+                || Grammar::IsGlobalPropertyRead(execution)
+                || Grammar::IsClassPropertyRead(execution)
+                || Grammar::IsClassPropertyWrite(execution)
+                || Grammar::IsWrittenMathExpression(execution)
+                || Grammar::IsUserFunctionCall(execution)
+                || Grammar::IsFunctionCallNullCheckRequired(execution))
+            {
+                AddUnsupported(execution, "call requires the interpreted runtime");
+                return;
+            }
+
+            if (execution->GetChildrenCount() > 1 || (execution->GetChildrenCount() == 1 && execution->GetChild(0).m_output.size() > 1))
+            {
+                AddUnsupported(execution, "calls with multiple outs or results are not supported");
+                return;
+            }
+
+            const AZStd::vector<AZStd::string> operands = GetOperands(execution);
+            AZStd::string expression;
+            bool isCall = false;
+
+            if (Grammar::IsLogicalExpression(execution))
+            {
+                expression = ToLogicalExpression(execution, operands);
+            }
+            else if (Grammar::IsVariableGet(execution) || Grammar::IsVariableSet(execution) || execution->GetSymbol() == Grammar::Symbol::VariableAssignment)
+            {
+                if (operands.size() == 1)
+                {
+                    expression = operands[0];
+                }
+                else
+                {
+                    AddUnsupported(execution, "variable access with an unexpected number of operands");
+                }
+            }
+            else if (Grammar::IsOperatorArithmetic(execution))
+            {
+                expression = ToArithmeticExpression(execution, operands);
+            }
+            else
+            {
+                expression = ToFunctionCallExpression(execution, operands);
+                isCall = true;
+            }
 
+            if (!m_unsupported.empty())
+            {
+                return;
+            }
+
+            Grammar::VariableConstPtr result;
+            if (execution->GetChildrenCount() == 1 && !execution->GetChild(0).m_output.empty())
+            {
+                result = execution->GetChild(0).m_output[0].second->m_source;
+            }
+
+            if (result)
+            {
+                if (result->m_source == execution)
+                {
+                    m_startFunction.WriteLineIndented("ScriptCanvas::Datum %s = %s;", result->m_name.c_str(), expression.c_str());
+                }
+                else
+                {
+                    m_startFunction.WriteLineIndented("%s = %s;", GetVariableName(execution, result).c_str(), expression.c_str());
+                }
+            }
+            else if (isCall)
+            {
+                m_startFunction.WriteLineIndented("%s;", expression.c_str());
+            }
+
+            WriteOutputAssignments(execution);
         }
 
-        void GraphToCPlusPlus::TranslateDestruction()
+        void GraphToCPlusPlus::TranslateExecutionTreeIfCondition(Grammar::ExecutionTreeConstPtr execution)
         {
+            const size_t childCount = execution->GetChildrenCount();
+
+            if (execution->GetInputCount() != 1 || childCount > 2)
+            {
+                AddUnsupported(execution, "if condition with an unexpected number of inputs or outs");
+                return;
+            }
+
+            const AZStd::string condition = GetOperand(execution, 0);
+            m_startFunction.WriteLineIndented("if (ScriptCanvas::Execution::NativeToBoolean(%s))", condition.c_str());
+
+            // always write the true block, an if without one doesn't compile
+            for (size_t childIndex = 0; childIndex < AZStd::max(childCount, size_t(1)); ++childIndex)
+            {
+                if (childIndex > 0)
+                {
+                    m_startFunction.WriteLineIndented("else");
+                }
+
+                OpenScope(m_startFunction);
+
+                if (childIndex < childCount)
+                {
+                    const auto& child = execution->GetChild(childIndex);
+
+                    if (child.m_execution && !child.m_execution->IsInternalOut())
+                    {
+                        TranslateExecutionTreeEntry(child.m_execution);
+                    }
+                }
 
+                CloseScope(m_startFunction);
+            }
         }
-                
-        void GraphToCPlusPlus::TranslateHandlers()
-        {
 
+        void GraphToCPlusPlus::TranslateMethodTable()
+        {
+            m_dotCPP.WriteLineIndented("namespace %sCPP", m_className.c_str());
+            OpenScope(m_dotCPP);
+            m_dotCPP.WriteLineIndented("AZStd::array<const AZ::BehaviorMethod*, %zu> s_methods = {};", m_methods.size());
+            CloseScope(m_dotCPP);
+            m_dotCPP.WriteNewLine();
         }
 
         void GraphToCPlusPlus::TranslateNamespaceOpen()
@@ -129,49 +657,73 @@ namespace ScriptCanvas
 
         void GraphToCPlusPlus::TranslateNamespaceClose()
         {
-            CloseNamespace(m_dotH, "ScriptCanvas");
             CloseNamespace(m_dotH, GetAutoNativeNamespace());
-            CloseNamespace(m_dotCPP, "ScriptCanvas");
+            CloseNamespace(m_dotH, "ScriptCanvas");
             CloseNamespace(m_dotCPP, GetAutoNativeNamespace());
+            CloseNamespace(m_dotCPP, "ScriptCanvas");
         }
 
-        void GraphToCPlusPlus::TranslateStartNode()
+        void GraphToCPlusPlus::TranslateRegistration()
         {
-            // write a start function
-            const Node* startNode = nullptr;
-            
-            if (startNode)
+            const char* methodTable = m_className.c_str();
+
+            m_dotCPP.WriteLineIndented("bool %s::Register()", m_className.c_str());
+            OpenScope(m_dotCPP);
             {
-                { // .h
-                    m_dotH.WriteIndent();
-                    m_dotH.WriteLine("public: static void %s(const RuntimeContext& context);", Grammar::k_OnGraphStartFunctionName);
-                }
-                
-                { // .cpp
-                    m_dotCPP.WriteIndent();
-                    m_dotCPP.WriteLine("void %s::%s(const RuntimeContext& context)", GetGraphName().data(), Grammar::k_OnGraphStartFunctionName);
-                    OpenScope(m_dotCPP);
-                    {
-                        m_dotCPP.WriteIndent();
-                        m_dotCPP.WriteLine("AZ_TracePrintf(\"ScriptCanvas\", \"This call wasn't generated from parsing a print node!\");");
-                        m_dotCPP.WriteLine("LogNotificationBus::Event(context.GetGraphId(), &LogNotifications::LogMessage, \"This call wasn't generated from parsing a print node!\");");
-                        // get the related function call and call it
-                        // with possible appropriate variables
-                    }
-                    CloseScope(m_dotCPP);
+                for (size_t index = 0; index < m_methods.size(); ++index)
+                {
+                    m_dotCPP.WriteLineIndented("%sCPP::s_methods[%zu] = ScriptCanvas::Execution::FindNativeMethod(%s, %s);"
+                        , methodTable
+                        , index
+                        , GraphToCPlusPlusCpp::ToStringLiteral(m_methods[index].m_className).c_str()
+                        , GraphToCPlusPlusCpp::ToStringLiteral(m_methods[index].m_methodName).c_str());
                 }
+
+                m_dotCPP.WriteNewLine();
+                m_dotCPP.WriteLineIndented("if (AZStd::find(%sCPP::s_methods.begin(), %sCPP::s_methods.end(), nullptr) != %sCPP::s_methods.end())", methodTable, methodTable, methodTable);
+                OpenScope(m_dotCPP);
+                m_dotCPP.WriteLineIndented("return false;");
+                CloseScope(m_dotCPP);
+                m_dotCPP.WriteNewLine();
+                m_dotCPP.WriteLineIndented("return RegisterNativeGraphStart(\"%s\", &%s::%s);"
+                    , GetNativeGraphName(m_model.GetSource().m_assetId).c_str()
+                    , m_className.c_str()
+                    , Grammar::k_OnGraphStartFunctionName);
             }
+            CloseScope(m_dotCPP);
+            m_dotCPP.WriteNewLine();
         }
 
-        void GraphToCPlusPlus::TranslateVariables()
+        void GraphToCPlusPlus::TranslateStartNode()
         {
+            Grammar::ExecutionTreeConstPtr start = m_model.GetStart();
 
-        }
+            // inside the ScriptCanvas and AutoNative namespaces
+            m_startFunction.SetIndent(2);
+            m_startFunction.WriteLineIndented("void %s::%s(const RuntimeContext& /*context*/)", m_className.c_str(), Grammar::k_OnGraphStartFunctionName);
+            OpenScope(m_startFunction);
+            {
+                if (const auto* localVariables = m_model.GetLocalVariables(start))
+                {
+                    // sorted, so the output only changes along with the graph
+                    AZStd::vector<Grammar::VariableConstPtr> sortedVariables(localVariables->begin(), localVariables->end());
+                    AZStd::sort(sortedVariables.begin(), sortedVariables.end(), [](const Grammar::VariableConstPtr& lhs, const Grammar::VariableConstPtr& rhs)
+                        {
+                            return lhs->m_name < rhs->m_name;
+                        });
 
-        void GraphToCPlusPlus::WriteHeader()
-        {
-            WriteHeaderDotH();
-            WriteHeaderDotCPP();
+                    for (const auto& variable : sortedVariables)
+                    {
+                        m_startFunction.WriteLineIndented("ScriptCanvas::Datum %s(%s);", variable->m_name.c_str(), ToValue(start, variable->m_datum).c_str());
+                    }
+                }
+
+                if (start->GetChildrenCount() > 0 && start->GetChild(0).m_execution)
+                {
+                    TranslateExecutionTreeEntry(start->GetChild(0).m_execution);
+                }
+            }
+            CloseScope(m_startFunction);
         }
 
         void GraphToCPlusPlus::WriteHeaderDotCPP()
@@ -180,9 +732,13 @@ namespace ScriptCanvas
             m_dotCPP.WriteNewLine();
             WriteDoNotModify(m_dotCPP);
             m_dotCPP.WriteNewLine();
-            m_dotCPP.WriteLine("#include \"precompiled.h\"");
             m_dotCPP.WriteLine("#include \"%s.h\"", GetGraphName().data());
             m_dotCPP.WriteNewLine();
+            m_dotCPP.WriteLine("#include <AzCore/std/algorithm.h>");
+            m_dotCPP.WriteLine("#include <AzCore/std/containers/array.h>");
+            m_dotCPP.WriteLine("#include <ScriptCanvas/Execution/Native/ExecutionNativeAPI.h>");
+            m_dotCPP.WriteLine("#include <ScriptCanvas/Execution/NativeHostDefinitions.h>");
+            m_dotCPP.WriteNewLine();
         }
 
         void GraphToCPlusPlus::WriteHeaderDotH()
@@ -193,9 +749,30 @@ namespace ScriptCanvas
             m_dotH.WriteNewLine();
             WriteDoNotModify(m_dotH);
             m_dotH.WriteNewLine();
-            m_dotH.WriteLine("#include <Execution/NativeHostDeclarations.h>");
+            m_dotH.WriteLine("#include <ScriptCanvas/Execution/NativeHostDeclarations.h>");
             m_dotH.WriteNewLine();
         }
 
-    } 
-} 
+        void GraphToCPlusPlus::WriteOutputAssignments(Grammar::ExecutionTreeConstPtr execution)
+        {
+            if (const auto output = execution->GetLocalOutput())
+            {
+                for (const auto& outputIter : *output)
+                {
+                    if (!outputIter.second->m_sourceConversions.empty())
+                    {
+                        AddUnsupported(execution, "converted output is not supported");
+                        return;
+                    }
+
+                    const AZStd::string sourceName = GetVariableName(execution, outputIter.second->m_source);
+
+                    for (const auto& assignment : outputIter.second->m_assignments)
+                    {
+                        m_startFunction.WriteLineIndented("%s = %s;", GetVariableName(execution, assignment).c_str(), sourceName.c_str());
+                    }
+                }
+            }
+        }
+    }
+}
@@ -1,6 +1,6 @@
 /*
  * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
- * 
+ *
  * SPDX-License-Identifier: Apache-2.0 OR MIT
  *
  */
@@ -9,6 +9,7 @@
 
 #include <AzCore/Outcome/Outcome.h>
 
+#include "TranslationResult.h"
 #include "TranslationUtilities.h"
 #include "GraphToX.h"
 
@@ -23,37 +24,64 @@ namespace ScriptCanvas
 
     namespace Translation
     {
+        // Translates pure graphs with an On Graph Start into C++ source, to be compiled into a gem for release builds. The generated class
+        // registers its start function with RegisterNativeGraphStart, after which ExecutionState::Create selects it over the Lua
+        // translation. Values are kept in Datums and BehaviorContext methods are called directly, so no Lua marshalling takes place.
+        //
+        // Only a subset of the grammar is supported: function calls, variable reads and writes, arithmetic, comparisons, logical
+        // expressions and if conditions. Graphs using anything else fail translation, and keep executing their Lua translation.
         class GraphToCPlusPlus
             : public GraphToX
         {
         public:
-            static AZ::Outcome<void, AZStd::pair<AZStd::string, AZStd::string>> Translate(const Grammar::AbstractCodeModel& model, AZStd::string& dotH, AZStd::string& dotCPP);
-            
-            AZ_INLINE bool IsSuccessfull() const { return false;  }
-        private:         
+            // on success, returns the .h and the .cpp translation in that order
+            static AZ::Outcome<AZStd::pair<TargetResult, TargetResult>, ErrorList> Translate(const Grammar::AbstractCodeModel& model);
+
+            bool IsSuccessfull() const;
+
+        private:
+            struct MethodReference
+            {
+                AZStd::string m_className;
+                AZStd::string m_methodName;
+            };
+
+            AZStd::string m_className;
+            size_t m_constantCount = 0;
+            AZStd::vector<MethodReference> m_methods;
+            ErrorList m_unsupported;
+
             // cpp only
             Writer m_dotH;
             Writer m_dotCPP;
-            
+            Writer m_startFunction;
+
             GraphToCPlusPlus(const Grammar::AbstractCodeModel& model);
 
+            void AddUnsupported(Grammar::ExecutionTreeConstPtr execution, AZStd::string_view reason);
+            bool CheckGraphSupported();
+            AZStd::string GetOperand(Grammar::ExecutionTreeConstPtr execution, size_t index);
+            AZStd::vector<AZStd::string> GetOperands(Grammar::ExecutionTreeConstPtr execution);
+            AZStd::string GetVariableName(Grammar::ExecutionTreeConstPtr execution, Grammar::VariableConstPtr variable);
+            AZStd::string ToArithmeticExpression(Grammar::ExecutionTreeConstPtr execution, const AZStd::vector<AZStd::string>& operands);
+            AZStd::string ToFunctionCallExpression(Grammar::ExecutionTreeConstPtr execution, const AZStd::vector<AZStd::string>& operands);
+            AZStd::string ToLogicalExpression(Grammar::ExecutionTreeConstPtr execution, const AZStd::vector<AZStd::string>& operands);
+            AZStd::string ToValue(Grammar::ExecutionTreeConstPtr execution, const Datum& datum);
             void TranslateClassClose();
             void TranslateClassOpen();
-            void TranslateConstruction();
-            void TranslateDependencies();
-            void TranslateDependenciesDotH();
-            void TranslateDependenciesDotCPP();
-            void TranslateDestruction();
-            void TranslateFunctions();
-            void TranslateHandlers();
+            void TranslateExecutionTreeEntry(Grammar::ExecutionTreeConstPtr execution);
+            void TranslateExecutionTreeChildren(Grammar::ExecutionTreeConstPtr execution);
+            void TranslateExecutionTreeFunctionCall(Grammar::ExecutionTreeConstPtr execution);
+            void TranslateExecutionTreeIfCondition(Grammar::ExecutionTreeConstPtr execution);
+            void TranslateMethodTable();
             void TranslateNamespaceOpen();
             void TranslateNamespaceClose();
+            void TranslateRegistration();
             void TranslateStartNode();
-            void TranslateVariables();
-            void WriteHeader(); // Write, not translate, because this should be less dependent on the contents of the graph
             void WriteHeaderDotH(); // Write, not translate, because this should be less dependent on the contents of the graph
             void WriteHeaderDotCPP(); // Write, not translate, because this should be less dependent on the contents of the graph
+            void WriteOutputAssignments(Grammar::ExecutionTreeConstPtr execution);
         };
-    } 
+    }
 
 }
@@ -26,40 +26,38 @@ namespace TranslationCPP
     using namespace ScriptCanvas;
     using namespace ScriptCanvas::Translation;
 
-    /*
-    AZ::Outcome<AZStd::pair<AZStd::string, AZStd::string>, AZStd::pair<AZStd::string, AZStd::string>> ToCPlusPlus(const Grammar::AbstractCodeModel& model, bool rawSave = false)
+    AZ::Outcome<AZStd::pair<TargetResult, TargetResult>, ErrorList> ToCPlusPlus(const Grammar::AbstractCodeModel& model, bool save = false)
     {
-        AZStd::string dotH, dotCPP;
-        auto outcome = GraphToCPlusPlus::Translate(model, dotH, dotCPP);
+        auto outcome = GraphToCPlusPlus::Translate(model);
         if (outcome.IsSuccess())
         {
 #if defined(SCRIPT_CANVAS_PRINT_FILES_CONSOLE)
             AZ_TracePrintf("ScriptCanvas", "\n\n *** .h file ***\n\n");
-            AZ_TracePrintf("ScriptCanvas", dotH.data());
+            AZ_TracePrintf("ScriptCanvas", outcome.GetValue().first.m_text.data());
             AZ_TracePrintf("ScriptCanvas", "\n\n *** .cpp file *\n\n");
-            AZ_TracePrintf("ScriptCanvas", dotCPP.data());
+            AZ_TracePrintf("ScriptCanvas", outcome.GetValue().second.m_text.data());
             AZ_TracePrintf("ScriptCanvas", "\n\n");
 #endif
-            if (rawSave)
+            if (save)
             {
-                auto saveOutcome = SaveDotH(model.GetSource(), dotH);
+                auto saveOutcome = SaveDotH(model.GetSource(), outcome.GetValue().first.m_text);
                 if (saveOutcome.IsSuccess())
                 {
-                    saveOutcome = SaveDotCPP(model.GetSource(), dotCPP);
+                    saveOutcome = SaveDotCPP(model.GetSource(), outcome.GetValue().second.m_text);
                 }
                 if (!saveOutcome.IsSuccess())
                 {
-                    AZ_TracePrintf("Save failed %s", saveOutcome.GetError().data());
+                    AZ_TracePrintf("ScriptCanvas", "Save failed %s", saveOutcome.GetError().data());
                 }
             }
-            return AZ::Success(AZStd::make_pair(AZStd::move(dotH), AZStd::move(dotCPP)));
+
+            return AZ::Success(outcome.TakeValue());
         }
         else
         {
             return AZ::Failure(outcome.TakeError());
         }
     }
-    */
 
     AZ::Outcome<TargetResult, ErrorList> ToLua(const Grammar::AbstractCodeModel& model, bool rawSave = false)
     {
@@ -133,32 +131,23 @@ namespace ScriptCanvas
                     }
                 }
 
-                // Translation to C++ (executed via BehaviorContext calls) has been demonstrated in the past and is partially in progress.
-                // These calls allow for users to execute multiple translations from the same abstract code model.
-                // More work is required to complete all the latest features of the ACM, and do integrate output files into the build.
-                // 
-                //                 if (targetFlags & (TargetFlags::Cpp | TargetFlags::Hpp))
-                //                 {
-                //                     auto outcomeCPP = TranslationCPP::ToCPlusPlus(*model.get(), rawSave);
-                //                     if (outcomeCPP.IsSuccess())
-                //                     {
-                //                         auto hppAndCpp = outcomeCPP.TakeValue();
-                //                         
-                //                         TargetResult cppResult;
-                //                         cppResult.m_text = AZStd::move(hppAndCpp.first);
-                //                         translations.emplace(TargetFlags::Hpp, AZStd::move(cppResult));
-                //                         TargetResult hppResult;
-                //                         hppResult.m_text = AZStd::move(hppAndCpp.second);
-                //                         translations.emplace(TargetFlags::Cpp, AZStd::move(hppResult));
-                //                     }
-                //                     else
-                //                     {
-                //                         auto hppAndCpp = outcomeCPP.TakeError();
-                //                         errors.emplace(TargetFlags::Hpp, AZStd::move(hppAndCpp.first));
-                //                         errors.emplace(TargetFlags::Cpp, AZStd::move(hppAndCpp.second));
-                //                     }
-                //                 }
-
+                // C++ translation only supports a subset of the grammar, graphs it rejects keep executing their Lua translation
+                if (request.translationTargetFlags & (TargetFlags::Cpp | TargetFlags::Hpp))
+                {
+                    auto outcomeCPP = TranslationCPP::ToCPlusPlus(*model.get(), request.saveNativeSource);
+                    if (outcomeCPP.IsSuccess())
+                    {
+                        auto hppAndCpp = outcomeCPP.TakeValue();
+                        translations.emplace(TargetFlags::Hpp, AZStd::move(hppAndCpp.first));
+                        translations.emplace(TargetFlags::Cpp, AZStd::move(hppAndCpp.second));
+                    }
+                    else
+                    {
+                        ErrorList cppErrors = outcomeCPP.TakeError();
+                        errors.emplace(TargetFlags::Hpp, cppErrors);
+                        errors.emplace(TargetFlags::Cpp, AZStd::move(cppErrors));
+                    }
+                }
             }
 
             return Result(model, AZStd::move(translations), AZStd::move(errors));
@@ -5,14 +5,112 @@
  *
  */
 
+#include <AzCore/Asset/AssetManagerBus.h>
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/time.h>
+#include <AzCore/StringFunc/StringFunc.h>
 #include <ScriptCanvas/Execution/ExecutionPerformanceTimer.h>
+#include <ScriptCanvas/SystemComponent.h>
 
 #include <ScriptCanvas/PerformanceTracker.h>
 
+namespace PerformanceTrackerCpp
+{
+    AZStd::sys_time_t TicksToMicroseconds(AZStd::sys_time_t ticks)
+    {
+        return ticks * 1000000 / AZStd::GetTimeTicksPerSecond();
+    }
+
+    // collapsed stack frames are separated by ';' and end at the last space, so neither may appear in the name of a frame
+    AZStd::string ToFrameName(AZStd::string_view name)
+    {
+        AZStd::string frameName(name);
+        AZStd::replace(frameName.begin(), frameName.end(), ';', '_');
+        return frameName;
+    }
+
+    AZStd::string GetGraphFrameName(const AZ::Data::AssetId& assetId)
+    {
+        AZStd::string assetPath;
+        AZ::Data::AssetCatalogRequestBus::BroadcastResult(assetPath, &AZ::Data::AssetCatalogRequests::GetAssetPathById, assetId);
+
+        AZStd::string fileName;
+        if (assetPath.empty() || !AZ::StringFunc::Path::GetFileName(assetPath.c_str(), fileName))
+        {
+            fileName = assetId.ToString<AZStd::string>();
+        }
+
+        return ToFrameName(fileName);
+    }
+}
+
 namespace ScriptCanvas
 {
     namespace Execution
     {
+        AZ_CVAR(bool, sc_profileNodes, false, {}, AZ::ConsoleFunctorFlags::Null
+            , "Time every node of the graphs executing their debug configuration, whether they are observed by the debugger or not. See sc_WriteNodeProfile.");
+
+        static void sc_WriteNodeProfile(const AZ::ConsoleCommandContainer& arguments)
+        {
+            PerformanceTracker* tracker = SystemComponent::ModPerformanceTracker();
+            AZ::IO::FileIOBase* fileIO = AZ::IO::FileIOBase::GetInstance();
+            if (!tracker || !fileIO)
+            {
+                return;
+            }
+
+            const AZStd::string filePath = arguments.empty() ? AZStd::string("@user@/ScriptCanvas/NodeProfile.folded") : AZStd::string(arguments.front());
+            const AZStd::string collapsedStacks = tracker->GetNodeReportCollapsedStacks();
+
+            AZ::IO::HandleType fileHandle = AZ::IO::InvalidHandle;
+            if (fileIO->Open(filePath.c_str(), AZ::IO::OpenMode::ModeWrite | AZ::IO::OpenMode::ModeText, fileHandle) != AZ::IO::ResultCode::Success)
+            {
+                AZ_Error("ScriptCanvas", false, "Failed to open %s to write the node profile", filePath.c_str());
+                return;
+            }
+
+            fileIO->Write(fileHandle, collapsedStacks.data(), collapsedStacks.size());
+            fileIO->Close(fileHandle);
+            AZ_TracePrintf("ScriptCanvas", "Wrote the node profile to %s\n", filePath.c_str());
+        }
+        AZ_CONSOLEFREEFUNC(sc_WriteNodeProfile, AZ::ConsoleFunctorFlags::Null
+            , "Write the node timings collected while sc_profileNodes is on as collapsed stacks, to the given file or to @user@/ScriptCanvas/NodeProfile.folded");
+
+        static void sc_ClearNodeProfile([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
+        {
+            if (PerformanceTracker* tracker = SystemComponent::ModPerformanceTracker())
+            {
+                tracker->ClearNodeReport();
+            }
+        }
+        AZ_CONSOLEFREEFUNC(sc_ClearNodeProfile, AZ::ConsoleFunctorFlags::Null, "Discard the node timings collected so far.");
+
+        bool PerformanceTracker::NodeKey::operator==(const NodeKey& other) const
+        {
+            return assetId == other.assetId && nodeId == other.nodeId;
+        }
+
+        size_t PerformanceTracker::NodeKeyHasher::operator()(const NodeKey& key) const
+        {
+            size_t hash = 0;
+            AZStd::hash_combine(hash, key.assetId, key.nodeId);
+            return hash;
+        }
+
+        bool PerformanceTracker::NodePathKey::operator==(const NodePathKey& other) const
+        {
+            return parent == other.parent && node == other.node;
+        }
+
+        size_t PerformanceTracker::NodePathKeyHasher::operator()(const NodePathKey& key) const
+        {
+            size_t hash = NodeKeyHasher()(key.node);
+            AZStd::hash_combine(hash, key.parent);
+            return hash;
+        }
+
         PerformanceTracker::PerformanceTracker()
         {}
 
@@ -75,6 +173,23 @@ namespace ScriptCanvas
             m_globalReport = {};
         }
 
+        void PerformanceTracker::ClearNodeReport()
+        {
+            AZStd::lock_guard lock(m_nodeMutex);
+            m_nodePaths.clear();
+            m_nodePathIndices.clear();
+            m_nodeThreadStates.clear();
+        }
+
+        void PerformanceTracker::CloseOpenNodePath(NodeThreadState& state, AZStd::sys_time_t nowTicks)
+        {
+            if (state.openPath != k_noNodePath)
+            {
+                m_nodePaths[state.openPath].exclusiveTicks += nowTicks - state.openTicks;
+                state.openPath = k_noNodePath;
+            }
+        }
+
         void PerformanceTracker::ClearSnapshotReport()
         {
             AZStd::lock_guard lock(m_activeTimerMutex);
@@ -152,6 +267,144 @@ namespace ScriptCanvas
             return m_globalReport;
         }
 
+        AZStd::vector<PerformanceNodeReport> PerformanceTracker::GetNodeReport() const
+        {
+            AZStd::lock_guard lock(m_nodeMutex);
+            const AZStd::vector<AZStd::sys_time_t> inclusiveTicks = GetNodePathInclusiveTicks();
+
+            AZStd::vector<PerformanceNodeReport> reports;
+            AZStd::unordered_map<NodeKey, size_t, NodeKeyHasher> reportIndices;
+
+            for (size_t pathIndex = 0; pathIndex < m_nodePaths.size(); ++pathIndex)
+            {
+                const NodePath& path = m_nodePaths[pathIndex];
+                auto indexIter = reportIndices.find(path.node);
+                if (indexIter == reportIndices.end())
+                {
+                    indexIter = reportIndices.insert({ path.node, reports.size() }).first;
+                    PerformanceNodeReport& report = reports.emplace_back();
+                    report.assetId = path.node.assetId;
+                    report.nodeId = path.node.nodeId;
+                    report.nodeName = path.nodeName;
+                }
+
+                PerformanceNodeReport& report = reports[indexIter->second];
+                report.exclusiveTime += PerformanceTrackerCpp::TicksToMicroseconds(path.exclusiveTicks);
+                report.executionCount += path.executionCount;
+
+                // a node reached through a path it is already on, is included in the time of the outer occurrence
+                bool isNested = false;
+                for (size_t ancestor = path.parent; ancestor != k_noNodePath && !isNested; ancestor = m_nodePaths[ancestor].parent)
+                {
+                    isNested = m_nodePaths[ancestor].node == path.node;
+                }
+
+                if (!isNested)
+                {
+                    report.inclusiveTime += PerformanceTrackerCpp::TicksToMicroseconds(inclusiveTicks[pathIndex]);
+                }
+            }
+
+            return reports;
+        }
+
+        AZStd::string PerformanceTracker::GetNodeReportCollapsedStacks() const
+        {
+            AZStd::lock_guard lock(m_nodeMutex);
+
+            AZStd::unordered_map<AZ::Data::AssetId, AZStd::string> graphFrameNames;
+            auto getGraphFrameName = [&graphFrameNames](const AZ::Data::AssetId& assetId) -> const AZStd::string&
+            {
+                auto iter = graphFrameNames.find(assetId);
+                if (iter == graphFrameNames.end())
+                {
+                    iter = graphFrameNames.insert({ assetId, PerformanceTrackerCpp::GetGraphFrameName(assetId) }).first;
+                }
+
+                return iter->second;
+            };
+
+            AZStd::string collapsedStacks;
+            AZStd::vector<size_t> stack;
+
+            for (size_t pathIndex = 0; pathIndex < m_nodePaths.size(); ++pathIndex)
+            {
+                const AZStd::sys_time_t exclusiveTime = PerformanceTrackerCpp::TicksToMicroseconds(m_nodePaths[pathIndex].exclusiveTicks);
+                if (exclusiveTime == 0)
+                {
+                    continue;
+                }
+
+                stack.clear();
+                for (size_t frame = pathIndex; frame != k_noNodePath; frame = m_nodePaths[frame].parent)
+                {
+                    stack.push_back(frame);
+                }
+
+                // the graph is named at the root, and again wherever a path continues into a subgraph
+                const AZ::Data::AssetId* previousAssetId = nullptr;
+                for (auto frame = stack.rbegin(); frame != stack.rend(); ++frame)
+                {
+                    const NodePath& framePath = m_nodePaths[*frame];
+                    if (!previousAssetId || *previousAssetId != framePath.node.assetId)
+                    {
+                        collapsedStacks += getGraphFrameName(framePath.node.assetId);
+                        collapsedStacks += ';';
+                        previousAssetId = &framePath.node.assetId;
+                    }
+
+                    collapsedStacks += PerformanceTrackerCpp::ToFrameName(framePath.nodeName);
+                    collapsedStacks += ';';
+                }
+
+                collapsedStacks.back() = ' ';
+                collapsedStacks += AZStd::string::format("%lld\n", static_cast<long long>(exclusiveTime));
+            }
+
+            return collapsedStacks;
+        }
+
+        AZStd::vector<AZStd::sys_time_t> PerformanceTracker::GetNodePathInclusiveTicks() const
+        {
+            // paths are created after their parents, so walking them backwards adds every child to its parent before the parent is read
+            AZStd::vector<AZStd::sys_time_t> inclusiveTicks(m_nodePaths.size(), 0);
+
+            for (size_t pathIndex = m_nodePaths.size(); pathIndex-- > 0;)
+            {
+                const NodePath& path = m_nodePaths[pathIndex];
+                inclusiveTicks[pathIndex] += path.exclusiveTicks;
+
+                if (path.parent != k_noNodePath)
+                {
+                    inclusiveTicks[path.parent] += inclusiveTicks[pathIndex];
+                }
+            }
+
+            return inclusiveTicks;
+        }
+
+        size_t PerformanceTracker::GetOrCreateNodePath(size_t parent, const AZ::Data::AssetId& assetId, const NamedEndpoint& endpoint)
+        {
+            if (parent != k_noNodePath && m_nodePaths[parent].depth >= k_maxNodePathDepth)
+            {
+                parent = k_noNodePath;
+            }
+
+            const NodePathKey key{ parent, { assetId, endpoint.GetNodeId() } };
+            auto iter = m_nodePathIndices.find(key);
+            if (iter != m_nodePathIndices.end())
+            {
+                return iter->second;
+            }
+
+            NodePath& path = m_nodePaths.emplace_back();
+            path.parent = parent;
+            path.depth = parent != k_noNodePath ? m_nodePaths[parent].depth + 1 : 0;
+            path.node = key.node;
+            path.nodeName = endpoint.GetNodeName();
+            return m_nodePathIndices.insert({ key, m_nodePaths.size() - 1 }).first->second;
+        }
+
         PerformanceTrackingReport PerformanceTracker::GetReportByAsset(const PerformanceReportByAsset& reports, AZ::Data::AssetId key)
         {
             auto iter = reports.find(key);
@@ -199,6 +452,50 @@ namespace ScriptCanvas
             GetOrCreateTimer(assetId)->timer.AddLatentTime(time);
         }
 
+        void PerformanceTracker::ReportNodeSignalIn(const AZ::Data::AssetId& assetId, const NamedEndpoint& endpoint)
+        {
+            const AZStd::sys_time_t nowTicks = AZStd::GetTimeNowTicks();
+            AZStd::lock_guard lock(m_nodeMutex);
+
+            NodeThreadState& state = m_nodeThreadStates[AZStd::this_thread::get_id()];
+            CloseOpenNodePath(state, nowTicks);
+
+            const size_t pathIndex = GetOrCreateNodePath(state.parentPath, assetId, endpoint);
+            ++m_nodePaths[pathIndex].executionCount;
+            state.lastPathByNode[m_nodePaths[pathIndex].node] = pathIndex;
+            state.openPath = pathIndex;
+            state.parentPath = k_noNodePath;
+            // the time spent in here is left out of the node
+            state.openTicks = AZStd::GetTimeNowTicks();
+        }
+
+        void PerformanceTracker::ReportNodeSignalOut(const AZ::Data::AssetId& assetId, const NamedEndpoint& endpoint)
+        {
+            const AZStd::sys_time_t nowTicks = AZStd::GetTimeNowTicks();
+            AZStd::lock_guard lock(m_nodeMutex);
+
+            NodeThreadState& state = m_nodeThreadStates[AZStd::this_thread::get_id()];
+            CloseOpenNodePath(state, nowTicks);
+
+            auto lastPath = state.lastPathByNode.find(NodeKey{ assetId, endpoint.GetNodeId() });
+            if (lastPath != state.lastPathByNode.end())
+            {
+                state.parentPath = lastPath->second;
+            }
+            else
+            {
+                // an output without an input starts a new execution path, this is how events and graph start are signaled
+                state.parentPath = GetOrCreateNodePath(k_noNodePath, assetId, endpoint);
+                m_nodePaths[state.parentPath].isEntry = true;
+                state.lastPathByNode[m_nodePaths[state.parentPath].node] = state.parentPath;
+            }
+
+            if (m_nodePaths[state.parentPath].isEntry)
+            {
+                ++m_nodePaths[state.parentPath].executionCount;
+            }
+        }
+
         void PerformanceTracker::ReportInitializationTime(PerformanceKey key, const AZ::Data::AssetId& assetId, AZStd::sys_time_t time)
         {
              CreateTimer(key)->AddInitializationTime(time);
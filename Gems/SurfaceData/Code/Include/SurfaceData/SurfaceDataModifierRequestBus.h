@@ -9,6 +9,7 @@
 
 #include <AzCore/EBus/EBus.h>
 #include <AzCore/Math/Aabb.h>
+#include <AzCore/std/containers/span.h>
 #include <SurfaceData/SurfaceDataTypes.h>
 
 namespace SurfaceData
@@ -31,6 +32,26 @@ namespace SurfaceData
         using MutexType = AZStd::recursive_mutex;
 
         virtual void ModifySurfacePoints(SurfacePointList& surfacePointList) const = 0;
+
+        //! Modifies the points at pointIndices in a batched region list in one call. Modifiers that can amortize their locks
+        //! or evaluate many points at once should override this, the default implementation copies the points into a
+        //! SurfacePointList, calls ModifySurfacePoints and copies the masks back.
+        virtual void ModifySurfacePointsFromList(AZStd::span<const AZ::u32> pointIndices, SurfacePointRegionList& surfacePointList) const
+        {
+            SurfacePointList points;
+            points.reserve(pointIndices.size());
+            for (const AZ::u32 pointIndex : pointIndices)
+            {
+                points.push_back(surfacePointList.GetSurfacePoint(pointIndex));
+            }
+
+            ModifySurfacePoints(points);
+
+            for (size_t index = 0; index < pointIndices.size(); ++index)
+            {
+                surfacePointList.m_masks[pointIndices[index]] = AZStd::move(points[index].m_masks);
+            }
+        }
     };
 
     typedef AZ::EBus<SurfaceDataModifierRequests> SurfaceDataModifierRequestBus;
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <AzCore/EBus/EBus.h>
+#include <AzCore/std/containers/span.h>
 #include <SurfaceData/SurfaceDataTypes.h>
 
 namespace SurfaceData
@@ -30,6 +31,23 @@ namespace SurfaceData
         using MutexType = AZStd::recursive_mutex;
 
         virtual void GetSurfacePoints(const AZ::Vector3& inPosition, SurfacePointList& surfacePointList) const = 0;
+
+        //! Gets the surface points for a batch of input positions, the points are added to surfacePointList with the index
+        //! of the input position they belong to. Providers that can amortize their locks or evaluate many positions at
+        //! once should override this, the default implementation calls GetSurfacePoints for every position.
+        virtual void GetSurfacePointsFromList(AZStd::span<const AZ::Vector3> inPositions, SurfacePointRegionList& surfacePointList) const
+        {
+            SurfacePointList pointsAtPosition;
+            for (size_t inputIndex = 0; inputIndex < inPositions.size(); ++inputIndex)
+            {
+                pointsAtPosition.clear();
+                GetSurfacePoints(inPositions[inputIndex], pointsAtPosition);
+                for (const SurfacePoint& point : pointsAtPosition)
+                {
+                    surfacePointList.AddSurfacePoint(inputIndex, point);
+                }
+            }
+        }
     };
 
     typedef AZ::EBus<SurfaceDataProviderRequests> SurfaceDataProviderRequestBus;
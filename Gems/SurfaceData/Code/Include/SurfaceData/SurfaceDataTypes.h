@@ -7,11 +7,13 @@
 
 #pragma once
 
+#include <AzCore/Casting/numeric_cast.h>
 #include <AzCore/Math/Aabb.h>
 #include <AzCore/Math/Vector3.h>
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/containers/vector.h>
 #include <SurfaceData/SurfaceTag.h>
 
 namespace SurfaceData
@@ -35,6 +37,74 @@ namespace SurfaceData
     using SurfacePointList = AZStd::vector<SurfacePoint>;
     using SurfacePointListPerPosition = AZStd::vector<AZStd::pair<AZ::Vector3, SurfacePointList>>;
 
+    //! Structure of arrays variant of SurfacePointList, used by the batched region queries.
+    //! Every point stores the index of the input position it was generated for, so a provider can write the points of a
+    //! whole region in one call, and modifiers can walk the positions without touching the masks of each point.
+    struct SurfacePointRegionList final
+    {
+        AZ_CLASS_ALLOCATOR(SurfacePointRegionList, AZ::SystemAllocator, 0);
+
+        void Clear()
+        {
+            m_inputIndices.clear();
+            m_entityIds.clear();
+            m_positions.clear();
+            m_normals.clear();
+            m_masks.clear();
+        }
+
+        void Reserve(size_t count)
+        {
+            m_inputIndices.reserve(count);
+            m_entityIds.reserve(count);
+            m_positions.reserve(count);
+            m_normals.reserve(count);
+            m_masks.reserve(count);
+        }
+
+        size_t GetSize() const
+        {
+            return m_positions.size();
+        }
+
+        bool IsEmpty() const
+        {
+            return m_positions.empty();
+        }
+
+        //! Adds a point for the input position at inputIndex, returns the masks of the new point so tags can be added to it.
+        SurfaceTagWeightMap& AddSurfacePoint(size_t inputIndex, const AZ::EntityId& entityId, const AZ::Vector3& position, const AZ::Vector3& normal)
+        {
+            m_inputIndices.push_back(aznumeric_cast<AZ::u32>(inputIndex));
+            m_entityIds.push_back(entityId);
+            m_positions.push_back(position);
+            m_normals.push_back(normal);
+            return m_masks.emplace_back();
+        }
+
+        void AddSurfacePoint(size_t inputIndex, const SurfacePoint& point)
+        {
+            AddSurfacePoint(inputIndex, point.m_entityId, point.m_position, point.m_normal) = point.m_masks;
+        }
+
+        //! Returns a copy of the point at pointIndex in the SurfacePoint layout.
+        SurfacePoint GetSurfacePoint(size_t pointIndex) const
+        {
+            SurfacePoint point;
+            point.m_entityId = m_entityIds[pointIndex];
+            point.m_position = m_positions[pointIndex];
+            point.m_normal = m_normals[pointIndex];
+            point.m_masks = m_masks[pointIndex];
+            return point;
+        }
+
+        AZStd::vector<AZ::u32> m_inputIndices;
+        AZStd::vector<AZ::EntityId> m_entityIds;
+        AZStd::vector<AZ::Vector3> m_positions;
+        AZStd::vector<AZ::Vector3> m_normals;
+        AZStd::vector<SurfaceTagWeightMap> m_masks;
+    };
+
     struct SurfaceDataRegistryEntry
     {
         AZ::EntityId m_entityId;
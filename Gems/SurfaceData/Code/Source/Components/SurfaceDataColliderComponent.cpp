@@ -272,6 +272,53 @@ namespace SurfaceData
         }
     }
 
+    void SurfaceDataColliderComponent::GetSurfacePointsFromList(AZStd::span<const AZ::Vector3> inPositions, SurfacePointRegionList& surfacePointList) const
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
+
+        // Hold the cache lock for the whole batch instead of taking it in every DoRayTrace call
+        AZStd::lock_guard<decltype(m_cacheMutex)> lock(m_cacheMutex);
+
+        const AZ::EntityId entityId = GetEntityId();
+        constexpr bool queryPointOnly = false;
+        for (size_t inputIndex = 0; inputIndex < inPositions.size(); ++inputIndex)
+        {
+            AZ::Vector3 hitPosition;
+            AZ::Vector3 hitNormal;
+            if (DoRayTrace(inPositions[inputIndex], queryPointOnly, hitPosition, hitNormal))
+            {
+                SurfaceTagWeightMap& masks = surfacePointList.AddSurfacePoint(inputIndex, entityId, hitPosition, hitNormal);
+                AddMaxValueForMasks(masks, m_configuration.m_providerTags, 1.0f);
+            }
+        }
+    }
+
+    void SurfaceDataColliderComponent::ModifySurfacePointsFromList(AZStd::span<const AZ::u32> pointIndices, SurfacePointRegionList& surfacePointList) const
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
+
+        AZStd::lock_guard<decltype(m_cacheMutex)> lock(m_cacheMutex);
+
+        if (m_colliderBounds.IsValid() && !m_configuration.m_modifierTags.empty())
+        {
+            const AZ::EntityId entityId = GetEntityId();
+            constexpr bool queryPointOnly = true;
+            for (const AZ::u32 pointIndex : pointIndices)
+            {
+                const AZ::Vector3& position = surfacePointList.m_positions[pointIndex];
+                if (surfacePointList.m_entityIds[pointIndex] != entityId && m_colliderBounds.Contains(position))
+                {
+                    AZ::Vector3 hitPosition;
+                    AZ::Vector3 hitNormal;
+                    if (DoRayTrace(position, queryPointOnly, hitPosition, hitNormal))
+                    {
+                        AddMaxValueForMasks(surfacePointList.m_masks[pointIndex], m_configuration.m_modifierTags, 1.0f);
+                    }
+                }
+            }
+        }
+    }
+
     void SurfaceDataColliderComponent::OnCompositionChanged()
     {
         if (!m_refresh)
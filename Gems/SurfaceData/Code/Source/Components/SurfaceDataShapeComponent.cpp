@@ -190,6 +190,58 @@ namespace SurfaceData
         }
     }
 
+    void SurfaceDataShapeComponent::GetSurfacePointsFromList(AZStd::span<const AZ::Vector3> inPositions, SurfacePointRegionList& surfacePointList) const
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
+
+        AZStd::lock_guard<decltype(m_cacheMutex)> lock(m_cacheMutex);
+
+        if (m_shapeBoundsIsValid)
+        {
+            // Look up the shape once and cast all the rays against it
+            const AZ::EntityId entityId = GetEntityId();
+            const AZ::Vector3 rayDirection = -AZ::Vector3::CreateAxisZ();
+            const float rayOriginZ = m_shapeBounds.GetMax().GetZ();
+            LmbrCentral::ShapeComponentRequestsBus::Event(entityId, [&](LmbrCentral::ShapeComponentRequests* shape)
+            {
+                for (size_t inputIndex = 0; inputIndex < inPositions.size(); ++inputIndex)
+                {
+                    const AZ::Vector3 rayOrigin = AZ::Vector3(inPositions[inputIndex].GetX(), inPositions[inputIndex].GetY(), rayOriginZ);
+                    float intersectionDistance = 0.0f;
+                    if (shape->IntersectRay(rayOrigin, rayDirection, intersectionDistance))
+                    {
+                        SurfaceTagWeightMap& masks = surfacePointList.AddSurfacePoint(
+                            inputIndex, entityId, rayOrigin + intersectionDistance * rayDirection, AZ::Vector3::CreateAxisZ());
+                        AddMaxValueForMasks(masks, m_configuration.m_providerTags, 1.0f);
+                    }
+                }
+            });
+        }
+    }
+
+    void SurfaceDataShapeComponent::ModifySurfacePointsFromList(AZStd::span<const AZ::u32> pointIndices, SurfacePointRegionList& surfacePointList) const
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
+
+        AZStd::lock_guard<decltype(m_cacheMutex)> lock(m_cacheMutex);
+
+        if (m_shapeBoundsIsValid && !m_configuration.m_modifierTags.empty())
+        {
+            const AZ::EntityId entityId = GetEntityId();
+            LmbrCentral::ShapeComponentRequestsBus::Event(entityId, [&](LmbrCentral::ShapeComponentRequests* shape)
+            {
+                for (const AZ::u32 pointIndex : pointIndices)
+                {
+                    const AZ::Vector3& position = surfacePointList.m_positions[pointIndex];
+                    if (surfacePointList.m_entityIds[pointIndex] != entityId && m_shapeBounds.Contains(position) && shape->IsPointInside(position))
+                    {
+                        AddMaxValueForMasks(surfacePointList.m_masks[pointIndex], m_configuration.m_modifierTags, 1.0f);
+                    }
+                }
+            });
+        }
+    }
+
     void SurfaceDataShapeComponent::OnTransformChanged(const AZ::Transform& /*local*/, const AZ::Transform& /*world*/)
     {
         OnCompositionChanged();
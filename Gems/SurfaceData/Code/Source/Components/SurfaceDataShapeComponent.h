@@ -64,10 +64,12 @@ namespace SurfaceData
         //////////////////////////////////////////////////////////////////////////
         // SurfaceDataProviderRequestBus
         void GetSurfacePoints(const AZ::Vector3& inPosition, SurfacePointList& surfacePointList) const;
+        void GetSurfacePointsFromList(AZStd::span<const AZ::Vector3> inPositions, SurfacePointRegionList& surfacePointList) const override;
 
         //////////////////////////////////////////////////////////////////////////
         // SurfaceDataModifierRequestBus
         void ModifySurfacePoints(SurfacePointList& surfacePointList) const override;
+        void ModifySurfacePointsFromList(AZStd::span<const AZ::u32> pointIndices, SurfacePointRegionList& surfacePointList) const override;
 
         //////////////////////////////////////////////////////////////////////////
         // AZ::TransformNotificationBus
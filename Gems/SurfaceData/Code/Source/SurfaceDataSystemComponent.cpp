@@ -249,9 +249,16 @@ namespace SurfaceData
         const bool hasDesiredTags = HasValidTags(desiredTags);
         const bool hasModifierTags = hasDesiredTags && HasMatchingTags(desiredTags, m_registeredModifierTags);
 
-        // Loop through each data provider, and query all the points for each one.  This allows us to check the tags and the overall
-        // AABB bounds just once per provider, instead of once per point.  It also allows for an eventual optimization in which we could send
-        // the list of points directly into each SurfaceDataProvider.
+        // All the points are gathered in one structure of arrays list, and every provider / modifier gets the whole batch in
+        // a single bus call. This allows us to check the tags and the overall AABB bounds just once per provider, and lets the
+        // providers take their locks and look up their shapes once per region instead of once per point.
+        SurfacePointRegionList regionPoints;
+        regionPoints.Reserve(surfacePointListPerPosition.size());
+        AZStd::vector<AZ::Vector3> batchPositions;
+        AZStd::vector<AZ::u32> batchIndices;
+        batchPositions.reserve(surfacePointListPerPosition.size());
+        batchIndices.reserve(surfacePointListPerPosition.size());
+
         for (const auto& entryPair : m_registeredSurfaceDataProviders)
         {
             const SurfaceDataRegistryEntry& entry = entryPair.second;
@@ -261,14 +268,29 @@ namespace SurfaceData
                 ( alwaysApplies || AabbOverlaps2D(entry.m_bounds, inRegion) )
                 )
             {
-                for (auto& surfacePointListAndPoint : surfacePointListPerPosition)
+                batchPositions.clear();
+                batchIndices.clear();
+                for (size_t inputIndex = 0; inputIndex < surfacePointListPerPosition.size(); ++inputIndex)
                 {
-                    const auto& point2d = surfacePointListAndPoint.first;
-                    SurfacePointList& surfacePointList = surfacePointListAndPoint.second;
+                    const auto& point2d = surfacePointListPerPosition[inputIndex].first;
                     AZ::Vector3 point3d(point2d.GetX(), point2d.GetY(), entry.m_bounds.GetMax().GetZ());
                     if (alwaysApplies || entry.m_bounds.Contains(point3d))
                     {
-                        SurfaceDataProviderRequestBus::Event(entryPair.first, &SurfaceDataProviderRequestBus::Events::GetSurfacePoints, point3d, surfacePointList);
+                        batchPositions.push_back(point3d);
+                        batchIndices.push_back(aznumeric_cast<AZ::u32>(inputIndex));
+                    }
+                }
+
+                if (!batchPositions.empty())
+                {
+                    const size_t firstNewPoint = regionPoints.GetSize();
+                    SurfaceDataProviderRequestBus::Event(entryPair.first, &SurfaceDataProviderRequestBus::Events::GetSurfacePointsFromList,
+                        AZStd::span<const AZ::Vector3>(batchPositions), regionPoints);
+
+                    // The provider indexes into the positions it was given, remap them to the region positions.
+                    for (size_t pointIndex = firstNewPoint; pointIndex < regionPoints.GetSize(); ++pointIndex)
+                    {
+                        regionPoints.m_inputIndices[pointIndex] = batchIndices[regionPoints.m_inputIndices[pointIndex]];
                     }
                 }
             }
@@ -279,29 +301,45 @@ namespace SurfaceData
         // create new surface points, but surface data *modifiers* simply annotate points that have already been created.  The modifiers
         // are used to annotate points that occur within a volume.  A common example is marking points as "underwater" for points that occur
         // within a water volume.
-        for (const auto& entryPair : m_registeredSurfaceDataModifiers)
+        if (!regionPoints.IsEmpty())
         {
-            const SurfaceDataRegistryEntry& entry = entryPair.second;
-            bool alwaysApplies = !entry.m_bounds.IsValid();
-
-            if (alwaysApplies || AabbOverlaps2D(entry.m_bounds, inRegion))
+            for (const auto& entryPair : m_registeredSurfaceDataModifiers)
             {
-                for (auto& surfacePointListAndPoint : surfacePointListPerPosition)
+                const SurfaceDataRegistryEntry& entry = entryPair.second;
+                bool alwaysApplies = !entry.m_bounds.IsValid();
+
+                if (alwaysApplies || AabbOverlaps2D(entry.m_bounds, inRegion))
                 {
-                    const auto& point2d = surfacePointListAndPoint.first;
-                    SurfacePointList& surfacePointList = surfacePointListAndPoint.second;
-                    if (!surfacePointList.empty())
+                    batchIndices.clear();
+                    for (size_t pointIndex = 0; pointIndex < regionPoints.GetSize(); ++pointIndex)
                     {
+                        const auto& point2d = surfacePointListPerPosition[regionPoints.m_inputIndices[pointIndex]].first;
                         AZ::Vector3 point3d(point2d.GetX(), point2d.GetY(), entry.m_bounds.GetMax().GetZ());
                         if (alwaysApplies || entry.m_bounds.Contains(point3d))
                         {
-                            SurfaceDataModifierRequestBus::Event(entryPair.first, &SurfaceDataModifierRequestBus::Events::ModifySurfacePoints, surfacePointList);
+                            batchIndices.push_back(aznumeric_cast<AZ::u32>(pointIndex));
                         }
                     }
+
+                    if (!batchIndices.empty())
+                    {
+                        SurfaceDataModifierRequestBus::Event(entryPair.first, &SurfaceDataModifierRequestBus::Events::ModifySurfacePointsFromList,
+                            AZStd::span<const AZ::u32>(batchIndices), regionPoints);
+                    }
                 }
             }
         }
 
+        // Move the points into the list of their input position.
+        for (size_t pointIndex = 0; pointIndex < regionPoints.GetSize(); ++pointIndex)
+        {
+            SurfacePoint& point = surfacePointListPerPosition[regionPoints.m_inputIndices[pointIndex]].second.emplace_back();
+            point.m_entityId = regionPoints.m_entityIds[pointIndex];
+            point.m_position = regionPoints.m_positions[pointIndex];
+            point.m_normal = regionPoints.m_normals[pointIndex];
+            point.m_masks = AZStd::move(regionPoints.m_masks[pointIndex]);
+        }
+
         // After we've finished creating and annotating all the surface points, combine any points together that have effectively the
         // same XY coordinates and extremely similar Z values.  This produces results that are sorted in decreasing Z order.
         // Also, this filters out any remaining points that don't match the desired tag list.  This can happen when a surface provider
@@ -182,6 +182,37 @@ namespace SurfaceData
         }
     }
 
+    void TerrainSurfaceDataSystemComponent::GetSurfacePointsFromList(AZStd::span<const AZ::Vector3> inPositions, SurfacePointRegionList& surfacePointList) const
+    {
+        if (m_terrainBoundsIsValid)
+        {
+            // Enumerate the terrain handler once for the whole batch
+            auto enumerationCallback = [&](AzFramework::Terrain::TerrainDataRequests* terrain) -> bool
+            {
+                const AZ::Aabb terrainAabb = terrain->GetTerrainAabb();
+                const AZ::EntityId entityId = GetEntityId();
+                for (size_t inputIndex = 0; inputIndex < inPositions.size(); ++inputIndex)
+                {
+                    const AZ::Vector3& inPosition = inPositions[inputIndex];
+                    if (terrainAabb.Contains(inPosition))
+                    {
+                        bool isTerrainValidAtPoint = false;
+                        const float terrainHeight = terrain->GetHeight(inPosition, AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR, &isTerrainValidAtPoint);
+                        const bool isHole = !isTerrainValidAtPoint;
+
+                        SurfaceTagWeightMap& masks = surfacePointList.AddSurfacePoint(inputIndex, entityId,
+                            AZ::Vector3(inPosition.GetX(), inPosition.GetY(), terrainHeight), terrain->GetNormal(inPosition));
+                        const AZ::Crc32 terrainTag = isHole ? Constants::s_terrainHoleTagCrc : Constants::s_terrainTagCrc;
+                        AddMaxValueForMasks(masks, terrainTag, 1.0f);
+                    }
+                }
+                // Only one handler should exist.
+                return false;
+            };
+            AzFramework::Terrain::TerrainDataRequestBus::EnumerateHandlers(enumerationCallback);
+        }
+    }
+
     AZ::Aabb TerrainSurfaceDataSystemComponent::GetSurfaceAabb() const
     {
         auto terrain = AzFramework::Terrain::TerrainDataRequestBus::FindFirstHandler();
@@ -58,6 +58,7 @@ namespace SurfaceData
         //////////////////////////////////////////////////////////////////////////
         // SurfaceDataProviderRequestBus
         void GetSurfacePoints(const AZ::Vector3& inPosition, SurfacePointList& surfacePointList) const;
+        void GetSurfacePointsFromList(AZStd::span<const AZ::Vector3> inPositions, SurfacePointRegionList& surfacePointList) const override;
 
         ////////////////////////////////////////////////////////////////////////////
         // CrySystemEvents
@@ -743,4 +743,57 @@ TEST_F(SurfaceDataTestApp, SurfaceData_TestSurfacePointsFromRegion_DissimilarPoi
     }
 }
 
+TEST_F(SurfaceDataTestApp, SurfaceData_TestSurfacePointsFromRegion_MatchesPerPointQueries)
+{
+    // This test verifies that the batched region query produces the same points as querying every position separately,
+    // including for a modifier that only overlaps part of the region.
+
+    // Create a mock Surface Provider that covers from (0, 0) - (8, 8) in space, and a mock Surface Modifier that only
+    // covers from (2, 2) - (6, 6).
+    SurfaceData::SurfaceTagVector providerTags = { SurfaceData::SurfaceTag(m_testSurface1Crc) };
+    MockSurfaceProvider mockProvider(MockSurfaceProvider::ProviderType::SURFACE_PROVIDER, providerTags,
+                                     AZ::Vector3(0.0f), AZ::Vector3(8.0f), AZ::Vector3(1.0f, 1.0f, 4.0f));
+
+    SurfaceData::SurfaceTagVector modifierTags = { SurfaceData::SurfaceTag(m_testSurface2Crc) };
+    MockSurfaceProvider mockModifier(MockSurfaceProvider::ProviderType::SURFACE_MODIFIER, modifierTags,
+                                     AZ::Vector3(2.0f, 2.0f, 0.0f), AZ::Vector3(6.0f, 6.0f, 8.0f), AZ::Vector3(1.0f, 1.0f, 4.0f),
+                                     AZ::EntityId(0x22222222));
+
+    SurfaceData::SurfacePointListPerPosition availablePointsPerPosition;
+    AZ::Vector2 stepSize(1.0f, 1.0f);
+    AZ::Aabb regionBounds = AZ::Aabb::CreateFromMinMax(AZ::Vector3(0.0f), AZ::Vector3(8.0f));
+    SurfaceData::SurfaceTagVector testTags = { SurfaceData::SurfaceTag(m_testSurface1Crc), SurfaceData::SurfaceTag(m_testSurface2Crc) };
+
+    SurfaceData::SurfaceDataSystemRequestBus::Broadcast(
+        &SurfaceData::SurfaceDataSystemRequestBus::Events::GetSurfacePointsFromRegion,
+        regionBounds, stepSize, testTags, availablePointsPerPosition);
+
+    EXPECT_TRUE(ValidateRegionListSize(regionBounds, stepSize, availablePointsPerPosition));
+
+    size_t modifiedPoints = 0;
+    for (auto& queryPosition : availablePointsPerPosition)
+    {
+        SurfaceData::SurfacePointList expectedPoints;
+        SurfaceData::SurfaceDataSystemRequestBus::Broadcast(
+            &SurfaceData::SurfaceDataSystemRequestBus::Events::GetSurfacePoints,
+            queryPosition.first, testTags, expectedPoints);
+
+        const SurfaceData::SurfacePointList& pointList = queryPosition.second;
+        ASSERT_EQ(expectedPoints.size(), pointList.size());
+        for (size_t pointIndex = 0; pointIndex < pointList.size(); ++pointIndex)
+        {
+            EXPECT_TRUE(pointList[pointIndex].m_position.IsClose(expectedPoints[pointIndex].m_position));
+            EXPECT_EQ(expectedPoints[pointIndex].m_masks.size(), pointList[pointIndex].m_masks.size());
+            if (pointList[pointIndex].m_masks.size() == 2)
+            {
+                ++modifiedPoints;
+            }
+        }
+    }
+
+    // Only the points inside the modifier got its tag
+    EXPECT_GT(modifiedPoints, 0);
+    EXPECT_LT(modifiedPoints, availablePointsPerPosition.size() * 2);
+}
+
 AZ_UNIT_TEST_HOOK(DEFAULT_UNIT_TEST_ENV);
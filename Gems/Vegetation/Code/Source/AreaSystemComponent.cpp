@@ -21,6 +21,7 @@
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Jobs/JobCompletion.h>
 #include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/std/chrono/chrono.h>
 #include <AzCore/std/sort.h>
@@ -140,6 +141,8 @@ namespace Vegetation
                 ->Field("SectorDensity", &AreaSystemConfig::m_sectorDensity)
                 ->Field("SectorSizeInMeters", &AreaSystemConfig::m_sectorSizeInMeters)
                 ->Field("ThreadProcessingIntervalMs", &AreaSystemConfig::m_threadProcessingIntervalMs)
+                ->Field("ThreadProcessingBatchSize", &AreaSystemConfig::m_threadProcessingBatchSize)
+                ->Field("ThreadProcessingBudgetMs", &AreaSystemConfig::m_threadProcessingBudgetMs)
                 ->Field("SectorSearchPadding", &AreaSystemConfig::m_sectorSearchPadding)
                 ->Field("SectorPointSnapMode", &AreaSystemConfig::m_sectorPointSnapMode)
             ;
@@ -166,6 +169,12 @@ namespace Vegetation
                     ->DataElement(AZ::Edit::UIHandlers::Default, &AreaSystemConfig::m_threadProcessingIntervalMs, "Thread Processing Interval", "The delay (in milliseconds) between processing queued thread tasks.")
                     ->Attribute(AZ::Edit::Attributes::Min, 0)
                     ->Attribute(AZ::Edit::Attributes::Max, 5000)
+                    ->DataElement(AZ::Edit::UIHandlers::Default, &AreaSystemConfig::m_threadProcessingBatchSize, "Thread Processing Batch Size", "The number of sectors whose surface points are gathered in parallel jobs before they get filled.")
+                    ->Attribute(AZ::Edit::Attributes::Min, 1)
+                    ->Attribute(AZ::Edit::Attributes::Max, 64)
+                    ->DataElement(AZ::Edit::UIHandlers::Default, &AreaSystemConfig::m_threadProcessingBudgetMs, "Thread Processing Budget", "The time (in milliseconds) the vegetation thread can spend on sectors per tick before it resumes on the next tick. 0 means no limit.")
+                    ->Attribute(AZ::Edit::Attributes::Min, 0)
+                    ->Attribute(AZ::Edit::Attributes::Max, 1000)
                     ->DataElement(AZ::Edit::UIHandlers::Default, &AreaSystemConfig::m_sectorSearchPadding, "Sector Search Padding", "Increases the search radius for surrounding sectors when enumerating instances.")
                     ->Attribute(AZ::Edit::Attributes::Min, 0)
                     ->Attribute(AZ::Edit::Attributes::Max, 2)
@@ -185,6 +194,8 @@ namespace Vegetation
                 ->Property("sectorDensity", BehaviorValueProperty(&AreaSystemConfig::m_sectorDensity))
                 ->Property("sectorSizeInMeters", BehaviorValueProperty(&AreaSystemConfig::m_sectorSizeInMeters))
                 ->Property("threadProcessingIntervalMs", BehaviorValueProperty(&AreaSystemConfig::m_threadProcessingIntervalMs))
+                ->Property("threadProcessingBatchSize", BehaviorValueProperty(&AreaSystemConfig::m_threadProcessingBatchSize))
+                ->Property("threadProcessingBudgetMs", BehaviorValueProperty(&AreaSystemConfig::m_threadProcessingBudgetMs))
                 ->Property("sectorPointSnapMode",
                 [](AreaSystemConfig* config) { return static_cast<AZ::u8>(config->m_sectorPointSnapMode); },
                 [](AreaSystemConfig* config, const AZ::u8& i) { config->m_sectorPointSnapMode = static_cast<SnapMode>(i); })
@@ -756,6 +767,13 @@ namespace Vegetation
                 updateVegetationData = true;
             }
 
+            // if the vegetation thread ran out of time budget on the last tick, resume its work
+            if ((m_threadData.m_vegetationThreadState == PersistentThreadData::VegetationThreadState::Stopped) &&
+                m_threadData.m_vegetationThreadWorkPending.exchange(false))
+            {
+                updateVegetationData = true;
+            }
+
             if (m_vegetationThreadTaskTimer <= 0.0f)
             {
                 m_vegetationThreadTaskTimer = m_configuration.m_threadProcessingIntervalMs * 0.001f;
@@ -777,6 +795,8 @@ namespace Vegetation
                     m_cachedMainThreadData.m_sectorSizeInMeters = m_configuration.m_sectorSizeInMeters;
                     m_cachedMainThreadData.m_sectorDensity = m_configuration.m_sectorDensity;
                     m_cachedMainThreadData.m_sectorPointSnapMode = m_configuration.m_sectorPointSnapMode;
+                    m_cachedMainThreadData.m_threadProcessingBatchSize = AZStd::GetMax(m_configuration.m_threadProcessingBatchSize, 1);
+                    m_cachedMainThreadData.m_threadProcessingBudgetMs = m_configuration.m_threadProcessingBudgetMs;
                 }
 
                 // Set the state to Dirty to signal the thread that it will need to pull a new copy of the main thread state data
@@ -1071,15 +1091,10 @@ namespace Vegetation
         return itSector != m_sectorRollingWindow.end() ? &itSector->second : nullptr;
     }
 
-    AreaSystemComponent::SectorInfo* AreaSystemComponent::VegetationThreadTasks::CreateSector(const SectorId& sectorId, int sectorDensity, int sectorSizeInMeters, SnapMode sectorPointSnapMode)
+    AreaSystemComponent::SectorInfo* AreaSystemComponent::VegetationThreadTasks::AddSector(SectorInfo&& sectorInfo)
     {
         AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
 
-        SectorInfo sectorInfo;
-        sectorInfo.m_id = sectorId;
-        sectorInfo.m_bounds = GetSectorBounds(sectorId, sectorSizeInMeters);
-        UpdateSectorPoints(sectorInfo, sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
-
         AZStd::lock_guard<decltype(m_sectorRollingWindowMutex)> lock(m_sectorRollingWindowMutex);
         SectorInfo& sectorInfoRef = m_sectorRollingWindow[sectorInfo.m_id] = AZStd::move(sectorInfo);
         UpdateSectorCallbacks(sectorInfoRef);
@@ -1462,6 +1477,8 @@ namespace Vegetation
         // to this thread while it's still processing work.
         AZStd::lock_guard<decltype(threadData->m_vegetationThreadMutex)> lockTasks(threadData->m_vegetationThreadMutex);
 
+        const auto startTime = AZStd::chrono::system_clock::now();
+
         bool keepProcessing = true;
         while (keepProcessing && (threadData->m_vegetationThreadState != PersistentThreadData::VegetationThreadState::InterruptRequested))
         {
@@ -1493,7 +1510,17 @@ namespace Vegetation
 
             if (keepProcessing)
             {
-                keepProcessing = UpdateOneSector(threadData, vegTasks);
+                keepProcessing = UpdateSectorBatch(threadData, vegTasks);
+
+                // Once the time budget for this tick is used up, hand the remaining work over to the next tick.
+                const int budgetMs = m_cachedMainThreadData.m_threadProcessingBudgetMs;
+                if (keepProcessing && (budgetMs > 0) &&
+                    ((AZStd::chrono::system_clock::now() - startTime) >= AZStd::chrono::milliseconds(budgetMs)))
+                {
+                    RequeuePendingWork(threadData);
+                    threadData->m_vegetationThreadWorkPending = true;
+                    keepProcessing = false;
+                }
             }
         }
     }
@@ -1758,21 +1785,22 @@ namespace Vegetation
         return !m_deleteWorkList.empty() || !m_updateWorkList.empty();
     }
 
-    bool AreaSystemComponent::UpdateContext::UpdateOneSector(PersistentThreadData* threadData, VegetationThreadTasks* vegTasks)
+    bool AreaSystemComponent::UpdateContext::UpdateSectorBatch(PersistentThreadData* threadData, VegetationThreadTasks* vegTasks)
     {
         AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
 
         // This chooses work in the following order:
         // 1) Delete if we have more sectors than the total that should be in the view rectangle
-        // 2) Create/update if we have any sectors to create / update
+        // 2) Create/update a batch of sectors if we have any sectors to create / update
         // 3) Delete if we have any sectors to delete
 
-        // Delete if there are more active sectors than the number of desired sectors or the update list is empty.
-        if (!m_deleteWorkList.empty())
+        size_t activeSectorCount = 0;
         {
             AZStd::lock_guard<decltype(vegTasks->m_sectorRollingWindowMutex)> lock(vegTasks->m_sectorRollingWindowMutex);
+            activeSectorCount = vegTasks->m_sectorRollingWindow.size();
 
-            if ((vegTasks->m_sectorRollingWindow.size() > m_viewRectSectorCount) || m_updateWorkList.empty())
+            // Delete if there are more active sectors than the number of desired sectors or the update list is empty.
+            if (!m_deleteWorkList.empty() && ((activeSectorCount > m_viewRectSectorCount) || m_updateWorkList.empty()))
             {
                 vegTasks->DeleteSector(m_deleteWorkList.back());
                 m_deleteWorkList.pop_back();
@@ -1780,55 +1808,130 @@ namespace Vegetation
             }
         }
 
-        // Create / update if there's anything to do and we didn't prioritize a delete.
-        if (!m_updateWorkList.empty())
+        if (m_updateWorkList.empty())
+        {
+            // No sectors left to process, so tell our main loop to stop processing.
+            return false;
+        }
+
+        auto& sectorDensity = m_cachedMainThreadData.m_sectorDensity;
+        auto& sectorSizeInMeters = m_cachedMainThreadData.m_sectorSizeInMeters;
+        auto& sectorPointSnapMode = m_cachedMainThreadData.m_sectorPointSnapMode;
+
+        // Pull a batch of requests off the end of the work list, in the same order they would get processed one at a time.
+        // Creates are only added to a batch while we don't go over the number of sectors in the view rectangle, so that
+        // pending deletes still get prioritized.
+        const size_t maxBatchSize = aznumeric_cast<size_t>(m_cachedMainThreadData.m_threadProcessingBatchSize);
+        m_updateBatch.clear();
+        while (!m_updateWorkList.empty() && (m_updateBatch.size() < maxBatchSize))
         {
-            auto& updateEntry = m_updateWorkList.back();
-            SectorId sectorId = updateEntry.first;
-            UpdateMode mode = updateEntry.second;
+            const auto& updateEntry = m_updateWorkList.back();
+            if (updateEntry.second == UpdateMode::Create)
+            {
+                if (!m_updateBatch.empty() && !m_deleteWorkList.empty() && (activeSectorCount >= m_viewRectSectorCount))
+                {
+                    break;
+                }
+                ++activeSectorCount;
+            }
+            m_updateBatch.push_back(updateEntry);
             m_updateWorkList.pop_back();
+        }
+
+        // Gather the surface points of new sectors and sectors with a dirty surface cache.  This only queries surface data,
+        // so it's done in parallel jobs and without holding the rolling window lock.
+        m_updateBatchSectors.clear();
+        m_updateBatchSectors.resize(m_updateBatch.size());
+        const bool useJobs = m_updateBatch.size() > 1;
+        AZ::JobCompletion jobCompletion;
+        for (size_t batchIndex = 0; batchIndex < m_updateBatch.size(); ++batchIndex)
+        {
+            const SectorId& sectorId = m_updateBatch[batchIndex].first;
+            if (m_updateBatch[batchIndex].second == UpdateMode::Fill)
+            {
+                continue;
+            }
 
+            SectorInfo& sectorInfo = m_updateBatchSectors[batchIndex];
+            sectorInfo.m_id = sectorId;
+            sectorInfo.m_bounds = VegetationThreadTasks::GetSectorBounds(sectorId, sectorSizeInMeters);
+            if (useJobs)
+            {
+                auto job = AZ::CreateJobFunction([vegTasks, &sectorInfo, sectorDensity, sectorSizeInMeters, sectorPointSnapMode]()
+                {
+                    vegTasks->UpdateSectorPoints(sectorInfo, sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
+                }, true);
+                job->SetDependent(&jobCompletion);
+                job->Start();
+            }
+            else
             {
-                AZStd::lock_guard<decltype(vegTasks->m_sectorRollingWindowMutex)> lock(vegTasks->m_sectorRollingWindowMutex);
+                vegTasks->UpdateSectorPoints(sectorInfo, sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
+            }
+        }
+        jobCompletion.StartAndWaitForCompletion();
 
-                auto& sectorDensity = m_cachedMainThreadData.m_sectorDensity;
-                auto& sectorSizeInMeters = m_cachedMainThreadData.m_sectorSizeInMeters;
-                auto& sectorPointSnapMode = m_cachedMainThreadData.m_sectorPointSnapMode;
+        // Fill the sectors one at a time in the batch order.  Areas claim points in layer and priority order within each
+        // sector, so the results are the same as when the sectors are processed one by one.
+        AZStd::lock_guard<decltype(vegTasks->m_sectorRollingWindowMutex)> lock(vegTasks->m_sectorRollingWindowMutex);
+        for (size_t batchIndex = 0; batchIndex < m_updateBatch.size(); ++batchIndex)
+        {
+            const SectorId& sectorId = m_updateBatch[batchIndex].first;
+            SectorInfo& updatedSectorInfo = m_updateBatchSectors[batchIndex];
 
-                switch (mode)
+            switch (m_updateBatch[batchIndex].second)
+            {
+                case UpdateMode::RebuildSurfaceCacheAndFill:
                 {
-                    case UpdateMode::RebuildSurfaceCacheAndFill:
-                    {
-                        auto sectorInfo = vegTasks->GetSector(sectorId);
-                        AZ_Assert(sectorInfo, "Sector update mode is 'RebuildSurfaceCache' but sector doesn't exist");
-                        vegTasks->UpdateSectorPoints(*sectorInfo, sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
-                        vegTasks->FillSector(*sectorInfo, threadData->m_activeAreasInBubble);
-                    }
-                    break;
+                    auto sectorInfo = vegTasks->GetSector(sectorId);
+                    AZ_Assert(sectorInfo, "Sector update mode is 'RebuildSurfaceCache' but sector doesn't exist");
+                    sectorInfo->m_baseContext.m_availablePoints = AZStd::move(updatedSectorInfo.m_baseContext.m_availablePoints);
+                    sectorInfo->m_baseContext.m_masks = AZStd::move(updatedSectorInfo.m_baseContext.m_masks);
+                    vegTasks->FillSector(*sectorInfo, threadData->m_activeAreasInBubble);
+                }
+                break;
 
-                    case UpdateMode::Fill:
-                    {
-                        auto sectorInfo = vegTasks->GetSector(sectorId);
-                        AZ_Assert(sectorInfo, "Sector update mode is 'Fill' but sector doesn't exist");
-                        vegTasks->FillSector(*sectorInfo, threadData->m_activeAreasInBubble);
-                    }
-                    break;
+                case UpdateMode::Fill:
+                {
+                    auto sectorInfo = vegTasks->GetSector(sectorId);
+                    AZ_Assert(sectorInfo, "Sector update mode is 'Fill' but sector doesn't exist");
+                    vegTasks->FillSector(*sectorInfo, threadData->m_activeAreasInBubble);
+                }
+                break;
 
-                    case UpdateMode::Create:
-                    {
-                        AZ_Assert(!vegTasks->GetSector(sectorId), "Sector update mode is 'Create' but sector already exists");
-                        auto sectorInfo = vegTasks->CreateSector(sectorId, sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
-                        vegTasks->FillSector(*sectorInfo, threadData->m_activeAreasInBubble);
-                    }
-                    break;
+                case UpdateMode::Create:
+                {
+                    AZ_Assert(!vegTasks->GetSector(sectorId), "Sector update mode is 'Create' but sector already exists");
+                    auto sectorInfo = vegTasks->AddSector(AZStd::move(updatedSectorInfo));
+                    vegTasks->FillSector(*sectorInfo, threadData->m_activeAreasInBubble);
                 }
+                break;
             }
-
-            return true;
         }
 
-        // No sectors left to process, so tell our main loop to stop processing.
-        return false;
+        return true;
+    }
+
+    void AreaSystemComponent::UpdateContext::RequeuePendingWork(PersistentThreadData* threadData)
+    {
+        // The work lists don't outlive the vegetation thread, so mark the pending updates as dirty again to get them
+        // rebuilt the next time the thread runs.  Creates and deletes are recalculated from the view rectangle.
+        for (const auto& updateEntry : m_updateWorkList)
+        {
+            switch (updateEntry.second)
+            {
+                case UpdateMode::RebuildSurfaceCacheAndFill:
+                    threadData->m_dirtySectorSurfacePoints.MarkDirty(updateEntry.first);
+                    break;
+                case UpdateMode::Fill:
+                    threadData->m_dirtySectorContents.MarkDirty(updateEntry.first);
+                    break;
+                case UpdateMode::Create:
+                    break;
+            }
+        }
+        m_updateWorkList.clear();
+        m_deleteWorkList.clear();
     }
 
 }
@@ -48,6 +48,8 @@ namespace Vegetation
                    && m_sectorDensity == other.m_sectorDensity
                    && m_sectorSizeInMeters == other.m_sectorSizeInMeters
                    && m_threadProcessingIntervalMs == other.m_threadProcessingIntervalMs
+                   && m_threadProcessingBatchSize == other.m_threadProcessingBatchSize
+                   && m_threadProcessingBudgetMs == other.m_threadProcessingBudgetMs
                    && m_sectorSearchPadding == other.m_sectorSearchPadding
                    && m_sectorPointSnapMode == other.m_sectorPointSnapMode;
         }
@@ -56,6 +58,10 @@ namespace Vegetation
         int m_sectorDensity = 20;
         int m_sectorSizeInMeters = 16;
         int m_threadProcessingIntervalMs = 500;
+        //! Number of sectors whose surface points are gathered in parallel jobs before they are filled in order
+        int m_threadProcessingBatchSize = 8;
+        //! Time (in milliseconds) the vegetation thread may spend on sectors per tick, 0 means no limit
+        int m_threadProcessingBudgetMs = 0;
         int m_sectorSearchPadding = 0;
         SnapMode m_sectorPointSnapMode = SnapMode::Corner;
     private:
@@ -271,6 +277,8 @@ namespace Vegetation
             int m_sectorSizeInMeters = 0;
             int m_sectorDensity = 0;
             SnapMode m_sectorPointSnapMode = SnapMode::Corner;
+            int m_threadProcessingBatchSize = 1;
+            int m_threadProcessingBudgetMs = 0;
         };
 
         // VegetationThreadTasks is the task queue that's used equally by the main thread and the vegetation thread.
@@ -291,7 +299,8 @@ namespace Vegetation
             const SectorInfo* GetSector(const SectorId& sectorId) const;
             SectorInfo* GetSector(const SectorId& sectorId);
 
-            SectorInfo* CreateSector(const SectorId& sectorId, int sectorDensity, int sectorSizeInMeters, SnapMode sectorPointSnapMode);
+            //! Adds a sector whose surface points have already been gathered to the rolling window.
+            SectorInfo* AddSector(SectorInfo&& sectorInfo);
             void UpdateSectorPoints(SectorInfo& sectorInfo, int sectorDensity, int sectorSizeInMeters, SnapMode sectorPointSnapMode);
             void FillSector(SectorInfo& sectorInfo, const VegetationAreaVector& activeAreas);
             void DeleteSector(const SectorId& sectorId);
@@ -374,6 +383,9 @@ namespace Vegetation
             };
             AZStd::atomic<VegetationDataSyncState> m_vegetationDataSyncState{ VegetationDataSyncState::Synchronized };
 
+            // Set when the vegetation thread stopped because it ran out of time budget, so the main thread restarts it on the next tick.
+            AZStd::atomic_bool m_vegetationThreadWorkPending{ false };
+
             //! Reset the states that can get recalculated when the vegetation thread is run.
             //! This does *not* reset the states on registered vegetation area lists, since those only
             //! get filled out once.
@@ -429,7 +441,8 @@ namespace Vegetation
 
         private:
             bool UpdateSectorWorkLists(PersistentThreadData* threadData, VegetationThreadTasks* vegTasks);
-            bool UpdateOneSector(PersistentThreadData* threadData, VegetationThreadTasks* vegTasks);
+            bool UpdateSectorBatch(PersistentThreadData* threadData, VegetationThreadTasks* vegTasks);
+            void RequeuePendingWork(PersistentThreadData* threadData);
 
             enum class UpdateMode
             {
@@ -446,6 +459,11 @@ namespace Vegetation
             // be recalculated.
             AZStd::vector<AZStd::pair<SectorId, UpdateMode>> m_updateWorkList;
 
+            // The batch of update requests currently being processed, along with the sectors that surface points get gathered into.
+            // These are persistent to avoid reallocating them for every batch.
+            AZStd::vector<AZStd::pair<SectorId, UpdateMode>> m_updateBatch;
+            AZStd::vector<SectorInfo> m_updateBatchSectors;
+
             // Sector counts of the number of expected sectors in the view rectangle vs the number of sectors
             // currently active.  These are used to "load balance" sector deletes and creates so that we don't have
             // too many sectors active at any one point in time.
@@ -9,6 +9,7 @@
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/algorithm.h>
 
 namespace Vegetation
 {
@@ -273,6 +274,33 @@ namespace Vegetation
         return result;
     }
 
+    void ReferenceShapeComponent::ArePointsInside(AZStd::span<const AZ::Vector3> points, AZStd::span<bool> outInside)
+    {
+        // same results as IsPointInside when the request can't be forwarded
+        AZStd::fill(outInside.begin(), outInside.end(), false);
+
+        AZ_WarningOnce("Vegetation", !m_isRequestInProgress, "Detected cyclic dependences with vegetation entity references");
+        if (AllowRequest())
+        {
+            m_isRequestInProgress = true;
+            LmbrCentral::ShapeComponentRequestsBus::Event(m_configuration.m_shapeEntityId, &LmbrCentral::ShapeComponentRequestsBus::Events::ArePointsInside, points, outInside);
+            m_isRequestInProgress = false;
+        }
+    }
+
+    void ReferenceShapeComponent::DistanceSquaredFromPoints(AZStd::span<const AZ::Vector3> points, AZStd::span<float> outDistancesSquared)
+    {
+        AZStd::fill(outDistancesSquared.begin(), outDistancesSquared.end(), FLT_MAX);
+
+        AZ_WarningOnce("Vegetation", !m_isRequestInProgress, "Detected cyclic dependences with vegetation entity references");
+        if (AllowRequest())
+        {
+            m_isRequestInProgress = true;
+            LmbrCentral::ShapeComponentRequestsBus::Event(m_configuration.m_shapeEntityId, &LmbrCentral::ShapeComponentRequestsBus::Events::DistanceSquaredFromPoints, points, outDistancesSquared);
+            m_isRequestInProgress = false;
+        }
+    }
+
     AZ::Vector3 ReferenceShapeComponent::GenerateRandomPointInside(AZ::RandomDistributionType randomDistribution)
     {
         AZ::Vector3 result = AZ::Vector3::CreateZero();
@@ -10,6 +10,7 @@
 #include "EditorWhiteBoxDefaultShapeTypes.h"
 
 #include <AzCore/Component/ComponentBus.h>
+#include <WhiteBox/WhiteBoxToolApi.h>
 
 namespace WhiteBox
 {
@@ -75,6 +76,11 @@ namespace WhiteBox
         //! Notify the component the mesh has been modified.
         virtual void OnWhiteBoxMeshModified() {}
 
+        //! Notify the component the mesh is being modified by an edit still in progress (e.g. a manipulator drag).
+        //! Only the render mesh is updated, the physics mesh waits for OnWhiteBoxMeshModified once the edit completes.
+        //! @param modifiedFaceHandles The faces whose vertices, normals or uvs changed.
+        virtual void OnWhiteBoxMeshModifiedDuringEdit([[maybe_unused]] const Api::FaceHandles& modifiedFaceHandles) {}
+
         //! Notify listeners when the default shape of the white box mesh changes.
         virtual void OnDefaultShapeTypeChanged([[maybe_unused]] DefaultShapeType defaultShape) {}
 
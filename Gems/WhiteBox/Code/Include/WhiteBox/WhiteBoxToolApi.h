@@ -263,6 +263,12 @@ namespace WhiteBox
         //! Return user edge handles for a given vertex.
         //! @note The edge handles returned will only include 'user' edges.
         EdgeHandles VertexUserEdgeHandles(const WhiteBoxMesh& whiteBox, VertexHandle vertexHandle);
+
+        //! Return all face handles using a given vertex.
+        FaceHandles VertexFaceHandles(const WhiteBoxMesh& whiteBox, VertexHandle vertexHandle);
+
+        //! Return all face handles using any of the given vertices (each face is only returned once).
+        FaceHandles VertexFaceHandles(const WhiteBoxMesh& whiteBox, const VertexHandles& vertexHandles);
         ///////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
         ///////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -651,6 +657,9 @@ namespace WhiteBox
         //! Recalculate all normals of each face in the mesh.
         void CalculateNormals(WhiteBoxMesh& whiteBox);
 
+        //! Recalculate the normals of the given faces.
+        void CalculateNormals(WhiteBoxMesh& whiteBox, const FaceHandles& faceHandles);
+
         //! Zero/clear all uvs.
         void ZeroUVs(WhiteBoxMesh& whiteBox);
 
@@ -658,6 +667,9 @@ namespace WhiteBox
         //! @note This will produce a tiling effect across each side of the mesh.
         void CalculatePlanarUVs(WhiteBoxMesh& whiteBox);
 
+        //! Calculate planar uvs for the halfedges of the given faces.
+        void CalculatePlanarUVs(WhiteBoxMesh& whiteBox, const FaceHandles& faceHandles);
+
         //! Hide an edge to merge two polygons that share the same edge.
         //! Return the handle to the merged polygon.
         PolygonHandle HideEdge(WhiteBoxMesh& whiteBox, EdgeHandle edgeHandle);
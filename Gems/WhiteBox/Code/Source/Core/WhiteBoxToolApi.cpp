@@ -1871,6 +1871,38 @@ namespace WhiteBox
             return vertexEdgeHandles;
         }
 
+        FaceHandles VertexFaceHandles(const WhiteBoxMesh& whiteBox, const VertexHandle vertexHandle)
+        {
+            FaceHandles faceHandles;
+
+            const auto omVertexHandle = om_vh(vertexHandle);
+            for (auto vfh = whiteBox.mesh.cvf_ccwbegin(omVertexHandle); vfh != whiteBox.mesh.cvf_ccwend(omVertexHandle);
+                 ++vfh)
+            {
+                faceHandles.push_back(wb_fh(*vfh));
+            }
+
+            return faceHandles;
+        }
+
+        FaceHandles VertexFaceHandles(const WhiteBoxMesh& whiteBox, const VertexHandles& vertexHandles)
+        {
+            AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzToolsFramework);
+
+            FaceHandles faceHandles;
+            for (const VertexHandle vertexHandle : vertexHandles)
+            {
+                const FaceHandles vertexFaceHandles = VertexFaceHandles(whiteBox, vertexHandle);
+                faceHandles.insert(faceHandles.end(), vertexFaceHandles.begin(), vertexFaceHandles.end());
+            }
+
+            // faces are shared by neighboring vertices
+            AZStd::sort(faceHandles.begin(), faceHandles.end());
+            faceHandles.erase(AZStd::unique(faceHandles.begin(), faceHandles.end()), faceHandles.end());
+
+            return faceHandles;
+        }
+
         template<typename EdgeFn>
         static AZStd::vector<AZ::Vector3> VertexUserEdges(
             const WhiteBoxMesh& whiteBox, const VertexHandle vertexHandle, EdgeFn&& edgeFn)
@@ -2645,6 +2677,18 @@ namespace WhiteBox
             whiteBox.mesh.update_normals();
         }
 
+        void CalculateNormals(WhiteBoxMesh& whiteBox, const FaceHandles& faceHandles)
+        {
+            AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzToolsFramework);
+
+            // only face normals are requested by white box meshes (see InitializeWhiteBoxMesh)
+            for (const FaceHandle faceHandle : faceHandles)
+            {
+                const auto omFaceHandle = om_fh(faceHandle);
+                whiteBox.mesh.set_normal(omFaceHandle, whiteBox.mesh.calc_face_normal(omFaceHandle));
+            }
+        }
+
         void ZeroUVs(WhiteBoxMesh& whiteBox)
         {
             AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzToolsFramework);
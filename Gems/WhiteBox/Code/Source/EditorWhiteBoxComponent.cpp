@@ -58,6 +58,26 @@ namespace WhiteBox
             AzToolsFramework::PropertyModificationRefreshLevel::Refresh_AttributesAndValues);
     }
 
+    static WhiteBoxFace CreateWhiteBoxFaceFromHandle(const WhiteBoxMesh& whiteBox, const Api::FaceHandle& faceHandle)
+    {
+        const auto copyVertex = [&whiteBox](const Api::HalfedgeHandle& in, WhiteBoxVertex& out)
+        {
+            const auto vh = Api::HalfedgeVertexHandleAtTip(whiteBox, in);
+            out.m_position = Api::VertexPosition(whiteBox, vh);
+            out.m_uv = Api::HalfedgeUV(whiteBox, in);
+        };
+
+        WhiteBoxFace face;
+        face.m_normal = Api::FaceNormal(whiteBox, faceHandle);
+        const auto faceHalfedgeHandles = Api::FaceHalfedgeHandles(whiteBox, faceHandle);
+
+        copyVertex(faceHalfedgeHandles[0], face.m_v1);
+        copyVertex(faceHalfedgeHandles[1], face.m_v2);
+        copyVertex(faceHalfedgeHandles[2], face.m_v3);
+
+        return face;
+    }
+
     // build intermediate data to be passed to WhiteBoxRenderMeshInterface
     // to be used to generate concrete render mesh
     static WhiteBoxRenderData CreateWhiteBoxRenderData(const WhiteBoxMesh& whiteBox, const WhiteBoxMaterial& material)
@@ -70,30 +90,10 @@ namespace WhiteBox
         const size_t faceCount = Api::MeshFaceCount(whiteBox);
         faceData.reserve(faceCount);
 
-        const auto createWhiteBoxFaceFromHandle = [&whiteBox](const Api::FaceHandle& faceHandle) -> WhiteBoxFace
-        {
-            const auto copyVertex = [&whiteBox](const Api::HalfedgeHandle& in, WhiteBoxVertex& out)
-            {
-                const auto vh = Api::HalfedgeVertexHandleAtTip(whiteBox, in);
-                out.m_position = Api::VertexPosition(whiteBox, vh);
-                out.m_uv = Api::HalfedgeUV(whiteBox, in);
-            };
-
-            WhiteBoxFace face;
-            face.m_normal = Api::FaceNormal(whiteBox, faceHandle);
-            const auto faceHalfedgeHandles = Api::FaceHalfedgeHandles(whiteBox, faceHandle);
-
-            copyVertex(faceHalfedgeHandles[0], face.m_v1);
-            copyVertex(faceHalfedgeHandles[1], face.m_v2);
-            copyVertex(faceHalfedgeHandles[2], face.m_v3);
-
-            return face;
-        };
-
         const auto faceHandles = Api::MeshFaceHandles(whiteBox);
         for (const auto faceHandle : faceHandles)
         {
-            faceData.push_back(createWhiteBoxFaceFromHandle(faceHandle));
+            faceData.push_back(CreateWhiteBoxFaceFromHandle(whiteBox, faceHandle));
         }
 
         renderData.m_material = material;
@@ -406,10 +406,55 @@ namespace WhiteBox
         }
     }
 
+    void EditorWhiteBoxComponent::OnWhiteBoxMeshModifiedDuringEdit(const Api::FaceHandles& modifiedFaceHandles)
+    {
+        // cooking the physics mesh (and updating the other users of an asset) on every mouse move of a drag
+        // is too slow for large meshes, only the render mesh of this component follows the edit until it completes
+        UpdateRenderMesh(modifiedFaceHandles);
+    }
+
     void EditorWhiteBoxComponent::RebuildRenderMesh()
     {
         AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzToolsFramework);
 
+        // must have been created in Activate or have had the Entity made visible again
+        if (m_renderMesh.has_value())
+        {
+            // cache the white box render data
+            m_renderData = CreateWhiteBoxRenderData(*GetWhiteBoxMesh(), m_material);
+        }
+
+        BuildRenderMesh();
+    }
+
+    void EditorWhiteBoxComponent::UpdateRenderMesh(const Api::FaceHandles& modifiedFaceHandles)
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzToolsFramework);
+
+        if (m_renderMesh.has_value())
+        {
+            const WhiteBoxMesh& whiteBox = *GetWhiteBoxMesh();
+
+            // the cached faces are stored in face handle order, which only holds while the topology
+            // matches the one the render data was created from (an append changes the number of faces)
+            if (m_renderData.m_faces.size() == Api::MeshFaceCount(whiteBox))
+            {
+                for (const Api::FaceHandle& faceHandle : modifiedFaceHandles)
+                {
+                    m_renderData.m_faces[faceHandle.Index()] = CreateWhiteBoxFaceFromHandle(whiteBox, faceHandle);
+                }
+            }
+            else
+            {
+                m_renderData = CreateWhiteBoxRenderData(whiteBox, m_material);
+            }
+        }
+
+        BuildRenderMesh();
+    }
+
+    void EditorWhiteBoxComponent::BuildRenderMesh()
+    {
         // reset caches when the mesh changes
         m_worldAabb.reset();
         m_localAabb.reset();
@@ -420,9 +465,6 @@ namespace WhiteBox
         // must have been created in Activate or have had the Entity made visible again
         if (m_renderMesh.has_value())
         {
-            // cache the white box render data
-            m_renderData = CreateWhiteBoxRenderData(*GetWhiteBoxMesh(), m_material);
-
             // it's possible the white box mesh data isn't yet ready (for example if it's stored
             // in an asset which hasn't finished loading yet) so don't attempt to create a render
             // mesh with no data
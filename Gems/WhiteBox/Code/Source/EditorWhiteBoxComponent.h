@@ -101,10 +101,15 @@ namespace WhiteBox
 
         // EditorWhiteBoxComponentNotificationBus overrides ...
         void OnWhiteBoxMeshModified() override;
+        void OnWhiteBoxMeshModifiedDuringEdit(const Api::FaceHandles& modifiedFaceHandles) override;
 
         void ShowRenderMesh();
         void HideRenderMesh();
         void RebuildRenderMesh();
+        //! Update the cached render data of the modified faces only and rebuild the render mesh from it.
+        void UpdateRenderMesh(const Api::FaceHandles& modifiedFaceHandles);
+        //! Build the render mesh from the cached render data.
+        void BuildRenderMesh();
         void RebuildPhysicsMesh();
         void ExportToFile();
         void SaveAsAsset();
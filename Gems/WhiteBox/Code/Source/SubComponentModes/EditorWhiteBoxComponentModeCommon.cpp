@@ -40,6 +40,31 @@ namespace WhiteBox
         ComponentModeRequestBus::Event(entityComponentIdPair, &ComponentModeRequestBus::Events::Refresh);
     }
 
+    void UpdateWhiteBoxDuringEdit(
+        WhiteBoxMesh& whiteBox, const AZ::EntityComponentIdPair entityComponentIdPair,
+        const Api::VertexHandles& movedVertexHandles)
+    {
+        // only the faces using a moved vertex have a different normal or uvs
+        const Api::FaceHandles modifiedFaceHandles = Api::VertexFaceHandles(whiteBox, movedVertexHandles);
+        Api::CalculateNormals(whiteBox, modifiedFaceHandles);
+        Api::CalculatePlanarUVs(whiteBox, modifiedFaceHandles);
+
+        EditorWhiteBoxComponentNotificationBus::Event(
+            entityComponentIdPair, &EditorWhiteBoxComponentNotifications::OnWhiteBoxMeshModifiedDuringEdit,
+            modifiedFaceHandles);
+    }
+
+    void CompleteWhiteBoxEdit(const AZ::EntityComponentIdPair entityComponentIdPair)
+    {
+        // store the final mesh
+        EditorWhiteBoxComponentRequestBus::Event(
+            entityComponentIdPair, &EditorWhiteBoxComponentRequests::SerializeWhiteBox);
+
+        // rebuild everything the edit in progress left out (physics mesh and other users of a shared asset)
+        EditorWhiteBoxComponentNotificationBus::Event(
+            entityComponentIdPair, &EditorWhiteBoxComponentNotifications::OnWhiteBoxMeshModified);
+    }
+
     bool InputFlipEdge(const AzToolsFramework::ViewportInteraction::MouseInteractionEvent& mouseInteraction)
     {
         return mouseInteraction.m_mouseInteraction.m_mouseButtons.Right() &&
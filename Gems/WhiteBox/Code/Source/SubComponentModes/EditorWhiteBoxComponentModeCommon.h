@@ -9,6 +9,7 @@
 
 #include <AzCore/Component/ComponentBus.h>
 #include <AzToolsFramework/Viewport/ViewportTypes.h>
+#include <WhiteBox/WhiteBoxToolApi.h>
 
 namespace WhiteBox
 {
@@ -18,6 +19,15 @@ namespace WhiteBox
     void RecordWhiteBoxAction(
         WhiteBoxMesh& whiteBox, const AZ::EntityComponentIdPair entityComponentIdPair, const char* undoRedoDesc);
 
+    //! Recalculate the normals and uvs of the faces around the moved vertices and notify the white box mesh
+    //! of an edit in progress (the physics mesh is only rebuilt when the edit completes)
+    void UpdateWhiteBoxDuringEdit(
+        WhiteBoxMesh& whiteBox, const AZ::EntityComponentIdPair entityComponentIdPair,
+        const Api::VertexHandles& movedVertexHandles);
+
+    //! Notify the white box mesh an edit made by a manipulator has completed
+    void CompleteWhiteBoxEdit(const AZ::EntityComponentIdPair entityComponentIdPair);
+
     //! Returns true if user input is for flipping an edge
     bool InputFlipEdge(const AzToolsFramework::ViewportInteraction::MouseInteractionEvent& mouseInteraction);
 
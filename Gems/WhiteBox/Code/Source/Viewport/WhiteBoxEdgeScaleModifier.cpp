@@ -7,6 +7,7 @@
 
 #include "WhiteBox_precompiled.h"
 
+#include "SubComponentModes/EditorWhiteBoxComponentModeCommon.h"
 #include "SubComponentModes/EditorWhiteBoxDefaultModeBus.h"
 #include "Util/WhiteBoxMathUtil.h"
 #include "Viewport/WhiteBoxViewportConstants.h"
@@ -147,8 +148,9 @@ namespace WhiteBox
                             ScalePosition(normalizedScale, m_initialVertexPositions[vertexIndex], polygonSpace));
                     }
 
-                    Api::CalculateNormals(*whiteBox);
-                    Api::CalculatePlanarUVs(*whiteBox);
+                    // only the faces around the edge need updating, the full rebuild waits for mouse up
+                    UpdateWhiteBoxDuringEdit(
+                        *whiteBox, m_entityComponentIdPair, Api::VertexHandles{vertexHandles[0], vertexHandles[1]});
 
                     // update all manipulator positions
                     for (size_t manipulatorIndex = 0; manipulatorIndex < m_scaleManipulators.size(); ++manipulatorIndex)
@@ -176,17 +178,12 @@ namespace WhiteBox
                     EditorWhiteBoxDefaultModeRequestBus::Event(
                         m_entityComponentIdPair,
                         &EditorWhiteBoxDefaultModeRequestBus::Events::RefreshVertexSelectionModifier);
-
-                    EditorWhiteBoxComponentNotificationBus::Event(
-                        m_entityComponentIdPair,
-                        &EditorWhiteBoxComponentNotificationBus::Events::OnWhiteBoxMeshModified);
                 });
 
             manipulator->InstallLeftMouseUpCallback(
                 [this](const AzToolsFramework::LinearManipulator::Action&)
                 {
-                    EditorWhiteBoxComponentRequestBus::Event(
-                        m_entityComponentIdPair, &EditorWhiteBoxComponentRequests::SerializeWhiteBox);
+                    CompleteWhiteBoxEdit(m_entityComponentIdPair);
                 });
 
             m_scaleManipulators[vertexIndex] = AZStd::move(manipulator);
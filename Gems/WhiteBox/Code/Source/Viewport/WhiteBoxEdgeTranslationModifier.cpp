@@ -9,6 +9,7 @@
 
 #include "EditorWhiteBoxComponentModeBus.h"
 #include "EditorWhiteBoxEdgeModifierBus.h"
+#include "SubComponentModes/EditorWhiteBoxComponentModeCommon.h"
 #include "SubComponentModes/EditorWhiteBoxDefaultModeBus.h"
 #include "Util/WhiteBoxMathUtil.h"
 #include "Viewport/WhiteBoxModifierUtil.h"
@@ -201,6 +202,10 @@ namespace WhiteBox
                             m_hoveredEdgeHandle, nextEdgeHandle);
 
                         m_hoveredEdgeHandle = nextEdgeHandle;
+
+                        // the topology changed, recalculate the whole mesh once
+                        Api::CalculateNormals(*whiteBox);
+                        Api::CalculatePlanarUVs(*whiteBox);
                     }
                 }
                 else if (AppendInactive(sharedState->m_appendStage))
@@ -249,11 +254,9 @@ namespace WhiteBox
                         &EditorWhiteBoxDefaultModeRequestBus::Events::RefreshVertexSelectionModifier);
                 }
 
-                Api::CalculateNormals(*whiteBox);
-                Api::CalculatePlanarUVs(*whiteBox);
-
-                EditorWhiteBoxComponentNotificationBus::Event(
-                    m_entityComponentIdPair, &EditorWhiteBoxComponentNotificationBus::Events::OnWhiteBoxMeshModified);
+                // only the faces around the edges need updating, the full rebuild waits for mouse up
+                UpdateWhiteBoxDuringEdit(
+                    *whiteBox, m_entityComponentIdPair, VertexHandlesForEdges(*whiteBox, m_edgeHandles));
             });
 
         m_translationManipulator->InstallLeftMouseUpCallback(
@@ -272,8 +275,7 @@ namespace WhiteBox
                 }
                 else
                 {
-                    EditorWhiteBoxComponentRequestBus::Event(
-                        m_entityComponentIdPair, &EditorWhiteBoxComponentRequests::SerializeWhiteBox);
+                    CompleteWhiteBoxEdit(m_entityComponentIdPair);
                 }
             });
     }
@@ -8,6 +8,7 @@
 #include "WhiteBox_precompiled.h"
 
 #include "EditorWhiteBoxPolygonModifierBus.h"
+#include "SubComponentModes/EditorWhiteBoxComponentModeCommon.h"
 #include "SubComponentModes/EditorWhiteBoxDefaultModeBus.h"
 #include "Util/WhiteBoxMathUtil.h"
 #include "Viewport/WhiteBoxViewportConstants.h"
@@ -114,8 +115,7 @@ namespace WhiteBox
                 manipulator->InstallLeftMouseUpCallback(
                     [this](const AzToolsFramework::LinearManipulator::Action&)
                     {
-                        EditorWhiteBoxComponentRequestBus::Event(
-                            m_entityComponentIdPair, &EditorWhiteBoxComponentRequests::SerializeWhiteBox);
+                        CompleteWhiteBoxEdit(m_entityComponentIdPair);
                     });
 
                 m_scaleManipulators.push_back(manipulator);
@@ -158,6 +158,10 @@ namespace WhiteBox
             m_polygonHandle = polygonHandle;
 
             m_appendStage = AppendStage::Complete;
+
+            // the topology changed, recalculate the whole mesh once
+            Api::CalculateNormals(*whiteBox);
+            Api::CalculatePlanarUVs(*whiteBox);
         }
 
         if (m_appendStage == AppendStage::None || m_appendStage == AppendStage::Complete)
@@ -180,10 +184,10 @@ namespace WhiteBox
                         *whiteBox, vertexHandles[vertexIndex],
                         ScalePosition(normalizedUniformScale, m_initialVertexPositions[vertexIndex], polygonSpace));
                 }
-            }
 
-            Api::CalculateNormals(*whiteBox);
-            Api::CalculatePlanarUVs(*whiteBox);
+                // only the faces around the polygon need updating, the full rebuild waits for mouse up
+                UpdateWhiteBoxDuringEdit(*whiteBox, m_entityComponentIdPair, vertexHandles);
+            }
 
             {
                 // border vertex handles match those used for manipulators
@@ -212,9 +216,6 @@ namespace WhiteBox
 
             EditorWhiteBoxDefaultModeRequestBus::Event(
                 m_entityComponentIdPair, &EditorWhiteBoxDefaultModeRequestBus::Events::RefreshVertexSelectionModifier);
-
-            EditorWhiteBoxComponentNotificationBus::Event(
-                m_entityComponentIdPair, &EditorWhiteBoxComponentNotificationBus::Events::OnWhiteBoxMeshModified);
         }
     }
 
@@ -9,6 +9,7 @@
 
 #include "EditorWhiteBoxComponentModeBus.h"
 #include "EditorWhiteBoxPolygonModifierBus.h"
+#include "SubComponentModes/EditorWhiteBoxComponentModeCommon.h"
 #include "SubComponentModes/EditorWhiteBoxDefaultModeBus.h"
 #include "Viewport/WhiteBoxManipulatorViews.h"
 #include "Viewport/WhiteBoxModifierUtil.h"
@@ -162,6 +163,10 @@ namespace WhiteBox
                         }
 
                         m_polygonHandle = appendedPolygonHandles.m_appendedPolygonHandle;
+
+                        // the topology changed, recalculate the whole mesh once
+                        Api::CalculateNormals(*whiteBox);
+                        Api::CalculatePlanarUVs(*whiteBox);
                     }
                 }
 
@@ -207,12 +212,8 @@ namespace WhiteBox
                         &EditorWhiteBoxDefaultModeRequestBus::Events::RefreshVertexSelectionModifier);
                 }
 
-                Api::CalculateNormals(*whiteBox);
-                Api::CalculatePlanarUVs(*whiteBox);
-
-                // inefficient but easy/effective - just rebuild the whole mesh after every change
-                EditorWhiteBoxComponentNotificationBus::Event(
-                    m_entityComponentIdPair, &EditorWhiteBoxComponentNotificationBus::Events::OnWhiteBoxMeshModified);
+                // only the faces around the polygon need updating, the full rebuild waits for mouse up
+                UpdateWhiteBoxDuringEdit(*whiteBox, m_entityComponentIdPair, m_vertexHandles);
             });
 
         m_translationManipulator->InstallLeftMouseUpCallback(
@@ -232,8 +233,7 @@ namespace WhiteBox
                 }
                 else
                 {
-                    EditorWhiteBoxComponentRequestBus::Event(
-                        entityComponentIdPair, &EditorWhiteBoxComponentRequests::SerializeWhiteBox);
+                    CompleteWhiteBoxEdit(entityComponentIdPair);
                 }
             });
     }
@@ -7,6 +7,7 @@
 
 #include "WhiteBox_precompiled.h"
 
+#include "SubComponentModes/EditorWhiteBoxComponentModeCommon.h"
 #include "SubComponentModes/EditorWhiteBoxDefaultModeBus.h"
 #include "Util/WhiteBoxMathUtil.h"
 #include "Viewport/WhiteBoxModifierUtil.h"
@@ -200,13 +201,9 @@ namespace WhiteBox
                         m_entityComponentIdPair,
                         &EditorWhiteBoxDefaultModeRequestBus::Events::RefreshEdgeScaleModifier);
 
-                    EditorWhiteBoxComponentNotificationBus::Event(
-                        m_entityComponentIdPair,
-                        &EditorWhiteBoxComponentNotificationBus::Events::OnWhiteBoxMeshModified);
+                    // only the faces around the vertex need updating, the full rebuild waits for mouse up
+                    UpdateWhiteBoxDuringEdit(*whiteBox, m_entityComponentIdPair, Api::VertexHandles{m_vertexHandle});
                 }
-
-                Api::CalculateNormals(*whiteBox);
-                Api::CalculatePlanarUVs(*whiteBox);
             });
 
         m_translationManipulator->InstallLeftMouseUpCallback(
@@ -234,8 +231,7 @@ namespace WhiteBox
                         manipulator->AddAxes(Api::VertexUserEdgeAxes(*whiteBox, m_vertexHandle));
                     }
 
-                    EditorWhiteBoxComponentRequestBus::Event(
-                        m_entityComponentIdPair, &EditorWhiteBoxComponentRequests::SerializeWhiteBox);
+                    CompleteWhiteBoxEdit(m_entityComponentIdPair);
                 }
 
                 m_pressTime = 0.0f;
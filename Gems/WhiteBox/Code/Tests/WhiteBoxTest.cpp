@@ -13,6 +13,7 @@
 #include <AzCore/Math/Transform.h>
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/algorithm.h>
 #include <AzCore/std/containers/array.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzQtComponents/Utilities/QtPluginPaths.h>
@@ -1355,6 +1356,52 @@ namespace UnitTest
         EXPECT_THAT(Api::MeshFaces(*m_whiteBox), Eq(Api::MeshFaces(*whiteBoxClone)));
     }
 
+    TEST_F(WhiteBoxTestFixture, VertexFaceHandlesAreUniqueAndContainTheVertices)
+    {
+        namespace Api = WhiteBox::Api;
+        using ::testing::Contains;
+        using ::testing::Eq;
+
+        Api::InitializeAsUnitCube(*m_whiteBox);
+
+        const Api::VertexHandle vertexHandle = Api::VertexHandle{0};
+        const Api::FaceHandles faceHandles = Api::VertexFaceHandles(*m_whiteBox, vertexHandle);
+
+        EXPECT_THAT(faceHandles.size(), Eq(Api::VertexOutgoingHalfedgeHandles(*m_whiteBox, vertexHandle).size()));
+        for (const Api::FaceHandle& faceHandle : faceHandles)
+        {
+            EXPECT_THAT(Api::FaceVertexHandles(*m_whiteBox, faceHandle), Contains(vertexHandle));
+        }
+
+        // faces shared by several vertices are only returned once
+        const Api::VertexHandles vertexHandles = {Api::VertexHandle{0}, Api::VertexHandle{1}};
+        Api::FaceHandles sharedFaceHandles = Api::VertexFaceHandles(*m_whiteBox, vertexHandles);
+        const auto sharedFaceCount = sharedFaceHandles.size();
+        sharedFaceHandles.erase(AZStd::unique(sharedFaceHandles.begin(), sharedFaceHandles.end()), sharedFaceHandles.end());
+
+        EXPECT_THAT(sharedFaceHandles.size(), Eq(sharedFaceCount));
+    }
+
+    TEST_F(WhiteBoxTestFixture, CalculateNormalsOfVertexFacesMatchesFullMeshCalculation)
+    {
+        namespace Api = WhiteBox::Api;
+
+        Api::InitializeAsUnitCube(*m_whiteBox);
+
+        const Api::VertexHandle vertexHandle = Api::VertexHandle{0};
+        Api::SetVertexPosition(
+            *m_whiteBox, vertexHandle, Api::VertexPosition(*m_whiteBox, vertexHandle) + AZ::Vector3(0.25f, -0.5f, 0.75f));
+
+        Api::WhiteBoxMeshPtr whiteBoxClone = Api::CloneMesh(*m_whiteBox);
+        Api::CalculateNormals(*whiteBoxClone);
+        Api::CalculateNormals(*m_whiteBox, Api::VertexFaceHandles(*m_whiteBox, vertexHandle));
+
+        for (const Api::FaceHandle& faceHandle : Api::VertexFaceHandles(*m_whiteBox, vertexHandle))
+        {
+            EXPECT_THAT(Api::FaceNormal(*m_whiteBox, faceHandle), IsClose(Api::FaceNormal(*whiteBoxClone, faceHandle)));
+        }
+    }
+
     TEST_F(WhiteBoxTestFixture, EdgeVertexHandlesTailTipAreExpected)
     {
         namespace Api = WhiteBox::Api;
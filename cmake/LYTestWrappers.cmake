@@ -460,6 +460,8 @@ endfunction()
 #      If not supplied, json is used as a default and the test run command will output results to
 #      "${CMAKE_BINARY_DIR}/BenchmarkResults/" directory
 #      NOTE: Not used if a custom TEST_COMMAND is supplied
+# \arg:BENCHMARK_FILTER(optional) - Regular expression of the benchmarks to run, used to split the benchmarks of a target per subsystem
+#      NOTE: Not used if a custom TEST_COMMAND is supplied
 # \arg:TIMEOUT (optional) The timeout in seconds for the module. If not set, will have its timeout set by ly_add_test to the default timeout.
 function(ly_add_googlebenchmark)
     if(NOT PAL_TRAIT_BUILD_TESTS_SUPPORTED)
@@ -469,7 +471,7 @@ function(ly_add_googlebenchmark)
         return()
     endif()
 
-    set(one_value_args NAME TARGET OUTPUT_FILE_FORMAT TIMEOUT)
+    set(one_value_args NAME TARGET OUTPUT_FILE_FORMAT BENCHMARK_FILTER TIMEOUT)
     set(multi_value_args TEST_REQUIRES TEST_COMMAND COMPONENT)
     cmake_parse_arguments(ly_add_googlebenchmark "${options}" "${one_value_args}" "${multi_value_args}" ${ARGN})
 
@@ -494,6 +496,9 @@ function(ly_add_googlebenchmark)
             "--benchmark_out=${CMAKE_BINARY_DIR}/BenchmarkResults/${stripped_name}.json"
         )
     endif()
+    if(ly_add_googlebenchmark_BENCHMARK_FILTER)
+        list(APPEND output_format_args "--benchmark_filter=${ly_add_googlebenchmark_BENCHMARK_FILTER}")
+    endif()
 
     if(NOT ly_add_googlebenchmark_TEST_COMMAND)
         # Use the TARGET parameter as the build target if supplied, otherwise fallback to using the NAME parameter
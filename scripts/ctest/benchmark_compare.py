@@ -0,0 +1,214 @@
+"""
+Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+
+SPDX-License-Identifier: Apache-2.0 OR MIT
+
+Stores google benchmark json results as baselines and compares new results against them.
+
+The benchmark runs registered with ly_add_googlebenchmark write one json file per run to <build>/BenchmarkResults.
+    store:   copies those files into <baseline root>/<commit> and marks that commit as the latest baseline
+    compare: matches the benchmarks of two result sets by name and flags the ones that got slower by more than
+             the threshold, or by more than the measured noise when the runs were repeated
+             (--benchmark_repetitions), exiting with 1 if any regressed
+"""
+import argparse
+import glob
+import json
+import os
+import shutil
+import statistics
+import sys
+
+LATEST_BASELINE_FILE = 'latest'
+DEFAULT_THRESHOLD = 0.05
+DEFAULT_NOISE_MULTIPLIER = 3.0
+
+# Conversion to nanoseconds of the time units google benchmark can report
+TIME_UNIT_SCALES = {'ns': 1.0, 'us': 1e3, 'ms': 1e6, 's': 1e9}
+
+
+class BenchmarkMeasure:
+    """
+    Time of a benchmark and its relative noise (standard deviation over mean, 0 if the benchmark ran once).
+    """
+    def __init__(self, time_ns, relative_noise):
+        self.time_ns = time_ns
+        self.relative_noise = relative_noise
+
+
+def _get_time_ns(entry, metric):
+    return float(entry[metric]) * TIME_UNIT_SCALES.get(entry.get('time_unit', 'ns'), 1.0)
+
+
+def parse_benchmark_results(results, metric='cpu_time'):
+    """
+    Extract the measure of each benchmark from google benchmark json output.
+    Median and standard deviation aggregates are used when the run had repetitions, the individual runs otherwise.
+    :param results: Parsed content of a google benchmark json output file.
+    :param metric: 'cpu_time' or 'real_time'.
+    :return: Dictionary of BenchmarkMeasure keyed by benchmark name.
+    """
+    samples = {}
+    aggregates = {}
+    for entry in results.get('benchmarks', []):
+        if entry.get('error_occurred'):
+            continue
+        name = entry.get('run_name', entry['name'])
+        if entry.get('run_type') == 'aggregate':
+            aggregates.setdefault(name, {})[entry.get('aggregate_name')] = _get_time_ns(entry, metric)
+        else:
+            samples.setdefault(name, []).append(_get_time_ns(entry, metric))
+
+    measures = {}
+    for name, times in samples.items():
+        aggregate = aggregates.get(name, {})
+        time_ns = aggregate.get('median', aggregate.get('mean', statistics.median(times)))
+        mean = aggregate.get('mean', statistics.mean(times))
+        if 'stddev' in aggregate:
+            stddev = aggregate['stddev']
+        else:
+            stddev = statistics.stdev(times) if len(times) > 1 else 0.0
+        measures[name] = BenchmarkMeasure(time_ns, stddev / mean if mean > 0 else 0.0)
+    return measures
+
+
+def compare_measures(baseline, current, threshold=DEFAULT_THRESHOLD, noise_multiplier=DEFAULT_NOISE_MULTIPLIER):
+    """
+    Compare the benchmarks found in both result sets.
+    :param baseline: Dictionary of BenchmarkMeasure from the baseline.
+    :param current: Dictionary of BenchmarkMeasure from the new results.
+    :param threshold: Minimum relative slowdown reported as a regression.
+    :param noise_multiplier: The tolerance of a benchmark is at least this many times its relative noise.
+    :return: List of comparison dictionaries sorted by name, with a 'status' of 'regression', 'improvement' or 'same'.
+    """
+    comparisons = []
+    for name in sorted(baseline.keys() & current.keys()):
+        base = baseline[name]
+        new = current[name]
+        if base.time_ns <= 0:
+            continue
+        change = new.time_ns / base.time_ns - 1.0
+        tolerance = max(threshold, noise_multiplier * max(base.relative_noise, new.relative_noise))
+        if change > tolerance:
+            status = 'regression'
+        elif change < -tolerance:
+            status = 'improvement'
+        else:
+            status = 'same'
+        comparisons.append({
+            'name': name,
+            'baseline_ns': base.time_ns,
+            'current_ns': new.time_ns,
+            'change': change,
+            'tolerance': tolerance,
+            'status': status,
+        })
+    return comparisons
+
+
+def _load_measures(path, metric):
+    with open(path) as results_file:
+        return parse_benchmark_results(json.load(results_file), metric)
+
+
+def _resolve_baseline_dir(baseline_path):
+    """
+    A baseline root written by the store command resolves to its latest baseline.
+    """
+    latest_file = os.path.join(baseline_path, LATEST_BASELINE_FILE)
+    if os.path.isfile(latest_file):
+        with open(latest_file) as latest:
+            return os.path.join(baseline_path, latest.readline().strip())
+    return baseline_path
+
+
+def _list_result_files(path):
+    if os.path.isfile(path):
+        return {os.path.basename(path): path}
+    return {os.path.basename(file_path): file_path for file_path in glob.glob(os.path.join(path, '*.json'))}
+
+
+def store_results(results_dir, baseline_root, commit):
+    """
+    Copy the json results of a build into <baseline_root>/<commit> and make it the latest baseline.
+    :return: Number of result files stored.
+    """
+    result_files = _list_result_files(results_dir)
+    destination = os.path.join(baseline_root, commit)
+    os.makedirs(destination, exist_ok=True)
+    for file_name, file_path in result_files.items():
+        shutil.copyfile(file_path, os.path.join(destination, file_name))
+    with open(os.path.join(baseline_root, LATEST_BASELINE_FILE), 'w') as latest:
+        latest.write(commit + '\n')
+    return len(result_files)
+
+
+def compare_results(baseline_path, current_path, metric, threshold, noise_multiplier):
+    """
+    Compare result files with the same name in the baseline and current paths, which can be files or directories.
+    :return: Dictionary of comparison lists keyed by result file name.
+    """
+    baseline_files = _list_result_files(_resolve_baseline_dir(baseline_path))
+    current_files = _list_result_files(current_path)
+    if os.path.isfile(baseline_path) and os.path.isfile(current_path):
+        # Two files are compared with each other whatever their names
+        baseline_files = {os.path.basename(current_path): baseline_path}
+
+    report = {}
+    for file_name in sorted(baseline_files.keys() & current_files.keys()):
+        report[file_name] = compare_measures(
+            _load_measures(baseline_files[file_name], metric),
+            _load_measures(current_files[file_name], metric),
+            threshold, noise_multiplier)
+    return report
+
+
+def _print_report(report):
+    for file_name, comparisons in report.items():
+        regressions = [comparison for comparison in comparisons if comparison['status'] == 'regression']
+        improvements = [comparison for comparison in comparisons if comparison['status'] == 'improvement']
+        print(f'{file_name}: {len(comparisons)} compared, {len(regressions)} regressed, {len(improvements)} improved')
+        for comparison in regressions + improvements:
+            print(f"    {comparison['status'].upper():<11} {comparison['name']}: "
+                  f"{comparison['baseline_ns']:.1f}ns -> {comparison['current_ns']:.1f}ns "
+                  f"({comparison['change']:+.1%}, tolerance {comparison['tolerance']:.1%})")
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Store and compare google benchmark json results.')
+    subparsers = parser.add_subparsers(dest='command', required=True)
+
+    store_parser = subparsers.add_parser('store', help='Store benchmark results as the latest baseline.')
+    store_parser.add_argument('results', help='Directory of json benchmark results, usually <build>/BenchmarkResults.')
+    store_parser.add_argument('baseline_root', help='Directory holding one baseline directory per commit.')
+    store_parser.add_argument('--commit', required=True, help='Name of the baseline, usually the commit hash.')
+
+    compare_parser = subparsers.add_parser('compare', help='Compare benchmark results against a baseline.')
+    compare_parser.add_argument('baseline', help='Baseline json file, directory, or baseline root written by store.')
+    compare_parser.add_argument('current', help='Current json file or directory.')
+    compare_parser.add_argument('--metric', choices=['cpu_time', 'real_time'], default='cpu_time')
+    compare_parser.add_argument('--threshold', type=float, default=DEFAULT_THRESHOLD,
+                                help='Minimum relative slowdown reported as a regression (default: %(default)s).')
+    compare_parser.add_argument('--noise-multiplier', type=float, default=DEFAULT_NOISE_MULTIPLIER,
+                                help='Multiple of the relative noise a benchmark must slow down by (default: %(default)s).')
+    compare_parser.add_argument('--output', help='Write the comparison as json to this file.')
+
+    args = parser.parse_args()
+
+    if args.command == 'store':
+        stored = store_results(args.results, args.baseline_root, args.commit)
+        print(f'Stored {stored} benchmark result files as baseline {args.commit}')
+        return 0
+
+    report = compare_results(args.baseline, args.current, args.metric, args.threshold, args.noise_multiplier)
+    _print_report(report)
+    if args.output:
+        with open(args.output, 'w') as output:
+            json.dump(report, output, indent=4)
+
+    regressed = any(comparison['status'] == 'regression' for comparisons in report.values() for comparison in comparisons)
+    return 1 if regressed else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,73 @@
+"""
+Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+
+SPDX-License-Identifier: Apache-2.0 OR MIT
+
+Self-tests for benchmark_compare.py.
+"""
+import json
+import os
+import tempfile
+import unittest
+
+from benchmark_compare import compare_measures, compare_results, parse_benchmark_results, store_results
+
+
+def _iteration(name, cpu_time, time_unit='ns'):
+    return {'name': name, 'run_name': name, 'run_type': 'iteration', 'cpu_time': cpu_time, 'real_time': cpu_time,
+            'time_unit': time_unit}
+
+
+def _aggregate(name, aggregate_name, cpu_time):
+    return {'name': f'{name}_{aggregate_name}', 'run_name': name, 'run_type': 'aggregate',
+            'aggregate_name': aggregate_name, 'cpu_time': cpu_time, 'real_time': cpu_time, 'time_unit': 'ns'}
+
+
+class BenchmarkCompareTest(unittest.TestCase):
+    def test_parse_ConvertsTimeUnitsToNanoseconds(self):
+        measures = parse_benchmark_results({'benchmarks': [_iteration('BM_A', 2.0, 'us')]})
+        self.assertAlmostEqual(measures['BM_A'].time_ns, 2000.0)
+        self.assertEqual(measures['BM_A'].relative_noise, 0.0)
+
+    def test_parse_UsesMedianAndStddevAggregates(self):
+        results = {'benchmarks': [
+            _iteration('BM_A', 90.0), _iteration('BM_A', 100.0), _iteration('BM_A', 130.0),
+            _aggregate('BM_A', 'mean', 100.0), _aggregate('BM_A', 'median', 95.0), _aggregate('BM_A', 'stddev', 10.0),
+        ]}
+        measures = parse_benchmark_results(results)
+        self.assertAlmostEqual(measures['BM_A'].time_ns, 95.0)
+        self.assertAlmostEqual(measures['BM_A'].relative_noise, 0.1)
+
+    def test_compare_FlagsSlowdownBeyondThreshold(self):
+        baseline = parse_benchmark_results({'benchmarks': [_iteration('BM_A', 100.0), _iteration('BM_B', 100.0)]})
+        current = parse_benchmark_results({'benchmarks': [_iteration('BM_A', 120.0), _iteration('BM_B', 103.0)]})
+        statuses = {comparison['name']: comparison['status'] for comparison in compare_measures(baseline, current, 0.05)}
+        self.assertEqual(statuses, {'BM_A': 'regression', 'BM_B': 'same'})
+
+    def test_compare_NoisyBenchmarkNeedsLargerSlowdown(self):
+        noisy = [_aggregate('BM_A', 'mean', 100.0), _aggregate('BM_A', 'median', 100.0), _aggregate('BM_A', 'stddev', 10.0)]
+        baseline = parse_benchmark_results({'benchmarks': [_iteration('BM_A', 100.0)] + noisy})
+        current = parse_benchmark_results({'benchmarks': [_iteration('BM_A', 120.0)]})
+        comparison = compare_measures(baseline, current, threshold=0.05, noise_multiplier=3.0)[0]
+        self.assertEqual(comparison['status'], 'same')
+        self.assertAlmostEqual(comparison['tolerance'], 0.3)
+
+    def test_storeAndCompare_UsesLatestBaseline(self):
+        with tempfile.TemporaryDirectory() as temp_dir:
+            results_dir = os.path.join(temp_dir, 'BenchmarkResults')
+            baseline_root = os.path.join(temp_dir, 'Baselines')
+            os.makedirs(results_dir)
+            results_path = os.path.join(results_dir, 'AzCore.Benchmarks.Math.json')
+
+            with open(results_path, 'w') as results_file:
+                json.dump({'benchmarks': [_iteration('BM_A', 100.0)]}, results_file)
+            self.assertEqual(store_results(results_dir, baseline_root, 'abc123'), 1)
+
+            with open(results_path, 'w') as results_file:
+                json.dump({'benchmarks': [_iteration('BM_A', 200.0)]}, results_file)
+            report = compare_results(baseline_root, results_dir, 'cpu_time', 0.05, 3.0)
+            self.assertEqual(report['AzCore.Benchmarks.Math.json'][0]['status'], 'regression')
+
+
+if __name__ == '__main__':
+    unittest.main()